@@ -0,0 +1,198 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s).
+#include "traccc/definitions/common.hpp"
+#include "traccc/definitions/primitives.hpp"
+#include "traccc/edm/cell.hpp"
+#include "traccc/edm/spacepoint.hpp"
+
+// VecMem include(s).
+#include <vecmem/memory/memory_resource.hpp>
+
+// System include(s).
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <random>
+#include <vector>
+
+namespace traccc::benchmarks {
+
+/// Number of synthetic detector layers that every track crosses
+static constexpr std::size_t n_synthetic_layers = 6u;
+
+/// Rough number of (reconstructable) tracks per pile-up interaction, used to
+/// size the synthetic events for a given pile-up
+static constexpr std::size_t n_synthetic_tracks_per_interaction = 10u;
+
+/// Cells of a synthetic event
+struct synthetic_cells {
+
+    /// The cells, ordered the same way as by the file readers
+    cell_collection_types::host cells;
+    /// The modules of the cells
+    cell_module_collection_types::host modules;
+
+};  // struct synthetic_cells
+
+/// Make a synthetic event of cells
+///
+/// Every track makes one cluster of 1-3 x 1-3 cells on each of
+/// @c traccc::benchmarks::n_synthetic_layers randomly chosen modules.
+///
+/// @param n_tracks The number of tracks in the event
+/// @param mr The memory resource to create the collections with
+/// @param n_modules The number of modules in the detector
+/// @param seed The seed of the random number generator
+///
+inline synthetic_cells make_synthetic_cells(std::size_t n_tracks,
+                                            vecmem::memory_resource& mr,
+                                            std::size_t n_modules = 10000u,
+                                            unsigned int seed = 42u) {
+
+    std::mt19937 rng{seed};
+    std::uniform_int_distribution<std::size_t> module_dist(0u,
+                                                           n_modules - 1u);
+    std::uniform_int_distribution<channel_id> channel_dist(0u, 1000u);
+    std::uniform_int_distribution<channel_id> size_dist(1u, 3u);
+    std::uniform_real_distribution<scalar> activation_dist(0.1f, 1.f);
+
+    // Generate the cells of every module separately.
+    std::vector<std::vector<cell>> module_cells(n_modules);
+    for (std::size_t i = 0; i < n_tracks * n_synthetic_layers; ++i) {
+        const std::size_t module = module_dist(rng);
+        const channel_id channel0 = channel_dist(rng);
+        const channel_id channel1 = channel_dist(rng);
+        const channel_id size0 = size_dist(rng);
+        const channel_id size1 = size_dist(rng);
+        for (channel_id c0 = 0; c0 < size0; ++c0) {
+            for (channel_id c1 = 0; c1 < size1; ++c1) {
+                cell c;
+                c.channel0 = channel0 + c0;
+                c.channel1 = channel1 + c1;
+                c.activation = activation_dist(rng);
+                module_cells[module].push_back(c);
+            }
+        }
+    }
+
+    // Collect the cells of the modules that were hit, with the cells of every
+    // module sorted by channel1, as the clusterization expects them to be.
+    synthetic_cells result{cell_collection_types::host{&mr},
+                           cell_module_collection_types::host{&mr}};
+    for (std::vector<cell>& cells : module_cells) {
+        if (cells.empty()) {
+            continue;
+        }
+        std::sort(cells.begin(), cells.end(), [](const cell& a, const cell& b) {
+            return (a.channel1 != b.channel1) ? (a.channel1 < b.channel1)
+                                              : (a.channel0 < b.channel0);
+        });
+        // Drop the duplicates of overlapping clusters.
+        cells.erase(std::unique(cells.begin(), cells.end(),
+                                [](const cell& a, const cell& b) {
+                                    return (a.channel0 == b.channel0) &&
+                                           (a.channel1 == b.channel1);
+                                }),
+                    cells.end());
+        const auto link =
+            static_cast<cell::link_type>(result.modules.size());
+        result.modules.push_back({});
+        for (cell& c : cells) {
+            c.module_link = link;
+            result.cells.push_back(c);
+        }
+    }
+    return result;
+}
+
+/// Make a synthetic event of spacepoints
+///
+/// Every track is a helix, starting close to the origin, in a 2 T field along
+/// the z axis. It leaves one spacepoint on each of
+/// @c traccc::benchmarks::n_synthetic_layers cylindrical layers, which are
+/// laid out to be compatible with the default seeding configuration.
+///
+/// @param n_tracks The number of tracks in the event
+/// @param mr The memory resource to create the collection with
+/// @param seed The seed of the random number generator
+///
+inline spacepoint_collection_types::host make_synthetic_spacepoints(
+    std::size_t n_tracks, vecmem::memory_resource& mr,
+    unsigned int seed = 42u) {
+
+    static constexpr std::array<scalar, n_synthetic_layers> radii = {
+        40.f * unit<scalar>::mm,  70.f * unit<scalar>::mm,
+        100.f * unit<scalar>::mm, 130.f * unit<scalar>::mm,
+        160.f * unit<scalar>::mm, 190.f * unit<scalar>::mm};
+    static constexpr scalar b_field = 2.f * unit<scalar>::T;
+
+    std::mt19937 rng{seed};
+    std::uniform_real_distribution<scalar> phi_dist(-M_PI, M_PI);
+    std::uniform_real_distribution<scalar> eta_dist(-2.f, 2.f);
+    std::uniform_real_distribution<scalar> pt_dist(1.f * unit<scalar>::GeV,
+                                                   10.f * unit<scalar>::GeV);
+    std::normal_distribution<scalar> z0_dist(0.f, 50.f * unit<scalar>::mm);
+    std::bernoulli_distribution charge_dist;
+
+    spacepoint_collection_types::host result{&mr};
+    result.reserve(n_tracks * n_synthetic_layers);
+    for (std::size_t i = 0; i < n_tracks; ++i) {
+        const scalar phi0 = phi_dist(rng);
+        const scalar cot_theta = std::sinh(eta_dist(rng));
+        const scalar z0 = z0_dist(rng);
+        const scalar charge = charge_dist(rng) ? 1.f : -1.f;
+        // The radius of the helix in the transverse plane. (With the native
+        // units, the field already includes the speed of light.)
+        const scalar helix_radius = pt_dist(rng) / b_field;
+        for (const scalar r : radii) {
+            // Half of the turning angle of the helix, when crossing the layer.
+            const scalar alpha = std::asin(r / (2.f * helix_radius));
+            const scalar phi = phi0 - charge * alpha;
+            const scalar path = 2.f * helix_radius * alpha;
+            result.push_back({{r * std::cos(phi), r * std::sin(phi),
+                               z0 + cot_theta * path},
+                              {}});
+        }
+    }
+    return result;
+}
+
+/// The seeding efficiency on synthetic spacepoints
+///
+/// The fraction of the tracks with at least one seed made out of only their
+/// own spacepoints, as made by
+/// @c traccc::benchmarks::make_synthetic_spacepoints.
+///
+/// @param seeds The seeds found from the spacepoints
+/// @param n_tracks The number of tracks that the spacepoints were made from
+///
+template <typename seeds_t>
+inline double synthetic_seeding_efficiency(const seeds_t& seeds,
+                                           std::size_t n_tracks) {
+
+    std::vector<bool> found(n_tracks, false);
+    for (const auto& s : seeds) {
+        const std::size_t track = s.spB_link / n_synthetic_layers;
+        if ((track < n_tracks) &&
+            (s.spM_link / n_synthetic_layers == track) &&
+            (s.spT_link / n_synthetic_layers == track)) {
+            found[track] = true;
+        }
+    }
+    return (n_tracks == 0u)
+               ? 0.
+               : static_cast<double>(
+                     std::count(found.begin(), found.end(), true)) /
+                     static_cast<double>(n_tracks);
+}
+
+}  // namespace traccc::benchmarks
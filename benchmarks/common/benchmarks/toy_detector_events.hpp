@@ -0,0 +1,208 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s).
+#include "traccc/definitions/common.hpp"
+#include "traccc/definitions/primitives.hpp"
+#include "traccc/edm/track_candidate.hpp"
+#include "traccc/edm/track_parameters.hpp"
+#include "traccc/simulation/measurement_smearer.hpp"
+#include "traccc/simulation/simulator.hpp"
+#include "traccc/simulation/smearing_recorder.hpp"
+#include "traccc/utils/seed_generator.hpp"
+
+// Detray include(s).
+#include "detray/core/detector.hpp"
+#include "detray/core/detector_metadata.hpp"
+#include "detray/detectors/bfield.hpp"
+#include "detray/detectors/build_toy_detector.hpp"
+#include "detray/io/frontend/detector_reader.hpp"
+#include "detray/io/frontend/detector_writer.hpp"
+#include "detray/navigation/navigator.hpp"
+#include "detray/propagator/rk_stepper.hpp"
+#include "detray/simulation/event_generator/track_generators.hpp"
+
+// VecMem include(s).
+#include <vecmem/memory/host_memory_resource.hpp>
+#include <vecmem/memory/memory_resource.hpp>
+
+// System include(s).
+#include <array>
+#include <cstddef>
+#include <filesystem>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace traccc::benchmarks {
+
+/// Events simulated in memory, in the toy detector
+///
+/// The toy detector is built with the same setup as in the track finding and
+/// fitting tests, and goes through a JSON round trip, so that it would be of
+/// the (default metadata) type that the device algorithms are instantiated
+/// for.
+///
+class toy_detector_events {
+
+    public:
+    /// @name Type declarations
+    /// @{
+
+    /// The detector type on the host
+    using host_detector_type = detray::detector<detray::default_metadata,
+                                                detray::host_container_types>;
+    /// The detector type on the device
+    using device_detector_type =
+        detray::detector<detray::default_metadata,
+                         detray::device_container_types>;
+    /// The magnetic field type
+    using b_field_t = covfie::field<detray::bfield::const_bknd_t>;
+    /// The stepper type used by the finding and fitting
+    using rk_stepper_type = detray::rk_stepper<b_field_t::view_t, transform3,
+                                               detray::constrained_step<>>;
+    /// The navigator type used on the host
+    using host_navigator_type = detray::navigator<const host_detector_type>;
+    /// The navigator type used on the device
+    using device_navigator_type =
+        detray::navigator<const device_detector_type>;
+
+    /// @}
+
+    /// The magnetic field of the detector
+    static constexpr vector3 B{0, 0, 2 * detray::unit<scalar>::T};
+    /// Grid search window of the navigation
+    static const inline std::array<detray::dindex, 2> search_window{3u, 3u};
+
+    /// Simulate some events
+    ///
+    /// @param det_mr The memory resource to create the detector in
+    /// @param n_tracks The number of tracks per event
+    /// @param n_events The number of events to simulate
+    ///
+    toy_detector_events(vecmem::memory_resource& det_mr, std::size_t n_tracks,
+                        std::size_t n_events = 1u)
+        : m_detector(read_detector(det_mr)),
+          m_field(detray::bfield::create_const_field(B)) {
+
+        // Deterministic random number generator of the simulation.
+        using uniform_gen_t = detray::random_numbers<
+            scalar, std::uniform_real_distribution<scalar>, std::seed_seq>;
+        using generator_type =
+            detray::random_track_generator<free_track_parameters,
+                                           uniform_gen_t>;
+        using recorder_type =
+            smearing_recorder<measurement_smearer<transform3>>;
+
+        generator_type::configuration gen_cfg{};
+        gen_cfg.n_tracks(n_tracks);
+        gen_cfg.origin({0.f, 0.f, 0.f});
+        gen_cfg.phi_range(-detray::constant<scalar>::pi,
+                          detray::constant<scalar>::pi);
+        gen_cfg.theta_range(0.1f * detray::constant<scalar>::pi,
+                            0.9f * detray::constant<scalar>::pi);
+        gen_cfg.mom_range(1.f * detray::unit<scalar>::GeV,
+                          10.f * detray::unit<scalar>::GeV);
+
+        measurement_smearer<transform3> smearer(
+            50.f * detray::unit<scalar>::um, 50.f * detray::unit<scalar>::um);
+        typename recorder_type::config recorder_cfg{smearer, &m_store};
+
+        auto sim = simulator<host_detector_type, b_field_t, generator_type,
+                             recorder_type>(n_events, m_detector, m_field,
+                                            generator_type(gen_cfg),
+                                            std::move(recorder_cfg));
+        sim.get_config().propagation.navigation.search_window = search_window;
+        sim.run();
+
+        // Make the truth seeds and candidates of the events.
+        static constexpr std::array<scalar, e_bound_size> stddevs = {
+            0.01f * detray::unit<scalar>::mm,
+            0.01f * detray::unit<scalar>::mm,
+            0.001f,
+            0.001f,
+            0.01f / detray::unit<scalar>::GeV,
+            0.01f * detray::unit<scalar>::ns};
+        seed_generator<host_detector_type> sg(m_detector, stddevs);
+        for (const simulated_event& event : m_store.events()) {
+            m_seeds.push_back(event.truth_seeds(sg, m_host_mr));
+            m_candidates.push_back(event.truth_candidates(sg, m_host_mr));
+        }
+    }
+
+    /// The detector
+    const host_detector_type& detector() const { return m_detector; }
+    /// The magnetic field
+    const b_field_t& field() const { return m_field; }
+    /// The simulated events
+    const std::vector<simulated_event>& events() const {
+        return m_store.events();
+    }
+    /// The truth seeds of the events
+    const std::vector<bound_track_parameters_collection_types::host>& seeds()
+        const {
+        return m_seeds;
+    }
+    /// The truth track candidates of the events
+    const std::vector<track_candidate_container_types::host>& candidates()
+        const {
+        return m_candidates;
+    }
+
+    private:
+    /// Build the toy detector, and read it back from JSON files
+    static host_detector_type read_detector(vecmem::memory_resource& mr) {
+
+        const std::filesystem::path dir =
+            std::filesystem::temp_directory_path() /
+            "traccc_benchmarks_toy_detector";
+        std::filesystem::create_directories(dir);
+
+        {
+            vecmem::host_memory_resource host_mr;
+            detray::toy_det_config<scalar> toy_cfg{};
+            toy_cfg.n_brl_layers(4u).n_edc_layers(7u).do_check(false);
+            toy_cfg.module_mat_thickness(0.11f * detray::unit<scalar>::mm);
+            const auto [det, names] =
+                detray::build_toy_detector(host_mr, toy_cfg);
+            detray::io::write_detector(
+                det, names,
+                detray::io::detector_writer_config{}
+                    .format(detray::io::format::json)
+                    .replace_files(true)
+                    .path(dir.string()));
+        }
+
+        detray::io::detector_reader_config reader_cfg{};
+        reader_cfg.add_file((dir / "toy_detector_geometry.json").string())
+            .add_file(
+                (dir / "toy_detector_homogeneous_material.json").string())
+            .add_file((dir / "toy_detector_surface_grids.json").string());
+        auto det_and_names =
+            detray::io::read_detector<host_detector_type>(mr, reader_cfg);
+        return std::move(det_and_names.first);
+    }
+
+    /// Host memory resource for the seeds and candidates
+    vecmem::host_memory_resource m_host_mr;
+    /// The detector
+    host_detector_type m_detector;
+    /// The magnetic field
+    b_field_t m_field;
+    /// The simulated events
+    simulated_event_store m_store;
+    /// The truth seeds of the events
+    std::vector<bound_track_parameters_collection_types::host> m_seeds;
+    /// The truth track candidates of the events
+    std::vector<track_candidate_container_types::host> m_candidates;
+
+};  // class toy_detector_events
+
+}  // namespace traccc::benchmarks
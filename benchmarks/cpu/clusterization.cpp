@@ -0,0 +1,79 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Local include(s).
+#include "benchmarks/synthetic_data.hpp"
+
+// Project include(s).
+#include "traccc/clusterization/component_connection.hpp"
+#include "traccc/clusterization/measurement_creation.hpp"
+
+// VecMem include(s).
+#include <vecmem/memory/host_memory_resource.hpp>
+
+// Google Benchmark include(s).
+#include <benchmark/benchmark.h>
+
+namespace {
+
+/// Connected component labelling, with SparseCCL only
+void BM_SparseCCL(benchmark::State& state) {
+
+    vecmem::host_memory_resource host_mr;
+    const auto input = traccc::benchmarks::make_synthetic_cells(
+        static_cast<std::size_t>(state.range(0)), host_mr);
+
+    // Occupancies above 1 disable the dense CCL.
+    const traccc::component_connection cc(host_mr, 2.f);
+
+    for (auto _ : state) {
+        auto clusters = cc(input.cells);
+        benchmark::DoNotOptimize(clusters);
+    }
+    state.SetItemsProcessed(state.iterations() *
+                            static_cast<int64_t>(input.cells.size()));
+}
+BENCHMARK(BM_SparseCCL)->RangeMultiplier(10)->Range(10, 100000);
+
+/// Connected component labelling, with the default (sparse/dense) choice
+void BM_ComponentConnection(benchmark::State& state) {
+
+    vecmem::host_memory_resource host_mr;
+    const auto input = traccc::benchmarks::make_synthetic_cells(
+        static_cast<std::size_t>(state.range(0)), host_mr);
+
+    const traccc::component_connection cc(host_mr);
+
+    for (auto _ : state) {
+        auto clusters = cc(input.cells);
+        benchmark::DoNotOptimize(clusters);
+    }
+    state.SetItemsProcessed(state.iterations() *
+                            static_cast<int64_t>(input.cells.size()));
+}
+BENCHMARK(BM_ComponentConnection)->RangeMultiplier(10)->Range(10, 100000);
+
+/// Measurement creation from (already found) clusters
+void BM_MeasurementCreation(benchmark::State& state) {
+
+    vecmem::host_memory_resource host_mr;
+    const auto input = traccc::benchmarks::make_synthetic_cells(
+        static_cast<std::size_t>(state.range(0)), host_mr);
+    const auto clusters = traccc::component_connection(host_mr)(input.cells);
+
+    const traccc::measurement_creation mc(host_mr);
+
+    for (auto _ : state) {
+        auto measurements = mc(clusters, input.modules);
+        benchmark::DoNotOptimize(measurements);
+    }
+    state.SetItemsProcessed(state.iterations() *
+                            static_cast<int64_t>(clusters.size()));
+}
+BENCHMARK(BM_MeasurementCreation)->RangeMultiplier(10)->Range(10, 100000);
+
+}  // namespace
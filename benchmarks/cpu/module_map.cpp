@@ -0,0 +1,102 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Project include(s).
+#include "traccc/definitions/primitives.hpp"
+#include "traccc/geometry/hashed_module_map.hpp"
+#include "traccc/geometry/module_map.hpp"
+
+// Google Benchmark include(s).
+#include <benchmark/benchmark.h>
+
+// System include(s).
+#include <cstdint>
+#include <map>
+#include <random>
+#include <vector>
+
+namespace {
+
+/// Make a geometry with a given number of contiguous ranges of modules
+///
+/// Every range holds 250 modules, which for 71 ranges approximates the
+/// layout of the TrackML detector.
+///
+std::map<traccc::geometry_id, traccc::transform3> make_geometry(
+    std::size_t n_ranges) {
+
+    std::map<traccc::geometry_id, traccc::transform3> result;
+    for (std::size_t r = 0; r < n_ranges; ++r) {
+        const traccc::geometry_id start = (r + 1) * (std::uint64_t{1} << 20);
+        for (traccc::geometry_id i = 0; i < 250; ++i) {
+            result.emplace(
+                start + i,
+                traccc::transform3{traccc::vector3{static_cast<float>(r),
+                                                   static_cast<float>(i), 0.f},
+                                   traccc::vector3{0.f, 0.f, 1.f},
+                                   traccc::vector3{1.f, 0.f, 0.f}});
+        }
+    }
+    return result;
+}
+
+/// Make a (random) sequence of existing keys to look up
+std::vector<traccc::geometry_id> make_lookups(
+    const std::map<traccc::geometry_id, traccc::transform3>& geometry) {
+
+    std::vector<traccc::geometry_id> keys;
+    keys.reserve(geometry.size());
+    for (const auto& [key, value] : geometry) {
+        keys.push_back(key);
+    }
+    std::mt19937_64 gen{42u};
+    std::uniform_int_distribution<std::size_t> dist(0, keys.size() - 1);
+    std::vector<traccc::geometry_id> result(10000);
+    for (traccc::geometry_id& key : result) {
+        key = keys[dist(gen)];
+    }
+    return result;
+}
+
+/// Lookups in the (tree based) module map
+void BM_ModuleMapTree(benchmark::State& state) {
+
+    const auto geometry =
+        make_geometry(static_cast<std::size_t>(state.range(0)));
+    const auto lookups = make_lookups(geometry);
+    const traccc::module_map<> map(geometry);
+
+    for (auto _ : state) {
+        for (const traccc::geometry_id key : lookups) {
+            benchmark::DoNotOptimize(&map[key]);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() *
+                            static_cast<int64_t>(lookups.size()));
+}
+BENCHMARK(BM_ModuleMapTree)->RangeMultiplier(4)->Range(1, 256);
+
+/// Lookups in the hashed module map
+void BM_ModuleMapHashed(benchmark::State& state) {
+
+    const auto geometry =
+        make_geometry(static_cast<std::size_t>(state.range(0)));
+    const auto lookups = make_lookups(geometry);
+    const traccc::hashed_module_map<> map(geometry);
+    const traccc::hashed_module_map_device<> device(map.view());
+
+    for (auto _ : state) {
+        for (const traccc::geometry_id key : lookups) {
+            benchmark::DoNotOptimize(device.find(key));
+        }
+    }
+    state.SetItemsProcessed(state.iterations() *
+                            static_cast<int64_t>(lookups.size()));
+}
+BENCHMARK(BM_ModuleMapHashed)->RangeMultiplier(4)->Range(1, 256);
+
+}  // namespace
@@ -0,0 +1,170 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Local include(s).
+#include "benchmarks/synthetic_data.hpp"
+
+// Project include(s).
+#include "traccc/seeding/detail/hough_seeding_config.hpp"
+#include "traccc/seeding/detail/seeding_config.hpp"
+#include "traccc/seeding/hough_seeding_algorithm.hpp"
+#include "traccc/seeding/seed_finding.hpp"
+#include "traccc/seeding/seeding_algorithm.hpp"
+#include "traccc/seeding/spacepoint_binning.hpp"
+#include "traccc/seeding/track_params_estimation.hpp"
+
+// VecMem include(s).
+#include <vecmem/memory/host_memory_resource.hpp>
+
+// Google Benchmark include(s).
+#include <benchmark/benchmark.h>
+
+namespace {
+
+/// Spacepoint binning into the Phi-Z grid
+void BM_SpacepointBinning(benchmark::State& state) {
+
+    vecmem::host_memory_resource host_mr;
+    const auto spacepoints = traccc::benchmarks::make_synthetic_spacepoints(
+        static_cast<std::size_t>(state.range(0)), host_mr);
+
+    const traccc::seedfinder_config finder_config;
+    const traccc::spacepoint_binning sb(
+        finder_config, traccc::spacepoint_grid_config(finder_config), host_mr);
+
+    for (auto _ : state) {
+        auto grid = sb(spacepoints);
+        benchmark::DoNotOptimize(grid);
+    }
+    state.SetItemsProcessed(state.iterations() *
+                            static_cast<int64_t>(spacepoints.size()));
+}
+BENCHMARK(BM_SpacepointBinning)->RangeMultiplier(10)->Range(10, 10000);
+
+/// Seed finding on (already binned) spacepoints
+void BM_SeedFinding(benchmark::State& state) {
+
+    vecmem::host_memory_resource host_mr;
+    const auto spacepoints = traccc::benchmarks::make_synthetic_spacepoints(
+        static_cast<std::size_t>(state.range(0)), host_mr);
+
+    const traccc::seedfinder_config finder_config;
+    const traccc::seedfilter_config filter_config;
+    const auto grid = traccc::spacepoint_binning(
+        finder_config, traccc::spacepoint_grid_config(finder_config),
+        host_mr)(spacepoints);
+
+    const traccc::seed_finding sf(finder_config, filter_config);
+
+    for (auto _ : state) {
+        auto seeds = sf(spacepoints, grid);
+        benchmark::DoNotOptimize(seeds);
+    }
+    state.SetItemsProcessed(state.iterations() *
+                            static_cast<int64_t>(spacepoints.size()));
+}
+BENCHMARK(BM_SeedFinding)
+    ->RangeMultiplier(10)
+    ->Range(10, 10000)
+    ->Unit(benchmark::kMillisecond);
+
+/// Track parameter estimation from (already found) seeds
+void BM_TrackParamsEstimation(benchmark::State& state) {
+
+    vecmem::host_memory_resource host_mr;
+    const auto spacepoints = traccc::benchmarks::make_synthetic_spacepoints(
+        static_cast<std::size_t>(state.range(0)), host_mr);
+
+    const traccc::seedfinder_config finder_config;
+    const traccc::seedfilter_config filter_config;
+    const auto grid = traccc::spacepoint_binning(
+        finder_config, traccc::spacepoint_grid_config(finder_config),
+        host_mr)(spacepoints);
+    const auto seeds =
+        traccc::seed_finding(finder_config, filter_config)(spacepoints, grid);
+
+    const traccc::track_params_estimation tp(host_mr);
+
+    for (auto _ : state) {
+        auto params =
+            tp(spacepoints, seeds, {0.f, 0.f, finder_config.bFieldInZ});
+        benchmark::DoNotOptimize(params);
+    }
+    state.SetItemsProcessed(state.iterations() *
+                            static_cast<int64_t>(seeds.size()));
+}
+BENCHMARK(BM_TrackParamsEstimation)->RangeMultiplier(10)->Range(10, 10000);
+
+/// Triplet seeding of synthetic events, at a given pile-up
+void BM_TripletSeedingPileup(benchmark::State& state) {
+
+    vecmem::host_memory_resource host_mr;
+    const std::size_t n_tracks =
+        static_cast<std::size_t>(state.range(0)) *
+        traccc::benchmarks::n_synthetic_tracks_per_interaction;
+    const auto spacepoints =
+        traccc::benchmarks::make_synthetic_spacepoints(n_tracks, host_mr);
+
+    const traccc::seedfinder_config finder_config;
+    const traccc::seeding_algorithm sa(
+        finder_config, traccc::spacepoint_grid_config(finder_config),
+        traccc::seedfilter_config{}, host_mr);
+
+    // Measure the efficiency of the seeding once, outside of the timing.
+    const auto reference_seeds = sa(spacepoints);
+    state.counters["seeds"] = static_cast<double>(reference_seeds.size());
+    state.counters["efficiency"] =
+        traccc::benchmarks::synthetic_seeding_efficiency(reference_seeds,
+                                                         n_tracks);
+
+    for (auto _ : state) {
+        auto seeds = sa(spacepoints);
+        benchmark::DoNotOptimize(seeds);
+    }
+    state.SetItemsProcessed(state.iterations() *
+                            static_cast<int64_t>(spacepoints.size()));
+}
+BENCHMARK(BM_TripletSeedingPileup)
+    ->Arg(60)
+    ->Arg(140)
+    ->Arg(200)
+    ->Unit(benchmark::kMillisecond);
+
+/// Hough transform seeding of synthetic events, at a given pile-up
+void BM_HoughSeedingPileup(benchmark::State& state) {
+
+    vecmem::host_memory_resource host_mr;
+    const std::size_t n_tracks =
+        static_cast<std::size_t>(state.range(0)) *
+        traccc::benchmarks::n_synthetic_tracks_per_interaction;
+    const auto spacepoints =
+        traccc::benchmarks::make_synthetic_spacepoints(n_tracks, host_mr);
+
+    const traccc::hough_seeding_algorithm sa(
+        traccc::hough_seeding_config{traccc::seedfinder_config{}}, host_mr);
+
+    // Measure the efficiency of the seeding once, outside of the timing.
+    const auto reference_seeds = sa(spacepoints);
+    state.counters["seeds"] = static_cast<double>(reference_seeds.size());
+    state.counters["efficiency"] =
+        traccc::benchmarks::synthetic_seeding_efficiency(reference_seeds,
+                                                         n_tracks);
+
+    for (auto _ : state) {
+        auto seeds = sa(spacepoints);
+        benchmark::DoNotOptimize(seeds);
+    }
+    state.SetItemsProcessed(state.iterations() *
+                            static_cast<int64_t>(spacepoints.size()));
+}
+BENCHMARK(BM_HoughSeedingPileup)
+    ->Arg(60)
+    ->Arg(140)
+    ->Arg(200)
+    ->Unit(benchmark::kMillisecond);
+
+}  // namespace
@@ -0,0 +1,83 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Local include(s).
+#include "benchmarks/toy_detector_events.hpp"
+
+// Project include(s).
+#include "traccc/finding/finding_algorithm.hpp"
+#include "traccc/fitting/fitting_algorithm.hpp"
+#include "traccc/fitting/kalman_filter/kalman_fitter.hpp"
+
+// VecMem include(s).
+#include <vecmem/memory/host_memory_resource.hpp>
+
+// Google Benchmark include(s).
+#include <benchmark/benchmark.h>
+
+namespace {
+
+/// Type of the events used by the benchmarks
+using events_type = traccc::benchmarks::toy_detector_events;
+
+/// Combinatorial Kalman filter track finding, from truth seeds
+void BM_CombinatorialKalmanFilter(benchmark::State& state) {
+
+    vecmem::host_memory_resource host_mr;
+    const events_type events(host_mr,
+                             static_cast<std::size_t>(state.range(0)));
+
+    using algorithm_type =
+        traccc::finding_algorithm<events_type::rk_stepper_type,
+                                  events_type::host_navigator_type>;
+    algorithm_type::config_type cfg;
+    cfg.propagation.navigation.search_window = events_type::search_window;
+    const algorithm_type finding(cfg);
+
+    for (auto _ : state) {
+        auto candidates =
+            finding(events.detector(), events.field(),
+                    events.events()[0].measurements, events.seeds()[0]);
+        benchmark::DoNotOptimize(candidates);
+    }
+    state.SetItemsProcessed(state.iterations() *
+                            static_cast<int64_t>(events.seeds()[0].size()));
+}
+BENCHMARK(BM_CombinatorialKalmanFilter)
+    ->RangeMultiplier(10)
+    ->Range(1, 1000)
+    ->Unit(benchmark::kMillisecond);
+
+/// Kalman fitting of truth track candidates
+void BM_KalmanFitter(benchmark::State& state) {
+
+    vecmem::host_memory_resource host_mr;
+    const events_type events(host_mr,
+                             static_cast<std::size_t>(state.range(0)));
+
+    using algorithm_type = traccc::fitting_algorithm<
+        traccc::kalman_fitter<events_type::rk_stepper_type,
+                              events_type::host_navigator_type>>;
+    algorithm_type::config_type cfg;
+    cfg.propagation.navigation.search_window = events_type::search_window;
+    const algorithm_type fitting(cfg);
+
+    for (auto _ : state) {
+        auto track_states = fitting(events.detector(), events.field(),
+                                    events.candidates()[0]);
+        benchmark::DoNotOptimize(track_states);
+    }
+    state.SetItemsProcessed(
+        state.iterations() *
+        static_cast<int64_t>(events.candidates()[0].size()));
+}
+BENCHMARK(BM_KalmanFitter)
+    ->RangeMultiplier(10)
+    ->Range(1, 1000)
+    ->Unit(benchmark::kMillisecond);
+
+}  // namespace
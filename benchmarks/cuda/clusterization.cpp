@@ -0,0 +1,61 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Local include(s).
+#include "benchmarks/synthetic_data.hpp"
+
+// Project include(s).
+#include "traccc/cuda/clusterization/clusterization_algorithm.hpp"
+#include "traccc/cuda/utils/stream.hpp"
+#include "traccc/utils/memory_resource.hpp"
+
+// VecMem include(s).
+#include <vecmem/memory/cuda/device_memory_resource.hpp>
+#include <vecmem/memory/cuda/host_memory_resource.hpp>
+#include <vecmem/utils/cuda/async_copy.hpp>
+
+// Google Benchmark include(s).
+#include <benchmark/benchmark.h>
+
+namespace {
+
+/// Clusterization (CCL + measurement and spacepoint creation) on the device
+void BM_CudaClusterization(benchmark::State& state) {
+
+    vecmem::cuda::host_memory_resource host_mr;
+    vecmem::cuda::device_memory_resource device_mr;
+    const traccc::memory_resource mr{device_mr, &host_mr};
+    traccc::cuda::stream stream;
+    vecmem::cuda::async_copy copy{stream.cudaStream()};
+
+    // Put the cells onto the device, outside of the timed loop.
+    const auto input = traccc::benchmarks::make_synthetic_cells(
+        static_cast<std::size_t>(state.range(0)), host_mr);
+    traccc::cell_collection_types::buffer cells_buffer(
+        static_cast<unsigned int>(input.cells.size()), device_mr);
+    copy(vecmem::get_data(input.cells), cells_buffer);
+    traccc::cell_module_collection_types::buffer modules_buffer(
+        static_cast<unsigned int>(input.modules.size()), device_mr);
+    copy(vecmem::get_data(input.modules), modules_buffer);
+    stream.synchronize();
+
+    const traccc::cuda::clusterization_algorithm ca(mr, copy, stream, 1024);
+
+    for (auto _ : state) {
+        auto spacepoints = ca(cells_buffer, modules_buffer);
+        stream.synchronize();
+        benchmark::DoNotOptimize(spacepoints);
+    }
+    state.SetItemsProcessed(state.iterations() *
+                            static_cast<int64_t>(input.cells.size()));
+}
+BENCHMARK(BM_CudaClusterization)
+    ->RangeMultiplier(10)
+    ->Range(10, 100000)
+    ->UseRealTime();
+
+}  // namespace
@@ -0,0 +1,196 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Local include(s).
+#include "benchmarks/synthetic_data.hpp"
+
+// Project include(s).
+#include "traccc/cuda/seeding/hough_seeding_algorithm.hpp"
+#include "traccc/cuda/seeding/seed_finding.hpp"
+#include "traccc/cuda/seeding/seeding_algorithm.hpp"
+#include "traccc/cuda/seeding/spacepoint_binning.hpp"
+#include "traccc/cuda/seeding/track_params_estimation.hpp"
+#include "traccc/cuda/utils/stream.hpp"
+#include "traccc/seeding/detail/hough_seeding_config.hpp"
+#include "traccc/seeding/detail/seeding_config.hpp"
+#include "traccc/utils/memory_resource.hpp"
+
+// VecMem include(s).
+#include <vecmem/memory/cuda/device_memory_resource.hpp>
+#include <vecmem/memory/cuda/host_memory_resource.hpp>
+#include <vecmem/utils/cuda/async_copy.hpp>
+
+// Google Benchmark include(s).
+#include <benchmark/benchmark.h>
+
+namespace {
+
+/// Common setup of the seeding benchmarks
+struct seeding_setup {
+
+    explicit seeding_setup(std::size_t n_tracks)
+        : mr{device_mr, &host_mr},
+          copy{stream.cudaStream()},
+          spacepoints{
+              traccc::benchmarks::make_synthetic_spacepoints(n_tracks,
+                                                             host_mr)},
+          spacepoints_buffer{static_cast<unsigned int>(spacepoints.size()),
+                             device_mr} {
+
+        copy(vecmem::get_data(spacepoints), spacepoints_buffer);
+        stream.synchronize();
+    }
+
+    vecmem::cuda::host_memory_resource host_mr;
+    vecmem::cuda::device_memory_resource device_mr;
+    traccc::memory_resource mr;
+    traccc::cuda::stream stream;
+    vecmem::cuda::async_copy copy;
+
+    traccc::seedfinder_config finder_config;
+    traccc::seedfilter_config filter_config;
+
+    traccc::spacepoint_collection_types::host spacepoints;
+    traccc::spacepoint_collection_types::buffer spacepoints_buffer;
+};
+
+/// Run one of the seeding engines on synthetic events at a given pile-up
+template <typename seeding_algorithm_t>
+void run_pileup_seeding(benchmark::State& state, seeding_setup& setup,
+                        std::size_t n_tracks,
+                        const seeding_algorithm_t& sa) {
+
+    // Measure the efficiency of the seeding once, outside of the timing.
+    traccc::seed_collection_types::host seeds_host{&setup.host_mr};
+    setup.copy(sa(setup.spacepoints_buffer), seeds_host)->wait();
+    state.counters["seeds"] = static_cast<double>(seeds_host.size());
+    state.counters["efficiency"] =
+        traccc::benchmarks::synthetic_seeding_efficiency(seeds_host,
+                                                         n_tracks);
+
+    for (auto _ : state) {
+        auto seeds = sa(setup.spacepoints_buffer);
+        setup.stream.synchronize();
+        benchmark::DoNotOptimize(seeds);
+    }
+    state.SetItemsProcessed(state.iterations() *
+                            static_cast<int64_t>(setup.spacepoints.size()));
+}
+
+/// Spacepoint binning into the Phi-Z grid
+void BM_CudaSpacepointBinning(benchmark::State& state) {
+
+    seeding_setup setup(static_cast<std::size_t>(state.range(0)));
+    const traccc::cuda::spacepoint_binning sb(
+        setup.finder_config,
+        traccc::spacepoint_grid_config(setup.finder_config), setup.mr,
+        setup.copy, setup.stream);
+
+    for (auto _ : state) {
+        auto grid = sb(setup.spacepoints_buffer);
+        setup.stream.synchronize();
+        benchmark::DoNotOptimize(grid);
+    }
+    state.SetItemsProcessed(state.iterations() *
+                            static_cast<int64_t>(setup.spacepoints.size()));
+}
+BENCHMARK(BM_CudaSpacepointBinning)
+    ->RangeMultiplier(10)
+    ->Range(10, 10000)
+    ->UseRealTime();
+
+/// Seed finding on (already binned) spacepoints
+void BM_CudaSeedFinding(benchmark::State& state) {
+
+    seeding_setup setup(static_cast<std::size_t>(state.range(0)));
+    const auto grid = traccc::cuda::spacepoint_binning(
+        setup.finder_config,
+        traccc::spacepoint_grid_config(setup.finder_config), setup.mr,
+        setup.copy, setup.stream)(setup.spacepoints_buffer);
+    const traccc::cuda::seed_finding sf(setup.finder_config,
+                                        setup.filter_config, setup.mr,
+                                        setup.copy, setup.stream);
+
+    for (auto _ : state) {
+        auto seeds = sf(setup.spacepoints_buffer, grid);
+        setup.stream.synchronize();
+        benchmark::DoNotOptimize(seeds);
+    }
+    state.SetItemsProcessed(state.iterations() *
+                            static_cast<int64_t>(setup.spacepoints.size()));
+}
+BENCHMARK(BM_CudaSeedFinding)
+    ->RangeMultiplier(10)
+    ->Range(10, 10000)
+    ->UseRealTime();
+
+/// Track parameter estimation from (already found) seeds
+void BM_CudaTrackParamsEstimation(benchmark::State& state) {
+
+    seeding_setup setup(static_cast<std::size_t>(state.range(0)));
+    const auto grid = traccc::cuda::spacepoint_binning(
+        setup.finder_config,
+        traccc::spacepoint_grid_config(setup.finder_config), setup.mr,
+        setup.copy, setup.stream)(setup.spacepoints_buffer);
+    const auto seeds = traccc::cuda::seed_finding(
+        setup.finder_config, setup.filter_config, setup.mr, setup.copy,
+        setup.stream)(setup.spacepoints_buffer, grid);
+    const traccc::cuda::track_params_estimation tp(setup.mr, setup.copy,
+                                                   setup.stream);
+
+    for (auto _ : state) {
+        auto params = tp(setup.spacepoints_buffer, seeds,
+                         {0.f, 0.f, setup.finder_config.bFieldInZ});
+        setup.stream.synchronize();
+        benchmark::DoNotOptimize(params);
+    }
+    state.SetItemsProcessed(state.iterations() *
+                            static_cast<int64_t>(setup.copy.get_size(seeds)));
+}
+BENCHMARK(BM_CudaTrackParamsEstimation)
+    ->RangeMultiplier(10)
+    ->Range(10, 10000)
+    ->UseRealTime();
+
+/// Triplet seeding of synthetic events, at a given pile-up
+void BM_CudaTripletSeedingPileup(benchmark::State& state) {
+
+    const std::size_t n_tracks =
+        static_cast<std::size_t>(state.range(0)) *
+        traccc::benchmarks::n_synthetic_tracks_per_interaction;
+    seeding_setup setup(n_tracks);
+    const traccc::cuda::seeding_algorithm sa(
+        setup.finder_config,
+        traccc::spacepoint_grid_config(setup.finder_config),
+        setup.filter_config, setup.mr, setup.copy, setup.stream);
+    run_pileup_seeding(state, setup, n_tracks, sa);
+}
+BENCHMARK(BM_CudaTripletSeedingPileup)
+    ->Arg(60)
+    ->Arg(140)
+    ->Arg(200)
+    ->UseRealTime();
+
+/// Hough transform seeding of synthetic events, at a given pile-up
+void BM_CudaHoughSeedingPileup(benchmark::State& state) {
+
+    const std::size_t n_tracks =
+        static_cast<std::size_t>(state.range(0)) *
+        traccc::benchmarks::n_synthetic_tracks_per_interaction;
+    seeding_setup setup(n_tracks);
+    const traccc::cuda::hough_seeding_algorithm sa(
+        traccc::hough_seeding_config{setup.finder_config}, setup.mr,
+        setup.copy, setup.stream);
+    run_pileup_seeding(state, setup, n_tracks, sa);
+}
+BENCHMARK(BM_CudaHoughSeedingPileup)
+    ->Arg(60)
+    ->Arg(140)
+    ->Arg(200)
+    ->UseRealTime();
+
+}  // namespace
@@ -0,0 +1,208 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Local include(s).
+#include "benchmarks/toy_detector_events.hpp"
+
+// Project include(s).
+#include "traccc/cuda/finding/finding_algorithm.hpp"
+#include "traccc/cuda/fitting/fitting_algorithm.hpp"
+#include "traccc/cuda/utils/managed_memory_policy.hpp"
+#include "traccc/cuda/utils/stream.hpp"
+#include "traccc/device/container_h2d_copy_alg.hpp"
+#include "traccc/fitting/kalman_filter/kalman_fitter.hpp"
+#include "traccc/utils/memory_resource.hpp"
+
+// VecMem include(s).
+#include <vecmem/memory/cuda/device_memory_resource.hpp>
+#include <vecmem/memory/cuda/managed_memory_resource.hpp>
+#include <vecmem/memory/host_memory_resource.hpp>
+#include <vecmem/utils/cuda/async_copy.hpp>
+
+// Google Benchmark include(s).
+#include <benchmark/benchmark.h>
+
+// System include(s).
+#include <optional>
+
+namespace {
+
+/// Type of the events used by the benchmarks
+using events_type = traccc::benchmarks::toy_detector_events;
+
+/// Combinatorial Kalman filter track finding, from truth seeds
+void BM_CudaCombinatorialKalmanFilter(benchmark::State& state) {
+
+    vecmem::host_memory_resource host_mr;
+    vecmem::cuda::device_memory_resource device_mr;
+    vecmem::cuda::managed_memory_resource mng_mr;
+    const traccc::memory_resource mr{device_mr, &host_mr};
+    traccc::cuda::stream stream;
+    vecmem::cuda::async_copy copy{stream.cudaStream()};
+
+    // The detector needs to be accessible from the device.
+    const events_type events(mng_mr, static_cast<std::size_t>(state.range(0)));
+    const auto det_view = detray::get_data(events.detector());
+
+    using algorithm_type =
+        traccc::cuda::finding_algorithm<events_type::rk_stepper_type,
+                                        events_type::device_navigator_type>;
+    algorithm_type::config_type cfg;
+    cfg.propagation.navigation.search_window = events_type::search_window;
+    const algorithm_type finding(cfg, mr, copy, stream);
+
+    // Put the inputs onto the device, outside of the timed loop.
+    const auto& measurements = events.events()[0].measurements;
+    traccc::measurement_collection_types::buffer measurements_buffer(
+        static_cast<unsigned int>(measurements.size()), mr.main);
+    copy(vecmem::get_data(measurements), measurements_buffer);
+    const auto& seeds = events.seeds()[0];
+    traccc::bound_track_parameters_collection_types::buffer seeds_buffer(
+        static_cast<unsigned int>(seeds.size()), mr.main);
+    copy(vecmem::get_data(seeds), seeds_buffer);
+    auto navigation_buffer = detray::create_candidates_buffer(
+        events.detector(), cfg.max_num_branches_per_seed * seeds.size(),
+        mr.main, mr.host);
+    stream.synchronize();
+
+    for (auto _ : state) {
+        auto candidates = finding(det_view, events.field(), navigation_buffer,
+                                  measurements_buffer, seeds_buffer);
+        stream.synchronize();
+        benchmark::DoNotOptimize(candidates);
+    }
+    state.SetItemsProcessed(state.iterations() *
+                            static_cast<int64_t>(seeds.size()));
+}
+BENCHMARK(BM_CudaCombinatorialKalmanFilter)
+    ->RangeMultiplier(10)
+    ->Range(1, 1000)
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
+
+/// Kalman fitting of truth track candidates
+void BM_CudaKalmanFitter(benchmark::State& state) {
+
+    vecmem::host_memory_resource host_mr;
+    vecmem::cuda::device_memory_resource device_mr;
+    vecmem::cuda::managed_memory_resource mng_mr;
+    const traccc::memory_resource mr{device_mr, &host_mr};
+    traccc::cuda::stream stream;
+    vecmem::cuda::async_copy copy{stream.cudaStream()};
+
+    // The detector needs to be accessible from the device.
+    const events_type events(mng_mr, static_cast<std::size_t>(state.range(0)));
+    const auto det_view = detray::get_data(events.detector());
+
+    using algorithm_type = traccc::cuda::fitting_algorithm<
+        traccc::kalman_fitter<events_type::rk_stepper_type,
+                              events_type::device_navigator_type>>;
+    algorithm_type::config_type cfg;
+    cfg.propagation.navigation.search_window = events_type::search_window;
+    const algorithm_type fitting(cfg, mr, copy, stream);
+
+    // Put the inputs onto the device, outside of the timed loop.
+    const auto& candidates = events.candidates()[0];
+    const traccc::track_candidate_container_types::buffer candidates_buffer =
+        traccc::device::container_h2d_copy_alg<
+            traccc::track_candidate_container_types>{mr, copy}(
+            traccc::get_data(candidates));
+    auto navigation_buffer = detray::create_candidates_buffer(
+        events.detector(), candidates.size(), mr.main, mr.host);
+    stream.synchronize();
+
+    for (auto _ : state) {
+        auto track_states = fitting(det_view, events.field(),
+                                    navigation_buffer, candidates_buffer);
+        stream.synchronize();
+        benchmark::DoNotOptimize(track_states);
+    }
+    state.SetItemsProcessed(state.iterations() *
+                            static_cast<int64_t>(candidates.size()));
+}
+BENCHMARK(BM_CudaKalmanFitter)
+    ->RangeMultiplier(10)
+    ->Range(1, 1000)
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
+
+/// Kalman fitting of the first event after (re-)loading the detector
+///
+/// Compares where the fitting finds the detector: in managed memory that it
+/// has to page fault onto the device (0), in managed memory that is
+/// prefetched to the device with the read-mostly policy (1), or in explicit
+/// device buffers (2). Before every iteration the managed detector is
+/// migrated back to the host, as it would be after being set up, or after
+/// being evicted from an oversubscribed device. The prefetching (but not the
+/// one-off copy into the device buffers) is part of the timed region.
+///
+void BM_CudaKalmanFitterDetectorMemory(benchmark::State& state) {
+
+    vecmem::host_memory_resource host_mr;
+    vecmem::cuda::device_memory_resource device_mr;
+    vecmem::cuda::managed_memory_resource mng_mr;
+    traccc::cuda::managed_memory_policy detector_mr{
+        mng_mr, traccc::cuda::managed_memory_policy::usage::read_mostly};
+    const traccc::memory_resource mr{device_mr, &host_mr};
+    traccc::cuda::stream stream;
+    vecmem::cuda::async_copy copy{stream.cudaStream()};
+
+    const int64_t mode = state.range(0);
+    const events_type events(detector_mr, 100u);
+
+    // The detector, as seen by the fitting.
+    std::optional<decltype(detray::get_buffer(events.detector(), device_mr,
+                                              copy))>
+        detector_buffer;
+    auto det_view = detray::get_data(events.detector());
+    if (mode == 2) {
+        detector_buffer.emplace(
+            detray::get_buffer(events.detector(), device_mr, copy));
+        det_view = detray::get_data(*detector_buffer);
+    }
+
+    using algorithm_type = traccc::cuda::fitting_algorithm<
+        traccc::kalman_fitter<events_type::rk_stepper_type,
+                              events_type::device_navigator_type>>;
+    algorithm_type::config_type cfg;
+    cfg.propagation.navigation.search_window = events_type::search_window;
+    const algorithm_type fitting(cfg, mr, copy, stream);
+
+    // Put the inputs onto the device, outside of the timed loop.
+    const auto& candidates = events.candidates()[0];
+    const traccc::track_candidate_container_types::buffer candidates_buffer =
+        traccc::device::container_h2d_copy_alg<
+            traccc::track_candidate_container_types>{mr, copy}(
+            traccc::get_data(candidates));
+    auto navigation_buffer = detray::create_candidates_buffer(
+        events.detector(), candidates.size(), mr.main, mr.host);
+    stream.synchronize();
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        detector_mr.prefetch_to_host(stream);
+        stream.synchronize();
+        state.ResumeTiming();
+
+        if (mode == 1) {
+            detector_mr.prefetch_to_device(stream);
+        }
+        auto track_states = fitting(det_view, events.field(),
+                                    navigation_buffer, candidates_buffer);
+        stream.synchronize();
+        benchmark::DoNotOptimize(track_states);
+    }
+    state.SetItemsProcessed(state.iterations() *
+                            static_cast<int64_t>(candidates.size()));
+}
+BENCHMARK(BM_CudaKalmanFitterDetectorMemory)
+    ->ArgName("detector_memory")
+    ->DenseRange(0, 2)
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
+
+}  // namespace
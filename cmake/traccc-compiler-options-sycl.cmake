@@ -28,6 +28,18 @@ if( NOT WIN32 )
    endforeach()
 endif()
 
+# Compile the device code ahead of time, if asked for it. This spares the jobs
+# the just-in-time compilation of all of their kernels at startup.
+set( TRACCC_SYCL_AOT_TARGETS "" CACHE STRING
+   "SYCL target(s) to compile the device code for ahead of time (-fsycl-targets)" )
+mark_as_advanced( TRACCC_SYCL_AOT_TARGETS )
+if( NOT "${TRACCC_SYCL_AOT_TARGETS}" STREQUAL "" )
+   foreach( mode RELEASE RELWITHDEBINFO MINSIZEREL DEBUG )
+      traccc_add_flag( CMAKE_SYCL_FLAGS_${mode}
+         "-fsycl-targets=${TRACCC_SYCL_AOT_TARGETS}" )
+   endforeach()
+endif()
+
 # Fail on warnings, if asked for that behaviour.
 if( TRACCC_FAIL_ON_WARNINGS )
    foreach( mode RELEASE RELWITHDEBINFO MINSIZEREL DEBUG )
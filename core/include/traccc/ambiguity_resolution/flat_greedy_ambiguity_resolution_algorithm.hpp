@@ -0,0 +1,73 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s).
+#include "traccc/edm/track_state.hpp"
+#include "traccc/utils/algorithm.hpp"
+
+// System include(s).
+#include <cstddef>
+#include <cstdint>
+
+namespace traccc {
+
+/// Greedy ambiguity resolution, using flat arrays
+///
+/// Evicts the same tracks as @c traccc::greedy_ambiguity_resolution_algorithm,
+/// in the same order. But instead of node based containers, the tracks of
+/// every measurement are stored in one flat (CSR) array, and the tracks are
+/// kept in a d-ary heap ordered by their relative number of shared
+/// measurements and their chi-square. When a track is evicted, only the
+/// tracks sharing a measurement with it are updated in the heap. So every
+/// iteration is logarithmic, instead of linear, in the number of tracks.
+///
+class flat_greedy_ambiguity_resolution_algorithm
+    : public algorithm<track_state_container_types::host(
+          const typename track_state_container_types::host&)> {
+
+    public:
+    /// Configuration of the algorithm
+    struct config_t {
+
+        config_t(){};
+
+        /// Maximum amount of shared hits per track. One (1) means "no shared
+        /// hit allowed".
+        std::uint32_t maximum_shared_hits = 1;
+
+        /// Maximum number of iterations.
+        std::uint32_t maximum_iterations = 1000000;
+
+        /// Minimum number of measurement to form a track.
+        std::size_t n_measurements_min = 3;
+    };
+
+    /// Constructor for the algorithm
+    ///
+    /// @param cfg  Configuration object
+    ///
+    explicit flat_greedy_ambiguity_resolution_algorithm(
+        const config_t& cfg = {});
+
+    /// Run the algorithm
+    ///
+    /// @param track_states the container of the fitted track parameters
+    /// @return the container without ambiguous tracks
+    ///
+    output_type operator()(
+        const typename track_state_container_types::host& track_states)
+        const override;
+
+    private:
+    /// The configuration of the algorithm
+    config_t m_config;
+
+};  // class flat_greedy_ambiguity_resolution_algorithm
+
+}  // namespace traccc
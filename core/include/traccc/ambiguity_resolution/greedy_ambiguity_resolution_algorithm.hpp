@@ -9,6 +9,7 @@
 
 // System include
 #include <algorithm>
+#include <functional>
 #include <initializer_list>
 #include <iostream>
 #include <limits>
@@ -18,7 +19,10 @@
 #include <vector>
 
 // VecMem include(s).
+#include <vecmem/containers/jagged_vector.hpp>
 #include <vecmem/containers/vector.hpp>
+#include <vecmem/memory/host_memory_resource.hpp>
+#include <vecmem/memory/memory_resource.hpp>
 
 // Project include(s).
 #include "traccc/definitions/qualifiers.hpp"
@@ -66,24 +70,44 @@ class greedy_ambiguity_resolution_algorithm
         // of the algorithm.
         bool check_obvious_errs = true;
 
+        /// Split the tracks into groups connected by shared measurements,
+        /// and resolve the groups independently of each other, in parallel
+        /// (TBB) tasks. The maximum number of iterations then applies to
+        /// every group separately.
+        bool resolve_components_in_parallel = false;
+
         bool verbose_info = true;
         bool verbose_error = true;
         bool verbose_flood = false;
     };
 
     struct state_t {
+        /// Default constructor, allocating from the default resource
+        state_t() = default;
+        /// Constructor, with the resource to allocate the per-track data from
+        explicit state_t(vecmem::memory_resource& mr)
+            : input_track_index(&mr),
+              track_chi2(&mr),
+              measurements_per_track(&mr),
+              shared_measurements_per_track(&mr) {}
+
         std::size_t number_of_tracks{};
 
         /// For this whole comment section, track_index refers to the index of a
-        /// track in the initial input container.
+        /// track among the tracks of the input container that fulfill the
+        /// initial requirements (of @c config_t::n_measurements_min).
         ///
         /// There is no (track_id) in this algorithm, only (track_index).
 
+        /// Associates each track_index with the track's index in the input
+        /// container
+        vecmem::vector<std::size_t> input_track_index;
+
         /// Associates each track_index with the track's chi2 value
-        std::vector<traccc::scalar> track_chi2;
+        vecmem::vector<traccc::scalar> track_chi2;
 
         /// Associates each track_index to the track's (measurement_id)s list
-        std::vector<std::vector<std::size_t>> measurements_per_track;
+        vecmem::jagged_vector<std::size_t> measurements_per_track;
 
         /// Associates each measurement_id to a set of (track_index)es sharing
         /// it
@@ -92,7 +116,7 @@ class greedy_ambiguity_resolution_algorithm
 
         /// Associates each track_index to its number of shared measurements
         /// (among other tracks)
-        std::vector<std::size_t> shared_measurements_per_track;
+        vecmem::vector<std::size_t> shared_measurements_per_track;
 
         /// Keeps the selected tracks indexes that have not (yet) been removed
         /// by the algorithm
@@ -101,11 +125,27 @@ class greedy_ambiguity_resolution_algorithm
 
     /// Constructor for the greedy ambiguity resolution algorithm
     ///
+    /// The temporaries of the algorithm are allocated from the (global)
+    /// host memory resource.
+    ///
     /// @param cfg  Configuration object
     // greedy_ambiguity_resolution_algorithm(const config_type& cfg) :
     // _config(cfg) {}
     greedy_ambiguity_resolution_algorithm(const config_t cfg = {})
-        : _config{cfg} {}
+        : greedy_ambiguity_resolution_algorithm(cfg,
+                                                default_memory_resource()) {}
+
+    /// Constructor for the greedy ambiguity resolution algorithm
+    ///
+    /// The state of the whole event is allocated from @c mr. The states of
+    /// the connected components, which are resolved by parallel tasks, are
+    /// allocated from the global heap.
+    ///
+    /// @param cfg  Configuration object
+    /// @param mr   The memory resource to allocate the temporaries from
+    greedy_ambiguity_resolution_algorithm(const config_t cfg,
+                                          vecmem::memory_resource& mr)
+        : _config{cfg}, m_mr{mr} {}
 
     /// Run the algorithm
     ///
@@ -133,7 +173,17 @@ class greedy_ambiguity_resolution_algorithm
     ///
     /// @param state A state object that was previously filled by the
     /// initialization.
-    void resolve(state_t& state) const;
+    /// @return The number of iterations performed
+    std::size_t resolve(state_t& state) const;
+
+    /// Updates the state by splitting it into the connected components of
+    /// the track-measurement graph, and resolving every component on its
+    /// own, in parallel.
+    ///
+    /// @param state A state object that was previously filled by the
+    /// initialization.
+    /// @return The number of iterations performed, in all components
+    std::size_t resolve_components(state_t& state) const;
 
     /// Check for obvious errors returned by the algorithm:
     /// - Returned tracks should be independent of each other: they should share
@@ -149,7 +199,15 @@ class greedy_ambiguity_resolution_algorithm
         const typename track_state_container_types::host& initial_track_states,
         state_t& final_state) const;
 
+    /// The resource used when none is given to the constructor
+    static vecmem::memory_resource& default_memory_resource() {
+        static vecmem::host_memory_resource mr;
+        return mr;
+    }
+
     config_t _config;
+    /// The memory resource of the temporaries
+    std::reference_wrapper<vecmem::memory_resource> m_mr;
 };
 
 }  // namespace traccc
@@ -0,0 +1,69 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Library include(s).
+#include "traccc/clusterization/detail/threshold_filter.hpp"
+#include "traccc/edm/cell.hpp"
+#include "traccc/utils/algorithm.hpp"
+
+// VecMem include(s).
+#include <vecmem/memory/memory_resource.hpp>
+
+// System include(s).
+#include <functional>
+
+namespace traccc {
+
+/// Zero-suppression of the cells, ahead of the clusterization
+///
+/// Drops the cells with a signal not above the threshold of their modules,
+/// so that the connected component labelling has fewer cells to look at.
+/// With @c traccc::threshold_filter_mode::e_isolated only the sub-threshold
+/// cells without any neighbours are dropped, which leaves the clusters
+/// unchanged. With @c traccc::threshold_filter_mode::e_all all of them are.
+///
+/// The cells need to be grouped by module, and sorted by channel1 within
+/// every module. The order of the kept cells is preserved, so the output can
+/// be clusterized directly. Note that any cell links made from the output
+/// refer to the filtered collection, not to the input one.
+///
+class cell_threshold_filter
+    : public algorithm<cell_collection_types::host(
+          const cell_collection_types::host&,
+          const cell_module_collection_types::host&)> {
+
+    public:
+    /// Constructor for the filter
+    ///
+    /// @param mr The memory resource to use for the output
+    /// @param mode The sub-threshold cells to drop
+    ///
+    cell_threshold_filter(
+        vecmem::memory_resource& mr,
+        threshold_filter_mode mode = threshold_filter_mode::e_isolated);
+
+    /// Callable operator for the filter
+    ///
+    /// @param cells The cells to filter
+    /// @param modules The modules of the cells
+    /// @return The kept cells, in their original order
+    ///
+    output_type operator()(
+        const cell_collection_types::host& cells,
+        const cell_module_collection_types::host& modules) const override;
+
+    private:
+    /// The memory resource used by the algorithm
+    std::reference_wrapper<vecmem::memory_resource> m_mr;
+    /// The sub-threshold cells to drop
+    threshold_filter_mode m_mode;
+
+};  // class cell_threshold_filter
+
+}  // namespace traccc
@@ -1,6 +1,6 @@
 /** TRACCC library, part of the ACTS project (R&D line)
  *
- * (c) 2021-2022 CERN for the benefit of the ACTS project
+ * (c) 2021-2024 CERN for the benefit of the ACTS project
  *
  * Mozilla Public License Version 2.0
  */
@@ -9,7 +9,9 @@
 
 // Library include(s).
 #include "traccc/clusterization/component_connection.hpp"
+#include "traccc/clusterization/detail/dense_ccl.hpp"
 #include "traccc/clusterization/measurement_creation.hpp"
+#include "traccc/definitions/primitives.hpp"
 #include "traccc/edm/cell.hpp"
 #include "traccc/edm/measurement.hpp"
 #include "traccc/utils/algorithm.hpp"
@@ -27,6 +29,11 @@ namespace traccc {
 /// This algorithm creates local/2D measurements separately for each detector
 /// module from the cells of the modules.
 ///
+/// By default the measurements are created directly from the cluster labels
+/// of the cells, without collecting the cells of every cluster into a
+/// @c traccc::cluster_container_types::host object first. The result is the
+/// same either way.
+///
 class clusterization_algorithm
     : public algorithm<measurement_collection_types::host(
           const cell_collection_types::host&,
@@ -36,8 +43,16 @@ class clusterization_algorithm
     /// Clusterization algorithm constructor
     ///
     /// @param mr The memory resource to use for the result objects
+    /// @param build_clusters Whether to create an intermediate cluster
+    ///                       container, using @c traccc::component_connection
+    ///                       and @c traccc::measurement_creation
+    /// @param dense_ccl_occupancy The cell occupancy of a module above which
+    ///                            its cells are labeled with the dense-bitmap
+    ///                            CCL instead of SparseCCL
     ///
-    clusterization_algorithm(vecmem::memory_resource& mr);
+    clusterization_algorithm(
+        vecmem::memory_resource& mr, bool build_clusters = false,
+        scalar dense_ccl_occupancy = detail::default_dense_ccl_occupancy);
 
     /// Construct measurements for each detector module
     ///
@@ -61,6 +76,12 @@ class clusterization_algorithm
 
     /// @}
 
+    /// Whether to create an intermediate cluster container
+    bool m_build_clusters;
+
+    /// The occupancy above which modules are labeled with the dense CCL
+    scalar m_dense_ccl_occupancy;
+
     /// Reference to the host-accessible memory resource
     std::reference_wrapper<vecmem::memory_resource> m_mr;
 
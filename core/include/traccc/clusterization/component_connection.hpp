@@ -1,6 +1,6 @@
 /** TRACCC library, part of the ACTS project (R&D line)
  *
- * (c) 2021-2022 CERN for the benefit of the ACTS project
+ * (c) 2021-2024 CERN for the benefit of the ACTS project
  *
  * Mozilla Public License Version 2.0
  */
@@ -8,6 +8,8 @@
 #pragma once
 
 // Library include(s).
+#include "traccc/clusterization/detail/dense_ccl.hpp"
+#include "traccc/definitions/primitives.hpp"
 #include "traccc/edm/cell.hpp"
 #include "traccc/edm/cluster.hpp"
 #include "traccc/utils/algorithm.hpp"
@@ -37,7 +39,13 @@ class component_connection : public algorithm<cluster_container_types::host(
     /// Constructor for component_connection
     ///
     /// @param mr is the memory resource
-    component_connection(vecmem::memory_resource& mr) : m_mr(mr) {}
+    /// @param dense_ccl_occupancy is the cell occupancy of a module above
+    ///        which its cells are labeled with the dense-bitmap CCL instead
+    ///        of SparseCCL (values above 1 disable the dense CCL)
+    component_connection(
+        vecmem::memory_resource& mr,
+        scalar dense_ccl_occupancy = detail::default_dense_ccl_occupancy)
+        : m_mr(mr), m_dense_ccl_occupancy(dense_ccl_occupancy) {}
 
     /// @name Operator(s) to use in host code
     /// @{
@@ -58,6 +66,8 @@ class component_connection : public algorithm<cluster_container_types::host(
     private:
     /// The memory resource used by the algorithm
     std::reference_wrapper<vecmem::memory_resource> m_mr;
+    /// The occupancy above which modules are labeled with the dense CCL
+    scalar m_dense_ccl_occupancy;
 
 };  // class component_connection
 
@@ -0,0 +1,211 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Library include(s).
+#include "traccc/clusterization/detail/sparse_ccl.hpp"
+#include "traccc/clusterization/detail/sparse_ccl_simd.hpp"
+#include "traccc/clusterization/detail/strip_ccl.hpp"
+#include "traccc/definitions/primitives.hpp"
+#include "traccc/definitions/qualifiers.hpp"
+#include "traccc/edm/cell.hpp"
+
+// System include(s).
+#include <algorithm>
+#include <cassert>
+#include <vector>
+
+namespace traccc {
+
+/// Dense-bitmap CCL, for modules with a high cell occupancy
+///
+/// The cells of a module are rasterized into a bitmap spanning their
+/// bounding box, which is then labeled with a classic two-pass scan. Unlike
+/// SparseCCL, the cost of this does not grow with the number of cells that
+/// neighbour each other in the input.
+///
+/// Requires cells to be sorted by module
+namespace detail {
+
+/// Default occupancy (cells per bitmap pixel) above which a module is
+/// labeled with the dense CCL
+static constexpr scalar default_dense_ccl_occupancy = 0.25f;
+
+/// Maximal number of pixels in the bitmap of a module labeled with dense CCL
+static constexpr unsigned int max_dense_ccl_area = 1u << 16;
+
+/// Merge the trees of two entries of an equivalence table
+///
+/// The root with the higher index is attached to the one with the lower
+/// index, so every non-root entry keeps pointing to a lower index.
+///
+/// @param L an equivalance table
+/// @param e1 the first entry
+/// @param e2 the second entry
+template <typename ccl_vector_t>
+TRACCC_HOST_DEVICE inline void merge_trees(ccl_vector_t& L, unsigned int e1,
+                                           unsigned int e2) {
+
+    const unsigned int r1 = find_root(L, e1);
+    const unsigned int r2 = find_root(L, e2);
+    if (r1 < r2) {
+        L[r2] = r1;
+    } else if (r2 < r1) {
+        L[r1] = r2;
+    }
+}
+
+/// First scan of the dense CCL, associating the cells of one module
+///
+/// @param cells is the cell collection
+/// @param L is the equivalence table to fill for the module
+/// @param begin is the index of the first cell of the module
+/// @param end is the index after the last cell of the module
+/// @param min0 is the lowest @c channel0 value of the module's cells
+/// @param min1 is the lowest @c channel1 value of the module's cells
+/// @param width is the number of bitmap columns (along @c channel0)
+/// @param height is the number of bitmap rows (along @c channel1)
+/// @param bitmap is a zeroed array of at least @c width*height entries,
+///               which is zeroed again on return
+template <typename cell_collection_t, typename ccl_vector_t>
+TRACCC_HOST_DEVICE inline void dense_ccl_first_scan(
+    const cell_collection_t& cells, ccl_vector_t& L, unsigned int begin,
+    unsigned int end, channel_id min0, channel_id min1, unsigned int width,
+    unsigned int height, unsigned int* bitmap) {
+
+    // Rasterize the cells, storing (index + 1) in their pixels.
+    for (unsigned int i = begin; i < end; ++i) {
+        L[i] = i;
+        const unsigned int pixel = (cells[i].channel1 - min1) * width +
+                                   (cells[i].channel0 - min0);
+        assert(pixel < width * height);
+        if (bitmap[pixel] == 0) {
+            bitmap[pixel] = i + 1;
+        } else {
+            // Cells on the same pixel belong to the same cluster.
+            merge_trees(L, i, bitmap[pixel] - 1);
+        }
+    }
+
+    // Associate every pixel with its neighbours in the previous row and on
+    // its left. The others are taken care of when visiting those pixels.
+    for (unsigned int y = 0; y < height; ++y) {
+        const unsigned int* row = bitmap + y * width;
+        const unsigned int* prev_row = (y > 0 ? row - width : nullptr);
+        for (unsigned int x = 0; x < width; ++x) {
+            if (row[x] == 0) {
+                continue;
+            }
+            const unsigned int i = row[x] - 1;
+            if (x > 0 && row[x - 1] != 0) {
+                merge_trees(L, i, row[x - 1] - 1);
+            }
+            if (prev_row == nullptr) {
+                continue;
+            }
+            const unsigned int x_begin = (x > 0 ? x - 1 : x);
+            const unsigned int x_end = std::min(x + 2, width);
+            for (unsigned int nx = x_begin; nx < x_end; ++nx) {
+                if (prev_row[nx] != 0) {
+                    merge_trees(L, i, prev_row[nx] - 1);
+                }
+            }
+        }
+    }
+
+    // Clear the pixels of the cells, so the bitmap can be re-used.
+    for (unsigned int i = begin; i < end; ++i) {
+        bitmap[(cells[i].channel1 - min1) * width +
+               (cells[i].channel0 - min0)] = 0;
+    }
+}
+
+/// CCL choosing between SparseCCL, the dense CCL and the run-length CCL
+/// module by module
+///
+/// Produces the same labels as @c traccc::detail::sparse_ccl.
+///
+/// @param cells is the cell collection, sorted by module
+/// @param L is the vector of the output indices (to which cluster a cell
+/// belongs to)
+/// @param dense_occupancy is the occupancy of the bounding box of a module's
+///                        cells, above which the dense CCL is used for it
+/// @param bitmap is a scratch vector, re-used between the modules
+/// @return number of clusters
+template <typename cell_collection_t, typename ccl_vector_t>
+inline unsigned int adaptive_ccl(const cell_collection_t& cells,
+                                 ccl_vector_t& L, scalar dense_occupancy,
+                                 std::vector<unsigned int>& bitmap) {
+
+    // The number of cells.
+    const unsigned int n_cells = cells.size();
+
+    // first scan: pixel association, one module at a time
+    sparse_ccl_simd_scratch sparse_scratch;
+    unsigned int begin = 0;
+    while (begin < n_cells) {
+
+        // Find the cells of the module, and their bounding box.
+        unsigned int end = begin + 1;
+        channel_id min0 = cells[begin].channel0, max0 = min0;
+        channel_id min1 = cells[begin].channel1, max1 = min1;
+        while (end < n_cells &&
+               cells[end].module_link == cells[begin].module_link) {
+            min0 = std::min(min0, cells[end].channel0);
+            max0 = std::max(max0, cells[end].channel0);
+            min1 = std::min(min1, cells[end].channel1);
+            max1 = std::max(max1, cells[end].channel1);
+            ++end;
+        }
+        const unsigned int width = max0 - min0 + 1;
+        const unsigned int height = max1 - min1 + 1;
+        const unsigned long area = static_cast<unsigned long>(width) *
+                                   static_cast<unsigned long>(height);
+
+        // Label the module with the appropriate algorithm. Modules with all
+        // cells in a single row or column (like all strip modules) only need
+        // their runs of cells found.
+        if ((width == 1) || (height == 1)) {
+            strip_ccl_first_scan(cells, L, begin, end);
+        } else if ((area <= max_dense_ccl_area) &&
+                   (static_cast<scalar>(end - begin) >=
+                    dense_occupancy * static_cast<scalar>(area))) {
+            if (bitmap.size() < area) {
+                bitmap.resize(area, 0);
+            }
+            dense_ccl_first_scan(cells, L, begin, end, min0, min1, width,
+                                 height, bitmap.data());
+        } else {
+            sparse_ccl_simd_first_scan(cells, L, begin, end, sparse_scratch);
+        }
+        begin = end;
+    }
+
+    // second scan: transitive closure
+    return ccl_second_scan(L, n_cells);
+}
+
+/// CCL choosing between SparseCCL and the dense CCL module by module
+///
+/// @param cells is the cell collection, sorted by module
+/// @param L is the vector of the output indices (to which cluster a cell
+/// belongs to)
+/// @param dense_occupancy is the occupancy of the bounding box of a module's
+///                        cells, above which the dense CCL is used for it
+/// @return number of clusters
+template <typename cell_collection_t, typename ccl_vector_t>
+inline unsigned int adaptive_ccl(const cell_collection_t& cells,
+                                 ccl_vector_t& L, scalar dense_occupancy) {
+
+    std::vector<unsigned int> bitmap;
+    return adaptive_ccl(cells, L, dense_occupancy, bitmap);
+}
+
+}  // namespace detail
+
+}  // namespace traccc
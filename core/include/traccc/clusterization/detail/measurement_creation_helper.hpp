@@ -1,6 +1,6 @@
 /** TRACCC library, part of the ACTS project (R&D line)
  *
- * (c) 2021-2023 CERN for the benefit of the ACTS project
+ * (c) 2021-2024 CERN for the benefit of the ACTS project
  *
  * Mozilla Public License Version 2.0
  */
@@ -14,6 +14,9 @@
 #include "traccc/edm/cluster.hpp"
 #include "traccc/edm/measurement.hpp"
 
+// System include(s).
+#include <vector>
+
 namespace traccc::detail {
 
 /// Function used for retrieving the cell signal based on the module id
@@ -31,6 +34,40 @@ inline vector2 position_from_cell(const cell& cell, const cell_module& module) {
             module.pixel.min_center_y + cell.channel1 * module.pixel.pitch_y};
 }
 
+/// Function adding one cell to the properties of a cluster during
+/// measurement creation
+///
+/// @param[in] cell    The cell to add to the cluster
+/// @param[in] module  The cell module
+/// @param[inout] mean The mean position of the cluster/measurement
+/// @param[inout] var  The variation on the mean position of the
+///                    cluster/measurement
+/// @param[inout] totalWeight The total weight of the cluster/measurement
+///
+TRACCC_HOST_DEVICE inline void accumulate_cell(const cell& cell,
+                                               const cell_module& module,
+                                               point2& mean, point2& var,
+                                               scalar& totalWeight) {
+
+    // Translate the cell readout value into a weight.
+    const scalar weight = signal_cell_modelling(cell.activation, module);
+
+    // Only consider cells over a minimum threshold.
+    if (weight > module.threshold) {
+
+        // Update all output properties with this cell.
+        totalWeight += cell.activation;
+        const point2 cell_position = position_from_cell(cell, module);
+        const point2 prev = mean;
+        const point2 diff = cell_position - prev;
+
+        mean = prev + (weight / totalWeight) * diff;
+        for (std::size_t i = 0; i < 2; ++i) {
+            var[i] = var[i] + weight * (diff[i]) * (cell_position[i] - mean[i]);
+        }
+    }
+}
+
 /// Function used for calculating the properties of the cluster during
 /// measurement creation
 ///
@@ -48,25 +85,42 @@ TRACCC_HOST inline void calc_cluster_properties(
 
     // Loop over the cells of the cluster.
     for (const cell& cell : cluster) {
+        accumulate_cell(cell, module, mean, var, totalWeight);
+    }
+}
 
-        // Translate the cell readout value into a weight.
-        const scalar weight = signal_cell_modelling(cell.activation, module);
-
-        // Only consider cells over a minimum threshold.
-        if (weight > module.threshold) {
+/// Function creating a measurement from the properties of a cluster
+///
+/// @param[out] measurements is the measurement collection where the measurement
+/// object will be filled
+/// @param[in] mean is the mean position of the cluster
+/// @param[in] var is the (unnormalized) variation on the mean position
+/// @param[in] totalWeight is the total weight of the cluster
+/// @param[in] module is the cell module where the cluster belongs to
+/// @param[in] module_link is the module index
+///
+TRACCC_HOST inline void fill_measurement(
+    measurement_collection_types::host& measurements, const point2& mean,
+    const point2& var, scalar totalWeight, const cell_module& module,
+    const unsigned int module_link) {
 
-            // Update all output properties with this cell.
-            totalWeight += cell.activation;
-            const point2 cell_position = position_from_cell(cell, module);
-            const point2 prev = mean;
-            const point2 diff = cell_position - prev;
+    if (totalWeight > 0.) {
+        measurement m;
+        m.module_link = module_link;
+        m.surface_link = module.surface_link;
+        // normalize the cell position
+        m.local = mean;
+        // normalize the variance
+        m.variance[0] = var[0] / totalWeight;
+        m.variance[1] = var[1] / totalWeight;
+        // plus pitch^2 / 12
+        const auto pitch = module.pixel.get_pitch();
+        m.variance =
+            m.variance + point2{pitch[0] * pitch[0] / static_cast<scalar>(12.),
+                                pitch[1] * pitch[1] / static_cast<scalar>(12.)};
+        // @todo add variance estimation
 
-            mean = prev + (weight / totalWeight) * diff;
-            for (std::size_t i = 0; i < 2; ++i) {
-                var[i] =
-                    var[i] + weight * (diff[i]) * (cell_position[i] - mean[i]);
-            }
-        }
+        measurements.push_back(std::move(m));
     }
 }
 
@@ -99,23 +153,60 @@ TRACCC_HOST inline void fill_measurement(
     point2 mean{0., 0.}, var{0., 0.};
     detail::calc_cluster_properties(cluster, module, mean, var, totalWeight);
 
-    if (totalWeight > 0.) {
-        measurement m;
-        m.module_link = module_link;
-        m.surface_link = module.surface_link;
-        // normalize the cell position
-        m.local = mean;
-        // normalize the variance
-        m.variance[0] = var[0] / totalWeight;
-        m.variance[1] = var[1] / totalWeight;
-        // plus pitch^2 / 12
-        const auto pitch = module.pixel.get_pitch();
-        m.variance =
-            m.variance + point2{pitch[0] * pitch[0] / static_cast<scalar>(12.),
-                                pitch[1] * pitch[1] / static_cast<scalar>(12.)};
-        // @todo add variance estimation
+    // Create the measurement
+    fill_measurement(measurements, mean, var, totalWeight, module,
+                     module_link);
+}
 
-        measurements.push_back(std::move(m));
+/// Function creating the measurements of all clusters of a cell collection,
+/// without collecting the cells of the clusters into separate vectors
+///
+/// The cells are visited in their original order, so the result is
+/// identical to calling the cluster based @c fill_measurement on every
+/// cluster found by @c traccc::detail::sparse_ccl.
+///
+/// @param[out] measurements is the measurement collection where the
+/// measurement objects will be filled
+/// @param[in] cells is the cell collection
+/// @param[in] labels is the cluster index of every cell
+/// @param[in] n_clusters is the number of clusters in the cell collection
+/// @param[in] modules is the collection of cell modules
+///
+template <typename cell_collection_t, typename label_vector_t>
+TRACCC_HOST inline void fill_measurements(
+    measurement_collection_types::host& measurements,
+    const cell_collection_t& cells, const label_vector_t& labels,
+    unsigned int n_clusters,
+    const cell_module_collection_types::host& modules) {
+
+    /// Properties of one cluster, accumulated over its cells
+    struct cluster_properties {
+        point2 mean{0., 0.};
+        point2 var{0., 0.};
+        scalar totalWeight = 0.;
+        unsigned int module_link = 0;
+    };
+
+    // Accumulate the properties of all clusters in a single pass.
+    std::vector<cluster_properties> clusters(n_clusters);
+    std::vector<bool> seen(n_clusters, false);
+    for (std::size_t i = 0; i < cells.size(); ++i) {
+        const cell& c = cells[i];
+        cluster_properties& cluster = clusters[labels[i]];
+        if (!seen[labels[i]]) {
+            cluster.module_link = c.module_link;
+            seen[labels[i]] = true;
+        }
+        accumulate_cell(c, modules.at(cluster.module_link), cluster.mean,
+                        cluster.var, cluster.totalWeight);
+    }
+
+    // Create the measurements, in the order of the clusters.
+    measurements.reserve(measurements.size() + n_clusters);
+    for (const cluster_properties& cluster : clusters) {
+        fill_measurement(measurements, cluster.mean, cluster.var,
+                         cluster.totalWeight, modules.at(cluster.module_link),
+                         cluster.module_link);
     }
 }
 
@@ -1,6 +1,6 @@
 /** TRACCC library, part of the ACTS project (R&D line)
  *
- * (c) 2021-2022 CERN for the benefit of the ACTS project
+ * (c) 2021-2024 CERN for the benefit of the ACTS project
  *
  * Mozilla Public License Version 2.0
  */
@@ -90,25 +90,19 @@ TRACCC_HOST_DEVICE inline bool is_far_enough(traccc::cell a, traccc::cell b) {
     return (a.channel1 - b.channel1) > 1 || a.module_link != b.module_link;
 }
 
-/// Sparce CCL algorithm
+/// First scan of SparseCCL, associating the cells in a range with each other
 ///
 /// @param cells is the cell collection
-/// @param L is the vector of the output indices (to which cluster a cell
-/// belongs to)
-/// @param labels is the number of clusters found
-/// @return number of clusters
+/// @param L is the equivalence table to fill for the range
+/// @param begin is the index of the first cell of the range
+/// @param end is the index after the last cell of the range
 template <typename cell_collection_t, typename ccl_vector_t>
-TRACCC_HOST_DEVICE inline unsigned int sparse_ccl(
-    const cell_collection_t& cells, ccl_vector_t& L) {
-
-    unsigned int labels = 0;
+TRACCC_HOST_DEVICE inline void sparse_ccl_first_scan(
+    const cell_collection_t& cells, ccl_vector_t& L, unsigned int begin,
+    unsigned int end) {
 
-    // The number of cells.
-    const unsigned int n_cells = cells.size();
-
-    // first scan: pixel association
-    unsigned int start_j = 0;
-    for (unsigned int i = 0; i < n_cells; ++i) {
+    unsigned int start_j = begin;
+    for (unsigned int i = begin; i < end; ++i) {
         L[i] = i;
         unsigned int ai = i;
         for (unsigned int j = start_j; j < i; ++j) {
@@ -119,8 +113,20 @@ TRACCC_HOST_DEVICE inline unsigned int sparse_ccl(
             }
         }
     }
+}
 
-    // second scan: transitive closure
+/// Second scan of SparseCCL, turning an equivalence table into labels
+///
+/// Requires every non-root entry of the table to point to a lower index.
+///
+/// @param L is the equivalence table, replaced by the cluster labels
+/// @param n_cells is the number of cells
+/// @return number of clusters
+template <typename ccl_vector_t>
+TRACCC_HOST_DEVICE inline unsigned int ccl_second_scan(ccl_vector_t& L,
+                                                       unsigned int n_cells) {
+
+    unsigned int labels = 0;
     for (unsigned int i = 0; i < n_cells; ++i) {
         if (L[i] == i) {
             L[i] = labels++;
@@ -128,9 +134,29 @@ TRACCC_HOST_DEVICE inline unsigned int sparse_ccl(
             L[i] = L[L[i]];
         }
     }
-
     return labels;
 }
+
+/// Sparce CCL algorithm
+///
+/// @param cells is the cell collection
+/// @param L is the vector of the output indices (to which cluster a cell
+/// belongs to)
+/// @param labels is the number of clusters found
+/// @return number of clusters
+template <typename cell_collection_t, typename ccl_vector_t>
+TRACCC_HOST_DEVICE inline unsigned int sparse_ccl(
+    const cell_collection_t& cells, ccl_vector_t& L) {
+
+    // The number of cells.
+    const unsigned int n_cells = cells.size();
+
+    // first scan: pixel association
+    sparse_ccl_first_scan(cells, L, 0, n_cells);
+
+    // second scan: transitive closure
+    return ccl_second_scan(L, n_cells);
+}
 }  // namespace detail
 
 }  // namespace traccc
@@ -0,0 +1,309 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Library include(s).
+#include "traccc/clusterization/detail/sparse_ccl.hpp"
+#include "traccc/edm/cell.hpp"
+
+// System include(s).
+#include <vector>
+
+// Select the instruction set of the block tests, from the flags that the
+// code is compiled with (e.g. -march=...).
+#if defined(__AVX512F__) && !defined(__CUDACC__)
+#define TRACCC_SPARSE_CCL_AVX512
+#include <immintrin.h>
+#elif defined(__AVX2__) && !defined(__CUDACC__)
+#define TRACCC_SPARSE_CCL_AVX2
+#include <immintrin.h>
+#elif defined(__ARM_NEON) && defined(__aarch64__) && !defined(__CUDACC__)
+#define TRACCC_SPARSE_CCL_NEON
+#include <arm_neon.h>
+#endif
+
+namespace traccc {
+
+/// Host variant of SparseCCL, comparing every cell with a block of its
+/// preceding cells at once
+///
+/// The channels and module links of the cells are copied into separate
+/// arrays, so that the @c is_adjacent and @c is_far_enough tests of
+/// @c traccc::detail::sparse_ccl_first_scan can be evaluated with AVX-512,
+/// AVX2 or NEON instructions (as available at compile time), or with a
+/// plain loop that the compiler may vectorise. The unions are made in the
+/// same order as in the scalar scan, so the labels are identical to those of
+/// @c traccc::detail::sparse_ccl.
+namespace detail {
+
+#if defined(TRACCC_SPARSE_CCL_AVX512)
+/// The number of preceding cells tested at once
+static constexpr unsigned int sparse_ccl_block_size = 16u;
+#else
+/// The number of preceding cells tested at once
+static constexpr unsigned int sparse_ccl_block_size = 8u;
+#endif
+
+/// The cell data of a range of cells, in structure-of-arrays layout
+struct sparse_ccl_simd_scratch {
+    /// The first channels of the cells
+    std::vector<unsigned int> channel0;
+    /// The second channels of the cells
+    std::vector<unsigned int> channel1;
+    /// The module links of the cells
+    std::vector<unsigned int> module_link;
+};
+
+/// The results of testing one cell against a block of cells
+struct sparse_ccl_block_result {
+    /// Bit mask of the cells adjacent to the tested cell
+    unsigned int adjacent = 0u;
+    /// Bit mask of the cells far enough from the tested cell
+    unsigned int far = 0u;
+};
+
+/// Count the set bits of a mask
+inline unsigned int sparse_ccl_popcount(unsigned int mask) {
+#if defined(__GNUC__)
+    return static_cast<unsigned int>(__builtin_popcount(mask));
+#else
+    unsigned int result = 0u;
+    for (; mask != 0u; mask &= mask - 1u) {
+        ++result;
+    }
+    return result;
+#endif
+}
+
+/// Get the index of the lowest set bit of a (non-zero) mask
+inline unsigned int sparse_ccl_lowest_bit(unsigned int mask) {
+#if defined(__GNUC__)
+    return static_cast<unsigned int>(__builtin_ctz(mask));
+#else
+    unsigned int result = 0u;
+    for (; (mask & 1u) == 0u; mask >>= 1) {
+        ++result;
+    }
+    return result;
+#endif
+}
+
+/// Test one cell against a block of @c sparse_ccl_block_size cells
+///
+/// Uses the same (wrapping) unsigned arithmetic as @c is_adjacent and
+/// @c is_far_enough. AVX2 has no unsigned vector comparisons, so it tests
+/// @c x<=1 as @c x>>1 being zero.
+///
+/// @param channel0 The first channels of the block
+/// @param channel1 The second channels of the block
+/// @param module_link The module links of the block
+/// @param c0 The first channel of the tested cell
+/// @param c1 The second channel of the tested cell
+/// @param module The module link of the tested cell
+///
+inline sparse_ccl_block_result sparse_ccl_test_block(
+    const unsigned int* channel0, const unsigned int* channel1,
+    const unsigned int* module_link, unsigned int c0, unsigned int c1,
+    unsigned int module) {
+
+    sparse_ccl_block_result result;
+
+#if defined(TRACCC_SPARSE_CCL_AVX512)
+    const __m512i one = _mm512_set1_epi32(1);
+    const __m512i d0 = _mm512_sub_epi32(
+        _mm512_set1_epi32(static_cast<int>(c0)),
+        _mm512_loadu_si512(static_cast<const void*>(channel0)));
+    const __m512i d1 = _mm512_sub_epi32(
+        _mm512_set1_epi32(static_cast<int>(c1)),
+        _mm512_loadu_si512(static_cast<const void*>(channel1)));
+    const __mmask16 same_module = _mm512_cmpeq_epi32_mask(
+        _mm512_set1_epi32(static_cast<int>(module)),
+        _mm512_loadu_si512(static_cast<const void*>(module_link)));
+    const __mmask16 near0 =
+        _mm512_cmple_epu32_mask(_mm512_mullo_epi32(d0, d0), one);
+    const __mmask16 near1 =
+        _mm512_cmple_epu32_mask(_mm512_mullo_epi32(d1, d1), one);
+    const __mmask16 close1 = _mm512_cmple_epu32_mask(d1, one);
+    result.adjacent = static_cast<unsigned int>(near0 & near1 & same_module);
+    result.far = static_cast<unsigned int>(~(close1 & same_module)) & 0xffffu;
+#elif defined(TRACCC_SPARSE_CCL_AVX2)
+    const __m256i zero = _mm256_setzero_si256();
+    const __m256i d0 = _mm256_sub_epi32(
+        _mm256_set1_epi32(static_cast<int>(c0)),
+        _mm256_loadu_si256(reinterpret_cast<const __m256i*>(channel0)));
+    const __m256i d1 = _mm256_sub_epi32(
+        _mm256_set1_epi32(static_cast<int>(c1)),
+        _mm256_loadu_si256(reinterpret_cast<const __m256i*>(channel1)));
+    const __m256i same_module = _mm256_cmpeq_epi32(
+        _mm256_set1_epi32(static_cast<int>(module)),
+        _mm256_loadu_si256(reinterpret_cast<const __m256i*>(module_link)));
+    const __m256i near0 = _mm256_cmpeq_epi32(
+        _mm256_srli_epi32(_mm256_mullo_epi32(d0, d0), 1), zero);
+    const __m256i near1 = _mm256_cmpeq_epi32(
+        _mm256_srli_epi32(_mm256_mullo_epi32(d1, d1), 1), zero);
+    const __m256i close1 = _mm256_cmpeq_epi32(_mm256_srli_epi32(d1, 1), zero);
+    auto to_mask = [](__m256i v) {
+        return static_cast<unsigned int>(
+            _mm256_movemask_ps(_mm256_castsi256_ps(v)));
+    };
+    result.adjacent =
+        to_mask(_mm256_and_si256(_mm256_and_si256(near0, near1), same_module));
+    result.far = ~to_mask(_mm256_and_si256(close1, same_module)) & 0xffu;
+#elif defined(TRACCC_SPARSE_CCL_NEON)
+    static const uint32_t lane_bits_data[4] = {1u, 2u, 4u, 8u};
+    const uint32x4_t lane_bits = vld1q_u32(lane_bits_data);
+    const uint32x4_t one = vdupq_n_u32(1u);
+    const uint32x4_t vc0 = vdupq_n_u32(c0);
+    const uint32x4_t vc1 = vdupq_n_u32(c1);
+    const uint32x4_t vmodule = vdupq_n_u32(module);
+    for (unsigned int half = 0u; half < 2u; ++half) {
+        const unsigned int offset = 4u * half;
+        const uint32x4_t d0 = vsubq_u32(vc0, vld1q_u32(channel0 + offset));
+        const uint32x4_t d1 = vsubq_u32(vc1, vld1q_u32(channel1 + offset));
+        const uint32x4_t same_module =
+            vceqq_u32(vmodule, vld1q_u32(module_link + offset));
+        const uint32x4_t near0 = vcleq_u32(vmulq_u32(d0, d0), one);
+        const uint32x4_t near1 = vcleq_u32(vmulq_u32(d1, d1), one);
+        const uint32x4_t close1 = vcleq_u32(d1, one);
+        result.adjacent |=
+            vaddvq_u32(vandq_u32(vandq_u32(vandq_u32(near0, near1),
+                                           same_module),
+                                 lane_bits))
+            << offset;
+        result.far |= vaddvq_u32(vandq_u32(vmvnq_u32(vandq_u32(
+                                               close1, same_module)),
+                                           lane_bits))
+                      << offset;
+    }
+#else
+    for (unsigned int k = 0u; k < sparse_ccl_block_size; ++k) {
+        const unsigned int d0 = c0 - channel0[k];
+        const unsigned int d1 = c1 - channel1[k];
+        const bool same_module = (module == module_link[k]);
+        const bool adjacent = ((d0 * d0) <= 1u) && ((d1 * d1) <= 1u) &&
+                              same_module;
+        const bool far = (d1 > 1u) || (!same_module);
+        result.adjacent |= (static_cast<unsigned int>(adjacent) << k);
+        result.far |= (static_cast<unsigned int>(far) << k);
+    }
+#endif
+
+    return result;
+}
+
+/// First scan of SparseCCL, testing blocks of preceding cells at once
+///
+/// Produces the same equivalence table as @c sparse_ccl_first_scan.
+///
+/// @param cells is the cell collection
+/// @param L is the equivalence table to fill for the range
+/// @param begin is the index of the first cell of the range
+/// @param end is the index after the last cell of the range
+/// @param scratch is re-used memory for the cell data of the range
+template <typename cell_collection_t, typename ccl_vector_t>
+inline void sparse_ccl_simd_first_scan(const cell_collection_t& cells,
+                                       ccl_vector_t& L, unsigned int begin,
+                                       unsigned int end,
+                                       sparse_ccl_simd_scratch& scratch) {
+
+    // Copy the cell data of the range into the scratch arrays.
+    const unsigned int n_cells = end - begin;
+    if (scratch.channel0.size() < n_cells) {
+        scratch.channel0.resize(n_cells);
+        scratch.channel1.resize(n_cells);
+        scratch.module_link.resize(n_cells);
+    }
+    unsigned int* channel0 = scratch.channel0.data();
+    unsigned int* channel1 = scratch.channel1.data();
+    unsigned int* module_link = scratch.module_link.data();
+    for (unsigned int k = 0; k < n_cells; ++k) {
+        const traccc::cell& c = cells[begin + k];
+        channel0[k] = c.channel0;
+        channel1[k] = c.channel1;
+        module_link[k] = c.module_link;
+    }
+
+    // The indices (relative to begin) of the adjacent cells of a block.
+    unsigned int adjacent[sparse_ccl_block_size];
+
+    unsigned int start_j = 0;
+    for (unsigned int i = 0; i < n_cells; ++i) {
+        L[begin + i] = begin + i;
+        unsigned int ai = begin + i;
+
+        // Like in the scalar scan, every (non-adjacent) cell that is far
+        // enough moves the start of the range of the next cell.
+        unsigned int n_far = 0;
+        unsigned int j = start_j;
+        for (; j + sparse_ccl_block_size <= i; j += sparse_ccl_block_size) {
+            const sparse_ccl_block_result block = sparse_ccl_test_block(
+                channel0 + j, channel1 + j, module_link + j, channel0[i],
+                channel1[i], module_link[i]);
+            n_far += sparse_ccl_popcount(block.far & ~block.adjacent);
+
+            // Collect the adjacent cells, in increasing order.
+#if defined(TRACCC_SPARSE_CCL_AVX512)
+            _mm512_mask_compressstoreu_epi32(
+                adjacent, static_cast<__mmask16>(block.adjacent),
+                _mm512_add_epi32(
+                    _mm512_set1_epi32(static_cast<int>(j)),
+                    _mm512_set_epi32(15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5,
+                                     4, 3, 2, 1, 0)));
+            const unsigned int n_adjacent =
+                sparse_ccl_popcount(block.adjacent);
+#else
+            unsigned int n_adjacent = 0;
+            for (unsigned int mask = block.adjacent; mask != 0u;
+                 mask &= mask - 1u) {
+                adjacent[n_adjacent++] = j + sparse_ccl_lowest_bit(mask);
+            }
+#endif
+            for (unsigned int k = 0; k < n_adjacent; ++k) {
+                ai = make_union(L, ai, find_root(L, begin + adjacent[k]));
+            }
+        }
+
+        // Test the remaining cells one by one.
+        for (; j < i; ++j) {
+            const unsigned int d0 = channel0[i] - channel0[j];
+            const unsigned int d1 = channel1[i] - channel1[j];
+            const bool same_module = (module_link[i] == module_link[j]);
+            if (((d0 * d0) <= 1u) && ((d1 * d1) <= 1u) && same_module) {
+                ai = make_union(L, ai, find_root(L, begin + j));
+            } else if ((d1 > 1u) || (!same_module)) {
+                ++n_far;
+            }
+        }
+        start_j += n_far;
+    }
+}
+
+/// SparseCCL, testing blocks of preceding cells at once
+///
+/// @param cells is the cell collection
+/// @param L is the vector of the output indices (to which cluster a cell
+/// belongs to)
+/// @return number of clusters
+template <typename cell_collection_t, typename ccl_vector_t>
+inline unsigned int sparse_ccl_simd(const cell_collection_t& cells,
+                                    ccl_vector_t& L) {
+
+    // The number of cells.
+    const unsigned int n_cells = cells.size();
+
+    // first scan: pixel association
+    sparse_ccl_simd_scratch scratch;
+    sparse_ccl_simd_first_scan(cells, L, 0, n_cells, scratch);
+
+    // second scan: transitive closure
+    return ccl_second_scan(L, n_cells);
+}
+
+}  // namespace detail
+
+}  // namespace traccc
@@ -0,0 +1,64 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Library include(s).
+#include "traccc/clusterization/detail/sparse_ccl.hpp"
+#include "traccc/definitions/qualifiers.hpp"
+#include "traccc/edm/cell.hpp"
+
+namespace traccc {
+
+/// Run-length CCL, for one dimensional (strip) modules
+///
+/// When all cells of a module share one of their channels, the clusters of
+/// the module are runs of consecutive cells in the sorted cell collection,
+/// as a cell can only neighbour the cells right before and after it. So no
+/// union-find is needed, only the detection of the starts of the runs.
+///
+/// Requires cells to be sorted by module
+namespace detail {
+
+/// Check whether a cell starts a new run of adjacent cells
+///
+/// @param cells is the cell collection
+/// @param begin is the index of the first cell of the range looked at
+/// @param i is the index of the cell
+/// @return @c true if the cell is not adjacent to the previous one
+template <typename cell_collection_t>
+TRACCC_HOST_DEVICE inline bool is_run_start(const cell_collection_t& cells,
+                                            unsigned int begin,
+                                            unsigned int i) {
+
+    return (i == begin) || !is_adjacent(cells[i - 1], cells[i]);
+}
+
+/// First scan of the run-length CCL, associating the cells of one module
+///
+/// Every cell is associated directly with the first cell of its run, which
+/// is the form expected by @c traccc::detail::ccl_second_scan.
+///
+/// @param cells is the cell collection
+/// @param L is the equivalence table to fill for the module
+/// @param begin is the index of the first cell of the module
+/// @param end is the index after the last cell of the module
+template <typename cell_collection_t, typename ccl_vector_t>
+TRACCC_HOST_DEVICE inline void strip_ccl_first_scan(
+    const cell_collection_t& cells, ccl_vector_t& L, unsigned int begin,
+    unsigned int end) {
+
+    // A select instead of a branch, so mispredictions on noisy modules
+    // don't slow this loop down.
+    for (unsigned int i = begin; i < end; ++i) {
+        L[i] = is_run_start(cells, begin, i) ? i : L[i - 1];
+    }
+}
+
+}  // namespace detail
+
+}  // namespace traccc
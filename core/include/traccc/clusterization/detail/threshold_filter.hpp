@@ -0,0 +1,95 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Library include(s).
+#include "traccc/clusterization/detail/measurement_creation_helper.hpp"
+#include "traccc/definitions/qualifiers.hpp"
+#include "traccc/edm/cell.hpp"
+
+namespace traccc {
+
+/// Which of the cells below the threshold of their modules to drop, ahead
+/// of the clusterization
+///
+/// Cells below the threshold do not contribute to the measurements, but they
+/// do connect the cells around them into clusters.
+///
+enum class threshold_filter_mode {
+    /// Drop the sub-threshold cells without any neighbours. Which keeps all
+    /// clusters with cells above the threshold exactly as they are.
+    e_isolated = 0,
+    /// Drop all sub-threshold cells. Clusters connected only through
+    /// sub-threshold cells are split up then.
+    e_all = 1
+};
+
+namespace detail {
+
+/// Check whether a cell is kept by the threshold filter
+///
+/// The cells need to be grouped by module, and sorted by their channel1
+/// identifiers within every module, as the clusterization expects them.
+///
+/// @param pos     The index of the cell
+/// @param cells   All cells
+/// @param modules The modules of the cells
+/// @param mode    The cells to drop
+/// @return @c true if the cell is kept
+///
+template <typename cell_container_t, typename module_container_t>
+TRACCC_HOST_DEVICE inline bool is_kept_cell(const unsigned int pos,
+                                            const cell_container_t& cells,
+                                            const module_container_t& modules,
+                                            const threshold_filter_mode mode) {
+
+    const cell this_cell = cells[pos];
+    const cell_module& this_module = modules[this_cell.module_link];
+
+    // Cells above the threshold are always kept.
+    if (signal_cell_modelling(this_cell.activation, this_module) >
+        this_module.threshold) {
+        return true;
+    }
+    if (mode == threshold_filter_mode::e_all) {
+        return false;
+    }
+
+    // Keep the sub-threshold cells with any neighbours, looking at the cells
+    // of the same module with a close enough channel1.
+    auto is_neighbour = [&](const cell& other) {
+        const channel_id d0 = (other.channel0 > this_cell.channel0)
+                                  ? (other.channel0 - this_cell.channel0)
+                                  : (this_cell.channel0 - other.channel0);
+        return d0 <= 1;
+    };
+    for (unsigned int j = pos - 1; j < pos; --j) {
+        if ((cells[j].module_link != this_cell.module_link) ||
+            (cells[j].channel1 + 1 < this_cell.channel1)) {
+            break;
+        }
+        if (is_neighbour(cells[j])) {
+            return true;
+        }
+    }
+    const unsigned int n_cells = static_cast<unsigned int>(cells.size());
+    for (unsigned int j = pos + 1; j < n_cells; ++j) {
+        if ((cells[j].module_link != this_cell.module_link) ||
+            (cells[j].channel1 > this_cell.channel1 + 1)) {
+            break;
+        }
+        if (is_neighbour(cells[j])) {
+            return true;
+        }
+    }
+    return false;
+}
+
+}  // namespace detail
+
+}  // namespace traccc
@@ -0,0 +1,71 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s).
+#include "traccc/edm/cell.hpp"
+
+// VecMem include(s).
+#include <vecmem/containers/vector.hpp>
+#include <vecmem/memory/memory_resource.hpp>
+
+// System include(s).
+#include <cstddef>
+
+namespace traccc {
+
+/// The cells and modules of several events, merged into single collections
+///
+/// Allows the clusterization of many small events with a single sequence of
+/// (device) kernels. The modules of the events are appended one after the
+/// other, with the module links of the cells shifted accordingly, so the
+/// cells of the batch remain ordered by module as long as the cells of the
+/// individual events are. The event that every module belongs to is
+/// recorded, for de-multiplexing the results of the clusterization.
+///
+class event_batch {
+
+    public:
+    /// Constructor with the memory resource to use for the collections
+    explicit event_batch(vecmem::memory_resource& mr);
+
+    /// Add an event to the batch
+    ///
+    /// @param cells The cells of the event
+    /// @param modules The modules of the event
+    /// @return The index of the event in the batch
+    ///
+    std::size_t add(const cell_collection_types::host& cells,
+                    const cell_module_collection_types::host& modules);
+
+    /// Remove all events from the batch (keeping the allocated memory)
+    void clear();
+
+    /// The number of events in the batch
+    std::size_t size() const;
+
+    /// The cells of all events
+    const cell_collection_types::host& cells() const;
+    /// The modules of all events
+    const cell_module_collection_types::host& modules() const;
+    /// The index of the event that each module belongs to
+    const vecmem::vector<unsigned int>& module_events() const;
+
+    private:
+    /// The cells of all events
+    cell_collection_types::host m_cells;
+    /// The modules of all events
+    cell_module_collection_types::host m_modules;
+    /// The index of the event that each module belongs to
+    vecmem::vector<unsigned int> m_module_events;
+    /// The number of events in the batch
+    std::size_t m_size = 0;
+
+};  // class event_batch
+
+}  // namespace traccc
@@ -0,0 +1,90 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Library include(s).
+#include "traccc/clusterization/detail/dense_ccl.hpp"
+#include "traccc/definitions/primitives.hpp"
+#include "traccc/edm/cell.hpp"
+#include "traccc/edm/measurement.hpp"
+#include "traccc/utils/algorithm.hpp"
+
+// VecMem include(s).
+#include <vecmem/memory/memory_resource.hpp>
+
+// System include(s).
+#include <cstddef>
+#include <functional>
+#include <vector>
+
+namespace traccc {
+
+/// Multi-threaded clusterization algorithm, creating measurements from cells
+///
+/// This algorithm splits the (module-sorted) cell collection into partitions
+/// at module boundaries, and runs the connected component labeling and the
+/// measurement creation on the partitions in parallel, using TBB. Since no
+/// cluster can span multiple modules, concatenating the per-partition
+/// results gives exactly the same measurements, in the same order, as
+/// @c traccc::clusterization_algorithm.
+///
+/// If traccc::core is built without TBB, the partitions are processed one
+/// after the other.
+///
+/// The memory resource given to the algorithm must be thread safe.
+///
+class parallel_clusterization_algorithm
+    : public algorithm<measurement_collection_types::host(
+          const cell_collection_types::host&,
+          const cell_module_collection_types::host&)> {
+
+    public:
+    /// Clusterization algorithm constructor
+    ///
+    /// @param mr The memory resource to use for the result objects
+    /// @param partition_size The minimum number of cells in a partition
+    /// @param dense_ccl_occupancy The cell occupancy of a module above which
+    ///                            its cells are labeled with the dense-bitmap
+    ///                            CCL instead of SparseCCL
+    ///
+    parallel_clusterization_algorithm(
+        vecmem::memory_resource& mr, std::size_t partition_size = 1024,
+        scalar dense_ccl_occupancy = detail::default_dense_ccl_occupancy);
+
+    /// Construct measurements for each detector module
+    ///
+    /// @param cells The cells for every detector module in the event
+    /// @param modules A collection of detector modules
+    /// @return The measurements reconstructed for every detector module
+    ///
+    output_type operator()(
+        const cell_collection_types::host& cells,
+        const cell_module_collection_types::host& modules) const override;
+
+    /// Find the partitions that the algorithm would process a collection in
+    ///
+    /// @param cells The cells for every detector module in the event
+    /// @return The index of the first cell of every partition, plus the
+    ///         size of the cell collection at the end
+    ///
+    std::vector<std::size_t> partitions(
+        const cell_collection_types::host& cells) const;
+
+    private:
+    /// The minimum number of cells in a partition
+    std::size_t m_partition_size;
+
+    /// The occupancy above which modules are labeled with the dense CCL
+    scalar m_dense_ccl_occupancy;
+
+    /// Reference to the host-accessible memory resource
+    std::reference_wrapper<vecmem::memory_resource> m_mr;
+
+};  // class parallel_clusterization_algorithm
+
+}  // namespace traccc
@@ -25,6 +25,11 @@ namespace traccc {
 /// This algorithm performs the local-to-global transformation of the 2D
 /// measurements made on every detector module, into 3D spacepoint coordinates.
 ///
+/// Consecutive measurements on the same module are transformed together, in
+/// fixed size blocks, looking up the placement of the module only once. So
+/// it runs the fastest on measurements grouped by module, as they come out
+/// of the clusterization.
+///
 class spacepoint_formation : public algorithm<spacepoint_collection_types::host(
                                  const measurement_collection_types::host&,
                                  const cell_module_collection_types::host&)> {
@@ -0,0 +1,106 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s).
+#include "traccc/definitions/primitives.hpp"
+#include "traccc/edm/cell.hpp"
+
+// Detray include(s).
+#include "detray/definitions/units.hpp"
+
+// VecMem include(s).
+#include <vecmem/memory/memory_resource.hpp>
+
+// System include(s).
+#include <cstddef>
+#include <functional>
+
+namespace traccc {
+
+/// Configuration of the time windows of a continuous readout stream
+struct time_window_config {
+
+    /// Start time of the first window
+    scalar start_time = 0.f;
+
+    /// Length of every time window
+    scalar window_length = 100.f * detray::unit<scalar>::ns;
+
+    /// Clusters with at least one cell this close to the end of a window are
+    /// not finalised in that window, but are clusterized again with the
+    /// cells of the next window
+    scalar cluster_time_window = 5.f * detray::unit<scalar>::ns;
+
+    /// Spacepoints this close to the end of a window are handed to the
+    /// seeding of the next window as well, for finding the seeds that cross
+    /// the window boundary. Must not be shorter than the cluster time window,
+    /// and must be shorter than the window length.
+    scalar overlap = 20.f * detray::unit<scalar>::ns;
+
+};  // struct time_window_config
+
+/// Partitioner of a stream of cells into consecutive time windows
+///
+/// Cells can be added in chunks of any size, in (roughly) increasing time
+/// order. A window becomes ready once a cell later than its end was seen, or
+/// once the end of the stream was signalled. Cells arriving after their
+/// window was handed out already are assigned to the next window that is
+/// handed out, so no cell is ever lost.
+///
+class time_window_partitioner {
+
+    public:
+    /// Constructor with the configuration and the memory resource to use
+    ///
+    /// @param config The configuration of the time windows
+    /// @param mr The memory resource to use for the cell collections
+    ///
+    time_window_partitioner(const time_window_config& config,
+                            vecmem::memory_resource& mr);
+
+    /// Add cells of the stream
+    void push(const cell_collection_types::host& cells);
+
+    /// Signal that no more cells will be added
+    void finish();
+
+    /// Check whether the next window can be handed out
+    bool ready() const;
+
+    /// Hand out the cells of the next window
+    ///
+    /// @return The cells of the window, ordered by module and channel, as
+    ///         expected by the clusterization
+    ///
+    cell_collection_types::host pop();
+
+    /// The index of the next window to be handed out
+    std::size_t window_index() const;
+    /// The start time of the next window to be handed out
+    scalar window_begin() const;
+    /// The end time of the next window to be handed out
+    scalar window_end() const;
+
+    private:
+    /// The configuration of the time windows
+    time_window_config m_config;
+    /// The memory resource to use
+    std::reference_wrapper<vecmem::memory_resource> m_mr;
+    /// The cells not handed out yet
+    cell_collection_types::host m_cells;
+    /// The latest cell time seen so far
+    scalar m_watermark;
+    /// The index of the next window
+    std::size_t m_window = 0;
+    /// Whether the end of the stream was signalled
+    bool m_finished = false;
+
+};  // class time_window_partitioner
+
+}  // namespace traccc
@@ -0,0 +1,304 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s).
+#include "traccc/definitions/primitives.hpp"
+#include "traccc/definitions/qualifiers.hpp"
+#include "traccc/edm/cell.hpp"
+#include "traccc/edm/details/soa_types.hpp"
+
+// VecMem include(s).
+#include <vecmem/containers/data/vector_buffer.hpp>
+#include <vecmem/containers/data/vector_view.hpp>
+#include <vecmem/containers/device_vector.hpp>
+#include <vecmem/containers/vector.hpp>
+#include <vecmem/memory/memory_resource.hpp>
+#include <vecmem/utils/copy.hpp>
+
+// System include(s).
+#include <type_traits>
+
+namespace traccc {
+
+/// @name Structure-of-arrays layout of cell collections
+///
+/// Every member of @c traccc::cell lives in its own array. So device code
+/// reading only some of the members (like the channel identifiers during the
+/// connected component labeling) makes coalesced memory accesses.
+///
+/// @{
+
+/// Host collection of cells, in SoA layout
+struct cell_soa_host {
+
+    /// Constructor with a memory resource
+    explicit cell_soa_host(vecmem::memory_resource* mr = nullptr)
+        : channel0(mr),
+          channel1(mr),
+          activation(mr),
+          time(mr),
+          module_link(mr) {}
+
+    /// The number of cells in the collection
+    std::size_t size() const { return channel0.size(); }
+
+    /// Resize all arrays of the collection
+    void resize(std::size_t size) {
+        channel0.resize(size);
+        channel1.resize(size);
+        activation.resize(size);
+        time.resize(size);
+        module_link.resize(size);
+    }
+
+    /// Add a cell to the end of the collection
+    void push_back(const cell& c) {
+        channel0.push_back(c.channel0);
+        channel1.push_back(c.channel1);
+        activation.push_back(c.activation);
+        time.push_back(c.time);
+        module_link.push_back(c.module_link);
+    }
+
+    /// Get one cell from the collection
+    cell at(std::size_t i) const {
+        return {channel0.at(i), channel1.at(i), activation.at(i), time.at(i),
+                module_link.at(i)};
+    }
+
+    /// @name The arrays of the collection
+    /// @{
+    vecmem::vector<channel_id> channel0;
+    vecmem::vector<channel_id> channel1;
+    vecmem::vector<scalar> activation;
+    vecmem::vector<scalar> time;
+    vecmem::vector<cell::link_type> module_link;
+    /// @}
+
+};  // struct cell_soa_host
+
+/// View of a cell collection, in SoA layout
+template <bool CONST>
+struct cell_soa_view {
+
+    /// Size type of the views
+    using size_type =
+        typename details::soa_vector_view<CONST, channel_id>::size_type;
+
+    /// Default constructor
+    cell_soa_view() = default;
+
+    /// Constructor from a non-const view
+    template <bool OTHER_CONST,
+              std::enable_if_t<CONST && (!OTHER_CONST), bool> = true>
+    TRACCC_HOST_DEVICE cell_soa_view(const cell_soa_view<OTHER_CONST>& parent)
+        : channel0(parent.channel0),
+          channel1(parent.channel1),
+          activation(parent.activation),
+          time(parent.time),
+          module_link(parent.module_link) {}
+
+    /// The number of cells in the collection
+    TRACCC_HOST_DEVICE size_type size() const { return channel0.size(); }
+
+    /// @name Views of the arrays of the collection
+    /// @{
+    details::soa_vector_view<CONST, channel_id> channel0;
+    details::soa_vector_view<CONST, channel_id> channel1;
+    details::soa_vector_view<CONST, scalar> activation;
+    details::soa_vector_view<CONST, scalar> time;
+    details::soa_vector_view<CONST, cell::link_type> module_link;
+    /// @}
+
+};  // struct cell_soa_view
+
+/// Buffer for a cell collection, in SoA layout
+struct cell_soa_buffer {
+
+    /// Size type of the buffers
+    using size_type = cell_soa_view<false>::size_type;
+
+    /// Constructor allocating the arrays of the collection
+    cell_soa_buffer(size_type size, vecmem::memory_resource& mr)
+        : channel0(size, mr),
+          channel1(size, mr),
+          activation(size, mr),
+          time(size, mr),
+          module_link(size, mr) {}
+
+    /// The number of cells in the collection
+    size_type size() const { return channel0.size(); }
+
+    /// @name Buffers of the arrays of the collection
+    /// @{
+    vecmem::data::vector_buffer<channel_id> channel0;
+    vecmem::data::vector_buffer<channel_id> channel1;
+    vecmem::data::vector_buffer<scalar> activation;
+    vecmem::data::vector_buffer<scalar> time;
+    vecmem::data::vector_buffer<cell::link_type> module_link;
+    /// @}
+
+};  // struct cell_soa_buffer
+
+/// Device collection of cells, in SoA layout
+template <bool CONST>
+struct cell_soa_device {
+
+    /// Size type of the collection
+    using size_type = typename cell_soa_view<CONST>::size_type;
+
+    /// Constructor from a view
+    TRACCC_HOST_DEVICE explicit cell_soa_device(const cell_soa_view<CONST>& v)
+        : channel0(v.channel0),
+          channel1(v.channel1),
+          activation(v.activation),
+          time(v.time),
+          module_link(v.module_link) {}
+
+    /// The number of cells in the collection
+    TRACCC_HOST_DEVICE size_type size() const { return channel0.size(); }
+
+    /// Get one cell from the collection
+    ///
+    /// Only use this when all members of the cell are needed. Reading the
+    /// individual arrays directly results in better memory access patterns.
+    ///
+    TRACCC_HOST_DEVICE cell at(size_type i) const {
+        return {channel0[i], channel1[i], activation[i], time[i],
+                module_link[i]};
+    }
+
+    /// Set one cell of the collection
+    template <bool C = CONST, std::enable_if_t<!C, bool> = true>
+    TRACCC_HOST_DEVICE void set(size_type i, const cell& c) {
+        channel0[i] = c.channel0;
+        channel1[i] = c.channel1;
+        activation[i] = c.activation;
+        time[i] = c.time;
+        module_link[i] = c.module_link;
+    }
+
+    /// @name The arrays of the collection
+    /// @{
+    details::soa_device_vector<CONST, channel_id> channel0;
+    details::soa_device_vector<CONST, channel_id> channel1;
+    details::soa_device_vector<CONST, scalar> activation;
+    details::soa_device_vector<CONST, scalar> time;
+    details::soa_device_vector<CONST, cell::link_type> module_link;
+    /// @}
+
+};  // struct cell_soa_device
+
+/// Declare all SoA cell collection types
+struct cell_soa_collection_types {
+    /// Host collection
+    using host = cell_soa_host;
+    /// Non-const device collection
+    using device = cell_soa_device<false>;
+    /// Constant device collection
+    using const_device = cell_soa_device<true>;
+    /// Non-constant view
+    using view = cell_soa_view<false>;
+    /// Constant view
+    using const_view = cell_soa_view<true>;
+    /// Buffer
+    using buffer = cell_soa_buffer;
+};
+
+/// Get a (non-const) view of a host SoA cell collection
+inline cell_soa_view<false> get_data(cell_soa_host& cells) {
+    cell_soa_view<false> result;
+    result.channel0 = vecmem::get_data(cells.channel0);
+    result.channel1 = vecmem::get_data(cells.channel1);
+    result.activation = vecmem::get_data(cells.activation);
+    result.time = vecmem::get_data(cells.time);
+    result.module_link = vecmem::get_data(cells.module_link);
+    return result;
+}
+
+/// Get a (const) view of a host SoA cell collection
+inline cell_soa_view<true> get_data(const cell_soa_host& cells) {
+    cell_soa_view<true> result;
+    result.channel0 = vecmem::get_data(cells.channel0);
+    result.channel1 = vecmem::get_data(cells.channel1);
+    result.activation = vecmem::get_data(cells.activation);
+    result.time = vecmem::get_data(cells.time);
+    result.module_link = vecmem::get_data(cells.module_link);
+    return result;
+}
+
+/// Get a (non-const) view of an SoA cell buffer
+inline cell_soa_view<false> get_data(cell_soa_buffer& cells) {
+    cell_soa_view<false> result;
+    result.channel0 = cells.channel0;
+    result.channel1 = cells.channel1;
+    result.activation = cells.activation;
+    result.time = cells.time;
+    result.module_link = cells.module_link;
+    return result;
+}
+
+/// Copy an SoA cell collection between two views
+///
+/// @param copy_obj The copy object to use
+/// @param from The view to copy from
+/// @param to The view to copy into (of the same size)
+/// @param type The type of the copy, if known
+///
+inline void copy(vecmem::copy& copy_obj, const cell_soa_view<true>& from,
+                 const cell_soa_view<false>& to,
+                 vecmem::copy::type::copy_type type =
+                     vecmem::copy::type::unknown) {
+    copy_obj(from.channel0, to.channel0, type);
+    copy_obj(from.channel1, to.channel1, type);
+    copy_obj(from.activation, to.activation, type);
+    copy_obj(from.time, to.time, type);
+    copy_obj(from.module_link, to.module_link, type);
+}
+
+/// Convert an AoS cell collection into SoA layout
+///
+/// @param cells The cells to convert
+/// @param mr The memory resource to use for the result
+/// @return The cells in SoA layout
+///
+inline cell_soa_host to_soa(const cell_collection_types::host& cells,
+                            vecmem::memory_resource* mr = nullptr) {
+    cell_soa_host result(mr);
+    result.resize(cells.size());
+    for (std::size_t i = 0; i < cells.size(); ++i) {
+        result.channel0[i] = cells[i].channel0;
+        result.channel1[i] = cells[i].channel1;
+        result.activation[i] = cells[i].activation;
+        result.time[i] = cells[i].time;
+        result.module_link[i] = cells[i].module_link;
+    }
+    return result;
+}
+
+/// Convert an SoA cell collection into the AoS layout used by the
+/// clusterization algorithms
+///
+/// @param cells The cells to convert
+/// @param mr The memory resource to use for the result
+/// @return The cells in AoS layout
+///
+inline cell_collection_types::host to_aos(
+    const cell_soa_host& cells, vecmem::memory_resource* mr = nullptr) {
+    cell_collection_types::host result(mr);
+    result.reserve(cells.size());
+    for (std::size_t i = 0; i < cells.size(); ++i) {
+        result.push_back(cells.at(i));
+    }
+    return result;
+}
+
+/// @}
+
+}  // namespace traccc
@@ -0,0 +1,110 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s).
+#include "traccc/definitions/qualifiers.hpp"
+#include "traccc/edm/container.hpp"
+#include "traccc/edm/track_state.hpp"
+
+// detray include(s).
+#include "detray/geometry/barcode.hpp"
+
+// VecMem include(s).
+#include <vecmem/containers/data/jagged_vector_buffer.hpp>
+#include <vecmem/containers/data/jagged_vector_view.hpp>
+#include <vecmem/containers/jagged_device_vector.hpp>
+#include <vecmem/containers/jagged_vector.hpp>
+
+// System include(s).
+#include <cstddef>
+
+namespace traccc {
+
+/// Compact fitting result per measurement
+///
+/// Only keeps the smoothed parameters (without their covariance) and the
+/// smoothed chi square of a @c traccc::track_state, which is all that most
+/// users of the fitted tracks need. The covariances of the smoothed
+/// parameters can be kept separately, with
+/// @c traccc::compact_track_covariance_types.
+///
+template <typename algebra_t>
+struct compact_track_state {
+
+    using bound_track_parameters_type =
+        detray::bound_track_parameters<algebra_t>;
+    using bound_vector = typename bound_track_parameters_type::vector_type;
+    using bound_matrix = typename bound_track_parameters_type::covariance_type;
+    using scalar_type = typename algebra_t::scalar_type;
+
+    compact_track_state() = default;
+
+    /// Construction from a (smoothed) full track state
+    TRACCC_HOST_DEVICE
+    explicit compact_track_state(const track_state<algebra_t>& state)
+        : surface_link(state.surface_link()),
+          measurement_id(state.get_measurement().measurement_id),
+          smoothed(state.smoothed().vector()),
+          smoothed_chi2(state.smoothed_chi2()),
+          is_hole(state.is_hole) {}
+
+    /// @return the smoothed parameters, with a given covariance
+    TRACCC_HOST_DEVICE
+    bound_track_parameters_type smoothed_parameters(
+        const bound_matrix& covariance) const {
+        return {surface_link, smoothed, covariance};
+    }
+
+    /// The surface of the measurement
+    detray::geometry::barcode surface_link;
+    /// The identifier of the measurement
+    std::size_t measurement_id = 0;
+    /// The smoothed parameter vector
+    bound_vector smoothed;
+    /// The smoothed chi square
+    scalar_type smoothed_chi2{0};
+    /// Whether the state is a hole
+    bool is_hole{true};
+};
+
+/// Declare all compact track_state collection types
+using compact_track_state_collection_types =
+    collection_types<compact_track_state<transform3>>;
+
+/// Declare all compact track_state container types
+using compact_track_state_container_types =
+    container_types<fitting_result<transform3>,
+                    compact_track_state<transform3>>;
+
+/// Declare the types of the (optional) covariances of compact track states
+///
+/// The covariances of the smoothed parameters, with one (jagged) row per
+/// track, and one element per compact track state of the track.
+///
+struct compact_track_covariance_types {
+
+    /// The covariance type
+    using value_type = compact_track_state<transform3>::bound_matrix;
+
+    /// Host jagged vector type
+    using host = vecmem::jagged_vector<value_type>;
+    /// Non-const device jagged vector type
+    using device = vecmem::jagged_device_vector<value_type>;
+    /// Constant device jagged vector type
+    using const_device = vecmem::jagged_device_vector<const value_type>;
+    /// Non-constant view type
+    using view = vecmem::data::jagged_vector_view<value_type>;
+    /// Constant view type
+    using const_view = vecmem::data::jagged_vector_view<const value_type>;
+    /// Buffer type
+    using buffer = vecmem::data::jagged_vector_buffer<value_type>;
+
+};  // struct compact_track_covariance_types
+
+}  // namespace traccc
@@ -0,0 +1,29 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// VecMem include(s).
+#include <vecmem/containers/data/vector_view.hpp>
+#include <vecmem/containers/device_vector.hpp>
+
+// System include(s).
+#include <type_traits>
+
+namespace traccc::details {
+
+/// Type of the vector views of a (possibly constant) SoA collection
+template <bool CONST, typename T>
+using soa_vector_view =
+    vecmem::data::vector_view<std::conditional_t<CONST, const T, T>>;
+
+/// Type of the device vectors of a (possibly constant) SoA collection
+template <bool CONST, typename T>
+using soa_device_vector =
+    vecmem::device_vector<std::conditional_t<CONST, const T, T>>;
+
+}  // namespace traccc::details
@@ -19,6 +19,7 @@
 #include "detray/geometry/barcode.hpp"
 
 // System include(s).
+#include <cstdint>
 #include <limits>
 
 namespace traccc {
@@ -88,6 +89,18 @@ struct measurement_sort_comp {
     }
 };
 
+/// Integer sort key of a measurement, ordering the measurements the same way
+/// as @c traccc::measurement_sort_comp
+///
+/// Meant for radix sorting the measurements by their surfaces.
+///
+struct measurement_sort_key {
+    TRACCC_HOST_DEVICE
+    std::uint64_t operator()(const measurement& meas) const {
+        return static_cast<std::uint64_t>(meas.surface_link.value());
+    }
+};
+
 struct measurement_equal_comp {
     TRACCC_HOST_DEVICE
     bool operator()(const measurement& lhs, const measurement& rhs) {
@@ -0,0 +1,441 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s).
+#include "traccc/definitions/primitives.hpp"
+#include "traccc/definitions/qualifiers.hpp"
+#include "traccc/edm/details/soa_types.hpp"
+#include "traccc/edm/measurement.hpp"
+
+// VecMem include(s).
+#include <vecmem/containers/data/vector_buffer.hpp>
+#include <vecmem/containers/vector.hpp>
+#include <vecmem/memory/memory_resource.hpp>
+#include <vecmem/utils/copy.hpp>
+
+// System include(s).
+#include <cstdint>
+#include <limits>
+
+namespace traccc {
+
+/// @name Structure-of-arrays layout of measurement collections
+///
+/// Every member of @c traccc::measurement lives in its own array, with the
+/// identifiers and links narrowed to 32 bits, and the measurement dimension
+/// and subspace to 8 bits. Which is about half of the memory needed by the
+/// AoS layout.
+///
+/// @{
+
+namespace details {
+
+/// Type used for the identifiers and links of the SoA layout
+using measurement_soa_index = std::uint32_t;
+/// Type used for the dimension and subspace of the SoA layout
+using measurement_soa_dim = std::uint8_t;
+
+/// Narrow an index to the SoA layout, keeping the "invalid" value
+TRACCC_HOST_DEVICE inline measurement_soa_index to_soa_index(std::size_t i) {
+    return (i == std::numeric_limits<std::size_t>::max())
+               ? std::numeric_limits<measurement_soa_index>::max()
+               : static_cast<measurement_soa_index>(i);
+}
+
+/// Widen an index from the SoA layout, keeping the "invalid" value
+TRACCC_HOST_DEVICE inline std::size_t from_soa_index(measurement_soa_index i) {
+    return (i == std::numeric_limits<measurement_soa_index>::max())
+               ? std::numeric_limits<std::size_t>::max()
+               : static_cast<std::size_t>(i);
+}
+
+}  // namespace details
+
+/// Host collection of measurements, in SoA layout
+struct measurement_soa_host {
+
+    /// Constructor with a memory resource
+    explicit measurement_soa_host(vecmem::memory_resource* mr = nullptr)
+        : local0(mr),
+          local1(mr),
+          variance0(mr),
+          variance1(mr),
+          surface_link(mr),
+          measurement_id(mr),
+          module_link(mr),
+          cluster_link(mr),
+          meas_dim(mr),
+          subspace0(mr),
+          subspace1(mr) {}
+
+    /// The number of measurements in the collection
+    std::size_t size() const { return local0.size(); }
+
+    /// Resize all arrays of the collection
+    void resize(std::size_t size) {
+        local0.resize(size);
+        local1.resize(size);
+        variance0.resize(size);
+        variance1.resize(size);
+        surface_link.resize(size);
+        measurement_id.resize(size);
+        module_link.resize(size);
+        cluster_link.resize(size);
+        meas_dim.resize(size);
+        subspace0.resize(size);
+        subspace1.resize(size);
+    }
+
+    /// Set one measurement of the collection
+    void set(std::size_t i, const measurement& m) {
+        local0.at(i) = m.local[0];
+        local1.at(i) = m.local[1];
+        variance0.at(i) = m.variance[0];
+        variance1.at(i) = m.variance[1];
+        surface_link.at(i) = m.surface_link.value();
+        measurement_id.at(i) = details::to_soa_index(m.measurement_id);
+        module_link.at(i) = static_cast<details::measurement_soa_index>(
+            m.module_link);
+        cluster_link.at(i) = details::to_soa_index(m.cluster_link);
+        meas_dim.at(i) = static_cast<details::measurement_soa_dim>(m.meas_dim);
+        subspace0.at(i) = static_cast<details::measurement_soa_dim>(
+            m.subs.get_indices()[0]);
+        subspace1.at(i) = static_cast<details::measurement_soa_dim>(
+            m.subs.get_indices()[1]);
+    }
+
+    /// Add a measurement to the end of the collection
+    void push_back(const measurement& m) {
+        resize(size() + 1);
+        set(size() - 1, m);
+    }
+
+    /// Get one measurement from the collection
+    measurement at(std::size_t i) const {
+        measurement result;
+        result.local = {local0.at(i), local1.at(i)};
+        result.variance = {variance0.at(i), variance1.at(i)};
+        result.surface_link = detray::geometry::barcode{surface_link.at(i)};
+        result.measurement_id = details::from_soa_index(measurement_id.at(i));
+        result.module_link = module_link.at(i);
+        result.cluster_link = details::from_soa_index(cluster_link.at(i));
+        result.meas_dim = meas_dim.at(i);
+        result.subs.set_indices({subspace0.at(i), subspace1.at(i)});
+        return result;
+    }
+
+    /// @name The arrays of the collection
+    /// @{
+    vecmem::vector<scalar> local0;
+    vecmem::vector<scalar> local1;
+    vecmem::vector<scalar> variance0;
+    vecmem::vector<scalar> variance1;
+    vecmem::vector<std::uint64_t> surface_link;
+    vecmem::vector<details::measurement_soa_index> measurement_id;
+    vecmem::vector<details::measurement_soa_index> module_link;
+    vecmem::vector<details::measurement_soa_index> cluster_link;
+    vecmem::vector<details::measurement_soa_dim> meas_dim;
+    vecmem::vector<details::measurement_soa_dim> subspace0;
+    vecmem::vector<details::measurement_soa_dim> subspace1;
+    /// @}
+
+};  // struct measurement_soa_host
+
+/// View of a measurement collection, in SoA layout
+template <bool CONST>
+struct measurement_soa_view {
+
+    /// Size type of the views
+    using size_type =
+        typename details::soa_vector_view<CONST, scalar>::size_type;
+
+    /// Default constructor
+    measurement_soa_view() = default;
+
+    /// Constructor from a non-const view
+    template <bool OTHER_CONST,
+              std::enable_if_t<CONST && (!OTHER_CONST), bool> = true>
+    TRACCC_HOST_DEVICE measurement_soa_view(
+        const measurement_soa_view<OTHER_CONST>& parent)
+        : local0(parent.local0),
+          local1(parent.local1),
+          variance0(parent.variance0),
+          variance1(parent.variance1),
+          surface_link(parent.surface_link),
+          measurement_id(parent.measurement_id),
+          module_link(parent.module_link),
+          cluster_link(parent.cluster_link),
+          meas_dim(parent.meas_dim),
+          subspace0(parent.subspace0),
+          subspace1(parent.subspace1) {}
+
+    /// The number of measurements in the collection
+    TRACCC_HOST_DEVICE size_type size() const { return local0.size(); }
+
+    /// @name Views of the arrays of the collection
+    /// @{
+    details::soa_vector_view<CONST, scalar> local0;
+    details::soa_vector_view<CONST, scalar> local1;
+    details::soa_vector_view<CONST, scalar> variance0;
+    details::soa_vector_view<CONST, scalar> variance1;
+    details::soa_vector_view<CONST, std::uint64_t> surface_link;
+    details::soa_vector_view<CONST, details::measurement_soa_index>
+        measurement_id;
+    details::soa_vector_view<CONST, details::measurement_soa_index>
+        module_link;
+    details::soa_vector_view<CONST, details::measurement_soa_index>
+        cluster_link;
+    details::soa_vector_view<CONST, details::measurement_soa_dim> meas_dim;
+    details::soa_vector_view<CONST, details::measurement_soa_dim> subspace0;
+    details::soa_vector_view<CONST, details::measurement_soa_dim> subspace1;
+    /// @}
+
+};  // struct measurement_soa_view
+
+/// Buffer for a measurement collection, in SoA layout
+struct measurement_soa_buffer {
+
+    /// Size type of the buffers
+    using size_type = measurement_soa_view<false>::size_type;
+
+    /// Constructor allocating the arrays of the collection
+    measurement_soa_buffer(size_type size, vecmem::memory_resource& mr)
+        : local0(size, mr),
+          local1(size, mr),
+          variance0(size, mr),
+          variance1(size, mr),
+          surface_link(size, mr),
+          measurement_id(size, mr),
+          module_link(size, mr),
+          cluster_link(size, mr),
+          meas_dim(size, mr),
+          subspace0(size, mr),
+          subspace1(size, mr) {}
+
+    /// The number of measurements in the collection
+    size_type size() const { return local0.size(); }
+
+    /// @name Buffers of the arrays of the collection
+    /// @{
+    vecmem::data::vector_buffer<scalar> local0;
+    vecmem::data::vector_buffer<scalar> local1;
+    vecmem::data::vector_buffer<scalar> variance0;
+    vecmem::data::vector_buffer<scalar> variance1;
+    vecmem::data::vector_buffer<std::uint64_t> surface_link;
+    vecmem::data::vector_buffer<details::measurement_soa_index>
+        measurement_id;
+    vecmem::data::vector_buffer<details::measurement_soa_index> module_link;
+    vecmem::data::vector_buffer<details::measurement_soa_index> cluster_link;
+    vecmem::data::vector_buffer<details::measurement_soa_dim> meas_dim;
+    vecmem::data::vector_buffer<details::measurement_soa_dim> subspace0;
+    vecmem::data::vector_buffer<details::measurement_soa_dim> subspace1;
+    /// @}
+
+};  // struct measurement_soa_buffer
+
+/// Device collection of measurements, in SoA layout
+template <bool CONST>
+struct measurement_soa_device {
+
+    /// Size type of the collection
+    using size_type = typename measurement_soa_view<CONST>::size_type;
+
+    /// Constructor from a view
+    TRACCC_HOST_DEVICE explicit measurement_soa_device(
+        const measurement_soa_view<CONST>& v)
+        : local0(v.local0),
+          local1(v.local1),
+          variance0(v.variance0),
+          variance1(v.variance1),
+          surface_link(v.surface_link),
+          measurement_id(v.measurement_id),
+          module_link(v.module_link),
+          cluster_link(v.cluster_link),
+          meas_dim(v.meas_dim),
+          subspace0(v.subspace0),
+          subspace1(v.subspace1) {}
+
+    /// The number of measurements in the collection
+    TRACCC_HOST_DEVICE size_type size() const { return local0.size(); }
+
+    /// Get one measurement from the collection
+    ///
+    /// Only use this when all members of the measurement are needed. Reading
+    /// the individual arrays directly results in better memory access
+    /// patterns.
+    ///
+    TRACCC_HOST_DEVICE measurement at(size_type i) const {
+        measurement result;
+        result.local = {local0[i], local1[i]};
+        result.variance = {variance0[i], variance1[i]};
+        result.surface_link = detray::geometry::barcode{surface_link[i]};
+        result.measurement_id = details::from_soa_index(measurement_id[i]);
+        result.module_link = module_link[i];
+        result.cluster_link = details::from_soa_index(cluster_link[i]);
+        result.meas_dim = meas_dim[i];
+        result.subs.set_indices({subspace0[i], subspace1[i]});
+        return result;
+    }
+
+    /// Set one measurement of the collection
+    template <bool C = CONST, std::enable_if_t<!C, bool> = true>
+    TRACCC_HOST_DEVICE void set(size_type i, const measurement& m) {
+        local0[i] = m.local[0];
+        local1[i] = m.local[1];
+        variance0[i] = m.variance[0];
+        variance1[i] = m.variance[1];
+        surface_link[i] = m.surface_link.value();
+        measurement_id[i] = details::to_soa_index(m.measurement_id);
+        module_link[i] =
+            static_cast<details::measurement_soa_index>(m.module_link);
+        cluster_link[i] = details::to_soa_index(m.cluster_link);
+        meas_dim[i] = static_cast<details::measurement_soa_dim>(m.meas_dim);
+        subspace0[i] =
+            static_cast<details::measurement_soa_dim>(m.subs.get_indices()[0]);
+        subspace1[i] =
+            static_cast<details::measurement_soa_dim>(m.subs.get_indices()[1]);
+    }
+
+    /// @name The arrays of the collection
+    /// @{
+    details::soa_device_vector<CONST, scalar> local0;
+    details::soa_device_vector<CONST, scalar> local1;
+    details::soa_device_vector<CONST, scalar> variance0;
+    details::soa_device_vector<CONST, scalar> variance1;
+    details::soa_device_vector<CONST, std::uint64_t> surface_link;
+    details::soa_device_vector<CONST, details::measurement_soa_index>
+        measurement_id;
+    details::soa_device_vector<CONST, details::measurement_soa_index>
+        module_link;
+    details::soa_device_vector<CONST, details::measurement_soa_index>
+        cluster_link;
+    details::soa_device_vector<CONST, details::measurement_soa_dim> meas_dim;
+    details::soa_device_vector<CONST, details::measurement_soa_dim> subspace0;
+    details::soa_device_vector<CONST, details::measurement_soa_dim> subspace1;
+    /// @}
+
+};  // struct measurement_soa_device
+
+/// Declare all SoA measurement collection types
+struct measurement_soa_collection_types {
+    /// Host collection
+    using host = measurement_soa_host;
+    /// Non-const device collection
+    using device = measurement_soa_device<false>;
+    /// Constant device collection
+    using const_device = measurement_soa_device<true>;
+    /// Non-constant view
+    using view = measurement_soa_view<false>;
+    /// Constant view
+    using const_view = measurement_soa_view<true>;
+    /// Buffer
+    using buffer = measurement_soa_buffer;
+};
+
+namespace details {
+
+/// Fill an SoA measurement view from a set of per-array views / buffers
+template <typename view_t, typename source_t, typename getter_t>
+view_t make_measurement_soa_view(source_t& source, getter_t getter) {
+    view_t result;
+    result.local0 = getter(source.local0);
+    result.local1 = getter(source.local1);
+    result.variance0 = getter(source.variance0);
+    result.variance1 = getter(source.variance1);
+    result.surface_link = getter(source.surface_link);
+    result.measurement_id = getter(source.measurement_id);
+    result.module_link = getter(source.module_link);
+    result.cluster_link = getter(source.cluster_link);
+    result.meas_dim = getter(source.meas_dim);
+    result.subspace0 = getter(source.subspace0);
+    result.subspace1 = getter(source.subspace1);
+    return result;
+}
+
+}  // namespace details
+
+/// Get a (non-const) view of a host SoA measurement collection
+inline measurement_soa_view<false> get_data(measurement_soa_host& meas) {
+    return details::make_measurement_soa_view<measurement_soa_view<false>>(
+        meas, [](auto& v) { return vecmem::get_data(v); });
+}
+
+/// Get a (const) view of a host SoA measurement collection
+inline measurement_soa_view<true> get_data(const measurement_soa_host& meas) {
+    return details::make_measurement_soa_view<measurement_soa_view<true>>(
+        meas, [](const auto& v) { return vecmem::get_data(v); });
+}
+
+/// Get a (non-const) view of an SoA measurement buffer
+inline measurement_soa_view<false> get_data(measurement_soa_buffer& meas) {
+    return details::make_measurement_soa_view<measurement_soa_view<false>>(
+        meas, [](auto& b) { return vecmem::get_data(b); });
+}
+
+/// Copy an SoA measurement collection between two views
+///
+/// @param copy_obj The copy object to use
+/// @param from The view to copy from
+/// @param to The view to copy into (of the same size)
+/// @param type The type of the copy, if known
+///
+inline void copy(vecmem::copy& copy_obj, const measurement_soa_view<true>& from,
+                 const measurement_soa_view<false>& to,
+                 vecmem::copy::type::copy_type type =
+                     vecmem::copy::type::unknown) {
+    copy_obj(from.local0, to.local0, type);
+    copy_obj(from.local1, to.local1, type);
+    copy_obj(from.variance0, to.variance0, type);
+    copy_obj(from.variance1, to.variance1, type);
+    copy_obj(from.surface_link, to.surface_link, type);
+    copy_obj(from.measurement_id, to.measurement_id, type);
+    copy_obj(from.module_link, to.module_link, type);
+    copy_obj(from.cluster_link, to.cluster_link, type);
+    copy_obj(from.meas_dim, to.meas_dim, type);
+    copy_obj(from.subspace0, to.subspace0, type);
+    copy_obj(from.subspace1, to.subspace1, type);
+}
+
+/// Convert an AoS measurement collection into SoA layout
+///
+/// @param meas The measurements to convert
+/// @param mr The memory resource to use for the result
+/// @return The measurements in SoA layout
+///
+inline measurement_soa_host to_soa(
+    const measurement_collection_types::host& meas,
+    vecmem::memory_resource* mr = nullptr) {
+    measurement_soa_host result(mr);
+    result.resize(meas.size());
+    for (std::size_t i = 0; i < meas.size(); ++i) {
+        result.set(i, meas[i]);
+    }
+    return result;
+}
+
+/// Convert an SoA measurement collection into the AoS layout used by the
+/// seeding and track finding algorithms
+///
+/// @param meas The measurements to convert
+/// @param mr The memory resource to use for the result
+/// @return The measurements in AoS layout
+///
+inline measurement_collection_types::host to_aos(
+    const measurement_soa_host& meas, vecmem::memory_resource* mr = nullptr) {
+    measurement_collection_types::host result(mr);
+    result.reserve(meas.size());
+    for (std::size_t i = 0; i < meas.size(); ++i) {
+        result.push_back(meas.at(i));
+    }
+    return result;
+}
+
+/// @}
+
+}  // namespace traccc
@@ -0,0 +1,336 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s).
+#include "traccc/definitions/primitives.hpp"
+#include "traccc/definitions/qualifiers.hpp"
+#include "traccc/edm/cell.hpp"
+#include "traccc/edm/details/soa_types.hpp"
+
+// Detray include(s).
+#include "detray/geometry/barcode.hpp"
+
+// VecMem include(s).
+#include <vecmem/containers/data/vector_buffer.hpp>
+#include <vecmem/containers/vector.hpp>
+#include <vecmem/memory/memory_resource.hpp>
+#include <vecmem/utils/copy.hpp>
+
+// System include(s).
+#include <array>
+
+namespace traccc {
+
+/// @name Structure-of-arrays table of compact module descriptors
+///
+/// Holds the properties of the detector modules needed by the
+/// clusterization and the spacepoint formation, in a much more compact form
+/// than @c traccc::cell_module. The placement of a module is stored as a
+/// 3x4 single precision matrix (the rotation and the translation), instead
+/// of a full transform with both its matrix and its inverse.
+///
+/// Meant to be built once per detector (from the modules that the cells of
+/// all events link to), and to be kept on the device for all events.
+///
+/// @{
+
+namespace details {
+
+/// Compact placement of a module: a row-major 3x4 matrix of the rotation
+/// (in the first three columns) and the translation (in the last column)
+using compact_placement = std::array<float, 12>;
+
+/// Make the compact placement of a module
+inline compact_placement make_compact_placement(const transform3& trf) {
+
+    const point3 translation = trf.point_to_global(point3{0.f, 0.f, 0.f});
+    const vector3 axes[3] = {trf.vector_to_global(vector3{1.f, 0.f, 0.f}),
+                             trf.vector_to_global(vector3{0.f, 1.f, 0.f}),
+                             trf.vector_to_global(vector3{0.f, 0.f, 1.f})};
+    compact_placement result;
+    for (unsigned int row = 0; row < 3; ++row) {
+        for (unsigned int col = 0; col < 3; ++col) {
+            result[row * 4 + col] = static_cast<float>(axes[col][row]);
+        }
+        result[row * 4 + 3] = static_cast<float>(translation[row]);
+    }
+    return result;
+}
+
+/// Transform a (2D) local position on a module into global coordinates
+TRACCC_HOST_DEVICE inline point3 point_to_global(const compact_placement& p,
+                                                 const point2& local) {
+
+    point3 result;
+    for (unsigned int row = 0; row < 3; ++row) {
+        result[row] = p[row * 4] * local[0] + p[row * 4 + 1] * local[1] +
+                      p[row * 4 + 3];
+    }
+    return result;
+}
+
+}  // namespace details
+
+/// Host table of module descriptors, in SoA layout
+struct module_descriptor_soa_host {
+
+    /// Constructor with a memory resource
+    explicit module_descriptor_soa_host(vecmem::memory_resource* mr = nullptr)
+        : placement(mr),
+          pitch_x(mr),
+          pitch_y(mr),
+          origin_x(mr),
+          origin_y(mr),
+          threshold(mr),
+          surface_link(mr) {}
+
+    /// The number of modules in the table
+    std::size_t size() const { return placement.size(); }
+
+    /// Add the descriptor of a module to the end of the table
+    void push_back(const cell_module& m) {
+        placement.push_back(details::make_compact_placement(m.placement));
+        pitch_x.push_back(static_cast<float>(m.pixel.pitch_x));
+        pitch_y.push_back(static_cast<float>(m.pixel.pitch_y));
+        origin_x.push_back(static_cast<float>(m.pixel.min_center_x));
+        origin_y.push_back(static_cast<float>(m.pixel.min_center_y));
+        threshold.push_back(static_cast<float>(m.threshold));
+        surface_link.push_back(m.surface_link);
+    }
+
+    /// @name The arrays of the table
+    /// @{
+    vecmem::vector<details::compact_placement> placement;
+    vecmem::vector<float> pitch_x;
+    vecmem::vector<float> pitch_y;
+    vecmem::vector<float> origin_x;
+    vecmem::vector<float> origin_y;
+    vecmem::vector<float> threshold;
+    vecmem::vector<detray::geometry::barcode> surface_link;
+    /// @}
+
+};  // struct module_descriptor_soa_host
+
+/// View of a module descriptor table, in SoA layout
+template <bool CONST>
+struct module_descriptor_soa_view {
+
+    /// Size type of the views
+    using size_type =
+        typename details::soa_vector_view<CONST, float>::size_type;
+
+    /// Default constructor
+    module_descriptor_soa_view() = default;
+
+    /// Constructor from a non-const view
+    template <bool OTHER_CONST,
+              std::enable_if_t<CONST && (!OTHER_CONST), bool> = true>
+    TRACCC_HOST_DEVICE module_descriptor_soa_view(
+        const module_descriptor_soa_view<OTHER_CONST>& parent)
+        : placement(parent.placement),
+          pitch_x(parent.pitch_x),
+          pitch_y(parent.pitch_y),
+          origin_x(parent.origin_x),
+          origin_y(parent.origin_y),
+          threshold(parent.threshold),
+          surface_link(parent.surface_link) {}
+
+    /// The number of modules in the table
+    TRACCC_HOST_DEVICE size_type size() const { return placement.size(); }
+
+    /// @name Views of the arrays of the table
+    /// @{
+    details::soa_vector_view<CONST, details::compact_placement> placement;
+    details::soa_vector_view<CONST, float> pitch_x;
+    details::soa_vector_view<CONST, float> pitch_y;
+    details::soa_vector_view<CONST, float> origin_x;
+    details::soa_vector_view<CONST, float> origin_y;
+    details::soa_vector_view<CONST, float> threshold;
+    details::soa_vector_view<CONST, detray::geometry::barcode> surface_link;
+    /// @}
+
+};  // struct module_descriptor_soa_view
+
+/// Buffer for a module descriptor table, in SoA layout
+struct module_descriptor_soa_buffer {
+
+    /// Size type of the buffers
+    using size_type = module_descriptor_soa_view<false>::size_type;
+
+    /// Constructor allocating the arrays of the table
+    module_descriptor_soa_buffer(size_type size, vecmem::memory_resource& mr)
+        : placement(size, mr),
+          pitch_x(size, mr),
+          pitch_y(size, mr),
+          origin_x(size, mr),
+          origin_y(size, mr),
+          threshold(size, mr),
+          surface_link(size, mr) {}
+
+    /// The number of modules in the table
+    size_type size() const { return placement.size(); }
+
+    /// @name Buffers of the arrays of the table
+    /// @{
+    vecmem::data::vector_buffer<details::compact_placement> placement;
+    vecmem::data::vector_buffer<float> pitch_x;
+    vecmem::data::vector_buffer<float> pitch_y;
+    vecmem::data::vector_buffer<float> origin_x;
+    vecmem::data::vector_buffer<float> origin_y;
+    vecmem::data::vector_buffer<float> threshold;
+    vecmem::data::vector_buffer<detray::geometry::barcode> surface_link;
+    /// @}
+
+};  // struct module_descriptor_soa_buffer
+
+/// Device table of module descriptors, in SoA layout
+template <bool CONST>
+struct module_descriptor_soa_device {
+
+    /// Size type of the table
+    using size_type = typename module_descriptor_soa_view<CONST>::size_type;
+
+    /// Constructor from a view
+    TRACCC_HOST_DEVICE explicit module_descriptor_soa_device(
+        const module_descriptor_soa_view<CONST>& v)
+        : placement(v.placement),
+          pitch_x(v.pitch_x),
+          pitch_y(v.pitch_y),
+          origin_x(v.origin_x),
+          origin_y(v.origin_y),
+          threshold(v.threshold),
+          surface_link(v.surface_link) {}
+
+    /// The number of modules in the table
+    TRACCC_HOST_DEVICE size_type size() const { return placement.size(); }
+
+    /// Get the local position of a cell on its module
+    TRACCC_HOST_DEVICE point2 cell_position(size_type i,
+                                            const cell& c) const {
+        return {origin_x[i] + static_cast<float>(c.channel0) * pitch_x[i],
+                origin_y[i] + static_cast<float>(c.channel1) * pitch_y[i]};
+    }
+
+    /// Transform a local position on a module into global coordinates
+    TRACCC_HOST_DEVICE point3 point_to_global(size_type i,
+                                              const point2& local) const {
+        return details::point_to_global(placement[i], local);
+    }
+
+    /// @name The arrays of the table
+    /// @{
+    details::soa_device_vector<CONST, details::compact_placement> placement;
+    details::soa_device_vector<CONST, float> pitch_x;
+    details::soa_device_vector<CONST, float> pitch_y;
+    details::soa_device_vector<CONST, float> origin_x;
+    details::soa_device_vector<CONST, float> origin_y;
+    details::soa_device_vector<CONST, float> threshold;
+    details::soa_device_vector<CONST, detray::geometry::barcode> surface_link;
+    /// @}
+
+};  // struct module_descriptor_soa_device
+
+/// Declare all SoA module descriptor table types
+struct module_descriptor_soa_collection_types {
+    /// Host collection
+    using host = module_descriptor_soa_host;
+    /// Non-const device collection
+    using device = module_descriptor_soa_device<false>;
+    /// Constant device collection
+    using const_device = module_descriptor_soa_device<true>;
+    /// Non-constant view
+    using view = module_descriptor_soa_view<false>;
+    /// Constant view
+    using const_view = module_descriptor_soa_view<true>;
+    /// Buffer
+    using buffer = module_descriptor_soa_buffer;
+};
+
+/// Get a (non-const) view of a host module descriptor table
+inline module_descriptor_soa_view<false> get_data(
+    module_descriptor_soa_host& modules) {
+    module_descriptor_soa_view<false> result;
+    result.placement = vecmem::get_data(modules.placement);
+    result.pitch_x = vecmem::get_data(modules.pitch_x);
+    result.pitch_y = vecmem::get_data(modules.pitch_y);
+    result.origin_x = vecmem::get_data(modules.origin_x);
+    result.origin_y = vecmem::get_data(modules.origin_y);
+    result.threshold = vecmem::get_data(modules.threshold);
+    result.surface_link = vecmem::get_data(modules.surface_link);
+    return result;
+}
+
+/// Get a (const) view of a host module descriptor table
+inline module_descriptor_soa_view<true> get_data(
+    const module_descriptor_soa_host& modules) {
+    module_descriptor_soa_view<true> result;
+    result.placement = vecmem::get_data(modules.placement);
+    result.pitch_x = vecmem::get_data(modules.pitch_x);
+    result.pitch_y = vecmem::get_data(modules.pitch_y);
+    result.origin_x = vecmem::get_data(modules.origin_x);
+    result.origin_y = vecmem::get_data(modules.origin_y);
+    result.threshold = vecmem::get_data(modules.threshold);
+    result.surface_link = vecmem::get_data(modules.surface_link);
+    return result;
+}
+
+/// Get a (non-const) view of a module descriptor buffer
+inline module_descriptor_soa_view<false> get_data(
+    module_descriptor_soa_buffer& modules) {
+    module_descriptor_soa_view<false> result;
+    result.placement = modules.placement;
+    result.pitch_x = modules.pitch_x;
+    result.pitch_y = modules.pitch_y;
+    result.origin_x = modules.origin_x;
+    result.origin_y = modules.origin_y;
+    result.threshold = modules.threshold;
+    result.surface_link = modules.surface_link;
+    return result;
+}
+
+/// Copy a module descriptor table between two views
+///
+/// @param copy_obj The copy object to use
+/// @param from The view to copy from
+/// @param to The view to copy into (of the same size)
+/// @param type The type of the copy, if known
+///
+inline void copy(vecmem::copy& copy_obj,
+                 const module_descriptor_soa_view<true>& from,
+                 const module_descriptor_soa_view<false>& to,
+                 vecmem::copy::type::copy_type type =
+                     vecmem::copy::type::unknown) {
+    copy_obj(from.placement, to.placement, type);
+    copy_obj(from.pitch_x, to.pitch_x, type);
+    copy_obj(from.pitch_y, to.pitch_y, type);
+    copy_obj(from.origin_x, to.origin_x, type);
+    copy_obj(from.origin_y, to.origin_y, type);
+    copy_obj(from.threshold, to.threshold, type);
+    copy_obj(from.surface_link, to.surface_link, type);
+}
+
+/// Make the descriptor table of a module collection
+///
+/// @param modules The modules to describe
+/// @param mr The memory resource to use for the result
+/// @return The descriptors of the modules, at the same indices
+///
+inline module_descriptor_soa_host make_module_descriptors(
+    const cell_module_collection_types::host& modules,
+    vecmem::memory_resource* mr = nullptr) {
+    module_descriptor_soa_host result(mr);
+    for (const cell_module& m : modules) {
+        result.push_back(m);
+    }
+    return result;
+}
+
+/// @}
+
+}  // namespace traccc
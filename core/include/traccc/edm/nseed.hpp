@@ -1,16 +1,20 @@
 /** TRACCC library, part of the ACTS project (R&D line)
  *
- * (c) 2021-2022 CERN for the benefit of the ACTS project
+ * (c) 2021-2024 CERN for the benefit of the ACTS project
  *
  * Mozilla Public License Version 2.0
  */
 
 #pragma once
 
+#include <traccc/definitions/qualifiers.hpp>
 #include <traccc/edm/container.hpp>
 #include <traccc/edm/seed.hpp>
 #include <traccc/edm/spacepoint.hpp>
 
+#include <array>
+#include <cassert>
+
 namespace traccc {
 /**
  * @brief Seed of arbitrary size.
@@ -32,31 +36,74 @@ struct nseed {
      */
     using link_type = spacepoint_collection_types::host::size_type;
 
+    /**
+     * @brief Construct an empty n-seed object.
+     */
+    TRACCC_HOST_DEVICE
+    nseed() : _size(0), _sps{} {}
+
     /**
      * @brief Construct a new n-seed object from a 3-seed object.
      *
      * @param s A 3-seed.
      */
+    TRACCC_HOST_DEVICE
     nseed(const seed& s)
         : _size(3), _sps({s.spB_link, s.spM_link, s.spT_link}) {}
 
+    /**
+     * @brief Get the maximum size of the seed.
+     */
+    TRACCC_HOST_DEVICE
+    static constexpr std::size_t capacity() { return N; }
+
     /**
      * @brief Get the size of the seed.
      */
+    TRACCC_HOST_DEVICE
     std::size_t size() const { return _size; }
 
+    /**
+     * @brief Add a space point identifier to the end of the seed.
+     *
+     * @param l The identifier of a space point outside of the seed.
+     */
+    TRACCC_HOST_DEVICE
+    void push_back(link_type l) {
+        assert(_size < N);
+        _sps[_size++] = l;
+    }
+
+    /**
+     * @brief Get the i-th space point identifier in the seed.
+     */
+    TRACCC_HOST_DEVICE
+    link_type operator[](std::size_t i) const {
+        assert(i < _size);
+        return _sps[i];
+    }
+
     /**
      * @brief Get the first space point identifier in the seed.
      */
+    TRACCC_HOST_DEVICE
     const link_type* cbegin() const { return &_sps[0]; }
 
     /**
      * @brief Get the one-after-last space point identifier in the seed.
      */
+    TRACCC_HOST_DEVICE
     const link_type* cend() const { return &_sps[_size]; }
 
     private:
     std::size_t _size;
     std::array<link_type, N> _sps;
 };
+
+/// The n-seed type produced by the seed extension
+using extended_seed = nseed<5>;
+
+/// Declare all extended seed collection types
+using extended_seed_collection_types = collection_types<extended_seed>;
+
 }  // namespace traccc
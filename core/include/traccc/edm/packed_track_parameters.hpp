@@ -0,0 +1,107 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s).
+#include "traccc/definitions/qualifiers.hpp"
+#include "traccc/definitions/track_parametrization.hpp"
+#include "traccc/edm/container.hpp"
+#include "traccc/edm/track_parameters.hpp"
+
+// detray include(s).
+#include "detray/geometry/barcode.hpp"
+
+namespace traccc {
+
+/// Bound track parameters in a packed storage format
+///
+/// Only the upper triangle of the (symmetric) covariance matrix is stored,
+/// in single precision, row by row. Which makes the parameters a lot smaller
+/// to store, and faster to read and write, than
+/// @c detray::bound_track_parameters. The parameters are meant to be kept in
+/// memory in this format, and to be converted (implicitly) to/from
+/// @c detray::bound_track_parameters in registers, only where they are used.
+///
+template <typename algebra_t>
+struct packed_bound_track_parameters {
+
+    using bound_track_parameters_type =
+        detray::bound_track_parameters<algebra_t>;
+    using bound_vector = typename bound_track_parameters_type::vector_type;
+    using bound_matrix = typename bound_track_parameters_type::covariance_type;
+    using scalar_type = typename algebra_t::scalar_type;
+
+    /// The number of stored covariance elements
+    static constexpr unsigned int covariance_size =
+        e_bound_size * (e_bound_size + 1) / 2;
+
+    packed_bound_track_parameters() = default;
+
+    /// Construction from (by packing) bound track parameters
+    TRACCC_HOST_DEVICE
+    packed_bound_track_parameters(const bound_track_parameters_type& par)
+        : m_surface_link(par.surface_link()) {
+
+        const bound_vector& vec = par.vector();
+        const bound_matrix& cov = par.covariance();
+        for (unsigned int i = 0u; i < e_bound_size; ++i) {
+            m_vector[i] = getter::element(vec, i, 0u);
+            for (unsigned int j = i; j < e_bound_size; ++j) {
+                m_covariance[index(i, j)] =
+                    static_cast<float>(getter::element(cov, i, j));
+            }
+        }
+    }
+
+    /// Conversion to (by unpacking into) bound track parameters
+    TRACCC_HOST_DEVICE
+    operator bound_track_parameters_type() const { return unpack(); }
+
+    /// @return the unpacked bound track parameters
+    TRACCC_HOST_DEVICE
+    bound_track_parameters_type unpack() const {
+
+        bound_vector vec;
+        bound_matrix cov;
+        for (unsigned int i = 0u; i < e_bound_size; ++i) {
+            getter::element(vec, i, 0u) = m_vector[i];
+            for (unsigned int j = i; j < e_bound_size; ++j) {
+                const scalar_type value =
+                    static_cast<scalar_type>(m_covariance[index(i, j)]);
+                getter::element(cov, i, j) = value;
+                getter::element(cov, j, i) = value;
+            }
+        }
+        return {m_surface_link, vec, cov};
+    }
+
+    /// @return the surface that the parameters are bound to
+    TRACCC_HOST_DEVICE
+    const detray::geometry::barcode& surface_link() const {
+        return m_surface_link;
+    }
+
+    /// The position of covariance element (i, j), for i <= j
+    TRACCC_HOST_DEVICE
+    static constexpr unsigned int index(unsigned int i, unsigned int j) {
+        return i * e_bound_size - (i * (i + 1u)) / 2u + j;
+    }
+
+    /// The surface that the parameters are bound to
+    detray::geometry::barcode m_surface_link;
+    /// The parameter vector
+    scalar_type m_vector[e_bound_size];
+    /// The upper triangle of the covariance matrix
+    float m_covariance[covariance_size];
+};
+
+/// Declare all packed track_parameters collection types
+using packed_bound_track_parameters_collection_types =
+    collection_types<packed_bound_track_parameters<transform3>>;
+
+}  // namespace traccc
@@ -0,0 +1,34 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s).
+#include "traccc/definitions/primitives.hpp"
+#include "traccc/edm/container.hpp"
+
+namespace traccc {
+
+/// Definition of one cell, as it arrives from the readout
+///
+/// Unlike @c traccc::cell, it identifies its module directly with the
+/// geometry identifier (barcode value) of the module, and it comes in no
+/// particular order. The clusterization needs the cells to be sorted and
+/// linked to a module collection first.
+///
+struct raw_cell {
+    geometry_id module_id = 0;
+    channel_id channel0 = 0;
+    channel_id channel1 = 0;
+    scalar activation = 0.;
+    scalar time = 0.;
+};
+
+/// Declare all raw cell collection types
+using raw_cell_collection_types = collection_types<raw_cell>;
+
+}  // namespace traccc
@@ -0,0 +1,86 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s).
+#include "traccc/definitions/primitives.hpp"
+#include "traccc/definitions/qualifiers.hpp"
+#include "traccc/edm/container.hpp"
+
+// Algebra plugins include(s).
+#include <algebra/math/common.hpp>
+
+// System include(s).
+#include <cmath>
+
+namespace traccc {
+
+/// A region of interest in the detector, e.g. from a level-1 trigger
+///
+/// The region is a wedge in (eta, phi), with its apex anywhere on the beam
+/// line in a range of Z. All coordinates are in the global frame of the
+/// detector.
+///
+struct region_of_interest {
+
+    /// @name The pseudorapidity range of the region
+    /// @{
+    scalar eta_min;
+    scalar eta_max;
+    /// @}
+
+    /// @name The azimuthal angle range of the region
+    ///
+    /// If @c phi_min is larger than @c phi_max, the region wraps around
+    /// the +-pi boundary.
+    ///
+    /// @{
+    scalar phi_min;
+    scalar phi_max;
+    /// @}
+
+    /// @name The range of the vertex position along the beam line
+    /// @{
+    scalar z_vertex_min;
+    scalar z_vertex_max;
+    /// @}
+
+    /// Check whether a point is inside the region
+    ///
+    /// @param pos The global position of the point
+    /// @return @c true if a track from the vertex range, with an (eta, phi)
+    ///         inside the region, may have gone through the point
+    ///
+    TRACCC_HOST_DEVICE bool contains(const point3& pos) const {
+
+        // Check phi first, it's the cheapest and most discriminating.
+        const scalar phi = algebra::math::atan2(pos[1], pos[0]);
+        const bool phi_inside = (phi_min <= phi_max)
+                                    ? ((phi >= phi_min) && (phi <= phi_max))
+                                    : ((phi >= phi_min) || (phi <= phi_max));
+        if (!phi_inside) {
+            return false;
+        }
+
+        // The cotangent of the polar angle of the point, as seen from the
+        // vertex at Z, decreases monotonically with Z. So the point is inside
+        // if the cotangents seen from the two ends of the vertex range overlap
+        // with sinh(eta) of the region. (Written without dividing by the
+        // radius.)
+        const scalar r = algebra::math::sqrt(pos[0] * pos[0] + pos[1] * pos[1]);
+        return ((pos[2] - z_vertex_max) <= std::sinh(eta_max) * r) &&
+               ((pos[2] - z_vertex_min) >= std::sinh(eta_min) * r);
+    }
+
+};  // struct region_of_interest
+
+/// Declare all region of interest collection types
+using region_of_interest_collection_types =
+    collection_types<region_of_interest>;
+
+}  // namespace traccc
@@ -0,0 +1,235 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s).
+#include "traccc/definitions/qualifiers.hpp"
+#include "traccc/edm/details/soa_types.hpp"
+#include "traccc/edm/measurement.hpp"
+#include "traccc/edm/track_candidate.hpp"
+#include "traccc/edm/track_parameters.hpp"
+
+// VecMem include(s).
+#include <vecmem/containers/data/vector_buffer.hpp>
+#include <vecmem/containers/vector.hpp>
+#include <vecmem/memory/memory_resource.hpp>
+#include <vecmem/utils/copy.hpp>
+
+namespace traccc {
+
+/// @name Flat (structure-of-arrays) layout of track candidate containers
+///
+/// Instead of one jagged vector of measurement copies, the candidates of all
+/// tracks are stored as indices into the measurement collection that the
+/// track finding ran on, in one flat array. The candidates of track @c i are
+/// the ones in <tt>[offsets[i], offsets[i + 1])</tt>, so @c offsets has one
+/// more element than there are tracks. The seed of every track is kept in
+/// its own array.
+///
+/// @{
+
+/// Host container of track candidates, in flat layout
+struct track_candidate_soa_host {
+
+    /// Constructor with a memory resource
+    explicit track_candidate_soa_host(vecmem::memory_resource* mr = nullptr)
+        : seeds(mr), offsets(mr), measurement_indices(mr) {}
+
+    /// The number of tracks in the container
+    std::size_t size() const { return seeds.size(); }
+
+    /// @name The arrays of the container
+    /// @{
+    vecmem::vector<bound_track_parameters> seeds;
+    vecmem::vector<unsigned int> offsets;
+    vecmem::vector<unsigned int> measurement_indices;
+    /// @}
+
+};  // struct track_candidate_soa_host
+
+/// View of a track candidate container, in flat layout
+template <bool CONST>
+struct track_candidate_soa_view {
+
+    /// Size type of the views
+    using size_type =
+        typename details::soa_vector_view<CONST, unsigned int>::size_type;
+
+    /// Default constructor
+    track_candidate_soa_view() = default;
+
+    /// Constructor from a non-const view
+    template <bool OTHER_CONST,
+              std::enable_if_t<CONST && (!OTHER_CONST), bool> = true>
+    TRACCC_HOST_DEVICE track_candidate_soa_view(
+        const track_candidate_soa_view<OTHER_CONST>& parent)
+        : seeds(parent.seeds),
+          offsets(parent.offsets),
+          measurement_indices(parent.measurement_indices) {}
+
+    /// The number of tracks in the container
+    TRACCC_HOST_DEVICE size_type size() const { return seeds.size(); }
+
+    /// @name Views of the arrays of the container
+    /// @{
+    details::soa_vector_view<CONST, bound_track_parameters> seeds;
+    details::soa_vector_view<CONST, unsigned int> offsets;
+    details::soa_vector_view<CONST, unsigned int> measurement_indices;
+    /// @}
+
+};  // struct track_candidate_soa_view
+
+/// Buffer for a track candidate container, in flat layout
+struct track_candidate_soa_buffer {
+
+    /// Size type of the buffers
+    using size_type = track_candidate_soa_view<false>::size_type;
+
+    /// Constructor allocating the arrays of the container
+    ///
+    /// @param n_tracks The number of tracks
+    /// @param n_candidates The number of candidates of all tracks
+    /// @param mr The memory resource to allocate the arrays with
+    ///
+    track_candidate_soa_buffer(size_type n_tracks, size_type n_candidates,
+                               vecmem::memory_resource& mr)
+        : seeds(n_tracks, mr),
+          offsets(n_tracks + 1, mr),
+          measurement_indices(n_candidates, mr) {}
+
+    /// The number of tracks in the container
+    size_type size() const { return seeds.size(); }
+
+    /// @name Buffers of the arrays of the container
+    /// @{
+    vecmem::data::vector_buffer<bound_track_parameters> seeds;
+    vecmem::data::vector_buffer<unsigned int> offsets;
+    vecmem::data::vector_buffer<unsigned int> measurement_indices;
+    /// @}
+
+};  // struct track_candidate_soa_buffer
+
+/// Device container of track candidates, in flat layout
+template <bool CONST>
+struct track_candidate_soa_device {
+
+    /// Size type of the container
+    using size_type = typename track_candidate_soa_view<CONST>::size_type;
+
+    /// Constructor from a view
+    TRACCC_HOST_DEVICE explicit track_candidate_soa_device(
+        const track_candidate_soa_view<CONST>& v)
+        : seeds(v.seeds),
+          offsets(v.offsets),
+          measurement_indices(v.measurement_indices) {}
+
+    /// The number of tracks in the container
+    TRACCC_HOST_DEVICE size_type size() const { return seeds.size(); }
+
+    /// The number of candidates of one track
+    TRACCC_HOST_DEVICE size_type n_candidates(size_type i) const {
+        return offsets[i + 1] - offsets[i];
+    }
+
+    /// @name The arrays of the container
+    /// @{
+    details::soa_device_vector<CONST, bound_track_parameters> seeds;
+    details::soa_device_vector<CONST, unsigned int> offsets;
+    details::soa_device_vector<CONST, unsigned int> measurement_indices;
+    /// @}
+
+};  // struct track_candidate_soa_device
+
+/// Declare all flat track candidate container types
+struct track_candidate_soa_collection_types {
+    /// Host container
+    using host = track_candidate_soa_host;
+    /// Non-const device container
+    using device = track_candidate_soa_device<false>;
+    /// Constant device container
+    using const_device = track_candidate_soa_device<true>;
+    /// Non-constant view
+    using view = track_candidate_soa_view<false>;
+    /// Constant view
+    using const_view = track_candidate_soa_view<true>;
+    /// Buffer
+    using buffer = track_candidate_soa_buffer;
+};
+
+/// Get a (non-const) view of a host flat track candidate container
+inline track_candidate_soa_view<false> get_data(
+    track_candidate_soa_host& cands) {
+    track_candidate_soa_view<false> result;
+    result.seeds = vecmem::get_data(cands.seeds);
+    result.offsets = vecmem::get_data(cands.offsets);
+    result.measurement_indices = vecmem::get_data(cands.measurement_indices);
+    return result;
+}
+
+/// Get a (const) view of a host flat track candidate container
+inline track_candidate_soa_view<true> get_data(
+    const track_candidate_soa_host& cands) {
+    track_candidate_soa_view<true> result;
+    result.seeds = vecmem::get_data(cands.seeds);
+    result.offsets = vecmem::get_data(cands.offsets);
+    result.measurement_indices = vecmem::get_data(cands.measurement_indices);
+    return result;
+}
+
+/// Get a (non-const) view of a flat track candidate buffer
+inline track_candidate_soa_view<false> get_data(
+    track_candidate_soa_buffer& cands) {
+    track_candidate_soa_view<false> result;
+    result.seeds = vecmem::get_data(cands.seeds);
+    result.offsets = vecmem::get_data(cands.offsets);
+    result.measurement_indices = vecmem::get_data(cands.measurement_indices);
+    return result;
+}
+
+/// Copy a flat track candidate container from a view into a host container
+///
+/// @param copy_obj The copy object to use
+/// @param from The view to copy from
+/// @param to The host container to copy into (resized as needed)
+///
+inline void copy(vecmem::copy& copy_obj,
+                 const track_candidate_soa_view<true>& from,
+                 track_candidate_soa_host& to) {
+    copy_obj(from.seeds, to.seeds);
+    copy_obj(from.offsets, to.offsets);
+    copy_obj(from.measurement_indices, to.measurement_indices);
+}
+
+/// Convert flat track candidates into the jagged container layout
+///
+/// @param cands The track candidates to convert
+/// @param measurements The measurements that the candidates refer to
+/// @param mr The memory resource to use for the result
+/// @return The track candidates in the jagged container layout
+///
+inline track_candidate_container_types::host to_container(
+    const track_candidate_soa_host& cands,
+    const measurement_collection_types::host& measurements,
+    vecmem::memory_resource& mr) {
+    track_candidate_container_types::host result(&mr);
+    result.reserve(cands.size());
+    for (std::size_t i = 0; i < cands.size(); ++i) {
+        vecmem::vector<track_candidate> items(&mr);
+        items.reserve(cands.offsets.at(i + 1) - cands.offsets.at(i));
+        for (unsigned int j = cands.offsets.at(i); j < cands.offsets.at(i + 1);
+             ++j) {
+            items.push_back(measurements.at(cands.measurement_indices.at(j)));
+        }
+        result.push_back(cands.seeds.at(i), std::move(items));
+    }
+    return result;
+}
+
+/// @}
+
+}  // namespace traccc
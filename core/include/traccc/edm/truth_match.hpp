@@ -0,0 +1,51 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Local include(s).
+#include "traccc/definitions/qualifiers.hpp"
+#include "traccc/edm/container.hpp"
+#include "traccc/edm/measurement.hpp"
+
+// System include(s).
+#include <cstdint>
+#include <limits>
+
+namespace traccc {
+
+/// The truth particles contributing to the measurements of an event
+///
+/// Every header is a measurement, and its items are the identifiers of the
+/// particles contributing to it. The headers are sorted with the ordering
+/// operator of @c traccc::measurement, so that the measurements can be
+/// looked up with a binary search, also on a device.
+///
+using measurement_particle_container_types =
+    container_types<measurement, std::uint64_t>;
+
+/// The result of matching a reconstructed track to the truth particles
+struct track_truth_match {
+
+    /// Particle identifier of the tracks without a matching particle
+    static constexpr std::uint64_t invalid_particle_id =
+        std::numeric_limits<std::uint64_t>::max();
+
+    /// The identifier of the one particle contributing to all of the
+    /// (truth matched) measurements of the track, if there is such a particle
+    std::uint64_t particle_id = invalid_particle_id;
+
+    /// Whether the track could be matched to a particle
+    TRACCC_HOST_DEVICE
+    bool is_matched() const { return (particle_id != invalid_particle_id); }
+
+};  // struct track_truth_match
+
+/// Declare all track truth match collection types
+using track_truth_match_collection_types = collection_types<track_truth_match>;
+
+}  // namespace traccc
@@ -0,0 +1,36 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Local include(s).
+#include "traccc/edm/container.hpp"
+#include "traccc/edm/track_parameters.hpp"
+
+// detray include(s).
+#include "detray/geometry/barcode.hpp"
+
+namespace traccc {
+
+/// The truth state of a particle that a seed is generated from
+///
+/// That is the (free) parameters of the particle at its first measurement,
+/// and the surface of that measurement, that the seed is bound to.
+///
+struct truth_seed_input {
+
+    /// The surface of the first measurement of the particle
+    detray::geometry::barcode surface_link;
+    /// The parameters of the particle at its first measurement
+    free_track_parameters free_param;
+
+};  // struct truth_seed_input
+
+/// Declare all truth seed input collection types
+using truth_seed_input_collection_types = collection_types<truth_seed_input>;
+
+}  // namespace traccc
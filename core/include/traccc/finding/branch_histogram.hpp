@@ -0,0 +1,31 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// System include(s).
+#include <vector>
+
+namespace traccc {
+
+/// The number of track finding branches in every step of one event
+///
+/// Every vector has one element per executed step of the track finding.
+///
+struct branch_histogram {
+
+    /// The number of branches (candidate links) created in the step
+    std::vector<unsigned int> n_candidates;
+    /// The number of branches that reached a next surface, and are alive in
+    /// the next step
+    std::vector<unsigned int> n_active;
+    /// The number of branches that terminated in the step
+    std::vector<unsigned int> n_tips;
+
+};  // struct branch_histogram
+
+}  // namespace traccc
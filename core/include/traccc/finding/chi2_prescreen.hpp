@@ -0,0 +1,60 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s).
+#include "traccc/definitions/primitives.hpp"
+#include "traccc/definitions/qualifiers.hpp"
+#include "traccc/definitions/track_parametrization.hpp"
+#include "traccc/edm/measurement.hpp"
+#include "traccc/edm/track_parameters.hpp"
+
+namespace traccc {
+
+/// Cheap lower bound on the chi-square of a measurement w.r.t. a track
+///
+/// The chi-square calculated by the Kalman update is the one of the
+/// predicted residual r with respect to M = H*C*H^T + V. As the largest
+/// eigenvalue of M is not larger than its trace, the chi-square can not be
+/// smaller than |r|^2 / trace(M). Which only needs the diagonal elements of
+/// the covariances.
+///
+/// (The sign of the first local coordinate is ignored, as it is not
+/// measured on line surfaces.)
+///
+/// @param meas   The measurement
+/// @param params The predicted track parameters on the measurement's surface
+/// @return The lower bound of the measurement's chi-square
+///
+TRACCC_HOST_DEVICE
+inline scalar chi2_lower_bound(const measurement& meas,
+                               const bound_track_parameters& params) {
+
+    const auto& vec = params.vector();
+    const auto& cov = params.covariance();
+    const auto& indices = meas.subs.get_indices();
+
+    scalar residual2 = 0.f;
+    scalar trace = 0.f;
+    for (unsigned int i = 0u; i < meas.meas_dim; ++i) {
+
+        const auto idx = indices[i];
+        const scalar local = meas.local[idx];
+        const scalar predicted = getter::element(vec, idx, 0u);
+        scalar r = local - predicted;
+        if (idx == e_bound_loc0) {
+            const scalar r_flipped = local + predicted;
+            r = (r * r < r_flipped * r_flipped) ? r : r_flipped;
+        }
+        residual2 += r * r;
+        trace += meas.variance[idx] + getter::element(cov, idx, idx);
+    }
+    return (trace > 0.f) ? residual2 / trace : 0.f;
+}
+
+}  // namespace traccc
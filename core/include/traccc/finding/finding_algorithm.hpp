@@ -12,13 +12,19 @@
 #include "traccc/edm/measurement.hpp"
 #include "traccc/edm/track_candidate.hpp"
 #include "traccc/edm/track_state.hpp"
+#include "traccc/finding/candidate_link.hpp"
+#include "traccc/finding/chi2_prescreen.hpp"
 #include "traccc/finding/finding_config.hpp"
 #include "traccc/finding/interaction_register.hpp"
+#include "traccc/finding/measurement_range.hpp"
 #include "traccc/fitting/kalman_filter/gain_matrix_updater.hpp"
+#include "traccc/fitting/kalman_filter/kalman_fitter.hpp"
+#include "traccc/navigation/planar_navigator.hpp"
 #include "traccc/utils/algorithm.hpp"
 #include "traccc/utils/memory_resource.hpp"
 
 // detray include(s).
+#include "detray/geometry/surface.hpp"
 #include "detray/navigation/intersection/intersection.hpp"
 #include "detray/propagator/actor_chain.hpp"
 #include "detray/propagator/actors/aborters.hpp"
@@ -28,15 +34,35 @@
 #include "detray/propagator/propagator.hpp"
 
 // VecMem include(s).
+#include <vecmem/containers/jagged_vector.hpp>
+#include <vecmem/containers/vector.hpp>
+#include <vecmem/memory/host_memory_resource.hpp>
+#include <vecmem/memory/memory_resource.hpp>
 #include <vecmem/utils/copy.hpp>
 
 // Thrust Library
 #include <thrust/pair.h>
 
+// System include(s).
+#include <cstddef>
+#include <functional>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
 namespace traccc {
 
 /// Track Finding algorithm for a set of tracks
-template <typename stepper_t, typename navigator_t>
+///
+/// With a @c traccc::planar_navigator as navigator, the tracks are
+/// propagated along the fixed-order walk of its planes, instead of with the
+/// detray propagator.
+///
+/// @tparam precise_scalar_t The scalar type of the Kalman gain inversions and
+///         chi-squares (see @c traccc::gain_matrix_updater)
+///
+template <typename stepper_t, typename navigator_t,
+          typename precise_scalar_t = typename stepper_t::scalar_type>
 class finding_algorithm
     : public algorithm<track_candidate_container_types::host(
           const typename navigator_t::detector_type&,
@@ -67,6 +93,12 @@ class finding_algorithm
     using propagator_type =
         detray::propagator<stepper_t, navigator_t, actor_type>;
 
+    /// The object propagating the tracks to their next surfaces: the plane
+    /// walk of a planar navigator, or the detray propagator
+    using propagation_type =
+        std::conditional_t<is_planar_navigator_v<navigator_t>, navigator_t,
+                           propagator_type>;
+
     using intersection_type =
         detray::intersection2D<typename detector_type::surface_type,
                                transform3_type>;
@@ -76,21 +108,47 @@ class finding_algorithm
 
     using bfield_type = typename stepper_t::magnetic_field_type;
 
+    /// Track state type
+    using track_state_type = track_state<transform3_type>;
+    /// Transport jacobian type
+    using bound_matrix = typename track_state_type::bound_matrix;
+
     public:
     /// Configuration type
-    using config_type = finding_config<scalar_type>;
+    using config_type = finding_config<scalar_type, precise_scalar_t>;
+
+    /// The found track candidates, with the track states filtered while
+    /// finding them
+    using output_with_transport_type =
+        std::pair<track_candidate_container_types::host,
+                  track_state_container_types::host>;
+
+    /// Constructor for the finding algorithm
+    ///
+    /// The temporaries of the algorithm are allocated from the (global)
+    /// host memory resource.
+    ///
+    /// @param cfg  Configuration object
+    finding_algorithm(const config_type& cfg)
+        : finding_algorithm(cfg, default_memory_resource()) {}
 
     /// Constructor for the finding algorithm
     ///
     /// @param cfg  Configuration object
-    /// @param mr   The memory resource to use
-    finding_algorithm(const config_type& cfg) : m_cfg(cfg) {}
+    /// @param mr   The memory resource to allocate the temporaries of the
+    ///             algorithm from, used by all threads running it
+    finding_algorithm(const config_type& cfg, vecmem::memory_resource& mr)
+        : m_cfg(cfg), m_mr(mr) {}
 
     /// Get config object (const access)
-    const finding_config<scalar_type>& get_config() const { return m_cfg; }
+    const config_type& get_config() const { return m_cfg; }
 
     /// Run the algorithm
     ///
+    /// The input parameters of every step are processed in (TBB) tasks if
+    /// @c finding_config::host_params_per_task is set, with the same results
+    /// as for the serial processing.
+    ///
     /// @param det    Detector
     /// @param measurements  Input measurements
     /// @param seeds  Input seeds
@@ -99,9 +157,230 @@ class finding_algorithm
         const measurement_collection_types::host& measurements,
         const bound_track_parameters_collection_types::host& seeds) const;
 
+    /// Run the track finding, and smooth the found tracks right away
+    ///
+    /// Instead of fitting the track candidates found by @c operator() once
+    /// more, starting from their seeds, the track states filtered during the
+    /// track finding are kept, and only the backward smoothing of the Kalman
+    /// fitter is run on them. Saving the forward propagation of every track.
+    ///
+    /// The transport jacobians over holes are combined with the ones of the
+    /// following measurements. Which is only an approximation, as the
+    /// finding updates the parameters of a hole with a loose dummy
+    /// measurement.
+    ///
+    /// @param det    Detector
+    /// @param measurements  Input measurements
+    /// @param seeds  Input seeds
+    /// @return The smoothed track states of the found tracks
+    ///
+    track_state_container_types::host find_and_smooth(
+        const detector_type& det, const bfield_type& field,
+        const measurement_collection_types::host& measurements,
+        const bound_track_parameters_collection_types::host& seeds) const;
+
+    /// Run the track finding, recording the transport of the found tracks
+    ///
+    /// Next to the track candidates of @c operator(), the track states
+    /// filtered during the track finding are returned for every candidate.
+    /// With their predicted parameters, and the transport jacobians from
+    /// their previous measurements (combined over holes, as in
+    /// @c find_and_smooth). The header of every track holds the seed that
+    /// the track was found from, as its fit parameters.
+    ///
+    /// The fitting algorithm can re-use these track states in the first
+    /// iteration of its fit, instead of propagating the tracks once more
+    /// along the same surfaces.
+    ///
+    /// @param det    Detector
+    /// @param measurements  Input measurements
+    /// @param seeds  Input seeds
+    /// @return The track candidates, and their recorded track states
+    ///
+    output_with_transport_type find_with_transport(
+        const detector_type& det, const bfield_type& field,
+        const measurement_collection_types::host& measurements,
+        const bound_track_parameters_collection_types::host& seeds) const;
+
     private:
+    /// The links of all steps of the track finding
+    struct link_store {
+        /// Constructor, with the resource to allocate the links from
+        explicit link_store(vecmem::memory_resource& mr)
+            : links(&mr), param_to_link(&mr), tips(&mr), states(&mr) {}
+        /// The links of every step
+        vecmem::jagged_vector<candidate_link> links;
+        /// The parameter-to-link maps of every step
+        vecmem::jagged_vector<std::size_t> param_to_link;
+        /// The tips of the tracks
+        vecmem::vector<typename candidate_link::link_index_type> tips;
+        /// The filtered track states of the links of every step (only
+        /// filled when requested)
+        vecmem::jagged_vector<track_state_type> states;
+    };
+
+    /// Run all steps of the track finding
+    ///
+    /// @param det          Detector
+    /// @param field        Magnetic field
+    /// @param measurements Input measurements
+    /// @param seeds        Input seeds
+    /// @param record_states Whether to record the track states of the links
+    /// @return The links of all steps
+    ///
+    link_store find_links(
+        const detector_type& det, const bfield_type& field,
+        const measurement_collection_types::host& measurements,
+        const bound_track_parameters_collection_types::host& seeds,
+        bool record_states) const;
+
+    /// Count the work of the track finding, if requested
+    void count_links(const link_store& store, std::size_t n_seeds) const;
+
+    /// Build the track candidates from the links of the track finding
+    ///
+    /// @param store        The links of all steps
+    /// @param measurements Input measurements
+    /// @param seeds        Input seeds
+    /// @return The track candidates of the tips with enough measurements
+    ///
+    track_candidate_container_types::host build_candidates(
+        const link_store& store,
+        const measurement_collection_types::host& measurements,
+        const bound_track_parameters_collection_types::host& seeds) const;
+
+    /// Collect the recorded track states of one track, in forward order
+    ///
+    /// @param store        The links of all steps, with their track states
+    /// @param measurements Input measurements
+    /// @param tip          The tip of the track
+    /// @return The track states of the measurements of the track
+    ///
+    vecmem::vector<track_state_type> collect_states(
+        const link_store& store,
+        const measurement_collection_types::host& measurements,
+        const typename candidate_link::link_index_type& tip) const;
+
+    /// Results of one step, for a range of input parameters
+    struct step_output {
+        /// The links created by the step
+        std::vector<candidate_link> links;
+        /// Indices into @c links for the output parameters
+        std::vector<std::size_t> param_to_link;
+        /// The parameters for the next step
+        std::vector<bound_track_parameters> out_params;
+        /// The tips of the tracks, with indices into @c links
+        std::vector<typename candidate_link::link_index_type> tips;
+        /// The track states of the links (only if recorded)
+        std::vector<track_state_type> states;
+        /// The transport jacobians of the output parameters (only if the
+        /// track states are recorded)
+        std::vector<bound_matrix> out_jacobians;
+    };
+
+    /// A measurement to branch on
+    struct branch_candidate {
+        /// The chi-square of the measurement
+        scalar chi2;
+        /// Index of the measurement
+        unsigned int meas_idx;
+        /// The track parameters, updated with the measurement
+        bound_track_parameters params;
+    };
+
+    /// Choose the first compatible measurements of a surface to branch on
+    ///
+    /// @param sf           The surface of the measurements
+    /// @param measurements Input measurements
+    /// @param range        The measurement range of the surface
+    /// @param in_param     The track parameters on the surface
+    /// @param n_seed_branches The number of branches of the track's seed
+    /// @param candidates   The chosen measurements, in storage order
+    ///
+    void choose_first_branches(
+        const detray::surface<detector_type>& sf,
+        const measurement_collection_types::host& measurements,
+        const measurement_range& range, const bound_track_parameters& in_param,
+        unsigned int n_seed_branches,
+        std::vector<branch_candidate>& candidates) const;
+
+    /// Choose the compatible measurements of a surface with the lowest
+    /// chi-squares to branch on
+    ///
+    /// @param sf           The surface of the measurements
+    /// @param measurements Input measurements
+    /// @param range        The measurement range of the surface
+    /// @param in_param     The track parameters on the surface
+    /// @param n_seed_branches The number of branches of the track's seed
+    /// @param candidates   The chosen measurements, in increasing chi-square
+    ///                     order
+    ///
+    void choose_best_branches(
+        const detray::surface<detector_type>& sf,
+        const measurement_collection_types::host& measurements,
+        const measurement_range& range, const bound_track_parameters& in_param,
+        unsigned int n_seed_branches,
+        std::vector<branch_candidate>& candidates) const;
+
+    /// Run one step of the track finding on a range of input parameters
+    ///
+    /// @param det           Detector
+    /// @param field         Magnetic field
+    /// @param measurements  Input measurements
+    /// @param ranges        The measurement ranges of the surfaces
+    /// @param step          The current step
+    /// @param links         The links of all previous steps
+    /// @param param_to_link The parameter-to-link maps of all previous steps
+    /// @param in_params     The input parameters of the step
+    /// @param in_jacobians  The transport jacobians of the input parameters
+    ///                      (empty if the track states are not recorded)
+    /// @param begin         The first input parameter to process
+    /// @param end           The input parameter after the last one to process
+    /// @param n_trks_per_seed The number of branches of the seeds in the step
+    /// @param output        The results for the processed range
+    ///
+    void find_step(const detector_type& det, const bfield_type& field,
+                   const measurement_collection_types::host& measurements,
+                   const measurement_range_collection_types::host& ranges,
+                   unsigned int step,
+                   const vecmem::jagged_vector<candidate_link>& links,
+                   const vecmem::jagged_vector<std::size_t>& param_to_link,
+                   vecmem::vector<bound_track_parameters>& in_params,
+                   const vecmem::vector<bound_matrix>& in_jacobians,
+                   std::size_t begin, std::size_t end,
+                   vecmem::vector<unsigned int>& n_trks_per_seed,
+                   step_output& output) const;
+
+    /// Create the object propagating the tracks
+    propagation_type make_propagation(const detector_type& det) const;
+
+    /// Propagate track parameters to the next sensitive surface
+    ///
+    /// @param propagation  The object propagating the tracks
+    /// @param det          Detector
+    /// @param field        Magnetic field
+    /// @param in_param     The parameters to propagate
+    /// @param out_param    The parameters on the next sensitive surface
+    /// @param out_jacobian The transport jacobian to the next surface
+    /// @return Whether a next sensitive surface was reached
+    ///
+    bool propagate_to_next_surface(propagation_type& propagation,
+                                   const detector_type& det,
+                                   const bfield_type& field,
+                                   const bound_track_parameters& in_param,
+                                   bound_track_parameters& out_param,
+                                   bound_matrix& out_jacobian) const;
+
+    /// The resource used when none is given to the constructor
+    static vecmem::memory_resource& default_memory_resource() {
+        static vecmem::host_memory_resource mr;
+        return mr;
+    }
+
     /// Config object
     config_type m_cfg;
+    /// The memory resource of the temporaries
+    std::reference_wrapper<vecmem::memory_resource> m_mr;
 };
 
 }  // namespace traccc
@@ -6,7 +6,9 @@
  */
 
 // Project include(s).
-#include "traccc/finding/candidate_link.hpp"
+#include "traccc/utils/parallel_for.hpp"
+#include "traccc/utils/trace.hpp"
+#include "traccc/utils/work_model.hpp"
 
 // detray include(s).
 #include "detray/geometry/barcode.hpp"
@@ -21,73 +23,60 @@
 
 namespace traccc {
 
-template <typename stepper_t, typename navigator_t>
-track_candidate_container_types::host
-finding_algorithm<stepper_t, navigator_t>::operator()(
+template <typename stepper_t, typename navigator_t, typename precise_scalar_t>
+typename finding_algorithm<stepper_t, navigator_t, precise_scalar_t>::link_store
+finding_algorithm<stepper_t, navigator_t, precise_scalar_t>::find_links(
     const detector_type& det, const bfield_type& field,
     const measurement_collection_types::host& measurements,
-    const bound_track_parameters_collection_types::host& seeds) const {
-
-    track_candidate_container_types::host output_candidates;
+    const bound_track_parameters_collection_types::host& seeds,
+    const bool record_states) const {
 
     /*****************************************************************
      * Measurement Operations
      *****************************************************************/
 
-    // Get copy of barcode uniques
-    std::vector<measurement> uniques;
-    uniques.resize(measurements.size());
-
-    auto end = std::unique_copy(measurements.begin(), measurements.end(),
-                                uniques.begin(), measurement_equal_comp());
-    const unsigned int n_modules = end - uniques.begin();
-
-    // Get upper bounds of unique elements
-    std::vector<unsigned int> upper_bounds;
-    upper_bounds.reserve(n_modules);
-    for (unsigned int i = 0; i < n_modules; i++) {
-        auto up = std::upper_bound(measurements.begin(), measurements.end(),
-                                   uniques[i], measurement_sort_comp());
-        upper_bounds.push_back(std::distance(measurements.begin(), up));
-    }
-
-    // Get the number of measurements of each module
-    std::vector<unsigned int> sizes(n_modules);
-    std::adjacent_difference(upper_bounds.begin(), upper_bounds.end(),
-                             sizes.begin());
-
-    // Create barcode sequence
-    std::vector<detray::geometry::barcode> barcodes;
-    barcodes.reserve(n_modules);
-    for (unsigned int i = 0; i < n_modules; i++) {
-        barcodes.push_back(uniques[i].surface_link);
-    }
+    // Get the measurement range of every surface
+    const measurement_range_collection_types::host ranges =
+        make_measurement_ranges(measurements, m_mr.get());
 
     /**********************
      * Find tracks
      **********************/
 
-    std::vector<std::vector<candidate_link>> links;
+    link_store store{m_mr.get()};
+    vecmem::jagged_vector<candidate_link>& links = store.links;
     links.resize(m_cfg.max_track_candidates_per_track);
 
-    std::vector<std::vector<std::size_t>> param_to_link;
+    vecmem::jagged_vector<std::size_t>& param_to_link = store.param_to_link;
     param_to_link.resize(m_cfg.max_track_candidates_per_track);
 
-    std::vector<typename candidate_link::link_index_type> tips;
-
-    // Create propagator
-    propagator_type propagator(m_cfg.propagation);
+    vecmem::vector<typename candidate_link::link_index_type>& tips =
+        store.tips;
 
-    // Copy seed to input parameters
-    std::vector<bound_track_parameters> in_params;
-    std::vector<unsigned int> n_trks_per_seed(seeds.size(), 0);
+    if (record_states) {
+        store.states.resize(m_cfg.max_track_candidates_per_track);
+    }
 
-    in_params.reserve(seeds.size());
-    for (const auto& seed : seeds) {
-        in_params.push_back(seed);
+    // Copy seed to input parameters, up to the seed budget
+    const std::size_t n_seeds =
+        ((m_cfg.max_num_seeds > 0) && (seeds.size() > m_cfg.max_num_seeds))
+            ? m_cfg.max_num_seeds
+            : seeds.size();
+    vecmem::vector<bound_track_parameters> in_params(
+        seeds.begin(), seeds.begin() + n_seeds, &(m_mr.get()));
+    vecmem::vector<unsigned int> n_trks_per_seed(n_seeds, 0u, &(m_mr.get()));
+
+    // The seeds are on the surfaces of their first measurements already
+    vecmem::vector<bound_matrix> in_jacobians(&(m_mr.get()));
+    if (record_states) {
+        in_jacobians.assign(
+            n_seeds,
+            track_state_type::matrix_operator().template identity<
+                e_bound_size, e_bound_size>());
     }
 
-    std::vector<bound_track_parameters> out_params;
+    vecmem::vector<bound_track_parameters> out_params(&(m_mr.get()));
+    vecmem::vector<bound_matrix> out_jacobians(&(m_mr.get()));
 
     for (unsigned int step = 0; step < m_cfg.max_track_candidates_per_track;
          step++) {
@@ -103,259 +92,110 @@ finding_algorithm<stepper_t, navigator_t>::operator()(
         // Rough estimation on out parameters size
         out_params.reserve(n_in_params);
 
-        // Previous step ID
-        const unsigned int previous_step =
-            (step == 0) ? std::numeric_limits<unsigned int>::max() : step - 1;
-
         std::fill(n_trks_per_seed.begin(), n_trks_per_seed.end(), 0);
 
-        for (unsigned int in_param_id = 0; in_param_id < n_in_params;
-             in_param_id++) {
-
-            bound_track_parameters& in_param = in_params[in_param_id];
-            unsigned int orig_param_id =
-                (step == 0
-                     ? in_param_id
-                     : links[step - 1][param_to_link[step - 1][in_param_id]]
-                           .seed_idx);
-            unsigned int skip_counter =
-                (step == 0
-                     ? 0
-                     : links[step - 1][param_to_link[step - 1][in_param_id]]
-                           .n_skipped);
-
-            /*************************
-             * Material interaction
-             *************************/
-
-            // Get intersection at surface
-            const detray::surface<detector_type> sf{det,
-                                                    in_param.surface_link()};
-
-            const cxt_t ctx{};
-            const auto free_vec =
-                sf.bound_to_free_vector(ctx, in_param.vector());
-            intersection_type sfi;
-
-            const auto sf_desc = det.surface(in_param.surface_link());
-            sfi.sf_desc = sf_desc;
-            sf.template visit_mask<
-                detray::intersection_update<detray::ray_intersector>>(
-                detray::detail::ray<transform3_type>(free_vec), sfi,
-                det.transform_store());
-
-            // Apply interactor
-            typename interactor_type::state interactor_state;
-            interactor_type{}.update(
-                in_param, interactor_state,
-                static_cast<int>(detray::navigation::direction::e_forward), sf,
-                sfi.cos_incidence_angle);
-
-            /*************************
-             * CKF
-             *************************/
-
-            // Get barcode and measurements range on surface
-            const auto bcd = in_param.surface_link();
-            std::pair<unsigned int, unsigned int> range;
-
-            // Find the corresponding index of bcd in barcode vector
-            unsigned int bcd_id;
-            if (std::binary_search(barcodes.begin(), barcodes.end(), bcd)) {
-                const auto lo2 =
-                    std::lower_bound(barcodes.begin(), barcodes.end(), bcd);
-                bcd_id = std::distance(barcodes.begin(), lo2);
-
-                if (lo2 == barcodes.begin()) {
-                    range.first = 0u;
-                    range.second = upper_bounds[bcd_id];
+        // Split the input parameters into ranges processed by separate
+        // tasks. Without splitting the parameters of any seed, as those are
+        // limited together by max_num_branches_per_initial_seed. (The
+        // parameters of the same seed are always next to each other.)
+        auto seed_of = [&](std::size_t param_id) {
+            return (step == 0
+                        ? static_cast<unsigned int>(param_id)
+                        : links[step - 1][param_to_link[step - 1][param_id]]
+                              .seed_idx);
+        };
+        std::vector<std::size_t> range_bounds{0u};
+        if (m_cfg.host_params_per_task > 0) {
+            std::size_t bound = m_cfg.host_params_per_task;
+            while (bound < n_in_params) {
+                if (seed_of(bound) != seed_of(bound - 1)) {
+                    range_bounds.push_back(bound);
+                    bound += m_cfg.host_params_per_task;
                 } else {
-                    range.first = upper_bounds[bcd_id - 1];
-                    range.second = upper_bounds[bcd_id];
+                    ++bound;
                 }
-            } else {
-                range.first = 0u;
-                range.second = 0u;
             }
+        }
+        range_bounds.push_back(n_in_params);
+        const std::size_t n_ranges = range_bounds.size() - 1;
+
+        // Process the ranges, in parallel if there is more than one of them.
+        std::vector<step_output> outputs(n_ranges);
+        auto process_range = [&](std::size_t range) {
+            find_step(det, field, measurements, ranges, step, links,
+                      param_to_link, in_params, in_jacobians,
+                      range_bounds[range],
+                      range_bounds[range + 1], n_trks_per_seed,
+                      outputs[range]);
+        };
+        if (n_ranges == 1) {
+            process_range(0);
+        } else {
+            details::parallel_for(n_ranges, process_range);
+        }
 
-            unsigned int n_branches = 0;
-
-            // Iterate over the measurements
-            for (unsigned int item_id = range.first; item_id < range.second;
-                 item_id++) {
-                if (n_branches > m_cfg.max_num_branches_per_surface) {
-                    break;
-                }
-                if (n_trks_per_seed[orig_param_id] >=
-                    m_cfg.max_num_branches_per_initial_seed) {
-                    break;
-                }
-
-                bound_track_parameters bound_param(in_param.surface_link(),
-                                                   in_param.vector(),
-                                                   in_param.covariance());
-                const auto& meas = measurements[item_id];
-
-                track_state<transform3_type> trk_state(meas);
-
-                // Run the Kalman update
-                sf.template visit_mask<gain_matrix_updater<transform3_type>>(
-                    trk_state, bound_param);
-
-                // Get the chi-square
-                const auto chi2 = trk_state.filtered_chi2();
-
-                // Found a good measurement
-                if (chi2 < m_cfg.chi2_max) {
-
-                    // Current link ID
-                    unsigned int cur_link_id =
-                        static_cast<unsigned int>(links[step].size());
-
-                    n_branches++;
-                    n_trks_per_seed[orig_param_id]++;
-
-                    links[step].push_back({{previous_step, in_param_id},
-                                           item_id,
-                                           orig_param_id,
-                                           skip_counter});
-
-                    /*********************************
-                     * Propagate to the next surface
-                     *********************************/
-
-                    // Create propagator state
-                    typename propagator_type::state propagation(
-                        trk_state.filtered(), field, det);
-                    propagation._stepping.template set_constraint<
-                        detray::step::constraint::e_accuracy>(
-                        m_cfg.propagation.stepping.step_constraint);
-
-                    typename detray::pathlimit_aborter::state s0;
-                    typename detray::parameter_transporter<
-                        transform3_type>::state s1;
-                    typename interactor::state s3;
-                    typename interaction_register<interactor>::state s2{s3};
-                    typename detray::next_surface_aborter::state s4{
-                        m_cfg.min_step_length_for_surface_aborter};
-                    // typename propagation::print_inspector::state s5{};
-
-                    // @TODO: Should be removed once detray is fixed to set the
-                    // volume in the constructor
-                    propagation._navigation.set_volume(
-                        trk_state.filtered().surface_link().volume());
-
-                    // Propagate to the next surface
-                    propagator.propagate_sync(propagation,
-                                              std::tie(s0, s1, s2, s3, s4));
-
-                    /*
-                    propagator.propagate_sync(propagation,
-                                              std::tie(s0, s1, s2, s3, s4, s5));
-                    */
-
-                    // If a surface found, add the parameter for the next
-                    // step
-                    if (s4.success) {
-                        out_params.push_back(
-                            propagation._stepping._bound_params);
-                        param_to_link[step].push_back(cur_link_id);
-                    }
-                    // Unless the track found a surface, it is considered a
-                    // tip
-                    else if (!s4.success &&
-                             step >= m_cfg.min_track_candidates_per_track - 1) {
-                        tips.push_back({step, cur_link_id});
-                    }
-
-                    // If no more CKF step is expected, current candidate is
-                    // kept as a tip
-                    if (s4.success &&
-                        step == m_cfg.max_track_candidates_per_track - 1) {
-                        tips.push_back({step, cur_link_id});
-                    }
-                }
+        // Merge the results of the ranges, in the same order as the serial
+        // processing would produce them.
+        for (step_output& output : outputs) {
+            const unsigned int link_offset =
+                static_cast<unsigned int>(links[step].size());
+            links[step].insert(links[step].end(), output.links.begin(),
+                               output.links.end());
+            for (const std::size_t link_id : output.param_to_link) {
+                param_to_link[step].push_back(link_id + link_offset);
             }
-            // After the loop over the measurements
-
-            if (n_branches == 0) {
-                // let's skip this CKF step for the current track candidate
-                if (n_trks_per_seed[orig_param_id] >=
-                    m_cfg.max_num_branches_per_initial_seed) {
-
-                    continue;
-                }
-
-                bound_track_parameters bound_param(in_param.surface_link(),
-                                                   in_param.vector(),
-                                                   in_param.covariance());
-
-                measurement dummy_meas;
-
-                dummy_meas.local = in_param.bound_local();
-                dummy_meas.variance = dummy_meas.variance + point2{10., 10.};
-                dummy_meas.surface_link = in_param.surface_link();
+            out_params.insert(out_params.end(), output.out_params.begin(),
+                              output.out_params.end());
+            for (const auto& tip : output.tips) {
+                tips.push_back({tip.first, tip.second + link_offset});
+            }
+            if (record_states) {
+                store.states[step].insert(store.states[step].end(),
+                                          output.states.begin(),
+                                          output.states.end());
+                out_jacobians.insert(out_jacobians.end(),
+                                     output.out_jacobians.begin(),
+                                     output.out_jacobians.end());
+            }
+        }
 
-                track_state<transform3_type> trk_state(dummy_meas);
+        in_params = std::move(out_params);
+        out_params.clear();
+        in_jacobians = std::move(out_jacobians);
+        out_jacobians.clear();
+    }
 
-                // Run the Kalman update
-                sf.template visit_mask<gain_matrix_updater<transform3_type>>(
-                    trk_state, bound_param);
+    return store;
+}
 
-                unsigned int cur_link_id =
-                    static_cast<unsigned int>(links[step].size());
+template <typename stepper_t, typename navigator_t, typename precise_scalar_t>
+void finding_algorithm<stepper_t, navigator_t, precise_scalar_t>::count_links(
+    const link_store& store, std::size_t n_seeds) const {
 
-                links[step].push_back({{previous_step, in_param_id},
-                                       std::numeric_limits<unsigned int>::max(),
-                                       orig_param_id,
-                                       skip_counter + 1});
+    // Every link is a propagation to, and an update on, a surface.
+    if (counting_work()) {
+        std::size_t n_links = 0;
+        for (const vecmem::vector<candidate_link>& step_links : store.links) {
+            n_links += step_links.size();
+        }
+        count_work(work_model::track_finding(n_seeds, n_links));
+    }
+}
 
-                if (skip_counter + 1 > m_cfg.max_num_skipping_per_cand) {
-                    tips.push_back({step, cur_link_id});
-                    continue;
-                    // exit from param_id loop
-                }
+template <typename stepper_t, typename navigator_t, typename precise_scalar_t>
+track_candidate_container_types::host
+finding_algorithm<stepper_t, navigator_t, precise_scalar_t>::build_candidates(
+    const link_store& store,
+    const measurement_collection_types::host& measurements,
+    const bound_track_parameters_collection_types::host& seeds) const {
 
-                // Create propagator state
-                typename propagator_type::state propagation(
-                    trk_state.filtered(), field, det);
-                propagation._stepping.template set_constraint<
-                    detray::step::constraint::e_accuracy>(
-                    m_cfg.propagation.stepping.step_constraint);
-
-                typename detray::pathlimit_aborter::state s0;
-                typename detray::parameter_transporter<transform3_type>::state
-                    s1;
-                typename interactor::state s3;
-                typename interaction_register<interactor>::state s2{s3};
-                typename detray::next_surface_aborter::state s4{
-                    m_cfg.min_step_length_for_surface_aborter};
-
-                propagation._navigation.set_volume(
-                    trk_state.filtered().surface_link().volume());
-
-                // Propagate to the next surface
-                propagator.propagate_sync(propagation,
-                                          std::tie(s0, s1, s2, s3, s4));
-
-                // If a surface found, add the parameter for the next
-                // step
-                if (s4.success) {
-                    out_params.push_back(propagation._stepping._bound_params);
-                    param_to_link[step].push_back(cur_link_id);
-                }
-                // Unless the track found a surface, it is considered a
-                // tip
-                else if (!s4.success &&
-                         step >= m_cfg.min_track_candidates_per_track - 1) {
-                    tips.push_back({step, cur_link_id});
-                }
-            }
-        }
+    track_candidate_container_types::host output_candidates;
 
-        in_params = std::move(out_params);
-        out_params.clear();
-    }
+    const vecmem::jagged_vector<candidate_link>& links = store.links;
+    const vecmem::jagged_vector<std::size_t>& param_to_link =
+        store.param_to_link;
+    const vecmem::vector<typename candidate_link::link_index_type>& tips =
+        store.tips;
 
     /**********************
      * Build tracks
@@ -423,4 +263,523 @@ finding_algorithm<stepper_t, navigator_t>::operator()(
     return output_candidates;
 }
 
+template <typename stepper_t, typename navigator_t, typename precise_scalar_t>
+vecmem::vector<typename finding_algorithm<stepper_t, navigator_t,
+                                          precise_scalar_t>::track_state_type>
+finding_algorithm<stepper_t, navigator_t, precise_scalar_t>::collect_states(
+    const link_store& store,
+    const measurement_collection_types::host& measurements,
+    const typename candidate_link::link_index_type& tip) const {
+
+    const candidate_link& tip_link = store.links[tip.first][tip.second];
+
+    // Collect the track states of the track, from its tip backwards
+    vecmem::vector<track_state_type> track_states;
+    track_states.reserve(tip.first + 1 - tip_link.n_skipped);
+    unsigned int step = tip.first;
+    std::size_t link_pos = tip.second;
+    while (true) {
+
+        const candidate_link& L = store.links[step][link_pos];
+        const track_state_type& state = store.states[step][link_pos];
+
+        if (L.meas_idx < measurements.size()) {
+            track_states.push_back(state);
+        }
+        // Transport the following state all the way from before the hole
+        else if (!track_states.empty()) {
+            track_states.back().jacobian() =
+                track_states.back().jacobian() * state.jacobian();
+        }
+
+        if (step == 0) {
+            break;
+        }
+        link_pos = store.param_to_link[L.previous.first][L.previous.second];
+        step = L.previous.first;
+    }
+    std::reverse(track_states.begin(), track_states.end());
+
+    return track_states;
+}
+
+template <typename stepper_t, typename navigator_t, typename precise_scalar_t>
+track_candidate_container_types::host
+finding_algorithm<stepper_t, navigator_t, precise_scalar_t>::operator()(
+    const detector_type& det, const bfield_type& field,
+    const measurement_collection_types::host& measurements,
+    const bound_track_parameters_collection_types::host& seeds) const {
+
+    TRACCC_TRACE_RANGE("traccc::finding_algorithm");
+
+    const link_store store =
+        find_links(det, field, measurements, seeds, false);
+    count_links(store, seeds.size());
+
+    return build_candidates(store, measurements, seeds);
+}
+
+template <typename stepper_t, typename navigator_t, typename precise_scalar_t>
+track_state_container_types::host
+finding_algorithm<stepper_t, navigator_t, precise_scalar_t>::find_and_smooth(
+    const detector_type& det, const bfield_type& field,
+    const measurement_collection_types::host& measurements,
+    const bound_track_parameters_collection_types::host& seeds) const {
+
+    track_state_container_types::host output_states;
+
+    const link_store store = find_links(det, field, measurements, seeds, true);
+
+    // The fitter, used for its smoothing only
+    using fitter_type = kalman_fitter<stepper_t, navigator_t, precise_scalar_t>;
+    fitter_type fitter(det, field, typename fitter_type::config_type{});
+
+    output_states.reserve(store.tips.size());
+
+    for (const auto& tip : store.tips) {
+
+        // Skip if the number of tracks candidates is too small
+        const candidate_link& tip_link = store.links[tip.first][tip.second];
+        if (tip.first + 1 - tip_link.n_skipped <
+            m_cfg.min_track_candidates_per_track) {
+            continue;
+        }
+
+        // Run the smoothing
+        typename fitter_type::state fitter_state(
+            collect_states(store, measurements, tip));
+        fitter.smooth(fitter_state);
+        fitter.update_statistics(fitter_state);
+
+        output_states.push_back(
+            std::move(fitter_state.m_fit_res),
+            std::move(fitter_state.m_fit_actor_state.m_track_states));
+    }
+
+    return output_states;
+}
+
+template <typename stepper_t, typename navigator_t, typename precise_scalar_t>
+typename finding_algorithm<stepper_t, navigator_t,
+                           precise_scalar_t>::output_with_transport_type
+finding_algorithm<stepper_t, navigator_t, precise_scalar_t>::
+    find_with_transport(
+        const detector_type& det, const bfield_type& field,
+        const measurement_collection_types::host& measurements,
+        const bound_track_parameters_collection_types::host& seeds) const {
+
+    TRACCC_TRACE_RANGE("traccc::finding_algorithm");
+
+    const link_store store = find_links(det, field, measurements, seeds, true);
+    count_links(store, seeds.size());
+
+    output_with_transport_type output;
+    output.first = build_candidates(store, measurements, seeds);
+
+    // Collect the track states in the same order as the candidates
+    track_state_container_types::host& output_states = output.second;
+    output_states.reserve(output.first.size());
+    for (const auto& tip : store.tips) {
+
+        // Skip the same tips as the candidates
+        const candidate_link& tip_link = store.links[tip.first][tip.second];
+        if ((tip.first + 1 < m_cfg.min_track_candidates_per_track) ||
+            (tip.first + 1 - tip_link.n_skipped <
+             m_cfg.min_track_candidates_per_track)) {
+            continue;
+        }
+
+        fitting_result<transform3_type> header;
+        header.fit_params = seeds.at(tip_link.seed_idx);
+        output_states.push_back(std::move(header),
+                                collect_states(store, measurements, tip));
+    }
+
+    return output;
+}
+
+template <typename stepper_t, typename navigator_t, typename precise_scalar_t>
+void finding_algorithm<stepper_t, navigator_t,
+                       precise_scalar_t>::choose_first_branches(
+    const detray::surface<detector_type>& sf,
+    const measurement_collection_types::host& measurements,
+    const measurement_range& range, const bound_track_parameters& in_param,
+    unsigned int n_seed_branches,
+    std::vector<branch_candidate>& candidates) const {
+
+    for (unsigned int item_id = range.begin; item_id < range.end; item_id++) {
+        if (candidates.size() > m_cfg.max_num_branches_per_surface) {
+            break;
+        }
+        if (n_seed_branches >= m_cfg.max_num_branches_per_initial_seed) {
+            break;
+        }
+
+        bound_track_parameters bound_param(in_param.surface_link(),
+                                           in_param.vector(),
+                                           in_param.covariance());
+        track_state<transform3_type> trk_state(measurements[item_id]);
+
+        // Run the Kalman update
+        sf.template visit_mask<
+            gain_matrix_updater<transform3_type, precise_scalar_t>>(
+            trk_state, bound_param);
+
+        // Get the chi-square
+        const auto chi2 = trk_state.filtered_chi2();
+
+        // Found a good measurement
+        if (chi2 < m_cfg.chi2_max) {
+            candidates.push_back({chi2, item_id, trk_state.filtered()});
+            n_seed_branches++;
+        }
+    }
+}
+
+template <typename stepper_t, typename navigator_t, typename precise_scalar_t>
+void finding_algorithm<stepper_t, navigator_t,
+                       precise_scalar_t>::choose_best_branches(
+    const detray::surface<detector_type>& sf,
+    const measurement_collection_types::host& measurements,
+    const measurement_range& range, const bound_track_parameters& in_param,
+    unsigned int n_seed_branches,
+    std::vector<branch_candidate>& candidates) const {
+
+    // The number of branches to keep
+    const unsigned int n_remaining =
+        (n_seed_branches < m_cfg.max_num_branches_per_initial_seed)
+            ? m_cfg.max_num_branches_per_initial_seed - n_seed_branches
+            : 0u;
+    const std::size_t k = std::min(m_cfg.max_num_branches_per_surface,
+                                   n_remaining);
+    if (k == 0u) {
+        return;
+    }
+
+    for (unsigned int item_id = range.begin; item_id < range.end; item_id++) {
+
+        const measurement& meas = measurements[item_id];
+
+        // Skip the measurement without a Kalman update, if it can not be
+        // better than the ones already kept
+        const scalar threshold =
+            (candidates.size() == k) ? candidates.back().chi2 : m_cfg.chi2_max;
+        if (chi2_lower_bound(meas, in_param) >= threshold) {
+            continue;
+        }
+
+        bound_track_parameters bound_param(in_param.surface_link(),
+                                           in_param.vector(),
+                                           in_param.covariance());
+        track_state<transform3_type> trk_state(meas);
+
+        // Run the Kalman update
+        sf.template visit_mask<
+            gain_matrix_updater<transform3_type, precise_scalar_t>>(
+            trk_state, bound_param);
+
+        // Get the chi-square
+        const scalar chi2 = trk_state.filtered_chi2();
+        if (chi2 >= threshold) {
+            continue;
+        }
+
+        // Insert the measurement after the ones with the same or a lower
+        // chi-square, dropping the worst one if there are too many.
+        auto it = std::upper_bound(
+            candidates.begin(), candidates.end(), chi2,
+            [](scalar value, const branch_candidate& candidate) {
+                return value < candidate.chi2;
+            });
+        candidates.insert(it, {chi2, item_id, trk_state.filtered()});
+        if (candidates.size() > k) {
+            candidates.pop_back();
+        }
+    }
+}
+
+template <typename stepper_t, typename navigator_t, typename precise_scalar_t>
+void finding_algorithm<stepper_t, navigator_t, precise_scalar_t>::find_step(
+    const detector_type& det, const bfield_type& field,
+    const measurement_collection_types::host& measurements,
+    const measurement_range_collection_types::host& ranges,
+    const unsigned int step,
+    const vecmem::jagged_vector<candidate_link>& links,
+    const vecmem::jagged_vector<std::size_t>& param_to_link,
+    vecmem::vector<bound_track_parameters>& in_params,
+    const vecmem::vector<bound_matrix>& in_jacobians, const std::size_t begin,
+    const std::size_t end, vecmem::vector<unsigned int>& n_trks_per_seed,
+    step_output& output) const {
+
+    const bool record_states = !in_jacobians.empty();
+
+    // Create the object propagating the tracks
+    propagation_type propagation = make_propagation(det);
+
+    // Previous step ID
+    const unsigned int previous_step =
+        (step == 0) ? std::numeric_limits<unsigned int>::max() : step - 1;
+
+    for (unsigned int in_param_id = static_cast<unsigned int>(begin);
+         in_param_id < end; in_param_id++) {
+
+        bound_track_parameters& in_param = in_params[in_param_id];
+        unsigned int orig_param_id =
+            (step == 0
+                 ? in_param_id
+                 : links[step - 1][param_to_link[step - 1][in_param_id]]
+                       .seed_idx);
+        unsigned int skip_counter =
+            (step == 0
+                 ? 0
+                 : links[step - 1][param_to_link[step - 1][in_param_id]]
+                       .n_skipped);
+
+        /*************************
+         * Material interaction
+         *************************/
+
+        // Get intersection at surface, if it has any material
+        const detray::surface<detector_type> sf{det, in_param.surface_link()};
+
+        if (sf.has_material()) {
+            const cxt_t ctx{};
+            const auto free_vec =
+                sf.bound_to_free_vector(ctx, in_param.vector());
+            intersection_type sfi;
+
+            sfi.sf_desc = det.surface(in_param.surface_link());
+            sf.template visit_mask<
+                detray::intersection_update<detray::ray_intersector>>(
+                detray::detail::ray<transform3_type>(free_vec), sfi,
+                det.transform_store());
+
+            // Apply interactor
+            typename interactor_type::state interactor_state;
+            interactor_type{}.update(
+                in_param, interactor_state,
+                static_cast<int>(detray::navigation::direction::e_forward),
+                sf, sfi.cos_incidence_angle);
+        }
+
+        /*************************
+         * CKF
+         *************************/
+
+        // Get the measurement range on the surface
+        const measurement_range range = find_measurement_range(
+            ranges, in_param.surface_link().index());
+
+        // Choose the measurements to branch on
+        std::vector<branch_candidate> candidates;
+        if (m_cfg.branching == branching_policy::e_best_chi2) {
+            choose_best_branches(sf, measurements, range, in_param,
+                                 n_trks_per_seed[orig_param_id], candidates);
+        } else {
+            choose_first_branches(sf, measurements, range, in_param,
+                                  n_trks_per_seed[orig_param_id], candidates);
+        }
+
+        unsigned int n_branches = 0;
+
+        // Iterate over the chosen measurements
+        for (const branch_candidate& candidate : candidates) {
+            const unsigned int item_id = candidate.meas_idx;
+
+            // Current link ID
+            unsigned int cur_link_id =
+                static_cast<unsigned int>(output.links.size());
+
+            n_branches++;
+            n_trks_per_seed[orig_param_id]++;
+
+            output.links.push_back({{previous_step, in_param_id},
+                                    item_id,
+                                    orig_param_id,
+                                    skip_counter});
+
+            if (record_states) {
+                track_state_type trk_state(measurements[item_id]);
+                trk_state.is_hole = false;
+                trk_state.jacobian() = in_jacobians[in_param_id];
+                trk_state.predicted().set_vector(in_param.vector());
+                trk_state.predicted().set_covariance(in_param.covariance());
+                trk_state.filtered().set_vector(candidate.params.vector());
+                trk_state.filtered().set_covariance(
+                    candidate.params.covariance());
+                trk_state.filtered_chi2() = candidate.chi2;
+                output.states.push_back(trk_state);
+            }
+
+            /*********************************
+             * Propagate to the next surface
+             *********************************/
+
+            // Propagate to the next surface
+            bound_track_parameters out_param;
+            bound_matrix out_jacobian;
+            const bool success = propagate_to_next_surface(
+                propagation, det, field, candidate.params, out_param,
+                out_jacobian);
+
+            // If a surface found, add the parameter for the next step
+            if (success) {
+                output.out_params.push_back(out_param);
+                output.param_to_link.push_back(cur_link_id);
+                if (record_states) {
+                    output.out_jacobians.push_back(out_jacobian);
+                }
+            }
+            // Unless the track found a surface, it is considered a tip
+            else if (!success &&
+                     step >= m_cfg.min_track_candidates_per_track - 1) {
+                output.tips.push_back({step, cur_link_id});
+            }
+
+            // If no more CKF step is expected, current candidate is
+            // kept as a tip
+            if (success && step == m_cfg.max_track_candidates_per_track - 1) {
+                output.tips.push_back({step, cur_link_id});
+            }
+        }
+        // After the loop over the measurements
+
+        if (n_branches == 0) {
+            // let's skip this CKF step for the current track candidate
+            if (n_trks_per_seed[orig_param_id] >=
+                m_cfg.max_num_branches_per_initial_seed) {
+
+                continue;
+            }
+
+            bound_track_parameters bound_param(in_param.surface_link(),
+                                               in_param.vector(),
+                                               in_param.covariance());
+
+            measurement dummy_meas;
+
+            dummy_meas.local = in_param.bound_local();
+            dummy_meas.variance = dummy_meas.variance + point2{10., 10.};
+            dummy_meas.surface_link = in_param.surface_link();
+
+            track_state<transform3_type> trk_state(dummy_meas);
+
+            // Run the Kalman update
+            sf.template visit_mask<
+                gain_matrix_updater<transform3_type, precise_scalar_t>>(
+                trk_state, bound_param);
+
+            unsigned int cur_link_id =
+                static_cast<unsigned int>(output.links.size());
+
+            output.links.push_back({{previous_step, in_param_id},
+                                    std::numeric_limits<unsigned int>::max(),
+                                    orig_param_id,
+                                    skip_counter + 1});
+
+            if (record_states) {
+                trk_state.jacobian() = in_jacobians[in_param_id];
+                output.states.push_back(trk_state);
+            }
+
+            if (skip_counter + 1 > m_cfg.max_num_skipping_per_cand) {
+                output.tips.push_back({step, cur_link_id});
+                continue;
+                // exit from param_id loop
+            }
+
+            // Propagate to the next surface
+            bound_track_parameters out_param;
+            bound_matrix out_jacobian;
+            const bool success = propagate_to_next_surface(
+                propagation, det, field, trk_state.filtered(), out_param,
+                out_jacobian);
+
+            // If a surface found, add the parameter for the next step
+            if (success) {
+                output.out_params.push_back(out_param);
+                output.param_to_link.push_back(cur_link_id);
+                if (record_states) {
+                    output.out_jacobians.push_back(out_jacobian);
+                }
+            }
+            // Unless the track found a surface, it is considered a tip
+            else if (!success &&
+                     step >= m_cfg.min_track_candidates_per_track - 1) {
+                output.tips.push_back({step, cur_link_id});
+            }
+        }
+    }
+}
+
+template <typename stepper_t, typename navigator_t, typename precise_scalar_t>
+typename finding_algorithm<stepper_t, navigator_t,
+                           precise_scalar_t>::propagation_type
+finding_algorithm<stepper_t, navigator_t, precise_scalar_t>::make_propagation(
+    const detector_type& det) const {
+
+    if constexpr (is_planar_navigator_v<navigator_t>) {
+        return navigator_t(det);
+    } else {
+        return propagator_type(m_cfg.propagation);
+    }
+}
+
+template <typename stepper_t, typename navigator_t, typename precise_scalar_t>
+bool finding_algorithm<stepper_t, navigator_t, precise_scalar_t>::
+    propagate_to_next_surface(propagation_type& propagation,
+                              const detector_type& det,
+                              const bfield_type& field,
+                              const bound_track_parameters& in_param,
+                              bound_track_parameters& out_param,
+                              bound_matrix& out_jacobian) const {
+
+    if constexpr (is_planar_navigator_v<navigator_t>) {
+
+        // Walk the planes up to the next sensitive one, applying the material
+        // of the passive planes on the way
+        (void)det;
+        out_param = in_param;
+        out_jacobian = track_state_type::matrix_operator()
+                           .template identity<e_bound_size, e_bound_size>();
+        bound_matrix step_jacobian;
+        while (propagation.step(out_param, field, step_jacobian)) {
+            out_jacobian = step_jacobian * out_jacobian;
+            if (propagation.is_sensitive(out_param.surface_link())) {
+                return true;
+            }
+            propagation.interact(out_param);
+        }
+        return false;
+
+    } else {
+
+        // Create propagator state
+        typename propagator_type::state state(in_param, field, det);
+        state._stepping
+            .template set_constraint<detray::step::constraint::e_accuracy>(
+                m_cfg.propagation.stepping.step_constraint);
+
+        typename detray::pathlimit_aborter::state s0;
+        typename detray::parameter_transporter<transform3_type>::state s1;
+        typename interactor::state s3;
+        typename interaction_register<interactor>::state s2{s3};
+        typename detray::next_surface_aborter::state s4{
+            m_cfg.min_step_length_for_surface_aborter};
+
+        // @TODO: Should be removed once detray is fixed to set the
+        // volume in the constructor
+        state._navigation.set_volume(in_param.surface_link().volume());
+
+        // Propagate to the next surface
+        propagation.propagate_sync(state, std::tie(s0, s1, s2, s3, s4));
+
+        if (s4.success) {
+            out_param = state._stepping._bound_params;
+            out_jacobian = state._stepping._full_jacobian;
+        }
+        return s4.success;
+    }
+}
+
 }  // namespace traccc
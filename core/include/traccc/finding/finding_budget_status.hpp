@@ -0,0 +1,35 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+namespace traccc {
+
+/// The budgets of the track finding that one event exceeded
+///
+/// Events exceeding a budget of @c traccc::finding_config are not rejected,
+/// but are processed in a degraded mode. These flags allow flagging such
+/// events downstream.
+///
+struct finding_budget_status {
+
+    /// The seeds beyond @c max_num_seeds were not processed
+    bool seeds_truncated = false;
+    /// More than @c max_num_branches_in_flight branches were in flight, and
+    /// the following steps did not branch any more
+    bool branches_limited = false;
+    /// The wall-clock budget was exceeded, and the step loop was ended early
+    bool deadline_exceeded = false;
+
+    /// Check whether the event was processed in a degraded mode
+    bool degraded() const {
+        return seeds_truncated || branches_limited || deadline_exceeded;
+    }
+
+};  // struct finding_budget_status
+
+}  // namespace traccc
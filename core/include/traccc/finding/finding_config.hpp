@@ -11,17 +11,43 @@
 #include "detray/definitions/units.hpp"
 #include "detray/propagator/propagation_config.hpp"
 
+// System include(s).
+#include <cstddef>
+#include <limits>
+
 namespace traccc {
 
+/// Policies for choosing the branches of a track on a surface
+enum class branching_policy {
+    /// Branch on the first compatible measurements, in storage order
+    e_first_compatible = 0,
+    /// Branch on the compatible measurements with the lowest chi-squares
+    e_best_chi2 = 1
+};
+
 /// Configuration struct for track finding
-template <typename scalar_t>
+///
+/// @tparam scalar_t The scalar type of the track parameters
+/// @tparam precise_scalar_t The scalar type of the Kalman gain inversions
+///         and of the chi-squares of the track finding
+///
+template <typename scalar_t, typename precise_scalar_t = scalar_t>
 struct finding_config {
+    /// The scalar type of the Kalman gain inversions and chi-squares
+    using precise_scalar_type = precise_scalar_t;
+
     /// @NOTE: This paramter might be removed
     unsigned int max_num_branches_per_seed = 100;
 
     /// Maximum number of branches per surface
     unsigned int max_num_branches_per_surface = 10;
 
+    /// Policy for choosing the branches of a track on a surface. With
+    /// @c branching_policy::e_best_chi2, (at most)
+    /// @c max_num_branches_per_surface branches are made, on the
+    /// measurements with the lowest chi-squares.
+    branching_policy branching = branching_policy::e_first_compatible;
+
     /// Min/Max number of track candidates per track
     unsigned int min_track_candidates_per_track = 3;
     unsigned int max_track_candidates_per_track = 100;
@@ -47,6 +73,79 @@ struct finding_config {
     /// GPU-specific parameter for the number of measurements to be
     /// iterated per thread
     unsigned int n_measurements_per_thread = 8;
+
+    /// GPU-specific minimum mean number of measurements per parameter in a
+    /// step, for which every parameter is processed by a whole warp. The
+    /// lanes of the warp then share the parameter, and split its
+    /// measurements between them. With 0, the measurements are always
+    /// split up by @c n_measurements_per_thread instead.
+    unsigned int min_measurements_for_warp_finding = 16;
+
+    /// GPU-specific flag for running the step loop without reading the
+    /// candidate counts back to the host after every step. All step buffers
+    /// are allocated with their worst-case sizes up front in this mode, and
+    /// the host only synchronises once, after the last step.
+    bool run_step_loop_on_device = false;
+
+    /// GPU-specific minimum number of parameters going into a step, for
+    /// which they get sorted by their surface beforehand. Sorting lets the
+    /// threads of a warp work on the same surface and measurements, which
+    /// pays off for large numbers of parameters. With the default of 0, the
+    /// parameters are never sorted.
+    unsigned int min_params_for_surface_sort = 0;
+
+    /// GPU-specific budget, in bytes, for the per-step buffers of the track
+    /// finding of one event. If the worst-case estimate for all seeds of an
+    /// event, from the branching limits, exceeds it, the seeds are processed
+    /// in chunks that fit into the budget, and the track candidates of the
+    /// chunks are concatenated. With the default of 0, all seeds are always
+    /// processed at once.
+    std::size_t device_memory_budget = 0;
+
+    /// GPU-specific flag for pruning the branches of every step that reached
+    /// the same measurement as another branch of the same seed group, with a
+    /// lower chi-square, and with similar parameters. Pruning the duplicates
+    /// early saves both track finding and track fitting work. Only applied
+    /// when the step loop is driven from the host.
+    bool prune_shared_hits = false;
+
+    /// Number of consecutive seeds forming one group for the shared hit
+    /// pruning. With the default of 0, all seeds form a single group.
+    unsigned int pruning_seed_group_size = 0;
+
+    /// Maximum difference between the angles of pruned branches
+    scalar_t pruning_max_delta_angle = 0.01f;
+
+    /// Maximum relative difference between the q/p of pruned branches
+    scalar_t pruning_max_rel_delta_qop = 0.05f;
+
+    /// Budget for the number of seeds of one event. The seeds beyond it are
+    /// not processed. With the default of 0, all seeds are processed.
+    unsigned int max_num_seeds = 0;
+
+    /// GPU-specific budget for the number of branches in flight in one step.
+    /// Once a step exceeds it, the following steps make at most one branch
+    /// per surface, with @c chi2_max scaled by @c degraded_chi2_scale. With
+    /// the default of 0, the branching is never limited. Only applied when
+    /// the step loop is driven from the host.
+    unsigned int max_num_branches_in_flight = 0;
+
+    /// Scale of @c chi2_max in the steps after exceeding the branch budget
+    scalar_t degraded_chi2_scale = 0.5f;
+
+    /// GPU-specific wall-clock budget, in milliseconds, for the track finding
+    /// of one event. Once it is exceeded, the branches of the current step
+    /// become track candidates, and the step loop ends. With the default of
+    /// 0, there is no deadline. Only applied when the step loop is driven
+    /// from the host.
+    unsigned int max_event_time_ms = 0;
+
+    /// CPU-specific number of input parameters to process in each (TBB)
+    /// task of a host track finding step. Tasks never split the parameters
+    /// belonging to the same seed, so they may receive more. With the
+    /// default of 0, the host track finding runs serially. The results do
+    /// not depend on this setting.
+    unsigned int host_params_per_task = 0;
 };
 
 }  // namespace traccc
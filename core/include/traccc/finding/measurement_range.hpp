@@ -0,0 +1,99 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s).
+#include "traccc/definitions/qualifiers.hpp"
+#include "traccc/edm/container.hpp"
+#include "traccc/edm/measurement.hpp"
+
+// VecMem include(s).
+#include <vecmem/memory/memory_resource.hpp>
+
+// System include(s).
+#include <algorithm>
+
+namespace traccc {
+
+/// The range of (surface-sorted) measurements on one detector surface
+///
+/// The measurements of the surface are the ones in <tt>[begin, end)</tt>.
+/// Surfaces without measurements have an empty range.
+///
+struct measurement_range {
+
+    /// Index of the first measurement on the surface
+    unsigned int begin = 0u;
+    /// Index after the last measurement on the surface
+    unsigned int end = 0u;
+
+    /// The number of measurements on the surface
+    TRACCC_HOST_DEVICE
+    unsigned int size() const { return end - begin; }
+
+};  // struct measurement_range
+
+/// Declare all measurement range collection types
+///
+/// The collections are indexed by the (Detray) surface index of the
+/// measurements' surface links.
+///
+using measurement_range_collection_types =
+    collection_types<measurement_range>;
+
+/// Look up the measurement range of a surface
+///
+/// @param ranges The measurement range table
+/// @param surface_index The Detray index of the surface
+/// @return The measurement range of the surface, which is empty for surfaces
+///         beyond the end of the table
+///
+template <typename range_vector_t>
+TRACCC_HOST_DEVICE inline measurement_range find_measurement_range(
+    const range_vector_t& ranges, const unsigned int surface_index) {
+
+    return (surface_index < ranges.size()) ? ranges[surface_index]
+                                           : measurement_range{};
+}
+
+/// Build the measurement range table of surface-sorted measurements on the
+/// host
+///
+/// @param measurements The measurements, sorted by surface
+/// @param mr The memory resource to create the table with
+/// @return The table with one entry per surface, up to the last surface
+///         with measurements
+///
+inline measurement_range_collection_types::host make_measurement_ranges(
+    const measurement_collection_types::host& measurements,
+    vecmem::memory_resource& mr) {
+
+    // The size of the table is set by the largest surface index.
+    unsigned int n_surfaces = 0u;
+    for (const measurement& meas : measurements) {
+        n_surfaces = std::max(
+            n_surfaces, static_cast<unsigned int>(meas.surface_link.index()) +
+                            1u);
+    }
+    measurement_range_collection_types::host result(n_surfaces, &mr);
+
+    // Fill the ranges of the surfaces with measurements.
+    for (unsigned int i = 0; i < measurements.size(); ++i) {
+        const unsigned int surface_index =
+            static_cast<unsigned int>(measurements[i].surface_link.index());
+        if ((i == 0u) ||
+            !(measurements[i - 1].surface_link ==
+              measurements[i].surface_link)) {
+            result[surface_index].begin = i;
+        }
+        result[surface_index].end = i + 1u;
+    }
+    return result;
+}
+
+}  // namespace traccc
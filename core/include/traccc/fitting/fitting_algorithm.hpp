@@ -1,6 +1,6 @@
 /** TRACCC library, part of the ACTS project (R&D line)
  *
- * (c) 2022-2023 CERN for the benefit of the ACTS project
+ * (c) 2022-2024 CERN for the benefit of the ACTS project
  *
  * Mozilla Public License Version 2.0
  */
@@ -14,6 +14,12 @@
 #include "traccc/fitting/fitting_config.hpp"
 #include "traccc/fitting/kalman_filter/kalman_fitter.hpp"
 #include "traccc/utils/algorithm.hpp"
+#include "traccc/utils/parallel_for.hpp"
+#include "traccc/utils/trace.hpp"
+#include "traccc/utils/work_model.hpp"
+
+// System include(s).
+#include <algorithm>
 
 namespace traccc {
 
@@ -38,6 +44,10 @@ class fitting_algorithm
 
     /// Run the algorithm
     ///
+    /// The tracks are fitted in (TBB) tasks if
+    /// @c fitting_config::host_tracks_per_task is set, with the same results
+    /// as for the serial fitting.
+    ///
     /// @param track_candidates the candidate measurements from track finding
     /// @return the container of the fitted track parameters
     track_state_container_types::host operator()(
@@ -46,43 +56,159 @@ class fitting_algorithm
         const typename track_candidate_container_types::host& track_candidates)
         const override {
 
-        fitter_t fitter(det, field, m_cfg);
+        return fit(det, field, track_candidates, nullptr);
+    }
 
-        track_state_container_types::host output_states;
+    /// Run the algorithm, re-using the transport recorded by the track
+    /// finding
+    ///
+    /// The track states filtered by the track finding (see
+    /// @c traccc::finding_algorithm::find_with_transport) are used in place
+    /// of the forward filtering of the first iteration, for every track
+    /// whose seed and measurements match its recorded ones. Tracks without
+    /// matching track states, e.g. ones modified after the track finding,
+    /// are fitted as usual.
+    ///
+    /// @param track_candidates the candidate measurements from track finding
+    /// @param filtered_states the track states filtered by the track finding
+    /// @return the container of the fitted track parameters
+    track_state_container_types::host operator()(
+        const typename fitter_t::detector_type& det,
+        const typename fitter_t::bfield_type& field,
+        const typename track_candidate_container_types::host& track_candidates,
+        const track_state_container_types::host& filtered_states) const {
 
-        // The number of tracks
-        std::size_t n_tracks = track_candidates.size();
+        return fit(det, field, track_candidates, &filtered_states);
+    }
 
-        // Iterate over tracks
-        for (std::size_t i = 0; i < n_tracks; i++) {
+    /// Config object
+    config_type m_cfg;
+
+    private:
+    /// The track candidates of one track
+    using candidate_view =
+        typename track_candidate_container_types::host::const_element_view;
+    /// The track states of one track
+    using state_view =
+        typename track_state_container_types::host::const_element_view;
 
-            // Seed parameter
-            const auto& seed_param = track_candidates[i].header;
+    /// Check whether the recorded track states of a track candidate match it
+    static bool matches(const candidate_view& candidate,
+                        const state_view& states) {
 
-            // Make a vector of track state
-            auto& cands = track_candidates[i].items;
-            vecmem::vector<track_state<transform3_type>> input_states;
-            input_states.reserve(cands.size());
-            for (auto& cand : cands) {
-                input_states.emplace_back(cand);
+        if (states.items.size() != candidate.items.size()) {
+            return false;
+        }
+        // Require the same seed, to the bit
+        const bound_track_parameters& seed = candidate.header;
+        const bound_track_parameters& recorded = states.header.fit_params;
+        if (seed.surface_link() != recorded.surface_link()) {
+            return false;
+        }
+        for (unsigned int i = 0; i < e_bound_size; ++i) {
+            if (getter::element(seed.vector(), i, 0u) !=
+                getter::element(recorded.vector(), i, 0u)) {
+                return false;
             }
+        }
+        for (std::size_t i = 0; i < states.items.size(); ++i) {
+            if (!(states.items[i].get_measurement() == candidate.items[i])) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    /// Fit the tracks, with or without recorded track states
+    track_state_container_types::host fit(
+        const typename fitter_t::detector_type& det,
+        const typename fitter_t::bfield_type& field,
+        const typename track_candidate_container_types::host& track_candidates,
+        const track_state_container_types::host* filtered_states) const {
+
+        TRACCC_TRACE_RANGE("traccc::fitting_algorithm");
+
+        // The number of tracks
+        const std::size_t n_tracks = track_candidates.size();
 
-            // Make a fitter state
-            typename fitter_t::state fitter_state(std::move(input_states));
+        // Only use recorded track states made for the same tracks
+        if ((filtered_states != nullptr) &&
+            (filtered_states->size() != n_tracks)) {
+            filtered_states = nullptr;
+        }
 
-            // Run fitter
-            fitter.fit(seed_param, fitter_state);
+        // The output, sized up front, so that the tracks can be written into
+        // it directly from any task
+        track_state_container_types::host output_states;
+        output_states.resize(n_tracks);
+
+        // Fit a range of tracks, with one fitter state re-used for all of them
+        auto fit_tracks = [&](std::size_t begin, std::size_t end) {
+            fitter_t fitter(det, field, m_cfg);
+            typename fitter_t::state fitter_state(
+                vecmem::vector<track_state<transform3_type>>{});
+
+            for (std::size_t i = begin; i < end; i++) {
+
+                // Start from the recorded track states, if they match
+                auto& track_states = output_states.get_items()[i];
+                if ((filtered_states != nullptr) &&
+                    matches(track_candidates[i], (*filtered_states)[i])) {
+
+                    track_states = filtered_states->get_items()[i];
+                    fitter_state.reset(std::move(track_states));
+                    fitter.fit_filtered(fitter_state);
+                } else {
+
+                    // Seed parameter
+                    const auto& seed_param = track_candidates[i].header;
+
+                    // Make the vector of track states, in the output container
+                    auto& cands = track_candidates[i].items;
+                    track_states.reserve(cands.size());
+                    for (auto& cand : cands) {
+                        track_states.emplace_back(cand);
+                    }
+
+                    // Prepare the fitter state
+                    fitter_state.reset(std::move(track_states));
+
+                    // Run fitter
+                    fitter.fit(seed_param, fitter_state);
+                }
+
+                output_states.get_headers()[i] =
+                    std::move(fitter_state.m_fit_res);
+                track_states =
+                    std::move(fitter_state.m_fit_actor_state.m_track_states);
+            }
+        };
+
+        // Iterate over tracks, in parallel if requested
+        if (m_cfg.host_tracks_per_task == 0) {
+            fit_tracks(0, n_tracks);
+        } else {
+            const std::size_t tracks_per_task = m_cfg.host_tracks_per_task;
+            const std::size_t n_tasks =
+                (n_tracks + tracks_per_task - 1) / tracks_per_task;
+            details::parallel_for(n_tasks, [&](std::size_t task) {
+                fit_tracks(task * tracks_per_task,
+                           std::min(n_tracks, (task + 1) * tracks_per_task));
+            });
+        }
 
-            output_states.push_back(
-                std::move(fitter_state.m_fit_res),
-                std::move(fitter_state.m_fit_actor_state.m_track_states));
+        // Count the work on the calling thread, as the tasks may have run on
+        // other threads.
+        if (counting_work()) {
+            std::size_t n_states = 0;
+            for (std::size_t i = 0; i < n_tracks; ++i) {
+                n_states += track_candidates[i].items.size();
+            }
+            count_work(work_model::track_fitting(n_tracks, n_states));
         }
 
         return output_states;
     }
-
-    /// Config object
-    config_type m_cfg;
 };
 
 }  // namespace traccc
\ No newline at end of file
@@ -19,8 +19,39 @@ struct fitting_config {
 
     std::size_t n_iterations = 1;
 
+    /// Flag for refitting the tracks, in the iterations after the first one,
+    /// with a @c traccc::direct_navigator. Which visits the surfaces of the
+    /// track states of the previous iteration in order, instead of navigating
+    /// through the detector again. Only the material of these surfaces is
+    /// applied to the tracks then.
+    bool direct_refit = true;
+
+    /// Flag for running the first iteration with a
+    /// @c traccc::direct_navigator as well, along the surfaces of the track
+    /// candidates. The navigation candidate buffers are not used then.
+    bool direct_first_fit = false;
+
     /// Propagation configuration
     detray::propagation::config<scalar_t> propagation{};
+
+    /// GPU-specific flag for fitting the tracks in the order of decreasing
+    /// numbers of candidates. Which lets the threads of a warp fit tracks of
+    /// similar lengths, instead of waiting for the longest track of a warp
+    /// of random lengths. The fitted tracks keep their input order.
+    bool sort_tracks_by_length = false;
+
+    /// GPU-specific flag for smoothing the tracks with their track states
+    /// staged in (thread-)local memory. The backward pass then reads every
+    /// track state from the global memory only once, updates the fit
+    /// statistics along the way, and only writes back the smoothed
+    /// parameters. Instead of reading every state twice for the smoothing,
+    /// and once more for the statistics.
+    bool staged_smoothing = false;
+
+    /// CPU-specific number of tracks to fit in each (TBB) task of the host
+    /// track fitting. With the default of 0, the host track fitting runs
+    /// serially. The results do not depend on this setting.
+    unsigned int host_tracks_per_task = 0;
 };
 
 }  // namespace traccc
@@ -0,0 +1,217 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s).
+#include "traccc/definitions/qualifiers.hpp"
+
+// System include(s).
+#include <cmath>
+
+namespace traccc {
+
+/// Fixed-size kernels for the symmetric (covariance) matrices of the Kalman
+/// filter
+///
+/// The matrix sizes can not be deduced from the arguments, they have to be
+/// given explicitly as template parameters.
+///
+/// The products that are known to give symmetric results only compute the
+/// upper triangle of them, and mirror it. The positive definite matrices are
+/// inverted through their Cholesky decomposition. When the project is built
+/// with @c TRACCC_USE_SYMMETRIC_COVARIANCE switched off, the kernels fall
+/// back to the generic matrix operations of the algebra plugin, for
+/// validation.
+///
+/// The kernels only use the element access of the matrices, so they work
+/// with all algebra plugins. Specialisations for individual plugins can be
+/// provided for their algebra types.
+///
+template <typename algebra_t>
+struct covariance_kernels {
+
+    /// @name Type declarations
+    /// @{
+
+    using matrix_operator = typename algebra_t::matrix_actor;
+    using size_type = typename matrix_operator::size_ty;
+    template <size_type ROWS, size_type COLS>
+    using matrix_type =
+        typename matrix_operator::template matrix_type<ROWS, COLS>;
+    using scalar_type = typename algebra_t::scalar_type;
+
+    /// @}
+
+    /// The upper triangle of a symmetric matrix, stored row by row
+    template <size_type N>
+    struct packed_matrix {
+
+        /// The number of stored elements
+        static constexpr size_type size = N * (N + 1) / 2;
+
+        /// Access an element (in either triangle)
+        TRACCC_HOST_DEVICE scalar_type& operator()(size_type i, size_type j) {
+            return data[(i <= j) ? index(i, j) : index(j, i)];
+        }
+        /// Access an element (in either triangle)
+        TRACCC_HOST_DEVICE scalar_type operator()(size_type i,
+                                                  size_type j) const {
+            return data[(i <= j) ? index(i, j) : index(j, i)];
+        }
+
+        /// The position of element (i, j), for i <= j
+        TRACCC_HOST_DEVICE static constexpr size_type index(size_type i,
+                                                            size_type j) {
+            return i * N - (i * (i + 1)) / 2 + j;
+        }
+
+        /// The stored elements
+        scalar_type data[size];
+
+    };  // struct packed_matrix
+
+    /// Pack the upper triangle of a symmetric matrix
+    template <size_type N>
+    TRACCC_HOST_DEVICE static packed_matrix<N> pack(
+        const matrix_type<N, N>& m) {
+
+        packed_matrix<N> result;
+        for (size_type i = 0u; i < N; ++i) {
+            for (size_type j = i; j < N; ++j) {
+                result(i, j) = getter::element(m, i, j);
+            }
+        }
+        return result;
+    }
+
+    /// Unpack a symmetric matrix, filling both of its triangles
+    template <size_type N>
+    TRACCC_HOST_DEVICE static matrix_type<N, N> unpack(
+        const packed_matrix<N>& p) {
+
+        matrix_type<N, N> result;
+        for (size_type i = 0u; i < N; ++i) {
+            for (size_type j = i; j < N; ++j) {
+                getter::element(result, i, j) = p(i, j);
+                getter::element(result, j, i) = p(i, j);
+            }
+        }
+        return result;
+    }
+
+    /// The product J * C * J^T, for a symmetric C
+    template <size_type M, size_type N>
+    TRACCC_HOST_DEVICE static matrix_type<M, M> sandwich(
+        const matrix_type<M, N>& J, const matrix_type<N, N>& C) {
+
+#ifdef TRACCC_USE_SYMMETRIC_COVARIANCE
+        const matrix_type<M, N> JC = J * C;
+        packed_matrix<M> result;
+        for (size_type i = 0u; i < M; ++i) {
+            for (size_type j = i; j < M; ++j) {
+                scalar_type sum = 0.f;
+                for (size_type k = 0u; k < N; ++k) {
+                    sum += getter::element(JC, i, k) * getter::element(J, j, k);
+                }
+                result(i, j) = sum;
+            }
+        }
+        return unpack<M>(result);
+#else
+        return J * C * matrix_operator().transpose(J);
+#endif
+    }
+
+    /// The difference C - K * B^T, for a product K * B^T known to be
+    /// symmetric, like the covariance update P - K * (P * H^T)^T of the
+    /// Kalman filter
+    template <size_type N, size_type D>
+    TRACCC_HOST_DEVICE static matrix_type<N, N> subtract_symmetric_product(
+        const matrix_type<N, N>& C, const matrix_type<N, D>& K,
+        const matrix_type<N, D>& B) {
+
+#ifdef TRACCC_USE_SYMMETRIC_COVARIANCE
+        packed_matrix<N> result;
+        for (size_type i = 0u; i < N; ++i) {
+            for (size_type j = i; j < N; ++j) {
+                scalar_type sum = getter::element(C, i, j);
+                for (size_type k = 0u; k < D; ++k) {
+                    sum -= getter::element(K, i, k) * getter::element(B, j, k);
+                }
+                result(i, j) = sum;
+            }
+        }
+        return unpack<N>(result);
+#else
+        return C - K * matrix_operator().transpose(B);
+#endif
+    }
+
+    /// The inverse of a symmetric, positive definite matrix
+    ///
+    /// Falls back to the generic inversion of the algebra plugin, if the
+    /// Cholesky decomposition fails.
+    ///
+    template <size_type N>
+    TRACCC_HOST_DEVICE static matrix_type<N, N> inverse_spd(
+        const matrix_type<N, N>& m) {
+
+#ifdef TRACCC_USE_SYMMETRIC_COVARIANCE
+        // Cholesky decomposition, m = L * L^T, with L stored transposed
+        packed_matrix<N> Lt;
+        for (size_type j = 0u; j < N; ++j) {
+            scalar_type diag = getter::element(m, j, j);
+            for (size_type k = 0u; k < j; ++k) {
+                diag -= Lt(k, j) * Lt(k, j);
+            }
+            if (!(diag > 0.f)) {
+                return matrix_operator().inverse(m);
+            }
+            Lt(j, j) = std::sqrt(diag);
+            for (size_type i = j + 1u; i < N; ++i) {
+                scalar_type sum = getter::element(m, i, j);
+                for (size_type k = 0u; k < j; ++k) {
+                    sum -= Lt(k, i) * Lt(k, j);
+                }
+                Lt(j, i) = sum / Lt(j, j);
+            }
+        }
+
+        // Inverse of L, stored transposed as well
+        packed_matrix<N> Linvt;
+        for (size_type j = 0u; j < N; ++j) {
+            Linvt(j, j) = 1.f / Lt(j, j);
+            for (size_type i = j + 1u; i < N; ++i) {
+                scalar_type sum = 0.f;
+                for (size_type k = j; k < i; ++k) {
+                    sum += Lt(k, i) * Linvt(j, k);
+                }
+                Linvt(j, i) = -sum / Lt(i, i);
+            }
+        }
+
+        // m^-1 = L^-T * L^-1
+        packed_matrix<N> result;
+        for (size_type i = 0u; i < N; ++i) {
+            for (size_type j = i; j < N; ++j) {
+                scalar_type sum = 0.f;
+                for (size_type k = j; k < N; ++k) {
+                    sum += Linvt(i, k) * Linvt(j, k);
+                }
+                result(i, j) = sum;
+            }
+        }
+        return unpack<N>(result);
+#else
+        return matrix_operator().inverse(m);
+#endif
+    }
+
+};  // struct covariance_kernels
+
+}  // namespace traccc
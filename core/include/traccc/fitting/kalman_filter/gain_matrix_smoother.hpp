@@ -9,6 +9,7 @@
 
 // Project include(s).
 #include "traccc/definitions/qualifiers.hpp"
+#include "traccc/fitting/kalman_filter/covariance_kernels.hpp"
 #include "traccc/edm/track_parameters.hpp"
 #include "traccc/edm/track_state.hpp"
 
@@ -29,6 +30,7 @@ struct gain_matrix_smoother {
     using matrix_type =
         typename matrix_operator::template matrix_type<ROWS, COLS>;
     using scalar_type = typename algebra_t::scalar_type;
+    using kernels = covariance_kernels<algebra_t>;
 
     /// Gain matrix smoother operation
     ///
@@ -101,13 +103,15 @@ struct gain_matrix_smoother {
         // Calculate smoothed parameter for current state
         const matrix_type<e_bound_size, e_bound_size> A =
             cur_filtered_cov * matrix_operator().transpose(next_jacobian) *
-            matrix_operator().inverse(regularized_predicted_cov);
+            kernels::template inverse_spd<e_bound_size>(
+                regularized_predicted_cov);
 
         const matrix_type<e_bound_size, 1> smt_vec =
             cur_filtered_vec + A * (next_smoothed_vec - next_predicted_vec);
         const matrix_type<e_bound_size, e_bound_size> smt_cov =
-            cur_filtered_cov + A * (next_smoothed_cov - next_predicted_cov) *
-                                   matrix_operator().transpose(A);
+            cur_filtered_cov +
+            kernels::template sandwich<e_bound_size, e_bound_size>(
+                A, next_smoothed_cov - next_predicted_cov);
 
         cur_state.smoothed().set_vector(smt_vec);
         cur_state.smoothed().set_covariance(smt_cov);
@@ -1,6 +1,6 @@
 /** TRACCC library, part of the ACTS project (R&D line)
  *
- * (c) 2022-2023 CERN for the benefit of the ACTS project
+ * (c) 2022-2024 CERN for the benefit of the ACTS project
  *
  * Mozilla Public License Version 2.0
  */
@@ -10,12 +10,21 @@
 // Project include(s).
 #include "traccc/definitions/qualifiers.hpp"
 #include "traccc/definitions/track_parametrization.hpp"
+#include "traccc/fitting/kalman_filter/covariance_kernels.hpp"
 #include "traccc/edm/track_state.hpp"
 
 namespace traccc {
 
 /// Type unrolling functor for Kalman updating
-template <typename algebra_t>
+///
+/// @tparam algebra_t The algebra type of the track parameters
+/// @tparam precise_scalar_t The scalar type to invert the gain matrix and to
+///         calculate the chi-square in. (Which are the numerically sensitive
+///         parts of the update, when the covariances are stored in single
+///         precision.)
+///
+template <typename algebra_t,
+          typename precise_scalar_t = typename algebra_t::scalar_type>
 struct gain_matrix_updater {
 
     // Type declarations
@@ -24,6 +33,8 @@ struct gain_matrix_updater {
     template <size_type ROWS, size_type COLS>
     using matrix_type =
         typename matrix_operator::template matrix_type<ROWS, COLS>;
+    using scalar_type = typename algebra_t::scalar_type;
+    using kernels = covariance_kernels<algebra_t>;
 
     /// Gain matrix updater operation
     ///
@@ -53,6 +64,14 @@ struct gain_matrix_updater {
         }
     }
 
+    /// Kalman update with a measurement of a given dimension
+    ///
+    /// The projection matrix H of the measurement only selects D of the bound
+    /// parameters (flipping the sign of the first one on line surfaces, for
+    /// negative predicted local positions). So instead of multiplying with
+    /// it, the measured elements of the parameters and of the covariance are
+    /// accessed directly.
+    ///
     template <size_type D, typename shape_t>
     TRACCC_HOST_DEVICE inline void update(
         track_state<algebra_t>& trk_state,
@@ -63,16 +82,9 @@ struct gain_matrix_updater {
 
         const auto meas = trk_state.get_measurement();
 
-        // Some identity matrices
-        // @Note: Make constexpr work
-        const matrix_type<e_bound_size, e_bound_size> I66 =
-            matrix_operator().template identity<e_bound_size, e_bound_size>();
-
         const matrix_type<D, D> I_m =
             matrix_operator().template identity<D, D>();
 
-        matrix_type<D, e_bound_size> H = meas.subs.template projector<D>();
-
         // Measurement data on surface
         const matrix_type<D, 1>& meas_local =
             trk_state.template measurement_local<D>();
@@ -89,11 +101,21 @@ struct gain_matrix_updater {
         trk_state.predicted().set_vector(predicted_vec);
         trk_state.predicted().set_covariance(predicted_cov);
 
+        // The bound parameters selected by the rows of H, and their signs
+        const auto& indices = meas.subs.get_indices();
+        size_type idx[D];
+        scalar_type sign[D];
+        for (size_type i = 0u; i < D; ++i) {
+            idx[i] = static_cast<size_type>(indices[i]);
+            sign[i] = 1.f;
+        }
+
         if constexpr (std::is_same_v<shape_t, detray::line<true>> ||
                       std::is_same_v<shape_t, detray::line<false>>) {
 
-            if (getter::element(predicted_vec, e_bound_loc0, 0u) < 0) {
-                getter::element(H, 0u, e_bound_loc0) = -1;
+            if ((idx[0] == e_bound_loc0) &&
+                (getter::element(predicted_vec, e_bound_loc0, 0u) < 0)) {
+                sign[0] = -1.f;
             }
         }
 
@@ -101,26 +123,61 @@ struct gain_matrix_updater {
         const matrix_type<D, D> V =
             trk_state.template measurement_covariance<D>();
 
-        const matrix_type<D, D> M =
-            H * predicted_cov * matrix_operator().transpose(H) + V;
+        // P * H^T: the (signed) covariance columns of the measured parameters
+        matrix_type<e_bound_size, D> PHt;
+        for (size_type r = 0u; r < e_bound_size; ++r) {
+            for (size_type j = 0u; j < D; ++j) {
+                getter::element(PHt, r, j) =
+                    sign[j] * getter::element(predicted_cov, r, idx[j]);
+            }
+        }
+
+        // M = H * P * H^T + V
+        matrix_type<D, D> M = V;
+        for (size_type i = 0u; i < D; ++i) {
+            for (size_type j = 0u; j < D; ++j) {
+                getter::element(M, i, j) +=
+                    sign[i] * getter::element(PHt, idx[i], j);
+            }
+        }
 
         // Kalman gain matrix
-        const matrix_type<6, D> K = predicted_cov *
-                                    matrix_operator().transpose(H) *
-                                    matrix_operator().inverse(M);
+        const matrix_type<6, D> K = PHt * inverse<D>(M);
+
+        // Residual between measurement and (projected) predicted vector
+        matrix_type<D, 1> predicted_residual;
+        for (size_type i = 0u; i < D; ++i) {
+            getter::element(predicted_residual, i, 0u) =
+                getter::element(meas_local, i, 0u) -
+                sign[i] * getter::element(predicted_vec, idx[i], 0u);
+        }
 
-        // Calculate the filtered track parameters
+        // Calculate the filtered track parameters. With H * P = (P * H^T)^T,
+        // as the covariance is symmetric.
         const matrix_type<6, 1> filtered_vec =
-            predicted_vec + K * (meas_local - H * predicted_vec);
-        const matrix_type<6, 6> filtered_cov = (I66 - K * H) * predicted_cov;
+            predicted_vec + K * predicted_residual;
+        const matrix_type<6, 6> filtered_cov =
+            kernels::template subtract_symmetric_product<6, D>(predicted_cov,
+                                                                K, PHt);
 
         // Residual between measurement and (projected) filtered vector
-        const matrix_type<D, 1> residual = meas_local - H * filtered_vec;
+        matrix_type<D, 1> residual;
+        for (size_type i = 0u; i < D; ++i) {
+            getter::element(residual, i, 0u) =
+                getter::element(meas_local, i, 0u) -
+                sign[i] * getter::element(filtered_vec, idx[i], 0u);
+        }
 
-        // Calculate the chi square
-        const matrix_type<D, D> R = (I_m - H * K) * V;
-        const matrix_type<1, 1> chi2 = matrix_operator().transpose(residual) *
-                                       matrix_operator().inverse(R) * residual;
+        // Calculate the chi square, with R = (I - H * K) * V
+        matrix_type<D, D> I_HK = I_m;
+        for (size_type i = 0u; i < D; ++i) {
+            for (size_type j = 0u; j < D; ++j) {
+                getter::element(I_HK, i, j) -=
+                    sign[i] * getter::element(K, idx[i], j);
+            }
+        }
+        const matrix_type<D, D> R = I_HK * V;
+        const scalar_type chi2 = chi_square<D>(residual, R);
 
         // Set the stepper parameter
         bound_params.set_vector(filtered_vec);
@@ -129,10 +186,74 @@ struct gain_matrix_updater {
         // Set the track state parameters
         trk_state.filtered().set_vector(filtered_vec);
         trk_state.filtered().set_covariance(filtered_cov);
-        trk_state.filtered_chi2() = matrix_operator().element(chi2, 0, 0);
+        trk_state.filtered_chi2() = chi2;
 
         return;
     }
+
+    /// Invert a (1x1 or 2x2) matrix, in @c precise_scalar_t
+    template <size_type D>
+    TRACCC_HOST_DEVICE inline matrix_type<D, D> inverse(
+        const matrix_type<D, D>& m) const {
+
+        matrix_type<D, D> result;
+        if constexpr (D == 1u) {
+            getter::element(result, 0u, 0u) = static_cast<scalar_type>(
+                precise_scalar_t{1} /
+                static_cast<precise_scalar_t>(getter::element(m, 0u, 0u)));
+        } else {
+            const auto a =
+                static_cast<precise_scalar_t>(getter::element(m, 0u, 0u));
+            const auto b =
+                static_cast<precise_scalar_t>(getter::element(m, 0u, 1u));
+            const auto c =
+                static_cast<precise_scalar_t>(getter::element(m, 1u, 0u));
+            const auto d =
+                static_cast<precise_scalar_t>(getter::element(m, 1u, 1u));
+            const precise_scalar_t inv_det =
+                precise_scalar_t{1} / (a * d - b * c);
+            getter::element(result, 0u, 0u) =
+                static_cast<scalar_type>(d * inv_det);
+            getter::element(result, 0u, 1u) =
+                static_cast<scalar_type>(-b * inv_det);
+            getter::element(result, 1u, 0u) =
+                static_cast<scalar_type>(-c * inv_det);
+            getter::element(result, 1u, 1u) =
+                static_cast<scalar_type>(a * inv_det);
+        }
+        return result;
+    }
+
+    /// Calculate the chi-square r^T * R^-1 * r, in @c precise_scalar_t
+    template <size_type D>
+    TRACCC_HOST_DEVICE inline scalar_type chi_square(
+        const matrix_type<D, 1>& r, const matrix_type<D, D>& R) const {
+
+        if constexpr (D == 1u) {
+            const auto r0 =
+                static_cast<precise_scalar_t>(getter::element(r, 0u, 0u));
+            return static_cast<scalar_type>(
+                r0 * r0 /
+                static_cast<precise_scalar_t>(getter::element(R, 0u, 0u)));
+        } else {
+            const auto r0 =
+                static_cast<precise_scalar_t>(getter::element(r, 0u, 0u));
+            const auto r1 =
+                static_cast<precise_scalar_t>(getter::element(r, 1u, 0u));
+            const auto a =
+                static_cast<precise_scalar_t>(getter::element(R, 0u, 0u));
+            const auto b =
+                static_cast<precise_scalar_t>(getter::element(R, 0u, 1u));
+            const auto c =
+                static_cast<precise_scalar_t>(getter::element(R, 1u, 0u));
+            const auto d =
+                static_cast<precise_scalar_t>(getter::element(R, 1u, 1u));
+            // r^T * adj(R) * r / det(R)
+            return static_cast<scalar_type>(
+                (r0 * (d * r0 - b * r1) + r1 * (a * r1 - c * r0)) /
+                (a * d - b * c));
+        }
+    }
 };
 
 }  // namespace traccc
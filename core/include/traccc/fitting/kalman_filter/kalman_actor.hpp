@@ -1,6 +1,6 @@
 /** TRACCC library, part of the ACTS project (R&D line)
  *
- * (c) 2022-2023 CERN for the benefit of the ACTS project
+ * (c) 2022-2024 CERN for the benefit of the ACTS project
  *
  * Mozilla Public License Version 2.0
  */
@@ -18,7 +18,12 @@
 namespace traccc {
 
 /// Detray actor for Kalman filtering
-template <typename algebra_t, template <typename...> class vector_t>
+///
+/// @tparam precise_scalar_t The scalar type of the Kalman gain inversions and
+///         chi-squares (see @c traccc::gain_matrix_updater)
+///
+template <typename algebra_t, template <typename...> class vector_t,
+          typename precise_scalar_t = typename algebra_t::scalar_type>
 struct kalman_actor : detray::actor {
 
     // Type declarations
@@ -105,7 +110,8 @@ struct kalman_actor : detray::actor {
 
             // Run Kalman Gain Updater
             const auto sf = navigation.get_surface();
-            sf.template visit_mask<gain_matrix_updater<algebra_t>>(
+            sf.template visit_mask<
+                gain_matrix_updater<algebra_t, precise_scalar_t>>(
                 trk_state, propagation._stepping._bound_params);
 
             // Update iterator
@@ -16,6 +16,8 @@
 #include "traccc/fitting/kalman_filter/gain_matrix_smoother.hpp"
 #include "traccc/fitting/kalman_filter/kalman_actor.hpp"
 #include "traccc/fitting/kalman_filter/statistics_updater.hpp"
+#include "traccc/navigation/direct_navigator.hpp"
+#include "traccc/navigation/planar_navigator.hpp"
 
 // detray include(s).
 #include "detray/propagator/actor_chain.hpp"
@@ -27,11 +29,32 @@
 
 // System include(s).
 #include <limits>
+#include <type_traits>
 
 namespace traccc {
 
+namespace details {
+
+/// Placeholder for the plane walk of @c traccc::kalman_fitter, with the
+/// navigators other than @c traccc::planar_navigator
+struct no_plane_walk {
+    template <typename detector_t>
+    TRACCC_HOST_DEVICE explicit no_plane_walk(const detector_t&) {}
+};
+
+}  // namespace details
+
 /// Kalman fitter algorithm to fit a single track
-template <typename stepper_t, typename navigator_t>
+///
+/// With a @c traccc::planar_navigator as navigator, the tracks are filtered
+/// along the fixed-order walk of its planes, instead of with the detray
+/// propagator.
+///
+/// @tparam precise_scalar_t The scalar type of the Kalman gain inversions and
+///         chi-squares (see @c traccc::gain_matrix_updater)
+///
+template <typename stepper_t, typename navigator_t,
+          typename precise_scalar_t = typename stepper_t::scalar_type>
 class kalman_fitter {
 
     public:
@@ -61,7 +84,8 @@ class kalman_fitter {
     using aborter = detray::pathlimit_aborter;
     using transporter = detray::parameter_transporter<transform3_type>;
     using interactor = detray::pointwise_material_interactor<transform3_type>;
-    using fit_actor = traccc::kalman_actor<transform3_type, vector_type>;
+    using fit_actor =
+        traccc::kalman_actor<transform3_type, vector_type, precise_scalar_t>;
     using resetter = detray::parameter_resetter<transform3_type>;
 
     using actor_chain_type =
@@ -72,13 +96,26 @@ class kalman_fitter {
     using propagator_type =
         detray::propagator<stepper_t, navigator_t, actor_chain_type>;
 
+    /// Navigator visiting the surfaces of the track states directly
+    using direct_navigator_type =
+        direct_navigator<detector_type,
+                         vector_type<track_state<transform3_type>>>;
+
+    /// Propagator type of the direct (re)fits
+    using direct_propagator_type =
+        detray::propagator<stepper_t, direct_navigator_type, actor_chain_type>;
+
+    /// The plane walk (only used with @c traccc::planar_navigator)
+    using walk_type = std::conditional_t<is_planar_navigator_v<navigator_t>,
+                                         navigator_t, details::no_plane_walk>;
+
     /// Constructor with a detector
     ///
     /// @param det the detector object
     TRACCC_HOST_DEVICE
     kalman_fitter(const detector_type& det, const bfield_type& field,
                   const config_type& cfg)
-        : m_detector(det), m_field(field), m_cfg(cfg) {}
+        : m_detector(det), m_field(field), m_cfg(cfg), m_walk(det) {}
 
     /// Kalman fitter state
     struct state {
@@ -97,6 +134,22 @@ class kalman_fitter {
         state(const vector_type<track_state<transform3_type>>& track_states)
             : m_fit_actor_state(track_states) {}
 
+        /// Prepare the state for fitting another track
+        ///
+        /// Allows re-using one state object for fitting many tracks.
+        ///
+        /// @param track_states the vector of track states of the new track
+        TRACCC_HOST_DEVICE
+        void reset(vector_type<track_state<transform3_type>>&& track_states) {
+            m_aborter_state = {};
+            m_transporter_state = {};
+            m_interactor_state = {};
+            m_fit_actor_state =
+                typename fit_actor::state(std::move(track_states));
+            m_resetter_state = {};
+            m_fit_res = {};
+        }
+
         /// @return the actor chain state
         TRACCC_HOST_DEVICE
         typename actor_chain_type::state operator()() {
@@ -134,7 +187,8 @@ class kalman_fitter {
             fitter_state.m_fit_actor_state.reset();
 
             if (i == 0) {
-                filter(seed_params, fitter_state, std::move(nav_candidates));
+                filter(seed_params, fitter_state, std::move(nav_candidates),
+                       m_cfg.direct_first_fit);
             }
             // From the second iteration, seed parameter is the smoothed track
             // parameter at the first surface
@@ -143,7 +197,39 @@ class kalman_fitter {
                     fitter_state.m_fit_actor_state.m_track_states[0].smoothed();
 
                 filter(new_seed_params, fitter_state,
-                       std::move(nav_candidates));
+                       std::move(nav_candidates), m_cfg.direct_refit);
+            }
+        }
+    }
+
+    /// Run the kalman fitter on track states that were filtered already
+    ///
+    /// Meant for the track states recorded by the track finding, which
+    /// propagated the tracks along the same surfaces already. The track
+    /// states need to have their predicted and filtered parameters, and
+    /// their transport jacobians from the previous track states, set. The
+    /// forward filtering of the first iteration is skipped then, and only
+    /// its smoothing is run. Any further iterations propagate the tracks
+    /// from their smoothed parameters, as in @c fit.
+    ///
+    /// @param fitter_state the state of kalman fitter
+    TRACCC_HOST_DEVICE void fit_filtered(
+        state& fitter_state,
+        vector_type<intersection_type>&& nav_candidates = {}) {
+
+        for (std::size_t i = 0; i < m_cfg.n_iterations; i++) {
+
+            // Reset the iterator of kalman actor
+            fitter_state.m_fit_actor_state.reset();
+
+            if (i == 0) {
+                smooth_and_update(fitter_state);
+            } else {
+                const auto& new_seed_params =
+                    fitter_state.m_fit_actor_state.m_track_states[0].smoothed();
+
+                filter(new_seed_params, fitter_state,
+                       std::move(nav_candidates), m_cfg.direct_refit);
             }
         }
     }
@@ -154,10 +240,58 @@ class kalman_fitter {
     ///
     /// @param seed_params seed track parameter
     /// @param fitter_state the state of kalman fitter
+    /// @param direct Flag for visiting the surfaces of the track states
+    ///               directly, with a @c traccc::direct_navigator
     template <typename seed_parameters_t>
     TRACCC_HOST_DEVICE void filter(
         const seed_parameters_t& seed_params, state& fitter_state,
-        vector_type<intersection_type>&& nav_candidates = {}) {
+        vector_type<intersection_type>&& nav_candidates = {},
+        bool direct = false) {
+
+        if constexpr (is_planar_navigator_v<navigator_t>) {
+            // The plane walk does not search for surfaces anyway.
+            (void)nav_candidates;
+            (void)direct;
+            walk_planes(seed_params, fitter_state);
+        } else {
+            if (direct) {
+                propagate_direct(seed_params, fitter_state);
+            } else {
+                propagate(seed_params, fitter_state,
+                          std::move(nav_candidates));
+            }
+        }
+
+        smooth_and_update(fitter_state);
+    }
+
+    /// Run smoothing after kalman filtering, and update the track fitting
+    /// qualities, in one or two passes (see @c fitting_config)
+    ///
+    /// @param fitter_state the state of kalman fitter
+    TRACCC_HOST_DEVICE
+    void smooth_and_update(state& fitter_state) {
+
+        if (m_cfg.staged_smoothing) {
+            // Run smoothing and update the track fitting qualities together
+            smooth_staged(fitter_state);
+        } else {
+            // Run smoothing
+            smooth(fitter_state);
+
+            // Update track fitting qualities
+            update_statistics(fitter_state);
+        }
+    }
+
+    /// Run the forward filtering with the detray propagator
+    ///
+    /// @param seed_params seed track parameter
+    /// @param fitter_state the state of kalman fitter
+    template <typename seed_parameters_t>
+    TRACCC_HOST_DEVICE void propagate(
+        const seed_parameters_t& seed_params, state& fitter_state,
+        vector_type<intersection_type>&& nav_candidates) {
 
         // Create propagator
         propagator_type propagator(m_cfg.propagation);
@@ -181,12 +315,96 @@ class kalman_fitter {
 
         // Run forward filtering
         propagator.propagate(propagation, fitter_state());
+    }
 
-        // Run smoothing
-        smooth(fitter_state);
+    /// Run the forward filtering with the detray propagator, visiting the
+    /// surfaces of the track states directly
+    ///
+    /// @param seed_params seed track parameter
+    /// @param fitter_state the state of kalman fitter
+    template <typename seed_parameters_t>
+    TRACCC_HOST_DEVICE void propagate_direct(
+        const seed_parameters_t& seed_params, state& fitter_state) {
 
-        // Update track fitting qualities
-        update_statistics(fitter_state);
+        // Create propagator
+        direct_propagator_type propagator(m_cfg.propagation);
+
+        // Set path limit
+        fitter_state.m_aborter_state.set_path_limit(
+            m_cfg.propagation.stepping.path_limit);
+
+        // Create propagator state, along the surfaces of the track states
+        typename direct_propagator_type::state propagation(
+            seed_params, m_field, m_detector);
+        propagation._navigation.set_volume(seed_params.surface_link().volume());
+        propagation._navigation.set_sequence(
+            fitter_state.m_fit_actor_state.m_track_states);
+
+        // Set overstep tolerance, stepper constraint and mask tolerance
+        propagation._stepping
+            .template set_constraint<detray::step::constraint::e_accuracy>(
+                m_cfg.propagation.stepping.step_constraint);
+
+        // Run forward filtering
+        propagator.propagate(propagation, fitter_state());
+    }
+
+    /// Run the forward filtering along the planes of a planar navigator
+    ///
+    /// The material of every crossed plane is applied, as by the actor chain
+    /// of the propagator, before the Kalman update on it.
+    ///
+    /// @param seed_params seed track parameter
+    /// @param fitter_state the state of kalman fitter
+    template <typename seed_parameters_t>
+    void walk_planes(const seed_parameters_t& seed_params,
+                     state& fitter_state) {
+
+        using matrix_operator =
+            typename track_state<transform3_type>::matrix_operator;
+        using bound_matrix =
+            typename track_state<transform3_type>::bound_matrix;
+
+        auto& actor_state = fitter_state.m_fit_actor_state;
+        bound_track_parameters params = seed_params;
+
+        // The transport jacobian since the last track state
+        bound_matrix jacobian =
+            matrix_operator().template identity<e_bound_size, e_bound_size>();
+
+        while (!actor_state.is_complete()) {
+
+            m_walk.interact(params);
+
+            auto& trk_state = actor_state();
+            if (params.surface_link() == trk_state.surface_link()) {
+
+                // This track state is not a hole
+                trk_state.is_hole = false;
+                trk_state.jacobian() = jacobian;
+
+                // Run Kalman Gain Updater
+                const detray::surface<detector_type> sf{m_detector,
+                                                        params.surface_link()};
+                sf.template visit_mask<
+                    gain_matrix_updater<transform3_type, precise_scalar_t>>(
+                    trk_state, params);
+
+                actor_state.next();
+                jacobian = matrix_operator()
+                               .template identity<e_bound_size, e_bound_size>();
+                if (actor_state.is_complete()) {
+                    break;
+                }
+            }
+
+            // Move on to the next plane
+            bound_matrix step_jacobian;
+            if (!m_walk.step(params, m_field, step_jacobian)) {
+                break;
+            }
+            jacobian = step_jacobian * jacobian;
+        }
     }
 
     /// Run smoothing after kalman filtering
@@ -224,6 +442,68 @@ class kalman_fitter {
         }
     }
 
+    /// Run smoothing after kalman filtering, updating the track fitting
+    /// qualities in the same (backward) pass
+    ///
+    /// Produces the same results as @c smooth followed by
+    /// @c update_statistics, up to the rounding of the summed chi2. But the
+    /// track states are staged in a window of local copies, holding the
+    /// state being smoothed and the (already smoothed) one after it. So
+    /// every track state is read only once, and only its smoothed parameters
+    /// are written back.
+    ///
+    /// @param fitter_state the state of kalman fitter
+    TRACCC_HOST_DEVICE
+    void smooth_staged(state& fitter_state) {
+        auto& fit_res = fitter_state.m_fit_res;
+        auto& track_states = fitter_state.m_fit_actor_state.m_track_states;
+
+        // The local window of the current and the next track states
+        track_state<transform3_type> window[2] = {track_states.back(),
+                                                  track_states.back()};
+        unsigned int next = 0u;
+
+        // The smoothed track parameter of the last surface is the filtered
+        // one
+        window[next].smoothed().set_vector(window[next].filtered().vector());
+        window[next].smoothed().set_covariance(
+            window[next].filtered().covariance());
+        window[next].smoothed_chi2() = window[next].filtered_chi2();
+
+        std::size_t i = track_states.size() - 1u;
+        while (true) {
+
+            // Write back the smoothed parameters of the (next) track state,
+            // and update the fitting qualities with it
+            const track_state<transform3_type>& smoothed = window[next];
+            track_states[i].smoothed() = smoothed.smoothed();
+            track_states[i].smoothed_chi2() = smoothed.smoothed_chi2();
+            const detray::surface<detector_type> next_sf{
+                m_detector, smoothed.surface_link()};
+            next_sf.template visit_mask<statistics_updater<transform3_type>>(
+                fit_res, smoothed);
+            if (i == 0u) {
+                break;
+            }
+
+            // Stage the previous track state, and smooth it
+            --i;
+            const unsigned int cur = 1u - next;
+            window[cur] = track_states[i];
+            const detray::surface<detector_type> sf{
+                m_detector, window[cur].surface_link()};
+            sf.template visit_mask<gain_matrix_smoother<transform3_type>>(
+                window[cur], window[next]);
+            next = cur;
+        }
+
+        // Fit parameter = smoothed track parameter at the first surface
+        fit_res.fit_params = window[next].smoothed();
+
+        // Subtract the NDoF with the degree of freedom of the bound track (=5)
+        fit_res.ndf = fit_res.ndf - 5.f;
+    }
+
     TRACCC_HOST_DEVICE
     void update_statistics(state& fitter_state) {
         auto& fit_res = fitter_state.m_fit_res;
@@ -252,6 +532,9 @@ class kalman_fitter {
 
     // Configuration object
     config_type m_cfg;
+
+    // The plane walk (only used with planar navigators)
+    walk_type m_walk;
 };
 
 }  // namespace traccc
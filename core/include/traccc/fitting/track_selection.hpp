@@ -0,0 +1,118 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s).
+#include "traccc/definitions/primitives.hpp"
+#include "traccc/definitions/qualifiers.hpp"
+#include "traccc/edm/track_state.hpp"
+#include "traccc/utils/algorithm.hpp"
+
+// VecMem include(s).
+#include <vecmem/containers/vector.hpp>
+
+// System include(s).
+#include <cmath>
+#include <cstddef>
+#include <limits>
+
+namespace traccc {
+
+/// Configuration of the selection of fitted tracks
+struct track_selection_config {
+
+    /// The smallest number of degrees of freedom of a selected track
+    scalar min_ndf = 0.f;
+    /// The largest chi square per degree of freedom of a selected track
+    scalar max_chi2_per_ndf = std::numeric_limits<scalar>::max();
+    /// The smallest transverse momentum of a selected track
+    scalar min_pT = 0.f;
+    /// The largest number of holes of a selected track
+    unsigned int max_n_holes = std::numeric_limits<unsigned int>::max();
+};
+
+/// Quality selection of one fitted track
+///
+/// The device counterpart of the (truth-level) @c traccc::track_filter
+/// predicates, for the fitted tracks themselves.
+///
+struct track_selector {
+
+    /// Decide whether to keep a track
+    ///
+    /// @param cfg The selection configuration
+    /// @param fit_res The fitting result of the track
+    /// @param states The (range of) track states of the track
+    /// @return Whether the track passes all cuts
+    ///
+    template <typename states_t>
+    TRACCC_HOST_DEVICE static bool is_selected(
+        const track_selection_config& cfg,
+        const fitting_result<transform3>& fit_res, const states_t& states) {
+
+        if (!(fit_res.ndf >= cfg.min_ndf) || !(fit_res.ndf > 0.f) ||
+            !(fit_res.chi2 <= cfg.max_chi2_per_ndf * fit_res.ndf)) {
+            return false;
+        }
+        const scalar qop = fit_res.fit_params.qop();
+        if ((qop == 0.f) ||
+            (std::abs(std::sin(fit_res.fit_params.theta()) / qop) <
+             cfg.min_pT)) {
+            return false;
+        }
+        unsigned int n_holes = 0u;
+        for (const auto& state : states) {
+            if (state.is_hole && (++n_holes > cfg.max_n_holes)) {
+                return false;
+            }
+        }
+        return true;
+    }
+};
+
+/// Algorithm selecting fitted tracks with @c traccc::track_selector
+///
+/// The selected tracks are copied into a dense output, keeping their order.
+///
+class track_selection_algorithm
+    : public algorithm<track_state_container_types::host(
+          const track_state_container_types::host&)> {
+
+    public:
+    /// Constructor with the selection configuration
+    explicit track_selection_algorithm(const track_selection_config& cfg)
+        : m_cfg(cfg) {}
+
+    /// Run the algorithm
+    ///
+    /// @param track_states The fitted tracks
+    /// @return The selected tracks
+    ///
+    output_type operator()(
+        const track_state_container_types::host& track_states) const override {
+
+        output_type result;
+        for (std::size_t i = 0; i < track_states.size(); ++i) {
+            const auto& header = track_states.get_headers()[i];
+            const auto& items = track_states.get_items()[i];
+            if (track_selector::is_selected(m_cfg, header, items)) {
+                result.push_back(fitting_result<transform3>(header),
+                                 vecmem::vector<track_state<transform3>>(
+                                     items, items.get_allocator()));
+            }
+        }
+        return result;
+    }
+
+    private:
+    /// The selection configuration
+    track_selection_config m_cfg;
+
+};  // class track_selection_algorithm
+
+}  // namespace traccc
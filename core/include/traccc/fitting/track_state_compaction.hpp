@@ -0,0 +1,78 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s).
+#include "traccc/edm/compact_track_state.hpp"
+#include "traccc/edm/track_state.hpp"
+#include "traccc/utils/algorithm.hpp"
+
+// System include(s).
+#include <cstddef>
+
+namespace traccc {
+
+/// Algorithm turning fitted track states into compact track states
+///
+/// Once the smoother is done, the measurements, the predicted and filtered
+/// parameters, and the jacobians of the track states are not needed by most
+/// jobs anymore. This algorithm only keeps the smoothed parameters and the
+/// smoothed chi squares of the states, while the covariances of the smoothed
+/// parameters can be kept (or not) with @c covariances.
+///
+class track_state_compaction
+    : public algorithm<compact_track_state_container_types::host(
+          const track_state_container_types::host&)> {
+
+    public:
+    /// Run the algorithm
+    ///
+    /// @param track_states The fitted track states
+    /// @return The compact states, with the same fitting results per track
+    ///
+    output_type operator()(
+        const track_state_container_types::host& track_states) const override {
+
+        const std::size_t n_tracks = track_states.size();
+        output_type result;
+        result.resize(n_tracks);
+        for (std::size_t i = 0; i < n_tracks; ++i) {
+            result.get_headers()[i] = track_states.get_headers()[i];
+            const auto& states = track_states.get_items()[i];
+            auto& compact_states = result.get_items()[i];
+            compact_states.reserve(states.size());
+            for (const auto& state : states) {
+                compact_states.emplace_back(state);
+            }
+        }
+        return result;
+    }
+
+    /// Collect the covariances of the smoothed parameters
+    ///
+    /// @param track_states The fitted track states
+    /// @return The covariances, in the same layout as the compact states
+    ///
+    compact_track_covariance_types::host covariances(
+        const track_state_container_types::host& track_states) const {
+
+        const std::size_t n_tracks = track_states.size();
+        compact_track_covariance_types::host result(n_tracks);
+        for (std::size_t i = 0; i < n_tracks; ++i) {
+            const auto& states = track_states.get_items()[i];
+            result[i].reserve(states.size());
+            for (const auto& state : states) {
+                result[i].push_back(state.smoothed().covariance());
+            }
+        }
+        return result;
+    }
+
+};  // class track_state_compaction
+
+}  // namespace traccc
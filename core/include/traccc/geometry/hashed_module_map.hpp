@@ -0,0 +1,350 @@
+/**
+ * TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s).
+#include "traccc/definitions/primitives.hpp"
+#include "traccc/definitions/qualifiers.hpp"
+#include "traccc/geometry/module_map.hpp"
+
+// VecMem include(s).
+#include <vecmem/containers/data/vector_buffer.hpp>
+#include <vecmem/containers/data/vector_view.hpp>
+#include <vecmem/containers/device_vector.hpp>
+#include <vecmem/containers/vector.hpp>
+#include <vecmem/memory/memory_resource.hpp>
+#include <vecmem/utils/copy.hpp>
+
+// System include(s).
+#include <cstdint>
+#include <limits>
+#include <map>
+#include <stdexcept>
+#include <type_traits>
+
+namespace traccc {
+
+/**
+ * @brief One slot of the hash table of @c traccc::hashed_module_map.
+ *
+ * A slot holds a key, and the index of its value in the (dense) value array
+ * of the map. Empty slots hold @c hashed_module_map_slot::empty_key().
+ */
+template <typename K>
+struct hashed_module_map_slot {
+
+    /// The key marking an empty slot
+    TRACCC_HOST_DEVICE static constexpr K empty_key() {
+        return std::numeric_limits<K>::max();
+    }
+
+    K key = empty_key();
+    unsigned int index = 0;
+};
+
+/**
+ * @brief Non-owning view of a @c traccc::hashed_module_map.
+ *
+ * This is what gets handed to device code, where lookups are done through
+ * @c traccc::hashed_module_map_device.
+ */
+template <typename K = geometry_id, typename V = transform3>
+struct hashed_module_map_view {
+    vecmem::data::vector_view<const hashed_module_map_slot<K>> slots;
+    vecmem::data::vector_view<const V> values;
+};
+
+namespace details {
+
+/**
+ * @brief Hash a module key.
+ *
+ * Uses the finalizer of MurmurHash3, which spreads the (mostly consecutive)
+ * module identifiers well over all of the bits of the result.
+ */
+template <typename K>
+TRACCC_HOST_DEVICE inline std::uint64_t hash_module_key(const K& key) {
+
+    std::uint64_t h = static_cast<std::uint64_t>(key);
+    h ^= h >> 33;
+    h *= 0xff51afd7ed558ccdull;
+    h ^= h >> 33;
+    h *= 0xc4ceb9fe1a85ec53ull;
+    h ^= h >> 33;
+    return h;
+}
+
+/**
+ * @brief Find the value of a key in a hash table.
+ *
+ * The table uses open addressing with linear probing, and it is never more
+ * than half full. So the probing terminates on an empty slot quickly.
+ *
+ * @return The index of the value of the key, or
+ *         @c std::numeric_limits<unsigned int>::max() if it is not found.
+ */
+template <typename K>
+TRACCC_HOST_DEVICE inline unsigned int find_module_key(
+    const hashed_module_map_slot<K>* slots, const unsigned int n_slots,
+    const K& key) {
+
+    if (n_slots == 0) {
+        return std::numeric_limits<unsigned int>::max();
+    }
+    const unsigned int mask = n_slots - 1;
+    for (unsigned int i = static_cast<unsigned int>(hash_module_key(key)) &
+                          mask;
+         ; i = (i + 1) & mask) {
+        const hashed_module_map_slot<K>& slot = slots[i];
+        if (slot.key == key) {
+            return slot.index;
+        }
+        if (slot.key == hashed_module_map_slot<K>::empty_key()) {
+            return std::numeric_limits<unsigned int>::max();
+        }
+    }
+}
+
+}  // namespace details
+
+/**
+ * @brief A flat, hashed map from module IDs to values.
+ *
+ * An alternative to @c traccc::module_map, which resolves keys in constant
+ * time, instead of with a tree search over the contiguous ranges of keys. It
+ * does not rely on the keys being contiguous either.
+ *
+ * The map is built once, on the host, typically when loading the geometry.
+ * Its slots and values are held in two flat arrays, which can be copied to a
+ * device as they are, with @c traccc::copy, and used there through
+ * @c traccc::hashed_module_map_device.
+ *
+ * @note Keys need to be integers, with their maximal value being reserved
+ * for marking the empty slots of the table.
+ */
+template <typename K = geometry_id, typename V = transform3>
+class hashed_module_map {
+
+    static_assert(std::is_integral_v<K>,
+                  "The keys of a hashed module map must be integers");
+
+    public:
+    /// Type of the slots of the hash table
+    using slot_type = hashed_module_map_slot<K>;
+    /// Type of the views of the map
+    using view_type = hashed_module_map_view<K, V>;
+
+    /// Default constructor, with an (optional) memory resource
+    explicit hashed_module_map(vecmem::memory_resource* mr = nullptr)
+        : m_slots(mr), m_values(mr) {}
+
+    /**
+     * @brief Construct a hashed map from a std::map.
+     *
+     * @param[in] input The existing map to convert.
+     * @param[in] mr The memory resource to hold the map in.
+     */
+    explicit hashed_module_map(const std::map<K, V>& input,
+                               vecmem::memory_resource* mr = nullptr)
+        : hashed_module_map(mr) {
+
+        reserve(input.size());
+        for (const auto& [key, value] : input) {
+            insert(key, value);
+        }
+    }
+
+    /**
+     * @brief Construct a hashed map from a (tree based) module map.
+     *
+     * @param[in] input The existing module map to convert.
+     * @param[in] mr The memory resource to hold the map in.
+     */
+    explicit hashed_module_map(const module_map<K, V>& input,
+                               vecmem::memory_resource* mr = nullptr)
+        : hashed_module_map(mr) {
+
+        reserve(input.size());
+        input.for_each([this](const K& key, const V& value) {
+            insert(key, value);
+        });
+    }
+
+    /**
+     * @brief Find a given key in the map, with bounds checking.
+     *
+     * @param[in] i The key to look-up.
+     *
+     * @return The value associated with the given key.
+     */
+    const V& at(const K& i) const {
+        const unsigned int index = find(i);
+        if (index >= m_values.size()) {
+            throw std::out_of_range("Index not found in hashed module map!");
+        }
+        return m_values[index];
+    }
+
+    /**
+     * @brief Find a given key in the map.
+     *
+     * @warning This method does no bounds checking, and will result in
+     * undefined behaviour if the key does not exist in the map.
+     */
+    const V& operator[](const K& i) const { return m_values[find(i)]; }
+
+    /// Check whether a key is in the map
+    bool contains(const K& i) const { return find(i) < m_values.size(); }
+
+    /// The number of keys in the map
+    std::size_t size() const { return m_values.size(); }
+
+    /// Check whether the map is empty
+    bool empty() const { return m_values.empty(); }
+
+    /// The number of slots in the hash table
+    std::size_t n_slots() const { return m_slots.size(); }
+
+    /// Get a view of the map, for using it in host or device code
+    view_type view() const {
+        return {vecmem::get_data(m_slots), vecmem::get_data(m_values)};
+    }
+
+    private:
+    /// Set up the slots of the table for a given number of keys
+    void reserve(std::size_t n_keys) {
+
+        // Keep the table at most half full.
+        std::size_t n = 1;
+        while (n < 2 * n_keys) {
+            n *= 2;
+        }
+        if (n > std::numeric_limits<unsigned int>::max()) {
+            throw std::length_error("Too many keys for a hashed module map!");
+        }
+        m_slots.assign(n, slot_type{});
+        m_values.reserve(n_keys);
+    }
+
+    /// Insert a key that is not in the map yet
+    void insert(const K& key, const V& value) {
+
+        if (key == slot_type::empty_key()) {
+            throw std::invalid_argument(
+                "The maximal key is reserved in a hashed module map!");
+        }
+        const std::size_t mask = m_slots.size() - 1;
+        std::size_t i = details::hash_module_key(key) & mask;
+        while (m_slots[i].key != slot_type::empty_key()) {
+            i = (i + 1) & mask;
+        }
+        m_slots[i] = {key, static_cast<unsigned int>(m_values.size())};
+        m_values.push_back(value);
+    }
+
+    /// Find the index of the value of a key
+    unsigned int find(const K& key) const {
+        return details::find_module_key(
+            m_slots.data(), static_cast<unsigned int>(m_slots.size()), key);
+    }
+
+    /// The slots of the hash table
+    vecmem::vector<slot_type> m_slots;
+    /// The values of the map, in insertion order
+    vecmem::vector<V> m_values;
+
+};  // class hashed_module_map
+
+/**
+ * @brief Buffer holding a copy of a @c traccc::hashed_module_map.
+ *
+ * Allocated with the sizes of an existing map, in (device) memory, for
+ * copying the map into with @c traccc::copy.
+ */
+template <typename K = geometry_id, typename V = transform3>
+struct hashed_module_map_buffer {
+
+    /// Constructor allocating the memory for a given map
+    hashed_module_map_buffer(const hashed_module_map<K, V>& map,
+                             vecmem::memory_resource& mr)
+        : slots(static_cast<unsigned int>(map.n_slots()), mr),
+          values(static_cast<unsigned int>(map.size()), mr) {}
+
+    vecmem::data::vector_buffer<hashed_module_map_slot<K>> slots;
+    vecmem::data::vector_buffer<V> values;
+};
+
+/// Get a view of a @c traccc::hashed_module_map_buffer
+template <typename K, typename V>
+hashed_module_map_view<K, V> get_data(
+    const hashed_module_map_buffer<K, V>& buffer) {
+    return {buffer.slots, buffer.values};
+}
+
+/**
+ * @brief Copy a hashed module map into a buffer.
+ *
+ * @param copy_obj The copy object to use
+ * @param from The map to copy
+ * @param to The buffer to copy into, allocated for @c from
+ * @param type The type of the copy, if known
+ */
+template <typename K, typename V>
+void copy(vecmem::copy& copy_obj, const hashed_module_map<K, V>& from,
+          hashed_module_map_buffer<K, V>& to,
+          vecmem::copy::type::copy_type type = vecmem::copy::type::unknown) {
+
+    const hashed_module_map_view<K, V> view = from.view();
+    copy_obj(view.slots, to.slots, type);
+    copy_obj(view.values, to.values, type);
+}
+
+/**
+ * @brief Lookups in a @c traccc::hashed_module_map, from host or device code.
+ */
+template <typename K = geometry_id, typename V = transform3>
+class hashed_module_map_device {
+
+    public:
+    /// Constructor from a view of the map
+    TRACCC_HOST_DEVICE explicit hashed_module_map_device(
+        const hashed_module_map_view<K, V>& view)
+        : m_slots(view.slots), m_values(view.values) {}
+
+    /**
+     * @brief Find a given key in the map.
+     *
+     * @param[in] i The key to look-up.
+     *
+     * @return A pointer to the value of the key, or @c nullptr if the key
+     * is not in the map.
+     */
+    TRACCC_HOST_DEVICE const V* find(const K& i) const {
+        const unsigned int index =
+            details::find_module_key(m_slots.data(), m_slots.size(), i);
+        return (index < m_values.size()) ? &(m_values[index]) : nullptr;
+    }
+
+    /// Check whether a key is in the map
+    TRACCC_HOST_DEVICE bool contains(const K& i) const {
+        return find(i) != nullptr;
+    }
+
+    /// The number of keys in the map
+    TRACCC_HOST_DEVICE unsigned int size() const { return m_values.size(); }
+
+    private:
+    /// The slots of the hash table
+    vecmem::device_vector<const hashed_module_map_slot<K>> m_slots;
+    /// The values of the map
+    vecmem::device_vector<const V> m_values;
+
+};  // class hashed_module_map_device
+
+}  // namespace traccc
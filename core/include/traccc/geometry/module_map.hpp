@@ -1,7 +1,7 @@
 /**
  * TRACCC library, part of the ACTS project (R&D line)
  *
- * (c) 2021-2022 CERN for the benefit of the ACTS project
+ * (c) 2021-2024 CERN for the benefit of the ACTS project
  *
  * Mozilla Public License Version 2.0
  */
@@ -11,6 +11,9 @@
 // Project include(s).
 #include "traccc/definitions/primitives.hpp"
 
+// VecMem include(s).
+#include <vecmem/containers/data/vector_view.hpp>
+
 // System include(s).
 #include <iostream>
 
@@ -52,6 +55,29 @@ namespace traccc {
 template <typename K = geometry_id, typename V = transform3>
 class module_map {
     public:
+    /**
+     * @brief The internal representation of nodes in our binary search tree.
+     *
+     * These objects carry three pieces of data. Firstly, there is the starting
+     * ID. Then, there is the size. Since the node represents a stretch of
+     * consecutive IDs, we know that the node ends at `start + size`. Finally,
+     * there is the index in the value array. We keep indices instead of
+     * pointers to make it easier to port this code to other devices.
+     */
+    struct module_map_node {
+        module_map_node() = default;
+
+        module_map_node(K s, std::size_t n, std::size_t i)
+            : start(s), size(n), index(i) {}
+
+        K start = 0;
+        std::size_t size = 0;
+        std::size_t index = 0;
+    };
+
+    /// Type of the nodes, as used by @c nodes()
+    using node_type = module_map_node;
+
     // Default constructor
     module_map() = default;
 
@@ -77,6 +103,23 @@ class module_map {
         create_tree(nodes);
     }
 
+    /**
+     * @brief Construct a module map on top of existing nodes and values.
+     *
+     * The map does not copy, or take ownership of, the nodes and values. They
+     * must stay valid for the lifetime of the map. This allows using a map
+     * laid out in (shared) memory mapped from a file, see @c nodes() and
+     * @c values().
+     *
+     * @param[in] nodes The nodes of the binary search tree.
+     * @param[in] values The values that the nodes point to.
+     */
+    module_map(vecmem::data::vector_view<const module_map_node> nodes,
+               vecmem::data::vector_view<const V> values)
+        : m_external(true),
+          m_external_nodes(nodes),
+          m_external_values(values) {}
+
     /**
      * @brief Find a given key in the map.
      *
@@ -116,8 +159,8 @@ class module_map {
     std::size_t size(void) const {
         std::size_t c = 0;
 
-        for (const module_map_node& n : m_nodes) {
-            c += n.size;
+        for (std::size_t j = 0; j < n_nodes(); ++j) {
+            c += node_data()[j].size;
         }
 
         return c;
@@ -125,29 +168,51 @@ class module_map {
 
     bool contains(const K& i) const { return at_helper(i, 0) != nullptr; }
 
-    bool empty(void) const { return m_nodes.empty(); }
+    bool empty(void) const { return n_nodes() == 0; }
 
-    private:
     /**
-     * @brief The internal representation of nodes in our binary search tree.
+     * @brief Call a function for every key-value pair in the map.
      *
-     * These objects carry three pieces of data. Firstly, there is the starting
-     * ID. Then, there is the size. Since the node represents a stretch of
-     * consecutive IDs, we know that the node ends at `start + size`. Finally,
-     * there is the index in the value array. We keep indices instead of
-     * pointers to make it easier to port this code to other devices.
+     * The pairs are visited in the memory order of the tree, not in the order
+     * of the keys.
+     *
+     * @param[in] f The function to call with every key and value.
      */
-    struct module_map_node {
-        module_map_node() = default;
+    template <typename F>
+    void for_each(F&& f) const {
+        for (std::size_t k = 0; k < n_nodes(); ++k) {
+            const module_map_node& n = node_data()[k];
+            for (std::size_t j = 0; j < n.size; ++j) {
+                f(static_cast<K>(n.start + j), value_data()[n.index + j]);
+            }
+        }
+    }
 
-        module_map_node(K s, std::size_t n, std::size_t i)
-            : start(s), size(n), index(i) {}
+    /**
+     * @brief Get a view of the nodes of the binary search tree.
+     *
+     * Together with @c values(), this allows storing the map in a flat
+     * form, which can be used again without any conversion.
+     */
+    vecmem::data::vector_view<const module_map_node> nodes(void) const {
+        using size_type = typename vecmem::data::vector_view<
+            const module_map_node>::size_type;
+        return {static_cast<size_type>(n_nodes()), node_data()};
+    }
 
-        K start = 0;
-        std::size_t size = 0;
-        std::size_t index = 0;
-    };
+    /**
+     * @brief Get a view of the values that the nodes point to.
+     */
+    vecmem::data::vector_view<const V> values(void) const {
+        using size_type =
+            typename vecmem::data::vector_view<const V>::size_type;
+        if (m_external) {
+            return m_external_values;
+        }
+        return {static_cast<size_type>(m_values.size()), m_values.data()};
+    }
 
+    private:
     /**
      * @brief Lay out a set of nodes in a binary tree format.
      *
@@ -335,14 +400,14 @@ class module_map {
         /*
          * For memory safety, if we are out of bounds we will exit.
          */
-        if (n >= m_nodes.size()) {
+        if (n >= n_nodes()) {
             return nullptr;
         }
 
         /*
          * Retrieve the current root node.
          */
-        const module_map_node& node = m_nodes[n];
+        const module_map_node& node = node_data()[n];
 
         /*
          * If the size is zero, it is essentially an invalid node (i.e. the
@@ -368,7 +433,7 @@ class module_map {
                  * Found it! Return a pointer to the value within the
                  * contiguous range.
                  */
-                return &m_values[node.index + (i - node.start)];
+                return &value_data()[node.index + (i - node.start)];
             } else {
                 /*
                  * Two possibilties remain, we need to check the right subtree.
@@ -400,5 +465,41 @@ class module_map {
      * keep indices in this array instead of pointers.
      */
     std::vector<V> m_values;
+
+    /**
+     * @brief The number of nodes, owned or external.
+     */
+    std::size_t n_nodes(void) const {
+        return m_external ? m_external_nodes.size() : m_nodes.size();
+    }
+
+    /**
+     * @brief The nodes of the tree, owned or external.
+     */
+    const module_map_node* node_data(void) const {
+        return m_external ? m_external_nodes.ptr() : m_nodes.data();
+    }
+
+    /**
+     * @brief The values of the map, owned or external.
+     */
+    const V* value_data(void) const {
+        return m_external ? m_external_values.ptr() : m_values.data();
+    }
+
+    /**
+     * @brief Whether the nodes and values are held in external memory.
+     */
+    bool m_external = false;
+
+    /**
+     * @brief The nodes of the tree, if they are in external memory.
+     */
+    vecmem::data::vector_view<const module_map_node> m_external_nodes;
+
+    /**
+     * @brief The values of the map, if they are in external memory.
+     */
+    vecmem::data::vector_view<const V> m_external_values;
 };
 }  // namespace traccc
@@ -0,0 +1,93 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s).
+#include "traccc/edm/cell.hpp"
+
+// VecMem include(s).
+#include <vecmem/memory/memory_resource.hpp>
+
+// System include(s).
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+namespace traccc {
+
+/// Table of the detector modules, shared by the cells of many events
+///
+/// The cells read for an event link to a module collection of that event
+/// alone, which needs to be processed (and uploaded to a device) together
+/// with the cells. Once the cells of an event are re-linked to this table,
+/// the same module collection serves all events.
+///
+class module_table {
+
+    public:
+    /// Constructor with a memory resource
+    explicit module_table(vecmem::memory_resource* mr = nullptr)
+        : m_modules(mr) {}
+
+    /// Re-link the cells of an event to the modules of the table
+    ///
+    /// The modules of the event that are not in the table yet, are added to
+    /// it. The cells of every module are kept together, in their original
+    /// order, with the modules ordered by their index in the table. (As the
+    /// clusterization algorithms expect.)
+    ///
+    /// @param cells The cells of the event, linking to @c modules
+    /// @param modules The modules of the event
+    ///
+    void relink(cell_collection_types::host& cells,
+                const cell_module_collection_types::host& modules) {
+
+        // Find (or add) the table index of every module of the event.
+        std::vector<unsigned int> index(modules.size());
+        for (std::size_t i = 0; i < modules.size(); ++i) {
+            const auto it = m_index.find(modules[i].surface_link.value());
+            if (it != m_index.end()) {
+                index[i] = it->second;
+            } else {
+                index[i] = static_cast<unsigned int>(m_modules.size());
+                m_index.emplace(modules[i].surface_link.value(), index[i]);
+                m_modules.push_back(modules[i]);
+            }
+        }
+
+        // Re-link the cells, ordering them by (table) module index with a
+        // stable sort. The cells of every module are contiguous in the
+        // input, so this only reorders whole modules.
+        for (cell& c : cells) {
+            c.module_link = index.at(c.module_link);
+        }
+        std::stable_sort(cells.begin(), cells.end(),
+                         [](const cell& c1, const cell& c2) {
+                             return c1.module_link < c2.module_link;
+                         });
+    }
+
+    /// The modules of the table
+    const cell_module_collection_types::host& modules() const {
+        return m_modules;
+    }
+
+    /// The number of modules in the table
+    std::size_t size() const { return m_modules.size(); }
+
+    private:
+    /// The modules of the table
+    cell_module_collection_types::host m_modules;
+    /// The index of every module in the table, by surface identifier
+    std::unordered_map<std::uint64_t, unsigned int> m_index;
+
+};  // class module_table
+
+}  // namespace traccc
@@ -1,6 +1,6 @@
 /** TRACCC library, part of the ACTS project (R&D line)
  *
- * (c) 2021-2022 CERN for the benefit of the ACTS project
+ * (c) 2021-2024 CERN for the benefit of the ACTS project
  *
  * Mozilla Public License Version 2.0
  */
@@ -24,6 +24,10 @@ struct pixel_data {
     scalar pitch_x = 1.;
     scalar pitch_y = 1.;
 
+    /// The number of dimensions of the segmentation. 1 for strip modules,
+    /// whose cells all share the same @c channel1 value.
+    unsigned char dimensions = 2;
+
     TRACCC_HOST_DEVICE
     vector2 get_pitch() const { return {pitch_x, pitch_y}; };
 };
@@ -0,0 +1,110 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s).
+#include "traccc/definitions/primitives.hpp"
+
+// Detray include(s).
+#include "detray/geometry/surface.hpp"
+
+// System include(s).
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <tuple>
+#include <unordered_set>
+#include <vector>
+
+namespace traccc {
+
+/// Get the layer of a surface from its Acts geometry identifier
+///
+/// @param source The Acts geometry identifier of the surface
+/// @return The layer field of the identifier
+///
+inline unsigned int acts_layer_id(std::uint64_t source) {
+    return static_cast<unsigned int>((source >> 36) & 0xfffu);
+}
+
+/// The position of a surface in the navigation locality order
+struct surface_locality_key {
+    /// The index of the volume of the surface
+    unsigned int volume;
+    /// The (Acts) layer of the surface
+    unsigned int layer;
+    /// The azimuth of the center of the surface
+    scalar phi;
+    /// The longitudinal position of the center of the surface
+    scalar z;
+    /// The current index of the surface in the detector
+    unsigned int index;
+
+    /// Order the surfaces by volume, layer, azimuth and position
+    bool operator<(const surface_locality_key& other) const {
+        return std::tie(volume, layer, phi, z, index) <
+               std::tie(other.volume, other.layer, other.phi, other.z,
+                        other.index);
+    }
+};
+
+/// Get the locality keys of the surfaces of a detector, in locality order
+///
+/// Surfaces that follow each other in this order are close to each other
+/// along typical (outgoing) track trajectories. Within a layer, they go
+/// around in azimuth, and along the layer for the same azimuth.
+///
+/// @param det The detector
+/// @return The keys of all surfaces of the detector, in locality order
+///
+template <typename detector_t>
+std::vector<surface_locality_key> surface_locality_order(
+    const detector_t& det) {
+
+    const typename detector_t::geometry_context ctx{};
+
+    std::vector<surface_locality_key> keys;
+    keys.reserve(det.surfaces().size());
+    for (const auto& sf_desc : det.surfaces()) {
+        const detray::surface<detector_t> sf{det, sf_desc.barcode()};
+        const auto center = sf.transform(ctx).translation();
+        keys.push_back({static_cast<unsigned int>(sf_desc.barcode().volume()),
+                        acts_layer_id(sf_desc.source),
+                        static_cast<scalar>(std::atan2(center[1], center[0])),
+                        static_cast<scalar>(center[2]),
+                        static_cast<unsigned int>(sf_desc.barcode().index())});
+    }
+    std::sort(keys.begin(), keys.end());
+    return keys;
+}
+
+/// Count the cache lines touched by visiting some elements of a store
+///
+/// @param indices The indices of the visited elements
+/// @param element_size The size of the elements of the store, in bytes
+/// @param line_size The size of a cache line, in bytes
+/// @return The number of distinct cache lines holding the visited elements
+///
+inline std::size_t count_cache_lines(const std::vector<unsigned int>& indices,
+                                     std::size_t element_size,
+                                     std::size_t line_size = 64) {
+
+    std::unordered_set<std::size_t> lines;
+    for (const unsigned int index : indices) {
+        const std::size_t begin = index * element_size;
+        const std::size_t end = begin + element_size;
+        for (std::size_t line = begin / line_size;
+             line < (end + line_size - 1) / line_size; ++line) {
+            lines.insert(line);
+        }
+    }
+    return lines.size();
+}
+
+}  // namespace traccc
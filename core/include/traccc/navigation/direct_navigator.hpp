@@ -0,0 +1,297 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s).
+#include "traccc/definitions/primitives.hpp"
+#include "traccc/definitions/qualifiers.hpp"
+
+// detray include(s).
+#include "detray/definitions/indexing.hpp"
+#include "detray/definitions/units.hpp"
+#include "detray/geometry/barcode.hpp"
+#include "detray/geometry/surface.hpp"
+#include "detray/navigation/intersection/intersection.hpp"
+#include "detray/navigation/navigator.hpp"
+
+namespace traccc {
+
+/// Navigator visiting a known sequence of surfaces, in order
+///
+/// Once a track has been fitted, the surfaces that it crosses are known from
+/// its track states. Refitting it does not need to look for the surfaces in
+/// the volumes of the detector again. This navigator only ever intersects the
+/// next surface of the sequence, with no candidate search, no sorting of the
+/// intersections, and no candidate buffer.
+///
+/// It can be used with the detray propagator and actors in place of
+/// @c detray::navigator. The sequence needs to be set (with
+/// @c state::set_sequence) after the propagation state is created. Note that
+/// only the material of the surfaces in the sequence is applied to the
+/// tracks.
+///
+/// @tparam detector_t The detector type
+/// @tparam sequence_t The type of the sequence of surfaces, a vector of
+///                    elements with a @c surface_link() barcode (like the
+///                    track states of a track)
+///
+template <typename detector_t, typename sequence_t>
+class direct_navigator {
+
+    public:
+    /// @name Type(s) expected by the propagator from a navigator
+    /// @{
+
+    /// Detector type
+    using detector_type = detector_t;
+    /// Transform3 type
+    using transform3_type = typename detector_t::transform3;
+    /// Scalar type
+    using scalar_type = typename transform3_type::scalar_type;
+    /// Vector type
+    template <typename T>
+    using vector_type = typename detector_t::template vector_type<T>;
+    /// Intersection type
+    using intersection_type =
+        detray::intersection2D<typename detector_t::surface_type,
+                               transform3_type>;
+
+    /// @}
+
+    /// The distance within which a track is considered to be on a surface
+    static constexpr scalar_type on_surface_tolerance =
+        1.f * detray::unit<scalar_type>::um;
+
+    /// The status of the navigation
+    enum class status {
+        towards_surface,
+        on_surface,
+        complete,
+        aborted
+    };
+
+    /// State of the navigation of one track
+    class state {
+
+        friend class direct_navigator;
+
+        public:
+        /// Constructor with the detector
+        ///
+        /// Any further arguments (like the candidate buffer of the detray
+        /// navigator) are ignored.
+        ///
+        template <typename... args_t>
+        TRACCC_HOST_DEVICE explicit state(const detector_type& det,
+                                          args_t&&...)
+            : m_detector(&det) {}
+
+        /// Set the sequence of surfaces to visit
+        ///
+        /// @param sequence The surfaces, which need to outlive the navigation
+        ///
+        TRACCC_HOST_DEVICE
+        void set_sequence(const sequence_t& sequence) {
+            m_sequence = &sequence;
+            m_next = 0u;
+        }
+
+        /// The distance to the next surface
+        TRACCC_HOST_DEVICE
+        scalar_type operator()() const { return m_target.path; }
+
+        /// The detector being navigated
+        TRACCC_HOST_DEVICE
+        const detector_type& detector() const { return *m_detector; }
+
+        /// The current volume
+        TRACCC_HOST_DEVICE
+        detray::dindex volume() const { return m_volume; }
+
+        /// Set the current volume
+        TRACCC_HOST_DEVICE
+        void set_volume(detray::dindex v) { m_volume = v; }
+
+        /// The intersection with the current (or next) surface
+        TRACCC_HOST_DEVICE
+        const intersection_type* current() const { return &m_target; }
+
+        /// The barcode of the current (or next) surface
+        TRACCC_HOST_DEVICE
+        detray::geometry::barcode barcode() const {
+            return m_target.sf_desc.barcode();
+        }
+
+        /// The current (or next) surface
+        TRACCC_HOST_DEVICE
+        detray::surface<detector_type> get_surface() const {
+            return detray::surface<detector_type>{*m_detector, barcode()};
+        }
+
+        /// The number of surfaces left to visit
+        TRACCC_HOST_DEVICE
+        unsigned int n_candidates() const {
+            return (m_sequence == nullptr)
+                       ? 0u
+                       : static_cast<unsigned int>(m_sequence->size()) - m_next;
+        }
+
+        /// Whether all surfaces of the sequence were reached
+        TRACCC_HOST_DEVICE
+        bool is_exhausted() const { return (n_candidates() == 0u); }
+
+        /// Whether the track is on a surface of the sequence
+        TRACCC_HOST_DEVICE
+        bool is_on_module() const { return (m_status == status::on_surface); }
+
+        /// Whether the track is on a sensitive surface of the sequence
+        TRACCC_HOST_DEVICE
+        bool is_on_sensitive() const {
+            return is_on_module() && get_surface().is_sensitive();
+        }
+
+        /// Whether the track is on a portal (never, for this navigator)
+        TRACCC_HOST_DEVICE
+        bool is_on_portal() const { return false; }
+
+        /// Whether the track is on a surface that may have material
+        ///
+        /// All surfaces of the sequence are handed to the material
+        /// interactor, which skips the ones without material itself.
+        ///
+        TRACCC_HOST_DEVICE
+        bool encountered_sf_material() const { return is_on_module(); }
+
+        /// The status of the navigation
+        TRACCC_HOST_DEVICE
+        status get_status() const { return m_status; }
+
+        /// Whether the navigation visited all surfaces of the sequence
+        TRACCC_HOST_DEVICE
+        bool is_complete() const { return (m_status == status::complete); }
+
+        /// The direction of the navigation
+        TRACCC_HOST_DEVICE
+        detray::navigation::direction direction() const { return m_direction; }
+
+        /// Set the direction of the navigation
+        TRACCC_HOST_DEVICE
+        void set_direction(detray::navigation::direction dir) {
+            m_direction = dir;
+        }
+
+        /// The trust level of the current intersection
+        TRACCC_HOST_DEVICE
+        detray::navigation::trust_level trust_level() const {
+            return m_trust_level;
+        }
+
+        /// @name Lower the trust level of the current intersection
+        /// @{
+        TRACCC_HOST_DEVICE
+        void set_full_trust() {
+            m_trust_level = detray::navigation::trust_level::e_full;
+        }
+        TRACCC_HOST_DEVICE
+        void set_high_trust() {
+            lower_trust(detray::navigation::trust_level::e_high);
+        }
+        TRACCC_HOST_DEVICE
+        void set_fair_trust() {
+            lower_trust(detray::navigation::trust_level::e_fair);
+        }
+        TRACCC_HOST_DEVICE
+        void set_no_trust() {
+            lower_trust(detray::navigation::trust_level::e_no_trust);
+        }
+        /// @}
+
+        /// Abort the navigation
+        ///
+        /// @return @c false, to stop the propagation
+        ///
+        TRACCC_HOST_DEVICE
+        bool abort() {
+            m_status = status::aborted;
+            set_full_trust();
+            return false;
+        }
+
+        /// Finish the navigation
+        ///
+        /// @return @c false, to stop the propagation
+        ///
+        TRACCC_HOST_DEVICE
+        bool exit() {
+            m_status = status::complete;
+            set_full_trust();
+            return false;
+        }
+
+        private:
+        /// Lower the trust level to (at most) a given level
+        TRACCC_HOST_DEVICE
+        void lower_trust(detray::navigation::trust_level level) {
+            if (static_cast<int>(level) < static_cast<int>(m_trust_level)) {
+                m_trust_level = level;
+            }
+        }
+
+        /// The detector being navigated
+        const detector_type* m_detector;
+        /// The sequence of surfaces to visit
+        const sequence_t* m_sequence = nullptr;
+        /// The index of the next surface to reach in the sequence
+        unsigned int m_next = 0u;
+        /// The intersection with the current (or next) surface
+        intersection_type m_target{};
+        /// The current volume
+        detray::dindex m_volume = 0u;
+        /// The status of the navigation
+        status m_status = status::towards_surface;
+        /// The direction of the navigation
+        detray::navigation::direction m_direction =
+            detray::navigation::direction::e_forward;
+        /// The trust level of the current intersection
+        detray::navigation::trust_level m_trust_level =
+            detray::navigation::trust_level::e_no_trust;
+
+    };  // class state
+
+    /// Start the navigation, aiming at the first surface of the sequence
+    ///
+    /// @param propagation The state of the propagation
+    /// @return Whether the propagation can go on
+    ///
+    template <typename propagator_state_t>
+    TRACCC_HOST_DEVICE bool init(propagator_state_t& propagation) const;
+
+    /// Update the navigation after a step (or after the actors)
+    ///
+    /// Re-intersects the next surface whenever the trust level of the current
+    /// intersection dropped, and moves on to the next surface of the
+    /// sequence once the track is on the current one.
+    ///
+    /// @param propagation The state of the propagation
+    /// @return Whether the propagation can go on
+    ///
+    template <typename propagator_state_t>
+    TRACCC_HOST_DEVICE bool update(propagator_state_t& propagation) const;
+
+    private:
+    /// Intersect the next surface of the sequence, from the current position
+    /// of the track
+    template <typename propagator_state_t>
+    TRACCC_HOST_DEVICE void update_target(
+        propagator_state_t& propagation) const;
+
+};  // class direct_navigator
+
+}  // namespace traccc
+
+#include "traccc/navigation/direct_navigator.ipp"
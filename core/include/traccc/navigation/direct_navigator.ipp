@@ -0,0 +1,98 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// detray include(s).
+#include "detray/navigation/detail/ray.hpp"
+#include "detray/navigation/intersection/ray_intersector.hpp"
+#include "detray/navigation/intersection_kernel.hpp"
+
+// System include(s).
+#include <cmath>
+
+namespace traccc {
+
+template <typename detector_t, typename sequence_t>
+template <typename propagator_state_t>
+TRACCC_HOST_DEVICE bool direct_navigator<detector_t, sequence_t>::init(
+    propagator_state_t& propagation) const {
+
+    auto& navigation = propagation._navigation;
+
+    // There is nothing to do without surfaces to visit.
+    if (navigation.is_exhausted()) {
+        return navigation.abort();
+    }
+
+    navigation.m_next = 0u;
+    navigation.m_status = status::towards_surface;
+    update_target(propagation);
+    return true;
+}
+
+template <typename detector_t, typename sequence_t>
+template <typename propagator_state_t>
+TRACCC_HOST_DEVICE bool direct_navigator<detector_t, sequence_t>::update(
+    propagator_state_t& propagation) const {
+
+    auto& navigation = propagation._navigation;
+
+    // Stop once the navigation is over.
+    if ((navigation.m_status == status::complete) ||
+        (navigation.m_status == status::aborted)) {
+        return false;
+    }
+
+    // Nothing changed since the last update.
+    if (navigation.m_trust_level == detray::navigation::trust_level::e_full) {
+        return true;
+    }
+
+    // Leave the surface that the track is on, finishing the navigation on
+    // the last one of the sequence.
+    if ((navigation.m_status == status::on_surface) &&
+        navigation.is_exhausted()) {
+        return navigation.exit();
+    }
+
+    update_target(propagation);
+    return true;
+}
+
+template <typename detector_t, typename sequence_t>
+template <typename propagator_state_t>
+TRACCC_HOST_DEVICE void direct_navigator<detector_t, sequence_t>::update_target(
+    propagator_state_t& propagation) const {
+
+    auto& navigation = propagation._navigation;
+    const detector_type& det = *(navigation.m_detector);
+
+    // Intersect the next surface of the sequence
+    const detray::geometry::barcode bcd =
+        (*(navigation.m_sequence))[navigation.m_next].surface_link();
+    const detray::surface<detector_type> sf{det, bcd};
+    intersection_type sfi;
+    sfi.sf_desc = det.surface(bcd);
+    sf.template visit_mask<
+        detray::intersection_update<detray::ray_intersector>>(
+        detray::detail::ray<transform3_type>(propagation._stepping().vector()),
+        sfi, det.transform_store());
+    navigation.m_target = sfi;
+
+    // Check whether the track reached the surface
+    if (std::abs(sfi.path) < on_surface_tolerance) {
+        navigation.m_status = status::on_surface;
+        navigation.m_volume = bcd.volume();
+        ++(navigation.m_next);
+    } else {
+        navigation.m_status = status::towards_surface;
+    }
+    navigation.set_full_trust();
+}
+
+}  // namespace traccc
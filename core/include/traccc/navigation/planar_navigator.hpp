@@ -0,0 +1,174 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s).
+#include "traccc/definitions/primitives.hpp"
+#include "traccc/definitions/track_parametrization.hpp"
+#include "traccc/edm/track_parameters.hpp"
+#include "traccc/edm/track_state.hpp"
+
+// detray include(s).
+#include "detray/geometry/barcode.hpp"
+#include "detray/navigation/intersection/intersection.hpp"
+#include "detray/propagator/actors/pointwise_material_interactor.hpp"
+
+// VecMem include(s).
+#include <vecmem/containers/vector.hpp>
+
+// System include(s).
+#include <cstddef>
+#include <limits>
+#include <type_traits>
+#include <vector>
+
+namespace traccc {
+
+/// Navigator for detectors made of parallel planes, in a known order along
+/// the beam axis
+///
+/// Telescope and other beam-test like detectors do not need the generic
+/// navigation of detray, intersecting and sorting all the surfaces of a
+/// volume for every track. Their planes are ordered along the beam axis once,
+/// when this object is created, and the tracks are transported from one
+/// plane to the next one of this fixed-order walk, with an analytic helix
+/// transport between the planes.
+///
+/// Using this type as the navigator of @c traccc::kalman_fitter and
+/// @c traccc::finding_algorithm selects their fast path, which uses this
+/// walk instead of the detray propagator. The magnetic field is evaluated
+/// once per transport, at the starting point, so it should be homogeneous
+/// between neighbouring planes. The time is transported with the speed of
+/// light.
+///
+/// Only the (non-portal) surfaces parallel to the first surface of the
+/// detector are part of the walk, and their local coordinates have to be
+/// cartesian. For host use only.
+///
+/// @tparam detector_t The (host) detector type
+///
+template <typename detector_t>
+class planar_navigator {
+
+    public:
+    /// @name Type(s) expected by the algorithms from a navigator
+    /// @{
+
+    /// Detector type
+    using detector_type = detector_t;
+    /// Transform3 type
+    using transform3_type = typename detector_t::transform3;
+    /// Scalar type
+    using scalar_type = typename transform3_type::scalar_type;
+    /// Vector type used by the fitter
+    template <typename T>
+    using vector_type = vecmem::vector<T>;
+    /// Intersection type
+    using intersection_type =
+        detray::intersection2D<typename detector_t::surface_type,
+                               transform3_type>;
+
+    /// @}
+
+    /// Transport jacobian type
+    using bound_matrix = typename track_state<transform3_type>::bound_matrix;
+
+    /// Index of the surfaces not part of the walk
+    static constexpr std::size_t npos = std::numeric_limits<std::size_t>::max();
+
+    /// Constructor, ordering the planes of a detector
+    ///
+    /// @param det The detector, which has to outlive this object
+    ///
+    explicit planar_navigator(const detector_t& det);
+
+    /// The number of planes in the walk
+    std::size_t size() const;
+
+    /// The position of a surface in the walk
+    ///
+    /// @param bcd The barcode of the surface
+    /// @return The position of the surface along the beam axis, or @c npos
+    ///         for the surfaces not part of the walk
+    ///
+    std::size_t position(detray::geometry::barcode bcd) const;
+
+    /// Whether a plane of the walk is sensitive
+    bool is_sensitive(detray::geometry::barcode bcd) const;
+
+    /// Transport track parameters to the next plane that the track crosses
+    ///
+    /// @param params The parameters on a plane of the walk, transported to
+    ///               the next plane in the direction of the track
+    /// @param field The (view of the) magnetic field, as used by the steppers
+    /// @param jacobian The transport jacobian of the bound parameters
+    /// @return Whether a next plane was reached
+    ///
+    template <typename bfield_t>
+    bool step(bound_track_parameters& params, const bfield_t& field,
+              bound_matrix& jacobian) const;
+
+    /// Apply the material interaction of the plane that some parameters are
+    /// on, the same way as @c detray::pointwise_material_interactor does
+    void interact(bound_track_parameters& params) const;
+
+    private:
+    /// Description of one plane of the walk
+    struct plane {
+        /// The surface of the plane
+        detray::geometry::barcode barcode;
+        /// Whether the surface is sensitive
+        bool sensitive;
+        /// The center of the plane
+        point3 center;
+        /// The local axes of the plane (the third one is its normal)
+        vector3 axes[3];
+    };
+
+    /// Helix transport from a free parameter vector to a plane
+    ///
+    /// @param free_vec The free parameters to start from
+    /// @param bfield The magnetic field vector
+    /// @param pl The plane to transport to
+    /// @param out_vec The free parameters on the plane
+    /// @param free_jacobian The free transport jacobian, with the path
+    ///                      correction onto the plane applied
+    /// @return Whether the plane was reached in front of the track
+    ///
+    template <typename free_matrix_t>
+    bool transport(const free_vector& free_vec, const vector3& bfield,
+                   const plane& pl, free_vector& out_vec,
+                   free_matrix_t& free_jacobian) const;
+
+    /// The material interactor type
+    using interactor_type =
+        detray::pointwise_material_interactor<transform3_type>;
+
+    /// The detector
+    const detector_t* m_detector;
+    /// The planes, ordered along the beam axis
+    std::vector<plane> m_planes;
+    /// The position of every surface of the detector in the walk
+    std::vector<std::size_t> m_positions;
+
+};  // class planar_navigator
+
+/// Trait telling whether a navigator type is a @c traccc::planar_navigator
+template <typename navigator_t>
+struct is_planar_navigator : std::false_type {};
+
+template <typename detector_t>
+struct is_planar_navigator<planar_navigator<detector_t>> : std::true_type {};
+
+template <typename navigator_t>
+inline constexpr bool is_planar_navigator_v =
+    is_planar_navigator<navigator_t>::value;
+
+}  // namespace traccc
+
+#include "traccc/navigation/planar_navigator.ipp"
@@ -0,0 +1,383 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s).
+#include "traccc/fitting/kalman_filter/covariance_kernels.hpp"
+
+// detray include(s).
+#include "detray/definitions/units.hpp"
+#include "detray/geometry/surface.hpp"
+#include "detray/navigation/detail/ray.hpp"
+#include "detray/navigation/intersection/ray_intersector.hpp"
+#include "detray/navigation/intersection_kernel.hpp"
+#include "detray/navigation/navigator.hpp"
+
+// System include(s).
+#include <algorithm>
+#include <cmath>
+
+namespace traccc {
+
+template <typename detector_t>
+planar_navigator<detector_t>::planar_navigator(const detector_t& det)
+    : m_detector(&det), m_positions(det.surfaces().size(), npos) {
+
+    const typename detector_t::geometry_context ctx{};
+
+    // Collect the planes parallel to the first one
+    for (const auto& sf_desc : det.surfaces()) {
+
+        const detray::surface<detector_t> sf{det, sf_desc.barcode()};
+        if (sf.is_portal()) {
+            continue;
+        }
+
+        const transform3_type trf = sf.transform(ctx);
+        const plane pl{sf.barcode(),
+                       sf.is_sensitive(),
+                       trf.point_to_global(point3{0.f, 0.f, 0.f}),
+                       {trf.vector_to_global(vector3{1.f, 0.f, 0.f}),
+                        trf.vector_to_global(vector3{0.f, 1.f, 0.f}),
+                        trf.vector_to_global(vector3{0.f, 0.f, 1.f})}};
+
+        static constexpr scalar_type parallel_tolerance = 1e-4f;
+        if (!m_planes.empty() &&
+            (std::abs(vector::dot(pl.axes[2], m_planes.front().axes[2])) <
+             1.f - parallel_tolerance)) {
+            continue;
+        }
+        m_planes.push_back(pl);
+    }
+
+    // Order them along their normal
+    if (!m_planes.empty()) {
+        const vector3 axis = m_planes.front().axes[2];
+        std::sort(m_planes.begin(), m_planes.end(),
+                  [&axis](const plane& a, const plane& b) {
+                      return vector::dot(a.center, axis) <
+                             vector::dot(b.center, axis);
+                  });
+    }
+    for (std::size_t i = 0; i < m_planes.size(); ++i) {
+        m_positions[m_planes[i].barcode.index()] = i;
+    }
+}
+
+template <typename detector_t>
+std::size_t planar_navigator<detector_t>::size() const {
+
+    return m_planes.size();
+}
+
+template <typename detector_t>
+std::size_t planar_navigator<detector_t>::position(
+    detray::geometry::barcode bcd) const {
+
+    return (bcd.index() < m_positions.size()) ? m_positions[bcd.index()]
+                                              : npos;
+}
+
+template <typename detector_t>
+bool planar_navigator<detector_t>::is_sensitive(
+    detray::geometry::barcode bcd) const {
+
+    const std::size_t pos = position(bcd);
+    return (pos != npos) && m_planes[pos].sensitive;
+}
+
+template <typename detector_t>
+template <typename bfield_t>
+bool planar_navigator<detector_t>::step(bound_track_parameters& params,
+                                        const bfield_t& field,
+                                        bound_matrix& jacobian) const {
+
+    using matrix_operator =
+        typename track_state<transform3_type>::matrix_operator;
+    using free_matrix = typename matrix_operator::template matrix_type<
+        e_free_size, e_free_size>;
+
+    const std::size_t pos = position(params.surface_link());
+    if (pos == npos) {
+        return false;
+    }
+    const plane& start = m_planes[pos];
+
+    const typename detector_t::geometry_context ctx{};
+    const detray::surface<detector_t> sf{*m_detector, params.surface_link()};
+    const free_vector free_vec = sf.bound_to_free_vector(ctx, params.vector());
+
+    // The magnetic field at the starting point
+    const auto bvec = field.at(getter::element(free_vec, e_free_pos0, 0u),
+                               getter::element(free_vec, e_free_pos1, 0u),
+                               getter::element(free_vec, e_free_pos2, 0u));
+    const vector3 bfield{bvec[0], bvec[1], bvec[2]};
+
+    // Walk the planes in the direction of the track, until one of them is
+    // crossed (within its boundaries)
+    const vector3 dir{getter::element(free_vec, e_free_dir0, 0u),
+                      getter::element(free_vec, e_free_dir1, 0u),
+                      getter::element(free_vec, e_free_dir2, 0u)};
+    const bool forward = vector::dot(dir, m_planes.front().axes[2]) >= 0.f;
+
+    for (std::size_t next = (forward ? pos + 1 : pos - 1);
+         next < m_planes.size(); next = (forward ? next + 1 : next - 1)) {
+
+        const plane& pl = m_planes[next];
+        free_vector out_vec;
+        free_matrix free_jacobian;
+        if (!transport(free_vec, bfield, pl, out_vec, free_jacobian)) {
+            continue;
+        }
+
+        const detray::surface<detector_t> next_sf{*m_detector, pl.barcode};
+        intersection_type sfi;
+        sfi.sf_desc = m_detector->surface(pl.barcode);
+        next_sf.template visit_mask<
+            detray::intersection_update<detray::ray_intersector>>(
+            detray::detail::ray<transform3_type>(out_vec), sfi,
+            m_detector->transform_store());
+        if (sfi.status != detray::intersection::status::e_inside) {
+            continue;
+        }
+
+        // Bound-to-free jacobian on the starting plane
+        const bound_vector& in_vec = params.vector();
+        const scalar_type in_phi = getter::element(in_vec, e_bound_phi, 0u);
+        const scalar_type in_theta =
+            getter::element(in_vec, e_bound_theta, 0u);
+        auto bound_to_free = matrix_operator().template zero<e_free_size,
+                                                             e_bound_size>();
+        for (unsigned int i = 0u; i < 3u; ++i) {
+            getter::element(bound_to_free, e_free_pos0 + i, e_bound_loc0) =
+                start.axes[0][i];
+            getter::element(bound_to_free, e_free_pos0 + i, e_bound_loc1) =
+                start.axes[1][i];
+        }
+        getter::element(bound_to_free, e_free_time, e_bound_time) = 1.f;
+        getter::element(bound_to_free, e_free_dir0, e_bound_phi) =
+            -std::sin(in_theta) * std::sin(in_phi);
+        getter::element(bound_to_free, e_free_dir1, e_bound_phi) =
+            std::sin(in_theta) * std::cos(in_phi);
+        getter::element(bound_to_free, e_free_dir0, e_bound_theta) =
+            std::cos(in_theta) * std::cos(in_phi);
+        getter::element(bound_to_free, e_free_dir1, e_bound_theta) =
+            std::cos(in_theta) * std::sin(in_phi);
+        getter::element(bound_to_free, e_free_dir2, e_bound_theta) =
+            -std::sin(in_theta);
+        getter::element(bound_to_free, e_free_qoverp, e_bound_qoverp) = 1.f;
+
+        // Free-to-bound jacobian on the reached plane
+        const bound_vector out_bound =
+            next_sf.free_to_bound_vector(ctx, out_vec);
+        const scalar_type out_phi =
+            getter::element(out_bound, e_bound_phi, 0u);
+        const scalar_type out_theta =
+            getter::element(out_bound, e_bound_theta, 0u);
+        const scalar_type inv_sin_theta = 1.f / std::sin(out_theta);
+        auto free_to_bound = matrix_operator().template zero<e_bound_size,
+                                                             e_free_size>();
+        for (unsigned int i = 0u; i < 3u; ++i) {
+            getter::element(free_to_bound, e_bound_loc0, e_free_pos0 + i) =
+                pl.axes[0][i];
+            getter::element(free_to_bound, e_bound_loc1, e_free_pos0 + i) =
+                pl.axes[1][i];
+        }
+        getter::element(free_to_bound, e_bound_time, e_free_time) = 1.f;
+        getter::element(free_to_bound, e_bound_phi, e_free_dir0) =
+            -std::sin(out_phi) * inv_sin_theta;
+        getter::element(free_to_bound, e_bound_phi, e_free_dir1) =
+            std::cos(out_phi) * inv_sin_theta;
+        getter::element(free_to_bound, e_bound_theta, e_free_dir0) =
+            std::cos(out_phi) * std::cos(out_theta);
+        getter::element(free_to_bound, e_bound_theta, e_free_dir1) =
+            std::sin(out_phi) * std::cos(out_theta);
+        getter::element(free_to_bound, e_bound_theta, e_free_dir2) =
+            -std::sin(out_theta);
+        getter::element(free_to_bound, e_bound_qoverp, e_free_qoverp) = 1.f;
+
+        jacobian = free_to_bound * free_jacobian * bound_to_free;
+        params = bound_track_parameters(
+            pl.barcode, out_bound,
+            covariance_kernels<transform3_type>::template sandwich<
+                e_bound_size, e_bound_size>(jacobian, params.covariance()));
+        return true;
+    }
+
+    return false;
+}
+
+template <typename detector_t>
+void planar_navigator<detector_t>::interact(
+    bound_track_parameters& params) const {
+
+    const typename detector_t::geometry_context ctx{};
+    const detray::surface<detector_t> sf{*m_detector, params.surface_link()};
+    if (!sf.has_material()) {
+        return;
+    }
+    const free_vector free_vec = sf.bound_to_free_vector(ctx, params.vector());
+
+    // Get the incidence angle on the plane
+    intersection_type sfi;
+    sfi.sf_desc = m_detector->surface(params.surface_link());
+    sf.template visit_mask<
+        detray::intersection_update<detray::ray_intersector>>(
+        detray::detail::ray<transform3_type>(free_vec), sfi,
+        m_detector->transform_store());
+
+    typename interactor_type::state interactor_state;
+    interactor_type{}.update(
+        params, interactor_state,
+        static_cast<int>(detray::navigation::direction::e_forward), sf,
+        sfi.cos_incidence_angle);
+}
+
+template <typename detector_t>
+template <typename free_matrix_t>
+bool planar_navigator<detector_t>::transport(
+    const free_vector& free_vec, const vector3& bfield, const plane& pl,
+    free_vector& out_vec, free_matrix_t& free_jacobian) const {
+
+    using matrix_operator =
+        typename track_state<transform3_type>::matrix_operator;
+
+    static constexpr scalar_type speed_of_light =
+        299.792458f * detray::unit<scalar_type>::mm /
+        detray::unit<scalar_type>::ns;
+    static constexpr unsigned int max_iterations = 20u;
+    static constexpr scalar_type path_tolerance =
+        0.1f * detray::unit<scalar_type>::um;
+
+    const point3 pos0{getter::element(free_vec, e_free_pos0, 0u),
+                      getter::element(free_vec, e_free_pos1, 0u),
+                      getter::element(free_vec, e_free_pos2, 0u)};
+    const vector3 dir0{getter::element(free_vec, e_free_dir0, 0u),
+                       getter::element(free_vec, e_free_dir1, 0u),
+                       getter::element(free_vec, e_free_dir2, 0u)};
+    const scalar_type qop = getter::element(free_vec, e_free_qoverp, 0u);
+
+    // Decompose the direction along, and perpendicular to, the field. With
+    // d(dir)/ds = qop * (dir x B), the direction rotates around the field
+    // direction h with the angular frequency omega = qop * |B|.
+    const scalar_type b = getter::norm(bfield);
+    const vector3 h = (b > 0.f) ? (1.f / b) * bfield : vector3{0.f, 0.f, 0.f};
+    const scalar_type omega = qop * b;
+    const scalar_type along = vector::dot(dir0, h);
+    const vector3 dir_perp = dir0 - along * h;
+    const vector3 dir_cross = vector::cross(dir0, h);
+
+    // sin(omega * s) / omega and (1 - cos(omega * s)) / omega
+    auto s1 = [omega](scalar_type s) {
+        return (omega == 0.f) ? s : std::sin(omega * s) / omega;
+    };
+    auto s2 = [omega](scalar_type s) {
+        const scalar_type half = std::sin(0.5f * omega * s);
+        return (omega == 0.f) ? 0.f : 2.f * half * half / omega;
+    };
+    auto position_at = [&](scalar_type s) {
+        return pos0 + (along * s) * h + s1(s) * dir_perp + s2(s) * dir_cross;
+    };
+    auto direction_at = [&](scalar_type s) {
+        return along * h + std::cos(omega * s) * dir_perp +
+               std::sin(omega * s) * dir_cross;
+    };
+
+    // Intersect the helix with the plane, starting from the straight line
+    // intersection
+    const vector3& normal = pl.axes[2];
+    const scalar_type normal_dir = vector::dot(normal, dir0);
+    if (normal_dir == 0.f) {
+        return false;
+    }
+    scalar_type s = vector::dot(normal, pl.center - pos0) / normal_dir;
+    bool converged = false;
+    for (unsigned int i = 0u; i < max_iterations; ++i) {
+        const scalar_type df = vector::dot(normal, direction_at(s));
+        if (df == 0.f) {
+            return false;
+        }
+        const scalar_type ds =
+            vector::dot(normal, position_at(s) - pl.center) / df;
+        s -= ds;
+        if (std::abs(ds) < path_tolerance) {
+            converged = true;
+            break;
+        }
+    }
+    if (!converged || !(s > 0.f)) {
+        return false;
+    }
+
+    // The free parameters on the plane
+    const point3 pos = position_at(s);
+    const vector3 dir = vector::normalize(direction_at(s));
+    out_vec = free_vec;
+    for (unsigned int i = 0u; i < 3u; ++i) {
+        getter::element(out_vec, e_free_pos0 + i, 0u) = pos[i];
+        getter::element(out_vec, e_free_dir0 + i, 0u) = dir[i];
+    }
+    getter::element(out_vec, e_free_time, 0u) += s / speed_of_light;
+
+    // The free transport jacobian for a fixed path length
+    const scalar_type c = std::cos(omega * s);
+    const scalar_type sn = std::sin(omega * s);
+    const scalar_type omega_s = omega * s;
+    // The derivatives of s1 and s2 with respect to omega
+    scalar_type ds1 = 0.f;
+    scalar_type ds2 = 0.5f * s * s;
+    if (std::abs(omega_s) > 1e-3f) {
+        ds1 = (omega_s * c - sn) / (omega * omega);
+        ds2 = (omega_s * sn - (1.f - c)) / (omega * omega);
+    }
+    // The matrix of the cross product with h
+    const scalar_type cross_h[3][3] = {
+        {0.f, -h[2], h[1]}, {h[2], 0.f, -h[0]}, {-h[1], h[0], 0.f}};
+
+    auto transport_jacobian =
+        matrix_operator().template identity<e_free_size, e_free_size>();
+    for (unsigned int i = 0u; i < 3u; ++i) {
+        for (unsigned int j = 0u; j < 3u; ++j) {
+            const scalar_type hh = h[i] * h[j];
+            const scalar_type id = (i == j) ? 1.f : 0.f;
+            getter::element(transport_jacobian, e_free_pos0 + i,
+                            e_free_dir0 + j) =
+                s * hh + s1(s) * (id - hh) - s2(s) * cross_h[i][j];
+            getter::element(transport_jacobian, e_free_dir0 + i,
+                            e_free_dir0 + j) =
+                hh + c * (id - hh) - sn * cross_h[i][j];
+        }
+        getter::element(transport_jacobian, e_free_pos0 + i, e_free_qoverp) =
+            b * (ds1 * dir_perp[i] + ds2 * dir_cross[i]);
+        getter::element(transport_jacobian, e_free_dir0 + i, e_free_qoverp) =
+            b * s * (-sn * dir_perp[i] + c * dir_cross[i]);
+    }
+
+    // Correct for the path length changing with the starting parameters, to
+    // stay on the plane
+    const vector3 ddir_ds = omega * vector::cross(dir, h);
+    const scalar_type normal_out = vector::dot(normal, dir);
+    auto path_correction =
+        matrix_operator().template identity<e_free_size, e_free_size>();
+    for (unsigned int j = 0u; j < 3u; ++j) {
+        const scalar_type ds_dpos = -normal[j] / normal_out;
+        for (unsigned int i = 0u; i < 3u; ++i) {
+            getter::element(path_correction, e_free_pos0 + i,
+                            e_free_pos0 + j) += dir[i] * ds_dpos;
+            getter::element(path_correction, e_free_dir0 + i,
+                            e_free_pos0 + j) += ddir_ds[i] * ds_dpos;
+        }
+        getter::element(path_correction, e_free_time, e_free_pos0 + j) +=
+            ds_dpos / speed_of_light;
+    }
+
+    free_jacobian = path_correction * transport_jacobian;
+    return true;
+}
+
+}  // namespace traccc
@@ -0,0 +1,141 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s).
+#include "traccc/definitions/common.hpp"
+#include "traccc/definitions/primitives.hpp"
+#include "traccc/definitions/qualifiers.hpp"
+
+// System include(s).
+#include <cmath>
+
+namespace traccc {
+
+/// Interval of the radius and Z coordinate of a compressed grid spacepoint
+struct rz_interval {
+    scalar r_lo;
+    scalar r_hi;
+    scalar z_lo;
+    scalar z_hi;
+};
+
+/// Helper for the compressed (16-bit) radius and Z coordinates of the
+/// spacepoints in the seeding grid
+///
+/// The radius of a spacepoint is stored relative to the smallest radius of
+/// its grid bin, and its Z coordinate relative to the lower boundary of its Z
+/// bin. Both are packed into one 32-bit word, so the doublet finding can
+/// reject most of its candidates while reading half as many bytes per
+/// spacepoint.
+///
+/// The coordinates are rounded down when compressed, and decompressed into
+/// intervals that are guaranteed to hold the full precision values. Values
+/// not fitting into 16 bits saturate, and give (practically) unbounded
+/// intervals.
+///
+struct compressed_rz_helper {
+
+    /// The resolution of the compressed radii
+    static constexpr scalar r_step = 0.02f * unit<scalar>::mm;
+    /// The largest value of one compressed coordinate
+    static constexpr unsigned int max_value = 0xFFFFu;
+    /// The bound used for the saturated coordinates
+    static constexpr scalar unbounded = 1e5f * unit<scalar>::m;
+
+    /// Compress the coordinates of one spacepoint
+    ///
+    /// @param r The radius of the spacepoint
+    /// @param z The Z coordinate of the spacepoint
+    /// @param r_base The smallest radius in the grid bin of the spacepoint
+    /// @param z_base The lower boundary of the Z bin of the spacepoint
+    /// @param z_step The resolution of the compressed Z coordinates
+    ///
+    /// @return The compressed coordinates
+    ///
+    TRACCC_HOST_DEVICE
+    static inline unsigned int compress(scalar r, scalar z, scalar r_base,
+                                        scalar z_base, scalar z_step) {
+        return (quantize(r - r_base, r_step) << 16) |
+               quantize(z - z_base, z_step);
+    }
+
+    /// Decompress the coordinates of one spacepoint
+    ///
+    /// @param rz The compressed coordinates
+    /// @param r_base The smallest radius in the grid bin of the spacepoint
+    /// @param z_base The lower boundary of the Z bin of the spacepoint
+    /// @param z_step The resolution of the compressed Z coordinates
+    ///
+    /// @return The intervals holding the coordinates of the spacepoint
+    ///
+    TRACCC_HOST_DEVICE
+    static inline rz_interval decompress(unsigned int rz, scalar r_base,
+                                         scalar z_base, scalar z_step) {
+        rz_interval result;
+        interval(rz >> 16, r_base, r_step, result.r_lo, result.r_hi);
+        interval(rz & max_value, z_base, z_step, result.z_lo, result.z_hi);
+        return result;
+    }
+
+    private:
+    /// Quantize one (relative) coordinate, rounding down and saturating
+    TRACCC_HOST_DEVICE
+    static inline unsigned int quantize(scalar value, scalar step) {
+        const scalar q = std::floor(value / step);
+        if (!(q > 0.f)) {
+            return 0u;
+        }
+        if (q >= static_cast<scalar>(max_value)) {
+            return max_value;
+        }
+        return static_cast<unsigned int>(q);
+    }
+
+    /// The interval of one quantized coordinate
+    ///
+    /// The interval is widened by half a step on both sides, to be safe from
+    /// the rounding of the compression.
+    ///
+    TRACCC_HOST_DEVICE
+    static inline void interval(unsigned int q, scalar base, scalar step,
+                                scalar& lo, scalar& hi) {
+        lo = (q == 0u) ? -unbounded
+                       : base + (static_cast<scalar>(q) - 0.5f) * step;
+        hi = (q == max_value)
+                 ? unbounded
+                 : base + (static_cast<scalar>(q) + 1.5f) * step;
+    }
+
+};  // struct compressed_rz_helper
+
+/// The reference values of the compressed coordinates in one grid bin
+struct compressed_rz_bin {
+
+    /// The smallest radius in the bin
+    scalar r_base;
+    /// The lower boundary of the Z bin
+    scalar z_base;
+    /// The resolution of the compressed Z coordinates
+    scalar z_step;
+
+    /// Compress the coordinates of a spacepoint of the bin
+    TRACCC_HOST_DEVICE
+    unsigned int compress(scalar r, scalar z) const {
+        return compressed_rz_helper::compress(r, z, r_base, z_base, z_step);
+    }
+
+    /// Decompress the coordinates of a spacepoint of the bin
+    TRACCC_HOST_DEVICE
+    rz_interval decompress(unsigned int rz) const {
+        return compressed_rz_helper::decompress(rz, r_base, z_base, z_step);
+    }
+
+};  // struct compressed_rz_bin
+
+}  // namespace traccc
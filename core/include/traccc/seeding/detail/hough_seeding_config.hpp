@@ -0,0 +1,103 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s).
+#include "traccc/definitions/common.hpp"
+#include "traccc/definitions/primitives.hpp"
+#include "traccc/definitions/qualifiers.hpp"
+#include "traccc/seeding/detail/seeding_config.hpp"
+
+namespace traccc {
+
+/// Configuration of the Hough transform seeding
+///
+/// The spacepoints are filled into one (q/pT, phi0) accumulator per slice in
+/// (z0, cot(theta)), for the tracks coming from the collision region. Cells
+/// of the accumulators that collect spacepoints from enough distinct
+/// (radial) layers, and are local maxima of their neighbourhood, are turned
+/// into seeds.
+///
+struct hough_seeding_config {
+
+    /// Default constructor
+    hough_seeding_config() = default;
+
+    /// Construction with the acceptance of an existing seed finding
+    /// configuration
+    explicit hough_seeding_config(const seedfinder_config& finder_config)
+        : rMin(finder_config.rMin),
+          rMax(finder_config.rMax),
+          collisionRegionMin(finder_config.collisionRegionMin),
+          collisionRegionMax(finder_config.collisionRegionMax),
+          cotThetaMax(finder_config.cotThetaMax),
+          minPt(finder_config.minPt),
+          bFieldInZ(finder_config.bFieldInZ),
+          beamPos(finder_config.beamPos) {}
+
+    /// @name Acceptance of the seeds
+    /// @{
+
+    /// The smallest radius of the spacepoints to use
+    scalar rMin = 33 * unit<scalar>::mm;
+    /// The largest radius of the spacepoints to use
+    scalar rMax = 200 * unit<scalar>::mm;
+    /// The lower end of the collision region in z
+    scalar collisionRegionMin = -250 * unit<scalar>::mm;
+    /// The upper end of the collision region in z
+    scalar collisionRegionMax = +250 * unit<scalar>::mm;
+    /// The largest |cot(theta)| of the seeds
+    scalar cotThetaMax = 7.40627;
+    /// The smallest transverse momentum of the seeds
+    scalar minPt = 500. * unit<scalar>::MeV;
+    /// The magnetic field along the z axis
+    scalar bFieldInZ = 1.99724 * unit<scalar>::T;
+    /// The position of the beam in the transverse plane
+    vector2 beamPos{-.0 * unit<scalar>::mm, -.0 * unit<scalar>::mm};
+
+    /// @}
+
+    /// @name Binning of the accumulators
+    /// @{
+
+    /// The number of bins in q/pT
+    unsigned int n_qopt_bins = 32u;
+    /// The number of bins in phi0
+    unsigned int n_phi_bins = 512u;
+    /// The number of slices of the collision region in z0
+    unsigned int n_z_slices = 16u;
+    /// The number of slices in cot(theta), per z0 slice
+    unsigned int n_cot_slices = 64u;
+
+    /// @}
+
+    /// @name Selection of the accumulator cells
+    /// @{
+
+    /// The radial width of the layers that the spacepoints are counted in
+    scalar layerWidth = 20 * unit<scalar>::mm;
+    /// The smallest number of distinct layers of a seed cell
+    unsigned int minLayers = 3u;
+    /// The largest distance in z of the middle spacepoint of a seed from the
+    /// line between its bottom and top spacepoints
+    scalar maxMiddleDeltaZ = 5 * unit<scalar>::mm;
+
+    /// @}
+
+    /// The total number of (z0, cot(theta)) slices
+    TRACCC_HOST_DEVICE
+    unsigned int n_slices() const { return n_z_slices * n_cot_slices; }
+
+    /// The total number of accumulator cells
+    TRACCC_HOST_DEVICE
+    unsigned int n_cells() const {
+        return n_slices() * n_qopt_bins * n_phi_bins;
+    }
+};
+
+}  // namespace traccc
@@ -0,0 +1,70 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// System include(s).
+#include <algorithm>
+#include <cmath>
+
+namespace traccc {
+
+/// Capacities for running the device seed finding without host
+/// synchronisation
+///
+/// By default the device seed finding copies the number of doublets and
+/// triplets back to the host after counting them, to allocate exactly sized
+/// buffers for them. When the factors of this struct are set, the buffers are
+/// instead allocated with capacities that are proportional to the number of
+/// spacepoints in the event, and the whole doublet -> triplet -> seed chain is
+/// queued without waiting for the device. If an event turns out not to fit
+/// into these capacities, its seed finding is re-done in the exact mode.
+///
+/// In adaptive mode the capacities are instead learnt from the previously
+/// processed events, with @c traccc::capacity_predictor. The factors, if
+/// set, are only used until the first event was processed. (The adaptive
+/// mode is implemented by the CUDA seed finding only.)
+///
+struct seed_finding_capacities {
+
+    /// The maximal number of middle-bottom doublets per spacepoint
+    float mid_bot_doublets_per_spacepoint = 0.f;
+    /// The maximal number of middle-top doublets per spacepoint
+    float mid_top_doublets_per_spacepoint = 0.f;
+    /// The maximal number of triplets per spacepoint
+    float triplets_per_spacepoint = 0.f;
+
+    /// Whether to learn the capacities from the previous events
+    bool adaptive = false;
+    /// The number of previous events to learn the capacities from
+    unsigned int adaptive_history = 16;
+    /// The safety margin on the largest per-spacepoint counts seen in the
+    /// previous events
+    float adaptive_margin = 1.2f;
+
+    /// Whether the bounded-capacity mode is to be used with fixed factors
+    bool enabled() const {
+        return (mid_bot_doublets_per_spacepoint > 0.f) &&
+               (mid_top_doublets_per_spacepoint > 0.f) &&
+               (triplets_per_spacepoint > 0.f);
+    }
+
+    /// Calculate a capacity for a given number of spacepoints
+    ///
+    /// @param factor          One of the per-spacepoint factors
+    /// @param num_spacepoints The number of spacepoints in the event
+    /// @return The (non-zero) capacity to allocate
+    ///
+    static unsigned int capacity(float factor, unsigned int num_spacepoints) {
+        const float capacity =
+            std::ceil(factor * static_cast<float>(num_spacepoints));
+        return std::max(1u, static_cast<unsigned int>(capacity));
+    }
+
+};  // struct seed_finding_capacities
+
+}  // namespace traccc
@@ -1,6 +1,6 @@
 /** TRACCC library, part of the ACTS project (R&D line)
  *
- * (c) 2021-2022 CERN for the benefit of the ACTS project
+ * (c) 2021-2024 CERN for the benefit of the ACTS project
  *
  * Mozilla Public License Version 2.0
  */
@@ -12,6 +12,9 @@
 #include "traccc/definitions/primitives.hpp"
 #include "traccc/definitions/qualifiers.hpp"
 
+// System include(s).
+#include <vector>
+
 namespace traccc {
 
 struct seedfinder_config {
@@ -107,6 +110,12 @@ struct seedfinder_config {
 
     darray<unsigned int, 2> neighbor_scope{1, 1};
 
+    // Use the compressed (16-bit) coordinates of the grid spacepoints to
+    // reject the doublet candidates in the device doublet finding, reading
+    // the full precision coordinates only for the candidates passing this
+    // pre-selection. Does not change the found doublets.
+    bool useCompressedGrid = false;
+
     TRACCC_HOST_DEVICE
     size_t get_num_rbins() const {
         return static_cast<size_t>(rMax + getter::norm(beamPos));
@@ -184,6 +193,13 @@ struct spacepoint_grid_config {
     // configured to return 1 neighbor on either side of the current phi-bin
     // (and you want to cover the full phi-range of minPT), leave this at 1.
     int phiBinDeflectionCoverage = 1;
+    // Explicit Z bin edges, e.g. equal-occupancy ones from
+    // traccc::adaptive_z_bin_edges, replacing the regular Z bins of the grid
+    // (if not empty)
+    std::vector<scalar> zBinEdges;
+    // Derive equal-occupancy Z bin edges from the spacepoints of every event
+    // (only in the host spacepoint binning)
+    bool adaptiveZBinsPerEvent = false;
 };
 
 struct seedfilter_config {
@@ -222,4 +238,53 @@ struct seedfilter_config {
     scalar spB_min_radius = 43. * unit<scalar>::mm;
 };
 
+// configuration of the extension of triplet seeds into longer seeds, with
+// spacepoints further out along the seeds' helices
+struct seed_extension_config {
+    // the maximum number of spacepoints of the extended seeds. At most the
+    // capacity of traccc::extended_seed, and 3 turns the extension off.
+    unsigned int max_seed_size = 3;
+    // the minimum number of spacepoints of the extended seeds that are kept.
+    // With the default of 3, the extension does not remove any seeds.
+    unsigned int min_seed_size = 3;
+    // minimum distance in r between the outermost spacepoint of a seed and
+    // the spacepoint extending it
+    scalar deltaRMin = 5. * unit<scalar>::mm;
+    // maximum distance in r between the outermost spacepoint of a seed and
+    // the spacepoint extending it
+    scalar deltaRMax = 160. * unit<scalar>::mm;
+    // maximum distance in z between the seed's straight line in r-z and the
+    // extending spacepoint
+    scalar max_z_residual = 5. * unit<scalar>::mm;
+    // maximum distance in the transverse plane between the seed's circle and
+    // the extending spacepoint
+    scalar max_xy_residual = 1. * unit<scalar>::mm;
+};
+
+// configuration of the selection of the seeds handed to the track finding,
+// which removes near-duplicate seeds, and caps the number of seeds in every
+// (eta, phi) region
+struct seed_selection_config {
+    // whether to run the selection at all
+    bool enabled = false;
+    // the minimum number of spacepoints shared by two seeds for them to be
+    // considered duplicates (with compatible parameters)
+    unsigned int min_shared_spacepoints = 2;
+    // the maximum differences between the parameters of duplicate seeds
+    scalar max_delta_phi = 0.01f;
+    scalar max_delta_theta = 0.01f;
+    // the maximum relative difference between the q/p of duplicate seeds
+    scalar max_rel_delta_qop = 0.1f;
+    // with seeds sharing spacepoints, the number of neighbouring candidates
+    // checked by every seed, per pair of spacepoints
+    unsigned int max_duplicate_candidates = 32;
+    // the binning of the regions used for capping the number of seeds
+    unsigned int n_eta_bins = 32;
+    unsigned int n_phi_bins = 64;
+    scalar eta_range = 4.f;
+    // the maximum number of seeds (with the highest weights) kept in every
+    // region. 0 turns the cap off.
+    unsigned int max_seeds_per_region = 0;
+};
+
 }  // namespace traccc
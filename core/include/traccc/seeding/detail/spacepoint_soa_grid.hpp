@@ -0,0 +1,511 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s).
+#include "traccc/definitions/primitives.hpp"
+#include "traccc/definitions/qualifiers.hpp"
+#include "traccc/edm/details/soa_types.hpp"
+#include "traccc/edm/internal_spacepoint.hpp"
+#include "traccc/edm/spacepoint.hpp"
+#include "traccc/seeding/detail/compressed_rz.hpp"
+#include "traccc/seeding/detail/singlet.hpp"
+#include "traccc/seeding/detail/spacepoint_grid.hpp"
+#include "traccc/seeding/detail/spacepoint_z_axis.hpp"
+
+// VecMem include(s).
+#include <vecmem/containers/data/vector_buffer.hpp>
+#include <vecmem/containers/data/vector_view.hpp>
+#include <vecmem/containers/device_vector.hpp>
+#include <vecmem/containers/vector.hpp>
+#include <vecmem/memory/memory_resource.hpp>
+#include <vecmem/utils/copy.hpp>
+
+// System include(s).
+#include <cassert>
+#include <type_traits>
+
+namespace traccc {
+
+/// @name Phi-Z spacepoint grid with flat, structure-of-arrays storage
+///
+/// The seeding spacepoints of all bins of the grid live in one set of arrays,
+/// ordered by bin, and inside of every bin by radius. The spacepoints of bin
+/// @c b are found at the indices <tt>[bin_offsets[b], bin_offsets[b+1])</tt>.
+///
+/// So the doublet finding can scan a neighbouring bin reading only the radii
+/// and Z coordinates of its spacepoints, and can stop at the first spacepoint
+/// that is too far away in radius. Spacepoint locations
+/// (@c traccc::sp_location) keep referring to a bin and to an index inside of
+/// that bin.
+///
+/// The grid also holds the compressed (16-bit) radii and Z coordinates of its
+/// spacepoints, filled with @c traccc::compress_grid_bin once the bins are
+/// sorted. See @c traccc::compressed_rz_helper.
+///
+/// @{
+
+/// Type of the phi axis of the grid
+using sp_soa_grid_axis_p0_type = sp_grid::axis_p0_type;
+/// Type of the Z axis of the grid
+using sp_soa_grid_axis_p1_type = sp_grid_z_axis;
+
+namespace details {
+
+/// Accessors shared by the host and device types of the grid
+///
+/// @tparam derived_t The grid type providing the arrays and the axes
+///
+template <typename derived_t>
+struct sp_soa_grid_accessors {
+
+    /// The number of bins of the grid
+    TRACCC_HOST_DEVICE unsigned int nbins() const {
+        return static_cast<unsigned int>(self().bin_offsets.size()) - 1u;
+    }
+
+    /// The global index of the bin at some phi and Z bin indices
+    TRACCC_HOST_DEVICE unsigned int bin_index(unsigned int phi_bin,
+                                              unsigned int z_bin) const {
+        return phi_bin +
+               z_bin * static_cast<unsigned int>(self().phi_axis.bins());
+    }
+
+    /// The index of the first spacepoint of a bin
+    TRACCC_HOST_DEVICE unsigned int bin_begin(unsigned int bin) const {
+        return self().bin_offsets[bin];
+    }
+
+    /// The index after the last spacepoint of a bin
+    TRACCC_HOST_DEVICE unsigned int bin_end(unsigned int bin) const {
+        return self().bin_offsets[bin + 1];
+    }
+
+    /// The number of spacepoints in a bin
+    TRACCC_HOST_DEVICE unsigned int bin_size(unsigned int bin) const {
+        return bin_end(bin) - bin_begin(bin);
+    }
+
+    /// Find the bin holding the spacepoint at some (flat) index
+    TRACCC_HOST_DEVICE unsigned int bin_of(unsigned int index) const {
+        // Binary search for the last bin starting at or before the index.
+        unsigned int low = 0, high = nbins();
+        while (high - low > 1) {
+            const unsigned int mid = low + (high - low) / 2;
+            if (bin_begin(mid) <= index) {
+                low = mid;
+            } else {
+                high = mid;
+            }
+        }
+        return low;
+    }
+
+    /// The (flat) index of the spacepoint at some location
+    TRACCC_HOST_DEVICE unsigned int index(const sp_location& loc) const {
+        assert(loc.sp_idx < bin_size(loc.bin_idx));
+        return bin_begin(loc.bin_idx) + loc.sp_idx;
+    }
+
+    /// The location of the spacepoint at some (flat) index
+    TRACCC_HOST_DEVICE sp_location location(unsigned int index) const {
+        const unsigned int bin = bin_of(index);
+        return {bin, index - bin_begin(bin)};
+    }
+
+    /// Get one spacepoint of the grid
+    ///
+    /// Only use this when all coordinates of the spacepoint are needed.
+    /// Reading the individual arrays directly results in better memory access
+    /// patterns.
+    ///
+    TRACCC_HOST_DEVICE internal_spacepoint<spacepoint> at(
+        unsigned int index) const {
+        internal_spacepoint<spacepoint> result;
+        result.m_link = self().link[index];
+        result.m_x = self().x[index];
+        result.m_y = self().y[index];
+        result.m_z = self().z[index];
+        result.m_r = self().radius[index];
+        result.m_phi = self().phi[index];
+        return result;
+    }
+
+    /// Get the spacepoint at some location of the grid
+    TRACCC_HOST_DEVICE internal_spacepoint<spacepoint> at(
+        const sp_location& loc) const {
+        return at(index(loc));
+    }
+
+    /// The reference values of the compressed coordinates in a bin
+    ///
+    /// Only meaningful once the bin is sorted by radius.
+    ///
+    /// @param bin The global index of the bin
+    ///
+    TRACCC_HOST_DEVICE compressed_rz_bin
+    compressed_bin(unsigned int bin) const {
+        const unsigned int z_bin =
+            bin / static_cast<unsigned int>(self().phi_axis.bins());
+        const scalar z_lower = self().z_axis.lower(z_bin);
+        const scalar z_width = self().z_axis.upper(z_bin) - z_lower;
+        return {(bin_size(bin) > 0) ? self().radius[bin_begin(bin)] : 0.f,
+                z_lower,
+                z_width / static_cast<scalar>(compressed_rz_helper::max_value)};
+    }
+
+    /// The phi axis of the grid
+    TRACCC_HOST_DEVICE const sp_soa_grid_axis_p0_type& axis_p0() const {
+        return self().phi_axis;
+    }
+
+    /// The Z axis of the grid
+    TRACCC_HOST_DEVICE const sp_soa_grid_axis_p1_type& axis_p1() const {
+        return self().z_axis;
+    }
+
+    private:
+    /// Access the derived grid type
+    TRACCC_HOST_DEVICE const derived_t& self() const {
+        return static_cast<const derived_t&>(*this);
+    }
+
+};  // struct sp_soa_grid_accessors
+
+}  // namespace details
+
+/// Host spacepoint grid, in SoA layout
+struct sp_soa_grid_host
+    : public details::sp_soa_grid_accessors<sp_soa_grid_host> {
+
+    /// Constructor with the axes and a memory resource
+    ///
+    /// Creates a grid without any spacepoints.
+    ///
+    sp_soa_grid_host(const sp_soa_grid_axis_p0_type& phi_ax,
+                     const sp_soa_grid_axis_p1_type& z_ax,
+                     vecmem::memory_resource& mr)
+        : phi_axis(phi_ax),
+          z_axis(z_ax),
+          x(&mr),
+          y(&mr),
+          z(&mr),
+          radius(&mr),
+          phi(&mr),
+          link(&mr),
+          rz(&mr),
+          bin_offsets(phi_ax.bins() * z_ax.bins() + 1, 0u, &mr) {}
+
+    /// The (total) number of spacepoints in the grid
+    std::size_t size() const { return x.size(); }
+
+    /// Resize all spacepoint arrays of the grid
+    void resize(std::size_t size) {
+        x.resize(size);
+        y.resize(size);
+        z.resize(size);
+        radius.resize(size);
+        phi.resize(size);
+        link.resize(size);
+        rz.resize(size);
+    }
+
+    /// Set one spacepoint of the grid
+    void set(std::size_t i, const internal_spacepoint<spacepoint>& sp) {
+        x[i] = sp.x();
+        y[i] = sp.y();
+        z[i] = sp.z();
+        radius[i] = sp.radius();
+        phi[i] = sp.phi();
+        link[i] = static_cast<unsigned int>(sp.m_link);
+    }
+
+    /// @name The axes of the grid
+    /// @{
+    sp_soa_grid_axis_p0_type phi_axis;
+    sp_soa_grid_axis_p1_type z_axis;
+    /// @}
+
+    /// @name The arrays of the spacepoints
+    /// @{
+    vecmem::vector<scalar> x;
+    vecmem::vector<scalar> y;
+    vecmem::vector<scalar> z;
+    vecmem::vector<scalar> radius;
+    vecmem::vector<scalar> phi;
+    vecmem::vector<unsigned int> link;
+    /// Compressed radii and Z coordinates
+    vecmem::vector<unsigned int> rz;
+    /// @}
+
+    /// The index of the first spacepoint of every bin, with the total number
+    /// of spacepoints as the last element
+    vecmem::vector<unsigned int> bin_offsets;
+
+};  // struct sp_soa_grid_host
+
+/// View of a spacepoint grid, in SoA layout
+template <bool CONST>
+struct sp_soa_grid_view {
+
+    /// Size type of the views
+    using size_type =
+        typename details::soa_vector_view<CONST, scalar>::size_type;
+
+    /// Constructor with the axes of the grid
+    TRACCC_HOST_DEVICE sp_soa_grid_view(const sp_soa_grid_axis_p0_type& phi_ax,
+                                        const sp_soa_grid_axis_p1_type& z_ax)
+        : phi_axis(phi_ax), z_axis(z_ax) {}
+
+    /// Constructor from a non-const view
+    template <bool OTHER_CONST,
+              std::enable_if_t<CONST && (!OTHER_CONST), bool> = true>
+    TRACCC_HOST_DEVICE sp_soa_grid_view(
+        const sp_soa_grid_view<OTHER_CONST>& parent)
+        : phi_axis(parent.phi_axis),
+          z_axis(parent.z_axis),
+          x(parent.x),
+          y(parent.y),
+          z(parent.z),
+          radius(parent.radius),
+          phi(parent.phi),
+          link(parent.link),
+          rz(parent.rz),
+          bin_offsets(parent.bin_offsets) {}
+
+    /// The (total) number of spacepoints in the grid
+    TRACCC_HOST_DEVICE size_type size() const { return x.size(); }
+
+    /// @name The axes of the grid
+    /// @{
+    sp_soa_grid_axis_p0_type phi_axis;
+    sp_soa_grid_axis_p1_type z_axis;
+    /// @}
+
+    /// @name Views of the arrays of the grid
+    /// @{
+    details::soa_vector_view<CONST, scalar> x;
+    details::soa_vector_view<CONST, scalar> y;
+    details::soa_vector_view<CONST, scalar> z;
+    details::soa_vector_view<CONST, scalar> radius;
+    details::soa_vector_view<CONST, scalar> phi;
+    details::soa_vector_view<CONST, unsigned int> link;
+    details::soa_vector_view<CONST, unsigned int> rz;
+    details::soa_vector_view<CONST, unsigned int> bin_offsets;
+    /// @}
+
+};  // struct sp_soa_grid_view
+
+/// Buffer for a spacepoint grid, in SoA layout
+struct sp_soa_grid_buffer {
+
+    /// Size type of the buffers
+    using size_type = sp_soa_grid_view<false>::size_type;
+
+    /// Constructor allocating the arrays of the grid
+    ///
+    /// @param phi_ax The phi axis of the grid
+    /// @param z_ax The Z axis of the grid
+    /// @param size The (total) number of spacepoints in the grid
+    /// @param mr The memory resource to allocate the arrays with
+    ///
+    sp_soa_grid_buffer(const sp_soa_grid_axis_p0_type& phi_ax,
+                       const sp_soa_grid_axis_p1_type& z_ax, size_type size,
+                       vecmem::memory_resource& mr)
+        : phi_axis(phi_ax),
+          z_axis(z_ax),
+          x(size, mr),
+          y(size, mr),
+          z(size, mr),
+          radius(size, mr),
+          phi(size, mr),
+          link(size, mr),
+          rz(size, mr),
+          bin_offsets(
+              static_cast<size_type>(phi_ax.bins() * z_ax.bins() + 1), mr) {}
+
+    /// The (total) number of spacepoints in the grid
+    size_type size() const { return x.size(); }
+
+    /// @name The axes of the grid
+    /// @{
+    sp_soa_grid_axis_p0_type phi_axis;
+    sp_soa_grid_axis_p1_type z_axis;
+    /// @}
+
+    /// @name Buffers of the arrays of the grid
+    /// @{
+    vecmem::data::vector_buffer<scalar> x;
+    vecmem::data::vector_buffer<scalar> y;
+    vecmem::data::vector_buffer<scalar> z;
+    vecmem::data::vector_buffer<scalar> radius;
+    vecmem::data::vector_buffer<scalar> phi;
+    vecmem::data::vector_buffer<unsigned int> link;
+    vecmem::data::vector_buffer<unsigned int> rz;
+    vecmem::data::vector_buffer<unsigned int> bin_offsets;
+    /// @}
+
+};  // struct sp_soa_grid_buffer
+
+/// Device spacepoint grid, in SoA layout
+template <bool CONST>
+struct sp_soa_grid_device
+    : public details::sp_soa_grid_accessors<sp_soa_grid_device<CONST>> {
+
+    /// Size type of the grid
+    using size_type = typename sp_soa_grid_view<CONST>::size_type;
+
+    /// Constructor from a view
+    TRACCC_HOST_DEVICE explicit sp_soa_grid_device(
+        const sp_soa_grid_view<CONST>& v)
+        : phi_axis(v.phi_axis),
+          z_axis(v.z_axis),
+          x(v.x),
+          y(v.y),
+          z(v.z),
+          radius(v.radius),
+          phi(v.phi),
+          link(v.link),
+          rz(v.rz),
+          bin_offsets(v.bin_offsets) {}
+
+    /// The (total) number of spacepoints in the grid
+    TRACCC_HOST_DEVICE size_type size() const { return x.size(); }
+
+    /// Set one spacepoint of the grid
+    template <bool C = CONST, std::enable_if_t<!C, bool> = true>
+    TRACCC_HOST_DEVICE void set(size_type i,
+                                const internal_spacepoint<spacepoint>& sp) {
+        x[i] = sp.x();
+        y[i] = sp.y();
+        z[i] = sp.z();
+        radius[i] = sp.radius();
+        phi[i] = sp.phi();
+        link[i] = static_cast<unsigned int>(sp.m_link);
+    }
+
+    /// @name The axes of the grid
+    /// @{
+    sp_soa_grid_axis_p0_type phi_axis;
+    sp_soa_grid_axis_p1_type z_axis;
+    /// @}
+
+    /// @name The arrays of the grid
+    /// @{
+    details::soa_device_vector<CONST, scalar> x;
+    details::soa_device_vector<CONST, scalar> y;
+    details::soa_device_vector<CONST, scalar> z;
+    details::soa_device_vector<CONST, scalar> radius;
+    details::soa_device_vector<CONST, scalar> phi;
+    details::soa_device_vector<CONST, unsigned int> link;
+    details::soa_device_vector<CONST, unsigned int> rz;
+    details::soa_device_vector<CONST, unsigned int> bin_offsets;
+    /// @}
+
+};  // struct sp_soa_grid_device
+
+/// Declare all SoA spacepoint grid types
+struct sp_soa_grid_types {
+    /// Host grid
+    using host = sp_soa_grid_host;
+    /// Non-const device grid
+    using device = sp_soa_grid_device<false>;
+    /// Constant device grid
+    using const_device = sp_soa_grid_device<true>;
+    /// Non-constant view
+    using view = sp_soa_grid_view<false>;
+    /// Constant view
+    using const_view = sp_soa_grid_view<true>;
+    /// Buffer
+    using buffer = sp_soa_grid_buffer;
+};
+
+/// Get a (non-const) view of a host SoA spacepoint grid
+inline sp_soa_grid_view<false> get_data(sp_soa_grid_host& grid) {
+    sp_soa_grid_view<false> result(grid.phi_axis, grid.z_axis);
+    result.x = vecmem::get_data(grid.x);
+    result.y = vecmem::get_data(grid.y);
+    result.z = vecmem::get_data(grid.z);
+    result.radius = vecmem::get_data(grid.radius);
+    result.phi = vecmem::get_data(grid.phi);
+    result.link = vecmem::get_data(grid.link);
+    result.rz = vecmem::get_data(grid.rz);
+    result.bin_offsets = vecmem::get_data(grid.bin_offsets);
+    return result;
+}
+
+/// Get a (const) view of a host SoA spacepoint grid
+inline sp_soa_grid_view<true> get_data(const sp_soa_grid_host& grid) {
+    sp_soa_grid_view<true> result(grid.phi_axis, grid.z_axis);
+    result.x = vecmem::get_data(grid.x);
+    result.y = vecmem::get_data(grid.y);
+    result.z = vecmem::get_data(grid.z);
+    result.radius = vecmem::get_data(grid.radius);
+    result.phi = vecmem::get_data(grid.phi);
+    result.link = vecmem::get_data(grid.link);
+    result.rz = vecmem::get_data(grid.rz);
+    result.bin_offsets = vecmem::get_data(grid.bin_offsets);
+    return result;
+}
+
+/// Get a (non-const) view of an SoA spacepoint grid buffer
+inline sp_soa_grid_view<false> get_data(sp_soa_grid_buffer& grid) {
+    sp_soa_grid_view<false> result(grid.phi_axis, grid.z_axis);
+    result.x = grid.x;
+    result.y = grid.y;
+    result.z = grid.z;
+    result.radius = grid.radius;
+    result.phi = grid.phi;
+    result.link = grid.link;
+    result.rz = grid.rz;
+    result.bin_offsets = grid.bin_offsets;
+    return result;
+}
+
+/// Fill the compressed coordinates of the spacepoints of one grid bin
+///
+/// Needs to be called after the spacepoints of the bin were sorted by
+/// radius.
+///
+/// @param grid The (host or non-const device) grid
+/// @param bin The bin to fill the compressed coordinates of
+///
+template <typename grid_t>
+TRACCC_HOST_DEVICE inline void compress_grid_bin(grid_t& grid,
+                                                 unsigned int bin) {
+
+    const compressed_rz_bin cbin = grid.compressed_bin(bin);
+    for (unsigned int i = grid.bin_begin(bin); i < grid.bin_end(bin); ++i) {
+        grid.rz[i] = cbin.compress(grid.radius[i], grid.z[i]);
+    }
+}
+
+/// Copy an SoA spacepoint grid between two views
+///
+/// @param copy_obj The copy object to use
+/// @param from The view to copy from
+/// @param to The view to copy into (with arrays of the same sizes)
+/// @param type The type of the copy, if known
+///
+inline void copy(vecmem::copy& copy_obj, const sp_soa_grid_view<true>& from,
+                 const sp_soa_grid_view<false>& to,
+                 vecmem::copy::type::copy_type type =
+                     vecmem::copy::type::unknown) {
+    copy_obj(from.x, to.x, type);
+    copy_obj(from.y, to.y, type);
+    copy_obj(from.z, to.z, type);
+    copy_obj(from.radius, to.radius, type);
+    copy_obj(from.phi, to.phi, type);
+    copy_obj(from.link, to.link, type);
+    copy_obj(from.rz, to.rz, type);
+    copy_obj(from.bin_offsets, to.bin_offsets, type);
+}
+
+/// @}
+
+}  // namespace traccc
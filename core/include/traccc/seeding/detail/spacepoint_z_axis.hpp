@@ -0,0 +1,141 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s).
+#include "traccc/definitions/primitives.hpp"
+#include "traccc/definitions/qualifiers.hpp"
+#include "traccc/seeding/detail/spacepoint_grid.hpp"
+
+// System include(s).
+#include <stdexcept>
+#include <vector>
+
+namespace traccc {
+
+/// Z axis of the seeding spacepoint grid
+///
+/// By default this is the regular axis of detray, with bins at least as wide
+/// as the largest Z distance of two spacepoints forming a doublet. It can also
+/// be given explicit (e.g. equal-occupancy) bin edges. The neighbourhood of
+/// a Z coordinate then covers the same Z distance as it would with the
+/// regular bins, no matter how wide the bins around it are. So the doublet
+/// finding finds the same doublets with either kind of bins.
+///
+struct sp_grid_z_axis : public sp_grid::axis_p1_type {
+
+    /// The regular axis type
+    using regular_type = sp_grid::axis_p1_type;
+
+    /// The largest number of explicit bins
+    static constexpr unsigned int max_bins = 64;
+
+    /// Construct an axis with regular bins
+    sp_grid_z_axis(const regular_type& regular)
+        : regular_type(regular), reach((regular.max - regular.min) /
+                                       static_cast<scalar>(regular.n_bins)) {}
+
+    /// Construct an axis with explicit bin edges
+    ///
+    /// The neighbourhoods of the axis cover the same Z distances as the ones
+    /// of the regular axis that the bins replace.
+    ///
+    /// @param regular The regular axis that the bins replace
+    /// @param bin_edges The (increasing) bin edges, with the lower edge of
+    ///                  the first and the upper edge of the last bin
+    ///
+    sp_grid_z_axis(const regular_type& regular,
+                   const std::vector<scalar>& bin_edges)
+        : sp_grid_z_axis(regular) {
+
+        if (bin_edges.size() < 2u || bin_edges.size() > max_bins + 1u) {
+            throw std::invalid_argument(
+                "Invalid number of Z bin edges for the spacepoint grid");
+        }
+        for (std::size_t i = 1u; i < bin_edges.size(); ++i) {
+            if (!(bin_edges[i] > bin_edges[i - 1u])) {
+                throw std::invalid_argument(
+                    "The Z bin edges of the spacepoint grid must increase");
+            }
+        }
+        n_edges = static_cast<unsigned int>(bin_edges.size());
+        for (unsigned int i = 0u; i < n_edges; ++i) {
+            edges[i] = bin_edges[i];
+        }
+        this->n_bins = n_edges - 1u;
+        this->min = edges[0];
+        this->max = edges[n_edges - 1u];
+    }
+
+    /// Whether the axis has explicit bin edges
+    TRACCC_HOST_DEVICE bool is_adaptive() const { return (n_edges > 0u); }
+
+    /// The bin of a Z coordinate, clamped to the axis
+    TRACCC_HOST_DEVICE detray::dindex bin(scalar z) const {
+
+        if (!is_adaptive()) {
+            return regular_type::bin(z);
+        }
+        // Binary search for the last bin starting at or before z.
+        unsigned int low = 0u, high = n_edges - 1u;
+        while (high - low > 1u) {
+            const unsigned int mid = low + (high - low) / 2u;
+            if (edges[mid] <= z) {
+                low = mid;
+            } else {
+                high = mid;
+            }
+        }
+        return low;
+    }
+
+    /// The (inclusive) range of bins in the neighbourhood of a Z coordinate
+    TRACCC_HOST_DEVICE detray::dindex_range range(
+        scalar z, const darray<unsigned int, 2>& nhood) const {
+
+        if (!is_adaptive()) {
+            return regular_type::range(z, nhood);
+        }
+        return {bin(z - static_cast<scalar>(nhood[0]) * reach),
+                bin(z + static_cast<scalar>(nhood[1]) * reach)};
+    }
+
+    /// The bins in the neighbourhood of a Z coordinate
+    std::vector<detray::dindex> zone(
+        scalar z, const darray<unsigned int, 2>& nhood) const {
+
+        const detray::dindex_range r = range(z, nhood);
+        std::vector<detray::dindex> result;
+        for (detray::dindex b = r[0]; b <= r[1]; ++b) {
+            result.push_back(b);
+        }
+        return result;
+    }
+
+    /// The lower edge of a bin
+    TRACCC_HOST_DEVICE scalar lower(detray::dindex b) const {
+        return is_adaptive() ? edges[b]
+                             : this->min + static_cast<scalar>(b) * reach;
+    }
+
+    /// The upper edge of a bin
+    TRACCC_HOST_DEVICE scalar upper(detray::dindex b) const {
+        return is_adaptive() ? edges[b + 1u]
+                             : this->min + static_cast<scalar>(b + 1u) * reach;
+    }
+
+    /// The Z distance covered by one step of the neighbourhood
+    scalar reach;
+    /// The number of explicit bin edges (0 for regular bins)
+    unsigned int n_edges = 0u;
+    /// The explicit bin edges
+    darray<scalar, max_bins + 1u> edges{};
+
+};  // struct sp_grid_z_axis
+
+}  // namespace traccc
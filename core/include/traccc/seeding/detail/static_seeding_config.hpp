@@ -0,0 +1,134 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s).
+#include "traccc/definitions/primitives.hpp"
+#include "traccc/definitions/qualifiers.hpp"
+#include "traccc/seeding/detail/seeding_config.hpp"
+
+namespace traccc {
+
+/// Seeding configuration values taken from the runtime configuration
+///
+/// The (device) seeding functions access the configuration values that
+/// drive their loop bounds and local arrays through a type like this one, so
+/// that they can be specialised for a @c traccc::static_seeding_config
+/// instead.
+///
+struct runtime_seeding_config {
+
+    /// Whether the values are known at compile time
+    static constexpr bool is_static = false;
+
+    /// The number of neighbouring grid bins looked at in phi and z
+    TRACCC_HOST_DEVICE
+    static darray<unsigned int, 2> neighbor_scope(
+        const seedfinder_config& config) {
+        return config.neighbor_scope;
+    }
+    /// The maximum number of triplets kept per middle spacepoint
+    TRACCC_HOST_DEVICE
+    static unsigned int max_triplets_per_spM(
+        const seedfilter_config& filter_config) {
+        return static_cast<unsigned int>(filter_config.max_triplets_per_spM);
+    }
+    /// The maximum number of seeds made from one middle spacepoint
+    TRACCC_HOST_DEVICE
+    static unsigned int max_seeds_per_spM(
+        const seedfilter_config& filter_config) {
+        return filter_config.maxSeedsPerSpM;
+    }
+    /// The maximum number of compatible seeds increasing the weight of a seed
+    TRACCC_HOST_DEVICE
+    static unsigned int compat_seed_limit(
+        const seedfilter_config& filter_config) {
+        return static_cast<unsigned int>(filter_config.compatSeedLimit);
+    }
+
+};  // struct runtime_seeding_config
+
+/// Seeding configuration values fixed at compile time
+///
+/// Specialising the seeding kernels for one of these lets the compiler unroll
+/// the loops over the neighbouring bins and over the kept triplets, and size
+/// the local arrays of the kernels exactly. It only applies to runtime
+/// configurations that it @c matches, with everything else still being
+/// taken from the runtime configuration.
+///
+/// @tparam SCOPE_LOW  Lower neighbour scope of the grid bins
+/// @tparam SCOPE_HIGH Upper neighbour scope of the grid bins
+/// @tparam MAX_TRIPLETS_PER_SPM Maximum number of triplets per middle
+///                              spacepoint
+/// @tparam MAX_SEEDS_PER_SPM    Maximum number of seeds per middle
+///                              spacepoint
+/// @tparam COMPAT_SEED_LIMIT    Maximum number of compatible seeds
+///
+template <unsigned int SCOPE_LOW, unsigned int SCOPE_HIGH,
+          unsigned int MAX_TRIPLETS_PER_SPM, unsigned int MAX_SEEDS_PER_SPM,
+          unsigned int COMPAT_SEED_LIMIT>
+struct static_seeding_config {
+
+    /// Whether the values are known at compile time
+    static constexpr bool is_static = true;
+
+    /// @name Compile-time values, e.g. for sizing arrays
+    /// @{
+    static constexpr unsigned int k_max_triplets_per_spM = MAX_TRIPLETS_PER_SPM;
+    static constexpr unsigned int k_compat_seed_limit = COMPAT_SEED_LIMIT;
+    /// @}
+
+    /// The number of neighbouring grid bins looked at in phi and z
+    TRACCC_HOST_DEVICE
+    static constexpr darray<unsigned int, 2> neighbor_scope(
+        const seedfinder_config&) {
+        return {SCOPE_LOW, SCOPE_HIGH};
+    }
+    /// The maximum number of triplets kept per middle spacepoint
+    TRACCC_HOST_DEVICE
+    static constexpr unsigned int max_triplets_per_spM(
+        const seedfilter_config&) {
+        return MAX_TRIPLETS_PER_SPM;
+    }
+    /// The maximum number of seeds made from one middle spacepoint
+    TRACCC_HOST_DEVICE
+    static constexpr unsigned int max_seeds_per_spM(const seedfilter_config&) {
+        return MAX_SEEDS_PER_SPM;
+    }
+    /// The maximum number of compatible seeds increasing the weight of a seed
+    TRACCC_HOST_DEVICE
+    static constexpr unsigned int compat_seed_limit(const seedfilter_config&) {
+        return COMPAT_SEED_LIMIT;
+    }
+
+    /// Check whether a runtime configuration has the values of this type
+    static bool matches(const seedfinder_config& config,
+                        const seedfilter_config& filter_config) {
+        return (config.neighbor_scope[0] == SCOPE_LOW) &&
+               (config.neighbor_scope[1] == SCOPE_HIGH) &&
+               (filter_config.max_triplets_per_spM == MAX_TRIPLETS_PER_SPM) &&
+               (filter_config.maxSeedsPerSpM == MAX_SEEDS_PER_SPM) &&
+               (filter_config.compatSeedLimit == COMPAT_SEED_LIMIT);
+    }
+
+};  // struct static_seeding_config
+
+/// Seeding configurations that the seeding kernels are pre-instantiated for
+namespace seeding_presets {
+
+/// The default configuration, as used for the TML and ODD samples
+using default_config = static_seeding_config<1u, 1u, 5u, 20u, 2u>;
+
+/// A wider neighbour scope, with fewer seeds per middle spacepoint and more
+/// compatible seeds boosting their weights, as a starting point for denser
+/// (ITk-like) detectors
+using dense_config = static_seeding_config<2u, 2u, 5u, 10u, 3u>;
+
+}  // namespace seeding_presets
+
+}  // namespace traccc
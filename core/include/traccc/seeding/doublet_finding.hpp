@@ -1,6 +1,6 @@
 /** TRACCC library, part of the ACTS project (R&D line)
  *
- * (c) 2021-2022 CERN for the benefit of the ACTS project
+ * (c) 2021-2024 CERN for the benefit of the ACTS project
  *
  * Mozilla Public License Version 2.0
  */
@@ -10,11 +10,15 @@
 #include "traccc/edm/internal_spacepoint.hpp"
 #include "traccc/seeding/detail/doublet.hpp"
 #include "traccc/seeding/detail/singlet.hpp"
-#include "traccc/seeding/detail/spacepoint_grid.hpp"
+#include "traccc/seeding/detail/spacepoint_soa_grid.hpp"
 #include "traccc/seeding/detail/spacepoint_type.hpp"
 #include "traccc/seeding/doublet_finding_helper.hpp"
 #include "traccc/utils/algorithm.hpp"
 
+// System include(s).
+#include <algorithm>
+#include <array>
+
 namespace traccc {
 
 /// Doublet finding to search the combinations of two compatible spacepoints
@@ -23,7 +27,7 @@ template <details::spacepoint_type otherSpType>
 struct doublet_finding
     : public algorithm<std::pair<doublet_collection_types::host,
                                  lin_circle_collection_types::host>(
-          const sp_grid&, const sp_location&)> {
+          const sp_soa_grid_host&, const sp_location&)> {
 
     static_assert(otherSpType == details::spacepoint_type::bottom ||
                   otherSpType == details::spacepoint_type::top);
@@ -41,7 +45,7 @@ struct doublet_finding
     /// internal spacepoint container
     ///
     /// @return a pair of vectors of doublets and transformed coordinates
-    output_type operator()(const sp_grid& g2,
+    output_type operator()(const sp_soa_grid_host& g2,
                            const sp_location& l) const override {
         output_type result;
         this->operator()(g2, l, result);
@@ -57,14 +61,19 @@ struct doublet_finding
     /// void interface
     ///
     /// @return a pair of vectors of doublets and transformed coordinates
-    void operator()(const sp_grid& g2, const sp_location& l,
+    void operator()(const sp_soa_grid_host& g2, const sp_location& l,
                     output_type& o) const {
         // output
         auto& doublets = o.first;
         auto& lin_circles = o.second;
 
         // middle spacepoint
-        const auto& spM = g2.bin(l.bin_idx)[l.sp_idx];
+        const internal_spacepoint<spacepoint> spM = g2.at(l);
+
+        // scratch space for testing the neighbours in batches
+        std::array<unsigned char, batch_size> compatible;
+        std::array<unsigned int, batch_size> indices;
+        std::array<lin_circle, batch_size> lins;
 
         auto phi_bins = g2.axis_p0().zone(spM.phi(), m_config.neighbor_scope);
         auto z_bins = g2.axis_p1().zone(spM.z(), m_config.neighbor_scope);
@@ -72,32 +81,66 @@ struct doublet_finding
         // iterator over neighbor bins
         for (auto& phi_bin : phi_bins) {
             for (auto& z_bin : z_bins) {
-                auto bin_idx = phi_bin + z_bin * g2.axis_p0().bins();
-
-                const auto& neighbors = g2.bin(phi_bin, z_bin);
-                for (unsigned int sp_idx = 0; sp_idx < neighbors.size();
-                     sp_idx++) {
-                    const auto& sp_nb = neighbors[sp_idx];
-
-                    if (!doublet_finding_helper::isCompatible<otherSpType>(
-                            spM, sp_nb, m_config)) {
-                        continue;
+                const unsigned int bin_idx =
+                    g2.bin_index(static_cast<unsigned int>(phi_bin),
+                                 static_cast<unsigned int>(z_bin));
+                const unsigned int bin_begin = g2.bin_begin(bin_idx);
+                const unsigned int bin_end = g2.bin_end(bin_idx);
+
+                // The bins are sorted by radius, so only a contiguous range
+                // of the neighbours can be in the allowed radius distance.
+                const auto first_nb = std::partition_point(
+                    g2.radius.begin() + bin_begin, g2.radius.begin() + bin_end,
+                    [&](scalar r_nb) {
+                        return doublet_finding_helper::isBelowDeltaRRange<
+                            otherSpType>(spM.radius(), r_nb, m_config);
+                    });
+                const auto last_nb = std::partition_point(
+                    first_nb, g2.radius.begin() + bin_end, [&](scalar r_nb) {
+                        return !doublet_finding_helper::isAboveDeltaRRange<
+                            otherSpType>(spM.radius(), r_nb, m_config);
+                    });
+                const auto range_begin =
+                    static_cast<unsigned int>(first_nb - g2.radius.begin());
+                const auto range_end =
+                    static_cast<unsigned int>(last_nb - g2.radius.begin());
+
+                // Test the neighbours of the range in fixed size batches.
+                for (unsigned int batch_begin = range_begin;
+                     batch_begin < range_end; batch_begin += batch_size) {
+
+                    const unsigned int n =
+                        std::min(batch_size, range_end - batch_begin);
+                    doublet_finding_helper::isCompatible<otherSpType>(
+                        spM, g2.radius.data() + batch_begin,
+                        g2.z.data() + batch_begin, n, m_config,
+                        compatible.data());
+
+                    // Collect the indices of the compatible neighbours.
+                    unsigned int n_compatible = 0;
+                    for (unsigned int i = 0; i < n; ++i) {
+                        indices[n_compatible] = batch_begin + i;
+                        n_compatible += compatible[i];
                     }
 
-                    lin_circle lin =
-                        doublet_finding_helper::transform_coordinates<
-                            otherSpType>(spM, sp_nb);
-                    sp_location sp_nb_location = {
-                        static_cast<unsigned int>(bin_idx),
-                        static_cast<unsigned int>(sp_idx)};
-                    doublets.push_back(doublet({l, sp_nb_location}));
-                    lin_circles.push_back(std::move(lin));
+                    doublet_finding_helper::transform_coordinates<otherSpType>(
+                        spM, g2.x.data(), g2.y.data(), g2.z.data(),
+                        indices.data(), n_compatible, lins.data());
+                    for (unsigned int i = 0; i < n_compatible; ++i) {
+                        sp_location sp_nb_location = {bin_idx,
+                                                      indices[i] - bin_begin};
+                        doublets.push_back(doublet({l, sp_nb_location}));
+                        lin_circles.push_back(lins[i]);
+                    }
                 }
             }
         }
     }
 
     private:
+    /// The number of neighbour spacepoints tested together
+    static constexpr unsigned int batch_size = 64;
+
     seedfinder_config m_config;
 };
 
@@ -1,6 +1,6 @@
 /** TRACCC library, part of the ACTS project (R&D line)
  *
- * (c) 2021-2022 CERN for the benefit of the ACTS project
+ * (c) 2021-2024 CERN for the benefit of the ACTS project
  *
  * Mozilla Public License Version 2.0
  */
@@ -8,6 +8,7 @@
 #pragma once
 
 #include "traccc/edm/internal_spacepoint.hpp"
+#include "traccc/seeding/detail/compressed_rz.hpp"
 #include "traccc/seeding/detail/doublet.hpp"
 #include "traccc/seeding/detail/lin_circle.hpp"
 #include "traccc/seeding/detail/seeding_config.hpp"
@@ -15,6 +16,18 @@
 
 namespace traccc {
 
+/// Result of the pre-selection of a doublet candidate with its compressed
+/// coordinates
+enum class compressed_preselection {
+    /// The candidate can not form a doublet
+    skip,
+    /// Neither the candidate, nor any later one of its (radius sorted) bin
+    /// can form a doublet
+    stop,
+    /// The candidate needs to be tested with its full precision coordinates
+    test
+};
+
 // helper functions used for both cpu and gpu
 struct doublet_finding_helper {
     /// Check if two spacepoints form doublets
@@ -32,6 +45,125 @@ struct doublet_finding_helper {
         const internal_spacepoint<spacepoint>& sp2,
         const seedfinder_config& config);
 
+    /// Check if two spacepoints form doublets
+    ///
+    /// @param sp1 is middle spacepoint
+    /// @param r2 is the radius of the bottom or top spacepoint
+    /// @param z2 is the Z coordinate of the bottom or top spacepoint
+    /// @param config is configuration parameter
+    /// @tparam otherSpType is whether it is for middle-bottom or middle-top
+    /// doublet
+    ///
+    /// @return boolean value for compatibility
+    template <details::spacepoint_type otherSpType>
+    static inline TRACCC_HOST_DEVICE bool isCompatible(
+        const internal_spacepoint<spacepoint>& sp1, scalar r2, scalar z2,
+        const seedfinder_config& config);
+
+    /// Check which spacepoints of a contiguous range form doublets with a
+    /// middle spacepoint
+    ///
+    /// This is the batched version of the previous function. It is written
+    /// without branches in its loop, so that the compiler can evaluate the
+    /// candidates with SIMD instructions.
+    ///
+    /// @param sp1 is middle spacepoint
+    /// @param r2 is the radii of the bottom or top spacepoints
+    /// @param z2 is the Z coordinates of the bottom or top spacepoints
+    /// @param n is the number of bottom or top spacepoints
+    /// @param config is configuration parameter
+    /// @param compatible is set to 1 for the compatible spacepoints, and to 0
+    /// for all others
+    /// @tparam otherSpType is whether it is for middle-bottom or middle-top
+    /// doublet
+    ///
+    template <details::spacepoint_type otherSpType>
+    static inline TRACCC_HOST void isCompatible(
+        const internal_spacepoint<spacepoint>& sp1, const scalar* r2,
+        const scalar* z2, unsigned int n, const seedfinder_config& config,
+        unsigned char* compatible);
+
+    /// Check if a spacepoint with coordinates in some intervals could form a
+    /// doublet
+    ///
+    /// This is the pre-selection for the compressed grid coordinates. It only
+    /// returns @c false if no point of the intervals passes the checks of
+    /// @c isCompatible.
+    ///
+    /// @param sp1 is middle spacepoint
+    /// @param rz is the intervals of the bottom or top spacepoint coordinates
+    /// @param config is configuration parameter
+    /// @tparam otherSpType is whether it is for middle-bottom or middle-top
+    /// doublet
+    ///
+    /// @return boolean value for possible compatibility
+    template <details::spacepoint_type otherSpType>
+    static inline TRACCC_HOST_DEVICE bool mayBeCompatible(
+        const internal_spacepoint<spacepoint>& sp1, const rz_interval& rz,
+        const seedfinder_config& config);
+
+    /// Pre-select a (bottom or top) doublet candidate of a middle
+    /// spacepoint, using its compressed coordinates
+    ///
+    /// Makes the same decisions as the radius range checks and the
+    /// @c isCompatible checks of the doublet finding, only erring on the side
+    /// of testing the candidates with their full precision coordinates.
+    ///
+    /// @param sp1 is middle spacepoint
+    /// @param rz is the intervals of the candidate's coordinates
+    /// @param config is configuration parameter
+    ///
+    /// @return the decision about the candidate
+    static inline TRACCC_HOST_DEVICE compressed_preselection preselect(
+        const internal_spacepoint<spacepoint>& sp1, const rz_interval& rz,
+        const seedfinder_config& config);
+
+    /// Check if a spacepoint, and all spacepoints with a smaller radius, are
+    /// too far below the allowed radius distance from the middle spacepoint
+    ///
+    /// @param r1 is the radius of the middle spacepoint
+    /// @param r2 is the radius of the bottom or top spacepoint
+    /// @param config is configuration parameter
+    /// @tparam otherSpType is whether it is for middle-bottom or middle-top
+    /// doublet
+    ///
+    template <details::spacepoint_type otherSpType>
+    static inline TRACCC_HOST_DEVICE bool isBelowDeltaRRange(
+        scalar r1, scalar r2, const seedfinder_config& config);
+
+    /// Check if a spacepoint, and all spacepoints with a larger radius, are
+    /// too far above the allowed radius distance from the middle spacepoint
+    ///
+    /// @param r1 is the radius of the middle spacepoint
+    /// @param r2 is the radius of the bottom or top spacepoint
+    /// @param config is configuration parameter
+    /// @tparam otherSpType is whether it is for middle-bottom or middle-top
+    /// doublet
+    ///
+    template <details::spacepoint_type otherSpType>
+    static inline TRACCC_HOST_DEVICE bool isAboveDeltaRRange(
+        scalar r1, scalar r2, const seedfinder_config& config);
+
+    /// Find the spacepoints of a (radius sorted) grid bin in the allowed
+    /// radius distance of a middle spacepoint
+    ///
+    /// Gives the range of the bin that can hold bottom or top candidates of
+    /// the middle spacepoint, the same one that scanning the bin with
+    /// @c isBelowDeltaRRange and @c isAboveDeltaRRange would give, using two
+    /// binary searches.
+    ///
+    /// @param radii is the radii of the grid spacepoints
+    /// @param begin is the index of the first spacepoint of the bin
+    /// @param end is the index after the last spacepoint of the bin
+    /// @param r1 is the radius of the middle spacepoint
+    /// @param config is configuration parameter
+    ///
+    /// @return the first and the after-last index of the range
+    template <typename radius_container_t>
+    static inline TRACCC_HOST_DEVICE darray<unsigned int, 2> radiusWindow(
+        const radius_container_t& radii, unsigned int begin, unsigned int end,
+        scalar r1, const seedfinder_config& config);
+
     /// Do the conformal transformation on doublet's coordinate
     ///
     /// @param sp1 is middle spacepoint
@@ -44,6 +176,27 @@ struct doublet_finding_helper {
     static inline TRACCC_HOST_DEVICE lin_circle
     transform_coordinates(const internal_spacepoint<spacepoint>& sp1,
                           const internal_spacepoint<spacepoint>& sp2);
+
+    /// Do the conformal transformation on a number of doublets' coordinates
+    ///
+    /// This is the batched version of the previous function, for spacepoints
+    /// stored in separate coordinate arrays.
+    ///
+    /// @param sp1 is middle spacepoint
+    /// @param x2 is the X coordinates of all bottom or top spacepoints
+    /// @param y2 is the Y coordinates of all bottom or top spacepoints
+    /// @param z2 is the Z coordinates of all bottom or top spacepoints
+    /// @param indices is the indices of the spacepoints to transform
+    /// @param n is the number of spacepoints to transform
+    /// @param result is filled with the @c n transformed coordinates
+    /// @tparam otherSpType is whether it is for middle-bottom or middle-top
+    /// doublet
+    ///
+    template <details::spacepoint_type otherSpType>
+    static inline TRACCC_HOST void transform_coordinates(
+        const internal_spacepoint<spacepoint>& sp1, const scalar* x2,
+        const scalar* y2, const scalar* z2, const unsigned int* indices,
+        unsigned int n, lin_circle* result);
 };
 
 template <details::spacepoint_type otherSpType>
@@ -52,14 +205,22 @@ doublet_finding_helper::isCompatible(const internal_spacepoint<spacepoint>& sp1,
                                      const internal_spacepoint<spacepoint>& sp2,
                                      const seedfinder_config& config) {
 
+    return isCompatible<otherSpType>(sp1, sp2.radius(), sp2.z(), config);
+}
+
+template <details::spacepoint_type otherSpType>
+bool TRACCC_HOST_DEVICE doublet_finding_helper::isCompatible(
+    const internal_spacepoint<spacepoint>& sp1, scalar r2, scalar z2,
+    const seedfinder_config& config) {
+
     static_assert(otherSpType == details::spacepoint_type::bottom ||
                   otherSpType == details::spacepoint_type::top);
 
     if constexpr (otherSpType == details::spacepoint_type::bottom) {
         // check if R distance is too small, because bins are not R-sorted
-        scalar deltaR = sp1.radius() - sp2.radius();
+        scalar deltaR = sp1.radius() - r2;
         // actually cotTheta * deltaR to avoid division by 0 statements
-        scalar cotTheta = sp1.z() - sp2.z();
+        scalar cotTheta = sp1.z() - z2;
         // actually zOrigin * deltaR to avoid division by 0 statements
         scalar zOrigin = sp1.z() * deltaR - sp1.radius() * cotTheta;
         if (deltaR > config.deltaRMax || deltaR < config.deltaRMin ||
@@ -70,9 +231,9 @@ doublet_finding_helper::isCompatible(const internal_spacepoint<spacepoint>& sp1,
         }
     } else {
         // check if R distance is too small, because bins are not R-sorted
-        scalar deltaR = sp2.radius() - sp1.radius();
+        scalar deltaR = r2 - sp1.radius();
         // actually cotTheta * deltaR to avoid division by 0 statements
-        scalar cotTheta = (sp2.z() - sp1.z());
+        scalar cotTheta = (z2 - sp1.z());
         // actually zOrigin * deltaR to avoid division by 0 statements
         scalar zOrigin = sp1.z() * deltaR - sp1.radius() * cotTheta;
         if (deltaR > config.deltaRMax || deltaR < config.deltaRMin ||
@@ -85,6 +246,163 @@ doublet_finding_helper::isCompatible(const internal_spacepoint<spacepoint>& sp1,
     return true;
 }
 
+template <details::spacepoint_type otherSpType>
+void TRACCC_HOST doublet_finding_helper::isCompatible(
+    const internal_spacepoint<spacepoint>& sp1, const scalar* r2,
+    const scalar* z2, unsigned int n, const seedfinder_config& config,
+    unsigned char* compatible) {
+
+    static_assert(otherSpType == details::spacepoint_type::bottom ||
+                  otherSpType == details::spacepoint_type::top);
+
+    const scalar r1 = sp1.radius();
+    const scalar z1 = sp1.z();
+
+    // Use the same expressions as the single-spacepoint function, but combine
+    // the results of the comparisons without short-circuiting.
+    for (unsigned int i = 0; i < n; ++i) {
+        const scalar deltaR = (otherSpType == details::spacepoint_type::bottom)
+                                  ? (r1 - r2[i])
+                                  : (r2[i] - r1);
+        const scalar cotTheta =
+            (otherSpType == details::spacepoint_type::bottom) ? (z1 - z2[i])
+                                                              : (z2[i] - z1);
+        const scalar zOrigin = z1 * deltaR - r1 * cotTheta;
+        compatible[i] = static_cast<unsigned char>(
+            (deltaR <= config.deltaRMax) & (deltaR >= config.deltaRMin) &
+            (std::fabs(cotTheta) <= config.cotThetaMax * deltaR) &
+            (zOrigin >= config.collisionRegionMin * deltaR) &
+            (zOrigin <= config.collisionRegionMax * deltaR));
+    }
+}
+
+template <details::spacepoint_type otherSpType>
+bool TRACCC_HOST_DEVICE doublet_finding_helper::mayBeCompatible(
+    const internal_spacepoint<spacepoint>& sp1, const rz_interval& rz,
+    const seedfinder_config& config) {
+
+    static_assert(otherSpType == details::spacepoint_type::bottom ||
+                  otherSpType == details::spacepoint_type::top);
+
+    const scalar r1 = sp1.radius();
+    const scalar z1 = sp1.z();
+
+    // The intervals of deltaR and of (cotTheta * deltaR).
+    scalar dr_lo, dr_hi, dz_lo, dz_hi;
+    if constexpr (otherSpType == details::spacepoint_type::bottom) {
+        dr_lo = r1 - rz.r_hi;
+        dr_hi = r1 - rz.r_lo;
+        dz_lo = z1 - rz.z_hi;
+        dz_hi = z1 - rz.z_lo;
+    } else {
+        dr_lo = rz.r_lo - r1;
+        dr_hi = rz.r_hi - r1;
+        dz_lo = rz.z_lo - z1;
+        dz_hi = rz.z_hi - z1;
+    }
+
+    // Every check of isCompatible is tested on its own, for the most
+    // favourable point of the intervals. The zOrigin checks are linear in
+    // deltaR and cotTheta, so their extremes are on the corners.
+    const scalar min_abs_dz =
+        (dz_lo > 0.f) ? dz_lo : ((dz_hi < 0.f) ? -dz_hi : 0.f);
+    const scalar cmin_factor = z1 - config.collisionRegionMin;
+    const scalar cmax_factor = z1 - config.collisionRegionMax;
+    const scalar max_origin_above_min =
+        cmin_factor * (cmin_factor >= 0.f ? dr_hi : dr_lo) - r1 * dz_lo;
+    const scalar min_origin_above_max =
+        cmax_factor * (cmax_factor >= 0.f ? dr_lo : dr_hi) - r1 * dz_hi;
+    return !(dr_lo > config.deltaRMax || dr_hi < config.deltaRMin ||
+             min_abs_dz > config.cotThetaMax * dr_hi ||
+             max_origin_above_min < 0.f || min_origin_above_max > 0.f);
+}
+
+compressed_preselection TRACCC_HOST_DEVICE
+doublet_finding_helper::preselect(const internal_spacepoint<spacepoint>& sp1,
+                                  const rz_interval& rz,
+                                  const seedfinder_config& config) {
+
+    if (isBelowDeltaRRange<details::spacepoint_type::bottom>(
+            sp1.radius(), rz.r_hi, config)) {
+        return compressed_preselection::skip;
+    }
+    if (isAboveDeltaRRange<details::spacepoint_type::top>(sp1.radius(),
+                                                          rz.r_lo, config)) {
+        return compressed_preselection::stop;
+    }
+    if (mayBeCompatible<details::spacepoint_type::bottom>(sp1, rz, config) ||
+        mayBeCompatible<details::spacepoint_type::top>(sp1, rz, config)) {
+        return compressed_preselection::test;
+    }
+    return compressed_preselection::skip;
+}
+
+template <details::spacepoint_type otherSpType>
+bool TRACCC_HOST_DEVICE doublet_finding_helper::isBelowDeltaRRange(
+    scalar r1, scalar r2, const seedfinder_config& config) {
+
+    static_assert(otherSpType == details::spacepoint_type::bottom ||
+                  otherSpType == details::spacepoint_type::top);
+
+    // Use the same expressions for deltaR as isCompatible, so the two
+    // functions can not disagree due to rounding.
+    if constexpr (otherSpType == details::spacepoint_type::bottom) {
+        return (r1 - r2 > config.deltaRMax);
+    } else {
+        return (r2 - r1 < config.deltaRMin);
+    }
+}
+
+template <details::spacepoint_type otherSpType>
+bool TRACCC_HOST_DEVICE doublet_finding_helper::isAboveDeltaRRange(
+    scalar r1, scalar r2, const seedfinder_config& config) {
+
+    static_assert(otherSpType == details::spacepoint_type::bottom ||
+                  otherSpType == details::spacepoint_type::top);
+
+    // Use the same expressions for deltaR as isCompatible, so the two
+    // functions can not disagree due to rounding.
+    if constexpr (otherSpType == details::spacepoint_type::bottom) {
+        return (r1 - r2 < config.deltaRMin);
+    } else {
+        return (r2 - r1 > config.deltaRMax);
+    }
+}
+
+template <typename radius_container_t>
+darray<unsigned int, 2> TRACCC_HOST_DEVICE doublet_finding_helper::radiusWindow(
+    const radius_container_t& radii, unsigned int begin, unsigned int end,
+    scalar r1, const seedfinder_config& config) {
+
+    // The first spacepoint that is not too close to the beam to be a bottom
+    // spacepoint.
+    unsigned int low = begin, high = end;
+    while (low < high) {
+        const unsigned int mid = low + (high - low) / 2;
+        if (isBelowDeltaRRange<details::spacepoint_type::bottom>(
+                r1, radii[mid], config)) {
+            low = mid + 1;
+        } else {
+            high = mid;
+        }
+    }
+    const unsigned int first = low;
+
+    // The first spacepoint that is too far from the beam to be a top
+    // spacepoint.
+    high = end;
+    while (low < high) {
+        const unsigned int mid = low + (high - low) / 2;
+        if (isAboveDeltaRRange<details::spacepoint_type::top>(r1, radii[mid],
+                                                              config)) {
+            high = mid;
+        } else {
+            low = mid + 1;
+        }
+    }
+    return {first, low};
+}
+
 template <details::spacepoint_type otherSpType>
 lin_circle TRACCC_HOST_DEVICE doublet_finding_helper::transform_coordinates(
     const internal_spacepoint<spacepoint>& sp1,
@@ -142,4 +460,23 @@ lin_circle TRACCC_HOST_DEVICE doublet_finding_helper::transform_coordinates(
     return l;
 }
 
+template <details::spacepoint_type otherSpType>
+void TRACCC_HOST doublet_finding_helper::transform_coordinates(
+    const internal_spacepoint<spacepoint>& sp1, const scalar* x2,
+    const scalar* y2, const scalar* z2, const unsigned int* indices,
+    unsigned int n, lin_circle* result) {
+
+    // The single-spacepoint function reads the coordinates of the other
+    // spacepoint through an internal_spacepoint, so let it do the work on
+    // one constructed from the arrays. This gets inlined into a loop without
+    // any branches or function calls.
+    internal_spacepoint<spacepoint> sp2{};
+    for (unsigned int i = 0; i < n; ++i) {
+        sp2.m_x = x2[indices[i]];
+        sp2.m_y = y2[indices[i]];
+        sp2.m_z = z2[indices[i]];
+        result[i] = transform_coordinates<otherSpType>(sp1, sp2);
+    }
+}
+
 }  // namespace traccc
@@ -0,0 +1,59 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Library include(s).
+#include "traccc/edm/seed.hpp"
+#include "traccc/edm/spacepoint.hpp"
+#include "traccc/seeding/detail/hough_seeding_config.hpp"
+#include "traccc/utils/algorithm.hpp"
+
+// VecMem include(s).
+#include <vecmem/memory/memory_resource.hpp>
+
+// System include(s).
+#include <functional>
+
+namespace traccc {
+
+/// Track seeding with a binned Hough transform, on the CPU
+///
+/// An alternative to @c traccc::seeding_algorithm, with the same interface.
+/// Its cost grows linearly with the number of spacepoints, instead of with
+/// the number of spacepoint combinations.
+///
+class hough_seeding_algorithm
+    : public algorithm<seed_collection_types::host(
+          const spacepoint_collection_types::host&)> {
+
+    public:
+    /// Constructor for the seeding algorithm
+    ///
+    /// @param config The configuration of the Hough transform
+    /// @param mr The memory resource to use
+    ///
+    hough_seeding_algorithm(const hough_seeding_config& config,
+                            vecmem::memory_resource& mr);
+
+    /// Operator executing the algorithm.
+    ///
+    /// @param spacepoints All spacepoints in the event
+    /// @return The track seeds reconstructed from the spacepoints
+    ///
+    output_type operator()(
+        const spacepoint_collection_types::host& spacepoints) const override;
+
+    private:
+    /// The configuration of the Hough transform
+    hough_seeding_config m_config;
+    /// The memory resource to use
+    std::reference_wrapper<vecmem::memory_resource> m_mr;
+
+};  // class hough_seeding_algorithm
+
+}  // namespace traccc
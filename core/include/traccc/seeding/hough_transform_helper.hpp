@@ -0,0 +1,352 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s).
+#include "traccc/definitions/common.hpp"
+#include "traccc/definitions/primitives.hpp"
+#include "traccc/definitions/qualifiers.hpp"
+#include "traccc/edm/seed.hpp"
+#include "traccc/edm/spacepoint.hpp"
+#include "traccc/seeding/detail/hough_seeding_config.hpp"
+
+// System include(s).
+#include <cmath>
+#include <limits>
+
+namespace traccc {
+
+/// Helper functions of the Hough transform seeding, shared by the host and
+/// device implementations
+struct hough_transform_helper {
+
+    /// Key of a spacepoint that no accumulator cell was given yet
+    static constexpr unsigned long long invalid_key =
+        std::numeric_limits<unsigned long long>::max();
+    /// The largest residual that the keys of the spacepoints can hold
+    static constexpr unsigned int max_residual = (1u << 27) - 1u;
+
+    /// The radius of a spacepoint, relative to the beam
+    TRACCC_HOST_DEVICE
+    static inline scalar radius(const hough_seeding_config& cfg,
+                                const spacepoint& sp) {
+        const scalar x = sp.x() - cfg.beamPos[0];
+        const scalar y = sp.y() - cfg.beamPos[1];
+        return std::sqrt(x * x + y * y);
+    }
+
+    /// The (radial) layer of a spacepoint at a given radius
+    TRACCC_HOST_DEVICE
+    static inline unsigned int layer(const hough_seeding_config& cfg,
+                                     scalar r) {
+        const scalar l = (r - cfg.rMin) / cfg.layerWidth;
+        return (l <= 0.f) ? 0u
+                          : ((l >= 31.f) ? 31u : static_cast<unsigned int>(l));
+    }
+
+    /// The number of distinct layers in a mask of layers
+    TRACCC_HOST_DEVICE
+    static inline unsigned int n_layers(unsigned int mask) {
+        unsigned int result = 0u;
+        for (; mask != 0u; mask &= (mask - 1u)) {
+            ++result;
+        }
+        return result;
+    }
+
+    /// The index of an accumulator cell
+    TRACCC_HOST_DEVICE
+    static inline unsigned int cell_index(const hough_seeding_config& cfg,
+                                          unsigned int slice,
+                                          unsigned int qopt_bin,
+                                          unsigned int phi_bin) {
+        return (slice * cfg.n_qopt_bins + qopt_bin) * cfg.n_phi_bins + phi_bin;
+    }
+
+    /// Call a function on all accumulator cells that a spacepoint votes for
+    ///
+    /// For every z0 slice of the collision region, the spacepoint votes for
+    /// the cot(theta) slices that a track from that z0 slice could have
+    /// through it. In every one of those slices, it votes for all phi0 bins
+    /// that it covers over the width of every q/pT bin.
+    ///
+    /// @param cfg The configuration of the seeding
+    /// @param sp The spacepoint
+    /// @param func The function, called with the index of every cell
+    ///
+    template <typename func_t>
+    TRACCC_HOST_DEVICE static inline void for_each_cell(
+        const hough_seeding_config& cfg, const spacepoint& sp, func_t&& func) {
+
+        const scalar r = radius(cfg, sp);
+        if ((r < cfg.rMin) || (r > cfg.rMax)) {
+            return;
+        }
+
+        // The phi0 bins of every q/pT bin. phi0 = phi + asin(B * r * q/pT / 2)
+        // for a track from the beam line.
+        const scalar phi =
+            std::atan2(sp.y() - cfg.beamPos[1], sp.x() - cfg.beamPos[0]);
+        const scalar qopt_max = 1.f / cfg.minPt;
+        const scalar qopt_width =
+            2.f * qopt_max / static_cast<scalar>(cfg.n_qopt_bins);
+        const scalar pi = static_cast<scalar>(M_PI);
+        const scalar phi_width =
+            2.f * pi / static_cast<scalar>(cfg.n_phi_bins);
+        const scalar half_curvature = 0.5f * cfg.bFieldInZ * r;
+        auto phi_bin = [&](scalar qopt) {
+            scalar s = half_curvature * qopt;
+            s = (s > 1.f) ? 1.f : ((s < -1.f) ? -1.f : s);
+            return static_cast<int>(
+                std::floor((phi + std::asin(s) + pi) / phi_width));
+        };
+        const int n_phi_bins = static_cast<int>(cfg.n_phi_bins);
+
+        const scalar z_width =
+            (cfg.collisionRegionMax - cfg.collisionRegionMin) /
+            static_cast<scalar>(cfg.n_z_slices);
+        const scalar cot_width =
+            2.f * cfg.cotThetaMax / static_cast<scalar>(cfg.n_cot_slices);
+        for (unsigned int z = 0; z < cfg.n_z_slices; ++z) {
+
+            // The range of cot(theta) slices of this z0 slice.
+            const scalar z0_lo =
+                cfg.collisionRegionMin + static_cast<scalar>(z) * z_width;
+            const scalar cot_lo = (sp.z() - (z0_lo + z_width)) / r;
+            const scalar cot_hi = (sp.z() - z0_lo) / r;
+            if ((cot_hi < -cfg.cotThetaMax) || (cot_lo > cfg.cotThetaMax)) {
+                continue;
+            }
+            const int first_cot = static_cast<int>(
+                std::floor((cot_lo + cfg.cotThetaMax) / cot_width));
+            const int last_cot = static_cast<int>(
+                std::floor((cot_hi + cfg.cotThetaMax) / cot_width));
+            const unsigned int slice_begin =
+                z * cfg.n_cot_slices +
+                static_cast<unsigned int>(first_cot < 0 ? 0 : first_cot);
+            const unsigned int slice_end =
+                z * cfg.n_cot_slices +
+                ((last_cot >= static_cast<int>(cfg.n_cot_slices))
+                     ? cfg.n_cot_slices
+                     : static_cast<unsigned int>(last_cot + 1));
+
+            for (unsigned int slice = slice_begin; slice < slice_end;
+                 ++slice) {
+                for (unsigned int q = 0; q < cfg.n_qopt_bins; ++q) {
+                    const scalar qopt_lo =
+                        -qopt_max + static_cast<scalar>(q) * qopt_width;
+                    const int bin_lo = phi_bin(qopt_lo);
+                    const int bin_hi = phi_bin(qopt_lo + qopt_width);
+                    for (int b = bin_lo; b <= bin_hi; ++b) {
+                        const unsigned int wrapped = static_cast<unsigned int>(
+                            ((b % n_phi_bins) + n_phi_bins) % n_phi_bins);
+                        func(cell_index(cfg, slice, q, wrapped));
+                    }
+                }
+            }
+        }
+    }
+
+    /// Decide whether an accumulator cell should seed a track
+    ///
+    /// The cell needs spacepoints from enough distinct layers, and needs to
+    /// be a local maximum of its (cot(theta), q/pT, phi0) neighbourhood
+    /// within its z0 slice. Of neighbouring cells with the same number of
+    /// layers, the one with the lowest index is kept. (A track votes for the
+    /// same cells in a few neighbouring slices, which would otherwise all
+    /// make the same seed.)
+    ///
+    /// @param cfg The configuration of the seeding
+    /// @param cell The index of the cell
+    /// @param masks The layer masks of all cells
+    ///
+    template <typename masks_t>
+    TRACCC_HOST_DEVICE static inline bool is_seed_cell(
+        const hough_seeding_config& cfg, unsigned int cell,
+        const masks_t& masks) {
+
+        const unsigned int n = n_layers(masks[cell]);
+        if (n < cfg.minLayers) {
+            return false;
+        }
+        const int phi_bin = static_cast<int>(cell % cfg.n_phi_bins);
+        const int qopt_bin =
+            static_cast<int>((cell / cfg.n_phi_bins) % cfg.n_qopt_bins);
+        const unsigned int slice = cell / (cfg.n_phi_bins * cfg.n_qopt_bins);
+        const unsigned int z_slice = slice / cfg.n_cot_slices;
+        const int cot_slice = static_cast<int>(slice % cfg.n_cot_slices);
+        const int n_phi_bins = static_cast<int>(cfg.n_phi_bins);
+        for (int dc = -1; dc <= 1; ++dc) {
+            const int c = cot_slice + dc;
+            if ((c < 0) || (c >= static_cast<int>(cfg.n_cot_slices))) {
+                continue;
+            }
+            for (int dq = -1; dq <= 1; ++dq) {
+                const int q = qopt_bin + dq;
+                if ((q < 0) || (q >= static_cast<int>(cfg.n_qopt_bins))) {
+                    continue;
+                }
+                for (int dphi = -1; dphi <= 1; ++dphi) {
+                    if ((dc == 0) && (dq == 0) && (dphi == 0)) {
+                        continue;
+                    }
+                    const int p = (phi_bin + n_phi_bins + dphi) % n_phi_bins;
+                    const unsigned int other = cell_index(
+                        cfg,
+                        z_slice * cfg.n_cot_slices +
+                            static_cast<unsigned int>(c),
+                        static_cast<unsigned int>(q),
+                        static_cast<unsigned int>(p));
+                    const unsigned int n_other = n_layers(masks[other]);
+                    if ((n_other > n) || ((n_other == n) && (other < cell))) {
+                        return false;
+                    }
+                }
+            }
+        }
+        return true;
+    }
+
+    /// The distance in phi of a spacepoint from the trajectory at the centre
+    /// of an accumulator cell, in units of 10 microradians
+    TRACCC_HOST_DEVICE
+    static inline unsigned int residual(const hough_seeding_config& cfg,
+                                        unsigned int cell,
+                                        const spacepoint& sp) {
+
+        const unsigned int phi_bin = cell % cfg.n_phi_bins;
+        const unsigned int qopt_bin = (cell / cfg.n_phi_bins) % cfg.n_qopt_bins;
+        const scalar pi = static_cast<scalar>(M_PI);
+        const scalar qopt_max = 1.f / cfg.minPt;
+        const scalar qopt =
+            -qopt_max + (static_cast<scalar>(qopt_bin) + 0.5f) * 2.f *
+                            qopt_max / static_cast<scalar>(cfg.n_qopt_bins);
+        const scalar phi0 =
+            -pi + (static_cast<scalar>(phi_bin) + 0.5f) * 2.f * pi /
+                      static_cast<scalar>(cfg.n_phi_bins);
+        scalar s = 0.5f * cfg.bFieldInZ * radius(cfg, sp) * qopt;
+        s = (s > 1.f) ? 1.f : ((s < -1.f) ? -1.f : s);
+        scalar delta =
+            std::atan2(sp.y() - cfg.beamPos[1], sp.x() - cfg.beamPos[0]) -
+            (phi0 - std::asin(s));
+        delta = std::abs(delta - 2.f * pi * std::floor((delta + pi) /
+                                                       (2.f * pi)));
+        const scalar result = delta / 1e-5f;
+        return (result >= static_cast<scalar>(max_residual))
+                   ? max_residual
+                   : static_cast<unsigned int>(result);
+    }
+
+    /// Key ordering the spacepoints of a cell by a (layer based) rank, then
+    /// by their residual in the cell, with ties broken by their index
+    TRACCC_HOST_DEVICE
+    static inline unsigned long long selection_key(unsigned int rank,
+                                                   unsigned int res,
+                                                   unsigned int link) {
+        return (static_cast<unsigned long long>(rank) << 59) |
+               (static_cast<unsigned long long>(res) << 32) | link;
+    }
+
+    /// The index of the spacepoint of a key
+    TRACCC_HOST_DEVICE
+    static inline unsigned int key_link(unsigned long long key) {
+        return static_cast<unsigned int>(key & 0xffffffffull);
+    }
+
+    /// Key of a bottom spacepoint candidate of a seed, preferring the
+    /// innermost layer
+    TRACCC_HOST_DEVICE
+    static inline unsigned long long bottom_key(
+        const hough_seeding_config& cfg, unsigned int cell,
+        const spacepoint& sp, unsigned int link) {
+        return selection_key(layer(cfg, radius(cfg, sp)),
+                             residual(cfg, cell, sp), link);
+    }
+
+    /// Key of a top spacepoint candidate of a seed, preferring the
+    /// outermost layer
+    TRACCC_HOST_DEVICE
+    static inline unsigned long long top_key(const hough_seeding_config& cfg,
+                                             unsigned int cell,
+                                             const spacepoint& sp,
+                                             unsigned int link) {
+        return selection_key(31u - layer(cfg, radius(cfg, sp)),
+                             residual(cfg, cell, sp), link);
+    }
+
+    /// Key of a middle spacepoint candidate of a seed
+    ///
+    /// @return The key, preferring the layer closest to the mid-layer of the
+    ///         seed, or @c invalid_key if the spacepoint is not on a layer
+    ///         between the bottom and top spacepoints, or is too far in z
+    ///         from the line between them
+    ///
+    TRACCC_HOST_DEVICE
+    static inline unsigned long long middle_key(
+        const hough_seeding_config& cfg, unsigned int cell,
+        const spacepoint& sp, unsigned int link, const spacepoint& spB,
+        const spacepoint& spT) {
+
+        const scalar r = radius(cfg, sp);
+        const scalar rB = radius(cfg, spB);
+        const scalar rT = radius(cfg, spT);
+        const unsigned int l = layer(cfg, r);
+        const unsigned int lB = layer(cfg, rB);
+        const unsigned int lT = layer(cfg, rT);
+        if ((l <= lB) || (l >= lT)) {
+            return invalid_key;
+        }
+        const scalar z_line =
+            spB.z() + (r - rB) * (spT.z() - spB.z()) / (rT - rB);
+        if (std::abs(sp.z() - z_line) > cfg.maxMiddleDeltaZ) {
+            return invalid_key;
+        }
+        const unsigned int rank = (2u * l > lB + lT) ? (2u * l - lB - lT)
+                                                     : (lB + lT - 2u * l);
+        return selection_key(rank, residual(cfg, cell, sp), link);
+    }
+
+    /// Make a seed out of the spacepoints chosen for a cell
+    ///
+    /// @param cfg The configuration of the seeding
+    /// @param spacepoints All spacepoints of the event
+    /// @param bottom The key of the bottom spacepoint
+    /// @param middle The key of the middle spacepoint
+    /// @param top The key of the top spacepoint
+    /// @param mask The layer mask of the cell
+    /// @param[out] result The seed
+    /// @return Whether a valid seed could be made
+    ///
+    template <typename spacepoints_t>
+    TRACCC_HOST_DEVICE static inline bool make_seed(
+        const hough_seeding_config& cfg, const spacepoints_t& spacepoints,
+        unsigned long long bottom, unsigned long long middle,
+        unsigned long long top, unsigned int mask, seed& result) {
+
+        if ((bottom == invalid_key) || (middle == invalid_key) ||
+            (top == invalid_key)) {
+            return false;
+        }
+        const spacepoint& spB = spacepoints[key_link(bottom)];
+        const spacepoint& spT = spacepoints[key_link(top)];
+        const scalar rB = radius(cfg, spB);
+        const scalar rT = radius(cfg, spT);
+        const scalar z_vertex =
+            spB.z() - rB * (spT.z() - spB.z()) / (rT - rB);
+        if ((z_vertex < cfg.collisionRegionMin) ||
+            (z_vertex > cfg.collisionRegionMax)) {
+            return false;
+        }
+        result = {key_link(bottom), key_link(middle), key_link(top),
+                  static_cast<scalar>(n_layers(mask)), z_vertex};
+        return true;
+    }
+
+};  // struct hough_transform_helper
+
+}  // namespace traccc
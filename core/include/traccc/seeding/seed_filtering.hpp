@@ -1,6 +1,6 @@
 /** TRACCC library, part of the ACTS project (R&D line)
  *
- * (c) 2021-2022 CERN for the benefit of the ACTS project
+ * (c) 2021-2024 CERN for the benefit of the ACTS project
  *
  * Mozilla Public License Version 2.0
  */
@@ -11,15 +11,42 @@
 #include "traccc/edm/seed.hpp"
 #include "traccc/edm/spacepoint.hpp"
 #include "traccc/seeding/detail/seeding_config.hpp"
-#include "traccc/seeding/detail/spacepoint_grid.hpp"
+#include "traccc/seeding/detail/spacepoint_soa_grid.hpp"
 #include "traccc/seeding/detail/triplet.hpp"
 
+// System include(s).
+#include <cstddef>
+#include <vector>
+
 namespace traccc {
 
 /// Seed filtering to filter out the bad triplets
 class seed_filtering {
 
     public:
+    /// Workspace of the seed filtering
+    ///
+    /// Holds the best seed candidates of the current middle spacepoint. It
+    /// can be reused for any number of middle spacepoints (by one thread at
+    /// a time), so that memory is only allocated for the first of them.
+    ///
+    class workspace {
+        friend class seed_filtering;
+
+        /// A seed candidate, with its sort keys
+        struct candidate {
+            /// The seed
+            seed s;
+            /// The summed y^2 + z^2 of the bottom and top spacepoints
+            scalar sum;
+            /// The index of the triplet of the seed
+            std::size_t index;
+        };
+
+        /// The (heap of the) best candidates
+        std::vector<candidate> m_candidates;
+    };
+
     /// Constructor with the seed filter configuration
     seed_filtering(const seedfilter_config& config);
 
@@ -33,9 +60,24 @@ class seed_filtering {
     /// @return seeds are the vector of seeds where the new compatible seeds are
     /// added
     void operator()(const spacepoint_collection_types::host& sp_collection,
-                    const sp_grid& g2, triplet_collection_types::host& triplets,
+                    const sp_soa_grid_host& g2,
+                    triplet_collection_types::host& triplets,
                     seed_collection_types::host& seeds) const;
 
+    /// Callable operator for the seed filtering, using a given workspace
+    ///
+    /// Only the @c max_triplets_per_spM best triplets are kept while
+    /// processing the triplets, instead of sorting all of them. The
+    /// selected seeds are the same as through the other operator.
+    ///
+    /// @param ws is the (reusable) workspace of the filtering
+    ///
+    void operator()(const spacepoint_collection_types::host& sp_collection,
+                    const sp_soa_grid_host& g2,
+                    triplet_collection_types::host& triplets,
+                    seed_collection_types::host& seeds,
+                    workspace& ws) const;
+
     private:
     /// Seed filter configuration
     seedfilter_config m_filter_config;
@@ -1,6 +1,6 @@
 /** TRACCC library, part of the ACTS project (R&D line)
  *
- * (c) 2021-2022 CERN for the benefit of the ACTS project
+ * (c) 2021-2024 CERN for the benefit of the ACTS project
  *
  * Mozilla Public License Version 2.0
  */
@@ -11,7 +11,7 @@
 #include "traccc/edm/seed.hpp"
 #include "traccc/edm/spacepoint.hpp"
 #include "traccc/seeding/detail/seeding_config.hpp"
-#include "traccc/seeding/detail/spacepoint_grid.hpp"
+#include "traccc/seeding/detail/spacepoint_soa_grid.hpp"
 #include "traccc/seeding/doublet_finding.hpp"
 #include "traccc/seeding/seed_filtering.hpp"
 #include "traccc/seeding/triplet_finding.hpp"
@@ -20,18 +20,32 @@
 namespace traccc {
 
 /// Seed finding
+///
+/// The seeds of every middle spacepoint are found independently of all other
+/// middle spacepoints. In multi-threaded mode, the bins of the grid are
+/// processed in parallel using TBB, into separate seed collections that are
+/// then concatenated in the order of the bins. So the result is the same, in
+/// the same order, as in single-threaded mode.
+///
+/// If traccc::core is built without TBB, the bins are always processed one
+/// after the other.
+///
 class seed_finding
     : public algorithm<seed_collection_types::host(
-          const spacepoint_collection_types::host&, const sp_grid&)> {
+          const spacepoint_collection_types::host&,
+          const sp_soa_grid_host&)> {
 
     public:
     /// Constructor for the seed finding
     ///
     /// @param find_config is seed finder configuration parameters
     /// @param filter_config is the seed filter configuration
+    /// @param multi_threaded whether to process the bins of the grid in
+    ///                       parallel
     ///
     seed_finding(const seedfinder_config& find_config,
-                 const seedfilter_config& filter_config);
+                 const seedfilter_config& filter_config,
+                 bool multi_threaded = false);
 
     /// Callable operator for the seed finding
     ///
@@ -41,9 +55,20 @@ class seed_finding
     ///
     output_type operator()(
         const spacepoint_collection_types::host& sp_collection,
-        const sp_grid& g2) const override;
+        const sp_soa_grid_host& g2) const override;
 
     private:
+    /// Find the seeds of the middle spacepoints in one bin of the grid
+    ///
+    /// @param sp_collection All spacepoints in the event
+    /// @param g2 The same spacepoints arranged in a 2D Phi-Z grid
+    /// @param bin The index of the bin to process
+    /// @param seeds The collection to add the seeds to
+    ///
+    void find_seeds(const spacepoint_collection_types::host& sp_collection,
+                    const sp_soa_grid_host& g2, unsigned int bin,
+                    output_type& seeds) const;
+
     /// Algorithm performing the mid bottom doublet finding
     doublet_finding<details::spacepoint_type::bottom> m_midBot_finding;
     /// Algorithm performing the mid top doublet finding
@@ -52,6 +77,8 @@ class seed_finding
     triplet_finding m_triplet_finding;
     /// Algorithm performing the seed selection
     seed_filtering m_seed_filtering;
+    /// Whether to process the bins of the grid in parallel
+    bool m_multi_threaded;
 
 };  // class seed_finding
 
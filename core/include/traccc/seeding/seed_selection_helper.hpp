@@ -0,0 +1,188 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s).
+#include "traccc/definitions/primitives.hpp"
+#include "traccc/definitions/qualifiers.hpp"
+#include "traccc/edm/seed.hpp"
+#include "traccc/edm/track_parameters.hpp"
+#include "traccc/seeding/detail/seeding_config.hpp"
+
+// System include(s).
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+
+namespace traccc {
+
+// helper functions used for both cpu and gpu, for selecting the seeds
+// handed to the track finding
+struct seed_selection_helper {
+
+    /// Get the key of a pair of spacepoints of a seed
+    ///
+    /// Seeds sharing two spacepoints share the key of the same pair. The
+    /// pairs are (bottom, middle), (bottom, top) and (middle, top).
+    ///
+    /// @param seed is the seed
+    /// @param pair is the index of the pair (0, 1 or 2)
+    ///
+    /// @return the key of the pair of spacepoints
+    static TRACCC_HOST_DEVICE std::uint64_t pair_key(const seed& seed,
+                                                     const unsigned int pair) {
+        const seed::link_type first =
+            (pair == 2u) ? seed.spM_link : seed.spB_link;
+        const seed::link_type second =
+            (pair == 0u) ? seed.spM_link : seed.spT_link;
+        return (static_cast<std::uint64_t>(first) << 32) |
+               static_cast<std::uint64_t>(second);
+    }
+
+    /// Count the spacepoints shared by two seeds
+    ///
+    /// @param a is the first seed
+    /// @param b is the second seed
+    ///
+    /// @return the number of spacepoints of @c a that are also in @c b
+    static TRACCC_HOST_DEVICE unsigned int n_shared_spacepoints(const seed& a,
+                                                                const seed& b) {
+        return (is_in(a.spB_link, b) ? 1u : 0u) +
+               (is_in(a.spM_link, b) ? 1u : 0u) +
+               (is_in(a.spT_link, b) ? 1u : 0u);
+    }
+
+    /// Check whether the estimated parameters of two seeds are compatible
+    ///
+    /// @param config is the seed selection configuration
+    /// @param a is the parameters of the first seed
+    /// @param b is the parameters of the second seed
+    ///
+    /// @return boolean value
+    static TRACCC_HOST_DEVICE bool compatible_parameters(
+        const seed_selection_config& config, const bound_track_parameters& a,
+        const bound_track_parameters& b) {
+
+        scalar delta_phi = std::abs(a.phi() - b.phi());
+        if (delta_phi > static_cast<scalar>(M_PI)) {
+            delta_phi = 2.f * static_cast<scalar>(M_PI) - delta_phi;
+        }
+        const scalar max_qop = (std::abs(a.qop()) > std::abs(b.qop()))
+                                   ? std::abs(a.qop())
+                                   : std::abs(b.qop());
+        return (delta_phi <= config.max_delta_phi) &&
+               (std::abs(a.theta() - b.theta()) <= config.max_delta_theta) &&
+               (std::abs(a.qop() - b.qop()) <=
+                config.max_rel_delta_qop * max_qop);
+    }
+
+    /// Check whether a seed is of higher quality than another one
+    ///
+    /// Seeds are ordered by their weights, with ties broken by the seed
+    /// indices, so that the ordering is strict and deterministic.
+    ///
+    /// @param a is the first seed
+    /// @param ia is the index of the first seed
+    /// @param b is the second seed
+    /// @param ib is the index of the second seed
+    ///
+    /// @return boolean value
+    static TRACCC_HOST_DEVICE bool is_better(const seed& a,
+                                             const unsigned int ia,
+                                             const seed& b,
+                                             const unsigned int ib) {
+        return (a.weight > b.weight) || ((a.weight == b.weight) && (ia < ib));
+    }
+
+    /// Check whether a seed is a near-duplicate of a higher quality seed
+    ///
+    /// @param config is the seed selection configuration
+    /// @param a is the seed to check
+    /// @param ia is the index of the seed to check
+    /// @param pa is the parameters of the seed to check
+    /// @param b is the other seed
+    /// @param ib is the index of the other seed
+    /// @param pb is the parameters of the other seed
+    ///
+    /// @return boolean value
+    static TRACCC_HOST_DEVICE bool is_duplicate_of(
+        const seed_selection_config& config, const seed& a,
+        const unsigned int ia, const bound_track_parameters& pa, const seed& b,
+        const unsigned int ib, const bound_track_parameters& pb) {
+
+        return is_better(b, ib, a, ia) &&
+               (n_shared_spacepoints(a, b) >= config.min_shared_spacepoints) &&
+               compatible_parameters(config, pa, pb);
+    }
+
+    /// Get the (eta, phi) region of a seed
+    ///
+    /// @param config is the seed selection configuration
+    /// @param params is the parameters of the seed
+    ///
+    /// @return the index of the region
+    static TRACCC_HOST_DEVICE unsigned int region_index(
+        const seed_selection_config& config,
+        const bound_track_parameters& params) {
+
+        const scalar eta =
+            -std::log(std::tan(0.5f * static_cast<scalar>(params.theta())));
+        const scalar eta_fraction =
+            (eta + config.eta_range) / (2.f * config.eta_range);
+        const scalar phi_fraction =
+            (params.phi() + static_cast<scalar>(M_PI)) /
+            (2.f * static_cast<scalar>(M_PI));
+        const unsigned int eta_bin = bin_index(eta_fraction, config.n_eta_bins);
+        const unsigned int phi_bin = bin_index(phi_fraction, config.n_phi_bins);
+        return eta_bin * config.n_phi_bins + phi_bin;
+    }
+
+    /// Get a key ordering seeds by their regions, and then by decreasing
+    /// weight
+    ///
+    /// @param config is the seed selection configuration
+    /// @param seed is the seed
+    /// @param params is the parameters of the seed
+    ///
+    /// @return the sort key of the seed
+    static TRACCC_HOST_DEVICE std::uint64_t region_key(
+        const seed_selection_config& config, const seed& seed,
+        const bound_track_parameters& params) {
+
+        // Map the weight onto an unsigned integer with the opposite order.
+        static_assert(sizeof(float) == sizeof(std::uint32_t));
+        const float weight = static_cast<float>(seed.weight);
+        std::uint32_t bits = 0;
+        memcpy(&bits, &weight, sizeof(bits));
+        bits = (bits & 0x80000000u) ? ~bits : (bits | 0x80000000u);
+        return (static_cast<std::uint64_t>(region_index(config, params))
+                << 32) |
+               static_cast<std::uint64_t>(~bits);
+    }
+
+    private:
+    /// Check whether a spacepoint is in a seed
+    static TRACCC_HOST_DEVICE bool is_in(const seed::link_type link,
+                                         const seed& seed) {
+        return (link == seed.spB_link) || (link == seed.spM_link) ||
+               (link == seed.spT_link);
+    }
+
+    /// Get the bin of a fraction of a range, clamped to the range
+    static TRACCC_HOST_DEVICE unsigned int bin_index(
+        const scalar fraction, const unsigned int n_bins) {
+        const scalar bin = fraction * static_cast<scalar>(n_bins);
+        if (!(bin > 0.f)) {
+            return 0u;
+        }
+        const unsigned int result = static_cast<unsigned int>(bin);
+        return (result < n_bins) ? result : (n_bins - 1u);
+    }
+};
+
+}  // namespace traccc
@@ -1,6 +1,6 @@
 /** TRACCC library, part of the ACTS project (R&D line)
  *
- * (c) 2021-2022 CERN for the benefit of the ACTS project
+ * (c) 2021-2024 CERN for the benefit of the ACTS project
  *
  * Mozilla Public License Version 2.0
  */
@@ -27,11 +27,14 @@ class seeding_algorithm : public algorithm<seed_collection_types::host(
     /// Constructor for the seed finding algorithm
     ///
     /// @param mr The memory resource to use
+    /// @param multi_threaded Whether to run the seed finding on the bins of
+    ///                       the spacepoint grid in parallel
     ///
     seeding_algorithm(const seedfinder_config& finder_config,
                       const spacepoint_grid_config& grid_config,
                       const seedfilter_config& filter_config,
-                      vecmem::memory_resource& mr);
+                      vecmem::memory_resource& mr,
+                      bool multi_threaded = false);
 
     /// Operator executing the algorithm.
     ///
@@ -1,6 +1,6 @@
 /** TRACCC library, part of the ACTS project (R&D line)
  *
- * (c) 2021-2022 CERN for the benefit of the ACTS project
+ * (c) 2021-2024 CERN for the benefit of the ACTS project
  *
  * Mozilla Public License Version 2.0
  */
@@ -10,7 +10,7 @@
 // Library include(s).
 #include "traccc/edm/spacepoint.hpp"
 #include "traccc/seeding/detail/seeding_config.hpp"
-#include "traccc/seeding/detail/spacepoint_grid.hpp"
+#include "traccc/seeding/detail/spacepoint_soa_grid.hpp"
 #include "traccc/utils/algorithm.hpp"
 
 // System include(s).
@@ -19,8 +19,13 @@
 namespace traccc {
 
 /// spacepoint binning
+///
+/// Arranges the spacepoints passing the seeding selection into a phi-Z grid,
+/// sorted by radius in every bin.
+///
 class spacepoint_binning
-    : public algorithm<sp_grid(const spacepoint_collection_types::host&)> {
+    : public algorithm<sp_soa_grid_host(
+          const spacepoint_collection_types::host&)> {
 
     public:
     /// Constructor for the spacepoint binning
@@ -44,7 +49,7 @@ class spacepoint_binning
     private:
     seedfinder_config m_config;
     spacepoint_grid_config m_grid_config;
-    std::pair<output_type::axis_p0_type, output_type::axis_p1_type> m_axes;
+    std::pair<sp_soa_grid_axis_p0_type, sp_soa_grid_axis_p1_type> m_axes;
     std::reference_wrapper<vecmem::memory_resource> m_mr;
 };
 
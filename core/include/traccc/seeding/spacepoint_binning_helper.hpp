@@ -13,13 +13,32 @@
 #include "traccc/seeding/detail/seeding_config.hpp"
 #include "traccc/seeding/detail/singlet.hpp"
 #include "traccc/seeding/detail/spacepoint_grid.hpp"
+#include "traccc/seeding/detail/spacepoint_z_axis.hpp"
 
 // VecMem include(s).
 #include <vecmem/memory/memory_resource.hpp>
 
+// System include(s).
+#include <algorithm>
+#include <vector>
+
 namespace traccc {
 
-inline std::pair<detray::axis2::circular<>, detray::axis2::regular<>> get_axes(
+/// The number of regular Z bins of the spacepoint grid
+inline detray::dindex get_regular_z_bins(
+    const spacepoint_grid_config& grid_config) {
+
+    // TODO: can probably be optimized using smaller z bins
+    // and returning (multiple) neighbors only in one z-direction for forward
+    // seeds
+    // FIXME: zBinSize must include scattering
+
+    scalar zBinSize = grid_config.cotThetaMax * grid_config.deltaRMax;
+    return std::max(
+        1, (int)std::floor((grid_config.zMax - grid_config.zMin) / zBinSize));
+}
+
+inline std::pair<detray::axis2::circular<>, sp_grid_z_axis> get_axes(
     const spacepoint_grid_config& grid_config, vecmem::memory_resource& mr) {
 
     detray::dindex phiBins;
@@ -91,19 +110,13 @@ inline std::pair<detray::axis2::circular<>, detray::axis2::regular<>> get_axes(
     detray::axis2::circular m_phi_axis{phiBins, grid_config.phiMin,
                                        grid_config.phiMax, mr};
 
-    // TODO: can probably be optimized using smaller z bins
-    // and returning (multiple) neighbors only in one z-direction for forward
-    // seeds
-    // FIXME: zBinSize must include scattering
+    detray::axis2::regular m_z_axis{get_regular_z_bins(grid_config),
+                                    grid_config.zMin, grid_config.zMax, mr};
 
-    scalar zBinSize = grid_config.cotThetaMax * grid_config.deltaRMax;
-    detray::dindex zBins = std::max(
-        1, (int)std::floor((grid_config.zMax - grid_config.zMin) / zBinSize));
-
-    detray::axis2::regular m_z_axis{zBins, grid_config.zMin, grid_config.zMax,
-                                    mr};
-
-    return {m_phi_axis, m_z_axis};
+    if (grid_config.zBinEdges.empty()) {
+        return {m_phi_axis, sp_grid_z_axis{m_z_axis}};
+    }
+    return {m_phi_axis, sp_grid_z_axis{m_z_axis, grid_config.zBinEdges}};
 }
 
 inline TRACCC_HOST_DEVICE size_t is_valid_sp(const seedfinder_config& config,
@@ -125,4 +138,70 @@ inline TRACCC_HOST_DEVICE size_t is_valid_sp(const seedfinder_config& config,
     return detray::detail::invalid_value<size_t>();
 }
 
+/// Equal-occupancy Z bin edges for the spacepoint grid
+///
+/// Places the edges at the quantiles of the Z distribution of the
+/// spacepoints passing the seeding selection, to be used as
+/// @c traccc::spacepoint_grid_config::zBinEdges. Bins that would become
+/// empty because of many spacepoints at the same Z are merged, so the
+/// result may describe fewer bins than requested.
+///
+/// @param config The seed finder configuration, selecting the spacepoints
+/// @param grid_config The grid configuration, giving the Z range
+/// @param spacepoints The spacepoints of one (or more) events
+/// @param n_bins The number of bins, or 0 for as many as the regular axis
+///               has
+///
+/// @return The bin edges, from @c zMin to @c zMax
+///
+inline std::vector<scalar> adaptive_z_bin_edges(
+    const seedfinder_config& config, const spacepoint_grid_config& grid_config,
+    const spacepoint_collection_types::host& spacepoints,
+    unsigned int n_bins = 0u) {
+
+    if (n_bins == 0u) {
+        n_bins = static_cast<unsigned int>(get_regular_z_bins(grid_config));
+    }
+    n_bins = std::min(n_bins, sp_grid_z_axis::max_bins);
+
+    // The sorted Z coordinates of the selected spacepoints.
+    std::vector<scalar> zs;
+    zs.reserve(spacepoints.size());
+    for (const spacepoint& sp : spacepoints) {
+        if (is_valid_sp(config, sp) !=
+            detray::detail::invalid_value<size_t>()) {
+            zs.push_back(sp.z());
+        }
+    }
+    std::sort(zs.begin(), zs.end());
+
+    // Put the inner edges half way between neighbouring quantiles, and only
+    // keep the ones that increase.
+    std::vector<scalar> result{grid_config.zMin};
+    for (unsigned int k = 1u; (k < n_bins) && !zs.empty(); ++k) {
+        const std::size_t i = (k * zs.size()) / n_bins;
+        const scalar edge =
+            (i == 0u) ? zs[0] : static_cast<scalar>(0.5) * (zs[i - 1] + zs[i]);
+        if ((edge > result.back()) && (edge < grid_config.zMax)) {
+            result.push_back(edge);
+        }
+    }
+    result.push_back(grid_config.zMax);
+    return result;
+}
+
+/// Order of the spacepoints inside of a grid bin
+///
+/// Spacepoints are sorted by radius, and by their index in the event for
+/// equal radii, to make the order reproducible.
+///
+/// @return @c true if the first spacepoint comes before the second one
+///
+inline TRACCC_HOST_DEVICE bool grid_bin_order(scalar radius1,
+                                              unsigned int link1,
+                                              scalar radius2,
+                                              unsigned int link2) {
+    return (radius1 < radius2) || ((radius1 == radius2) && (link1 < link2));
+}
+
 }  // namespace traccc
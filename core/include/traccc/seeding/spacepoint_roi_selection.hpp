@@ -0,0 +1,61 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Library include(s).
+#include "traccc/edm/region_of_interest.hpp"
+#include "traccc/edm/spacepoint.hpp"
+#include "traccc/utils/algorithm.hpp"
+
+// VecMem include(s).
+#include <vecmem/memory/memory_resource.hpp>
+
+// System include(s).
+#include <functional>
+
+namespace traccc {
+
+/// Algorithm selecting the spacepoints inside of regions of interest
+///
+/// Running the seeding (and everything after it) on the selected spacepoints
+/// restricts the reconstruction to the regions of interest, with a cost that
+/// scales with the size of the regions instead of the size of the event.
+///
+/// Note that the seeds found on the result refer to the selected
+/// spacepoints, so the track parameter estimation has to receive the same
+/// collection.
+///
+class spacepoint_roi_selection
+    : public algorithm<spacepoint_collection_types::host(
+          const spacepoint_collection_types::host&,
+          const region_of_interest_collection_types::host&)> {
+
+    public:
+    /// Constructor for the spacepoint selection
+    ///
+    /// @param mr The memory resource to use for the result
+    ///
+    spacepoint_roi_selection(vecmem::memory_resource& mr);
+
+    /// Select the spacepoints that are inside of any of the regions
+    ///
+    /// @param spacepoints All spacepoints of the event
+    /// @param rois The regions of interest
+    /// @return The spacepoints inside of the regions, in their original order
+    ///
+    output_type operator()(
+        const spacepoint_collection_types::host& spacepoints,
+        const region_of_interest_collection_types::host& rois) const override;
+
+    private:
+    /// The memory resource to use for the result
+    std::reference_wrapper<vecmem::memory_resource> m_mr;
+
+};  // class spacepoint_roi_selection
+
+}  // namespace traccc
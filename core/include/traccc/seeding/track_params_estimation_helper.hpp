@@ -13,7 +13,9 @@
 #include "traccc/edm/track_parameters.hpp"
 
 // System include(s).
+#include <array>
 #include <cmath>
+#include <cstddef>
 
 namespace traccc {
 
@@ -142,4 +144,166 @@ inline TRACCC_HOST_DEVICE bound_vector seed_to_bound_vector(
     return params;
 }
 
+/// Seeds of a batch, with the coordinates of their spacepoints gathered into
+/// a structure-of-arrays layout
+template <std::size_t N>
+struct seed_batch {
+
+    /// The (maximal) number of seeds in a batch
+    static constexpr std::size_t capacity = N;
+
+    /// Global coordinates of the bottom spacepoints
+    std::array<scalar, N> xB, yB, zB;
+    /// Global coordinates of the middle spacepoints
+    std::array<scalar, N> xM, yM, zM;
+    /// Global coordinates of the top spacepoints
+    std::array<scalar, N> xT, yT, zT;
+};
+
+/// Gather the spacepoint coordinates of (some) seeds into a batch
+///
+/// @param sp_collection is the spacepoint collection of the seeds
+/// @param seeds is the seed array to gather from
+/// @param n_seeds is the number of seeds to gather (at most @c N)
+/// @param batch is the batch to fill
+template <typename spacepoint_collection_t, std::size_t N>
+inline TRACCC_HOST void gather_seed_batch(
+    const spacepoint_collection_t& sp_collection, const seed* seeds,
+    const std::size_t n_seeds, seed_batch<N>& batch) {
+
+    for (std::size_t i = 0; i < n_seeds; ++i) {
+        const auto& spB = sp_collection.at(seeds[i].spB_link);
+        const auto& spM = sp_collection.at(seeds[i].spM_link);
+        const auto& spT = sp_collection.at(seeds[i].spT_link);
+        batch.xB[i] = spB.x();
+        batch.yB[i] = spB.y();
+        batch.zB[i] = spB.z();
+        batch.xM[i] = spM.x();
+        batch.yM[i] = spM.y();
+        batch.zM[i] = spM.z();
+        batch.xT[i] = spT.x();
+        batch.yT[i] = spT.y();
+        batch.zT[i] = spT.z();
+    }
+}
+
+/// Batched version of @c traccc::seed_to_bound_vector
+///
+/// Estimates the angles, the charge over momentum and the time of all seeds
+/// of a batch, with the same calculation as @c traccc::seed_to_bound_vector.
+/// The loop over the seeds is written without branches, and with all frame
+/// transformations spelled out component by component, so that the compiler
+/// can evaluate multiple seeds with SIMD instructions.
+///
+/// @param batch is the batch of seeds
+/// @param n_seeds is the number of seeds in the batch
+/// @param bfield is the magnetic field
+/// @param mass is the mass of particle
+/// @param[out] phi is the array of the estimated phi angles
+/// @param[out] theta is the array of the estimated theta angles
+/// @param[out] qoverp is the array of the estimated q/p values
+/// @param[out] time is the array of the estimated times
+template <std::size_t N>
+inline TRACCC_HOST void seed_batch_to_bound_parameters(
+    const seed_batch<N>& batch, const std::size_t n_seeds,
+    const vector3& bfield, const scalar mass, scalar* phi, scalar* theta,
+    scalar* qoverp, scalar* time) {
+
+    // The z axis of the new frame (along the magnetic field direction) is
+    // the same for all seeds.
+    const scalar bnorm = getter::norm(bfield);
+    const scalar zx = bfield[0] / bnorm;
+    const scalar zy = bfield[1] / bnorm;
+    const scalar zz = bfield[2] / bnorm;
+    const scalar massInGeV = mass / unit<scalar>::GeV;
+    static constexpr scalar G = static_cast<scalar>(1.f / 24.f);
+
+    for (std::size_t i = 0; i < n_seeds; ++i) {
+
+        // The positions of the middle and top spacepoints, relative to the
+        // bottom one
+        const scalar d1x = batch.xM[i] - batch.xB[i];
+        const scalar d1y = batch.yM[i] - batch.yB[i];
+        const scalar d1z = batch.zM[i] - batch.zB[i];
+        const scalar d2x = batch.xT[i] - batch.xB[i];
+        const scalar d2y = batch.yT[i] - batch.yB[i];
+        const scalar d2z = batch.zT[i] - batch.zB[i];
+
+        // The y axis of the new frame, perpendicular to the vector from the
+        // bottom to the middle spacepoint, and the x axis
+        scalar yx = zy * d1z - zz * d1y;
+        scalar yy = zz * d1x - zx * d1z;
+        scalar yz = zx * d1y - zy * d1x;
+        const scalar ynorm = std::sqrt(yx * yx + yy * yy + yz * yz);
+        yx /= ynorm;
+        yy /= ynorm;
+        yz /= ynorm;
+        const scalar xx = yy * zz - yz * zy;
+        const scalar xy = yz * zx - yx * zz;
+        const scalar xz = yx * zy - yy * zx;
+
+        // The coordinates of the middle and top spacepoints in the new frame
+        const scalar l1x = d1x * xx + d1y * xy + d1z * xz;
+        const scalar l1y = d1x * yx + d1y * yy + d1z * yz;
+        const scalar l2x = d2x * xx + d2y * xy + d2z * xz;
+        const scalar l2y = d2x * yx + d2y * yy + d2z * yz;
+        const scalar l2z = d2x * zx + d2y * zy + d2z * zz;
+
+        // The conformal transformation of the two points, and the slope and
+        // intercept of the straight line connecting them in the u,v plane
+        const scalar r1 = l1x * l1x + l1y * l1y;
+        const scalar rn = l2x * l2x + l2y * l2y;
+        const scalar u1 = l1x / r1;
+        const scalar v1 = l1y / r1;
+        const scalar u2 = l2x / rn;
+        const scalar v2 = l2y / rn;
+        const scalar A = (v2 - v1) / (u2 - u1);
+        const scalar B = v2 - A * u2;
+
+        // Curvature (with a sign) estimate, and the (1/tanTheta) of the
+        // momentum in the new frame
+        const scalar perpA = std::sqrt(1.f + A * A);
+        const scalar rho = -2.0f * B / perpA;
+        const scalar invTanTheta =
+            l2z * std::sqrt(1.f / rn) / (1.f + G * rho * rho * rn);
+
+        // The momentum direction in the new frame, transformed back to the
+        // original frame
+        const scalar tx = 1.f;
+        const scalar ty = A;
+        const scalar tz = perpA * invTanTheta;
+        const scalar tnorm = std::sqrt(tx * tx + ty * ty + tz * tz);
+        const scalar dx = (tx * xx + ty * yx + tz * zx) / tnorm;
+        const scalar dy = (tx * xy + ty * yy + tz * zy) / tnorm;
+        const scalar dz = (tx * xz + ty * yz + tz * zz) / tnorm;
+
+        // The estimated phi and theta
+        phi[i] = std::atan2(dy, dx);
+        theta[i] = std::atan2(std::sqrt(dx * dx + dy * dy), dz);
+
+        // The estimated q/pt and q/p in [GeV/c]^-1
+        const scalar qOverPt = rho / bnorm;
+        const scalar qop = qOverPt / std::sqrt(1.f + invTanTheta * invTanTheta);
+        qoverp[i] = qop;
+
+        // The estimated momentum and velocity, and their projections along
+        // the magnetic field direction
+        const scalar pInGeV = std::abs(1.0f / qop);
+        const scalar pzInGeV = 1.0f / std::abs(qOverPt) * invTanTheta;
+        const scalar energy =
+            std::sqrt(pInGeV * pInGeV + massInGeV * massInGeV);
+        const scalar v = pInGeV / energy;
+        const scalar vz = pzInGeV / energy;
+
+        // The estimated time (use path length along magnetic field only if
+        // it's not zero)
+        const scalar pathz =
+            batch.xB[i] * zx + batch.yB[i] * zy + batch.zB[i] * zz;
+        const scalar pathr =
+            std::sqrt(batch.xB[i] * batch.xB[i] + batch.yB[i] * batch.yB[i] +
+                      batch.zB[i] * batch.zB[i]);
+        time[i] = (pathz != 0) ? (pathz / vz) : (pathr / v);
+    }
+}
+
 }  // namespace traccc
@@ -1,6 +1,6 @@
 /** TRACCC library, part of the ACTS project (R&D line)
  *
- * (c) 2021-2022 CERN for the benefit of the ACTS project
+ * (c) 2021-2024 CERN for the benefit of the ACTS project
  *
  * Mozilla Public License Version 2.0
  */
@@ -9,18 +9,24 @@
 
 #include "traccc/edm/internal_spacepoint.hpp"
 #include "traccc/seeding/detail/doublet.hpp"
+#include "traccc/seeding/detail/spacepoint_soa_grid.hpp"
 #include "traccc/seeding/detail/triplet.hpp"
 #include "traccc/seeding/triplet_finding_helper.hpp"
 #include "traccc/utils/algorithm.hpp"
 
+// System include(s).
+#include <algorithm>
+#include <array>
+
 namespace traccc {
 
 /// Triplet finding to search the compatible combintations of two doublets which
 /// share same middle spacepoint
-struct triplet_finding : public algorithm<triplet_collection_types::host(
-                             const sp_grid&, const doublet&, const lin_circle&,
-                             const doublet_collection_types::host&,
-                             const lin_circle_collection_types::host&)> {
+struct triplet_finding
+    : public algorithm<triplet_collection_types::host(
+          const sp_soa_grid_host&, const doublet&, const lin_circle&,
+          const doublet_collection_types::host&,
+          const lin_circle_collection_types::host&)> {
     /// Constructor for the triplet finding
     ///
     /// @param seedfinder_config is the configuration parameters
@@ -38,7 +44,7 @@ struct triplet_finding : public algorithm<triplet_collection_types::host(
     ///
     /// @return a vector of triplets
     output_type operator()(
-        const sp_grid& g2, const doublet& d, const lin_circle& lc,
+        const sp_soa_grid_host& g2, const doublet& d, const lin_circle& lc,
         const doublet_collection_types::host& doublet,
         const lin_circle_collection_types::host& lincol) const override {
         output_type result;
@@ -59,7 +65,8 @@ struct triplet_finding : public algorithm<triplet_collection_types::host(
     ///
     /// @return a vector of triplets
     void operator()(
-        const sp_grid& g2, const doublet& mid_bot, const lin_circle& lb,
+        const sp_soa_grid_host& g2, const doublet& mid_bot,
+        const lin_circle& lb,
         const doublet_collection_types::host& doublets_mid_top,
         const lin_circle_collection_types::host& lin_circles_mid_top,
         output_type& o) const {
@@ -68,37 +75,46 @@ struct triplet_finding : public algorithm<triplet_collection_types::host(
 
         // Run the algorithm
         auto& l = mid_bot.sp1;
-        const auto& spM = g2.bin(l.bin_idx)[l.sp_idx];
+        const internal_spacepoint<spacepoint> spM = g2.at(l);
 
         scalar iSinTheta2 = 1 + lb.cotTheta() * lb.cotTheta();
         scalar scatteringInRegion2 = m_config.maxScatteringAngle2 * iSinTheta2;
         scatteringInRegion2 *=
             m_config.sigmaScattering * m_config.sigmaScattering;
-        scalar curvature, impact_parameter;
-
-        for (size_t i = 0; i < doublets_mid_top.size(); ++i) {
-            auto& mid_top = doublets_mid_top[i];
-            auto& lt = lin_circles_mid_top[i];
-
-            if (!triplet_finding_helper::isCompatible(
-                    spM, lb, lt, m_config, iSinTheta2, scatteringInRegion2,
-                    curvature, impact_parameter)) {
-                continue;
+        std::array<scalar, batch_size> curvature, impact_parameter;
+        std::array<unsigned char, batch_size> compatible;
+
+        // Test the middle-top doublets in fixed size batches.
+        const auto n_mid_top =
+            static_cast<unsigned int>(doublets_mid_top.size());
+        for (unsigned int batch_begin = 0; batch_begin < n_mid_top;
+             batch_begin += batch_size) {
+
+            const unsigned int n = std::min(batch_size, n_mid_top - batch_begin);
+            triplet_finding_helper::isCompatible(
+                spM, lb, lin_circles_mid_top.data() + batch_begin, n, m_config,
+                iSinTheta2, scatteringInRegion2, curvature.data(),
+                impact_parameter.data(), compatible.data());
+
+            for (unsigned int i = 0; i < n; ++i) {
+                if (!compatible[i]) {
+                    continue;
+                }
+                auto& mid_top = doublets_mid_top[batch_begin + i];
+                triplets.push_back(
+                    {mid_bot.sp2,   // bottom
+                     mid_bot.sp1,   // middle
+                     mid_top.sp2,   // top
+                     curvature[i],  // curvature
+                     -impact_parameter[i] * m_filter_config.impactWeightFactor,
+                     lb.Zo()});
             }
-
-            triplets.push_back(
-                {mid_bot.sp2,  // bottom
-                 mid_bot.sp1,  // middle
-                 mid_top.sp2,  // top
-                 curvature,    // curvature
-                 -impact_parameter * m_filter_config.impactWeightFactor,
-                 lb.Zo()});
         }
 
         for (size_t i = 0; i < triplets.size(); ++i) {
             auto& current_triplet = triplets[i];
             auto& spT_idx = current_triplet.sp3;
-            auto& current_spT = g2.bin(spT_idx.bin_idx)[spT_idx.sp_idx];
+            const auto current_spT = g2.at(spT_idx);
             const auto& currentTop_r = current_spT.radius();
 
             // if two compatible seeds with high distance in r are found,
@@ -117,8 +133,7 @@ struct triplet_finding : public algorithm<triplet_collection_types::host(
 
                 auto& other_triplet = triplets[j];
                 auto& other_spT_idx = other_triplet.sp3;
-                auto& other_spT =
-                    g2.bin(other_spT_idx.bin_idx)[other_spT_idx.sp_idx];
+                const auto other_spT = g2.at(other_spT_idx);
 
                 // compared top SP should have at least deltaRMin distance
                 const auto& otherTop_r = other_spT.radius();
@@ -164,6 +179,9 @@ struct triplet_finding : public algorithm<triplet_collection_types::host(
     }
 
     private:
+    /// The number of middle-top doublets tested together
+    static constexpr unsigned int batch_size = 64;
+
     seedfinder_config m_config;
     seedfilter_config m_filter_config;
 };
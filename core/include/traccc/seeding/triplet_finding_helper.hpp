@@ -1,6 +1,6 @@
 /** TRACCC library, part of the ACTS project (R&D line)
  *
- * (c) 2021-2022 CERN for the benefit of the ACTS project
+ * (c) 2021-2024 CERN for the benefit of the ACTS project
  *
  * Mozilla Public License Version 2.0
  */
@@ -34,6 +34,34 @@ struct triplet_finding_helper {
         const lin_circle& lt, const seedfinder_config& config,
         const scalar& iSinTheta2, const scalar& scatteringInRegion2,
         scalar& curvature, scalar& impact_parameter);
+
+    /// Check which middle-top doublets can form a triplet with a middle-bottom
+    /// doublet
+    ///
+    /// This is the batched version of the previous function. All quantities
+    /// are calculated for every middle-top doublet, and the cuts are combined
+    /// without branches, so that the compiler can evaluate the doublets with
+    /// SIMD instructions. For the compatible doublets the results are the same
+    /// as the ones of the previous function.
+    ///
+    /// @param spM is middle spacepoint
+    /// @param lb is transformed coordinate of middle-bottom doublet
+    /// @param lt is transformed coordinates of the middle-top doublets
+    /// @param n is the number of middle-top doublets
+    /// @param config is configuration parameter
+    /// @param iSinTheta2 is the square of sin of pitch angle
+    /// @param scatteringInRegion2 is the threshold for scattering angle for the
+    /// lower pT cut
+    /// @param curvature is set to the curvatures of the triplets
+    /// @param impact_parameter is set to the impact parameters of the triplets
+    /// @param compatible is set to 1 for the compatible middle-top doublets,
+    /// and to 0 for all others
+    ///
+    static inline TRACCC_HOST void isCompatible(
+        const internal_spacepoint<spacepoint>& spM, const lin_circle& lb,
+        const lin_circle* lt, unsigned int n, const seedfinder_config& config,
+        scalar iSinTheta2, scalar scatteringInRegion2, scalar* curvature,
+        scalar* impact_parameter, unsigned char* compatible);
 };
 
 bool TRACCC_HOST_DEVICE triplet_finding_helper::isCompatible(
@@ -128,4 +156,78 @@ bool TRACCC_HOST_DEVICE triplet_finding_helper::isCompatible(
     return true;
 }
 
+void TRACCC_HOST triplet_finding_helper::isCompatible(
+    const internal_spacepoint<spacepoint>& spM, const lin_circle& lb,
+    const lin_circle* lt, unsigned int n, const seedfinder_config& config,
+    scalar iSinTheta2, scalar scatteringInRegion2, scalar* curvature,
+    scalar* impact_parameter, unsigned char* compatible) {
+
+    // Quantities not depending on the middle-top doublet
+    const scalar pTscatter = config.highland / config.maxPtScattering;
+
+    for (unsigned int i = 0; i < n; ++i) {
+
+        // add errors of spB-spM and spM-spT pairs and add the correlation
+        // term for errors on spM
+        const scalar error2 =
+            lt[i].Er() + lb.Er() +
+            static_cast<scalar>(2.f) *
+                (lb.cotTheta() * lt[i].cotTheta() * spM.varianceR() +
+                 spM.varianceZ()) *
+                lb.iDeltaR() * lt[i].iDeltaR();
+
+        const scalar deltaCotTheta = lb.cotTheta() - lt[i].cotTheta();
+        const scalar deltaCotTheta2 = deltaCotTheta * deltaCotTheta;
+
+        // the scattering cuts are only applied if the error is smaller than
+        // the difference in theta
+        const bool checkScattering = (deltaCotTheta2 - error2 > 0);
+        const scalar dCotThetaMinusError2 =
+            deltaCotTheta2 + error2 -
+            static_cast<scalar>(2.) * std::abs(deltaCotTheta) *
+                std::sqrt(error2);
+        bool result =
+            !(checkScattering & (dCotThetaMinusError2 > scatteringInRegion2));
+
+        // protects against division by 0
+        const scalar dU = lt[i].U() - lb.U();
+        result &= (dU != static_cast<scalar>(0.));
+        const scalar safe_dU =
+            (dU != static_cast<scalar>(0.)) ? dU : static_cast<scalar>(1.);
+
+        // A and B are evaluated as a function of the circumference parameters
+        // x_0 and y_0
+        const scalar A = (lt[i].V() - lb.V()) / safe_dU;
+        const scalar S2 = static_cast<scalar>(1.) + A * A;
+        const scalar B = lb.V() - A * lb.U();
+        const scalar B2 = B * B;
+        // calculated radius must not be smaller than minimum radius
+        result &= !(S2 < B2 * config.minHelixDiameter2);
+
+        // calculate scattering for p(T) calculated from seed curvature, or
+        // with maxPtScattering if pT is larger than that
+        const scalar iHelixDiameter2 = B2 / S2;
+        const scalar pT = config.pTPerHelixRadius * std::sqrt(S2 / B2) /
+                          static_cast<scalar>(2.);
+        const scalar pT2scatter =
+            (pT > config.maxPtScattering)
+                ? pTscatter * pTscatter
+                : static_cast<scalar>(4.) * iHelixDiameter2 *
+                      config.pT2perRadius;
+        // convert p(T) to p scaling by sin^2(theta) AND scale by
+        // 1/sin^4(theta) from rad to deltaCotTheta
+        const scalar p2scatter = pT2scatter * iSinTheta2;
+        result &= !(checkScattering &
+                    (dCotThetaMinusError2 > p2scatter * config.sigmaScattering *
+                                                config.sigmaScattering));
+
+        // calculate curvature and impact parameter
+        curvature[i] = B / std::sqrt(S2);
+        impact_parameter[i] = std::abs((A - B * spM.radius()) * spM.radius());
+        result &= !(impact_parameter[i] > config.impactMax);
+
+        compatible[i] = static_cast<unsigned char>(result);
+    }
+}
+
 }  // namespace traccc
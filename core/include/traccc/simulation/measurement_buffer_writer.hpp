@@ -0,0 +1,152 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s).
+#include "traccc/definitions/primitives.hpp"
+#include "traccc/definitions/qualifiers.hpp"
+#include "traccc/definitions/track_parametrization.hpp"
+#include "traccc/edm/measurement.hpp"
+#include "traccc/edm/track_parameters.hpp"
+#include "traccc/utils/philox.hpp"
+
+// Detray include(s).
+#include "detray/geometry/shapes/annulus2D.hpp"
+#include "detray/geometry/shapes/line.hpp"
+#include "detray/propagator/base_actor.hpp"
+
+// System include(s).
+#include <array>
+#include <cstdint>
+#include <type_traits>
+
+namespace traccc {
+
+/// Actor smearing the hits of a propagated track into measurements, and
+/// writing them into a (resizable) measurement buffer
+///
+/// The host- and device-capable counterpart of @c traccc::smearing_writer.
+/// The measurements are smeared the same way as by
+/// @c traccc::measurement_smearer, with counter-based random numbers keyed by
+/// the event, the particle and the surface of every hit.
+///
+template <typename transform3_t>
+struct measurement_buffer_writer : detray::actor {
+
+    using scalar_type = typename transform3_t::scalar_type;
+
+    struct state {
+
+        /// Constructor
+        ///
+        /// @param measurements The buffer to write the measurements into
+        /// @param seed The seed of the random numbers (the event index)
+        /// @param particle_id The particle being propagated
+        /// @param stddev The standard deviations of the smearing
+        /// @param max_measurements The largest number of measurements to
+        ///                         write for the particle
+        ///
+        TRACCC_HOST_DEVICE
+        state(measurement_collection_types::device& measurements,
+              std::uint64_t seed, std::uint64_t particle_id,
+              const std::array<scalar, 2>& stddev,
+              unsigned int max_measurements)
+            : m_measurements(measurements),
+              m_seed(seed),
+              m_particle_id(particle_id),
+              m_stddev(stddev),
+              m_max_measurements(max_measurements) {}
+
+        /// The buffer to write the measurements into
+        measurement_collection_types::device& m_measurements;
+        /// The seed of the random numbers
+        std::uint64_t m_seed;
+        /// The particle being propagated
+        std::uint64_t m_particle_id;
+        /// The standard deviations of the smearing
+        std::array<scalar, 2> m_stddev;
+        /// The largest number of measurements to write for the particle
+        unsigned int m_max_measurements;
+        /// The number of measurements written for the particle
+        unsigned int m_n_measurements = 0u;
+    };
+
+    /// Visitor setting up the smeared measurement of a surface
+    struct measurement_kernel {
+
+        template <typename mask_group_t, typename index_t>
+        TRACCC_HOST_DEVICE inline void operator()(
+            const mask_group_t& /*mask_group*/, const index_t& /*index*/,
+            const bound_track_parameters& bound_params,
+            const std::array<scalar, 2>& offset,
+            const std::array<scalar, 2>& stddev, measurement& meas) const {
+
+            using mask_t = typename mask_group_t::value_type;
+            const point2 local = bound_params.bound_local();
+
+            // Line detector
+            if constexpr (std::is_same_v<typename mask_t::local_frame_type,
+                                         detray::line2D<transform3_t>>) {
+                const scalar_type local0 = std::abs(local[0]) + offset[0];
+                meas.local[0] = (local0 > 0.f) ? local0 : 0.f;
+                meas.variance[0] = stddev[0] * stddev[0];
+                meas.meas_dim = 1u;
+                meas.subs.set_indices({e_bound_loc0, e_bound_loc0});
+            }
+            // Annulus strip
+            else if constexpr (std::is_same_v<typename mask_t::shape,
+                                              detray::annulus2D>) {
+                meas.local[1] = local[1] + offset[0];
+                meas.variance[1] = stddev[1] * stddev[1];
+                meas.meas_dim = 1u;
+                meas.subs.set_indices({e_bound_loc1, e_bound_loc0});
+            }
+            // Else
+            else {
+                meas.local = {local[0] + offset[0], local[1] + offset[1]};
+                meas.variance = {stddev[0] * stddev[0], stddev[1] * stddev[1]};
+                meas.meas_dim = 2u;
+                meas.subs.set_indices({e_bound_loc0, e_bound_loc1});
+            }
+        }
+    };
+
+    template <typename propagator_state_t>
+    TRACCC_HOST_DEVICE void operator()(state& writer_state,
+                                       propagator_state_t& propagation) const {
+
+        auto& navigation = propagation._navigation;
+
+        // triggered only for sensitive surfaces
+        if (!navigation.is_on_sensitive() ||
+            (writer_state.m_n_measurements >=
+             writer_state.m_max_measurements)) {
+            return;
+        }
+
+        const auto sf = navigation.get_surface();
+        const std::array<scalar, 2> normal = philox4x32::normal(
+            writer_state.m_seed, writer_state.m_particle_id,
+            sf.barcode().value());
+        const std::array<scalar, 2> offset{
+            normal[0] * writer_state.m_stddev[0],
+            normal[1] * writer_state.m_stddev[1]};
+
+        measurement meas;
+        meas.surface_link = sf.barcode();
+        sf.template visit_mask<measurement_kernel>(
+            propagation._stepping._bound_params, offset,
+            writer_state.m_stddev, meas);
+
+        const auto index = writer_state.m_measurements.push_back(meas);
+        writer_state.m_measurements.at(index).measurement_id = index;
+        ++writer_state.m_n_measurements;
+    }
+};
+
+}  // namespace traccc
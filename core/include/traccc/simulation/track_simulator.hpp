@@ -0,0 +1,146 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s).
+#include "traccc/definitions/common.hpp"
+#include "traccc/definitions/primitives.hpp"
+#include "traccc/definitions/qualifiers.hpp"
+#include "traccc/edm/measurement.hpp"
+#include "traccc/edm/track_parameters.hpp"
+#include "traccc/simulation/measurement_buffer_writer.hpp"
+
+// Detray include(s).
+#include "detray/propagator/actor_chain.hpp"
+#include "detray/propagator/actors/aborters.hpp"
+#include "detray/propagator/actors/parameter_resetter.hpp"
+#include "detray/propagator/actors/parameter_transporter.hpp"
+#include "detray/propagator/propagation_config.hpp"
+#include "detray/propagator/propagator.hpp"
+
+// System include(s).
+#include <array>
+#include <cstdint>
+#include <tuple>
+#include <utility>
+
+namespace traccc {
+
+/// Configuration of the simulation of single tracks
+struct track_simulation_config {
+
+    /// The configuration of the propagation
+    detray::propagation::config<scalar> propagation{};
+    /// The standard deviations of the measurement smearing
+    std::array<scalar, 2> smearing{50.f * unit<scalar>::um,
+                                   50.f * unit<scalar>::um};
+    /// The largest number of measurements to write for one track
+    unsigned int max_measurements_per_track = 64u;
+};
+
+/// Simulation of single (particle gun) tracks, on the host or on a device
+///
+/// The tracks are propagated with the same actors as in
+/// @c traccc::simulator, apart from the material interactions, which
+/// detray's @c random_scatterer can only do on the host. Their smeared
+/// measurements are written into a measurement buffer directly.
+///
+template <typename stepper_t, typename navigator_t>
+class track_simulator {
+
+    public:
+    // vector type
+    template <typename T>
+    using vector_type = typename navigator_t::template vector_type<T>;
+
+    // navigator candidate type
+    using intersection_type = typename navigator_t::intersection_type;
+
+    /// Configuration type
+    using config_type = track_simulation_config;
+
+    // transform3 type
+    using transform3_type = typename stepper_t::transform3_type;
+
+    // Detector type
+    using detector_type = typename navigator_t::detector_type;
+
+    // Field type
+    using bfield_type = typename stepper_t::magnetic_field_type;
+
+    // Actor types
+    using aborter = detray::pathlimit_aborter;
+    using transporter = detray::parameter_transporter<transform3_type>;
+    using resetter = detray::parameter_resetter<transform3_type>;
+    using writer = measurement_buffer_writer<transform3_type>;
+
+    using actor_chain_type =
+        detray::actor_chain<std::tuple, aborter, transporter, resetter,
+                            writer>;
+
+    // Propagator type
+    using propagator_type =
+        detray::propagator<stepper_t, navigator_t, actor_chain_type>;
+
+    /// Constructor with a detector
+    TRACCC_HOST_DEVICE
+    track_simulator(const detector_type& det, const bfield_type& field,
+                    const config_type& cfg)
+        : m_detector(det), m_field(field), m_cfg(cfg) {}
+
+    /// Simulate one track
+    ///
+    /// @param track The (free) parameters of the track at its origin
+    /// @param event The index of the event, seeding the smearing
+    /// @param particle_id The identifier of the particle of the track
+    /// @param measurements The (resizable) buffer of the measurements
+    /// @param nav_candidates The candidate vector of the navigation
+    ///
+    TRACCC_HOST_DEVICE void simulate(
+        const free_track_parameters& track, std::uint64_t event,
+        std::uint64_t particle_id,
+        measurement_collection_types::device& measurements,
+        vector_type<intersection_type>&& nav_candidates) const {
+
+        // Create propagator
+        propagator_type propagator(m_cfg.propagation);
+
+        // Create propagator state
+        typename propagator_type::state propagation(
+            track, m_field, m_detector, std::move(nav_candidates));
+
+        // Set the stepper constraint
+        propagation._stepping
+            .template set_constraint<detray::step::constraint::e_accuracy>(
+                m_cfg.propagation.stepping.step_constraint);
+
+        // Actor states
+        typename aborter::state aborter_state{};
+        aborter_state.set_path_limit(m_cfg.propagation.stepping.path_limit);
+        typename transporter::state transporter_state{};
+        typename resetter::state resetter_state{};
+        typename writer::state writer_state(measurements, event, particle_id,
+                                            m_cfg.smearing,
+                                            m_cfg.max_measurements_per_track);
+
+        propagator.propagate(propagation,
+                             std::tie(aborter_state, transporter_state,
+                                      resetter_state, writer_state));
+    }
+
+    private:
+    /// The detector to simulate the tracks in
+    const detector_type& m_detector;
+    /// The magnetic field
+    const bfield_type m_field;
+    /// The configuration of the simulation
+    config_type m_cfg;
+
+};  // class track_simulator
+
+}  // namespace traccc
@@ -0,0 +1,152 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s).
+#include "traccc/clusterization/component_connection.hpp"
+#include "traccc/clusterization/spacepoint_formation.hpp"
+#include "traccc/clusterization/time_window_partitioner.hpp"
+#include "traccc/edm/cell.hpp"
+#include "traccc/edm/measurement.hpp"
+#include "traccc/edm/seed.hpp"
+#include "traccc/edm/spacepoint.hpp"
+#include "traccc/edm/track_parameters.hpp"
+#include "traccc/seeding/detail/seeding_config.hpp"
+#include "traccc/seeding/seeding_algorithm.hpp"
+#include "traccc/seeding/track_params_estimation.hpp"
+
+// VecMem include(s).
+#include <vecmem/memory/memory_resource.hpp>
+
+// System include(s).
+#include <cstddef>
+#include <functional>
+#include <vector>
+
+namespace traccc {
+
+/// The reconstruction result of one time window of a stream
+struct time_window_result {
+
+    /// The index of the window in the stream
+    std::size_t index = 0;
+    /// The start time of the window
+    scalar begin = 0.f;
+    /// The end time of the window
+    scalar end = 0.f;
+
+    /// The measurements finalised in this window
+    measurement_collection_types::host measurements;
+    /// The spacepoints used by the seeding of this window. The ones carried
+    /// over from the previous window come first, followed by the spacepoints
+    /// of @c measurements.
+    spacepoint_collection_types::host spacepoints;
+    /// The number of spacepoints carried over from the previous window
+    std::size_t n_carried_spacepoints = 0;
+    /// The seeds found in this window, linking to @c spacepoints
+    seed_collection_types::host seeds;
+    /// The track parameters estimated for @c seeds
+    bound_track_parameters_collection_types::host params;
+
+};  // struct time_window_result
+
+/// Driver reconstructing a continuous stream of cells in time windows
+///
+/// The cells of the stream are split into consecutive time windows with
+/// @c traccc::time_window_partitioner, and every window is clusterized and
+/// seeded as soon as it is complete, so the latency is bounded by the window
+/// length. The state at the window boundaries is carried over incrementally,
+/// instead of re-processing the overlap of the windows:
+///  - The clusters with cells close to the end of a window are not turned
+///    into measurements in that window. Their cells are clusterized again
+///    with the next window, so that every cluster is finalised exactly once.
+///  - The spacepoints close to the end of a window are added to the seeding
+///    of the next window. Seeds made only of such spacepoints were found by
+///    the previous window already, and are dropped.
+///
+class streaming_reconstruction {
+
+    public:
+    /// The results of the windows completed by one call
+    using output_type = std::vector<time_window_result>;
+
+    /// Constructor for the driver
+    ///
+    /// @param config The configuration of the time windows
+    /// @param finder_config The seed finding configuration
+    /// @param grid_config The spacepoint grid configuration
+    /// @param filter_config The seed filtering configuration
+    /// @param modules The modules that the cells of the stream link to
+    /// @param mr The memory resource to use for the result objects
+    ///
+    streaming_reconstruction(const time_window_config& config,
+                             const seedfinder_config& finder_config,
+                             const spacepoint_grid_config& grid_config,
+                             const seedfilter_config& filter_config,
+                             const cell_module_collection_types::host& modules,
+                             vecmem::memory_resource& mr);
+
+    /// Add cells of the stream, reconstructing the windows they complete
+    ///
+    /// @param cells The next cells of the stream
+    /// @return The results of the windows that were completed
+    ///
+    output_type push(const cell_collection_types::host& cells);
+
+    /// Signal the end of the stream, reconstructing all remaining windows
+    ///
+    /// @return The results of the remaining windows
+    ///
+    output_type finish();
+
+    private:
+    /// Reconstruct the next window of the partitioner
+    ///
+    /// @param finishing Whether the end of the stream was signalled, in which
+    ///                  case nothing is carried over from the last window
+    ///
+    time_window_result process(bool finishing);
+
+    /// The configuration of the time windows
+    time_window_config m_config;
+    /// The seed finding configuration
+    seedfinder_config m_finder_config;
+    /// The modules that the cells of the stream link to
+    const cell_module_collection_types::host& m_modules;
+    /// The memory resource to use
+    std::reference_wrapper<vecmem::memory_resource> m_mr;
+
+    /// @name Sub-algorithms used by the driver
+    /// @{
+
+    /// Time window partitioner
+    time_window_partitioner m_partitioner;
+    /// Cluster creation algorithm
+    component_connection m_cc;
+    /// Spacepoint formation algorithm
+    spacepoint_formation m_spacepoint_formation;
+    /// Seeding algorithm
+    seeding_algorithm m_seeding;
+    /// Track parameter estimation algorithm
+    track_params_estimation m_track_parameter_estimation;
+
+    /// @}
+
+    /// @name State carried over to the next window
+    /// @{
+
+    /// The cells of the clusters that were not finalised yet
+    cell_collection_types::host m_deferred_cells;
+    /// The spacepoints close to the end of the previous window
+    spacepoint_collection_types::host m_carried_spacepoints;
+
+    /// @}
+
+};  // class streaming_reconstruction
+
+}  // namespace traccc
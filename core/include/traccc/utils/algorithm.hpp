@@ -9,7 +9,10 @@
 #pragma once
 
 // System include(s).
+#include <cstddef>
 #include <functional>
+#include <future>
+#include <tuple>
 #include <type_traits>
 #include <utility>
 
@@ -52,6 +55,122 @@ class algorithm<R(A...)> {
     virtual output_type operator()(A... args) const = 0;
 };
 
+template <typename T>
+class async_algorithm {};
+
+/**
+ * @brief Asynchronous counterpart of @c traccc::algorithm.
+ *
+ * Submitting an input to an asynchronous algorithm returns right away, with
+ * a future of the output. Device algorithms can implement it by launching
+ * their work on a stream, and fulfilling the future once the stream gets to
+ * the point where the output is ready. The arguments need to outlive the
+ * future.
+ *
+ * @param A The input types of the algorithm
+ * @param R The output type of the algorithm
+ */
+template <typename R, typename... A>
+class async_algorithm<R(A...)> {
+    public:
+    using output_type = R;
+
+    using function_type = R(A...);
+
+    static_assert(
+        std::conjunction<rvalue_or_const_lvalue<A>...>::value,
+        "All arguments must be either affine types (rvalue references), or "
+        "immutable constant types (const lvalue references).");
+
+    virtual ~async_algorithm() {}
+
+    virtual std::future<output_type> submit(A... args) const = 0;
+};
+
+template <typename T>
+class async_adaptor {};
+
+/**
+ * @brief Asynchronous algorithm running a synchronous one on a new thread.
+ *
+ * Meant for algorithms that do not have an asynchronous implementation of
+ * their own. The adapted algorithm is held by reference, and needs to outlive
+ * the adaptor and all futures received from it. The affine arguments are
+ * moved into the new thread, while the constant ones are passed on by
+ * reference.
+ */
+template <typename R, typename... A>
+class async_adaptor<R(A...)> : public async_algorithm<R(A...)> {
+    public:
+    explicit async_adaptor(const algorithm<R(A...)>& alg) : m_alg(alg) {}
+
+    std::future<R> submit(A... args) const override {
+        return std::async(std::launch::async, std::cref(m_alg),
+                          pass<A>(args)...);
+    }
+
+    private:
+    /// Pass constant arguments by reference, and move the affine ones
+    template <typename T>
+    static auto pass(std::remove_reference_t<T>& arg) {
+        if constexpr (std::is_lvalue_reference_v<T>) {
+            return std::cref(arg);
+        } else {
+            return std::move(arg);
+        }
+    }
+
+    const algorithm<R(A...)>& m_alg;
+};
+
+/**
+ * @brief Compile-time composition of algorithms.
+ *
+ * Calls its algorithms one after the other, passing the output of each as
+ * a temporary to the next, and returns the output of the last one. Unlike
+ * @c traccc::compose, it does not type-erase its algorithms. So the calls
+ * can be inlined, and no allocation happens per call. The output types of
+ * the algorithms are not converted either, so device algorithms can hand
+ * their buffers directly to the next ones, keeping the intermediate results
+ * on the device.
+ *
+ * The algorithms are stored by value. Use @c std::cref to compose algorithms
+ * that can not, or should not, be copied.
+ *
+ * @param F The types of the algorithms, in the order of the calls
+ */
+template <typename... F>
+class algorithm_chain {
+    static_assert(sizeof...(F) > 0, "An algorithm chain needs an algorithm.");
+
+    public:
+    explicit constexpr algorithm_chain(F... f) : m_f(std::move(f)...) {}
+
+    template <typename... A>
+    constexpr decltype(auto) operator()(A&&... args) const {
+        return call<0>(std::forward<A>(args)...);
+    }
+
+    private:
+    template <std::size_t I, typename... A>
+    constexpr decltype(auto) call(A&&... args) const {
+        if constexpr (I + 1 == sizeof...(F)) {
+            return std::invoke(std::get<I>(m_f), std::forward<A>(args)...);
+        } else {
+            return call<I + 1>(
+                std::invoke(std::get<I>(m_f), std::forward<A>(args)...));
+        }
+    }
+
+    std::tuple<F...> m_f;
+};
+
+/// Create an @c traccc::algorithm_chain out of some algorithms
+template <typename... F>
+constexpr auto chain(F&&... f) {
+    return algorithm_chain<std::decay_t<F>...>(std::forward<F>(f)...);
+}
+
 template <typename A, typename B, typename C, typename... R>
 auto compose(
     std::function<std::remove_const_t<std::remove_reference_t<B>>(A)> f,
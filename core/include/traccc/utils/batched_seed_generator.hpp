@@ -0,0 +1,92 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Library include(s).
+#include "traccc/edm/track_parameters.hpp"
+#include "traccc/edm/truth_seed_input.hpp"
+#include "traccc/utils/parallel_for.hpp"
+#include "traccc/utils/truth_seed.hpp"
+
+// VecMem include(s).
+#include <vecmem/memory/memory_resource.hpp>
+
+// System include(s).
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace traccc {
+
+/// Seed track parameter generator for all particles of an event at once
+///
+/// Does the same surface operations as @c traccc::seed_generator, but smears
+/// the parameters with the counter-based @c traccc::philox4x32 generator,
+/// instead of a sequential one. So the seeds are made in parallel (with
+/// @c traccc::details::parallel_for), and depend only on the seed, the event
+/// and the index of the particles. The same seeds are made on a device by
+/// @c traccc::device::make_truth_seeds.
+///
+template <typename detector_t>
+class batched_seed_generator {
+
+    public:
+    /// The number of seeds made by one task
+    static constexpr std::size_t chunk_size = 256u;
+
+    /// Constructor with detector
+    ///
+    /// @param det input detector
+    /// @param stddevs standard deviations for parameter smearing
+    /// @param seed seed of the smearing
+    batched_seed_generator(const detector_t& det,
+                           const std::array<scalar, e_bound_size>& stddevs,
+                           std::uint64_t seed = 0)
+        : m_detector(det), m_stddevs(stddevs), m_seed(seed) {}
+
+    /// Seed generator operation
+    ///
+    /// @param inputs the truth states of the particles
+    /// @param event the index of the event
+    /// @param mr the memory resource of the result
+    /// @return the (smeared) seeds, in the order of the inputs
+    bound_track_parameters_collection_types::host operator()(
+        const truth_seed_input_collection_types::host& inputs,
+        std::uint64_t event, vecmem::memory_resource& mr) const {
+
+        const std::size_t n_seeds = inputs.size();
+        bound_track_parameters_collection_types::host seeds(n_seeds, &mr);
+
+        details::parallel_for(
+            (n_seeds + chunk_size - 1u) / chunk_size, [&](std::size_t chunk) {
+                const std::size_t end =
+                    std::min(n_seeds, (chunk + 1u) * chunk_size);
+                for (std::size_t i = chunk * chunk_size; i < end; ++i) {
+                    const truth_seed_input& input = inputs[i];
+                    seeds[i] = details::make_truth_seed(
+                        m_detector, input.surface_link, input.free_param);
+                    details::smear_truth_seed(seeds[i], m_stddevs, m_seed,
+                                              event, i);
+                }
+            });
+
+        return seeds;
+    }
+
+    private:
+    /// Detector object
+    const detector_t& m_detector;
+    /// Standard deviations for parameter smearing
+    std::array<scalar, e_bound_size> m_stddevs;
+    /// Seed of the smearing
+    std::uint64_t m_seed;
+
+};  // class batched_seed_generator
+
+}  // namespace traccc
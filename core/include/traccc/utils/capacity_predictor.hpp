@@ -0,0 +1,72 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// System include(s).
+#include <cstddef>
+#include <vector>
+
+namespace traccc {
+
+/// Configuration of @c traccc::capacity_predictor
+struct capacity_predictor_config {
+    /// The number of previous events to learn from
+    unsigned int history = 16;
+    /// The factor to multiply the largest seen ratio with
+    float margin = 1.2f;
+};
+
+/// Predictor of the output capacity needed by a processing stage
+///
+/// It learns the ratio of the output and input sizes of a stage from the
+/// previously processed events, and predicts the capacity that the output
+/// of the next event will need as the largest ratio seen over a window of
+/// recent events, times a safety margin. Allows (device) algorithms to
+/// allocate their output buffers ahead of time, instead of counting the
+/// output before allocating it. The algorithms have to detect when a
+/// prediction turns out to be too small, and fall back to counting then.
+///
+/// The predictor is not thread-safe.
+///
+class capacity_predictor {
+
+    public:
+    /// Configuration type
+    using config = capacity_predictor_config;
+
+    /// Constructor with a configuration
+    explicit capacity_predictor(const config& cfg = {});
+
+    /// Whether there were any events to learn from yet
+    bool ready() const;
+
+    /// Predict the output capacity needed for a given input size
+    ///
+    /// @param n_input The size of the input of the stage
+    /// @return The (non-zero) capacity to allocate for the output
+    ///
+    unsigned int predict(unsigned int n_input) const;
+
+    /// Record the output size of an event
+    ///
+    /// @param n_input The size of the input of the stage
+    /// @param n_output The (actual) size of the output of the stage
+    ///
+    void record(unsigned int n_input, unsigned int n_output);
+
+    private:
+    /// The configuration of the predictor
+    config m_cfg;
+    /// The output / input ratios of the recent events, in a ring buffer
+    std::vector<float> m_ratios;
+    /// The position in @c m_ratios to record the next event at
+    std::size_t m_next = 0;
+
+};  // class capacity_predictor
+
+}  // namespace traccc
@@ -0,0 +1,154 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// VecMem include(s).
+#include <vecmem/memory/memory_resource.hpp>
+
+// System include(s).
+#include <cstddef>
+#include <iosfwd>
+#include <map>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+namespace traccc {
+
+/// Allocation statistics of (a part of) a memory resource
+struct memory_usage {
+
+    /// The number of allocations
+    std::size_t allocations = 0;
+    /// The number of deallocations
+    std::size_t deallocations = 0;
+    /// The total number of bytes allocated
+    std::size_t allocated_bytes = 0;
+    /// The number of bytes allocated at the moment
+    std::size_t current_bytes = 0;
+    /// The largest number of bytes that were allocated at the same time
+    std::size_t peak_bytes = 0;
+
+    /// Add the statistics of another (independent) resource to these ones
+    ///
+    /// The counters are summed, while the peak becomes the larger of the two
+    /// peaks. I.e. the result describes the most demanding one of multiple
+    /// resources used in the same way.
+    ///
+    void merge(const memory_usage& other);
+
+};  // struct memory_usage
+
+/// Allocation statistics of an instrumented memory resource
+struct memory_statistics {
+
+    /// Statistics of all allocations
+    memory_usage total;
+    /// Statistics of the allocations made in the individual stages
+    std::map<std::string, memory_usage> stages;
+
+    /// Add the statistics of another (independent) resource to these ones
+    void merge(const memory_statistics& other);
+
+};  // struct memory_statistics
+
+/// Printout helper for @c traccc::memory_statistics
+std::ostream& operator<<(std::ostream& out, const memory_statistics& stats);
+
+/// Memory resource recording statistics about the (de-)allocations made
+/// through it
+///
+/// It counts the allocations and the bytes allocated from the upstream
+/// resource, and keeps track of their high-water mark. Every allocation is
+/// also attributed to the processing stage that the allocating thread is in,
+/// as declared with @c traccc::instrumented_memory_resource::stage. A
+/// deallocation is always attributed to the stage that made the allocation.
+///
+/// The resource is thread-safe.
+///
+class instrumented_memory_resource : public vecmem::memory_resource {
+
+    public:
+    /// Helper declaring the processing stage of the current thread
+    ///
+    /// Allocations made by the thread while the object is alive, through any
+    /// instrumented resource, are attributed to the stage. Stages may be
+    /// nested, the previous stage is restored by the destructor.
+    ///
+    class stage {
+
+        public:
+        /// Enter a processing stage
+        ///
+        /// @param name The name of the stage, which must be a string literal
+        ///             (or some other string outliving the resources)
+        ///
+        explicit stage(const char* name);
+        /// Leave the processing stage
+        ~stage();
+
+        /// The object can not be copied
+        stage(const stage&) = delete;
+        /// The object can not be copied
+        stage& operator=(const stage&) = delete;
+
+        private:
+        /// The stage that was set before this object
+        const char* m_previous;
+
+    };  // class stage
+
+    /// Name of the stage of the allocations made outside of any stage
+    static constexpr const char* no_stage = "(no stage)";
+
+    /// Constructor
+    ///
+    /// @param upstream The resource to forward the (de-)allocations to
+    ///
+    explicit instrumented_memory_resource(vecmem::memory_resource& upstream);
+
+    /// Get the statistics collected so far
+    memory_statistics statistics() const;
+
+    /// Restart the high-water marks from the current memory use
+    ///
+    /// Allows measuring the peak memory use of distinct periods, for
+    /// instance of the individual events.
+    ///
+    void reset_peak();
+
+    private:
+    /// @name Function(s) implementing @c vecmem::memory_resource
+    /// @{
+
+    /// Allocate memory from the upstream resource
+    void* do_allocate(std::size_t bytes, std::size_t alignment) override;
+    /// Give memory back to the upstream resource
+    void do_deallocate(void* ptr, std::size_t bytes,
+                       std::size_t alignment) override;
+    /// Compare the resource with another one
+    bool do_is_equal(
+        const vecmem::memory_resource& other) const noexcept override;
+
+    /// @}
+
+    /// The resource forwarded to
+    vecmem::memory_resource& m_upstream;
+
+    /// Mutex protecting the statistics
+    mutable std::mutex m_mutex;
+    /// Statistics of all allocations
+    memory_usage m_total;
+    /// Statistics of the individual stages, indexed by their name literals
+    std::unordered_map<const char*, memory_usage> m_stages;
+    /// The stages that the live allocations were made in
+    std::unordered_map<void*, const char*> m_live;
+
+};  // class instrumented_memory_resource
+
+}  // namespace traccc
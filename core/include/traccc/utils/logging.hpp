@@ -0,0 +1,140 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// System include(s).
+#include <iosfwd>
+#include <sstream>
+
+/// The lowest level of the log messages compiled into the code
+///
+/// Set through the @c TRACCC_LOG_LEVEL CMake option. Messages of lower levels
+/// are removed by the preprocessor, together with the evaluation of their
+/// contents.
+///
+#ifndef TRACCC_MIN_LOG_LEVEL
+#define TRACCC_MIN_LOG_LEVEL 1
+#endif  // TRACCC_MIN_LOG_LEVEL
+
+namespace traccc::logging {
+
+/// The levels of the log messages
+enum class level : int {
+    /// Detailed messages, possibly from every iteration of the algorithms
+    flood = 0,
+    /// Informational messages
+    info = 1,
+    /// Warnings
+    warning = 2,
+    /// Errors
+    error = 3
+};
+
+/// Set the stream that the log messages are written to
+///
+/// The messages are written to @c std::cout by default. The stream must
+/// outlive its use for the logging.
+///
+/// @param out The stream to write the messages to
+///
+void set_output(std::ostream& out);
+
+/// Write out the log messages buffered by the calling thread
+void flush();
+
+/// One log message, collected in the buffer of the calling thread
+///
+/// The messages of every thread are buffered separately, and are only
+/// written to the output in blocks of whole lines. That happens once the
+/// buffer of the thread is large enough, for every warning and error, when
+/// @c traccc::logging::flush() is called, and when the thread exits. So
+/// threads logging at the same time don't wait on each other for every
+/// message, and their lines don't get mixed up.
+///
+class message {
+
+    public:
+    /// Start a new message
+    ///
+    /// @param lvl The level of the message
+    /// @param source The name of the code writing the message, which must be
+    ///               a string literal
+    ///
+    message(level lvl, const char* source);
+    /// Finish the message
+    ~message();
+
+    /// The object can not be copied
+    message(const message&) = delete;
+    /// The object can not be copied
+    message& operator=(const message&) = delete;
+
+    /// The stream to write the contents of the message to
+    std::ostream& stream() { return m_stream; }
+
+    private:
+    /// The level of the message
+    level m_level;
+    /// The contents of the message
+    std::ostringstream m_stream;
+
+};  // class message
+
+}  // namespace traccc::logging
+
+/// @name Macros writing log messages
+///
+/// The level is given as one of @c FLOOD, @c INFO, @c WARNING or @c ERROR.
+/// The message is anything that can be streamed into an @c std::ostream,
+/// with the parts separated by @c <<, and without a newline at its end.
+///
+/// @{
+
+/// Write a log message of level @c LEVEL, if @c CONDITION is true
+#define TRACCC_LOG_IF(LEVEL, CONDITION, SOURCE, MSG) \
+    TRACCC_LOG_IF_##LEVEL(CONDITION, SOURCE, MSG)
+/// Write a log message of level @c LEVEL
+#define TRACCC_LOG(LEVEL, SOURCE, MSG) TRACCC_LOG_IF(LEVEL, true, SOURCE, MSG)
+
+/// Helper macro writing the log message of a level compiled into the code
+#define TRACCC_LOG_MESSAGE(LVL, CONDITION, SOURCE, MSG)               \
+    do {                                                              \
+        if (CONDITION) {                                              \
+            ::traccc::logging::message(::traccc::logging::level::LVL, \
+                                       SOURCE)                        \
+                    .stream()                                         \
+                << MSG;                                               \
+        }                                                             \
+    } while (false)
+
+#if TRACCC_MIN_LOG_LEVEL <= 0
+#define TRACCC_LOG_IF_FLOOD(CONDITION, SOURCE, MSG) \
+    TRACCC_LOG_MESSAGE(flood, CONDITION, SOURCE, MSG)
+#else
+#define TRACCC_LOG_IF_FLOOD(CONDITION, SOURCE, MSG) static_cast<void>(0)
+#endif
+#if TRACCC_MIN_LOG_LEVEL <= 1
+#define TRACCC_LOG_IF_INFO(CONDITION, SOURCE, MSG) \
+    TRACCC_LOG_MESSAGE(info, CONDITION, SOURCE, MSG)
+#else
+#define TRACCC_LOG_IF_INFO(CONDITION, SOURCE, MSG) static_cast<void>(0)
+#endif
+#if TRACCC_MIN_LOG_LEVEL <= 2
+#define TRACCC_LOG_IF_WARNING(CONDITION, SOURCE, MSG) \
+    TRACCC_LOG_MESSAGE(warning, CONDITION, SOURCE, MSG)
+#else
+#define TRACCC_LOG_IF_WARNING(CONDITION, SOURCE, MSG) static_cast<void>(0)
+#endif
+#if TRACCC_MIN_LOG_LEVEL <= 3
+#define TRACCC_LOG_IF_ERROR(CONDITION, SOURCE, MSG) \
+    TRACCC_LOG_MESSAGE(error, CONDITION, SOURCE, MSG)
+#else
+#define TRACCC_LOG_IF_ERROR(CONDITION, SOURCE, MSG) static_cast<void>(0)
+#endif
+
+/// @}
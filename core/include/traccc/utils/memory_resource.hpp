@@ -1,6 +1,6 @@
 /** TRACCC library, part of the ACTS project (R&D line)
  *
- * (c) 2022 CERN for the benefit of the ACTS project
+ * (c) 2022-2024 CERN for the benefit of the ACTS project
  *
  * Mozilla Public License Version 2.0
  */
@@ -12,6 +12,9 @@
 
 namespace traccc {
 
+// Forward declaration(s).
+class workspace_resource;
+
 // Simple struct for combining multiple memory resources
 struct memory_resource {
 
@@ -20,6 +23,22 @@ struct memory_resource {
 
     // optional host accesible memory resource
     vecmem::memory_resource* host = nullptr;
+
+    // optional workspace for the temporary buffers of the algorithms, in the
+    // same memory as @c main
+    workspace_resource* workspace = nullptr;
+
+    // optional arena for the buffers that live for (at most) one event, in
+    // the same memory as @c main. Its owner releases everything allocated
+    // from it in one go, once the event is finished (for instance with
+    // @c traccc::workspace_resource::reset()).
+    vecmem::memory_resource* event_arena = nullptr;
+
+    // the resource to allocate the per-event buffers from: the event arena
+    // if there is one, @c main otherwise
+    vecmem::memory_resource& event_memory() const {
+        return (event_arena != nullptr) ? *event_arena : main;
+    }
 };
 
 }  // namespace traccc
\ No newline at end of file
@@ -0,0 +1,73 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// System include(s).
+#include <cstddef>
+#include <mutex>
+#include <optional>
+#include <utility>
+#include <vector>
+
+namespace traccc {
+
+/// Thread-safe pool of objects handed back for re-use
+///
+/// Meant for recycling the (host) results of an algorithm. The users of the
+/// results hand them back to the pool once they are done with them, and the
+/// algorithm fills them again for a later event. Re-using the memory of the
+/// objects, instead of allocating new ones for every event.
+///
+/// @tparam T The type of the pooled objects
+///
+template <typename T>
+class object_pool {
+
+    public:
+    /// Take an object out of the pool
+    ///
+    /// @return One of the objects handed back to the pool, or an empty
+    ///         optional if there are none
+    ///
+    std::optional<T> acquire() {
+
+        std::lock_guard<std::mutex> lock{m_mutex};
+        if (m_objects.empty()) {
+            return {};
+        }
+        std::optional<T> result{std::move(m_objects.back())};
+        m_objects.pop_back();
+        return result;
+    }
+
+    /// Hand an object (back) to the pool
+    ///
+    /// @param object The object to re-use later
+    ///
+    void release(T&& object) {
+
+        std::lock_guard<std::mutex> lock{m_mutex};
+        m_objects.push_back(std::move(object));
+    }
+
+    /// The number of objects in the pool
+    std::size_t size() const {
+
+        std::lock_guard<std::mutex> lock{m_mutex};
+        return m_objects.size();
+    }
+
+    private:
+    /// Mutex protecting the pool
+    mutable std::mutex m_mutex;
+    /// The objects in the pool
+    std::vector<T> m_objects;
+
+};  // class object_pool
+
+}  // namespace traccc
@@ -0,0 +1,29 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// System include(s).
+#include <cstddef>
+#include <functional>
+
+namespace traccc::details {
+
+/// Call a function for every index of a range, in parallel if possible
+///
+/// The indices are processed by OpenMP tasks (of a @c taskloop) when the
+/// core library was built with @c TRACCC_USE_OPENMP, by TBB tasks when it was
+/// built with TBB, and one after the other otherwise. This allows header-only
+/// (templated) algorithms to make use of TBB or OpenMP, without having to
+/// depend on them publicly.
+///
+/// @param n    The number of indices to process
+/// @param func The function to call with every index in [0, n)
+///
+void parallel_for(std::size_t n, const std::function<void(std::size_t)>& func);
+
+}  // namespace traccc::details
@@ -0,0 +1,106 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s).
+#include "traccc/definitions/primitives.hpp"
+#include "traccc/definitions/qualifiers.hpp"
+
+// System include(s).
+#include <array>
+#include <cmath>
+#include <cstdint>
+
+namespace traccc {
+
+/// The Philox4x32-10 counter-based random number generator
+///
+/// Instead of advancing an internal state, the generator computes its
+/// random numbers as a (bijective) function of a counter and a key. So any
+/// random number can be computed independently, in any order, and by any
+/// thread, as long as the counter and the key identifying it are known.
+///
+/// See J. K. Salmon et al., "Parallel random numbers: as easy as 1, 2, 3",
+/// SC '11, doi:10.1145/2063384.2063405.
+///
+struct philox4x32 {
+
+    /// The type of the counters of the generator
+    using counter_type = std::array<std::uint32_t, 4>;
+    /// The type of the keys of the generator
+    using key_type = std::array<std::uint32_t, 2>;
+
+    /// The random numbers belonging to one counter and key
+    TRACCC_HOST_DEVICE
+    static inline counter_type generate(counter_type counter, key_type key) {
+
+        for (unsigned int i = 0; i < 10u; ++i) {
+            const std::uint64_t p0 =
+                static_cast<std::uint64_t>(0xD2511F53u) * counter[0];
+            const std::uint64_t p1 =
+                static_cast<std::uint64_t>(0xCD9E8D57u) * counter[2];
+            counter = {static_cast<std::uint32_t>(p1 >> 32) ^ counter[1] ^
+                           key[0],
+                       static_cast<std::uint32_t>(p1),
+                       static_cast<std::uint32_t>(p0 >> 32) ^ counter[3] ^
+                           key[1],
+                       static_cast<std::uint32_t>(p0)};
+            key[0] += 0x9E3779B9u;
+            key[1] += 0xBB67AE85u;
+        }
+        return counter;
+    }
+
+    /// The generator key of a 64-bit seed
+    TRACCC_HOST_DEVICE
+    static inline key_type make_key(std::uint64_t seed) {
+        return {static_cast<std::uint32_t>(seed),
+                static_cast<std::uint32_t>(seed >> 32)};
+    }
+
+    /// The generator counter of two 64-bit indices
+    TRACCC_HOST_DEVICE
+    static inline counter_type make_counter(std::uint64_t index0,
+                                            std::uint64_t index1) {
+        return {static_cast<std::uint32_t>(index0),
+                static_cast<std::uint32_t>(index0 >> 32),
+                static_cast<std::uint32_t>(index1),
+                static_cast<std::uint32_t>(index1 >> 32)};
+    }
+
+    /// A uniformly distributed number in (0, 1) from a random integer
+    TRACCC_HOST_DEVICE
+    static inline scalar uniform(std::uint32_t value) {
+        return (static_cast<scalar>(value) + 0.5f) * 2.3283064e-10f;
+    }
+
+    /// Two independent, normally distributed numbers from two random
+    /// integers (with the Box-Muller transform)
+    TRACCC_HOST_DEVICE
+    static inline std::array<scalar, 2> normal(std::uint32_t value0,
+                                               std::uint32_t value1) {
+        const scalar radius = std::sqrt(-2.f * std::log(uniform(value0)));
+        const scalar angle =
+            2.f * static_cast<scalar>(M_PI) * uniform(value1);
+        return {radius * std::cos(angle), radius * std::sin(angle)};
+    }
+
+    /// Two independent, normally distributed numbers identified by a seed
+    /// and two indices
+    TRACCC_HOST_DEVICE
+    static inline std::array<scalar, 2> normal(std::uint64_t seed,
+                                               std::uint64_t index0,
+                                               std::uint64_t index1) {
+        const counter_type random =
+            generate(make_counter(index0, index1), make_key(seed));
+        return normal(random[0], random[1]);
+    }
+
+};  // struct philox4x32
+
+}  // namespace traccc
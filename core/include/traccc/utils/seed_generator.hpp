@@ -9,6 +9,7 @@
 
 // Library include(s).
 #include "traccc/edm/track_parameters.hpp"
+#include "traccc/utils/truth_seed.hpp"
 
 // detray include(s).
 #include "detray/geometry/barcode.hpp"
@@ -31,7 +32,6 @@ namespace traccc {
 template <typename detector_t>
 struct seed_generator {
     using matrix_operator = typename transform3::matrix_actor;
-    using cxt_t = typename detector_t::geometry_context;
 
     /// Constructor with detector
     ///
@@ -52,39 +52,8 @@ struct seed_generator {
         const detray::geometry::barcode surface_link,
         const free_track_parameters& free_param) {
 
-        // Get bound parameter
-        const detray::surface<detector_t> sf{m_detector, surface_link};
-
-        const cxt_t ctx{};
-        auto bound_vec = sf.free_to_bound_vector(ctx, free_param.vector());
-
-        auto bound_cov =
-            matrix_operator().template zero<e_bound_size, e_bound_size>();
-
-        bound_track_parameters bound_param{surface_link, bound_vec, bound_cov};
-
-        // Type definitions
-        using transform3_type = typename detector_t::transform3;
-        using intersection_type =
-            detray::intersection2D<typename detector_t::surface_type,
-                                   transform3_type>;
-        using interactor_type =
-            detray::pointwise_material_interactor<transform3_type>;
-
-        intersection_type sfi;
-        sfi.sf_desc = m_detector.surface(surface_link);
-        sf.template visit_mask<
-            detray::intersection_update<detray::ray_intersector>>(
-            detray::detail::ray<transform3_type>(free_param.vector()), sfi,
-            m_detector.transform_store());
-
-        // Apply interactor
-        typename interactor_type::state interactor_state;
-        interactor_state.do_multiple_scattering = false;
-        interactor_type{}.update(
-            bound_param, interactor_state,
-            static_cast<int>(detray::navigation::direction::e_backward), sf,
-            sfi.cos_incidence_angle);
+        bound_track_parameters bound_param =
+            details::make_truth_seed(m_detector, surface_link, free_param);
 
         for (std::size_t i = 0; i < e_bound_size; i++) {
 
@@ -0,0 +1,57 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// VecMem include(s).
+#include <vecmem/memory/memory_resource.hpp>
+
+// System include(s).
+#include <cstddef>
+
+namespace traccc {
+
+/// Host memory resource serving the allocations from per-thread caches
+///
+/// The many small, short lived temporaries of the host algorithms make the
+/// worker threads of a multi-threaded job contend on the global heap. This
+/// resource hands them to TBB's scalable allocator instead, which serves
+/// them from caches private to each thread. So that unlike the caching
+/// resources of VecMem, it can be shared by any number of threads without
+/// locking.
+///
+/// When traccc is built without TBB's memory allocator, the resource falls
+/// back to the global (aligned) @c operator new.
+///
+class thread_caching_memory_resource : public vecmem::memory_resource {
+
+    public:
+    /// Whether the allocations are really cached per thread
+    ///
+    /// @return @c true if TBB's scalable allocator is used, @c false if the
+    ///         resource falls back to the global heap
+    ///
+    static bool is_thread_caching();
+
+    private:
+    /// @name Function(s) implementing @c vecmem::memory_resource
+    /// @{
+
+    /// Allocate memory from the cache of the calling thread
+    void* do_allocate(std::size_t bytes, std::size_t alignment) override;
+    /// Give memory back to the thread caches
+    void do_deallocate(void* ptr, std::size_t bytes,
+                       std::size_t alignment) override;
+    /// Compare the resource with another one
+    bool do_is_equal(
+        const vecmem::memory_resource& other) const noexcept override;
+
+    /// @}
+
+};  // class thread_caching_memory_resource
+
+}  // namespace traccc
@@ -0,0 +1,103 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// System include(s).
+#include <cstddef>
+#include <limits>
+
+namespace traccc::trace {
+
+/// Value of the event number when no event is being processed
+static constexpr std::size_t no_event = std::numeric_limits<std::size_t>::max();
+
+/// Get the event number that the current thread is processing
+std::size_t current_event();
+
+/// Helper declaring the event that the current thread is processing
+///
+/// The trace ranges opened on the thread while the object is alive carry the
+/// event number as their payload. Scopes may be nested, the previous event
+/// number is restored by the destructor.
+///
+class event_scope {
+
+    public:
+    /// Start the processing of an event on the current thread
+    explicit event_scope(std::size_t event);
+    /// Finish the processing of the event
+    ~event_scope();
+
+    /// The object can not be copied
+    event_scope(const event_scope&) = delete;
+    /// The object can not be copied
+    event_scope& operator=(const event_scope&) = delete;
+
+    private:
+    /// The event number that was set before this object
+    std::size_t m_previous;
+
+};  // class event_scope
+
+/// Range annotation, visible in the timelines of the profilers
+///
+/// Depending on the build configuration, the range is forwarded to NVTX
+/// (Nsight Systems), ITT (VTune) and/or ROCTx (rocprof). Without any of them
+/// the object does nothing.
+///
+class range {
+
+    public:
+    /// Open a range on the current thread
+    ///
+    /// @param name The name of the range, which must be a string literal (or
+    ///             some other string outliving the application)
+    ///
+    explicit range(const char* name);
+    /// Close the range
+    ~range();
+
+    /// The object can not be copied
+    range(const range&) = delete;
+    /// The object can not be copied
+    range& operator=(const range&) = delete;
+
+};  // class range
+
+}  // namespace traccc::trace
+
+/// @name Macros annotating the traccc code for the profilers
+///
+/// They compile to nothing, unless the project is built with
+/// @c TRACCC_ENABLE_TRACING.
+///
+/// @{
+
+/// Helper macros making unique variable names
+#define TRACCC_TRACE_CONCAT_IMPL(A, B) A##B
+#define TRACCC_TRACE_CONCAT(A, B) TRACCC_TRACE_CONCAT_IMPL(A, B)
+
+#ifdef TRACCC_ENABLE_TRACING
+/// Annotate the rest of the current scope as a range called @c NAME
+#define TRACCC_TRACE_RANGE(NAME)                      \
+    const ::traccc::trace::range TRACCC_TRACE_CONCAT( \
+        traccc_trace_range_, __LINE__) {              \
+        NAME                                          \
+    }
+/// Declare that the rest of the current scope processes event @c EVENT
+#define TRACCC_TRACE_EVENT(EVENT)                           \
+    const ::traccc::trace::event_scope TRACCC_TRACE_CONCAT( \
+        traccc_trace_event_, __LINE__) {                    \
+        EVENT                                               \
+    }
+#else
+#define TRACCC_TRACE_RANGE(NAME) static_cast<void>(0)
+#define TRACCC_TRACE_EVENT(EVENT) static_cast<void>(EVENT)
+#endif  // TRACCC_ENABLE_TRACING
+
+/// @}
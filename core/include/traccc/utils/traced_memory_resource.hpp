@@ -0,0 +1,57 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// VecMem include(s).
+#include <vecmem/memory/memory_resource.hpp>
+
+// System include(s).
+#include <cstddef>
+
+namespace traccc {
+
+/// Memory resource annotating the (de-)allocations of another one
+///
+/// Every allocation and deallocation made through the resource shows up as a
+/// range in the profiler timelines (see @c traccc/utils/trace.hpp). It only
+/// forwards the calls otherwise.
+///
+class traced_memory_resource : public vecmem::memory_resource {
+
+    public:
+    /// Constructor
+    ///
+    /// @param upstream The resource to forward the (de-)allocations to
+    /// @param name The name of the ranges, which must be a string literal
+    ///
+    traced_memory_resource(vecmem::memory_resource& upstream,
+                           const char* name);
+
+    private:
+    /// @name Function(s) implementing @c vecmem::memory_resource
+    /// @{
+
+    /// Allocate memory from the upstream resource
+    void* do_allocate(std::size_t bytes, std::size_t alignment) override;
+    /// Give memory back to the upstream resource
+    void do_deallocate(void* ptr, std::size_t bytes,
+                       std::size_t alignment) override;
+    /// Compare the resource with another one
+    bool do_is_equal(
+        const vecmem::memory_resource& other) const noexcept override;
+
+    /// @}
+
+    /// The resource forwarded to
+    vecmem::memory_resource& m_upstream;
+    /// The name of the ranges
+    const char* m_name;
+
+};  // class traced_memory_resource
+
+}  // namespace traccc
@@ -0,0 +1,122 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Library include(s).
+#include "traccc/definitions/qualifiers.hpp"
+#include "traccc/edm/track_parameters.hpp"
+#include "traccc/utils/philox.hpp"
+
+// detray include(s).
+#include "detray/geometry/barcode.hpp"
+#include "detray/geometry/surface.hpp"
+#include "detray/navigation/intersection/ray_intersector.hpp"
+#include "detray/navigation/intersection_kernel.hpp"
+#include "detray/propagator/actors/pointwise_material_interactor.hpp"
+
+// System include(s).
+#include <array>
+#include <cstdint>
+
+namespace traccc::details {
+
+/// Make the (unsmeared) truth seed of a particle
+///
+/// The free parameters are bound to the surface, and the energy loss in its
+/// material is undone, as the seed is meant to describe the particle right
+/// before it crossed the surface.
+///
+/// @param det          The detector holding the surface
+/// @param surface_link The surface of the first measurement of the particle
+/// @param free_param   The parameters of the particle on that surface
+/// @return The bound parameters of the seed, with a zero covariance
+///
+template <typename detector_t>
+TRACCC_HOST_DEVICE inline bound_track_parameters make_truth_seed(
+    const detector_t& det, const detray::geometry::barcode surface_link,
+    const free_track_parameters& free_param) {
+
+    using matrix_operator = typename transform3::matrix_actor;
+    using transform3_type = typename detector_t::transform3;
+    using intersection_type =
+        detray::intersection2D<typename detector_t::surface_type,
+                               transform3_type>;
+    using interactor_type =
+        detray::pointwise_material_interactor<transform3_type>;
+
+    // Get bound parameter
+    const detray::surface<detector_t> sf{det, surface_link};
+
+    const typename detector_t::geometry_context ctx{};
+    auto bound_vec = sf.free_to_bound_vector(ctx, free_param.vector());
+
+    auto bound_cov =
+        matrix_operator().template zero<e_bound_size, e_bound_size>();
+
+    bound_track_parameters bound_param{surface_link, bound_vec, bound_cov};
+
+    intersection_type sfi;
+    sfi.sf_desc = det.surface(surface_link);
+    sf.template visit_mask<
+        detray::intersection_update<detray::ray_intersector>>(
+        detray::detail::ray<transform3_type>(free_param.vector()), sfi,
+        det.transform_store());
+
+    // Apply interactor
+    typename interactor_type::state interactor_state;
+    interactor_state.do_multiple_scattering = false;
+    interactor_type{}.update(
+        bound_param, interactor_state,
+        static_cast<int>(detray::navigation::direction::e_backward), sf,
+        sfi.cos_incidence_angle);
+
+    return bound_param;
+}
+
+/// Smear the parameters of a truth seed
+///
+/// The normal distributed offsets come from @c traccc::philox4x32, as a
+/// function of the seed, the event and the index of the particle. So the
+/// smearing of every particle can be done independently, by any thread,
+/// with the same result.
+///
+/// @param param   The parameters to smear (and set the covariance of)
+/// @param stddevs The standard deviations of the smearing
+/// @param seed    The seed of the random numbers
+/// @param event   The index of the event
+/// @param index   The index of the particle in the event
+///
+TRACCC_HOST_DEVICE inline void smear_truth_seed(
+    bound_track_parameters& param,
+    const std::array<scalar, e_bound_size>& stddevs, std::uint64_t seed,
+    std::uint64_t event, std::uint64_t index) {
+
+    using matrix_operator = typename transform3::matrix_actor;
+
+    // Two counters give eight random integers, for the six parameters.
+    const philox4x32::key_type key = philox4x32::make_key(seed);
+    const std::array<philox4x32::counter_type, 2> random{
+        philox4x32::generate(philox4x32::make_counter(2u * index, event), key),
+        philox4x32::generate(philox4x32::make_counter(2u * index + 1u, event),
+                             key)};
+
+    for (unsigned int i = 0; i < e_bound_size; i += 2u) {
+
+        const philox4x32::counter_type& values = random[i / 4u];
+        const std::array<scalar, 2> normal =
+            philox4x32::normal(values[i % 4u], values[i % 4u + 1u]);
+        for (unsigned int j = 0; j < 2u; ++j) {
+            matrix_operator().element(param.vector(), i + j, 0) +=
+                stddevs[i + j] * normal[j];
+            matrix_operator().element(param.covariance(), i + j, i + j) =
+                stddevs[i + j] * stddevs[i + j];
+        }
+    }
+}
+
+}  // namespace traccc::details
@@ -0,0 +1,125 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// System include(s).
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <string>
+#include <string_view>
+
+namespace traccc {
+
+/// (Analytic) estimate of the work done by (part of) an algorithm
+struct work_estimate {
+
+    /// The number of bytes read from memory
+    std::uint64_t bytes_read = 0;
+    /// The number of bytes written to memory
+    std::uint64_t bytes_written = 0;
+    /// The number of floating point operations
+    std::uint64_t flops = 0;
+
+    /// Add another estimate to this one
+    work_estimate& operator+=(const work_estimate& other);
+
+};  // struct work_estimate
+
+/// Peak performance of a device, that the estimated work is compared to
+struct device_peaks {
+
+    /// The name of the device
+    std::string name;
+    /// The peak memory bandwidth [GB/s], 0 if unknown
+    double bandwidth = 0.;
+    /// The peak (single precision) floating point throughput [GFLOP/s], 0 if
+    /// unknown
+    double gflops = 0.;
+
+};  // struct device_peaks
+
+/// Thread-safe accumulator of the work estimated by the algorithms
+///
+/// The algorithms record the work that they do (as estimated from the sizes
+/// of their collections) with @c traccc::count_work. The estimates are
+/// collected by the counter that the calling thread declared with
+/// @c traccc::work_counter::scope, under the name of the scope. Without a
+/// scope, the algorithms do not estimate anything.
+///
+class work_counter {
+
+    public:
+    /// Helper declaring the processing stage of the current thread
+    ///
+    /// All work counted by the thread while the object is alive is added to
+    /// the given stage of the given counter. Scopes may be nested, the
+    /// previous scope is restored by the destructor.
+    ///
+    class scope {
+
+        public:
+        /// Enter a processing stage
+        ///
+        /// @param counter The counter to add the work to
+        /// @param stage The name of the stage
+        ///
+        scope(work_counter& counter, std::string_view stage);
+        /// Enter a processing stage, if a counter is given
+        ///
+        /// @param counter The counter to add the work to, or @c nullptr to
+        ///                leave the current scope of the thread unchanged
+        /// @param stage The name of the stage
+        ///
+        scope(work_counter* counter, std::string_view stage);
+        /// Leave the processing stage
+        ~scope();
+
+        /// The object can not be copied
+        scope(const scope&) = delete;
+        /// The object can not be copied
+        scope& operator=(const scope&) = delete;
+
+        private:
+        /// The counter of the previous scope
+        work_counter* m_previous_counter;
+        /// The stage of the previous scope
+        std::string_view m_previous_stage;
+
+    };  // class scope
+
+    /// Add work to a stage
+    void add(std::string_view stage, const work_estimate& work);
+
+    /// Get the work estimated in each stage so far
+    std::map<std::string, work_estimate> stages() const;
+
+    private:
+    /// Mutex protecting the estimates
+    mutable std::mutex m_mutex;
+    /// The work estimated in each stage
+    std::map<std::string, work_estimate, std::less<> > m_stages;
+
+};  // class work_counter
+
+/// Whether the work done on the current thread is being counted
+///
+/// Allows the algorithms to skip collecting the information needed for the
+/// estimates, when they would not be used.
+///
+bool counting_work();
+
+/// Record the work done by an algorithm on the current thread
+///
+/// It is a no-op, unless the thread is in a
+/// @c traccc::work_counter::scope.
+///
+void count_work(const work_estimate& work);
+
+}  // namespace traccc
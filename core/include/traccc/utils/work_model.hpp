@@ -0,0 +1,150 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s).
+#include "traccc/edm/cell.hpp"
+#include "traccc/edm/measurement.hpp"
+#include "traccc/edm/seed.hpp"
+#include "traccc/edm/spacepoint.hpp"
+#include "traccc/edm/track_parameters.hpp"
+#include "traccc/edm/track_state.hpp"
+#include "traccc/utils/work_counter.hpp"
+
+// System include(s).
+#include <cstddef>
+#include <cstdint>
+
+/// Analytic models of the work done by the reconstruction algorithms
+///
+/// The models estimate the memory traffic and the floating point operations
+/// of the algorithms from the sizes of their input and output collections.
+/// They describe the host and the device implementations alike, counting
+/// every element as being read / written the minimal number of times that
+/// the algorithm needs. They are meant for placing the algorithms on a
+/// roofline plot, not for exact accounting.
+///
+namespace traccc::work_model {
+
+/// The average number of spacepoints that every middle spacepoint is paired
+/// with in the doublet search of the seeding
+static constexpr std::uint64_t seeding_doublets_per_spacepoint = 32u;
+/// The average number of Runge-Kutta steps made between two surfaces in the
+/// track finding and fitting
+static constexpr std::uint64_t rk_steps_per_surface = 4u;
+/// Floating point operations of one Runge-Kutta step, with the transport of
+/// the Jacobian
+static constexpr std::uint64_t flops_per_rk_step = 1500u;
+/// Floating point operations of one Kalman filter update (or smoothing) step
+static constexpr std::uint64_t flops_per_kalman_update = 600u;
+
+/// Work of the clusterization (CCL and measurement creation)
+///
+/// @param n_cells The number of input cells
+/// @param n_measurements The number of output measurements
+///
+inline work_estimate clusterization(std::size_t n_cells,
+                                    std::size_t n_measurements) {
+
+    // The cells are read once for the connected component labeling, and
+    // once for the measurement creation, with the labels written and read
+    // in between.
+    return {2u * n_cells * (sizeof(cell) + sizeof(unsigned int)),
+            n_cells * sizeof(unsigned int) +
+                n_measurements * sizeof(measurement),
+            // Weighted mean and variance of every cell's 2D position, and
+            // the normalization of every measurement.
+            12u * n_cells + 10u * n_measurements};
+}
+
+/// Work of the spacepoint formation
+///
+/// @param n_measurements The number of measurements
+///
+inline work_estimate spacepoint_formation(std::size_t n_measurements) {
+
+    // Reading the measurement and its module's 4x4 transform, and a 3x3
+    // matrix-vector product plus translation for the global position.
+    return {n_measurements * (sizeof(measurement) + 16u * sizeof(scalar)),
+            n_measurements * sizeof(spacepoint), 18u * n_measurements};
+}
+
+/// Work of the seeding (binning, doublet and triplet finding, filtering)
+///
+/// @param n_spacepoints The number of input spacepoints
+/// @param n_seeds The number of output seeds
+///
+inline work_estimate seeding(std::size_t n_spacepoints, std::size_t n_seeds) {
+
+    const std::uint64_t n_doublets =
+        n_spacepoints * seeding_doublets_per_spacepoint;
+    // Binning reads and writes every spacepoint, the doublet search reads
+    // the compatible neighbours of every middle spacepoint, and the triplet
+    // search reads every doublet pair once (approximated by the doublets).
+    return {n_spacepoints * sizeof(spacepoint) * 2u +
+                n_doublets * (sizeof(spacepoint) + 2u * sizeof(unsigned int)),
+            n_spacepoints * sizeof(spacepoint) +
+                n_doublets * 2u * sizeof(unsigned int) +
+                n_seeds * sizeof(seed),
+            // The coordinate transformation of every doublet, and the
+            // curvature / impact parameter calculation of every triplet.
+            20u * n_doublets + 40u * n_doublets + 30u * n_seeds};
+}
+
+/// Work of the track parameter estimation
+///
+/// @param n_seeds The number of seeds
+///
+inline work_estimate track_params_estimation(std::size_t n_seeds) {
+
+    // A conformal circle fit of three spacepoints per seed.
+    return {n_seeds * (sizeof(seed) + 3u * sizeof(spacepoint)),
+            n_seeds * sizeof(bound_track_parameters), 200u * n_seeds};
+}
+
+/// Work of the combinatorial Kalman filter track finding
+///
+/// @param n_seeds The number of input seeds
+/// @param n_candidates The number of measurements on the found tracks
+///
+inline work_estimate track_finding(std::size_t n_seeds,
+                                   std::size_t n_candidates) {
+
+    // Every measurement on a track took a propagation to its surface and a
+    // Kalman update, with the bound track parameters read and written.
+    const std::uint64_t n_steps = n_seeds + n_candidates;
+    return {n_seeds * sizeof(bound_track_parameters) +
+                n_steps * (sizeof(measurement) +
+                           sizeof(bound_track_parameters)),
+            n_steps * sizeof(bound_track_parameters) +
+                n_candidates * sizeof(measurement),
+            n_steps * (rk_steps_per_surface * flops_per_rk_step +
+                       flops_per_kalman_update)};
+}
+
+/// Work of the Kalman filter track fitting (with smoothing)
+///
+/// @param n_tracks The number of tracks
+/// @param n_states The total number of track states (measurements) of the
+///                 tracks
+///
+inline work_estimate track_fitting(std::size_t n_tracks,
+                                   std::size_t n_states) {
+
+    // A forward filtering pass with propagation, and a backward smoothing
+    // pass, over every track state.
+    using state_type = track_state<transform3>;
+    return {n_tracks * sizeof(bound_track_parameters) +
+                2u * n_states * (sizeof(measurement) + sizeof(state_type)),
+            2u * n_states * sizeof(state_type) +
+                n_tracks * sizeof(bound_track_parameters),
+            n_states * (rk_steps_per_surface * flops_per_rk_step +
+                        2u * flops_per_kalman_update)};
+}
+
+}  // namespace traccc::work_model
@@ -0,0 +1,111 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// VecMem include(s).
+#include <vecmem/memory/memory_resource.hpp>
+
+// System include(s).
+#include <cstddef>
+#include <vector>
+
+namespace traccc {
+
+/// Memory resource handing out slices of one persistent block of memory
+///
+/// It is meant for the temporary buffers of an algorithm, which are created
+/// and destroyed during every execution of the algorithm, or for all the
+/// buffers of an event (as a @c traccc::memory_resource::event_arena), which
+/// are released together at the end of the event. Allocations are served by
+/// bumping an offset into a block allocated from an upstream resource, and
+/// deallocations are no-ops.
+///
+/// Allocations that do not fit into the block are served by the upstream
+/// resource directly. The next @c reset() replaces the block with one large
+/// enough for all of the memory used since the previous reset, growing it at
+/// least geometrically. So after a few events an algorithm no longer needs
+/// to allocate memory from the upstream resource at all.
+///
+/// The resource is not thread-safe, and must not be shared between
+/// algorithms running concurrently.
+///
+class workspace_resource : public vecmem::memory_resource {
+
+    public:
+    /// Constructor
+    ///
+    /// @param upstream The resource to allocate the memory block(s) from
+    /// @param capacity The initial size of the memory block, in bytes
+    ///
+    explicit workspace_resource(vecmem::memory_resource& upstream,
+                                std::size_t capacity = 0);
+    /// Destructor
+    ~workspace_resource() override;
+
+    /// Make sure that the memory block is at least of a given size
+    ///
+    /// Allows sizing the workspace ahead of time. Must not be called while
+    /// memory from the workspace is in use.
+    ///
+    /// @param capacity The size of the memory block, in bytes
+    ///
+    void reserve(std::size_t capacity);
+
+    /// Release all memory handed out since the previous reset
+    ///
+    /// Grows the memory block if the previous allocations did not fit into
+    /// it. Must not be called while memory from the workspace is in use.
+    ///
+    void reset();
+
+    /// The size of the memory block, in bytes
+    std::size_t capacity() const;
+    /// The number of bytes handed out since the previous reset
+    std::size_t used() const;
+
+    private:
+    /// @name Function(s) implemented from @c vecmem::memory_resource
+    /// @{
+
+    /// Allocate memory from the workspace
+    void* do_allocate(std::size_t bytes, std::size_t alignment) override;
+    /// De-allocate a previously allocated memory slice
+    void do_deallocate(void* ptr, std::size_t bytes,
+                       std::size_t alignment) override;
+    /// Compare the equality of @c *this memory resource with another
+    bool do_is_equal(
+        const vecmem::memory_resource& other) const noexcept override;
+
+    /// @}
+
+    /// Description of an allocation served by the upstream resource
+    struct overflow_allocation {
+        void* ptr;
+        std::size_t bytes;
+        std::size_t alignment;
+    };
+
+    /// The upstream memory resource
+    vecmem::memory_resource& m_upstream;
+    /// The memory block that allocations are served from
+    void* m_block = nullptr;
+    /// The size of the memory block
+    std::size_t m_capacity = 0;
+    /// The offset of the first free byte in the memory block
+    std::size_t m_offset = 0;
+    /// The number of bytes used since the previous reset
+    std::size_t m_used = 0;
+    /// Whether any allocation did not fit into the block since the previous
+    /// reset
+    bool m_overflowed = false;
+    /// The allocations that did not fit into the memory block
+    std::vector<overflow_allocation> m_overflow;
+
+};  // class workspace_resource
+
+}  // namespace traccc
@@ -0,0 +1,340 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Local include(s).
+#include "traccc/ambiguity_resolution/flat_greedy_ambiguity_resolution_algorithm.hpp"
+
+#include "traccc/utils/trace.hpp"
+
+// VecMem include(s).
+#include <vecmem/containers/vector.hpp>
+
+// System include(s).
+#include <algorithm>
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+namespace traccc {
+
+namespace {
+
+/// The flattened tracks and measurements of the ambiguity resolution
+///
+/// Tracks are identified by their index among the tracks passing the
+/// minimum-size requirement, measurements by their index among the sorted,
+/// unique measurement identifiers.
+///
+struct resolution_state {
+
+    /// The index of every track in the input container
+    std::vector<std::size_t> input_index;
+    /// The chi-square of every track
+    std::vector<scalar> chi2;
+
+    /// The measurements of track @c i are in
+    /// <tt>[track_offsets[i], track_offsets[i + 1])</tt> of
+    /// @c track_measurements
+    std::vector<std::size_t> track_offsets;
+    std::vector<std::size_t> track_measurements;
+
+    /// The (distinct) tracks of measurement @c m are in
+    /// <tt>[measurement_offsets[m], measurement_offsets[m + 1])</tt> of
+    /// @c measurement_tracks
+    std::vector<std::size_t> measurement_offsets;
+    std::vector<std::size_t> measurement_tracks;
+
+    /// The number of selected tracks of every measurement
+    std::vector<std::size_t> n_selected_tracks;
+    /// The number of shared measurements of every track
+    std::vector<std::size_t> n_shared;
+    /// Whether every track is (still) selected
+    std::vector<char> selected;
+
+    /// The number of measurements of a track
+    std::size_t n_measurements(std::size_t track) const {
+        return track_offsets[track + 1] - track_offsets[track];
+    }
+    /// The relative amount of shared measurements of a track
+    double relative_shared(std::size_t track) const {
+        return static_cast<double>(n_shared[track]) /
+               static_cast<double>(n_measurements(track));
+    }
+};
+
+/// Indexed d-ary max-heap of the tracks, ordered by their "badness"
+///
+/// The order is the one in which @c greedy_ambiguity_resolution_algorithm
+/// evicts the tracks: the largest relative amount of shared measurements
+/// first, then the largest chi-square, then the smallest index.
+///
+class track_heap {
+
+    public:
+    /// The number of children of every node
+    static constexpr std::size_t arity = 4u;
+
+    /// Constructor with all tracks of the state
+    explicit track_heap(const resolution_state& state)
+        : m_state(state), m_heap(state.chi2.size()), m_pos(m_heap.size()) {
+
+        for (std::size_t i = 0; i < m_heap.size(); ++i) {
+            m_heap[i] = i;
+            m_pos[i] = i;
+        }
+        for (std::size_t i = m_heap.size(); i-- > 0;) {
+            sift_down(i);
+        }
+    }
+
+    /// Whether the heap is empty
+    bool empty() const { return m_heap.empty(); }
+
+    /// Remove the worst track from the heap, and return its index
+    std::size_t pop() {
+        const std::size_t top = m_heap.front();
+        move(m_heap.size() - 1, 0);
+        m_heap.pop_back();
+        if (!m_heap.empty()) {
+            sift_down(0);
+        }
+        return top;
+    }
+
+    /// Restore the heap order after the "badness" of a track decreased
+    void decreased(std::size_t track) { sift_down(m_pos[track]); }
+
+    private:
+    /// Whether track @c a is to be evicted before track @c b
+    bool worse(std::size_t a, std::size_t b) const {
+        const double rel_a = m_state.relative_shared(a);
+        const double rel_b = m_state.relative_shared(b);
+        if (rel_a != rel_b) {
+            return rel_a > rel_b;
+        }
+        if (m_state.chi2[a] != m_state.chi2[b]) {
+            return m_state.chi2[a] > m_state.chi2[b];
+        }
+        return a < b;
+    }
+
+    /// Move the track from heap position @c from to @c to
+    void move(std::size_t from, std::size_t to) {
+        m_heap[to] = m_heap[from];
+        m_pos[m_heap[to]] = to;
+    }
+
+    /// Move the track at heap position @c i down to its place
+    void sift_down(std::size_t i) {
+        const std::size_t track = m_heap[i];
+        while (true) {
+            const std::size_t first = arity * i + 1;
+            if (first >= m_heap.size()) {
+                break;
+            }
+            const std::size_t last = std::min(first + arity, m_heap.size());
+            std::size_t child = first;
+            for (std::size_t j = first + 1; j < last; ++j) {
+                if (worse(m_heap[j], m_heap[child])) {
+                    child = j;
+                }
+            }
+            if (!worse(m_heap[child], track)) {
+                break;
+            }
+            move(child, i);
+            i = child;
+        }
+        m_heap[i] = track;
+        m_pos[track] = i;
+    }
+
+    /// The state that the tracks are ordered by
+    const resolution_state& m_state;
+    /// The tracks, in heap order
+    std::vector<std::size_t> m_heap;
+    /// The position of every track in the heap
+    std::vector<std::size_t> m_pos;
+};
+
+/// Build the flat arrays of the resolution
+resolution_state make_state(
+    const track_state_container_types::host& track_states,
+    std::size_t n_measurements_min) {
+
+    resolution_state state;
+    state.track_offsets.push_back(0);
+
+    // Collect the tracks passing the requirements, and their measurements.
+    for (std::size_t i = 0; i < track_states.size(); ++i) {
+        auto const& [fit_res, states] = track_states.at(i);
+        if (states.size() < n_measurements_min) {
+            continue;
+        }
+        state.input_index.push_back(i);
+        state.chi2.push_back(fit_res.chi2);
+        for (auto const& st : states) {
+            state.track_measurements.push_back(
+                st.get_measurement().measurement_id);
+        }
+        state.track_offsets.push_back(state.track_measurements.size());
+    }
+    const std::size_t n_tracks = state.input_index.size();
+
+    // Replace the measurement identifiers with dense indices.
+    std::vector<std::size_t> ids = state.track_measurements;
+    std::sort(ids.begin(), ids.end());
+    ids.erase(std::unique(ids.begin(), ids.end()), ids.end());
+    for (std::size_t& m : state.track_measurements) {
+        m = static_cast<std::size_t>(
+            std::lower_bound(ids.begin(), ids.end(), m) - ids.begin());
+    }
+    const std::size_t n_meas = ids.size();
+
+    // Build the measurement -> track adjacency. A track appears only once
+    // per measurement, even if it holds the measurement more than once.
+    state.n_selected_tracks.assign(n_meas, 0);
+    std::vector<std::size_t> last_track(n_meas, n_tracks);
+    for (std::size_t t = 0; t < n_tracks; ++t) {
+        for (std::size_t j = state.track_offsets[t];
+             j < state.track_offsets[t + 1]; ++j) {
+            const std::size_t m = state.track_measurements[j];
+            if (last_track[m] != t) {
+                last_track[m] = t;
+                ++state.n_selected_tracks[m];
+            }
+        }
+    }
+    state.measurement_offsets.assign(n_meas + 1, 0);
+    for (std::size_t m = 0; m < n_meas; ++m) {
+        state.measurement_offsets[m + 1] =
+            state.measurement_offsets[m] + state.n_selected_tracks[m];
+    }
+    state.measurement_tracks.resize(state.measurement_offsets.back());
+    std::vector<std::size_t> fill(state.measurement_offsets.begin(),
+                                  state.measurement_offsets.end() - 1);
+    last_track.assign(n_meas, n_tracks);
+    for (std::size_t t = 0; t < n_tracks; ++t) {
+        for (std::size_t j = state.track_offsets[t];
+             j < state.track_offsets[t + 1]; ++j) {
+            const std::size_t m = state.track_measurements[j];
+            if (last_track[m] != t) {
+                last_track[m] = t;
+                state.measurement_tracks[fill[m]++] = t;
+            }
+        }
+    }
+
+    // Count the shared measurements of every track.
+    state.n_shared.assign(n_tracks, 0);
+    for (std::size_t t = 0; t < n_tracks; ++t) {
+        for (std::size_t j = state.track_offsets[t];
+             j < state.track_offsets[t + 1]; ++j) {
+            if (state.n_selected_tracks[state.track_measurements[j]] > 1) {
+                ++state.n_shared[t];
+            }
+        }
+    }
+    state.selected.assign(n_tracks, 1);
+
+    return state;
+}
+
+}  // namespace
+
+flat_greedy_ambiguity_resolution_algorithm::
+    flat_greedy_ambiguity_resolution_algorithm(const config_t& cfg)
+    : m_config(cfg) {}
+
+flat_greedy_ambiguity_resolution_algorithm::output_type
+flat_greedy_ambiguity_resolution_algorithm::operator()(
+    const typename track_state_container_types::host& track_states) const {
+
+    TRACCC_TRACE_RANGE("traccc::flat_greedy_ambiguity_resolution_algorithm");
+
+    resolution_state state =
+        make_state(track_states, m_config.n_measurements_min);
+    const std::size_t n_tracks = state.input_index.size();
+
+    // Histogram of the number of shared measurements of the selected tracks,
+    // to know when the final state is reached. As the numbers only ever
+    // decrease, the maximum can be tracked from above.
+    std::vector<std::size_t> n_tracks_with_shared(
+        state.track_measurements.size() + 1, 0);
+    std::size_t max_shared = 0;
+    for (std::size_t t = 0; t < n_tracks; ++t) {
+        ++n_tracks_with_shared[state.n_shared[t]];
+        max_shared = std::max(max_shared, state.n_shared[t]);
+    }
+
+    track_heap heap(state);
+    for (std::uint32_t i = 0; i < m_config.maximum_iterations; ++i) {
+
+        if (heap.empty()) {
+            break;
+        }
+        while (n_tracks_with_shared[max_shared] == 0) {
+            --max_shared;
+        }
+        if (max_shared < m_config.maximum_shared_hits) {
+            break;
+        }
+
+        // Evict the worst track.
+        const std::size_t bad_track = heap.pop();
+        state.selected[bad_track] = 0;
+        --n_tracks_with_shared[state.n_shared[bad_track]];
+
+        // Update the tracks that it shared measurements with. (Once for
+        // every occurrence of a measurement, like the node based version.)
+        const auto track_begin =
+            state.track_measurements.begin() +
+            static_cast<std::ptrdiff_t>(state.track_offsets[bad_track]);
+        const auto track_end =
+            state.track_measurements.begin() +
+            static_cast<std::ptrdiff_t>(state.track_offsets[bad_track + 1]);
+        for (auto it = track_begin; it != track_end; ++it) {
+
+            const std::size_t m = *it;
+            if (std::find(track_begin, it, m) == it) {
+                --state.n_selected_tracks[m];
+            }
+            if (state.n_selected_tracks[m] != 1) {
+                continue;
+            }
+            for (std::size_t k = state.measurement_offsets[m];
+                 k < state.measurement_offsets[m + 1]; ++k) {
+                const std::size_t other = state.measurement_tracks[k];
+                if (state.selected[other] && (state.n_shared[other] > 0)) {
+                    --n_tracks_with_shared[state.n_shared[other]];
+                    --state.n_shared[other];
+                    ++n_tracks_with_shared[state.n_shared[other]];
+                    heap.decreased(other);
+                    break;
+                }
+            }
+        }
+    }
+
+    // Copy the tracks to be retained into the return value.
+    output_type result;
+    for (std::size_t t = 0; t < n_tracks; ++t) {
+        if (!state.selected[t]) {
+            continue;
+        }
+        auto const [header, items] = track_states.at(state.input_index[t]);
+        vecmem::vector<track_state<transform3>> states;
+        states.reserve(items.size());
+        for (auto const& item : items) {
+            states.push_back(item);
+        }
+        result.push_back(header, std::move(states));
+    }
+    return result;
+}
+
+}  // namespace traccc
@@ -23,50 +23,28 @@
 // Project include(s).
 #include "traccc/definitions/qualifiers.hpp"
 #include "traccc/edm/track_candidate.hpp"
+#include "traccc/clusterization/detail/sparse_ccl.hpp"
 #include "traccc/edm/track_state.hpp"
 #include "traccc/utils/algorithm.hpp"
+#include "traccc/utils/logging.hpp"
+#include "traccc/utils/parallel_for.hpp"
+#include "traccc/utils/trace.hpp"
 
 // Greedy ambiguity resolution adapted from ACTS code
 
 namespace traccc {
 
-namespace {
-
-#define LOG_INFO(msg)                       \
-    if (_config.verbose_info) {             \
-        logger::info() << msg << std::endl; \
-    }
-
-#define LOG_FLOOD(msg)                       \
-    if (_config.verbose_flood) {             \
-        logger::flood() << msg << std::endl; \
-    }
-
-#define LOG_ERROR(msg)                       \
-    if (_config.verbose_error) {             \
-        logger::error() << msg << std::endl; \
-    }
-
-// This logger is specific to the greedy_ambiguity_resolution_algorithm, and to
-// this translation unit.
-struct logger {
-    static std::ostream& error() {
-        std::cout << "ERROR @greedy_ambiguity_resolution_algorithm: ";
-        return std::cout;
-    }
-
-    static std::ostream& info() {
-        std::cout << "@greedy_ambiguity_resolution_algorithm: ";
-        return std::cout;
-    }
-
-    static std::ostream& flood() {
-        std::cout << "@greedy_ambiguity_resolution_algorithm: ";
-        return std::cout;
-    }
-};
-
-}  // namespace
+// The log messages of the algorithm, which can also be turned off through
+// its configuration.
+#define LOG_INFO(msg)                         \
+    TRACCC_LOG_IF(INFO, _config.verbose_info, \
+                  "greedy_ambiguity_resolution_algorithm", msg)
+#define LOG_FLOOD(msg)                          \
+    TRACCC_LOG_IF(FLOOD, _config.verbose_flood, \
+                  "greedy_ambiguity_resolution_algorithm", msg)
+#define LOG_ERROR(msg)                          \
+    TRACCC_LOG_IF(ERROR, _config.verbose_error, \
+                  "greedy_ambiguity_resolution_algorithm", msg)
 
 /// Run the algorithm
 ///
@@ -76,9 +54,14 @@ track_state_container_types::host
 greedy_ambiguity_resolution_algorithm::operator()(
     const typename track_state_container_types::host& track_states) const {
 
-    state_t state;
+    TRACCC_TRACE_RANGE("traccc::greedy_ambiguity_resolution_algorithm");
+
+    state_t state{m_mr.get()};
     compute_initial_state(track_states, state);
-    resolve(state);
+    const std::size_t iteration_count = _config.resolve_components_in_parallel
+                                            ? resolve_components(state)
+                                            : resolve(state);
+    LOG_INFO("Iteration_count: " << iteration_count);
 
     if (_config.check_obvious_errs) {
         LOG_INFO("Checking result validity...");
@@ -95,7 +78,8 @@ greedy_ambiguity_resolution_algorithm::operator()(
     for (std::size_t index : state.selected_tracks) {
         // track_states is a host_container<fitting_result<transform3>,
         // track_state<transform3>>
-        auto const [sm_headers, sm_items] = track_states.at(index);
+        auto const [sm_headers, sm_items] =
+            track_states.at(state.input_track_index[index]);
 
         // Copy header
         fitting_result<transform3> header = sm_headers;
@@ -109,9 +93,42 @@ greedy_ambiguity_resolution_algorithm::operator()(
 
         res.push_back(header, states);
     }
+
+    // Write out the messages of the event in one go.
+    logging::flush();
     return res;
 }
 
+namespace {
+
+/// Fills the measurement -> tracks association and the number of shared
+/// measurements of a state, from its tracks' measurements.
+void count_shared_measurements(
+    greedy_ambiguity_resolution_algorithm::state_t& state) {
+
+    // Associate each measurement to the tracks sharing it
+    for (std::size_t track_index = 0; track_index < state.number_of_tracks;
+         ++track_index) {
+        for (auto meas_id : state.measurements_per_track[track_index]) {
+            state.tracks_per_measurement[meas_id].insert(track_index);
+        }
+    }
+
+    // Finally, we can accumulate the number of shared measurements per track
+    state.shared_measurements_per_track.assign(state.number_of_tracks, 0);
+
+    for (std::size_t track_index = 0; track_index < state.number_of_tracks;
+         ++track_index) {
+        for (auto meas_index : state.measurements_per_track[track_index]) {
+            if (state.tracks_per_measurement[meas_index].size() > 1) {
+                ++state.shared_measurements_per_track[track_index];
+            }
+        }
+    }
+}
+
+}  // namespace
+
 void greedy_ambiguity_resolution_algorithm::compute_initial_state(
     const typename track_state_container_types::host& track_states,
     state_t& state) const {
@@ -131,11 +148,13 @@ void greedy_ambiguity_resolution_algorithm::compute_initial_state(
         }
 
         // Create the list of measurement_id of the current track
-        std::vector<std::size_t> measurements;
+        vecmem::vector<std::size_t> measurements(&(m_mr.get()));
         for (auto const& st : states) {
             measurements.push_back(st.get_measurement().measurement_id);
         }
 
+        // Remember where the track came from
+        state.input_track_index.push_back(track_index);
         // Add this track chi2 value
         state.track_chi2.push_back(fit_res.chi2);
         // Add all the (measurement_id)s of this track
@@ -146,26 +165,7 @@ void greedy_ambiguity_resolution_algorithm::compute_initial_state(
         ++state.number_of_tracks;
     }
 
-    // Associate each measurement to the tracks sharing it
-    for (std::size_t track_index = 0; track_index < state.number_of_tracks;
-         ++track_index) {
-        for (auto meas_id : state.measurements_per_track[track_index]) {
-            state.tracks_per_measurement[meas_id].insert(track_index);
-        }
-    }
-
-    // Finally, we can accumulate the number of shared measurements per track
-    state.shared_measurements_per_track =
-        std::vector<std::size_t>(state.number_of_tracks, 0);
-
-    for (std::size_t track_index = 0; track_index < state.number_of_tracks;
-         ++track_index) {
-        for (auto meas_index : state.measurements_per_track[track_index]) {
-            if (state.tracks_per_measurement[meas_index].size() > 1) {
-                ++state.shared_measurements_per_track[track_index];
-            }
-        }
-    }
+    count_shared_measurements(state);
 }
 
 /// Check for obvious errors returned by the algorithm:
@@ -214,11 +214,12 @@ bool greedy_ambiguity_resolution_algorithm::check_obvious_errors(
     // =========================================================================
     // Checks that every removed track had at least
     // (_config.maximum_shared_hits) commun measurements with other tracks
+    // (The tracks failing the initial requirements are not considered.)
     // =========================================================================
-    std::size_t n_initial_track_states = initial_track_states.size();
-    for (std::size_t track_index = 0; track_index < n_initial_track_states;
-         ++track_index) {
-        auto const& [fit_res, states] = initial_track_states.at(track_index);
+    for (std::size_t track_index = 0;
+         track_index < final_state.number_of_tracks; ++track_index) {
+        auto const& [fit_res, states] = initial_track_states.at(
+            final_state.input_track_index[track_index]);
 
         // Skip this track if it has to be kept (i.e. exists in selected_tracks)
         if (final_state.selected_tracks.find(track_index) !=
@@ -242,7 +243,7 @@ bool greedy_ambiguity_resolution_algorithm::check_obvious_errors(
                     << track_index
                     << ") which is a removed track, has a measurement not "
                     << "present in initial_measurement_count. This should "
-                    << "never happen and is an implementation error.\n");
+                    << "never happen and is an implementation error.");
                 all_removed_tracks_alright = false;
             } else if (meas_it->second > 1) {
                 ++shared_hits;
@@ -285,7 +286,8 @@ bool greedy_ambiguity_resolution_algorithm::check_obvious_errors(
 
     // Initializes tracks_per_measurements
     for (std::size_t track_index : final_state.selected_tracks) {
-        auto const& [fit_res, states] = initial_track_states.at(track_index);
+        auto const& [fit_res, states] = initial_track_states.at(
+            final_state.input_track_index[track_index]);
         for (auto const& mes : states) {
             std::size_t meas_id = mes.get_measurement().measurement_id;
             tracks_per_measurements[meas_id].push_back(track_index);
@@ -313,8 +315,8 @@ bool greedy_ambiguity_resolution_algorithm::check_obvious_errors(
             for (std::size_t track_index : tracks_per_mes) {
                 std::stringstream ssm;
                 ssm << "    Track(" << track_index << ")'s measurements:";
-                auto const& [fit_res, states] =
-                    initial_track_states.at(track_index);
+                auto const& [fit_res, states] = initial_track_states.at(
+                    final_state.input_track_index[track_index]);
 
                 for (auto const& st : states) {
                     auto meas_id = st.get_measurement().measurement_id;
@@ -355,7 +357,8 @@ static void remove_track(greedy_ambiguity_resolution_algorithm::state_t& state,
 }
 }  // namespace
 
-void greedy_ambiguity_resolution_algorithm::resolve(state_t& state) const {
+std::size_t greedy_ambiguity_resolution_algorithm::resolve(
+    state_t& state) const {
     /// Compares two tracks based on the number of shared measurements in order
     /// to decide if we already met the final state.
     auto shared_measurements_comperator = [&state](std::size_t a,
@@ -422,7 +425,85 @@ void greedy_ambiguity_resolution_algorithm::resolve(state_t& state) const {
         ++iteration_count;
     }
 
-    LOG_INFO("Iteration_count: " << iteration_count);
+    return iteration_count;
+}
+
+std::size_t greedy_ambiguity_resolution_algorithm::resolve_components(
+    state_t& state) const {
+
+    // Connect the tracks sharing measurements with union-find
+    std::vector<unsigned int> roots(state.number_of_tracks);
+    for (std::size_t track_index = 0; track_index < state.number_of_tracks;
+         ++track_index) {
+        roots[track_index] = static_cast<unsigned int>(track_index);
+    }
+    for (auto const& [meas_id, tracks] : state.tracks_per_measurement) {
+        const unsigned int first = static_cast<unsigned int>(*tracks.begin());
+        for (std::size_t track_index : tracks) {
+            const unsigned int r1 = detail::find_root(roots, first);
+            const unsigned int r2 = detail::find_root(
+                roots, static_cast<unsigned int>(track_index));
+            if (r1 != r2) {
+                detail::make_union(roots, r1, r2);
+            }
+        }
+    }
+
+    // Collect the tracks of every component, in increasing order
+    std::vector<std::vector<std::size_t>> components;
+    std::vector<std::size_t> component_of_root(state.number_of_tracks,
+                                               state.number_of_tracks);
+    for (std::size_t track_index = 0; track_index < state.number_of_tracks;
+         ++track_index) {
+        const unsigned int root = detail::find_root(
+            roots, static_cast<unsigned int>(track_index));
+        if (component_of_root[root] == state.number_of_tracks) {
+            component_of_root[root] = components.size();
+            components.emplace_back();
+        }
+        components[component_of_root[root]].push_back(track_index);
+    }
+    LOG_INFO("Number of track components: " << components.size());
+
+    // Resolve the components independently of each other
+    std::vector<std::vector<std::size_t>> selected(components.size());
+    std::vector<std::size_t> iterations(components.size(), 0);
+    details::parallel_for(components.size(), [&](std::size_t i) {
+        const std::vector<std::size_t>& tracks = components[i];
+
+        // Single tracks can not have shared measurements
+        if (tracks.size() == 1) {
+            selected[i] = tracks;
+            return;
+        }
+
+        // Build a state of the tracks of the component
+        state_t component_state;
+        component_state.number_of_tracks = tracks.size();
+        for (std::size_t j = 0; j < tracks.size(); ++j) {
+            component_state.track_chi2.push_back(state.track_chi2[tracks[j]]);
+            component_state.measurements_per_track.push_back(
+                state.measurements_per_track[tracks[j]]);
+            component_state.selected_tracks.insert(j);
+        }
+        count_shared_measurements(component_state);
+
+        iterations[i] = resolve(component_state);
+        for (std::size_t j : component_state.selected_tracks) {
+            selected[i].push_back(tracks[j]);
+        }
+        logging::flush();
+    });
+
+    // Collect the results of all components
+    state.selected_tracks.clear();
+    std::size_t iteration_count = 0;
+    for (std::size_t i = 0; i < components.size(); ++i) {
+        state.selected_tracks.insert(selected[i].begin(), selected[i].end());
+        iteration_count += iterations[i];
+    }
+
+    return iteration_count;
 }
 
 }  // namespace traccc
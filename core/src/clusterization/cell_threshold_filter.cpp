@@ -0,0 +1,51 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Library include(s).
+#include "traccc/clusterization/cell_threshold_filter.hpp"
+
+#include "traccc/utils/trace.hpp"
+
+// System include(s).
+#include <vector>
+
+namespace traccc {
+
+cell_threshold_filter::cell_threshold_filter(vecmem::memory_resource& mr,
+                                             threshold_filter_mode mode)
+    : m_mr(mr), m_mode(mode) {}
+
+cell_threshold_filter::output_type cell_threshold_filter::operator()(
+    const cell_collection_types::host& cells,
+    const cell_module_collection_types::host& modules) const {
+
+    TRACCC_TRACE_RANGE("traccc::cell_threshold_filter");
+
+    const unsigned int n_cells = static_cast<unsigned int>(cells.size());
+
+    // Decide which cells to keep, in a separate pass, so that the compaction
+    // below is free of the branches of the decision.
+    std::vector<unsigned char> keep(n_cells);
+    for (unsigned int i = 0; i < n_cells; ++i) {
+        keep[i] = detail::is_kept_cell(i, cells, modules, m_mode) ? 1u : 0u;
+    }
+
+    // Compact the kept cells without branching. Every cell is written to the
+    // next free position, which only advances for the kept ones. This
+    // vectorises well, and is not slowed down by mispredictions on noisy
+    // modules.
+    output_type result(n_cells, &(m_mr.get()));
+    unsigned int n_kept = 0;
+    for (unsigned int i = 0; i < n_cells; ++i) {
+        result[n_kept] = cells[i];
+        n_kept += keep[i];
+    }
+    result.resize(n_kept);
+    return result;
+}
+
+}  // namespace traccc
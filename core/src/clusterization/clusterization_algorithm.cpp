@@ -1,6 +1,6 @@
 /** TRACCC library, part of the ACTS project (R&D line)
  *
- * (c) 2022 CERN for the benefit of the ACTS project
+ * (c) 2022-2024 CERN for the benefit of the ACTS project
  *
  * Mozilla Public License Version 2.0
  */
@@ -8,16 +8,48 @@
 // Library include(s).
 #include "traccc/clusterization/clusterization_algorithm.hpp"
 
+#include "traccc/clusterization/detail/measurement_creation_helper.hpp"
+#include "traccc/clusterization/detail/dense_ccl.hpp"
+#include "traccc/utils/trace.hpp"
+#include "traccc/utils/work_model.hpp"
+
+// System include(s).
+#include <vector>
+
 namespace traccc {
 
-clusterization_algorithm::clusterization_algorithm(vecmem::memory_resource& mr)
-    : m_cc(mr), m_mc(mr), m_mr(mr) {}
+clusterization_algorithm::clusterization_algorithm(vecmem::memory_resource& mr,
+                                                   bool build_clusters,
+                                                   scalar dense_ccl_occupancy)
+    : m_cc(mr, dense_ccl_occupancy),
+      m_mc(mr),
+      m_build_clusters(build_clusters),
+      m_dense_ccl_occupancy(dense_ccl_occupancy),
+      m_mr(mr) {}
 
 clusterization_algorithm::output_type clusterization_algorithm::operator()(
     const cell_collection_types::host& cells,
     const cell_module_collection_types::host& modules) const {
 
-    return m_mc(m_cc(cells), modules);
+    TRACCC_TRACE_RANGE("traccc::clusterization_algorithm");
+
+    // Go through an explicit cluster container if requested.
+    if (m_build_clusters) {
+        output_type result = m_mc(m_cc(cells), modules);
+        count_work(work_model::clusterization(cells.size(), result.size()));
+        return result;
+    }
+
+    // Label the cells with their clusters, and create the measurements
+    // straight from the labels.
+    std::vector<unsigned int> CCL_indices(cells.size());
+    const unsigned int n_clusters =
+        detail::adaptive_ccl(cells, CCL_indices, m_dense_ccl_occupancy);
+
+    output_type result(&(m_mr.get()));
+    detail::fill_measurements(result, cells, CCL_indices, n_clusters, modules);
+    count_work(work_model::clusterization(cells.size(), result.size()));
+    return result;
 }
 
 }  // namespace traccc
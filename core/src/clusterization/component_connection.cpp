@@ -1,6 +1,6 @@
 /** TRACCC library, part of the ACTS project (R&D line)
  *
- * (c) 2022 CERN for the benefit of the ACTS project
+ * (c) 2022-2024 CERN for the benefit of the ACTS project
  *
  * Mozilla Public License Version 2.0
  */
@@ -8,7 +8,8 @@
 // Library include(s).
 #include "traccc/clusterization/component_connection.hpp"
 
-#include "traccc/clusterization/detail/sparse_ccl.hpp"
+#include "traccc/clusterization/detail/dense_ccl.hpp"
+#include "traccc/utils/trace.hpp"
 
 // VecMem include(s).
 #include <vecmem/containers/device_vector.hpp>
@@ -19,11 +20,14 @@ namespace traccc {
 component_connection::output_type component_connection::operator()(
     const cell_collection_types::host& cells) const {
 
+    TRACCC_TRACE_RANGE("traccc::component_connection");
+
     unsigned int num_clusters = 0;
     std::vector<unsigned int> CCL_indices(cells.size());
 
-    // Run SparseCCL to fill CCL indices
-    num_clusters = detail::sparse_ccl(cells, CCL_indices);
+    // Run SparseCCL or the dense CCL to fill CCL indices
+    num_clusters =
+        detail::adaptive_ccl(cells, CCL_indices, m_dense_ccl_occupancy);
 
     // Create the result container.
     output_type result(num_clusters, &(m_mr.get()));
@@ -0,0 +1,65 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Library include(s).
+#include "traccc/clusterization/event_batch.hpp"
+
+namespace traccc {
+
+event_batch::event_batch(vecmem::memory_resource& mr)
+    : m_cells(&mr), m_modules(&mr), m_module_events(&mr) {}
+
+std::size_t event_batch::add(
+    const cell_collection_types::host& cells,
+    const cell_module_collection_types::host& modules) {
+
+    // Append the cells, pointing them at the appended modules.
+    const auto module_offset =
+        static_cast<cell::link_type>(m_modules.size());
+    m_cells.reserve(m_cells.size() + cells.size());
+    for (const cell& c : cells) {
+        m_cells.push_back(c);
+        m_cells.back().module_link += module_offset;
+    }
+
+    // Append the modules, remembering which event they belong to.
+    m_modules.insert(m_modules.end(), modules.begin(), modules.end());
+    m_module_events.insert(m_module_events.end(), modules.size(),
+                           static_cast<unsigned int>(m_size));
+
+    return m_size++;
+}
+
+void event_batch::clear() {
+
+    m_cells.clear();
+    m_modules.clear();
+    m_module_events.clear();
+    m_size = 0;
+}
+
+std::size_t event_batch::size() const {
+
+    return m_size;
+}
+
+const cell_collection_types::host& event_batch::cells() const {
+
+    return m_cells;
+}
+
+const cell_module_collection_types::host& event_batch::modules() const {
+
+    return m_modules;
+}
+
+const vecmem::vector<unsigned int>& event_batch::module_events() const {
+
+    return m_module_events;
+}
+
+}  // namespace traccc
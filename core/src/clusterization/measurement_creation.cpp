@@ -10,6 +10,7 @@
 
 #include "traccc/clusterization/detail/measurement_creation_helper.hpp"
 #include "traccc/definitions/primitives.hpp"
+#include "traccc/utils/trace.hpp"
 
 namespace traccc {
 
@@ -20,6 +21,8 @@ measurement_creation::output_type measurement_creation::operator()(
     const cluster_container_types::host &clusters,
     const cell_module_collection_types::host &modules) const {
 
+    TRACCC_TRACE_RANGE("traccc::measurement_creation");
+
     // Create the result object.
     output_type result(&(m_mr.get()));
     result.reserve(clusters.size());
@@ -0,0 +1,142 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Library include(s).
+#include "traccc/clusterization/parallel_clusterization_algorithm.hpp"
+
+#include "traccc/clusterization/detail/measurement_creation_helper.hpp"
+#include "traccc/clusterization/detail/dense_ccl.hpp"
+#include "traccc/utils/trace.hpp"
+
+// VecMem include(s).
+#include <vecmem/containers/data/vector_view.hpp>
+#include <vecmem/containers/device_vector.hpp>
+
+// TBB include(s).
+#ifdef TRACCC_CORE_HAVE_TBB
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+#endif
+
+// System include(s).
+#include <algorithm>
+#include <cassert>
+
+namespace traccc {
+
+parallel_clusterization_algorithm::parallel_clusterization_algorithm(
+    vecmem::memory_resource& mr, std::size_t partition_size,
+    scalar dense_ccl_occupancy)
+    : m_partition_size(std::max<std::size_t>(partition_size, 1)),
+      m_dense_ccl_occupancy(dense_ccl_occupancy),
+      m_mr(mr) {}
+
+std::vector<std::size_t> parallel_clusterization_algorithm::partitions(
+    const cell_collection_types::host& cells) const {
+
+    // Start a new partition at the first module boundary after every
+    // m_partition_size cells.
+    std::vector<std::size_t> result{0};
+    for (std::size_t i = 1; i < cells.size(); ++i) {
+        if ((i - result.back() >= m_partition_size) &&
+            (cells[i].module_link != cells[i - 1].module_link)) {
+            result.push_back(i);
+        }
+    }
+    result.push_back(cells.size());
+    return result;
+}
+
+parallel_clusterization_algorithm::output_type
+parallel_clusterization_algorithm::operator()(
+    const cell_collection_types::host& cells,
+    const cell_module_collection_types::host& modules) const {
+
+    TRACCC_TRACE_RANGE("traccc::parallel_clusterization_algorithm");
+
+    // Find the partitions to process.
+    const std::vector<std::size_t> bounds = partitions(cells);
+    const std::size_t n_partitions = bounds.size() - 1;
+
+    // Measurements found in the individual partitions.
+    std::vector<output_type> partition_meas;
+    partition_meas.reserve(n_partitions);
+    for (std::size_t i = 0; i < n_partitions; ++i) {
+        partition_meas.emplace_back(&(m_mr.get()));
+    }
+
+    // Function processing one partition.
+    auto process_partition = [&](std::size_t partition) {
+        // Access the partition's cells without copying them.
+        const auto n_cells = static_cast<unsigned int>(bounds[partition + 1] -
+                                                       bounds[partition]);
+        const vecmem::device_vector<const cell> partition_cells(
+            vecmem::data::vector_view<const cell>(
+                n_cells, cells.data() + bounds[partition]));
+
+        // Run SparseCCL or the dense CCL on them.
+        std::vector<unsigned int> CCL_indices(n_cells);
+        const unsigned int n_clusters = detail::adaptive_ccl(
+            partition_cells, CCL_indices, m_dense_ccl_occupancy);
+
+        // Create measurements straight from the cluster labels.
+        detail::fill_measurements(partition_meas[partition], partition_cells,
+                                  CCL_indices, n_clusters, modules);
+    };
+
+    // Process the partitions.
+#if defined(TRACCC_CORE_HAVE_OPENMP)
+#pragma omp taskloop
+    for (std::size_t i = 0; i < n_partitions; ++i) {
+        process_partition(i);
+    }
+#elif defined(TRACCC_CORE_HAVE_TBB)
+    tbb::parallel_for(tbb::blocked_range<std::size_t>(0, n_partitions),
+                      [&](const tbb::blocked_range<std::size_t>& range) {
+                          for (std::size_t i = range.begin(); i != range.end();
+                               ++i) {
+                              process_partition(i);
+                          }
+                      });
+#else
+    for (std::size_t i = 0; i < n_partitions; ++i) {
+        process_partition(i);
+    }
+#endif
+
+    // Find where the measurements of each partition go in the result, with
+    // an exclusive prefix sum over their sizes.
+    std::vector<std::size_t> offsets(n_partitions + 1, 0);
+    for (std::size_t i = 0; i < n_partitions; ++i) {
+        offsets[i + 1] = offsets[i] + partition_meas[i].size();
+    }
+
+    // Merge the measurements, keeping the order of the partitions.
+    output_type result(offsets.back(), &(m_mr.get()));
+    auto merge_partition = [&](std::size_t partition) {
+        std::copy(partition_meas[partition].begin(),
+                  partition_meas[partition].end(),
+                  result.begin() + offsets[partition]);
+    };
+#if defined(TRACCC_CORE_HAVE_OPENMP)
+#pragma omp taskloop
+    for (std::size_t i = 0; i < n_partitions; ++i) {
+        merge_partition(i);
+    }
+#elif defined(TRACCC_CORE_HAVE_TBB)
+    tbb::parallel_for(std::size_t{0}, n_partitions, merge_partition);
+#else
+    for (std::size_t i = 0; i < n_partitions; ++i) {
+        merge_partition(i);
+    }
+#endif
+    assert(result.size() == offsets.back());
+
+    return result;
+}
+
+}  // namespace traccc
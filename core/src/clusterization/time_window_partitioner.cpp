@@ -0,0 +1,88 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Library include(s).
+#include "traccc/clusterization/time_window_partitioner.hpp"
+
+// System include(s).
+#include <algorithm>
+#include <limits>
+#include <stdexcept>
+
+namespace traccc {
+
+time_window_partitioner::time_window_partitioner(
+    const time_window_config& config, vecmem::memory_resource& mr)
+    : m_config(config),
+      m_mr(mr),
+      m_cells(&mr),
+      m_watermark(std::numeric_limits<scalar>::lowest()) {
+
+    if (!(m_config.window_length > 0.f)) {
+        throw std::invalid_argument("The time window length must be positive");
+    }
+    if ((m_config.cluster_time_window > m_config.overlap) ||
+        !(m_config.overlap < m_config.window_length)) {
+        throw std::invalid_argument(
+            "The time window overlap must be between the cluster time window "
+            "and the window length");
+    }
+}
+
+void time_window_partitioner::push(const cell_collection_types::host& cells) {
+
+    m_cells.insert(m_cells.end(), cells.begin(), cells.end());
+    for (const cell& c : cells) {
+        m_watermark = std::max(m_watermark, c.time);
+    }
+}
+
+void time_window_partitioner::finish() {
+
+    m_finished = true;
+}
+
+bool time_window_partitioner::ready() const {
+
+    return m_finished ? (m_cells.empty() == false)
+                      : (m_watermark >= window_end());
+}
+
+cell_collection_types::host time_window_partitioner::pop() {
+
+    // Move the cells of the window (and the late ones) to the front of the
+    // pending cells, keeping their order.
+    const scalar end = window_end();
+    auto last = std::stable_partition(
+        m_cells.begin(), m_cells.end(),
+        [end](const cell& c) { return c.time < end; });
+
+    // Hand them out, ordered by module and channel.
+    cell_collection_types::host result(m_cells.begin(), last, &(m_mr.get()));
+    m_cells.erase(m_cells.begin(), last);
+    std::sort(result.begin(), result.end());
+    ++m_window;
+    return result;
+}
+
+std::size_t time_window_partitioner::window_index() const {
+
+    return m_window;
+}
+
+scalar time_window_partitioner::window_begin() const {
+
+    return m_config.start_time +
+           static_cast<scalar>(m_window) * m_config.window_length;
+}
+
+scalar time_window_partitioner::window_end() const {
+
+    return window_begin() + m_config.window_length;
+}
+
+}  // namespace traccc
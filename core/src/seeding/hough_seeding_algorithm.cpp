@@ -0,0 +1,107 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Library include(s).
+#include "traccc/seeding/hough_seeding_algorithm.hpp"
+
+#include "traccc/seeding/hough_transform_helper.hpp"
+#include "traccc/utils/trace.hpp"
+
+// VecMem include(s).
+#include <vecmem/containers/vector.hpp>
+
+// System include(s).
+#include <algorithm>
+
+namespace traccc {
+
+hough_seeding_algorithm::hough_seeding_algorithm(
+    const hough_seeding_config& config, vecmem::memory_resource& mr)
+    : m_config(config), m_mr(mr) {}
+
+hough_seeding_algorithm::output_type hough_seeding_algorithm::operator()(
+    const spacepoint_collection_types::host& spacepoints) const {
+
+    TRACCC_TRACE_RANGE("traccc::hough_seeding_algorithm");
+
+    using helper = hough_transform_helper;
+    const unsigned int n_spacepoints =
+        static_cast<unsigned int>(spacepoints.size());
+
+    // Fill the layers of the spacepoints into the accumulator cells.
+    vecmem::vector<unsigned int> masks(m_config.n_cells(), 0u, &(m_mr.get()));
+    for (unsigned int i = 0; i < n_spacepoints; ++i) {
+        const unsigned int bit =
+            1u << helper::layer(m_config,
+                                helper::radius(m_config, spacepoints[i]));
+        helper::for_each_cell(m_config, spacepoints[i],
+                              [&](unsigned int cell) { masks[cell] |= bit; });
+    }
+
+    // Find the cells to make seeds from. The candidate links of the cells
+    // are one larger than the index of their candidate, so that zero would
+    // mean "no candidate".
+    vecmem::vector<unsigned int> candidates(&(m_mr.get()));
+    vecmem::vector<unsigned int> candidate_links(m_config.n_cells(), 0u,
+                                                 &(m_mr.get()));
+    for (unsigned int cell = 0; cell < m_config.n_cells(); ++cell) {
+        if (helper::is_seed_cell(m_config, cell, masks)) {
+            candidates.push_back(cell);
+            candidate_links[cell] =
+                static_cast<unsigned int>(candidates.size());
+        }
+    }
+
+    // Find the bottom and top spacepoints of every candidate.
+    vecmem::vector<unsigned long long> bottom(
+        candidates.size(), helper::invalid_key, &(m_mr.get()));
+    vecmem::vector<unsigned long long> top(candidates.size(),
+                                           helper::invalid_key, &(m_mr.get()));
+    for (unsigned int i = 0; i < n_spacepoints; ++i) {
+        const spacepoint& sp = spacepoints[i];
+        helper::for_each_cell(m_config, sp, [&](unsigned int cell) {
+            if (candidate_links[cell] != 0u) {
+                const unsigned int c = candidate_links[cell] - 1u;
+                bottom[c] = std::min(bottom[c],
+                                     helper::bottom_key(m_config, cell, sp, i));
+                top[c] =
+                    std::min(top[c], helper::top_key(m_config, cell, sp, i));
+            }
+        });
+    }
+
+    // Find the middle spacepoint of every candidate.
+    vecmem::vector<unsigned long long> middle(
+        candidates.size(), helper::invalid_key, &(m_mr.get()));
+    for (unsigned int i = 0; i < n_spacepoints; ++i) {
+        const spacepoint& sp = spacepoints[i];
+        helper::for_each_cell(m_config, sp, [&](unsigned int cell) {
+            if (candidate_links[cell] != 0u) {
+                const unsigned int c = candidate_links[cell] - 1u;
+                middle[c] = std::min(
+                    middle[c],
+                    helper::middle_key(
+                        m_config, cell, sp, i,
+                        spacepoints[helper::key_link(bottom[c])],
+                        spacepoints[helper::key_link(top[c])]));
+            }
+        });
+    }
+
+    // Make the seeds.
+    output_type result(&(m_mr.get()));
+    for (unsigned int c = 0; c < candidates.size(); ++c) {
+        seed s;
+        if (helper::make_seed(m_config, spacepoints, bottom[c], middle[c],
+                              top[c], masks[candidates[c]], s)) {
+            result.push_back(s);
+        }
+    }
+    return result;
+}
+
+}  // namespace traccc
@@ -1,6 +1,6 @@
 /** TRACCC library, part of the ACTS project (R&D line)
  *
- * (c) 2021-2022 CERN for the benefit of the ACTS project
+ * (c) 2021-2024 CERN for the benefit of the ACTS project
  *
  * Mozilla Public License Version 2.0
  */
@@ -9,6 +9,10 @@
 #include "traccc/seeding/seed_filtering.hpp"
 
 #include "traccc/seeding/seed_selecting_helper.hpp"
+#include "traccc/utils/trace.hpp"
+
+// System include(s).
+#include <algorithm>
 
 namespace traccc {
 
@@ -16,24 +20,59 @@ seed_filtering::seed_filtering(const seedfilter_config& config)
     : m_filter_config(config) {}
 
 void seed_filtering::operator()(
-    const spacepoint_collection_types::host& sp_collection, const sp_grid& g2,
+    const spacepoint_collection_types::host& sp_collection,
+    const sp_soa_grid_host& g2,
     triplet_collection_types::host& triplets,
     seed_collection_types::host& seeds) const {
 
-    seed_collection_types::host seeds_per_spM;
+    workspace ws;
+    (*this)(sp_collection, g2, triplets, seeds, ws);
+}
+
+void seed_filtering::operator()(
+    const spacepoint_collection_types::host& sp_collection,
+    const sp_soa_grid_host& g2,
+    triplet_collection_types::host& triplets,
+    seed_collection_types::host& seeds, workspace& ws) const {
+
+    TRACCC_TRACE_RANGE("traccc::seed_filtering");
+
+    // Ordering of the seed candidates, best first: by weight, then by the
+    // summed y^2 + z^2 of their outer spacepoints. Equal candidates are
+    // kept in the order of their triplets.
+    auto better = [](const workspace::candidate& c1,
+                     const workspace::candidate& c2) {
+        if (c1.s.weight != c2.s.weight) {
+            return c1.s.weight > c2.s.weight;
+        }
+        if (c1.sum != c2.sum) {
+            return c1.sum > c2.sum;
+        }
+        return c1.index < c2.index;
+    };
+
+    // Only the best max_triplets_per_spM candidates (but at least one) are
+    // looked at by the selection below. Keep just those, in a heap with the
+    // worst of them at its front.
+    const std::size_t capacity =
+        std::max<std::size_t>(m_filter_config.max_triplets_per_spM, 1u);
+    std::vector<workspace::candidate>& candidates = ws.m_candidates;
+    candidates.clear();
+
+    for (std::size_t i = 0; i < triplets.size(); ++i) {
+        triplet& triplet = triplets[i];
 
-    for (triplet& triplet : triplets) {
         // bottom
         const auto& spB_idx = triplet.sp1;
-        const auto& spB = g2.bin(spB_idx.bin_idx)[spB_idx.sp_idx];
+        const auto spB = g2.at(spB_idx);
 
         // middle
         const auto& spM_idx = triplet.sp2;
-        const auto& spM = g2.bin(spM_idx.bin_idx)[spM_idx.sp_idx];
+        const auto spM = g2.at(spM_idx);
 
         // top
         const auto& spT_idx = triplet.sp3;
-        const auto& spT = g2.bin(spT_idx.bin_idx)[spT_idx.sp_idx];
+        const auto spT = g2.at(spT_idx);
 
         seed_selecting_helper::seed_weight(m_filter_config, spM, spB, spT,
                                            triplet.weight);
@@ -43,63 +82,50 @@ void seed_filtering::operator()(
             continue;
         }
 
-        seeds_per_spM.push_back({spB.m_link, spM.m_link, spT.m_link,
-                                 triplet.weight, triplet.z_vertex});
-    }
-
-    // sort seeds based on their weights
-    std::sort(seeds_per_spM.begin(), seeds_per_spM.end(),
-              [&](seed& seed1, seed& seed2) {
-                  if (seed1.weight != seed2.weight) {
-                      return seed1.weight > seed2.weight;
-                  } else {
-                      scalar seed1_sum = 0;
-                      scalar seed2_sum = 0;
-                      auto& spB1 = sp_collection.at(seed1.spB_link);
-                      auto& spT1 = sp_collection.at(seed1.spT_link);
-                      auto& spB2 = sp_collection.at(seed2.spB_link);
-                      auto& spT2 = sp_collection.at(seed2.spT_link);
-
-                      seed1_sum += pow(spB1.y(), 2) + pow(spB1.z(), 2);
-                      seed1_sum += pow(spT1.y(), 2) + pow(spT1.z(), 2);
-                      seed2_sum += pow(spB2.y(), 2) + pow(spB2.z(), 2);
-                      seed2_sum += pow(spT2.y(), 2) + pow(spT2.z(), 2);
-
-                      return seed1_sum > seed2_sum;
-                  }
-              });
-
-    seed_collection_types::host new_seeds;
-    if (seeds_per_spM.size() > 1) {
-        new_seeds.push_back(seeds_per_spM[0]);
-
-        size_t itLength = std::min(seeds_per_spM.size(),
-                                   m_filter_config.max_triplets_per_spM);
-        // don't cut first element
-        for (size_t i = 1; i < itLength; i++) {
-            if (seed_selecting_helper::cut_per_middle_sp(
-                    m_filter_config, sp_collection, seeds_per_spM[i],
-                    seeds_per_spM[i].weight)) {
-                new_seeds.push_back(std::move(seeds_per_spM[i]));
-            }
+        // Skip the candidate right away if it would not make it into the
+        // heap, without looking up its spacepoints.
+        if ((candidates.size() == capacity) &&
+            (triplet.weight < candidates.front().s.weight)) {
+            continue;
         }
-        seeds_per_spM = std::move(new_seeds);
-    }
 
-    unsigned int maxSeeds = seeds_per_spM.size();
-
-    if (maxSeeds > m_filter_config.maxSeedsPerSpM) {
-        maxSeeds = m_filter_config.maxSeedsPerSpM + 1;
+        const auto& spB1 = sp_collection.at(spB.m_link);
+        const auto& spT1 = sp_collection.at(spT.m_link);
+        scalar sum = 0;
+        sum += pow(spB1.y(), 2) + pow(spB1.z(), 2);
+        sum += pow(spT1.y(), 2) + pow(spT1.z(), 2);
+
+        workspace::candidate c{{spB.m_link, spM.m_link, spT.m_link,
+                                triplet.weight, triplet.z_vertex},
+                               sum,
+                               i};
+        if (candidates.size() < capacity) {
+            candidates.push_back(std::move(c));
+            std::push_heap(candidates.begin(), candidates.end(), better);
+        } else if (better(c, candidates.front())) {
+            std::pop_heap(candidates.begin(), candidates.end(), better);
+            candidates.back() = std::move(c);
+            std::push_heap(candidates.begin(), candidates.end(), better);
+        }
     }
 
-    auto itBegin = seeds_per_spM.begin();
-    auto it = seeds_per_spM.begin();
-    // default filter removes the last seeds if maximum amount exceeded
-    // ordering by weight by filterSeeds_2SpFixed means these are the lowest
-    // weight seeds
-
-    for (; it < itBegin + maxSeeds; ++it) {
-        seeds.push_back(*it);
+    // Order the kept candidates, best first.
+    std::sort_heap(candidates.begin(), candidates.end(), better);
+
+    // Keep the best candidate, and the others passing the cut. The default
+    // filter removes the last (lowest weight) seeds if the maximum amount is
+    // exceeded.
+    const std::size_t max_seeds =
+        static_cast<std::size_t>(m_filter_config.maxSeedsPerSpM) + 1u;
+    std::size_t n_seeds = 0;
+    for (std::size_t i = 0; (i < candidates.size()) && (n_seeds < max_seeds);
+         ++i) {
+        const seed& s = candidates[i].s;
+        if ((i == 0) || seed_selecting_helper::cut_per_middle_sp(
+                            m_filter_config, sp_collection, s, s.weight)) {
+            seeds.push_back(s);
+            ++n_seeds;
+        }
     }
 }
 
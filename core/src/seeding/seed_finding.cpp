@@ -1,6 +1,6 @@
 /** TRACCC library, part of the ACTS project (R&D line)
  *
- * (c) 2021-2022 CERN for the benefit of the ACTS project
+ * (c) 2021-2024 CERN for the benefit of the ACTS project
  *
  * Mozilla Public License Version 2.0
  */
@@ -8,62 +8,121 @@
 // Library include(s).
 #include "traccc/seeding/seed_finding.hpp"
 
+#include "traccc/utils/trace.hpp"
+
+// TBB include(s).
+#ifdef TRACCC_CORE_HAVE_TBB
+#include <tbb/parallel_for.h>
+#endif
+
+// System include(s).
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+
 namespace traccc {
 
 seed_finding::seed_finding(const seedfinder_config& finder_config,
-                           const seedfilter_config& filter_config)
+                           const seedfilter_config& filter_config,
+                           bool multi_threaded)
     : m_midBot_finding(finder_config),
       m_midTop_finding(finder_config),
       m_triplet_finding(finder_config),
-      m_seed_filtering(filter_config) {}
+      m_seed_filtering(filter_config),
+      m_multi_threaded(multi_threaded) {}
 
 seed_finding::output_type seed_finding::operator()(
     const spacepoint_collection_types::host& sp_collection,
-    const sp_grid& g2) const {
+    const sp_soa_grid_host& g2) const {
+
+    TRACCC_TRACE_RANGE("traccc::seed_finding");
 
     // Run the algorithm
     output_type seeds;
 
-    for (unsigned int i = 0; i < g2.nbins(); i++) {
-        auto& spM_collection = g2.bin(i);
+    if (m_multi_threaded) {
+
+        // Find the seeds of every bin separately.
+        const unsigned int n_bins = g2.nbins();
+        std::vector<output_type> bin_seeds(n_bins);
+        auto process_bin = [&](unsigned int bin) {
+            find_seeds(sp_collection, g2, bin, bin_seeds[bin]);
+        };
+#if defined(TRACCC_CORE_HAVE_OPENMP)
+#pragma omp taskloop
+        for (unsigned int bin = 0; bin < n_bins; ++bin) {
+            process_bin(bin);
+        }
+#elif defined(TRACCC_CORE_HAVE_TBB)
+        tbb::parallel_for(0u, n_bins, process_bin);
+#else
+        for (unsigned int bin = 0; bin < n_bins; ++bin) {
+            process_bin(bin);
+        }
+#endif
+
+        // Merge the seeds, keeping the order of the bins.
+        std::size_t n_seeds = 0;
+        for (const output_type& s : bin_seeds) {
+            n_seeds += s.size();
+        }
+        seeds.reserve(n_seeds);
+        for (const output_type& s : bin_seeds) {
+            seeds.insert(seeds.end(), s.begin(), s.end());
+        }
+        return seeds;
+    }
+
+    for (unsigned int bin = 0; bin < g2.nbins(); ++bin) {
+        find_seeds(sp_collection, g2, bin, seeds);
+    }
+
+    return seeds;
+}
+
+void seed_finding::find_seeds(
+    const spacepoint_collection_types::host& sp_collection,
+    const sp_soa_grid_host& g2, unsigned int bin, output_type& seeds) const {
 
-        for (unsigned int j = 0; j < spM_collection.size(); ++j) {
+    // Workspace of the seed filtering, shared by the middle spacepoints of
+    // the bin.
+    seed_filtering::workspace filter_ws;
 
-            sp_location spM_location({i, j});
+    for (unsigned int j = 0; j < g2.bin_size(bin); ++j) {
 
-            // middule-bottom doublet search
-            auto mid_bot = m_midBot_finding(g2, spM_location);
+        sp_location spM_location({bin, j});
 
-            if (mid_bot.first.empty())
-                continue;
+        // middule-bottom doublet search
+        auto mid_bot = m_midBot_finding(g2, spM_location);
 
-            // middule-top doublet search
-            auto mid_top = m_midTop_finding(g2, spM_location);
+        if (mid_bot.first.empty())
+            continue;
 
-            if (mid_top.first.empty())
-                continue;
+        // middule-top doublet search
+        auto mid_top = m_midTop_finding(g2, spM_location);
 
-            triplet_collection_types::host triplets_per_spM;
+        if (mid_top.first.empty())
+            continue;
 
-            // triplet search from the combinations of two doublets which
-            // share middle spacepoint
-            for (unsigned int k = 0; k < mid_bot.first.size(); ++k) {
-                auto& doublet_mb = mid_bot.first[k];
-                auto& lb = mid_bot.second[k];
+        triplet_collection_types::host triplets_per_spM;
 
-                triplet_collection_types::host triplets = m_triplet_finding(
-                    g2, doublet_mb, lb, mid_top.first, mid_top.second);
+        // triplet search from the combinations of two doublets which
+        // share middle spacepoint
+        for (unsigned int k = 0; k < mid_bot.first.size(); ++k) {
+            auto& doublet_mb = mid_bot.first[k];
+            auto& lb = mid_bot.second[k];
 
-                triplets_per_spM.insert(std::end(triplets_per_spM),
-                                        triplets.begin(), triplets.end());
-            }
+            triplet_collection_types::host triplets = m_triplet_finding(
+                g2, doublet_mb, lb, mid_top.first, mid_top.second);
 
-            // seed filtering
-            m_seed_filtering(sp_collection, g2, triplets_per_spM, seeds);
+            triplets_per_spM.insert(std::end(triplets_per_spM),
+                                    triplets.begin(), triplets.end());
         }
-    }
 
-    return seeds;
+        // seed filtering
+        m_seed_filtering(sp_collection, g2, triplets_per_spM, seeds,
+                         filter_ws);
+    }
 }
 
 }  // namespace traccc
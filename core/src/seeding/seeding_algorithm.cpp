@@ -1,6 +1,6 @@
 /** TRACCC library, part of the ACTS project (R&D line)
  *
- * (c) 2021-2022 CERN for the benefit of the ACTS project
+ * (c) 2021-2024 CERN for the benefit of the ACTS project
  *
  * Mozilla Public License Version 2.0
  */
@@ -9,6 +9,8 @@
 #include "traccc/seeding/seeding_algorithm.hpp"
 
 #include "traccc/seeding/detail/seeding_config.hpp"
+#include "traccc/utils/trace.hpp"
+#include "traccc/utils/work_model.hpp"
 
 // System include(s).
 #include <cmath>
@@ -19,14 +21,20 @@ namespace traccc {
 seeding_algorithm::seeding_algorithm(const seedfinder_config& finder_config,
                                      const spacepoint_grid_config& grid_config,
                                      const seedfilter_config& filter_config,
-                                     vecmem::memory_resource& mr)
+                                     vecmem::memory_resource& mr,
+                                     bool multi_threaded)
     : m_spacepoint_binning(finder_config, grid_config, mr),
-      m_seed_finding(finder_config, filter_config) {}
+      m_seed_finding(finder_config, filter_config, multi_threaded) {}
 
 seeding_algorithm::output_type seeding_algorithm::operator()(
     const spacepoint_collection_types::host& spacepoints) const {
 
-    return m_seed_finding(spacepoints, m_spacepoint_binning(spacepoints));
+    TRACCC_TRACE_RANGE("traccc::seeding_algorithm");
+
+    output_type result =
+        m_seed_finding(spacepoints, m_spacepoint_binning(spacepoints));
+    count_work(work_model::seeding(spacepoints.size(), result.size()));
+    return result;
 }
 
 }  // namespace traccc
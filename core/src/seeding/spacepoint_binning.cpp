@@ -1,6 +1,6 @@
 /** TRACCC library, part of the ACTS project (R&D line)
  *
- * (c) 2021-2022 CERN for the benefit of the ACTS project
+ * (c) 2021-2024 CERN for the benefit of the ACTS project
  *
  * Mozilla Public License Version 2.0
  */
@@ -10,9 +10,40 @@
 
 #include "traccc/definitions/primitives.hpp"
 #include "traccc/seeding/spacepoint_binning_helper.hpp"
+#include "traccc/utils/trace.hpp"
+
+// TBB include(s).
+#ifdef TRACCC_CORE_HAVE_TBB
+#include <tbb/parallel_for.h>
+#include <tbb/task_arena.h>
+#endif
+
+// System include(s).
+#include <algorithm>
+#include <cstddef>
+#include <numeric>
+#include <vector>
 
 namespace traccc {
 
+namespace {
+
+/// Scratch arrays of the binning, re-used for every event
+struct scratch_arrays {
+    /// The internal spacepoints made from the input spacepoints
+    std::vector<internal_spacepoint<spacepoint>> isps;
+    /// The bin of every input spacepoint
+    std::vector<std::size_t> sp_bins;
+    /// The number of spacepoints in every bin
+    std::vector<unsigned int> counts;
+    /// The indices of the input spacepoints, ordered by bin
+    std::vector<unsigned int> sp_order;
+    /// The insertion cursors of the bins
+    std::vector<unsigned int> cursors;
+};
+
+}  // namespace
+
 spacepoint_binning::spacepoint_binning(
     const seedfinder_config& config, const spacepoint_grid_config& grid_config,
     vecmem::memory_resource& mr)
@@ -24,22 +55,119 @@ spacepoint_binning::spacepoint_binning(
 spacepoint_binning::output_type spacepoint_binning::operator()(
     const spacepoint_collection_types::host& sp_collection) const {
 
-    output_type g2(m_axes.first, m_axes.second, m_mr.get());
+    TRACCC_TRACE_RANGE("traccc::spacepoint_binning");
 
-    auto& phi_axis = g2.axis_p0();
-    auto& z_axis = g2.axis_p1();
+    // Use the Z bins of the configuration, or ones adapted to the Z
+    // distribution of the spacepoints of this event.
+    std::pair<sp_soa_grid_axis_p0_type, sp_soa_grid_axis_p1_type> axes =
+        m_axes;
+    if (m_grid_config.adaptiveZBinsPerEvent) {
+        spacepoint_grid_config grid_config = m_grid_config;
+        grid_config.zBinEdges =
+            adaptive_z_bin_edges(m_config, m_grid_config, sp_collection);
+        axes = get_axes(grid_config, m_mr.get());
+    }
 
-    for (unsigned int i = 0; i < sp_collection.size(); i++) {
-        const spacepoint& sp = sp_collection[i];
-        internal_spacepoint<spacepoint> isp(sp, i, m_config.beamPos);
+    output_type g2(axes.first, axes.second, m_mr.get());
+
+    const auto& phi_axis = g2.axis_p0();
+    const auto& z_axis = g2.axis_p1();
+    const std::size_t n_bins = g2.nbins();
+    const std::size_t n_spacepoints = sp_collection.size();
 
-        if (is_valid_sp(m_config, sp) !=
+    // Find the bin of every spacepoint. Spacepoints not passing the
+    // selection are assigned to the (non-existent) bin n_bins. The scratch
+    // arrays of the calling thread keep their capacity from one event to the
+    // next, without making the (shared) algorithm stateful. The TBB loops
+    // below are isolated, so that the thread does not pick up (the binning
+    // of) another event while waiting for them, which would overwrite the
+    // arrays still in use. (The tied tasks of the OpenMP taskloops only pick
+    // up their own descendants.)
+    static thread_local scratch_arrays scratch;
+    std::vector<internal_spacepoint<spacepoint>>& isps = scratch.isps;
+    isps.resize(n_spacepoints);
+    std::vector<std::size_t>& sp_bins = scratch.sp_bins;
+    sp_bins.resize(n_spacepoints);
+    auto find_bin = [&](std::size_t i) {
+        const spacepoint& sp = sp_collection[i];
+        if (is_valid_sp(m_config, sp) ==
             detray::detail::invalid_value<size_t>()) {
-            const std::size_t bin_index =
-                phi_axis.bin(isp.phi()) + phi_axis.bins() * z_axis.bin(isp.z());
-            g2.bin(bin_index).push_back(std::move(isp));
+            sp_bins[i] = n_bins;
+            return;
+        }
+        isps[i] = internal_spacepoint<spacepoint>(
+            sp, static_cast<unsigned int>(i), m_config.beamPos);
+        sp_bins[i] = phi_axis.bin(isps[i].phi()) +
+                     phi_axis.bins() * z_axis.bin(isps[i].z());
+    };
+#if defined(TRACCC_CORE_HAVE_OPENMP)
+#pragma omp taskloop
+    for (std::size_t i = 0; i < n_spacepoints; ++i) {
+        find_bin(i);
+    }
+#elif defined(TRACCC_CORE_HAVE_TBB)
+    tbb::this_task_arena::isolate([&]() {
+        tbb::parallel_for(std::size_t{0}, n_spacepoints, find_bin);
+    });
+#else
+    for (std::size_t i = 0; i < n_spacepoints; ++i) {
+        find_bin(i);
+    }
+#endif
+
+    // Count the spacepoints of every bin, and turn the counts into bin
+    // offsets with an exclusive prefix sum.
+    std::vector<unsigned int>& counts = scratch.counts;
+    counts.assign(n_bins + 1, 0);
+    for (std::size_t bin : sp_bins) {
+        ++counts[bin];
+    }
+    g2.bin_offsets[0] = 0;
+    std::partial_sum(counts.begin(), counts.end() - 1,
+                     g2.bin_offsets.begin() + 1);
+    g2.resize(g2.bin_offsets.back());
+
+    // Order the spacepoint indices by their bin (counting sort), keeping
+    // spacepoints of the same bin in their original order.
+    std::vector<unsigned int>& sp_order = scratch.sp_order;
+    sp_order.resize(g2.size());
+    {
+        std::vector<unsigned int>& cursors = scratch.cursors;
+        cursors.assign(g2.bin_offsets.begin(), g2.bin_offsets.end() - 1);
+        for (std::size_t i = 0; i < n_spacepoints; ++i) {
+            if (sp_bins[i] < n_bins) {
+                sp_order[cursors[sp_bins[i]]++] = static_cast<unsigned int>(i);
+            }
         }
     }
+
+    // Sort the spacepoints of every bin by radius, and write them (and their
+    // compressed coordinates) into the arrays of the grid.
+    auto fill_bin = [&](std::size_t bin) {
+        const auto begin = sp_order.begin() + g2.bin_begin(bin);
+        const auto end = sp_order.begin() + g2.bin_end(bin);
+        std::sort(begin, end, [&](unsigned int a, unsigned int b) {
+            return grid_bin_order(isps[a].radius(), a, isps[b].radius(), b);
+        });
+        for (unsigned int i = g2.bin_begin(bin); i < g2.bin_end(bin); ++i) {
+            g2.set(i, isps[sp_order[i]]);
+        }
+        compress_grid_bin(g2, static_cast<unsigned int>(bin));
+    };
+#if defined(TRACCC_CORE_HAVE_OPENMP)
+#pragma omp taskloop
+    for (std::size_t bin = 0; bin < n_bins; ++bin) {
+        fill_bin(bin);
+    }
+#elif defined(TRACCC_CORE_HAVE_TBB)
+    tbb::this_task_arena::isolate(
+        [&]() { tbb::parallel_for(std::size_t{0}, n_bins, fill_bin); });
+#else
+    for (std::size_t bin = 0; bin < n_bins; ++bin) {
+        fill_bin(bin);
+    }
+#endif
+
     return g2;
 }
 
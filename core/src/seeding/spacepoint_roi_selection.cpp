@@ -0,0 +1,39 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Library include(s).
+#include "traccc/seeding/spacepoint_roi_selection.hpp"
+
+#include "traccc/utils/trace.hpp"
+
+// System include(s).
+#include <algorithm>
+
+namespace traccc {
+
+spacepoint_roi_selection::spacepoint_roi_selection(vecmem::memory_resource& mr)
+    : m_mr(mr) {}
+
+spacepoint_roi_selection::output_type spacepoint_roi_selection::operator()(
+    const spacepoint_collection_types::host& spacepoints,
+    const region_of_interest_collection_types::host& rois) const {
+
+    TRACCC_TRACE_RANGE("traccc::spacepoint_roi_selection");
+
+    output_type result(&(m_mr.get()));
+    for (const spacepoint& sp : spacepoints) {
+        if (std::any_of(rois.begin(), rois.end(),
+                        [&sp](const region_of_interest& roi) {
+                            return roi.contains(sp.global);
+                        })) {
+            result.push_back(sp);
+        }
+    }
+    return result;
+}
+
+}  // namespace traccc
@@ -1,6 +1,6 @@
 /** TRACCC library, part of the ACTS project (R&D line)
  *
- * (c) 2021-2023 CERN for the benefit of the ACTS project
+ * (c) 2021-2024 CERN for the benefit of the ACTS project
  *
  * Mozilla Public License Version 2.0
  */
@@ -10,6 +10,17 @@
 
 #include "traccc/edm/seed.hpp"
 #include "traccc/seeding/track_params_estimation_helper.hpp"
+#include "traccc/utils/trace.hpp"
+#include "traccc/utils/work_model.hpp"
+
+// TBB include(s).
+#ifdef TRACCC_CORE_HAVE_TBB
+#include <tbb/parallel_for.h>
+#endif
+
+// System include(s).
+#include <algorithm>
+#include <cstddef>
 
 namespace traccc {
 
@@ -21,27 +32,69 @@ track_params_estimation::output_type track_params_estimation::operator()(
     const seed_collection_types::host& seeds, const vector3& bfield,
     const std::array<traccc::scalar, traccc::e_bound_size>& stddev) const {
 
+    TRACCC_TRACE_RANGE("traccc::track_params_estimation");
+
     const unsigned int num_seeds = seeds.size();
     output_type result(num_seeds, &m_mr.get());
 
-    for (unsigned int i = 0; i < num_seeds; ++i) {
-        bound_track_parameters track_params;
-        track_params.set_vector(
-            seed_to_bound_vector(spacepoints, seeds[i], bfield, PION_MASS_MEV));
+    // The covariance is the same for all of the track parameters.
+    bound_covariance covariance = bound_track_parameters{}.covariance();
+    for (std::size_t j = 0; j < e_bound_size; ++j) {
+        getter::element(covariance, j, j) = stddev[j] * stddev[j];
+    }
 
-        // Set Covariance
-        for (std::size_t j = 0; j < e_bound_size; ++j) {
-            getter::element(track_params.covariance(), j, j) =
-                stddev[j] * stddev[j];
-        }
+    // Process the seeds in batches. Gathering the coordinates of their
+    // spacepoints into a batch allows vectorizing the estimation itself.
+    using batch_type = seed_batch<64>;
+    const std::size_t n_batches =
+        (num_seeds + batch_type::capacity - 1) / batch_type::capacity;
+    auto process_batch = [&](const std::size_t ibatch) {
+        const std::size_t offset = ibatch * batch_type::capacity;
+        const std::size_t n =
+            std::min(batch_type::capacity, num_seeds - offset);
+
+        batch_type batch;
+        gather_seed_batch(spacepoints, seeds.data() + offset, n, batch);
 
-        // Get geometry ID for bottom spacepoint
-        const auto& spB = spacepoints.at(seeds[i].spB_link);
-        track_params.set_surface_link(spB.meas.surface_link);
+        std::array<scalar, batch_type::capacity> phi, theta, qoverp, time;
+        seed_batch_to_bound_parameters(batch, n, bfield, PION_MASS_MEV,
+                                       phi.data(), theta.data(),
+                                       qoverp.data(), time.data());
 
-        result[i] = track_params;
+        // Fill the pre-sized output.
+        for (std::size_t i = 0; i < n; ++i) {
+            // Get the measurement of the bottom spacepoint
+            const auto& spB = spacepoints.at(seeds[offset + i].spB_link);
+
+            bound_vector params = bound_track_parameters{}.vector();
+            getter::element(params, e_bound_loc0, 0) = spB.meas.local[0];
+            getter::element(params, e_bound_loc1, 0) = spB.meas.local[1];
+            getter::element(params, e_bound_phi, 0) = phi[i];
+            getter::element(params, e_bound_theta, 0) = theta[i];
+            getter::element(params, e_bound_qoverp, 0) = qoverp[i];
+            getter::element(params, e_bound_time, 0) = time[i];
+
+            bound_track_parameters& track_params = result[offset + i];
+            track_params.set_vector(params);
+            track_params.set_covariance(covariance);
+            track_params.set_surface_link(spB.meas.surface_link);
+        }
+    };
+
+#if defined(TRACCC_CORE_HAVE_OPENMP)
+#pragma omp taskloop
+    for (std::size_t i = 0; i < n_batches; ++i) {
+        process_batch(i);
+    }
+#elif defined(TRACCC_CORE_HAVE_TBB)
+    tbb::parallel_for(std::size_t{0}, n_batches, process_batch);
+#else
+    for (std::size_t i = 0; i < n_batches; ++i) {
+        process_batch(i);
     }
+#endif
 
+    count_work(work_model::track_params_estimation(num_seeds));
     return result;
 }
 
@@ -0,0 +1,158 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Library include(s).
+#include "traccc/streaming/streaming_reconstruction.hpp"
+
+#include "traccc/clusterization/detail/measurement_creation_helper.hpp"
+#include "traccc/utils/trace.hpp"
+
+// System include(s).
+#include <algorithm>
+#include <iterator>
+#include <vector>
+
+namespace traccc {
+
+streaming_reconstruction::streaming_reconstruction(
+    const time_window_config& config, const seedfinder_config& finder_config,
+    const spacepoint_grid_config& grid_config,
+    const seedfilter_config& filter_config,
+    const cell_module_collection_types::host& modules,
+    vecmem::memory_resource& mr)
+    : m_config(config),
+      m_finder_config(finder_config),
+      m_modules(modules),
+      m_mr(mr),
+      m_partitioner(config, mr),
+      m_cc(mr),
+      m_spacepoint_formation(mr),
+      m_seeding(finder_config, grid_config, filter_config, mr),
+      m_track_parameter_estimation(mr),
+      m_deferred_cells(&mr),
+      m_carried_spacepoints(&mr) {}
+
+streaming_reconstruction::output_type streaming_reconstruction::push(
+    const cell_collection_types::host& cells) {
+
+    m_partitioner.push(cells);
+    output_type result;
+    while (m_partitioner.ready()) {
+        result.push_back(process(false));
+    }
+    return result;
+}
+
+streaming_reconstruction::output_type streaming_reconstruction::finish() {
+
+    m_partitioner.finish();
+    output_type result;
+    while (m_partitioner.ready() || (m_deferred_cells.empty() == false)) {
+        result.push_back(process(true));
+    }
+    return result;
+}
+
+time_window_result streaming_reconstruction::process(bool finishing) {
+
+    TRACCC_TRACE_RANGE("traccc::streaming_reconstruction");
+
+    // Set up the result object.
+    vecmem::memory_resource& mr = m_mr.get();
+    time_window_result result{
+        m_partitioner.window_index(),
+        m_partitioner.window_begin(),
+        m_partitioner.window_end(),
+        measurement_collection_types::host{&mr},
+        spacepoint_collection_types::host{&mr},
+        0u,
+        seed_collection_types::host{&mr},
+        bound_track_parameters_collection_types::host{&mr}};
+
+    // Collect the cells of the window, together with the cells of the
+    // clusters deferred by the previous window.
+    cell_collection_types::host cells = m_partitioner.pop();
+    const bool last = finishing && (m_partitioner.ready() == false);
+    if (m_deferred_cells.empty() == false) {
+        cells.insert(cells.end(), m_deferred_cells.begin(),
+                     m_deferred_cells.end());
+        std::sort(cells.begin(), cells.end());
+        m_deferred_cells.clear();
+    }
+
+    // Create the measurements of the clusters that can not grow any more,
+    // and defer the others to the next window. Remember the (latest) time of
+    // every measurement.
+    const cluster_container_types::host clusters = m_cc(cells);
+    std::vector<scalar> times;
+    times.reserve(clusters.size());
+    const scalar cluster_limit = result.end - m_config.cluster_time_window;
+    for (std::size_t i = 0; i < clusters.size(); ++i) {
+
+        const auto& cluster = clusters.at(i).items;
+        scalar time = cluster.at(0).time;
+        for (const cell& c : cluster) {
+            time = std::max(time, c.time);
+        }
+        if ((last == false) && (time >= cluster_limit)) {
+            m_deferred_cells.insert(m_deferred_cells.end(), cluster.begin(),
+                                    cluster.end());
+            continue;
+        }
+
+        const auto module_link = cluster.at(0).module_link;
+        const std::size_t n_measurements = result.measurements.size();
+        detail::fill_measurement(result.measurements, cluster,
+                                 m_modules.at(module_link), module_link);
+        if (result.measurements.size() > n_measurements) {
+            times.push_back(time);
+        }
+    }
+
+    // Form the spacepoints of the new measurements, and seed them together
+    // with the spacepoints carried over from the previous window.
+    const spacepoint_collection_types::host spacepoints =
+        m_spacepoint_formation(result.measurements, m_modules);
+    result.n_carried_spacepoints = m_carried_spacepoints.size();
+    result.spacepoints.reserve(m_carried_spacepoints.size() +
+                               spacepoints.size());
+    result.spacepoints.insert(result.spacepoints.end(),
+                              m_carried_spacepoints.begin(),
+                              m_carried_spacepoints.end());
+    result.spacepoints.insert(result.spacepoints.end(), spacepoints.begin(),
+                              spacepoints.end());
+
+    // Drop the seeds made only of carried spacepoints, which the previous
+    // window found already.
+    const seed_collection_types::host seeds = m_seeding(result.spacepoints);
+    const std::size_t n_carried = result.n_carried_spacepoints;
+    std::copy_if(seeds.begin(), seeds.end(), std::back_inserter(result.seeds),
+                 [n_carried](const seed& s) {
+                     return (s.spB_link >= n_carried) ||
+                            (s.spM_link >= n_carried) ||
+                            (s.spT_link >= n_carried);
+                 });
+    result.params = m_track_parameter_estimation(
+        result.spacepoints, result.seeds,
+        {0.f, 0.f, m_finder_config.bFieldInZ});
+
+    // Carry the spacepoints close to the end of the window over to the next
+    // one.
+    m_carried_spacepoints.clear();
+    if (last == false) {
+        const scalar carry_limit = result.end - m_config.overlap;
+        for (std::size_t i = 0; i < spacepoints.size(); ++i) {
+            if (times[i] >= carry_limit) {
+                m_carried_spacepoints.push_back(spacepoints[i]);
+            }
+        }
+    }
+
+    return result;
+}
+
+}  // namespace traccc
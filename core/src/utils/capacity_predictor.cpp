@@ -0,0 +1,54 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Library include(s).
+#include "traccc/utils/capacity_predictor.hpp"
+
+// System include(s).
+#include <algorithm>
+#include <cmath>
+
+namespace traccc {
+
+capacity_predictor::capacity_predictor(const config& cfg) : m_cfg(cfg) {
+
+    m_cfg.history = std::max(m_cfg.history, 1u);
+    m_ratios.reserve(m_cfg.history);
+}
+
+bool capacity_predictor::ready() const {
+
+    return !m_ratios.empty();
+}
+
+unsigned int capacity_predictor::predict(unsigned int n_input) const {
+
+    const float ratio =
+        m_ratios.empty() ? 0.f
+                         : *std::max_element(m_ratios.begin(), m_ratios.end());
+    const float capacity =
+        std::ceil(ratio * m_cfg.margin * static_cast<float>(n_input));
+    return std::max(1u, static_cast<unsigned int>(capacity));
+}
+
+void capacity_predictor::record(unsigned int n_input, unsigned int n_output) {
+
+    // Events without input do not tell anything about the ratio.
+    if (n_input == 0) {
+        return;
+    }
+    const float ratio =
+        static_cast<float>(n_output) / static_cast<float>(n_input);
+    if (m_ratios.size() < m_cfg.history) {
+        m_ratios.push_back(ratio);
+    } else {
+        m_ratios[m_next] = ratio;
+    }
+    m_next = (m_next + 1) % m_cfg.history;
+}
+
+}  // namespace traccc
@@ -0,0 +1,157 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Library include(s).
+#include "traccc/utils/instrumented_memory_resource.hpp"
+
+// System include(s).
+#include <algorithm>
+#include <iomanip>
+#include <iostream>
+
+namespace traccc {
+
+namespace {
+
+/// The processing stage of the current thread
+thread_local const char* thread_stage = instrumented_memory_resource::no_stage;
+
+/// Record an allocation in some statistics
+void add_allocation(memory_usage& usage, std::size_t bytes) {
+
+    ++(usage.allocations);
+    usage.allocated_bytes += bytes;
+    usage.current_bytes += bytes;
+    usage.peak_bytes = std::max(usage.peak_bytes, usage.current_bytes);
+}
+
+/// Record a deallocation in some statistics
+void add_deallocation(memory_usage& usage, std::size_t bytes) {
+
+    ++(usage.deallocations);
+    usage.current_bytes -= std::min(usage.current_bytes, bytes);
+}
+
+/// Print a number of bytes in MB
+std::ostream& print_mb(std::ostream& out, std::size_t bytes) {
+
+    return out << std::setw(12)
+               << static_cast<double>(bytes) / (1024. * 1024.);
+}
+
+}  // namespace
+
+void memory_usage::merge(const memory_usage& other) {
+
+    allocations += other.allocations;
+    deallocations += other.deallocations;
+    allocated_bytes += other.allocated_bytes;
+    current_bytes += other.current_bytes;
+    peak_bytes = std::max(peak_bytes, other.peak_bytes);
+}
+
+void memory_statistics::merge(const memory_statistics& other) {
+
+    total.merge(other.total);
+    for (const auto& [name, usage] : other.stages) {
+        stages[name].merge(usage);
+    }
+}
+
+std::ostream& operator<<(std::ostream& out, const memory_statistics& stats) {
+
+    const auto flags = out.flags();
+    const auto precision = out.precision();
+    out << std::setw(28) << std::left << "Stage" << std::right
+        << std::setw(14) << "allocations" << std::setw(12) << "total [MB]"
+        << std::setw(12) << "peak [MB]" << std::setw(12) << "live [MB]";
+    out << std::fixed << std::setprecision(3);
+    auto print_usage = [&out](const std::string& name,
+                              const memory_usage& usage) {
+        out << "\n" << std::setw(28) << std::left << name << std::right
+            << std::setw(14) << usage.allocations;
+        print_mb(out, usage.allocated_bytes);
+        print_mb(out, usage.peak_bytes);
+        print_mb(out, usage.current_bytes);
+    };
+    for (const auto& [name, usage] : stats.stages) {
+        print_usage("  " + name, usage);
+    }
+    print_usage("Total", stats.total);
+    out.flags(flags);
+    out.precision(precision);
+    return out;
+}
+
+instrumented_memory_resource::stage::stage(const char* name)
+    : m_previous(thread_stage) {
+
+    thread_stage = name;
+}
+
+instrumented_memory_resource::stage::~stage() {
+
+    thread_stage = m_previous;
+}
+
+instrumented_memory_resource::instrumented_memory_resource(
+    vecmem::memory_resource& upstream)
+    : m_upstream(upstream) {}
+
+memory_statistics instrumented_memory_resource::statistics() const {
+
+    std::lock_guard lock{m_mutex};
+    memory_statistics result;
+    result.total = m_total;
+    for (const auto& [name, usage] : m_stages) {
+        result.stages[name].merge(usage);
+    }
+    return result;
+}
+
+void instrumented_memory_resource::reset_peak() {
+
+    std::lock_guard lock{m_mutex};
+    m_total.peak_bytes = m_total.current_bytes;
+    for (auto& [name, usage] : m_stages) {
+        usage.peak_bytes = usage.current_bytes;
+    }
+}
+
+void* instrumented_memory_resource::do_allocate(std::size_t bytes,
+                                                std::size_t alignment) {
+
+    void* ptr = m_upstream.allocate(bytes, alignment);
+    std::lock_guard lock{m_mutex};
+    add_allocation(m_total, bytes);
+    add_allocation(m_stages[thread_stage], bytes);
+    m_live[ptr] = thread_stage;
+    return ptr;
+}
+
+void instrumented_memory_resource::do_deallocate(void* ptr, std::size_t bytes,
+                                                 std::size_t alignment) {
+
+    {
+        std::lock_guard lock{m_mutex};
+        add_deallocation(m_total, bytes);
+        auto it = m_live.find(ptr);
+        if (it != m_live.end()) {
+            add_deallocation(m_stages[it->second], bytes);
+            m_live.erase(it);
+        }
+    }
+    m_upstream.deallocate(ptr, bytes, alignment);
+}
+
+bool instrumented_memory_resource::do_is_equal(
+    const vecmem::memory_resource& other) const noexcept {
+
+    return (this == &other);
+}
+
+}  // namespace traccc
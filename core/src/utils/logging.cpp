@@ -0,0 +1,113 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Library include(s).
+#include "traccc/utils/logging.hpp"
+
+// System include(s).
+#include <iostream>
+#include <mutex>
+#include <string>
+
+namespace traccc::logging {
+
+namespace {
+
+/// The size of the buffered messages, above which a thread writes them out
+constexpr std::size_t flush_threshold = 4096;
+
+/// The output of the log messages, with the mutex protecting it
+struct log_output {
+    /// The stream the messages are written to
+    std::ostream* stream = &std::cout;
+    /// Mutex serializing the writes of the threads
+    std::mutex mutex;
+};
+
+/// Get the output of the log messages
+log_output& output() {
+
+    static log_output result;
+    return result;
+}
+
+/// The log messages buffered by one thread
+struct thread_buffer {
+
+    /// Write out the buffered messages
+    void flush() {
+
+        if (text.empty()) {
+            return;
+        }
+        log_output& out = output();
+        {
+            std::lock_guard lock{out.mutex};
+            out.stream->write(text.data(),
+                              static_cast<std::streamsize>(text.size()));
+            out.stream->flush();
+        }
+        text.clear();
+    }
+
+    /// Write out the remaining messages when the thread exits
+    ~thread_buffer() { flush(); }
+
+    /// The buffered messages
+    std::string text;
+};
+
+/// Get the buffer of the calling thread
+thread_buffer& buffer() {
+
+    static thread_local thread_buffer result;
+    return result;
+}
+
+/// Get the prefix of the messages of a level
+const char* prefix(level lvl) {
+
+    switch (lvl) {
+        case level::warning:
+            return "WARNING ";
+        case level::error:
+            return "ERROR ";
+        default:
+            return "";
+    }
+}
+
+}  // namespace
+
+void set_output(std::ostream& out) {
+
+    log_output& result = output();
+    std::lock_guard lock{result.mutex};
+    result.stream = &out;
+}
+
+void flush() {
+
+    buffer().flush();
+}
+
+message::message(level lvl, const char* source) : m_level(lvl) {
+
+    m_stream << prefix(lvl) << '@' << source << ": ";
+}
+
+message::~message() {
+
+    thread_buffer& buf = buffer();
+    buf.text += m_stream.str();
+    buf.text += '\n';
+    if ((m_level >= level::warning) || (buf.text.size() >= flush_threshold)) {
+        buf.flush();
+    }
+}
+
+}  // namespace traccc::logging
@@ -0,0 +1,34 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Library include(s).
+#include "traccc/utils/parallel_for.hpp"
+
+// TBB include(s).
+#ifdef TRACCC_CORE_HAVE_TBB
+#include <tbb/parallel_for.h>
+#endif
+
+namespace traccc::details {
+
+void parallel_for(std::size_t n, const std::function<void(std::size_t)>& func) {
+
+#if defined(TRACCC_CORE_HAVE_OPENMP)
+#pragma omp taskloop
+    for (std::size_t i = 0; i < n; ++i) {
+        func(i);
+    }
+#elif defined(TRACCC_CORE_HAVE_TBB)
+    tbb::parallel_for(std::size_t{0}, n, func);
+#else
+    for (std::size_t i = 0; i < n; ++i) {
+        func(i);
+    }
+#endif
+}
+
+}  // namespace traccc::details
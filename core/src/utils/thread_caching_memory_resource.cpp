@@ -0,0 +1,69 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Library include(s).
+#include "traccc/utils/thread_caching_memory_resource.hpp"
+
+// TBB include(s).
+#ifdef TRACCC_CORE_HAVE_TBBMALLOC
+#include <tbb/scalable_allocator.h>
+#endif  // TRACCC_CORE_HAVE_TBBMALLOC
+
+// System include(s).
+#include <new>
+
+namespace traccc {
+
+bool thread_caching_memory_resource::is_thread_caching() {
+
+#ifdef TRACCC_CORE_HAVE_TBBMALLOC
+    return true;
+#else
+    return false;
+#endif  // TRACCC_CORE_HAVE_TBBMALLOC
+}
+
+void* thread_caching_memory_resource::do_allocate(std::size_t bytes,
+                                                  std::size_t alignment) {
+
+    if (bytes == 0) {
+        return nullptr;
+    }
+#ifdef TRACCC_CORE_HAVE_TBBMALLOC
+    void* result = scalable_aligned_malloc(bytes, alignment);
+    if (result == nullptr) {
+        throw std::bad_alloc();
+    }
+    return result;
+#else
+    return ::operator new(bytes, std::align_val_t{alignment});
+#endif  // TRACCC_CORE_HAVE_TBBMALLOC
+}
+
+void thread_caching_memory_resource::do_deallocate(void* ptr, std::size_t,
+                                                   std::size_t alignment) {
+
+    if (ptr == nullptr) {
+        return;
+    }
+#ifdef TRACCC_CORE_HAVE_TBBMALLOC
+    (void)alignment;
+    scalable_aligned_free(ptr);
+#else
+    ::operator delete(ptr, std::align_val_t{alignment});
+#endif  // TRACCC_CORE_HAVE_TBBMALLOC
+}
+
+bool thread_caching_memory_resource::do_is_equal(
+    const vecmem::memory_resource& other) const noexcept {
+
+    // Memory from any instance can be given back through any other one.
+    return (dynamic_cast<const thread_caching_memory_resource*>(&other) !=
+            nullptr);
+}
+
+}  // namespace traccc
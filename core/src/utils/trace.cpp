@@ -0,0 +1,121 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Library include(s).
+#include "traccc/utils/trace.hpp"
+
+// Profiler include(s).
+#ifdef TRACCC_HAVE_NVTX
+#include "nvtx3/nvToolsExt.h"
+#endif  // TRACCC_HAVE_NVTX
+#ifdef TRACCC_HAVE_ITT
+#include <ittnotify.h>
+#endif  // TRACCC_HAVE_ITT
+#ifdef TRACCC_HAVE_ROCTX
+#include <roctx.h>
+#endif  // TRACCC_HAVE_ROCTX
+
+// System include(s).
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <unordered_map>
+
+namespace traccc::trace {
+
+namespace {
+
+/// The event number processed by the current thread
+thread_local std::size_t thread_event = no_event;
+
+#ifdef TRACCC_HAVE_ITT
+/// The ITT domain of all traccc ranges
+__itt_domain* itt_domain() {
+    static __itt_domain* domain = __itt_domain_create("traccc");
+    return domain;
+}
+
+/// Get the (cached) ITT string handle belonging to a name
+__itt_string_handle* itt_handle(const char* name) {
+    thread_local std::unordered_map<const char*, __itt_string_handle*> cache;
+    auto it = cache.find(name);
+    if (it == cache.end()) {
+        it = cache.emplace(name, __itt_string_handle_create(name)).first;
+    }
+    return it->second;
+}
+#endif  // TRACCC_HAVE_ITT
+
+}  // namespace
+
+std::size_t current_event() {
+
+    return thread_event;
+}
+
+event_scope::event_scope(std::size_t event) : m_previous(thread_event) {
+
+    thread_event = event;
+}
+
+event_scope::~event_scope() {
+
+    thread_event = m_previous;
+}
+
+range::range([[maybe_unused]] const char* name) {
+
+#ifdef TRACCC_HAVE_NVTX
+    nvtxEventAttributes_t attributes;
+    std::memset(&attributes, 0, sizeof(nvtxEventAttributes_t));
+    attributes.version = NVTX_VERSION;
+    attributes.size = NVTX_EVENT_ATTRIB_STRUCT_SIZE;
+    attributes.messageType = NVTX_MESSAGE_TYPE_ASCII;
+    attributes.message.ascii = name;
+    if (thread_event != no_event) {
+        attributes.payloadType = NVTX_PAYLOAD_TYPE_UNSIGNED_INT64;
+        attributes.payload.ullValue = thread_event;
+    }
+    nvtxRangePushEx(&attributes);
+#endif  // TRACCC_HAVE_NVTX
+
+#ifdef TRACCC_HAVE_ITT
+    __itt_task_begin(itt_domain(), __itt_null, __itt_null, itt_handle(name));
+    if (thread_event != no_event) {
+        std::uint64_t event = thread_event;
+        __itt_metadata_add(itt_domain(), __itt_null, itt_handle("event"),
+                           __itt_metadata_u64, 1, &event);
+    }
+#endif  // TRACCC_HAVE_ITT
+
+#ifdef TRACCC_HAVE_ROCTX
+    // ROCTx ranges have no payload, so the event number becomes part of the
+    // message.
+    if (thread_event != no_event) {
+        roctxRangePushA((std::string{name} + " (event " +
+                         std::to_string(thread_event) + ")")
+                            .c_str());
+    } else {
+        roctxRangePushA(name);
+    }
+#endif  // TRACCC_HAVE_ROCTX
+}
+
+range::~range() {
+
+#ifdef TRACCC_HAVE_ROCTX
+    roctxRangePop();
+#endif  // TRACCC_HAVE_ROCTX
+#ifdef TRACCC_HAVE_ITT
+    __itt_task_end(itt_domain());
+#endif  // TRACCC_HAVE_ITT
+#ifdef TRACCC_HAVE_NVTX
+    nvtxRangePop();
+#endif  // TRACCC_HAVE_NVTX
+}
+
+}  // namespace traccc::trace
@@ -0,0 +1,39 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Library include(s).
+#include "traccc/utils/traced_memory_resource.hpp"
+
+#include "traccc/utils/trace.hpp"
+
+namespace traccc {
+
+traced_memory_resource::traced_memory_resource(
+    vecmem::memory_resource& upstream, const char* name)
+    : m_upstream(upstream), m_name(name) {}
+
+void* traced_memory_resource::do_allocate(std::size_t bytes,
+                                          std::size_t alignment) {
+
+    TRACCC_TRACE_RANGE(m_name);
+    return m_upstream.allocate(bytes, alignment);
+}
+
+void traced_memory_resource::do_deallocate(void* ptr, std::size_t bytes,
+                                           std::size_t alignment) {
+
+    TRACCC_TRACE_RANGE(m_name);
+    m_upstream.deallocate(ptr, bytes, alignment);
+}
+
+bool traced_memory_resource::do_is_equal(
+    const vecmem::memory_resource& other) const noexcept {
+
+    return (this == &other);
+}
+
+}  // namespace traccc
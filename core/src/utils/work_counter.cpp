@@ -0,0 +1,76 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Library include(s).
+#include "traccc/utils/work_counter.hpp"
+
+namespace traccc {
+
+namespace {
+
+/// The counter that the current thread adds its work to
+thread_local work_counter* thread_counter = nullptr;
+/// The stage that the current thread adds its work to
+thread_local std::string_view thread_stage;
+
+}  // namespace
+
+work_estimate& work_estimate::operator+=(const work_estimate& other) {
+
+    bytes_read += other.bytes_read;
+    bytes_written += other.bytes_written;
+    flops += other.flops;
+    return *this;
+}
+
+work_counter::scope::scope(work_counter& counter, std::string_view stage)
+    : scope(&counter, stage) {}
+
+work_counter::scope::scope(work_counter* counter, std::string_view stage)
+    : m_previous_counter(thread_counter), m_previous_stage(thread_stage) {
+
+    if (counter != nullptr) {
+        thread_counter = counter;
+        thread_stage = stage;
+    }
+}
+
+work_counter::scope::~scope() {
+
+    thread_counter = m_previous_counter;
+    thread_stage = m_previous_stage;
+}
+
+void work_counter::add(std::string_view stage, const work_estimate& work) {
+
+    std::lock_guard lock{m_mutex};
+    auto it = m_stages.find(stage);
+    if (it == m_stages.end()) {
+        it = m_stages.emplace(std::string{stage}, work_estimate{}).first;
+    }
+    it->second += work;
+}
+
+std::map<std::string, work_estimate> work_counter::stages() const {
+
+    std::lock_guard lock{m_mutex};
+    return {m_stages.begin(), m_stages.end()};
+}
+
+bool counting_work() {
+
+    return (thread_counter != nullptr);
+}
+
+void count_work(const work_estimate& work) {
+
+    if (thread_counter != nullptr) {
+        thread_counter->add(thread_stage, work);
+    }
+}
+
+}  // namespace traccc
@@ -0,0 +1,144 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Library include(s).
+#include "traccc/utils/workspace_resource.hpp"
+
+// System include(s).
+#include <algorithm>
+#include <cassert>
+#include <cstdint>
+
+namespace traccc {
+
+namespace {
+
+/// Alignment of the memory block, and of every slice handed out from it
+///
+/// Large enough for coalesced memory access on GPUs, and for every
+/// fundamental type.
+///
+static constexpr std::size_t slice_alignment = 256;
+
+/// Round a size up to a multiple of an alignment
+std::size_t align_up(std::size_t size, std::size_t alignment) {
+    return ((size + alignment - 1) / alignment) * alignment;
+}
+
+}  // namespace
+
+workspace_resource::workspace_resource(vecmem::memory_resource& upstream,
+                                       std::size_t capacity)
+    : m_upstream(upstream) {
+
+    reserve(capacity);
+}
+
+workspace_resource::~workspace_resource() {
+
+    for (const overflow_allocation& alloc : m_overflow) {
+        m_upstream.deallocate(alloc.ptr, alloc.bytes, alloc.alignment);
+    }
+    if (m_block != nullptr) {
+        m_upstream.deallocate(m_block, m_capacity, slice_alignment);
+    }
+}
+
+void workspace_resource::reserve(std::size_t capacity) {
+
+    assert(m_used == 0);
+    capacity = align_up(capacity, slice_alignment);
+    if (capacity <= m_capacity) {
+        return;
+    }
+    if (m_block != nullptr) {
+        m_upstream.deallocate(m_block, m_capacity, slice_alignment);
+        m_block = nullptr;
+        m_capacity = 0;
+    }
+    m_block = m_upstream.allocate(capacity, slice_alignment);
+    m_capacity = capacity;
+}
+
+void workspace_resource::reset() {
+
+    // Free the allocations that did not fit into the block.
+    for (const overflow_allocation& alloc : m_overflow) {
+        m_upstream.deallocate(alloc.ptr, alloc.bytes, alloc.alignment);
+    }
+    m_overflow.clear();
+
+    // Grow the block, so that everything fits into it next time.
+    const std::size_t used = m_used;
+    const bool overflowed = m_overflowed;
+    m_offset = 0;
+    m_used = 0;
+    m_overflowed = false;
+    if (overflowed) {
+        reserve(std::max(used, 2 * m_capacity));
+    }
+}
+
+std::size_t workspace_resource::capacity() const {
+
+    return m_capacity;
+}
+
+std::size_t workspace_resource::used() const {
+
+    return m_used;
+}
+
+void* workspace_resource::do_allocate(std::size_t bytes,
+                                      std::size_t alignment) {
+
+    const std::size_t slice_bytes =
+        align_up(std::max<std::size_t>(bytes, 1), slice_alignment);
+    m_used += slice_bytes;
+
+    // Serve the allocation from the block, if it fits.
+    if ((alignment <= slice_alignment) &&
+        (m_offset + slice_bytes <= m_capacity)) {
+        void* result = static_cast<std::uint8_t*>(m_block) + m_offset;
+        m_offset += slice_bytes;
+        return result;
+    }
+
+    // If not, allocate it from the upstream resource.
+    void* result = m_upstream.allocate(bytes, alignment);
+    m_overflowed = true;
+    m_overflow.push_back({result, bytes, alignment});
+    return result;
+}
+
+void workspace_resource::do_deallocate(void* ptr, std::size_t,
+                                       std::size_t) {
+
+    // Slices of the block are only released all at once, by reset().
+    const std::uint8_t* begin = static_cast<const std::uint8_t*>(m_block);
+    const std::uint8_t* p = static_cast<const std::uint8_t*>(ptr);
+    if ((m_block != nullptr) && (p >= begin) && (p < begin + m_capacity)) {
+        return;
+    }
+
+    // Give overflow allocations back to the upstream resource right away.
+    auto it = std::find_if(
+        m_overflow.begin(), m_overflow.end(),
+        [ptr](const overflow_allocation& alloc) { return alloc.ptr == ptr; });
+    if (it != m_overflow.end()) {
+        m_upstream.deallocate(it->ptr, it->bytes, it->alignment);
+        m_overflow.erase(it);
+    }
+}
+
+bool workspace_resource::do_is_equal(
+    const vecmem::memory_resource& other) const noexcept {
+
+    return (this == &other);
+}
+
+}  // namespace traccc
@@ -1,6 +1,6 @@
 /** TRACCC library, part of the ACTS project (R&D line)
  *
- * (c) 2023 CERN for the benefit of the ACTS project
+ * (c) 2023-2024 CERN for the benefit of the ACTS project
  *
  * Mozilla Public License Version 2.0
  */
@@ -10,8 +10,9 @@
 // Project include(s).
 #include "traccc/edm/seed.hpp"
 #include "traccc/edm/spacepoint.hpp"
+#include "traccc/seeding/detail/seed_finding_capacities.hpp"
 #include "traccc/seeding/detail/seeding_config.hpp"
-#include "traccc/seeding/detail/spacepoint_grid.hpp"
+#include "traccc/seeding/detail/spacepoint_soa_grid.hpp"
 #include "traccc/utils/algorithm.hpp"
 #include "traccc/utils/memory_resource.hpp"
 
@@ -26,7 +27,7 @@ namespace traccc::alpaka {
 /// Seed finding for alpaka
 class seed_finding : public algorithm<seed_collection_types::buffer(
                          const spacepoint_collection_types::const_view&,
-                         const sp_grid_const_view&)> {
+                         const sp_soa_grid_types::const_view&)> {
 
     public:
     /// Constructor for the alpaka seed finding
@@ -37,9 +38,13 @@ class seed_finding : public algorithm<seed_collection_types::buffer(
     /// @param mr vecmem memory resource
     /// @param copy The copy object to use for copying data between device
     ///             and host memory blocks
+    /// @param capacities The capacities to use for finding the seeds without
+    ///                   intermediate host synchronisation (disabled by
+    ///                   default)
     seed_finding(const seedfinder_config& config,
                  const seedfilter_config& filter_config,
-                 const traccc::memory_resource& mr, vecmem::copy& copy);
+                 const traccc::memory_resource& mr, vecmem::copy& copy,
+                 const seed_finding_capacities& capacities = {});
 
     /// Callable operator for the seed finding
     ///
@@ -49,11 +54,28 @@ class seed_finding : public algorithm<seed_collection_types::buffer(
     ///
     output_type operator()(
         const spacepoint_collection_types::const_view& spacepoints_view,
-        const sp_grid_const_view& g2_view) const override;
+        const sp_soa_grid_types::const_view& g2_view) const override;
 
     private:
+    /// Find the seeds, with either exactly sized or capacity-bounded buffers
+    ///
+    /// @param spacepoints_view     is a view of all spacepoints in the event
+    /// @param g2_view              is a view of the spacepoint grid
+    /// @param num_spacepoints      is the number of spacepoints in the grid
+    /// @param bounded              whether to use @c m_capacities
+    /// @param fits                 set to whether all doublets and triplets
+    ///                             fit into the buffers
+    /// @return                     a vector buffer of seeds
+    ///
+    output_type find_seeds(
+        const spacepoint_collection_types::const_view& spacepoints_view,
+        const sp_soa_grid_types::const_view& g2_view,
+        unsigned int num_spacepoints, bool bounded, bool& fits) const;
+
     seedfinder_config m_seedfinder_config;
     seedfilter_config m_seedfilter_config;
+    /// Capacities for the bounded (synchronisation-free) mode
+    seed_finding_capacities m_capacities;
     traccc::memory_resource m_mr;
     vecmem::copy& m_copy;
 };
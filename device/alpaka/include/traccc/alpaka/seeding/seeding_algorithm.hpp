@@ -1,6 +1,6 @@
 /** TRACCC library, part of the ACTS project (R&D line)
  *
- * (c) 2023 CERN for the benefit of the ACTS project
+ * (c) 2023-2024 CERN for the benefit of the ACTS project
  *
  * Mozilla Public License Version 2.0
  */
@@ -35,11 +35,15 @@ class seeding_algorithm : public algorithm<seed_collection_types::buffer(
     /// @param mr The memory resource(s) to use in the algorithm
     /// @param copy The copy object to use for copying data between device
     ///             and host memory blocks
+    /// @param capacities The capacities to use for finding the seeds without
+    ///                   intermediate host synchronisation (disabled by
+    ///                   default)
     ///
     seeding_algorithm(const seedfinder_config& finder_config,
                       const spacepoint_grid_config& grid_config,
                       const seedfilter_config& filter_config,
-                      const traccc::memory_resource& mr, vecmem::copy& copy);
+                      const traccc::memory_resource& mr, vecmem::copy& copy,
+                      const seed_finding_capacities& capacities = {});
 
     /// Operator executing the algorithm.
     ///
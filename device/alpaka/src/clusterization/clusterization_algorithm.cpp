@@ -0,0 +1,242 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Local include(s).
+#include "traccc/alpaka/clusterization/clusterization_algorithm.hpp"
+
+#include "../utils/barrier.hpp"
+#include "../utils/utils.hpp"
+
+// Project include(s)
+#include "traccc/clusterization/device/ccl_kernel.hpp"
+#include "traccc/clusterization/device/form_spacepoints.hpp"
+#include "traccc/utils/trace.hpp"
+
+// System include(s).
+#include <algorithm>
+#include <cstddef>
+
+namespace traccc::alpaka {
+
+namespace {
+/// These indices in clusterization will only range from 0 to
+/// max_cells_per_partition, so we only need a short
+using index_t = unsigned short;
+
+static constexpr int TARGET_CELLS_PER_THREAD = 8;
+static constexpr int MAX_CELLS_PER_THREAD = 12;
+}  // namespace
+
+/// Kernel for running @c traccc::device::ccl_kernel, with one thread block
+/// per partition
+struct CCLKernel {
+    template <typename TAcc>
+    ALPAKA_FN_ACC void operator()(
+        TAcc const& acc, const cell_collection_types::const_view cells_view,
+        const cell_module_collection_types::const_view modules_view,
+        const index_t max_cells_per_partition,
+        const index_t target_cells_per_partition,
+        measurement_collection_types::view measurements_view,
+        unsigned int* measurement_count,
+        vecmem::data::vector_view<unsigned int> cell_links,
+        vecmem::data::vector_view<unsigned int> ccl_backup) const {
+
+        auto const localThreadIdx =
+            ::alpaka::getIdx<::alpaka::Block, ::alpaka::Threads>(acc)[0u];
+        auto const blockIdx =
+            ::alpaka::getIdx<::alpaka::Grid, ::alpaka::Blocks>(acc)[0u];
+        auto const blockExtent =
+            ::alpaka::getWorkDiv<::alpaka::Block, ::alpaka::Threads>(acc)[0u];
+
+        // The partition boundaries, the number of measurements of the block,
+        // and the (two) arrays of cell labels live in shared memory.
+        auto& partition_start =
+            ::alpaka::declareSharedVar<unsigned int, __COUNTER__>(acc);
+        auto& partition_end =
+            ::alpaka::declareSharedVar<unsigned int, __COUNTER__>(acc);
+        auto& outi = ::alpaka::declareSharedVar<unsigned int, __COUNTER__>(acc);
+        index_t* const f = ::alpaka::getDynSharedMem<index_t>(acc);
+        index_t* const f_next = f + max_cells_per_partition;
+
+        details::barrier<TAcc> barry_r(acc);
+
+        device::ccl_kernel(static_cast<index_t>(localThreadIdx),
+                           static_cast<index_t>(blockExtent), blockIdx,
+                           cells_view, modules_view, max_cells_per_partition,
+                           target_cells_per_partition, partition_start,
+                           partition_end, outi, f, f_next, barry_r,
+                           measurements_view, *measurement_count, cell_links,
+                           ccl_backup);
+    }
+};
+
+/// Kernel for running @c traccc::device::form_spacepoints
+struct FormSpacepointsKernel {
+    template <typename TAcc>
+    ALPAKA_FN_ACC void operator()(
+        TAcc const& acc,
+        measurement_collection_types::const_view measurements_view,
+        cell_module_collection_types::const_view modules_view,
+        const unsigned int measurement_count,
+        spacepoint_collection_types::view spacepoints_view) const {
+        auto const globalThreadIdx =
+            ::alpaka::getIdx<::alpaka::Grid, ::alpaka::Threads>(acc)[0u];
+        device::form_spacepoints(globalThreadIdx, measurements_view,
+                                 modules_view, measurement_count,
+                                 spacepoints_view);
+    }
+};
+
+clusterization_algorithm::clusterization_algorithm(
+    const traccc::memory_resource& mr, vecmem::copy& copy,
+    const unsigned short target_cells_per_partition, bool produce_cell_links)
+    : m_target_cells_per_partition(target_cells_per_partition),
+      m_produce_cell_links(produce_cell_links),
+      m_mr(mr),
+      m_copy(copy) {}
+
+clusterization_algorithm::output_type clusterization_algorithm::operator()(
+    const cell_collection_types::const_view& cells,
+    const cell_module_collection_types::const_view& modules) const {
+
+    TRACCC_TRACE_RANGE("traccc::alpaka::clusterization_algorithm");
+
+    auto result = run_with_measurements(cells, modules);
+    return {std::move(std::get<1>(result)), std::move(std::get<2>(result))};
+}
+
+clusterization_algorithm::measurements_output_type
+clusterization_algorithm::run_with_measurements(
+    const cell_collection_types::const_view& cells,
+    const cell_module_collection_types::const_view& modules) const {
+
+    // Number of cells
+    const cell_collection_types::view::size_type num_cells =
+        m_copy.get_size(cells);
+
+    if (num_cells == 0) {
+        return {measurement_collection_types::buffer{0, m_mr.main},
+                spacepoint_collection_types::buffer{0, m_mr.main},
+                vecmem::data::vector_buffer<unsigned int>{0, m_mr.main}};
+    }
+
+    // Setup alpaka
+    auto devAcc = ::alpaka::getDevByIdx(::alpaka::Platform<Acc>{}, 0u);
+    auto devHost = ::alpaka::getDevByIdx(::alpaka::Platform<Host>{}, 0u);
+    auto queue = Queue{devAcc};
+    auto const deviceProperties = ::alpaka::getAccDevProps<Acc>(devAcc);
+    const unsigned int maxThreads = deviceProperties.m_blockThreadExtentMax[0];
+
+    // Create result object for the CCL kernel with size overestimation
+    measurement_collection_types::buffer measurements_buffer(num_cells,
+                                                             m_mr.main);
+    m_copy.setup(measurements_buffer);
+
+    // Create buffer for linking cells to their spacepoints, if requested.
+    vecmem::data::vector_buffer<unsigned int> cell_links(
+        m_produce_cell_links ? num_cells : 0u, m_mr.main);
+    m_copy.setup(cell_links);
+
+    // Scratch space for the partitions that would not fit into shared memory,
+    // and for the cooperative aggregation of the clusters.
+    vecmem::data::vector_buffer<unsigned int> ccl_backup(
+        device::ccl_backup_size(num_cells), m_mr.main);
+    m_copy.setup(ccl_backup);
+
+    // Counter for the number of measurements
+    auto bufHost_num_measurements =
+        ::alpaka::allocBuf<unsigned int, Idx>(devHost, 1u);
+    unsigned int* const pBufHost_num_measurements =
+        ::alpaka::getPtrNative(bufHost_num_measurements);
+    auto bufAcc_num_measurements =
+        ::alpaka::allocBuf<unsigned int, Idx>(devAcc, 1u);
+    ::alpaka::memset(queue, bufAcc_num_measurements, 0);
+
+    // Every thread of a block handles (up to) MAX_CELLS_PER_THREAD cells, so
+    // the partitions have to be made smaller if the accelerator can not run
+    // large enough thread blocks. (Note that the work division is set up
+    // directly here, as the kernel relies on having real threads in its
+    // blocks.)
+    const unsigned int threads_per_partition =
+        std::min((m_target_cells_per_partition + TARGET_CELLS_PER_THREAD - 1) /
+                     TARGET_CELLS_PER_THREAD,
+                 maxThreads);
+    const unsigned int target_cells_per_partition =
+        std::min<unsigned int>(m_target_cells_per_partition,
+                               threads_per_partition * TARGET_CELLS_PER_THREAD);
+    const index_t max_cells_per_partition = static_cast<index_t>(
+        (target_cells_per_partition * MAX_CELLS_PER_THREAD +
+         TARGET_CELLS_PER_THREAD - 1) /
+        TARGET_CELLS_PER_THREAD);
+    const unsigned int num_partitions =
+        (num_cells + target_cells_per_partition - 1) /
+        target_cells_per_partition;
+
+    // Run the CCL kernel
+    auto workDiv = WorkDiv{num_partitions, threads_per_partition, 1u};
+    ::alpaka::exec<Acc>(queue, workDiv, CCLKernel{}, cells, modules,
+                        max_cells_per_partition,
+                        static_cast<index_t>(target_cells_per_partition),
+                        vecmem::get_data(measurements_buffer),
+                        ::alpaka::getPtrNative(bufAcc_num_measurements),
+                        vecmem::get_data(cell_links),
+                        vecmem::get_data(ccl_backup));
+
+    // Copy number of measurements to host
+    ::alpaka::memcpy(queue, bufHost_num_measurements, bufAcc_num_measurements);
+    ::alpaka::wait(queue);
+    const unsigned int num_measurements = *pBufHost_num_measurements;
+
+    spacepoint_collection_types::buffer spacepoints_buffer(num_measurements,
+                                                           m_mr.main);
+    m_copy.setup(spacepoints_buffer);
+
+    // Run form spacepoints kernel, turning 2D measurements into 3D spacepoints
+    if (num_measurements > 0) {
+        const Idx threadsPerBlock = warpSize * 2;
+        const Idx blocksPerGrid =
+            (num_measurements + threadsPerBlock - 1) / threadsPerBlock;
+        ::alpaka::exec<Acc>(queue,
+                            makeWorkDiv<Acc>(blocksPerGrid, threadsPerBlock),
+                            FormSpacepointsKernel{},
+                            vecmem::get_data(measurements_buffer), modules,
+                            num_measurements,
+                            vecmem::get_data(spacepoints_buffer));
+    }
+    ::alpaka::wait(queue);
+
+    return {std::move(measurements_buffer), std::move(spacepoints_buffer),
+            std::move(cell_links)};
+}
+
+}  // namespace traccc::alpaka
+
+// Define the required trait needed for Dynamic shared memory allocation.
+namespace alpaka::trait {
+
+template <typename TAcc>
+struct BlockSharedMemDynSizeBytes<traccc::alpaka::CCLKernel, TAcc> {
+    template <typename TVec>
+    ALPAKA_FN_HOST_ACC static auto getBlockSharedMemDynSizeBytes(
+        traccc::alpaka::CCLKernel const& /* kernel */,
+        TVec const& /* blockThreadExtent */,
+        TVec const& /* threadElemExtent */,
+        traccc::cell_collection_types::const_view /* cells_view */,
+        traccc::cell_module_collection_types::const_view /* modules_view */,
+        const unsigned short max_cells_per_partition,
+        const unsigned short /* target_cells_per_partition */,
+        traccc::measurement_collection_types::view /* measurements_view */,
+        unsigned int* /* measurement_count */,
+        vecmem::data::vector_view<unsigned int> /* cell_links */,
+        vecmem::data::vector_view<unsigned int> /* ccl_backup */
+        ) -> std::size_t {
+        return static_cast<std::size_t>(2 * max_cells_per_partition) *
+               sizeof(unsigned short);
+    }
+};
+
+}  // namespace alpaka::trait
@@ -0,0 +1,507 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Local include(s).
+#include "traccc/alpaka/finding/finding_algorithm.hpp"
+
+#include "../utils/utils.hpp"
+
+// Project include(s).
+#include "traccc/definitions/primitives.hpp"
+#include "traccc/edm/device/finding_global_counter.hpp"
+#include "traccc/finding/candidate_link.hpp"
+#include "traccc/finding/device/apply_interaction.hpp"
+#include "traccc/finding/device/build_tracks.hpp"
+#include "traccc/finding/device/count_measurements.hpp"
+#include "traccc/finding/device/find_tracks.hpp"
+#include "traccc/finding/device/propagate_to_next_surface.hpp"
+#include "traccc/utils/trace.hpp"
+
+// detray include(s).
+#include "detray/core/detector.hpp"
+#include "detray/core/detector_metadata.hpp"
+#include "detray/detectors/bfield.hpp"
+#include "detray/navigation/navigator.hpp"
+#include "detray/propagator/rk_stepper.hpp"
+
+// VecMem include(s).
+#include <vecmem/containers/data/jagged_vector_buffer.hpp>
+#include <vecmem/containers/data/vector_buffer.hpp>
+#include <vecmem/containers/vector.hpp>
+
+// System include(s).
+#include <algorithm>
+#include <map>
+#include <numeric>
+#include <vector>
+
+namespace traccc::alpaka {
+
+/// Kernel for running @c traccc::device::apply_interaction
+template <typename detector_t>
+struct ApplyInteractionKernel {
+    template <typename TAcc>
+    ALPAKA_FN_ACC void operator()(
+        TAcc const& acc, typename detector_t::view_type det_data,
+        vecmem::data::jagged_vector_view<detray::intersection2D<
+            typename detector_t::surface_type, typename detector_t::transform3>>
+            nav_candidates_buffer,
+        const int n_params,
+        bound_track_parameters_collection_types::view params_view) const {
+        auto const globalThreadIdx =
+            ::alpaka::getIdx<::alpaka::Grid, ::alpaka::Threads>(acc)[0u];
+        device::apply_interaction<detector_t>(globalThreadIdx, det_data,
+                                              nav_candidates_buffer, n_params,
+                                              params_view);
+    }
+};
+
+/// Kernel for running @c traccc::device::count_measurements
+struct CountMeasurementsKernel {
+    template <typename TAcc>
+    ALPAKA_FN_ACC void operator()(
+        TAcc const& acc,
+        bound_track_parameters_collection_types::const_view params_view,
+        measurement_range_collection_types::const_view ranges_view,
+        const unsigned int n_in_params,
+        vecmem::data::vector_view<unsigned int> n_measurements_view,
+        vecmem::data::vector_view<unsigned int> ref_meas_idx_view,
+        device::finding_global_counter* counter) const {
+        auto const globalThreadIdx =
+            ::alpaka::getIdx<::alpaka::Grid, ::alpaka::Threads>(acc)[0u];
+        device::count_measurements(
+            globalThreadIdx, params_view, ranges_view,
+            n_in_params, n_measurements_view, ref_meas_idx_view,
+            counter->n_measurements_sum);
+    }
+};
+
+/// Kernel for running @c traccc::device::find_tracks
+template <typename detector_t, typename config_t>
+struct FindTracksKernel {
+    template <typename TAcc>
+    ALPAKA_FN_ACC void operator()(
+        TAcc const& acc, const config_t cfg,
+        typename detector_t::view_type det_data,
+        measurement_collection_types::const_view measurements_view,
+        bound_track_parameters_collection_types::const_view in_params_view,
+        vecmem::data::vector_view<const unsigned int>
+            n_measurements_prefix_sum_view,
+        vecmem::data::vector_view<const unsigned int> ref_meas_idx_view,
+        const unsigned int step, const unsigned int n_max_candidates,
+        bound_track_parameters_collection_types::view out_params_view,
+        vecmem::data::vector_view<candidate_link> links_view,
+        device::finding_global_counter* counter) const {
+        auto const globalThreadIdx =
+            ::alpaka::getIdx<::alpaka::Grid, ::alpaka::Threads>(acc)[0u];
+        device::find_tracks<detector_t, config_t>(
+            globalThreadIdx, cfg, det_data, measurements_view, in_params_view,
+            n_measurements_prefix_sum_view, ref_meas_idx_view, step,
+            n_max_candidates, out_params_view, links_view,
+            counter->n_candidates);
+    }
+};
+
+/// Kernel for running @c traccc::device::propagate_to_next_surface
+template <typename propagator_t, typename bfield_t, typename config_t>
+struct PropagateToNextSurfaceKernel {
+    template <typename TAcc>
+    ALPAKA_FN_ACC void operator()(
+        TAcc const& acc, const config_t cfg,
+        typename propagator_t::detector_type::view_type det_data,
+        bfield_t field_data,
+        vecmem::data::jagged_vector_view<
+            typename propagator_t::intersection_type>
+            nav_candidates_buffer,
+        bound_track_parameters_collection_types::const_view in_params_view,
+        vecmem::data::vector_view<const candidate_link> links_view,
+        const unsigned int step, device::finding_global_counter* counter,
+        bound_track_parameters_collection_types::view out_params_view,
+        vecmem::data::vector_view<unsigned int> param_to_link_view,
+        vecmem::data::vector_view<typename candidate_link::link_index_type>
+            tips_view) const {
+        auto const globalThreadIdx =
+            ::alpaka::getIdx<::alpaka::Grid, ::alpaka::Threads>(acc)[0u];
+        device::propagate_to_next_surface<propagator_t, bfield_t, config_t>(
+            globalThreadIdx, cfg, det_data, field_data, nav_candidates_buffer,
+            in_params_view, links_view, step, counter->n_candidates,
+            out_params_view, param_to_link_view, tips_view,
+            counter->n_out_params);
+    }
+};
+
+/// Kernel for running @c traccc::device::build_tracks
+struct BuildTracksKernel {
+    template <typename TAcc>
+    ALPAKA_FN_ACC void operator()(
+        TAcc const& acc,
+        measurement_collection_types::const_view measurements_view,
+        bound_track_parameters_collection_types::const_view seeds_view,
+        vecmem::data::jagged_vector_view<const candidate_link> links_view,
+        vecmem::data::jagged_vector_view<const unsigned int>
+            param_to_link_view,
+        vecmem::data::vector_view<
+            const typename candidate_link::link_index_type>
+            tips_view,
+        track_candidate_container_types::view track_candidates_view) const {
+        auto const globalThreadIdx =
+            ::alpaka::getIdx<::alpaka::Grid, ::alpaka::Threads>(acc)[0u];
+        device::build_tracks(globalThreadIdx, measurements_view, seeds_view,
+                             links_view, param_to_link_view, tips_view,
+                             track_candidates_view);
+    }
+};
+
+template <typename stepper_t, typename navigator_t>
+finding_algorithm<stepper_t, navigator_t>::finding_algorithm(
+    const config_type& cfg, const traccc::memory_resource& mr,
+    vecmem::copy& copy)
+    : m_cfg(cfg), m_mr(mr), m_copy(copy) {}
+
+template <typename stepper_t, typename navigator_t>
+track_candidate_container_types::buffer
+finding_algorithm<stepper_t, navigator_t>::operator()(
+    const typename detector_type::view_type& det_view,
+    const bfield_type& field_view,
+    const vecmem::data::jagged_vector_view<
+        typename navigator_t::intersection_type>& navigation_buffer,
+    const typename measurement_collection_types::view& measurements,
+    const bound_track_parameters_collection_types::buffer& seeds_buffer)
+    const {
+
+    TRACCC_TRACE_RANGE("traccc::alpaka::finding_algorithm");
+
+    // Setup alpaka
+    auto devAcc = ::alpaka::getDevByIdx(::alpaka::Platform<Acc>{}, 0u);
+    auto devHost = ::alpaka::getDevByIdx(::alpaka::Platform<Host>{}, 0u);
+    auto queue = Queue{devAcc};
+    Idx threadsPerBlock = warpSize * 2;
+
+    // Memory resource for the host-side helper collections
+    vecmem::memory_resource& host_mr =
+        (m_mr.host != nullptr) ? *(m_mr.host) : m_mr.main;
+
+    // Copy setup
+    m_copy.setup(seeds_buffer);
+    m_copy.setup(navigation_buffer);
+
+    // Prepare input parameters with seeds
+    const unsigned int n_seeds = m_copy.get_size(seeds_buffer);
+    bound_track_parameters_collection_types::buffer in_params_buffer(
+        n_seeds, m_mr.main);
+    m_copy.setup(in_params_buffer);
+    m_copy(vecmem::get_data(seeds_buffer), vecmem::get_data(in_params_buffer));
+
+    // Create a map for links
+    std::map<unsigned int, vecmem::data::vector_buffer<candidate_link>>
+        link_map;
+
+    // Create a map for parameter ID to link ID
+    std::map<unsigned int, vecmem::data::vector_buffer<unsigned int>>
+        param_to_link_map;
+
+    // Create a map for tip links
+    std::map<unsigned int, vecmem::data::vector_buffer<
+                               typename candidate_link::link_index_type>>
+        tips_map;
+
+    // Link size
+    std::vector<std::size_t> n_candidates_per_step;
+    n_candidates_per_step.reserve(m_cfg.max_track_candidates_per_track);
+
+    std::vector<std::size_t> n_parameters_per_step;
+    n_parameters_per_step.reserve(m_cfg.max_track_candidates_per_track);
+
+    // Global counter object, in host and device memory
+    auto bufHost_counter =
+        ::alpaka::allocBuf<device::finding_global_counter, Idx>(devHost, 1u);
+    device::finding_global_counter* const pBufHost_counter(
+        ::alpaka::getPtrNative(bufHost_counter));
+    auto bufAcc_counter =
+        ::alpaka::allocBuf<device::finding_global_counter, Idx>(devAcc, 1u);
+    ::alpaka::memset(queue, bufAcc_counter, 0);
+
+    /*****************************************************************
+     * Measurement Operations
+     *****************************************************************/
+
+    // The measurement range table of the (sorted) measurements is built on
+    // the host.
+    vecmem::vector<measurement> measurements_host(&host_mr);
+    m_copy(measurements, measurements_host);
+    const measurement_range_collection_types::host ranges_host =
+        make_measurement_ranges(measurements_host, host_mr);
+
+    const unsigned int n_surfaces =
+        static_cast<unsigned int>(ranges_host.size());
+    measurement_range_collection_types::buffer ranges_buffer{n_surfaces,
+                                                             m_mr.main};
+    m_copy.setup(ranges_buffer);
+    m_copy(vecmem::get_data(ranges_host), ranges_buffer);
+
+    // The work division of the kernels, set up for every launch
+    Idx blocksPerGrid = 0;
+    auto workDiv = makeWorkDiv<Acc>(blocksPerGrid, threadsPerBlock);
+
+    for (unsigned int step = 0; step < m_cfg.max_track_candidates_per_track;
+         step++) {
+
+        // Global counter object: Device -> Host
+        ::alpaka::memcpy(queue, bufHost_counter, bufAcc_counter);
+        ::alpaka::wait(queue);
+
+        // Set the number of input parameters
+        const unsigned int n_in_params =
+            (step == 0) ? n_seeds : pBufHost_counter->n_out_params;
+
+        // Terminate if there is no parameter to process.
+        if (n_in_params == 0) {
+            break;
+        }
+
+        // Reset the global counter
+        ::alpaka::memset(queue, bufAcc_counter, 0);
+
+        /*****************************************************************
+         * Kernel2: Apply material interaction
+         ****************************************************************/
+
+        blocksPerGrid = (n_in_params + threadsPerBlock - 1) / threadsPerBlock;
+        workDiv = makeWorkDiv<Acc>(blocksPerGrid, threadsPerBlock);
+
+        ::alpaka::exec<Acc>(queue, workDiv,
+                            ApplyInteractionKernel<detector_type>{}, det_view,
+                            navigation_buffer, static_cast<int>(n_in_params),
+                            vecmem::get_data(in_params_buffer));
+
+        /*****************************************************************
+         * Kernel3: Count the number of measurements per parameter
+         ****************************************************************/
+
+        vecmem::data::vector_buffer<unsigned int> n_measurements_buffer(
+            n_in_params, m_mr.main);
+        m_copy.setup(n_measurements_buffer);
+        m_copy.memset(n_measurements_buffer, 0);
+
+        // Create a buffer for the first measurement index of parameter
+        vecmem::data::vector_buffer<unsigned int> ref_meas_idx_buffer(
+            n_in_params, m_mr.main);
+        m_copy.setup(ref_meas_idx_buffer);
+
+        ::alpaka::exec<Acc>(queue, workDiv, CountMeasurementsKernel{},
+                            vecmem::get_data(in_params_buffer),
+                            vecmem::get_data(ranges_buffer), n_in_params,
+                            vecmem::get_data(n_measurements_buffer),
+                            vecmem::get_data(ref_meas_idx_buffer),
+                            ::alpaka::getPtrNative(bufAcc_counter));
+
+        // Global counter object: Device -> Host
+        ::alpaka::memcpy(queue, bufHost_counter, bufAcc_counter);
+        ::alpaka::wait(queue);
+
+        // Create the buffer for the prefix sum of the number of measurements
+        // per parameter. The scan itself is done on the host.
+        vecmem::vector<unsigned int> n_measurements_host(&host_mr);
+        m_copy(n_measurements_buffer, n_measurements_host);
+        std::inclusive_scan(n_measurements_host.begin(),
+                            n_measurements_host.end(),
+                            n_measurements_host.begin());
+        vecmem::data::vector_buffer<unsigned int>
+            n_measurements_prefix_sum_buffer(n_in_params, m_mr.main);
+        m_copy.setup(n_measurements_prefix_sum_buffer);
+        m_copy(vecmem::get_data(n_measurements_host),
+               n_measurements_prefix_sum_buffer);
+
+        /*****************************************************************
+         * Kernel4: Find valid tracks
+         *****************************************************************/
+
+        // Buffer for kalman-updated parameters spawned by the measurement
+        // candidates
+        const unsigned int n_max_candidates =
+            std::min(n_in_params * m_cfg.max_num_branches_per_surface,
+                     n_seeds * m_cfg.max_num_branches_per_seed);
+
+        bound_track_parameters_collection_types::buffer updated_params_buffer(
+            n_in_params * m_cfg.max_num_branches_per_surface, m_mr.main);
+        m_copy.setup(updated_params_buffer);
+
+        // Create the link map
+        link_map[step] = {n_in_params * m_cfg.max_num_branches_per_surface,
+                          m_mr.main};
+        m_copy.setup(link_map[step]);
+
+        blocksPerGrid = (pBufHost_counter->n_measurements_sum +
+                         threadsPerBlock * m_cfg.n_measurements_per_thread -
+                         1) /
+                        (threadsPerBlock * m_cfg.n_measurements_per_thread);
+
+        if (blocksPerGrid > 0) {
+            workDiv = makeWorkDiv<Acc>(blocksPerGrid, threadsPerBlock);
+            ::alpaka::exec<Acc>(
+                queue, workDiv, FindTracksKernel<detector_type, config_type>{},
+                m_cfg, det_view, measurements,
+                vecmem::get_data(in_params_buffer),
+                vecmem::get_data(n_measurements_prefix_sum_buffer),
+                vecmem::get_data(ref_meas_idx_buffer), step, n_max_candidates,
+                vecmem::get_data(updated_params_buffer),
+                vecmem::get_data(link_map[step]),
+                ::alpaka::getPtrNative(bufAcc_counter));
+        }
+
+        // Global counter object: Device -> Host
+        ::alpaka::memcpy(queue, bufHost_counter, bufAcc_counter);
+        ::alpaka::wait(queue);
+
+        /*****************************************************************
+         * Kernel5: Propagate to the next surface
+         *****************************************************************/
+
+        const unsigned int n_candidates = pBufHost_counter->n_candidates;
+
+        // Buffer for out parameters for the next step
+        bound_track_parameters_collection_types::buffer out_params_buffer(
+            n_candidates, m_mr.main);
+        m_copy.setup(out_params_buffer);
+
+        // Create the param to link ID map
+        param_to_link_map[step] = {n_candidates, m_mr.main};
+        m_copy.setup(param_to_link_map[step]);
+
+        // Create the tip map
+        tips_map[step] = {n_candidates, m_mr.main,
+                          vecmem::data::buffer_type::resizable};
+        m_copy.setup(tips_map[step]);
+
+        if (n_candidates > 0) {
+            blocksPerGrid =
+                (n_candidates + threadsPerBlock - 1) / threadsPerBlock;
+            workDiv = makeWorkDiv<Acc>(blocksPerGrid, threadsPerBlock);
+            ::alpaka::exec<Acc>(
+                queue, workDiv,
+                PropagateToNextSurfaceKernel<propagator_type, bfield_type,
+                                             config_type>{},
+                m_cfg, det_view, field_view, navigation_buffer,
+                vecmem::get_data(updated_params_buffer),
+                vecmem::get_data(link_map[step]), step,
+                ::alpaka::getPtrNative(bufAcc_counter),
+                vecmem::get_data(out_params_buffer),
+                vecmem::get_data(param_to_link_map[step]),
+                vecmem::get_data(tips_map[step]));
+        }
+
+        // Global counter object: Device -> Host
+        ::alpaka::memcpy(queue, bufHost_counter, bufAcc_counter);
+        ::alpaka::wait(queue);
+
+        // Fill the candidate size vector
+        n_candidates_per_step.push_back(pBufHost_counter->n_candidates);
+        n_parameters_per_step.push_back(pBufHost_counter->n_out_params);
+
+        // Swap parameter buffer for the next step
+        in_params_buffer = std::move(out_params_buffer);
+    }
+
+    // Get the number of tips per step
+    const auto n_steps = n_candidates_per_step.size();
+    std::vector<unsigned int> n_tips_per_step;
+    n_tips_per_step.reserve(n_steps);
+    for (unsigned int it = 0; it < n_steps; it++) {
+        n_tips_per_step.push_back(m_copy.get_size(tips_map[it]));
+    }
+
+    // Create link buffer
+    vecmem::data::jagged_vector_buffer<candidate_link> links_buffer(
+        n_candidates_per_step, m_mr.main, m_mr.host);
+    m_copy.setup(links_buffer);
+
+    // Copy link map to link buffer
+    for (unsigned int it = 0; it < n_steps; it++) {
+        const vecmem::data::vector_view<const candidate_link> in{
+            static_cast<unsigned int>(n_candidates_per_step[it]),
+            link_map[it].ptr()};
+        m_copy(in, *(links_buffer.host_ptr() + it));
+    }
+
+    // Create param_to_link
+    vecmem::data::jagged_vector_buffer<unsigned int> param_to_link_buffer(
+        n_parameters_per_step, m_mr.main, m_mr.host);
+    m_copy.setup(param_to_link_buffer);
+
+    // Copy param_to_link map to param_to_link buffer
+    for (unsigned int it = 0; it < n_steps; it++) {
+        const vecmem::data::vector_view<const unsigned int> in{
+            static_cast<unsigned int>(n_parameters_per_step[it]),
+            param_to_link_map[it].ptr()};
+        m_copy(in, *(param_to_link_buffer.host_ptr() + it));
+    }
+
+    // Copy tips_map into the tips vector (D->D)
+    unsigned int n_tips_total =
+        std::accumulate(n_tips_per_step.begin(), n_tips_per_step.end(), 0);
+    vecmem::data::vector_buffer<typename candidate_link::link_index_type>
+        tips_buffer{n_tips_total, m_mr.main};
+    m_copy.setup(tips_buffer);
+
+    unsigned int prefix_sum = 0;
+    for (unsigned int it = m_cfg.min_track_candidates_per_track - 1;
+         it < n_steps; it++) {
+
+        const unsigned int n_tips = n_tips_per_step[it];
+        if (n_tips > 0) {
+            const vecmem::data::vector_view<
+                const typename candidate_link::link_index_type>
+                in{n_tips, tips_map[it].ptr()};
+            vecmem::data::vector_view<typename candidate_link::link_index_type>
+                out{n_tips, tips_buffer.ptr() + prefix_sum};
+            m_copy(in, out);
+            prefix_sum += n_tips;
+        }
+    }
+
+    /*****************************************************************
+     * Kernel6: Build tracks
+     *****************************************************************/
+
+    // Create track candidate buffer
+    track_candidate_container_types::buffer track_candidates_buffer{
+        {n_tips_total, m_mr.main},
+        {std::vector<std::size_t>(n_tips_total,
+                                  m_cfg.max_track_candidates_per_track),
+         m_mr.main, m_mr.host, vecmem::data::buffer_type::resizable}};
+
+    m_copy.setup(track_candidates_buffer.headers);
+    m_copy.setup(track_candidates_buffer.items);
+
+    // @Note: blocksPerGrid can be zero in case there is no tip. This happens
+    // when chi2_max config is set tightly and no tips are found
+    if (n_tips_total > 0) {
+        blocksPerGrid = (n_tips_total + threadsPerBlock - 1) / threadsPerBlock;
+        workDiv = makeWorkDiv<Acc>(blocksPerGrid, threadsPerBlock);
+        ::alpaka::exec<Acc>(queue, workDiv, BuildTracksKernel{}, measurements,
+                            vecmem::get_data(seeds_buffer),
+                            vecmem::get_data(links_buffer),
+                            vecmem::get_data(param_to_link_buffer),
+                            vecmem::get_data(tips_buffer),
+                            track_candidate_container_types::view{
+                                track_candidates_buffer});
+    }
+    ::alpaka::wait(queue);
+
+    return track_candidates_buffer;
+}
+
+// Explicit template instantiation
+using default_detector_type =
+    detray::detector<detray::default_metadata, detray::device_container_types>;
+using default_stepper_type =
+    detray::rk_stepper<covfie::field<detray::bfield::const_bknd_t>::view_t,
+                       transform3, detray::constrained_step<>>;
+using default_navigator_type = detray::navigator<const default_detector_type>;
+template class finding_algorithm<default_stepper_type, default_navigator_type>;
+
+}  // namespace traccc::alpaka
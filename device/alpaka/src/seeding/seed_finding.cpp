@@ -1,6 +1,6 @@
 /** TRACCC library, part of the ACTS project (R&D line)
  *
- * (c) 2023 CERN for the benefit of the ACTS project
+ * (c) 2023-2024 CERN for the benefit of the ACTS project
  *
  * Mozilla Public License Version 2.0
  */
@@ -11,9 +11,6 @@
 #include "../utils/utils.hpp"
 
 // Project include(s).
-#include "traccc/alpaka/utils/make_prefix_sum_buff.hpp"
-#include "traccc/device/fill_prefix_sum.hpp"
-#include "traccc/device/make_prefix_sum_buffer.hpp"
 #include "traccc/edm/device/device_doublet.hpp"
 #include "traccc/edm/device/device_triplet.hpp"
 #include "traccc/edm/device/doublet_counter.hpp"
@@ -25,7 +22,9 @@
 #include "traccc/seeding/device/find_triplets.hpp"
 #include "traccc/seeding/device/reduce_triplet_counts.hpp"
 #include "traccc/seeding/device/select_seeds.hpp"
+#include "traccc/seeding/device/set_seeding_buffer_sizes.hpp"
 #include "traccc/seeding/device/update_triplet_weights.hpp"
+#include "traccc/utils/trace.hpp"
 
 // System include(s).
 #include <algorithm>
@@ -38,24 +37,37 @@ struct CountDoubletsKernel {
     template <typename TAcc>
     ALPAKA_FN_ACC void operator()(
         TAcc const& acc, seedfinder_config config,
-        const sp_grid_const_view sp_grid,
-        const vecmem::data::vector_view<const device::prefix_sum_element_t>
-            sp_prefix_sum,
+        const sp_soa_grid_types::const_view sp_grid,
         device::doublet_counter_collection_types::view doublet_counter,
         device::seeding_global_counter* counter) const {
         auto const globalThreadIdx =
             ::alpaka::getIdx<::alpaka::Grid, ::alpaka::Threads>(acc)[0u];
-        device::count_doublets(globalThreadIdx, config, sp_grid, sp_prefix_sum,
+        device::count_doublets(globalThreadIdx, config, sp_grid,
                                doublet_counter, counter->m_nMidBot,
                                counter->m_nMidTop);
     }
 };
 
+// Kernel for running @c traccc::device::set_doublet_buffer_sizes
+struct SetDoubletBufferSizesKernel {
+    template <typename TAcc>
+    ALPAKA_FN_ACC void operator()(
+        TAcc const& acc, device::seeding_global_counter* counter,
+        device::device_doublet_collection_types::view mb_doublets,
+        device::device_doublet_collection_types::view mt_doublets) const {
+        auto const globalThreadIdx =
+            ::alpaka::getIdx<::alpaka::Grid, ::alpaka::Threads>(acc)[0u];
+        device::set_doublet_buffer_sizes(globalThreadIdx, *counter,
+                                         mb_doublets, mt_doublets);
+    }
+};
+
 // Kernel for running @c traccc::device::find_doublets
 struct FindDoubletsKernel {
     template <typename TAcc>
     ALPAKA_FN_ACC void operator()(
-        TAcc const& acc, seedfinder_config config, sp_grid_const_view sp_grid,
+        TAcc const& acc, seedfinder_config config,
+        sp_soa_grid_types::const_view sp_grid,
         device::doublet_counter_collection_types::const_view doublet_counter,
         device::device_doublet_collection_types::view mb_doublets,
         device::device_doublet_collection_types::view mt_doublets) const {
@@ -70,7 +82,8 @@ struct FindDoubletsKernel {
 struct CountTripletsKernel {
     template <typename TAcc>
     ALPAKA_FN_ACC void operator()(
-        TAcc const& acc, seedfinder_config config, sp_grid_const_view sp_grid,
+        TAcc const& acc, seedfinder_config config,
+        sp_soa_grid_types::const_view sp_grid,
         device::doublet_counter_collection_types::const_view doublet_counter,
         device::device_doublet_collection_types::const_view mb_doublets,
         device::device_doublet_collection_types::const_view mt_doublets,
@@ -99,12 +112,24 @@ struct ReduceTripletCounts {
     }
 };
 
+// Kernel for running @c traccc::device::set_triplet_buffer_size
+struct SetTripletBufferSizeKernel {
+    template <typename TAcc>
+    ALPAKA_FN_ACC void operator()(
+        TAcc const& acc, device::seeding_global_counter* counter,
+        device::device_triplet_collection_types::view triplets) const {
+        auto const globalThreadIdx =
+            ::alpaka::getIdx<::alpaka::Grid, ::alpaka::Threads>(acc)[0u];
+        device::set_triplet_buffer_size(globalThreadIdx, *counter, triplets);
+    }
+};
+
 // Kernel for running @c traccc::device::find_triplets
 struct FindTripletsKernel {
     template <typename TAcc>
     ALPAKA_FN_ACC void operator()(
         TAcc const& acc, seedfinder_config config,
-        seedfilter_config filter_config, sp_grid_const_view sp_grid,
+        seedfilter_config filter_config, sp_soa_grid_types::const_view sp_grid,
         device::doublet_counter_collection_types::const_view doublet_counter,
         device::device_doublet_collection_types::const_view mt_doublets,
         device::triplet_counter_spM_collection_types::const_view spM_tc,
@@ -124,7 +149,7 @@ struct UpdateTripletWeightsKernel {
     template <typename TAcc>
     ALPAKA_FN_ACC void operator()(
         TAcc const& acc, seedfilter_config filter_config,
-        sp_grid_const_view sp_grid,
+        sp_soa_grid_types::const_view sp_grid,
         device::triplet_counter_spM_collection_types::const_view spM_tc,
         device::triplet_counter_collection_types::const_view midBot_tc,
         device::device_triplet_collection_types::view triplet_view) const {
@@ -152,7 +177,7 @@ struct SelectSeedsKernel {
     ALPAKA_FN_ACC void operator()(
         TAcc const& acc, seedfilter_config filter_config,
         spacepoint_collection_types::const_view spacepoints_view,
-        sp_grid_const_view internal_sp_view,
+        sp_soa_grid_types::const_view internal_sp_view,
         device::triplet_counter_spM_collection_types::const_view spM_tc,
         device::triplet_counter_collection_types::const_view midBot_tc,
         device::device_triplet_collection_types::view triplet_view,
@@ -164,10 +189,11 @@ struct SelectSeedsKernel {
 
         // Array for temporary storage of quality parameters for comparing
         // triplets within weight updating kernel
-        triplet* const data = ::alpaka::getDynSharedMem<triplet>(acc);
+        device::device_triplet* const data =
+            ::alpaka::getDynSharedMem<device::device_triplet>(acc);
 
         // Each thread uses max_triplets_per_spM elements of the array
-        triplet* dataPos =
+        device::device_triplet* dataPos =
             &data[localThreadIdx * filter_config.max_triplets_per_spM];
 
         device::select_seeds(globalThreadIdx, filter_config, spacepoints_view,
@@ -179,15 +205,47 @@ struct SelectSeedsKernel {
 seed_finding::seed_finding(const seedfinder_config& config,
                            const seedfilter_config& filter_config,
                            const traccc::memory_resource& mr,
-                           vecmem::copy& copy)
+                           vecmem::copy& copy,
+                           const seed_finding_capacities& capacities)
     : m_seedfinder_config(config),
       m_seedfilter_config(filter_config),
+      m_capacities(capacities),
       m_mr(mr),
       m_copy(copy) {}
 
 seed_finding::output_type seed_finding::operator()(
     const spacepoint_collection_types::const_view& spacepoints_view,
-    const sp_grid_const_view& g2_view) const {
+    const sp_soa_grid_types::const_view& g2_view) const {
+
+    TRACCC_TRACE_RANGE("traccc::alpaka::seed_finding");
+
+    // Get the number of spacepoints in the grid. The threads of the doublet
+    // counting can find their spacepoints using the offsets of the bins, so
+    // no prefix sum is needed for iterating over the grid.
+    const auto num_spacepoints = m_copy.get_size(g2_view.x);
+    if (num_spacepoints == 0) {
+        return {0, m_mr.main};
+    }
+
+    // Try to find the seeds with bounded capacities first, if configured to.
+    if (m_capacities.enabled()) {
+        bool fits = false;
+        output_type result = find_seeds(spacepoints_view, g2_view,
+                                        num_spacepoints, true, fits);
+        if (fits) {
+            return result;
+        }
+    }
+
+    // Find the seeds with exactly sized buffers.
+    bool fits = false;
+    return find_seeds(spacepoints_view, g2_view, num_spacepoints, false, fits);
+}
+
+seed_finding::output_type seed_finding::find_seeds(
+    const spacepoint_collection_types::const_view& spacepoints_view,
+    const sp_soa_grid_types::const_view& g2_view, unsigned int num_spacepoints,
+    bool bounded, bool& fits) const {
 
     // Setup alpaka
     auto devAcc = ::alpaka::getDevByIdx(::alpaka::Platform<Acc>{}, 0u);
@@ -197,29 +255,23 @@ seed_finding::output_type seed_finding::operator()(
     auto maxThreads = deviceProperties.m_blockThreadExtentMax[0];
     auto threadsPerBlock = maxThreads;
 
-    // Get the sizes from the grid view
-    auto grid_sizes = m_copy.get_sizes(g2_view._data_view);
+    // Without bounded capacities, the buffers always fit.
+    fits = true;
 
-    // Create prefix sum buffer
-    vecmem::data::vector_buffer sp_grid_prefix_sum_buff =
-        make_prefix_sum_buff(grid_sizes, m_copy, m_mr, queue);
-
-    const auto num_spacepoints = m_copy.get_size(sp_grid_prefix_sum_buff);
-    if (num_spacepoints == 0) {
-        return {0, m_mr.main};
-    }
+    // The type of the (doublet and triplet) buffers to use.
+    const vecmem::data::buffer_type buffer_type =
+        (bounded ? vecmem::data::buffer_type::resizable
+                 : vecmem::data::buffer_type::fixed_size);
 
     // Set up the doublet counter buffer.
     device::doublet_counter_collection_types::buffer doublet_counter_buffer = {
-        m_copy.get_size(sp_grid_prefix_sum_buff), m_mr.main,
-        vecmem::data::buffer_type::resizable};
+        num_spacepoints, m_mr.main, vecmem::data::buffer_type::resizable};
     m_copy.setup(doublet_counter_buffer);
 
     // Calculate the number of threads and thread blocks to run the doublet
     // counting kernel for.
     auto blocksPerGrid =
-        (sp_grid_prefix_sum_buff.size() + threadsPerBlock - 1) /
-        threadsPerBlock;
+        (num_spacepoints + threadsPerBlock - 1) / threadsPerBlock;
     auto workDiv = makeWorkDiv<Acc>(blocksPerGrid, threadsPerBlock);
 
     // Counter for the total number of doublets and triplets
@@ -237,30 +289,53 @@ seed_finding::output_type seed_finding::operator()(
     // Count the number of doublets that we need to produce.
     ::alpaka::exec<Acc>(queue, workDiv, CountDoubletsKernel{},
                         m_seedfinder_config, g2_view,
-                        vecmem::get_data(sp_grid_prefix_sum_buff),
                         vecmem::get_data(doublet_counter_buffer),
                         ::alpaka::getPtrNative(bufAcc_counter));
-    ::alpaka::wait(queue);
 
-    // Get the summary values per bin.
-    ::alpaka::memcpy(queue, bufHost_counter, bufAcc_counter);
-
-    if (pBufHost_counter->m_nMidBot == 0 || pBufHost_counter->m_nMidTop == 0) {
-        return {0, m_mr.main};
+    // Decide about the doublet buffer capacities. In bounded mode these come
+    // from the configured factors, otherwise from the doublet counts.
+    unsigned int mb_capacity = 0, mt_capacity = 0;
+    if (bounded) {
+        mb_capacity = seed_finding_capacities::capacity(
+            m_capacities.mid_bot_doublets_per_spacepoint, num_spacepoints);
+        mt_capacity = seed_finding_capacities::capacity(
+            m_capacities.mid_top_doublets_per_spacepoint, num_spacepoints);
+    } else {
+        // Get the summary values.
+        ::alpaka::memcpy(queue, bufHost_counter, bufAcc_counter);
+        ::alpaka::wait(queue);
+
+        if (pBufHost_counter->m_nMidBot == 0 ||
+            pBufHost_counter->m_nMidTop == 0) {
+            return {0, m_mr.main};
+        }
+        mb_capacity = pBufHost_counter->m_nMidBot;
+        mt_capacity = pBufHost_counter->m_nMidTop;
     }
 
     // Set up the doublet counter buffers.
     device::device_doublet_collection_types::buffer doublet_buffer_mb = {
-        pBufHost_counter->m_nMidBot, m_mr.main};
+        mb_capacity, m_mr.main, buffer_type};
     m_copy.setup(doublet_buffer_mb);
     device::device_doublet_collection_types::buffer doublet_buffer_mt = {
-        pBufHost_counter->m_nMidTop, m_mr.main};
+        mt_capacity, m_mr.main, buffer_type};
     m_copy.setup(doublet_buffer_mt);
 
+    // In bounded mode, set the sizes of the doublet buffers on the device.
+    if (bounded) {
+        ::alpaka::exec<Acc>(queue, makeWorkDiv<Acc>(1u, 1u),
+                            SetDoubletBufferSizesKernel{},
+                            ::alpaka::getPtrNative(bufAcc_counter),
+                            vecmem::get_data(doublet_buffer_mb),
+                            vecmem::get_data(doublet_buffer_mt));
+    }
+
     // Calculate the number of threads and thread blocks to run the doublet
-    // finding kernel for.
+    // finding kernel for. (In bounded mode the kernels are launched for the
+    // maximal number of middle spacepoints, to avoid reading back the size of
+    // the doublet counter buffer.)
     const unsigned int doublet_counter_buffer_size =
-        m_copy.get_size(doublet_counter_buffer);
+        (bounded ? num_spacepoints : m_copy.get_size(doublet_counter_buffer));
     blocksPerGrid =
         (doublet_counter_buffer_size + threadsPerBlock - 1) / threadsPerBlock;
     workDiv = makeWorkDiv<Acc>(blocksPerGrid, threadsPerBlock);
@@ -271,7 +346,6 @@ seed_finding::output_type seed_finding::operator()(
                         vecmem::get_data(doublet_counter_buffer),
                         vecmem::get_data(doublet_buffer_mb),
                         vecmem::get_data(doublet_buffer_mt));
-    ::alpaka::wait(queue);
 
     // Set up the triplet counter buffers
     device::triplet_counter_spM_collection_types::buffer
@@ -279,14 +353,13 @@ seed_finding::output_type seed_finding::operator()(
     m_copy.setup(triplet_counter_spM_buffer);
     m_copy.memset(triplet_counter_spM_buffer, 0);
     device::triplet_counter_collection_types::buffer
-        triplet_counter_midBot_buffer = {pBufHost_counter->m_nMidBot, m_mr.main,
+        triplet_counter_midBot_buffer = {mb_capacity, m_mr.main,
                                          vecmem::data::buffer_type::resizable};
     m_copy.setup(triplet_counter_midBot_buffer);
 
     // Calculate the number of threads and thread blocks to run the triplet
     // counting kernel for.
-    blocksPerGrid =
-        (pBufHost_counter->m_nMidBot + threadsPerBlock - 1) / threadsPerBlock;
+    blocksPerGrid = (mb_capacity + threadsPerBlock - 1) / threadsPerBlock;
     workDiv = makeWorkDiv<Acc>(blocksPerGrid, threadsPerBlock);
 
     // Count the number of triplets that we need to produce.
@@ -297,7 +370,6 @@ seed_finding::output_type seed_finding::operator()(
                         vecmem::get_data(doublet_buffer_mt),
                         vecmem::get_data(triplet_counter_spM_buffer),
                         vecmem::get_data(triplet_counter_midBot_buffer));
-    ::alpaka::wait(queue);
 
     // Calculate the number of threads and thread blocks to run the triplet
     // count reduction kernel for.
@@ -310,24 +382,38 @@ seed_finding::output_type seed_finding::operator()(
                         vecmem::get_data(doublet_counter_buffer),
                         vecmem::get_data(triplet_counter_spM_buffer),
                         ::alpaka::getPtrNative(bufAcc_counter));
-    ::alpaka::wait(queue);
 
-    ::alpaka::memcpy(queue, bufHost_counter, bufAcc_counter);
-
-    if (pBufHost_counter->m_nTriplets == 0) {
-        return {0, m_mr.main};
+    // Decide about the triplet buffer capacity.
+    unsigned int triplet_capacity = 0;
+    if (bounded) {
+        triplet_capacity = seed_finding_capacities::capacity(
+            m_capacities.triplets_per_spacepoint, num_spacepoints);
+    } else {
+        ::alpaka::memcpy(queue, bufHost_counter, bufAcc_counter);
+        ::alpaka::wait(queue);
+
+        if (pBufHost_counter->m_nTriplets == 0) {
+            return {0, m_mr.main};
+        }
+        triplet_capacity = pBufHost_counter->m_nTriplets;
     }
 
     // Set up the triplet buffer.
     device::device_triplet_collection_types::buffer triplet_buffer = {
-        pBufHost_counter->m_nTriplets, m_mr.main};
+        triplet_capacity, m_mr.main, buffer_type};
     m_copy.setup(triplet_buffer);
 
+    // In bounded mode, set the size of the triplet buffer on the device.
+    if (bounded) {
+        ::alpaka::exec<Acc>(queue, makeWorkDiv<Acc>(1u, 1u),
+                            SetTripletBufferSizeKernel{},
+                            ::alpaka::getPtrNative(bufAcc_counter),
+                            vecmem::get_data(triplet_buffer));
+    }
+
     // Calculate the number of threads and thread blocks to run the triplet
     // finding kernel for.
-    blocksPerGrid =
-        (m_copy.get_size(triplet_counter_midBot_buffer) + threadsPerBlock - 1) /
-        threadsPerBlock;
+    blocksPerGrid = (mb_capacity + threadsPerBlock - 1) / threadsPerBlock;
     workDiv = makeWorkDiv<Acc>(blocksPerGrid, threadsPerBlock);
 
     // Find all of the spacepoint triplets.
@@ -338,13 +424,11 @@ seed_finding::output_type seed_finding::operator()(
                         vecmem::get_data(triplet_counter_spM_buffer),
                         vecmem::get_data(triplet_counter_midBot_buffer),
                         vecmem::get_data(triplet_buffer));
-    ::alpaka::wait(queue);
 
     // Calculate the number of threads and thread blocks to run the weight
     // updating kernel for.
     threadsPerBlock = warpSize * 2 < maxThreads ? warpSize * 2 : maxThreads;
-    blocksPerGrid =
-        (pBufHost_counter->m_nTriplets + threadsPerBlock - 1) / threadsPerBlock;
+    blocksPerGrid = (triplet_capacity + threadsPerBlock - 1) / threadsPerBlock;
     workDiv = makeWorkDiv<Acc>(blocksPerGrid, threadsPerBlock);
 
     // Update the weights of all spacepoint triplets.
@@ -353,12 +437,10 @@ seed_finding::output_type seed_finding::operator()(
                         vecmem::get_data(triplet_counter_spM_buffer),
                         vecmem::get_data(triplet_counter_midBot_buffer),
                         vecmem::get_data(triplet_buffer));
-    ::alpaka::wait(queue);
 
     // Create result object: collection of seeds
     seed_collection_types::buffer seed_buffer(
-        pBufHost_counter->m_nTriplets, m_mr.main,
-        vecmem::data::buffer_type::resizable);
+        triplet_capacity, m_mr.main, vecmem::data::buffer_type::resizable);
     m_copy.setup(seed_buffer);
 
     // Calculate the number of threads and thread blocks to run the seed
@@ -373,7 +455,18 @@ seed_finding::output_type seed_finding::operator()(
         spacepoints_view, g2_view, vecmem::get_data(triplet_counter_spM_buffer),
         vecmem::get_data(triplet_counter_midBot_buffer),
         vecmem::get_data(triplet_buffer), vecmem::get_data(seed_buffer));
+
+    // In bounded mode, check (with the only synchronisation of this mode)
+    // whether everything fit into the buffers.
+    if (bounded) {
+        ::alpaka::memcpy(queue, bufHost_counter, bufAcc_counter);
+    }
     ::alpaka::wait(queue);
+    if (bounded) {
+        fits = (pBufHost_counter->m_nMidBot <= mb_capacity) &&
+               (pBufHost_counter->m_nMidTop <= mt_capacity) &&
+               (pBufHost_counter->m_nTriplets <= triplet_capacity);
+    }
 
     return seed_buffer;
 }
@@ -391,7 +484,7 @@ struct BlockSharedMemDynSizeBytes<traccc::alpaka::UpdateTripletWeightsKernel,
         traccc::alpaka::UpdateTripletWeightsKernel const& /* kernel */,
         TVec const& blockThreadExtent, TVec const& /* threadElemExtent */,
         traccc::seedfilter_config filter_config,
-        traccc::sp_grid_const_view /* sp_grid */,
+        traccc::sp_soa_grid_types::const_view /* sp_grid */,
         traccc::device::triplet_counter_spM_collection_types::
             const_view /* spM_tc */,
         traccc::device::triplet_counter_collection_types::
@@ -412,7 +505,7 @@ struct BlockSharedMemDynSizeBytes<traccc::alpaka::SelectSeedsKernel, TAcc> {
         TVec const& blockThreadExtent, TVec const& /* threadElemExtent */,
         traccc::seedfilter_config filter_config,
         traccc::spacepoint_collection_types::const_view /* spacepoints_view */,
-        traccc::sp_grid_const_view /* sp_grid */,
+        traccc::sp_soa_grid_types::const_view /* sp_grid */,
         traccc::device::triplet_counter_spM_collection_types::
             const_view /* spM_tc */,
         traccc::device::triplet_counter_collection_types::
@@ -423,7 +516,7 @@ struct BlockSharedMemDynSizeBytes<traccc::alpaka::SelectSeedsKernel, TAcc> {
         ) -> std::size_t {
         return static_cast<std::size_t>(filter_config.max_triplets_per_spM *
                                         blockThreadExtent.prod()) *
-               sizeof(traccc::triplet);
+               sizeof(traccc::device::device_triplet);
     }
 };
 
@@ -1,6 +1,6 @@
 /** TRACCC library, part of the ACTS project (R&D line)
  *
- * (c) 2023 CERN for the benefit of the ACTS project
+ * (c) 2023-2024 CERN for the benefit of the ACTS project
  *
  * Mozilla Public License Version 2.0
  */
@@ -12,6 +12,7 @@
 
 // Project include(s).
 #include "traccc/seeding/detail/seeding_config.hpp"
+#include "traccc/utils/trace.hpp"
 
 // System include(s).
 #include <cmath>
@@ -22,15 +23,19 @@ seeding_algorithm::seeding_algorithm(const seedfinder_config& finder_config,
                                      const spacepoint_grid_config& grid_config,
                                      const seedfilter_config& filter_config,
                                      const traccc::memory_resource& mr,
-                                     vecmem::copy& copy)
+                                     vecmem::copy& copy,
+                                     const seed_finding_capacities& capacities)
     : m_spacepoint_binning(finder_config, grid_config, mr, copy),
-      m_seed_finding(finder_config, filter_config, mr, copy) {}
+      m_seed_finding(finder_config, filter_config, mr, copy, capacities) {}
 
 seeding_algorithm::output_type seeding_algorithm::operator()(
     const spacepoint_collection_types::const_view& spacepoints_view) const {
 
-    return m_seed_finding(spacepoints_view,
-                          m_spacepoint_binning(spacepoints_view));
+    TRACCC_TRACE_RANGE("traccc::alpaka::seeding_algorithm");
+
+    sp_soa_grid_types::buffer grid_buffer =
+        m_spacepoint_binning(spacepoints_view);
+    return m_seed_finding(spacepoints_view, get_data(grid_buffer));
 }
 
 }  // namespace traccc::alpaka
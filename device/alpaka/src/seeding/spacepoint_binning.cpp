@@ -1,6 +1,6 @@
 /** TRACCC library, part of the ACTS project (R&D line)
  *
- * (c) 2023 CERN for the benefit of the ACTS project
+ * (c) 2023-2024 CERN for the benefit of the ACTS project
  *
  * Mozilla Public License Version 2.0
  */
@@ -14,6 +14,11 @@
 #include "traccc/edm/spacepoint.hpp"
 #include "traccc/seeding/device/count_grid_capacities.hpp"
 #include "traccc/seeding/device/populate_grid.hpp"
+#include "traccc/seeding/device/sort_grid_bins.hpp"
+#include "traccc/utils/trace.hpp"
+
+// System include(s).
+#include <numeric>
 
 namespace traccc::alpaka {
 
@@ -30,8 +35,8 @@ struct CountGridCapacityKernel {
     template <typename TAcc>
     ALPAKA_FN_ACC void operator()(
         TAcc const& acc, const seedfinder_config& config,
-        const sp_grid::axis_p0_type phi_axis,
-        const sp_grid::axis_p1_type z_axis,
+        const sp_soa_grid_axis_p0_type phi_axis,
+        const sp_soa_grid_axis_p1_type z_axis,
         const spacepoint_collection_types::const_view spacepoints_view,
         vecmem::data::vector_view<unsigned int> grid_capacities_view) const {
         auto const globalThreadIdx =
@@ -48,18 +53,33 @@ struct PopulateGridKernel {
     ALPAKA_FN_ACC void operator()(
         TAcc const& acc, seedfinder_config config,
         spacepoint_collection_types::const_view spacepoints_view,
-        sp_grid_view grid_view) const {
+        sp_soa_grid_types::view grid_view,
+        vecmem::data::vector_view<unsigned int> bin_cursors_view) const {
         auto const globalThreadIdx =
             ::alpaka::getIdx<::alpaka::Grid, ::alpaka::Threads>(acc)[0u];
 
         device::populate_grid(globalThreadIdx, config, spacepoints_view,
-                              grid_view);
+                              grid_view, bin_cursors_view);
+    }
+};
+
+// Sort Grid Bins Kernel
+struct SortGridBinsKernel {
+    template <typename TAcc>
+    ALPAKA_FN_ACC void operator()(TAcc const& acc,
+                                  sp_soa_grid_types::view grid_view) const {
+        auto const globalThreadIdx =
+            ::alpaka::getIdx<::alpaka::Grid, ::alpaka::Threads>(acc)[0u];
+
+        device::sort_grid_bins(globalThreadIdx, grid_view);
     }
 };
 
 spacepoint_binning::output_type spacepoint_binning::operator()(
     const spacepoint_collection_types::const_view& spacepoints_view) const {
 
+    TRACCC_TRACE_RANGE("traccc::alpaka::spacepoint_binning");
+
     // Setup alpaka
     auto const platformAcc = ::alpaka::Platform<Acc>{};
     auto devAcc = ::alpaka::getDevByIdx(platformAcc, 0u);
@@ -69,7 +89,9 @@ spacepoint_binning::output_type spacepoint_binning::operator()(
     auto sp_size = m_copy.get_size(spacepoints_view);
 
     if (sp_size == 0) {
-        return {m_axes.first, m_axes.second, {}, m_mr.main, m_mr.host};
+        output_type grid_buffer(m_axes.first, m_axes.second, 0, m_mr.main);
+        m_copy.memset(grid_buffer.bin_offsets, 0);
+        return grid_buffer;
     }
 
     // Set up the container that will be filled with the required capacities for
@@ -95,22 +117,32 @@ spacepoint_binning::output_type spacepoint_binning::operator()(
                         grid_capacities_view);
     ::alpaka::wait(queue);
 
-    // Copy grid capacities back to the host
-    vecmem::vector<unsigned int> grid_capacities_host(m_mr.host ? m_mr.host
-                                                                : &(m_mr.main));
-    m_copy(grid_capacities_buff, grid_capacities_host);
+    // Copy grid capacities back to the host, and turn them into the offsets of
+    // the bins.
+    vecmem::vector<unsigned int> bin_offsets_host(m_mr.host ? m_mr.host
+                                                            : &(m_mr.main));
+    m_copy(grid_capacities_buff, bin_offsets_host);
+    bin_offsets_host.insert(bin_offsets_host.begin(), 0u);
+    std::partial_sum(bin_offsets_host.begin(), bin_offsets_host.end(),
+                     bin_offsets_host.begin());
 
     // Create the grid buffer.
-    sp_grid_buffer grid_buffer(
-        m_axes.first, m_axes.second,
-        std::vector<std::size_t>(grid_capacities_host.begin(),
-                                 grid_capacities_host.end()),
-        m_mr.main, m_mr.host, vecmem::data::buffer_type::resizable);
-    m_copy.setup(grid_buffer._buffer);
-    sp_grid_view grid_view = grid_buffer;
+    output_type grid_buffer(m_axes.first, m_axes.second,
+                            bin_offsets_host.back(), m_mr.main);
+    m_copy(vecmem::get_data(bin_offsets_host), grid_buffer.bin_offsets);
+    sp_soa_grid_types::view grid_view = get_data(grid_buffer);
 
+    // Populate the grid, re-using the capacity buffer as the bin cursors.
+    m_copy.memset(grid_capacities_buff, 0);
     ::alpaka::exec<Acc>(queue, workDiv, PopulateGridKernel{}, m_config,
-                        spacepoints_view, grid_view);
+                        spacepoints_view, grid_view, grid_capacities_view);
+    ::alpaka::wait(queue);
+
+    // Sort the spacepoints of every bin by radius.
+    auto const binBlocksPerGrid =
+        (grid_bins + threadsPerBlock - 1) / threadsPerBlock;
+    auto binWorkDiv = makeWorkDiv<Acc>(binBlocksPerGrid, threadsPerBlock);
+    ::alpaka::exec<Acc>(queue, binWorkDiv, SortGridBinsKernel{}, grid_view);
     ::alpaka::wait(queue);
 
     // Return the freshly filled buffer.
@@ -11,6 +11,7 @@
 // Project include(s).
 #include "traccc/alpaka/seeding/track_params_estimation.hpp"
 #include "traccc/seeding/device/estimate_track_params.hpp"
+#include "traccc/utils/trace.hpp"
 
 namespace traccc::alpaka {
 
@@ -40,6 +41,8 @@ track_params_estimation::output_type track_params_estimation::operator()(
     const vector3& bfield,
     const std::array<traccc::scalar, traccc::e_bound_size>& stddev) const {
 
+    TRACCC_TRACE_RANGE("traccc::alpaka::track_params_estimation");
+
     // Get the size of the seeds view
     auto seeds_size = m_copy.get_size(seeds_view);
 
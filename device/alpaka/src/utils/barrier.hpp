@@ -0,0 +1,38 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Local include(s).
+#include "utils.hpp"
+
+namespace traccc::alpaka::details {
+
+/// Barrier synchronising the threads of an Alpaka thread block
+///
+/// Allows running the block-level algorithms of @c traccc::device in Alpaka
+/// kernels.
+///
+template <typename TAcc>
+struct barrier {
+    ALPAKA_FN_ACC
+    barrier(TAcc const& acc) : m_acc(acc) {}
+
+    ALPAKA_FN_ACC
+    void blockBarrier() { ::alpaka::syncBlockThreads(m_acc); }
+
+    ALPAKA_FN_ACC
+    bool blockOr(bool predicate) {
+        return ::alpaka::syncBlockThreadsPredicate<::alpaka::BlockOr>(
+                   m_acc, predicate) != 0;
+    }
+
+    private:
+    TAcc const& m_acc;
+};
+
+}  // namespace traccc::alpaka::details
@@ -0,0 +1,65 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s).
+#include "traccc/definitions/qualifiers.hpp"
+
+// VecMem include(s).
+#include <vecmem/containers/data/vector_view.hpp>
+
+// System include(s).
+#include <cstddef>
+
+namespace traccc::device {
+
+/// Function counting the selected tracks of the measurement of one pair
+///
+/// The pairs must be sorted by measurement, and by track within every
+/// measurement. So that a track holding a measurement multiple times is only
+/// counted once.
+///
+/// @param[in] globalIndex             The index of the current thread (pair)
+/// @param[in] pair_measurements_view  The (dense) measurement index of every
+///                                    pair
+/// @param[in] pair_tracks_view        The track index of every pair
+/// @param[in] selected_view           The selection flag of every track
+/// @param[out] n_tracks_view          The number of selected tracks of every
+///                                    measurement
+///
+TRACCC_DEVICE inline void count_tracks_per_measurement(
+    std::size_t globalIndex,
+    vecmem::data::vector_view<const unsigned int> pair_measurements_view,
+    vecmem::data::vector_view<const unsigned int> pair_tracks_view,
+    vecmem::data::vector_view<const unsigned int> selected_view,
+    vecmem::data::vector_view<unsigned int> n_tracks_view);
+
+/// Function counting the shared measurement of one pair for its track
+///
+/// @param[in] globalIndex             The index of the current thread (pair)
+/// @param[in] pair_measurements_view  The (dense) measurement index of every
+///                                    pair
+/// @param[in] pair_tracks_view        The track index of every pair
+/// @param[in] selected_view           The selection flag of every track
+/// @param[in] n_tracks_view           The number of selected tracks of every
+///                                    measurement
+/// @param[out] n_shared_view          The number of shared measurements of
+///                                    every track
+///
+TRACCC_DEVICE inline void count_shared_measurements(
+    std::size_t globalIndex,
+    vecmem::data::vector_view<const unsigned int> pair_measurements_view,
+    vecmem::data::vector_view<const unsigned int> pair_tracks_view,
+    vecmem::data::vector_view<const unsigned int> selected_view,
+    vecmem::data::vector_view<const unsigned int> n_tracks_view,
+    vecmem::data::vector_view<unsigned int> n_shared_view);
+
+}  // namespace traccc::device
+
+// Include the implementation.
+#include "traccc/ambiguity_resolution/device/impl/count_shared_measurements.ipp"
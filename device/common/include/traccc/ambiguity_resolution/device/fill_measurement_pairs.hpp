@@ -0,0 +1,49 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s).
+#include "traccc/definitions/qualifiers.hpp"
+#include "traccc/edm/track_state.hpp"
+
+// VecMem include(s).
+#include <vecmem/containers/data/vector_view.hpp>
+
+// System include(s).
+#include <cstddef>
+
+namespace traccc::device {
+
+/// Function writing the (measurement, track) pairs of one track, and
+/// setting up its selection flag
+///
+/// Tracks with fewer than @c n_measurements_min measurements are not
+/// selected from the start.
+///
+/// @param[in] globalIndex         The index of the current thread (track)
+/// @param[in] track_states_view   The fitted tracks
+/// @param[in] track_offsets_view  The index of the first pair of every track
+/// @param[in] n_measurements_min  The minimum number of measurements of a
+///                                selected track
+/// @param[out] pair_ids_view      The measurement identifier of every pair
+/// @param[out] pair_tracks_view   The track index of every pair
+/// @param[out] selected_view      The selection flag of every track
+///
+TRACCC_DEVICE inline void fill_measurement_pairs(
+    std::size_t globalIndex,
+    track_state_container_types::const_view track_states_view,
+    vecmem::data::vector_view<const unsigned int> track_offsets_view,
+    unsigned int n_measurements_min,
+    vecmem::data::vector_view<std::size_t> pair_ids_view,
+    vecmem::data::vector_view<unsigned int> pair_tracks_view,
+    vecmem::data::vector_view<unsigned int> selected_view);
+
+}  // namespace traccc::device
+
+// Include the implementation.
+#include "traccc/ambiguity_resolution/device/impl/fill_measurement_pairs.ipp"
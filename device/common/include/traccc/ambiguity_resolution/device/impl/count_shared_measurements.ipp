@@ -0,0 +1,77 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// VecMem include(s).
+#include <vecmem/containers/device_vector.hpp>
+#include <vecmem/memory/device_atomic_ref.hpp>
+
+namespace traccc::device {
+
+TRACCC_DEVICE inline void count_tracks_per_measurement(
+    std::size_t globalIndex,
+    vecmem::data::vector_view<const unsigned int> pair_measurements_view,
+    vecmem::data::vector_view<const unsigned int> pair_tracks_view,
+    vecmem::data::vector_view<const unsigned int> selected_view,
+    vecmem::data::vector_view<unsigned int> n_tracks_view) {
+
+    vecmem::device_vector<const unsigned int> pair_measurements(
+        pair_measurements_view);
+    vecmem::device_vector<const unsigned int> pair_tracks(pair_tracks_view);
+    vecmem::device_vector<const unsigned int> selected(selected_view);
+    vecmem::device_vector<unsigned int> n_tracks(n_tracks_view);
+
+    if (globalIndex >= pair_tracks.size()) {
+        return;
+    }
+
+    const unsigned int meas = pair_measurements.at(globalIndex);
+    const unsigned int track = pair_tracks.at(globalIndex);
+    if (selected.at(track) == 0u) {
+        return;
+    }
+    // Skip the repeated occurrences of the measurement on the same track
+    if ((globalIndex > 0) && (pair_measurements.at(globalIndex - 1) == meas) &&
+        (pair_tracks.at(globalIndex - 1) == track)) {
+        return;
+    }
+
+    vecmem::device_atomic_ref<unsigned int> n(n_tracks.at(meas));
+    n.fetch_add(1u);
+}
+
+TRACCC_DEVICE inline void count_shared_measurements(
+    std::size_t globalIndex,
+    vecmem::data::vector_view<const unsigned int> pair_measurements_view,
+    vecmem::data::vector_view<const unsigned int> pair_tracks_view,
+    vecmem::data::vector_view<const unsigned int> selected_view,
+    vecmem::data::vector_view<const unsigned int> n_tracks_view,
+    vecmem::data::vector_view<unsigned int> n_shared_view) {
+
+    vecmem::device_vector<const unsigned int> pair_measurements(
+        pair_measurements_view);
+    vecmem::device_vector<const unsigned int> pair_tracks(pair_tracks_view);
+    vecmem::device_vector<const unsigned int> selected(selected_view);
+    vecmem::device_vector<const unsigned int> n_tracks(n_tracks_view);
+    vecmem::device_vector<unsigned int> n_shared(n_shared_view);
+
+    if (globalIndex >= pair_tracks.size()) {
+        return;
+    }
+
+    const unsigned int track = pair_tracks.at(globalIndex);
+    if ((selected.at(track) == 0u) ||
+        (n_tracks.at(pair_measurements.at(globalIndex)) < 2u)) {
+        return;
+    }
+
+    vecmem::device_atomic_ref<unsigned int> n(n_shared.at(track));
+    n.fetch_add(1u);
+}
+
+}  // namespace traccc::device
@@ -0,0 +1,46 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// VecMem include(s).
+#include <vecmem/containers/device_vector.hpp>
+
+namespace traccc::device {
+
+TRACCC_DEVICE inline void fill_measurement_pairs(
+    std::size_t globalIndex,
+    track_state_container_types::const_view track_states_view,
+    vecmem::data::vector_view<const unsigned int> track_offsets_view,
+    unsigned int n_measurements_min,
+    vecmem::data::vector_view<std::size_t> pair_ids_view,
+    vecmem::data::vector_view<unsigned int> pair_tracks_view,
+    vecmem::data::vector_view<unsigned int> selected_view) {
+
+    track_state_container_types::const_device track_states(track_states_view);
+    vecmem::device_vector<const unsigned int> track_offsets(
+        track_offsets_view);
+    vecmem::device_vector<std::size_t> pair_ids(pair_ids_view);
+    vecmem::device_vector<unsigned int> pair_tracks(pair_tracks_view);
+    vecmem::device_vector<unsigned int> selected(selected_view);
+
+    if (globalIndex >= track_states.size()) {
+        return;
+    }
+
+    const auto states = track_states.get_items().at(globalIndex);
+    selected.at(globalIndex) =
+        (states.size() >= n_measurements_min) ? 1u : 0u;
+
+    const unsigned int offset = track_offsets.at(globalIndex);
+    for (unsigned int i = 0; i < states.size(); ++i) {
+        pair_ids.at(offset + i) = states.at(i).get_measurement().measurement_id;
+        pair_tracks.at(offset + i) = static_cast<unsigned int>(globalIndex);
+    }
+}
+
+}  // namespace traccc::device
@@ -0,0 +1,112 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// VecMem include(s).
+#include <vecmem/containers/device_vector.hpp>
+#include <vecmem/memory/device_atomic_ref.hpp>
+
+namespace traccc::device {
+
+TRACCC_DEVICE inline void find_worse_neighbours(
+    std::size_t globalIndex,
+    track_state_container_types::const_view track_states_view,
+    vecmem::data::vector_view<const unsigned int> track_offsets_view,
+    vecmem::data::vector_view<const unsigned int> pair_measurements_view,
+    vecmem::data::vector_view<const unsigned int> pair_tracks_view,
+    vecmem::data::vector_view<const unsigned int> measurement_offsets_view,
+    vecmem::data::vector_view<const unsigned int> selected_view,
+    vecmem::data::vector_view<const unsigned int> n_shared_view,
+    unsigned int maximum_shared_hits,
+    vecmem::data::vector_view<unsigned int> has_worse_view) {
+
+    track_state_container_types::const_device track_states(track_states_view);
+    vecmem::device_vector<const unsigned int> track_offsets(
+        track_offsets_view);
+    vecmem::device_vector<const unsigned int> pair_measurements(
+        pair_measurements_view);
+    vecmem::device_vector<const unsigned int> pair_tracks(pair_tracks_view);
+    vecmem::device_vector<const unsigned int> measurement_offsets(
+        measurement_offsets_view);
+    vecmem::device_vector<const unsigned int> selected(selected_view);
+    vecmem::device_vector<const unsigned int> n_shared(n_shared_view);
+    vecmem::device_vector<unsigned int> has_worse(has_worse_view);
+
+    if (globalIndex >= pair_tracks.size()) {
+        return;
+    }
+
+    // Whether a track takes part in this round of the resolution
+    auto is_candidate = [&](unsigned int track) {
+        return (selected.at(track) != 0u) &&
+               (n_shared.at(track) >= maximum_shared_hits);
+    };
+    // The relative amount of shared measurements of a track
+    auto relative_shared = [&](unsigned int track) {
+        return static_cast<double>(n_shared.at(track)) /
+               static_cast<double>(track_offsets.at(track + 1) -
+                                   track_offsets.at(track));
+    };
+
+    const unsigned int track = pair_tracks.at(globalIndex);
+    if (!is_candidate(track) || (has_worse.at(track) != 0u)) {
+        return;
+    }
+    const double track_rel = relative_shared(track);
+    const scalar track_chi2 = track_states.get_headers().at(track).chi2;
+
+    const unsigned int meas = pair_measurements.at(globalIndex);
+    for (unsigned int i = measurement_offsets.at(meas);
+         i < measurement_offsets.at(meas + 1); ++i) {
+
+        const unsigned int other = pair_tracks.at(i);
+        if ((other == track) || !is_candidate(other)) {
+            continue;
+        }
+        const double other_rel = relative_shared(other);
+        const scalar other_chi2 = track_states.get_headers().at(other).chi2;
+        const bool other_is_worse =
+            (other_rel != track_rel)
+                ? (other_rel > track_rel)
+                : ((other_chi2 != track_chi2) ? (other_chi2 > track_chi2)
+                                              : (other < track));
+        if (other_is_worse) {
+            has_worse.at(track) = 1u;
+            return;
+        }
+    }
+}
+
+TRACCC_DEVICE inline void remove_worst_tracks(
+    std::size_t globalIndex,
+    vecmem::data::vector_view<const unsigned int> n_shared_view,
+    vecmem::data::vector_view<const unsigned int> has_worse_view,
+    unsigned int maximum_shared_hits,
+    vecmem::data::vector_view<unsigned int> selected_view,
+    unsigned int& n_removed) {
+
+    vecmem::device_vector<const unsigned int> n_shared(n_shared_view);
+    vecmem::device_vector<const unsigned int> has_worse(has_worse_view);
+    vecmem::device_vector<unsigned int> selected(selected_view);
+
+    if (globalIndex >= selected.size()) {
+        return;
+    }
+
+    if ((selected.at(globalIndex) == 0u) ||
+        (n_shared.at(globalIndex) < maximum_shared_hits) ||
+        (has_worse.at(globalIndex) != 0u)) {
+        return;
+    }
+
+    selected.at(globalIndex) = 0u;
+    vecmem::device_atomic_ref<unsigned int> n(n_removed);
+    n.fetch_add(1u);
+}
+
+}  // namespace traccc::device
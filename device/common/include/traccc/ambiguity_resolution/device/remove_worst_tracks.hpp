@@ -0,0 +1,87 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s).
+#include "traccc/definitions/qualifiers.hpp"
+#include "traccc/edm/track_state.hpp"
+
+// VecMem include(s).
+#include <vecmem/containers/data/vector_view.hpp>
+
+// System include(s).
+#include <cstddef>
+
+namespace traccc::device {
+
+/// Function flagging the track of one pair, if a track sharing the pair's
+/// measurement is worse than it
+///
+/// Only the "candidate" tracks, i.e. the selected tracks with at least
+/// @c maximum_shared_hits shared measurements, are compared with each other.
+/// Track @c a is worse than track @c b if it has a larger relative amount of
+/// shared measurements, then if it has a larger chi-square, then if it has a
+/// smaller index. (The order in which the host algorithm evicts tracks.)
+///
+/// @param[in] globalIndex             The index of the current thread (pair)
+/// @param[in] track_states_view       The fitted tracks
+/// @param[in] track_offsets_view      The index of the first pair of every
+///                                    track
+/// @param[in] pair_measurements_view  The (dense) measurement index of every
+///                                    pair
+/// @param[in] pair_tracks_view        The track index of every pair
+/// @param[in] measurement_offsets_view The index of the first pair of every
+///                                    measurement
+/// @param[in] selected_view           The selection flag of every track
+/// @param[in] n_shared_view           The number of shared measurements of
+///                                    every track
+/// @param[in] maximum_shared_hits     The number of shared measurements
+///                                    making a track a candidate
+/// @param[out] has_worse_view         Flag of every track having a worse
+///                                    candidate track as neighbour
+///
+TRACCC_DEVICE inline void find_worse_neighbours(
+    std::size_t globalIndex,
+    track_state_container_types::const_view track_states_view,
+    vecmem::data::vector_view<const unsigned int> track_offsets_view,
+    vecmem::data::vector_view<const unsigned int> pair_measurements_view,
+    vecmem::data::vector_view<const unsigned int> pair_tracks_view,
+    vecmem::data::vector_view<const unsigned int> measurement_offsets_view,
+    vecmem::data::vector_view<const unsigned int> selected_view,
+    vecmem::data::vector_view<const unsigned int> n_shared_view,
+    unsigned int maximum_shared_hits,
+    vecmem::data::vector_view<unsigned int> has_worse_view);
+
+/// Function removing one track from the selection, if it is a candidate
+/// without a worse candidate neighbour
+///
+/// The removed tracks share no measurements with each other, so they can all
+/// be removed in the same round.
+///
+/// @param[in] globalIndex          The index of the current thread (track)
+/// @param[in] n_shared_view        The number of shared measurements of
+///                                 every track
+/// @param[in] has_worse_view       Flag of every track having a worse
+///                                 candidate track as neighbour
+/// @param[in] maximum_shared_hits  The number of shared measurements making
+///                                 a track a candidate
+/// @param[inout] selected_view     The selection flag of every track
+/// @param[out] n_removed           The number of removed tracks
+///
+TRACCC_DEVICE inline void remove_worst_tracks(
+    std::size_t globalIndex,
+    vecmem::data::vector_view<const unsigned int> n_shared_view,
+    vecmem::data::vector_view<const unsigned int> has_worse_view,
+    unsigned int maximum_shared_hits,
+    vecmem::data::vector_view<unsigned int> selected_view,
+    unsigned int& n_removed);
+
+}  // namespace traccc::device
+
+// Include the implementation.
+#include "traccc/ambiguity_resolution/device/impl/remove_worst_tracks.ipp"
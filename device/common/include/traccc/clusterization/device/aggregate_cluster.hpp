@@ -1,6 +1,6 @@
 /** TRACCC library, part of the ACTS project (R&D line)
  *
- * (c) 2022 CERN for the benefit of the ACTS project
+ * (c) 2022-2024 CERN for the benefit of the ACTS project
  *
  * Mozilla Public License Version 2.0
  */
@@ -28,15 +28,83 @@ namespace traccc::device {
 /// @param[in] end      partition end point this cell belongs to
 /// @param[in] cid      current cell id
 /// @param[out] out     cluster to fill
-TRACCC_HOST_DEVICE
-inline void aggregate_cluster(
+/// @param[out] cell_links collection of links to measurements each cell is
+/// put into, or an empty view if the links are not needed
+/// @param[in] link     index of the measurement @c out in the output
+///
+/// @tparam index_type The type of the (partition-local) cell indices
+template <typename index_type>
+TRACCC_HOST_DEVICE inline void aggregate_cluster(
     const cell_collection_types::const_device& cells,
     const cell_module_collection_types::const_device& modules,
-    const vecmem::data::vector_view<unsigned short> f_view,
-    const unsigned int start, const unsigned int end, const unsigned short cid,
+    const vecmem::data::vector_view<index_type> f_view,
+    const unsigned int start, const unsigned int end, const unsigned int cid,
     measurement& out, vecmem::data::vector_view<unsigned int> cell_links,
     const unsigned int link);
 
+/// The number of (32-bit) words that the cooperative aggregation of the
+/// clusters needs, for each cell
+///
+/// The accumulators of a cluster are held by (the index of) its root cell.
+/// They are: the total weight of the cluster, and the weighted sums of the
+/// positions of its cells, and of the squares of those positions, relative
+/// to the position of the root cell.
+///
+static constexpr unsigned int AGGREGATION_WORDS_PER_CELL = 5;
+
+/// Function resetting the accumulators of a cluster, before the cooperative
+/// aggregation of its cells
+///
+/// @param[in] cid          the (partition-local) index of the cluster's root
+/// @param[out] accumulators the accumulators of all clusters in the partition
+///
+TRACCC_HOST_DEVICE inline void reset_cluster(const unsigned int cid,
+                                             unsigned int* accumulators);
+
+/// Function adding one cell to the accumulators of its cluster
+///
+/// Meant to be called for all cells of a partition in parallel, after the
+/// accumulators of all of its clusters were reset by
+/// @c traccc::device::reset_cluster. The cells are added with atomic
+/// operations, so the result only depends on the order of the additions
+/// (within the floating point precision).
+///
+/// @param[in] cells    collection of cells
+/// @param[in] modules  collection of modules to which the cells are linked to
+/// @param[in] f_view   array of "parent" indices for all cells in this
+/// partition
+/// @param[in] start    partition start point this cell belongs to
+/// @param[in] cid      current cell id
+/// @param[inout] accumulators the accumulators of all clusters in the
+/// partition
+///
+/// @tparam index_type The type of the (partition-local) cell indices
+template <typename index_type>
+TRACCC_DEVICE inline void aggregate_cell(
+    const cell_collection_types::const_device& cells,
+    const cell_module_collection_types::const_device& modules,
+    const vecmem::data::vector_view<index_type> f_view,
+    const unsigned int start, const unsigned int cid,
+    unsigned int* accumulators);
+
+/// Function creating the measurement of a (cooperatively aggregated) cluster
+///
+/// Gives the same result as @c traccc::device::aggregate_cluster, within the
+/// floating point precision.
+///
+/// @param[in] cells    collection of cells
+/// @param[in] modules  collection of modules to which the cells are linked to
+/// @param[in] start    partition start point this cell belongs to
+/// @param[in] cid      the (partition-local) index of the cluster's root
+/// @param[in] accumulators the accumulators of all clusters in the partition
+/// @param[out] out     cluster to fill
+///
+TRACCC_HOST_DEVICE inline void write_cluster(
+    const cell_collection_types::const_device& cells,
+    const cell_module_collection_types::const_device& modules,
+    const unsigned int start, const unsigned int cid,
+    const unsigned int* accumulators, measurement& out);
+
 }  // namespace traccc::device
 
 // Include the implementation.
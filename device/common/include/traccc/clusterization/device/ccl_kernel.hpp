@@ -1,6 +1,6 @@
 /** TRACCC library, part of the ACTS project (R&D line)
  *
- * (c) 2022-2023 CERN for the benefit of the ACTS project
+ * (c) 2022-2024 CERN for the benefit of the ACTS project
  *
  * Mozilla Public License Version 2.0
  */
@@ -8,6 +8,7 @@
 #pragma once
 
 // Project include(s).
+#include "traccc/clusterization/device/aggregate_cluster.hpp"
 #include "traccc/definitions/qualifiers.hpp"
 #include "traccc/edm/cell.hpp"
 #include "traccc/edm/measurement.hpp"
@@ -18,6 +19,7 @@
 #include <vecmem/memory/memory_resource.hpp>
 
 // System include(s).
+#include <cassert>
 #include <cstddef>
 
 namespace traccc::device {
@@ -31,6 +33,19 @@ static constexpr int TARGET_CELLS_PER_THREAD = 8;
 static constexpr int MAX_CELLS_PER_THREAD = 12;
 }  // namespace
 
+/// The size of the scratch space needed by @c traccc::device::ccl_kernel
+///
+/// @param n_cells The number of cells in the event
+/// @param cooperative_aggregation Whether to (also) have room for the
+/// accumulators of the cooperative cluster aggregation
+/// @return The number of elements that the scratch space needs to have
+///
+TRACCC_HOST_DEVICE constexpr unsigned int ccl_backup_size(
+    const unsigned int n_cells, const bool cooperative_aggregation = true) {
+    return (2 + (cooperative_aggregation ? AGGREGATION_WORDS_PER_CELL : 0)) *
+           n_cells;
+}
+
 /// Function which reads raw detector cells and turns them into measurements.
 ///
 /// @param[in] threadId current thread index
@@ -50,7 +65,14 @@ static constexpr int MAX_CELLS_PER_THREAD = 12;
 /// @param[out] measurements_view collection of measurements
 /// @param[out] measurement_count number of measurements
 /// @param[out] cell_links    collection of links to measurements each cell is
-/// put into
+/// put into, or an empty view to skip writing them
+/// @param backup_view  scratch space of (at least) twice the number of cells,
+/// used for the partitions that do not fit into @c f and @c gf. With at least
+/// @c traccc::device::ccl_backup_size elements, the clusters are also
+/// aggregated cooperatively, by all threads of a block.
+/// @param[out] measurements_start unless it is a null pointer, receives the
+/// index of the first measurement of the partition. The number of
+/// measurements of the partition is left in @c outi.
 template <typename barrier_t>
 TRACCC_DEVICE inline void ccl_kernel(
     const index_t threadId, const index_t blckDim, const unsigned int blockId,
@@ -61,7 +83,9 @@ TRACCC_DEVICE inline void ccl_kernel(
     unsigned int& partition_end, unsigned int& outi, index_t* f, index_t* gf,
     barrier_t& barrier, measurement_collection_types::view measurements_view,
     unsigned int& measurement_count,
-    vecmem::data::vector_view<unsigned int> cell_links);
+    vecmem::data::vector_view<unsigned int> cell_links,
+    vecmem::data::vector_view<unsigned int> backup_view,
+    unsigned int* measurements_start = nullptr);
 
 }  // namespace traccc::device
 
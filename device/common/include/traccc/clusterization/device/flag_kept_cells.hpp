@@ -0,0 +1,44 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s).
+#include "traccc/clusterization/detail/threshold_filter.hpp"
+#include "traccc/definitions/qualifiers.hpp"
+#include "traccc/edm/cell.hpp"
+
+// VecMem include(s).
+#include <vecmem/containers/data/vector_view.hpp>
+
+// System include(s).
+#include <cstddef>
+
+namespace traccc::device {
+
+/// Function flagging the cells kept by the threshold filter
+///
+/// The flags are meant to be used as the stencil of a stream compaction of
+/// the cells, ahead of the clusterization.
+///
+/// @param[in] globalIndex     The index for the current thread
+/// @param[in] cells_view      The cells, sorted as for the clusterization
+/// @param[in] modules_view    The modules of the cells
+/// @param[in] mode            The sub-threshold cells to drop
+/// @param[out] flags_view     1 for the kept cells, 0 otherwise
+///
+TRACCC_HOST_DEVICE
+inline void flag_kept_cells(
+    std::size_t globalIndex, cell_collection_types::const_view cells_view,
+    cell_module_collection_types::const_view modules_view,
+    threshold_filter_mode mode,
+    vecmem::data::vector_view<unsigned int> flags_view);
+
+}  // namespace traccc::device
+
+// Include the implementation.
+#include "traccc/clusterization/device/impl/flag_kept_cells.ipp"
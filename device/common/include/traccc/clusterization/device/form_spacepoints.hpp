@@ -12,6 +12,7 @@
 #include "traccc/device/fill_prefix_sum.hpp"
 #include "traccc/edm/cell.hpp"
 #include "traccc/edm/measurement.hpp"
+#include "traccc/edm/module_descriptor_soa.hpp"
 #include "traccc/edm/spacepoint.hpp"
 
 // Vecmem include(s).
@@ -40,6 +41,24 @@ inline void form_spacepoints(
     const unsigned int measurement_count,
     spacepoint_collection_types::view spacepoints_view);
 
+/// Function for creating 3D spacepoints out of 2D measurements, using the
+/// compact module descriptors for the placements of the modules
+///
+/// @param[in] globalIndex          The index for the current thread
+/// @param[in] measurements_view    Collection of measurements
+/// @param[in] descriptors_view     Descriptors of the modules (which the
+/// measurements link to)
+/// @param[in] measurement_count    Number of measurements
+/// @param[out] spacepoints_view    Collection of spacepoints
+///
+TRACCC_HOST_DEVICE
+inline void form_spacepoints(
+    const std::size_t globalIndex,
+    measurement_collection_types::const_view measurements_view,
+    module_descriptor_soa_collection_types::const_view descriptors_view,
+    const unsigned int measurement_count,
+    spacepoint_collection_types::view spacepoints_view);
+
 }  // namespace traccc::device
 
 // Include the implementation.
@@ -0,0 +1,42 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s).
+#include "traccc/definitions/qualifiers.hpp"
+#include "traccc/edm/measurement.hpp"
+
+// Vecmem include(s).
+#include <vecmem/containers/data/vector_view.hpp>
+
+// System include(s).
+#include <cstddef>
+
+namespace traccc::device {
+
+/// Function finding the event of every measurement of an event batch
+///
+/// @param[in] globalIndex          The index for the current thread
+/// @param[in] measurements_view    Collection of measurements
+/// @param[in] module_events_view   The event index of every module (which
+///                                 the measurements link to)
+/// @param[in] measurement_count    Number of measurements
+/// @param[out] measurement_events_view The event index of every measurement
+///
+TRACCC_HOST_DEVICE
+inline void get_measurement_events(
+    std::size_t globalIndex,
+    measurement_collection_types::const_view measurements_view,
+    vecmem::data::vector_view<const unsigned int> module_events_view,
+    unsigned int measurement_count,
+    vecmem::data::vector_view<unsigned int> measurement_events_view);
+
+}  // namespace traccc::device
+
+// Include the implementation.
+#include "traccc/clusterization/device/impl/get_measurement_events.ipp"
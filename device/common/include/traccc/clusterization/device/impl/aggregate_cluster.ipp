@@ -1,6 +1,6 @@
 /** TRACCC library, part of the ACTS project (R&D line)
  *
- * (c) 2022-2023 CERN for the benefit of the ACTS project
+ * (c) 2022-2024 CERN for the benefit of the ACTS project
  *
  * Mozilla Public License Version 2.0
  */
@@ -10,19 +10,59 @@
 // Project include(s)
 #include "traccc/clusterization/detail/measurement_creation_helper.hpp"
 
+// VecMem include(s).
+#include <vecmem/memory/device_atomic_ref.hpp>
+
+// System include(s).
+#include <cstring>
+
 namespace traccc::device {
+namespace details {
+
+/// Get the (single precision) value held by an accumulator word
+TRACCC_HOST_DEVICE inline float accumulator_value(const unsigned int word) {
+
+    float result;
+    memcpy(&result, &word, sizeof(float));
+    return result;
+}
+
+/// Get the accumulator word holding a (single precision) value
+TRACCC_HOST_DEVICE inline unsigned int accumulator_word(const float value) {
+
+    unsigned int result;
+    memcpy(&result, &value, sizeof(float));
+    return result;
+}
+
+/// Atomically add a value to an accumulator word
+///
+/// Implemented with a compare-and-swap loop, as atomic floating point
+/// additions are not available on all of the supported backends.
+///
+TRACCC_DEVICE inline void accumulate(unsigned int& word, const float value) {
+
+    vecmem::device_atomic_ref<unsigned int> atom(word);
+    unsigned int expected = atom.load();
+    while (!atom.compare_exchange_strong(
+        expected, accumulator_word(accumulator_value(expected) + value))) {
+    }
+}
+
+}  // namespace details
 
-TRACCC_HOST_DEVICE
-inline void aggregate_cluster(
+template <typename index_type>
+TRACCC_HOST_DEVICE inline void aggregate_cluster(
     const cell_collection_types::const_device& cells,
     const cell_module_collection_types::const_device& modules,
-    const vecmem::data::vector_view<unsigned short> f_view,
-    const unsigned int start, const unsigned int end, const unsigned short cid,
+    const vecmem::data::vector_view<index_type> f_view,
+    const unsigned int start, const unsigned int end, const unsigned int cid,
     measurement& out, vecmem::data::vector_view<unsigned int> cell_links,
     const unsigned int link) {
 
-    const vecmem::device_vector<unsigned short> f(f_view);
+    const vecmem::device_vector<index_type> f(f_view);
     vecmem::device_vector<unsigned int> cell_links_device(cell_links);
+    const bool write_cell_links = (cell_links_device.size() > 0);
 
     /*
      * Now, we iterate over all other cells to check if they belong
@@ -34,11 +74,11 @@ inline void aggregate_cluster(
     point2 mean{0., 0.}, var{0., 0.};
     const auto module_link = cells[cid + start].module_link;
     const cell_module this_module = modules.at(module_link);
-    const unsigned short partition_size = end - start;
+    const unsigned int partition_size = end - start;
 
     channel_id maxChannel1 = std::numeric_limits<channel_id>::min();
 
-    for (unsigned short j = cid; j < partition_size; j++) {
+    for (unsigned int j = cid; j < partition_size; j++) {
 
         assert(j < f.size());
 
@@ -81,7 +121,9 @@ inline void aggregate_cluster(
                 }
             }
 
-            cell_links_device.at(pos) = link;
+            if (write_cell_links) {
+                cell_links_device.at(pos) = link;
+            }
         }
 
         /*
@@ -112,4 +154,92 @@ inline void aggregate_cluster(
     out.meas_dim = 2u;
 }
 
+TRACCC_HOST_DEVICE inline void reset_cluster(const unsigned int cid,
+                                             unsigned int* accumulators) {
+
+    unsigned int* acc = accumulators + cid * AGGREGATION_WORDS_PER_CELL;
+    for (unsigned int i = 0; i < AGGREGATION_WORDS_PER_CELL; ++i) {
+        acc[i] = details::accumulator_word(0.f);
+    }
+}
+
+template <typename index_type>
+TRACCC_DEVICE inline void aggregate_cell(
+    const cell_collection_types::const_device& cells,
+    const cell_module_collection_types::const_device& modules,
+    const vecmem::data::vector_view<index_type> f_view,
+    const unsigned int start, const unsigned int cid,
+    unsigned int* accumulators) {
+
+    const vecmem::device_vector<index_type> f(f_view);
+    const unsigned int root = f[cid];
+
+    // Only cells above the threshold contribute to the cluster.
+    const cell this_cell = cells[cid + start];
+    const cell_module this_module = modules.at(this_cell.module_link);
+    const scalar weight = traccc::detail::signal_cell_modelling(
+        this_cell.activation, this_module);
+    if (!(weight > this_module.threshold)) {
+        return;
+    }
+
+    // Accumulate the position relative to the root cell, to keep the sums of
+    // the squares small.
+    const point2 diff =
+        traccc::detail::position_from_cell(this_cell, this_module) -
+        traccc::detail::position_from_cell(cells[root + start], this_module);
+    unsigned int* acc = accumulators + root * AGGREGATION_WORDS_PER_CELL;
+    details::accumulate(acc[0], static_cast<float>(weight));
+    for (char i = 0; i < 2; ++i) {
+        details::accumulate(acc[1 + i],
+                            static_cast<float>(weight * diff[i]));
+        details::accumulate(
+            acc[3 + i], static_cast<float>(weight * diff[i] * diff[i]));
+    }
+}
+
+TRACCC_HOST_DEVICE inline void write_cluster(
+    const cell_collection_types::const_device& cells,
+    const cell_module_collection_types::const_device& modules,
+    const unsigned int start, const unsigned int cid,
+    const unsigned int* accumulators, measurement& out) {
+
+    const cell root_cell = cells[cid + start];
+    const auto module_link = root_cell.module_link;
+    const cell_module this_module = modules.at(module_link);
+    const unsigned int* acc = accumulators + cid * AGGREGATION_WORDS_PER_CELL;
+
+    // Without any cell above the threshold, the cluster is left at the
+    // origin, the same as with the serial aggregation.
+    const scalar totalWeight = details::accumulator_value(acc[0]);
+    point2 mean{0., 0.}, var{0., 0.};
+    if (totalWeight > static_cast<scalar>(0.)) {
+        const point2 root_position =
+            traccc::detail::position_from_cell(root_cell, this_module);
+        const auto pitch = this_module.pixel.get_pitch();
+        for (char i = 0; i < 2; ++i) {
+            const scalar offset =
+                details::accumulator_value(acc[1 + i]) / totalWeight;
+            mean[i] = root_position[i] + offset;
+            var[i] = details::accumulator_value(acc[3 + i]) / totalWeight -
+                     offset * offset;
+            // Guard against rounding to (slightly) negative values.
+            if (var[i] < static_cast<scalar>(0.)) {
+                var[i] = 0.f;
+            }
+            var[i] += pitch[i] * pitch[i] / static_cast<scalar>(12.);
+        }
+    }
+
+    /*
+     * Fill output vector with calculated cluster properties
+     */
+    out.local = mean;
+    out.variance = var;
+    out.surface_link = this_module.surface_link;
+    out.module_link = module_link;
+    // The following will need to be filled properly "soon".
+    out.meas_dim = 2u;
+}
+
 }  // namespace traccc::device
@@ -1,12 +1,13 @@
 /** TRACCC library, part of the ACTS project (R&D line)
  *
- * (c) 2022-2023 CERN for the benefit of the ACTS project
+ * (c) 2022-2024 CERN for the benefit of the ACTS project
  *
  * Mozilla Public License Version 2.0
  */
 
 #pragma once
 
+#include "traccc/clusterization/detail/strip_ccl.hpp"
 #include "traccc/clusterization/device/aggregate_cluster.hpp"
 #include "traccc/clusterization/device/reduce_problem_cell.hpp"
 
@@ -120,6 +121,275 @@ TRACCC_DEVICE void fast_sv_1(index_t* f, index_t* gf,
     } while (barrier.blockOr(gf_changed));
 }
 
+/// FastSV algorithm for partitions that do not fit into the shared memory
+/// arrays of @c traccc::device::ccl_kernel
+///
+/// Implements the same algorithm as @c traccc::device::fast_sv_1, but with
+/// the parent arrays held in global memory, with 32-bit indices, and with
+/// the adjacent cells looked up on every iteration instead of being kept in
+/// registers. So it supports partitions of any size, at a lower speed.
+///
+/// @param[in] cells    The cells of the event
+/// @param[in] start    The start point of the partition
+/// @param[in] end      The end point of the partition
+/// @param[inout] f     array holding the parent cell ID for the current
+/// iteration.
+/// @param[inout] gf    array holding grandparent cell ID from the previous
+/// iteration.
+/// @param[in] tid      The thread index
+/// @param[in] blckDim  The block size
+/// @param[in] barrier  A generic object for block-wide synchronisation
+///
+template <typename barrier_t>
+TRACCC_DEVICE void fast_sv_global(
+    const cell_collection_types::const_device& cells, const unsigned int start,
+    const unsigned int end, unsigned int* f, unsigned int* gf,
+    const index_t tid, const index_t blckDim, barrier_t& barrier) {
+
+    const unsigned int size = end - start;
+    bool gf_changed;
+
+    do {
+        gf_changed = false;
+
+        // Hooking, with the adjacent cells found on the fly.
+        for (unsigned int cid = tid; cid < size; cid += blckDim) {
+            unsigned char adjc = 0;
+            unsigned int adjv[8];
+            device::reduce_problem_cell(cells, cid, start, end, adjc, adjv);
+            for (unsigned char k = 0; k < adjc; ++k) {
+                const unsigned int q = gf[adjv[k]];
+
+                if (gf[cid] > q) {
+                    f[f[cid]] = q;
+                    f[cid] = q;
+                }
+            }
+        }
+
+        barrier.blockBarrier();
+
+        // Shortcutting.
+        for (unsigned int cid = tid; cid < size; cid += blckDim) {
+            if (f[cid] > gf[cid]) {
+                f[cid] = gf[cid];
+            }
+        }
+
+        barrier.blockBarrier();
+
+        // Update the grandparents for the next iteration.
+        for (unsigned int cid = tid; cid < size; cid += blckDim) {
+            if (gf[cid] != f[f[cid]]) {
+                gf[cid] = f[f[cid]];
+                gf_changed = true;
+            }
+        }
+    } while (barrier.blockOr(gf_changed));
+}
+
+/// Run-length labelling of partitions holding only strip module cells
+///
+/// The clusters of strip modules are runs of consecutive cells, so every
+/// cell only needs to find the first cell of its run. Which is done with a
+/// segmented (Hillis-Steele) maximum scan of the run start indices, instead
+/// of any union-find iterations.
+///
+/// @param[in] cells    The cells of the event
+/// @param[in] start    The start point of the partition
+/// @param[in] size     The number of cells in the partition
+/// @param[out] f       array receiving the first cell of the run of each cell
+/// @param[inout] gf    scratch array of the same size as @c f
+/// @param[in] tid      The thread index
+/// @param[in] blckDim  The block size
+/// @param[in] barrier  A generic object for block-wide synchronisation
+///
+template <typename index_type, typename barrier_t>
+TRACCC_DEVICE void strip_labels(
+    const cell_collection_types::const_device& cells, const unsigned int start,
+    const unsigned int size, index_type* f, index_type* gf, const index_t tid,
+    const index_t blckDim, barrier_t& barrier) {
+
+    // Set the run starts to their own index, and all other cells to zero.
+    for (unsigned int cid = tid; cid < size; cid += blckDim) {
+        f[cid] = detail::is_run_start(cells, start, start + cid)
+                     ? static_cast<index_type>(cid)
+                     : static_cast<index_type>(0);
+    }
+
+    barrier.blockBarrier();
+
+    // Propagate the maximum run start, going back and forth between the two
+    // arrays so that the result ends up in f.
+    for (unsigned int d = 1; d < size; d *= 4) {
+        for (unsigned int cid = tid; cid < size; cid += blckDim) {
+            gf[cid] = (cid >= d && f[cid - d] > f[cid]) ? f[cid - d] : f[cid];
+        }
+        barrier.blockBarrier();
+        const unsigned int d2 = 2 * d;
+        for (unsigned int cid = tid; cid < size; cid += blckDim) {
+            f[cid] =
+                (cid >= d2 && gf[cid - d2] > gf[cid]) ? gf[cid - d2] : gf[cid];
+        }
+        barrier.blockBarrier();
+    }
+}
+
+/// Create the measurements of one partition, after its cells were labeled
+///
+/// @param[in] threadId current thread index
+/// @param[in] blckDim  current thread block size
+/// @param[in] cells_device   collection of cells
+/// @param[in] modules_device collection of modules
+/// @param[in] f_view   the "parent" indices of all cells in the partition
+/// @param[in] partition_start partition start point for this thread block
+/// @param[in] partition_end   partition end point for this thread block
+/// @param outi               number of measurements for this partition
+/// @param[in] barrier  A generic object for block-wide synchronisation
+/// @param[out] measurements_device collection of measurements
+/// @param[out] measurement_count number of measurements
+/// @param[out] cell_links    collection of links to measurements each cell is
+/// put into, or an empty view to skip writing them
+/// @param[out] slots   array receiving the (partition-local) measurement index
+/// of each cluster, at the index of its root cell. Only used with
+/// @c accumulators.
+/// @param[out] accumulators the accumulators of the clusters of the
+/// partition, or a null pointer to aggregate every cluster serially (by the
+/// thread that found its root cell)
+/// @param[out] measurements_start receives the index of the first measurement
+/// of the partition, unless it is a null pointer
+///
+template <typename index_type, typename barrier_t>
+TRACCC_DEVICE inline void write_partition_measurements(
+    const index_t threadId, const index_t blckDim,
+    const cell_collection_types::const_device& cells_device,
+    const cell_module_collection_types::const_device& modules_device,
+    const vecmem::data::vector_view<index_type> f_view,
+    const unsigned int partition_start, const unsigned int partition_end,
+    unsigned int& outi, barrier_t& barrier,
+    measurement_collection_types::device& measurements_device,
+    unsigned int& measurement_count,
+    vecmem::data::vector_view<unsigned int> cell_links, index_type* slots,
+    unsigned int* accumulators, unsigned int* measurements_start) {
+
+    const vecmem::device_vector<const index_type> f(f_view);
+    const unsigned int size = partition_end - partition_start;
+
+    /*
+     * Count the number of clusters by checking how many cells have
+     * themself assigned as a parent.
+     */
+    for (unsigned int cid = threadId; cid < size; cid += blckDim) {
+
+        if (f[cid] == cid) {
+            // Increment the summary values in the header object.
+            vecmem::device_atomic_ref<unsigned int,
+                                      vecmem::device_address_space::local>
+                atom(outi);
+            atom.fetch_add(1);
+        }
+    }
+
+    barrier.blockBarrier();
+
+    /*
+     * Add the number of clusters of each thread block to the total
+     * number of clusters. At the same time, a cluster id is retrieved
+     * for the next data processing step.
+     * Note that this might be not the same cluster as has been treated
+     * previously. However, since each thread block spawns a the maximum
+     * amount of threads per block, this has no sever implications.
+     */
+    if (threadId == 0) {
+        vecmem::device_atomic_ref<unsigned int,
+                                  vecmem::device_address_space::global>
+            atom(measurement_count);
+        outi = atom.fetch_add(outi);
+    }
+
+    barrier.blockBarrier();
+
+    /*
+     * Get the position to fill the measurements found in this thread group.
+     */
+    const unsigned int groupPos = outi;
+
+    barrier.blockBarrier();
+
+    if (threadId == 0) {
+        outi = 0;
+        if (measurements_start != nullptr) {
+            *measurements_start = groupPos;
+        }
+    }
+
+    barrier.blockBarrier();
+
+    /*
+     * With scratch space for the accumulators, all threads of the block
+     * aggregate the clusters together: every cell is added to the
+     * accumulators of its cluster in parallel, and the measurements are
+     * written from the accumulators afterwards. This keeps all threads busy
+     * in partitions with a few large clusters, where the serial aggregation
+     * is limited by the largest cluster. Note that the choice is the same
+     * for all threads of the block.
+     */
+    if (accumulators != nullptr) {
+
+        for (unsigned int cid = threadId; cid < size; cid += blckDim) {
+            if (f[cid] == cid) {
+                vecmem::device_atomic_ref<unsigned int,
+                                          vecmem::device_address_space::local>
+                    atom(outi);
+                slots[cid] = static_cast<index_type>(atom.fetch_add(1));
+                device::reset_cluster(cid, accumulators);
+            }
+        }
+
+        barrier.blockBarrier();
+
+        for (unsigned int cid = threadId; cid < size; cid += blckDim) {
+            device::aggregate_cell(cells_device, modules_device, f_view,
+                                   partition_start, cid, accumulators);
+        }
+
+        barrier.blockBarrier();
+
+        vecmem::device_vector<unsigned int> cell_links_device(cell_links);
+        const bool write_cell_links = (cell_links_device.size() > 0);
+        for (unsigned int cid = threadId; cid < size; cid += blckDim) {
+            if (f[cid] == cid) {
+                device::write_cluster(
+                    cells_device, modules_device, partition_start, cid,
+                    accumulators, measurements_device[groupPos + slots[cid]]);
+            }
+            if (write_cell_links) {
+                cell_links_device.at(partition_start + cid) =
+                    groupPos + slots[f[cid]];
+            }
+        }
+    } else {
+
+        for (unsigned int cid = threadId; cid < size; cid += blckDim) {
+            if (f[cid] == cid) {
+                /*
+                 * If we are a cluster owner, atomically claim a position in
+                 * the output array which we can write to.
+                 */
+                vecmem::device_atomic_ref<unsigned int,
+                                          vecmem::device_address_space::local>
+                    atom(outi);
+                const unsigned int id = atom.fetch_add(1);
+
+                device::aggregate_cluster(cells_device, modules_device, f_view,
+                                          partition_start, partition_end, cid,
+                                          measurements_device[groupPos + id],
+                                          cell_links, groupPos + id);
+            }
+        }
+    }
+}
+
 template <typename barrier_t>
 TRACCC_DEVICE inline void ccl_kernel(
     const index_t threadId, const index_t blckDim, const unsigned int blockId,
@@ -130,7 +400,9 @@ TRACCC_DEVICE inline void ccl_kernel(
     unsigned int& partition_end, unsigned int& outi, index_t* f, index_t* gf,
     barrier_t& barrier, measurement_collection_types::view measurements_view,
     unsigned int& measurement_count,
-    vecmem::data::vector_view<unsigned int> cell_links) {
+    vecmem::data::vector_view<unsigned int> cell_links,
+    vecmem::data::vector_view<unsigned int> backup_view,
+    unsigned int* measurements_start) {
 
     // Get device copy of input parameters
     const cell_collection_types::const_device cells_device(cells_view);
@@ -149,19 +421,25 @@ TRACCC_DEVICE inline void ccl_kernel(
      * amounts.
      */
     if (threadId == 0) {
-        unsigned int start = blockId * target_cells_per_partition;
-        assert(start < num_cells);
+        unsigned int start =
+            std::min(num_cells, blockId * target_cells_per_partition);
         unsigned int end =
             std::min(num_cells, start + target_cells_per_partition);
         outi = 0;
 
+        /*
+         * Note that blocks starting past the last cell (which happens when
+         * the kernel is launched for a cell capacity, instead of the actual
+         * number of cells) end up with an empty partition.
+         */
+
         /*
          * Next, shift the starting point to a position further in the
          * array; the purpose of this is to ensure that we are not operating
          * on any cells that have been claimed by the previous block (if
          * any).
          */
-        while (start != 0 &&
+        while (start != 0 && start < num_cells &&
                cells_device[start - 1].module_link ==
                    cells_device[start].module_link &&
                cells_device[start].channel1 <=
@@ -187,129 +465,145 @@ TRACCC_DEVICE inline void ccl_kernel(
 
     barrier.blockBarrier();
 
-    // Vector of indices of the adjacent cells
-    index_t adjv[MAX_CELLS_PER_THREAD][8];
-    /*
-     * The number of adjacent cells for each cell must start at zero, to
-     * avoid uninitialized memory. adjv does not need to be zeroed, as
-     * we will only access those values if adjc indicates that the value
-     * is set.
-     */
-    // Number of adjacent cells
-    unsigned char adjc[MAX_CELLS_PER_THREAD];
-
     // It seems that sycl runs into undefined behaviour when calling
     // group synchronisation functions when some threads have already run
     // into a return. As such, we cannot use returns in this kernel.
 
-    // Get partition for this thread group
-    const index_t size = partition_end - partition_start;
-    assert(size <= max_cells_per_partition);
-
-#pragma unroll
-    for (index_t tst = 0; tst < MAX_CELLS_PER_THREAD; ++tst) {
-        adjc[tst] = 0;
-    }
-
-    for (index_t tst = 0, cid; (cid = tst * blckDim + threadId) < size; ++tst) {
-        /*
-         * Look for adjacent cells to the current one.
-         */
-        device::reduce_problem_cell(cells_device, cid, partition_start,
-                                    partition_end, adjc[tst], adjv[tst]);
-    }
-
-#pragma unroll
-    for (index_t tst = 0; tst < MAX_CELLS_PER_THREAD; ++tst) {
-        const index_t cid = tst * blckDim + threadId;
-        /*
-         * At the start, the values of f and gf should be equal to the
-         * ID of the cell.
-         */
-        f[cid] = cid;
-        gf[cid] = cid;
-    }
-
     /*
-     * Now that the data has initialized, we synchronize again before we
-     * move onto the actual processing part.
+     * Partitions in very dense modules may not fit into the shared memory
+     * arrays. Those are labeled in global memory instead, while all other
+     * partitions use the (much faster) shared memory arrays. Note that the
+     * partition size is the same for all threads of the block, so all of
+     * them take the same branch.
      */
-    barrier.blockBarrier();
+    const unsigned int partition_size = partition_end - partition_start;
 
     /*
-     * Run FastSV algorithm, which will update the father index to that of
-     * the cell belonging to the same cluster with the lowest index.
+     * Partitions with only strip module cells are labeled with the run-length
+     * labelling, skipping the adjacency search and FastSV altogether.
      */
-    fast_sv_1(&f[0], &gf[0], adjc, adjv, threadId, blckDim, barrier);
-
-    barrier.blockBarrier();
+    bool has_pixel_cells = false;
+    for (unsigned int cid = threadId; cid < partition_size; cid += blckDim) {
+        has_pixel_cells |=
+            (modules_device[cells_device[partition_start + cid].module_link]
+                 .pixel.dimensions != 1);
+    }
+    const bool strip_partition = !barrier.blockOr(has_pixel_cells);
 
     /*
-     * Count the number of clusters by checking how many cells have
-     * themself assigned as a parent.
+     * The clusters are aggregated cooperatively if the scratch space has
+     * room for their accumulators, after the global memory label arrays.
      */
-    for (index_t tst = 0, cid; (cid = tst * blckDim + threadId) < size; ++tst) {
+    unsigned int* accumulators =
+        (backup_view.size() >= ccl_backup_size(num_cells, true))
+            ? backup_view.ptr() + 2 * num_cells +
+                  AGGREGATION_WORDS_PER_CELL * partition_start
+            : nullptr;
+
+    if (strip_partition && (partition_size <= max_cells_per_partition)) {
+
+        strip_labels(cells_device, partition_start, partition_size, &f[0],
+                     &gf[0], threadId, blckDim, barrier);
+
+        write_partition_measurements(
+            threadId, blckDim, cells_device, modules_device,
+            vecmem::data::vector_view<index_t>(max_cells_per_partition, &f[0]),
+            partition_start, partition_end, outi, barrier, measurements_device,
+            measurement_count, cell_links, &gf[0], accumulators,
+            measurements_start);
+    } else if (partition_size <= max_cells_per_partition) {
+
+        // Vector of indices of the adjacent cells
+        index_t adjv[MAX_CELLS_PER_THREAD][8];
+        /*
+         * The number of adjacent cells for each cell must start at zero, to
+         * avoid uninitialized memory. adjv does not need to be zeroed, as
+         * we will only access those values if adjc indicates that the value
+         * is set.
+         */
+        // Number of adjacent cells
+        unsigned char adjc[MAX_CELLS_PER_THREAD];
 
-        if (f[cid] == cid) {
-            // Increment the summary values in the header object.
-            vecmem::device_atomic_ref<unsigned int,
-                                      vecmem::device_address_space::local>
-                atom(outi);
-            atom.fetch_add(1);
-        }
-    }
+        // Get partition for this thread group
+        const index_t size = static_cast<index_t>(partition_size);
 
-    barrier.blockBarrier();
+#pragma unroll
+        for (index_t tst = 0; tst < MAX_CELLS_PER_THREAD; ++tst) {
+            adjc[tst] = 0;
+        }
 
-    /*
-     * Add the number of clusters of each thread block to the total
-     * number of clusters. At the same time, a cluster id is retrieved
-     * for the next data processing step.
-     * Note that this might be not the same cluster as has been treated
-     * previously. However, since each thread block spawns a the maximum
-     * amount of threads per block, this has no sever implications.
-     */
-    if (threadId == 0) {
-        vecmem::device_atomic_ref<unsigned int,
-                                  vecmem::device_address_space::global>
-            atom(measurement_count);
-        outi = atom.fetch_add(outi);
-    }
+        for (index_t tst = 0, cid; (cid = tst * blckDim + threadId) < size;
+             ++tst) {
+            /*
+             * Look for adjacent cells to the current one.
+             */
+            device::reduce_problem_cell(cells_device, cid, partition_start,
+                                        partition_end, adjc[tst], adjv[tst]);
+        }
 
-    barrier.blockBarrier();
+#pragma unroll
+        for (index_t tst = 0; tst < MAX_CELLS_PER_THREAD; ++tst) {
+            const index_t cid = tst * blckDim + threadId;
+            /*
+             * At the start, the values of f and gf should be equal to the
+             * ID of the cell.
+             */
+            f[cid] = cid;
+            gf[cid] = cid;
+        }
 
-    /*
-     * Get the position to fill the measurements found in this thread group.
-     */
-    const unsigned int groupPos = outi;
+        /*
+         * Now that the data has initialized, we synchronize again before we
+         * move onto the actual processing part.
+         */
+        barrier.blockBarrier();
 
-    barrier.blockBarrier();
+        /*
+         * Run FastSV algorithm, which will update the father index to that
+         * of the cell belonging to the same cluster with the lowest index.
+         */
+        fast_sv_1(&f[0], &gf[0], adjc, adjv, threadId, blckDim, barrier);
 
-    if (threadId == 0) {
-        outi = 0;
-    }
+        barrier.blockBarrier();
 
-    barrier.blockBarrier();
+        write_partition_measurements(
+            threadId, blckDim, cells_device, modules_device,
+            vecmem::data::vector_view<index_t>(max_cells_per_partition, &f[0]),
+            partition_start, partition_end, outi, barrier, measurements_device,
+            measurement_count, cell_links, &gf[0], accumulators,
+            measurements_start);
+    } else {
+
+        // Use this partition's part of the global memory arrays.
+        assert(backup_view.size() >= 2 * num_cells);
+        unsigned int* f_global = backup_view.ptr() + partition_start;
+        unsigned int* gf_global =
+            backup_view.ptr() + num_cells + partition_start;
+
+        if (strip_partition) {
+            strip_labels(cells_device, partition_start, partition_size,
+                         f_global, gf_global, threadId, blckDim, barrier);
+        } else {
+            for (unsigned int cid = threadId; cid < partition_size;
+                 cid += blckDim) {
+                f_global[cid] = cid;
+                gf_global[cid] = cid;
+            }
 
-    const vecmem::data::vector_view<unsigned short> f_view(
-        max_cells_per_partition, &f[0]);
+            barrier.blockBarrier();
 
-    for (index_t tst = 0, cid; (cid = tst * blckDim + threadId) < size; ++tst) {
-        if (f[cid] == cid) {
-            /*
-             * If we are a cluster owner, atomically claim a position in the
-             * output array which we can write to.
-             */
-            vecmem::device_atomic_ref<unsigned int,
-                                      vecmem::device_address_space::local>
-                atom(outi);
-            const unsigned int id = atom.fetch_add(1);
+            fast_sv_global(cells_device, partition_start, partition_end,
+                           f_global, gf_global, threadId, blckDim, barrier);
 
-            device::aggregate_cluster(cells_device, modules_device, f_view,
-                                      partition_start, partition_end, cid,
-                                      measurements_device[groupPos + id],
-                                      cell_links, groupPos + id);
+            barrier.blockBarrier();
         }
+
+        write_partition_measurements(
+            threadId, blckDim, cells_device, modules_device,
+            vecmem::data::vector_view<unsigned int>(partition_size, f_global),
+            partition_start, partition_end, outi, barrier, measurements_device,
+            measurement_count, cell_links, gf_global, accumulators,
+            measurements_start);
     }
 }
 
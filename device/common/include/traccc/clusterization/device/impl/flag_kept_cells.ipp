@@ -0,0 +1,37 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// VecMem include(s).
+#include <vecmem/containers/device_vector.hpp>
+
+namespace traccc::device {
+
+TRACCC_HOST_DEVICE
+inline void flag_kept_cells(
+    std::size_t globalIndex, cell_collection_types::const_view cells_view,
+    cell_module_collection_types::const_view modules_view,
+    threshold_filter_mode mode,
+    vecmem::data::vector_view<unsigned int> flags_view) {
+
+    const cell_collection_types::const_device cells(cells_view);
+    if (globalIndex >= cells.size()) {
+        return;
+    }
+
+    const cell_module_collection_types::const_device modules(modules_view);
+    vecmem::device_vector<unsigned int> flags(flags_view);
+
+    flags.at(globalIndex) =
+        detail::is_kept_cell(static_cast<unsigned int>(globalIndex), cells,
+                             modules, mode)
+            ? 1u
+            : 0u;
+}
+
+}  // namespace traccc::device
@@ -44,4 +44,35 @@ inline void form_spacepoints(
     spacepoints_device[globalIndex] = {global, meas};
 }
 
+TRACCC_HOST_DEVICE
+inline void form_spacepoints(
+    const std::size_t globalIndex,
+    measurement_collection_types::const_view measurements_view,
+    module_descriptor_soa_collection_types::const_view descriptors_view,
+    const unsigned int measurement_count,
+    spacepoint_collection_types::view spacepoints_view) {
+
+    // Check if anything needs to be done
+    if (globalIndex >= measurement_count) {
+        return;
+    }
+
+    // Get device copy of input parameters
+    const measurement_collection_types::const_device measurements_device(
+        measurements_view);
+    const module_descriptor_soa_collection_types::const_device descriptors(
+        descriptors_view);
+
+    spacepoint_collection_types::device spacepoints_device(spacepoints_view);
+
+    // Form a spacepoint based on the measurement for this index, reading
+    // only the (compact) placement of its module
+    const measurement& meas = measurements_device.at(globalIndex);
+    const point3 global =
+        descriptors.point_to_global(meas.module_link, meas.local);
+
+    // Fill the result object with this spacepoint
+    spacepoints_device[globalIndex] = {global, meas};
+}
+
 }  // namespace traccc::device
\ No newline at end of file
@@ -0,0 +1,41 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// VecMem include(s).
+#include <vecmem/containers/device_vector.hpp>
+
+namespace traccc::device {
+
+TRACCC_HOST_DEVICE
+inline void get_measurement_events(
+    const std::size_t globalIndex,
+    measurement_collection_types::const_view measurements_view,
+    vecmem::data::vector_view<const unsigned int> module_events_view,
+    const unsigned int measurement_count,
+    vecmem::data::vector_view<unsigned int> measurement_events_view) {
+
+    // Check if anything needs to be done
+    if (globalIndex >= measurement_count) {
+        return;
+    }
+
+    // Get device copies of the parameters
+    const measurement_collection_types::const_device measurements(
+        measurements_view);
+    const vecmem::device_vector<const unsigned int> module_events(
+        module_events_view);
+    vecmem::device_vector<unsigned int> measurement_events(
+        measurement_events_view);
+
+    // The measurement belongs to the event of its module.
+    measurement_events.at(globalIndex) =
+        module_events.at(measurements.at(globalIndex).module_link);
+}
+
+}  // namespace traccc::device
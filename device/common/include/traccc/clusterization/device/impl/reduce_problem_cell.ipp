@@ -1,6 +1,6 @@
 /** TRACCC library, part of the ACTS project (R&D line)
  *
- * (c) 2022 CERN for the benefit of the ACTS project
+ * (c) 2022-2024 CERN for the benefit of the ACTS project
  *
  * Mozilla Public License Version 2.0
  */
@@ -22,11 +22,11 @@ inline bool is_adjacent(channel_id ac0, channel_id ac1, channel_id bc0,
     return p0 * p0 <= 1 && p1 * p1 <= 1;
 }
 
-TRACCC_HOST_DEVICE
-inline void reduce_problem_cell(
-    const cell_collection_types::const_device& cells, const unsigned short cid,
+template <typename index_type>
+TRACCC_HOST_DEVICE inline void reduce_problem_cell(
+    const cell_collection_types::const_device& cells, const unsigned int cid,
     const unsigned int start, const unsigned int end, unsigned char& adjc,
-    unsigned short adjv[8]) {
+    index_type adjv[8]) {
 
     const unsigned int pos = cid + start;
 
@@ -57,7 +57,7 @@ inline void reduce_problem_cell(
          * in the current cell's adjacency set.
          */
         if (is_adjacent(c0, c1, cells[j].channel0, cells[j].channel1)) {
-            adjv[adjc++] = j - start;
+            adjv[adjc++] = static_cast<index_type>(j - start);
         }
     }
 
@@ -75,7 +75,7 @@ inline void reduce_problem_cell(
         }
 
         if (is_adjacent(c0, c1, cells[j].channel0, cells[j].channel1)) {
-            adjv[adjc++] = j - start;
+            adjv[adjc++] = static_cast<index_type>(j - start);
         }
     }
 }
@@ -0,0 +1,117 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// VecMem include(s).
+#include <vecmem/containers/device_vector.hpp>
+
+namespace traccc::device {
+
+TRACCC_HOST_DEVICE
+inline void make_raw_cell_channel_keys(
+    std::size_t globalIndex,
+    raw_cell_collection_types::const_view raw_cells_view,
+    vecmem::data::vector_view<std::uint64_t> keys_view,
+    vecmem::data::vector_view<unsigned int> indices_view) {
+
+    const raw_cell_collection_types::const_device raw_cells(raw_cells_view);
+    if (globalIndex >= raw_cells.size()) {
+        return;
+    }
+
+    vecmem::device_vector<std::uint64_t> keys(keys_view);
+    vecmem::device_vector<unsigned int> indices(indices_view);
+
+    const raw_cell& c = raw_cells.at(globalIndex);
+    keys.at(globalIndex) =
+        (static_cast<std::uint64_t>(c.channel1) << 32) |
+        static_cast<std::uint64_t>(static_cast<std::uint32_t>(c.channel0));
+    indices.at(globalIndex) = static_cast<unsigned int>(globalIndex);
+}
+
+TRACCC_HOST_DEVICE
+inline void make_raw_cell_module_keys(
+    std::size_t globalIndex,
+    raw_cell_collection_types::const_view raw_cells_view,
+    vecmem::data::vector_view<const unsigned int> indices_view,
+    vecmem::data::vector_view<std::uint64_t> keys_view) {
+
+    const vecmem::device_vector<const unsigned int> indices(indices_view);
+    if (globalIndex >= indices.size()) {
+        return;
+    }
+
+    const raw_cell_collection_types::const_device raw_cells(raw_cells_view);
+    vecmem::device_vector<std::uint64_t> keys(keys_view);
+
+    keys.at(globalIndex) = raw_cells.at(indices.at(globalIndex)).module_id;
+}
+
+TRACCC_HOST_DEVICE
+inline void flag_raw_cell_modules(
+    std::size_t globalIndex,
+    vecmem::data::vector_view<const std::uint64_t> keys_view,
+    vecmem::data::vector_view<unsigned int> flags_view) {
+
+    const vecmem::device_vector<const std::uint64_t> keys(keys_view);
+    if (globalIndex >= keys.size()) {
+        return;
+    }
+
+    vecmem::device_vector<unsigned int> flags(flags_view);
+    flags.at(globalIndex) =
+        ((globalIndex == 0) ||
+         (keys.at(globalIndex) != keys.at(globalIndex - 1)))
+            ? 1u
+            : 0u;
+}
+
+TRACCC_HOST_DEVICE
+inline void fill_sorted_cells(
+    std::size_t globalIndex,
+    raw_cell_collection_types::const_view raw_cells_view,
+    vecmem::data::vector_view<const unsigned int> indices_view,
+    vecmem::data::vector_view<const unsigned int> module_sum_view,
+    const cell_module_map_view& module_map,
+    cell_collection_types::view cells_view,
+    cell_module_collection_types::view modules_view) {
+
+    const vecmem::device_vector<const unsigned int> indices(indices_view);
+    if (globalIndex >= indices.size()) {
+        return;
+    }
+
+    const raw_cell_collection_types::const_device raw_cells(raw_cells_view);
+    const vecmem::device_vector<const unsigned int> module_sum(
+        module_sum_view);
+    cell_collection_types::device cells(cells_view);
+
+    // Fill the cell, linking it to its module
+    const raw_cell& c = raw_cells.at(indices.at(globalIndex));
+    const unsigned int module_link = module_sum.at(globalIndex) - 1;
+    cells.at(globalIndex) = {c.channel0, c.channel1, c.activation, c.time,
+                             module_link};
+
+    // The first cell of every module fills the module
+    if ((globalIndex != 0) &&
+        (module_sum.at(globalIndex) == module_sum.at(globalIndex - 1))) {
+        return;
+    }
+    cell_module_collection_types::device modules(modules_view);
+    const hashed_module_map_device<geometry_id, cell_module> map(module_map);
+    const cell_module* mod = map.find(c.module_id);
+    if (mod != nullptr) {
+        modules.at(module_link) = *mod;
+    } else {
+        cell_module result;
+        result.surface_link = detray::geometry::barcode{c.module_id};
+        modules.at(module_link) = result;
+    }
+}
+
+}  // namespace traccc::device
@@ -1,6 +1,6 @@
 /** TRACCC library, part of the ACTS project (R&D line)
  *
- * (c) 2022 CERN for the benefit of the ACTS project
+ * (c) 2022-2024 CERN for the benefit of the ACTS project
  *
  * Mozilla Public License Version 2.0
  */
@@ -27,11 +27,13 @@ namespace traccc::device {
 /// @param[out] ajc     Number of adjacent cells
 /// @param[out] ajv     Indices of adjacent cells
 ///
-TRACCC_HOST_DEVICE
-inline void reduce_problem_cell(
-    const cell_collection_types::const_device& cells, const unsigned short cid,
+/// @tparam index_type The type of the (partition-local) cell indices
+///
+template <typename index_type>
+TRACCC_HOST_DEVICE inline void reduce_problem_cell(
+    const cell_collection_types::const_device& cells, const unsigned int cid,
     const unsigned int start, const unsigned int end, unsigned char& adjc,
-    unsigned short adjv[8]);
+    index_type adjv[8]);
 
 }  // namespace traccc::device
 
@@ -0,0 +1,100 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s).
+#include "traccc/definitions/primitives.hpp"
+#include "traccc/definitions/qualifiers.hpp"
+#include "traccc/edm/cell.hpp"
+#include "traccc/edm/raw_cell.hpp"
+#include "traccc/geometry/hashed_module_map.hpp"
+
+// VecMem include(s).
+#include <vecmem/containers/data/vector_view.hpp>
+
+// System include(s).
+#include <cstddef>
+#include <cstdint>
+
+namespace traccc::device {
+
+/// Type of the map from geometry identifiers to module descriptions, used
+/// when building the module collection of the cells on a device
+using cell_module_map_view = hashed_module_map_view<geometry_id, cell_module>;
+
+/// Function making the channel sort keys of the raw cells
+///
+/// The channel1 identifier of a cell is its most significant part, as the
+/// clusterization expects the cells of a module to be sorted by it.
+///
+/// @param[in] globalIndex     The index for the current thread
+/// @param[in] raw_cells_view  The raw cells
+/// @param[out] keys_view      The channel sort keys of the cells
+/// @param[out] indices_view   The (unsorted) indices of the cells
+///
+TRACCC_HOST_DEVICE
+inline void make_raw_cell_channel_keys(
+    std::size_t globalIndex,
+    raw_cell_collection_types::const_view raw_cells_view,
+    vecmem::data::vector_view<std::uint64_t> keys_view,
+    vecmem::data::vector_view<unsigned int> indices_view);
+
+/// Function making the module sort keys of the (partially sorted) raw cells
+///
+/// @param[in] globalIndex     The index for the current thread
+/// @param[in] raw_cells_view  The raw cells
+/// @param[in] indices_view    The indices of the cells, sorted by channel
+/// @param[out] keys_view      The module sort keys of the cells
+///
+TRACCC_HOST_DEVICE
+inline void make_raw_cell_module_keys(
+    std::size_t globalIndex,
+    raw_cell_collection_types::const_view raw_cells_view,
+    vecmem::data::vector_view<const unsigned int> indices_view,
+    vecmem::data::vector_view<std::uint64_t> keys_view);
+
+/// Function flagging the first cell of every module, in the sorted cells
+///
+/// @param[in] globalIndex     The index for the current thread
+/// @param[in] keys_view       The sorted module keys of the cells
+/// @param[out] flags_view     1 for the first cell of a module, 0 otherwise
+///
+TRACCC_HOST_DEVICE
+inline void flag_raw_cell_modules(
+    std::size_t globalIndex,
+    vecmem::data::vector_view<const std::uint64_t> keys_view,
+    vecmem::data::vector_view<unsigned int> flags_view);
+
+/// Function filling the sorted cells and their modules
+///
+/// Modules not found in the module map only get their surface link set, the
+/// same as when reading cells on the host without a geometry and a
+/// digitization configuration.
+///
+/// @param[in] globalIndex     The index for the current thread
+/// @param[in] raw_cells_view  The raw cells
+/// @param[in] indices_view    The indices of the sorted cells
+/// @param[in] module_sum_view The inclusive prefix sum of the module flags
+/// @param[in] module_map      The module descriptions of the detector
+/// @param[out] cells_view     The sorted cells
+/// @param[out] modules_view   The modules of the cells
+///
+TRACCC_HOST_DEVICE
+inline void fill_sorted_cells(
+    std::size_t globalIndex,
+    raw_cell_collection_types::const_view raw_cells_view,
+    vecmem::data::vector_view<const unsigned int> indices_view,
+    vecmem::data::vector_view<const unsigned int> module_sum_view,
+    const cell_module_map_view& module_map,
+    cell_collection_types::view cells_view,
+    cell_module_collection_types::view modules_view);
+
+}  // namespace traccc::device
+
+// Include the implementation.
+#include "traccc/clusterization/device/impl/sort_raw_cells.ipp"
@@ -0,0 +1,39 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s).
+#include "traccc/definitions/qualifiers.hpp"
+
+// VecMem include(s).
+#include <vecmem/memory/device_atomic_ref.hpp>
+
+namespace traccc::device {
+
+/// Functor reserving one element at the end of a compacted output
+///
+/// Every calling thread increments the counter of the output by itself.
+/// Device specific code may provide functors with the same interface that
+/// aggregate the increments of multiple threads.
+///
+struct atomic_append {
+
+    /// Reserve one element in an output
+    ///
+    /// @param counter The number of elements in the output
+    /// @return The index of the reserved element
+    ///
+    TRACCC_DEVICE
+    unsigned int operator()(unsigned int& counter) const {
+        vecmem::device_atomic_ref<unsigned int> atomic_counter(counter);
+        return atomic_counter.fetch_add(1u);
+    }
+
+};  // struct atomic_append
+
+}  // namespace traccc::device
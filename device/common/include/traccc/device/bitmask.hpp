@@ -0,0 +1,51 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s).
+#include "traccc/definitions/qualifiers.hpp"
+
+// VecMem include(s).
+#include <vecmem/containers/device_vector.hpp>
+#include <vecmem/memory/device_atomic_ref.hpp>
+
+namespace traccc::device {
+
+/// @name Helpers for bitmasks, stored in vectors of 32-bit words
+/// @{
+
+/// The number of bits in one word of a bitmask
+constexpr unsigned int bitmask_word_bits = 32u;
+
+/// The number of words needed for the bitmask of some number of elements
+TRACCC_HOST_DEVICE
+constexpr unsigned int bitmask_size(unsigned int n_elements) {
+    return (n_elements + bitmask_word_bits - 1u) / bitmask_word_bits;
+}
+
+/// Check whether the bit of an element is set in a bitmask
+TRACCC_HOST_DEVICE
+inline bool bitmask_test(const vecmem::device_vector<const unsigned int>& mask,
+                         unsigned int element) {
+    return (mask.at(element / bitmask_word_bits) >>
+            (element % bitmask_word_bits)) &
+           1u;
+}
+
+/// Set the bit of an element in a bitmask, atomically
+TRACCC_DEVICE
+inline void bitmask_set(vecmem::device_vector<unsigned int>& mask,
+                        unsigned int element) {
+    vecmem::device_atomic_ref<unsigned int> word(
+        mask.at(element / bitmask_word_bits));
+    word.fetch_or(1u << (element % bitmask_word_bits));
+}
+
+/// @}
+
+}  // namespace traccc::device
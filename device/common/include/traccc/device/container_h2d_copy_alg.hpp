@@ -43,8 +43,21 @@ class container_h2d_copy_alg {
     container_h2d_copy_alg(const memory_resource& mr, vecmem::copy& deviceCopy);
 
     /// Function executing a simple copy to the device
+    ///
+    /// If the items of the input are not contiguous in memory (as is the case
+    /// for a host jagged vector), and a host memory resource is available,
+    /// the items are first gathered into a contiguous staging buffer in host
+    /// memory, so that they would be uploaded with a single copy. The
+    /// function waits for the upload from the staging buffer to finish
+    /// before returning.
+    ///
     output_type operator()(input_type input) const;
     /// Function executing an optimised copy to the device
+    ///
+    /// The input is gathered into @c hostBuffer, which is uploaded with a
+    /// single (asynchronous) copy. The caller must keep @c hostBuffer alive
+    /// until the copy is finished.
+    ///
     output_type operator()(input_type input,
                            typename CONTAINER_TYPES::buffer& hostBuffer) const;
 
@@ -56,6 +69,13 @@ class container_h2d_copy_alg {
 
     /// Helper function calculating the size(s) of the input container
     std::vector<std::size_t> get_sizes(input_type input) const;
+    /// Helper function checking if the items of the input are contiguous
+    bool items_contiguous(input_type input) const;
+    /// Helper function copying the input through a host staging buffer
+    output_type staged_copy(
+        input_type input, typename CONTAINER_TYPES::buffer& hostBuffer,
+        vecmem::copy::event_type& header_event,
+        vecmem::copy::event_type& item_event) const;
 
     /// The memory resource(s) to use
     memory_resource m_mr;
@@ -22,6 +22,20 @@ template <typename CONTAINER_TYPES>
 typename container_h2d_copy_alg<CONTAINER_TYPES>::output_type
 container_h2d_copy_alg<CONTAINER_TYPES>::operator()(input_type input) const {
 
+    // If the items are scattered in host memory, gather them into a
+    // contiguous staging buffer first. Copying them directly would result in
+    // one copy operation per inner vector.
+    if ((m_mr.host != nullptr) && (!items_contiguous(input))) {
+        typename CONTAINER_TYPES::buffer hostBuffer;
+        vecmem::copy::event_type header_event, item_event;
+        output_type result =
+            staged_copy(input, hostBuffer, header_event, item_event);
+        // The staging buffer goes out of scope, so the copies have to finish.
+        header_event->wait();
+        item_event->wait();
+        return result;
+    }
+
     // Get the sizes of the jagged vector.
     const std::vector<std::size_t> sizes = get_sizes(input);
 
@@ -45,6 +59,17 @@ typename container_h2d_copy_alg<CONTAINER_TYPES>::output_type
 container_h2d_copy_alg<CONTAINER_TYPES>::operator()(
     input_type input, typename CONTAINER_TYPES::buffer& hostBuffer) const {
 
+    vecmem::copy::event_type header_event, item_event;
+    return staged_copy(input, hostBuffer, header_event, item_event);
+}
+
+template <typename CONTAINER_TYPES>
+typename container_h2d_copy_alg<CONTAINER_TYPES>::output_type
+container_h2d_copy_alg<CONTAINER_TYPES>::staged_copy(
+    input_type input, typename CONTAINER_TYPES::buffer& hostBuffer,
+    vecmem::copy::event_type& header_event,
+    vecmem::copy::event_type& item_event) const {
+
     // Get the sizes of the jagged vector.
     const std::vector<std::size_t> sizes = get_sizes(input);
     const header_size_type size = static_cast<header_size_type>(sizes.size());
@@ -53,13 +78,14 @@ container_h2d_copy_alg<CONTAINER_TYPES>::operator()(
     vecmem::memory_resource* host_mr =
         (m_mr.host != nullptr) ? m_mr.host : &(m_mr.main);
 
-    // Create/set the host buffer.
+    // Create/set the host buffer. The items of a jagged vector buffer are
+    // allocated in a single contiguous block.
     hostBuffer =
         typename CONTAINER_TYPES::buffer{{size, *host_mr}, {sizes, *host_mr}};
     m_hostCopy.setup(hostBuffer.headers);
     m_hostCopy.setup(hostBuffer.items);
 
-    // Copy the data into the host buffer.
+    // Gather the data into the host buffer.
     m_hostCopy(input.headers, hostBuffer.headers);
     m_hostCopy(input.items, hostBuffer.items);
 
@@ -68,11 +94,12 @@ container_h2d_copy_alg<CONTAINER_TYPES>::operator()(
     m_deviceCopy.setup(result.headers);
     m_deviceCopy.setup(result.items);
 
-    // Copy data from the host buffer into the device/result buffer.
-    m_deviceCopy(hostBuffer.headers, result.headers,
-                 vecmem::copy::type::host_to_device);
-    m_deviceCopy(hostBuffer.items, result.items,
-                 vecmem::copy::type::host_to_device);
+    // Copy data from the host buffer into the device/result buffer. Since both
+    // buffers are contiguous, these are single copy operations.
+    header_event = m_deviceCopy(hostBuffer.headers, result.headers,
+                                vecmem::copy::type::host_to_device);
+    item_event = m_deviceCopy(hostBuffer.items, result.items,
+                              vecmem::copy::type::host_to_device);
 
     // Return the created buffer.
     return result;
@@ -95,4 +122,24 @@ std::vector<std::size_t> container_h2d_copy_alg<CONTAINER_TYPES>::get_sizes(
     return sizes;
 }
 
+template <typename CONTAINER_TYPES>
+bool container_h2d_copy_alg<CONTAINER_TYPES>::items_contiguous(
+    input_type input) const {
+
+    // The inner vectors are contiguous if each of them starts where the
+    // previous one ends. (Empty vectors can be anywhere.)
+    const auto* views = input.items.host_ptr();
+    const void* end = nullptr;
+    for (std::size_t i = 0; i < input.items.size(); ++i) {
+        if (views[i].capacity() == 0) {
+            continue;
+        }
+        if ((end != nullptr) && (views[i].ptr() != end)) {
+            return false;
+        }
+        end = views[i].ptr() + views[i].capacity();
+    }
+    return true;
+}
+
 }  // namespace traccc::device
@@ -1,6 +1,6 @@
 /** TRACCC library, part of the ACTS project (R&D line)
  *
- * (c) 2023 CERN for the benefit of the ACTS project
+ * (c) 2023-2024 CERN for the benefit of the ACTS project
  *
  * Mozilla Public License Version 2.0
  */
@@ -10,14 +10,13 @@
 // Project include(s).
 #include "traccc/edm/container.hpp"
 #include "traccc/edm/device/doublet_counter.hpp"
-#include "traccc/seeding/detail/singlet.hpp"
 
 namespace traccc::device {
 
 /// Doublet of middle-bottom or middle-top spacepoints
 struct device_doublet {
-    /// bottom (or top) spacepoint location in internal spacepoint container
-    sp_location sp2;
+    /// Index of the bottom (or top) spacepoint in the (flat) spacepoint grid
+    unsigned int sp2;
 
     using link_type = device::doublet_counter_collection_types::host::size_type;
     /// Link to doublet counter where the middle spacepoint is stored
@@ -1,6 +1,6 @@
 /** TRACCC library, part of the ACTS project (R&D line)
  *
- * (c) 2023 CERN for the benefit of the ACTS project
+ * (c) 2023-2024 CERN for the benefit of the ACTS project
  *
  * Mozilla Public License Version 2.0
  */
@@ -15,9 +15,13 @@
 namespace traccc::device {
 
 /// Triplets of bottom, middle and top spacepoints
+///
+/// Only the top spacepoint is stored explicitly. The bottom and middle ones
+/// are the ones of the middle-bottom doublet that the triplet links to.
+///
 struct device_triplet {
-    // top spacepoint location in internal spacepoint container
-    sp_location spT;
+    /// Index of the top spacepoint in the (flat) spacepoint grid
+    unsigned int spT;
 
     using link_type = device::triplet_counter_collection_types::host::size_type;
     /// Link to triplet counter where the middle and bottom spacepoints are
@@ -1,6 +1,6 @@
 /** TRACCC library, part of the ACTS project (R&D line)
  *
- * (c) 2021-2023 CERN for the benefit of the ACTS project
+ * (c) 2021-2024 CERN for the benefit of the ACTS project
  *
  * Mozilla Public License Version 2.0
  */
@@ -9,21 +9,31 @@
 
 // Project include(s).
 #include "traccc/edm/container.hpp"
-#include "traccc/seeding/detail/singlet.hpp"
+
+// System include(s).
+#include <cstdint>
+#include <limits>
 
 namespace traccc::device {
 
 /// Number of doublets for one specific middle spacepoint.
 struct doublet_counter {
 
-    /// Index of the middle spacepoint.
-    sp_location m_spM;
+    /// The type used for the number of doublets
+    using count_type = std::uint16_t;
+    /// The largest number of doublets of one type that can be recorded for a
+    /// single middle spacepoint
+    static constexpr unsigned int max_count =
+        std::numeric_limits<count_type>::max();
+
+    /// Index of the middle spacepoint in the (flat) spacepoint grid
+    unsigned int m_spM = 0;
 
     /// The number of compatible middle-bottom doublets
-    unsigned int m_nMidBot = 0;
+    count_type m_nMidBot = 0;
 
     /// The number of compatible middle-top doublets
-    unsigned int m_nMidTop = 0;
+    count_type m_nMidTop = 0;
 
     /// The position in which these middle-bottom doublets will be added
     unsigned int m_posMidBot = 0;
@@ -1,6 +1,6 @@
 /** TRACCC library, part of the ACTS project (R&D line)
  *
- * (c) 2021-2023 CERN for the benefit of the ACTS project
+ * (c) 2021-2024 CERN for the benefit of the ACTS project
  *
  * Mozilla Public License Version 2.0
  */
@@ -9,15 +9,17 @@
 
 // Project include(s).
 #include "traccc/edm/container.hpp"
-#include "traccc/seeding/detail/singlet.hpp"
+
+// System include(s).
+#include <limits>
 
 namespace traccc::device {
 
 /// Number of triplets for one specific middle spacepoint.
 struct triplet_counter_spM {
 
-    /// Middle spacepoint location in internal spacepoint container
-    sp_location spM;
+    /// Index of the middle spacepoint in the (flat) spacepoint grid
+    unsigned int spM = 0;
 
     /// The number of triplets for this middle spacepoint
     unsigned int m_nTriplets = 0;
@@ -34,8 +36,8 @@ using triplet_counter_spM_collection_types =
 /// Number of triplets for one specific Mid-Bottom Doublet.
 struct triplet_counter {
 
-    /// Bottom spacepoint location in internal spacepoint container
-    sp_location spB;
+    /// Index of the bottom spacepoint in the (flat) spacepoint grid
+    unsigned int spB = 0;
 
     using link_type = triplet_counter_spM_collection_types::host::size_type;
     /// Link to the triplet counter per middle spacepoint
@@ -52,4 +54,9 @@ struct triplet_counter {
 /// Declare all triplet counter collection types
 using triplet_counter_collection_types = collection_types<triplet_counter>;
 
+/// Link of the midBottom doublets without a triplet counter (i.e. without
+/// any triplets)
+constexpr unsigned int triplet_counter_invalid_link =
+    std::numeric_limits<unsigned int>::max();
+
 }  // namespace traccc::device
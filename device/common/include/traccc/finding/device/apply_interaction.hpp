@@ -9,6 +9,7 @@
 
 // Project include(s).
 #include "traccc/definitions/qualifiers.hpp"
+#include "traccc/finding/measurement_range.hpp"
 
 namespace traccc::device {
 
@@ -30,6 +31,37 @@ TRACCC_DEVICE inline void apply_interaction(
     const int n_params,
     bound_track_parameters_collection_types::view params_view);
 
+/// Function applying the Pre material interaction to tracks spawned by bound
+/// track parameters, and evaluating the number of measurements to be iterated
+/// per parameter in the same pass
+///
+/// The parameters are read once, updated in registers, and written back
+/// once. This is equivalent to calling @c traccc::device::apply_interaction
+/// and then @c traccc::device::count_measurements (with a measurement range
+/// table) on the same parameters.
+///
+/// @param[in] globalIndex           The index of the current thread
+/// @param[in] det_data              Detector view object
+/// @param[in] n_params              The number of parameters (or tracks)
+/// @param[inout] params_view        Collection of bound track_parameters
+/// @param[in] ranges_view           Measurement ranges, indexed by surface
+/// @param[out] n_measurements_view  The number of measurements per parameter
+/// @param[out] ref_meas_idx         The first index of measurements per
+/// parameter
+/// @param[out] n_measurements_sum   The sum of the number of measurements per
+/// parameter
+/// @tparam param_t The (storage) type of the parameters
+///
+template <typename detector_t, typename param_t = bound_track_parameters>
+TRACCC_DEVICE inline void apply_interaction_and_count_measurements(
+    std::size_t globalIndex, typename detector_t::view_type det_data,
+    const unsigned int n_params,
+    typename collection_types<param_t>::view params_view,
+    measurement_range_collection_types::const_view ranges_view,
+    vecmem::data::vector_view<unsigned int> n_measurements_view,
+    vecmem::data::vector_view<unsigned int> ref_meas_idx_view,
+    unsigned int& n_measurements_sum);
+
 }  // namespace traccc::device
 
 // Include the implementation.
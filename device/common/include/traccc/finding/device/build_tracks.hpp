@@ -1,6 +1,6 @@
 /** TRACCC library, part of the ACTS project (R&D line)
  *
- * (c) 2023 CERN for the benefit of the ACTS project
+ * (c) 2023-2024 CERN for the benefit of the ACTS project
  *
  * Mozilla Public License Version 2.0
  */
@@ -9,6 +9,7 @@
 
 // Project include(s).
 #include "traccc/definitions/qualifiers.hpp"
+#include "traccc/edm/track_candidate_soa.hpp"
 
 namespace traccc::device {
 
@@ -35,6 +36,28 @@ TRACCC_DEVICE inline void build_tracks(
         tips_view,
     track_candidate_container_types::view track_candidates_view);
 
+/// Function for building full tracks from the link container, in the flat
+/// track candidate layout
+///
+/// The offsets of the tracks' candidates must already be filled, with
+/// <tt>tip.first + 1</tt> candidates for every tip.
+///
+/// @param[in] globalIndex         The index of the current thread
+/// @param[in] seeds_view          Seed container view
+/// @param[in] link_view           Link container view
+/// @param[in] param_to_link_view  Container for param index -> link index
+/// @param[in] tips_view           Tip link container view
+/// @param[out] track_candidates_view  Flat track candidate container view
+///
+TRACCC_DEVICE inline void build_flat_tracks(
+    std::size_t globalIndex,
+    bound_track_parameters_collection_types::const_view seeds_view,
+    vecmem::data::jagged_vector_view<const candidate_link> links_view,
+    vecmem::data::jagged_vector_view<const unsigned int> param_to_link_view,
+    vecmem::data::vector_view<const typename candidate_link::link_index_type>
+        tips_view,
+    track_candidate_soa_collection_types::view track_candidates_view);
+
 }  // namespace traccc::device
 
 // Include the implementation.
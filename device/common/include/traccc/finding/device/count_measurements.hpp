@@ -1,6 +1,6 @@
 /** TRACCC library, part of the ACTS project (R&D line)
  *
- * (c) 2023 CERN for the benefit of the ACTS project
+ * (c) 2023-2024 CERN for the benefit of the ACTS project
  *
  * Mozilla Public License Version 2.0
  */
@@ -9,6 +9,7 @@
 
 // Project include(s).
 #include "traccc/definitions/qualifiers.hpp"
+#include "traccc/finding/measurement_range.hpp"
 
 namespace traccc::device {
 
@@ -36,6 +37,27 @@ TRACCC_DEVICE inline void count_measurements(
     vecmem::data::vector_view<unsigned int> ref_meas_idx_view,
     unsigned int& n_measurements_sum);
 
+/// Function evalulating the number of measurements to be iterated per thread
+/// and the total number of measurements, using a measurement range table
+///
+/// @param[in] globalIndex           The index of the current thread
+/// @param[in] params_view           Input parameters view object
+/// @param[in] ranges_view           Measurement ranges, indexed by surface
+/// @param[out] n_measurements_view  The number of measurements per parameter
+/// @param[out] ref_meas_idx         The first index of measurements per
+/// parameter
+/// @param[out] n_measurements_sum   The sum of the number of measurements per
+/// parameter
+///
+TRACCC_DEVICE inline void count_measurements(
+    std::size_t globalIndex,
+    bound_track_parameters_collection_types::const_view params_view,
+    measurement_range_collection_types::const_view ranges_view,
+    const unsigned int n_in_params,
+    vecmem::data::vector_view<unsigned int> n_measurements_view,
+    vecmem::data::vector_view<unsigned int> ref_meas_idx_view,
+    unsigned int& n_measurements_sum);
+
 }  // namespace traccc::device
 
 // Include the implementation.
@@ -0,0 +1,36 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s).
+#include "traccc/definitions/qualifiers.hpp"
+#include "traccc/edm/measurement.hpp"
+#include "traccc/finding/measurement_range.hpp"
+
+namespace traccc::device {
+
+/// Function filling the measurement range table of surface-sorted measurements
+///
+/// Every thread handles one measurement, setting the beginning (end) of its
+/// surface's range if it is the first (last) measurement on the surface. The
+/// table needs to be zero-initialised beforehand, so that surfaces without
+/// measurements end up with empty ranges.
+///
+/// @param[in] globalIndex        The index of the current thread
+/// @param[in] measurements_view  Measurements, sorted by surface
+/// @param[out] ranges_view       The measurement ranges, indexed by surface
+///
+TRACCC_DEVICE inline void fill_measurement_ranges(
+    std::size_t globalIndex,
+    measurement_collection_types::const_view measurements_view,
+    measurement_range_collection_types::view ranges_view);
+
+}  // namespace traccc::device
+
+// Include the implementation.
+#include "traccc/finding/device/impl/fill_measurement_ranges.ipp"
@@ -1,6 +1,6 @@
 /** TRACCC library, part of the ACTS project (R&D line)
  *
- * (c) 2023 CERN for the benefit of the ACTS project
+ * (c) 2023-2024 CERN for the benefit of the ACTS project
  *
  * Mozilla Public License Version 2.0
  */
@@ -12,6 +12,7 @@
 #include "traccc/definitions/qualifiers.hpp"
 #include "traccc/edm/measurement.hpp"
 #include "traccc/edm/track_parameters.hpp"
+#include "traccc/finding/chi2_prescreen.hpp"
 
 namespace traccc::device {
 
@@ -34,18 +35,62 @@ namespace traccc::device {
 /// @param[out] out_params_view   Output parameters
 /// @param[out] links_view        link container for the current step
 /// @param[out] n_candidates      The number of candidates for the current step
+/// @tparam param_t The (storage) type of the parameters
 ///
-template <typename detector_t, typename config_t>
+template <typename detector_t, typename config_t,
+          typename param_t = bound_track_parameters>
 TRACCC_DEVICE inline void find_tracks(
     std::size_t globalIndex, const config_t cfg,
     typename detector_t::view_type det_data,
     measurement_collection_types::const_view measurements_view,
-    bound_track_parameters_collection_types::const_view in_params_view,
+    typename collection_types<param_t>::const_view in_params_view,
     vecmem::data::vector_view<const unsigned int>
         n_measurements_prefix_sum_view,
     vecmem::data::vector_view<const unsigned int> ref_meas_idx_view,
     const unsigned int step, const unsigned int& n_max_candidates,
-    bound_track_parameters_collection_types::view out_params_view,
+    typename collection_types<param_t>::view out_params_view,
+    vecmem::data::vector_view<candidate_link> links_view,
+    unsigned int& n_candidates);
+
+/// The maximum number of branches per parameter that
+/// @c traccc::device::find_best_tracks can make
+constexpr unsigned int max_best_branches = 16u;
+
+/// Function for combinatorial finding, keeping only the measurements with
+/// the lowest chi-squares.
+/// Every thread handles one parameter, and adds (at most)
+/// @c max_num_branches_per_surface links for its compatible measurements with
+/// the lowest chi-squares. Measurements are pre-screened with
+/// @c traccc::chi2_lower_bound, to avoid Kalman updates for measurements that
+/// could not be kept.
+///
+/// @param[in] globalIndex        The index of the current thread
+/// @param[in] cfg                Track finding config object
+/// @param[in] det_data           Detector view object
+/// @param[in] measurements_view  Measurements container view
+/// @param[in] in_params_view     Input parameters
+/// @param[in] n_measurements_view The number of measurements per parameter
+/// @param[in] ref_meas_idx_view  The first index of measurements per parameter
+/// @param[in] step               Step index
+/// @param[in] n_in_params        The number of input parameters
+/// @param[in] n_max_candidates   Number of maximum candidates
+/// @param[out] out_params_view   Output parameters
+/// @param[out] links_view        link container for the current step
+/// @param[out] n_candidates      The number of candidates for the current step
+/// @tparam param_t The (storage) type of the parameters
+///
+template <typename detector_t, typename config_t,
+          typename param_t = bound_track_parameters>
+TRACCC_DEVICE inline void find_best_tracks(
+    std::size_t globalIndex, const config_t cfg,
+    typename detector_t::view_type det_data,
+    measurement_collection_types::const_view measurements_view,
+    typename collection_types<param_t>::const_view in_params_view,
+    vecmem::data::vector_view<const unsigned int> n_measurements_view,
+    vecmem::data::vector_view<const unsigned int> ref_meas_idx_view,
+    const unsigned int step, const unsigned int n_in_params,
+    const unsigned int n_max_candidates,
+    typename collection_types<param_t>::view out_params_view,
     vecmem::data::vector_view<candidate_link> links_view,
     unsigned int& n_candidates);
 
@@ -15,6 +15,52 @@
 
 namespace traccc::device {
 
+namespace details {
+
+/// Apply the Pre material interaction to one parameter, on its surface
+template <typename detector_t>
+TRACCC_DEVICE inline void apply_interaction(const detector_t& det,
+                                            bound_track_parameters& param) {
+
+    // Type definitions
+    using transform3_type = typename detector_t::transform3;
+    using intersection_type =
+        detray::intersection2D<typename detector_t::surface_type,
+                               transform3_type>;
+    using interactor_type =
+        detray::pointwise_material_interactor<transform3_type>;
+
+    // Get intersection at surface
+    const detray::surface<detector_t> sf{det, param.surface_link()};
+
+    // Surfaces without material leave the parameter unchanged. Tell them
+    // apart with the material link of the surface descriptor alone, before
+    // intersecting the surface and visiting its material.
+    if (!sf.has_material()) {
+        return;
+    }
+
+    using cxt_t = typename detector_t::geometry_context;
+    const cxt_t ctx{};
+    const auto free_vec = sf.bound_to_free_vector(ctx, param.vector());
+
+    intersection_type sfi;
+    sfi.sf_desc = det.surface(param.surface_link());
+    sf.template visit_mask<
+        detray::intersection_update<detray::ray_intersector>>(
+        detray::detail::ray<transform3_type>(free_vec), sfi,
+        det.transform_store());
+
+    // Apply interactor
+    typename interactor_type::state interactor_state;
+    interactor_type{}.update(
+        param, interactor_state,
+        static_cast<int>(detray::navigation::direction::e_forward), sf,
+        sfi.cos_incidence_angle);
+}
+
+}  // namespace details
+
 template <typename detector_t>
 TRACCC_DEVICE inline void apply_interaction(
     std::size_t globalIndex, typename detector_t::view_type det_data,
@@ -25,12 +71,9 @@ TRACCC_DEVICE inline void apply_interaction(
     bound_track_parameters_collection_types::view params_view) {
 
     // Type definitions
-    using transform3_type = typename detector_t::transform3;
     using intersection_type =
         detray::intersection2D<typename detector_t::surface_type,
-                               transform3_type>;
-    using interactor_type =
-        detray::pointwise_material_interactor<transform3_type>;
+                               typename detector_t::transform3>;
 
     // Detector
     detector_t det(det_data);
@@ -46,28 +89,48 @@ TRACCC_DEVICE inline void apply_interaction(
         return;
     }
 
-    auto& bound_param = params.at(globalIndex);
+    details::apply_interaction(det, params.at(globalIndex));
+}
 
-    // Get intersection at surface
-    const detray::surface<detector_t> sf{det, bound_param.surface_link()};
-    using cxt_t = typename detector_t::geometry_context;
-    const cxt_t ctx{};
-    const auto free_vec = sf.bound_to_free_vector(ctx, bound_param.vector());
+template <typename detector_t, typename param_t>
+TRACCC_DEVICE inline void apply_interaction_and_count_measurements(
+    std::size_t globalIndex, typename detector_t::view_type det_data,
+    const unsigned int n_params,
+    typename collection_types<param_t>::view params_view,
+    measurement_range_collection_types::const_view ranges_view,
+    vecmem::data::vector_view<unsigned int> n_measurements_view,
+    vecmem::data::vector_view<unsigned int> ref_meas_idx_view,
+    unsigned int& n_measurements_sum) {
 
-    const auto& mask_store = det.mask_store();
-    intersection_type sfi;
-    sfi.sf_desc = det.surface(bound_param.surface_link());
-    sf.template visit_mask<
-        detray::intersection_update<detray::ray_intersector>>(
-        detray::detail::ray<transform3_type>(free_vec), sfi,
-        det.transform_store());
+    if (globalIndex >= n_params) {
+        return;
+    }
 
-    // Apply interactor
-    typename interactor_type::state interactor_state;
-    interactor_type{}.update(
-        bound_param, interactor_state,
-        static_cast<int>(detray::navigation::direction::e_forward), sf,
-        sfi.cos_incidence_angle);
+    // Detector
+    detector_t det(det_data);
+
+    typename collection_types<param_t>::device params(params_view);
+    measurement_range_collection_types::const_device ranges(ranges_view);
+    vecmem::device_vector<unsigned int> n_measurements(n_measurements_view);
+    vecmem::device_vector<unsigned int> ref_meas_idx(ref_meas_idx_view);
+
+    // Update a copy of the parameter, and write it back once
+    bound_track_parameters bound_param = params.at(globalIndex);
+    details::apply_interaction(det, bound_param);
+    params.at(globalIndex) = bound_param;
+
+    // Look up the measurement range of the parameter's surface
+    const measurement_range range =
+        find_measurement_range(ranges, bound_param.surface_link().index());
+
+    // Get the reference measurement index and the number of measurements per
+    // parameter
+    ref_meas_idx.at(globalIndex) = range.begin;
+    n_measurements.at(globalIndex) = range.size();
+
+    // Increase the total number of measurements with atomic addition
+    vecmem::device_atomic_ref<unsigned int> n_meas_sum(n_measurements_sum);
+    n_meas_sum.fetch_add(range.size());
 }
 
 }  // namespace traccc::device
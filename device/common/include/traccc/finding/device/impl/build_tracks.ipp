@@ -1,6 +1,6 @@
 /** TRACCC library, part of the ACTS project (R&D line)
  *
- * (c) 2023 CERN for the benefit of the ACTS project
+ * (c) 2023-2024 CERN for the benefit of the ACTS project
  *
  * Mozilla Public License Version 2.0
  */
@@ -68,4 +68,54 @@ TRACCC_DEVICE inline void build_tracks(
     }
 }
 
+TRACCC_DEVICE inline void build_flat_tracks(
+    std::size_t globalIndex,
+    bound_track_parameters_collection_types::const_view seeds_view,
+    vecmem::data::jagged_vector_view<const candidate_link> links_view,
+    vecmem::data::jagged_vector_view<const unsigned int> param_to_link_view,
+    vecmem::data::vector_view<const typename candidate_link::link_index_type>
+        tips_view,
+    track_candidate_soa_collection_types::view track_candidates_view) {
+
+    bound_track_parameters_collection_types::const_device seeds(seeds_view);
+
+    vecmem::jagged_device_vector<const candidate_link> links(links_view);
+
+    vecmem::jagged_device_vector<const unsigned int> param_to_link(
+        param_to_link_view);
+
+    vecmem::device_vector<const typename candidate_link::link_index_type> tips(
+        tips_view);
+
+    track_candidate_soa_collection_types::device track_candidates(
+        track_candidates_view);
+
+    if (globalIndex >= tips.size()) {
+        return;
+    }
+
+    const auto tip = tips.at(globalIndex);
+    const unsigned int begin = track_candidates.offsets.at(globalIndex);
+
+    // Get the link corresponding to tip
+    auto L = links[tip.first][tip.second];
+
+    // Reversely iterate to fill the measurement indices
+    for (unsigned int i = tip.first + 1; i > 0; --i) {
+
+        track_candidates.measurement_indices.at(begin + i - 1) = L.meas_idx;
+
+        // Fill the seed at the first candidate
+        if (i == 1) {
+            track_candidates.seeds.at(globalIndex) =
+                seeds.at(L.previous.second);
+            break;
+        }
+
+        const auto l_pos = param_to_link[L.previous.first][L.previous.second];
+
+        L = links[L.previous.first][l_pos];
+    }
+}
+
 }  // namespace traccc::device
\ No newline at end of file
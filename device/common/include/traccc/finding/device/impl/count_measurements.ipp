@@ -1,6 +1,6 @@
 /** TRACCC library, part of the ACTS project (R&D line)
  *
- * (c) 2023 CERN for the benefit of the ACTS project
+ * (c) 2023-2024 CERN for the benefit of the ACTS project
  *
  * Mozilla Public License Version 2.0
  */
@@ -48,4 +48,36 @@ TRACCC_DEVICE inline void count_measurements(
     n_meas_sum.fetch_add(n_measurements.at(globalIndex));
 }
 
+TRACCC_DEVICE inline void count_measurements(
+    std::size_t globalIndex,
+    bound_track_parameters_collection_types::const_view params_view,
+    measurement_range_collection_types::const_view ranges_view,
+    const unsigned int n_in_params,
+    vecmem::data::vector_view<unsigned int> n_measurements_view,
+    vecmem::data::vector_view<unsigned int> ref_meas_idx_view,
+    unsigned int& n_measurements_sum) {
+
+    bound_track_parameters_collection_types::const_device params(params_view);
+    measurement_range_collection_types::const_device ranges(ranges_view);
+    vecmem::device_vector<unsigned int> n_measurements(n_measurements_view);
+    vecmem::device_vector<unsigned int> ref_meas_idx(ref_meas_idx_view);
+
+    if (globalIndex >= n_in_params) {
+        return;
+    }
+
+    // Look up the measurement range of the parameter's surface
+    const measurement_range range = find_measurement_range(
+        ranges, params.at(globalIndex).surface_link().index());
+
+    // Get the reference measurement index and the number of measurements per
+    // parameter
+    ref_meas_idx.at(globalIndex) = range.begin;
+    n_measurements.at(globalIndex) = range.size();
+
+    // Increase the total number of measurements with atomic addition
+    vecmem::device_atomic_ref<unsigned int> n_meas_sum(n_measurements_sum);
+    n_meas_sum.fetch_add(range.size());
+}
+
 }  // namespace traccc::device
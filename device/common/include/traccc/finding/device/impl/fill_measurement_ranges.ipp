@@ -0,0 +1,42 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+namespace traccc::device {
+
+TRACCC_DEVICE inline void fill_measurement_ranges(
+    std::size_t globalIndex,
+    measurement_collection_types::const_view measurements_view,
+    measurement_range_collection_types::view ranges_view) {
+
+    measurement_collection_types::const_device measurements(
+        measurements_view);
+    measurement_range_collection_types::device ranges(ranges_view);
+
+    if (globalIndex >= measurements.size()) {
+        return;
+    }
+
+    const unsigned int meas_idx = static_cast<unsigned int>(globalIndex);
+    const detray::geometry::barcode bcd =
+        measurements.at(meas_idx).surface_link;
+    measurement_range& range = ranges.at(bcd.index());
+
+    // Set the boundaries of the surface's range, if this measurement is on
+    // one of them.
+    if ((meas_idx == 0u) ||
+        !(measurements.at(meas_idx - 1u).surface_link == bcd)) {
+        range.begin = meas_idx;
+    }
+    if ((meas_idx + 1u == measurements.size()) ||
+        !(measurements.at(meas_idx + 1u).surface_link == bcd)) {
+        range.end = meas_idx + 1u;
+    }
+}
+
+}  // namespace traccc::device
@@ -1,6 +1,6 @@
 /** TRACCC library, part of the ACTS project (R&D line)
  *
- * (c) 2023 CERN for the benefit of the ACTS project
+ * (c) 2023-2024 CERN for the benefit of the ACTS project
  *
  * Mozilla Public License Version 2.0
  */
@@ -15,17 +15,17 @@
 
 namespace traccc::device {
 
-template <typename detector_t, typename config_t>
+template <typename detector_t, typename config_t, typename param_t>
 TRACCC_DEVICE inline void find_tracks(
     std::size_t globalIndex, const config_t cfg,
     typename detector_t::view_type det_data,
     measurement_collection_types::const_view measurements_view,
-    bound_track_parameters_collection_types::const_view in_params_view,
+    typename collection_types<param_t>::const_view in_params_view,
     vecmem::data::vector_view<const unsigned int>
         n_measurements_prefix_sum_view,
     vecmem::data::vector_view<const unsigned int> ref_meas_idx_view,
     const unsigned int step, const unsigned int& n_max_candidates,
-    bound_track_parameters_collection_types::view out_params_view,
+    typename collection_types<param_t>::view out_params_view,
     vecmem::data::vector_view<candidate_link> links_view,
     unsigned int& n_candidates) {
 
@@ -36,11 +36,11 @@ TRACCC_DEVICE inline void find_tracks(
     measurement_collection_types::const_device measurements(measurements_view);
 
     // Input parameters
-    bound_track_parameters_collection_types::const_device in_params(
+    typename collection_types<param_t>::const_device in_params(
         in_params_view);
 
     // Output parameters
-    bound_track_parameters_collection_types::device out_params(out_params_view);
+    typename collection_types<param_t>::device out_params(out_params_view);
 
     // Links
     vecmem::device_vector<candidate_link> links(links_view);
@@ -90,8 +90,9 @@ TRACCC_DEVICE inline void find_tracks(
 
         // Run the Kalman update
         sf.template visit_mask<
-            gain_matrix_updater<typename detector_t::transform3>>(trk_state,
-                                                                  in_par);
+            gain_matrix_updater<typename detector_t::transform3,
+                                typename config_t::precise_scalar_type>>(
+            trk_state, in_par);
         // Get the chi-square
         const auto chi2 = trk_state.filtered_chi2();
 
@@ -115,4 +116,120 @@ TRACCC_DEVICE inline void find_tracks(
     }
 }
 
-}  // namespace traccc::device
\ No newline at end of file
+template <typename detector_t, typename config_t, typename param_t>
+TRACCC_DEVICE inline void find_best_tracks(
+    std::size_t globalIndex, const config_t cfg,
+    typename detector_t::view_type det_data,
+    measurement_collection_types::const_view measurements_view,
+    typename collection_types<param_t>::const_view in_params_view,
+    vecmem::data::vector_view<const unsigned int> n_measurements_view,
+    vecmem::data::vector_view<const unsigned int> ref_meas_idx_view,
+    const unsigned int step, const unsigned int n_in_params,
+    const unsigned int n_max_candidates,
+    typename collection_types<param_t>::view out_params_view,
+    vecmem::data::vector_view<candidate_link> links_view,
+    unsigned int& n_candidates) {
+
+    if (globalIndex >= n_in_params) {
+        return;
+    }
+
+    const unsigned int k =
+        (cfg.max_num_branches_per_surface < max_best_branches)
+            ? cfg.max_num_branches_per_surface
+            : max_best_branches;
+    if (k == 0u) {
+        return;
+    }
+
+    // Detector
+    detector_t det(det_data);
+
+    // Measurements, parameters and their measurement ranges
+    measurement_collection_types::const_device measurements(measurements_view);
+    typename collection_types<param_t>::const_device in_params(
+        in_params_view);
+    vecmem::device_vector<const unsigned int> n_measurements(
+        n_measurements_view);
+    vecmem::device_vector<const unsigned int> ref_meas_idx(ref_meas_idx_view);
+
+    // Output parameters and links
+    typename collection_types<param_t>::device out_params(out_params_view);
+    vecmem::device_vector<candidate_link> links(links_view);
+
+    // Last step ID
+    const unsigned int previous_step =
+        (step == 0) ? std::numeric_limits<unsigned int>::max() : step - 1;
+
+    const unsigned int in_param_id = static_cast<unsigned int>(globalIndex);
+    const bound_track_parameters in_par = in_params.at(in_param_id);
+    const detray::surface<detector_t> sf{det, in_par.surface_link()};
+    const unsigned int meas_begin = ref_meas_idx.at(in_param_id);
+    const unsigned int meas_end = meas_begin + n_measurements.at(in_param_id);
+
+    // The best measurements found so far, in increasing chi-square order
+    scalar best_chi2[max_best_branches];
+    unsigned int best_meas_idx[max_best_branches];
+    unsigned int n_best = 0u;
+
+    for (unsigned int meas_idx = meas_begin; meas_idx < meas_end; ++meas_idx) {
+
+        const measurement& meas = measurements.at(meas_idx);
+
+        // Skip the measurement without a Kalman update, if it can not be
+        // better than the ones already kept
+        const scalar threshold =
+            (n_best == k) ? best_chi2[n_best - 1u] : cfg.chi2_max;
+        if (chi2_lower_bound(meas, in_par) >= threshold) {
+            continue;
+        }
+
+        // Run the Kalman update
+        track_state<typename detector_t::transform3> trk_state(meas);
+        bound_track_parameters par = in_par;
+        sf.template visit_mask<
+            gain_matrix_updater<typename detector_t::transform3,
+                                typename config_t::precise_scalar_type>>(
+            trk_state, par);
+        const scalar chi2 = trk_state.filtered_chi2();
+        if (chi2 >= threshold) {
+            continue;
+        }
+
+        // Insert the measurement after the ones with the same or a lower
+        // chi-square, dropping the worst one if there are too many.
+        unsigned int pos = (n_best == k) ? k - 1u : n_best++;
+        while ((pos > 0u) && (best_chi2[pos - 1u] > chi2)) {
+            best_chi2[pos] = best_chi2[pos - 1u];
+            best_meas_idx[pos] = best_meas_idx[pos - 1u];
+            --pos;
+        }
+        best_chi2[pos] = chi2;
+        best_meas_idx[pos] = meas_idx;
+    }
+
+    // Add the links of the best measurements. Repeating their Kalman
+    // updates, instead of keeping all updated parameters in memory.
+    vecmem::device_atomic_ref<unsigned int> num_candidates(n_candidates);
+    for (unsigned int i = 0u; i < n_best; ++i) {
+
+        const unsigned int l_pos = num_candidates.fetch_add(1);
+        if (l_pos >= n_max_candidates) {
+            n_candidates = n_max_candidates;
+            return;
+        }
+
+        track_state<typename detector_t::transform3> trk_state(
+            measurements.at(best_meas_idx[i]));
+        bound_track_parameters par = in_par;
+        sf.template visit_mask<
+            gain_matrix_updater<typename detector_t::transform3,
+                                typename config_t::precise_scalar_type>>(
+            trk_state, par);
+
+        links[l_pos] = {{previous_step, in_param_id}, best_meas_idx[i]};
+        out_params[l_pos] = trk_state.filtered();
+    }
+}
+
+}  // namespace traccc::device
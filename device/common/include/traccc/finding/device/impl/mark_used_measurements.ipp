@@ -0,0 +1,89 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s).
+#include "traccc/device/bitmask.hpp"
+
+// System include(s).
+#include <cstdint>
+
+namespace traccc::device {
+
+TRACCC_HOST_DEVICE
+inline unsigned int find_measurement(
+    const measurement_collection_types::const_device& measurements,
+    const measurement& meas) {
+
+    // Find the first measurement of the surface with a binary search.
+    const std::uint64_t key = measurement_sort_key{}(meas);
+    unsigned int low = 0u;
+    unsigned int high = measurements.size();
+    while (low < high) {
+        const unsigned int mid = low + (high - low) / 2u;
+        if (measurement_sort_key{}(measurements.at(mid)) < key) {
+            low = mid + 1u;
+        } else {
+            high = mid;
+        }
+    }
+
+    // Look for the measurement among the few measurements of the surface.
+    for (unsigned int i = low; i < measurements.size(); ++i) {
+        const measurement& other = measurements.at(i);
+        if (measurement_sort_key{}(other) != key) {
+            break;
+        }
+        if (other == meas) {
+            return i;
+        }
+    }
+    return measurements.size();
+}
+
+TRACCC_DEVICE inline void mark_used_measurements(
+    std::size_t globalIndex,
+    measurement_collection_types::const_view measurements_view,
+    track_candidate_container_types::const_view track_candidates_view,
+    vecmem::data::vector_view<unsigned int> used_view) {
+
+    const track_candidate_container_types::const_device track_candidates(
+        track_candidates_view);
+    if (globalIndex >= track_candidates.size()) {
+        return;
+    }
+
+    const measurement_collection_types::const_device measurements(
+        measurements_view);
+    vecmem::device_vector<unsigned int> used(used_view);
+
+    const auto track = track_candidates.at(globalIndex);
+    for (const track_candidate& cand : track.items) {
+        const unsigned int meas_idx = find_measurement(measurements, cand);
+        if (meas_idx < measurements.size()) {
+            bitmask_set(used, meas_idx);
+        }
+    }
+}
+
+TRACCC_DEVICE inline void mark_used_measurements(
+    std::size_t globalIndex,
+    track_candidate_soa_collection_types::const_view track_candidates_view,
+    vecmem::data::vector_view<unsigned int> used_view) {
+
+    const track_candidate_soa_collection_types::const_device track_candidates(
+        track_candidates_view);
+    if (globalIndex >= track_candidates.measurement_indices.size()) {
+        return;
+    }
+
+    vecmem::device_vector<unsigned int> used(used_view);
+    bitmask_set(used, track_candidates.measurement_indices.at(globalIndex));
+}
+
+}  // namespace traccc::device
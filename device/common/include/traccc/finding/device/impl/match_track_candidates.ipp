@@ -0,0 +1,71 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+namespace traccc::device {
+
+TRACCC_HOST_DEVICE
+inline void match_track_candidates(
+    const std::size_t globalIndex,
+    const track_candidate_container_types::const_view& track_candidates_view,
+    const measurement_particle_container_types::const_view& truth_view,
+    track_truth_match_collection_types::view matches_view) {
+
+    // Check if anything needs to be done.
+    const track_candidate_container_types::const_device track_candidates(
+        track_candidates_view);
+    if (globalIndex >= track_candidates.size()) {
+        return;
+    }
+
+    const measurement_particle_container_types::const_device truth(
+        truth_view);
+    const auto& truth_measurements = truth.get_headers();
+    const unsigned int n_truth_measurements = truth_measurements.size();
+
+    // Collect the particles contributing to the measurements of the track.
+    track_truth_match match;
+    bool unique = true;
+    const auto candidates = track_candidates.get_items().at(globalIndex);
+    for (const track_candidate& meas : candidates) {
+
+        // Look up the measurement with a binary search.
+        unsigned int first = 0u;
+        unsigned int count = n_truth_measurements;
+        while (count > 0u) {
+            const unsigned int step = count / 2u;
+            if (truth_measurements.at(first + step) < meas) {
+                first += step + 1u;
+                count -= step + 1u;
+            } else {
+                count = step;
+            }
+        }
+        if ((first == n_truth_measurements) ||
+            (meas < truth_measurements.at(first))) {
+            continue;
+        }
+
+        // Check that all particles are the same one.
+        for (const std::uint64_t pid : truth.get_items().at(first)) {
+            if (!match.is_matched()) {
+                match.particle_id = pid;
+            } else if (match.particle_id != pid) {
+                unique = false;
+            }
+        }
+        if (!unique) {
+            break;
+        }
+    }
+
+    track_truth_match_collection_types::device matches(matches_view);
+    matches.at(globalIndex) = (unique ? match : track_truth_match{});
+}
+
+}  // namespace traccc::device
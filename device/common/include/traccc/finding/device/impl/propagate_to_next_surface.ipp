@@ -9,21 +9,22 @@
 
 namespace traccc::device {
 
-template <typename propagator_t, typename bfield_t, typename config_t>
+template <typename propagator_t, typename bfield_t, typename config_t,
+          typename append_t, typename param_t>
 TRACCC_DEVICE inline void propagate_to_next_surface(
     std::size_t globalIndex, const config_t cfg,
     typename propagator_t::detector_type::view_type det_data,
     bfield_t field_data,
     vecmem::data::jagged_vector_view<typename propagator_t::intersection_type>
         nav_candidates_buffer,
-    bound_track_parameters_collection_types::const_view in_params_view,
+    typename collection_types<param_t>::const_view in_params_view,
     vecmem::data::vector_view<const candidate_link> links_view,
     const unsigned int step, const unsigned int& n_in_params,
-    bound_track_parameters_collection_types::view out_params_view,
+    typename collection_types<param_t>::view out_params_view,
     vecmem::data::vector_view<unsigned int> param_to_link_view,
     vecmem::data::vector_view<typename candidate_link::link_index_type>
         tips_view,
-    unsigned int& n_out_params) {
+    unsigned int& n_out_params, const append_t& append) {
 
     if (globalIndex >= n_in_params) {
         return;
@@ -37,14 +38,14 @@ TRACCC_DEVICE inline void propagate_to_next_surface(
         nav_candidates(nav_candidates_buffer);
 
     // Input parameters
-    bound_track_parameters_collection_types::const_device in_params(
+    typename collection_types<param_t>::const_device in_params(
         in_params_view);
 
     // Links
     vecmem::device_vector<const candidate_link> links(links_view);
 
     // Out parameters
-    bound_track_parameters_collection_types::device out_params(out_params_view);
+    typename collection_types<param_t>::device out_params(out_params_view);
 
     // Param to Link ID
     vecmem::device_vector<unsigned int> param_to_link(param_to_link_view);
@@ -59,9 +60,12 @@ TRACCC_DEVICE inline void propagate_to_next_surface(
     // Create propagator
     propagator_t propagator(cfg.propagation);
 
-    // Create propagator state
+    // Create propagator state, with the candidate vector of this thread. (The
+    // buffer may hold fewer vectors than the number of parameters, if they
+    // are processed in a grid-stride loop of the same size.)
     typename propagator_t::state propagation(
-        in_par, field_data, det, std::move(nav_candidates.at(globalIndex)));
+        in_par, field_data, det,
+        std::move(nav_candidates.at(globalIndex % nav_candidates.size())));
     propagation._stepping
         .template set_constraint<detray::step::constraint::e_accuracy>(
             cfg.propagation.stepping.step_constraint);
@@ -91,8 +95,7 @@ TRACCC_DEVICE inline void propagate_to_next_surface(
 
     // If a surface found, add the parameter for the next step
     if (s4.success) {
-        vecmem::device_atomic_ref<unsigned int> num_out_params(n_out_params);
-        const unsigned int out_param_id = num_out_params.fetch_add(1);
+        const unsigned int out_param_id = append(n_out_params);
 
         out_params[out_param_id] = propagation._stepping._bound_params;
 
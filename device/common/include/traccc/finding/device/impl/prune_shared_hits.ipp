@@ -0,0 +1,204 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s).
+#include "traccc/fitting/kalman_filter/gain_matrix_updater.hpp"
+#include "traccc/geometry/hashed_module_map.hpp"
+
+// VecMem include(s).
+#include <vecmem/containers/device_vector.hpp>
+#include <vecmem/memory/device_atomic_ref.hpp>
+
+// System include(s).
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+
+namespace traccc::device {
+namespace details {
+
+/// Get the key of a candidate in the shared hit hash table
+template <typename config_t>
+TRACCC_DEVICE inline std::uint64_t shared_hit_key(const config_t& cfg,
+                                                  const unsigned int meas_idx,
+                                                  const unsigned int seed_idx) {
+    const unsigned int group = (cfg.pruning_seed_group_size == 0u)
+                                   ? 0u
+                                   : (seed_idx / cfg.pruning_seed_group_size);
+    return (static_cast<std::uint64_t>(meas_idx) << 32) |
+           static_cast<std::uint64_t>(group);
+}
+
+}  // namespace details
+
+template <typename detector_t, typename config_t, typename param_t>
+TRACCC_DEVICE inline void insert_shared_hits(
+    const std::size_t globalIndex, const config_t& cfg,
+    typename detector_t::view_type det_data,
+    measurement_collection_types::const_view measurements_view,
+    typename collection_types<param_t>::const_view in_params_view,
+    vecmem::data::vector_view<const unsigned int> param_seeds_view,
+    vecmem::data::vector_view<const candidate_link> links_view,
+    const unsigned int n_candidates,
+    vecmem::data::vector_view<unsigned int> slots_view,
+    vecmem::data::vector_view<unsigned int> best_chi2_view,
+    vecmem::data::vector_view<unsigned int> cand_slots_view,
+    vecmem::data::vector_view<unsigned int> cand_chi2_view,
+    vecmem::data::vector_view<unsigned int> cand_seeds_view) {
+
+    if (globalIndex >= n_candidates) {
+        return;
+    }
+
+    // Detector
+    detector_t det(det_data);
+
+    // Input containers
+    measurement_collection_types::const_device measurements(measurements_view);
+    typename collection_types<param_t>::const_device in_params(
+        in_params_view);
+    vecmem::device_vector<const unsigned int> param_seeds(param_seeds_view);
+    vecmem::device_vector<const candidate_link> links(links_view);
+
+    // Output containers
+    vecmem::device_vector<unsigned int> slots(slots_view);
+    vecmem::device_vector<unsigned int> best_chi2(best_chi2_view);
+    vecmem::device_vector<unsigned int> cand_slots(cand_slots_view);
+    vecmem::device_vector<unsigned int> cand_chi2(cand_chi2_view);
+    vecmem::device_vector<unsigned int> cand_seeds(cand_seeds_view);
+
+    // The candidate handled by this thread, and its seed.
+    const unsigned int cand_idx = static_cast<unsigned int>(globalIndex);
+    const candidate_link& link = links.at(cand_idx);
+    const unsigned int seed_idx = param_seeds.at(link.previous.second);
+    cand_seeds.at(cand_idx) = seed_idx;
+
+    // Re-do the Kalman update of the candidate, to get its chi-square.
+    bound_track_parameters in_par = in_params.at(link.previous.second);
+    track_state<typename detector_t::transform3> trk_state(
+        measurements.at(link.meas_idx));
+    const detray::surface<detector_t> sf{det, in_par.surface_link()};
+    sf.template visit_mask<
+        gain_matrix_updater<typename detector_t::transform3,
+                            typename config_t::precise_scalar_type>>(trk_state,
+                                                                     in_par);
+    // The bits of non-negative floats order the same way as their values.
+    const float chi2 = static_cast<float>(trk_state.filtered_chi2());
+    const float clamped_chi2 = (chi2 > 0.f) ? chi2 : 0.f;
+    unsigned int chi2_bits = 0u;
+    memcpy(&chi2_bits, &clamped_chi2, sizeof(chi2_bits));
+    cand_chi2.at(cand_idx) = chi2_bits;
+
+    // Find the slot of the candidate's key, claiming an empty one if no
+    // other candidate with the same key claimed one yet.
+    const std::uint64_t key =
+        details::shared_hit_key(cfg, link.meas_idx, seed_idx);
+    const unsigned int mask = slots.size() - 1u;
+    unsigned int slot =
+        static_cast<unsigned int>(traccc::details::hash_module_key(key)) &
+        mask;
+    while (true) {
+        vecmem::device_atomic_ref<unsigned int> slot_ref(slots.at(slot));
+        unsigned int occupant = 0u;
+        if (slot_ref.compare_exchange_strong(occupant, cand_idx + 1u)) {
+            break;
+        }
+        const candidate_link& other = links.at(occupant - 1u);
+        if (details::shared_hit_key(cfg, other.meas_idx,
+                                    param_seeds.at(other.previous.second)) ==
+            key) {
+            break;
+        }
+        slot = (slot + 1u) & mask;
+    }
+    cand_slots.at(cand_idx) = slot;
+
+    // Keep track of the lowest chi-square of the slot.
+    vecmem::device_atomic_ref<unsigned int> best(best_chi2.at(slot));
+    unsigned int current = best.load();
+    while ((chi2_bits < current) &&
+           !best.compare_exchange_strong(current, chi2_bits)) {
+    }
+}
+
+TRACCC_DEVICE inline void elect_shared_hits(
+    const std::size_t globalIndex, const unsigned int n_candidates,
+    vecmem::data::vector_view<const unsigned int> best_chi2_view,
+    vecmem::data::vector_view<const unsigned int> cand_slots_view,
+    vecmem::data::vector_view<const unsigned int> cand_chi2_view,
+    vecmem::data::vector_view<unsigned int> winners_view) {
+
+    if (globalIndex >= n_candidates) {
+        return;
+    }
+
+    const vecmem::device_vector<const unsigned int> best_chi2(best_chi2_view);
+    const vecmem::device_vector<const unsigned int> cand_slots(
+        cand_slots_view);
+    const vecmem::device_vector<const unsigned int> cand_chi2(cand_chi2_view);
+    vecmem::device_vector<unsigned int> winners(winners_view);
+
+    // Candidates with the lowest chi-square of their slot compete for it,
+    // with the lowest index winning.
+    const unsigned int cand_idx = static_cast<unsigned int>(globalIndex);
+    const unsigned int slot = cand_slots.at(cand_idx);
+    if (cand_chi2.at(cand_idx) != best_chi2.at(slot)) {
+        return;
+    }
+    vecmem::device_atomic_ref<unsigned int> winner(winners.at(slot));
+    unsigned int current = winner.load();
+    while ((cand_idx < current) &&
+           !winner.compare_exchange_strong(current, cand_idx)) {
+    }
+}
+
+template <typename config_t, typename param_t>
+TRACCC_DEVICE inline void prune_shared_hits(
+    const std::size_t globalIndex, const config_t& cfg,
+    const unsigned int n_candidates,
+    typename collection_types<param_t>::const_view params_view,
+    vecmem::data::vector_view<const unsigned int> cand_slots_view,
+    vecmem::data::vector_view<const unsigned int> winners_view,
+    vecmem::data::vector_view<unsigned int> pruned_view) {
+
+    if (globalIndex >= n_candidates) {
+        return;
+    }
+
+    const typename collection_types<param_t>::const_device params(
+        params_view);
+    const vecmem::device_vector<const unsigned int> cand_slots(
+        cand_slots_view);
+    const vecmem::device_vector<const unsigned int> winners(winners_view);
+    vecmem::device_vector<unsigned int> pruned(pruned_view);
+
+    // The elected candidate of the slot is always kept.
+    const unsigned int cand_idx = static_cast<unsigned int>(globalIndex);
+    const unsigned int winner = winners.at(cand_slots.at(cand_idx));
+    if (winner == cand_idx) {
+        pruned.at(cand_idx) = 0u;
+        return;
+    }
+
+    // Prune the candidate if its parameters are similar to the elected one's.
+    const bound_track_parameters& par = params.at(cand_idx);
+    const bound_track_parameters& best = params.at(winner);
+    scalar delta_phi = std::abs(par.phi() - best.phi());
+    if (delta_phi > static_cast<scalar>(M_PI)) {
+        delta_phi = 2.f * static_cast<scalar>(M_PI) - delta_phi;
+    }
+    const bool similar =
+        (delta_phi <= cfg.pruning_max_delta_angle) &&
+        (std::abs(par.theta() - best.theta()) <= cfg.pruning_max_delta_angle) &&
+        (std::abs(par.qop() - best.qop()) <=
+         cfg.pruning_max_rel_delta_qop * std::abs(best.qop()));
+    pruned.at(cand_idx) = similar ? 1u : 0u;
+}
+
+}  // namespace traccc::device
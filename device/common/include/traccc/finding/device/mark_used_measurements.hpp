@@ -0,0 +1,65 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s).
+#include "traccc/definitions/qualifiers.hpp"
+#include "traccc/edm/measurement.hpp"
+#include "traccc/edm/track_candidate.hpp"
+#include "traccc/edm/track_candidate_soa.hpp"
+
+// VecMem include(s).
+#include <vecmem/containers/data/vector_view.hpp>
+#include <vecmem/containers/device_vector.hpp>
+
+// System include(s).
+#include <cstddef>
+
+namespace traccc::device {
+
+/// Find the index of a (copy of a) measurement in the sorted measurements
+///
+/// @param measurements The measurements, sorted by their surfaces
+/// @param meas The measurement to look for
+/// @return The index of @c meas in @c measurements, or the size of
+///         @c measurements if it is not found
+///
+TRACCC_HOST_DEVICE
+inline unsigned int find_measurement(
+    const measurement_collection_types::const_device& measurements,
+    const measurement& meas);
+
+/// Function marking the measurements used by the track candidates of one
+/// track
+///
+/// @param[in] globalIndex       The index of the current thread (track)
+/// @param[in] measurements_view The measurements, sorted by their surfaces
+/// @param[in] track_candidates_view The track candidates
+/// @param[out] used_view        The bitmask of the used measurements
+///
+TRACCC_DEVICE inline void mark_used_measurements(
+    std::size_t globalIndex,
+    measurement_collection_types::const_view measurements_view,
+    track_candidate_container_types::const_view track_candidates_view,
+    vecmem::data::vector_view<unsigned int> used_view);
+
+/// Function marking the measurement used by one flat track candidate
+///
+/// @param[in] globalIndex       The index of the current thread (candidate)
+/// @param[in] track_candidates_view The track candidates, in flat layout
+/// @param[out] used_view        The bitmask of the used measurements
+///
+TRACCC_DEVICE inline void mark_used_measurements(
+    std::size_t globalIndex,
+    track_candidate_soa_collection_types::const_view track_candidates_view,
+    vecmem::data::vector_view<unsigned int> used_view);
+
+}  // namespace traccc::device
+
+// Include the implementation.
+#include "traccc/finding/device/impl/mark_used_measurements.ipp"
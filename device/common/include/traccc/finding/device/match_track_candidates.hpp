@@ -0,0 +1,43 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s).
+#include "traccc/definitions/qualifiers.hpp"
+#include "traccc/edm/track_candidate.hpp"
+#include "traccc/edm/truth_match.hpp"
+
+// System include(s).
+#include <cstddef>
+
+namespace traccc::device {
+
+/// Function matching one track candidate to the truth particles
+///
+/// The track is matched to a particle if that particle is the only one
+/// contributing to its measurements, ignoring the measurements without any
+/// truth information. This is the same matching as the one of
+/// @c traccc::finding_performance_writer.
+///
+/// @param[in] globalIndex      The index of the current thread
+/// @param[in] track_candidates_view The track candidates of the event
+/// @param[in] truth_view       The particles contributing to the measurements
+///                             of the event
+/// @param[out] matches_view    The match of every track candidate
+///
+TRACCC_HOST_DEVICE
+inline void match_track_candidates(
+    std::size_t globalIndex,
+    const track_candidate_container_types::const_view& track_candidates_view,
+    const measurement_particle_container_types::const_view& truth_view,
+    track_truth_match_collection_types::view matches_view);
+
+}  // namespace traccc::device
+
+// Include the implementation.
+#include "traccc/finding/device/impl/match_track_candidates.ipp"
@@ -1,6 +1,6 @@
 /** TRACCC library, part of the ACTS project (R&D line)
  *
- * (c) 2023 CERN for the benefit of the ACTS project
+ * (c) 2023-2024 CERN for the benefit of the ACTS project
  *
  * Mozilla Public License Version 2.0
  */
@@ -10,6 +10,7 @@
 // Project include(s).
 #include "traccc/definitions/primitives.hpp"
 #include "traccc/definitions/qualifiers.hpp"
+#include "traccc/device/atomic_append.hpp"
 #include "traccc/edm/measurement.hpp"
 #include "traccc/edm/track_parameters.hpp"
 
@@ -25,7 +26,9 @@ namespace traccc::device {
 /// @param[in] globalIndex        The index of the current thread
 /// @param[in] cfg                Track finding config object
 /// @param[in] det_data           Detector view object
-/// @param[in] nav_candidates_buffer Navgation buffer
+/// @param[in] nav_candidates_buffer Navgation buffer, with one candidate
+///                               vector per parameter, or per thread of a
+///                               grid-stride loop of the same size
 /// @param[in] in_params_view     Input parameters
 /// @param[in] links_view         Link container for the current step
 /// @param[in] step               Step index
@@ -34,22 +37,26 @@ namespace traccc::device {
 /// @param[out] param_to_link_view  Container for param index -> link index
 /// @param[out] tips_view         Tip link container for the current step
 /// @param[out] n_out_params      The number of output parameters
+/// @param[in] append             Functor reserving the output parameters
+/// @tparam param_t The (storage) type of the parameters
 ///
-template <typename propagator_t, typename bfield_t, typename config_t>
+template <typename propagator_t, typename bfield_t, typename config_t,
+          typename append_t = atomic_append,
+          typename param_t = bound_track_parameters>
 TRACCC_DEVICE inline void propagate_to_next_surface(
     std::size_t globalIndex, const config_t cfg,
     typename propagator_t::detector_type::view_type det_data,
     bfield_t field_data,
     vecmem::data::jagged_vector_view<typename propagator_t::intersection_type>
         nav_candidates_buffer,
-    bound_track_parameters_collection_types::const_view in_params_view,
+    typename collection_types<param_t>::const_view in_params_view,
     vecmem::data::vector_view<const candidate_link> links_view,
     const unsigned int step, const unsigned int& n_in_params,
-    bound_track_parameters_collection_types::view out_params_view,
+    typename collection_types<param_t>::view out_params_view,
     vecmem::data::vector_view<unsigned int> param_to_link_view,
     vecmem::data::vector_view<typename candidate_link::link_index_type>
         tips_view,
-    unsigned int& n_out_params);
+    unsigned int& n_out_params, const append_t& append = {});
 
 }  // namespace traccc::device
 
@@ -0,0 +1,116 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s).
+#include "traccc/definitions/primitives.hpp"
+#include "traccc/definitions/qualifiers.hpp"
+#include "traccc/edm/measurement.hpp"
+#include "traccc/edm/track_parameters.hpp"
+#include "traccc/finding/candidate_link.hpp"
+
+// VecMem include(s).
+#include <vecmem/containers/data/vector_view.hpp>
+
+// System include(s).
+#include <cstddef>
+
+namespace traccc::device {
+
+/// @name Functions for pruning the branches of a track finding step that
+/// share their measurement with a better branch
+///
+/// The candidates of a step are grouped by their measurement and by the
+/// group of their seed, with an open addressing hash table. The slots of the
+/// table hold the index (plus one) of the first candidate that reached them,
+/// and are never more than half full.
+///
+/// The pruning runs in three passes:
+///  - @c insert_shared_hits assigns every candidate to its slot, and finds
+///    the lowest chi-square of every slot;
+///  - @c elect_shared_hits picks the candidate of every slot with the
+///    lowest chi-square;
+///  - @c prune_shared_hits flags the other candidates of every slot, that
+///    have parameters similar to the picked one.
+///
+/// @{
+
+/// Function inserting the candidates of a step into the hash table
+///
+/// @param[in] globalIndex        The index of the current thread
+/// @param[in] cfg                Track finding config object
+/// @param[in] det_data           Detector view object
+/// @param[in] measurements_view  Measurements container view
+/// @param[in] in_params_view     Input parameters of the step
+/// @param[in] param_seeds_view   Seed indices of the input parameters
+/// @param[in] links_view         Links of the candidates of the step
+/// @param[in] n_candidates       The number of candidates of the step
+/// @param[out] slots_view        The slots of the hash table
+/// @param[out] best_chi2_view    The lowest chi-square bits per slot
+/// @param[out] cand_slots_view   The slot of every candidate
+/// @param[out] cand_chi2_view    The chi-square bits of every candidate
+/// @param[out] cand_seeds_view   The seed index of every candidate
+/// @tparam param_t The (storage) type of the parameters
+///
+template <typename detector_t, typename config_t,
+          typename param_t = bound_track_parameters>
+TRACCC_DEVICE inline void insert_shared_hits(
+    std::size_t globalIndex, const config_t& cfg,
+    typename detector_t::view_type det_data,
+    measurement_collection_types::const_view measurements_view,
+    typename collection_types<param_t>::const_view in_params_view,
+    vecmem::data::vector_view<const unsigned int> param_seeds_view,
+    vecmem::data::vector_view<const candidate_link> links_view,
+    unsigned int n_candidates,
+    vecmem::data::vector_view<unsigned int> slots_view,
+    vecmem::data::vector_view<unsigned int> best_chi2_view,
+    vecmem::data::vector_view<unsigned int> cand_slots_view,
+    vecmem::data::vector_view<unsigned int> cand_chi2_view,
+    vecmem::data::vector_view<unsigned int> cand_seeds_view);
+
+/// Function electing the candidate with the lowest chi-square of every slot
+///
+/// @param[in] globalIndex        The index of the current thread
+/// @param[in] n_candidates       The number of candidates of the step
+/// @param[in] best_chi2_view     The lowest chi-square bits per slot
+/// @param[in] cand_slots_view    The slot of every candidate
+/// @param[in] cand_chi2_view     The chi-square bits of every candidate
+/// @param[out] winners_view      The elected candidate of every slot
+///
+TRACCC_DEVICE inline void elect_shared_hits(
+    std::size_t globalIndex, unsigned int n_candidates,
+    vecmem::data::vector_view<const unsigned int> best_chi2_view,
+    vecmem::data::vector_view<const unsigned int> cand_slots_view,
+    vecmem::data::vector_view<const unsigned int> cand_chi2_view,
+    vecmem::data::vector_view<unsigned int> winners_view);
+
+/// Function flagging the candidates similar to the elected one of their slot
+///
+/// @param[in] globalIndex        The index of the current thread
+/// @param[in] cfg                Track finding config object
+/// @param[in] n_candidates       The number of candidates of the step
+/// @param[in] params_view        The (updated) parameters of the candidates
+/// @param[in] cand_slots_view    The slot of every candidate
+/// @param[in] winners_view       The elected candidate of every slot
+/// @param[out] pruned_view       Flags of the pruned candidates
+/// @tparam param_t The (storage) type of the parameters
+///
+template <typename config_t, typename param_t = bound_track_parameters>
+TRACCC_DEVICE inline void prune_shared_hits(
+    std::size_t globalIndex, const config_t& cfg, unsigned int n_candidates,
+    typename collection_types<param_t>::const_view params_view,
+    vecmem::data::vector_view<const unsigned int> cand_slots_view,
+    vecmem::data::vector_view<const unsigned int> winners_view,
+    vecmem::data::vector_view<unsigned int> pruned_view);
+
+/// @}
+
+}  // namespace traccc::device
+
+// Include the implementation.
+#include "traccc/finding/device/impl/prune_shared_hits.ipp"
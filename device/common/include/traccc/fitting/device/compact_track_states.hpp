@@ -0,0 +1,48 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s).
+#include "traccc/definitions/qualifiers.hpp"
+#include "traccc/edm/compact_track_state.hpp"
+#include "traccc/edm/track_state.hpp"
+
+// System include(s).
+#include <cstddef>
+
+namespace traccc::device {
+
+/// Function turning the fitted track states of one track into compact ones
+///
+/// @param[in] globalIndex   The index of the current thread (track)
+/// @param[in] track_states_view The fitted track states
+/// @param[out] compact_states_view The compact track states, with the same
+///                                 number of states per track
+///
+TRACCC_HOST_DEVICE inline void compact_track_states(
+    std::size_t globalIndex,
+    track_state_container_types::const_view track_states_view,
+    compact_track_state_container_types::view compact_states_view);
+
+/// Function collecting the covariances of the smoothed parameters of the
+/// fitted track states of one track
+///
+/// @param[in] globalIndex   The index of the current thread (track)
+/// @param[in] track_states_view The fitted track states
+/// @param[out] covariances_view The covariances, with the same number of
+///                              elements per track as there are states
+///
+TRACCC_HOST_DEVICE inline void collect_track_covariances(
+    std::size_t globalIndex,
+    track_state_container_types::const_view track_states_view,
+    compact_track_covariance_types::view covariances_view);
+
+}  // namespace traccc::device
+
+// Include the implementation.
+#include "traccc/fitting/device/impl/compact_track_states.ipp"
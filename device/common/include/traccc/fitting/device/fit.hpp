@@ -1,6 +1,6 @@
 /** TRACCC library, part of the ACTS project (R&D line)
  *
- * (c) 2022 CERN for the benefit of the ACTS project
+ * (c) 2022-2024 CERN for the benefit of the ACTS project
  *
  * Mozilla Public License Version 2.0
  */
@@ -9,7 +9,9 @@
 
 // Project include(s).
 #include "traccc/definitions/qualifiers.hpp"
+#include "traccc/edm/measurement.hpp"
 #include "traccc/edm/track_candidate.hpp"
+#include "traccc/edm/track_candidate_soa.hpp"
 #include "traccc/edm/track_state.hpp"
 
 // System include(s).
@@ -21,9 +23,14 @@ namespace traccc::device {
 ///
 /// @param[in] globalIndex   The index of the current thread
 /// @param[in] det_data      Detector view object
-/// @param[in] nav_candidates_buffer Buffer for navigation candidate objects
+/// @param[in] nav_candidates_buffer Buffer for navigation candidate objects,
+///                              with one candidate vector per track, or per
+///                              thread of a grid-stride loop of the same size
 /// @param[in] track_candidates_view The input track candidates
 /// @param[out] track_states_view The output of fitted track states
+/// @param[in] order_view    The order to fit the tracks in, with thread @c i
+///                          fitting track @c order[i] (or track @c i, if
+///                          empty)
 ///
 template <typename fitter_t, typename detector_view_t>
 TRACCC_HOST_DEVICE inline void fit(
@@ -33,7 +40,35 @@ TRACCC_HOST_DEVICE inline void fit(
     vecmem::data::jagged_vector_view<typename fitter_t::intersection_type>
         nav_candidates_buffer,
     track_candidate_container_types::const_view track_candidates_view,
-    track_state_container_types::view track_states_view);
+    track_state_container_types::view track_states_view,
+    vecmem::data::vector_view<const unsigned int> order_view = {});
+
+/// Function used for fitting a track for given track candidates, in the flat
+/// track candidate layout
+///
+/// @param[in] globalIndex   The index of the current thread
+/// @param[in] det_data      Detector view object
+/// @param[in] nav_candidates_buffer Buffer for navigation candidate objects,
+///                              with one candidate vector per track, or per
+///                              thread of a grid-stride loop of the same size
+/// @param[in] measurements_view The measurements the candidates refer to
+/// @param[in] track_candidates_view The input track candidates
+/// @param[out] track_states_view The output of fitted track states
+/// @param[in] order_view    The order to fit the tracks in, with thread @c i
+///                          fitting track @c order[i] (or track @c i, if
+///                          empty)
+///
+template <typename fitter_t, typename detector_view_t>
+TRACCC_HOST_DEVICE inline void fit(
+    std::size_t globalIndex, detector_view_t det_data,
+    const typename fitter_t::bfield_type field_data,
+    const typename fitter_t::config_type cfg,
+    vecmem::data::jagged_vector_view<typename fitter_t::intersection_type>
+        nav_candidates_buffer,
+    measurement_collection_types::const_view measurements_view,
+    track_candidate_soa_collection_types::const_view track_candidates_view,
+    track_state_container_types::view track_states_view,
+    vecmem::data::vector_view<const unsigned int> order_view = {});
 
 }  // namespace traccc::device
 
@@ -0,0 +1,61 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+namespace traccc::device {
+
+TRACCC_HOST_DEVICE inline void compact_track_states(
+    std::size_t globalIndex,
+    track_state_container_types::const_view track_states_view,
+    compact_track_state_container_types::view compact_states_view) {
+
+    track_state_container_types::const_device track_states(
+        track_states_view);
+
+    if (globalIndex >= track_states.size()) {
+        return;
+    }
+
+    compact_track_state_container_types::device compact_states(
+        compact_states_view);
+
+    // Fitting result of the track
+    compact_states[globalIndex].header = track_states[globalIndex].header;
+
+    // The states of the track
+    const auto states_per_track = track_states[globalIndex].items;
+    auto compact_states_per_track = compact_states[globalIndex].items;
+    for (unsigned int i = 0; i < states_per_track.size(); ++i) {
+        compact_states_per_track.at(i) =
+            compact_track_state<transform3>(states_per_track.at(i));
+    }
+}
+
+TRACCC_HOST_DEVICE inline void collect_track_covariances(
+    std::size_t globalIndex,
+    track_state_container_types::const_view track_states_view,
+    compact_track_covariance_types::view covariances_view) {
+
+    track_state_container_types::const_device track_states(
+        track_states_view);
+
+    if (globalIndex >= track_states.size()) {
+        return;
+    }
+
+    compact_track_covariance_types::device covariances(covariances_view);
+
+    const auto states_per_track = track_states[globalIndex].items;
+    auto covariances_per_track = covariances.at(globalIndex);
+    for (unsigned int i = 0; i < states_per_track.size(); ++i) {
+        covariances_per_track.at(i) =
+            states_per_track.at(i).smoothed().covariance();
+    }
+}
+
+}  // namespace traccc::device
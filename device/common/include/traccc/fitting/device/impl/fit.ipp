@@ -1,6 +1,6 @@
 /** TRACCC library, part of the ACTS project (R&D line)
  *
- * (c) 2022 CERN for the benefit of the ACTS project
+ * (c) 2022-2024 CERN for the benefit of the ACTS project
  *
  * Mozilla Public License Version 2.0
  */
@@ -17,7 +17,8 @@ TRACCC_HOST_DEVICE inline void fit(
     vecmem::data::jagged_vector_view<typename fitter_t::intersection_type>
         nav_candidates_buffer,
     track_candidate_container_types::const_view track_candidates_view,
-    track_state_container_types::view track_states_view) {
+    track_state_container_types::view track_states_view,
+    vecmem::data::vector_view<const unsigned int> order_view) {
 
     typename fitter_t::detector_type det(det_data);
 
@@ -35,15 +36,20 @@ TRACCC_HOST_DEVICE inline void fit(
         return;
     }
 
+    // The track fitted by this thread
+    vecmem::device_vector<const unsigned int> order(order_view);
+    const std::size_t track_index =
+        (order.size() == 0u) ? globalIndex : order.at(globalIndex);
+
     // Track candidates per track
     const auto& track_candidates_per_track =
-        track_candidates[globalIndex].items;
+        track_candidates[track_index].items;
 
     // Seed parameter
-    const auto& seed_param = track_candidates[globalIndex].header;
+    const auto& seed_param = track_candidates[track_index].header;
 
     // Track states per track
-    auto track_states_per_track = track_states[globalIndex].items;
+    auto track_states_per_track = track_states[track_index].items;
 
     for (auto& cand : track_candidates_per_track) {
         track_states_per_track.emplace_back(cand);
@@ -51,11 +57,70 @@ TRACCC_HOST_DEVICE inline void fit(
 
     typename fitter_t::state fitter_state(track_states_per_track);
 
-    // Run fitting
-    fitter.fit(seed_param, fitter_state, nav_candidates.at(globalIndex));
+    // Run fitting, with the candidate vector of this thread
+    fitter.fit(seed_param, fitter_state,
+               nav_candidates.at(globalIndex % nav_candidates.size()));
+
+    // Get the final fitting information
+    track_states[track_index].header = fitter_state.m_fit_res;
+}
+
+template <typename fitter_t, typename detector_view_t>
+TRACCC_HOST_DEVICE inline void fit(
+    std::size_t globalIndex, detector_view_t det_data,
+    const typename fitter_t::bfield_type field_data,
+    const typename fitter_t::config_type cfg,
+    vecmem::data::jagged_vector_view<typename fitter_t::intersection_type>
+        nav_candidates_buffer,
+    measurement_collection_types::const_view measurements_view,
+    track_candidate_soa_collection_types::const_view track_candidates_view,
+    track_state_container_types::view track_states_view,
+    vecmem::data::vector_view<const unsigned int> order_view) {
+
+    typename fitter_t::detector_type det(det_data);
+
+    vecmem::jagged_device_vector<typename fitter_t::intersection_type>
+        nav_candidates(nav_candidates_buffer);
+
+    measurement_collection_types::const_device measurements(measurements_view);
+
+    track_candidate_soa_collection_types::const_device track_candidates(
+        track_candidates_view);
+
+    track_state_container_types::device track_states(track_states_view);
+
+    fitter_t fitter(det, field_data, cfg);
+
+    if (globalIndex >= track_states.size()) {
+        return;
+    }
+
+    // The track fitted by this thread
+    vecmem::device_vector<const unsigned int> order(order_view);
+    const std::size_t track_index =
+        (order.size() == 0u) ? globalIndex : order.at(globalIndex);
+
+    // Seed parameter
+    const auto& seed_param = track_candidates.seeds.at(track_index);
+
+    // Track states per track
+    auto track_states_per_track = track_states[track_index].items;
+
+    const unsigned int begin = track_candidates.offsets.at(track_index);
+    const unsigned int end = track_candidates.offsets.at(track_index + 1);
+    for (unsigned int i = begin; i < end; ++i) {
+        track_states_per_track.emplace_back(
+            measurements.at(track_candidates.measurement_indices.at(i)));
+    }
+
+    typename fitter_t::state fitter_state(track_states_per_track);
+
+    // Run fitting, with the candidate vector of this thread
+    fitter.fit(seed_param, fitter_state,
+               nav_candidates.at(globalIndex % nav_candidates.size()));
 
     // Get the final fitting information
-    track_states[globalIndex].header = fitter_state.m_fit_res;
+    track_states[track_index].header = fitter_state.m_fit_res;
 }
 
 }  // namespace traccc::device
\ No newline at end of file
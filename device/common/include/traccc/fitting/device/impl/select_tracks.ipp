@@ -0,0 +1,59 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// VecMem include(s).
+#include <vecmem/containers/device_vector.hpp>
+
+namespace traccc::device {
+
+TRACCC_HOST_DEVICE inline void select_tracks(
+    std::size_t globalIndex, const track_selection_config& cfg,
+    track_state_container_types::const_view track_states_view,
+    vecmem::data::vector_view<unsigned int> selected_view) {
+
+    track_state_container_types::const_device track_states(
+        track_states_view);
+
+    if (globalIndex >= track_states.size()) {
+        return;
+    }
+
+    const auto track = track_states[globalIndex];
+    if (track_selector::is_selected(cfg, track.header, track.items)) {
+        vecmem::device_vector<unsigned int> selected(selected_view);
+        selected.push_back(static_cast<unsigned int>(globalIndex));
+    }
+}
+
+TRACCC_HOST_DEVICE inline void gather_tracks(
+    std::size_t globalIndex,
+    track_state_container_types::const_view track_states_view,
+    vecmem::data::vector_view<const unsigned int> selected_view,
+    track_state_container_types::view output_view) {
+
+    vecmem::device_vector<const unsigned int> selected(selected_view);
+
+    if (globalIndex >= selected.size()) {
+        return;
+    }
+
+    track_state_container_types::const_device track_states(
+        track_states_view);
+    track_state_container_types::device output(output_view);
+
+    // Copy the fitting result and the states of the track
+    const auto track = track_states[selected.at(globalIndex)];
+    output[globalIndex].header = track.header;
+    auto output_states = output[globalIndex].items;
+    for (unsigned int i = 0; i < track.items.size(); ++i) {
+        output_states.at(i) = track.items.at(i);
+    }
+}
+
+}  // namespace traccc::device
@@ -0,0 +1,53 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s).
+#include "traccc/definitions/qualifiers.hpp"
+#include "traccc/edm/track_state.hpp"
+#include "traccc/fitting/track_selection.hpp"
+
+// VecMem include(s).
+#include <vecmem/containers/data/vector_view.hpp>
+
+// System include(s).
+#include <cstddef>
+
+namespace traccc::device {
+
+/// Function deciding whether to keep one fitted track
+///
+/// @param[in] globalIndex   The index of the current thread (track)
+/// @param[in] cfg           The selection configuration
+/// @param[in] track_states_view The fitted tracks
+/// @param[out] selected_view The (resizable) indices of the selected tracks,
+///                           in no particular order
+///
+TRACCC_HOST_DEVICE inline void select_tracks(
+    std::size_t globalIndex, const track_selection_config& cfg,
+    track_state_container_types::const_view track_states_view,
+    vecmem::data::vector_view<unsigned int> selected_view);
+
+/// Function copying one selected track into the dense output
+///
+/// @param[in] globalIndex   The index of the current thread (selected track)
+/// @param[in] track_states_view The fitted tracks
+/// @param[in] selected_view The indices of the selected tracks
+/// @param[out] output_view  The selected tracks, in the order of
+///                          @c selected_view
+///
+TRACCC_HOST_DEVICE inline void gather_tracks(
+    std::size_t globalIndex,
+    track_state_container_types::const_view track_states_view,
+    vecmem::data::vector_view<const unsigned int> selected_view,
+    track_state_container_types::view output_view);
+
+}  // namespace traccc::device
+
+// Include the implementation.
+#include "traccc/fitting/device/impl/select_tracks.ipp"
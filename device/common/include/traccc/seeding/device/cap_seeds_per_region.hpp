@@ -0,0 +1,47 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s).
+#include "traccc/definitions/qualifiers.hpp"
+#include "traccc/seeding/detail/seeding_config.hpp"
+
+// VecMem include(s).
+#include <vecmem/containers/data/vector_view.hpp>
+
+// System include(s).
+#include <cstddef>
+#include <cstdint>
+
+namespace traccc::device {
+
+/// Function marking the seeds beyond the maximum number of seeds of a region
+///
+/// Works on the seeds sorted by their region keys (see
+/// @c traccc::seed_selection_helper::region_key), with the seeds already
+/// removed having the maximal key. The rank of every seed in its region is
+/// found with a binary search for the first seed of the region.
+///
+/// @param[in] globalIndex  The index of the current thread
+/// @param[in] config       The seed selection configuration
+/// @param[in] keys_view    The sorted region keys of the seeds
+/// @param[in] order_view   The indices of the seeds, in the order of the keys
+/// @param[out] removed_view Flags of the seeds to remove, set to 1 for the
+///                          seeds beyond the cap of their region
+///
+TRACCC_HOST_DEVICE
+inline void cap_seeds_per_region(
+    std::size_t globalIndex, const seed_selection_config& config,
+    vecmem::data::vector_view<const std::uint64_t> keys_view,
+    vecmem::data::vector_view<const unsigned int> order_view,
+    vecmem::data::vector_view<unsigned int> removed_view);
+
+}  // namespace traccc::device
+
+// Include the implementation.
+#include "traccc/seeding/device/impl/cap_seeds_per_region.ipp"
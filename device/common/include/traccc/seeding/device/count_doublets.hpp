@@ -1,6 +1,6 @@
 /** TRACCC library, part of the ACTS project (R&D line)
  *
- * (c) 2021-2023 CERN for the benefit of the ACTS project
+ * (c) 2021-2024 CERN for the benefit of the ACTS project
  *
  * Mozilla Public License Version 2.0
  */
@@ -9,10 +9,10 @@
 
 // Project include(s).
 #include "traccc/definitions/qualifiers.hpp"
-#include "traccc/device/fill_prefix_sum.hpp"
 #include "traccc/edm/device/doublet_counter.hpp"
 #include "traccc/seeding/detail/seeding_config.hpp"
-#include "traccc/seeding/detail/spacepoint_grid.hpp"
+#include "traccc/seeding/detail/spacepoint_soa_grid.hpp"
+#include "traccc/seeding/detail/static_seeding_config.hpp"
 
 // System include(s).
 #include <cstddef>
@@ -24,20 +24,23 @@ namespace traccc::device {
 /// The count is necessary for allocating the appropriate amount of memory
 /// for storing the information of the candidates in a next step.
 ///
+/// This function needs to be called separately for every spacepoint of the
+/// grid.
+///
 /// @param[in] globalIndex   The index of the current thread
 /// @param[in] config        Seedfinder configuration
 /// @param[in] sp_view       The spacepoint grid to count doublets on
-/// @param[in] sp_ps_view    Prefix sum for iterating over the spacepoint grid
 /// @param[out] doublet_view Collection storing the number of doublets for each
 /// spacepoint
 /// @param[out] nMidBot      Total number of middle-bottom doublets
 /// @param[out] nMidTop      Total number of middle-top doublets
+/// @tparam seeding_config_t The (runtime or static) seeding configuration
+///                          values driving the loops of the function
 ///
-TRACCC_HOST_DEVICE
-inline void count_doublets(
+template <typename seeding_config_t = runtime_seeding_config>
+TRACCC_HOST_DEVICE inline void count_doublets(
     std::size_t globalIndex, const seedfinder_config& config,
-    const sp_grid_const_view& sp_view,
-    const vecmem::data::vector_view<const prefix_sum_element_t>& sp_ps_view,
+    const sp_soa_grid_types::const_view& sp_view,
     doublet_counter_collection_types::view doublet_view, unsigned int& nMidBot,
     unsigned int& nMidTop);
 
@@ -1,6 +1,6 @@
 /** TRACCC library, part of the ACTS project (R&D line)
  *
- * (c) 2021-2022 CERN for the benefit of the ACTS project
+ * (c) 2021-2024 CERN for the benefit of the ACTS project
  *
  * Mozilla Public License Version 2.0
  */
@@ -12,7 +12,7 @@
 #include "traccc/device/fill_prefix_sum.hpp"
 #include "traccc/edm/spacepoint.hpp"
 #include "traccc/seeding/detail/seeding_config.hpp"
-#include "traccc/seeding/detail/spacepoint_grid.hpp"
+#include "traccc/seeding/detail/spacepoint_soa_grid.hpp"
 
 // VecMem include(s).
 #include <vecmem/containers/data/vector_view.hpp>
@@ -41,7 +41,8 @@ namespace traccc::device {
 TRACCC_HOST_DEVICE
 inline void count_grid_capacities(
     const std::size_t globalIndex, const seedfinder_config& config,
-    const sp_grid::axis_p0_type& phi_axis, const sp_grid::axis_p1_type& z_axis,
+    const sp_soa_grid_axis_p0_type& phi_axis,
+    const sp_soa_grid_axis_p1_type& z_axis,
     const spacepoint_collection_types::const_view& spacepoints,
     vecmem::data::vector_view<unsigned int> grid_capacities);
 
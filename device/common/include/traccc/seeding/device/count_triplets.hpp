@@ -1,6 +1,6 @@
 /** TRACCC library, part of the ACTS project (R&D line)
  *
- * (c) 2021-2023 CERN for the benefit of the ACTS project
+ * (c) 2021-2024 CERN for the benefit of the ACTS project
  *
  * Mozilla Public License Version 2.0
  */
@@ -14,7 +14,7 @@
 #include "traccc/edm/device/doublet_counter.hpp"
 #include "traccc/edm/device/triplet_counter.hpp"
 #include "traccc/seeding/detail/seeding_config.hpp"
-#include "traccc/seeding/detail/spacepoint_grid.hpp"
+#include "traccc/seeding/detail/spacepoint_soa_grid.hpp"
 // System include(s).
 #include <cstddef>
 
@@ -35,16 +35,21 @@ namespace traccc::device {
 /// spacepoint
 /// @param[out] mb_tc  Collection storing the number of triplets per midBottom
 /// doublet
+/// @param[out] mb_tc_links Collection receiving the index of the @c mb_tc
+/// element of every midBottom doublet (or
+/// @c traccc::device::triplet_counter_invalid_link for the doublets without
+/// triplets), or an empty view to skip writing them
 ///
 TRACCC_HOST_DEVICE
 inline void count_triplets(
     std::size_t globalIndex, const seedfinder_config& config,
-    const sp_grid_const_view& sp_view,
+    const sp_soa_grid_types::const_view& sp_view,
     const doublet_counter_collection_types::const_view& dc_view,
     const device_doublet_collection_types::const_view& mid_bot_doublet_view,
     const device_doublet_collection_types::const_view& mid_top_doublet_view,
     triplet_counter_spM_collection_types::view spM_tc,
-    triplet_counter_collection_types::view mb_tc);
+    triplet_counter_collection_types::view mb_tc,
+    vecmem::data::vector_view<unsigned int> mb_tc_links = {});
 
 }  // namespace traccc::device
 
@@ -1,6 +1,6 @@
 /** TRACCC library, part of the ACTS project (R&D line)
  *
- * (c) 2022 CERN for the benefit of the ACTS project
+ * (c) 2022-2024 CERN for the benefit of the ACTS project
  *
  * Mozilla Public License Version 2.0
  */
@@ -13,8 +13,34 @@
 #include "traccc/edm/spacepoint.hpp"
 #include "traccc/edm/track_parameters.hpp"
 
+// System include(s).
+#include <array>
+
 namespace traccc::device {
 
+/// Configuration of estimating the track parameters of seeds, inside of
+/// another kernel
+struct seed_params_config {
+    /// The (temporary) magnetic field vector
+    vector3 bfield;
+    /// Standard deviation of the seed parameters
+    std::array<traccc::scalar, traccc::e_bound_size> stddev;
+};
+
+/// Function calculating the bound track parameters of one seed
+///
+/// @param[in] spacepoints The spacepoints of the event
+/// @param[in] this_seed   The seed to estimate the parameters of
+/// @param[in] bfield      B field
+/// @param[in] stddev      Standard deviation of seed parameters
+/// @return The estimated parameters, on the surface of the bottom spacepoint
+///
+TRACCC_HOST_DEVICE
+inline bound_track_parameters seed_to_track_params(
+    const spacepoint_collection_types::const_device& spacepoints,
+    const seed& this_seed, const vector3& bfield,
+    const std::array<traccc::scalar, traccc::e_bound_size>& stddev);
+
 /// Function used for calculating the bound track parameters for each seed
 ///
 /// @param[in] globalIndex      The index of the current thread
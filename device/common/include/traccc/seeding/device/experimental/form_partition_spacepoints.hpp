@@ -0,0 +1,80 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s).
+#include "traccc/definitions/qualifiers.hpp"
+#include "traccc/edm/cell.hpp"
+#include "traccc/edm/measurement.hpp"
+#include "traccc/edm/spacepoint.hpp"
+
+namespace traccc::device::experimental {
+
+/// The (maximum) number of module placements cached for each partition
+static constexpr unsigned int MAX_CACHED_PLACEMENTS = 4;
+
+/// Function caching the placements of the modules of one CCL partition
+///
+/// Meant to be called by the threads of the block that labeled the
+/// partition, after @c traccc::device::ccl_kernel. The placements of the
+/// first @c MAX_CACHED_PLACEMENTS modules of the partition are copied into
+/// (shared memory) @c placements.
+///
+/// @param[in] threadId   current thread index
+/// @param[in] det_data   the detector
+/// @param[in] cells_view    collection of cells
+/// @param[in] modules_view  collection of modules
+/// @param[in] partition_start partition start point for this thread block
+/// @param[in] partition_end   partition end point for this thread block
+/// @param[out] placements (uninitialised) storage for
+/// @c MAX_CACHED_PLACEMENTS placements
+///
+template <typename detector_t>
+TRACCC_DEVICE inline void cache_partition_placements(
+    const unsigned int threadId, typename detector_t::view_type det_data,
+    const cell_collection_types::const_view& cells_view,
+    const cell_module_collection_types::const_view& modules_view,
+    const unsigned int partition_start, const unsigned int partition_end,
+    typename detector_t::transform3* placements);
+
+/// Function creating 3D spacepoints out of the 2D measurements of one CCL
+/// partition
+///
+/// Uses the placements cached by
+/// @c traccc::device::experimental::cache_partition_placements, and the
+/// detector for the modules that did not fit into the cache. The spacepoints
+/// are written at the same indices as the measurements.
+///
+/// @param[in] threadId   current thread index
+/// @param[in] blckDim    current thread block size
+/// @param[in] det_data   the detector
+/// @param[in] cells_view    collection of cells
+/// @param[in] partition_start partition start point for this thread block
+/// @param[in] partition_end   partition end point for this thread block
+/// @param[in] placements the cached module placements
+/// @param[in] measurements_view collection of measurements
+/// @param[in] measurements_start index of the first measurement of the
+/// partition
+/// @param[in] n_measurements number of measurements of the partition
+/// @param[out] spacepoints_view collection of spacepoints
+///
+template <typename detector_t>
+TRACCC_DEVICE inline void form_partition_spacepoints(
+    const unsigned int threadId, const unsigned int blckDim,
+    typename detector_t::view_type det_data,
+    const cell_collection_types::const_view& cells_view,
+    const unsigned int partition_start, const unsigned int partition_end,
+    const typename detector_t::transform3* placements,
+    measurement_collection_types::const_view measurements_view,
+    const unsigned int measurements_start, const unsigned int n_measurements,
+    spacepoint_collection_types::view spacepoints_view);
+
+}  // namespace traccc::device::experimental
+
+// Include the implementation.
+#include "traccc/seeding/device/experimental/impl/form_partition_spacepoints.ipp"
@@ -0,0 +1,107 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Detray include(s).
+#include "detray/geometry/surface.hpp"
+
+// System include(s).
+#include <new>
+
+namespace traccc::device::experimental {
+namespace details {
+
+/// Get the number of module placements cached for a partition
+TRACCC_HOST_DEVICE inline unsigned int n_cached_placements(
+    const cell_collection_types::const_device& cells,
+    const unsigned int partition_start, const unsigned int partition_end) {
+
+    if (partition_start >= partition_end) {
+        return 0u;
+    }
+    // The cells are sorted by module, so the partition's modules are all in
+    // the range of its first and last cell. (Modules without cells in the
+    // partition may also get cached, which is harmless.)
+    const unsigned int n_modules = cells[partition_end - 1].module_link -
+                                   cells[partition_start].module_link + 1;
+    return (n_modules < MAX_CACHED_PLACEMENTS) ? n_modules
+                                               : MAX_CACHED_PLACEMENTS;
+}
+
+}  // namespace details
+
+template <typename detector_t>
+TRACCC_DEVICE inline void cache_partition_placements(
+    const unsigned int threadId, typename detector_t::view_type det_data,
+    const cell_collection_types::const_view& cells_view,
+    const cell_module_collection_types::const_view& modules_view,
+    const unsigned int partition_start, const unsigned int partition_end,
+    typename detector_t::transform3* placements) {
+
+    const cell_collection_types::const_device cells(cells_view);
+    if (threadId >=
+        details::n_cached_placements(cells, partition_start, partition_end)) {
+        return;
+    }
+
+    const cell_module_collection_types::const_device modules(modules_view);
+    const detector_t det(det_data);
+    const detray::surface<detector_t> sf{
+        det,
+        modules.at(cells[partition_start].module_link + threadId).surface_link};
+    new (&placements[threadId])
+        typename detector_t::transform3(sf.transform({}));
+}
+
+template <typename detector_t>
+TRACCC_DEVICE inline void form_partition_spacepoints(
+    const unsigned int threadId, const unsigned int blckDim,
+    typename detector_t::view_type det_data,
+    const cell_collection_types::const_view& cells_view,
+    const unsigned int partition_start, const unsigned int partition_end,
+    const typename detector_t::transform3* placements,
+    measurement_collection_types::const_view measurements_view,
+    const unsigned int measurements_start, const unsigned int n_measurements,
+    spacepoint_collection_types::view spacepoints_view) {
+
+    if (n_measurements == 0u) {
+        return;
+    }
+
+    const cell_collection_types::const_device cells(cells_view);
+    const unsigned int n_cached =
+        details::n_cached_placements(cells, partition_start, partition_end);
+    const unsigned int first_module = cells[partition_start].module_link;
+
+    const measurement_collection_types::const_device measurements(
+        measurements_view);
+    spacepoint_collection_types::device spacepoints(spacepoints_view);
+
+    for (unsigned int i = threadId; i < n_measurements; i += blckDim) {
+
+        const unsigned int index = measurements_start + i;
+        const measurement& ms = measurements.at(index);
+
+        // This local to global transformation only works for 2D planar
+        // measurements (e.g. barrel pixel and endcap pixel detector), the
+        // same as in traccc::device::experimental::form_spacepoints.
+        const unsigned int cache_index = ms.module_link - first_module;
+        if (cache_index < n_cached) {
+            const point3 local_3d = {ms.local[0], ms.local[1], 0.f};
+            spacepoints.at(index) = {
+                placements[cache_index].point_to_global(local_3d), ms};
+        } else {
+            const detector_t det(det_data);
+            const detray::surface<detector_t> sf{det, ms.surface_link};
+            spacepoints.at(index) = {sf.bound_to_global({}, ms.local, {}),
+                                     ms};
+        }
+    }
+}
+
+}  // namespace traccc::device::experimental
@@ -0,0 +1,56 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s).
+#include "traccc/definitions/qualifiers.hpp"
+#include "traccc/edm/nseed.hpp"
+#include "traccc/edm/seed.hpp"
+#include "traccc/edm/spacepoint.hpp"
+#include "traccc/seeding/detail/seeding_config.hpp"
+#include "traccc/seeding/detail/spacepoint_soa_grid.hpp"
+
+// System include(s).
+#include <cstddef>
+
+namespace traccc::device {
+
+/// Function extending triplet seeds with spacepoints at larger radii
+///
+/// The seed's circle in the transverse plane, and its straight line in r-z,
+/// are extrapolated outwards from its outermost spacepoint. The most
+/// compatible spacepoint within @c traccc::seed_extension_config::deltaRMax
+/// of it is added to the seed, until the seed reaches
+/// @c traccc::seed_extension_config::max_seed_size spacepoints, or no more
+/// compatible spacepoints are found.
+///
+/// @param[in] globalIndex      The index of the current thread
+/// @param[in] finder_config    Seed finder config (for the grid neighbourhood)
+/// @param[in] extension_config Seed extension config
+/// @param[in] spacepoints_view Collection of spacepoints
+/// @param[in] sp_view          The spacepoint grid
+/// @param[in] seeds_view       Collection of (triplet) seeds
+/// @param[out] nseeds_view     Collection of extended seeds, one per seed
+/// @param[out] kept_seeds_view Resizable collection of the triplet seeds
+///                             whose extension reached
+///                             @c traccc::seed_extension_config::min_seed_size
+///
+TRACCC_HOST_DEVICE
+inline void extend_seeds(
+    std::size_t globalIndex, const seedfinder_config& finder_config,
+    const seed_extension_config& extension_config,
+    const spacepoint_collection_types::const_view& spacepoints_view,
+    const sp_soa_grid_types::const_view& sp_view,
+    const seed_collection_types::const_view& seeds_view,
+    extended_seed_collection_types::view nseeds_view,
+    seed_collection_types::view kept_seeds_view);
+
+}  // namespace traccc::device
+
+// Include the implementation.
+#include "traccc/seeding/device/impl/extend_seeds.ipp"
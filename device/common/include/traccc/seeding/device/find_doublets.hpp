@@ -1,6 +1,6 @@
 /** TRACCC library, part of the ACTS project (R&D line)
  *
- * (c) 2021-2023 CERN for the benefit of the ACTS project
+ * (c) 2021-2024 CERN for the benefit of the ACTS project
  *
  * Mozilla Public License Version 2.0
  */
@@ -9,11 +9,11 @@
 
 // Project include(s).
 #include "traccc/definitions/qualifiers.hpp"
-#include "traccc/device/fill_prefix_sum.hpp"
 #include "traccc/edm/device/device_doublet.hpp"
 #include "traccc/edm/device/doublet_counter.hpp"
 #include "traccc/seeding/detail/seeding_config.hpp"
-#include "traccc/seeding/detail/spacepoint_grid.hpp"
+#include "traccc/seeding/detail/spacepoint_soa_grid.hpp"
+#include "traccc/seeding/detail/static_seeding_config.hpp"
 
 // System include(s).
 #include <cstddef>
@@ -31,11 +31,13 @@ namespace traccc::device {
 /// @param[in] dc_view           Collection with the number of doublets to find
 /// @param[out] mb_doublets_view Collection of middle-bottom doublets
 /// @param[out] mt_doublets_view Collection of middle-top doublets
+/// @tparam seeding_config_t The (runtime or static) seeding configuration
+///                          values driving the loops of the function
 ///
-TRACCC_HOST_DEVICE
-inline void find_doublets(
+template <typename seeding_config_t = runtime_seeding_config>
+TRACCC_HOST_DEVICE inline void find_doublets(
     std::size_t globalIndex, const seedfinder_config& config,
-    const sp_grid_const_view& sp_view,
+    const sp_soa_grid_types::const_view& sp_view,
     const doublet_counter_collection_types::const_view& dc_view,
     device_doublet_collection_types::view mb_doublets_view,
     device_doublet_collection_types::view mt_doublets_view);
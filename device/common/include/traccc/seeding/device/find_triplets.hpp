@@ -1,6 +1,6 @@
 /** TRACCC library, part of the ACTS project (R&D line)
  *
- * (c) 2021-2023 CERN for the benefit of the ACTS project
+ * (c) 2021-2024 CERN for the benefit of the ACTS project
  *
  * Mozilla Public License Version 2.0
  */
@@ -13,8 +13,9 @@
 #include "traccc/edm/device/device_triplet.hpp"
 #include "traccc/edm/device/doublet_counter.hpp"
 #include "traccc/edm/device/triplet_counter.hpp"
+#include "traccc/seeding/detail/lin_circle.hpp"
 #include "traccc/seeding/detail/seeding_config.hpp"
-#include "traccc/seeding/detail/spacepoint_grid.hpp"
+#include "traccc/seeding/detail/spacepoint_soa_grid.hpp"
 
 // System include(s).
 #include <cstddef>
@@ -36,15 +37,68 @@ namespace traccc::device {
 /// @param[in] tc_view           Collection with the number of triplets per
 /// midBot doublet
 /// @param[out] triplet_view     Collection of triplets
+/// @param[in] tiled_mid_top_capacity The midBot doublets of the middle
+/// spacepoints with at most this many midTop doublets are skipped, as they
+/// are handled by @c traccc::device::find_triplets_tiled
 ///
 TRACCC_HOST_DEVICE
 inline void find_triplets(
     std::size_t globalIndex, const seedfinder_config& config,
-    const seedfilter_config& filter_config, const sp_grid_const_view& sp_view,
+    const seedfilter_config& filter_config,
+    const sp_soa_grid_types::const_view& sp_view,
     const doublet_counter_collection_types::const_view& dc_view,
     const device_doublet_collection_types::const_view& mid_top_doublet_view,
     const triplet_counter_spM_collection_types::const_view& spM_tc_view,
     const triplet_counter_collection_types::const_view& tc_view,
+    device_triplet_collection_types::view triplet_view,
+    unsigned int tiled_mid_top_capacity = 0u);
+
+/// Function finding the spacepoint triplets of one middle spacepoint, with a
+/// whole block of threads
+///
+/// The midTop doublets of the middle spacepoint are transformed once, into a
+/// tile in shared memory, and all midBot doublets of the middle spacepoint
+/// are then checked against that tile. Middle spacepoints with more midTop
+/// doublets than what fits into the tile are skipped, and need to be handled
+/// by @c traccc::device::find_triplets.
+///
+/// @param[in] threadIndex       The index of the current thread in the block
+/// @param[in] blockSize         The number of threads in the block
+/// @param[in] blockIndex        The index of the block, which is the index of
+/// the middle spacepoint (of its doublet counter) to process
+/// @param[in] config            Seedfinder configuration
+/// @param[in] filter_config     Seedfilter configuration
+/// @param[in] sp_view           The spacepoint grid to find triplets on
+/// @param[in] dc_view           Collection of doublet counters
+/// @param[in] mid_bot_doublet_view Collection with the mid bottom doublets
+/// @param[in] mid_top_doublet_view Collection with the mid top doublets
+/// @param[in] spM_tc_view       Collection with the number of triplets per spM
+/// @param[in] tc_view           Collection with the number of triplets per
+/// midBot doublet
+/// @param[in] tc_links_view     The links to @c tc_view of the midBot
+/// doublets, as written by @c traccc::device::count_triplets
+/// @param tile_circles          Shared array of (at least) @c tile_size
+/// transformed midTop doublets
+/// @param tile_locations        Shared array of (at least) @c tile_size top
+/// spacepoint (grid) indices
+/// @param[in] tile_size         The capacity of the tile
+/// @param barrier               A generic object for block-wide
+/// synchronisation
+/// @param[out] triplet_view     Collection of triplets
+///
+template <typename barrier_t>
+TRACCC_HOST_DEVICE inline void find_triplets_tiled(
+    unsigned int threadIndex, unsigned int blockSize, unsigned int blockIndex,
+    const seedfinder_config& config, const seedfilter_config& filter_config,
+    const sp_soa_grid_types::const_view& sp_view,
+    const doublet_counter_collection_types::const_view& dc_view,
+    const device_doublet_collection_types::const_view& mid_bot_doublet_view,
+    const device_doublet_collection_types::const_view& mid_top_doublet_view,
+    const triplet_counter_spM_collection_types::const_view& spM_tc_view,
+    const triplet_counter_collection_types::const_view& tc_view,
+    const vecmem::data::vector_view<const unsigned int>& tc_links_view,
+    lin_circle* tile_circles, unsigned int* tile_locations,
+    unsigned int tile_size, barrier_t& barrier,
     device_triplet_collection_types::view triplet_view);
 
 }  // namespace traccc::device
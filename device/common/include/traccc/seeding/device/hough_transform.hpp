@@ -0,0 +1,112 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s).
+#include "traccc/definitions/qualifiers.hpp"
+#include "traccc/edm/seed.hpp"
+#include "traccc/edm/spacepoint.hpp"
+#include "traccc/seeding/detail/hough_seeding_config.hpp"
+
+// VecMem include(s).
+#include <vecmem/containers/data/vector_view.hpp>
+
+// System include(s).
+#include <cstddef>
+
+namespace traccc::device {
+
+/// Function filling the layer of one spacepoint into the Hough accumulator
+///
+/// @param[in] globalIndex       The index of the current thread (spacepoint)
+/// @param[in] config            The configuration of the Hough transform
+/// @param[in] spacepoints_view  All spacepoints of the event
+/// @param[out] masks_view       The layer masks of the accumulator cells
+///
+TRACCC_DEVICE inline void fill_hough_accumulator(
+    std::size_t globalIndex, const hough_seeding_config& config,
+    spacepoint_collection_types::const_view spacepoints_view,
+    vecmem::data::vector_view<unsigned int> masks_view);
+
+/// Function deciding whether one accumulator cell should make a seed
+///
+/// @param[in] globalIndex       The index of the current thread (cell)
+/// @param[in] config            The configuration of the Hough transform
+/// @param[in] masks_view        The layer masks of the accumulator cells
+/// @param[out] candidates_view  The (resizable) list of seed cells
+/// @param[out] candidate_links_view One plus the index of the candidate of
+///                              every seed cell (zero for other cells)
+///
+TRACCC_DEVICE inline void find_hough_candidates(
+    std::size_t globalIndex, const hough_seeding_config& config,
+    vecmem::data::vector_view<const unsigned int> masks_view,
+    vecmem::data::vector_view<unsigned int> candidates_view,
+    vecmem::data::vector_view<unsigned int> candidate_links_view);
+
+/// Function offering one spacepoint as the bottom and top spacepoint of the
+/// candidates that it voted for
+///
+/// @param[in] globalIndex       The index of the current thread (spacepoint)
+/// @param[in] config            The configuration of the Hough transform
+/// @param[in] spacepoints_view  All spacepoints of the event
+/// @param[in] candidate_links_view The candidate links of the cells
+/// @param[out] bottom_view      The bottom spacepoint keys of the candidates
+/// @param[out] top_view         The top spacepoint keys of the candidates
+///
+TRACCC_DEVICE inline void find_hough_edges(
+    std::size_t globalIndex, const hough_seeding_config& config,
+    spacepoint_collection_types::const_view spacepoints_view,
+    vecmem::data::vector_view<const unsigned int> candidate_links_view,
+    vecmem::data::vector_view<unsigned long long> bottom_view,
+    vecmem::data::vector_view<unsigned long long> top_view);
+
+/// Function offering one spacepoint as the middle spacepoint of the
+/// candidates that it voted for
+///
+/// @param[in] globalIndex       The index of the current thread (spacepoint)
+/// @param[in] config            The configuration of the Hough transform
+/// @param[in] spacepoints_view  All spacepoints of the event
+/// @param[in] candidate_links_view The candidate links of the cells
+/// @param[in] bottom_view       The bottom spacepoint keys of the candidates
+/// @param[in] top_view          The top spacepoint keys of the candidates
+/// @param[out] middle_view      The middle spacepoint keys of the candidates
+///
+TRACCC_DEVICE inline void find_hough_middles(
+    std::size_t globalIndex, const hough_seeding_config& config,
+    spacepoint_collection_types::const_view spacepoints_view,
+    vecmem::data::vector_view<const unsigned int> candidate_links_view,
+    vecmem::data::vector_view<const unsigned long long> bottom_view,
+    vecmem::data::vector_view<const unsigned long long> top_view,
+    vecmem::data::vector_view<unsigned long long> middle_view);
+
+/// Function making the seed of one candidate
+///
+/// @param[in] globalIndex       The index of the current thread (candidate)
+/// @param[in] config            The configuration of the Hough transform
+/// @param[in] spacepoints_view  All spacepoints of the event
+/// @param[in] masks_view        The layer masks of the accumulator cells
+/// @param[in] candidates_view   The seed cells
+/// @param[in] bottom_view       The bottom spacepoint keys of the candidates
+/// @param[in] middle_view       The middle spacepoint keys of the candidates
+/// @param[in] top_view          The top spacepoint keys of the candidates
+/// @param[out] seeds_view       The (resizable) collection of seeds
+///
+TRACCC_DEVICE inline void make_hough_seeds(
+    std::size_t globalIndex, const hough_seeding_config& config,
+    spacepoint_collection_types::const_view spacepoints_view,
+    vecmem::data::vector_view<const unsigned int> masks_view,
+    vecmem::data::vector_view<const unsigned int> candidates_view,
+    vecmem::data::vector_view<const unsigned long long> bottom_view,
+    vecmem::data::vector_view<const unsigned long long> middle_view,
+    vecmem::data::vector_view<const unsigned long long> top_view,
+    seed_collection_types::view seeds_view);
+
+}  // namespace traccc::device
+
+// Include the implementation.
+#include "traccc/seeding/device/impl/hough_transform.ipp"
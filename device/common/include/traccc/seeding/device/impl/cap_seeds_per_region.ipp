@@ -0,0 +1,55 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// VecMem include(s).
+#include <vecmem/containers/device_vector.hpp>
+
+namespace traccc::device {
+
+TRACCC_HOST_DEVICE
+inline void cap_seeds_per_region(
+    const std::size_t globalIndex, const seed_selection_config& config,
+    vecmem::data::vector_view<const std::uint64_t> keys_view,
+    vecmem::data::vector_view<const unsigned int> order_view,
+    vecmem::data::vector_view<unsigned int> removed_view) {
+
+    // Check if anything needs to be done.
+    const vecmem::device_vector<const std::uint64_t> keys(keys_view);
+    if (globalIndex >= keys.size()) {
+        return;
+    }
+
+    // Seeds that were removed already have nothing to do.
+    const unsigned int pos = static_cast<unsigned int>(globalIndex);
+    const std::uint64_t region = keys.at(pos) >> 32;
+    if (region == 0xffffffffu) {
+        return;
+    }
+
+    // Find the first seed of the region.
+    unsigned int first = 0u;
+    unsigned int last = pos;
+    while (first < last) {
+        const unsigned int middle = first + (last - first) / 2u;
+        if ((keys.at(middle) >> 32) < region) {
+            first = middle + 1u;
+        } else {
+            last = middle;
+        }
+    }
+
+    // Remove the seed if there are enough better seeds in its region.
+    if (pos - first >= config.max_seeds_per_region) {
+        const vecmem::device_vector<const unsigned int> order(order_view);
+        vecmem::device_vector<unsigned int> removed(removed_view);
+        removed.at(order.at(pos)) = 1u;
+    }
+}
+
+}  // namespace traccc::device
@@ -1,6 +1,6 @@
 /** TRACCC library, part of the ACTS project (R&D line)
  *
- * (c) 2021-2023 CERN for the benefit of the ACTS project
+ * (c) 2021-2024 CERN for the benefit of the ACTS project
  *
  * Mozilla Public License Version 2.0
  */
@@ -14,42 +14,41 @@
 #include <vecmem/memory/device_atomic_ref.hpp>
 
 // System include(s).
+#include <algorithm>
 #include <cassert>
 
 namespace traccc::device {
 
-TRACCC_HOST_DEVICE
-inline void count_doublets(
+template <typename seeding_config_t>
+TRACCC_HOST_DEVICE inline void count_doublets(
     const std::size_t globalIndex, const seedfinder_config& config,
-    const sp_grid_const_view& sp_view,
-    const vecmem::data::vector_view<const prefix_sum_element_t>& sp_ps_view,
+    const sp_soa_grid_types::const_view& sp_view,
     doublet_counter_collection_types::view doublet_view, unsigned int& nMidBot,
     unsigned int& nMidTop) {
 
     // Check if anything needs to be done.
-    vecmem::device_vector<const prefix_sum_element_t> sp_prefix_sum(sp_ps_view);
-    if (globalIndex >= sp_prefix_sum.size()) {
+    const sp_soa_grid_types::const_device sp_grid(sp_view);
+    if (globalIndex >= sp_grid.size()) {
         return;
     }
 
-    // Get the middle spacepoint that we need to be looking at.
-    const prefix_sum_element_t middle_sp_idx = sp_prefix_sum[globalIndex];
-
     // Set up the device containers.
-    const const_sp_grid_device sp_grid(sp_view);
     doublet_counter_collection_types::device doublet_counter(doublet_view);
 
     // Get the spacepoint that we're evaluating in this thread, and treat that
     // as the "middle" spacepoint.
+    const unsigned int middle_sp_index = static_cast<unsigned int>(globalIndex);
     const internal_spacepoint<spacepoint> middle_sp =
-        sp_grid.bin(middle_sp_idx.first).at(middle_sp_idx.second);
+        sp_grid.at(middle_sp_index);
 
     // The the IDs of the neighbouring bins along the phi and Z axes of the
     // grid.
+    const darray<unsigned int, 2> neighbor_scope =
+        seeding_config_t::neighbor_scope(config);
     const detray::dindex_range phi_bins =
-        sp_grid.axis_p0().range(middle_sp.phi(), config.neighbor_scope);
+        sp_grid.axis_p0().range(middle_sp.phi(), neighbor_scope);
     const detray::dindex_range z_bins =
-        sp_grid.axis_p1().range(middle_sp.z(), config.neighbor_scope);
+        sp_grid.axis_p1().range(middle_sp.z(), neighbor_scope);
     assert(z_bins[0] <= z_bins[1]);
 
     // The number of middle-bottom candidates found for this thread's middle
@@ -82,25 +81,46 @@ inline void count_doublets(
         // the Z axis does not "wrap around".
         for (detray::dindex z_bin = z_bins[0]; z_bin <= z_bins[1]; ++z_bin) {
 
-            // Ask the grid for all of the spacepoints in this specific bin.
-            typename const_sp_grid_device::serialized_storage::const_reference
-                spacepoints = sp_grid.bin(phi_bin, z_bin);
+            // The bins are sorted by radius, so only a contiguous range of
+            // them can be in the allowed radius distance. Only the radii and Z
+            // coordinates of the spacepoints are needed for the compatibility
+            // checks.
+            const unsigned int bin = sp_grid.bin_index(phi_bin, z_bin);
+            const compressed_rz_bin cbin = sp_grid.compressed_bin(bin);
+            const darray<unsigned int, 2> window =
+                doublet_finding_helper::radiusWindow(
+                    sp_grid.radius, sp_grid.bin_begin(bin),
+                    sp_grid.bin_end(bin), middle_sp.radius(), config);
+            for (unsigned int i = window[0]; i < window[1]; ++i) {
+
+                // Reject the candidates using their compressed coordinates
+                // first, if requested.
+                if (config.useCompressedGrid) {
+                    const compressed_preselection pre =
+                        doublet_finding_helper::preselect(
+                            middle_sp, cbin.decompress(sp_grid.rz[i]), config);
+                    if (pre == compressed_preselection::skip) {
+                        continue;
+                    } else if (pre == compressed_preselection::stop) {
+                        break;
+                    }
+                }
 
-            // Loop over all of those spacepoints.
-            for (const internal_spacepoint<spacepoint> other_sp : spacepoints) {
+                const scalar other_r = sp_grid.radius[i];
+                const scalar other_z = sp_grid.z[i];
 
                 // Check if this spacepoint is a compatible "bottom" spacepoint
                 // to the thread's "middle" spacepoint.
                 if (doublet_finding_helper::isCompatible<
-                        details::spacepoint_type::bottom>(middle_sp, other_sp,
-                                                          config)) {
+                        details::spacepoint_type::bottom>(middle_sp, other_r,
+                                                          other_z, config)) {
                     ++n_mb_cand;
                 }
                 // Check if this spacepoint is a compatible "top" spacepoint to
                 // the thread's "middle" spacepoint.
                 if (doublet_finding_helper::isCompatible<
-                        details::spacepoint_type::top>(middle_sp, other_sp,
-                                                       config)) {
+                        details::spacepoint_type::top>(middle_sp, other_r,
+                                                       other_z, config)) {
                     ++n_mt_cand;
                 }
             }
@@ -111,6 +131,10 @@ inline void count_doublets(
     // the middle spacepoint in question.
     if ((n_mb_cand > 0) && (n_mt_cand > 0)) {
 
+        // Only as many doublets are recorded as the counter can describe.
+        n_mb_cand = std::min(n_mb_cand, doublet_counter::max_count);
+        n_mt_cand = std::min(n_mt_cand, doublet_counter::max_count);
+
         // Increment the summary values in the header object.
         vecmem::device_atomic_ref<unsigned int> numMidBot(nMidBot);
         const unsigned int posBot = numMidBot.fetch_add(n_mb_cand);
@@ -119,11 +143,9 @@ inline void count_doublets(
 
         // Add the number of candidates for the "current bin".
         doublet_counter.push_back(
-            {{static_cast<unsigned int>(middle_sp_idx.first),
-              static_cast<unsigned int>(middle_sp_idx.second)},
-             n_mb_cand,
-             n_mt_cand,
-             posBot,
+            {middle_sp_index,
+             static_cast<doublet_counter::count_type>(n_mb_cand),
+             static_cast<doublet_counter::count_type>(n_mt_cand), posBot,
              posTop});
     }
 }
@@ -1,6 +1,6 @@
 /** TRACCC library, part of the ACTS project (R&D line)
  *
- * (c) 2021-2023 CERN for the benefit of the ACTS project
+ * (c) 2021-2024 CERN for the benefit of the ACTS project
  *
  * Mozilla Public License Version 2.0
  */
@@ -11,19 +11,24 @@
 #include "traccc/seeding/triplet_finding_helper.hpp"
 
 // VecMem include(s).
+#include <vecmem/containers/device_vector.hpp>
 #include <vecmem/memory/device_atomic_ref.hpp>
 
+// System include(s).
+#include <algorithm>
+
 namespace traccc::device {
 
 TRACCC_HOST_DEVICE
 inline void count_triplets(
     const std::size_t globalIndex, const seedfinder_config& config,
-    const sp_grid_const_view& sp_view,
+    const sp_soa_grid_types::const_view& sp_view,
     const doublet_counter_collection_types::const_view& dc_view,
     const device_doublet_collection_types::const_view& mid_bot_doublet_view,
     const device_doublet_collection_types::const_view& mid_top_doublet_view,
     triplet_counter_spM_collection_types::view spM_tc_view,
-    triplet_counter_collection_types::view mb_tc_view) {
+    triplet_counter_collection_types::view mb_tc_view,
+    vecmem::data::vector_view<unsigned int> mb_tc_links_view) {
 
     // Create device copy of input parameters
     const device_doublet_collection_types::const_device mid_bot_doublet_device(
@@ -47,19 +52,19 @@ inline void count_triplets(
         spM_tc_view);
 
     // Get all spacepoints
-    const const_sp_grid_device internal_sp_device(sp_view);
+    const sp_soa_grid_types::const_device internal_sp_device(sp_view);
 
     const unsigned int counter_link = mid_bot.counter_link;
     const doublet_counter doublet_counts = dc_device.at(counter_link);
 
     // middle spacepoint
-    const sp_location spM_loc = doublet_counts.m_spM;
+    const unsigned int spM_loc = doublet_counts.m_spM;
     const traccc::internal_spacepoint<traccc::spacepoint> spM =
-        internal_sp_device.bin(spM_loc.bin_idx)[spM_loc.sp_idx];
-    const sp_location spB_loc = mid_bot.sp2;
+        internal_sp_device.at(spM_loc);
+    const unsigned int spB_loc = mid_bot.sp2;
     // bottom spacepoint
     const traccc::internal_spacepoint<traccc::spacepoint> spB =
-        internal_sp_device.bin(spB_loc.bin_idx)[spB_loc.sp_idx];
+        internal_sp_device.at(spB_loc);
 
     // Apply the conformal transformation to middle-bot doublet
     traccc::lin_circle lb = doublet_finding_helper::transform_coordinates<
@@ -78,17 +83,21 @@ inline void count_triplets(
     // find the reference (start) index of the mid-top doublet container
     // item vector, where the doublets are recorded
     const unsigned int mt_start_idx = doublet_counts.m_posMidTop;
-    const unsigned int mt_end_idx = mt_start_idx + doublet_counts.m_nMidTop;
+    // (Clamped to the size of the doublet collection, which may be smaller
+    // than the doublet count when running with bounded capacities.)
+    const unsigned int mt_end_idx =
+        std::min(mt_start_idx + doublet_counts.m_nMidTop,
+                 mid_top_doublet_device.size());
 
     // number of triplets per middle-bot doublet
     unsigned int num_triplets_per_mb = 0;
 
     // iterate over mid-top doublets
     for (unsigned int i = mt_start_idx; i < mt_end_idx; ++i) {
-        const traccc::sp_location spT_loc = mid_top_doublet_device[i].sp2;
+        const unsigned int spT_loc = mid_top_doublet_device[i].sp2;
 
         const traccc::internal_spacepoint<traccc::spacepoint> spT =
-            internal_sp_device.bin(spT_loc.bin_idx)[spT_loc.sp_idx];
+            internal_sp_device.at(spT_loc);
 
         // Apply the conformal transformation to middle-top doublet
         traccc::lin_circle lt = doublet_finding_helper::transform_coordinates<
@@ -104,15 +113,22 @@ inline void count_triplets(
 
     // if the number of triplets per mb is larger than 0, write the triplet
     // counter into the collection
+    unsigned int mb_tc_link = triplet_counter_invalid_link;
     if (num_triplets_per_mb > 0) {
         triplet_counter_spM& header = spM_triplet_counter.at(counter_link);
         vecmem::device_atomic_ref<unsigned int> nTriplets(header.m_nTriplets);
         const unsigned int posTriplets =
             nTriplets.fetch_add(num_triplets_per_mb);
 
-        mb_triplet_counter.push_back(
+        mb_tc_link = mb_triplet_counter.push_back(
             {spB_loc, counter_link, num_triplets_per_mb, posTriplets});
     }
+
+    // Record where the triplet counter of the doublet ended up, if requested
+    vecmem::device_vector<unsigned int> mb_tc_links(mb_tc_links_view);
+    if (globalIndex < mb_tc_links.size()) {
+        mb_tc_links.at(globalIndex) = mb_tc_link;
+    }
 }
 
 }  // namespace traccc::device
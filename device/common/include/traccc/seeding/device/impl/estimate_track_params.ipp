@@ -1,6 +1,6 @@
 /** TRACCC library, part of the ACTS project (R&D line)
  *
- * (c) 2021-2022 CERN for the benefit of the ACTS project
+ * (c) 2021-2024 CERN for the benefit of the ACTS project
  *
  * Mozilla Public License Version 2.0
  */
@@ -13,6 +13,30 @@
 
 namespace traccc::device {
 
+TRACCC_HOST_DEVICE
+inline bound_track_parameters seed_to_track_params(
+    const spacepoint_collection_types::const_device& spacepoints,
+    const seed& this_seed, const vector3& bfield,
+    const std::array<traccc::scalar, traccc::e_bound_size>& stddev) {
+
+    // Get bound track parameter
+    bound_track_parameters track_params;
+    track_params.set_vector(
+        seed_to_bound_vector(spacepoints, this_seed, bfield, PION_MASS_MEV));
+
+    // Set Covariance
+    for (std::size_t i = 0; i < e_bound_size; i++) {
+        getter::element(track_params.covariance(), i, i) =
+            stddev[i] * stddev[i];
+    }
+
+    // Get geometry ID for bottom spacepoint
+    const auto& spB = spacepoints.at(this_seed.spB_link);
+    track_params.set_surface_link(spB.meas.surface_link);
+
+    return track_params;
+}
+
 TRACCC_HOST_DEVICE
 inline void estimate_track_params(
     const std::size_t globalIndex,
@@ -32,25 +56,9 @@ inline void estimate_track_params(
 
     bound_track_parameters_collection_types::device params_device(params_view);
 
-    const seed& this_seed = seeds_device.at(globalIndex);
-
-    // Get bound track parameter
-    bound_track_parameters track_params;
-    track_params.set_vector(seed_to_bound_vector(spacepoints_device, this_seed,
-                                                 bfield, PION_MASS_MEV));
-
-    // Set Covariance
-    for (std::size_t i = 0; i < e_bound_size; i++) {
-        getter::element(track_params.covariance(), i, i) =
-            stddev[i] * stddev[i];
-    }
-
-    // Get geometry ID for bottom spacepoint
-    const auto& spB = spacepoints_device.at(this_seed.spB_link);
-    track_params.set_surface_link(spB.meas.surface_link);
-
-    // Save the object into global memory.
-    params_device[globalIndex] = track_params;
+    // Save the parameters of the seed into global memory.
+    params_device[globalIndex] = seed_to_track_params(
+        spacepoints_device, seeds_device.at(globalIndex), bfield, stddev);
 }
 
 }  // namespace traccc::device
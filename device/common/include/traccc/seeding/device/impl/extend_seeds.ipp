@@ -0,0 +1,189 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s).
+#include "traccc/edm/internal_spacepoint.hpp"
+
+// Algebra plugins include(s).
+#include <algebra/math/common.hpp>
+
+// System include(s).
+#include <cmath>
+
+namespace traccc::device {
+
+TRACCC_HOST_DEVICE
+inline void extend_seeds(
+    const std::size_t globalIndex, const seedfinder_config& finder_config,
+    const seed_extension_config& extension_config,
+    const spacepoint_collection_types::const_view& spacepoints_view,
+    const sp_soa_grid_types::const_view& sp_view,
+    const seed_collection_types::const_view& seeds_view,
+    extended_seed_collection_types::view nseeds_view,
+    seed_collection_types::view kept_seeds_view) {
+
+    // Check if anything needs to be done.
+    const seed_collection_types::const_device seeds(seeds_view);
+    if (globalIndex >= seeds.size()) {
+        return;
+    }
+
+    // Set up the device containers.
+    const spacepoint_collection_types::const_device spacepoints(
+        spacepoints_view);
+    const sp_soa_grid_types::const_device sp_grid(sp_view);
+    extended_seed_collection_types::device nseeds(nseeds_view);
+    seed_collection_types::device kept_seeds(kept_seeds_view);
+
+    // The seed that this thread is extending.
+    const seed triplet = seeds.at(globalIndex);
+    extended_seed result(triplet);
+
+    // The seed's spacepoints, in the same coordinates as the grid's.
+    const internal_spacepoint<spacepoint> spB(
+        spacepoints.at(triplet.spB_link), triplet.spB_link,
+        finder_config.beamPos);
+    const internal_spacepoint<spacepoint> spM(
+        spacepoints.at(triplet.spM_link), triplet.spM_link,
+        finder_config.beamPos);
+    const internal_spacepoint<spacepoint> spT(
+        spacepoints.at(triplet.spT_link), triplet.spT_link,
+        finder_config.beamPos);
+
+    // Circle through the seed's spacepoints in the transverse plane. Which
+    // degenerates into a straight line for (almost) collinear spacepoints.
+    const scalar x1 = spB.x(), y1 = spB.y();
+    const scalar x2 = spM.x(), y2 = spM.y();
+    const scalar x3 = spT.x(), y3 = spT.y();
+    const scalar d = 2.f * (x1 * (y2 - y3) + x2 * (y3 - y1) + x3 * (y1 - y2));
+    const scalar chord =
+        algebra::math::sqrt((x3 - x1) * (x3 - x1) + (y3 - y1) * (y3 - y1));
+    const bool is_line = std::abs(d) < 1e-6f * chord * chord;
+    scalar xc = 0.f, yc = 0.f, radius = 0.f;
+    if (!is_line) {
+        const scalar s1 = x1 * x1 + y1 * y1;
+        const scalar s2 = x2 * x2 + y2 * y2;
+        const scalar s3 = x3 * x3 + y3 * y3;
+        xc = (s1 * (y2 - y3) + s2 * (y3 - y1) + s3 * (y1 - y2)) / d;
+        yc = (s1 * (x3 - x2) + s2 * (x1 - x3) + s3 * (x2 - x1)) / d;
+        radius =
+            algebra::math::sqrt((x1 - xc) * (x1 - xc) + (y1 - yc) * (y1 - yc));
+    }
+
+    // Slope of the seed in r-z, between its innermost and outermost
+    // spacepoints.
+    const scalar cot_theta =
+        (spT.z() - spB.z()) / (spT.radius() - spB.radius());
+
+    // The outermost spacepoint of the seed, updated as the seed grows.
+    scalar last_r = spT.radius(), last_z = spT.z(), last_phi = spT.phi();
+
+    // Add spacepoints to the seed one by one.
+    while (result.size() <
+           static_cast<std::size_t>(extension_config.max_seed_size)) {
+
+        const scalar min_r = last_r + extension_config.deltaRMin;
+        const scalar max_r = last_r + extension_config.deltaRMax;
+
+        // The grid bins around the seed's extrapolation, halfway along the
+        // radial search window.
+        const scalar z_guess =
+            last_z + cot_theta * 0.5f * (min_r + max_r - 2.f * last_r);
+        const detray::dindex_range phi_bins =
+            sp_grid.axis_p0().range(last_phi, finder_config.neighbor_scope);
+        const detray::dindex_range z_bins =
+            sp_grid.axis_p1().range(z_guess, finder_config.neighbor_scope);
+
+        // The best candidate found so far.
+        bool found = false;
+        unsigned int best_idx = 0;
+        scalar best_score = 0.f;
+
+        // Iterate over the neighbouring bins, the same way
+        // traccc::device::find_doublets does.
+        for (detray::dindex phi_bin_iterator = phi_bins[0];
+             phi_bin_iterator <=
+             (phi_bins[1] +
+              (phi_bins[0] > phi_bins[1] ? sp_grid.axis_p0().n_bins : 0));
+             ++phi_bin_iterator) {
+            const detray::dindex phi_bin =
+                (phi_bin_iterator >= sp_grid.axis_p0().n_bins
+                     ? phi_bin_iterator - sp_grid.axis_p0().n_bins
+                     : phi_bin_iterator);
+            for (detray::dindex z_bin = z_bins[0]; z_bin <= z_bins[1];
+                 ++z_bin) {
+                const unsigned int bin = sp_grid.bin_index(phi_bin, z_bin);
+
+                // The spacepoints of the bins are sorted by radius.
+                for (unsigned int i = sp_grid.bin_begin(bin);
+                     i < sp_grid.bin_end(bin); ++i) {
+
+                    const scalar r = sp_grid.radius[i];
+                    if (r < min_r) {
+                        continue;
+                    }
+                    if (r > max_r) {
+                        break;
+                    }
+
+                    // Residual in r-z.
+                    const scalar dz = std::abs(
+                        sp_grid.z[i] - (last_z + cot_theta * (r - last_r)));
+                    if (dz > extension_config.max_z_residual) {
+                        continue;
+                    }
+
+                    // Residual in the transverse plane.
+                    const scalar x = sp_grid.x[i], y = sp_grid.y[i];
+                    const scalar dxy =
+                        is_line
+                            ? std::abs((x3 - x1) * (y - y1) -
+                                       (y3 - y1) * (x - x1)) /
+                                  chord
+                            : std::abs(algebra::math::sqrt(
+                                           (x - xc) * (x - xc) +
+                                           (y - yc) * (y - yc)) -
+                                       radius);
+                    if (dxy > extension_config.max_xy_residual) {
+                        continue;
+                    }
+
+                    // Keep the candidate with the smallest normalised
+                    // residuals.
+                    const scalar nz = dz / extension_config.max_z_residual;
+                    const scalar nxy = dxy / extension_config.max_xy_residual;
+                    const scalar score = nz * nz + nxy * nxy;
+                    if (!found || score < best_score) {
+                        found = true;
+                        best_idx = i;
+                        best_score = score;
+                    }
+                }
+            }
+        }
+
+        // Stop if there is no compatible spacepoint.
+        if (!found) {
+            break;
+        }
+        result.push_back(sp_grid.link[best_idx]);
+        last_r = sp_grid.radius[best_idx];
+        last_z = sp_grid.z[best_idx];
+        last_phi = sp_grid.phi[best_idx];
+    }
+
+    // Record the result.
+    nseeds.at(globalIndex) = result;
+    if (result.size() >=
+        static_cast<std::size_t>(extension_config.min_seed_size)) {
+        kept_seeds.push_back(triplet);
+    }
+}
+
+}  // namespace traccc::device
@@ -1,6 +1,6 @@
 /** TRACCC library, part of the ACTS project (R&D line)
  *
- * (c) 2021-2023 CERN for the benefit of the ACTS project
+ * (c) 2021-2024 CERN for the benefit of the ACTS project
  *
  * Mozilla Public License Version 2.0
  */
@@ -18,10 +18,10 @@
 
 namespace traccc::device {
 
-TRACCC_HOST_DEVICE
-inline void find_doublets(
+template <typename seeding_config_t>
+TRACCC_HOST_DEVICE inline void find_doublets(
     const std::size_t globalIndex, const seedfinder_config& config,
-    const sp_grid_const_view& sp_view,
+    const sp_soa_grid_types::const_view& sp_view,
     const doublet_counter_collection_types::const_view& dc_view,
     device_doublet_collection_types::view mb_doublets_view,
     device_doublet_collection_types::view mt_doublets_view) {
@@ -37,15 +37,14 @@ inline void find_doublets(
     const doublet_counter middle_sp_counter = doublet_counts.at(globalIndex);
 
     // Set up the device containers.
-    const const_sp_grid_device sp_grid(sp_view);
+    const sp_soa_grid_types::const_device sp_grid(sp_view);
     device_doublet_collection_types::device mb_doublets(mb_doublets_view);
     device_doublet_collection_types::device mt_doublets(mt_doublets_view);
 
     // Get the spacepoint that we're evaluating in this thread, and treat that
     // as the "middle" spacepoint.
     const internal_spacepoint<spacepoint> middle_sp =
-        sp_grid.bin(middle_sp_counter.m_spM.bin_idx)
-            .at(middle_sp_counter.m_spM.sp_idx);
+        sp_grid.at(middle_sp_counter.m_spM);
 
     // Find the reference (start) index of the doublet container item vector,
     // where the doublets are recorded.
@@ -57,10 +56,12 @@ inline void find_doublets(
 
     // The the IDs of the neighbouring bins along the phi and Z axes of the
     // grid.
+    const darray<unsigned int, 2> neighbor_scope =
+        seeding_config_t::neighbor_scope(config);
     const detray::dindex_range phi_bins =
-        sp_grid.axis_p0().range(middle_sp.phi(), config.neighbor_scope);
+        sp_grid.axis_p0().range(middle_sp.phi(), neighbor_scope);
     const detray::dindex_range z_bins =
-        sp_grid.axis_p1().range(middle_sp.z(), config.neighbor_scope);
+        sp_grid.axis_p1().range(middle_sp.z(), neighbor_scope);
     assert(z_bins[0] <= z_bins[1]);
 
     // Iterate over all of the neighboring phi bins, including the same bin that
@@ -86,48 +87,70 @@ inline void find_doublets(
         // the Z axis does not "wrap around".
         for (detray::dindex z_bin = z_bins[0]; z_bin <= z_bins[1]; ++z_bin) {
 
-            // Ask the grid for all of the spacepoints in this specific bin.
-            typename const_sp_grid_device::serialized_storage::const_reference
-                spacepoints = sp_grid.bin(phi_bin, z_bin);
-
             // Construct the "single index" that refers to this phi-Z bin.
             const unsigned int other_bin_idx =
-                phi_bin + z_bin * sp_grid.axis_p0().bins();
-
-            const unsigned int size = spacepoints.size();
-            // Loop over all of those spacepoints.
-            for (unsigned int other_sp_idx = 0; other_sp_idx < size;
-                 ++other_sp_idx) {
+                sp_grid.bin_index(phi_bin, z_bin);
+            const unsigned int other_bin_begin =
+                sp_grid.bin_begin(other_bin_idx);
+
+            const compressed_rz_bin cbin =
+                sp_grid.compressed_bin(other_bin_idx);
+
+            // Loop over the spacepoints of the bin, in the same way as
+            // traccc::device::count_doublets does.
+            const darray<unsigned int, 2> window =
+                doublet_finding_helper::radiusWindow(
+                    sp_grid.radius, other_bin_begin,
+                    sp_grid.bin_end(other_bin_idx), middle_sp.radius(),
+                    config);
+            for (unsigned int i = window[0]; i < window[1]; ++i) {
+
+                if (config.useCompressedGrid) {
+                    const compressed_preselection pre =
+                        doublet_finding_helper::preselect(
+                            middle_sp, cbin.decompress(sp_grid.rz[i]), config);
+                    if (pre == compressed_preselection::skip) {
+                        continue;
+                    } else if (pre == compressed_preselection::stop) {
+                        break;
+                    }
+                }
 
-                // Access the "other spacepoint".
-                const internal_spacepoint<spacepoint> other_sp =
-                    spacepoints.at(other_sp_idx);
+                const scalar other_r = sp_grid.radius[i];
+                const scalar other_z = sp_grid.z[i];
 
                 // Check if this spacepoint is a compatible "bottom" spacepoint
-                // to the thread's "middle" spacepoint.
-                if (doublet_finding_helper::isCompatible<
-                        details::spacepoint_type::bottom>(middle_sp, other_sp,
-                                                          config)) {
+                // to the thread's "middle" spacepoint, as long as the counter
+                // has room for it.
+                if ((mid_bot_idx < middle_sp_counter.m_nMidBot) &&
+                    doublet_finding_helper::isCompatible<
+                        details::spacepoint_type::bottom>(middle_sp, other_r,
+                                                          other_z, config)) {
 
                     // Add it as a candidate to the middle-bottom container.
+                    // (The buffer may be smaller than the doublet count when
+                    // running with bounded capacities.)
                     const unsigned int pos = mid_bot_start_idx + mid_bot_idx++;
-                    assert(pos < mb_doublets.size());
-                    mb_doublets.at(pos) = {
-                        {other_bin_idx, other_sp_idx},
-                        static_cast<unsigned int>(globalIndex)};
+                    if (pos < mb_doublets.size()) {
+                        mb_doublets.at(pos) = {
+                            i, static_cast<unsigned int>(globalIndex)};
+                    }
                 }
                 // Check if this spacepoint is a compatible "top" spacepoint to
                 // the thread's "middle" spacepoint.
-                if (doublet_finding_helper::isCompatible<
-                        details::spacepoint_type::top>(middle_sp, other_sp,
-                                                       config)) {
+                if ((mid_top_idx < middle_sp_counter.m_nMidTop) &&
+                    doublet_finding_helper::isCompatible<
+                        details::spacepoint_type::top>(middle_sp, other_r,
+                                                       other_z, config)) {
 
                     // Add it as a candidate to the middle-top container.
+                    // (The buffer may be smaller than the doublet count when
+                    // running with bounded capacities.)
                     const unsigned int pos = mid_top_start_idx + mid_top_idx++;
-                    assert(pos < mt_doublets.size());
-                    mt_doublets.at(pos) = {
-                        {other_bin_idx, other_sp_idx},
-                        static_cast<unsigned int>(globalIndex)};
+                    if (pos < mt_doublets.size()) {
+                        mt_doublets.at(pos) = {
+                            i, static_cast<unsigned int>(globalIndex)};
+                    }
                 }
             }
         }
@@ -1,6 +1,6 @@
 /** TRACCC library, part of the ACTS project (R&D line)
  *
- * (c) 2021-2023 CERN for the benefit of the ACTS project
+ * (c) 2021-2024 CERN for the benefit of the ACTS project
  *
  * Mozilla Public License Version 2.0
  */
@@ -8,22 +8,29 @@
 #pragma once
 
 // Project include(s).
+#include "traccc/seeding/doublet_finding_helper.hpp"
 #include "traccc/seeding/triplet_finding_helper.hpp"
 
 // VecMem include(s).
+#include <vecmem/containers/device_vector.hpp>
 #include <vecmem/memory/device_atomic_ref.hpp>
 
+// System include(s).
+#include <algorithm>
+
 namespace traccc::device {
 
 TRACCC_HOST_DEVICE
 inline void find_triplets(
     const std::size_t globalIndex, const seedfinder_config& config,
-    const seedfilter_config& filter_config, const sp_grid_const_view& sp_view,
+    const seedfilter_config& filter_config,
+    const sp_soa_grid_types::const_view& sp_view,
     const doublet_counter_collection_types::const_view& dc_view,
     const device_doublet_collection_types::const_view& mid_top_doublet_view,
     const triplet_counter_spM_collection_types::const_view& spM_tc_view,
     const triplet_counter_collection_types::const_view& tc_view,
-    device_triplet_collection_types::view triplet_view) {
+    device_triplet_collection_types::view triplet_view,
+    const unsigned int tiled_mid_top_capacity) {
 
     // Check if anything needs to be done.
     const triplet_counter_collection_types::const_device triplet_counts(
@@ -37,7 +44,7 @@ inline void find_triplets(
         dc_view);
     const device_doublet_collection_types::const_device mid_top_doublet_device(
         mid_top_doublet_view);
-    const const_sp_grid_device sp_grid(sp_view);
+    const sp_soa_grid_types::const_device sp_grid(sp_view);
     const triplet_counter_spM_collection_types::const_device triplet_counts_spM(
         spM_tc_view);
 
@@ -48,16 +55,30 @@ inline void find_triplets(
     const doublet_counter doublet_count =
         doublet_counts.at(mid_bot_counter.spM_counter_link);
 
-    const sp_location spM_loc = spM_counter.spM;
-    const sp_location spB_loc = mid_bot_counter.spB;
+    // find the reference (start) index of the mid-top doublet collection
+    // item vector, where the doublets are recorded
+    const unsigned int mt_start_idx = doublet_count.m_posMidTop;
+    // (Clamped to the size of the doublet collection, which may be smaller
+    // than the doublet count when running with bounded capacities.)
+    const unsigned int mt_end_idx =
+        std::min(mt_start_idx + doublet_count.m_nMidTop,
+                 mid_top_doublet_device.size());
+
+    // Leave the middle spacepoints of the tiled triplet finding alone.
+    if (mt_end_idx <= mt_start_idx + tiled_mid_top_capacity) {
+        return;
+    }
+
+    const unsigned int spM_loc = spM_counter.spM;
+    const unsigned int spB_loc = mid_bot_counter.spB;
 
     // middle spacepoint
     const traccc::internal_spacepoint<traccc::spacepoint> spM =
-        sp_grid.bin(spM_loc.bin_idx)[spM_loc.sp_idx];
+        sp_grid.at(spM_loc);
 
     // bottom spacepoint
     const traccc::internal_spacepoint<traccc::spacepoint> spB =
-        sp_grid.bin(spB_loc.bin_idx)[spB_loc.sp_idx];
+        sp_grid.at(spB_loc);
 
     // Set up the device result collection
     device_triplet_collection_types::device triplets(triplet_view);
@@ -77,10 +98,6 @@ inline void find_triplets(
     // triplet_finding_helper::isCompatible but their values are irrelevant
     scalar curvature, impact_parameter;
 
-    // find the reference (start) index of the mid-top doublet collection
-    // item vector, where the doublets are recorded
-    const unsigned int mt_start_idx = doublet_count.m_posMidTop;
-    const unsigned int mt_end_idx = mt_start_idx + doublet_count.m_nMidTop;
     // The position in which these triplets should be filled is the sum of the
     // position for all triplets which share the same middle spacepoint
     // and the one for those which also share the same bottom spacepoint.
@@ -89,10 +106,10 @@ inline void find_triplets(
 
     // iterate over mid-top doublets
     for (unsigned int i = mt_start_idx; i < mt_end_idx; ++i) {
-        const sp_location spT_loc = mid_top_doublet_device[i].sp2;
+        const unsigned int spT_loc = mid_top_doublet_device[i].sp2;
 
         const traccc::internal_spacepoint<traccc::spacepoint> spT =
-            sp_grid.bin(spT_loc.bin_idx)[spT_loc.sp_idx];
+            sp_grid.at(spT_loc);
 
         // Apply the conformal transformation to middle-top doublet
         const traccc::lin_circle lt =
@@ -104,11 +121,145 @@ inline void find_triplets(
                 spM, lb, lt, config, iSinTheta2, scatteringInRegion2, curvature,
                 impact_parameter)) {
 
-            // Add triplet to jagged vector
-            triplets.at(posTriplets++) = device_triplet(
-                {spT_loc, static_cast<unsigned int>(globalIndex), curvature,
-                 -impact_parameter * filter_config.impactWeightFactor,
-                 lb.Zo()});
+            // Add triplet to jagged vector, if it fits into it
+            if (posTriplets < triplets.size()) {
+                triplets.at(posTriplets) = device_triplet(
+                    {spT_loc, static_cast<unsigned int>(globalIndex),
+                     curvature,
+                     -impact_parameter * filter_config.impactWeightFactor,
+                     lb.Zo()});
+            }
+            ++posTriplets;
+        }
+    }
+}
+
+template <typename barrier_t>
+TRACCC_HOST_DEVICE inline void find_triplets_tiled(
+    const unsigned int threadIndex, const unsigned int blockSize,
+    const unsigned int blockIndex, const seedfinder_config& config,
+    const seedfilter_config& filter_config,
+    const sp_soa_grid_types::const_view& sp_view,
+    const doublet_counter_collection_types::const_view& dc_view,
+    const device_doublet_collection_types::const_view& mid_bot_doublet_view,
+    const device_doublet_collection_types::const_view& mid_top_doublet_view,
+    const triplet_counter_spM_collection_types::const_view& spM_tc_view,
+    const triplet_counter_collection_types::const_view& tc_view,
+    const vecmem::data::vector_view<const unsigned int>& tc_links_view,
+    lin_circle* tile_circles, unsigned int* tile_locations,
+    const unsigned int tile_size, barrier_t& barrier,
+    device_triplet_collection_types::view triplet_view) {
+
+    // Check if anything needs to be done. (All of these decisions are the
+    // same for all threads of the block.)
+    const doublet_counter_collection_types::const_device doublet_counts(
+        dc_view);
+    if (blockIndex >= doublet_counts.size()) {
+        return;
+    }
+    const triplet_counter_spM_collection_types::const_device triplet_counts_spM(
+        spM_tc_view);
+    const triplet_counter_spM spM_counter = triplet_counts_spM.at(blockIndex);
+    if (spM_counter.m_nTriplets == 0u) {
+        return;
+    }
+
+    // Get device copy of input parameters
+    const device_doublet_collection_types::const_device mid_bot_doublet_device(
+        mid_bot_doublet_view);
+    const device_doublet_collection_types::const_device mid_top_doublet_device(
+        mid_top_doublet_view);
+    const sp_soa_grid_types::const_device sp_grid(sp_view);
+    const triplet_counter_collection_types::const_device triplet_counts(
+        tc_view);
+    const vecmem::device_vector<const unsigned int> tc_links(tc_links_view);
+
+    // The doublets of the middle spacepoint, clamped to the sizes of the
+    // doublet collections like in the other kernels.
+    const doublet_counter doublet_count = doublet_counts.at(blockIndex);
+    const unsigned int mt_start_idx = doublet_count.m_posMidTop;
+    const unsigned int mt_end_idx =
+        std::min(mt_start_idx + doublet_count.m_nMidTop,
+                 mid_top_doublet_device.size());
+    const unsigned int n_tops =
+        (mt_end_idx > mt_start_idx ? mt_end_idx - mt_start_idx : 0u);
+    if (n_tops == 0u || n_tops > tile_size) {
+        return;
+    }
+    const unsigned int mb_start_idx = doublet_count.m_posMidBot;
+    const unsigned int mb_end_idx = std::min(
+        mb_start_idx + doublet_count.m_nMidBot,
+        std::min(mid_bot_doublet_device.size(), tc_links.size()));
+
+    // middle spacepoint
+    const traccc::internal_spacepoint<traccc::spacepoint> spM =
+        sp_grid.at(spM_counter.spM);
+
+    // Transform the mid-top doublets into the tile, cooperatively.
+    for (unsigned int i = threadIndex; i < n_tops; i += blockSize) {
+        const unsigned int spT_loc =
+            mid_top_doublet_device[mt_start_idx + i].sp2;
+        tile_locations[i] = spT_loc;
+        tile_circles[i] = doublet_finding_helper::transform_coordinates<
+            details::spacepoint_type::top>(spM, sp_grid.at(spT_loc));
+    }
+    barrier.blockBarrier();
+
+    // Set up the device result collection
+    device_triplet_collection_types::device triplets(triplet_view);
+
+    // iterate over the mid-bot doublets, one per thread
+    for (unsigned int j = mb_start_idx + threadIndex; j < mb_end_idx;
+         j += blockSize) {
+
+        // Skip the doublets without any triplets.
+        const unsigned int tc_link = tc_links.at(j);
+        if (tc_link == triplet_counter_invalid_link) {
+            continue;
+        }
+        const triplet_counter mid_bot_counter = triplet_counts.at(tc_link);
+
+        // bottom spacepoint
+        const traccc::internal_spacepoint<traccc::spacepoint> spB =
+            sp_grid.at(mid_bot_counter.spB);
+
+        // Apply the conformal transformation to middle-bot doublet
+        const traccc::lin_circle lb =
+            doublet_finding_helper::transform_coordinates<
+                details::spacepoint_type::bottom>(spM, spB);
+
+        // Calculate some physical quantities required for triplet
+        // compatibility check
+        const scalar iSinTheta2 = 1 + lb.cotTheta() * lb.cotTheta();
+        const scalar scatteringInRegion2 =
+            config.maxScatteringAngle2 * iSinTheta2 * config.sigmaScattering *
+            config.sigmaScattering;
+
+        // These two quantities are used as output parameters in
+        // triplet_finding_helper::isCompatible
+        scalar curvature, impact_parameter;
+
+        // The position in which these triplets should be filled
+        unsigned int posTriplets =
+            mid_bot_counter.posTriplets + spM_counter.posTriplets;
+
+        // iterate over the tile of mid-top doublets
+        for (unsigned int i = 0u; i < n_tops; ++i) {
+
+            // Check if mid-bot and mid-top doublets can form a triplet
+            if (triplet_finding_helper::isCompatible(
+                    spM, lb, tile_circles[i], config, iSinTheta2,
+                    scatteringInRegion2, curvature, impact_parameter)) {
+
+                // Add triplet to jagged vector, if it fits into it
+                if (posTriplets < triplets.size()) {
+                    triplets.at(posTriplets) = device_triplet(
+                        {tile_locations[i], tc_link, curvature,
+                         -impact_parameter * filter_config.impactWeightFactor,
+                         lb.Zo()});
+                }
+                ++posTriplets;
+            }
         }
     }
 }
@@ -0,0 +1,179 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s).
+#include "traccc/seeding/hough_transform_helper.hpp"
+
+// VecMem include(s).
+#include <vecmem/containers/device_vector.hpp>
+#include <vecmem/memory/device_atomic_ref.hpp>
+
+namespace traccc::device {
+namespace details {
+
+/// Atomically lower a key to (at most) a given value
+TRACCC_DEVICE inline void hough_key_min(unsigned long long& key,
+                                        unsigned long long value) {
+    vecmem::device_atomic_ref<unsigned long long> ref(key);
+    unsigned long long current = ref.load();
+    while ((value < current) && !ref.compare_exchange_strong(current, value)) {
+    }
+}
+
+}  // namespace details
+
+TRACCC_DEVICE inline void fill_hough_accumulator(
+    std::size_t globalIndex, const hough_seeding_config& config,
+    spacepoint_collection_types::const_view spacepoints_view,
+    vecmem::data::vector_view<unsigned int> masks_view) {
+
+    const spacepoint_collection_types::const_device spacepoints(
+        spacepoints_view);
+    if (globalIndex >= spacepoints.size()) {
+        return;
+    }
+    vecmem::device_vector<unsigned int> masks(masks_view);
+
+    const spacepoint& sp = spacepoints.at(globalIndex);
+    const unsigned int bit =
+        1u << hough_transform_helper::layer(
+            config, hough_transform_helper::radius(config, sp));
+    hough_transform_helper::for_each_cell(
+        config, sp, [&](unsigned int cell) {
+            vecmem::device_atomic_ref<unsigned int>(masks.at(cell))
+                .fetch_or(bit);
+        });
+}
+
+TRACCC_DEVICE inline void find_hough_candidates(
+    std::size_t globalIndex, const hough_seeding_config& config,
+    vecmem::data::vector_view<const unsigned int> masks_view,
+    vecmem::data::vector_view<unsigned int> candidates_view,
+    vecmem::data::vector_view<unsigned int> candidate_links_view) {
+
+    const vecmem::device_vector<const unsigned int> masks(masks_view);
+    if (globalIndex >= masks.size()) {
+        return;
+    }
+    const unsigned int cell = static_cast<unsigned int>(globalIndex);
+    if (!hough_transform_helper::is_seed_cell(config, cell, masks)) {
+        return;
+    }
+
+    vecmem::device_vector<unsigned int> candidates(candidates_view);
+    vecmem::device_vector<unsigned int> candidate_links(candidate_links_view);
+    candidate_links.at(cell) =
+        static_cast<unsigned int>(candidates.push_back(cell)) + 1u;
+}
+
+TRACCC_DEVICE inline void find_hough_edges(
+    std::size_t globalIndex, const hough_seeding_config& config,
+    spacepoint_collection_types::const_view spacepoints_view,
+    vecmem::data::vector_view<const unsigned int> candidate_links_view,
+    vecmem::data::vector_view<unsigned long long> bottom_view,
+    vecmem::data::vector_view<unsigned long long> top_view) {
+
+    const spacepoint_collection_types::const_device spacepoints(
+        spacepoints_view);
+    if (globalIndex >= spacepoints.size()) {
+        return;
+    }
+    const vecmem::device_vector<const unsigned int> candidate_links(
+        candidate_links_view);
+    vecmem::device_vector<unsigned long long> bottom(bottom_view);
+    vecmem::device_vector<unsigned long long> top(top_view);
+
+    const spacepoint& sp = spacepoints.at(globalIndex);
+    const unsigned int index = static_cast<unsigned int>(globalIndex);
+    hough_transform_helper::for_each_cell(
+        config, sp, [&](unsigned int cell) {
+            const unsigned int link = candidate_links.at(cell);
+            if (link != 0u) {
+                details::hough_key_min(
+                    bottom.at(link - 1u),
+                    hough_transform_helper::bottom_key(config, cell, sp,
+                                                       index));
+                details::hough_key_min(
+                    top.at(link - 1u),
+                    hough_transform_helper::top_key(config, cell, sp, index));
+            }
+        });
+}
+
+TRACCC_DEVICE inline void find_hough_middles(
+    std::size_t globalIndex, const hough_seeding_config& config,
+    spacepoint_collection_types::const_view spacepoints_view,
+    vecmem::data::vector_view<const unsigned int> candidate_links_view,
+    vecmem::data::vector_view<const unsigned long long> bottom_view,
+    vecmem::data::vector_view<const unsigned long long> top_view,
+    vecmem::data::vector_view<unsigned long long> middle_view) {
+
+    const spacepoint_collection_types::const_device spacepoints(
+        spacepoints_view);
+    if (globalIndex >= spacepoints.size()) {
+        return;
+    }
+    const vecmem::device_vector<const unsigned int> candidate_links(
+        candidate_links_view);
+    const vecmem::device_vector<const unsigned long long> bottom(bottom_view);
+    const vecmem::device_vector<const unsigned long long> top(top_view);
+    vecmem::device_vector<unsigned long long> middle(middle_view);
+
+    const spacepoint& sp = spacepoints.at(globalIndex);
+    hough_transform_helper::for_each_cell(
+        config, sp, [&](unsigned int cell) {
+            const unsigned int link = candidate_links.at(cell);
+            if (link == 0u) {
+                return;
+            }
+            const unsigned long long key = hough_transform_helper::middle_key(
+                config, cell, sp, static_cast<unsigned int>(globalIndex),
+                spacepoints.at(
+                    hough_transform_helper::key_link(bottom.at(link - 1u))),
+                spacepoints.at(
+                    hough_transform_helper::key_link(top.at(link - 1u))));
+            if (key != hough_transform_helper::invalid_key) {
+                details::hough_key_min(middle.at(link - 1u), key);
+            }
+        });
+}
+
+TRACCC_DEVICE inline void make_hough_seeds(
+    std::size_t globalIndex, const hough_seeding_config& config,
+    spacepoint_collection_types::const_view spacepoints_view,
+    vecmem::data::vector_view<const unsigned int> masks_view,
+    vecmem::data::vector_view<const unsigned int> candidates_view,
+    vecmem::data::vector_view<const unsigned long long> bottom_view,
+    vecmem::data::vector_view<const unsigned long long> middle_view,
+    vecmem::data::vector_view<const unsigned long long> top_view,
+    seed_collection_types::view seeds_view) {
+
+    const vecmem::device_vector<const unsigned int> candidates(
+        candidates_view);
+    if (globalIndex >= candidates.size()) {
+        return;
+    }
+    const spacepoint_collection_types::const_device spacepoints(
+        spacepoints_view);
+    const vecmem::device_vector<const unsigned int> masks(masks_view);
+    const vecmem::device_vector<const unsigned long long> bottom(bottom_view);
+    const vecmem::device_vector<const unsigned long long> middle(middle_view);
+    const vecmem::device_vector<const unsigned long long> top(top_view);
+
+    seed s;
+    if (hough_transform_helper::make_seed(
+            config, spacepoints, bottom.at(globalIndex),
+            middle.at(globalIndex), top.at(globalIndex),
+            masks.at(candidates.at(globalIndex)), s)) {
+        seed_collection_types::device seeds(seeds_view);
+        seeds.push_back(s);
+    }
+}
+
+}  // namespace traccc::device
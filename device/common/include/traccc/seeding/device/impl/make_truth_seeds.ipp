@@ -0,0 +1,37 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s).
+#include "traccc/utils/truth_seed.hpp"
+
+namespace traccc::device {
+
+template <typename detector_t>
+TRACCC_HOST_DEVICE inline void make_truth_seeds(
+    std::size_t globalIndex, typename detector_t::view_type det_data,
+    truth_seed_input_collection_types::const_view inputs_view,
+    const std::array<scalar, e_bound_size>& stddevs, std::uint64_t seed,
+    std::uint64_t event,
+    bound_track_parameters_collection_types::view seeds_view) {
+
+    const truth_seed_input_collection_types::const_device inputs(inputs_view);
+    if (globalIndex >= inputs.size()) {
+        return;
+    }
+
+    const detector_t det(det_data);
+    bound_track_parameters_collection_types::device seeds(seeds_view);
+
+    const truth_seed_input& input = inputs.at(globalIndex);
+    bound_track_parameters& param = seeds.at(globalIndex);
+    param = details::make_truth_seed(det, input.surface_link, input.free_param);
+    details::smear_truth_seed(param, stddevs, seed, event, globalIndex);
+}
+
+}  // namespace traccc::device
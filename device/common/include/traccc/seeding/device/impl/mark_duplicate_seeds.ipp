@@ -0,0 +1,71 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s).
+#include "traccc/seeding/seed_selection_helper.hpp"
+
+// VecMem include(s).
+#include <vecmem/containers/device_vector.hpp>
+
+namespace traccc::device {
+
+TRACCC_HOST_DEVICE
+inline void mark_duplicate_seeds(
+    const std::size_t globalIndex, const seed_selection_config& config,
+    vecmem::data::vector_view<const std::uint64_t> keys_view,
+    vecmem::data::vector_view<const unsigned int> order_view,
+    const seed_collection_types::const_view& seeds_view,
+    const bound_track_parameters_collection_types::const_view& params_view,
+    vecmem::data::vector_view<unsigned int> removed_view) {
+
+    // Check if anything needs to be done.
+    const vecmem::device_vector<const std::uint64_t> keys(keys_view);
+    if (globalIndex >= keys.size()) {
+        return;
+    }
+
+    const vecmem::device_vector<const unsigned int> order(order_view);
+    const seed_collection_types::const_device seeds(seeds_view);
+    const bound_track_parameters_collection_types::const_device params(
+        params_view);
+    vecmem::device_vector<unsigned int> removed(removed_view);
+
+    // The seed handled by this thread.
+    const unsigned int pos = static_cast<unsigned int>(globalIndex);
+    const unsigned int index = order.at(pos);
+    const seed& this_seed = seeds.at(index);
+    const bound_track_parameters& this_params = params.at(index);
+    const std::uint64_t key = keys.at(pos);
+
+    // Look for a better, compatible seed among the neighbours with the same
+    // pair of spacepoints, in both directions.
+    for (unsigned int i = 1u; i <= config.max_duplicate_candidates; ++i) {
+        const bool has_previous = (pos >= i) && (keys.at(pos - i) == key);
+        const bool has_next =
+            (pos + i < keys.size()) && (keys.at(pos + i) == key);
+        if (!(has_previous || has_next)) {
+            break;
+        }
+        for (unsigned int direction = 0u; direction < 2u; ++direction) {
+            if (!((direction == 0u) ? has_previous : has_next)) {
+                continue;
+            }
+            const unsigned int other =
+                order.at((direction == 0u) ? (pos - i) : (pos + i));
+            if (seed_selection_helper::is_duplicate_of(
+                    config, this_seed, index, this_params, seeds.at(other),
+                    other, params.at(other))) {
+                removed.at(index) = 1u;
+                return;
+            }
+        }
+    }
+}
+
+}  // namespace traccc::device
@@ -0,0 +1,98 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s).
+#include "traccc/device/bitmask.hpp"
+#include "traccc/finding/device/mark_used_measurements.hpp"
+
+// VecMem include(s).
+#include <vecmem/containers/device_vector.hpp>
+
+namespace traccc::device {
+
+TRACCC_DEVICE inline void mark_used_spacepoints(
+    std::size_t globalIndex,
+    spacepoint_collection_types::const_view spacepoints_view,
+    measurement_collection_types::const_view measurements_view,
+    vecmem::data::vector_view<const unsigned int> used_measurements_view,
+    vecmem::data::vector_view<unsigned int> used_spacepoints_view) {
+
+    const spacepoint_collection_types::const_device spacepoints(
+        spacepoints_view);
+    if (globalIndex >= spacepoints.size()) {
+        return;
+    }
+
+    const measurement_collection_types::const_device measurements(
+        measurements_view);
+    const vecmem::device_vector<const unsigned int> used_measurements(
+        used_measurements_view);
+
+    const unsigned int meas_idx =
+        find_measurement(measurements, spacepoints.at(globalIndex).meas);
+    if ((meas_idx < measurements.size()) &&
+        bitmask_test(used_measurements, meas_idx)) {
+        vecmem::device_vector<unsigned int> used_spacepoints(
+            used_spacepoints_view);
+        bitmask_set(used_spacepoints, static_cast<unsigned int>(globalIndex));
+    }
+}
+
+TRACCC_HOST_DEVICE inline void count_masked_grid_bin(
+    std::size_t globalIndex, sp_soa_grid_types::const_view grid_view,
+    vecmem::data::vector_view<const unsigned int> used_spacepoints_view,
+    vecmem::data::vector_view<unsigned int> bin_sizes_view) {
+
+    const sp_soa_grid_types::const_device grid(grid_view);
+    if (globalIndex >= grid.nbins()) {
+        return;
+    }
+
+    const vecmem::device_vector<const unsigned int> used_spacepoints(
+        used_spacepoints_view);
+    const unsigned int bin = static_cast<unsigned int>(globalIndex);
+    unsigned int n_unused = 0u;
+    for (unsigned int i = grid.bin_begin(bin); i < grid.bin_end(bin); ++i) {
+        if (!bitmask_test(used_spacepoints, grid.link[i])) {
+            ++n_unused;
+        }
+    }
+
+    vecmem::device_vector<unsigned int> bin_sizes(bin_sizes_view);
+    bin_sizes.at(bin) = n_unused;
+}
+
+TRACCC_HOST_DEVICE inline void fill_masked_grid_bin(
+    std::size_t globalIndex, sp_soa_grid_types::const_view grid_view,
+    vecmem::data::vector_view<const unsigned int> used_spacepoints_view,
+    sp_soa_grid_types::view masked_grid_view) {
+
+    const sp_soa_grid_types::const_device grid(grid_view);
+    if (globalIndex >= grid.nbins()) {
+        return;
+    }
+
+    const vecmem::device_vector<const unsigned int> used_spacepoints(
+        used_spacepoints_view);
+    sp_soa_grid_types::device masked_grid(masked_grid_view);
+
+    // Copy the unused spacepoints of the bin, keeping their order.
+    const unsigned int bin = static_cast<unsigned int>(globalIndex);
+    unsigned int pos = masked_grid.bin_begin(bin);
+    for (unsigned int i = grid.bin_begin(bin); i < grid.bin_end(bin); ++i) {
+        if (!bitmask_test(used_spacepoints, grid.link[i])) {
+            masked_grid.set(pos++, grid.at(i));
+        }
+    }
+
+    // The reference radius of the bin may have changed.
+    compress_grid_bin(masked_grid, bin);
+}
+
+}  // namespace traccc::device
@@ -0,0 +1,48 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s).
+#include "traccc/seeding/device/select_sector_spacepoints.hpp"
+
+// VecMem include(s).
+#include <vecmem/containers/device_vector.hpp>
+
+namespace traccc::device {
+
+TRACCC_HOST_DEVICE
+inline void merge_sector_seeds(
+    const std::size_t globalIndex,
+    const seed_collection_types::const_view& sector_seeds_view,
+    const spacepoint_collection_types::const_view& sector_spacepoints_view,
+    const vecmem::data::vector_view<const unsigned int>& indices_view,
+    const unsigned int sector, const unsigned int n_sectors,
+    seed_collection_types::view seeds_view) {
+
+    // Check if anything needs to be done.
+    const seed_collection_types::const_device sector_seeds(sector_seeds_view);
+    if (globalIndex >= sector_seeds.size()) {
+        return;
+    }
+
+    // Only keep the seeds owned by this sector.
+    const seed s = sector_seeds.at(globalIndex);
+    const spacepoint_collection_types::const_device sector_spacepoints(
+        sector_spacepoints_view);
+    if (phi_sector(sector_spacepoints.at(s.spM_link), n_sectors) != sector) {
+        return;
+    }
+
+    // Point the seed to the spacepoints of the full event.
+    const vecmem::device_vector<const unsigned int> indices(indices_view);
+    seed_collection_types::device seeds(seeds_view);
+    seeds.push_back({indices.at(s.spB_link), indices.at(s.spM_link),
+                     indices.at(s.spT_link), s.weight, s.z_vertex});
+}
+
+}  // namespace traccc::device
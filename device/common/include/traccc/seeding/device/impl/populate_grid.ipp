@@ -1,6 +1,6 @@
 /** TRACCC library, part of the ACTS project (R&D line)
  *
- * (c) 2021-2022 CERN for the benefit of the ACTS project
+ * (c) 2021-2024 CERN for the benefit of the ACTS project
  *
  * Mozilla Public License Version 2.0
  */
@@ -10,13 +10,20 @@
 // Project include(s).
 #include "traccc/seeding/spacepoint_binning_helper.hpp"
 
+// VecMem include(s).
+#include <vecmem/memory/device_atomic_ref.hpp>
+
+// System include(s).
+#include <cassert>
+
 namespace traccc::device {
 
 TRACCC_HOST_DEVICE
 inline void populate_grid(
     unsigned int globalIndex, const seedfinder_config& config,
     const spacepoint_collection_types::const_view& spacepoints_view,
-    sp_grid_view grid_view) {
+    sp_soa_grid_types::view grid_view,
+    vecmem::data::vector_view<unsigned int> bin_cursors_view) {
 
     // Check if anything needs to be done.
     const spacepoint_collection_types::const_device spacepoints(
@@ -30,18 +37,26 @@ inline void populate_grid(
     if (is_valid_sp(config, sp) != detray::detail::invalid_value<size_t>()) {
 
         // Set up the spacepoint grid object(s).
-        sp_grid_device grid(grid_view);
-        const sp_grid_device::axis_p0_type& phi_axis = grid.axis_p0();
-        const sp_grid_device::axis_p1_type& z_axis = grid.axis_p1();
+        sp_soa_grid_types::device grid(grid_view);
+        const sp_soa_grid_axis_p0_type& phi_axis = grid.axis_p0();
+        const sp_soa_grid_axis_p1_type& z_axis = grid.axis_p1();
 
         // Find the grid bin that the spacepoint belongs to.
         const internal_spacepoint<spacepoint> isp(sp, globalIndex,
                                                   config.beamPos);
-        const std::size_t bin_index =
-            phi_axis.bin(isp.phi()) + phi_axis.bins() * z_axis.bin(isp.z());
+        const unsigned int bin_index =
+            grid.bin_index(static_cast<unsigned int>(phi_axis.bin(isp.phi())),
+                           static_cast<unsigned int>(z_axis.bin(isp.z())));
+
+        // Reserve a slot for the spacepoint in its bin.
+        vecmem::device_vector<unsigned int> bin_cursors(bin_cursors_view);
+        vecmem::device_atomic_ref<unsigned int> bin_cursor(
+            bin_cursors[bin_index]);
+        const unsigned int pos = bin_cursor.fetch_add(1);
+        assert(pos < grid.bin_size(bin_index));
 
         // Add the spacepoint to the grid.
-        grid.bin(bin_index).push_back(std::move(isp));
+        grid.set(grid.bin_begin(bin_index) + pos, isp);
     }
 }
 
@@ -1,6 +1,6 @@
 /** TRACCC library, part of the ACTS project (R&D line)
  *
- * (c) 2023 CERN for the benefit of the ACTS project
+ * (c) 2023-2024 CERN for the benefit of the ACTS project
  *
  * Mozilla Public License Version 2.0
  */
@@ -26,11 +26,15 @@ inline void reduce_triplet_counts(
         return;
     }
 
+    // The spM counter collection may have been allocated for the maximal
+    // number of middle spacepoints, so only use the counters that belong to
+    // an actual middle spacepoint.
     const doublet_counter_collection_types::const_device doublet_counts(
         dc_view);
-
-    // This should only ever be called with two collections of equal size
-    assert(doublet_counts.size() == spM_counts.size());
+    assert(doublet_counts.size() <= spM_counts.size());
+    if (globalIndex >= doublet_counts.size()) {
+        return;
+    }
 
     // Get triplet counter for this middle spacepoint
     triplet_counter_spM& this_spM_counter = spM_counts.at(globalIndex);
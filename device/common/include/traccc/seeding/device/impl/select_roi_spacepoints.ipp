@@ -0,0 +1,38 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+namespace traccc::device {
+
+TRACCC_HOST_DEVICE
+inline void select_roi_spacepoints(
+    const std::size_t globalIndex,
+    const spacepoint_collection_types::const_view& spacepoints_view,
+    const region_of_interest_collection_types::const_view& rois_view,
+    spacepoint_collection_types::view selected_view) {
+
+    // Check if anything needs to be done.
+    const spacepoint_collection_types::const_device spacepoints(
+        spacepoints_view);
+    if (globalIndex >= spacepoints.size()) {
+        return;
+    }
+
+    // Check the spacepoint against all regions.
+    const spacepoint sp = spacepoints.at(globalIndex);
+    const region_of_interest_collection_types::const_device rois(rois_view);
+    for (const region_of_interest& roi : rois) {
+        if (roi.contains(sp.global)) {
+            spacepoint_collection_types::device selected(selected_view);
+            selected.push_back(sp);
+            return;
+        }
+    }
+}
+
+}  // namespace traccc::device
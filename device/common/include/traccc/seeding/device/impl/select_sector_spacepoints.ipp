@@ -0,0 +1,72 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Algebra plugins include(s).
+#include <algebra/math/common.hpp>
+
+// VecMem include(s).
+#include <vecmem/containers/device_vector.hpp>
+
+// System include(s).
+#include <cmath>
+
+namespace traccc::device {
+
+TRACCC_HOST_DEVICE
+inline unsigned int phi_sector(const spacepoint& sp,
+                               const unsigned int n_sectors) {
+
+    const scalar width = 2.f * static_cast<scalar>(M_PI) / n_sectors;
+    const scalar phi = algebra::math::atan2(sp.y(), sp.x());
+    const scalar pos = (phi + static_cast<scalar>(M_PI)) / width;
+    if (pos <= 0.f) {
+        return 0u;
+    }
+    const unsigned int sector = static_cast<unsigned int>(pos);
+    return (sector < n_sectors) ? sector : n_sectors - 1u;
+}
+
+TRACCC_HOST_DEVICE
+inline void select_sector_spacepoints(
+    const std::size_t globalIndex,
+    const spacepoint_collection_types::const_view& spacepoints_view,
+    const unsigned int sector, const unsigned int n_sectors,
+    const scalar overlap, spacepoint_collection_types::view selected_view,
+    vecmem::data::vector_view<unsigned int> indices_view) {
+
+    // Check if anything needs to be done.
+    const spacepoint_collection_types::const_device spacepoints(
+        spacepoints_view);
+    if (globalIndex >= spacepoints.size()) {
+        return;
+    }
+
+    // The distance in phi of the spacepoint from the centre of the sector,
+    // in the range [-pi, pi).
+    const scalar pi = static_cast<scalar>(M_PI);
+    const scalar width = 2.f * pi / n_sectors;
+    const scalar centre = -pi + (sector + 0.5f) * width;
+    const spacepoint sp = spacepoints.at(globalIndex);
+    scalar dphi = algebra::math::atan2(sp.y(), sp.x()) - centre;
+    if (dphi >= pi) {
+        dphi -= 2.f * pi;
+    } else if (dphi < -pi) {
+        dphi += 2.f * pi;
+    }
+
+    // Select the spacepoint if it is inside of the (extended) sector.
+    if (std::abs(dphi) <= 0.5f * width + overlap) {
+        spacepoint_collection_types::device selected(selected_view);
+        vecmem::device_vector<unsigned int> indices(indices_view);
+        const unsigned int pos = selected.push_back(sp);
+        indices.at(pos) = static_cast<unsigned int>(globalIndex);
+    }
+}
+
+}  // namespace traccc::device
@@ -1,6 +1,6 @@
 /** TRACCC library, part of the ACTS project (R&D line)
  *
- * (c) 2021-2023 CERN for the benefit of the ACTS project
+ * (c) 2021-2024 CERN for the benefit of the ACTS project
  *
  * Mozilla Public License Version 2.0
  */
@@ -8,6 +8,7 @@
 #pragma once
 
 // System include(s)
+#include <algorithm>
 #include <cmath>
 
 // Project include(s).
@@ -18,7 +19,7 @@ namespace traccc::device {
 namespace details {
 // Finding minimum element algorithm
 template <typename Comparator>
-TRACCC_HOST_DEVICE std::size_t min_elem(const triplet* arr,
+TRACCC_HOST_DEVICE std::size_t min_elem(const device_triplet* arr,
                                         const std::size_t begin_idx,
                                         const std::size_t end_idx,
                                         Comparator comp) {
@@ -36,10 +37,11 @@ TRACCC_HOST_DEVICE std::size_t min_elem(const triplet* arr,
 
 // Sorting algorithm for sorting seeds in the local memory
 template <typename Comparator>
-TRACCC_HOST_DEVICE void insertionSort(triplet* arr, const std::size_t begin_idx,
+TRACCC_HOST_DEVICE void insertionSort(device_triplet* arr,
+                                      const std::size_t begin_idx,
                                       const std::size_t n, Comparator comp) {
     int j = 0;
-    triplet key = arr[begin_idx];
+    device_triplet key = arr[begin_idx];
     for (std::size_t i = 0; i < n; ++i) {
         key = arr[begin_idx + i];
         j = i - 1;
@@ -53,15 +55,17 @@ TRACCC_HOST_DEVICE void insertionSort(triplet* arr, const std::size_t begin_idx,
 }  // namespace details
 
 // Select seeds kernel
-TRACCC_HOST_DEVICE
-inline void select_seeds(
+template <typename seeding_config_t>
+TRACCC_HOST_DEVICE inline void select_seeds(
     const std::size_t globalIndex, const seedfilter_config& filter_config,
     const spacepoint_collection_types::const_view& spacepoints_view,
-    const sp_grid_const_view& internal_sp_view,
+    const sp_soa_grid_types::const_view& internal_sp_view,
     const triplet_counter_spM_collection_types::const_view& spM_tc_view,
     const triplet_counter_collection_types::const_view& tc_view,
     const device_triplet_collection_types::const_view& triplet_view,
-    triplet* data, seed_collection_types::view seed_view) {
+    device_triplet* data, seed_collection_types::view seed_view,
+    bound_track_parameters_collection_types::view params_view,
+    const seed_params_config& params_config) {
 
     // Check if anything needs to be done.
     const triplet_counter_spM_collection_types::const_device triplet_counts_spM(
@@ -75,34 +79,39 @@ inline void select_seeds(
         tc_view);
     const spacepoint_collection_types::const_device spacepoints_device(
         spacepoints_view);
-    const const_sp_grid_device internal_sp_device(internal_sp_view);
+    const sp_soa_grid_types::const_device internal_sp_device(internal_sp_view);
 
     device_triplet_collection_types::const_device triplets(triplet_view);
     seed_collection_types::device seeds_device(seed_view);
 
     // Current work item = middle spacepoint
     const triplet_counter_spM spM_counter = triplet_counts_spM.at(globalIndex);
-    const sp_location spM_loc = spM_counter.spM;
+    if (spM_counter.m_nTriplets == 0) {
+        return;
+    }
     const internal_spacepoint<spacepoint> spM =
-        internal_sp_device.bin(spM_loc.bin_idx)[spM_loc.sp_idx];
+        internal_sp_device.at(spM_counter.spM);
+
+    // The limits of the triplets and seeds of this spM
+    const unsigned int max_triplets_per_spM =
+        seeding_config_t::max_triplets_per_spM(filter_config);
+    const unsigned int max_seeds_per_spM =
+        seeding_config_t::max_seeds_per_spM(filter_config);
 
     // Number of triplets added for this spM
     unsigned int n_triplets_per_spM = 0;
 
-    const unsigned int end_triplets_spM =
-        spM_counter.posTriplets + spM_counter.m_nTriplets;
+    const unsigned int end_triplets_spM = std::min(
+        spM_counter.posTriplets + spM_counter.m_nTriplets, triplets.size());
     // iterate over the triplets in the bin
     for (unsigned int i = spM_counter.posTriplets; i < end_triplets_spM; ++i) {
         device_triplet aTriplet = triplets[i];
 
         // spacepoints bottom and top for this triplet
-        const sp_location spB_loc =
-            triplet_counts.at(aTriplet.counter_link).spB;
-        const sp_location spT_loc = aTriplet.spT;
         const internal_spacepoint<spacepoint> spB =
-            internal_sp_device.bin(spB_loc.bin_idx)[spB_loc.sp_idx];
+            internal_sp_device.at(triplet_counts.at(aTriplet.counter_link).spB);
         const internal_spacepoint<spacepoint> spT =
-            internal_sp_device.bin(spT_loc.bin_idx)[spT_loc.sp_idx];
+            internal_sp_device.at(aTriplet.spT);
 
         // update weight of triplet
         seed_selecting_helper::seed_weight(filter_config, spM, spB, spT,
@@ -116,36 +125,33 @@ inline void select_seeds(
 
         // if the number of good triplets is larger than the threshold,
         // the triplet with the lowest weight is removed
-        if (n_triplets_per_spM >= filter_config.max_triplets_per_spM) {
+        if (n_triplets_per_spM >= max_triplets_per_spM) {
 
-            const int min_index =
-                details::min_elem(data, 0, filter_config.max_triplets_per_spM,
-                                  [](const triplet lhs, const triplet rhs) {
-                                      return lhs.weight > rhs.weight;
-                                  });
+            const int min_index = details::min_elem(
+                data, 0, max_triplets_per_spM,
+                [](const device_triplet& lhs, const device_triplet& rhs) {
+                    return lhs.weight > rhs.weight;
+                });
 
             const scalar& min_weight = data[min_index].weight;
 
             if (aTriplet.weight > min_weight) {
-                data[min_index] = {spB_loc,         spM_loc,
-                                   spT_loc,         aTriplet.curvature,
-                                   aTriplet.weight, aTriplet.z_vertex};
+                data[min_index] = aTriplet;
             }
         }
 
         // if the number of good triplets is below the threshold, add
         // the current triplet to the array
-        else if (n_triplets_per_spM < filter_config.max_triplets_per_spM) {
-            data[n_triplets_per_spM] = {spB_loc,         spM_loc,
-                                        spT_loc,         aTriplet.curvature,
-                                        aTriplet.weight, aTriplet.z_vertex};
+        else if (n_triplets_per_spM < max_triplets_per_spM) {
+            data[n_triplets_per_spM] = aTriplet;
             n_triplets_per_spM++;
         }
     }
 
     // sort the triplets per spM
     details::insertionSort(
-        data, 0, n_triplets_per_spM, [&](triplet& lhs, triplet& rhs) {
+        data, 0, n_triplets_per_spM,
+        [&](device_triplet& lhs, device_triplet& rhs) {
             if (lhs.weight != rhs.weight) {
                 return lhs.weight > rhs.weight;
             } else {
@@ -153,14 +159,16 @@ inline void select_seeds(
                 scalar seed1_sum = 0;
                 scalar seed2_sum = 0;
 
-                const internal_spacepoint<spacepoint>& ispB1 =
-                    internal_sp_device.bin(lhs.sp1.bin_idx)[lhs.sp1.sp_idx];
-                const internal_spacepoint<spacepoint>& ispT1 =
-                    internal_sp_device.bin(lhs.sp3.bin_idx)[lhs.sp3.sp_idx];
-                const internal_spacepoint<spacepoint>& ispB2 =
-                    internal_sp_device.bin(rhs.sp1.bin_idx)[rhs.sp1.sp_idx];
-                const internal_spacepoint<spacepoint>& ispT2 =
-                    internal_sp_device.bin(rhs.sp3.bin_idx)[rhs.sp3.sp_idx];
+                const internal_spacepoint<spacepoint> ispB1 =
+                    internal_sp_device.at(
+                        triplet_counts.at(lhs.counter_link).spB);
+                const internal_spacepoint<spacepoint> ispT1 =
+                    internal_sp_device.at(lhs.spT);
+                const internal_spacepoint<spacepoint> ispB2 =
+                    internal_sp_device.at(
+                        triplet_counts.at(rhs.counter_link).spB);
+                const internal_spacepoint<spacepoint> ispT2 =
+                    internal_sp_device.at(rhs.spT);
 
                 const spacepoint& spB1 = spacepoints_device.at(ispB1.m_link);
                 const spacepoint& spT1 = spacepoints_device.at(ispT1.m_link);
@@ -182,16 +190,14 @@ inline void select_seeds(
 
     // iterate over the good triplets for final selection of seeds
     for (unsigned int i = 0; i < n_triplets_per_spM; ++i) {
-        const triplet& aTriplet = data[i];
-        const sp_location& spB_loc = aTriplet.sp1;
-        const sp_location& spT_loc = aTriplet.sp3;
-        const internal_spacepoint<spacepoint>& spB =
-            internal_sp_device.bin(spB_loc.bin_idx)[spB_loc.sp_idx];
-        const internal_spacepoint<spacepoint>& spT =
-            internal_sp_device.bin(spT_loc.bin_idx)[spT_loc.sp_idx];
+        const device_triplet& aTriplet = data[i];
+        const internal_spacepoint<spacepoint> spB =
+            internal_sp_device.at(triplet_counts.at(aTriplet.counter_link).spB);
+        const internal_spacepoint<spacepoint> spT =
+            internal_sp_device.at(aTriplet.spT);
 
         // if the number of seeds reaches the threshold, break
-        if (n_seeds_per_spM >= filter_config.maxSeedsPerSpM + 1) {
+        if (n_seeds_per_spM >= max_seeds_per_spM + 1) {
             break;
         }
 
@@ -205,7 +211,14 @@ inline void select_seeds(
 
             n_seeds_per_spM++;
 
-            seeds_device.push_back(aSeed);
+            const unsigned int seed_idx = seeds_device.push_back(aSeed);
+            // Estimate the parameters of the seed, while its spacepoints are
+            // still in the cache.
+            if (params_view.ptr() != nullptr) {
+                params_view.ptr()[seed_idx] = seed_to_track_params(
+                    spacepoints_device, aSeed, params_config.bfield,
+                    params_config.stddev);
+            }
         }
     }
 }
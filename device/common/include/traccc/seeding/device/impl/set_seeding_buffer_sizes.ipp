@@ -0,0 +1,59 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// System include(s).
+#include <algorithm>
+#include <cassert>
+
+namespace traccc::device {
+
+TRACCC_HOST_DEVICE
+inline void set_doublet_buffer_sizes(
+    const std::size_t globalIndex, const seeding_global_counter& counter,
+    device_doublet_collection_types::view mb_doublets,
+    device_doublet_collection_types::view mt_doublets) {
+
+    // Only one thread needs to do anything.
+    if (globalIndex != 0) {
+        return;
+    }
+
+    // The buffers must be resizable ones.
+    assert(mb_doublets.size_ptr() != nullptr);
+    assert(mt_doublets.size_ptr() != nullptr);
+
+    // Set the sizes of the buffers directly. There is no need to construct
+    // the elements, they are all written by @c find_doublets.
+    *(mb_doublets.size_ptr()) =
+        std::min(counter.m_nMidBot, mb_doublets.capacity());
+    *(mt_doublets.size_ptr()) =
+        std::min(counter.m_nMidTop, mt_doublets.capacity());
+}
+
+TRACCC_HOST_DEVICE
+inline void set_triplet_buffer_size(
+    const std::size_t globalIndex, const seeding_global_counter& counter,
+    device_triplet_collection_types::view triplets) {
+
+    // Only one thread needs to do anything.
+    if (globalIndex != 0) {
+        return;
+    }
+
+    // The buffer must be a resizable one.
+    assert(triplets.size_ptr() != nullptr);
+
+    // Set the size of the buffer directly. All of its elements are written by
+    // @c find_triplets, since the triplets were counted on the same (possibly
+    // truncated) doublet collections that they are found on.
+    *(triplets.size_ptr()) =
+        std::min(counter.m_nTriplets, triplets.capacity());
+}
+
+}  // namespace traccc::device
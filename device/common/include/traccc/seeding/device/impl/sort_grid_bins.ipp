@@ -0,0 +1,47 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s).
+#include "traccc/seeding/spacepoint_binning_helper.hpp"
+
+namespace traccc::device {
+
+TRACCC_HOST_DEVICE
+inline void sort_grid_bins(const std::size_t globalIndex,
+                           sp_soa_grid_types::view grid_view) {
+
+    // Check if anything needs to be done.
+    sp_soa_grid_types::device grid(grid_view);
+    if (globalIndex >= grid.nbins()) {
+        return;
+    }
+    const unsigned int bin = static_cast<unsigned int>(globalIndex);
+    const unsigned int begin = grid.bin_begin(bin);
+    const unsigned int end = grid.bin_end(bin);
+
+    // Insertion sort of the bin. The bins are small, and this way no
+    // temporary memory is needed.
+    for (unsigned int i = begin + 1; i < end; ++i) {
+        const internal_spacepoint<spacepoint> sp = grid.at(i);
+        const unsigned int link = grid.link[i];
+        unsigned int j = i;
+        for (; j > begin && grid_bin_order(sp.radius(), link,
+                                           grid.radius[j - 1],
+                                           grid.link[j - 1]);
+             --j) {
+            grid.set(j, grid.at(j - 1));
+        }
+        grid.set(j, sp);
+    }
+
+    // Compress the coordinates of the sorted bin.
+    compress_grid_bin(grid, bin);
+}
+
+}  // namespace traccc::device
@@ -1,21 +1,22 @@
 /** TRACCC library, part of the ACTS project (R&D line)
  *
- * (c) 2021-2023 CERN for the benefit of the ACTS project
+ * (c) 2021-2024 CERN for the benefit of the ACTS project
  *
  * Mozilla Public License Version 2.0
  */
 
 // System include(s).
+#include <algorithm>
 #include <cassert>
 
 #pragma once
 
 namespace traccc::device {
 
-TRACCC_HOST_DEVICE
-inline void update_triplet_weights(
+template <typename seeding_config_t>
+TRACCC_HOST_DEVICE inline void update_triplet_weights(
     const std::size_t globalIndex, const seedfilter_config& filter_config,
-    const sp_grid_const_view& sp_view,
+    const sp_soa_grid_types::const_view& sp_view,
     const triplet_counter_spM_collection_types::const_view& spM_tc_view,
     const triplet_counter_collection_types::const_view& tc_view, scalar* data,
     device_triplet_collection_types::view triplet_view) {
@@ -27,7 +28,7 @@ inline void update_triplet_weights(
     }
 
     // Set up the device containers
-    const const_sp_grid_device sp_grid(sp_view);
+    const sp_soa_grid_types::const_device sp_grid(sp_view);
     const triplet_counter_spM_collection_types::const_device triplet_counts_spM(
         spM_tc_view);
     const triplet_counter_collection_types::const_device triplet_counts(
@@ -36,10 +37,10 @@ inline void update_triplet_weights(
     // Current work item
     device_triplet this_triplet = triplets[globalIndex];
 
-    const sp_location& spT_idx = this_triplet.spT;
+    const unsigned int spT_idx = this_triplet.spT;
 
     const traccc::internal_spacepoint<traccc::spacepoint> current_spT =
-        sp_grid.bin(spT_idx.bin_idx)[spT_idx.sp_idx];
+        sp_grid.at(spT_idx);
 
     const scalar currentTop_r = current_spT.radius();
 
@@ -51,6 +52,8 @@ inline void update_triplet_weights(
     const scalar upperLimitCurv =
         this_triplet.curvature + filter_config.deltaInvHelixDiameter;
     std::size_t num_compat_seedR = 0;
+    const unsigned int compat_seed_limit =
+        seeding_config_t::compat_seed_limit(filter_config);
 
     const triplet_counter mb_count =
         triplet_counts.at(this_triplet.counter_link);
@@ -64,8 +67,8 @@ inline void update_triplet_weights(
     const unsigned int triplets_mb_begin =
         mb_count.posTriplets +
         triplet_counts_spM.at(mb_count.spM_counter_link).posTriplets;
-    const unsigned int triplets_mb_end =
-        triplets_mb_begin + mb_count.m_nTriplets;
+    const unsigned int triplets_mb_end = std::min(
+        triplets_mb_begin + mb_count.m_nTriplets, triplets.size());
 
     // iterate over triplets
     for (unsigned int i = triplets_mb_begin; i < triplets_mb_end; ++i) {
@@ -75,9 +78,9 @@ inline void update_triplet_weights(
         }
 
         const device_triplet other_triplet = triplets[i];
-        const sp_location other_spT_idx = other_triplet.spT;
+        const unsigned int other_spT_idx = other_triplet.spT;
         const traccc::internal_spacepoint<traccc::spacepoint> other_spT =
-            sp_grid.bin(other_spT_idx.bin_idx)[other_spT_idx.sp_idx];
+            sp_grid.at(other_spT_idx);
 
         // compared top SP should have at least deltaRMin distance
         const scalar otherTop_r = other_spT.radius();
@@ -119,7 +122,7 @@ inline void update_triplet_weights(
             num_compat_seedR++;
         }
 
-        if (num_compat_seedR >= filter_config.compatSeedLimit) {
+        if (num_compat_seedR >= compat_seed_limit) {
             break;
         }
     }
@@ -0,0 +1,46 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s).
+#include "traccc/definitions/qualifiers.hpp"
+#include "traccc/edm/track_parameters.hpp"
+#include "traccc/edm/truth_seed_input.hpp"
+
+// System include(s).
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace traccc::device {
+
+/// Function making the (smeared) truth seed of one particle
+///
+/// The seed is the same as the one made by
+/// @c traccc::batched_seed_generator on the host.
+///
+/// @param[in] globalIndex The index of the current thread (particle)
+/// @param[in] det_data    Detector view object
+/// @param[in] inputs_view The truth states of the particles
+/// @param[in] stddevs     The standard deviations of the smearing
+/// @param[in] seed        The seed of the smearing
+/// @param[in] event       The index of the event
+/// @param[out] seeds_view The seeds, in the order of the particles
+///
+template <typename detector_t>
+TRACCC_HOST_DEVICE inline void make_truth_seeds(
+    std::size_t globalIndex, typename detector_t::view_type det_data,
+    truth_seed_input_collection_types::const_view inputs_view,
+    const std::array<scalar, e_bound_size>& stddevs, std::uint64_t seed,
+    std::uint64_t event,
+    bound_track_parameters_collection_types::view seeds_view);
+
+}  // namespace traccc::device
+
+// Include the implementation.
+#include "traccc/seeding/device/impl/make_truth_seeds.ipp"
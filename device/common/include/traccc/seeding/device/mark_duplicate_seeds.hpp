@@ -0,0 +1,53 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s).
+#include "traccc/definitions/qualifiers.hpp"
+#include "traccc/edm/seed.hpp"
+#include "traccc/edm/track_parameters.hpp"
+#include "traccc/seeding/detail/seeding_config.hpp"
+
+// VecMem include(s).
+#include <vecmem/containers/data/vector_view.hpp>
+
+// System include(s).
+#include <cstddef>
+#include <cstdint>
+
+namespace traccc::device {
+
+/// Function marking the seeds that are near-duplicates of better seeds
+///
+/// Works on the seeds sorted by the keys of one of their pairs of
+/// spacepoints (see @c traccc::seed_selection_helper::pair_key). Every seed
+/// is compared to its neighbours with the same key, i.e. to the seeds
+/// sharing the same two spacepoints with it.
+///
+/// @param[in] globalIndex  The index of the current thread
+/// @param[in] config       The seed selection configuration
+/// @param[in] keys_view    The sorted pair keys of the seeds
+/// @param[in] order_view   The indices of the seeds, in the order of the keys
+/// @param[in] seeds_view   The seeds
+/// @param[in] params_view  The estimated parameters of the seeds
+/// @param[out] removed_view Flags of the seeds to remove, set to 1 for the
+///                          duplicates
+///
+TRACCC_HOST_DEVICE
+inline void mark_duplicate_seeds(
+    std::size_t globalIndex, const seed_selection_config& config,
+    vecmem::data::vector_view<const std::uint64_t> keys_view,
+    vecmem::data::vector_view<const unsigned int> order_view,
+    const seed_collection_types::const_view& seeds_view,
+    const bound_track_parameters_collection_types::const_view& params_view,
+    vecmem::data::vector_view<unsigned int> removed_view);
+
+}  // namespace traccc::device
+
+// Include the implementation.
+#include "traccc/seeding/device/impl/mark_duplicate_seeds.ipp"
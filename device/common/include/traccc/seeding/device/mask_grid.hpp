@@ -0,0 +1,70 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s).
+#include "traccc/definitions/qualifiers.hpp"
+#include "traccc/edm/measurement.hpp"
+#include "traccc/edm/spacepoint.hpp"
+#include "traccc/seeding/detail/spacepoint_soa_grid.hpp"
+
+// VecMem include(s).
+#include <vecmem/containers/data/vector_view.hpp>
+
+// System include(s).
+#include <cstddef>
+
+namespace traccc::device {
+
+/// Function marking a spacepoint whose measurement was used already
+///
+/// @param[in] globalIndex       The index of the current thread (spacepoint)
+/// @param[in] spacepoints_view  All spacepoints of the event
+/// @param[in] measurements_view The measurements, sorted by their surfaces
+/// @param[in] used_measurements_view The bitmask of the used measurements
+/// @param[out] used_spacepoints_view The bitmask of the used spacepoints
+///
+TRACCC_DEVICE inline void mark_used_spacepoints(
+    std::size_t globalIndex,
+    spacepoint_collection_types::const_view spacepoints_view,
+    measurement_collection_types::const_view measurements_view,
+    vecmem::data::vector_view<const unsigned int> used_measurements_view,
+    vecmem::data::vector_view<unsigned int> used_spacepoints_view);
+
+/// Function counting the spacepoints of one grid bin that are not used
+///
+/// @param[in] globalIndex       The index of the current thread (grid bin)
+/// @param[in] grid_view         The spacepoint grid
+/// @param[in] used_spacepoints_view The bitmask of the used spacepoints
+/// @param[out] bin_sizes_view   The number of unused spacepoints per bin
+///
+TRACCC_HOST_DEVICE inline void count_masked_grid_bin(
+    std::size_t globalIndex, sp_soa_grid_types::const_view grid_view,
+    vecmem::data::vector_view<const unsigned int> used_spacepoints_view,
+    vecmem::data::vector_view<unsigned int> bin_sizes_view);
+
+/// Function copying the unused spacepoints of one grid bin into a masked
+/// grid
+///
+/// The spacepoints keep their order (by radius) in the bin, and the
+/// compressed coordinates of the bin are re-computed.
+///
+/// @param[in] globalIndex       The index of the current thread (grid bin)
+/// @param[in] grid_view         The spacepoint grid
+/// @param[in] used_spacepoints_view The bitmask of the used spacepoints
+/// @param[out] masked_grid_view The masked grid, with its bin offsets set
+///
+TRACCC_HOST_DEVICE inline void fill_masked_grid_bin(
+    std::size_t globalIndex, sp_soa_grid_types::const_view grid_view,
+    vecmem::data::vector_view<const unsigned int> used_spacepoints_view,
+    sp_soa_grid_types::view masked_grid_view);
+
+}  // namespace traccc::device
+
+// Include the implementation.
+#include "traccc/seeding/device/impl/mask_grid.ipp"
@@ -0,0 +1,54 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s).
+#include "traccc/definitions/qualifiers.hpp"
+#include "traccc/edm/seed.hpp"
+#include "traccc/edm/spacepoint.hpp"
+
+// VecMem include(s).
+#include <vecmem/containers/data/vector_view.hpp>
+
+// System include(s).
+#include <cstddef>
+
+namespace traccc::device {
+
+/// Function merging the seeds found in one phi sector into the seeds of the
+/// full event
+///
+/// Only the seeds with their middle spacepoint inside of the (core) sector
+/// are kept. The seeds with their middle spacepoint in the overlap with a
+/// neighbouring sector are found again in that sector, so this removes the
+/// duplicates between the sectors.
+///
+/// @param[in] globalIndex      The index of the current thread
+/// @param[in] sector_seeds_view The seeds found in the sector
+/// @param[in] sector_spacepoints_view The spacepoints of the sector
+/// @param[in] indices_view     The indices of the sector's spacepoints in the
+///                             spacepoints of the full event
+/// @param[in] sector           The index of the sector
+/// @param[in] n_sectors        The number of phi sectors
+/// @param[out] seeds_view      Resizable collection receiving the seeds, with
+///                             their links pointing to the spacepoints of the
+///                             full event
+///
+TRACCC_HOST_DEVICE
+inline void merge_sector_seeds(
+    std::size_t globalIndex,
+    const seed_collection_types::const_view& sector_seeds_view,
+    const spacepoint_collection_types::const_view& sector_spacepoints_view,
+    const vecmem::data::vector_view<const unsigned int>& indices_view,
+    unsigned int sector, unsigned int n_sectors,
+    seed_collection_types::view seeds_view);
+
+}  // namespace traccc::device
+
+// Include the implementation.
+#include "traccc/seeding/device/impl/merge_sector_seeds.ipp"
@@ -1,6 +1,6 @@
 /** TRACCC library, part of the ACTS project (R&D line)
  *
- * (c) 2021-2022 CERN for the benefit of the ACTS project
+ * (c) 2021-2024 CERN for the benefit of the ACTS project
  *
  * Mozilla Public License Version 2.0
  */
@@ -12,7 +12,7 @@
 #include "traccc/device/fill_prefix_sum.hpp"
 #include "traccc/edm/spacepoint.hpp"
 #include "traccc/seeding/detail/seeding_config.hpp"
-#include "traccc/seeding/detail/spacepoint_grid.hpp"
+#include "traccc/seeding/detail/spacepoint_soa_grid.hpp"
 
 // VecMem include(s).
 #include <vecmem/containers/data/vector_view.hpp>
@@ -24,16 +24,24 @@ namespace traccc::device {
 
 /// Function populating the spacepoint grid
 ///
+/// The bin offsets of the grid need to be set up already, from the bin
+/// capacities calculated by @c traccc::device::count_grid_capacities. The
+/// spacepoints are written into their bins in an arbitrary order, so the
+/// bins need to be sorted with @c traccc::device::sort_grid_bins afterwards.
+///
 /// @param[in] globalIndex   The index of the current thread
 /// @param[in] config        Seedfinder configuration
 /// @param[in] spacepoints   All the spacepoints of the event
 /// @param[out] grid         The spacepoint grid to populate
+/// @param[in,out] bin_cursors The number of spacepoints already written into
+///                            each bin, starting from zero
 ///
 TRACCC_HOST_DEVICE
 inline void populate_grid(
     unsigned int globalIndex, const seedfinder_config& config,
     const spacepoint_collection_types::const_view& spacepoints,
-    sp_grid_view grid);
+    sp_soa_grid_types::view grid,
+    vecmem::data::vector_view<unsigned int> bin_cursors);
 
 }  // namespace traccc::device
 
@@ -0,0 +1,38 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s).
+#include "traccc/definitions/qualifiers.hpp"
+#include "traccc/edm/region_of_interest.hpp"
+#include "traccc/edm/spacepoint.hpp"
+
+// System include(s).
+#include <cstddef>
+
+namespace traccc::device {
+
+/// Function selecting the spacepoints inside of regions of interest
+///
+/// @param[in] globalIndex      The index of the current thread
+/// @param[in] spacepoints_view All spacepoints of the event
+/// @param[in] rois_view        The regions of interest
+/// @param[out] selected_view   Resizable collection receiving the spacepoints
+///                             inside of any of the regions
+///
+TRACCC_HOST_DEVICE
+inline void select_roi_spacepoints(
+    std::size_t globalIndex,
+    const spacepoint_collection_types::const_view& spacepoints_view,
+    const region_of_interest_collection_types::const_view& rois_view,
+    spacepoint_collection_types::view selected_view);
+
+}  // namespace traccc::device
+
+// Include the implementation.
+#include "traccc/seeding/device/impl/select_roi_spacepoints.ipp"
@@ -0,0 +1,60 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s).
+#include "traccc/definitions/primitives.hpp"
+#include "traccc/definitions/qualifiers.hpp"
+#include "traccc/edm/spacepoint.hpp"
+
+// VecMem include(s).
+#include <vecmem/containers/data/vector_view.hpp>
+
+// System include(s).
+#include <cstddef>
+
+namespace traccc::device {
+
+/// Get the (core) phi sector that a spacepoint belongs to
+///
+/// The full phi range is split into @c n_sectors sectors of equal size, with
+/// sector 0 starting at -pi.
+///
+/// @param sp        The spacepoint to get the sector of
+/// @param n_sectors The number of phi sectors
+/// @return The index of the sector that the spacepoint belongs to
+///
+TRACCC_HOST_DEVICE
+inline unsigned int phi_sector(const spacepoint& sp, unsigned int n_sectors);
+
+/// Function selecting the spacepoints of a phi sector, including its overlap
+/// with the neighbouring sectors
+///
+/// @param[in] globalIndex      The index of the current thread
+/// @param[in] spacepoints_view All spacepoints of the event
+/// @param[in] sector           The index of the sector to select
+/// @param[in] n_sectors        The number of phi sectors
+/// @param[in] overlap          The phi range (in radians) on either side of
+///                             the sector to also select the spacepoints in
+/// @param[out] selected_view   Resizable collection receiving the spacepoints
+///                             of the sector
+/// @param[out] indices_view    The indices of the selected spacepoints in
+///                             @c spacepoints_view, in the same order
+///
+TRACCC_HOST_DEVICE
+inline void select_sector_spacepoints(
+    std::size_t globalIndex,
+    const spacepoint_collection_types::const_view& spacepoints_view,
+    unsigned int sector, unsigned int n_sectors, scalar overlap,
+    spacepoint_collection_types::view selected_view,
+    vecmem::data::vector_view<unsigned int> indices_view);
+
+}  // namespace traccc::device
+
+// Include the implementation.
+#include "traccc/seeding/device/impl/select_sector_spacepoints.ipp"
@@ -1,6 +1,6 @@
 /** TRACCC library, part of the ACTS project (R&D line)
  *
- * (c) 2021-2023 CERN for the benefit of the ACTS project
+ * (c) 2021-2024 CERN for the benefit of the ACTS project
  *
  * Mozilla Public License Version 2.0
  */
@@ -11,9 +11,11 @@
 #include "traccc/edm/device/device_triplet.hpp"
 #include "traccc/edm/device/triplet_counter.hpp"
 #include "traccc/edm/seed.hpp"
+#include "traccc/edm/track_parameters.hpp"
+#include "traccc/seeding/device/estimate_track_params.hpp"
 #include "traccc/seeding/detail/seeding_config.hpp"
-#include "traccc/seeding/detail/spacepoint_grid.hpp"
-#include "traccc/seeding/detail/triplet.hpp"
+#include "traccc/seeding/detail/spacepoint_soa_grid.hpp"
+#include "traccc/seeding/detail/static_seeding_config.hpp"
 
 // System include(s).
 #include <cassert>
@@ -32,16 +34,27 @@ namespace traccc::device {
 /// @param[in] triplet_view     Collection of triplets
 /// @param[in] data     Array for temporary storage of triplets for comparison
 /// @param[out] seed_view       Collection of seeds
+/// @param[out] params_view     Optional collection of the bound track
+///                             parameters of the seeds, with the capacity of
+///                             @c seed_view. If it is set, the parameters of
+///                             every seed are estimated right away, and stored
+///                             at the index of the seed. Its size is left for
+///                             the caller to set.
+/// @param[in] params_config    The configuration of the parameter estimation
+/// @tparam seeding_config_t The (runtime or static) seeding configuration
+///                          values driving the loops of the function
 ///
-TRACCC_HOST_DEVICE
-inline void select_seeds(
+template <typename seeding_config_t = runtime_seeding_config>
+TRACCC_HOST_DEVICE inline void select_seeds(
     std::size_t globalIndex, const seedfilter_config& filter_config,
     const spacepoint_collection_types::const_view& spacepoints_view,
-    const sp_grid_const_view& internal_sp_view,
+    const sp_soa_grid_types::const_view& internal_sp_view,
     const triplet_counter_spM_collection_types::const_view& spM_tc_view,
     const triplet_counter_collection_types::const_view& tc_view,
     const device_triplet_collection_types::const_view& triplet_view,
-    triplet* data, seed_collection_types::view seed_view);
+    device_triplet* data, seed_collection_types::view seed_view,
+    bound_track_parameters_collection_types::view params_view = {},
+    const seed_params_config& params_config = {});
 
 }  // namespace traccc::device
 
@@ -0,0 +1,58 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s).
+#include "traccc/definitions/qualifiers.hpp"
+#include "traccc/edm/device/device_doublet.hpp"
+#include "traccc/edm/device/device_triplet.hpp"
+#include "traccc/edm/device/seeding_global_counter.hpp"
+
+// System include(s).
+#include <cstddef>
+
+namespace traccc::device {
+
+/// Function setting the sizes of capacity-bounded doublet buffers
+///
+/// When running the seed finding with bounded capacities, the doublet buffers
+/// are allocated as resizable buffers before the number of doublets is known.
+/// This function sets their sizes to the number of doublets found by
+/// @c count_doublets, clamped to their capacities. It is meant to be executed
+/// by a single thread.
+///
+/// @param[in] globalIndex    The index of the current thread
+/// @param[in] counter        The global counter filled by @c count_doublets
+/// @param[out] mb_doublets   The middle-bottom doublet buffer
+/// @param[out] mt_doublets   The middle-top doublet buffer
+///
+TRACCC_HOST_DEVICE
+inline void set_doublet_buffer_sizes(
+    std::size_t globalIndex, const seeding_global_counter& counter,
+    device_doublet_collection_types::view mb_doublets,
+    device_doublet_collection_types::view mt_doublets);
+
+/// Function setting the size of a capacity-bounded triplet buffer
+///
+/// The counterpart of @c set_doublet_buffer_sizes, to be executed after
+/// @c reduce_triplet_counts.
+///
+/// @param[in] globalIndex    The index of the current thread
+/// @param[in] counter        The global counter filled by
+///                           @c reduce_triplet_counts
+/// @param[out] triplets      The triplet buffer
+///
+TRACCC_HOST_DEVICE
+inline void set_triplet_buffer_size(
+    std::size_t globalIndex, const seeding_global_counter& counter,
+    device_triplet_collection_types::view triplets);
+
+}  // namespace traccc::device
+
+// Include the implementation.
+#include "traccc/seeding/device/impl/set_seeding_buffer_sizes.ipp"
@@ -0,0 +1,39 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s).
+#include "traccc/definitions/qualifiers.hpp"
+#include "traccc/seeding/detail/spacepoint_soa_grid.hpp"
+
+// System include(s).
+#include <cstddef>
+
+namespace traccc::device {
+
+/// Function sorting the spacepoints of one spacepoint grid bin by radius
+///
+/// @c traccc::device::populate_grid fills the bins in an arbitrary order.
+/// This function brings the spacepoints of a bin into the same order that
+/// the host binning produces, by radius, and by the index of the spacepoint
+/// for equal radii. It also fills the compressed coordinates of the sorted
+/// bin.
+///
+/// This function needs to be called separately for every bin of the grid.
+///
+/// @param[in] globalIndex   The index of the current thread (grid bin)
+/// @param[in,out] grid      The spacepoint grid to sort the bins of
+///
+TRACCC_HOST_DEVICE
+inline void sort_grid_bins(std::size_t globalIndex,
+                           sp_soa_grid_types::view grid);
+
+}  // namespace traccc::device
+
+// Include the implementation.
+#include "traccc/seeding/device/impl/sort_grid_bins.ipp"
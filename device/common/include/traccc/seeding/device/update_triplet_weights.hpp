@@ -1,6 +1,6 @@
 /** TRACCC library, part of the ACTS project (R&D line)
  *
- * (c) 2021-2023 CERN for the benefit of the ACTS project
+ * (c) 2021-2024 CERN for the benefit of the ACTS project
  *
  * Mozilla Public License Version 2.0
  */
@@ -13,7 +13,8 @@
 #include "traccc/edm/device/device_triplet.hpp"
 #include "traccc/edm/device/triplet_counter.hpp"
 #include "traccc/seeding/detail/seeding_config.hpp"
-#include "traccc/seeding/detail/spacepoint_grid.hpp"
+#include "traccc/seeding/detail/spacepoint_soa_grid.hpp"
+#include "traccc/seeding/detail/static_seeding_config.hpp"
 
 // System include(s)
 #include <cstddef>
@@ -30,11 +31,13 @@ namespace traccc::device {
 /// @param[in] data Array for temporary storage of quality parameters for
 /// comparison of triplets
 /// @param[inout] triplet_view Collection of triplets
+/// @tparam seeding_config_t The (runtime or static) seeding configuration
+///                          values driving the loops of the function
 ///
-TRACCC_HOST_DEVICE
-inline void update_triplet_weights(
+template <typename seeding_config_t = runtime_seeding_config>
+TRACCC_HOST_DEVICE inline void update_triplet_weights(
     std::size_t globalIndex, const seedfilter_config& filter_config,
-    const sp_grid_const_view& sp_view,
+    const sp_soa_grid_types::const_view& sp_view,
     const triplet_counter_spM_collection_types::const_view& spM_tc_view,
     const triplet_counter_collection_types::const_view& tc_view, scalar* data,
     device_triplet_collection_types::view triplet_view);
@@ -0,0 +1,47 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// VecMem include(s).
+#include <vecmem/containers/device_vector.hpp>
+#include <vecmem/containers/jagged_device_vector.hpp>
+
+namespace traccc::device {
+
+template <typename simulator_t, typename detector_view_t>
+TRACCC_HOST_DEVICE inline void simulate_tracks(
+    std::size_t globalIndex, detector_view_t det_data,
+    const typename simulator_t::bfield_type field_data,
+    const typename simulator_t::config_type cfg,
+    vecmem::data::jagged_vector_view<typename simulator_t::intersection_type>
+        nav_candidates_buffer,
+    vecmem::data::vector_view<const free_track_parameters> tracks_view,
+    std::uint64_t event, measurement_collection_types::view measurements_view) {
+
+    const vecmem::device_vector<const free_track_parameters> tracks(
+        tracks_view);
+    if (globalIndex >= tracks.size()) {
+        return;
+    }
+
+    typename simulator_t::detector_type det(det_data);
+
+    vecmem::jagged_device_vector<typename simulator_t::intersection_type>
+        nav_candidates(nav_candidates_buffer);
+
+    measurement_collection_types::device measurements(measurements_view);
+
+    // Simulate the track, with the candidate vector of this thread. The
+    // particles are identified by their index in the event.
+    const simulator_t simulator(det, field_data, cfg);
+    simulator.simulate(tracks.at(globalIndex), event, globalIndex,
+                       measurements,
+                       nav_candidates.at(globalIndex % nav_candidates.size()));
+}
+
+}  // namespace traccc::device
@@ -0,0 +1,52 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s).
+#include "traccc/definitions/qualifiers.hpp"
+#include "traccc/edm/measurement.hpp"
+#include "traccc/edm/track_parameters.hpp"
+
+// VecMem include(s).
+#include <vecmem/containers/data/jagged_vector_view.hpp>
+#include <vecmem/containers/data/vector_view.hpp>
+
+// System include(s).
+#include <cstddef>
+#include <cstdint>
+
+namespace traccc::device {
+
+/// Function simulating one track of a particle gun
+///
+/// @param[in] globalIndex   The index of the current thread (track)
+/// @param[in] det_data      Detector view object
+/// @param[in] field_data    The magnetic field
+/// @param[in] cfg           The configuration of the simulation
+/// @param[in] nav_candidates_buffer Buffer for navigation candidate objects,
+///                              with one candidate vector per track, or per
+///                              thread of a grid-stride loop of the same size
+/// @param[in] tracks_view   The (free) parameters of the tracks at their
+///                          origins
+/// @param[in] event         The index of the event, seeding the smearing
+/// @param[out] measurements_view The (resizable) buffer of the measurements
+///
+template <typename simulator_t, typename detector_view_t>
+TRACCC_HOST_DEVICE inline void simulate_tracks(
+    std::size_t globalIndex, detector_view_t det_data,
+    const typename simulator_t::bfield_type field_data,
+    const typename simulator_t::config_type cfg,
+    vecmem::data::jagged_vector_view<typename simulator_t::intersection_type>
+        nav_candidates_buffer,
+    vecmem::data::vector_view<const free_track_parameters> tracks_view,
+    std::uint64_t event, measurement_collection_types::view measurements_view);
+
+}  // namespace traccc::device
+
+// Include the implementation.
+#include "traccc/simulation/device/impl/simulate_tracks.ipp"
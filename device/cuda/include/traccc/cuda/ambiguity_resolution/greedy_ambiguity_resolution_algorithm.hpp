@@ -0,0 +1,92 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s).
+#include "traccc/cuda/utils/stream.hpp"
+#include "traccc/edm/track_state.hpp"
+#include "traccc/utils/algorithm.hpp"
+#include "traccc/utils/memory_resource.hpp"
+
+// VecMem include(s).
+#include <vecmem/containers/data/vector_buffer.hpp>
+#include <vecmem/utils/copy.hpp>
+
+// System include(s).
+#include <cstddef>
+#include <cstdint>
+
+namespace traccc::cuda {
+
+/// Greedy ambiguity resolution on a CUDA device
+///
+/// Instead of evicting the single worst track at a time, like the host
+/// algorithm does, every round evicts all "candidate" tracks (tracks with at
+/// least @c maximum_shared_hits shared measurements) that are worse than all
+/// of the candidates that they share a measurement with. These tracks share
+/// no measurements with each other, so their removal does not conflict. The
+/// rounds stop once no track has @c maximum_shared_hits shared measurements
+/// anymore.
+///
+/// The result is a selection mask over the input tracks (1 for the retained
+/// tracks, 0 for the removed ones), so that the tracks themselves never need
+/// to leave the device.
+///
+class greedy_ambiguity_resolution_algorithm
+    : public algorithm<vecmem::data::vector_buffer<unsigned int>(
+          const track_state_container_types::const_view&)> {
+
+    public:
+    /// Configuration of the algorithm
+    struct config_t {
+
+        config_t(){};
+
+        /// Maximum amount of shared hits per track. One (1) means "no shared
+        /// hit allowed".
+        std::uint32_t maximum_shared_hits = 1;
+
+        /// Maximum number of rounds.
+        std::uint32_t maximum_iterations = 1000000;
+
+        /// Minimum number of measurement to form a track.
+        std::size_t n_measurements_min = 3;
+    };
+
+    /// Constructor for the algorithm
+    ///
+    /// @param cfg  Configuration object
+    /// @param mr   The memory resource to use
+    /// @param copy Copy object
+    /// @param str  Cuda stream object
+    ///
+    greedy_ambiguity_resolution_algorithm(const config_t& cfg,
+                                          const traccc::memory_resource& mr,
+                                          vecmem::copy& copy, stream& str);
+
+    /// Run the algorithm
+    ///
+    /// @param track_states_view The fitted tracks, on the device
+    /// @return The selection mask of the tracks, on the device
+    ///
+    output_type operator()(const track_state_container_types::const_view&
+                               track_states_view) const override;
+
+    private:
+    /// The configuration of the algorithm
+    config_t m_config;
+    /// Memory resource used by the algorithm
+    traccc::memory_resource m_mr;
+    /// The copy object to use
+    vecmem::copy& m_copy;
+    /// The CUDA stream to use
+    stream& m_stream;
+
+};  // class greedy_ambiguity_resolution_algorithm
+
+}  // namespace traccc::cuda
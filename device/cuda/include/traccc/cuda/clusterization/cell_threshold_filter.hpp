@@ -0,0 +1,71 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s).
+#include "traccc/clusterization/detail/threshold_filter.hpp"
+#include "traccc/cuda/utils/stream.hpp"
+#include "traccc/edm/cell.hpp"
+#include "traccc/utils/algorithm.hpp"
+#include "traccc/utils/memory_resource.hpp"
+
+// VecMem include(s).
+#include <vecmem/utils/copy.hpp>
+
+namespace traccc::cuda {
+
+/// Zero-suppression of the cells on a CUDA device, ahead of the
+/// clusterization
+///
+/// The device version of @c traccc::cell_threshold_filter. The kept cells are
+/// flagged by one thread per cell, and are then stream compacted (keeping
+/// their order) into the output buffer. The modules of the cells are not
+/// touched, so they can be used with the filtered cells as they are.
+///
+class cell_threshold_filter
+    : public algorithm<cell_collection_types::buffer(
+          const cell_collection_types::const_view&,
+          const cell_module_collection_types::const_view&)> {
+
+    public:
+    /// Constructor for the filter
+    ///
+    /// @param mr The memory resource(s) to use
+    /// @param copy The copy object to use for copying data between device
+    ///             and host memory blocks
+    /// @param str The CUDA stream to perform the operations in
+    /// @param mode The sub-threshold cells to drop
+    ///
+    cell_threshold_filter(
+        const traccc::memory_resource& mr, vecmem::copy& copy, stream& str,
+        threshold_filter_mode mode = threshold_filter_mode::e_isolated);
+
+    /// Callable operator for the filter
+    ///
+    /// @param cells The cells to filter, sorted as for the clusterization
+    /// @param modules The modules of the cells
+    /// @return The kept cells, in their original order
+    ///
+    output_type operator()(
+        const cell_collection_types::const_view& cells,
+        const cell_module_collection_types::const_view& modules)
+        const override;
+
+    private:
+    /// The memory resource(s) to use
+    traccc::memory_resource m_mr;
+    /// The copy object to use
+    vecmem::copy& m_copy;
+    /// The CUDA stream to use
+    stream& m_stream;
+    /// The sub-threshold cells to drop
+    threshold_filter_mode m_mode;
+
+};  // class cell_threshold_filter
+
+}  // namespace traccc::cuda
@@ -1,6 +1,6 @@
 /** TRACCC library, part of the ACTS project (R&D line)
  *
- * (c) 2022 CERN for the benefit of the ACTS project
+ * (c) 2022-2024 CERN for the benefit of the ACTS project
  *
  * Mozilla Public License Version 2.0
  */
@@ -13,6 +13,7 @@
 // Project include(s).
 #include "traccc/edm/cell.hpp"
 #include "traccc/edm/measurement.hpp"
+#include "traccc/edm/module_descriptor_soa.hpp"
 #include "traccc/edm/spacepoint.hpp"
 #include "traccc/utils/algorithm.hpp"
 #include "traccc/utils/memory_resource.hpp"
@@ -20,6 +21,11 @@
 // VecMem include(s).
 #include <vecmem/utils/copy.hpp>
 
+// System include(s).
+#include <cstddef>
+#include <tuple>
+#include <vector>
+
 namespace traccc::cuda {
 
 /// Algorithm performing hit clusterization
@@ -45,10 +51,27 @@ class clusterization_algorithm
     /// @param str The CUDA stream to perform the operations in
     /// @param target_cells_per_partition the average number of cells in each
     /// partition
+    /// @param warp_ccl_max_cells_per_module the mean number of cells per
+    /// module below which the connected component labeling is done with one
+    /// warp per (smaller) partition, instead of one thread block
+    /// @param compact_measurements whether to copy the measurements into a
+    /// buffer of their exact size once they are counted, releasing the
+    /// one-slot-per-cell buffer that the labeling kernel writes into
+    /// @param produce_cell_links whether to fill the links from the cells to
+    /// their spacepoints. If not, an empty link buffer is returned.
     ///
     clusterization_algorithm(const traccc::memory_resource& mr,
                              vecmem::copy& copy, stream& str,
-                             const unsigned short target_cells_per_partition);
+                             const unsigned short target_cells_per_partition,
+                             float warp_ccl_max_cells_per_module = 32.f,
+                             bool compact_measurements = true,
+                             bool produce_cell_links = true);
+
+    /// Type of the result of @c run_with_measurements
+    using measurements_output_type =
+        std::tuple<measurement_collection_types::buffer,
+                   spacepoint_collection_types::buffer,
+                   vecmem::data::vector_buffer<unsigned int>>;
 
     /// Callable operator for clusterization algorithm
     ///
@@ -60,9 +83,144 @@ class clusterization_algorithm
         const cell_collection_types::const_view& cells,
         const cell_module_collection_types::const_view& modules) const override;
 
+    /// Run the clusterization, returning the measurements as well
+    ///
+    /// @param cells        a collection of cells
+    /// @param modules      a collection of modules
+    /// @return a measurement collection (buffer), a spacepoint collection
+    /// (buffer), and a collection (buffer) of links from cells to the
+    /// spacepoints they belong to.
+    measurements_output_type run_with_measurements(
+        const cell_collection_types::const_view& cells,
+        const cell_module_collection_types::const_view& modules) const;
+
+    /// Result of @c run_batched
+    struct batched_output_type {
+
+        /// The measurements of all events, ordered by event
+        measurement_collection_types::buffer measurements;
+        /// The spacepoints of all events, in the same order as the
+        /// measurements
+        spacepoint_collection_types::buffer spacepoints;
+        /// The index of the first measurement / spacepoint of every event,
+        /// with a final element holding the total number of them
+        std::vector<unsigned int> offsets;
+
+        /// Get (a view of) the measurements of one event
+        measurement_collection_types::view event_measurements(
+            std::size_t event) {
+            return {offsets.at(event + 1) - offsets.at(event),
+                    measurements.ptr() + offsets.at(event)};
+        }
+        /// Get (a view of) the spacepoints of one event
+        spacepoint_collection_types::view event_spacepoints(std::size_t event) {
+            return {offsets.at(event + 1) - offsets.at(event),
+                    spacepoints.ptr() + offsets.at(event)};
+        }
+
+    };  // struct batched_output_type
+
+    /// Run the clusterization on a batch of events at once
+    ///
+    /// Meant for events too small to keep the device busy on their own, for
+    /// which the cost of launching the kernels would dominate. The cells and
+    /// modules of the events are expected to be merged by
+    /// @c traccc::event_batch. The connected component labeling and the
+    /// spacepoint formation are run once for all events, and the results are
+    /// then ordered by event, so that the subsequent algorithms (seeding,
+    /// track finding) could run on the (views of the) results of the
+    /// individual events.
+    ///
+    /// No cell links are produced in this mode.
+    ///
+    /// @param cells         the cells of all events
+    /// @param modules       the modules of all events
+    /// @param module_events the index of the event of every module
+    /// @param n_events      the number of events in the batch
+    /// @return the measurements and spacepoints of all events, with the
+    ///         offsets of the individual events
+    ///
+    batched_output_type run_batched(
+        const cell_collection_types::const_view& cells,
+        const cell_module_collection_types::const_view& modules,
+        const vecmem::data::vector_view<const unsigned int>& module_events,
+        std::size_t n_events) const;
+
+    /// Run the clusterization into capacity-bounded, pre-allocated buffers
+    ///
+    /// Unlike the call operator, this function never synchronises the stream,
+    /// and the kernels that it launches only depend on the capacities of the
+    /// buffers. The actual sizes are only read in device code. This makes it
+    /// possible to capture the function's work into a CUDA graph, and replay
+    /// it for any event that fits into the buffers.
+    ///
+    /// @param cells         a (resizable) collection of cells
+    /// @param modules       a (resizable) collection of modules
+    /// @param cell_capacity the capacity of @c cells
+    /// @param measurements  a resizable measurement buffer of (at least)
+    ///                      @c cell_capacity capacity (which is never
+    ///                      compacted, @c compact_measurements does not
+    ///                      apply to this function)
+    /// @param spacepoints   a resizable spacepoint buffer of (at least)
+    ///                      @c cell_capacity capacity
+    /// @param cell_links    a buffer of (at least) @c cell_capacity size, or
+    ///                      an empty view to skip writing the links
+    /// @param ccl_backup    a scratch buffer of (at least)
+    ///                      @c ccl_backup_size(cell_capacity) size, used for
+    ///                      labeling the cells of very dense modules, and for
+    ///                      aggregating the clusters
+    /// @param descriptors   the compact descriptors of @c modules to form the
+    ///                      spacepoints with, or an empty view to use
+    ///                      @c modules for it
+    ///
+    void run_bounded(
+        const cell_collection_types::const_view& cells,
+        const cell_module_collection_types::const_view& modules,
+        unsigned int cell_capacity,
+        measurement_collection_types::view measurements,
+        spacepoint_collection_types::view spacepoints,
+        vecmem::data::vector_view<unsigned int> cell_links,
+        vecmem::data::vector_view<unsigned int> ccl_backup,
+        const module_descriptor_soa_collection_types::const_view& descriptors =
+            {}) const;
+
+    /// Get the size of the scratch buffer needed by @c run_bounded
+    ///
+    /// @param cell_capacity the (maximum) number of cells
+    /// @return the number of elements the scratch buffer needs to have
+    ///
+    static unsigned int ccl_backup_size(unsigned int cell_capacity);
+
     private:
+    /// Launch the connected component labeling kernel best suited for the
+    /// input
+    ///
+    /// @param cells         a collection of cells
+    /// @param modules       a collection of modules
+    /// @param n_cells       the (maximum) number of cells
+    /// @param n_modules     the (maximum) number of modules
+    /// @param measurements  the measurement buffer to fill
+    /// @param measurement_count the (device) counter of measurements
+    /// @param cell_links    a buffer of (at least) @c n_cells size, or empty
+    /// @param ccl_backup    a scratch buffer of (at least)
+    ///                      @c ccl_backup_size(n_cells) size
+    ///
+    void launch_ccl(const cell_collection_types::const_view& cells,
+                    const cell_module_collection_types::const_view& modules,
+                    unsigned int n_cells, unsigned int n_modules,
+                    measurement_collection_types::view measurements,
+                    unsigned int& measurement_count,
+                    vecmem::data::vector_view<unsigned int> cell_links,
+                    vecmem::data::vector_view<unsigned int> ccl_backup) const;
+
     /// The average number of cells in each partition
     unsigned short m_target_cells_per_partition;
+    /// The mean number of cells per module below which warp-level CCL is used
+    float m_warp_ccl_max_cells_per_module;
+    /// Whether to copy the measurements into an exact-size buffer
+    bool m_compact_measurements;
+    /// Whether to fill the links from the cells to their spacepoints
+    bool m_produce_cell_links;
     /// The memory resource(s) to use
     traccc::memory_resource m_mr;
     /// The copy object to use
@@ -0,0 +1,80 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Local include(s).
+#include "traccc/cuda/utils/stream.hpp"
+
+// Project include(s).
+#include "traccc/edm/cell.hpp"
+#include "traccc/edm/spacepoint.hpp"
+#include "traccc/utils/algorithm.hpp"
+#include "traccc/utils/memory_resource.hpp"
+
+// VecMem include(s).
+#include <vecmem/utils/copy.hpp>
+
+namespace traccc::cuda::experimental {
+
+/// Algorithm performing hit clusterization and spacepoint formation at once
+///
+/// Performs the work of @c traccc::cuda::experimental::clusterization_algorithm
+/// and @c traccc::cuda::experimental::spacepoint_formation in a single kernel.
+/// The threads that aggregate the clusters of a CCL partition also transform
+/// them into spacepoints, using the placements of the partition's modules
+/// cached in shared memory. So the measurements are not read back from
+/// global memory by a separate kernel.
+///
+/// The measurements are available as part of the spacepoints.
+///
+template <typename detector_t>
+class spacepoint_clusterization_algorithm
+    : public algorithm<spacepoint_collection_types::buffer(
+          const typename detector_t::view_type&,
+          const cell_collection_types::const_view&,
+          const cell_module_collection_types::const_view&)> {
+
+    public:
+    /// Constructor for the algorithm
+    ///
+    /// @param mr The memory resource(s) to use in the algorithm
+    /// @param copy The copy object to use for copying data between device
+    ///             and host memory blocks
+    /// @param str The CUDA stream to perform the operations in
+    /// @param target_cells_per_partition the average number of cells in each
+    /// partition
+    ///
+    spacepoint_clusterization_algorithm(
+        const traccc::memory_resource& mr, vecmem::copy& copy, stream& str,
+        const unsigned short target_cells_per_partition);
+
+    /// Callable operator for the algorithm
+    ///
+    /// @param det_view     a detector view object
+    /// @param cells        a collection of cells
+    /// @param modules      a collection of modules
+    /// @return a spacepoint collection (buffer), sorted by the surfaces of
+    ///         their measurements
+    ///
+    spacepoint_collection_types::buffer operator()(
+        const typename detector_t::view_type& det_view,
+        const cell_collection_types::const_view& cells,
+        const cell_module_collection_types::const_view& modules) const override;
+
+    private:
+    /// The average number of cells in each partition
+    unsigned short m_target_cells_per_partition;
+    /// The memory resource(s) to use
+    traccc::memory_resource m_mr;
+    /// The copy object to use
+    vecmem::copy& m_copy;
+    /// The CUDA stream to use
+    stream& m_stream;
+};
+
+}  // namespace traccc::cuda::experimental
@@ -0,0 +1,66 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s).
+#include "traccc/cuda/utils/stream.hpp"
+#include "traccc/edm/measurement.hpp"
+#include "traccc/utils/algorithm.hpp"
+#include "traccc/utils/memory_resource.hpp"
+
+// VecMem include(s).
+#include <vecmem/utils/copy.hpp>
+
+namespace traccc::cuda {
+
+/// Algorithm sorting the measurements of an event by their surfaces
+///
+/// The track finding algorithm expects the measurements to be grouped by, and
+/// ordered according to, their surface identifiers. The measurements produced
+/// by the clusterization only follow the order of the input modules, so they
+/// need to be sorted before they can be used in the track finding.
+///
+/// The sorting happens in place, as a radix sort on the integer keys of the
+/// measurements' surfaces (see @c traccc::measurement_sort_key). The returned
+/// view points at the same memory as the input, but it always has a fixed
+/// size, even if the input view was describing a resizable buffer.
+///
+class measurement_sorting_algorithm
+    : public algorithm<measurement_collection_types::view(
+          const measurement_collection_types::view&)> {
+
+    public:
+    /// Constructor for the algorithm
+    ///
+    /// @param mr The memory resource(s) to use for the sort keys
+    /// @param copy The copy object to use for copying data between device
+    ///             and host memory blocks
+    /// @param str The CUDA stream to perform the operations in
+    ///
+    measurement_sorting_algorithm(const traccc::memory_resource& mr,
+                                  vecmem::copy& copy, stream& str);
+
+    /// Callable operator for the algorithm
+    ///
+    /// @param measurements The measurements to sort (in place)
+    /// @return A fixed size view of the sorted measurements
+    ///
+    output_type operator()(
+        const measurement_collection_types::view& measurements) const override;
+
+    private:
+    /// The memory resource(s) to use
+    traccc::memory_resource m_mr;
+    /// The copy object to use
+    vecmem::copy& m_copy;
+    /// The CUDA stream to use
+    stream& m_stream;
+
+};  // class measurement_sorting_algorithm
+
+}  // namespace traccc::cuda
@@ -0,0 +1,154 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s).
+#include "traccc/edm/cell.hpp"
+#include "traccc/edm/measurement.hpp"
+#include "traccc/edm/spacepoint.hpp"
+#include "traccc/utils/memory_resource.hpp"
+
+// VecMem include(s).
+#include <vecmem/containers/data/vector_buffer.hpp>
+#include <vecmem/memory/binary_page_memory_resource.hpp>
+
+// System include(s).
+#include <memory>
+#include <vector>
+
+namespace traccc::cuda {
+
+/// @cond
+namespace details {
+struct persistent_queue;
+}
+/// @endcond
+
+/// Clusterization of events by a persistent (resident) kernel
+///
+/// Instead of launching the clusterization kernels for every event, a single
+/// kernel stays resident on the device for the lifetime of the object, and
+/// picks up the events that the host enqueues into a queue in mapped, pinned
+/// host memory. Every event is processed in three stages: the setup of its
+/// buffers, the connected component labeling with one thread block per cell
+/// partition (@c traccc::device::ccl_kernel), and the spacepoint formation
+/// (@c traccc::device::form_spacepoints). The blocks of the kernel claim the
+/// work items of a stage as soon as the previous stage of the event is done,
+/// so the host neither launches kernels nor synchronises streams per event.
+///
+/// The device memory of the events is taken from a caching memory resource,
+/// which does not have to go back to the (device synchronising) CUDA
+/// allocator once it is warmed up. The buffers returned by @c wait must be
+/// released before this object is destroyed.
+///
+/// By default the kernel occupies all of the device, so no other kernel can
+/// run next to it until @c stop is called. Use a smaller number of blocks to
+/// share the device.
+///
+class persistent_clusterization {
+
+    public:
+    /// Type of the tickets identifying the enqueued events
+    using ticket_type = unsigned int;
+
+    /// Type of the results of one event
+    struct output_type {
+        /// The measurements of the event
+        measurement_collection_types::buffer measurements;
+        /// The spacepoints of the event, in the order of the measurements
+        spacepoint_collection_types::buffer spacepoints;
+    };
+
+    /// Constructor, starting the persistent kernel
+    ///
+    /// @param mr The memory resource(s) to use for the event buffers
+    /// @param target_cells_per_partition the average number of cells in each
+    /// partition
+    /// @param queue_size The number of events that can be in flight at the
+    /// same time
+    /// @param n_blocks The number of resident thread blocks, or 0 to use as
+    /// many as the device can run at the same time
+    ///
+    persistent_clusterization(const traccc::memory_resource& mr,
+                              unsigned short target_cells_per_partition,
+                              unsigned int queue_size = 64u,
+                              unsigned int n_blocks = 0u);
+    /// Destructor, stopping the persistent kernel
+    ~persistent_clusterization();
+
+    /// The object can not be copied
+    persistent_clusterization(const persistent_clusterization&) = delete;
+    /// The object can not be copied
+    persistent_clusterization& operator=(const persistent_clusterization&) =
+        delete;
+
+    /// Enqueue an event for clusterization
+    ///
+    /// If @c queue_size events are in flight already, the function waits for
+    /// the oldest of them to finish. The results of that event are discarded
+    /// if they were not collected with @c wait by then.
+    ///
+    /// @param cells The (fixed size) view of the cells of the event
+    /// @param modules The view of the modules of the event
+    /// @return The ticket identifying the event
+    ///
+    ticket_type enqueue(
+        const cell_collection_types::const_view& cells,
+        const cell_module_collection_types::const_view& modules);
+
+    /// Check (without blocking) whether an event is done
+    bool is_done(ticket_type ticket) const;
+
+    /// Wait for an event to be done, and collect its results
+    ///
+    /// @param ticket The ticket returned by @c enqueue for the event
+    /// @return The measurements and spacepoints of the event
+    ///
+    output_type wait(ticket_type ticket);
+
+    /// Finish the enqueued events, and stop the persistent kernel
+    void stop();
+
+    private:
+    /// The buffers of an event in the queue
+    struct event_buffers {
+        /// The ticket of the event
+        ticket_type ticket = 0u;
+        /// Whether the buffers belong to an event that was not collected yet
+        bool pending = false;
+        /// The measurements of the event
+        measurement_collection_types::buffer measurements;
+        /// The spacepoints of the event
+        spacepoint_collection_types::buffer spacepoints;
+        /// Scratch space of the connected component labeling
+        vecmem::data::vector_buffer<unsigned int> backup;
+    };
+
+    /// Wait (by polling the queue) for an event to be done
+    void wait_for(ticket_type ticket) const;
+
+    /// The memory resource(s) to use
+    traccc::memory_resource m_mr;
+    /// Caching resource for the device memory of the events
+    std::unique_ptr<vecmem::binary_page_memory_resource> m_cached_mr;
+    /// The average number of cells in each partition
+    unsigned short m_target_cells_per_partition;
+    /// The number of events that can be in flight at the same time
+    unsigned int m_queue_size;
+    /// The ticket of the next event to enqueue
+    ticket_type m_next_ticket = 0u;
+    /// Whether the persistent kernel was stopped already
+    bool m_stopped = false;
+    /// The buffers of the events in the queue
+    std::vector<event_buffers> m_buffers;
+    /// The (CUDA specific) state of the queue and its kernel
+    std::unique_ptr<details::persistent_queue> m_queue;
+
+};  // class persistent_clusterization
+
+}  // namespace traccc::cuda
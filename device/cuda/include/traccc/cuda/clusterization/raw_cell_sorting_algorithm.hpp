@@ -0,0 +1,86 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s).
+#include "traccc/cuda/utils/stream.hpp"
+#include "traccc/definitions/primitives.hpp"
+#include "traccc/edm/cell.hpp"
+#include "traccc/edm/raw_cell.hpp"
+#include "traccc/geometry/hashed_module_map.hpp"
+#include "traccc/utils/algorithm.hpp"
+#include "traccc/utils/memory_resource.hpp"
+
+// VecMem include(s).
+#include <vecmem/utils/copy.hpp>
+
+namespace traccc::cuda {
+
+/// The cells and modules made by @c traccc::cuda::raw_cell_sorting_algorithm
+struct sorted_cell_buffers {
+    /// The sorted cells, linking to @c modules
+    cell_collection_types::buffer cells;
+    /// The modules of the cells
+    cell_module_collection_types::buffer modules;
+};
+
+/// Algorithm preparing the cells of the readout for the clusterization
+///
+/// The clusterization expects the cells to be grouped by module, sorted by
+/// their channels within every module, and linked to a module collection.
+/// When cells arrive in no particular order (as with @c traccc::raw_cell),
+/// this algorithm does all of that on the device. The cells are (stably)
+/// radix sorted by their channels and then by their modules, and the
+/// modules are filled from a hashed map of the module descriptions of the
+/// detector.
+///
+/// This algorithm returns buffers which are not necessarily filled yet. A
+/// synchronisation statement is required before destroying them.
+///
+class raw_cell_sorting_algorithm
+    : public algorithm<sorted_cell_buffers(
+          const raw_cell_collection_types::const_view&)> {
+
+    public:
+    /// Type of the (device) view of the module descriptions
+    using module_map_view = hashed_module_map_view<geometry_id, cell_module>;
+
+    /// Constructor for the algorithm
+    ///
+    /// @param module_map The module descriptions of the detector, keyed by
+    ///                   their geometry identifiers, in device memory
+    /// @param mr The memory resource(s) to use
+    /// @param copy The copy object to use for copying data between device
+    ///             and host memory blocks
+    /// @param str The CUDA stream to perform the operations in
+    ///
+    raw_cell_sorting_algorithm(const module_map_view& module_map,
+                               const traccc::memory_resource& mr,
+                               vecmem::copy& copy, stream& str);
+
+    /// Callable operator for the algorithm
+    ///
+    /// @param raw_cells The cells of the readout, in no particular order
+    /// @return The sorted cells, and their modules
+    ///
+    output_type operator()(
+        const raw_cell_collection_types::const_view& raw_cells) const override;
+
+    private:
+    /// The module descriptions of the detector
+    module_map_view m_module_map;
+    /// The memory resource(s) to use
+    traccc::memory_resource m_mr;
+    /// The copy object to use
+    vecmem::copy& m_copy;
+    /// The CUDA stream to use
+    stream& m_stream;
+
+};  // class raw_cell_sorting_algorithm
+
+}  // namespace traccc::cuda
@@ -1,6 +1,6 @@
 /** TRACCC library, part of the ACTS project (R&D line)
  *
- * (c) 2023 CERN for the benefit of the ACTS project
+ * (c) 2023-2024 CERN for the benefit of the ACTS project
  *
  * Mozilla Public License Version 2.0
  */
@@ -12,10 +12,15 @@
 #include "traccc/definitions/qualifiers.hpp"
 #include "traccc/edm/measurement.hpp"
 #include "traccc/edm/track_candidate.hpp"
+#include "traccc/edm/track_candidate_soa.hpp"
+#include "traccc/finding/candidate_link.hpp"
+#include "traccc/finding/branch_histogram.hpp"
+#include "traccc/finding/finding_budget_status.hpp"
 #include "traccc/finding/finding_config.hpp"
 #include "traccc/finding/interaction_register.hpp"
 #include "traccc/utils/algorithm.hpp"
 #include "traccc/utils/memory_resource.hpp"
+#include "traccc/utils/workspace_resource.hpp"
 
 // detray include(s).
 #include "detray/propagator/actor_chain.hpp"
@@ -26,16 +31,27 @@
 #include "detray/propagator/propagator.hpp"
 
 // VecMem include(s).
+#include <vecmem/containers/data/jagged_vector_buffer.hpp>
+#include <vecmem/containers/data/vector_buffer.hpp>
 #include <vecmem/utils/copy.hpp>
 #include <vecmem/utils/cuda/copy.hpp>
 
 // Thrust Library
 #include <thrust/pair.h>
 
+// System include(s).
+#include <chrono>
+#include <memory>
+
 namespace traccc::cuda {
 
 /// Track Finding algorithm for a set of tracks
-template <typename stepper_t, typename navigator_t>
+///
+/// @tparam precise_scalar_t The scalar type of the Kalman gain inversions and
+///         chi-squares (see @c traccc::gain_matrix_updater)
+///
+template <typename stepper_t, typename navigator_t,
+          typename precise_scalar_t = typename stepper_t::scalar_type>
 class finding_algorithm
     : public algorithm<track_candidate_container_types::buffer(
           const typename navigator_t::detector_type::view_type&,
@@ -72,10 +88,15 @@ class finding_algorithm
 
     public:
     /// Configuration type
-    using config_type = finding_config<scalar_type>;
+    using config_type = finding_config<scalar_type, precise_scalar_t>;
 
     /// Constructor for the finding algorithm
     ///
+    /// The temporary buffers of every event are created in the workspace of
+    /// @c mr. If it does not have one, the algorithm creates its own, which
+    /// keeps its memory (and grows as needed) over the lifetime of the
+    /// algorithm.
+    ///
     /// @param cfg  Configuration object
     /// @param mr   The memory resource to use
     /// @param copy Copy object
@@ -84,12 +105,26 @@ class finding_algorithm
                       vecmem::copy& copy, stream& str);
 
     /// Get config object (const access)
-    const finding_config<scalar_type>& get_config() const { return m_cfg; }
+    const config_type& get_config() const { return m_cfg; }
+
+    /// Get the number of branches in the steps of the last processed event
+    const branch_histogram& get_branch_histogram() const {
+        return m_branch_histogram;
+    }
+
+    /// Get the budgets that the last processed event exceeded
+    const finding_budget_status& get_budget_status() const {
+        return m_budget_status;
+    }
 
     /// Run the algorithm
     ///
     /// @param det_view  Detector view object
-    /// @param navigation_buffer  Buffer for navigation candidates
+    /// @param navigation_buffer  Buffer for navigation candidates. It may
+    ///                   hold fewer candidate vectors than the number of
+    ///                   tracks, but at least one per thread of a block.
+    ///                   The propagation then processes multiple tracks per
+    ///                   thread.
     /// @param seeds     Input seeds
     track_candidate_container_types::buffer operator()(
         const typename detector_type::view_type& det_view,
@@ -100,15 +135,106 @@ class finding_algorithm
         const bound_track_parameters_collection_types::buffer& seeds)
         const override;
 
+    /// Run the algorithm, with the output in the flat track candidate layout
+    ///
+    /// The candidates refer to the measurements by their index in
+    /// @c measurements. The memory budget of the configuration is not
+    /// applied in this mode, all seeds are always processed at once.
+    ///
+    /// @param det_view  Detector view object
+    /// @param navigation_buffer  Buffer for navigation candidates
+    /// @param seeds     Input seeds
+    track_candidate_soa_collection_types::buffer find_flat(
+        const typename detector_type::view_type& det_view,
+        const bfield_type& field_view,
+        const vecmem::data::jagged_vector_view<
+            typename navigator_t::intersection_type>& navigation_buffer,
+        const typename measurement_collection_types::view& measurements,
+        const bound_track_parameters_collection_types::buffer& seeds) const;
+
     private:
+    /// The links describing the track candidates found by the step loop
+    struct link_buffers {
+        /// The candidate links of every step
+        vecmem::data::jagged_vector_buffer<candidate_link> links;
+        /// The parameter index -> link index maps of every step
+        vecmem::data::jagged_vector_buffer<unsigned int> param_to_link;
+        /// The tip links of all tracks
+        vecmem::data::vector_buffer<typename candidate_link::link_index_type>
+            tips;
+    };
+
+    /// Clock used for the wall-clock budget of the track finding
+    using clock_type = std::chrono::steady_clock;
+
+    /// Apply the seed budget of the configuration
+    ///
+    /// @param seeds The seeds of the event
+    /// @return A copy of the first seeds, if there are more seeds than the
+    ///         budget, or an empty buffer otherwise
+    ///
+    bound_track_parameters_collection_types::buffer truncate_seeds(
+        const bound_track_parameters_collection_types::buffer& seeds) const;
+
+    /// Run the step loop of the track finding
+    ///
+    /// The returned buffers live in the workspace of the algorithm, until
+    /// its next execution.
+    ///
+    /// @param start The start time of the track finding of the event
+    ///
+    link_buffers find_links(
+        const typename detector_type::view_type& det_view,
+        const bfield_type& field_view,
+        const vecmem::data::jagged_vector_view<
+            typename navigator_t::intersection_type>& navigation_buffer,
+        const typename measurement_collection_types::view& measurements,
+        const bound_track_parameters_collection_types::buffer& seeds,
+        clock_type::time_point start) const;
+
+    /// Run the step loop, and build the track candidates of all seeds
+    ///
+    /// @param start The start time of the track finding of the event
+    ///
+    track_candidate_container_types::buffer find_tracks(
+        const typename detector_type::view_type& det_view,
+        const bfield_type& field_view,
+        const vecmem::data::jagged_vector_view<
+            typename navigator_t::intersection_type>& navigation_buffer,
+        const typename measurement_collection_types::view& measurements,
+        const bound_track_parameters_collection_types::buffer& seeds,
+        clock_type::time_point start) const;
+
+    /// Run the algorithm on chunks of the seeds, one after the other
+    ///
+    /// @param chunk_size The (maximal) number of seeds per chunk
+    /// @param start The start time of the track finding of the event
+    ///
+    track_candidate_container_types::buffer find_in_chunks(
+        const typename detector_type::view_type& det_view,
+        const bfield_type& field_view,
+        const vecmem::data::jagged_vector_view<
+            typename navigator_t::intersection_type>& navigation_buffer,
+        const typename measurement_collection_types::view& measurements,
+        const bound_track_parameters_collection_types::buffer& seeds,
+        unsigned int chunk_size, clock_type::time_point start) const;
+
     /// Config object
     config_type m_cfg;
     /// Memory resource used by the algorithm
     traccc::memory_resource m_mr;
+    /// The workspace owned by the algorithm, if @c m_mr has none
+    std::unique_ptr<workspace_resource> m_own_workspace;
+    /// The workspace used for the temporary buffers of the algorithm
+    workspace_resource* m_workspace;
     /// The copy object to use
     vecmem::copy& m_copy;
     /// The CUDA stream to use
     stream& m_stream;
+    /// The number of branches in the steps of the last processed event
+    mutable branch_histogram m_branch_histogram;
+    /// The budgets that the last processed event exceeded
+    mutable finding_budget_status m_budget_status;
 };
 
 }  // namespace traccc::cuda
\ No newline at end of file
@@ -0,0 +1,71 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s).
+#include "traccc/cuda/utils/stream.hpp"
+#include "traccc/edm/track_candidate.hpp"
+#include "traccc/edm/truth_match.hpp"
+#include "traccc/utils/algorithm.hpp"
+#include "traccc/utils/memory_resource.hpp"
+
+// VecMem include(s).
+#include <vecmem/utils/copy.hpp>
+
+namespace traccc::cuda {
+
+/// Algorithm matching the track candidates to the truth particles
+///
+/// Looks up the measurements of every track candidate among the truth
+/// matched measurements of the event on the device, so that only the compact
+/// matches need to be copied back to the host for the performance
+/// monitoring (see @c traccc::finding_performance_writer).
+///
+/// This algorithm returns a buffer which is not necessarily filled yet. A
+/// synchronisation statement is required before destroying this buffer.
+///
+class truth_matching_algorithm
+    : public algorithm<track_truth_match_collection_types::buffer(
+          const track_candidate_container_types::const_view&,
+          const measurement_particle_container_types::const_view&)> {
+
+    public:
+    /// Constructor for the algorithm
+    ///
+    /// @param mr The memory resource(s) to use
+    /// @param copy The copy object to use for copying data between device
+    ///             and host memory blocks
+    /// @param str The CUDA stream to perform the operations in
+    ///
+    truth_matching_algorithm(const traccc::memory_resource& mr,
+                             vecmem::copy& copy, stream& str);
+
+    /// Callable operator for the algorithm
+    ///
+    /// @param track_candidates_view The track candidates of the event
+    /// @param truth_view The particles contributing to the measurements of
+    ///                   the event, with the measurements sorted
+    /// @return The match of every track candidate
+    ///
+    output_type operator()(
+        const track_candidate_container_types::const_view&
+            track_candidates_view,
+        const measurement_particle_container_types::const_view& truth_view)
+        const override;
+
+    private:
+    /// The memory resource(s) to use
+    traccc::memory_resource m_mr;
+    /// The copy object to use
+    vecmem::copy& m_copy;
+    /// The CUDA stream to use
+    stream& m_stream;
+
+};  // class truth_matching_algorithm
+
+}  // namespace traccc::cuda
@@ -1,6 +1,6 @@
 /** TRACCC library, part of the ACTS project (R&D line)
  *
- * (c) 2022 CERN for the benefit of the ACTS project
+ * (c) 2022-2024 CERN for the benefit of the ACTS project
  *
  * Mozilla Public License Version 2.0
  */
@@ -9,7 +9,9 @@
 
 // Project include(s).
 #include "traccc/cuda/utils/stream.hpp"
+#include "traccc/edm/measurement.hpp"
 #include "traccc/edm/track_candidate.hpp"
+#include "traccc/edm/track_candidate_soa.hpp"
 #include "traccc/edm/track_state.hpp"
 #include "traccc/fitting/fitting_config.hpp"
 #include "traccc/utils/algorithm.hpp"
@@ -48,7 +50,19 @@ class fitting_algorithm
     fitting_algorithm(const config_type& cfg, const traccc::memory_resource& mr,
                       vecmem::copy& copy, stream& str);
 
+    /// Get the warp efficiency of the last processed event
+    ///
+    /// It is the estimated fraction of the lanes of the fitting warps doing
+    /// useful work, with the track lengths as the measure of work.
+    ///
+    float get_warp_efficiency() const { return m_warp_efficiency; }
+
     /// Run the algorithm
+    ///
+    /// The navigation buffer may hold fewer candidate vectors than the number
+    /// of tracks, but at least one per thread of a block. The fit then
+    /// processes multiple tracks per thread.
+    ///
     track_state_container_types::buffer operator()(
         const typename fitter_t::detector_type::view_type& det_view,
         const typename fitter_t::bfield_type& field_view,
@@ -57,6 +71,19 @@ class fitting_algorithm
         const typename track_candidate_container_types::const_view&
             track_candidates_view) const override;
 
+    /// Run the algorithm on track candidates in the flat layout
+    ///
+    /// @param measurements_view The measurements the candidates refer to
+    ///
+    track_state_container_types::buffer operator()(
+        const typename fitter_t::detector_type::view_type& det_view,
+        const typename fitter_t::bfield_type& field_view,
+        const vecmem::data::jagged_vector_view<
+            typename fitter_t::intersection_type>& navigation_buffer,
+        const measurement_collection_types::const_view& measurements_view,
+        const track_candidate_soa_collection_types::const_view&
+            track_candidates_view) const;
+
     private:
     /// Config object
     config_type m_cfg;
@@ -66,6 +93,8 @@ class fitting_algorithm
     vecmem::copy& m_copy;
     /// The CUDA stream to use
     stream& m_stream;
+    /// The warp efficiency of the last processed event
+    mutable float m_warp_efficiency = 1.f;
 };
 
 }  // namespace traccc::cuda
\ No newline at end of file
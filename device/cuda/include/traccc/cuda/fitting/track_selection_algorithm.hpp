@@ -0,0 +1,66 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s).
+#include "traccc/cuda/utils/stream.hpp"
+#include "traccc/edm/track_state.hpp"
+#include "traccc/fitting/track_selection.hpp"
+#include "traccc/utils/algorithm.hpp"
+#include "traccc/utils/memory_resource.hpp"
+
+// VecMem include(s).
+#include <vecmem/utils/copy.hpp>
+
+namespace traccc::cuda {
+
+/// Algorithm selecting fitted tracks with @c traccc::track_selector, on the
+/// device
+///
+/// Running the selection before copying the tracks to the host means that
+/// only the selected tracks need to be transferred. The selected tracks are
+/// gathered into a dense buffer, keeping their order.
+///
+/// This algorithm returns a buffer which is not necessarily filled yet. A
+/// synchronisation statement is required before destroying it.
+///
+class track_selection_algorithm
+    : public algorithm<track_state_container_types::buffer(
+          const track_state_container_types::const_view&)> {
+
+    public:
+    /// Constructor for the track selection
+    ///
+    /// @param cfg  The selection configuration
+    /// @param mr   The memory resource to use
+    /// @param copy Copy object
+    /// @param str  Cuda stream object
+    track_selection_algorithm(const track_selection_config& cfg,
+                              const traccc::memory_resource& mr,
+                              vecmem::copy& copy, stream& str);
+
+    /// Run the algorithm
+    ///
+    /// @param track_states_view The fitted tracks
+    /// @return The selected tracks
+    ///
+    output_type operator()(const track_state_container_types::const_view&
+                               track_states_view) const override;
+
+    private:
+    /// The selection configuration
+    track_selection_config m_cfg;
+    /// Memory resource used by the algorithm
+    traccc::memory_resource m_mr;
+    /// The copy object to use
+    vecmem::copy& m_copy;
+    /// The CUDA stream to use
+    stream& m_stream;
+};
+
+}  // namespace traccc::cuda
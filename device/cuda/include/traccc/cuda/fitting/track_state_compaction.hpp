@@ -0,0 +1,72 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s).
+#include "traccc/cuda/utils/stream.hpp"
+#include "traccc/edm/compact_track_state.hpp"
+#include "traccc/edm/track_state.hpp"
+#include "traccc/utils/algorithm.hpp"
+#include "traccc/utils/memory_resource.hpp"
+
+// VecMem include(s).
+#include <vecmem/utils/copy.hpp>
+
+namespace traccc::cuda {
+
+/// Algorithm turning fitted track states into compact track states, on the
+/// device
+///
+/// Compacting the states before copying them to the host shrinks the
+/// transfer by several times. Once the compact states are made, the buffer
+/// of the full states can be released. The covariances of the smoothed
+/// parameters are only kept if requested, with @c covariances.
+///
+/// This algorithm returns buffers which are not necessarily filled yet. A
+/// synchronisation statement is required before destroying them.
+///
+class track_state_compaction
+    : public algorithm<compact_track_state_container_types::buffer(
+          const track_state_container_types::const_view&)> {
+
+    public:
+    /// Constructor for the track state compaction
+    ///
+    /// @param mr   The memory resource to use
+    /// @param copy Copy object
+    /// @param str  Cuda stream object
+    track_state_compaction(const traccc::memory_resource& mr,
+                           vecmem::copy& copy, stream& str);
+
+    /// Run the algorithm
+    ///
+    /// @param track_states_view The fitted track states
+    /// @return The compact states, with the same fitting results per track
+    ///
+    output_type operator()(const track_state_container_types::const_view&
+                               track_states_view) const override;
+
+    /// Collect the covariances of the smoothed parameters
+    ///
+    /// @param track_states_view The fitted track states
+    /// @return The covariances, in the same layout as the compact states
+    ///
+    compact_track_covariance_types::buffer covariances(
+        const track_state_container_types::const_view& track_states_view)
+        const;
+
+    private:
+    /// Memory resource used by the algorithm
+    traccc::memory_resource m_mr;
+    /// The copy object to use
+    vecmem::copy& m_copy;
+    /// The CUDA stream to use
+    stream& m_stream;
+};
+
+}  // namespace traccc::cuda
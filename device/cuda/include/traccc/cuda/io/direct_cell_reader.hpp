@@ -0,0 +1,85 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s).
+#include "traccc/cuda/utils/stream.hpp"
+#include "traccc/edm/cell.hpp"
+
+// VecMem include(s).
+#include <vecmem/memory/memory_resource.hpp>
+
+// System include(s).
+#include <cstddef>
+#include <memory>
+#include <string_view>
+#include <utility>
+
+namespace traccc::cuda {
+
+/// Reader of binary cell files, straight into device memory
+///
+/// The payloads of @c traccc::data_format::binary cell and module files are
+/// read with cuFile (GPUDirect Storage), which DMA-s them from the storage
+/// directly into the device buffers, without a copy in host memory.
+///
+/// If the library was built without cuFile, or GPUDirect Storage is not
+/// usable on the machine, the payloads are instead streamed through a pair
+/// of pinned bounce buffers, overlapping the file reads with the
+/// host-to-device copies.
+///
+class direct_cell_reader {
+
+    public:
+    /// Output type of the reader: the cells and the modules of an event
+    using output_type = std::pair<cell_collection_types::buffer,
+                                  cell_module_collection_types::buffer>;
+
+    /// Constructor
+    ///
+    /// @param mr The device memory resource to allocate the buffers with
+    /// @param str The stream to perform the (fallback) copies on
+    /// @param use_gds Whether to try using GPUDirect Storage at all
+    /// @param bounce_buffer_size The size of each of the two pinned bounce
+    ///                           buffers (in bytes)
+    ///
+    direct_cell_reader(vecmem::memory_resource& mr, stream& str,
+                       bool use_gds = true,
+                       std::size_t bounce_buffer_size = 16 * 1024 * 1024);
+
+    /// Destructor
+    ~direct_cell_reader();
+
+    /// Copying is not allowed
+    direct_cell_reader(const direct_cell_reader&) = delete;
+    /// Copying is not allowed
+    direct_cell_reader& operator=(const direct_cell_reader&) = delete;
+
+    /// Read the cells and modules of an event into device memory
+    ///
+    /// The function returns once the data has arrived in the buffers.
+    ///
+    /// @param cells_file The full name of the binary cell file
+    /// @param modules_file The full name of the binary module file
+    /// @return The device buffers holding the cells and the modules
+    ///
+    output_type operator()(std::string_view cells_file,
+                           std::string_view modules_file) const;
+
+    /// Whether GPUDirect Storage is used by the reader
+    bool uses_gds() const;
+
+    private:
+    /// Internal data type
+    struct impl;
+    /// Pointer to the internal data
+    std::unique_ptr<impl> m_impl;
+
+};  // class direct_cell_reader
+
+}  // namespace traccc::cuda
@@ -0,0 +1,114 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s).
+#include "traccc/cuda/utils/stream.hpp"
+#include "traccc/edm/measurement.hpp"
+#include "traccc/edm/spacepoint.hpp"
+#include "traccc/edm/track_candidate.hpp"
+#include "traccc/edm/track_candidate_soa.hpp"
+#include "traccc/seeding/detail/spacepoint_soa_grid.hpp"
+#include "traccc/utils/algorithm.hpp"
+#include "traccc/utils/memory_resource.hpp"
+
+// VecMem include(s).
+#include <vecmem/containers/data/vector_buffer.hpp>
+#include <vecmem/containers/data/vector_view.hpp>
+#include <vecmem/utils/copy.hpp>
+
+namespace traccc::cuda {
+
+/// Masking of the hits used by earlier tracking passes, for the seeding of
+/// later passes
+///
+/// The measurements used by the track candidates of a pass are marked in a
+/// device bitmask (see @c mark). The spacepoint grid of the first pass is
+/// then masked, keeping only the spacepoints of unused measurements, in
+/// their order in the original bins. So later seeding passes can run on
+/// the masked grid directly (see
+/// @c traccc::cuda::seeding_algorithm::operator()), without filtering the
+/// spacepoints on the host and re-binning them.
+///
+/// This algorithm returns a buffer which is not necessarily filled yet. A
+/// synchronisation statement is required before destroying it.
+///
+class hit_masking
+    : public algorithm<sp_soa_grid_types::buffer(
+          const sp_soa_grid_types::const_view&,
+          const spacepoint_collection_types::const_view&,
+          const measurement_collection_types::const_view&,
+          const vecmem::data::vector_view<const unsigned int>&)> {
+
+    public:
+    /// Constructor for the hit masking
+    ///
+    /// @param mr The memory resource(s) to use
+    /// @param copy The copy object to use for copying data between device
+    ///             and host memory blocks
+    /// @param str The CUDA stream to perform the operations in
+    ///
+    hit_masking(const traccc::memory_resource& mr, vecmem::copy& copy,
+                stream& str);
+
+    /// Create an (all clear) bitmask for some number of measurements
+    ///
+    /// @param n_measurements The number of measurements of the event
+    /// @return The bitmask, with one bit per measurement
+    ///
+    vecmem::data::vector_buffer<unsigned int> make_mask(
+        unsigned int n_measurements) const;
+
+    /// Mark the measurements used by some track candidates
+    ///
+    /// @param measurements The measurements, sorted by their surfaces (as
+    ///                     used by the track finding)
+    /// @param track_candidates The track candidates of a tracking pass
+    /// @param mask The bitmask of the used measurements, to update
+    ///
+    void mark(const measurement_collection_types::const_view& measurements,
+              const track_candidate_container_types::const_view&
+                  track_candidates,
+              const vecmem::data::vector_view<unsigned int>& mask) const;
+
+    /// Mark the measurements used by some flat track candidates
+    ///
+    /// @param track_candidates The track candidates of a tracking pass, in
+    ///                         flat layout
+    /// @param mask The bitmask of the used measurements, to update
+    ///
+    void mark(const track_candidate_soa_collection_types::const_view&
+                  track_candidates,
+              const vecmem::data::vector_view<unsigned int>& mask) const;
+
+    /// Mask the spacepoint grid of an event
+    ///
+    /// @param grid The spacepoint grid of the event
+    /// @param spacepoints All spacepoints of the event
+    /// @param measurements The measurements, sorted by their surfaces
+    /// @param mask The bitmask of the used measurements
+    /// @return The grid of the spacepoints of the unused measurements
+    ///
+    output_type operator()(
+        const sp_soa_grid_types::const_view& grid,
+        const spacepoint_collection_types::const_view& spacepoints,
+        const measurement_collection_types::const_view& measurements,
+        const vecmem::data::vector_view<const unsigned int>& mask)
+        const override;
+
+    private:
+    /// The memory resource(s) to use
+    traccc::memory_resource m_mr;
+    /// The copy object to use
+    vecmem::copy& m_copy;
+    /// The CUDA stream to use
+    stream& m_stream;
+
+};  // class hit_masking
+
+}  // namespace traccc::cuda
@@ -0,0 +1,70 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s).
+#include "traccc/cuda/utils/stream.hpp"
+#include "traccc/edm/seed.hpp"
+#include "traccc/edm/spacepoint.hpp"
+#include "traccc/seeding/detail/hough_seeding_config.hpp"
+#include "traccc/utils/algorithm.hpp"
+#include "traccc/utils/memory_resource.hpp"
+
+// VecMem include(s).
+#include <vecmem/utils/copy.hpp>
+
+namespace traccc::cuda {
+
+/// Track seeding with a binned Hough transform, on an NVIDIA GPU
+///
+/// An alternative to @c traccc::cuda::seeding_algorithm, with the same
+/// interface. Every spacepoint votes for the (q/pT, phi0) cells of the
+/// cot(theta) slices that it is compatible with, in one thread, so the cost
+/// of the seeding grows linearly with the number of spacepoints.
+///
+/// This algorithm returns a buffer which is not necessarily filled yet. A
+/// synchronisation statement is required before destroying this buffer.
+///
+class hough_seeding_algorithm
+    : public algorithm<seed_collection_types::buffer(
+          const spacepoint_collection_types::const_view&)> {
+
+    public:
+    /// Constructor for the seeding algorithm
+    ///
+    /// @param config The configuration of the Hough transform
+    /// @param mr The memory resource(s) to use in the algorithm
+    /// @param copy The copy object to use for copying data between device
+    ///             and host memory blocks
+    /// @param str The CUDA stream to perform the operations in
+    ///
+    hough_seeding_algorithm(const hough_seeding_config& config,
+                            const traccc::memory_resource& mr,
+                            vecmem::copy& copy, stream& str);
+
+    /// Operator executing the algorithm.
+    ///
+    /// @param spacepoints_view is a view of all spacepoints in the event
+    /// @return the buffer of track seeds reconstructed from the spacepoints
+    ///
+    output_type operator()(const spacepoint_collection_types::const_view&
+                               spacepoints_view) const override;
+
+    private:
+    /// The configuration of the Hough transform
+    hough_seeding_config m_config;
+    /// The memory resource(s) to use
+    traccc::memory_resource m_mr;
+    /// The copy object to use
+    vecmem::copy& m_copy;
+    /// The CUDA stream to use
+    stream& m_stream;
+
+};  // class hough_seeding_algorithm
+
+}  // namespace traccc::cuda
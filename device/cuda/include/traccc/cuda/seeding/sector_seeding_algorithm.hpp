@@ -0,0 +1,105 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Library include(s).
+#include "traccc/cuda/seeding/seeding_algorithm.hpp"
+#include "traccc/cuda/utils/stream.hpp"
+
+// Project include(s).
+#include "traccc/definitions/primitives.hpp"
+#include "traccc/edm/seed.hpp"
+#include "traccc/edm/spacepoint.hpp"
+#include "traccc/seeding/detail/seeding_config.hpp"
+#include "traccc/utils/algorithm.hpp"
+#include "traccc/utils/memory_resource.hpp"
+
+// VecMem include(s).
+#include <vecmem/utils/copy.hpp>
+
+// System include(s).
+#include <memory>
+#include <vector>
+
+namespace traccc::cuda {
+
+/// Track seeding running on phi sectors of the event in parallel
+///
+/// Splits the spacepoints of an event into @c n_sectors sectors in phi, each
+/// extended by an overlap with its neighbours, and runs the seeding of every
+/// sector on its own CUDA stream. The sectors are scheduled by separate host
+/// threads, so the synchronisations inside of the seeding of one sector do
+/// not hold up the others. The seeds of the sectors are then merged, keeping
+/// every seed only in the sector that its middle spacepoint belongs to.
+///
+/// For the seeds to be the same as the ones of
+/// @c traccc::cuda::seeding_algorithm, the overlap needs to cover the phi
+/// distance between the middle spacepoints and their bottom and top
+/// spacepoints.
+///
+/// The memory resources are used by the host threads of the sectors at the
+/// same time, so they need to be thread safe.
+///
+/// This algorithm returns a buffer which is filled already.
+///
+class sector_seeding_algorithm
+    : public algorithm<seed_collection_types::buffer(
+          const spacepoint_collection_types::const_view&)> {
+
+    public:
+    /// Constructor for the sectored seeding
+    ///
+    /// @param finder_config The seed finding configuration of the sectors
+    /// @param grid_config The spacepoint grid configuration of the sectors
+    /// @param filter_config The seed filtering configuration of the sectors
+    /// @param mr The memory resource(s) to use in the algorithm
+    /// @param copy The copy object to use for copying data between device
+    ///             and host memory blocks
+    /// @param str The CUDA stream to merge the seeds of the sectors in
+    /// @param n_sectors The number of phi sectors to split the events into
+    /// @param overlap The phi range (in radians) on either side of a sector
+    ///                that its seeding also uses the spacepoints of
+    ///
+    sector_seeding_algorithm(const seedfinder_config& finder_config,
+                             const spacepoint_grid_config& grid_config,
+                             const seedfilter_config& filter_config,
+                             const traccc::memory_resource& mr,
+                             vecmem::copy& copy, stream& str,
+                             unsigned int n_sectors = 4u,
+                             scalar overlap = 0.1f);
+    /// Destructor
+    ~sector_seeding_algorithm();
+
+    /// Operator executing the algorithm.
+    ///
+    /// @param spacepoints_view is a view of all spacepoints in the event
+    /// @return the buffer of track seeds reconstructed from the spacepoints
+    ///
+    output_type operator()(const spacepoint_collection_types::const_view&
+                               spacepoints_view) const override;
+
+    private:
+    /// The objects used for the seeding of one sector
+    struct sector;
+
+    /// The memory resource(s) to use
+    traccc::memory_resource m_mr;
+    /// The copy object to use
+    vecmem::copy& m_copy;
+    /// The CUDA stream to merge the seeds in
+    stream& m_stream;
+    /// The CUDA device to run the sectors on
+    int m_device;
+    /// The phi range on either side of a sector to also use
+    scalar m_overlap;
+    /// The objects used for the seeding of the sectors
+    std::vector<std::unique_ptr<sector>> m_sectors;
+
+};  // class sector_seeding_algorithm
+
+}  // namespace traccc::cuda
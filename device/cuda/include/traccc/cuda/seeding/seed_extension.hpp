@@ -0,0 +1,86 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s).
+#include "traccc/cuda/utils/stream.hpp"
+#include "traccc/edm/nseed.hpp"
+#include "traccc/edm/seed.hpp"
+#include "traccc/edm/spacepoint.hpp"
+#include "traccc/seeding/detail/seeding_config.hpp"
+#include "traccc/seeding/detail/spacepoint_soa_grid.hpp"
+#include "traccc/utils/algorithm.hpp"
+#include "traccc/utils/memory_resource.hpp"
+
+// VecMem include(s).
+#include <vecmem/utils/copy.hpp>
+
+// System include(s).
+#include <utility>
+
+namespace traccc::cuda {
+
+/// Seed extension executed on a CUDA device
+///
+/// Extends the triplet seeds produced by @c traccc::cuda::seed_finding with
+/// compatible spacepoints from the spacepoint grid, into
+/// @c traccc::extended_seed objects. Also produces the collection of the
+/// triplet seeds that could be extended to at least
+/// @c traccc::seed_extension_config::min_seed_size spacepoints.
+///
+/// This algorithm returns buffers which are not necessarily filled yet. A
+/// synchronisation statement is required before destroying these buffers.
+///
+class seed_extension
+    : public algorithm<std::pair<extended_seed_collection_types::buffer,
+                                 seed_collection_types::buffer>(
+          const spacepoint_collection_types::const_view&,
+          const sp_soa_grid_types::const_view&,
+          const seed_collection_types::const_view&)> {
+
+    public:
+    /// Constructor for the algorithm
+    ///
+    /// @param finder_config The seed finder configuration
+    /// @param extension_config The seed extension configuration
+    /// @param mr The memory resource(s) to use in the algorithm
+    /// @param copy The copy object to use for copying data between device
+    ///             and host memory blocks
+    /// @param str The CUDA stream to perform the operations in
+    ///
+    seed_extension(const seedfinder_config& finder_config,
+                   const seed_extension_config& extension_config,
+                   const traccc::memory_resource& mr, vecmem::copy& copy,
+                   stream& str);
+
+    /// Callable operator for the seed extension
+    ///
+    /// @param spacepoints_view All spacepoints in the event
+    /// @param g2_view The spacepoint grid that the seeds were found on
+    /// @param seeds_view The triplet seeds to extend
+    /// @return The extended seeds, and the triplet seeds that were kept
+    ///
+    output_type operator()(
+        const spacepoint_collection_types::const_view& spacepoints_view,
+        const sp_soa_grid_types::const_view& g2_view,
+        const seed_collection_types::const_view& seeds_view) const override;
+
+    private:
+    /// Member variables
+    seedfinder_config m_finder_config;
+    seed_extension_config m_extension_config;
+    traccc::memory_resource m_mr;
+
+    /// The copy object to use
+    vecmem::copy& m_copy;
+    /// The CUDA stream to use
+    stream& m_stream;
+
+};  // class seed_extension
+
+}  // namespace traccc::cuda
@@ -1,6 +1,6 @@
 /** TRACCC library, part of the ACTS project (R&D line)
  *
- * (c) 2021-2023 CERN for the benefit of the ACTS project
+ * (c) 2021-2024 CERN for the benefit of the ACTS project
  *
  * Mozilla Public License Version 2.0
  */
@@ -11,19 +11,45 @@
 #include "traccc/cuda/utils/stream.hpp"
 #include "traccc/edm/seed.hpp"
 #include "traccc/edm/spacepoint.hpp"
+#include "traccc/edm/track_parameters.hpp"
+#include "traccc/seeding/device/estimate_track_params.hpp"
+#include "traccc/seeding/detail/seed_finding_capacities.hpp"
 #include "traccc/seeding/detail/seeding_config.hpp"
-#include "traccc/seeding/detail/spacepoint_grid.hpp"
+#include "traccc/seeding/detail/spacepoint_soa_grid.hpp"
 #include "traccc/utils/algorithm.hpp"
+#include "traccc/utils/capacity_predictor.hpp"
 #include "traccc/utils/memory_resource.hpp"
 
 // VecMem include(s).
 #include <vecmem/utils/copy.hpp>
 
 // System include(s).
+#include <array>
 #include <functional>
+#include <utility>
 
 namespace traccc::cuda {
 
+/// Configuration of the seed selection step of @c traccc::cuda::seed_finding
+struct seed_selection_config {
+
+    /// Whether to select the seeds of every middle spacepoint with a full
+    /// warp, keeping its @c traccc::seedfilter_config::max_triplets_per_spM
+    /// (at most @c WARP_SIZE) best triplets with a warp-level bitonic top-k,
+    /// instead of with a single thread
+    bool warp_cooperative = false;
+    /// The number of warps in each thread block of the warp-cooperative
+    /// selection
+    unsigned int warps_per_block = 2;
+
+    /// Whether to use the seeding kernels specialised at compile time for
+    /// one of the @c traccc::seeding_presets, if the configuration of the
+    /// seed finding matches one of them. The kernels taking all values from
+    /// the runtime configuration are used otherwise.
+    bool use_presets = true;
+
+};  // struct seed_selection_config
+
 /// Seed finding for cuda
 ///
 /// This algorithm returns a buffer which is not necessarily filled yet. A
@@ -31,9 +57,14 @@ namespace traccc::cuda {
 ///
 class seed_finding : public algorithm<seed_collection_types::buffer(
                          const spacepoint_collection_types::const_view&,
-                         const sp_grid_const_view&)> {
+                         const sp_soa_grid_types::const_view&)> {
 
     public:
+    /// The seeds, with their estimated track parameters
+    using params_output_type =
+        std::pair<seed_collection_types::buffer,
+                  bound_track_parameters_collection_types::buffer>;
+
     /// Constructor for the cuda seed finding
     ///
     /// @param config is seed finder configuration parameters
@@ -43,10 +74,20 @@ class seed_finding : public algorithm<seed_collection_types::buffer(
     /// @param copy The copy object to use for copying data between device
     ///             and host memory blocks
     /// @param str The CUDA stream to perform the operations in
+    /// @param capacities The (fixed or adaptive) capacities to use for
+    ///                   finding the seeds without intermediate host
+    ///                   synchronisation (disabled by default)
+    /// @param selection The configuration of the seed selection step
+    ///
+    /// @throws std::invalid_argument If the warp-cooperative seed selection
+    ///         is requested with more than @c WARP_SIZE triplets per middle
+    ///         spacepoint, or without any warps per block
+    ///
     seed_finding(const seedfinder_config& config,
                  const seedfilter_config& filter_config,
                  const traccc::memory_resource& mr, vecmem::copy& copy,
-                 stream& str);
+                 stream& str, const seed_finding_capacities& capacities = {},
+                 const seed_selection_config& selection = {});
 
     /// Callable operator for the seed finding
     ///
@@ -56,11 +97,89 @@ class seed_finding : public algorithm<seed_collection_types::buffer(
     ///
     output_type operator()(
         const spacepoint_collection_types::const_view& spacepoints_view,
-        const sp_grid_const_view& g2_view) const override;
+        const sp_soa_grid_types::const_view& g2_view) const override;
+
+    /// Find the seeds, and estimate their track parameters right away
+    ///
+    /// The parameters are calculated by the seed selecting kernel, from the
+    /// spacepoints that it has just read, instead of by a separate
+    /// @c traccc::cuda::track_params_estimation pass over the seeds. The
+    /// resulting parameters are the same.
+    ///
+    /// @param spacepoints_view     is a view of all spacepoints in the event
+    /// @param g2_view              is a view of the spacepoint grid
+    /// @param bfield               is the (temporary) magnetic field vector
+    /// @param stddev               is the standard deviation for setting the
+    ///                             covariance of the parameters
+    /// @return                     the buffers of the seeds, and of their
+    ///                             parameters
+    ///
+    params_output_type operator()(
+        const spacepoint_collection_types::const_view& spacepoints_view,
+        const sp_soa_grid_types::const_view& g2_view, const vector3& bfield,
+        const std::array<traccc::scalar, traccc::e_bound_size>& stddev) const;
 
     private:
+    /// Find the seeds (and possibly their parameters)
+    ///
+    /// @param spacepoints_view     is a view of all spacepoints in the event
+    /// @param g2_view              is a view of the spacepoint grid
+    /// @param params_config        is the configuration of the parameter
+    ///                             estimation, or @c nullptr to only find
+    ///                             the seeds
+    /// @return                     the buffers of the seeds and parameters
+    ///
+    params_output_type find(
+        const spacepoint_collection_types::const_view& spacepoints_view,
+        const sp_soa_grid_types::const_view& g2_view,
+        const device::seed_params_config* params_config) const;
+    /// Find the seeds, with either exactly sized or capacity-bounded buffers
+    ///
+    /// @param spacepoints_view     is a view of all spacepoints in the event
+    /// @param g2_view              is a view of the spacepoint grid
+    /// @param num_spacepoints      is the number of spacepoints in the grid
+    /// @param bounded              whether to use @c m_capacities
+    /// @param params_config        is the configuration of the parameter
+    ///                             estimation, or @c nullptr
+    /// @param fits                 set to whether all doublets and triplets
+    ///                             fit into the buffers
+    /// @return                     the buffers of the seeds and parameters
+    ///
+    params_output_type find_seeds(
+        const spacepoint_collection_types::const_view& spacepoints_view,
+        const sp_soa_grid_types::const_view& g2_view,
+        unsigned int num_spacepoints, bool bounded,
+        const device::seed_params_config* params_config, bool& fits) const;
+    /// Find the seeds with kernels specialised for a seeding configuration
+    ///
+    /// @tparam seeding_config_t The (static or runtime) seeding configuration
+    ///                          values to specialise the kernels for
+    ///
+    template <typename seeding_config_t>
+    params_output_type find_seeds_impl(
+        const spacepoint_collection_types::const_view& spacepoints_view,
+        const sp_soa_grid_types::const_view& g2_view,
+        unsigned int num_spacepoints, bool bounded,
+        const device::seed_params_config* params_config, bool& fits) const;
+
+    /// The seeding configuration presets that the kernels can be specialised
+    /// for
+    enum class seeding_preset { none, default_config, dense_config };
+
     seedfinder_config m_seedfinder_config;
     seedfilter_config m_seedfilter_config;
+    /// Capacities for the bounded (synchronisation-free) mode
+    seed_finding_capacities m_capacities;
+    /// @name Predictors of the capacities in adaptive mode
+    /// @{
+    mutable capacity_predictor m_mid_bot_predictor;
+    mutable capacity_predictor m_mid_top_predictor;
+    mutable capacity_predictor m_triplet_predictor;
+    /// @}
+    /// Configuration of the seed selection
+    seed_selection_config m_selection;
+    /// The preset matching the configuration of the seed finding (if any)
+    seeding_preset m_preset = seeding_preset::none;
     traccc::memory_resource m_mr;
 
     /// The copy object to use
@@ -0,0 +1,83 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s).
+#include "traccc/cuda/utils/stream.hpp"
+#include "traccc/edm/seed.hpp"
+#include "traccc/edm/track_parameters.hpp"
+#include "traccc/seeding/detail/seeding_config.hpp"
+#include "traccc/utils/algorithm.hpp"
+#include "traccc/utils/memory_resource.hpp"
+
+// VecMem include(s).
+#include <vecmem/utils/copy.hpp>
+
+// System include(s).
+#include <utility>
+
+namespace traccc::cuda {
+
+/// Selection of the seeds handed to the track finding, on a CUDA device
+///
+/// Runs between @c traccc::cuda::track_params_estimation and the track
+/// finding. Removes the seeds that share at least
+/// @c traccc::seed_selection_config::min_shared_spacepoints spacepoints with
+/// a seed of higher weight, with compatible estimated parameters. Then
+/// (optionally) keeps only the seeds of the highest weights in every
+/// (eta, phi) region.
+///
+/// The selected seeds and parameters keep their original order.
+///
+class seed_selection
+    : public algorithm<
+          std::pair<seed_collection_types::buffer,
+                    bound_track_parameters_collection_types::buffer>(
+              const seed_collection_types::const_view&,
+              const bound_track_parameters_collection_types::const_view&)> {
+
+    public:
+    /// Constructor for the algorithm
+    ///
+    /// @param config The seed selection configuration
+    /// @param mr The memory resource(s) to use in the algorithm
+    /// @param copy The copy object to use for copying data between device
+    ///             and host memory blocks
+    /// @param str The CUDA stream to perform the operations in
+    ///
+    seed_selection(const seed_selection_config& config,
+                   const traccc::memory_resource& mr, vecmem::copy& copy,
+                   stream& str);
+
+    /// Callable operator for the seed selection
+    ///
+    /// The number of selected seeds is read back from the device
+    /// synchronously, to size the result buffers.
+    ///
+    /// @param seeds_view The seeds of the event
+    /// @param params_view The estimated parameters of the seeds
+    /// @return The selected seeds, and their parameters
+    ///
+    output_type operator()(
+        const seed_collection_types::const_view& seeds_view,
+        const bound_track_parameters_collection_types::const_view& params_view)
+        const override;
+
+    private:
+    /// The seed selection configuration
+    seed_selection_config m_config;
+    /// The memory resource(s) to use
+    traccc::memory_resource m_mr;
+    /// The copy object to use
+    vecmem::copy& m_copy;
+    /// The CUDA stream to use
+    stream& m_stream;
+
+};  // class seed_selection
+
+}  // namespace traccc::cuda
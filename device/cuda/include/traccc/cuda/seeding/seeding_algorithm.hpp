@@ -1,6 +1,6 @@
 /** TRACCC library, part of the ACTS project (R&D line)
  *
- * (c) 2021-2023 CERN for the benefit of the ACTS project
+ * (c) 2021-2024 CERN for the benefit of the ACTS project
  *
  * Mozilla Public License Version 2.0
  */
@@ -8,8 +8,10 @@
 #pragma once
 
 // Library include(s).
+#include "traccc/cuda/seeding/seed_extension.hpp"
 #include "traccc/cuda/seeding/seed_finding.hpp"
 #include "traccc/cuda/seeding/spacepoint_binning.hpp"
+#include "traccc/cuda/seeding/track_params_estimation.hpp"
 #include "traccc/cuda/utils/stream.hpp"
 
 // Project include(s).
@@ -41,12 +43,23 @@ class seeding_algorithm : public algorithm<seed_collection_types::buffer(
     /// @param copy The copy object to use for copying data between device
     ///             and host memory blocks
     /// @param str The CUDA stream to perform the operations in
+    /// @param capacities The capacities to use for finding the seeds without
+    ///                   intermediate host synchronisation (disabled by
+    ///                   default)
+    /// @param extension_config The configuration of the seed extension. With
+    ///                         @c max_seed_size larger than 3, only the seeds
+    ///                         that could be extended to @c min_seed_size
+    ///                         spacepoints are returned.
+    /// @param selection_config The configuration of the seed selection step
     ///
     seeding_algorithm(const seedfinder_config& finder_config,
                       const spacepoint_grid_config& grid_config,
                       const seedfilter_config& filter_config,
                       const traccc::memory_resource& mr, vecmem::copy& copy,
-                      stream& str);
+                      stream& str,
+                      const seed_finding_capacities& capacities = {},
+                      const seed_extension_config& extension_config = {},
+                      const seed_selection_config& selection_config = {});
 
     /// Operator executing the algorithm.
     ///
@@ -56,11 +69,71 @@ class seeding_algorithm : public algorithm<seed_collection_types::buffer(
     output_type operator()(const spacepoint_collection_types::const_view&
                                spacepoints_view) const override;
 
+    /// Bin the spacepoints of an event into a grid
+    ///
+    /// The grid can be kept for later seeding passes on the same event (see
+    /// @c traccc::cuda::hit_masking).
+    ///
+    /// @param spacepoints_view is a view of all spacepoints in the event
+    /// @return the spacepoint grid of the event
+    ///
+    sp_soa_grid_types::buffer bin(
+        const spacepoint_collection_types::const_view& spacepoints_view) const;
+
+    /// Find the seeds of an event on an existing spacepoint grid
+    ///
+    /// The grid needs to have been made with the same grid configuration as
+    /// the one of this algorithm, but possibly with different seed finding
+    /// cuts, and possibly with some of its spacepoints masked.
+    ///
+    /// @param spacepoints_view is a view of all spacepoints in the event
+    /// @param grid_view is a view of the spacepoint grid of the event
+    /// @return the buffer of track seeds reconstructed from the grid
+    ///
+    output_type operator()(
+        const spacepoint_collection_types::const_view& spacepoints_view,
+        const sp_soa_grid_types::const_view& grid_view) const;
+
+    /// Find the seeds of an event on an existing spacepoint grid, together
+    /// with their estimated track parameters
+    ///
+    /// The parameters are estimated by the seed selection of
+    /// @c traccc::cuda::seed_finding itself, saving the separate pass of
+    /// @c traccc::cuda::track_params_estimation over the seeds. Unless the
+    /// seeds are extended, in which case the parameters of the extended seeds
+    /// are estimated with that separate pass.
+    ///
+    /// @param spacepoints_view is a view of all spacepoints in the event
+    /// @param grid_view is a view of the spacepoint grid of the event
+    /// @param bfield is the (temporary) magnetic field vector
+    /// @param stddev is the standard deviation for setting the covariance of
+    ///               the parameters
+    /// @return the buffers of track seeds, and of their parameters
+    ///
+    seed_finding::params_output_type operator()(
+        const spacepoint_collection_types::const_view& spacepoints_view,
+        const sp_soa_grid_types::const_view& grid_view, const vector3& bfield,
+        const std::array<traccc::scalar, traccc::e_bound_size>& stddev = {
+            0.02 * detray::unit<traccc::scalar>::mm,
+            0.03 * detray::unit<traccc::scalar>::mm,
+            1. * detray::unit<traccc::scalar>::degree,
+            1. * detray::unit<traccc::scalar>::degree,
+            0.01 / detray::unit<traccc::scalar>::GeV,
+            1 * detray::unit<traccc::scalar>::ns}) const;
+
     private:
     /// Sub-algorithm performing the spacepoint binning
     spacepoint_binning m_spacepoint_binning;
     /// Sub-algorithm performing the seed finding
     seed_finding m_seed_finding;
+    /// Sub-algorithm performing the seed extension
+    seed_extension m_seed_extension;
+    /// Sub-algorithm estimating the parameters of the extended seeds
+    track_params_estimation m_track_params_estimation;
+    /// Whether to run the seed extension
+    bool m_extend_seeds;
+    /// The CUDA stream to use
+    stream& m_stream;
 
 };  // class seeding_algorithm
 
@@ -1,6 +1,6 @@
 /** TRACCC library, part of the ACTS project (R&D line)
  *
- * (c) 2021-2023 CERN for the benefit of the ACTS project
+ * (c) 2021-2024 CERN for the benefit of the ACTS project
  *
  * Mozilla Public License Version 2.0
  */
@@ -11,11 +11,13 @@
 #include "traccc/cuda/utils/stream.hpp"
 #include "traccc/edm/spacepoint.hpp"
 #include "traccc/seeding/detail/seeding_config.hpp"
-#include "traccc/seeding/detail/spacepoint_grid.hpp"
+#include "traccc/seeding/detail/spacepoint_soa_grid.hpp"
 #include "traccc/utils/algorithm.hpp"
 #include "traccc/utils/memory_resource.hpp"
 
 // VecMem include(s).
+#include <vecmem/containers/data/vector_buffer.hpp>
+#include <vecmem/containers/vector.hpp>
 #include <vecmem/utils/copy.hpp>
 
 // System include(s).
@@ -26,11 +28,18 @@ namespace traccc::cuda {
 
 /// Spacepoing binning executed on a CUDA device
 ///
+/// The spacepoints of every bin of the produced grid are sorted by radius,
+/// the same way as by the host algorithm.
+///
 /// This algorithm returns a buffer which is not necessarily filled yet. A
 /// synchronisation statement is required before destroying this buffer.
 ///
+/// The capacity buffer of the grid, and the host array of its bin offsets,
+/// are allocated once and re-used for every event. So one instance of the
+/// algorithm must only be used on one thread (and stream) at a time.
+///
 class spacepoint_binning
-    : public algorithm<sp_grid_buffer(
+    : public algorithm<sp_soa_grid_types::buffer(
           const spacepoint_collection_types::const_view&)> {
 
     public:
@@ -41,13 +50,13 @@ class spacepoint_binning
                        stream& str);
 
     /// Function executing the algorithm with a a view of spacepoints
-    sp_grid_buffer operator()(const spacepoint_collection_types::const_view&
-                                  spacepoints_view) const override;
+    output_type operator()(const spacepoint_collection_types::const_view&
+                               spacepoints_view) const override;
 
     private:
     /// Member variables
     seedfinder_config m_config;
-    std::pair<sp_grid::axis_p0_type, sp_grid::axis_p1_type> m_axes;
+    std::pair<sp_soa_grid_axis_p0_type, sp_soa_grid_axis_p1_type> m_axes;
     traccc::memory_resource m_mr;
 
     /// The copy object to use
@@ -55,6 +64,11 @@ class spacepoint_binning
     /// The CUDA stream to use
     stream& m_stream;
 
+    /// The capacities of the grid bins, re-used as the bin cursors
+    vecmem::data::vector_buffer<unsigned int> m_grid_capacities;
+    /// The bin offsets of the grid, on the host
+    mutable vecmem::vector<unsigned int> m_bin_offsets_host;
+
 };  // class spacepoint_binning
 
 }  // namespace traccc::cuda
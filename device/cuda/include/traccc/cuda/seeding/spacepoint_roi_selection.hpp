@@ -0,0 +1,67 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s).
+#include "traccc/cuda/utils/stream.hpp"
+#include "traccc/edm/region_of_interest.hpp"
+#include "traccc/edm/spacepoint.hpp"
+#include "traccc/utils/algorithm.hpp"
+#include "traccc/utils/memory_resource.hpp"
+
+// VecMem include(s).
+#include <vecmem/utils/copy.hpp>
+
+namespace traccc::cuda {
+
+/// Algorithm selecting the spacepoints inside of regions of interest
+///
+/// The device equivalent of @c traccc::spacepoint_roi_selection. The order of
+/// the selected spacepoints is not defined.
+///
+/// This algorithm returns a buffer which is not necessarily filled yet. A
+/// synchronisation statement is required before destroying this buffer.
+///
+class spacepoint_roi_selection
+    : public algorithm<spacepoint_collection_types::buffer(
+          const spacepoint_collection_types::const_view&,
+          const region_of_interest_collection_types::const_view&)> {
+
+    public:
+    /// Constructor for the spacepoint selection
+    ///
+    /// @param mr The memory resource(s) to use in the algorithm
+    /// @param copy The copy object to use for copying data between device
+    ///             and host memory blocks
+    /// @param str The CUDA stream to perform the operations in
+    ///
+    spacepoint_roi_selection(const traccc::memory_resource& mr,
+                             vecmem::copy& copy, stream& str);
+
+    /// Select the spacepoints that are inside of any of the regions
+    ///
+    /// @param spacepoints_view All spacepoints of the event
+    /// @param rois_view The regions of interest (in device memory)
+    /// @return A resizable buffer with the spacepoints inside of the regions
+    ///
+    output_type operator()(
+        const spacepoint_collection_types::const_view& spacepoints_view,
+        const region_of_interest_collection_types::const_view& rois_view)
+        const override;
+
+    private:
+    /// The memory resource(s) to use
+    traccc::memory_resource m_mr;
+    /// The copy object to use
+    vecmem::copy& m_copy;
+    /// The CUDA stream to use
+    stream& m_stream;
+
+};  // class spacepoint_roi_selection
+
+}  // namespace traccc::cuda
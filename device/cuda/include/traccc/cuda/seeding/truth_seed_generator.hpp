@@ -0,0 +1,78 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s).
+#include "traccc/cuda/utils/stream.hpp"
+#include "traccc/edm/track_parameters.hpp"
+#include "traccc/edm/truth_seed_input.hpp"
+#include "traccc/utils/algorithm.hpp"
+#include "traccc/utils/memory_resource.hpp"
+
+// VecMem include(s).
+#include <vecmem/utils/copy.hpp>
+
+// System include(s).
+#include <array>
+#include <cstdint>
+
+namespace traccc::cuda {
+
+/// Truth seed generation for all particles of an event, on an NVIDIA GPU
+///
+/// Every seed is made by one thread, with the same surface operations and
+/// smearing as @c traccc::batched_seed_generator, and is written into a
+/// device buffer directly. Which can then be handed to the track finding,
+/// without copying the seeds from the host.
+///
+template <typename detector_t>
+class truth_seed_generator
+    : public algorithm<bound_track_parameters_collection_types::buffer(
+          const typename detector_t::view_type&,
+          const truth_seed_input_collection_types::const_view&,
+          std::uint64_t)> {
+
+    public:
+    /// Constructor for the truth seed generator
+    ///
+    /// @param stddevs Standard deviations for parameter smearing
+    /// @param seed    Seed of the smearing
+    /// @param mr      The memory resource to use
+    /// @param copy    Copy object
+    /// @param str     Cuda stream object
+    truth_seed_generator(const std::array<scalar, e_bound_size>& stddevs,
+                         std::uint64_t seed,
+                         const traccc::memory_resource& mr, vecmem::copy& copy,
+                         stream& str);
+
+    /// Run the algorithm
+    ///
+    /// @param det_view The detector that the seeds are bound to
+    /// @param inputs_view The truth states of the particles (on the device)
+    /// @param event The index of the event, seeding the smearing
+    /// @return The buffer of the seeds, in the order of the particles
+    ///
+    bound_track_parameters_collection_types::buffer operator()(
+        const typename detector_t::view_type& det_view,
+        const truth_seed_input_collection_types::const_view& inputs_view,
+        std::uint64_t event) const override;
+
+    private:
+    /// Standard deviations for parameter smearing
+    std::array<scalar, e_bound_size> m_stddevs;
+    /// Seed of the smearing
+    std::uint64_t m_seed;
+    /// Memory resource used by the algorithm
+    traccc::memory_resource m_mr;
+    /// The copy object to use
+    vecmem::copy& m_copy;
+    /// The CUDA stream to use
+    stream& m_stream;
+};
+
+}  // namespace traccc::cuda
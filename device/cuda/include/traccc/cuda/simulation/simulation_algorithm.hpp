@@ -0,0 +1,98 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s).
+#include "traccc/cuda/utils/stream.hpp"
+#include "traccc/edm/measurement.hpp"
+#include "traccc/edm/track_parameters.hpp"
+#include "traccc/simulation/track_simulator.hpp"
+#include "traccc/utils/algorithm.hpp"
+#include "traccc/utils/memory_resource.hpp"
+
+// VecMem include(s).
+#include <vecmem/containers/data/jagged_vector_view.hpp>
+#include <vecmem/containers/data/vector_view.hpp>
+#include <vecmem/utils/copy.hpp>
+
+// System include(s).
+#include <cstdint>
+
+namespace traccc::cuda {
+
+/// Particle gun simulation of one event, on an NVIDIA GPU
+///
+/// Every track is propagated through the detector by one thread, with the
+/// actors of @c traccc::track_simulator. Its smeared measurements are
+/// written into a (resizable) device buffer directly, which can be handed to
+/// the track finding (after @c traccc::cuda::measurement_sorting_algorithm)
+/// or copied to the host, and written out in the binary format.
+///
+/// The measurements of a thread are written in the order of its hits, but
+/// the threads are not ordered, so the measurement identifiers are unique,
+/// but otherwise arbitrary. The measurements themselves do not depend on the
+/// order of the threads.
+///
+template <typename simulator_t>
+class simulation_algorithm
+    : public algorithm<measurement_collection_types::buffer(
+          const typename simulator_t::detector_type::view_type&,
+          const typename simulator_t::bfield_type&,
+          const vecmem::data::jagged_vector_view<
+              typename simulator_t::intersection_type>&,
+          const vecmem::data::vector_view<const free_track_parameters>&,
+          std::uint64_t)> {
+
+    public:
+    /// Configuration type
+    using config_type = typename simulator_t::config_type;
+
+    /// Constructor for the simulation algorithm
+    ///
+    /// @param cfg  Configuration object
+    /// @param mr   The memory resource to use
+    /// @param copy Copy object
+    /// @param str  Cuda stream object
+    simulation_algorithm(const config_type& cfg,
+                         const traccc::memory_resource& mr, vecmem::copy& copy,
+                         stream& str);
+
+    /// Run the algorithm
+    ///
+    /// The navigation buffer may hold fewer candidate vectors than the number
+    /// of tracks, but at least one per thread of a block. The simulation
+    /// then processes multiple tracks per thread.
+    ///
+    /// @param det_view The detector to simulate the tracks in
+    /// @param field_view The magnetic field
+    /// @param navigation_buffer The navigation candidate buffer
+    /// @param tracks_view The (free) parameters of the tracks at their origins
+    /// @param event The index of the event, seeding the smearing
+    /// @return The (resizable) buffer of the smeared measurements
+    ///
+    measurement_collection_types::buffer operator()(
+        const typename simulator_t::detector_type::view_type& det_view,
+        const typename simulator_t::bfield_type& field_view,
+        const vecmem::data::jagged_vector_view<
+            typename simulator_t::intersection_type>& navigation_buffer,
+        const vecmem::data::vector_view<const free_track_parameters>&
+            tracks_view,
+        std::uint64_t event) const override;
+
+    private:
+    /// Config object
+    config_type m_cfg;
+    /// Memory resource used by the algorithm
+    traccc::memory_resource m_mr;
+    /// The copy object to use
+    vecmem::copy& m_copy;
+    /// The CUDA stream to use
+    stream& m_stream;
+};
+
+}  // namespace traccc::cuda
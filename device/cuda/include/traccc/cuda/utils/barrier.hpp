@@ -1,6 +1,6 @@
 /** TRACCC library, part of the ACTS project (R&D line)
  *
- * (c) 2023 CERN for the benefit of the ACTS project
+ * (c) 2023-2024 CERN for the benefit of the ACTS project
  *
  * Mozilla Public License Version 2.0
  */
@@ -20,4 +20,24 @@ struct barrier {
     bool blockOr(bool predicate) { return __syncthreads_or(predicate); }
 };
 
+/// Barrier synchronising the threads of a single (full) warp
+///
+/// Allows running the block-level algorithms of @c traccc::device on
+/// individual warps, using warp-level synchronisation instead of block-wide
+/// barriers.
+///
+struct warp_barrier {
+    /// Mask selecting all threads of the warp
+    static constexpr unsigned int full_mask = 0xffffffff;
+
+    TRACCC_DEVICE
+    void blockBarrier() { __syncwarp(full_mask); }
+
+    TRACCC_DEVICE
+    bool blockOr(bool predicate) {
+        __syncwarp(full_mask);
+        return __ballot_sync(full_mask, predicate) != 0u;
+    }
+};
+
 }  // namespace traccc::cuda
\ No newline at end of file
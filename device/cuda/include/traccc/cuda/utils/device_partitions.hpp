@@ -0,0 +1,69 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// System include(s).
+#include <iosfwd>
+#include <string>
+#include <vector>
+
+namespace traccc::cuda {
+
+/// The ways in which a logical CUDA device can be (a part of) a GPU
+enum class partition_kind {
+    /// A full GPU
+    full_device = 0,
+    /// A MIG (Multi-Instance GPU) instance of a GPU
+    mig_instance = 1,
+    /// A GPU shared with other processes through MPS (Multi-Process Service)
+    mps_client = 2
+};
+
+/// Description of one logical CUDA device visible to the process
+///
+/// MIG instances show up as separate CUDA devices of their own (once they
+/// are selected with @c CUDA_VISIBLE_DEVICES), and the MPS clients of a GPU
+/// are separate processes. So partitioning a GPU in either way gives every
+/// process the logical devices that @c traccc::cuda::stream can be created
+/// on as usual, just with a part of the GPU's multiprocessors behind them.
+///
+struct device_partition {
+
+    /// The CUDA device identifier of the logical device
+    int device = -1;
+    /// The name of the device
+    std::string name;
+    /// The UUID of the device (the one of the MIG instance, for MIG devices)
+    std::string uuid;
+    /// The kind of the partition
+    partition_kind kind = partition_kind::full_device;
+    /// The number of multiprocessors of the device
+    unsigned int sm_count = 0;
+    /// The percentage of the device's threads usable by the process (for
+    /// MPS clients), 100 otherwise
+    unsigned int active_thread_percentage = 100;
+
+    /// The number of multiprocessors that the process can use
+    unsigned int usable_sm_count() const;
+
+};  // struct device_partition
+
+/// Printout helper for @c traccc::cuda::device_partition
+std::ostream& operator<<(std::ostream& out, const device_partition& partition);
+
+/// Get the descriptions of all logical CUDA devices visible to the process
+///
+/// MIG instances are recognised by their names. A process is taken to be an
+/// MPS client if it was given an active thread percentage, or if the
+/// control pipe of an MPS daemon is present.
+///
+/// @return The descriptions, in the order of the CUDA device identifiers
+///
+std::vector<device_partition> get_device_partitions();
+
+}  // namespace traccc::cuda
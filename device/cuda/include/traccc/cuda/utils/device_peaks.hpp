@@ -0,0 +1,28 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s).
+#include "traccc/utils/work_counter.hpp"
+
+namespace traccc::cuda {
+
+/// Get the (theoretical) peak performance of a CUDA device
+///
+/// The peak memory bandwidth is calculated from the memory clock rate and
+/// the width of the memory bus, the peak single precision throughput from
+/// the number of multiprocessors, the number of FP32 cores per
+/// multiprocessor (for the compute capability of the device) and the core
+/// clock rate, counting fused multiply-adds as two operations.
+///
+/// @param device The CUDA device identifier, -1 for the current device
+/// @return The peak performance of the device
+///
+device_peaks get_device_peaks(int device = -1);
+
+}  // namespace traccc::cuda
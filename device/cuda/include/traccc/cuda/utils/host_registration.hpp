@@ -0,0 +1,53 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// System include(s).
+#include <cstddef>
+
+namespace traccc::cuda {
+
+/// Owning wrapper around the registration of a host memory range with CUDA
+///
+/// Registering (page-locking) existing host memory, for instance the mapping
+/// of a @c traccc::io::mapped_file, allows asynchronous host-to-device copies
+/// to be done directly from it, without staging the data through a separate
+/// pinned buffer first. The memory is registered as read-only, so it can be a
+/// read-only file mapping.
+///
+class host_registration {
+
+    public:
+    /// Register a host memory range
+    ///
+    /// @param ptr The start of the memory range
+    /// @param size The size of the memory range (in bytes)
+    ///
+    host_registration(const void* ptr, std::size_t size);
+
+    /// Move constructor
+    host_registration(host_registration&& parent);
+
+    /// Destructor, un-registering the memory range
+    ~host_registration();
+
+    /// Move assignment
+    host_registration& operator=(host_registration&& rhs);
+
+    /// Copying is not allowed
+    host_registration(const host_registration&) = delete;
+    /// Copying is not allowed
+    host_registration& operator=(const host_registration&) = delete;
+
+    private:
+    /// The start of the registered memory range
+    void* m_ptr = nullptr;
+
+};  // class host_registration
+
+}  // namespace traccc::cuda
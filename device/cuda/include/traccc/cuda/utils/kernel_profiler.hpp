@@ -0,0 +1,127 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// System include(s).
+#include <cstddef>
+#include <iosfwd>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace traccc::cuda {
+
+/// Timing statistics of one kernel
+struct kernel_statistics {
+
+    /// The name of the kernel
+    std::string name;
+    /// The number of times that the kernel was launched
+    std::size_t launches = 0;
+    /// The total execution time of the kernel [ms]
+    float total_ms = 0.f;
+    /// The shortest execution time of the kernel [ms]
+    float min_ms = 0.f;
+    /// The longest execution time of the kernel [ms]
+    float max_ms = 0.f;
+    /// The total number of blocks that the kernel was launched with
+    std::size_t total_blocks = 0;
+    /// The largest number of blocks that the kernel was launched with
+    unsigned int max_blocks = 0;
+    /// The (largest) number of threads per block used by the kernel
+    unsigned int threads_per_block = 0;
+
+};  // struct kernel_statistics
+
+/// Timing report of all the kernels measured in a period
+struct kernel_timing_report {
+
+    /// Statistics of the individual kernels, in the order of their first
+    /// launch
+    std::vector<kernel_statistics> kernels;
+
+    /// Add the contents of another report to this one
+    void merge(const kernel_timing_report& other);
+
+};  // struct kernel_timing_report
+
+/// Printout helper for @c traccc::cuda::kernel_timing_report
+std::ostream& operator<<(std::ostream& out, const kernel_timing_report& report);
+
+/// Opt-in profiler of the kernels launched by the CUDA algorithms
+///
+/// When attached to a @c traccc::cuda::stream (with
+/// @c traccc::cuda::stream::set_profiler), the algorithms using that stream
+/// record a pair of CUDA events around each of their kernel launches. The
+/// events are resolved into execution times lazily, without synchronizing
+/// the stream(s).
+///
+/// A profiler may be attached to multiple streams at the same time. Kernels
+/// launched while their stream is being captured into a CUDA graph are not
+/// profiled.
+///
+class kernel_profiler {
+
+    public:
+    /// Constructor
+    kernel_profiler();
+    /// Destructor
+    ~kernel_profiler();
+
+    /// Resolve the measurements of the already finished kernels
+    ///
+    /// The function never waits for any kernel to finish.
+    ///
+    void poll();
+
+    /// Finish the measurements of the current (processing) event
+    ///
+    /// It waits for the kernels launched so far to finish, but only by
+    /// waiting for their CUDA events, not for the streams that they were
+    /// launched on.
+    ///
+    /// @return The statistics of the kernels launched since the previous
+    ///         call to this function
+    ///
+    kernel_timing_report finish_event();
+
+    /// The statistics of all the events finished so far
+    kernel_timing_report totals() const;
+
+    /// @name Functions used by the algorithms
+    /// @{
+
+    /// Record the start of a kernel launch
+    ///
+    /// @param name The name of the kernel
+    /// @param n_blocks The number of blocks that the kernel is launched with
+    /// @param n_threads The number of threads per block
+    /// @param stream The (typeless) @c cudaStream_t of the launch
+    /// @return An identifier of the launch, for @c stop_kernel
+    ///
+    std::size_t start_kernel(std::string_view name, unsigned int n_blocks,
+                             unsigned int n_threads, void* stream);
+    /// Record the end of a kernel launch
+    ///
+    /// @param launch The identifier returned by @c start_kernel
+    /// @param stream The (typeless) @c cudaStream_t of the launch
+    ///
+    void stop_kernel(std::size_t launch, void* stream);
+
+    /// @}
+
+    private:
+    /// Internal data type
+    struct impl;
+    /// Pointer to the internal data
+    std::unique_ptr<impl> m_impl;
+
+};  // class kernel_profiler
+
+}  // namespace traccc::cuda
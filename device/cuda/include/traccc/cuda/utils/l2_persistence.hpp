@@ -0,0 +1,72 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Local include(s).
+#include "traccc/cuda/utils/stream.hpp"
+
+// System include(s).
+#include <cstddef>
+
+namespace traccc::cuda {
+
+/// Owning wrapper around a persisting L2 cache access window of a stream
+///
+/// Small, read-only data that all kernels of a stream read over and over,
+/// like the payload of the detector geometry, can be kept in the persisting
+/// part of the L2 cache, instead of being evicted by the streaming event
+/// data. The window only covers a single, contiguous memory range.
+///
+/// On devices without persisting L2 cache support, or for memory ranges
+/// larger than what the device can keep persistent, the object does nothing.
+///
+class l2_persistence {
+
+    public:
+    /// Default constructor, not setting any access window
+    l2_persistence() = default;
+
+    /// Set up the access window of a stream
+    ///
+    /// Must be called with the device of the stream selected.
+    ///
+    /// @param str The stream whose kernels the window applies to
+    /// @param ptr The start of the (device) memory range
+    /// @param size The size of the memory range (in bytes)
+    ///
+    l2_persistence(stream& str, const void* ptr, std::size_t size);
+
+    /// Move constructor
+    l2_persistence(l2_persistence&& parent);
+
+    /// Destructor, removing the access window from the stream
+    ~l2_persistence();
+
+    /// Move assignment
+    l2_persistence& operator=(l2_persistence&& rhs);
+
+    /// Copying is not allowed
+    l2_persistence(const l2_persistence&) = delete;
+    /// Copying is not allowed
+    l2_persistence& operator=(const l2_persistence&) = delete;
+
+    /// The size of the memory range kept persistent, 0 if there is none
+    std::size_t size() const;
+
+    private:
+    /// Remove the access window from the stream (if there is one)
+    void reset();
+
+    /// The stream that the access window is set on
+    void* m_stream = nullptr;
+    /// The size of the memory range kept persistent
+    std::size_t m_size = 0;
+
+};  // class l2_persistence
+
+}  // namespace traccc::cuda
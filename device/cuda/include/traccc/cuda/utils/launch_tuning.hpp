@@ -0,0 +1,105 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// System include(s).
+#include <functional>
+#include <map>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace traccc::cuda {
+
+// Forward declaration(s).
+class stream;
+
+/// Tuned launch parameters of the kernels of the CUDA algorithms
+///
+/// Holds the number of threads per block to launch the (tunable) kernels
+/// with, by the kernel names used by @c traccc::cuda::kernel_profiler. The
+/// kernels without an entry are launched with their default block sizes.
+///
+/// Tunings are tied to the device that they were made on, and are stored in
+/// simple text files, with one "<kernel> <threads per block>" line for every
+/// kernel.
+///
+class launch_tuning {
+
+    public:
+    /// Create a tuning launching every tunable kernel with the same number of
+    /// threads per block
+    static launch_tuning uniform(unsigned int threads_per_block);
+
+    /// Read a tuning from a file
+    ///
+    /// @param filename The file to read
+    /// @return The tuning read from the file
+    /// @throws std::runtime_error If the file can not be read/interpreted
+    ///
+    static launch_tuning read(const std::string& filename);
+
+    /// Write the tuning into a file
+    ///
+    /// @param filename The file to write
+    /// @throws std::runtime_error If the file can not be written
+    ///
+    void write(const std::string& filename) const;
+
+    /// Set the number of threads per block of one kernel
+    void set(std::string_view kernel, unsigned int threads_per_block);
+
+    /// Get the number of threads per block to launch a kernel with
+    ///
+    /// @param kernel The name of the kernel
+    /// @param default_threads The default block size of the kernel
+    /// @return The tuned block size, or @c default_threads if the kernel was
+    ///         not tuned
+    ///
+    unsigned int threads_per_block(std::string_view kernel,
+                                   unsigned int default_threads) const;
+
+    /// The number of kernels with a tuned block size
+    std::size_t size() const;
+
+    /// The name of the device that the tuning was made on (may be empty)
+    const std::string& device_name() const;
+    /// Set the name of the device that the tuning was made on
+    void set_device_name(std::string_view name);
+
+    private:
+    /// The block sizes of the individual kernels
+    std::map<std::string, unsigned int, std::less<>> m_threads;
+    /// The block size of all tunable kernels, if non-zero
+    unsigned int m_uniform = 0;
+    /// The name of the device that the tuning was made on
+    std::string m_device_name;
+
+};  // class launch_tuning
+
+/// The block sizes tried by @c traccc::cuda::autotune_launches
+std::vector<unsigned int> launch_tuning_candidates();
+
+/// Tune the launch parameters of the kernels used on a stream
+///
+/// Processes a sample event with every candidate block size, by calling
+/// @c process_event repeatedly, and picks the block size with the lowest
+/// average execution time for every kernel that was launched with the
+/// candidate block sizes. The profiler and tuning attached to the stream are
+/// restored at the end.
+///
+/// @param str The stream that @c process_event launches its kernels on
+/// @param process_event Function (synchronously) processing the sample event
+/// @param repetitions The number of measurements with every block size
+/// @return The tuning of the kernels, for the current device
+///
+launch_tuning autotune_launches(stream& str,
+                                const std::function<void()>& process_event,
+                                unsigned int repetitions = 3);
+
+}  // namespace traccc::cuda
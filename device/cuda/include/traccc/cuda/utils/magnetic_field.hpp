@@ -0,0 +1,73 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s).
+#include "traccc/definitions/primitives.hpp"
+
+// Detray include(s).
+#include "detray/detectors/bfield.hpp"
+
+// Covfie include(s).
+#include <covfie/core/backend/transformer/affine.hpp>
+#include <covfie/core/backend/transformer/linear.hpp>
+#include <covfie/core/backend/transformer/strided.hpp>
+#include <covfie/core/field.hpp>
+#include <covfie/core/vector.hpp>
+#include <covfie/cuda/backend/primitive/cuda_device_array.hpp>
+#include <covfie/cuda/backend/primitive/cuda_texture.hpp>
+
+// System include(s).
+#include <cstddef>
+
+namespace traccc::cuda {
+
+/// Backend of an inhomogeneous magnetic field map in global device memory
+///
+/// It has the same layout as the host field map
+/// @c detray::bfield::inhom_bknd_t, but the field is trilinearly interpolated
+/// between the grid points, like in @c inhom_texture_bknd_t. (So that the two
+/// device backends only differ in the memory that they read from.)
+///
+using inhom_global_bknd_t =
+    covfie::backend::affine<covfie::backend::linear<
+        covfie::backend::strided<covfie::vector::vector_d<std::size_t, 3>,
+                                 covfie::backend::cuda_device_array<
+                                     covfie::vector::vector_d<scalar, 3>>>>>;
+
+/// Backend of an inhomogeneous magnetic field map in texture memory
+///
+/// The field is read through the texture cache, and trilinearly interpolated
+/// between the grid points by the texture units.
+///
+using inhom_texture_bknd_t = covfie::backend::affine<
+    covfie::backend::cuda_texture<covfie::vector::vector_d<scalar, 3>,
+                                  covfie::vector::vector_d<scalar, 3>>>;
+
+/// Inhomogeneous magnetic field map in global device memory
+using inhom_global_field_t = covfie::field<inhom_global_bknd_t>;
+/// Inhomogeneous magnetic field map in texture memory
+using inhom_texture_field_t = covfie::field<inhom_texture_bknd_t>;
+
+/// Copy a host field map into global device memory
+///
+/// @param field The host field map, as read by @c io::read_magnetic_field
+/// @return The field map in global device memory
+///
+inhom_global_field_t make_global_field(
+    const detray::bfield::inhom_field_t& field);
+
+/// Copy a host field map into texture memory
+///
+/// @param field The host field map, as read by @c io::read_magnetic_field
+/// @return The field map in texture memory
+///
+inhom_texture_field_t make_texture_field(
+    const detray::bfield::inhom_field_t& field);
+
+}  // namespace traccc::cuda
@@ -52,4 +52,22 @@ vecmem::data::vector_buffer<device::prefix_sum_element_t> make_prefix_sum_buff(
     const std::vector<device::prefix_sum_size_t>& sizes, vecmem::copy& copy,
     const traccc::memory_resource& mr, const stream& str);
 
+/// Function that returns vector of prefix_sum_element_t for accessing a jagged
+/// vector's elements in device, with sizes that are already in device memory
+///
+/// The summation of the sizes is done on the device as well, with a single
+/// pass scan, so no host copy of the sizes is needed. Only the total size is
+/// copied back to the host, to allocate the result with. Unlike the other
+/// overloads, the returned buffer is already filled.
+///
+/// @param[in] sizes       The sizes of the jagged vector, in device memory
+/// @param copy A "copy object" capable of dealing with the view
+/// @param mr   The memory resource to create the buffer with
+/// @param str  The CUDA stream to create the buffer with
+/// @return     A vector buffer of prefix_sum element
+///
+vecmem::data::vector_buffer<device::prefix_sum_element_t> make_prefix_sum_buff(
+    const vecmem::data::vector_view<const device::prefix_sum_size_t>& sizes,
+    vecmem::copy& copy, const traccc::memory_resource& mr, const stream& str);
+
 }  // namespace traccc::cuda
@@ -0,0 +1,101 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Local include(s).
+#include "traccc/cuda/utils/stream.hpp"
+
+// VecMem include(s).
+#include <vecmem/memory/memory_resource.hpp>
+
+// System include(s).
+#include <cstddef>
+#include <map>
+#include <mutex>
+
+namespace traccc::cuda {
+
+/// Memory resource applying a usage policy to (CUDA) managed memory
+///
+/// Wraps a managed memory resource, like
+/// @c vecmem::cuda::managed_memory_resource, and keeps track of the memory
+/// ranges that were allocated through it. Once the objects living in those
+/// ranges are set up on the host, @c prefetch_to_device tells the CUDA
+/// driver how the ranges will be used, and migrates them to the device ahead
+/// of the kernels. Without that, the first kernels reading the data would
+/// page fault on every page of it.
+///
+/// The detector (geometry, material and grids) should use
+/// @c usage::read_mostly. It is duplicated onto the device, and remains
+/// readable from the host without any migration. Event data, that the
+/// kernels also write, should use @c usage::device_resident.
+///
+class managed_memory_policy : public vecmem::memory_resource {
+
+    public:
+    /// The ways in which the managed memory is used
+    enum class usage {
+        /// Written (once) on the host, read by the host and the device
+        read_mostly,
+        /// Written and read by the device, kept in its memory
+        device_resident
+    };
+
+    /// Constructor
+    ///
+    /// @param upstream The managed memory resource to allocate from
+    /// @param u The way in which the allocated memory will be used
+    ///
+    managed_memory_policy(vecmem::memory_resource& upstream, usage u);
+
+    /// Apply the policy to, and prefetch all allocated ranges to, the device
+    ///
+    /// Must be called with the device of the stream selected. This advises
+    /// the driver about the use of the ranges, so it should only be called
+    /// once their contents were set up on the host.
+    ///
+    /// @param str The stream to prefetch the ranges on
+    ///
+    void prefetch_to_device(stream& str) const;
+
+    /// Prefetch all allocated ranges to the host
+    ///
+    /// @param str The stream to prefetch the ranges on
+    ///
+    void prefetch_to_host(stream& str) const;
+
+    /// The total size of the allocated ranges (in bytes)
+    std::size_t size() const;
+
+    private:
+    /// @name Function(s) implementing @c vecmem::memory_resource
+    /// @{
+
+    /// Allocate (managed) memory from the upstream resource
+    void* do_allocate(std::size_t bytes, std::size_t alignment) override;
+    /// Deallocate memory with the upstream resource
+    void do_deallocate(void* ptr, std::size_t bytes,
+                       std::size_t alignment) override;
+    /// Compare the equality of memory resources
+    bool do_is_equal(
+        const vecmem::memory_resource& other) const noexcept override;
+
+    /// @}
+
+    /// The upstream (managed) memory resource
+    vecmem::memory_resource& m_upstream;
+    /// The way in which the allocated memory is used
+    usage m_usage;
+    /// Mutex protecting the allocated ranges
+    mutable std::mutex m_mutex;
+    /// The allocated ranges, with their sizes
+    std::map<void*, std::size_t> m_ranges;
+
+};  // class managed_memory_policy
+
+}  // namespace traccc::cuda
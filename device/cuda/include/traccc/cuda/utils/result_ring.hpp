@@ -0,0 +1,116 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Local include(s).
+#include "traccc/cuda/utils/stream.hpp"
+
+// System include(s).
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace traccc::cuda {
+
+/// Ring of page-locked host buffers receiving results from the device
+///
+/// Results are copied into a free slot of the ring with @c cudaMemcpyAsync,
+/// on the stream that produced them, right after the kernels producing
+/// them. A host function queued behind the copy marks the slot as complete.
+/// A completion thread owned by the ring then hands the copied data to the
+/// callback of the result, and frees the slot again. So the thread queueing
+/// the results never waits for the copies. It only waits if all slots have
+/// results that were not delivered yet.
+///
+/// The callbacks are called one at a time, in the order in which the
+/// results were queued. They must not throw.
+///
+class result_ring {
+
+    public:
+    /// A block of device memory to copy back (pointer and size in bytes)
+    using block = std::pair<const void*, std::size_t>;
+    /// Callback receiving the host copy of a result
+    ///
+    /// The data is only valid during the call, as the slot holding it is
+    /// re-used afterwards.
+    ///
+    using callback_type =
+        std::function<void(const void* data, std::size_t size)>;
+
+    /// Constructor
+    ///
+    /// @param str The stream that the results are produced on
+    /// @param n_slots The number of results that can be in flight at once
+    ///
+    result_ring(stream& str, std::size_t n_slots);
+
+    /// Destructor, delivering all of the queued results first
+    ~result_ring();
+
+    /// Copying is not allowed
+    result_ring(const result_ring&) = delete;
+    /// Copying is not allowed
+    result_ring& operator=(const result_ring&) = delete;
+
+    /// Queue the copy of a result
+    ///
+    /// The blocks are copied back to back into one slot, once all work
+    /// queued on the stream before them finished. The device memory of the
+    /// blocks must stay valid until then, which stream-ordered deallocations
+    /// on the same stream ensure.
+    ///
+    /// @param blocks The device memory blocks making up the result
+    /// @param callback The function to hand the host copy of the result to
+    ///
+    void enqueue(const std::vector<block>& blocks, callback_type callback);
+
+    /// Wait until all of the queued results were delivered
+    void drain();
+
+    /// The number of slots of the ring
+    std::size_t n_slots() const { return m_slots.size(); }
+
+    private:
+    /// One slot of the ring
+    struct slot;
+
+    /// The loop of the completion thread
+    void deliver();
+
+    /// The stream that the results are produced on
+    stream& m_stream;
+    /// The slots of the ring
+    std::vector<std::unique_ptr<slot>> m_slots;
+    /// The slots not used by any result
+    std::vector<slot*> m_free;
+    /// The slots with completed copies, in the order of their results
+    std::deque<slot*> m_ready;
+    /// The number of results queued, but not delivered yet
+    std::size_t m_in_flight = 0;
+    /// Whether the ring is being shut down
+    bool m_stop = false;
+
+    /// Mutex protecting the state of the ring
+    std::mutex m_mutex;
+    /// Condition variable signalling a completed copy
+    std::condition_variable m_ready_cv;
+    /// Condition variable signalling a delivered result
+    std::condition_variable m_free_cv;
+    /// The completion thread
+    std::thread m_thread;
+
+};  // class result_ring
+
+}  // namespace traccc::cuda
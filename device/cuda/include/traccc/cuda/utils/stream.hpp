@@ -1,6 +1,6 @@
 /** TRACCC library, part of the ACTS project (R&D line)
  *
- * (c) 2022 CERN for the benefit of the ACTS project
+ * (c) 2022-2024 CERN for the benefit of the ACTS project
  *
  * Mozilla Public License Version 2.0
  */
@@ -16,6 +16,8 @@ namespace traccc::cuda {
 namespace details {
 struct opaque_stream;
 }
+class kernel_profiler;
+class launch_tuning;
 
 /// Owning wrapper class around @c cudaStream_t
 ///
@@ -46,10 +48,37 @@ class stream {
     /// Wait for all queued tasks from the stream to complete
     void synchronize() const;
 
+    /// Attach a kernel profiler to the stream (or detach it with
+    /// @c nullptr)
+    ///
+    /// The profiler must outlive its use by the stream.
+    ///
+    void set_profiler(kernel_profiler* profiler);
+
+    /// The kernel profiler attached to the stream (if any)
+    kernel_profiler* profiler() const;
+
+    /// Attach a launch tuning to the stream (or detach it with @c nullptr)
+    ///
+    /// The algorithms launch their tunable kernels on the stream with the
+    /// block sizes of the tuning. The tuning must outlive its use by the
+    /// stream.
+    ///
+    void set_tuning(const launch_tuning* tuning);
+
+    /// The launch tuning attached to the stream (if any)
+    const launch_tuning* tuning() const;
+
     private:
     /// Smart pointer to the managed @c cudaStream_t object
     std::unique_ptr<details::opaque_stream> m_stream;
 
+    /// Kernel profiler attached to the stream
+    kernel_profiler* m_profiler = nullptr;
+
+    /// Launch tuning attached to the stream
+    const launch_tuning* m_tuning = nullptr;
+
 };  // class stream
 
 }  // namespace traccc::cuda
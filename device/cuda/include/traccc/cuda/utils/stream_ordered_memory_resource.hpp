@@ -0,0 +1,115 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Local include(s).
+#include "traccc/cuda/utils/stream.hpp"
+
+// VecMem include(s).
+#include <vecmem/memory/memory_resource.hpp>
+
+// System include(s).
+#include <cstddef>
+#include <limits>
+
+namespace traccc::cuda {
+
+/// Device memory resource allocating stream-ordered memory from a CUDA pool
+///
+/// Allocations and deallocations are made with @c cudaMallocFromPoolAsync and
+/// @c cudaFreeAsync on a given stream, from a memory pool owned by the
+/// resource. So they are ordered with the work on that stream, without
+/// synchronising the device, and without a lock in the resource itself. The
+/// memory that is freed stays in the pool (up to its release threshold) for
+/// the later allocations, making them cheap.
+///
+/// The memory handed out is ready for use on the stream of the resource.
+/// Work on other streams must synchronise with that stream before using it,
+/// and must be finished with it before it is deallocated.
+///
+class stream_ordered_memory_resource : public vecmem::memory_resource {
+
+    public:
+    /// Release threshold keeping all freed memory in the pool
+    static constexpr std::size_t keep_all =
+        std::numeric_limits<std::size_t>::max();
+
+    /// Constructor
+    ///
+    /// @param str The stream that the memory is allocated and freed on. It
+    ///            must outlive the resource.
+    /// @param device The device to allocate the memory on (the current one
+    ///               by default). It must be the device of @c str.
+    /// @param release_threshold The amount of freed memory (in bytes) that
+    ///                          the pool keeps reserved at synchronisation
+    ///                          points, instead of giving it back to the
+    ///                          system
+    ///
+    explicit stream_ordered_memory_resource(
+        const stream& str, int device = stream::INVALID_DEVICE,
+        std::size_t release_threshold = keep_all);
+    /// Destructor, releasing the memory pool
+    ~stream_ordered_memory_resource() override;
+
+    /// The resource can not be copied
+    stream_ordered_memory_resource(const stream_ordered_memory_resource&) =
+        delete;
+    /// The resource can not be copy assigned
+    stream_ordered_memory_resource& operator=(
+        const stream_ordered_memory_resource&) = delete;
+
+    /// Check whether a device supports stream-ordered memory pools
+    ///
+    /// @param device The device to check (the current one by default)
+    ///
+    static bool is_supported(int device = stream::INVALID_DEVICE);
+
+    /// Set the amount of freed memory that the pool keeps reserved
+    ///
+    /// @param bytes The new release threshold, in bytes
+    ///
+    void set_release_threshold(std::size_t bytes);
+    /// The amount of freed memory that the pool keeps reserved, in bytes
+    std::size_t release_threshold() const;
+
+    /// Give the unused memory of the pool back to the system
+    ///
+    /// @param bytes_to_keep The amount of memory (in bytes) to keep reserved
+    ///
+    void trim(std::size_t bytes_to_keep = 0);
+
+    /// The memory reserved by the pool (in use or not), in bytes
+    std::size_t reserved_size() const;
+    /// The memory of the pool in use by allocations, in bytes
+    std::size_t used_size() const;
+
+    private:
+    /// @name Function(s) implementing @c vecmem::memory_resource
+    /// @{
+
+    /// Allocate memory from the pool, ordered on the stream
+    void* do_allocate(std::size_t bytes, std::size_t alignment) override;
+    /// Free memory into the pool, ordered on the stream
+    void do_deallocate(void* ptr, std::size_t bytes,
+                       std::size_t alignment) override;
+    /// Compare the equality of memory resources
+    bool do_is_equal(
+        const vecmem::memory_resource& other) const noexcept override;
+
+    /// @}
+
+    /// The stream that the memory is allocated and freed on
+    const stream& m_stream;
+    /// The device of the memory pool
+    int m_device;
+    /// Typeless pointer to the managed @c cudaMemPool_t object
+    void* m_pool = nullptr;
+
+};  // class stream_ordered_memory_resource
+
+}  // namespace traccc::cuda
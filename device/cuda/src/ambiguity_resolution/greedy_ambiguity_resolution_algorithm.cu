@@ -0,0 +1,296 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Project include(s).
+#include "../utils/kernel_timer.hpp"
+#include "../utils/thrust_allocator.cuh"
+#include "../utils/utils.hpp"
+#include "traccc/ambiguity_resolution/device/count_shared_measurements.hpp"
+#include "traccc/ambiguity_resolution/device/fill_measurement_pairs.hpp"
+#include "traccc/ambiguity_resolution/device/remove_worst_tracks.hpp"
+#include "traccc/cuda/ambiguity_resolution/greedy_ambiguity_resolution_algorithm.hpp"
+#include "traccc/cuda/utils/definitions.hpp"
+#include "traccc/utils/trace.hpp"
+
+// VecMem include(s).
+#include <vecmem/containers/device_vector.hpp>
+#include <vecmem/memory/unique_ptr.hpp>
+
+// Thrust include(s).
+#include <thrust/binary_search.h>
+#include <thrust/execution_policy.h>
+#include <thrust/sort.h>
+#include <thrust/unique.h>
+
+// System include(s).
+#include <vector>
+
+namespace traccc::cuda {
+
+namespace kernels {
+
+__global__ void fill_measurement_pairs(
+    track_state_container_types::const_view track_states_view,
+    vecmem::data::vector_view<const unsigned int> track_offsets_view,
+    unsigned int n_measurements_min,
+    vecmem::data::vector_view<std::size_t> pair_ids_view,
+    vecmem::data::vector_view<unsigned int> pair_tracks_view,
+    vecmem::data::vector_view<unsigned int> selected_view) {
+
+    device::fill_measurement_pairs(threadIdx.x + blockIdx.x * blockDim.x,
+                                   track_states_view, track_offsets_view,
+                                   n_measurements_min, pair_ids_view,
+                                   pair_tracks_view, selected_view);
+}
+
+__global__ void count_tracks_per_measurement(
+    vecmem::data::vector_view<const unsigned int> pair_measurements_view,
+    vecmem::data::vector_view<const unsigned int> pair_tracks_view,
+    vecmem::data::vector_view<const unsigned int> selected_view,
+    vecmem::data::vector_view<unsigned int> n_tracks_view) {
+
+    device::count_tracks_per_measurement(
+        threadIdx.x + blockIdx.x * blockDim.x, pair_measurements_view,
+        pair_tracks_view, selected_view, n_tracks_view);
+}
+
+__global__ void count_shared_measurements(
+    vecmem::data::vector_view<const unsigned int> pair_measurements_view,
+    vecmem::data::vector_view<const unsigned int> pair_tracks_view,
+    vecmem::data::vector_view<const unsigned int> selected_view,
+    vecmem::data::vector_view<const unsigned int> n_tracks_view,
+    vecmem::data::vector_view<unsigned int> n_shared_view) {
+
+    device::count_shared_measurements(
+        threadIdx.x + blockIdx.x * blockDim.x, pair_measurements_view,
+        pair_tracks_view, selected_view, n_tracks_view, n_shared_view);
+}
+
+__global__ void find_worse_neighbours(
+    track_state_container_types::const_view track_states_view,
+    vecmem::data::vector_view<const unsigned int> track_offsets_view,
+    vecmem::data::vector_view<const unsigned int> pair_measurements_view,
+    vecmem::data::vector_view<const unsigned int> pair_tracks_view,
+    vecmem::data::vector_view<const unsigned int> measurement_offsets_view,
+    vecmem::data::vector_view<const unsigned int> selected_view,
+    vecmem::data::vector_view<const unsigned int> n_shared_view,
+    unsigned int maximum_shared_hits,
+    vecmem::data::vector_view<unsigned int> has_worse_view) {
+
+    device::find_worse_neighbours(
+        threadIdx.x + blockIdx.x * blockDim.x, track_states_view,
+        track_offsets_view, pair_measurements_view, pair_tracks_view,
+        measurement_offsets_view, selected_view, n_shared_view,
+        maximum_shared_hits, has_worse_view);
+}
+
+__global__ void remove_worst_tracks(
+    vecmem::data::vector_view<const unsigned int> n_shared_view,
+    vecmem::data::vector_view<const unsigned int> has_worse_view,
+    unsigned int maximum_shared_hits,
+    vecmem::data::vector_view<unsigned int> selected_view,
+    unsigned int* n_removed) {
+
+    device::remove_worst_tracks(threadIdx.x + blockIdx.x * blockDim.x,
+                                n_shared_view, has_worse_view,
+                                maximum_shared_hits, selected_view,
+                                *n_removed);
+}
+
+}  // namespace kernels
+
+greedy_ambiguity_resolution_algorithm::greedy_ambiguity_resolution_algorithm(
+    const config_t& cfg, const traccc::memory_resource& mr, vecmem::copy& copy,
+    stream& str)
+    : m_config(cfg), m_mr(mr), m_copy(copy), m_stream(str) {}
+
+greedy_ambiguity_resolution_algorithm::output_type
+greedy_ambiguity_resolution_algorithm::operator()(
+    const track_state_container_types::const_view& track_states_view) const {
+
+    TRACCC_TRACE_RANGE("traccc::cuda::greedy_ambiguity_resolution_algorithm");
+
+    // Get a convenience variable for the stream that we'll be using.
+    cudaStream_t stream = details::get_stream(m_stream);
+    // Thrust takes its temporary storage from the main memory resource.
+    details::thrust_allocator thrust_alloc(m_mr.main);
+
+    // The number of tracks, and the offsets of their measurement pairs
+    const track_state_container_types::const_device::header_vector::size_type
+        n_tracks = m_copy.get_size(track_states_view.headers);
+    const std::vector<track_state_container_types::const_device::item_vector::
+                          value_type::size_type>
+        sizes = m_copy.get_sizes(track_states_view.items);
+    std::vector<unsigned int> track_offsets(n_tracks + 1, 0u);
+    for (unsigned int i = 0; i < n_tracks; ++i) {
+        track_offsets[i + 1] = track_offsets[i] + sizes[i];
+    }
+    const unsigned int n_pairs = track_offsets.back();
+
+    vecmem::data::vector_buffer<unsigned int> selected_buffer(n_tracks,
+                                                              m_mr.main);
+    m_copy.setup(selected_buffer);
+    if (n_tracks == 0) {
+        return selected_buffer;
+    }
+
+    vecmem::data::vector_buffer<unsigned int> track_offsets_buffer(
+        n_tracks + 1, m_mr.main);
+    m_copy.setup(track_offsets_buffer);
+    m_copy(vecmem::get_data(track_offsets), track_offsets_buffer,
+           vecmem::copy::type::host_to_device);
+
+    /*****************************************************************
+     * Build the measurement -> track adjacency
+     *****************************************************************/
+
+    vecmem::data::vector_buffer<std::size_t> pair_ids_buffer(n_pairs,
+                                                             m_mr.main);
+    vecmem::data::vector_buffer<unsigned int> pair_tracks_buffer(n_pairs,
+                                                                 m_mr.main);
+    m_copy.setup(pair_ids_buffer);
+    m_copy.setup(pair_tracks_buffer);
+
+    const unsigned int nThreads = WARP_SIZE * 2;
+    const unsigned int nTrackBlocks = (n_tracks + nThreads - 1) / nThreads;
+    const unsigned int nPairBlocks = (n_pairs + nThreads - 1) / nThreads;
+
+    details::kernel_timer fill_measurement_pairs_timer(m_stream,
+                                                       "fill_measurement_pairs",
+                                                       nTrackBlocks, nThreads);
+    kernels::fill_measurement_pairs<<<nTrackBlocks, nThreads, 0, stream>>>(
+        track_states_view, track_offsets_buffer,
+        static_cast<unsigned int>(m_config.n_measurements_min),
+        pair_ids_buffer, pair_tracks_buffer, selected_buffer);
+    fill_measurement_pairs_timer.stop();
+    CUDA_ERROR_CHECK(cudaGetLastError());
+    if (n_pairs == 0) {
+        m_stream.synchronize();
+        return selected_buffer;
+    }
+
+    // Sort the pairs by measurement. The sort is stable, so the pairs of
+    // every measurement stay ordered by track.
+    vecmem::device_vector<std::size_t> pair_ids(pair_ids_buffer);
+    vecmem::device_vector<unsigned int> pair_tracks(pair_tracks_buffer);
+    thrust::stable_sort_by_key(
+        thrust::cuda::par_nosync(thrust_alloc).on(stream), pair_ids.begin(),
+        pair_ids.end(), pair_tracks.begin());
+
+    // Give the measurements dense indices, and find the first pair of every
+    // measurement
+    vecmem::data::vector_buffer<std::size_t> unique_ids_buffer(n_pairs,
+                                                               m_mr.main);
+    m_copy.setup(unique_ids_buffer);
+    vecmem::device_vector<std::size_t> unique_ids(unique_ids_buffer);
+    const unsigned int n_measurements = static_cast<unsigned int>(
+        thrust::unique_copy(thrust::cuda::par(thrust_alloc).on(stream),
+                            pair_ids.begin(), pair_ids.end(),
+                            unique_ids.begin()) -
+        unique_ids.begin());
+
+    vecmem::data::vector_buffer<unsigned int> pair_measurements_buffer(
+        n_pairs, m_mr.main);
+    m_copy.setup(pair_measurements_buffer);
+    vecmem::device_vector<unsigned int> pair_measurements(
+        pair_measurements_buffer);
+    thrust::lower_bound(thrust::cuda::par_nosync(thrust_alloc).on(stream),
+                        unique_ids.begin(),
+                        unique_ids.begin() + n_measurements, pair_ids.begin(),
+                        pair_ids.end(), pair_measurements.begin());
+
+    vecmem::data::vector_buffer<unsigned int> measurement_offsets_buffer(
+        n_measurements + 1, m_mr.main);
+    m_copy.setup(measurement_offsets_buffer);
+    vecmem::device_vector<unsigned int> measurement_offsets(
+        measurement_offsets_buffer);
+    thrust::lower_bound(thrust::cuda::par_nosync(thrust_alloc).on(stream),
+                        pair_ids.begin(), pair_ids.end(), unique_ids.begin(),
+                        unique_ids.begin() + n_measurements,
+                        measurement_offsets.begin());
+    CUDA_ERROR_CHECK(cudaMemcpyAsync(
+        measurement_offsets_buffer.ptr() + n_measurements, &n_pairs,
+        sizeof(unsigned int), cudaMemcpyHostToDevice, stream));
+
+    /*****************************************************************
+     * Remove the worst tracks, round by round
+     *****************************************************************/
+
+    vecmem::data::vector_buffer<unsigned int> n_tracks_buffer(n_measurements,
+                                                              m_mr.main);
+    vecmem::data::vector_buffer<unsigned int> n_shared_buffer(n_tracks,
+                                                              m_mr.main);
+    vecmem::data::vector_buffer<unsigned int> has_worse_buffer(n_tracks,
+                                                               m_mr.main);
+    m_copy.setup(n_tracks_buffer);
+    m_copy.setup(n_shared_buffer);
+    m_copy.setup(has_worse_buffer);
+
+    vecmem::unique_alloc_ptr<unsigned int> n_removed_device =
+        vecmem::make_unique_alloc<unsigned int>(m_mr.main);
+
+    for (std::uint32_t round = 0; round < m_config.maximum_iterations;
+         ++round) {
+
+        m_copy.memset(n_tracks_buffer, 0);
+        m_copy.memset(n_shared_buffer, 0);
+        m_copy.memset(has_worse_buffer, 0);
+        CUDA_ERROR_CHECK(cudaMemsetAsync(n_removed_device.get(), 0,
+                                         sizeof(unsigned int), stream));
+
+        details::kernel_timer count_tracks_per_measurement_timer(
+            m_stream, "count_tracks_per_measurement", nPairBlocks, nThreads);
+        kernels::count_tracks_per_measurement<<<nPairBlocks, nThreads, 0,
+                                                stream>>>(
+            pair_measurements_buffer, pair_tracks_buffer, selected_buffer,
+            n_tracks_buffer);
+        count_tracks_per_measurement_timer.stop();
+        CUDA_ERROR_CHECK(cudaGetLastError());
+
+        details::kernel_timer count_shared_measurements_timer(
+            m_stream, "count_shared_measurements", nPairBlocks, nThreads);
+        kernels::count_shared_measurements<<<nPairBlocks, nThreads, 0,
+                                             stream>>>(
+            pair_measurements_buffer, pair_tracks_buffer, selected_buffer,
+            n_tracks_buffer, n_shared_buffer);
+        count_shared_measurements_timer.stop();
+        CUDA_ERROR_CHECK(cudaGetLastError());
+
+        details::kernel_timer find_worse_neighbours_timer(
+            m_stream, "find_worse_neighbours", nPairBlocks, nThreads);
+        kernels::find_worse_neighbours<<<nPairBlocks, nThreads, 0, stream>>>(
+            track_states_view, track_offsets_buffer, pair_measurements_buffer,
+            pair_tracks_buffer, measurement_offsets_buffer, selected_buffer,
+            n_shared_buffer, m_config.maximum_shared_hits, has_worse_buffer);
+        find_worse_neighbours_timer.stop();
+        CUDA_ERROR_CHECK(cudaGetLastError());
+
+        details::kernel_timer remove_worst_tracks_timer(m_stream,
+                                                        "remove_worst_tracks",
+                                                        nTrackBlocks, nThreads);
+        kernels::remove_worst_tracks<<<nTrackBlocks, nThreads, 0, stream>>>(
+            n_shared_buffer, has_worse_buffer, m_config.maximum_shared_hits,
+            selected_buffer, n_removed_device.get());
+        remove_worst_tracks_timer.stop();
+        CUDA_ERROR_CHECK(cudaGetLastError());
+
+        // The worst candidate is always removed, so the final state is
+        // reached once a round does not remove any track.
+        unsigned int n_removed = 0;
+        CUDA_ERROR_CHECK(cudaMemcpyAsync(&n_removed, n_removed_device.get(),
+                                         sizeof(unsigned int),
+                                         cudaMemcpyDeviceToHost, stream));
+        m_stream.synchronize();
+        if (n_removed == 0) {
+            break;
+        }
+    }
+
+    return selected_buffer;
+}
+
+}  // namespace traccc::cuda
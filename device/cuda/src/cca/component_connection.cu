@@ -8,6 +8,7 @@
 
 #include "traccc/cuda/cca/component_connection.hpp"
 #include "traccc/cuda/utils/definitions.hpp"
+#include "traccc/utils/trace.hpp"
 #include "vecmem/containers/vector.hpp"
 #include "vecmem/memory/allocator.hpp"
 #include "vecmem/memory/binary_page_memory_resource.hpp"
@@ -696,6 +697,8 @@ __global__ __launch_bounds__(THREADS_PER_BLOCK) void ccl_kernel(
 
 component_connection::output_type component_connection::operator()(
     const cell_collection_types::host& cells) const {
+    TRACCC_TRACE_RANGE("traccc::cuda::component_connection");
+
     vecmem::cuda::managed_memory_resource upstream;
     vecmem::cuda::device_memory_resource dmem;
     vecmem::binary_page_memory_resource mem(upstream);
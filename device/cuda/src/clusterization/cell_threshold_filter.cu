@@ -0,0 +1,113 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Local include(s).
+#include "../utils/kernel_timer.hpp"
+#include "../utils/thrust_allocator.cuh"
+#include "../utils/utils.hpp"
+#include "traccc/cuda/clusterization/cell_threshold_filter.hpp"
+#include "traccc/cuda/utils/definitions.hpp"
+
+// Project include(s).
+#include "traccc/clusterization/device/flag_kept_cells.hpp"
+#include "traccc/utils/trace.hpp"
+
+// VecMem include(s).
+#include <vecmem/containers/data/vector_buffer.hpp>
+
+// Thrust include(s).
+#include <thrust/copy.h>
+#include <thrust/count.h>
+#include <thrust/execution_policy.h>
+
+namespace traccc::cuda {
+
+namespace kernels {
+
+/// CUDA kernel for running @c traccc::device::flag_kept_cells
+__global__ void flag_kept_cells(
+    cell_collection_types::const_view cells_view,
+    cell_module_collection_types::const_view modules_view,
+    threshold_filter_mode mode,
+    vecmem::data::vector_view<unsigned int> flags_view) {
+
+    device::flag_kept_cells(threadIdx.x + blockIdx.x * blockDim.x, cells_view,
+                            modules_view, mode, flags_view);
+}
+
+}  // namespace kernels
+
+namespace {
+
+/// Functor selecting the flagged cells
+struct is_flagged {
+    TRACCC_HOST_DEVICE
+    bool operator()(const unsigned int flag) const { return flag != 0u; }
+};
+
+}  // namespace
+
+cell_threshold_filter::cell_threshold_filter(const traccc::memory_resource& mr,
+                                             vecmem::copy& copy, stream& str,
+                                             threshold_filter_mode mode)
+    : m_mr(mr), m_copy(copy), m_stream(str), m_mode(mode) {}
+
+cell_threshold_filter::output_type cell_threshold_filter::operator()(
+    const cell_collection_types::const_view& cells,
+    const cell_module_collection_types::const_view& modules) const {
+
+    TRACCC_TRACE_RANGE("traccc::cuda::cell_threshold_filter");
+
+    // Get a convenience variable for the stream that we'll be using.
+    cudaStream_t stream = details::get_stream(m_stream);
+
+    // Get the number of cells. This is a synchronous operation for a
+    // resizable buffer.
+    const unsigned int n_cells = m_copy.get_size(cells);
+
+    // Check if anything needs to be done.
+    if (n_cells == 0) {
+        output_type result{0, m_mr.main};
+        m_copy.setup(result);
+        return result;
+    }
+
+    // Flag the kept cells.
+    vecmem::data::vector_buffer<unsigned int> flags_buffer(
+        n_cells, m_mr.event_memory());
+
+    const unsigned int nThreads = WARP_SIZE * 8;
+    const unsigned int nBlocks = (n_cells + nThreads - 1) / nThreads;
+
+    details::kernel_timer flag_timer(m_stream, "flag_kept_cells", nBlocks,
+                                     nThreads);
+    kernels::flag_kept_cells<<<nBlocks, nThreads, 0, stream>>>(
+        cells, modules, m_mode, flags_buffer);
+    flag_timer.stop();
+    CUDA_ERROR_CHECK(cudaGetLastError());
+
+    // Count the kept cells, to set up an output buffer of the exact size.
+    details::thrust_allocator thrust_alloc(m_mr.event_memory());
+    const unsigned int n_kept = static_cast<unsigned int>(
+        thrust::count_if(thrust::cuda::par(thrust_alloc).on(stream),
+                         flags_buffer.ptr(), flags_buffer.ptr() + n_cells,
+                         is_flagged{}));
+    output_type result{n_kept, m_mr.main};
+    m_copy.setup(result);
+
+    // Compact the kept cells into it, keeping their order. Waiting for the
+    // compaction to finish before the flags go out of scope.
+    if (n_kept > 0) {
+        thrust::copy_if(thrust::cuda::par(thrust_alloc).on(stream),
+                        cells.ptr(), cells.ptr() + n_cells, flags_buffer.ptr(),
+                        result.ptr(), is_flagged{});
+    }
+
+    return result;
+}
+
+}  // namespace traccc::cuda
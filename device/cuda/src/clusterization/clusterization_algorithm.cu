@@ -1,11 +1,13 @@
 /** TRACCC library, part of the ACTS project (R&D line)
  *
- * (c) 2022-2023 CERN for the benefit of the ACTS project
+ * (c) 2022-2024 CERN for the benefit of the ACTS project
  *
  * Mozilla Public License Version 2.0
  */
 
 // CUDA Library include(s).
+#include "../utils/kernel_timer.hpp"
+#include "../utils/thrust_allocator.cuh"
 #include "../utils/utils.hpp"
 #include "traccc/cuda/clusterization/clusterization_algorithm.hpp"
 #include "traccc/cuda/utils/barrier.hpp"
@@ -15,13 +17,25 @@
 #include "traccc/clusterization/device/aggregate_cluster.hpp"
 #include "traccc/clusterization/device/ccl_kernel.hpp"
 #include "traccc/clusterization/device/form_spacepoints.hpp"
+#include "traccc/clusterization/device/get_measurement_events.hpp"
 #include "traccc/clusterization/device/reduce_problem_cell.hpp"
+#include "traccc/utils/trace.hpp"
+#include "traccc/utils/work_model.hpp"
 
 // Vecmem include(s).
 #include <vecmem/utils/copy.hpp>
 
+// Thrust include(s).
+#include <thrust/binary_search.h>
+#include <thrust/execution_policy.h>
+#include <thrust/gather.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/sequence.h>
+#include <thrust/sort.h>
+
 // System include(s).
 #include <algorithm>
+#include <cassert>
 
 namespace {
 
@@ -32,6 +46,16 @@ using index_t = unsigned short;
 static constexpr int TARGET_CELLS_PER_THREAD = 8;
 static constexpr int MAX_CELLS_PER_THREAD = 12;
 
+/// The number of threads in a warp
+static constexpr unsigned int WARP_SIZE = 32;
+/// The number of warps (partitions) per block in warp-level CCL
+static constexpr unsigned int WARPS_PER_BLOCK = 8;
+/// The average number of cells in a partition in warp-level CCL
+static constexpr index_t WARP_TARGET_CELLS =
+    WARP_SIZE * TARGET_CELLS_PER_THREAD;
+/// The maximum number of cells in a partition in warp-level CCL
+static constexpr index_t WARP_MAX_CELLS = WARP_SIZE * MAX_CELLS_PER_THREAD;
+
 }  // namespace
 
 namespace traccc::cuda {
@@ -46,7 +70,8 @@ __global__ void ccl_kernel(
     const index_t target_cells_per_partition,
     measurement_collection_types::view measurements_view,
     unsigned int& measurement_count,
-    vecmem::data::vector_view<unsigned int> cell_links) {
+    vecmem::data::vector_view<unsigned int> cell_links,
+    vecmem::data::vector_view<unsigned int> backup_view) {
     __shared__ unsigned int partition_start, partition_end;
     __shared__ unsigned int outi;
     extern __shared__ index_t shared_v[];
@@ -58,7 +83,37 @@ __global__ void ccl_kernel(
                        modules_view, max_cells_per_partition,
                        target_cells_per_partition, partition_start,
                        partition_end, outi, f, f_next, barry_r,
-                       measurements_view, measurement_count, cell_links);
+                       measurements_view, measurement_count, cell_links,
+                       backup_view);
+}
+
+/// CUDA kernel for running @c traccc::device::ccl_kernel with one warp per
+/// partition
+///
+/// Meant for sparse events, where the partitions are small enough for the
+/// warp-level synchronisation to be much cheaper than block-wide barriers.
+///
+__global__ void ccl_kernel_warp(
+    const cell_collection_types::const_view cells_view,
+    const cell_module_collection_types::const_view modules_view,
+    measurement_collection_types::view measurements_view,
+    unsigned int& measurement_count,
+    vecmem::data::vector_view<unsigned int> cell_links,
+    vecmem::data::vector_view<unsigned int> backup_view) {
+    __shared__ unsigned int partition_start[WARPS_PER_BLOCK],
+        partition_end[WARPS_PER_BLOCK];
+    __shared__ unsigned int outi[WARPS_PER_BLOCK];
+    __shared__ index_t f[WARPS_PER_BLOCK][WARP_MAX_CELLS];
+    __shared__ index_t f_next[WARPS_PER_BLOCK][WARP_MAX_CELLS];
+    traccc::cuda::warp_barrier barry_r;
+
+    const unsigned int warp = threadIdx.x / WARP_SIZE;
+    device::ccl_kernel(threadIdx.x % WARP_SIZE, WARP_SIZE,
+                       blockIdx.x * WARPS_PER_BLOCK + warp, cells_view,
+                       modules_view, WARP_MAX_CELLS, WARP_TARGET_CELLS,
+                       partition_start[warp], partition_end[warp], outi[warp],
+                       f[warp], f_next[warp], barry_r, measurements_view,
+                       measurement_count, cell_links, backup_view);
 }
 
 __global__ void form_spacepoints(
@@ -72,43 +127,85 @@ __global__ void form_spacepoints(
                              spacepoints_view);
 }
 
+/// CUDA kernel for running @c traccc::device::form_spacepoints, with the
+/// number of measurements taken from device memory
+///
+/// @tparam modules_view_t The type of the module description, either a view
+///         of the module collection, or of the compact module descriptors
+///
+template <typename modules_view_t>
+__global__ void form_spacepoints_bounded(
+    measurement_collection_types::const_view measurements_view,
+    modules_view_t modules_view, const unsigned int& measurement_count,
+    spacepoint_collection_types::view spacepoints_view) {
+
+    device::form_spacepoints(threadIdx.x + blockIdx.x * blockDim.x,
+                             measurements_view, modules_view, measurement_count,
+                             spacepoints_view);
+}
+
+/// CUDA kernel for running @c traccc::device::get_measurement_events
+__global__ void get_measurement_events(
+    measurement_collection_types::const_view measurements_view,
+    vecmem::data::vector_view<const unsigned int> module_events_view,
+    const unsigned int measurement_count,
+    vecmem::data::vector_view<unsigned int> measurement_events_view) {
+
+    device::get_measurement_events(threadIdx.x + blockIdx.x * blockDim.x,
+                                   measurements_view, module_events_view,
+                                   measurement_count, measurement_events_view);
+}
+
 }  // namespace kernels
 
 clusterization_algorithm::clusterization_algorithm(
     const traccc::memory_resource& mr, vecmem::copy& copy, stream& str,
-    const unsigned short target_cells_per_partition)
+    const unsigned short target_cells_per_partition,
+    float warp_ccl_max_cells_per_module, bool compact_measurements,
+    bool produce_cell_links)
     : m_mr(mr),
       m_copy(copy),
       m_stream(str),
-      m_target_cells_per_partition(target_cells_per_partition) {}
+      m_target_cells_per_partition(target_cells_per_partition),
+      m_warp_ccl_max_cells_per_module(warp_ccl_max_cells_per_module),
+      m_compact_measurements(compact_measurements),
+      m_produce_cell_links(produce_cell_links) {}
 
-clusterization_algorithm::output_type clusterization_algorithm::operator()(
+void clusterization_algorithm::launch_ccl(
     const cell_collection_types::const_view& cells,
-    const cell_module_collection_types::const_view& modules) const {
+    const cell_module_collection_types::const_view& modules,
+    const unsigned int n_cells, const unsigned int n_modules,
+    measurement_collection_types::view measurements,
+    unsigned int& measurement_count,
+    vecmem::data::vector_view<unsigned int> cell_links,
+    vecmem::data::vector_view<unsigned int> ccl_backup) const {
 
     // Get a convenience variable for the stream that we'll be using.
     cudaStream_t stream = details::get_stream(m_stream);
 
-    // Number of cells
-    const cell_collection_types::view::size_type num_cells =
-        m_copy.get_size(cells);
-
-    if (num_cells == 0) {
-        return {output_type::first_type{0, m_mr.main},
-                output_type::second_type{0, m_mr.main}};
+    // Use one warp per partition for sparse inputs.
+    const float mean_cells_per_module =
+        static_cast<float>(n_cells) /
+        static_cast<float>(std::max(n_modules, 1u));
+    if (mean_cells_per_module < m_warp_ccl_max_cells_per_module) {
+
+        const unsigned int num_partitions =
+            (n_cells + WARP_TARGET_CELLS - 1) / WARP_TARGET_CELLS;
+        const unsigned int num_blocks = std::max(
+            1u, (num_partitions + WARPS_PER_BLOCK - 1) / WARPS_PER_BLOCK);
+        details::kernel_timer ccl_kernel_warp_timer(
+            m_stream, "ccl_kernel_warp", num_blocks,
+            WARPS_PER_BLOCK * WARP_SIZE);
+        kernels::ccl_kernel_warp<<<num_blocks, WARPS_PER_BLOCK * WARP_SIZE, 0,
+                                   stream>>>(cells, modules, measurements,
+                                             measurement_count, cell_links,
+                                             ccl_backup);
+        ccl_kernel_warp_timer.stop();
+        CUDA_ERROR_CHECK(cudaGetLastError());
+        return;
     }
 
-    // Create result object for the CCL kernel with size overestimation
-    measurement_collection_types::buffer measurements_buffer(num_cells,
-                                                             m_mr.main);
-    m_copy.setup(measurements_buffer);
-
-    // Counter for number of measurements
-    vecmem::unique_alloc_ptr<unsigned int> num_measurements_device =
-        vecmem::make_unique_alloc<unsigned int>(m_mr.main);
-    CUDA_ERROR_CHECK(cudaMemsetAsync(num_measurements_device.get(), 0,
-                                     sizeof(unsigned int), stream));
-
+    // Otherwise use one thread block per partition.
     const unsigned short max_cells_per_partition =
         (m_target_cells_per_partition * MAX_CELLS_PER_THREAD +
          TARGET_CELLS_PER_THREAD - 1) /
@@ -117,34 +214,103 @@ clusterization_algorithm::output_type clusterization_algorithm::operator()(
         (m_target_cells_per_partition + TARGET_CELLS_PER_THREAD - 1) /
         TARGET_CELLS_PER_THREAD;
     const unsigned int num_partitions =
-        (num_cells + m_target_cells_per_partition - 1) /
-        m_target_cells_per_partition;
-
-    // Create buffer for linking cells to their spacepoints.
-    vecmem::data::vector_buffer<unsigned int> cell_links(num_cells, m_mr.main);
-    m_copy.setup(cell_links);
+        std::max(1u, (n_cells + m_target_cells_per_partition - 1) /
+                         m_target_cells_per_partition);
 
     // Launch ccl kernel. Each thread will handle a single cell.
+    details::kernel_timer ccl_kernel_timer(m_stream, "ccl_kernel",
+                                           num_partitions,
+                                           threads_per_partition);
     kernels::
         ccl_kernel<<<num_partitions, threads_per_partition,
                      2 * max_cells_per_partition * sizeof(index_t), stream>>>(
             cells, modules, max_cells_per_partition,
-            m_target_cells_per_partition, measurements_buffer,
-            *num_measurements_device, cell_links);
-
+            m_target_cells_per_partition, measurements, measurement_count,
+            cell_links, ccl_backup);
+    ccl_kernel_timer.stop();
     CUDA_ERROR_CHECK(cudaGetLastError());
+}
+
+clusterization_algorithm::output_type clusterization_algorithm::operator()(
+    const cell_collection_types::const_view& cells,
+    const cell_module_collection_types::const_view& modules) const {
+
+    TRACCC_TRACE_RANGE("traccc::cuda::clusterization_algorithm");
+
+    auto [measurements, spacepoints, cell_links] =
+        run_with_measurements(cells, modules);
+    return {std::move(spacepoints), std::move(cell_links)};
+}
+
+clusterization_algorithm::measurements_output_type
+clusterization_algorithm::run_with_measurements(
+    const cell_collection_types::const_view& cells,
+    const cell_module_collection_types::const_view& modules) const {
+
+    // Get a convenience variable for the stream that we'll be using.
+    cudaStream_t stream = details::get_stream(m_stream);
+
+    // Number of cells
+    const cell_collection_types::view::size_type num_cells =
+        m_copy.get_size(cells);
+
+    if (num_cells == 0) {
+        vecmem::memory_resource& event_mr = m_mr.event_memory();
+        return {measurement_collection_types::buffer{0, event_mr},
+                spacepoint_collection_types::buffer{0, event_mr},
+                vecmem::data::vector_buffer<unsigned int>{0, event_mr}};
+    }
+
+    // Create result object for the CCL kernel with size overestimation. Its
+    // size is used as the measurement counter of the kernel.
+    measurement_collection_types::buffer measurements_buffer(
+        num_cells, m_mr.event_memory(), vecmem::data::buffer_type::resizable);
+    m_copy.setup(measurements_buffer);
+
+    // Create buffer for linking cells to their spacepoints, if requested.
+    vecmem::data::vector_buffer<unsigned int> cell_links(
+        m_produce_cell_links ? num_cells : 0u, m_mr.event_memory());
+    m_copy.setup(cell_links);
+
+    // Scratch space for the partitions that would not fit into shared memory,
+    // and for the cooperative aggregation of the clusters.
+    vecmem::data::vector_buffer<unsigned int> ccl_backup(
+        device::ccl_backup_size(num_cells), m_mr.event_memory());
+
+    // Run the connected component labeling.
+    launch_ccl(cells, modules, num_cells, m_copy.get_size(modules),
+               measurements_buffer, *(measurements_buffer.size_ptr()),
+               cell_links, ccl_backup);
 
     // Copy number of measurements to host
     vecmem::unique_alloc_ptr<unsigned int> num_measurements_host =
         vecmem::make_unique_alloc<unsigned int>(
             (m_mr.host != nullptr) ? *(m_mr.host) : m_mr.main);
     CUDA_ERROR_CHECK(cudaMemcpyAsync(
-        num_measurements_host.get(), num_measurements_device.get(),
+        num_measurements_host.get(), measurements_buffer.size_ptr(),
         sizeof(unsigned int), cudaMemcpyDeviceToHost, stream));
     m_stream.synchronize();
 
+    // Copy the measurements into a buffer of their exact size if requested,
+    // so that the overestimated buffer can be released. (Which would not
+    // happen before the end of the event with an event arena.)
+    if (m_compact_measurements && (m_mr.event_arena == nullptr)) {
+        measurement_collection_types::buffer compact_buffer(
+            *num_measurements_host, m_mr.event_memory());
+        if (*num_measurements_host > 0) {
+            CUDA_ERROR_CHECK(cudaMemcpyAsync(
+                compact_buffer.ptr(), measurements_buffer.ptr(),
+                *num_measurements_host * sizeof(measurement),
+                cudaMemcpyDeviceToDevice, stream));
+        }
+        // Make sure that the copy is done before the original buffer goes
+        // away.
+        m_stream.synchronize();
+        measurements_buffer = std::move(compact_buffer);
+    }
+
     spacepoint_collection_types::buffer spacepoints_buffer(
-        *num_measurements_host, m_mr.main);
+        *num_measurements_host, m_mr.event_memory());
     m_copy.setup(spacepoints_buffer);
 
     // For the following kernel, we can now use whatever the desired number of
@@ -155,13 +321,202 @@ clusterization_algorithm::output_type clusterization_algorithm::operator()(
         spacepointsLocalSize;
 
     // Turn 2D measurements into 3D spacepoints
+    details::kernel_timer form_spacepoints_timer(m_stream, "form_spacepoints",
+                                                 num_blocks,
+                                                 spacepointsLocalSize);
     kernels::form_spacepoints<<<num_blocks, spacepointsLocalSize, 0, stream>>>(
         measurements_buffer, modules, *num_measurements_host,
         spacepoints_buffer);
+    form_spacepoints_timer.stop();
 
     CUDA_ERROR_CHECK(cudaGetLastError());
 
-    return {std::move(spacepoints_buffer), std::move(cell_links)};
+    // Record the estimated work, with the sizes already known on the host.
+    if (counting_work()) {
+        work_estimate work =
+            work_model::clusterization(num_cells, *num_measurements_host);
+        work += work_model::spacepoint_formation(*num_measurements_host);
+        count_work(work);
+    }
+
+    return {std::move(measurements_buffer), std::move(spacepoints_buffer),
+            std::move(cell_links)};
+}
+
+clusterization_algorithm::batched_output_type
+clusterization_algorithm::run_batched(
+    const cell_collection_types::const_view& cells,
+    const cell_module_collection_types::const_view& modules,
+    const vecmem::data::vector_view<const unsigned int>& module_events,
+    const std::size_t n_events) const {
+
+    TRACCC_TRACE_RANGE("traccc::cuda::clusterization_algorithm::run_batched");
+
+    // Get a convenience variable for the stream that we'll be using.
+    cudaStream_t stream = details::get_stream(m_stream);
+    vecmem::memory_resource& event_mr = m_mr.event_memory();
+
+    // Number of cells
+    const cell_collection_types::view::size_type num_cells =
+        m_copy.get_size(cells);
+
+    if (num_cells == 0) {
+        return {measurement_collection_types::buffer{0, event_mr},
+                spacepoint_collection_types::buffer{0, event_mr},
+                std::vector<unsigned int>(n_events + 1, 0u)};
+    }
+
+    // Run the connected component labeling on all events at once, into a
+    // buffer with size overestimation.
+    measurement_collection_types::buffer unsorted_measurements(
+        num_cells, event_mr, vecmem::data::buffer_type::resizable);
+    m_copy.setup(unsorted_measurements);
+    vecmem::data::vector_buffer<unsigned int> cell_links(0u, event_mr);
+    vecmem::data::vector_buffer<unsigned int> ccl_backup(
+        device::ccl_backup_size(num_cells), event_mr);
+    launch_ccl(cells, modules, num_cells, m_copy.get_size(modules),
+               unsorted_measurements, *(unsorted_measurements.size_ptr()),
+               cell_links, ccl_backup);
+
+    // Copy number of measurements to host
+    vecmem::unique_alloc_ptr<unsigned int> num_measurements_host =
+        vecmem::make_unique_alloc<unsigned int>(
+            (m_mr.host != nullptr) ? *(m_mr.host) : m_mr.main);
+    CUDA_ERROR_CHECK(cudaMemcpyAsync(
+        num_measurements_host.get(), unsorted_measurements.size_ptr(),
+        sizeof(unsigned int), cudaMemcpyDeviceToHost, stream));
+    m_stream.synchronize();
+    const unsigned int n_measurements = *num_measurements_host;
+
+    // Find the event of every measurement.
+    vecmem::data::vector_buffer<unsigned int> measurement_events(
+        n_measurements, event_mr);
+    static constexpr unsigned int eventsLocalSize = 256;
+    const unsigned int events_blocks =
+        std::max(1u, (n_measurements + eventsLocalSize - 1) / eventsLocalSize);
+    kernels::get_measurement_events<<<events_blocks, eventsLocalSize, 0,
+                                      stream>>>(
+        unsorted_measurements, module_events, n_measurements,
+        measurement_events);
+    CUDA_ERROR_CHECK(cudaGetLastError());
+
+    // Order the measurements by event, keeping their original order inside
+    // of the events.
+    // Thrust takes its temporary storage from the event memory.
+    details::thrust_allocator thrust_alloc(event_mr);
+    auto policy = thrust::cuda::par_nosync(thrust_alloc).on(stream);
+    vecmem::data::vector_buffer<unsigned int> order(n_measurements, event_mr);
+    thrust::sequence(policy, order.ptr(), order.ptr() + n_measurements);
+    thrust::stable_sort_by_key(policy, measurement_events.ptr(),
+                               measurement_events.ptr() + n_measurements,
+                               order.ptr());
+    batched_output_type result{
+        measurement_collection_types::buffer{n_measurements, event_mr},
+        spacepoint_collection_types::buffer{n_measurements, event_mr},
+        std::vector<unsigned int>(n_events + 1, 0u)};
+    thrust::gather(policy, order.ptr(), order.ptr() + n_measurements,
+                   unsorted_measurements.ptr(), result.measurements.ptr());
+
+    // Find where the measurements of the individual events start.
+    vecmem::data::vector_buffer<unsigned int> offsets(
+        static_cast<unsigned int>(n_events + 1), event_mr);
+    thrust::lower_bound(policy, measurement_events.ptr(),
+                        measurement_events.ptr() + n_measurements,
+                        thrust::counting_iterator<unsigned int>(0u),
+                        thrust::counting_iterator<unsigned int>(
+                            static_cast<unsigned int>(n_events + 1)),
+                        offsets.ptr());
+    CUDA_ERROR_CHECK(cudaMemcpyAsync(
+        result.offsets.data(), offsets.ptr(),
+        (n_events + 1) * sizeof(unsigned int), cudaMemcpyDeviceToHost,
+        stream));
+    // Wait for the offsets, which also makes sure that the temporary
+    // buffers are no longer used when they go away.
+    m_stream.synchronize();
+
+    // Turn the (ordered) 2D measurements into 3D spacepoints.
+    if (n_measurements > 0) {
+        auto spacepointsLocalSize = 1024;
+        const unsigned int num_blocks =
+            (n_measurements + spacepointsLocalSize - 1) / spacepointsLocalSize;
+        details::kernel_timer form_spacepoints_timer(
+            m_stream, "form_spacepoints", num_blocks, spacepointsLocalSize);
+        kernels::form_spacepoints<<<num_blocks, spacepointsLocalSize, 0,
+                                    stream>>>(result.measurements, modules,
+                                              n_measurements,
+                                              result.spacepoints);
+        form_spacepoints_timer.stop();
+        CUDA_ERROR_CHECK(cudaGetLastError());
+    }
+
+    // Record the estimated work, with the sizes already known on the host.
+    if (counting_work()) {
+        work_estimate work =
+            work_model::clusterization(num_cells, n_measurements);
+        work += work_model::spacepoint_formation(n_measurements);
+        count_work(work);
+    }
+
+    return result;
+}
+
+void clusterization_algorithm::run_bounded(
+    const cell_collection_types::const_view& cells,
+    const cell_module_collection_types::const_view& modules,
+    const unsigned int cell_capacity,
+    measurement_collection_types::view measurements,
+    spacepoint_collection_types::view spacepoints,
+    vecmem::data::vector_view<unsigned int> cell_links,
+    vecmem::data::vector_view<unsigned int> ccl_backup,
+    const module_descriptor_soa_collection_types::const_view& descriptors)
+    const {
+
+    // Get a convenience variable for the stream that we'll be using.
+    cudaStream_t stream = details::get_stream(m_stream);
+
+    // The size of the resizable measurement buffer is used as the measurement
+    // counter of the CCL kernel.
+    assert(measurements.size_ptr() != nullptr);
+    assert(spacepoints.size_ptr() != nullptr);
+    CUDA_ERROR_CHECK(cudaMemsetAsync(measurements.size_ptr(), 0,
+                                     sizeof(unsigned int), stream));
+
+    // Launch the CCL kernel for the full capacity, choosing it based on the
+    // capacities as well. Partitions beyond the actual number of cells are
+    // empty.
+    launch_ccl(cells, modules, cell_capacity, modules.capacity(), measurements,
+               *(measurements.size_ptr()), cell_links, ccl_backup);
+
+    // Turn 2D measurements into 3D spacepoints
+    auto spacepointsLocalSize = 1024;
+    const unsigned int num_blocks =
+        std::max(1u, (cell_capacity + spacepointsLocalSize - 1) /
+                         spacepointsLocalSize);
+    details::kernel_timer form_spacepoints_bounded_timer(
+        m_stream, "form_spacepoints_bounded", num_blocks, spacepointsLocalSize);
+    if (descriptors.size() > 0) {
+        kernels::form_spacepoints_bounded<<<num_blocks, spacepointsLocalSize,
+                                            0, stream>>>(
+            measurements, descriptors, *(measurements.size_ptr()),
+            spacepoints);
+    } else {
+        kernels::form_spacepoints_bounded<<<num_blocks, spacepointsLocalSize,
+                                            0, stream>>>(
+            measurements, modules, *(measurements.size_ptr()), spacepoints);
+    }
+    form_spacepoints_bounded_timer.stop();
+    CUDA_ERROR_CHECK(cudaGetLastError());
+
+    // Set the size of the spacepoint buffer on the device.
+    CUDA_ERROR_CHECK(cudaMemcpyAsync(
+        spacepoints.size_ptr(), measurements.size_ptr(), sizeof(unsigned int),
+        cudaMemcpyDeviceToDevice, stream));
+}
+
+unsigned int clusterization_algorithm::ccl_backup_size(
+    const unsigned int cell_capacity) {
+
+    return device::ccl_backup_size(cell_capacity);
 }
 
 }  // namespace traccc::cuda
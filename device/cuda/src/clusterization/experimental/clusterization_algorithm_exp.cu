@@ -1,11 +1,13 @@
 /** TRACCC library, part of the ACTS project (R&D line)
  *
- * (c) 2022 CERN for the benefit of the ACTS project
+ * (c) 2022-2024 CERN for the benefit of the ACTS project
  *
  * Mozilla Public License Version 2.0
  */
 
 // CUDA Library include(s).
+#include "../../utils/kernel_timer.hpp"
+#include "../../utils/thrust_allocator.cuh"
 #include "../../utils/utils.hpp"
 #include "traccc/cuda/clusterization/experimental/clusterization_algorithm.hpp"
 #include "traccc/cuda/utils/barrier.hpp"
@@ -15,6 +17,7 @@
 #include "traccc/clusterization/device/aggregate_cluster.hpp"
 #include "traccc/clusterization/device/ccl_kernel.hpp"
 #include "traccc/clusterization/device/reduce_problem_cell.hpp"
+#include "traccc/utils/trace.hpp"
 
 // Vecmem include(s).
 #include <vecmem/utils/copy.hpp>
@@ -46,7 +49,8 @@ __global__ void ccl_kernel(
     const index_t target_cells_per_partition,
     measurement_collection_types::view measurements_view,
     unsigned int& measurement_count,
-    vecmem::data::vector_view<unsigned int> cell_links) {
+    vecmem::data::vector_view<unsigned int> cell_links,
+    vecmem::data::vector_view<unsigned int> backup_view) {
     __shared__ unsigned int partition_start, partition_end;
     __shared__ unsigned int outi;
     extern __shared__ index_t shared_v[];
@@ -58,7 +62,8 @@ __global__ void ccl_kernel(
                        modules_view, max_cells_per_partition,
                        target_cells_per_partition, partition_start,
                        partition_end, outi, f, f_next, barry_r,
-                       measurements_view, measurement_count, cell_links);
+                       measurements_view, measurement_count, cell_links,
+                       backup_view);
 }
 
 }  // namespace kernels
@@ -75,6 +80,8 @@ clusterization_algorithm::output_type clusterization_algorithm::operator()(
     const cell_collection_types::const_view& cells,
     const cell_module_collection_types::const_view& modules) const {
 
+    TRACCC_TRACE_RANGE("traccc::cuda::experimental::clusterization_algorithm");
+
     // Get a convenience variable for the stream that we'll be using.
     cudaStream_t stream = details::get_stream(m_stream);
 
@@ -108,17 +115,25 @@ clusterization_algorithm::output_type clusterization_algorithm::operator()(
         (num_cells + m_target_cells_per_partition - 1) /
         m_target_cells_per_partition;
 
-    // Create buffer for linking cells to their spacepoints.
-    vecmem::data::vector_buffer<unsigned int> cell_links(num_cells, m_mr.main);
-    m_copy.setup(cell_links);
-
-    // Launch ccl kernel. Each thread will handle a single cell.
+    // Scratch space for the partitions that would not fit into shared memory,
+    // and for the cooperative aggregation of the clusters.
+    vecmem::data::vector_buffer<unsigned int> ccl_backup(
+        device::ccl_backup_size(num_cells), m_mr.main);
+
+    // Launch ccl kernel. Each thread will handle a single cell. The links
+    // from the cells to their measurements are not returned by this
+    // algorithm, so they are not written.
+    details::kernel_timer ccl_kernel_timer(m_stream, "ccl_kernel",
+                                           num_partitions,
+                                           threads_per_partition);
     kernels::
         ccl_kernel<<<num_partitions, threads_per_partition,
                      2 * max_cells_per_partition * sizeof(index_t), stream>>>(
             cells, modules, max_cells_per_partition,
             m_target_cells_per_partition, measurements_buffer,
-            *num_measurements_device, cell_links);
+            *num_measurements_device, vecmem::data::vector_view<unsigned int>{},
+            ccl_backup);
+    ccl_kernel_timer.stop();
 
     CUDA_ERROR_CHECK(cudaGetLastError());
 
@@ -147,9 +162,12 @@ clusterization_algorithm::output_type clusterization_algorithm::operator()(
 
     m_stream.synchronize();
 
+    // Thrust takes its temporary storage from the main memory resource.
+    details::thrust_allocator thrust_alloc(m_mr.main);
     // Sort the measurements w.r.t geometry barcode
-    thrust::sort(thrust::cuda::par.on(stream), new_measurements_device.begin(),
-                 new_measurements_device.end(), measurement_sort_comp());
+    thrust::sort(thrust::cuda::par(thrust_alloc).on(stream),
+                 new_measurements_device.begin(), new_measurements_device.end(),
+                 measurement_sort_comp());
 
     return new_measurements_buffer;
 }
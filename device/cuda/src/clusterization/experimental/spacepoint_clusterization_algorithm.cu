@@ -0,0 +1,226 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// CUDA Library include(s).
+#include "../../utils/kernel_timer.hpp"
+#include "../../utils/thrust_allocator.cuh"
+#include "../../utils/utils.hpp"
+#include "traccc/cuda/clusterization/experimental/spacepoint_clusterization_algorithm.hpp"
+#include "traccc/cuda/utils/barrier.hpp"
+#include "traccc/cuda/utils/definitions.hpp"
+
+// Project include(s)
+#include "traccc/clusterization/device/ccl_kernel.hpp"
+#include "traccc/seeding/device/experimental/form_partition_spacepoints.hpp"
+#include "traccc/utils/trace.hpp"
+
+// Detray include(s).
+#include "detray/core/detector.hpp"
+#include "detray/detectors/telescope_metadata.hpp"
+#include "detray/geometry/shapes/rectangle2D.hpp"
+
+// Vecmem include(s).
+#include <vecmem/utils/copy.hpp>
+
+// Thrust include(s).
+#include <thrust/execution_policy.h>
+#include <thrust/sort.h>
+
+namespace {
+
+/// These indices in clusterization will only range from 0 to
+/// max_cells_per_partition, so we only need a short.
+using index_t = unsigned short;
+
+static constexpr int TARGET_CELLS_PER_THREAD = 8;
+static constexpr int MAX_CELLS_PER_THREAD = 12;
+
+/// Comparator ordering spacepoints by the surfaces of their measurements
+struct spacepoint_sort_comp {
+    TRACCC_HOST_DEVICE
+    bool operator()(const traccc::spacepoint& lhs,
+                    const traccc::spacepoint& rhs) const {
+        return traccc::measurement_sort_comp{}(lhs.meas, rhs.meas);
+    }
+};
+
+}  // namespace
+
+namespace traccc::cuda::experimental {
+
+namespace kernels {
+
+/// CUDA kernel running @c traccc::device::ccl_kernel, followed by the
+/// spacepoint formation of each partition
+template <typename detector_t>
+__global__ void ccl_spacepoints_kernel(
+    typename detector_t::view_type det_data,
+    const cell_collection_types::const_view cells_view,
+    const cell_module_collection_types::const_view modules_view,
+    const index_t max_cells_per_partition,
+    const index_t target_cells_per_partition,
+    measurement_collection_types::view measurements_view,
+    unsigned int& measurement_count,
+    vecmem::data::vector_view<unsigned int> backup_view,
+    spacepoint_collection_types::view spacepoints_view) {
+
+    using transform3_type = typename detector_t::transform3;
+
+    __shared__ unsigned int partition_start, partition_end;
+    __shared__ unsigned int outi, measurements_start;
+    // Raw storage, as shared memory variables can not have constructors.
+    __shared__ alignas(transform3_type) unsigned char
+        placements_storage[device::experimental::MAX_CACHED_PLACEMENTS *
+                           sizeof(transform3_type)];
+    extern __shared__ index_t shared_v[];
+    index_t* f = &shared_v[0];
+    index_t* f_next = &shared_v[max_cells_per_partition];
+    transform3_type* placements =
+        reinterpret_cast<transform3_type*>(placements_storage);
+    traccc::cuda::barrier barry_r;
+
+    device::ccl_kernel(threadIdx.x, blockDim.x, blockIdx.x, cells_view,
+                       modules_view, max_cells_per_partition,
+                       target_cells_per_partition, partition_start,
+                       partition_end, outi, f, f_next, barry_r,
+                       measurements_view, measurement_count,
+                       vecmem::data::vector_view<unsigned int>{}, backup_view,
+                       &measurements_start);
+
+    // Cache the placements while the (last) measurements are being written.
+    device::experimental::cache_partition_placements<detector_t>(
+        threadIdx.x, det_data, cells_view, modules_view, partition_start,
+        partition_end, placements);
+
+    barry_r.blockBarrier();
+
+    device::experimental::form_partition_spacepoints<detector_t>(
+        threadIdx.x, blockDim.x, det_data, cells_view, partition_start,
+        partition_end, placements, measurements_view, measurements_start,
+        outi, spacepoints_view);
+}
+
+}  // namespace kernels
+
+template <typename detector_t>
+spacepoint_clusterization_algorithm<detector_t>::
+    spacepoint_clusterization_algorithm(
+        const traccc::memory_resource& mr, vecmem::copy& copy, stream& str,
+        const unsigned short target_cells_per_partition)
+    : m_target_cells_per_partition(target_cells_per_partition),
+      m_mr(mr),
+      m_copy(copy),
+      m_stream(str) {}
+
+template <typename detector_t>
+spacepoint_collection_types::buffer
+spacepoint_clusterization_algorithm<detector_t>::operator()(
+    const typename detector_t::view_type& det_view,
+    const cell_collection_types::const_view& cells,
+    const cell_module_collection_types::const_view& modules) const {
+
+    TRACCC_TRACE_RANGE(
+        "traccc::cuda::experimental::spacepoint_clusterization_algorithm");
+
+    // Get a convenience variable for the stream that we'll be using.
+    cudaStream_t stream = details::get_stream(m_stream);
+
+    // Number of cells
+    const cell_collection_types::view::size_type num_cells =
+        m_copy.get_size(cells);
+
+    if (num_cells == 0) {
+        return {0, m_mr.main};
+    }
+
+    // Intermediate measurement and spacepoint buffers, with size
+    // overestimation. The spacepoints are written at the indices of their
+    // measurements.
+    measurement_collection_types::buffer measurements_buffer(num_cells,
+                                                             m_mr.main);
+    m_copy.setup(measurements_buffer);
+    spacepoint_collection_types::buffer spacepoints_buffer(num_cells,
+                                                           m_mr.main);
+    m_copy.setup(spacepoints_buffer);
+
+    // Counter for number of measurements
+    vecmem::unique_alloc_ptr<unsigned int> num_measurements_device =
+        vecmem::make_unique_alloc<unsigned int>(m_mr.main);
+    CUDA_ERROR_CHECK(cudaMemsetAsync(num_measurements_device.get(), 0,
+                                     sizeof(unsigned int), stream));
+
+    const unsigned short max_cells_per_partition =
+        (m_target_cells_per_partition * MAX_CELLS_PER_THREAD +
+         TARGET_CELLS_PER_THREAD - 1) /
+        TARGET_CELLS_PER_THREAD;
+    const unsigned int threads_per_partition =
+        (m_target_cells_per_partition + TARGET_CELLS_PER_THREAD - 1) /
+        TARGET_CELLS_PER_THREAD;
+    const unsigned int num_partitions =
+        (num_cells + m_target_cells_per_partition - 1) /
+        m_target_cells_per_partition;
+
+    // Scratch space for the partitions that would not fit into shared memory,
+    // and for the cooperative aggregation of the clusters.
+    vecmem::data::vector_buffer<unsigned int> ccl_backup(
+        device::ccl_backup_size(num_cells), m_mr.main);
+
+    // Launch the fused kernel. The links from the cells to their
+    // measurements are not written.
+    details::kernel_timer ccl_kernel_timer(m_stream, "ccl_spacepoints_kernel",
+                                           num_partitions,
+                                           threads_per_partition);
+    kernels::ccl_spacepoints_kernel<detector_t>
+        <<<num_partitions, threads_per_partition,
+           2 * max_cells_per_partition * sizeof(index_t), stream>>>(
+            det_view, cells, modules, max_cells_per_partition,
+            m_target_cells_per_partition, measurements_buffer,
+            *num_measurements_device, ccl_backup, spacepoints_buffer);
+    ccl_kernel_timer.stop();
+
+    CUDA_ERROR_CHECK(cudaGetLastError());
+
+    // Copy number of spacepoints to host
+    vecmem::unique_alloc_ptr<unsigned int> num_spacepoints_host =
+        vecmem::make_unique_alloc<unsigned int>(
+            (m_mr.host != nullptr) ? *(m_mr.host) : m_mr.main);
+    CUDA_ERROR_CHECK(cudaMemcpyAsync(
+        num_spacepoints_host.get(), num_measurements_device.get(),
+        sizeof(unsigned int), cudaMemcpyDeviceToHost, stream));
+    m_stream.synchronize();
+
+    // Create a new spacepoint buffer with a right size
+    spacepoint_collection_types::buffer new_spacepoints_buffer(
+        *num_spacepoints_host, m_mr.main);
+    m_copy.setup(new_spacepoints_buffer);
+
+    vecmem::device_vector<spacepoint> spacepoints_device(spacepoints_buffer);
+    vecmem::device_vector<spacepoint> new_spacepoints_device(
+        new_spacepoints_buffer);
+
+    CUDA_ERROR_CHECK(cudaMemcpyAsync(
+        new_spacepoints_device.begin(), spacepoints_device.begin(),
+        sizeof(spacepoint) * (*num_spacepoints_host),
+        cudaMemcpyDeviceToDevice, stream));
+
+    // Thrust takes its temporary storage from the main memory resource.
+    details::thrust_allocator thrust_alloc(m_mr.main);
+    // Sort the spacepoints w.r.t the geometry barcodes of their measurements
+    thrust::sort(thrust::cuda::par(thrust_alloc).on(stream),
+                 new_spacepoints_device.begin(), new_spacepoints_device.end(),
+                 spacepoint_sort_comp());
+    m_stream.synchronize();
+
+    return new_spacepoints_buffer;
+}
+
+using telescope_detector_type =
+    detray::detector<detray::telescope_metadata<detray::rectangle2D>,
+                     detray::device_container_types>;
+template class spacepoint_clusterization_algorithm<telescope_detector_type>;
+
+}  // namespace traccc::cuda::experimental
@@ -0,0 +1,63 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Local include(s).
+#include "../utils/thrust_allocator.cuh"
+#include "../utils/utils.hpp"
+#include "traccc/cuda/clusterization/measurement_sorting_algorithm.hpp"
+#include "traccc/utils/trace.hpp"
+
+// VecMem include(s).
+#include <vecmem/containers/data/vector_buffer.hpp>
+
+// Thrust include(s).
+#include <thrust/execution_policy.h>
+#include <thrust/sort.h>
+#include <thrust/transform.h>
+
+// System include(s).
+#include <cstdint>
+
+namespace traccc::cuda {
+
+measurement_sorting_algorithm::measurement_sorting_algorithm(
+    const traccc::memory_resource& mr, vecmem::copy& copy, stream& str)
+    : m_mr(mr), m_copy(copy), m_stream(str) {}
+
+measurement_sorting_algorithm::output_type
+measurement_sorting_algorithm::operator()(
+    const measurement_collection_types::view& measurements) const {
+
+    TRACCC_TRACE_RANGE("traccc::cuda::measurement_sorting_algorithm");
+
+    // Get a convenience variable for the stream that we'll be using.
+    cudaStream_t stream = details::get_stream(m_stream);
+
+    // Get the number of measurements. This is a synchronous operation for a
+    // resizable buffer.
+    const measurement_collection_types::view::size_type n_measurements =
+        m_copy.get_size(measurements);
+
+    // Sort the measurements in place by their integer keys, without
+    // synchronising the stream. With primitive keys Thrust uses a (stable)
+    // radix sort, instead of the merge sort of a comparison based sort.
+    vecmem::data::vector_buffer<std::uint64_t> keys_buffer(
+        n_measurements, m_mr.event_memory());
+    // Thrust takes its temporary storage from the event memory.
+    details::thrust_allocator thrust_alloc(m_mr.event_memory());
+    auto policy = thrust::cuda::par_nosync(thrust_alloc).on(stream);
+    thrust::transform(policy, measurements.ptr(),
+                      measurements.ptr() + n_measurements, keys_buffer.ptr(),
+                      measurement_sort_key());
+    thrust::sort_by_key(policy, keys_buffer.ptr(),
+                        keys_buffer.ptr() + n_measurements, measurements.ptr());
+
+    // Return a fixed size view of the sorted measurements.
+    return {n_measurements, measurements.ptr()};
+}
+
+}  // namespace traccc::cuda
@@ -0,0 +1,604 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// CUDA Library include(s).
+#include "traccc/cuda/clusterization/persistent_clusterization.hpp"
+#include "traccc/cuda/utils/barrier.hpp"
+#include "traccc/cuda/utils/definitions.hpp"
+
+// Project include(s)
+#include "traccc/clusterization/device/ccl_kernel.hpp"
+#include "traccc/clusterization/device/form_spacepoints.hpp"
+
+// CUDA include(s).
+#include <cuda_runtime_api.h>
+
+// System include(s).
+#include <algorithm>
+#include <atomic>
+#include <stdexcept>
+#include <thread>
+
+namespace {
+
+/// These indices in clusterization will only range from 0 to
+/// max_cells_per_partition, so we only need a short.
+using index_t = unsigned short;
+
+static constexpr int TARGET_CELLS_PER_THREAD = 8;
+static constexpr int MAX_CELLS_PER_THREAD = 12;
+
+/// @name Stages of the processing of an event
+/// @{
+
+/// Copy of the event descriptor into device memory, and buffer setup
+static constexpr unsigned int STAGE_SETUP = 0u;
+/// Connected component labeling, one thread block per partition
+static constexpr unsigned int STAGE_CCL = 1u;
+/// Spacepoint formation, one thread block per group of measurements
+static constexpr unsigned int STAGE_SPACEPOINTS = 2u;
+/// The number of stages
+static constexpr unsigned int N_STAGES = 3u;
+/// Pseudo-stage telling the blocks of the kernel to exit
+static constexpr unsigned int STAGE_EXIT = N_STAGES;
+/// Pseudo-stage telling the blocks of the kernel that there is no work
+static constexpr unsigned int STAGE_IDLE = N_STAGES + 1;
+
+/// @}
+
+}  // namespace
+
+namespace traccc::cuda {
+
+namespace details {
+
+/// Description of an event in the queue
+struct event_descriptor {
+    /// The cells of the event
+    cell_collection_types::const_view cells;
+    /// The modules of the event
+    cell_module_collection_types::const_view modules;
+    /// The (resizable) measurements of the event
+    measurement_collection_types::view measurements;
+    /// The (resizable) spacepoints of the event
+    spacepoint_collection_types::view spacepoints;
+    /// Scratch space of the connected component labeling
+    vecmem::data::vector_view<unsigned int> backup;
+    /// The number of cell partitions of the event
+    unsigned int n_partitions;
+};
+
+/// The part of the queue written by the host
+struct queue_control {
+    /// The ticket of the next event to be enqueued
+    unsigned int tail;
+    /// Flag telling the kernel to exit once the queue is empty
+    unsigned int stop;
+};
+
+/// The completion record of an event, written by the device
+struct queue_completion {
+    /// The ticket of the last completed event of the slot, plus one
+    unsigned int ticket;
+    /// The number of measurements of that event
+    unsigned int n_measurements;
+};
+
+/// The processing state of an event slot
+///
+/// All counters are tagged with the ticket of the event that they belong to,
+/// in their upper 32 bits. So the counters of a slot never need to be reset
+/// when the slot is re-used, and a block cannot mistake the counters of a
+/// previous event for the ones of the current event.
+///
+struct slot_state {
+    /// The number of claimed work items per stage
+    unsigned long long claimed[N_STAGES];
+    /// The number of finished work items per stage
+    unsigned long long finished[N_STAGES];
+    /// The number of spacepoint formation work items
+    unsigned long long n_spacepoint_items;
+};
+
+/// The (CUDA specific) state of the queue and its kernel
+struct persistent_queue {
+    /// The stream that the persistent kernel runs in
+    cudaStream_t stream = nullptr;
+    /// The control words of the queue, in mapped host memory
+    queue_control* control = nullptr;
+    /// The descriptors of the events, in mapped host memory
+    event_descriptor* host_events = nullptr;
+    /// The completion records of the events, in mapped host memory
+    queue_completion* completions = nullptr;
+    /// Copies of the descriptors of the events, in device memory
+    event_descriptor* events = nullptr;
+    /// The processing states of the slots, in device memory
+    slot_state* states = nullptr;
+    /// The ticket of the oldest unfinished event, in device memory
+    unsigned int* front = nullptr;
+};
+
+}  // namespace details
+
+namespace {
+
+/// Combine a ticket and a value into a tagged counter
+__device__ unsigned long long make_tagged(unsigned int ticket,
+                                          unsigned int value) {
+    return (static_cast<unsigned long long>(ticket) << 32) | value;
+}
+
+/// Check whether ticket @c a is newer than ticket @c b (with wrap-around)
+__host__ __device__ bool is_newer(unsigned int a, unsigned int b) {
+    return static_cast<int>(a - b) > 0;
+}
+
+/// Read the value of a tagged counter belonging to an event
+///
+/// @return Whether the counter was set for the event already
+///
+__device__ bool read_tagged(const unsigned long long* counter,
+                            unsigned int ticket, unsigned int& value) {
+    const unsigned long long word =
+        *static_cast<const volatile unsigned long long*>(counter);
+    value = static_cast<unsigned int>(word);
+    return static_cast<unsigned int>(word >> 32) == ticket;
+}
+
+/// Claim the next one of @c n_items work items of an event
+///
+/// @return Whether a work item could be claimed
+///
+__device__ bool claim_item(unsigned long long* counter, unsigned int ticket,
+                           unsigned int n_items, unsigned int& item) {
+    unsigned long long old =
+        *static_cast<volatile unsigned long long*>(counter);
+    while (true) {
+        const unsigned int tag = static_cast<unsigned int>(old >> 32);
+        // The slot was taken over by a newer event already.
+        if (is_newer(tag, ticket)) {
+            return false;
+        }
+        const unsigned int next =
+            (tag == ticket) ? static_cast<unsigned int>(old) : 0u;
+        if (next >= n_items) {
+            return false;
+        }
+        const unsigned long long prev =
+            atomicCAS(counter, old, make_tagged(ticket, next + 1));
+        if (prev == old) {
+            item = next;
+            return true;
+        }
+        old = prev;
+    }
+}
+
+/// Count one finished work item of an event
+///
+/// @return The number of the finished work items, including this one
+///
+__device__ unsigned int finish_item(unsigned long long* counter,
+                                    unsigned int ticket) {
+    unsigned long long old =
+        *static_cast<volatile unsigned long long*>(counter);
+    while (true) {
+        const unsigned int next =
+            (static_cast<unsigned int>(old >> 32) == ticket)
+                ? static_cast<unsigned int>(old) + 1
+                : 1u;
+        const unsigned long long prev =
+            atomicCAS(counter, old, make_tagged(ticket, next));
+        if (prev == old) {
+            return next;
+        }
+        old = prev;
+    }
+}
+
+/// Copy an event descriptor word-by-word, bypassing the (incoherent) caches
+__device__ void copy_descriptor(const details::event_descriptor* from,
+                                details::event_descriptor* to) {
+    static_assert(sizeof(details::event_descriptor) % sizeof(unsigned int) ==
+                  0u);
+    const volatile unsigned int* src =
+        reinterpret_cast<const volatile unsigned int*>(from);
+    volatile unsigned int* dst = reinterpret_cast<volatile unsigned int*>(to);
+    for (unsigned int i = 0;
+         i < sizeof(details::event_descriptor) / sizeof(unsigned int); ++i) {
+        dst[i] = src[i];
+    }
+}
+
+/// Publish the completion of an event to the host
+__device__ void complete_event(details::queue_completion& completion,
+                               unsigned int ticket,
+                               unsigned int n_measurements) {
+    volatile details::queue_completion& record = completion;
+    record.n_measurements = n_measurements;
+    __threadfence_system();
+    record.ticket = ticket + 1;
+}
+
+}  // namespace
+
+namespace kernels {
+
+/// Persistent CUDA kernel running the clusterization of the enqueued events
+///
+/// Thread 0 of every block looks for work in the events between the oldest
+/// unfinished one and the tail of the queue, preferring the older events,
+/// and claims one work item of the current stage of an event. The whole
+/// block then processes that work item, with the same device functions that
+/// the regular clusterization kernels use.
+///
+__global__ void persistent_clusterization(
+    const details::queue_control* control,
+    const details::event_descriptor* host_events,
+    details::queue_completion* completions, details::event_descriptor* events,
+    details::slot_state* states, unsigned int* front,
+    const unsigned int queue_size, const index_t max_cells_per_partition,
+    const index_t target_cells_per_partition) {
+
+    __shared__ unsigned int partition_start, partition_end;
+    __shared__ unsigned int outi;
+    __shared__ unsigned int s_ticket, s_stage, s_item;
+    // Local copy of the descriptor of the event being processed.
+    __shared__ alignas(details::event_descriptor) unsigned char
+        s_event_storage[sizeof(details::event_descriptor)];
+    details::event_descriptor& s_event =
+        *reinterpret_cast<details::event_descriptor*>(s_event_storage);
+    extern __shared__ index_t shared_v[];
+    index_t* f = &shared_v[0];
+    index_t* f_next = &shared_v[max_cells_per_partition];
+    traccc::cuda::barrier barry_r;
+
+    const volatile details::queue_control& vcontrol = *control;
+    const volatile unsigned int& vfront = *front;
+
+    while (true) {
+
+        // Look for a work item.
+        if (threadIdx.x == 0) {
+            bool found = false;
+            const unsigned int tail = vcontrol.tail;
+            const unsigned int first = vfront;
+            for (unsigned int ticket = first;
+                 (ticket != tail) && (ticket - first < queue_size) && !found;
+                 ++ticket) {
+
+                const unsigned int slot = ticket % queue_size;
+                details::slot_state& state = states[slot];
+
+                // Skip (and retire) the events that are done.
+                const unsigned int done_ticket =
+                    static_cast<volatile details::queue_completion&>(
+                        completions[slot])
+                        .ticket;
+                if (!is_newer(ticket + 1, done_ticket)) {
+                    atomicCAS(front, ticket, ticket + 1);
+                    continue;
+                }
+
+                // Find the current stage of the event.
+                unsigned int value = 0u;
+                unsigned int stage = STAGE_SETUP;
+                unsigned int n_items = 1u;
+                __threadfence();
+                if (read_tagged(&state.n_spacepoint_items, ticket, value)) {
+                    stage = STAGE_SPACEPOINTS;
+                    n_items = value;
+                } else if (read_tagged(&state.finished[STAGE_SETUP], ticket,
+                                       value) &&
+                           (value == 1u)) {
+                    __threadfence();
+                    stage = STAGE_CCL;
+                    n_items = static_cast<const volatile unsigned int&>(
+                        events[slot].n_partitions);
+                }
+
+                // Try to claim a work item of it.
+                unsigned int item = 0u;
+                if (claim_item(&state.claimed[stage], ticket, n_items, item)) {
+                    found = true;
+                    s_ticket = ticket;
+                    s_stage = stage;
+                    s_item = item;
+                    // Make the writes of the previous stages visible.
+                    __threadfence();
+                    copy_descriptor((stage == STAGE_SETUP) ? &host_events[slot]
+                                                           : &events[slot],
+                                    &s_event);
+                }
+            }
+            if (!found) {
+                s_stage =
+                    (vcontrol.stop && (vfront == tail)) ? STAGE_EXIT
+                                                        : STAGE_IDLE;
+            }
+        }
+        __syncthreads();
+
+        const unsigned int stage = s_stage;
+        if (stage == STAGE_EXIT) {
+            return;
+        } else if (stage == STAGE_IDLE) {
+            // Nothing to do at the moment.
+            if (threadIdx.x == 0) {
+                __nanosleep(1000);
+            }
+            __syncthreads();
+            continue;
+        }
+        const unsigned int ticket = s_ticket;
+        const unsigned int item = s_item;
+        const unsigned int slot = ticket % queue_size;
+        details::slot_state& state = states[slot];
+
+        // Process the work item.
+        if (stage == STAGE_SETUP) {
+            if (threadIdx.x == 0) {
+                copy_descriptor(&s_event, &events[slot]);
+                *static_cast<volatile unsigned int*>(
+                    s_event.measurements.size_ptr()) = 0u;
+                *static_cast<volatile unsigned int*>(
+                    s_event.spacepoints.size_ptr()) = 0u;
+            }
+        } else if (stage == STAGE_CCL) {
+            device::ccl_kernel(threadIdx.x, blockDim.x, item, s_event.cells,
+                               s_event.modules, max_cells_per_partition,
+                               target_cells_per_partition, partition_start,
+                               partition_end, outi, f, f_next, barry_r,
+                               s_event.measurements,
+                               *(s_event.measurements.size_ptr()), {},
+                               s_event.backup);
+        } else {
+            const unsigned int n_measurements =
+                *static_cast<const volatile unsigned int*>(
+                    s_event.measurements.size_ptr());
+            device::form_spacepoints(item * blockDim.x + threadIdx.x,
+                                     s_event.measurements, s_event.modules,
+                                     n_measurements, s_event.spacepoints);
+        }
+        __syncthreads();
+
+        // Record the finished work item, and start the next stage of the
+        // event if this was its last work item.
+        if (threadIdx.x == 0) {
+            __threadfence();
+            const unsigned int n_finished =
+                finish_item(&state.finished[stage], ticket);
+            if ((stage == STAGE_CCL) &&
+                       (n_finished == s_event.n_partitions)) {
+                const unsigned int n_measurements =
+                    *static_cast<const volatile unsigned int*>(
+                        s_event.measurements.size_ptr());
+                *static_cast<volatile unsigned int*>(
+                    s_event.spacepoints.size_ptr()) = n_measurements;
+                const unsigned int n_items =
+                    (n_measurements + blockDim.x - 1) / blockDim.x;
+                if (n_items == 0u) {
+                    complete_event(completions[slot], ticket, 0u);
+                } else {
+                    __threadfence();
+                    atomicExch(&state.n_spacepoint_items,
+                               make_tagged(ticket, n_items));
+                }
+            } else if (stage == STAGE_SPACEPOINTS) {
+                unsigned int n_items = 0u;
+                read_tagged(&state.n_spacepoint_items, ticket, n_items);
+                if (n_finished == n_items) {
+                    complete_event(completions[slot], ticket,
+                                   *static_cast<const volatile unsigned int*>(
+                                       s_event.measurements.size_ptr()));
+                }
+            }
+        }
+        __syncthreads();
+    }
+}
+
+}  // namespace kernels
+
+namespace {
+
+/// The maximum number of cells in a partition
+index_t max_cells_per_partition(unsigned short target_cells_per_partition) {
+    return (target_cells_per_partition * MAX_CELLS_PER_THREAD +
+            TARGET_CELLS_PER_THREAD - 1) /
+           TARGET_CELLS_PER_THREAD;
+}
+
+/// The number of threads of the blocks of the persistent kernel
+unsigned int threads_per_block(unsigned short target_cells_per_partition) {
+    return (target_cells_per_partition + TARGET_CELLS_PER_THREAD - 1) /
+           TARGET_CELLS_PER_THREAD;
+}
+
+}  // namespace
+
+persistent_clusterization::persistent_clusterization(
+    const traccc::memory_resource& mr,
+    unsigned short target_cells_per_partition, unsigned int queue_size,
+    unsigned int n_blocks)
+    : m_mr(mr),
+      m_cached_mr(std::make_unique<vecmem::binary_page_memory_resource>(
+          m_mr.main)),
+      m_target_cells_per_partition(target_cells_per_partition),
+      m_queue_size(queue_size),
+      m_buffers(queue_size),
+      m_queue(std::make_unique<details::persistent_queue>()) {
+
+    if (m_queue_size == 0u) {
+        throw std::invalid_argument("The queue size must be positive");
+    }
+
+    // Launch parameters of the persistent kernel.
+    const index_t max_cells =
+        max_cells_per_partition(target_cells_per_partition);
+    const unsigned int n_threads =
+        threads_per_block(target_cells_per_partition);
+    const std::size_t shared_size = 2 * max_cells * sizeof(index_t);
+    if (n_blocks == 0u) {
+        int device = 0, n_sm = 0, blocks_per_sm = 0;
+        CUDA_ERROR_CHECK(cudaGetDevice(&device));
+        CUDA_ERROR_CHECK(cudaDeviceGetAttribute(
+            &n_sm, cudaDevAttrMultiProcessorCount, device));
+        CUDA_ERROR_CHECK(cudaOccupancyMaxActiveBlocksPerMultiprocessor(
+            &blocks_per_sm, kernels::persistent_clusterization, n_threads,
+            shared_size));
+        n_blocks = static_cast<unsigned int>(std::max(1, n_sm * blocks_per_sm));
+    }
+
+    // Set up the queue. All counters of it start at zero.
+    details::persistent_queue& q = *m_queue;
+    CUDA_ERROR_CHECK(
+        cudaStreamCreateWithFlags(&(q.stream), cudaStreamNonBlocking));
+    CUDA_ERROR_CHECK(cudaHostAlloc(&(q.control), sizeof(details::queue_control),
+                                   cudaHostAllocMapped));
+    CUDA_ERROR_CHECK(cudaHostAlloc(
+        &(q.host_events), m_queue_size * sizeof(details::event_descriptor),
+        cudaHostAllocMapped));
+    CUDA_ERROR_CHECK(cudaHostAlloc(
+        &(q.completions), m_queue_size * sizeof(details::queue_completion),
+        cudaHostAllocMapped));
+    *(q.control) = {0u, 0u};
+    std::fill(q.completions, q.completions + m_queue_size,
+              details::queue_completion{0u, 0u});
+    CUDA_ERROR_CHECK(cudaMalloc(
+        &(q.events), m_queue_size * sizeof(details::event_descriptor)));
+    CUDA_ERROR_CHECK(
+        cudaMalloc(&(q.states), m_queue_size * sizeof(details::slot_state)));
+    CUDA_ERROR_CHECK(cudaMemset(q.states, 0,
+                                m_queue_size * sizeof(details::slot_state)));
+    CUDA_ERROR_CHECK(cudaMalloc(&(q.front), sizeof(unsigned int)));
+    CUDA_ERROR_CHECK(cudaMemset(q.front, 0, sizeof(unsigned int)));
+
+    // The device side addresses of the mapped memory.
+    details::queue_control* control = nullptr;
+    details::event_descriptor* host_events = nullptr;
+    details::queue_completion* completions = nullptr;
+    CUDA_ERROR_CHECK(cudaHostGetDevicePointer(&control, q.control, 0));
+    CUDA_ERROR_CHECK(cudaHostGetDevicePointer(&host_events, q.host_events, 0));
+    CUDA_ERROR_CHECK(cudaHostGetDevicePointer(&completions, q.completions, 0));
+
+    // Start the persistent kernel.
+    kernels::persistent_clusterization<<<n_blocks, n_threads, shared_size,
+                                         q.stream>>>(
+        control, host_events, completions, q.events, q.states, q.front,
+        m_queue_size, max_cells, target_cells_per_partition);
+    CUDA_ERROR_CHECK(cudaGetLastError());
+}
+
+persistent_clusterization::~persistent_clusterization() {
+
+    // Stop the kernel before releasing any of the memory that it uses.
+    stop();
+    details::persistent_queue& q = *m_queue;
+    cudaFree(q.front);
+    cudaFree(q.states);
+    cudaFree(q.events);
+    cudaFreeHost(q.completions);
+    cudaFreeHost(q.host_events);
+    cudaFreeHost(q.control);
+    cudaStreamDestroy(q.stream);
+}
+
+persistent_clusterization::ticket_type persistent_clusterization::enqueue(
+    const cell_collection_types::const_view& cells,
+    const cell_module_collection_types::const_view& modules) {
+
+    if (m_stopped) {
+        throw std::logic_error("The persistent kernel was stopped already");
+    }
+
+    const ticket_type ticket = m_next_ticket;
+    const unsigned int slot = ticket % m_queue_size;
+    details::persistent_queue& q = *m_queue;
+
+    // Make sure that the previous event of the slot is done.
+    if (ticket >= m_queue_size) {
+        wait_for(ticket - m_queue_size);
+    }
+
+    // Set up the buffers of the event.
+    event_buffers& buffers = m_buffers[slot];
+    const unsigned int n_cells = cells.size();
+    buffers.ticket = ticket;
+    buffers.pending = true;
+    if (n_cells == 0u) {
+        // Empty events never need to reach the device.
+        buffers.measurements = {0u, *m_cached_mr};
+        buffers.spacepoints = {0u, *m_cached_mr};
+        buffers.backup = {0u, *m_cached_mr};
+        q.completions[slot] = {ticket + 1, 0u};
+    } else {
+        buffers.measurements = {n_cells, *m_cached_mr,
+                                vecmem::data::buffer_type::resizable};
+        buffers.spacepoints = {n_cells, *m_cached_mr,
+                               vecmem::data::buffer_type::resizable};
+        buffers.backup = {device::ccl_backup_size(n_cells), *m_cached_mr};
+        q.host_events[slot] = {
+            cells,
+            modules,
+            buffers.measurements,
+            buffers.spacepoints,
+            buffers.backup,
+            (n_cells + m_target_cells_per_partition - 1) /
+                m_target_cells_per_partition};
+    }
+
+    // Publish the event to the kernel.
+    std::atomic_thread_fence(std::memory_order_release);
+    static_cast<volatile details::queue_control*>(q.control)->tail =
+        ticket + 1;
+    ++m_next_ticket;
+    return ticket;
+}
+
+bool persistent_clusterization::is_done(ticket_type ticket) const {
+
+    const volatile details::queue_completion& completion =
+        m_queue->completions[ticket % m_queue_size];
+    return !is_newer(ticket + 1, completion.ticket);
+}
+
+void persistent_clusterization::wait_for(ticket_type ticket) const {
+
+    while (!is_done(ticket)) {
+        std::this_thread::yield();
+    }
+    std::atomic_thread_fence(std::memory_order_acquire);
+}
+
+persistent_clusterization::output_type persistent_clusterization::wait(
+    ticket_type ticket) {
+
+    event_buffers& buffers = m_buffers[ticket % m_queue_size];
+    if (!buffers.pending || (buffers.ticket != ticket)) {
+        throw std::invalid_argument(
+            "The results of the event are not available");
+    }
+    wait_for(ticket);
+
+    buffers.pending = false;
+    buffers.backup = {};
+    return {std::move(buffers.measurements), std::move(buffers.spacepoints)};
+}
+
+void persistent_clusterization::stop() {
+
+    if (m_stopped) {
+        return;
+    }
+    std::atomic_thread_fence(std::memory_order_release);
+    static_cast<volatile details::queue_control*>(m_queue->control)->stop = 1u;
+    CUDA_ERROR_CHECK(cudaStreamSynchronize(m_queue->stream));
+    m_stopped = true;
+}
+
+}  // namespace traccc::cuda
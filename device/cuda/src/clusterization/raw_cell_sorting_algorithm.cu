@@ -0,0 +1,170 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Local include(s).
+#include "../utils/kernel_timer.hpp"
+#include "../utils/thrust_allocator.cuh"
+#include "../utils/utils.hpp"
+#include "traccc/cuda/clusterization/raw_cell_sorting_algorithm.hpp"
+#include "traccc/cuda/utils/definitions.hpp"
+
+// Project include(s).
+#include "traccc/clusterization/device/sort_raw_cells.hpp"
+#include "traccc/utils/trace.hpp"
+
+// VecMem include(s).
+#include <vecmem/containers/data/vector_buffer.hpp>
+
+// Thrust include(s).
+#include <thrust/execution_policy.h>
+#include <thrust/scan.h>
+#include <thrust/sort.h>
+
+// System include(s).
+#include <cstdint>
+#include <vector>
+
+namespace traccc::cuda {
+
+namespace kernels {
+
+/// CUDA kernel for running @c traccc::device::make_raw_cell_channel_keys
+__global__ void make_raw_cell_channel_keys(
+    raw_cell_collection_types::const_view raw_cells_view,
+    vecmem::data::vector_view<std::uint64_t> keys_view,
+    vecmem::data::vector_view<unsigned int> indices_view) {
+
+    device::make_raw_cell_channel_keys(threadIdx.x + blockIdx.x * blockDim.x,
+                                       raw_cells_view, keys_view,
+                                       indices_view);
+}
+
+/// CUDA kernel for running @c traccc::device::make_raw_cell_module_keys
+__global__ void make_raw_cell_module_keys(
+    raw_cell_collection_types::const_view raw_cells_view,
+    vecmem::data::vector_view<const unsigned int> indices_view,
+    vecmem::data::vector_view<std::uint64_t> keys_view) {
+
+    device::make_raw_cell_module_keys(threadIdx.x + blockIdx.x * blockDim.x,
+                                      raw_cells_view, indices_view, keys_view);
+}
+
+/// CUDA kernel for running @c traccc::device::flag_raw_cell_modules
+__global__ void flag_raw_cell_modules(
+    vecmem::data::vector_view<const std::uint64_t> keys_view,
+    vecmem::data::vector_view<unsigned int> flags_view) {
+
+    device::flag_raw_cell_modules(threadIdx.x + blockIdx.x * blockDim.x,
+                                  keys_view, flags_view);
+}
+
+/// CUDA kernel for running @c traccc::device::fill_sorted_cells
+__global__ void fill_sorted_cells(
+    raw_cell_collection_types::const_view raw_cells_view,
+    vecmem::data::vector_view<const unsigned int> indices_view,
+    vecmem::data::vector_view<const unsigned int> module_sum_view,
+    device::cell_module_map_view module_map,
+    cell_collection_types::view cells_view,
+    cell_module_collection_types::view modules_view) {
+
+    device::fill_sorted_cells(threadIdx.x + blockIdx.x * blockDim.x,
+                              raw_cells_view, indices_view, module_sum_view,
+                              module_map, cells_view, modules_view);
+}
+
+}  // namespace kernels
+
+raw_cell_sorting_algorithm::raw_cell_sorting_algorithm(
+    const module_map_view& module_map, const traccc::memory_resource& mr,
+    vecmem::copy& copy, stream& str)
+    : m_module_map(module_map), m_mr(mr), m_copy(copy), m_stream(str) {}
+
+raw_cell_sorting_algorithm::output_type raw_cell_sorting_algorithm::operator()(
+    const raw_cell_collection_types::const_view& raw_cells) const {
+
+    TRACCC_TRACE_RANGE("traccc::cuda::raw_cell_sorting_algorithm");
+
+    // Get a convenience variable for the stream that we'll be using.
+    cudaStream_t stream = details::get_stream(m_stream);
+
+    // Get the number of cells. This is a synchronous operation for a
+    // resizable buffer.
+    const unsigned int n_cells = m_copy.get_size(raw_cells);
+
+    // Check if anything needs to be done.
+    if (n_cells == 0) {
+        output_type result{{0, m_mr.main}, {0, m_mr.main}};
+        m_copy.setup(result.cells);
+        m_copy.setup(result.modules);
+        return result;
+    }
+
+    // The sort keys and the (sorted) indices of the cells
+    vecmem::data::vector_buffer<std::uint64_t> keys_buffer(
+        n_cells, m_mr.event_memory());
+    vecmem::data::vector_buffer<unsigned int> indices_buffer(
+        n_cells, m_mr.event_memory());
+
+    const unsigned int nThreads = WARP_SIZE * 8;
+    const unsigned int nBlocks = (n_cells + nThreads - 1) / nThreads;
+
+    // Thrust takes its temporary storage from the event memory. With
+    // primitive keys its (stable) sorts are radix sorts.
+    details::thrust_allocator thrust_alloc(m_mr.event_memory());
+    auto policy = thrust::cuda::par_nosync(thrust_alloc).on(stream);
+
+    // Sort the cells by their channels first, and then (stably) by their
+    // modules.
+    kernels::make_raw_cell_channel_keys<<<nBlocks, nThreads, 0, stream>>>(
+        raw_cells, keys_buffer, indices_buffer);
+    CUDA_ERROR_CHECK(cudaGetLastError());
+    thrust::stable_sort_by_key(policy, keys_buffer.ptr(),
+                               keys_buffer.ptr() + n_cells,
+                               indices_buffer.ptr());
+
+    kernels::make_raw_cell_module_keys<<<nBlocks, nThreads, 0, stream>>>(
+        raw_cells, indices_buffer, keys_buffer);
+    CUDA_ERROR_CHECK(cudaGetLastError());
+    thrust::stable_sort_by_key(policy, keys_buffer.ptr(),
+                               keys_buffer.ptr() + n_cells,
+                               indices_buffer.ptr());
+
+    // Number the modules of the sorted cells.
+    vecmem::data::vector_buffer<unsigned int> module_sum_buffer(
+        n_cells, m_mr.event_memory());
+    kernels::flag_raw_cell_modules<<<nBlocks, nThreads, 0, stream>>>(
+        keys_buffer, module_sum_buffer);
+    CUDA_ERROR_CHECK(cudaGetLastError());
+    thrust::inclusive_scan(policy, module_sum_buffer.ptr(),
+                           module_sum_buffer.ptr() + n_cells,
+                           module_sum_buffer.ptr());
+
+    // The number of modules is needed on the host, to set up the module
+    // buffer.
+    std::vector<unsigned int> n_modules;
+    m_copy(vecmem::data::vector_view<const unsigned int>(
+               1u, module_sum_buffer.ptr() + n_cells - 1),
+           n_modules)
+        ->wait();
+
+    // Create the output buffers, and fill them.
+    output_type result{{n_cells, m_mr.main}, {n_modules.front(), m_mr.main}};
+    m_copy.setup(result.cells);
+    m_copy.setup(result.modules);
+
+    details::kernel_timer fill_timer(m_stream, "fill_sorted_cells", nBlocks,
+                                     nThreads);
+    kernels::fill_sorted_cells<<<nBlocks, nThreads, 0, stream>>>(
+        raw_cells, indices_buffer, module_sum_buffer, m_module_map,
+        result.cells, result.modules);
+    fill_timer.stop();
+    CUDA_ERROR_CHECK(cudaGetLastError());
+
+    return result;
+}
+
+}  // namespace traccc::cuda
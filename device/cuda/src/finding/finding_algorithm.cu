@@ -6,23 +6,35 @@
  */
 
 // Project include(s).
+#include "../utils/decoupled_scan.cuh"
+#include "../utils/kernel_timer.hpp"
+#include "../utils/launch_parameters.cuh"
+#include "../utils/navigation_grid.hpp"
+#include "../utils/thrust_allocator.cuh"
 #include "../utils/utils.hpp"
+#include "../utils/warp_append.cuh"
 #include "traccc/cuda/finding/finding_algorithm.hpp"
+#include "traccc/cuda/finding/measurement_segmentation_algorithm.hpp"
 #include "traccc/cuda/utils/definitions.hpp"
+#include "traccc/cuda/utils/magnetic_field.hpp"
 #include "traccc/definitions/primitives.hpp"
 #include "traccc/edm/device/finding_global_counter.hpp"
+#include "traccc/edm/packed_track_parameters.hpp"
 #include "traccc/finding/candidate_link.hpp"
 #include "traccc/finding/device/apply_interaction.hpp"
 #include "traccc/finding/device/build_tracks.hpp"
-#include "traccc/finding/device/count_measurements.hpp"
 #include "traccc/finding/device/find_tracks.hpp"
-#include "traccc/finding/device/make_barcode_sequence.hpp"
 #include "traccc/finding/device/propagate_to_next_surface.hpp"
+#include "traccc/finding/device/prune_shared_hits.hpp"
+#include "traccc/fitting/kalman_filter/gain_matrix_updater.hpp"
+#include "traccc/utils/trace.hpp"
+#include "traccc/utils/work_model.hpp"
 
 // detray include(s).
 #include "detray/core/detector.hpp"
 #include "detray/core/detector_metadata.hpp"
 #include "detray/detectors/bfield.hpp"
+#include "detray/geometry/surface.hpp"
 #include "detray/navigation/navigator.hpp"
 #include "detray/propagator/rk_stepper.hpp"
 
@@ -36,58 +48,98 @@
 #include <thrust/copy.h>
 #include <thrust/execution_policy.h>
 #include <thrust/fill.h>
+#include <thrust/functional.h>
+#include <thrust/gather.h>
+#include <thrust/iterator/counting_iterator.h>
 #include <thrust/scan.h>
+#include <thrust/sequence.h>
 #include <thrust/sort.h>
-#include <thrust/unique.h>
+#include <thrust/transform.h>
+#include <thrust/transform_reduce.h>
 
 // System include(s).
+#include <algorithm>
+#include <limits>
+#include <new>
+#include <numeric>
+#include <stdexcept>
+#include <type_traits>
 #include <vector>
 
 namespace traccc::cuda {
 
-namespace kernels {
+/// Number of warps per block of the per-warp track finding kernel
+static constexpr unsigned int warps_per_block = 2u;
 
-/// CUDA kernel for running @c traccc::device::make_barcode_sequence
-__global__ void make_barcode_sequence(
-    measurement_collection_types::const_view measurements_view,
-    vecmem::data::vector_view<detray::geometry::barcode> barcodes_view) {
+/// Storage type of the parameters passed between the steps of the track
+/// finding, which are read and written by every step
+using step_parameters = packed_bound_track_parameters<transform3>;
+/// Collection types of the parameters passed between the steps
+using step_parameters_collection_types =
+    packed_bound_track_parameters_collection_types;
 
-    int gid = threadIdx.x + blockIdx.x * blockDim.x;
-
-    device::make_barcode_sequence(gid, measurements_view, barcodes_view);
-}
+namespace kernels {
 
-/// CUDA kernel for running @c traccc::device::apply_interaction
+/// Run @c traccc::device::apply_interaction_and_count_measurements, and
+/// produce the prefix sum of the number of measurements per parameter in the
+/// same kernel
+///
+/// The prefix sum is taken over the whole grid, in a single pass, with
+/// @c traccc::cuda::details::decoupled_lookback_scan. The elements from
+/// @c n_in_params to the size of the prefix sum receive zero measurements.
+///
 template <typename detector_t>
-__global__ void apply_interaction(
+__device__ inline void interact_count_measurements_and_scan(
     typename detector_t::view_type det_data,
-    vecmem::data::jagged_vector_view<detray::intersection2D<
-        typename detector_t::surface_type, typename detector_t::transform3>>
-        nav_candidates_buffer,
-    const int n_params,
-    bound_track_parameters_collection_types::view params_view) {
+    step_parameters_collection_types::view params_view,
+    measurement_range_collection_types::const_view ranges_view,
+    const unsigned int n_in_params,
+    vecmem::data::vector_view<unsigned int> n_measurements_view,
+    vecmem::data::vector_view<unsigned int> ref_meas_idx_view,
+    vecmem::data::vector_view<unsigned int> prefix_sum_view,
+    unsigned long long* scan_states, unsigned int& n_measurements_sum) {
 
-    int gid = threadIdx.x + blockIdx.x * blockDim.x;
+    const details::decoupled_lookback_scan scan(scan_states);
+    const unsigned int tile = scan.tile();
+    const unsigned int gid = threadIdx.x + tile * blockDim.x;
+
+    device::apply_interaction_and_count_measurements<detector_t,
+                                                    step_parameters>(
+        gid, det_data, n_in_params, params_view, ranges_view,
+        n_measurements_view, ref_meas_idx_view, n_measurements_sum);
+
+    vecmem::device_vector<unsigned int> n_measurements(n_measurements_view);
+    vecmem::device_vector<unsigned int> prefix_sum(prefix_sum_view);
+    unsigned int value = 0u;
+    if (gid < n_in_params) {
+        value = n_measurements.at(gid);
+    } else if (gid < prefix_sum.size()) {
+        n_measurements.at(gid) = 0u;
+    }
 
-    device::apply_interaction<detector_t>(gid, det_data, nav_candidates_buffer,
-                                          n_params, params_view);
+    const unsigned int sum = scan.inclusive_scan(value, tile);
+    if (gid < prefix_sum.size()) {
+        prefix_sum.at(gid) = sum;
+    }
 }
 
-/// CUDA kernel for running @c traccc::device::count_measurements
-__global__ void count_measurements(
-    bound_track_parameters_collection_types::const_view params_view,
-    vecmem::data::vector_view<const detray::geometry::barcode> barcodes_view,
-    vecmem::data::vector_view<const unsigned int> upper_bounds_view,
+/// CUDA kernel for running
+/// @c traccc::device::apply_interaction_and_count_measurements, which also
+/// produces the prefix sum of the number of measurements per parameter
+template <typename detector_t>
+__global__ void interact_and_count_measurements(
+    typename detector_t::view_type det_data,
+    step_parameters_collection_types::view params_view,
+    measurement_range_collection_types::const_view ranges_view,
     const unsigned int n_in_params,
     vecmem::data::vector_view<unsigned int> n_measurements_view,
     vecmem::data::vector_view<unsigned int> ref_meas_idx_view,
-    unsigned int& n_measurements_sum) {
-
-    int gid = threadIdx.x + blockIdx.x * blockDim.x;
+    vecmem::data::vector_view<unsigned int> prefix_sum_view,
+    unsigned long long* scan_states, unsigned int& n_measurements_sum) {
 
-    device::count_measurements(
-        gid, params_view, barcodes_view, upper_bounds_view, n_in_params,
-        n_measurements_view, ref_meas_idx_view, n_measurements_sum);
+    interact_count_measurements_and_scan<detector_t>(
+        det_data, params_view, ranges_view, n_in_params, n_measurements_view,
+        ref_meas_idx_view, prefix_sum_view, scan_states, n_measurements_sum);
 }
 
 /// CUDA kernel for running @c traccc::device::find_tracks
@@ -95,23 +147,189 @@ template <typename detector_t, typename config_t>
 __global__ void find_tracks(
     const config_t cfg, typename detector_t::view_type det_data,
     measurement_collection_types::const_view measurements_view,
-    bound_track_parameters_collection_types::const_view in_params_view,
+    step_parameters_collection_types::const_view in_params_view,
     vecmem::data::vector_view<const unsigned int>
         n_measurements_prefix_sum_view,
     vecmem::data::vector_view<const unsigned int> ref_meas_idx_view,
     const unsigned int step, const unsigned int n_max_candidates,
-    bound_track_parameters_collection_types::view out_params_view,
+    step_parameters_collection_types::view out_params_view,
     vecmem::data::vector_view<candidate_link> links_view,
     unsigned int& n_candidates) {
 
     int gid = threadIdx.x + blockIdx.x * blockDim.x;
 
-    device::find_tracks<detector_t, config_t>(
+    device::find_tracks<detector_t, config_t, step_parameters>(
         gid, cfg, det_data, measurements_view, in_params_view,
         n_measurements_prefix_sum_view, ref_meas_idx_view, step,
         n_max_candidates, out_params_view, links_view, n_candidates);
 }
 
+/// CUDA kernel finding the compatible measurements of the parameters, with
+/// one warp per parameter
+///
+/// It produces the same candidates as @c traccc::device::find_tracks. But
+/// the lanes of a warp share one parameter through shared memory, instead of
+/// every thread loading the parameters of its own measurements, and each of
+/// the lanes runs the Kalman updates of a subset of its measurements.
+///
+template <typename detector_t, typename config_t>
+__global__ void find_tracks_per_warp(
+    const config_t cfg, typename detector_t::view_type det_data,
+    measurement_collection_types::const_view measurements_view,
+    step_parameters_collection_types::const_view in_params_view,
+    vecmem::data::vector_view<const unsigned int> n_measurements_view,
+    vecmem::data::vector_view<const unsigned int> ref_meas_idx_view,
+    const unsigned int step, const unsigned int n_in_params,
+    const unsigned int n_max_candidates,
+    step_parameters_collection_types::view out_params_view,
+    vecmem::data::vector_view<candidate_link> links_view,
+    unsigned int& n_candidates) {
+
+    // The parameters of the warps of the block
+    __shared__ typename std::aligned_storage<
+        sizeof(bound_track_parameters), alignof(bound_track_parameters)>::type
+        shared_storage[warps_per_block];
+    bound_track_parameters* shared_params =
+        reinterpret_cast<bound_track_parameters*>(shared_storage);
+
+    const unsigned int lane = threadIdx.x % WARP_SIZE;
+    const unsigned int warp = threadIdx.x / WARP_SIZE;
+    const unsigned int in_param_id =
+        (threadIdx.x + blockIdx.x * blockDim.x) / WARP_SIZE;
+    if (in_param_id >= n_in_params) {
+        return;
+    }
+
+    step_parameters_collection_types::const_device in_params(
+        in_params_view);
+    if (lane == 0u) {
+        new (shared_params + warp)
+            bound_track_parameters(in_params.at(in_param_id));
+    }
+    __syncwarp();
+    const bound_track_parameters& in_par = shared_params[warp];
+
+    detector_t det(det_data);
+    measurement_collection_types::const_device measurements(measurements_view);
+    vecmem::device_vector<const unsigned int> n_measurements(
+        n_measurements_view);
+    vecmem::device_vector<const unsigned int> ref_meas_idx(ref_meas_idx_view);
+    step_parameters_collection_types::device out_params(out_params_view);
+    vecmem::device_vector<candidate_link> links(links_view);
+
+    // Last step ID
+    const unsigned int previous_step =
+        (step == 0) ? std::numeric_limits<unsigned int>::max() : step - 1;
+
+    const detray::surface<detector_t> sf{det, in_par.surface_link()};
+    const unsigned int meas_begin = ref_meas_idx.at(in_param_id);
+    const unsigned int meas_end = meas_begin + n_measurements.at(in_param_id);
+
+    for (unsigned int meas_idx = meas_begin + lane; meas_idx < meas_end;
+         meas_idx += WARP_SIZE) {
+
+        // Run the Kalman update
+        track_state<typename detector_t::transform3> trk_state(
+            measurements.at(meas_idx));
+        bound_track_parameters par = in_par;
+        sf.template visit_mask<
+            gain_matrix_updater<typename detector_t::transform3,
+                                typename config_t::precise_scalar_type>>(
+            trk_state, par);
+
+        if (trk_state.filtered_chi2() < cfg.chi2_max) {
+
+            // Add the measurement candidate to the links, with one atomic
+            // operation for the lanes of the warp
+            const unsigned int l_pos =
+                details::warp_aggregated_append{}(n_candidates);
+
+            if (l_pos >= n_max_candidates) {
+                n_candidates = n_max_candidates;
+                return;
+            }
+
+            links[l_pos] = {{previous_step, in_param_id}, meas_idx};
+            out_params[l_pos] = trk_state.filtered();
+        }
+    }
+}
+
+/// CUDA kernel for running @c traccc::device::find_best_tracks
+template <typename detector_t, typename config_t>
+__global__ void find_best_tracks(
+    const config_t cfg, typename detector_t::view_type det_data,
+    measurement_collection_types::const_view measurements_view,
+    step_parameters_collection_types::const_view in_params_view,
+    vecmem::data::vector_view<const unsigned int> n_measurements_view,
+    vecmem::data::vector_view<const unsigned int> ref_meas_idx_view,
+    const unsigned int step, const unsigned int n_in_params,
+    const unsigned int n_max_candidates,
+    step_parameters_collection_types::view out_params_view,
+    vecmem::data::vector_view<candidate_link> links_view,
+    unsigned int& n_candidates) {
+
+    int gid = threadIdx.x + blockIdx.x * blockDim.x;
+
+    device::find_best_tracks<detector_t, config_t, step_parameters>(
+        gid, cfg, det_data, measurements_view, in_params_view,
+        n_measurements_view, ref_meas_idx_view, step, n_in_params,
+        n_max_candidates, out_params_view, links_view, n_candidates);
+}
+
+/// CUDA kernel for running @c traccc::device::insert_shared_hits
+template <typename detector_t, typename config_t>
+__global__ void insert_shared_hits(
+    const config_t cfg, typename detector_t::view_type det_data,
+    measurement_collection_types::const_view measurements_view,
+    step_parameters_collection_types::const_view in_params_view,
+    vecmem::data::vector_view<const unsigned int> param_seeds_view,
+    vecmem::data::vector_view<const candidate_link> links_view,
+    const unsigned int n_candidates,
+    vecmem::data::vector_view<unsigned int> slots_view,
+    vecmem::data::vector_view<unsigned int> best_chi2_view,
+    vecmem::data::vector_view<unsigned int> cand_slots_view,
+    vecmem::data::vector_view<unsigned int> cand_chi2_view,
+    vecmem::data::vector_view<unsigned int> cand_seeds_view) {
+
+    int gid = threadIdx.x + blockIdx.x * blockDim.x;
+
+    device::insert_shared_hits<detector_t, config_t, step_parameters>(
+        gid, cfg, det_data, measurements_view, in_params_view,
+        param_seeds_view, links_view, n_candidates, slots_view, best_chi2_view,
+        cand_slots_view, cand_chi2_view, cand_seeds_view);
+}
+
+/// CUDA kernel for running @c traccc::device::elect_shared_hits
+__global__ void elect_shared_hits(
+    const unsigned int n_candidates,
+    vecmem::data::vector_view<const unsigned int> best_chi2_view,
+    vecmem::data::vector_view<const unsigned int> cand_slots_view,
+    vecmem::data::vector_view<const unsigned int> cand_chi2_view,
+    vecmem::data::vector_view<unsigned int> winners_view) {
+
+    int gid = threadIdx.x + blockIdx.x * blockDim.x;
+
+    device::elect_shared_hits(gid, n_candidates, best_chi2_view,
+                              cand_slots_view, cand_chi2_view, winners_view);
+}
+
+/// CUDA kernel for running @c traccc::device::prune_shared_hits
+template <typename config_t>
+__global__ void prune_shared_hits(
+    const config_t cfg, const unsigned int n_candidates,
+    step_parameters_collection_types::const_view params_view,
+    vecmem::data::vector_view<const unsigned int> cand_slots_view,
+    vecmem::data::vector_view<const unsigned int> winners_view,
+    vecmem::data::vector_view<unsigned int> pruned_view) {
+
+    int gid = threadIdx.x + blockIdx.x * blockDim.x;
+
+    device::prune_shared_hits<config_t, step_parameters>(
+        gid, cfg, n_candidates, params_view, cand_slots_view, winners_view,
+        pruned_view);
+}
+
 /// CUDA kernel for running @c traccc::device::propagate_to_next_surface
 template <typename propagator_t, typename bfield_t, typename config_t>
 __global__ void propagate_to_next_surface(
@@ -120,21 +338,141 @@ __global__ void propagate_to_next_surface(
     bfield_t field_data,
     vecmem::data::jagged_vector_view<typename propagator_t::intersection_type>
         nav_candidates_buffer,
-    bound_track_parameters_collection_types::const_view in_params_view,
+    step_parameters_collection_types::const_view in_params_view,
     vecmem::data::vector_view<const candidate_link> links_view,
     const unsigned int step, const unsigned int& n_candidates,
-    bound_track_parameters_collection_types::view out_params_view,
+    step_parameters_collection_types::view out_params_view,
     vecmem::data::vector_view<unsigned int> param_to_link_view,
     vecmem::data::vector_view<typename candidate_link::link_index_type>
         tips_view,
     unsigned int& n_out_params) {
 
-    int gid = threadIdx.x + blockIdx.x * blockDim.x;
+    const unsigned int n_in_params = n_candidates;
+
+    for (unsigned int gid = threadIdx.x + blockIdx.x * blockDim.x;
+         gid < n_in_params; gid += blockDim.x * gridDim.x) {
+        device::propagate_to_next_surface<propagator_t, bfield_t, config_t,
+                                          details::warp_aggregated_append,
+                                          step_parameters>(
+            gid, cfg, det_data, field_data, nav_candidates_buffer,
+            in_params_view, links_view, step, n_in_params, out_params_view,
+            param_to_link_view, tips_view, n_out_params,
+            details::warp_aggregated_append{});
+    }
+}
+
+/// CUDA kernel for running
+/// @c traccc::device::apply_interaction_and_count_measurements and the prefix
+/// sum of its results, with the number of parameters taken from device memory
+template <typename detector_t>
+__global__ void interact_and_count_measurements_on_device(
+    typename detector_t::view_type det_data,
+    step_parameters_collection_types::view params_view,
+    measurement_range_collection_types::const_view ranges_view,
+    const device::finding_global_counter& in_counter,
+    vecmem::data::vector_view<unsigned int> n_measurements_view,
+    vecmem::data::vector_view<unsigned int> ref_meas_idx_view,
+    vecmem::data::vector_view<unsigned int> prefix_sum_view,
+    unsigned long long* scan_states,
+    device::finding_global_counter& out_counter) {
+
+    interact_count_measurements_and_scan<detector_t>(
+        det_data, params_view, ranges_view, in_counter.n_out_params,
+        n_measurements_view, ref_meas_idx_view, prefix_sum_view, scan_states,
+        out_counter.n_measurements_sum);
+}
+
+/// CUDA kernel for running @c traccc::device::find_tracks, with the number
+/// of parameters and measurements taken from device memory
+template <typename detector_t, typename config_t>
+__global__ void find_tracks_on_device(
+    const config_t cfg, typename detector_t::view_type det_data,
+    measurement_collection_types::const_view measurements_view,
+    step_parameters_collection_types::const_view in_params_view,
+    vecmem::data::vector_view<const unsigned int>
+        n_measurements_prefix_sum_view,
+    vecmem::data::vector_view<const unsigned int> ref_meas_idx_view,
+    const unsigned int step, const unsigned int n_seeds,
+    const device::finding_global_counter& in_counter,
+    step_parameters_collection_types::view out_params_view,
+    vecmem::data::vector_view<candidate_link> links_view,
+    device::finding_global_counter& out_counter) {
+
+    const unsigned int n_max_candidates =
+        std::min(in_counter.n_out_params * cfg.max_num_branches_per_surface,
+                 n_seeds * cfg.max_num_branches_per_seed);
+    const unsigned int n_measurements_sum = out_counter.n_measurements_sum;
+
+    for (unsigned int gid = threadIdx.x + blockIdx.x * blockDim.x;
+         gid * cfg.n_measurements_per_thread < n_measurements_sum;
+         gid += blockDim.x * gridDim.x) {
+        device::find_tracks<detector_t, config_t, step_parameters>(
+            gid, cfg, det_data, measurements_view, in_params_view,
+            n_measurements_prefix_sum_view, ref_meas_idx_view, step,
+            n_max_candidates, out_params_view, links_view,
+            out_counter.n_candidates);
+    }
+}
+
+/// CUDA kernel for running @c traccc::device::find_best_tracks, with the
+/// number of parameters taken from device memory
+template <typename detector_t, typename config_t>
+__global__ void find_best_tracks_on_device(
+    const config_t cfg, typename detector_t::view_type det_data,
+    measurement_collection_types::const_view measurements_view,
+    step_parameters_collection_types::const_view in_params_view,
+    vecmem::data::vector_view<const unsigned int> n_measurements_view,
+    vecmem::data::vector_view<const unsigned int> ref_meas_idx_view,
+    const unsigned int step, const unsigned int n_seeds,
+    const device::finding_global_counter& in_counter,
+    step_parameters_collection_types::view out_params_view,
+    vecmem::data::vector_view<candidate_link> links_view,
+    device::finding_global_counter& out_counter) {
+
+    const unsigned int n_in_params = in_counter.n_out_params;
+    const unsigned int n_max_candidates =
+        std::min(n_in_params * cfg.max_num_branches_per_surface,
+                 n_seeds * cfg.max_num_branches_per_seed);
+
+    for (unsigned int gid = threadIdx.x + blockIdx.x * blockDim.x;
+         gid < n_in_params; gid += blockDim.x * gridDim.x) {
+        device::find_best_tracks<detector_t, config_t, step_parameters>(
+            gid, cfg, det_data, measurements_view, in_params_view,
+            n_measurements_view, ref_meas_idx_view, step, n_in_params,
+            n_max_candidates, out_params_view, links_view,
+            out_counter.n_candidates);
+    }
+}
 
-    device::propagate_to_next_surface<propagator_t, bfield_t, config_t>(
-        gid, cfg, det_data, field_data, nav_candidates_buffer, in_params_view,
-        links_view, step, n_candidates, out_params_view, param_to_link_view,
-        tips_view, n_out_params);
+/// CUDA kernel for running @c traccc::device::propagate_to_next_surface,
+/// with the number of candidates taken from device memory
+template <typename propagator_t, typename bfield_t, typename config_t>
+__global__ void propagate_to_next_surface_on_device(
+    const config_t cfg,
+    typename propagator_t::detector_type::view_type det_data,
+    bfield_t field_data,
+    vecmem::data::jagged_vector_view<typename propagator_t::intersection_type>
+        nav_candidates_buffer,
+    step_parameters_collection_types::const_view in_params_view,
+    vecmem::data::vector_view<const candidate_link> links_view,
+    const unsigned int step, device::finding_global_counter& out_counter,
+    step_parameters_collection_types::view out_params_view,
+    vecmem::data::vector_view<unsigned int> param_to_link_view,
+    vecmem::data::vector_view<typename candidate_link::link_index_type>
+        tips_view) {
+
+    const unsigned int n_candidates = out_counter.n_candidates;
+
+    for (unsigned int gid = threadIdx.x + blockIdx.x * blockDim.x;
+         gid < n_candidates; gid += blockDim.x * gridDim.x) {
+        device::propagate_to_next_surface<propagator_t, bfield_t, config_t,
+                                          details::warp_aggregated_append,
+                                          step_parameters>(
+            gid, cfg, det_data, field_data, nav_candidates_buffer,
+            in_params_view, links_view, step, n_candidates, out_params_view,
+            param_to_link_view, tips_view, out_counter.n_out_params,
+            details::warp_aggregated_append{});
+    }
 }
 
 /// CUDA kernel for running @c traccc::device::build_tracks
@@ -153,17 +491,322 @@ __global__ void build_tracks(
                          param_to_link_view, tips_view, track_candidates_view);
 }
 
+/// CUDA kernel for running @c traccc::device::build_flat_tracks
+__global__ void build_flat_tracks(
+    bound_track_parameters_collection_types::const_view seeds_view,
+    vecmem::data::jagged_vector_view<const candidate_link> links_view,
+    vecmem::data::jagged_vector_view<const unsigned int> param_to_link_view,
+    vecmem::data::vector_view<const typename candidate_link::link_index_type>
+        tips_view,
+    track_candidate_soa_collection_types::view track_candidates_view) {
+
+    int gid = threadIdx.x + blockIdx.x * blockDim.x;
+
+    device::build_flat_tracks(gid, seeds_view, links_view, param_to_link_view,
+                              tips_view, track_candidates_view);
+}
+
+/// CUDA kernel copying the track candidates of a chunk of seeds into the
+/// track candidates of the whole event
+__global__ void append_track_candidates(
+    track_candidate_container_types::const_view chunk_view,
+    const unsigned int offset,
+    track_candidate_container_types::view track_candidates_view) {
+
+    const unsigned int gid = threadIdx.x + blockIdx.x * blockDim.x;
+
+    track_candidate_container_types::const_device chunk(chunk_view);
+    if (gid >= chunk.size()) {
+        return;
+    }
+    track_candidate_container_types::device track_candidates(
+        track_candidates_view);
+
+    track_candidates[offset + gid].header = chunk[gid].header;
+    auto cands_per_track = track_candidates[offset + gid].items;
+    for (const track_candidate& cand : chunk[gid].items) {
+        cands_per_track.push_back(cand);
+    }
+}
+
 }  // namespace kernels
 
-template <typename stepper_t, typename navigator_t>
-finding_algorithm<stepper_t, navigator_t>::finding_algorithm(
+namespace {
+
+/// Functor returning the surface index of track parameters
+struct param_surface_index {
+    TRACCC_HOST_DEVICE
+    unsigned int operator()(const step_parameters& param) const {
+        return static_cast<unsigned int>(param.surface_link().index());
+    }
+};
+
+/// Sort the parameters of a step, and their links, by surface
+///
+/// @param params_buffer        The parameters to sort
+/// @param param_to_link_buffer The links of the parameters to sort
+/// @param n_params             The number of parameters in the buffers
+/// @param mr                   The memory resource for the sorted buffers
+/// @param stream               The stream to sort on
+///
+void sort_by_surface(
+    step_parameters_collection_types::buffer& params_buffer,
+    vecmem::data::vector_buffer<unsigned int>& param_to_link_buffer,
+    const unsigned int n_params, vecmem::memory_resource& mr,
+    cudaStream_t stream) {
+
+    // Thrust takes its temporary storage from the same memory resource.
+    details::thrust_allocator thrust_alloc(mr);
+
+    step_parameters_collection_types::device params(params_buffer);
+    vecmem::device_vector<unsigned int> param_to_link(param_to_link_buffer);
+
+    // Sort the indices of the parameters by their surfaces
+    vecmem::data::vector_buffer<unsigned int> keys_buffer(n_params, mr);
+    vecmem::data::vector_buffer<unsigned int> order_buffer(n_params, mr);
+    vecmem::device_vector<unsigned int> keys(keys_buffer);
+    vecmem::device_vector<unsigned int> order(order_buffer);
+    thrust::transform(thrust::cuda::par_nosync(thrust_alloc).on(stream),
+                      params.begin(), params.begin() + n_params, keys.begin(),
+                      param_surface_index{});
+    thrust::sequence(thrust::cuda::par_nosync(thrust_alloc).on(stream),
+                     order.begin(), order.end());
+    thrust::sort_by_key(thrust::cuda::par_nosync(thrust_alloc).on(stream),
+                        keys.begin(), keys.end(), order.begin());
+
+    // Gather the parameters and their links in the sorted order
+    step_parameters_collection_types::buffer sorted_params_buffer(
+        n_params, mr);
+    vecmem::data::vector_buffer<unsigned int> sorted_param_to_link_buffer(
+        n_params, mr);
+    step_parameters_collection_types::device sorted_params(
+        sorted_params_buffer);
+    vecmem::device_vector<unsigned int> sorted_param_to_link(
+        sorted_param_to_link_buffer);
+    thrust::gather(thrust::cuda::par_nosync(thrust_alloc).on(stream),
+                   order.begin(), order.end(), params.begin(),
+                   sorted_params.begin());
+    thrust::gather(thrust::cuda::par(thrust_alloc).on(stream), order.begin(),
+                   order.end(), param_to_link.begin(),
+                   sorted_param_to_link.begin());
+
+    // Replace the buffers, now that the (synchronising) gather finished.
+    params_buffer = std::move(sorted_params_buffer);
+    param_to_link_buffer = std::move(sorted_param_to_link_buffer);
+}
+
+/// Functor selecting the candidates that were not pruned
+struct is_not_pruned {
+    __device__ bool operator()(const unsigned int pruned) const {
+        return pruned == 0u;
+    }
+};
+
+/// Functor creating the tip link of a candidate of a step
+struct make_tip_link {
+    unsigned int m_step;
+
+    __device__ typename candidate_link::link_index_type operator()(
+        const unsigned int i) const {
+        return {m_step, i};
+    }
+};
+
+/// Functor getting the number of candidates of the track ending in a tip
+struct tip_n_candidates {
+    __device__ unsigned int operator()(
+        const typename candidate_link::link_index_type& tip) const {
+        return tip.first + 1;
+    }
+};
+
+/// Worst-case estimate of the per-step buffer memory of one seed, in bytes
+///
+/// A seed can not have more branches in a step than allowed by the branch
+/// limits per seed and per surface. Every branch needs the links that are
+/// kept until the tracks are built, and the parameters of the step.
+///
+template <typename config_t>
+std::size_t finding_bytes_per_seed(const config_t& cfg) {
+
+    const std::size_t kept_bytes_per_branch =
+        sizeof(candidate_link) + sizeof(unsigned int) +
+        sizeof(typename candidate_link::link_index_type);
+    const std::size_t step_bytes_per_branch =
+        3 * sizeof(step_parameters) + 3 * sizeof(unsigned int);
+    const std::size_t max_branches = cfg.max_num_branches_per_seed;
+
+    std::size_t n_branches = 1u;
+    std::size_t n_kept_branches = 0u;
+    for (unsigned int step = 0; step < cfg.max_track_candidates_per_track;
+         ++step) {
+        n_branches =
+            std::min(n_branches * cfg.max_num_branches_per_surface,
+                     max_branches);
+        n_kept_branches += n_branches;
+    }
+    return n_kept_branches * kept_bytes_per_branch +
+           n_branches * step_bytes_per_branch +
+           cfg.max_track_candidates_per_track * sizeof(track_candidate);
+}
+
+/// Add the branch counts of a chunk of seeds to the ones of the event
+void add_branch_counts(branch_histogram& total, const branch_histogram& chunk) {
+
+    auto add = [](std::vector<unsigned int>& to,
+                  const std::vector<unsigned int>& from) {
+        if (to.size() < from.size()) {
+            to.resize(from.size(), 0u);
+        }
+        for (std::size_t i = 0; i < from.size(); ++i) {
+            to[i] += from[i];
+        }
+    };
+    add(total.n_candidates, chunk.n_candidates);
+    add(total.n_active, chunk.n_active);
+    add(total.n_tips, chunk.n_tips);
+}
+
+}  // namespace
+
+template <typename stepper_t, typename navigator_t, typename precise_scalar_t>
+finding_algorithm<stepper_t, navigator_t, precise_scalar_t>::finding_algorithm(
     const config_type& cfg, const traccc::memory_resource& mr,
     vecmem::copy& copy, stream& str)
-    : m_cfg(cfg), m_mr(mr), m_copy(copy), m_stream(str){};
+    : m_cfg(cfg),
+      m_mr(mr),
+      m_own_workspace(mr.workspace == nullptr
+                          ? std::make_unique<workspace_resource>(mr.main)
+                          : nullptr),
+      m_workspace(mr.workspace == nullptr ? m_own_workspace.get()
+                                          : mr.workspace),
+      m_copy(copy),
+      m_stream(str) {
+
+    // The best-chi2 branching keeps its candidates in fixed size arrays.
+    if ((m_cfg.branching == branching_policy::e_best_chi2) &&
+        (m_cfg.max_num_branches_per_surface > device::max_best_branches)) {
+        throw std::invalid_argument(
+            "max_num_branches_per_surface is too large for the best-chi2 "
+            "branching policy");
+    }
+}
+
+template <typename stepper_t, typename navigator_t, typename precise_scalar_t>
+track_candidate_container_types::buffer
+finding_algorithm<stepper_t, navigator_t, precise_scalar_t>::operator()(
+    const typename detector_type::view_type& det_view,
+    const bfield_type& field_view,
+    const vecmem::data::jagged_vector_view<
+        typename navigator_t::intersection_type>& navigation_buffer,
+    const typename measurement_collection_types::view& measurements,
+    const bound_track_parameters_collection_types::buffer& seeds_buffer) const {
 
-template <typename stepper_t, typename navigator_t>
+    TRACCC_TRACE_RANGE("traccc::cuda::finding_algorithm");
+
+    // Start the budgets of the event, and apply its seed budget.
+    m_budget_status = {};
+    const clock_type::time_point start = clock_type::now();
+    const bound_track_parameters_collection_types::buffer truncated_seeds =
+        truncate_seeds(seeds_buffer);
+    const bound_track_parameters_collection_types::buffer& seeds =
+        m_budget_status.seeds_truncated ? truncated_seeds : seeds_buffer;
+
+    // Process the seeds in chunks, if finding the tracks of all of them at
+    // once could exceed the memory budget.
+    if (m_cfg.device_memory_budget > 0) {
+        const std::size_t chunk_size = std::max<std::size_t>(
+            1u, m_cfg.device_memory_budget / finding_bytes_per_seed(m_cfg));
+        if (m_copy.get_size(seeds) > chunk_size) {
+            return find_in_chunks(
+                det_view, field_view, navigation_buffer, measurements, seeds,
+                static_cast<unsigned int>(chunk_size), start);
+        }
+    }
+
+    return find_tracks(det_view, field_view, navigation_buffer, measurements,
+                       seeds, start);
+}
+
+template <typename stepper_t, typename navigator_t, typename precise_scalar_t>
+bound_track_parameters_collection_types::buffer
+finding_algorithm<stepper_t, navigator_t, precise_scalar_t>::truncate_seeds(
+    const bound_track_parameters_collection_types::buffer& seeds_buffer)
+    const {
+
+    const unsigned int n_seeds = m_copy.get_size(seeds_buffer);
+    if ((m_cfg.max_num_seeds == 0) || (n_seeds <= m_cfg.max_num_seeds)) {
+        return {};
+    }
+
+    // Keep the first seeds, so that the result is deterministic.
+    m_budget_status.seeds_truncated = true;
+    bound_track_parameters_collection_types::buffer result(
+        m_cfg.max_num_seeds, m_mr.event_memory());
+    CUDA_ERROR_CHECK(cudaMemcpyAsync(
+        result.ptr(), seeds_buffer.ptr(),
+        m_cfg.max_num_seeds * sizeof(bound_track_parameters),
+        cudaMemcpyDeviceToDevice, details::get_stream(m_stream)));
+    return result;
+}
+
+template <typename stepper_t, typename navigator_t, typename precise_scalar_t>
 track_candidate_container_types::buffer
-finding_algorithm<stepper_t, navigator_t>::operator()(
+finding_algorithm<stepper_t, navigator_t, precise_scalar_t>::find_tracks(
+    const typename detector_type::view_type& det_view,
+    const bfield_type& field_view,
+    const vecmem::data::jagged_vector_view<
+        typename navigator_t::intersection_type>& navigation_buffer,
+    const typename measurement_collection_types::view& measurements,
+    const bound_track_parameters_collection_types::buffer& seeds_buffer,
+    clock_type::time_point start) const {
+
+    // Get a convenience variable for the stream that we'll be using.
+    cudaStream_t stream = details::get_stream(m_stream);
+
+    // Run the step loop
+    const link_buffers link_bufs =
+        find_links(det_view, field_view, navigation_buffer, measurements,
+                   seeds_buffer, start);
+    const unsigned int n_tips_total = link_bufs.tips.size();
+
+    /*****************************************************************
+     * Kernel6: Build tracks
+     *****************************************************************/
+
+    // Create track candidate buffer
+    track_candidate_container_types::buffer track_candidates_buffer{
+        {n_tips_total, m_mr.event_memory()},
+        {std::vector<std::size_t>(n_tips_total,
+                                  m_cfg.max_track_candidates_per_track),
+         m_mr.event_memory(), m_mr.host, vecmem::data::buffer_type::resizable}};
+
+    m_copy.setup(track_candidates_buffer.headers);
+    m_copy.setup(track_candidates_buffer.items);
+
+    // @Note: nBlocks can be zero in case there is no tip. This happens when
+    // chi2_max config is set tightly and no tips are found
+    if (n_tips_total > 0) {
+        const unsigned int nThreads = details::threads_per_block(
+            m_stream, "build_tracks", kernels::build_tracks, WARP_SIZE * 2);
+        const unsigned int nBlocks = (n_tips_total + nThreads - 1) / nThreads;
+        details::kernel_timer build_tracks_timer(m_stream, "build_tracks",
+                                                 nBlocks, nThreads);
+        kernels::build_tracks<<<nBlocks, nThreads, 0, stream>>>(
+            measurements, seeds_buffer, link_bufs.links,
+            link_bufs.param_to_link, link_bufs.tips, track_candidates_buffer);
+        build_tracks_timer.stop();
+
+        CUDA_ERROR_CHECK(cudaGetLastError());
+    }
+    m_stream.synchronize();
+
+    return track_candidates_buffer;
+}
+
+template <typename stepper_t, typename navigator_t, typename precise_scalar_t>
+track_candidate_soa_collection_types::buffer
+finding_algorithm<stepper_t, navigator_t, precise_scalar_t>::find_flat(
     const typename detector_type::view_type& det_view,
     const bfield_type& field_view,
     const vecmem::data::jagged_vector_view<
@@ -173,18 +816,105 @@ finding_algorithm<stepper_t, navigator_t>::operator()(
 
     // Get a convenience variable for the stream that we'll be using.
     cudaStream_t stream = details::get_stream(m_stream);
+    // Thrust takes its temporary storage from the workspace.
+    details::thrust_allocator thrust_alloc(*m_workspace);
+
+    // Start the budgets of the event, and apply its seed budget.
+    m_budget_status = {};
+    const clock_type::time_point start = clock_type::now();
+    const bound_track_parameters_collection_types::buffer truncated_seeds =
+        truncate_seeds(seeds_buffer);
+    const bound_track_parameters_collection_types::buffer& seeds =
+        m_budget_status.seeds_truncated ? truncated_seeds : seeds_buffer;
+
+    // Run the step loop
+    const link_buffers link_bufs = find_links(
+        det_view, field_view, navigation_buffer, measurements, seeds, start);
+    const unsigned int n_tips_total = link_bufs.tips.size();
+
+    // The offsets of the tracks' candidates, from their lengths
+    vecmem::data::vector_buffer<unsigned int> offsets_buffer(n_tips_total + 1,
+                                                             *m_workspace);
+    vecmem::device_vector<unsigned int> offsets(offsets_buffer);
+    vecmem::device_vector<const typename candidate_link::link_index_type> tips(
+        link_bufs.tips);
+    thrust::fill(thrust::cuda::par_nosync(thrust_alloc).on(stream),
+                 offsets.begin(), offsets.begin() + 1, 0u);
+    thrust::transform(thrust::cuda::par_nosync(thrust_alloc).on(stream),
+                      tips.begin(), tips.end(), offsets.begin() + 1,
+                      tip_n_candidates{});
+    thrust::inclusive_scan(thrust::cuda::par_nosync(thrust_alloc).on(stream),
+                           offsets.begin() + 1, offsets.end(),
+                           offsets.begin() + 1);
+    unsigned int n_candidates_total = 0u;
+    CUDA_ERROR_CHECK(cudaMemcpyAsync(
+        &n_candidates_total, offsets_buffer.ptr() + n_tips_total,
+        sizeof(unsigned int), cudaMemcpyDeviceToHost, stream));
+    m_stream.synchronize();
+
+    /*****************************************************************
+     * Kernel6: Build tracks
+     *****************************************************************/
+
+    track_candidate_soa_collection_types::buffer track_candidates_buffer(
+        n_tips_total, n_candidates_total, m_mr.event_memory());
+    CUDA_ERROR_CHECK(cudaMemcpyAsync(
+        track_candidates_buffer.offsets.ptr(), offsets_buffer.ptr(),
+        (n_tips_total + 1) * sizeof(unsigned int), cudaMemcpyDeviceToDevice,
+        stream));
+
+    if (n_tips_total > 0) {
+        const unsigned int nThreads = details::threads_per_block(
+            m_stream, "build_flat_tracks", kernels::build_flat_tracks,
+            WARP_SIZE * 2);
+        const unsigned int nBlocks = (n_tips_total + nThreads - 1) / nThreads;
+        details::kernel_timer build_flat_tracks_timer(m_stream,
+                                                      "build_flat_tracks",
+                                                      nBlocks, nThreads);
+        kernels::build_flat_tracks<<<nBlocks, nThreads, 0, stream>>>(
+            seeds, link_bufs.links, link_bufs.param_to_link,
+            link_bufs.tips, get_data(track_candidates_buffer));
+        build_flat_tracks_timer.stop();
+
+        CUDA_ERROR_CHECK(cudaGetLastError());
+    }
+    m_stream.synchronize();
+
+    return track_candidates_buffer;
+}
+
+template <typename stepper_t, typename navigator_t, typename precise_scalar_t>
+auto finding_algorithm<stepper_t, navigator_t, precise_scalar_t>::find_links(
+    const typename detector_type::view_type& det_view,
+    const bfield_type& field_view,
+    const vecmem::data::jagged_vector_view<
+        typename navigator_t::intersection_type>& navigation_buffer,
+    const typename measurement_collection_types::view& measurements,
+    const bound_track_parameters_collection_types::buffer& seeds_buffer,
+    clock_type::time_point start) const -> link_buffers {
+
+    // Get a convenience variable for the stream that we'll be using.
+    cudaStream_t stream = details::get_stream(m_stream);
+
+    // All temporary buffers are created in the workspace. The buffers of the
+    // previous event are no longer in use, as the algorithm synchronises
+    // with the stream before returning.
+    m_workspace->reset();
+    vecmem::memory_resource& ws_mr = *m_workspace;
+    // Thrust takes its temporary storage from the workspace as well.
+    details::thrust_allocator thrust_alloc(ws_mr);
 
     // Copy setup
     m_copy.setup(seeds_buffer);
     m_copy.setup(navigation_buffer);
 
     // Prepare input parameters with seeds
-    bound_track_parameters_collection_types::buffer in_params_buffer(
-        m_copy.get_size(seeds_buffer), m_mr.main);
-    bound_track_parameters_collection_types::device in_params(in_params_buffer);
+    step_parameters_collection_types::buffer in_params_buffer(
+        m_copy.get_size(seeds_buffer), ws_mr);
+    step_parameters_collection_types::device in_params(in_params_buffer);
     bound_track_parameters_collection_types::device seeds(seeds_buffer);
-    thrust::copy(thrust::cuda::par.on(stream), seeds.begin(), seeds.end(),
-                 in_params.begin());
+    thrust::copy(thrust::cuda::par(thrust_alloc).on(stream), seeds.begin(),
+                 seeds.end(), in_params.begin());
 
     // Create a map for links
     std::map<unsigned int, vecmem::data::vector_buffer<candidate_link>>
@@ -209,8 +939,7 @@ finding_algorithm<stepper_t, navigator_t>::operator()(
     // Global counter object in Device memory
     vecmem::unique_alloc_ptr<device::finding_global_counter>
         global_counter_device =
-            vecmem::make_unique_alloc<device::finding_global_counter>(
-                m_mr.main);
+            vecmem::make_unique_alloc<device::finding_global_counter>(ws_mr);
 
     // Global counter object in Host memory
     device::finding_global_counter global_counter_host;
@@ -219,210 +948,623 @@ finding_algorithm<stepper_t, navigator_t>::operator()(
      * Measurement Operations
      *****************************************************************/
 
-    measurement_collection_types::const_device measurements_device(
-        measurements);
-
-    // Get copy of barcode uniques
-    measurement_collection_types::buffer uniques_buffer{
-        measurements_device.size(), m_mr.main};
-    measurement_collection_types::device uniques(uniques_buffer);
-
-    measurement* end = thrust::unique_copy(
-        thrust::cuda::par.on(stream), measurements_device.begin(),
-        measurements_device.end(), uniques.begin(), measurement_equal_comp());
-    unsigned int n_modules = end - uniques.begin();
-
-    // Get upper bounds of unique elements
-    vecmem::data::vector_buffer<unsigned int> upper_bounds_buffer{n_modules,
-                                                                  m_mr.main};
-    vecmem::device_vector<unsigned int> upper_bounds(upper_bounds_buffer);
-
-    thrust::upper_bound(thrust::cuda::par.on(stream),
-                        measurements_device.begin(), measurements_device.end(),
-                        uniques.begin(), uniques.begin() + n_modules,
-                        upper_bounds.begin(), measurement_sort_comp());
-
-    /*****************************************************************
-     * Kernel1: Create barcode sequence
-     *****************************************************************/
-
-    vecmem::data::vector_buffer<detray::geometry::barcode> barcodes_buffer{
-        n_modules, m_mr.main};
+    // Build the per-surface segment table of the (sorted) measurements.
+    const measurement_range_collection_types::buffer ranges_buffer =
+        measurement_segmentation_algorithm{{ws_mr, m_mr.host}, m_copy,
+                                           m_stream}(measurements);
 
+    // Launch parameters of the kernels
     unsigned int nThreads = WARP_SIZE * 2;
-    unsigned int nBlocks = (barcodes_buffer.size() + nThreads - 1) / nThreads;
-
-    kernels::make_barcode_sequence<<<nBlocks, nThreads, 0, stream>>>(
-        uniques_buffer, barcodes_buffer);
-
-    CUDA_ERROR_CHECK(cudaGetLastError());
-
-    for (unsigned int step = 0; step < m_cfg.max_track_candidates_per_track;
-         step++) {
-
-        // Global counter object: Device -> Host
-        CUDA_ERROR_CHECK(cudaMemcpyAsync(&global_counter_host,
-                                         global_counter_device.get(),
-                                         sizeof(device::finding_global_counter),
-                                         cudaMemcpyDeviceToHost, stream));
-
-        m_stream.synchronize();
-
-        // Set the number of input parameters
-        const unsigned int n_in_params = (step == 0)
-                                             ? in_params_buffer.size()
-                                             : global_counter_host.n_out_params;
-
-        // Terminate if there is no parameter to process.
-        if (n_in_params == 0) {
-            break;
-        }
+    unsigned int nBlocks = 0;
 
-        // Reset the global counter
-        CUDA_ERROR_CHECK(cudaMemsetAsync(global_counter_device.get(), 0,
-                                         sizeof(device::finding_global_counter),
-                                         stream));
+    // Number of tips per step
+    std::vector<unsigned int> n_tips_per_step;
+    n_tips_per_step.reserve(m_cfg.max_track_candidates_per_track);
 
-        /*****************************************************************
-         * Kernel2: Apply material interaction
-         ****************************************************************/
-
-        nThreads = WARP_SIZE * 2;
-        nBlocks = (n_in_params + nThreads - 1) / nThreads;
-        kernels::apply_interaction<detector_type>
-            <<<nBlocks, nThreads, 0, stream>>>(det_view, navigation_buffer,
-                                               n_in_params, in_params_buffer);
-        CUDA_ERROR_CHECK(cudaGetLastError());
+    if (m_cfg.run_step_loop_on_device) {
 
         /*****************************************************************
-         * Kernel3: Count the number of measurements per parameter
-         ****************************************************************/
+         * Step loop without host synchronisation
+         *****************************************************************/
 
+        const unsigned int n_seeds = m_copy.get_size(seeds_buffer);
+        const unsigned int n_max_params =
+            n_seeds * m_cfg.max_num_branches_per_seed;
+        const unsigned int n_steps_max = m_cfg.max_track_candidates_per_track;
+
+        // One set of counters per step. The counter of step i describes the
+        // output of step i-1, and the input of step i. The input of the
+        // first step is the seeds.
+        vecmem::data::vector_buffer<device::finding_global_counter>
+            counters_buffer(n_steps_max + 1, ws_mr);
+        CUDA_ERROR_CHECK(cudaMemsetAsync(
+            counters_buffer.ptr(), 0,
+            (n_steps_max + 1) * sizeof(device::finding_global_counter),
+            stream));
+        device::finding_global_counter seed_counter{0, 0, n_seeds};
+        CUDA_ERROR_CHECK(cudaMemcpyAsync(
+            counters_buffer.ptr(), &seed_counter,
+            sizeof(device::finding_global_counter), cudaMemcpyHostToDevice,
+            stream));
+
+        // Buffers re-used by every step, with their worst-case sizes
+        step_parameters_collection_types::buffer step_params_buffers[] =
+            {{n_max_params, ws_mr}, {n_max_params, ws_mr}};
+        step_parameters_collection_types::buffer updated_params_buffer(
+            n_max_params, ws_mr);
         vecmem::data::vector_buffer<unsigned int> n_measurements_buffer(
-            n_in_params, m_mr.main);
-
-        // Create a buffer for the first measurement index of parameter
+            n_max_params, ws_mr);
         vecmem::data::vector_buffer<unsigned int> ref_meas_idx_buffer(
-            n_in_params, m_mr.main);
-
-        nThreads = WARP_SIZE * 2;
-        nBlocks = (n_in_params + nThreads - 1) / nThreads;
-        kernels::count_measurements<<<nBlocks, nThreads, 0, stream>>>(
-            in_params_buffer, barcodes_buffer, upper_bounds_buffer, n_in_params,
-            n_measurements_buffer, ref_meas_idx_buffer,
-            (*global_counter_device).n_measurements_sum);
-        CUDA_ERROR_CHECK(cudaGetLastError());
-
-        // Global counter object: Device -> Host
-        CUDA_ERROR_CHECK(cudaMemcpyAsync(&global_counter_host,
-                                         global_counter_device.get(),
-                                         sizeof(device::finding_global_counter),
-                                         cudaMemcpyDeviceToHost, stream));
-
-        m_stream.synchronize();
-
-        // Create the buffer for the prefix sum of the number of measurements
-        // per parameter
-        vecmem::device_vector<unsigned int> n_measurements(
-            n_measurements_buffer);
+            n_max_params, ws_mr);
         vecmem::data::vector_buffer<unsigned int>
-            n_measurements_prefix_sum_buffer(n_in_params, m_mr.main);
-        vecmem::device_vector<unsigned int> n_measurements_prefix_sum(
-            n_measurements_prefix_sum_buffer);
-        thrust::inclusive_scan(thrust::cuda::par.on(stream),
-                               n_measurements.begin(), n_measurements.end(),
-                               n_measurements_prefix_sum.begin());
-
-        /*****************************************************************
-         * Kernel4: Find valid tracks
-         *****************************************************************/
+            n_measurements_prefix_sum_buffer(n_max_params, ws_mr);
+        // The states of the prefix sums, for the largest number of blocks
+        vecmem::data::vector_buffer<unsigned long long> scan_states_buffer(
+            details::decoupled_lookback_scan::state_size(std::max(
+                1u, (n_max_params + WARP_SIZE * 2 - 1) / (WARP_SIZE * 2))),
+            ws_mr);
+
+        step_parameters_collection_types::device step_params_0(
+            step_params_buffers[0]);
+        thrust::copy(thrust::cuda::par_nosync(thrust_alloc).on(stream),
+                     seeds.begin(), seeds.end(), step_params_0.begin());
+
+        // The sizes of the tip buffers, collected in device memory
+        vecmem::data::vector_buffer<unsigned int> n_tips_buffer(n_steps_max,
+                                                                ws_mr);
+
+        // Upper limit on the number of parameters going into a step
+        unsigned int n_step_capacity = n_seeds;
+
+        for (unsigned int step = 0; step < n_steps_max; step++) {
+
+            const device::finding_global_counter& in_counter =
+                *(counters_buffer.ptr() + step);
+            device::finding_global_counter& out_counter =
+                *(counters_buffer.ptr() + step + 1);
+
+            auto& in_buffer = step_params_buffers[step % 2];
+            auto& out_buffer = step_params_buffers[(step + 1) % 2];
+
+            // Upper limit on the number of candidates found in this step
+            const unsigned int n_candidate_capacity =
+                static_cast<unsigned int>(std::min(
+                    static_cast<std::size_t>(n_step_capacity) *
+                        m_cfg.max_num_branches_per_surface,
+                    static_cast<std::size_t>(n_max_params)));
+
+            nThreads = WARP_SIZE * 2;
+            const unsigned int nParamBlocks =
+                std::max(1u, (n_step_capacity + nThreads - 1) / nThreads);
+            const unsigned int nCandidateBlocks =
+                std::max(1u, (n_candidate_capacity + nThreads - 1) / nThreads);
+
+            // Kernel2+3: Apply material interaction, count the number of
+            // measurements per parameter, and produce their prefix sum, in
+            // one pass over the parameters. The entries beyond the number of
+            // input parameters get zero measurements, so the last element of
+            // the prefix sum holds the total number of measurements.
+            CUDA_ERROR_CHECK(cudaMemsetAsync(
+                scan_states_buffer.ptr(), 0,
+                details::decoupled_lookback_scan::state_size(nParamBlocks) *
+                    sizeof(unsigned long long),
+                stream));
+            details::kernel_timer interact_and_count_on_device_timer(
+                m_stream, "interact_and_count_measurements_on_device",
+                nParamBlocks, nThreads);
+            kernels::interact_and_count_measurements_on_device<detector_type>
+                <<<nParamBlocks, nThreads, 0, stream>>>(
+                    det_view, in_buffer, ranges_buffer, in_counter,
+                    n_measurements_buffer, ref_meas_idx_buffer,
+                    vecmem::data::vector_view<unsigned int>{
+                        n_step_capacity,
+                        n_measurements_prefix_sum_buffer.ptr()},
+                    scan_states_buffer.ptr(), out_counter);
+            interact_and_count_on_device_timer.stop();
+            CUDA_ERROR_CHECK(cudaGetLastError());
 
-        // Buffer for kalman-updated parameters spawned by the measurement
-        // candidates
-        const unsigned int n_max_candidates =
-            std::min(n_in_params * m_cfg.max_num_branches_per_surface,
-                     seeds.size() * m_cfg.max_num_branches_per_seed);
-
-        bound_track_parameters_collection_types::buffer updated_params_buffer(
-            n_in_params * m_cfg.max_num_branches_per_surface, m_mr.main);
-
-        // Create the link map
-        link_map[step] = {n_in_params * m_cfg.max_num_branches_per_surface,
-                          m_mr.main};
-        m_copy.setup(link_map[step]);
-        nBlocks = (global_counter_host.n_measurements_sum +
-                   nThreads * m_cfg.n_measurements_per_thread - 1) /
-                  (nThreads * m_cfg.n_measurements_per_thread);
-
-        if (nBlocks > 0) {
-            kernels::find_tracks<detector_type, config_type>
-                <<<nBlocks, nThreads, 0, stream>>>(
-                    m_cfg, det_view, measurements, in_params_buffer,
-                    n_measurements_prefix_sum_buffer, ref_meas_idx_buffer, step,
-                    n_max_candidates, updated_params_buffer, link_map[step],
-                    (*global_counter_device).n_candidates);
+            vecmem::data::vector_view<const unsigned int> prefix_sum_view{
+                n_step_capacity, n_measurements_prefix_sum_buffer.ptr()};
+
+            // Kernel4: Find valid tracks
+            link_map[step] = {n_candidate_capacity, ws_mr};
+            if (m_cfg.branching == branching_policy::e_best_chi2) {
+                details::kernel_timer find_best_tracks_on_device_timer(
+                    m_stream, "find_best_tracks_on_device", nParamBlocks,
+                    nThreads);
+                kernels::find_best_tracks_on_device<detector_type, config_type>
+                    <<<nParamBlocks, nThreads, 0, stream>>>(
+                        m_cfg, det_view, measurements, in_buffer,
+                        n_measurements_buffer, ref_meas_idx_buffer, step,
+                        n_seeds, in_counter, updated_params_buffer,
+                        link_map[step], out_counter);
+                find_best_tracks_on_device_timer.stop();
+            } else {
+                details::kernel_timer find_tracks_on_device_timer(
+                    m_stream, "find_tracks_on_device", nCandidateBlocks,
+                    nThreads);
+                kernels::find_tracks_on_device<detector_type, config_type>
+                    <<<nCandidateBlocks, nThreads, 0, stream>>>(
+                        m_cfg, det_view, measurements, in_buffer,
+                        prefix_sum_view, ref_meas_idx_buffer, step, n_seeds,
+                        in_counter, updated_params_buffer, link_map[step],
+                        out_counter);
+                find_tracks_on_device_timer.stop();
+            }
             CUDA_ERROR_CHECK(cudaGetLastError());
-        }
 
-        // Global counter object: Device -> Host
-        CUDA_ERROR_CHECK(cudaMemcpyAsync(&global_counter_host,
-                                         global_counter_device.get(),
-                                         sizeof(device::finding_global_counter),
-                                         cudaMemcpyDeviceToHost, stream));
+            // Kernel5: Propagate to the next surface
+            param_to_link_map[step] = {n_candidate_capacity, ws_mr};
+            tips_map[step] = {n_candidate_capacity, ws_mr,
+                              vecmem::data::buffer_type::resizable};
+            m_copy.setup(tips_map[step]);
+            const auto nav_grid = details::make_navigation_grid(
+                navigation_buffer, n_candidate_capacity, nThreads);
+            details::kernel_timer propagate_to_next_surface_on_device_timer(
+                m_stream, "propagate_to_next_surface_on_device",
+                std::max(1u, nav_grid.n_blocks), nThreads);
+            kernels::propagate_to_next_surface_on_device<
+                propagator_type, bfield_type, config_type>
+                <<<std::max(1u, nav_grid.n_blocks), nThreads, 0, stream>>>(
+                    m_cfg, det_view, field_view, nav_grid.candidates,
+                    updated_params_buffer, link_map[step], step, out_counter,
+                    out_buffer, param_to_link_map[step], tips_map[step]);
+            propagate_to_next_surface_on_device_timer.stop();
+            CUDA_ERROR_CHECK(cudaGetLastError());
 
-        m_stream.synchronize();
+            CUDA_ERROR_CHECK(cudaMemcpyAsync(
+                n_tips_buffer.ptr() + step, tips_map[step].size_ptr(),
+                sizeof(unsigned int), cudaMemcpyDeviceToDevice, stream));
 
-        /*****************************************************************
-         * Kernel5: Propagate to the next surface
-         *****************************************************************/
-
-        // Buffer for out parameters for the next step
-        bound_track_parameters_collection_types::buffer out_params_buffer(
-            global_counter_host.n_candidates, m_mr.main);
+            n_step_capacity = n_candidate_capacity;
+        }
 
-        // Create the param to link ID map
-        param_to_link_map[step] = {global_counter_host.n_candidates, m_mr.main};
-        m_copy.setup(param_to_link_map[step]);
+        // Global counter objects: Device -> Host
+        std::vector<device::finding_global_counter> counters_host(
+            n_steps_max + 1);
+        CUDA_ERROR_CHECK(cudaMemcpyAsync(
+            counters_host.data(), counters_buffer.ptr(),
+            (n_steps_max + 1) * sizeof(device::finding_global_counter),
+            cudaMemcpyDeviceToHost, stream));
+        std::vector<unsigned int> n_tips_host(n_steps_max);
+        CUDA_ERROR_CHECK(cudaMemcpyAsync(
+            n_tips_host.data(), n_tips_buffer.ptr(),
+            n_steps_max * sizeof(unsigned int), cudaMemcpyDeviceToHost,
+            stream));
 
-        // Create the tip map
-        tips_map[step] = {global_counter_host.n_candidates, m_mr.main,
-                          vecmem::data::buffer_type::resizable};
-        m_copy.setup(tips_map[step]);
+        m_stream.synchronize();
 
-        nThreads = WARP_SIZE * 2;
+        // Collect the sizes of the steps that had any input parameters
+        for (unsigned int step = 0;
+             step < n_steps_max && counters_host[step].n_out_params > 0;
+             step++) {
+            n_candidates_per_step.push_back(
+                counters_host[step + 1].n_candidates);
+            n_parameters_per_step.push_back(
+                counters_host[step + 1].n_out_params);
+            n_tips_per_step.push_back(n_tips_host[step]);
+        }
+    } else {
+
+        // Seed indices of the input parameters of the steps, for the shared
+        // hit pruning, and of the candidates of the steps.
+        vecmem::data::vector_buffer<unsigned int> param_seeds_buffer;
+        vecmem::data::vector_buffer<unsigned int> cand_seeds_buffer;
+        if (m_cfg.prune_shared_hits) {
+            param_seeds_buffer = {in_params_buffer.size(), ws_mr};
+            m_copy.setup(param_seeds_buffer);
+            thrust::sequence(thrust::cuda::par_nosync(thrust_alloc).on(stream),
+                             param_seeds_buffer.ptr(),
+                             param_seeds_buffer.ptr() +
+                                 in_params_buffer.size());
+        }
 
-        if (global_counter_host.n_candidates > 0) {
-            nBlocks =
-                (global_counter_host.n_candidates + nThreads - 1) / nThreads;
-            kernels::propagate_to_next_surface<propagator_type, bfield_type,
-                                               config_type>
+        // Configuration of the steps after exceeding the branch budget
+        config_type degraded_cfg = m_cfg;
+        degraded_cfg.max_num_branches_per_surface = 1u;
+        degraded_cfg.chi2_max *= m_cfg.degraded_chi2_scale;
+        bool degraded = false;
+
+        for (unsigned int step = 0; step < m_cfg.max_track_candidates_per_track;
+             step++) {
+
+            // Global counter object: Device -> Host
+            CUDA_ERROR_CHECK(cudaMemcpyAsync(
+                &global_counter_host, global_counter_device.get(),
+                sizeof(device::finding_global_counter), cudaMemcpyDeviceToHost,
+                stream));
+
+            m_stream.synchronize();
+
+            // Set the number of input parameters
+            const unsigned int n_in_params =
+                (step == 0) ? in_params_buffer.size()
+                            : global_counter_host.n_out_params;
+
+            // Terminate if there is no parameter to process.
+            if (n_in_params == 0) {
+                break;
+            }
+
+            // Reset the global counter
+            CUDA_ERROR_CHECK(cudaMemsetAsync(
+                global_counter_device.get(), 0,
+                sizeof(device::finding_global_counter), stream));
+
+            /*****************************************************************
+             * Kernel2+3: Apply material interaction, and count the number of
+             * measurements per parameter
+             ****************************************************************/
+
+            vecmem::data::vector_buffer<unsigned int> n_measurements_buffer(
+                n_in_params, ws_mr);
+
+            // Create a buffer for the first measurement index of parameter
+            vecmem::data::vector_buffer<unsigned int> ref_meas_idx_buffer(
+                n_in_params, ws_mr);
+
+            // Create the buffer for the prefix sum of the number of
+            // measurements per parameter
+            vecmem::data::vector_buffer<unsigned int>
+                n_measurements_prefix_sum_buffer(n_in_params, ws_mr);
+
+            // The kernel produces the prefix sum in the same pass, with whole
+            // warps in every block.
+            nThreads = details::threads_per_block(
+                m_stream, "interact_and_count_measurements",
+                kernels::interact_and_count_measurements<detector_type>,
+                WARP_SIZE * 2);
+            nThreads = std::max(nThreads / WARP_SIZE, 1u) * WARP_SIZE;
+            nBlocks = (n_in_params + nThreads - 1) / nThreads;
+
+            // The states of the prefix sum
+            vecmem::data::vector_buffer<unsigned long long> scan_states_buffer(
+                details::decoupled_lookback_scan::state_size(nBlocks), ws_mr);
+            CUDA_ERROR_CHECK(cudaMemsetAsync(
+                scan_states_buffer.ptr(), 0,
+                details::decoupled_lookback_scan::state_size(nBlocks) *
+                    sizeof(unsigned long long),
+                stream));
+
+            details::kernel_timer interact_and_count_timer(
+                m_stream, "interact_and_count_measurements", nBlocks,
+                nThreads);
+            kernels::interact_and_count_measurements<detector_type>
                 <<<nBlocks, nThreads, 0, stream>>>(
-                    m_cfg, det_view, field_view, navigation_buffer,
-                    updated_params_buffer, link_map[step], step,
-                    (*global_counter_device).n_candidates, out_params_buffer,
-                    param_to_link_map[step], tips_map[step],
-                    (*global_counter_device).n_out_params);
+                    det_view, in_params_buffer, ranges_buffer, n_in_params,
+                    n_measurements_buffer, ref_meas_idx_buffer,
+                    n_measurements_prefix_sum_buffer, scan_states_buffer.ptr(),
+                    (*global_counter_device).n_measurements_sum);
+            interact_and_count_timer.stop();
             CUDA_ERROR_CHECK(cudaGetLastError());
-        }
-
-        CUDA_ERROR_CHECK(cudaMemcpyAsync(&global_counter_host,
-                                         global_counter_device.get(),
-                                         sizeof(device::finding_global_counter),
-                                         cudaMemcpyDeviceToHost, stream));
-
-        m_stream.synchronize();
 
-        // Fill the candidate size vector
-        n_candidates_per_step.push_back(global_counter_host.n_candidates);
-        n_parameters_per_step.push_back(global_counter_host.n_out_params);
+            // Global counter object: Device -> Host
+            CUDA_ERROR_CHECK(cudaMemcpyAsync(
+                &global_counter_host, global_counter_device.get(),
+                sizeof(device::finding_global_counter), cudaMemcpyDeviceToHost,
+                stream));
+
+            m_stream.synchronize();
+
+            /*****************************************************************
+             * Kernel4: Find valid tracks
+             *****************************************************************/
+
+            // Buffer for kalman-updated parameters spawned by the measurement
+            // candidates
+            const unsigned int n_max_candidates =
+                std::min(n_in_params * m_cfg.max_num_branches_per_surface,
+                         seeds.size() * m_cfg.max_num_branches_per_seed);
+
+            step_parameters_collection_types::buffer
+                updated_params_buffer(
+                    n_in_params * m_cfg.max_num_branches_per_surface, ws_mr);
+
+            // Create the link map
+            link_map[step] = {n_in_params * m_cfg.max_num_branches_per_surface,
+                              ws_mr};
+            m_copy.setup(link_map[step]);
+            nBlocks = (global_counter_host.n_measurements_sum +
+                       nThreads * m_cfg.n_measurements_per_thread - 1) /
+                      (nThreads * m_cfg.n_measurements_per_thread);
+
+            // The configuration of the measurement search of the step
+            const config_type& step_cfg = degraded ? degraded_cfg : m_cfg;
+
+            // Use a whole warp per parameter if the parameters have many
+            // measurements on average
+            const bool warp_finding =
+                (m_cfg.min_measurements_for_warp_finding > 0u) &&
+                (global_counter_host.n_measurements_sum >=
+                 static_cast<std::size_t>(n_in_params) *
+                     m_cfg.min_measurements_for_warp_finding);
+
+            if (m_cfg.branching == branching_policy::e_best_chi2) {
+                nBlocks = (n_in_params + nThreads - 1) / nThreads;
+                details::kernel_timer find_best_tracks_timer(m_stream,
+                                                             "find_best_tracks",
+                                                             nBlocks, nThreads);
+                kernels::find_best_tracks<detector_type, config_type>
+                    <<<nBlocks, nThreads, 0, stream>>>(
+                        step_cfg, det_view, measurements, in_params_buffer,
+                        n_measurements_buffer, ref_meas_idx_buffer, step,
+                        n_in_params, n_max_candidates, updated_params_buffer,
+                        link_map[step], (*global_counter_device).n_candidates);
+                find_best_tracks_timer.stop();
+                CUDA_ERROR_CHECK(cudaGetLastError());
+            } else if (warp_finding) {
+                nBlocks = (n_in_params + warps_per_block - 1) / warps_per_block;
+                details::kernel_timer find_tracks_per_warp_timer(
+                    m_stream, "find_tracks_per_warp", nBlocks,
+                    warps_per_block * WARP_SIZE);
+                kernels::find_tracks_per_warp<detector_type, config_type>
+                    <<<nBlocks, warps_per_block * WARP_SIZE, 0, stream>>>(
+                        step_cfg, det_view, measurements, in_params_buffer,
+                        n_measurements_buffer, ref_meas_idx_buffer, step,
+                        n_in_params, n_max_candidates, updated_params_buffer,
+                        link_map[step], (*global_counter_device).n_candidates);
+                find_tracks_per_warp_timer.stop();
+                CUDA_ERROR_CHECK(cudaGetLastError());
+            } else if (nBlocks > 0) {
+                details::kernel_timer find_tracks_timer(m_stream, "find_tracks",
+                                                        nBlocks, nThreads);
+                kernels::find_tracks<detector_type, config_type>
+                    <<<nBlocks, nThreads, 0, stream>>>(
+                        step_cfg, det_view, measurements, in_params_buffer,
+                        n_measurements_prefix_sum_buffer, ref_meas_idx_buffer,
+                        step, n_max_candidates, updated_params_buffer,
+                        link_map[step], (*global_counter_device).n_candidates);
+                find_tracks_timer.stop();
+                CUDA_ERROR_CHECK(cudaGetLastError());
+            }
+
+            // Global counter object: Device -> Host
+            CUDA_ERROR_CHECK(cudaMemcpyAsync(
+                &global_counter_host, global_counter_device.get(),
+                sizeof(device::finding_global_counter), cudaMemcpyDeviceToHost,
+                stream));
+
+            m_stream.synchronize();
+
+            /*****************************************************************
+             * Kernel4b: Prune the branches sharing their measurements
+             *****************************************************************/
+
+            if (m_cfg.prune_shared_hits &&
+                (global_counter_host.n_candidates > 0)) {
+
+                const unsigned int n_candidates =
+                    global_counter_host.n_candidates;
+
+                // The hash table, kept at most half full.
+                unsigned int n_slots = 1u;
+                while (n_slots < 2u * n_candidates) {
+                    n_slots *= 2u;
+                }
+                vecmem::data::vector_buffer<unsigned int> slots_buffer(n_slots,
+                                                                       ws_mr);
+                vecmem::data::vector_buffer<unsigned int> best_chi2_buffer(
+                    n_slots, ws_mr);
+                vecmem::data::vector_buffer<unsigned int> winners_buffer(
+                    n_slots, ws_mr);
+                m_copy.setup(slots_buffer);
+                m_copy.setup(best_chi2_buffer);
+                m_copy.setup(winners_buffer);
+                m_copy.memset(slots_buffer, 0);
+                m_copy.memset(best_chi2_buffer, 0xff);
+                m_copy.memset(winners_buffer, 0xff);
+
+                // Per-candidate buffers.
+                vecmem::data::vector_buffer<unsigned int> cand_slots_buffer(
+                    n_candidates, ws_mr);
+                vecmem::data::vector_buffer<unsigned int> cand_chi2_buffer(
+                    n_candidates, ws_mr);
+                vecmem::data::vector_buffer<unsigned int> all_seeds_buffer(
+                    n_candidates, ws_mr);
+                vecmem::data::vector_buffer<unsigned int> pruned_buffer(
+                    n_candidates, ws_mr);
+                m_copy.setup(cand_slots_buffer);
+                m_copy.setup(cand_chi2_buffer);
+                m_copy.setup(all_seeds_buffer);
+                m_copy.setup(pruned_buffer);
+
+                nThreads = WARP_SIZE * 2;
+                nBlocks = (n_candidates + nThreads - 1) / nThreads;
+                details::kernel_timer prune_shared_hits_timer(
+                    m_stream, "prune_shared_hits", nBlocks, nThreads);
+                kernels::insert_shared_hits<detector_type, config_type>
+                    <<<nBlocks, nThreads, 0, stream>>>(
+                        m_cfg, det_view, measurements, in_params_buffer,
+                        param_seeds_buffer, link_map[step], n_candidates,
+                        slots_buffer, best_chi2_buffer, cand_slots_buffer,
+                        cand_chi2_buffer, all_seeds_buffer);
+                CUDA_ERROR_CHECK(cudaGetLastError());
+                kernels::elect_shared_hits<<<nBlocks, nThreads, 0, stream>>>(
+                    n_candidates, best_chi2_buffer, cand_slots_buffer,
+                    cand_chi2_buffer, winners_buffer);
+                CUDA_ERROR_CHECK(cudaGetLastError());
+                kernels::prune_shared_hits<config_type>
+                    <<<nBlocks, nThreads, 0, stream>>>(
+                        m_cfg, n_candidates, updated_params_buffer,
+                        cand_slots_buffer, winners_buffer, pruned_buffer);
+                prune_shared_hits_timer.stop();
+                CUDA_ERROR_CHECK(cudaGetLastError());
+
+                // Compact the kept candidates, their links and their seeds.
+                vecmem::data::vector_buffer<candidate_link> kept_links_buffer(
+                    link_map[step].size(), ws_mr);
+                step_parameters_collection_types::buffer
+                    kept_params_buffer(updated_params_buffer.size(), ws_mr);
+                cand_seeds_buffer = {n_candidates, ws_mr};
+                m_copy.setup(kept_links_buffer);
+                m_copy.setup(kept_params_buffer);
+                m_copy.setup(cand_seeds_buffer);
+                thrust::copy_if(
+                    thrust::cuda::par_nosync(thrust_alloc).on(stream),
+                    link_map[step].ptr(), link_map[step].ptr() + n_candidates,
+                    pruned_buffer.ptr(), kept_links_buffer.ptr(),
+                    is_not_pruned{});
+                thrust::copy_if(
+                    thrust::cuda::par_nosync(thrust_alloc).on(stream),
+                    updated_params_buffer.ptr(),
+                    updated_params_buffer.ptr() + n_candidates,
+                    pruned_buffer.ptr(), kept_params_buffer.ptr(),
+                    is_not_pruned{});
+                const unsigned int* kept_seeds_end = thrust::copy_if(
+                    thrust::cuda::par(thrust_alloc).on(stream),
+                    all_seeds_buffer.ptr(),
+                    all_seeds_buffer.ptr() + n_candidates, pruned_buffer.ptr(),
+                    cand_seeds_buffer.ptr(), is_not_pruned{});
+                link_map[step] = std::move(kept_links_buffer);
+                updated_params_buffer = std::move(kept_params_buffer);
+
+                // Update the number of candidates, on the host and on the
+                // device.
+                global_counter_host.n_candidates = static_cast<unsigned int>(
+                    kept_seeds_end - cand_seeds_buffer.ptr());
+                CUDA_ERROR_CHECK(cudaMemcpyAsync(
+                    &((*global_counter_device).n_candidates),
+                    &(global_counter_host.n_candidates), sizeof(unsigned int),
+                    cudaMemcpyHostToDevice, stream));
+                m_stream.synchronize();
+            }
+
+            /*****************************************************************
+             * Check the budgets of the event
+             *****************************************************************/
+
+            // Stop branching in the following steps, if too many branches
+            // are in flight.
+            if ((m_cfg.max_num_branches_in_flight > 0) &&
+                (global_counter_host.n_candidates >
+                 m_cfg.max_num_branches_in_flight)) {
+                degraded = true;
+                m_budget_status.branches_limited = true;
+            }
+
+            // Turn the branches of the step into track candidates, instead of
+            // propagating them any further, if the event took too long.
+            if ((m_cfg.max_event_time_ms > 0) &&
+                (clock_type::now() - start >
+                 std::chrono::milliseconds(m_cfg.max_event_time_ms))) {
+                m_budget_status.deadline_exceeded = true;
+                const unsigned int n_tips =
+                    (step + 1 >= m_cfg.min_track_candidates_per_track)
+                        ? global_counter_host.n_candidates
+                        : 0u;
+                tips_map[step] = {n_tips, ws_mr};
+                m_copy.setup(tips_map[step]);
+                thrust::transform(
+                    thrust::cuda::par(thrust_alloc).on(stream),
+                    thrust::counting_iterator<unsigned int>(0u),
+                    thrust::counting_iterator<unsigned int>(n_tips),
+                    tips_map[step].ptr(), make_tip_link{step});
+                n_candidates_per_step.push_back(
+                    global_counter_host.n_candidates);
+                n_parameters_per_step.push_back(0u);
+                break;
+            }
+
+            /*****************************************************************
+             * Kernel5: Propagate to the next surface
+             *****************************************************************/
+
+            // Buffer for out parameters for the next step
+            step_parameters_collection_types::buffer out_params_buffer(
+                global_counter_host.n_candidates, ws_mr);
+
+            // Create the param to link ID map
+            param_to_link_map[step] = {global_counter_host.n_candidates, ws_mr};
+            m_copy.setup(param_to_link_map[step]);
+
+            // Create the tip map
+            tips_map[step] = {global_counter_host.n_candidates, ws_mr,
+                              vecmem::data::buffer_type::resizable};
+            m_copy.setup(tips_map[step]);
+
+            nThreads = details::threads_per_block(
+                m_stream, "propagate_to_next_surface",
+                kernels::propagate_to_next_surface<propagator_type,
+                                                   bfield_type, config_type>,
+                WARP_SIZE * 2);
+
+            if (global_counter_host.n_candidates > 0) {
+                const auto nav_grid = details::make_navigation_grid(
+                    navigation_buffer, global_counter_host.n_candidates,
+                    nThreads);
+                details::kernel_timer propagate_to_next_surface_timer(
+                    m_stream, "propagate_to_next_surface", nav_grid.n_blocks,
+                    nThreads);
+                kernels::propagate_to_next_surface<propagator_type,
+                                                   bfield_type, config_type>
+                    <<<nav_grid.n_blocks, nThreads, 0, stream>>>(
+                        m_cfg, det_view, field_view, nav_grid.candidates,
+                        updated_params_buffer, link_map[step], step,
+                        (*global_counter_device).n_candidates,
+                        out_params_buffer, param_to_link_map[step],
+                        tips_map[step],
+                        (*global_counter_device).n_out_params);
+                propagate_to_next_surface_timer.stop();
+                CUDA_ERROR_CHECK(cudaGetLastError());
+            }
+
+            CUDA_ERROR_CHECK(cudaMemcpyAsync(
+                &global_counter_host, global_counter_device.get(),
+                sizeof(device::finding_global_counter), cudaMemcpyDeviceToHost,
+                stream));
+
+            m_stream.synchronize();
+
+            // Fill the candidate size vector
+            n_candidates_per_step.push_back(global_counter_host.n_candidates);
+            n_parameters_per_step.push_back(global_counter_host.n_out_params);
+
+            // Sort the parameters of the next step by surface, if there are
+            // enough of them
+            if ((m_cfg.min_params_for_surface_sort > 0) &&
+                (global_counter_host.n_out_params >=
+                 m_cfg.min_params_for_surface_sort)) {
+                sort_by_surface(out_params_buffer, param_to_link_map[step],
+                                global_counter_host.n_out_params, ws_mr,
+                                stream);
+            }
+
+            // Find the seeds of the parameters of the next step
+            if (m_cfg.prune_shared_hits) {
+                vecmem::data::vector_buffer<unsigned int> out_seeds_buffer(
+                    global_counter_host.n_out_params, ws_mr);
+                m_copy.setup(out_seeds_buffer);
+                if (global_counter_host.n_out_params > 0) {
+                    thrust::gather(thrust::cuda::par(thrust_alloc).on(stream),
+                                   param_to_link_map[step].ptr(),
+                                   param_to_link_map[step].ptr() +
+                                       global_counter_host.n_out_params,
+                                   cand_seeds_buffer.ptr(),
+                                   out_seeds_buffer.ptr());
+                }
+                param_seeds_buffer = std::move(out_seeds_buffer);
+            }
+
+            // Swap parameter buffer for the next step
+            in_params_buffer = std::move(out_params_buffer);
+        }
 
-        // Swap parameter buffer for the next step
-        in_params_buffer = std::move(out_params_buffer);
+        // Get the number of tips per step
+        for (unsigned int it = 0; it < n_candidates_per_step.size(); it++) {
+            n_tips_per_step.push_back(m_copy.get_size(tips_map[it]));
+        }
     }
 
+    // Record the number of branches of the steps
+    m_branch_histogram.n_candidates.assign(n_candidates_per_step.begin(),
+                                           n_candidates_per_step.end());
+    m_branch_histogram.n_active.assign(n_parameters_per_step.begin(),
+                                       n_parameters_per_step.end());
+    m_branch_histogram.n_tips = n_tips_per_step;
+
     // Create link buffer
     vecmem::data::jagged_vector_buffer<candidate_link> links_buffer(
-        n_candidates_per_step, m_mr.main, m_mr.host);
+        n_candidates_per_step, ws_mr, m_mr.host);
     m_copy.setup(links_buffer);
 
     // Copy link map to link buffer
@@ -433,13 +1575,13 @@ finding_algorithm<stepper_t, navigator_t>::operator()(
         vecmem::device_vector<candidate_link> out(
             *(links_buffer.host_ptr() + it));
 
-        thrust::copy(thrust::cuda::par.on(stream), in.begin(),
+        thrust::copy(thrust::cuda::par(thrust_alloc).on(stream), in.begin(),
                      in.begin() + n_candidates_per_step[it], out.begin());
     }
 
     // Create param_to_link
     vecmem::data::jagged_vector_buffer<unsigned int> param_to_link_buffer(
-        n_parameters_per_step, m_mr.main, m_mr.host);
+        n_parameters_per_step, ws_mr, m_mr.host);
     m_copy.setup(param_to_link_buffer);
 
     // Copy param_to_link map to param_to_link buffer
@@ -449,22 +1591,16 @@ finding_algorithm<stepper_t, navigator_t>::operator()(
         vecmem::device_vector<unsigned int> out(
             *(param_to_link_buffer.host_ptr() + it));
 
-        thrust::copy(thrust::cuda::par.on(stream), in.begin(),
+        thrust::copy(thrust::cuda::par(thrust_alloc).on(stream), in.begin(),
                      in.begin() + n_parameters_per_step[it], out.begin());
     }
 
-    // Get the number of tips per step
-    std::vector<unsigned int> n_tips_per_step;
-    n_tips_per_step.reserve(n_steps);
-    for (unsigned int it = 0; it < n_steps; it++) {
-        n_tips_per_step.push_back(m_copy.get_size(tips_map[it]));
-    }
 
     // Copy tips_map into the tips vector (D->D)
     unsigned int n_tips_total =
         std::accumulate(n_tips_per_step.begin(), n_tips_per_step.end(), 0);
     vecmem::data::vector_buffer<typename candidate_link::link_index_type>
-        tips_buffer{n_tips_total, m_mr.main};
+        tips_buffer{n_tips_total, ws_mr};
     m_copy.setup(tips_buffer);
 
     vecmem::device_vector<typename candidate_link::link_index_type> tips(
@@ -479,39 +1615,98 @@ finding_algorithm<stepper_t, navigator_t>::operator()(
 
         const unsigned int n_tips = n_tips_per_step[it];
         if (n_tips > 0) {
-            thrust::copy(thrust::cuda::par.on(stream), in.begin(),
+            thrust::copy(thrust::cuda::par(thrust_alloc).on(stream), in.begin(),
                          in.begin() + n_tips, tips.begin() + prefix_sum);
             prefix_sum += n_tips;
         }
     }
 
-    /*****************************************************************
-     * Kernel6: Build tracks
-     *****************************************************************/
+    // Record the estimated work. Every link is a propagation to, and an
+    // update on, a surface.
+    if (counting_work()) {
+        count_work(work_model::track_finding(
+            m_copy.get_size(seeds_buffer),
+            std::accumulate(n_candidates_per_step.begin(),
+                            n_candidates_per_step.end(), std::size_t{0})));
+    }
+
+    return {std::move(links_buffer), std::move(param_to_link_buffer),
+            std::move(tips_buffer)};
+}
+
+template <typename stepper_t, typename navigator_t, typename precise_scalar_t>
+track_candidate_container_types::buffer
+finding_algorithm<stepper_t, navigator_t, precise_scalar_t>::find_in_chunks(
+    const typename detector_type::view_type& det_view,
+    const bfield_type& field_view,
+    const vecmem::data::jagged_vector_view<
+        typename navigator_t::intersection_type>& navigation_buffer,
+    const typename measurement_collection_types::view& measurements,
+    const bound_track_parameters_collection_types::buffer& seeds_buffer,
+    unsigned int chunk_size, clock_type::time_point start) const {
+
+    // Get a convenience variable for the stream that we'll be using.
+    cudaStream_t stream = details::get_stream(m_stream);
+
+    // Find the track candidates of every chunk. (The temporary buffers of a
+    // chunk are released by the next one.)
+    const unsigned int n_seeds = m_copy.get_size(seeds_buffer);
+    std::vector<track_candidate_container_types::buffer> chunk_candidates;
+    branch_histogram histogram;
+    for (unsigned int begin = 0; begin < n_seeds; begin += chunk_size) {
+
+        const unsigned int n_chunk_seeds =
+            std::min(chunk_size, n_seeds - begin);
+        bound_track_parameters_collection_types::buffer chunk_seeds(
+            n_chunk_seeds, m_mr.event_memory());
+        CUDA_ERROR_CHECK(cudaMemcpyAsync(
+            chunk_seeds.ptr(), seeds_buffer.ptr() + begin,
+            n_chunk_seeds * sizeof(bound_track_parameters),
+            cudaMemcpyDeviceToDevice, stream));
+
+        chunk_candidates.push_back(find_tracks(det_view, field_view,
+                                               navigation_buffer, measurements,
+                                               chunk_seeds, start));
+        add_branch_counts(histogram, m_branch_histogram);
+    }
+
+    // Concatenate the track candidates of the chunks
+    std::vector<unsigned int> n_chunk_tracks;
+    n_chunk_tracks.reserve(chunk_candidates.size());
+    for (const track_candidate_container_types::buffer& candidates :
+         chunk_candidates) {
+        n_chunk_tracks.push_back(m_copy.get_size(candidates.headers));
+    }
+    const unsigned int n_tracks =
+        std::accumulate(n_chunk_tracks.begin(), n_chunk_tracks.end(), 0u);
 
-    // Create track candidate buffer
     track_candidate_container_types::buffer track_candidates_buffer{
-        {n_tips_total, m_mr.main},
-        {std::vector<std::size_t>(n_tips_total,
+        {n_tracks, m_mr.event_memory()},
+        {std::vector<std::size_t>(n_tracks,
                                   m_cfg.max_track_candidates_per_track),
-         m_mr.main, m_mr.host, vecmem::data::buffer_type::resizable}};
-
+         m_mr.event_memory(), m_mr.host, vecmem::data::buffer_type::resizable}};
     m_copy.setup(track_candidates_buffer.headers);
     m_copy.setup(track_candidates_buffer.items);
 
-    // @Note: nBlocks can be zero in case there is no tip. This happens when
-    // chi2_max config is set tightly and no tips are found
-    if (n_tips_total > 0) {
-        nThreads = WARP_SIZE * 2;
-        nBlocks = (n_tips_total + nThreads - 1) / nThreads;
-        kernels::build_tracks<<<nBlocks, nThreads, 0, stream>>>(
-            measurements, seeds_buffer, links_buffer, param_to_link_buffer,
-            tips_buffer, track_candidates_buffer);
-
-        CUDA_ERROR_CHECK(cudaGetLastError());
+    const unsigned int nThreads = WARP_SIZE * 2;
+    unsigned int offset = 0u;
+    for (std::size_t i = 0; i < chunk_candidates.size(); ++i) {
+        if (n_chunk_tracks[i] > 0) {
+            const unsigned int nBlocks =
+                (n_chunk_tracks[i] + nThreads - 1) / nThreads;
+            details::kernel_timer append_track_candidates_timer(
+                m_stream, "append_track_candidates", nBlocks, nThreads);
+            kernels::append_track_candidates<<<nBlocks, nThreads, 0,
+                                               stream>>>(
+                chunk_candidates[i], offset, track_candidates_buffer);
+            append_track_candidates_timer.stop();
+            CUDA_ERROR_CHECK(cudaGetLastError());
+        }
+        offset += n_chunk_tracks[i];
     }
     m_stream.synchronize();
 
+    m_branch_histogram = std::move(histogram);
     return track_candidates_buffer;
 }
 
@@ -523,5 +1718,17 @@ using default_stepper_type =
                        transform3, detray::constrained_step<>>;
 using default_navigator_type = detray::navigator<const default_detector_type>;
 template class finding_algorithm<default_stepper_type, default_navigator_type>;
+template class finding_algorithm<default_stepper_type, default_navigator_type,
+                                 double>;
+using inhom_global_stepper_type =
+    detray::rk_stepper<inhom_global_field_t::view_t, transform3,
+                       detray::constrained_step<>>;
+template class finding_algorithm<inhom_global_stepper_type,
+                                 default_navigator_type>;
+using inhom_texture_stepper_type =
+    detray::rk_stepper<inhom_texture_field_t::view_t, transform3,
+                       detray::constrained_step<>>;
+template class finding_algorithm<inhom_texture_stepper_type,
+                                 default_navigator_type>;
 
 }  // namespace traccc::cuda
@@ -0,0 +1,100 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Local include(s).
+#include "../utils/kernel_timer.hpp"
+#include "../utils/thrust_allocator.cuh"
+#include "../utils/utils.hpp"
+#include "traccc/cuda/finding/measurement_segmentation_algorithm.hpp"
+#include "traccc/cuda/utils/definitions.hpp"
+#include "traccc/finding/device/fill_measurement_ranges.hpp"
+#include "traccc/utils/trace.hpp"
+
+// VecMem include(s).
+#include <vecmem/containers/device_vector.hpp>
+
+// Thrust include(s).
+#include <thrust/execution_policy.h>
+#include <thrust/functional.h>
+#include <thrust/transform_reduce.h>
+
+namespace traccc::cuda {
+namespace kernels {
+
+/// CUDA kernel for running @c traccc::device::fill_measurement_ranges
+__global__ void fill_measurement_ranges(
+    measurement_collection_types::const_view measurements_view,
+    measurement_range_collection_types::view ranges_view) {
+
+    int gid = threadIdx.x + blockIdx.x * blockDim.x;
+
+    device::fill_measurement_ranges(gid, measurements_view, ranges_view);
+}
+
+}  // namespace kernels
+
+namespace {
+
+/// Functor returning the number of surfaces needed to index a measurement
+struct measurement_surface_count {
+    TRACCC_HOST_DEVICE
+    unsigned int operator()(const measurement& meas) const {
+        return static_cast<unsigned int>(meas.surface_link.index()) + 1u;
+    }
+};
+
+}  // namespace
+
+measurement_segmentation_algorithm::measurement_segmentation_algorithm(
+    const traccc::memory_resource& mr, vecmem::copy& copy, stream& str)
+    : m_mr(mr), m_copy(copy), m_stream(str) {}
+
+measurement_segmentation_algorithm::output_type
+measurement_segmentation_algorithm::operator()(
+    const measurement_collection_types::const_view& measurements) const {
+
+    TRACCC_TRACE_RANGE("traccc::cuda::measurement_segmentation_algorithm");
+
+    // Get a convenience variable for the stream that we'll be using.
+    cudaStream_t stream = details::get_stream(m_stream);
+
+    // Thrust takes its temporary storage from the main memory resource.
+    details::thrust_allocator thrust_alloc(m_mr.main);
+
+    // The size of the table is set by the largest surface index of the
+    // measurements.
+    const measurement_collection_types::const_device measurements_device(
+        measurements);
+    const unsigned int n_surfaces = thrust::transform_reduce(
+        thrust::cuda::par(thrust_alloc).on(stream), measurements_device.begin(),
+        measurements_device.end(), measurement_surface_count{}, 0u,
+        thrust::maximum<unsigned int>());
+
+    // Create the table, with empty ranges for the surfaces without any
+    // measurements.
+    output_type ranges_buffer{n_surfaces, m_mr.main};
+    m_copy.setup(ranges_buffer);
+    m_copy.memset(ranges_buffer, 0);
+
+    // Fill the ranges of the surfaces with measurements.
+    const unsigned int nThreads = WARP_SIZE * 2;
+    const unsigned int nBlocks =
+        (measurements_device.size() + nThreads - 1) / nThreads;
+    if (nBlocks > 0) {
+        details::kernel_timer timer(m_stream, "fill_measurement_ranges",
+                                    nBlocks, nThreads);
+        kernels::fill_measurement_ranges<<<nBlocks, nThreads, 0, stream>>>(
+            measurements, ranges_buffer);
+        timer.stop();
+        CUDA_ERROR_CHECK(cudaGetLastError());
+    }
+
+    // Return the table.
+    return ranges_buffer;
+}
+
+}  // namespace traccc::cuda
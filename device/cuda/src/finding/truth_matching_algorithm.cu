@@ -0,0 +1,71 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Local include(s).
+#include "../utils/kernel_timer.hpp"
+#include "../utils/utils.hpp"
+#include "traccc/cuda/finding/truth_matching_algorithm.hpp"
+#include "traccc/cuda/utils/definitions.hpp"
+
+// Project include(s).
+#include "traccc/finding/device/match_track_candidates.hpp"
+#include "traccc/utils/trace.hpp"
+
+namespace traccc::cuda {
+namespace kernels {
+
+/// CUDA kernel for running @c traccc::device::match_track_candidates
+__global__ void match_track_candidates(
+    track_candidate_container_types::const_view track_candidates_view,
+    measurement_particle_container_types::const_view truth_view,
+    track_truth_match_collection_types::view matches_view) {
+
+    device::match_track_candidates(threadIdx.x + blockIdx.x * blockDim.x,
+                                   track_candidates_view, truth_view,
+                                   matches_view);
+}
+
+}  // namespace kernels
+
+truth_matching_algorithm::truth_matching_algorithm(
+    const traccc::memory_resource& mr, vecmem::copy& copy, stream& str)
+    : m_mr(mr), m_copy(copy), m_stream(str) {}
+
+truth_matching_algorithm::output_type truth_matching_algorithm::operator()(
+    const track_candidate_container_types::const_view& track_candidates_view,
+    const measurement_particle_container_types::const_view& truth_view)
+    const {
+
+    TRACCC_TRACE_RANGE("traccc::cuda::truth_matching_algorithm");
+
+    // Get a convenience variable for the stream that we'll be using.
+    cudaStream_t stream = details::get_stream(m_stream);
+
+    // Create the result buffer.
+    const unsigned int n_tracks =
+        m_copy.get_size(track_candidates_view.headers);
+    output_type result(n_tracks, m_mr.main);
+
+    // Check if anything needs to be done.
+    if (n_tracks == 0) {
+        return result;
+    }
+
+    // Match the track candidates.
+    const unsigned int nThreads = WARP_SIZE * 2;
+    const unsigned int nBlocks = (n_tracks + nThreads - 1) / nThreads;
+    details::kernel_timer match_track_candidates_timer(
+        m_stream, "match_track_candidates", nBlocks, nThreads);
+    kernels::match_track_candidates<<<nBlocks, nThreads, 0, stream>>>(
+        track_candidates_view, truth_view, result);
+    match_track_candidates_timer.stop();
+    CUDA_ERROR_CHECK(cudaGetLastError());
+
+    return result;
+}
+
+}  // namespace traccc::cuda
@@ -6,11 +6,17 @@
  */
 
 // Project include(s).
+#include "../utils/kernel_timer.hpp"
+#include "../utils/launch_parameters.cuh"
+#include "../utils/navigation_grid.hpp"
 #include "../utils/utils.hpp"
 #include "traccc/cuda/fitting/fitting_algorithm.hpp"
 #include "traccc/cuda/utils/definitions.hpp"
+#include "traccc/cuda/utils/magnetic_field.hpp"
 #include "traccc/fitting/device/fit.hpp"
 #include "traccc/fitting/kalman_filter/kalman_fitter.hpp"
+#include "traccc/utils/trace.hpp"
+#include "traccc/utils/work_model.hpp"
 
 // detray include(s).
 #include "detray/core/detector_metadata.hpp"
@@ -18,6 +24,8 @@
 #include "detray/propagator/rk_stepper.hpp"
 
 // System include(s).
+#include <algorithm>
+#include <numeric>
 #include <vector>
 
 namespace traccc::cuda {
@@ -31,16 +39,89 @@ __global__ void fit(
     vecmem::data::jagged_vector_view<typename fitter_t::intersection_type>
         nav_candidates_buffer,
     track_candidate_container_types::const_view track_candidates_view,
-    track_state_container_types::view track_states_view) {
+    track_state_container_types::view track_states_view,
+    const unsigned int n_tracks,
+    vecmem::data::vector_view<const unsigned int> order_view) {
 
-    int gid = threadIdx.x + blockIdx.x * blockDim.x;
+    for (unsigned int gid = threadIdx.x + blockIdx.x * blockDim.x;
+         gid < n_tracks; gid += blockDim.x * gridDim.x) {
+        device::fit<fitter_t>(gid, det_data, field_data, cfg,
+                              nav_candidates_buffer, track_candidates_view,
+                              track_states_view, order_view);
+    }
+}
+
+template <typename fitter_t, typename detector_view_t>
+__global__ void fit_flat(
+    detector_view_t det_data, const typename fitter_t::bfield_type field_data,
+    const typename fitter_t::config_type cfg,
+    vecmem::data::jagged_vector_view<typename fitter_t::intersection_type>
+        nav_candidates_buffer,
+    measurement_collection_types::const_view measurements_view,
+    track_candidate_soa_collection_types::const_view track_candidates_view,
+    track_state_container_types::view track_states_view,
+    const unsigned int n_tracks,
+    vecmem::data::vector_view<const unsigned int> order_view) {
 
-    device::fit<fitter_t>(gid, det_data, field_data, cfg, nav_candidates_buffer,
-                          track_candidates_view, track_states_view);
+    for (unsigned int gid = threadIdx.x + blockIdx.x * blockDim.x;
+         gid < n_tracks; gid += blockDim.x * gridDim.x) {
+        device::fit<fitter_t>(gid, det_data, field_data, cfg,
+                              nav_candidates_buffer, measurements_view,
+                              track_candidates_view, track_states_view,
+                              order_view);
+    }
 }
 
 }  // namespace kernels
 
+namespace {
+
+/// Order for fitting tracks in, with the longest tracks first
+///
+/// Tracks of the same length keep their input order.
+///
+template <typename size_t_>
+std::vector<unsigned int> length_order(const std::vector<size_t_>& sizes) {
+
+    std::vector<unsigned int> order(sizes.size());
+    std::iota(order.begin(), order.end(), 0u);
+    std::stable_sort(order.begin(), order.end(),
+                     [&sizes](unsigned int a, unsigned int b) {
+                         return sizes[a] > sizes[b];
+                     });
+    return order;
+}
+
+/// Estimate the fraction of the lanes of the fitting warps doing useful
+/// work, taking the track lengths as the amount of work per track
+///
+/// @param sizes The lengths of the tracks
+/// @param order The order of fitting the tracks in (input order if empty)
+///
+template <typename size_t_>
+float warp_efficiency(const std::vector<size_t_>& sizes,
+                      const std::vector<unsigned int>& order) {
+
+    std::size_t work = 0u;
+    std::size_t capacity = 0u;
+    for (std::size_t begin = 0u; begin < sizes.size(); begin += WARP_SIZE) {
+        const std::size_t end =
+            std::min<std::size_t>(begin + WARP_SIZE, sizes.size());
+        std::size_t longest = 0u;
+        for (std::size_t i = begin; i < end; ++i) {
+            const std::size_t size = sizes[order.empty() ? i : order[i]];
+            work += size;
+            longest = std::max(longest, size);
+        }
+        capacity += WARP_SIZE * longest;
+    }
+    return (capacity > 0u) ? static_cast<float>(work) /
+                                 static_cast<float>(capacity)
+                           : 1.f;
+}
+
+}  // namespace
+
 template <typename fitter_t>
 fitting_algorithm<fitter_t>::fitting_algorithm(
     const config_type& cfg, const traccc::memory_resource& mr,
@@ -56,6 +137,8 @@ track_state_container_types::buffer fitting_algorithm<fitter_t>::operator()(
     const typename track_candidate_container_types::const_view&
         track_candidates_view) const {
 
+    TRACCC_TRACE_RANGE("traccc::cuda::fitting_algorithm");
+
     // Get a convenience variable for the stream that we'll be using.
     cudaStream_t stream = details::get_stream(m_stream);
 
@@ -77,21 +160,119 @@ track_state_container_types::buffer fitting_algorithm<fitter_t>::operator()(
     m_copy.setup(track_states_buffer.items);
     m_copy.setup(navigation_buffer);
 
+    // Fit the longest tracks first, if requested
+    const std::vector<unsigned int> order =
+        m_cfg.sort_tracks_by_length ? length_order(candidate_sizes)
+                                    : std::vector<unsigned int>{};
+    m_warp_efficiency = warp_efficiency(candidate_sizes, order);
+    vecmem::data::vector_buffer<unsigned int> order_buffer(
+        static_cast<unsigned int>(order.size()), m_mr.main);
+    m_copy(vecmem::get_data(order), order_buffer,
+           vecmem::copy::type::host_to_device);
+
     // Calculate the number of threads and thread blocks to run the track
     // fitting
     if (n_tracks > 0) {
-        const unsigned int nThreads = WARP_SIZE * 2;
-        const unsigned int nBlocks = (n_tracks + nThreads - 1) / nThreads;
+        const unsigned int nThreads = details::threads_per_block(
+            m_stream, "fit",
+            kernels::fit<fitter_t,
+                         typename fitter_t::detector_type::view_type>,
+            WARP_SIZE * 2);
+        const auto grid = details::make_navigation_grid(navigation_buffer,
+                                                        n_tracks, nThreads);
+
+        // Run the track fitting
+        details::kernel_timer fit_timer(m_stream, "fit", grid.n_blocks,
+                                        nThreads);
+        kernels::fit<fitter_t><<<grid.n_blocks, nThreads, 0, stream>>>(
+            det_view, field_view, m_cfg, grid.candidates,
+            track_candidates_view, track_states_buffer, n_tracks,
+            order_buffer);
+        fit_timer.stop();
+        CUDA_ERROR_CHECK(cudaGetLastError());
+    }
+
+    m_stream.synchronize();
+
+    count_work(work_model::track_fitting(
+        n_tracks, std::accumulate(candidate_sizes.begin(),
+                                  candidate_sizes.end(), std::size_t{0})));
+    return track_states_buffer;
+}
+
+template <typename fitter_t>
+track_state_container_types::buffer fitting_algorithm<fitter_t>::operator()(
+    const typename fitter_t::detector_type::view_type& det_view,
+    const typename fitter_t::bfield_type& field_view,
+    const vecmem::data::jagged_vector_view<
+        typename fitter_t::intersection_type>& navigation_buffer,
+    const measurement_collection_types::const_view& measurements_view,
+    const track_candidate_soa_collection_types::const_view&
+        track_candidates_view) const {
+
+    TRACCC_TRACE_RANGE("traccc::cuda::fitting_algorithm");
+
+    // Get a convenience variable for the stream that we'll be using.
+    cudaStream_t stream = details::get_stream(m_stream);
+
+    // Number of tracks
+    const unsigned int n_tracks = track_candidates_view.size();
+
+    // Get the sizes of the track candidates in each track, from the offsets
+    std::vector<unsigned int> offsets(n_tracks + 1);
+    CUDA_ERROR_CHECK(cudaMemcpyAsync(
+        offsets.data(), track_candidates_view.offsets.ptr(),
+        (n_tracks + 1) * sizeof(unsigned int), cudaMemcpyDeviceToHost, stream));
+    m_stream.synchronize();
+    std::vector<std::size_t> candidate_sizes(n_tracks);
+    for (unsigned int i = 0; i < n_tracks; ++i) {
+        candidate_sizes[i] = offsets[i + 1] - offsets[i];
+    }
+
+    track_state_container_types::buffer track_states_buffer{
+        {n_tracks, m_mr.main},
+        {candidate_sizes, m_mr.main, m_mr.host,
+         vecmem::data::buffer_type::resizable}};
+
+    m_copy.setup(track_states_buffer.headers);
+    m_copy.setup(track_states_buffer.items);
+    m_copy.setup(navigation_buffer);
+
+    // Fit the longest tracks first, if requested
+    const std::vector<unsigned int> order =
+        m_cfg.sort_tracks_by_length ? length_order(candidate_sizes)
+                                    : std::vector<unsigned int>{};
+    m_warp_efficiency = warp_efficiency(candidate_sizes, order);
+    vecmem::data::vector_buffer<unsigned int> order_buffer(
+        static_cast<unsigned int>(order.size()), m_mr.main);
+    m_copy(vecmem::get_data(order), order_buffer,
+           vecmem::copy::type::host_to_device);
+
+    if (n_tracks > 0) {
+        const unsigned int nThreads = details::threads_per_block(
+            m_stream, "fit_flat",
+            kernels::fit_flat<fitter_t,
+                              typename fitter_t::detector_type::view_type>,
+            WARP_SIZE * 2);
+        const auto grid = details::make_navigation_grid(navigation_buffer,
+                                                        n_tracks, nThreads);
 
         // Run the track fitting
-        kernels::fit<fitter_t><<<nBlocks, nThreads, 0, stream>>>(
-            det_view, field_view, m_cfg, navigation_buffer,
-            track_candidates_view, track_states_buffer);
+        details::kernel_timer fit_flat_timer(m_stream, "fit_flat",
+                                             grid.n_blocks, nThreads);
+        kernels::fit_flat<fitter_t><<<grid.n_blocks, nThreads, 0, stream>>>(
+            det_view, field_view, m_cfg, grid.candidates, measurements_view,
+            track_candidates_view, track_states_buffer, n_tracks,
+            order_buffer);
+        fit_flat_timer.stop();
         CUDA_ERROR_CHECK(cudaGetLastError());
     }
 
     m_stream.synchronize();
 
+    count_work(work_model::track_fitting(
+        n_tracks, std::accumulate(candidate_sizes.begin(),
+                                  candidate_sizes.end(), std::size_t{0})));
     return track_states_buffer;
 }
 
@@ -105,5 +286,17 @@ using default_navigator_type = detray::navigator<const default_detector_type>;
 using default_fitter_type =
     kalman_fitter<default_stepper_type, default_navigator_type>;
 template class fitting_algorithm<default_fitter_type>;
+template class fitting_algorithm<
+    kalman_fitter<default_stepper_type, default_navigator_type, double>>;
+using inhom_global_stepper_type =
+    detray::rk_stepper<inhom_global_field_t::view_t, transform3,
+                       detray::constrained_step<>>;
+template class fitting_algorithm<
+    kalman_fitter<inhom_global_stepper_type, default_navigator_type>>;
+using inhom_texture_stepper_type =
+    detray::rk_stepper<inhom_texture_field_t::view_t, transform3,
+                       detray::constrained_step<>>;
+template class fitting_algorithm<
+    kalman_fitter<inhom_texture_stepper_type, default_navigator_type>>;
 
 }  // namespace traccc::cuda
@@ -0,0 +1,141 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Local include(s).
+#include "../utils/kernel_timer.hpp"
+#include "../utils/thrust_allocator.cuh"
+#include "../utils/utils.hpp"
+#include "traccc/cuda/fitting/track_selection_algorithm.hpp"
+#include "traccc/cuda/utils/definitions.hpp"
+
+// Project include(s).
+#include "traccc/fitting/device/select_tracks.hpp"
+#include "traccc/utils/trace.hpp"
+
+// VecMem include(s).
+#include <vecmem/containers/data/vector_buffer.hpp>
+
+// Thrust include(s).
+#include <thrust/execution_policy.h>
+#include <thrust/sort.h>
+
+// System include(s).
+#include <vector>
+
+namespace traccc::cuda {
+
+namespace kernels {
+
+/// CUDA kernel for running @c traccc::device::select_tracks
+__global__ void select_tracks(
+    track_selection_config cfg,
+    track_state_container_types::const_view track_states_view,
+    vecmem::data::vector_view<unsigned int> selected_view) {
+
+    device::select_tracks(threadIdx.x + blockIdx.x * blockDim.x, cfg,
+                          track_states_view, selected_view);
+}
+
+/// CUDA kernel for running @c traccc::device::gather_tracks
+__global__ void gather_tracks(
+    track_state_container_types::const_view track_states_view,
+    vecmem::data::vector_view<const unsigned int> selected_view,
+    track_state_container_types::view output_view) {
+
+    device::gather_tracks(threadIdx.x + blockIdx.x * blockDim.x,
+                          track_states_view, selected_view, output_view);
+}
+
+}  // namespace kernels
+
+track_selection_algorithm::track_selection_algorithm(
+    const track_selection_config& cfg, const traccc::memory_resource& mr,
+    vecmem::copy& copy, stream& str)
+    : m_cfg(cfg), m_mr(mr), m_copy(copy), m_stream(str) {}
+
+track_selection_algorithm::output_type track_selection_algorithm::operator()(
+    const track_state_container_types::const_view& track_states_view) const {
+
+    TRACCC_TRACE_RANGE("traccc::cuda::track_selection_algorithm");
+
+    // Get a convenience variable for the stream that we'll be using.
+    cudaStream_t stream = details::get_stream(m_stream);
+
+    // The number of tracks, and of states per track
+    const unsigned int n_tracks = m_copy.get_size(track_states_view.headers);
+    const std::vector<unsigned int> state_sizes =
+        m_copy.get_sizes(track_states_view.items);
+
+    // Check if anything needs to be done.
+    if (n_tracks == 0) {
+        track_state_container_types::buffer output_buffer{
+            {0, m_mr.main},
+            {std::vector<unsigned int>{}, m_mr.main, m_mr.host}};
+        m_copy.setup(output_buffer.headers);
+        m_copy.setup(output_buffer.items);
+        return output_buffer;
+    }
+
+    // Find the indices of the selected tracks
+    vecmem::data::vector_buffer<unsigned int> selected_buffer(
+        n_tracks, m_mr.main, vecmem::data::buffer_type::resizable);
+    m_copy.setup(selected_buffer);
+
+    const unsigned int nThreads = WARP_SIZE * 2;
+    const unsigned int nBlocks = (n_tracks + nThreads - 1) / nThreads;
+    details::kernel_timer select_timer(m_stream, "select_tracks", nBlocks,
+                                       nThreads);
+    kernels::select_tracks<<<nBlocks, nThreads, 0, stream>>>(
+        m_cfg, track_states_view, selected_buffer);
+    select_timer.stop();
+    CUDA_ERROR_CHECK(cudaGetLastError());
+
+    // Get the number of selected tracks. This is a synchronous operation for
+    // a resizable buffer.
+    const unsigned int n_selected = m_copy.get_size(selected_buffer);
+
+    // The tracks are selected in no particular order. Sort their indices, to
+    // keep the order of the input tracks.
+    details::thrust_allocator thrust_alloc(m_mr.event_memory());
+    auto policy = thrust::cuda::par_nosync(thrust_alloc).on(stream);
+    thrust::sort(policy, selected_buffer.ptr(),
+                 selected_buffer.ptr() + n_selected);
+
+    // The sizes of the selected tracks are needed on the host, to set up the
+    // output buffer.
+    std::vector<unsigned int> selected;
+    m_copy(selected_buffer, selected)->wait();
+    std::vector<unsigned int> selected_sizes(n_selected);
+    for (unsigned int i = 0; i < n_selected; ++i) {
+        selected_sizes[i] = state_sizes[selected[i]];
+    }
+
+    // Create the output buffer
+    track_state_container_types::buffer output_buffer{
+        {n_selected, m_mr.main}, {selected_sizes, m_mr.main, m_mr.host}};
+    m_copy.setup(output_buffer.headers);
+    m_copy.setup(output_buffer.items);
+
+    if (n_selected == 0) {
+        return output_buffer;
+    }
+
+    // Gather the selected tracks
+    const unsigned int nGatherBlocks = (n_selected + nThreads - 1) / nThreads;
+    details::kernel_timer gather_timer(m_stream, "gather_tracks",
+                                       nGatherBlocks, nThreads);
+    kernels::gather_tracks<<<nGatherBlocks, nThreads, 0, stream>>>(
+        track_states_view,
+        vecmem::data::vector_view<const unsigned int>(selected_buffer),
+        output_buffer);
+    gather_timer.stop();
+    CUDA_ERROR_CHECK(cudaGetLastError());
+
+    return output_buffer;
+}
+
+}  // namespace traccc::cuda
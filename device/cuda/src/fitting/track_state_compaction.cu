@@ -0,0 +1,120 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Local include(s).
+#include "../utils/kernel_timer.hpp"
+#include "../utils/utils.hpp"
+#include "traccc/cuda/fitting/track_state_compaction.hpp"
+#include "traccc/cuda/utils/definitions.hpp"
+
+// Project include(s).
+#include "traccc/fitting/device/compact_track_states.hpp"
+#include "traccc/utils/trace.hpp"
+
+// System include(s).
+#include <vector>
+
+namespace traccc::cuda {
+
+namespace kernels {
+
+/// CUDA kernel for running @c traccc::device::compact_track_states
+__global__ void compact_track_states(
+    track_state_container_types::const_view track_states_view,
+    compact_track_state_container_types::view compact_states_view) {
+
+    device::compact_track_states(threadIdx.x + blockIdx.x * blockDim.x,
+                                 track_states_view, compact_states_view);
+}
+
+/// CUDA kernel for running @c traccc::device::collect_track_covariances
+__global__ void collect_track_covariances(
+    track_state_container_types::const_view track_states_view,
+    compact_track_covariance_types::view covariances_view) {
+
+    device::collect_track_covariances(threadIdx.x + blockIdx.x * blockDim.x,
+                                      track_states_view, covariances_view);
+}
+
+}  // namespace kernels
+
+track_state_compaction::track_state_compaction(
+    const traccc::memory_resource& mr, vecmem::copy& copy, stream& str)
+    : m_mr(mr), m_copy(copy), m_stream(str) {}
+
+track_state_compaction::output_type track_state_compaction::operator()(
+    const track_state_container_types::const_view& track_states_view) const {
+
+    TRACCC_TRACE_RANGE("traccc::cuda::track_state_compaction");
+
+    // Get a convenience variable for the stream that we'll be using.
+    cudaStream_t stream = details::get_stream(m_stream);
+
+    // The number of tracks, and of states per track
+    const unsigned int n_tracks = m_copy.get_size(track_states_view.headers);
+    const std::vector<unsigned int> state_sizes =
+        m_copy.get_sizes(track_states_view.items);
+
+    // Create the output buffer
+    compact_track_state_container_types::buffer compact_states_buffer{
+        {n_tracks, m_mr.main}, {state_sizes, m_mr.main, m_mr.host}};
+    m_copy.setup(compact_states_buffer.headers);
+    m_copy.setup(compact_states_buffer.items);
+
+    // Check if anything needs to be done.
+    if (n_tracks == 0) {
+        return compact_states_buffer;
+    }
+
+    const unsigned int nThreads = WARP_SIZE * 2;
+    const unsigned int nBlocks = (n_tracks + nThreads - 1) / nThreads;
+    details::kernel_timer compact_timer(m_stream, "compact_track_states",
+                                        nBlocks, nThreads);
+    kernels::compact_track_states<<<nBlocks, nThreads, 0, stream>>>(
+        track_states_view, compact_states_buffer);
+    compact_timer.stop();
+    CUDA_ERROR_CHECK(cudaGetLastError());
+
+    return compact_states_buffer;
+}
+
+compact_track_covariance_types::buffer track_state_compaction::covariances(
+    const track_state_container_types::const_view& track_states_view) const {
+
+    TRACCC_TRACE_RANGE("traccc::cuda::track_state_compaction::covariances");
+
+    // Get a convenience variable for the stream that we'll be using.
+    cudaStream_t stream = details::get_stream(m_stream);
+
+    // The number of states per track
+    const std::vector<unsigned int> state_sizes =
+        m_copy.get_sizes(track_states_view.items);
+    const unsigned int n_tracks = static_cast<unsigned int>(state_sizes.size());
+
+    // Create the output buffer
+    compact_track_covariance_types::buffer covariances_buffer{
+        state_sizes, m_mr.main, m_mr.host};
+    m_copy.setup(covariances_buffer);
+
+    // Check if anything needs to be done.
+    if (n_tracks == 0) {
+        return covariances_buffer;
+    }
+
+    const unsigned int nThreads = WARP_SIZE * 2;
+    const unsigned int nBlocks = (n_tracks + nThreads - 1) / nThreads;
+    details::kernel_timer covariances_timer(
+        m_stream, "collect_track_covariances", nBlocks, nThreads);
+    kernels::collect_track_covariances<<<nBlocks, nThreads, 0, stream>>>(
+        track_states_view, covariances_buffer);
+    covariances_timer.stop();
+    CUDA_ERROR_CHECK(cudaGetLastError());
+
+    return covariances_buffer;
+}
+
+}  // namespace traccc::cuda
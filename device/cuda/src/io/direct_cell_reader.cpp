@@ -0,0 +1,237 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Local include(s).
+#include "traccc/cuda/io/direct_cell_reader.hpp"
+
+#include "../utils/utils.hpp"
+#include "traccc/cuda/utils/definitions.hpp"
+#include "traccc/utils/trace.hpp"
+
+// CUDA include(s).
+#include <cuda_runtime_api.h>
+#ifdef TRACCC_CUDA_HAVE_CUFILE
+#include <cufile.h>
+#endif
+
+// System include(s).
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <array>
+#include <cerrno>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+
+namespace {
+
+/// Owning wrapper around a POSIX file descriptor
+class file_descriptor {
+
+    public:
+    /// Open a file for reading, returning an invalid descriptor on failure
+    file_descriptor(const std::string& filename, int flags)
+        : m_fd(::open(filename.c_str(), O_RDONLY | flags)) {}
+    /// Destructor, closing the file
+    ~file_descriptor() {
+        if (m_fd >= 0) {
+            ::close(m_fd);
+        }
+    }
+    /// Copying is not allowed
+    file_descriptor(const file_descriptor&) = delete;
+    /// Copying is not allowed
+    file_descriptor& operator=(const file_descriptor&) = delete;
+
+    /// The descriptor of the file
+    int fd() const { return m_fd; }
+
+    private:
+    /// The descriptor of the file
+    int m_fd;
+
+};  // class file_descriptor
+
+/// Read a range of a file into host memory, throwing on failure
+void read_fully(int fd, void* ptr, std::size_t size, std::size_t offset,
+                const std::string& filename) {
+
+    char* dest = static_cast<char*>(ptr);
+    while (size > 0) {
+        const ssize_t n = ::pread(fd, dest, size, static_cast<off_t>(offset));
+        if (n < 0 && errno == EINTR) {
+            continue;
+        }
+        if (n <= 0) {
+            throw std::runtime_error("Could not read file: " + filename);
+        }
+        dest += n;
+        size -= static_cast<std::size_t>(n);
+        offset += static_cast<std::size_t>(n);
+    }
+}
+
+}  // namespace
+
+namespace traccc::cuda {
+
+struct direct_cell_reader::impl {
+
+    /// Read the payload of a binary file into device memory
+    void read_payload(const std::string& filename, int fd, void* dest,
+                      std::size_t size, std::size_t offset);
+    /// Read a binary collection file into a new device buffer
+    template <typename buffer_t>
+    buffer_t read_collection(std::string_view filename);
+
+    /// The device memory resource to allocate the buffers with
+    vecmem::memory_resource& m_mr;
+    /// The stream to perform the copies on
+    cudaStream_t m_stream;
+    /// Whether GPUDirect Storage is available
+    bool m_gds = false;
+    /// The size of each of the bounce buffers
+    std::size_t m_bounce_size;
+    /// Pinned bounce buffers, allocated on first use
+    std::array<void*, 2> m_bounce{nullptr, nullptr};
+    /// Events marking the copies out of the bounce buffers
+    std::array<cudaEvent_t, 2> m_events{nullptr, nullptr};
+    /// Mutex protecting the bounce buffers
+    std::mutex m_mutex;
+};
+
+void direct_cell_reader::impl::read_payload(const std::string& filename,
+                                            int fd, void* dest,
+                                            std::size_t size,
+                                            std::size_t offset) {
+
+    if (size == 0) {
+        return;
+    }
+
+#ifdef TRACCC_CUDA_HAVE_CUFILE
+    // Try to DMA the payload straight into device memory. GPUDirect Storage
+    // prefers files opened with O_DIRECT, but works in compatibility mode
+    // without it as well.
+    if (m_gds) {
+        file_descriptor direct_file(filename, O_DIRECT);
+        CUfileDescr_t descr{};
+        descr.handle.fd = (direct_file.fd() >= 0 ? direct_file.fd() : fd);
+        descr.type = CU_FILE_HANDLE_TYPE_OPAQUE_FD;
+        CUfileHandle_t handle;
+        if (cuFileHandleRegister(&handle, &descr).err == CU_FILE_SUCCESS) {
+            std::size_t done = 0;
+            while (done < size) {
+                const ssize_t n =
+                    cuFileRead(handle, dest, size - done,
+                               static_cast<off_t>(offset + done),
+                               static_cast<off_t>(done));
+                if (n <= 0) {
+                    break;
+                }
+                done += static_cast<std::size_t>(n);
+            }
+            cuFileHandleDeregister(handle);
+            if (done == size) {
+                return;
+            }
+        }
+    }
+#endif
+
+    // Stream the payload through the pinned bounce buffers, reading into one
+    // of them while the other one is being copied to the device.
+    std::lock_guard<std::mutex> lock{m_mutex};
+    if (m_bounce[0] == nullptr) {
+        for (std::size_t i = 0; i < m_bounce.size(); ++i) {
+            CUDA_ERROR_CHECK(cudaMallocHost(&(m_bounce[i]), m_bounce_size));
+            CUDA_ERROR_CHECK(
+                cudaEventCreateWithFlags(&(m_events[i]),
+                                         cudaEventDisableTiming));
+        }
+    }
+    std::size_t done = 0;
+    for (std::size_t i = 0; done < size; i = (i + 1) % m_bounce.size()) {
+        const std::size_t n = std::min(m_bounce_size, size - done);
+        CUDA_ERROR_CHECK(cudaEventSynchronize(m_events[i]));
+        read_fully(fd, m_bounce[i], n, offset + done, filename);
+        CUDA_ERROR_CHECK(cudaMemcpyAsync(static_cast<char*>(dest) + done,
+                                         m_bounce[i], n,
+                                         cudaMemcpyHostToDevice, m_stream));
+        CUDA_ERROR_CHECK(cudaEventRecord(m_events[i], m_stream));
+        done += n;
+    }
+    CUDA_ERROR_CHECK(cudaStreamSynchronize(m_stream));
+}
+
+template <typename buffer_t>
+buffer_t direct_cell_reader::impl::read_collection(std::string_view filename) {
+
+    const std::string fname(filename);
+    file_descriptor file(fname, 0);
+    if (file.fd() < 0) {
+        throw std::runtime_error("Could not open file: " + fname);
+    }
+
+    // Read the size of the collection, and then its payload.
+    std::size_t size = 0;
+    read_fully(file.fd(), &size, sizeof(std::size_t), 0, fname);
+    buffer_t result(static_cast<typename buffer_t::size_type>(size), m_mr);
+    read_payload(fname, file.fd(), result.ptr(),
+                 size * sizeof(typename buffer_t::value_type),
+                 sizeof(std::size_t));
+    return result;
+}
+
+direct_cell_reader::direct_cell_reader(vecmem::memory_resource& mr,
+                                       stream& str, bool use_gds,
+                                       std::size_t bounce_buffer_size)
+    : m_impl(new impl{mr, details::get_stream(str)}) {
+
+    m_impl->m_bounce_size = std::max<std::size_t>(bounce_buffer_size, 1u);
+#ifdef TRACCC_CUDA_HAVE_CUFILE
+    if (use_gds) {
+        m_impl->m_gds = (cuFileDriverOpen().err == CU_FILE_SUCCESS);
+    }
+#else
+    (void)use_gds;
+#endif
+}
+
+direct_cell_reader::~direct_cell_reader() {
+
+    for (std::size_t i = 0; i < m_impl->m_bounce.size(); ++i) {
+        if (m_impl->m_bounce[i] != nullptr) {
+            cudaFreeHost(m_impl->m_bounce[i]);
+            cudaEventDestroy(m_impl->m_events[i]);
+        }
+    }
+#ifdef TRACCC_CUDA_HAVE_CUFILE
+    if (m_impl->m_gds) {
+        cuFileDriverClose();
+    }
+#endif
+}
+
+direct_cell_reader::output_type direct_cell_reader::operator()(
+    std::string_view cells_file, std::string_view modules_file) const {
+
+    TRACCC_TRACE_RANGE("traccc::cuda::direct_cell_reader");
+
+    return {m_impl->read_collection<cell_collection_types::buffer>(cells_file),
+            m_impl->read_collection<cell_module_collection_types::buffer>(
+                modules_file)};
+}
+
+bool direct_cell_reader::uses_gds() const {
+
+    return m_impl->m_gds;
+}
+
+}  // namespace traccc::cuda
@@ -6,11 +6,13 @@
  */
 
 // Local include(s).
+#include "../../utils/kernel_timer.hpp"
 #include "../../utils/utils.hpp"
 #include "traccc/cuda/seeding/experimental/spacepoint_formation.hpp"
 #include "traccc/cuda/utils/barrier.hpp"
 #include "traccc/cuda/utils/definitions.hpp"
 #include "traccc/seeding/device/experimental/form_spacepoints.hpp"
+#include "traccc/utils/trace.hpp"
 
 // detray include(s).
 #include "detray/core/detector.hpp"
@@ -45,6 +47,8 @@ spacepoint_formation<detector_t>::operator()(
     const typename detector_t::view_type& det_view,
     const measurement_collection_types::const_view& measurements_view) const {
 
+    TRACCC_TRACE_RANGE("traccc::cuda::experimental::spacepoint_formation");
+
     // Get a convenience variable for the stream that we'll be using.
     cudaStream_t stream = details::get_stream(m_stream);
 
@@ -57,8 +61,11 @@ spacepoint_formation<detector_t>::operator()(
     unsigned int nThreads = WARP_SIZE * 2;
     unsigned int nBlocks = (n_measurements + nThreads - 1) / nThreads;
 
+    details::kernel_timer form_spacepoints_timer(m_stream, "form_spacepoints",
+                                                 nBlocks, nThreads);
     kernels::form_spacepoints<detector_t><<<nBlocks, nThreads, 0, stream>>>(
         det_view, measurements_view, spacepoints_buffer);
+    form_spacepoints_timer.stop();
 
     CUDA_ERROR_CHECK(cudaGetLastError());
 
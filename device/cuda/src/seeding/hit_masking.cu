@@ -0,0 +1,235 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Local include(s).
+#include "../utils/kernel_timer.hpp"
+#include "../utils/thrust_allocator.cuh"
+#include "../utils/utils.hpp"
+#include "traccc/cuda/seeding/hit_masking.hpp"
+#include "traccc/cuda/utils/definitions.hpp"
+
+// Project include(s).
+#include "traccc/device/bitmask.hpp"
+#include "traccc/finding/device/mark_used_measurements.hpp"
+#include "traccc/seeding/device/mask_grid.hpp"
+#include "traccc/utils/trace.hpp"
+
+// Thrust include(s).
+#include <thrust/execution_policy.h>
+#include <thrust/scan.h>
+
+// System include(s).
+#include <vector>
+
+namespace traccc::cuda {
+namespace kernels {
+
+/// CUDA kernel for running @c traccc::device::mark_used_measurements
+__global__ void mark_used_measurements(
+    measurement_collection_types::const_view measurements_view,
+    track_candidate_container_types::const_view track_candidates_view,
+    vecmem::data::vector_view<unsigned int> used_view) {
+
+    device::mark_used_measurements(threadIdx.x + blockIdx.x * blockDim.x,
+                                   measurements_view, track_candidates_view,
+                                   used_view);
+}
+
+/// CUDA kernel for running @c traccc::device::mark_used_measurements on flat
+/// track candidates
+__global__ void mark_used_flat_measurements(
+    track_candidate_soa_collection_types::const_view track_candidates_view,
+    vecmem::data::vector_view<unsigned int> used_view) {
+
+    device::mark_used_measurements(threadIdx.x + blockIdx.x * blockDim.x,
+                                   track_candidates_view, used_view);
+}
+
+/// CUDA kernel for running @c traccc::device::mark_used_spacepoints
+__global__ void mark_used_spacepoints(
+    spacepoint_collection_types::const_view spacepoints_view,
+    measurement_collection_types::const_view measurements_view,
+    vecmem::data::vector_view<const unsigned int> used_measurements_view,
+    vecmem::data::vector_view<unsigned int> used_spacepoints_view) {
+
+    device::mark_used_spacepoints(threadIdx.x + blockIdx.x * blockDim.x,
+                                  spacepoints_view, measurements_view,
+                                  used_measurements_view,
+                                  used_spacepoints_view);
+}
+
+/// CUDA kernel for running @c traccc::device::count_masked_grid_bin
+__global__ void count_masked_grid_bins(
+    sp_soa_grid_types::const_view grid_view,
+    vecmem::data::vector_view<const unsigned int> used_spacepoints_view,
+    vecmem::data::vector_view<unsigned int> bin_sizes_view) {
+
+    device::count_masked_grid_bin(threadIdx.x + blockIdx.x * blockDim.x,
+                                  grid_view, used_spacepoints_view,
+                                  bin_sizes_view);
+}
+
+/// CUDA kernel for running @c traccc::device::fill_masked_grid_bin
+__global__ void fill_masked_grid_bins(
+    sp_soa_grid_types::const_view grid_view,
+    vecmem::data::vector_view<const unsigned int> used_spacepoints_view,
+    sp_soa_grid_types::view masked_grid_view) {
+
+    device::fill_masked_grid_bin(threadIdx.x + blockIdx.x * blockDim.x,
+                                 grid_view, used_spacepoints_view,
+                                 masked_grid_view);
+}
+
+}  // namespace kernels
+
+hit_masking::hit_masking(const traccc::memory_resource& mr,
+                         vecmem::copy& copy, stream& str)
+    : m_mr(mr), m_copy(copy), m_stream(str) {}
+
+vecmem::data::vector_buffer<unsigned int> hit_masking::make_mask(
+    unsigned int n_measurements) const {
+
+    vecmem::data::vector_buffer<unsigned int> mask(
+        device::bitmask_size(n_measurements), m_mr.main);
+    m_copy.setup(mask);
+    m_copy.memset(mask, 0);
+    return mask;
+}
+
+void hit_masking::mark(
+    const measurement_collection_types::const_view& measurements,
+    const track_candidate_container_types::const_view& track_candidates,
+    const vecmem::data::vector_view<unsigned int>& mask) const {
+
+    TRACCC_TRACE_RANGE("traccc::cuda::hit_masking::mark");
+
+    // Get a convenience variable for the stream that we'll be using.
+    cudaStream_t stream = details::get_stream(m_stream);
+
+    // Check if anything needs to be done.
+    const unsigned int n_tracks = m_copy.get_size(track_candidates.headers);
+    if (n_tracks == 0) {
+        return;
+    }
+
+    const unsigned int nThreads = WARP_SIZE * 2;
+    const unsigned int nBlocks = (n_tracks + nThreads - 1) / nThreads;
+    details::kernel_timer mark_timer(m_stream, "mark_used_measurements",
+                                     nBlocks, nThreads);
+    kernels::mark_used_measurements<<<nBlocks, nThreads, 0, stream>>>(
+        measurements, track_candidates, mask);
+    mark_timer.stop();
+    CUDA_ERROR_CHECK(cudaGetLastError());
+}
+
+void hit_masking::mark(
+    const track_candidate_soa_collection_types::const_view& track_candidates,
+    const vecmem::data::vector_view<unsigned int>& mask) const {
+
+    TRACCC_TRACE_RANGE("traccc::cuda::hit_masking::mark");
+
+    // Get a convenience variable for the stream that we'll be using.
+    cudaStream_t stream = details::get_stream(m_stream);
+
+    // Check if anything needs to be done.
+    const unsigned int n_candidates =
+        track_candidates.measurement_indices.size();
+    if (n_candidates == 0) {
+        return;
+    }
+
+    const unsigned int nThreads = WARP_SIZE * 8;
+    const unsigned int nBlocks = (n_candidates + nThreads - 1) / nThreads;
+    details::kernel_timer mark_timer(m_stream, "mark_used_flat_measurements",
+                                     nBlocks, nThreads);
+    kernels::mark_used_flat_measurements<<<nBlocks, nThreads, 0, stream>>>(
+        track_candidates, mask);
+    mark_timer.stop();
+    CUDA_ERROR_CHECK(cudaGetLastError());
+}
+
+hit_masking::output_type hit_masking::operator()(
+    const sp_soa_grid_types::const_view& grid,
+    const spacepoint_collection_types::const_view& spacepoints,
+    const measurement_collection_types::const_view& measurements,
+    const vecmem::data::vector_view<const unsigned int>& mask) const {
+
+    TRACCC_TRACE_RANGE("traccc::cuda::hit_masking");
+
+    // Get a convenience variable for the stream that we'll be using.
+    cudaStream_t stream = details::get_stream(m_stream);
+
+    // Get the number of spacepoints. This is a synchronous operation for a
+    // resizable buffer.
+    const unsigned int n_spacepoints = m_copy.get_size(spacepoints);
+    const unsigned int n_bins = grid.bin_offsets.size() - 1u;
+
+    // Translate the mask of the measurements into a mask of the spacepoints.
+    vecmem::data::vector_buffer<unsigned int> used_spacepoints_buffer(
+        device::bitmask_size(n_spacepoints), m_mr.event_memory());
+    m_copy.setup(used_spacepoints_buffer);
+    m_copy.memset(used_spacepoints_buffer, 0);
+
+    const unsigned int nThreads = WARP_SIZE * 8;
+    if (n_spacepoints > 0) {
+        const unsigned int nBlocks =
+            (n_spacepoints + nThreads - 1) / nThreads;
+        details::kernel_timer mark_timer(m_stream, "mark_used_spacepoints",
+                                         nBlocks, nThreads);
+        kernels::mark_used_spacepoints<<<nBlocks, nThreads, 0, stream>>>(
+            spacepoints, measurements, mask, used_spacepoints_buffer);
+        mark_timer.stop();
+        CUDA_ERROR_CHECK(cudaGetLastError());
+    }
+
+    // Count the unused spacepoints of every bin, and turn the counts into
+    // the bin offsets of the masked grid.
+    vecmem::data::vector_buffer<unsigned int> bin_offsets_buffer(
+        n_bins + 1u, m_mr.event_memory());
+    m_copy.setup(bin_offsets_buffer);
+    m_copy.memset(bin_offsets_buffer, 0);
+
+    const unsigned int nBinBlocks = (n_bins + nThreads - 1) / nThreads;
+    details::kernel_timer count_timer(m_stream, "count_masked_grid_bins",
+                                      nBinBlocks, nThreads);
+    kernels::count_masked_grid_bins<<<nBinBlocks, nThreads, 0, stream>>>(
+        grid, used_spacepoints_buffer,
+        vecmem::data::vector_view<unsigned int>(
+            n_bins, bin_offsets_buffer.ptr() + 1));
+    count_timer.stop();
+    CUDA_ERROR_CHECK(cudaGetLastError());
+
+    details::thrust_allocator thrust_alloc(m_mr.event_memory());
+    auto policy = thrust::cuda::par_nosync(thrust_alloc).on(stream);
+    thrust::inclusive_scan(policy, bin_offsets_buffer.ptr() + 1,
+                           bin_offsets_buffer.ptr() + n_bins + 1,
+                           bin_offsets_buffer.ptr() + 1);
+
+    // The size of the masked grid is needed on the host.
+    std::vector<unsigned int> n_unused;
+    m_copy(vecmem::data::vector_view<const unsigned int>(
+               1u, bin_offsets_buffer.ptr() + n_bins),
+           n_unused)
+        ->wait();
+
+    // Create the masked grid, and fill it.
+    output_type masked_grid(grid.phi_axis, grid.z_axis, n_unused.front(),
+                            m_mr.event_memory());
+    m_copy(bin_offsets_buffer, masked_grid.bin_offsets,
+           vecmem::copy::type::device_to_device);
+
+    details::kernel_timer fill_timer(m_stream, "fill_masked_grid_bins",
+                                     nBinBlocks, nThreads);
+    kernels::fill_masked_grid_bins<<<nBinBlocks, nThreads, 0, stream>>>(
+        grid, used_spacepoints_buffer, get_data(masked_grid));
+    fill_timer.stop();
+    CUDA_ERROR_CHECK(cudaGetLastError());
+
+    return masked_grid;
+}
+
+}  // namespace traccc::cuda
@@ -0,0 +1,199 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Local include(s).
+#include "../utils/kernel_timer.hpp"
+#include "../utils/utils.hpp"
+#include "traccc/cuda/seeding/hough_seeding_algorithm.hpp"
+#include "traccc/cuda/utils/definitions.hpp"
+
+// Project include(s).
+#include "traccc/seeding/device/hough_transform.hpp"
+#include "traccc/utils/trace.hpp"
+
+// VecMem include(s).
+#include <vecmem/containers/data/vector_buffer.hpp>
+
+namespace traccc::cuda {
+namespace kernels {
+
+/// CUDA kernel for running @c traccc::device::fill_hough_accumulator
+__global__ void fill_hough_accumulator(
+    const hough_seeding_config config,
+    spacepoint_collection_types::const_view spacepoints_view,
+    vecmem::data::vector_view<unsigned int> masks_view) {
+
+    device::fill_hough_accumulator(threadIdx.x + blockIdx.x * blockDim.x,
+                                   config, spacepoints_view, masks_view);
+}
+
+/// CUDA kernel for running @c traccc::device::find_hough_candidates
+__global__ void find_hough_candidates(
+    const hough_seeding_config config,
+    vecmem::data::vector_view<const unsigned int> masks_view,
+    vecmem::data::vector_view<unsigned int> candidates_view,
+    vecmem::data::vector_view<unsigned int> candidate_links_view) {
+
+    device::find_hough_candidates(threadIdx.x + blockIdx.x * blockDim.x,
+                                  config, masks_view, candidates_view,
+                                  candidate_links_view);
+}
+
+/// CUDA kernel for running @c traccc::device::find_hough_edges
+__global__ void find_hough_edges(
+    const hough_seeding_config config,
+    spacepoint_collection_types::const_view spacepoints_view,
+    vecmem::data::vector_view<const unsigned int> candidate_links_view,
+    vecmem::data::vector_view<unsigned long long> bottom_view,
+    vecmem::data::vector_view<unsigned long long> top_view) {
+
+    device::find_hough_edges(threadIdx.x + blockIdx.x * blockDim.x, config,
+                             spacepoints_view, candidate_links_view,
+                             bottom_view, top_view);
+}
+
+/// CUDA kernel for running @c traccc::device::find_hough_middles
+__global__ void find_hough_middles(
+    const hough_seeding_config config,
+    spacepoint_collection_types::const_view spacepoints_view,
+    vecmem::data::vector_view<const unsigned int> candidate_links_view,
+    vecmem::data::vector_view<const unsigned long long> bottom_view,
+    vecmem::data::vector_view<const unsigned long long> top_view,
+    vecmem::data::vector_view<unsigned long long> middle_view) {
+
+    device::find_hough_middles(threadIdx.x + blockIdx.x * blockDim.x, config,
+                               spacepoints_view, candidate_links_view,
+                               bottom_view, top_view, middle_view);
+}
+
+/// CUDA kernel for running @c traccc::device::make_hough_seeds
+__global__ void make_hough_seeds(
+    const hough_seeding_config config,
+    spacepoint_collection_types::const_view spacepoints_view,
+    vecmem::data::vector_view<const unsigned int> masks_view,
+    vecmem::data::vector_view<const unsigned int> candidates_view,
+    vecmem::data::vector_view<const unsigned long long> bottom_view,
+    vecmem::data::vector_view<const unsigned long long> middle_view,
+    vecmem::data::vector_view<const unsigned long long> top_view,
+    seed_collection_types::view seeds_view) {
+
+    device::make_hough_seeds(threadIdx.x + blockIdx.x * blockDim.x, config,
+                             spacepoints_view, masks_view, candidates_view,
+                             bottom_view, middle_view, top_view, seeds_view);
+}
+
+}  // namespace kernels
+
+hough_seeding_algorithm::hough_seeding_algorithm(
+    const hough_seeding_config& config, const traccc::memory_resource& mr,
+    vecmem::copy& copy, stream& str)
+    : m_config(config), m_mr(mr), m_copy(copy), m_stream(str) {}
+
+hough_seeding_algorithm::output_type hough_seeding_algorithm::operator()(
+    const spacepoint_collection_types::const_view& spacepoints_view) const {
+
+    TRACCC_TRACE_RANGE("traccc::cuda::hough_seeding_algorithm");
+
+    // Get a convenience variable for the stream that we'll be using.
+    cudaStream_t stream = details::get_stream(m_stream);
+
+    // Get the number of spacepoints. This is a synchronous operation for a
+    // resizable buffer.
+    const unsigned int n_spacepoints = m_copy.get_size(spacepoints_view);
+    if (n_spacepoints == 0) {
+        return {0, m_mr.event_memory()};
+    }
+    const unsigned int n_cells = m_config.n_cells();
+
+    // Fill the layers of the spacepoints into the accumulator cells.
+    vecmem::data::vector_buffer<unsigned int> masks_buffer(
+        n_cells, m_mr.event_memory());
+    m_copy.setup(masks_buffer);
+    m_copy.memset(masks_buffer, 0);
+
+    const unsigned int nThreads = WARP_SIZE * 4;
+    const unsigned int nSpacepointBlocks =
+        (n_spacepoints + nThreads - 1) / nThreads;
+    details::kernel_timer fill_timer(m_stream, "fill_hough_accumulator",
+                                     nSpacepointBlocks, nThreads);
+    kernels::fill_hough_accumulator<<<nSpacepointBlocks, nThreads, 0,
+                                      stream>>>(m_config, spacepoints_view,
+                                                masks_buffer);
+    fill_timer.stop();
+    CUDA_ERROR_CHECK(cudaGetLastError());
+
+    // Find the cells to make seeds from.
+    vecmem::data::vector_buffer<unsigned int> candidates_buffer(
+        n_cells, m_mr.event_memory(), vecmem::data::buffer_type::resizable);
+    m_copy.setup(candidates_buffer);
+    vecmem::data::vector_buffer<unsigned int> candidate_links_buffer(
+        n_cells, m_mr.event_memory());
+    m_copy.setup(candidate_links_buffer);
+    m_copy.memset(candidate_links_buffer, 0);
+
+    const unsigned int nCellBlocks = (n_cells + nThreads - 1) / nThreads;
+    details::kernel_timer candidates_timer(m_stream, "find_hough_candidates",
+                                           nCellBlocks, nThreads);
+    kernels::find_hough_candidates<<<nCellBlocks, nThreads, 0, stream>>>(
+        m_config, masks_buffer, candidates_buffer, candidate_links_buffer);
+    candidates_timer.stop();
+    CUDA_ERROR_CHECK(cudaGetLastError());
+
+    // The number of candidates is needed on the host.
+    const unsigned int n_candidates = m_copy.get_size(candidates_buffer);
+    output_type seeds_buffer(n_candidates, m_mr.event_memory(),
+                             vecmem::data::buffer_type::resizable);
+    m_copy.setup(seeds_buffer);
+    if (n_candidates == 0) {
+        return seeds_buffer;
+    }
+
+    // Choose the bottom, top and middle spacepoints of the candidates.
+    vecmem::data::vector_buffer<unsigned long long> bottom_buffer(
+        n_candidates, m_mr.event_memory());
+    vecmem::data::vector_buffer<unsigned long long> middle_buffer(
+        n_candidates, m_mr.event_memory());
+    vecmem::data::vector_buffer<unsigned long long> top_buffer(
+        n_candidates, m_mr.event_memory());
+    m_copy.setup(bottom_buffer);
+    m_copy.setup(middle_buffer);
+    m_copy.setup(top_buffer);
+    m_copy.memset(bottom_buffer, 0xff);
+    m_copy.memset(middle_buffer, 0xff);
+    m_copy.memset(top_buffer, 0xff);
+
+    details::kernel_timer edges_timer(m_stream, "find_hough_edges",
+                                      nSpacepointBlocks, nThreads);
+    kernels::find_hough_edges<<<nSpacepointBlocks, nThreads, 0, stream>>>(
+        m_config, spacepoints_view, candidate_links_buffer, bottom_buffer,
+        top_buffer);
+    edges_timer.stop();
+    CUDA_ERROR_CHECK(cudaGetLastError());
+
+    details::kernel_timer middles_timer(m_stream, "find_hough_middles",
+                                        nSpacepointBlocks, nThreads);
+    kernels::find_hough_middles<<<nSpacepointBlocks, nThreads, 0, stream>>>(
+        m_config, spacepoints_view, candidate_links_buffer, bottom_buffer,
+        top_buffer, middle_buffer);
+    middles_timer.stop();
+    CUDA_ERROR_CHECK(cudaGetLastError());
+
+    // Make the seeds.
+    const unsigned int nCandidateBlocks =
+        (n_candidates + nThreads - 1) / nThreads;
+    details::kernel_timer seeds_timer(m_stream, "make_hough_seeds",
+                                      nCandidateBlocks, nThreads);
+    kernels::make_hough_seeds<<<nCandidateBlocks, nThreads, 0, stream>>>(
+        m_config, spacepoints_view, masks_buffer, candidates_buffer,
+        bottom_buffer, middle_buffer, top_buffer, seeds_buffer);
+    seeds_timer.stop();
+    CUDA_ERROR_CHECK(cudaGetLastError());
+
+    return seeds_buffer;
+}
+
+}  // namespace traccc::cuda
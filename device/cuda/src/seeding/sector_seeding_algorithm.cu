@@ -0,0 +1,204 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Local include(s).
+#include "../utils/kernel_timer.hpp"
+#include "../utils/utils.hpp"
+#include "traccc/cuda/seeding/sector_seeding_algorithm.hpp"
+#include "traccc/cuda/utils/definitions.hpp"
+
+// Project include(s).
+#include "traccc/seeding/device/merge_sector_seeds.hpp"
+#include "traccc/seeding/device/select_sector_spacepoints.hpp"
+#include "traccc/utils/trace.hpp"
+
+// VecMem include(s).
+#include <vecmem/containers/data/vector_buffer.hpp>
+#include <vecmem/utils/cuda/async_copy.hpp>
+
+// System include(s).
+#include <future>
+#include <stdexcept>
+
+namespace traccc::cuda {
+namespace kernels {
+
+/// CUDA kernel for running @c traccc::device::select_sector_spacepoints
+__global__ void select_sector_spacepoints(
+    spacepoint_collection_types::const_view spacepoints_view,
+    unsigned int sector, unsigned int n_sectors, scalar overlap,
+    spacepoint_collection_types::view selected_view,
+    vecmem::data::vector_view<unsigned int> indices_view) {
+
+    device::select_sector_spacepoints(threadIdx.x + blockIdx.x * blockDim.x,
+                                      spacepoints_view, sector, n_sectors,
+                                      overlap, selected_view, indices_view);
+}
+
+/// CUDA kernel for running @c traccc::device::merge_sector_seeds
+__global__ void merge_sector_seeds(
+    seed_collection_types::const_view sector_seeds_view,
+    spacepoint_collection_types::const_view sector_spacepoints_view,
+    vecmem::data::vector_view<const unsigned int> indices_view,
+    unsigned int sector, unsigned int n_sectors,
+    seed_collection_types::view seeds_view) {
+
+    device::merge_sector_seeds(threadIdx.x + blockIdx.x * blockDim.x,
+                               sector_seeds_view, sector_spacepoints_view,
+                               indices_view, sector, n_sectors, seeds_view);
+}
+
+}  // namespace kernels
+
+struct sector_seeding_algorithm::sector {
+
+    /// Constructor
+    sector(const seedfinder_config& finder_config,
+           const spacepoint_grid_config& grid_config,
+           const seedfilter_config& filter_config,
+           const traccc::memory_resource& mr, int device)
+        : str(device),
+          copy(str.cudaStream()),
+          seeding(finder_config, grid_config, filter_config, mr, copy, str) {}
+
+    /// The stream of the sector
+    stream str;
+    /// The copy object of the sector, working on its stream
+    vecmem::cuda::async_copy copy;
+    /// The seeding of the sector
+    seeding_algorithm seeding;
+
+};  // struct sector_seeding_algorithm::sector
+
+namespace {
+
+/// The results of the seeding of one sector
+struct sector_result {
+    /// The spacepoints of the sector
+    spacepoint_collection_types::buffer spacepoints;
+    /// The indices of the sector's spacepoints in the full event
+    vecmem::data::vector_buffer<unsigned int> indices;
+    /// The seeds found in the sector
+    seed_collection_types::buffer seeds;
+};
+
+}  // namespace
+
+sector_seeding_algorithm::sector_seeding_algorithm(
+    const seedfinder_config& finder_config,
+    const spacepoint_grid_config& grid_config,
+    const seedfilter_config& filter_config, const traccc::memory_resource& mr,
+    vecmem::copy& copy, stream& str, unsigned int n_sectors, scalar overlap)
+    : m_mr(mr),
+      m_copy(copy),
+      m_stream(str),
+      m_device(details::get_device()),
+      m_overlap(overlap) {
+
+    if (n_sectors == 0u) {
+        throw std::invalid_argument("At least one phi sector is needed");
+    }
+    m_sectors.reserve(n_sectors);
+    for (unsigned int i = 0; i < n_sectors; ++i) {
+        m_sectors.push_back(std::make_unique<sector>(
+            finder_config, grid_config, filter_config, mr, m_device));
+    }
+}
+
+sector_seeding_algorithm::~sector_seeding_algorithm() = default;
+
+sector_seeding_algorithm::output_type sector_seeding_algorithm::operator()(
+    const spacepoint_collection_types::const_view& spacepoints_view) const {
+
+    TRACCC_TRACE_RANGE("traccc::cuda::sector_seeding_algorithm");
+
+    // Make sure that the spacepoints are available to the other streams.
+    const unsigned int num_spacepoints = m_copy.get_size(spacepoints_view);
+    m_stream.synchronize();
+
+    // Run the seeding of every sector in its own thread, on its own stream.
+    const unsigned int n_sectors =
+        static_cast<unsigned int>(m_sectors.size());
+    std::vector<std::future<sector_result>> futures;
+    futures.reserve(n_sectors);
+    for (unsigned int i = 0; i < n_sectors; ++i) {
+        futures.push_back(std::async(std::launch::async, [&, i]() {
+            details::select_device device(m_device);
+            sector& sec = *(m_sectors[i]);
+
+            // Select the spacepoints of the sector.
+            sector_result result{
+                {num_spacepoints, m_mr.event_memory(),
+                 vecmem::data::buffer_type::resizable},
+                {num_spacepoints, m_mr.event_memory()},
+                {}};
+            sec.copy.setup(result.spacepoints);
+            sec.copy.setup(result.indices);
+            if (num_spacepoints > 0) {
+                const unsigned int nThreads = WARP_SIZE * 2;
+                const unsigned int nBlocks =
+                    (num_spacepoints + nThreads - 1) / nThreads;
+                details::kernel_timer timer(sec.str,
+                                            "select_sector_spacepoints",
+                                            nBlocks, nThreads);
+                kernels::select_sector_spacepoints<<<
+                    nBlocks, nThreads, 0, details::get_stream(sec.str)>>>(
+                    spacepoints_view, i, n_sectors, m_overlap,
+                    result.spacepoints, result.indices);
+                timer.stop();
+                CUDA_ERROR_CHECK(cudaGetLastError());
+            }
+
+            // Find the seeds of the sector.
+            result.seeds = sec.seeding(result.spacepoints);
+            sec.str.synchronize();
+            return result;
+        }));
+    }
+
+    // Collect the results of the sectors.
+    std::vector<sector_result> results;
+    results.reserve(n_sectors);
+    for (std::future<sector_result>& f : futures) {
+        results.push_back(f.get());
+    }
+    unsigned int max_seeds = 0;
+    std::vector<unsigned int> num_sector_seeds;
+    num_sector_seeds.reserve(n_sectors);
+    for (const sector_result& result : results) {
+        num_sector_seeds.push_back(m_copy.get_size(result.seeds));
+        max_seeds += num_sector_seeds.back();
+    }
+
+    // Merge the seeds of the sectors, dropping the duplicates.
+    output_type seeds(max_seeds, m_mr.event_memory(),
+                      vecmem::data::buffer_type::resizable);
+    m_copy.setup(seeds);
+    cudaStream_t stream = details::get_stream(m_stream);
+    for (unsigned int i = 0; i < n_sectors; ++i) {
+        if (num_sector_seeds[i] == 0) {
+            continue;
+        }
+        const unsigned int nThreads = WARP_SIZE * 2;
+        const unsigned int nBlocks =
+            (num_sector_seeds[i] + nThreads - 1) / nThreads;
+        details::kernel_timer timer(m_stream, "merge_sector_seeds", nBlocks,
+                                    nThreads);
+        kernels::merge_sector_seeds<<<nBlocks, nThreads, 0, stream>>>(
+            results[i].seeds, results[i].spacepoints, results[i].indices, i,
+            n_sectors, seeds);
+        timer.stop();
+        CUDA_ERROR_CHECK(cudaGetLastError());
+    }
+
+    // Make sure that the merging has finished before the buffers of the
+    // sectors are released.
+    m_stream.synchronize();
+    return seeds;
+}
+
+}  // namespace traccc::cuda
@@ -0,0 +1,89 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Local include(s).
+#include "../utils/kernel_timer.hpp"
+#include "../utils/utils.hpp"
+#include "traccc/cuda/seeding/seed_extension.hpp"
+#include "traccc/cuda/utils/definitions.hpp"
+
+// Project include(s).
+#include "traccc/seeding/device/extend_seeds.hpp"
+#include "traccc/utils/trace.hpp"
+
+namespace traccc::cuda {
+namespace kernels {
+
+/// CUDA kernel for running @c traccc::device::extend_seeds
+__global__ void extend_seeds(
+    seedfinder_config finder_config, seed_extension_config extension_config,
+    spacepoint_collection_types::const_view spacepoints,
+    sp_soa_grid_types::const_view grid,
+    seed_collection_types::const_view seeds,
+    extended_seed_collection_types::view nseeds,
+    seed_collection_types::view kept_seeds) {
+
+    device::extend_seeds(threadIdx.x + blockIdx.x * blockDim.x, finder_config,
+                         extension_config, spacepoints, grid, seeds, nseeds,
+                         kept_seeds);
+}
+
+}  // namespace kernels
+
+seed_extension::seed_extension(const seedfinder_config& finder_config,
+                               const seed_extension_config& extension_config,
+                               const traccc::memory_resource& mr,
+                               vecmem::copy& copy, stream& str)
+    : m_finder_config(finder_config),
+      m_extension_config(extension_config),
+      m_mr(mr),
+      m_copy(copy),
+      m_stream(str) {}
+
+seed_extension::output_type seed_extension::operator()(
+    const spacepoint_collection_types::const_view& spacepoints_view,
+    const sp_soa_grid_types::const_view& g2_view,
+    const seed_collection_types::const_view& seeds_view) const {
+
+    TRACCC_TRACE_RANGE("traccc::cuda::seed_extension");
+
+    // Get a convenience variable for the stream that we'll be using.
+    cudaStream_t stream = details::get_stream(m_stream);
+
+    // Get the number of seeds from the view.
+    const unsigned int n_seeds = m_copy.get_size(seeds_view);
+
+    // Create the result buffers.
+    output_type result{
+        extended_seed_collection_types::buffer(n_seeds, m_mr.event_memory()),
+        seed_collection_types::buffer(n_seeds, m_mr.event_memory(),
+                                      vecmem::data::buffer_type::resizable)};
+    m_copy.setup(result.first);
+    m_copy.setup(result.second);
+
+    // Return right away if there are no seeds.
+    if (n_seeds == 0) {
+        return result;
+    }
+
+    // Extend every seed with a separate thread.
+    const unsigned int num_threads = WARP_SIZE * 2;
+    const unsigned int num_blocks = (n_seeds + num_threads - 1) / num_threads;
+    details::kernel_timer extend_seeds_timer(m_stream, "extend_seeds",
+                                             num_blocks, num_threads);
+    kernels::extend_seeds<<<num_blocks, num_threads, 0, stream>>>(
+        m_finder_config, m_extension_config, spacepoints_view, g2_view,
+        seeds_view, vecmem::get_data(result.first),
+        vecmem::get_data(result.second));
+    extend_seeds_timer.stop();
+    CUDA_ERROR_CHECK(cudaGetLastError());
+
+    // Return the result buffers.
+    return result;
+}
+
+}  // namespace traccc::cuda
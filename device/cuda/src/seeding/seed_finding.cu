@@ -1,19 +1,19 @@
 /** TRACCC library, part of the ACTS project (R&D line)
  *
- * (c) 2021-2023 CERN for the benefit of the ACTS project
+ * (c) 2021-2024 CERN for the benefit of the ACTS project
  *
  * Mozilla Public License Version 2.0
  */
 
 // Local include(s).
+#include "../utils/kernel_timer.hpp"
 #include "../utils/utils.hpp"
+#include "../utils/warp_sort.cuh"
 #include "traccc/cuda/seeding/seed_finding.hpp"
+#include "traccc/cuda/utils/barrier.hpp"
 #include "traccc/cuda/utils/definitions.hpp"
 
 // Project include(s).
-#include "traccc/cuda/utils/make_prefix_sum_buff.hpp"
-#include "traccc/device/fill_prefix_sum.hpp"
-#include "traccc/device/make_prefix_sum_buffer.hpp"
 #include "traccc/edm/device/device_doublet.hpp"
 #include "traccc/edm/device/device_triplet.hpp"
 #include "traccc/edm/device/doublet_counter.hpp"
@@ -25,53 +25,84 @@
 #include "traccc/seeding/device/find_triplets.hpp"
 #include "traccc/seeding/device/reduce_triplet_counts.hpp"
 #include "traccc/seeding/device/select_seeds.hpp"
+#include "traccc/seeding/device/set_seeding_buffer_sizes.hpp"
 #include "traccc/seeding/device/update_triplet_weights.hpp"
+#include "traccc/seeding/detail/static_seeding_config.hpp"
+#include "traccc/seeding/seed_selecting_helper.hpp"
+#include "traccc/utils/trace.hpp"
+#include "traccc/utils/work_model.hpp"
 
 // VecMem include(s).
 #include "vecmem/utils/cuda/copy.hpp"
 
 // System include(s).
 #include <algorithm>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
 #include <vector>
 
 namespace traccc::cuda {
 namespace kernels {
 
+/// The number of threads per block of the kernels using per-thread arrays in
+/// shared memory, which the static seeding configurations size exactly
+constexpr unsigned int shared_array_threads = WARP_SIZE * 2;
+
+/// The number of threads per block of the tiled triplet finding kernel
+constexpr unsigned int triplet_tile_threads = WARP_SIZE * 2;
+/// The largest number of midTop doublets of a middle spacepoint that the
+/// tiled triplet finding kernel handles
+constexpr unsigned int triplet_tile_size = 256;
+
 /// CUDA kernel for running @c traccc::device::count_doublets
+template <typename seeding_config_t>
 __global__ void count_doublets(
-    seedfinder_config config, sp_grid_const_view sp_grid,
-    vecmem::data::vector_view<const device::prefix_sum_element_t> sp_prefix_sum,
+    seedfinder_config config, sp_soa_grid_types::const_view sp_grid,
     device::doublet_counter_collection_types::view doublet_counter,
     unsigned int& nMidBot, unsigned int& nMidTop) {
 
-    device::count_doublets(threadIdx.x + blockIdx.x * blockDim.x, config,
-                           sp_grid, sp_prefix_sum, doublet_counter, nMidBot,
-                           nMidTop);
+    device::count_doublets<seeding_config_t>(
+        threadIdx.x + blockIdx.x * blockDim.x, config, sp_grid,
+        doublet_counter, nMidBot, nMidTop);
+}
+
+/// CUDA kernel for running @c traccc::device::set_doublet_buffer_sizes
+__global__ void set_doublet_buffer_sizes(
+    const device::seeding_global_counter& counter,
+    device::device_doublet_collection_types::view mb_doublets,
+    device::device_doublet_collection_types::view mt_doublets) {
+
+    device::set_doublet_buffer_sizes(threadIdx.x + blockIdx.x * blockDim.x,
+                                     counter, mb_doublets, mt_doublets);
 }
 
 /// CUDA kernel for running @c traccc::device::find_doublets
+template <typename seeding_config_t>
 __global__ void find_doublets(
-    seedfinder_config config, sp_grid_const_view sp_grid,
+    seedfinder_config config, sp_soa_grid_types::const_view sp_grid,
     device::doublet_counter_collection_types::const_view doublet_counter,
     device::device_doublet_collection_types::view mb_doublets,
     device::device_doublet_collection_types::view mt_doublets) {
 
-    device::find_doublets(threadIdx.x + blockIdx.x * blockDim.x, config,
-                          sp_grid, doublet_counter, mb_doublets, mt_doublets);
+    device::find_doublets<seeding_config_t>(
+        threadIdx.x + blockIdx.x * blockDim.x, config, sp_grid,
+        doublet_counter, mb_doublets, mt_doublets);
 }
 
 /// CUDA kernel for running @c traccc::device::count_triplets
 __global__ void count_triplets(
-    seedfinder_config config, sp_grid_const_view sp_grid,
+    seedfinder_config config, sp_soa_grid_types::const_view sp_grid,
     device::doublet_counter_collection_types::const_view doublet_counter,
     device::device_doublet_collection_types::const_view mb_doublets,
     device::device_doublet_collection_types::const_view mt_doublets,
     device::triplet_counter_spM_collection_types::view spM_counter,
-    device::triplet_counter_collection_types::view midBot_counter) {
+    device::triplet_counter_collection_types::view midBot_counter,
+    vecmem::data::vector_view<unsigned int> midBot_counter_links) {
 
     device::count_triplets(threadIdx.x + blockIdx.x * blockDim.x, config,
                            sp_grid, doublet_counter, mb_doublets, mt_doublets,
-                           spM_counter, midBot_counter);
+                           spM_counter, midBot_counter, midBot_counter_links);
 }
 
 /// CUDA kernel for running @c traccc::device::reduce_triplet_counts
@@ -84,10 +115,19 @@ __global__ void reduce_triplet_counts(
                                   doublet_counter, spM_counter, num_triplets);
 }
 
+/// CUDA kernel for running @c traccc::device::set_triplet_buffer_size
+__global__ void set_triplet_buffer_size(
+    const device::seeding_global_counter& counter,
+    device::device_triplet_collection_types::view triplets) {
+
+    device::set_triplet_buffer_size(threadIdx.x + blockIdx.x * blockDim.x,
+                                    counter, triplets);
+}
+
 /// CUDA kernel for running @c traccc::device::find_triplets
 __global__ void find_triplets(
     seedfinder_config config, seedfilter_config filter_config,
-    sp_grid_const_view sp_grid,
+    sp_soa_grid_types::const_view sp_grid,
     device::doublet_counter_collection_types::const_view doublet_counter,
     device::device_doublet_collection_types::const_view mt_doublets,
     device::triplet_counter_spM_collection_types::const_view spM_tc,
@@ -96,46 +136,220 @@ __global__ void find_triplets(
 
     device::find_triplets(threadIdx.x + blockIdx.x * blockDim.x, config,
                           filter_config, sp_grid, doublet_counter, mt_doublets,
-                          spM_tc, midBot_tc, triplet_view);
+                          spM_tc, midBot_tc, triplet_view, triplet_tile_size);
+}
+
+/// CUDA kernel for running @c traccc::device::find_triplets_tiled
+__global__ void find_triplets_tiled(
+    seedfinder_config config, seedfilter_config filter_config,
+    sp_soa_grid_types::const_view sp_grid,
+    device::doublet_counter_collection_types::const_view doublet_counter,
+    device::device_doublet_collection_types::const_view mb_doublets,
+    device::device_doublet_collection_types::const_view mt_doublets,
+    device::triplet_counter_spM_collection_types::const_view spM_tc,
+    device::triplet_counter_collection_types::const_view midBot_tc,
+    vecmem::data::vector_view<const unsigned int> midBot_tc_links,
+    device::device_triplet_collection_types::view triplet_view) {
+
+    __shared__ lin_circle tile_circles[triplet_tile_size];
+    __shared__ unsigned int tile_locations[triplet_tile_size];
+    traccc::cuda::barrier barry_r;
+
+    device::find_triplets_tiled(
+        threadIdx.x, blockDim.x, blockIdx.x, config, filter_config, sp_grid,
+        doublet_counter, mb_doublets, mt_doublets, spM_tc, midBot_tc,
+        midBot_tc_links, tile_circles, tile_locations, triplet_tile_size,
+        barry_r, triplet_view);
 }
 
 /// CUDA kernel for running @c traccc::device::update_triplet_weights
+template <typename seeding_config_t>
 __global__ void update_triplet_weights(
-    seedfilter_config filter_config, sp_grid_const_view sp_grid,
+    seedfilter_config filter_config, sp_soa_grid_types::const_view sp_grid,
     device::triplet_counter_spM_collection_types::const_view spM_tc,
     device::triplet_counter_collection_types::const_view midBot_tc,
     device::device_triplet_collection_types::view triplet_view) {
 
     // Array for temporary storage of quality parameters for comparing triplets
-    // within weight updating kernel
-    extern __shared__ scalar data[];
-    // Each thread uses compatSeedLimit elements of the array
-    scalar* dataPos = &data[threadIdx.x * filter_config.compatSeedLimit];
-
-    device::update_triplet_weights(threadIdx.x + blockIdx.x * blockDim.x,
-                                   filter_config, sp_grid, spM_tc, midBot_tc,
-                                   dataPos, triplet_view);
+    // within weight updating kernel. Each thread uses compatSeedLimit elements
+    // of the array.
+    scalar* dataPos = nullptr;
+    if constexpr (seeding_config_t::is_static) {
+        __shared__ scalar data[seeding_config_t::k_compat_seed_limit *
+                               shared_array_threads];
+        dataPos = &data[threadIdx.x * seeding_config_t::k_compat_seed_limit];
+    } else {
+        extern __shared__ scalar data[];
+        dataPos = &data[threadIdx.x * filter_config.compatSeedLimit];
+    }
+
+    device::update_triplet_weights<seeding_config_t>(
+        threadIdx.x + blockIdx.x * blockDim.x, filter_config, sp_grid, spM_tc,
+        midBot_tc, dataPos, triplet_view);
 }
 
 /// CUDA kernel for running @c traccc::device::select_seeds
+template <typename seeding_config_t>
 __global__ void select_seeds(
     seedfilter_config filter_config,
     spacepoint_collection_types::const_view spacepoints_view,
-    sp_grid_const_view internal_sp_view,
+    sp_soa_grid_types::const_view internal_sp_view,
     device::triplet_counter_spM_collection_types::const_view spM_tc,
     device::triplet_counter_collection_types::const_view midBot_tc,
     device::device_triplet_collection_types::view triplet_view,
-    seed_collection_types::view seed_view) {
+    seed_collection_types::view seed_view,
+    bound_track_parameters_collection_types::view params_view,
+    device::seed_params_config params_config) {
 
     // Array for temporary storage of triplets for comparing within seed
-    // selecting kernel
-    extern __shared__ triplet data2[];
-    // Each thread uses max_triplets_per_spM elements of the array
-    triplet* dataPos = &data2[threadIdx.x * filter_config.max_triplets_per_spM];
-
-    device::select_seeds(threadIdx.x + blockIdx.x * blockDim.x, filter_config,
-                         spacepoints_view, internal_sp_view, spM_tc, midBot_tc,
-                         triplet_view, dataPos, seed_view);
+    // selecting kernel. Each thread uses max_triplets_per_spM elements of the
+    // array.
+    device::device_triplet* dataPos = nullptr;
+    if constexpr (seeding_config_t::is_static) {
+        __shared__ typename std::aligned_storage<
+            sizeof(device::device_triplet),
+            alignof(device::device_triplet)>::type
+            data2[seeding_config_t::k_max_triplets_per_spM *
+                  shared_array_threads];
+        dataPos = reinterpret_cast<device::device_triplet*>(data2) +
+                  threadIdx.x * seeding_config_t::k_max_triplets_per_spM;
+    } else {
+        extern __shared__ device::device_triplet data2[];
+        dataPos = &data2[threadIdx.x * filter_config.max_triplets_per_spM];
+    }
+
+    device::select_seeds<seeding_config_t>(
+        threadIdx.x + blockIdx.x * blockDim.x, filter_config, spacepoints_view,
+        internal_sp_view, spM_tc, midBot_tc, triplet_view, dataPos, seed_view,
+        params_view, params_config);
+}
+
+/// CUDA kernel selecting the seeds of every middle spacepoint with a full warp
+///
+/// Unlike @c traccc::device::select_seeds, which keeps the best triplets of a
+/// middle spacepoint in a per-thread array, the lanes of the warp evaluate
+/// @c WARP_SIZE triplets at a time, and merge them into the best triplets
+/// found so far with a bitonic sorting network. Which also orders the best
+/// triplets the same way as @c traccc::device::select_seeds does.
+///
+template <typename seeding_config_t>
+__global__ void select_seeds_warp(
+    seedfilter_config filter_config,
+    spacepoint_collection_types::const_view spacepoints_view,
+    sp_soa_grid_types::const_view internal_sp_view,
+    device::triplet_counter_spM_collection_types::const_view spM_tc_view,
+    device::triplet_counter_collection_types::const_view tc_view,
+    device::device_triplet_collection_types::const_view triplet_view,
+    seed_collection_types::view seed_view,
+    bound_track_parameters_collection_types::view params_view,
+    device::seed_params_config params_config) {
+
+    // Every warp processes one middle spacepoint. The early returns are the
+    // same for all lanes of a warp.
+    const unsigned int lane = threadIdx.x % WARP_SIZE;
+    const unsigned int spM_idx =
+        (threadIdx.x + blockIdx.x * blockDim.x) / WARP_SIZE;
+    const device::triplet_counter_spM_collection_types::const_device
+        triplet_counts_spM(spM_tc_view);
+    if (spM_idx >= triplet_counts_spM.size()) {
+        return;
+    }
+    const device::triplet_counter_spM spM_counter =
+        triplet_counts_spM.at(spM_idx);
+    if (spM_counter.m_nTriplets == 0) {
+        return;
+    }
+
+    // Set up the device containers
+    const device::triplet_counter_collection_types::const_device
+        triplet_counts(tc_view);
+    const spacepoint_collection_types::const_device spacepoints(
+        spacepoints_view);
+    const sp_soa_grid_types::const_device internal_sp_device(internal_sp_view);
+    const device::device_triplet_collection_types::const_device triplets(
+        triplet_view);
+    seed_collection_types::device seeds_device(seed_view);
+
+    const internal_spacepoint<spacepoint> spM =
+        internal_sp_device.at(spM_counter.spM);
+
+    // Find the best triplets of the middle spacepoint, WARP_SIZE at a time.
+    const unsigned int begin_triplets_spM = spM_counter.posTriplets;
+    const unsigned int end_triplets_spM = std::min(
+        spM_counter.posTriplets + spM_counter.m_nTriplets, triplets.size());
+    details::warp_candidate best{0.f, 0.f,
+                                 details::warp_candidate::invalid_index};
+    for (unsigned int chunk = begin_triplets_spM; chunk < end_triplets_spM;
+         chunk += WARP_SIZE) {
+
+        details::warp_candidate candidate{
+            0.f, 0.f, details::warp_candidate::invalid_index};
+        const unsigned int i = chunk + lane;
+        if (i < end_triplets_spM) {
+            const device::device_triplet aTriplet = triplets[i];
+            const internal_spacepoint<spacepoint> spB = internal_sp_device.at(
+                triplet_counts.at(aTriplet.counter_link).spB);
+            const internal_spacepoint<spacepoint> spT =
+                internal_sp_device.at(aTriplet.spT);
+
+            // Update the weight of the triplet, and check if it is a good
+            // triplet.
+            scalar weight = aTriplet.weight;
+            seed_selecting_helper::seed_weight(filter_config, spM, spB, spT,
+                                               weight);
+            if (seed_selecting_helper::single_seed_cut(filter_config, spM, spB,
+                                                       spT, weight)) {
+                const spacepoint& gspB = spacepoints.at(spB.m_link);
+                const spacepoint& gspT = spacepoints.at(spT.m_link);
+                candidate = {weight,
+                             gspB.y() * gspB.y() + gspB.z() * gspB.z() +
+                                 gspT.y() * gspT.y() + gspT.z() * gspT.z(),
+                             i};
+            }
+        }
+        best = details::warp_merge_top(best,
+                                       details::warp_bitonic_sort(candidate));
+    }
+
+    // Iterate over the (at most max_triplets_per_spM) best triplets, in
+    // decreasing order, for the final selection of the seeds. Every lane
+    // evaluates the same triplet, and the first lane records the seeds.
+    const unsigned int max_triplets_per_spM =
+        seeding_config_t::max_triplets_per_spM(filter_config);
+    const unsigned int max_seeds_per_spM =
+        seeding_config_t::max_seeds_per_spM(filter_config);
+    unsigned int n_seeds_per_spM = 0;
+    for (unsigned int k = 0; k < max_triplets_per_spM; ++k) {
+
+        const details::warp_candidate candidate =
+            details::shfl_candidate(best, k);
+        if (!candidate.valid() || n_seeds_per_spM >= max_seeds_per_spM + 1) {
+            break;
+        }
+
+        const device::device_triplet aTriplet = triplets[candidate.index];
+        const internal_spacepoint<spacepoint> spB = internal_sp_device.at(
+            triplet_counts.at(aTriplet.counter_link).spB);
+        const internal_spacepoint<spacepoint> spT =
+            internal_sp_device.at(aTriplet.spT);
+        const seed aSeed({spB.m_link, spM.m_link, spT.m_link, candidate.weight,
+                          aTriplet.z_vertex});
+
+        if (seed_selecting_helper::cut_per_middle_sp(
+                filter_config, spacepoints, aSeed, candidate.weight) ||
+            n_seeds_per_spM == 0) {
+
+            n_seeds_per_spM++;
+            if (lane == 0) {
+                const unsigned int seed_idx = seeds_device.push_back(aSeed);
+                if (params_view.ptr() != nullptr) {
+                    params_view.ptr()[seed_idx] = device::seed_to_track_params(
+                        spacepoints, aSeed, params_config.bfield,
+                        params_config.stddev);
+                }
+            }
+        }
+    }
 }
 
 }  // namespace kernels
@@ -143,35 +357,145 @@ __global__ void select_seeds(
 seed_finding::seed_finding(const seedfinder_config& config,
                            const seedfilter_config& filter_config,
                            const traccc::memory_resource& mr,
-                           vecmem::copy& copy, stream& str)
+                           vecmem::copy& copy, stream& str,
+                           const seed_finding_capacities& capacities,
+                           const seed_selection_config& selection)
     : m_seedfinder_config(config),
       m_seedfilter_config(filter_config),
+      m_capacities(capacities),
+      m_mid_bot_predictor({capacities.adaptive_history,
+                           capacities.adaptive_margin}),
+      m_mid_top_predictor({capacities.adaptive_history,
+                           capacities.adaptive_margin}),
+      m_triplet_predictor({capacities.adaptive_history,
+                           capacities.adaptive_margin}),
+      m_selection(selection),
       m_mr(mr),
       m_copy(copy),
-      m_stream(str) {}
+      m_stream(str) {
+
+    if (m_selection.warp_cooperative &&
+        ((m_seedfilter_config.max_triplets_per_spM > WARP_SIZE) ||
+         (m_selection.warps_per_block == 0))) {
+        throw std::invalid_argument(
+            "Invalid configuration for the warp-cooperative seed selection");
+    }
+
+    // Use the kernels specialised for the configuration, if there are any.
+    if (m_selection.use_presets) {
+        if (seeding_presets::default_config::matches(m_seedfinder_config,
+                                                     m_seedfilter_config)) {
+            m_preset = seeding_preset::default_config;
+        } else if (seeding_presets::dense_config::matches(
+                       m_seedfinder_config, m_seedfilter_config)) {
+            m_preset = seeding_preset::dense_config;
+        }
+    }
+}
 
 seed_finding::output_type seed_finding::operator()(
     const spacepoint_collection_types::const_view& spacepoints_view,
-    const sp_grid_const_view& g2_view) const {
+    const sp_soa_grid_types::const_view& g2_view) const {
 
-    // Get a convenience variable for the stream that we'll be using.
-    cudaStream_t stream = details::get_stream(m_stream);
+    TRACCC_TRACE_RANGE("traccc::cuda::seed_finding");
 
-    // Get the sizes from the grid view
-    auto grid_sizes = m_copy.get_sizes(g2_view._data_view);
+    return find(spacepoints_view, g2_view, nullptr).first;
+}
+
+seed_finding::params_output_type seed_finding::operator()(
+    const spacepoint_collection_types::const_view& spacepoints_view,
+    const sp_soa_grid_types::const_view& g2_view, const vector3& bfield,
+    const std::array<traccc::scalar, traccc::e_bound_size>& stddev) const {
 
-    // Create prefix sum buffer
-    vecmem::data::vector_buffer sp_grid_prefix_sum_buff =
-        make_prefix_sum_buff(grid_sizes, m_copy, m_mr, m_stream);
+    TRACCC_TRACE_RANGE("traccc::cuda::seed_finding");
 
-    const auto num_spacepoints = m_copy.get_size(sp_grid_prefix_sum_buff);
+    const device::seed_params_config params_config{bfield, stddev};
+    return find(spacepoints_view, g2_view, &params_config);
+}
+
+seed_finding::params_output_type seed_finding::find(
+    const spacepoint_collection_types::const_view& spacepoints_view,
+    const sp_soa_grid_types::const_view& g2_view,
+    const device::seed_params_config* params_config) const {
+
+    // Get the number of spacepoints in the grid. The threads of the doublet
+    // counting can find their spacepoints using the offsets of the bins, so
+    // no prefix sum is needed for iterating over the grid.
+    const auto num_spacepoints = m_copy.get_size(g2_view.x);
     if (num_spacepoints == 0) {
-        return {0, m_mr.main};
+        return {{0, m_mr.event_memory()}, {0, m_mr.event_memory()}};
+    }
+
+    // Try to find the seeds with bounded capacities first, if configured to,
+    // or if the capacities could be predicted from the previous events.
+    bool fits = false;
+    params_output_type result{{0, m_mr.event_memory()},
+                              {0, m_mr.event_memory()}};
+    if (m_capacities.enabled() ||
+        (m_capacities.adaptive && m_triplet_predictor.ready())) {
+        result = find_seeds(spacepoints_view, g2_view, num_spacepoints, true,
+                            params_config, fits);
+    }
+
+    // Find the seeds with exactly sized buffers otherwise.
+    if (!fits) {
+        result = find_seeds(spacepoints_view, g2_view, num_spacepoints, false,
+                            params_config, fits);
     }
 
+    // Record the estimated work (of the binning and the seed finding). The
+    // number of seeds is only read back when it is needed for this.
+    if (counting_work()) {
+        count_work(work_model::seeding(num_spacepoints,
+                                       m_copy.get_size(result.first)));
+    }
+    return result;
+}
+
+seed_finding::params_output_type seed_finding::find_seeds(
+    const spacepoint_collection_types::const_view& spacepoints_view,
+    const sp_soa_grid_types::const_view& g2_view, unsigned int num_spacepoints,
+    bool bounded, const device::seed_params_config* params_config,
+    bool& fits) const {
+
+    switch (m_preset) {
+        case seeding_preset::default_config:
+            return find_seeds_impl<seeding_presets::default_config>(
+                spacepoints_view, g2_view, num_spacepoints, bounded,
+                params_config, fits);
+        case seeding_preset::dense_config:
+            return find_seeds_impl<seeding_presets::dense_config>(
+                spacepoints_view, g2_view, num_spacepoints, bounded,
+                params_config, fits);
+        default:
+            return find_seeds_impl<runtime_seeding_config>(
+                spacepoints_view, g2_view, num_spacepoints, bounded,
+                params_config, fits);
+    }
+}
+
+template <typename seeding_config_t>
+seed_finding::params_output_type seed_finding::find_seeds_impl(
+    const spacepoint_collection_types::const_view& spacepoints_view,
+    const sp_soa_grid_types::const_view& g2_view, unsigned int num_spacepoints,
+    bool bounded, const device::seed_params_config* params_config,
+    bool& fits) const {
+
+    // Get a convenience variable for the stream that we'll be using.
+    cudaStream_t stream = details::get_stream(m_stream);
+
+    // Without bounded capacities, the buffers always fit.
+    fits = true;
+
+    // The type of the (doublet and triplet) buffers to use.
+    const vecmem::data::buffer_type buffer_type =
+        (bounded ? vecmem::data::buffer_type::resizable
+                 : vecmem::data::buffer_type::fixed_size);
+
     // Set up the doublet counter buffer.
     device::doublet_counter_collection_types::buffer doublet_counter_buffer = {
-        num_spacepoints, m_mr.main, vecmem::data::buffer_type::resizable};
+        num_spacepoints, m_mr.event_memory(),
+        vecmem::data::buffer_type::resizable};
     m_copy.setup(doublet_counter_buffer);
 
     // Calculate the number of threads and thread blocks to run the doublet
@@ -184,83 +508,132 @@ seed_finding::output_type seed_finding::operator()(
     vecmem::unique_alloc_ptr<device::seeding_global_counter>
         globalCounter_device =
             vecmem::make_unique_alloc<device::seeding_global_counter>(
-                m_mr.main);
+                m_mr.event_memory());
     CUDA_ERROR_CHECK(cudaMemsetAsync(globalCounter_device.get(), 0,
                                      sizeof(device::seeding_global_counter),
                                      stream));
 
     // Count the number of doublets that we need to produce.
-    kernels::count_doublets<<<nDoubletCountBlocks, nDoubletCountThreads, 0,
-                              stream>>>(
-        m_seedfinder_config, g2_view, sp_grid_prefix_sum_buff,
-        doublet_counter_buffer, (*globalCounter_device).m_nMidBot,
-        (*globalCounter_device).m_nMidTop);
+    details::kernel_timer count_doublets_timer(m_stream, "count_doublets",
+                                               nDoubletCountBlocks,
+                                               nDoubletCountThreads);
+    kernels::count_doublets<seeding_config_t>
+        <<<nDoubletCountBlocks, nDoubletCountThreads, 0, stream>>>(
+        m_seedfinder_config, g2_view, doublet_counter_buffer,
+        (*globalCounter_device).m_nMidBot, (*globalCounter_device).m_nMidTop);
+    count_doublets_timer.stop();
     CUDA_ERROR_CHECK(cudaGetLastError());
 
-    // Get the summary values.
+    // Host copy of the summary values.
     vecmem::unique_alloc_ptr<device::seeding_global_counter>
         globalCounter_host =
             vecmem::make_unique_alloc<device::seeding_global_counter>(
                 (m_mr.host != nullptr) ? *(m_mr.host) : m_mr.main);
-    CUDA_ERROR_CHECK(cudaMemcpyAsync(globalCounter_host.get(),
-                                     globalCounter_device.get(),
-                                     sizeof(device::seeding_global_counter),
-                                     cudaMemcpyDeviceToHost, stream));
-    m_stream.synchronize();
 
-    if (globalCounter_host->m_nMidBot == 0 ||
-        globalCounter_host->m_nMidTop == 0) {
-        return {0, m_mr.main};
+    // Decide about the doublet buffer capacities. In bounded mode these come
+    // from the configured factors, otherwise from the doublet counts.
+    const bool predicted =
+        (m_capacities.adaptive && m_triplet_predictor.ready());
+    unsigned int mb_capacity = 0, mt_capacity = 0;
+    if (bounded && predicted) {
+        mb_capacity = m_mid_bot_predictor.predict(num_spacepoints);
+        mt_capacity = m_mid_top_predictor.predict(num_spacepoints);
+    } else if (bounded) {
+        mb_capacity = seed_finding_capacities::capacity(
+            m_capacities.mid_bot_doublets_per_spacepoint, num_spacepoints);
+        mt_capacity = seed_finding_capacities::capacity(
+            m_capacities.mid_top_doublets_per_spacepoint, num_spacepoints);
+    } else {
+        CUDA_ERROR_CHECK(cudaMemcpyAsync(
+            globalCounter_host.get(), globalCounter_device.get(),
+            sizeof(device::seeding_global_counter), cudaMemcpyDeviceToHost,
+            stream));
+        m_stream.synchronize();
+
+        if (m_capacities.adaptive) {
+            m_mid_bot_predictor.record(num_spacepoints,
+                                       globalCounter_host->m_nMidBot);
+            m_mid_top_predictor.record(num_spacepoints,
+                                       globalCounter_host->m_nMidTop);
+        }
+        if (globalCounter_host->m_nMidBot == 0 ||
+            globalCounter_host->m_nMidTop == 0) {
+            return {{0, m_mr.event_memory()}, {0, m_mr.event_memory()}};
+        }
+        mb_capacity = globalCounter_host->m_nMidBot;
+        mt_capacity = globalCounter_host->m_nMidTop;
     }
 
     // Set up the doublet counter buffers.
     device::device_doublet_collection_types::buffer doublet_buffer_mb = {
-        globalCounter_host->m_nMidBot, m_mr.main};
+        mb_capacity, m_mr.event_memory(), buffer_type};
     m_copy.setup(doublet_buffer_mb);
     device::device_doublet_collection_types::buffer doublet_buffer_mt = {
-        globalCounter_host->m_nMidTop, m_mr.main};
+        mt_capacity, m_mr.event_memory(), buffer_type};
     m_copy.setup(doublet_buffer_mt);
 
+    // In bounded mode, set the sizes of the doublet buffers on the device.
+    if (bounded) {
+        details::kernel_timer set_doublet_buffer_sizes_timer(
+            m_stream, "set_doublet_buffer_sizes", 1, 1);
+        kernels::set_doublet_buffer_sizes<<<1, 1, 0, stream>>>(
+            *globalCounter_device, doublet_buffer_mb, doublet_buffer_mt);
+        set_doublet_buffer_sizes_timer.stop();
+        CUDA_ERROR_CHECK(cudaGetLastError());
+    }
+
     // Calculate the number of threads and thread blocks to run the doublet
-    // finding kernel for.
+    // finding kernel for. (In bounded mode the kernels are launched for the
+    // maximal number of middle spacepoints, to avoid reading back the size of
+    // the doublet counter buffer.)
     const unsigned int nDoubletFindThreads = WARP_SIZE * 2;
     const unsigned int doublet_counter_buffer_size =
-        m_copy.get_size(doublet_counter_buffer);
+        (bounded ? num_spacepoints : m_copy.get_size(doublet_counter_buffer));
     const unsigned int nDoubletFindBlocks =
         (doublet_counter_buffer_size + nDoubletFindThreads - 1) /
         nDoubletFindThreads;
 
     // Find all of the spacepoint doublets.
-    kernels::
-        find_doublets<<<nDoubletFindBlocks, nDoubletFindThreads, 0, stream>>>(
+    details::kernel_timer find_doublets_timer(m_stream, "find_doublets",
+                                              nDoubletFindBlocks,
+                                              nDoubletFindThreads);
+    kernels::find_doublets<seeding_config_t>
+        <<<nDoubletFindBlocks, nDoubletFindThreads, 0, stream>>>(
             m_seedfinder_config, g2_view, doublet_counter_buffer,
             doublet_buffer_mb, doublet_buffer_mt);
+    find_doublets_timer.stop();
     CUDA_ERROR_CHECK(cudaGetLastError());
 
     // Set up the triplet counter buffers
     device::triplet_counter_spM_collection_types::buffer
-        triplet_counter_spM_buffer = {doublet_counter_buffer_size, m_mr.main};
+        triplet_counter_spM_buffer = {doublet_counter_buffer_size,
+                                      m_mr.event_memory()};
     m_copy.setup(triplet_counter_spM_buffer);
     m_copy.memset(triplet_counter_spM_buffer, 0);
     device::triplet_counter_collection_types::buffer
-        triplet_counter_midBot_buffer = {globalCounter_host->m_nMidBot,
-                                         m_mr.main,
+        triplet_counter_midBot_buffer = {mb_capacity, m_mr.event_memory(),
                                          vecmem::data::buffer_type::resizable};
     m_copy.setup(triplet_counter_midBot_buffer);
+    vecmem::data::vector_buffer<unsigned int> triplet_counter_midBot_links = {
+        mb_capacity, m_mr.event_memory()};
+    m_copy.setup(triplet_counter_midBot_links);
 
     // Calculate the number of threads and thread blocks to run the doublet
     // counting kernel for.
     const unsigned int nTripletCountThreads = WARP_SIZE * 2;
     const unsigned int nTripletCountBlocks =
-        (globalCounter_host->m_nMidBot + nTripletCountThreads - 1) /
-        nTripletCountThreads;
+        (mb_capacity + nTripletCountThreads - 1) / nTripletCountThreads;
 
     // Count the number of triplets that we need to produce.
+    details::kernel_timer count_triplets_timer(m_stream, "count_triplets",
+                                               nTripletCountBlocks,
+                                               nTripletCountThreads);
     kernels::count_triplets<<<nTripletCountBlocks, nTripletCountThreads, 0,
                               stream>>>(
         m_seedfinder_config, g2_view, doublet_counter_buffer, doublet_buffer_mb,
         doublet_buffer_mt, triplet_counter_spM_buffer,
-        triplet_counter_midBot_buffer);
+        triplet_counter_midBot_buffer, triplet_counter_midBot_links);
+    count_triplets_timer.stop();
     CUDA_ERROR_CHECK(cudaGetLastError());
 
     // Calculate the number of threads and thread blocks to run the triplet
@@ -271,85 +644,219 @@ seed_finding::output_type seed_finding::operator()(
         nTcReductionThreads;
 
     // Reduce the triplet counts per spM.
+    details::kernel_timer reduce_triplet_counts_timer(m_stream,
+                                                      "reduce_triplet_counts",
+                                                      nTcReductionBlocks,
+                                                      nTcReductionThreads);
     kernels::reduce_triplet_counts<<<nTcReductionBlocks, nTcReductionThreads, 0,
                                      stream>>>(
         doublet_counter_buffer, triplet_counter_spM_buffer,
         (*globalCounter_device).m_nTriplets);
+    reduce_triplet_counts_timer.stop();
     CUDA_ERROR_CHECK(cudaGetLastError());
 
-    CUDA_ERROR_CHECK(cudaMemcpyAsync(globalCounter_host.get(),
-                                     globalCounter_device.get(),
-                                     sizeof(device::seeding_global_counter),
-                                     cudaMemcpyDeviceToHost, stream));
-    m_stream.synchronize();
-
-    if (globalCounter_host->m_nTriplets == 0) {
-        return {0, m_mr.main};
+    // Decide about the triplet buffer capacity.
+    unsigned int triplet_capacity = 0;
+    if (bounded && predicted) {
+        triplet_capacity = m_triplet_predictor.predict(num_spacepoints);
+    } else if (bounded) {
+        triplet_capacity = seed_finding_capacities::capacity(
+            m_capacities.triplets_per_spacepoint, num_spacepoints);
+    } else {
+        CUDA_ERROR_CHECK(cudaMemcpyAsync(
+            globalCounter_host.get(), globalCounter_device.get(),
+            sizeof(device::seeding_global_counter), cudaMemcpyDeviceToHost,
+            stream));
+        m_stream.synchronize();
+
+        if (m_capacities.adaptive) {
+            m_triplet_predictor.record(num_spacepoints,
+                                       globalCounter_host->m_nTriplets);
+        }
+        if (globalCounter_host->m_nTriplets == 0) {
+            return {{0, m_mr.event_memory()}, {0, m_mr.event_memory()}};
+        }
+        triplet_capacity = globalCounter_host->m_nTriplets;
     }
 
     // Set up the triplet buffer.
     device::device_triplet_collection_types::buffer triplet_buffer = {
-        globalCounter_host->m_nTriplets, m_mr.main};
+        triplet_capacity, m_mr.event_memory(), buffer_type};
     m_copy.setup(triplet_buffer);
 
+    // In bounded mode, set the size of the triplet buffer on the device.
+    if (bounded) {
+        details::kernel_timer set_triplet_buffer_size_timer(
+            m_stream, "set_triplet_buffer_size", 1, 1);
+        kernels::set_triplet_buffer_size<<<1, 1, 0, stream>>>(
+            *globalCounter_device, triplet_buffer);
+        set_triplet_buffer_size_timer.stop();
+        CUDA_ERROR_CHECK(cudaGetLastError());
+    }
+
+    // Find the triplets of the middle spacepoints with few enough midTop
+    // doublets, with one block per middle spacepoint.
+    details::kernel_timer find_triplets_tiled_timer(
+        m_stream, "find_triplets_tiled", doublet_counter_buffer_size,
+        kernels::triplet_tile_threads);
+    kernels::find_triplets_tiled<<<doublet_counter_buffer_size,
+                                   kernels::triplet_tile_threads, 0, stream>>>(
+        m_seedfinder_config, m_seedfilter_config, g2_view,
+        doublet_counter_buffer, doublet_buffer_mb, doublet_buffer_mt,
+        triplet_counter_spM_buffer, triplet_counter_midBot_buffer,
+        triplet_counter_midBot_links, triplet_buffer);
+    find_triplets_tiled_timer.stop();
+    CUDA_ERROR_CHECK(cudaGetLastError());
+
     // Calculate the number of threads and thread blocks to run the triplet
-    // finding kernel for.
+    // finding kernel for, for the remaining middle spacepoints.
     const unsigned int nTripletFindThreads = WARP_SIZE * 2;
     const unsigned int nTripletFindBlocks =
-        (m_copy.get_size(triplet_counter_midBot_buffer) + nTripletFindThreads -
-         1) /
-        nTripletFindThreads;
+        (mb_capacity + nTripletFindThreads - 1) / nTripletFindThreads;
 
     // Find all of the spacepoint triplets.
+    details::kernel_timer find_triplets_timer(m_stream, "find_triplets",
+                                              nTripletFindBlocks,
+                                              nTripletFindThreads);
     kernels::
         find_triplets<<<nTripletFindBlocks, nTripletFindThreads, 0, stream>>>(
             m_seedfinder_config, m_seedfilter_config, g2_view,
             doublet_counter_buffer, doublet_buffer_mt,
             triplet_counter_spM_buffer, triplet_counter_midBot_buffer,
             triplet_buffer);
+    find_triplets_timer.stop();
     CUDA_ERROR_CHECK(cudaGetLastError());
 
     // Calculate the number of threads and thread blocks to run the weight
     // updating kernel for.
-    const unsigned int nWeightUpdatingThreads = WARP_SIZE * 2;
+    const unsigned int nWeightUpdatingThreads = kernels::shared_array_threads;
     const unsigned int nWeightUpdatingBlocks =
-        (globalCounter_host->m_nTriplets + nWeightUpdatingThreads - 1) /
+        (triplet_capacity + nWeightUpdatingThreads - 1) /
         nWeightUpdatingThreads;
 
     // Update the weights of all spacepoint triplets.
-    kernels::update_triplet_weights<<<
-        nWeightUpdatingBlocks, nWeightUpdatingThreads,
-        sizeof(scalar) * m_seedfilter_config.compatSeedLimit *
-            nWeightUpdatingThreads,
-        stream>>>(m_seedfilter_config, g2_view, triplet_counter_spM_buffer,
-                  triplet_counter_midBot_buffer, triplet_buffer);
+    details::kernel_timer update_triplet_weights_timer(m_stream,
+                                                       "update_triplet_weights",
+                                                       nWeightUpdatingBlocks,
+                                                       nWeightUpdatingThreads);
+    const std::size_t weightUpdatingSharedMem =
+        seeding_config_t::is_static
+            ? 0u
+            : sizeof(scalar) * m_seedfilter_config.compatSeedLimit *
+                  nWeightUpdatingThreads;
+    kernels::update_triplet_weights<seeding_config_t>
+        <<<nWeightUpdatingBlocks, nWeightUpdatingThreads,
+           weightUpdatingSharedMem, stream>>>(
+            m_seedfilter_config, g2_view, triplet_counter_spM_buffer,
+            triplet_counter_midBot_buffer, triplet_buffer);
+    update_triplet_weights_timer.stop();
     CUDA_ERROR_CHECK(cudaGetLastError());
 
     // Create result object: collection of seeds
     seed_collection_types::buffer seed_buffer(
-        globalCounter_host->m_nTriplets, m_mr.main,
+        triplet_capacity, m_mr.event_memory(),
         vecmem::data::buffer_type::resizable);
     m_copy.setup(seed_buffer);
+    // And, if requested, of their parameters. Which are written at the
+    // indices of the seeds, by the seed selecting kernel.
+    bound_track_parameters_collection_types::buffer params_buffer(
+        (params_config != nullptr ? triplet_capacity : 0u),
+        m_mr.event_memory(), vecmem::data::buffer_type::resizable);
+    m_copy.setup(params_buffer);
+    const device::seed_params_config kernel_params_config =
+        (params_config != nullptr ? *params_config
+                                  : device::seed_params_config{});
+    const bound_track_parameters_collection_types::view params_view =
+        (params_config != nullptr
+             ? bound_track_parameters_collection_types::view{params_buffer}
+             : bound_track_parameters_collection_types::view{});
+
+    if (m_selection.warp_cooperative) {
+
+        // Calculate the number of threads and thread blocks to run the
+        // warp-cooperative seed selecting kernel for, with one warp per
+        // middle spacepoint.
+        const unsigned int nSeedSelectingThreads =
+            WARP_SIZE * m_selection.warps_per_block;
+        const unsigned int nSeedSelectingBlocks =
+            (doublet_counter_buffer_size + m_selection.warps_per_block - 1) /
+            m_selection.warps_per_block;
+
+        // Create seeds out of selected triplets
+        details::kernel_timer select_seeds_warp_timer(m_stream,
+                                                      "select_seeds_warp",
+                                                      nSeedSelectingBlocks,
+                                                      nSeedSelectingThreads);
+        kernels::select_seeds_warp<seeding_config_t>
+            <<<nSeedSelectingBlocks, nSeedSelectingThreads, 0, stream>>>(
+            m_seedfilter_config, spacepoints_view, g2_view,
+            triplet_counter_spM_buffer, triplet_counter_midBot_buffer,
+            triplet_buffer, seed_buffer, params_view, kernel_params_config);
+        select_seeds_warp_timer.stop();
+        CUDA_ERROR_CHECK(cudaGetLastError());
+    } else {
+
+        // Calculate the number of threads and thread blocks to run the seed
+        // selecting kernel for.
+        const unsigned int nSeedSelectingThreads =
+            kernels::shared_array_threads;
+        const unsigned int nSeedSelectingBlocks =
+            (doublet_counter_buffer_size + nSeedSelectingThreads - 1) /
+            nSeedSelectingThreads;
+
+        // Create seeds out of selected triplets
+        details::kernel_timer select_seeds_timer(m_stream, "select_seeds",
+                                                 nSeedSelectingBlocks,
+                                                 nSeedSelectingThreads);
+        const std::size_t seedSelectingSharedMem =
+            seeding_config_t::is_static
+                ? 0u
+                : sizeof(device::device_triplet) *
+                      m_seedfilter_config.max_triplets_per_spM *
+                      nSeedSelectingThreads;
+        kernels::select_seeds<seeding_config_t>
+            <<<nSeedSelectingBlocks, nSeedSelectingThreads,
+               seedSelectingSharedMem, stream>>>(
+                m_seedfilter_config, spacepoints_view, g2_view,
+                triplet_counter_spM_buffer, triplet_counter_midBot_buffer,
+                triplet_buffer, seed_buffer, params_view,
+                kernel_params_config);
+        select_seeds_timer.stop();
+        CUDA_ERROR_CHECK(cudaGetLastError());
+    }
 
-    // Calculate the number of threads and thread blocks to run the seed
-    // selecting kernel for.
-    const unsigned int nSeedSelectingThreads = WARP_SIZE * 2;
-    const unsigned int nSeedSelectingBlocks =
-        (doublet_counter_buffer_size + nSeedSelectingThreads - 1) /
-        nSeedSelectingThreads;
-
-    // Create seeds out of selected triplets
-    kernels::select_seeds<<<nSeedSelectingBlocks, nSeedSelectingThreads,
-                            sizeof(triplet) *
-                                m_seedfilter_config.max_triplets_per_spM *
-                                nSeedSelectingThreads,
-                            stream>>>(m_seedfilter_config, spacepoints_view,
-                                      g2_view, triplet_counter_spM_buffer,
-                                      triplet_counter_midBot_buffer,
-                                      triplet_buffer, seed_buffer);
-    CUDA_ERROR_CHECK(cudaGetLastError());
+    // The parameters have the same size as the seeds.
+    if (params_config != nullptr) {
+        CUDA_ERROR_CHECK(cudaMemcpyAsync(
+            params_buffer.size_ptr(), seed_buffer.size_ptr(),
+            sizeof(*(seed_buffer.size_ptr())), cudaMemcpyDeviceToDevice,
+            stream));
+    }
+
+    // In bounded mode, check (with the only synchronisation of this mode)
+    // whether everything fit into the buffers.
+    if (bounded) {
+        CUDA_ERROR_CHECK(cudaMemcpyAsync(
+            globalCounter_host.get(), globalCounter_device.get(),
+            sizeof(device::seeding_global_counter), cudaMemcpyDeviceToHost,
+            stream));
+        m_stream.synchronize();
+        fits = (globalCounter_host->m_nMidBot <= mb_capacity) &&
+               (globalCounter_host->m_nMidTop <= mt_capacity) &&
+               (globalCounter_host->m_nTriplets <= triplet_capacity);
+
+        // Learn from the event, if it fit. (Otherwise the exact mode does.)
+        if (m_capacities.adaptive && fits) {
+            m_mid_bot_predictor.record(num_spacepoints,
+                                       globalCounter_host->m_nMidBot);
+            m_mid_top_predictor.record(num_spacepoints,
+                                       globalCounter_host->m_nMidTop);
+            m_triplet_predictor.record(num_spacepoints,
+                                       globalCounter_host->m_nTriplets);
+        }
+    }
 
-    return seed_buffer;
+    return {std::move(seed_buffer), std::move(params_buffer)};
 }
 
 }  // namespace traccc::cuda
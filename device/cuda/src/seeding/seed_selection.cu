@@ -0,0 +1,211 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Local include(s).
+#include "../utils/kernel_timer.hpp"
+#include "../utils/thrust_allocator.cuh"
+#include "../utils/utils.hpp"
+#include "traccc/cuda/seeding/seed_selection.hpp"
+#include "traccc/cuda/utils/definitions.hpp"
+
+// Project include(s).
+#include "traccc/seeding/device/cap_seeds_per_region.hpp"
+#include "traccc/seeding/device/mark_duplicate_seeds.hpp"
+#include "traccc/seeding/seed_selection_helper.hpp"
+#include "traccc/utils/trace.hpp"
+
+// VecMem include(s).
+#include <vecmem/containers/data/vector_buffer.hpp>
+
+// Thrust include(s).
+#include <thrust/copy.h>
+#include <thrust/count.h>
+#include <thrust/execution_policy.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/sequence.h>
+#include <thrust/sort.h>
+#include <thrust/transform.h>
+
+// System include(s).
+#include <cstdint>
+
+namespace traccc::cuda {
+namespace kernels {
+
+/// CUDA kernel for running @c traccc::device::mark_duplicate_seeds
+__global__ void mark_duplicate_seeds(
+    seed_selection_config config,
+    vecmem::data::vector_view<const std::uint64_t> keys,
+    vecmem::data::vector_view<const unsigned int> order,
+    seed_collection_types::const_view seeds,
+    bound_track_parameters_collection_types::const_view params,
+    vecmem::data::vector_view<unsigned int> removed) {
+
+    device::mark_duplicate_seeds(threadIdx.x + blockIdx.x * blockDim.x,
+                                 config, keys, order, seeds, params, removed);
+}
+
+/// CUDA kernel for running @c traccc::device::cap_seeds_per_region
+__global__ void cap_seeds_per_region(
+    seed_selection_config config,
+    vecmem::data::vector_view<const std::uint64_t> keys,
+    vecmem::data::vector_view<const unsigned int> order,
+    vecmem::data::vector_view<unsigned int> removed) {
+
+    device::cap_seeds_per_region(threadIdx.x + blockIdx.x * blockDim.x,
+                                 config, keys, order, removed);
+}
+
+}  // namespace kernels
+
+namespace {
+
+/// Functor returning the key of one pair of spacepoints of a seed
+struct seed_pair_key {
+    unsigned int m_pair;
+
+    TRACCC_HOST_DEVICE
+    std::uint64_t operator()(const seed& s) const {
+        return seed_selection_helper::pair_key(s, m_pair);
+    }
+};
+
+/// Functor returning the region key of a seed, or the maximal key for the
+/// seeds removed already
+struct seed_region_key {
+    seed_selection_config m_config;
+    const seed* m_seeds;
+    const bound_track_parameters* m_params;
+    const unsigned int* m_removed;
+
+    TRACCC_HOST_DEVICE
+    std::uint64_t operator()(const unsigned int i) const {
+        return m_removed[i] ? ~std::uint64_t{0}
+                            : seed_selection_helper::region_key(
+                                  m_config, m_seeds[i], m_params[i]);
+    }
+};
+
+/// Functor selecting the seeds that were not removed
+struct is_kept {
+    TRACCC_HOST_DEVICE
+    bool operator()(const unsigned int removed) const { return removed == 0u; }
+};
+
+}  // namespace
+
+seed_selection::seed_selection(const seed_selection_config& config,
+                               const traccc::memory_resource& mr,
+                               vecmem::copy& copy, stream& str)
+    : m_config(config), m_mr(mr), m_copy(copy), m_stream(str) {}
+
+seed_selection::output_type seed_selection::operator()(
+    const seed_collection_types::const_view& seeds_view,
+    const bound_track_parameters_collection_types::const_view& params_view)
+    const {
+
+    TRACCC_TRACE_RANGE("traccc::cuda::seed_selection");
+
+    // Get a convenience variable for the stream that we'll be using.
+    cudaStream_t stream = details::get_stream(m_stream);
+    // Thrust takes its temporary storage from the event memory.
+    details::thrust_allocator thrust_alloc(m_mr.event_memory());
+    auto policy = thrust::cuda::par_nosync(thrust_alloc).on(stream);
+
+    // Get the number of seeds from the view.
+    const unsigned int n_seeds = m_copy.get_size(seeds_view);
+
+    // Flags of the removed seeds, and the sort keys and orders of the seeds.
+    vecmem::data::vector_buffer<unsigned int> removed_buffer(
+        n_seeds, m_mr.event_memory());
+    m_copy.setup(removed_buffer);
+    m_copy.memset(removed_buffer, 0);
+    vecmem::data::vector_buffer<std::uint64_t> keys_buffer(
+        n_seeds, m_mr.event_memory());
+    m_copy.setup(keys_buffer);
+    vecmem::data::vector_buffer<unsigned int> order_buffer(
+        n_seeds, m_mr.event_memory());
+    m_copy.setup(order_buffer);
+
+    const unsigned int num_threads = WARP_SIZE * 2;
+    const unsigned int num_blocks = (n_seeds + num_threads - 1) / num_threads;
+
+    if (m_config.enabled && (n_seeds > 0)) {
+
+        // Compare every seed to the ones sharing each of its pairs of
+        // spacepoints.
+        for (unsigned int pair = 0u; pair < 3u; ++pair) {
+            thrust::transform(policy, seeds_view.ptr(),
+                              seeds_view.ptr() + n_seeds, keys_buffer.ptr(),
+                              seed_pair_key{pair});
+            thrust::sequence(policy, order_buffer.ptr(),
+                             order_buffer.ptr() + n_seeds);
+            thrust::sort_by_key(policy, keys_buffer.ptr(),
+                                keys_buffer.ptr() + n_seeds,
+                                order_buffer.ptr());
+
+            details::kernel_timer timer(m_stream, "mark_duplicate_seeds",
+                                        num_blocks, num_threads);
+            kernels::mark_duplicate_seeds<<<num_blocks, num_threads, 0,
+                                            stream>>>(
+                m_config, keys_buffer, order_buffer, seeds_view, params_view,
+                removed_buffer);
+            timer.stop();
+            CUDA_ERROR_CHECK(cudaGetLastError());
+        }
+
+        // Cap the number of seeds in every region.
+        if (m_config.max_seeds_per_region > 0u) {
+            thrust::transform(
+                policy, thrust::counting_iterator<unsigned int>(0u),
+                thrust::counting_iterator<unsigned int>(n_seeds),
+                keys_buffer.ptr(),
+                seed_region_key{m_config, seeds_view.ptr(), params_view.ptr(),
+                                removed_buffer.ptr()});
+            thrust::sequence(policy, order_buffer.ptr(),
+                             order_buffer.ptr() + n_seeds);
+            thrust::sort_by_key(policy, keys_buffer.ptr(),
+                                keys_buffer.ptr() + n_seeds,
+                                order_buffer.ptr());
+
+            details::kernel_timer timer(m_stream, "cap_seeds_per_region",
+                                        num_blocks, num_threads);
+            kernels::cap_seeds_per_region<<<num_blocks, num_threads, 0,
+                                            stream>>>(
+                m_config, keys_buffer, order_buffer, removed_buffer);
+            timer.stop();
+            CUDA_ERROR_CHECK(cudaGetLastError());
+        }
+    }
+
+    // Count the selected seeds, and copy them (with their parameters) into
+    // the result buffers.
+    const unsigned int n_selected = static_cast<unsigned int>(
+        thrust::count(thrust::cuda::par(thrust_alloc).on(stream),
+                      removed_buffer.ptr(), removed_buffer.ptr() + n_seeds,
+                      0u));
+    output_type result{
+        seed_collection_types::buffer(n_selected, m_mr.event_memory()),
+        bound_track_parameters_collection_types::buffer(n_selected,
+                                                        m_mr.event_memory())};
+    m_copy.setup(result.first);
+    m_copy.setup(result.second);
+    if (n_selected > 0) {
+        thrust::copy_if(policy, seeds_view.ptr(), seeds_view.ptr() + n_seeds,
+                        removed_buffer.ptr(), result.first.ptr(), is_kept{});
+        // Wait for the copies to finish, before the temporary buffers go out
+        // of scope.
+        thrust::copy_if(thrust::cuda::par(thrust_alloc).on(stream),
+                        params_view.ptr(), params_view.ptr() + n_seeds,
+                        removed_buffer.ptr(), result.second.ptr(), is_kept{});
+    }
+
+    // Return the result buffers.
+    return result;
+}
+
+}  // namespace traccc::cuda
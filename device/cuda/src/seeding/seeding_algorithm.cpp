@@ -1,6 +1,6 @@
 /** TRACCC library, part of the ACTS project (R&D line)
  *
- * (c) 2021-2023 CERN for the benefit of the ACTS project
+ * (c) 2021-2024 CERN for the benefit of the ACTS project
  *
  * Mozilla Public License Version 2.0
  */
@@ -10,9 +10,11 @@
 
 // Project include(s).
 #include "traccc/seeding/detail/seeding_config.hpp"
+#include "traccc/utils/trace.hpp"
 
 // System include(s).
 #include <cmath>
+#include <utility>
 
 namespace traccc::cuda {
 
@@ -20,15 +22,65 @@ seeding_algorithm::seeding_algorithm(const seedfinder_config& finder_config,
                                      const spacepoint_grid_config& grid_config,
                                      const seedfilter_config& filter_config,
                                      const traccc::memory_resource& mr,
-                                     vecmem::copy& copy, stream& str)
+                                     vecmem::copy& copy, stream& str,
+                                     const seed_finding_capacities& capacities,
+                                     const seed_extension_config& extension,
+                                     const seed_selection_config& selection)
     : m_spacepoint_binning(finder_config, grid_config, mr, copy, str),
-      m_seed_finding(finder_config, filter_config, mr, copy, str) {}
+      m_seed_finding(finder_config, filter_config, mr, copy, str, capacities,
+                     selection),
+      m_seed_extension(finder_config, extension, mr, copy, str),
+      m_track_params_estimation(mr, copy, str),
+      m_extend_seeds(extension.max_seed_size > 3),
+      m_stream(str) {}
 
 seeding_algorithm::output_type seeding_algorithm::operator()(
     const spacepoint_collection_types::const_view& spacepoints_view) const {
 
-    return m_seed_finding(spacepoints_view,
-                          m_spacepoint_binning(spacepoints_view));
+    TRACCC_TRACE_RANGE("traccc::cuda::seeding_algorithm");
+
+    sp_soa_grid_types::buffer grid_buffer = bin(spacepoints_view);
+    return (*this)(spacepoints_view, get_data(grid_buffer));
+}
+
+sp_soa_grid_types::buffer seeding_algorithm::bin(
+    const spacepoint_collection_types::const_view& spacepoints_view) const {
+
+    return m_spacepoint_binning(spacepoints_view);
+}
+
+seeding_algorithm::output_type seeding_algorithm::operator()(
+    const spacepoint_collection_types::const_view& spacepoints_view,
+    const sp_soa_grid_types::const_view& grid_view) const {
+
+    output_type seeds = m_seed_finding(spacepoints_view, grid_view);
+    if (!m_extend_seeds) {
+        return seeds;
+    }
+
+    // Only keep the seeds that could be extended with enough spacepoints.
+    // Making sure that the extension has finished before the extended seeds
+    // are released.
+    seed_extension::output_type extended =
+        m_seed_extension(spacepoints_view, grid_view, seeds);
+    m_stream.synchronize();
+    return std::move(extended.second);
+}
+
+seed_finding::params_output_type seeding_algorithm::operator()(
+    const spacepoint_collection_types::const_view& spacepoints_view,
+    const sp_soa_grid_types::const_view& grid_view, const vector3& bfield,
+    const std::array<traccc::scalar, traccc::e_bound_size>& stddev) const {
+
+    if (!m_extend_seeds) {
+        return m_seed_finding(spacepoints_view, grid_view, bfield, stddev);
+    }
+
+    // Estimate the parameters of the extended seeds separately.
+    output_type seeds = (*this)(spacepoints_view, grid_view);
+    bound_track_parameters_collection_types::buffer params =
+        m_track_params_estimation(spacepoints_view, seeds, bfield, stddev);
+    return {std::move(seeds), std::move(params)};
 }
 
 }  // namespace traccc::cuda
@@ -1,11 +1,12 @@
 /** TRACCC library, part of the ACTS project (R&D line)
  *
- * (c) 2021-2023 CERN for the benefit of the ACTS project
+ * (c) 2021-2024 CERN for the benefit of the ACTS project
  *
  * Mozilla Public License Version 2.0
  */
 
 // Local include(s).
+#include "../utils/kernel_timer.hpp"
 #include "../utils/utils.hpp"
 #include "traccc/cuda/seeding/spacepoint_binning.hpp"
 #include "traccc/cuda/utils/definitions.hpp"
@@ -13,18 +14,23 @@
 // Project include(s).
 #include "traccc/seeding/device/count_grid_capacities.hpp"
 #include "traccc/seeding/device/populate_grid.hpp"
+#include "traccc/seeding/device/sort_grid_bins.hpp"
+#include "traccc/utils/trace.hpp"
 
 // VecMem include(s).
 #include <vecmem/utils/copy.hpp>
 #include <vecmem/utils/cuda/copy.hpp>
 
+// System include(s).
+#include <numeric>
+
 namespace traccc::cuda {
 namespace kernels {
 
 /// CUDA kernel for running @c traccc::device::count_grid_capacities
 __global__ void count_grid_capacities(
-    seedfinder_config config, sp_grid::axis_p0_type phi_axis,
-    sp_grid::axis_p1_type z_axis,
+    seedfinder_config config, sp_soa_grid_axis_p0_type phi_axis,
+    sp_soa_grid_axis_p1_type z_axis,
     spacepoint_collection_types::const_view spacepoints,
     vecmem::data::vector_view<unsigned int> grid_capacities) {
 
@@ -36,10 +42,18 @@ __global__ void count_grid_capacities(
 /// CUDA kernel for running @c traccc::device::populate_grid
 __global__ void populate_grid(
     seedfinder_config config,
-    spacepoint_collection_types::const_view spacepoints, sp_grid_view grid) {
+    spacepoint_collection_types::const_view spacepoints,
+    sp_soa_grid_types::view grid,
+    vecmem::data::vector_view<unsigned int> bin_cursors) {
 
     device::populate_grid(threadIdx.x + blockIdx.x * blockDim.x, config,
-                          spacepoints, grid);
+                          spacepoints, grid, bin_cursors);
+}
+
+/// CUDA kernel for running @c traccc::device::sort_grid_bins
+__global__ void sort_grid_bins(sp_soa_grid_types::view grid) {
+
+    device::sort_grid_bins(threadIdx.x + blockIdx.x * blockDim.x, grid);
 }
 
 }  // namespace kernels
@@ -51,11 +65,20 @@ spacepoint_binning::spacepoint_binning(
       m_axes(get_axes(grid_config, (mr.host ? *(mr.host) : mr.main))),
       m_mr(mr),
       m_copy(copy),
-      m_stream(str) {}
+      m_stream(str),
+      m_grid_capacities(m_axes.first.n_bins * m_axes.second.n_bins, mr.main),
+      m_bin_offsets_host(mr.host ? mr.host : &(mr.main)) {
+
+    m_copy.setup(m_grid_capacities);
+    m_bin_offsets_host.reserve(m_axes.first.n_bins * m_axes.second.n_bins +
+                               1);
+}
 
-sp_grid_buffer spacepoint_binning::operator()(
+spacepoint_binning::output_type spacepoint_binning::operator()(
     const spacepoint_collection_types::const_view& spacepoints_view) const {
 
+    TRACCC_TRACE_RANGE("traccc::cuda::spacepoint_binning");
+
     // Get a convenience variable for the stream that we'll be using.
     cudaStream_t stream = details::get_stream(m_stream);
 
@@ -63,47 +86,68 @@ sp_grid_buffer spacepoint_binning::operator()(
     const auto sp_size = m_copy.get_size(spacepoints_view);
 
     if (sp_size == 0) {
-        return {m_axes.first, m_axes.second, {}, m_mr.main, m_mr.host};
+        output_type grid_buffer(m_axes.first, m_axes.second, 0,
+                                m_mr.event_memory());
+        m_copy.memset(grid_buffer.bin_offsets, 0);
+        return grid_buffer;
     }
 
-    // Set up the container that will be filled with the required capacities for
-    // the spacepoint grid.
-    const std::size_t grid_bins = m_axes.first.n_bins * m_axes.second.n_bins;
-    vecmem::data::vector_buffer<unsigned int> grid_capacities_buff(grid_bins,
-                                                                   m_mr.main);
-    m_copy.setup(grid_capacities_buff);
-    m_copy.memset(grid_capacities_buff, 0);
+    // Reset the (persistent) container that will be filled with the required
+    // capacities for the spacepoint grid.
+    const unsigned int grid_bins = m_axes.first.n_bins * m_axes.second.n_bins;
+    m_copy.memset(m_grid_capacities, 0);
     vecmem::data::vector_view<unsigned int> grid_capacities_view =
-        grid_capacities_buff;
+        m_grid_capacities;
 
     // Calculate the number of threads and thread blocks to run the kernels for.
     const unsigned int num_threads = WARP_SIZE * 8;
     const unsigned int num_blocks = (sp_size + num_threads - 1) / num_threads;
 
     // Fill the grid capacity container.
+    details::kernel_timer count_grid_capacities_timer(m_stream,
+                                                      "count_grid_capacities",
+                                                      num_blocks, num_threads);
     kernels::count_grid_capacities<<<num_blocks, num_threads, 0, stream>>>(
         m_config, m_axes.first, m_axes.second, spacepoints_view,
         grid_capacities_view);
+    count_grid_capacities_timer.stop();
     CUDA_ERROR_CHECK(cudaGetLastError());
 
-    // Copy grid capacities back to the host
-    vecmem::vector<unsigned int> grid_capacities_host(m_mr.host ? m_mr.host
-                                                                : &(m_mr.main));
-    m_copy(grid_capacities_buff, grid_capacities_host);
-
+    // Copy grid capacities back to the host, and turn them into the offsets of
+    // the bins.
+    vecmem::vector<unsigned int>& bin_offsets_host = m_bin_offsets_host;
+    m_copy(m_grid_capacities, bin_offsets_host);
     m_stream.synchronize();
+    bin_offsets_host.insert(bin_offsets_host.begin(), 0u);
+    std::partial_sum(bin_offsets_host.begin(), bin_offsets_host.end(),
+                     bin_offsets_host.begin());
+
     // Create the grid buffer.
-    sp_grid_buffer grid_buffer(
-        m_axes.first, m_axes.second,
-        std::vector<std::size_t>(grid_capacities_host.begin(),
-                                 grid_capacities_host.end()),
-        m_mr.main, m_mr.host, vecmem::data::buffer_type::resizable);
-    m_copy.setup(grid_buffer._buffer);
-    sp_grid_view grid_view = grid_buffer;
-
-    // Populate the grid.
+    output_type grid_buffer(m_axes.first, m_axes.second,
+                            bin_offsets_host.back(), m_mr.event_memory());
+    m_copy(vecmem::get_data(bin_offsets_host), grid_buffer.bin_offsets);
+    // Make sure that the offsets were copied out of host memory before that
+    // memory is overwritten by the next event.
+    m_stream.synchronize();
+    sp_soa_grid_types::view grid_view = get_data(grid_buffer);
+
+    // Populate the grid, re-using the capacity buffer as the bin cursors.
+    m_copy.memset(m_grid_capacities, 0);
+    details::kernel_timer populate_grid_timer(m_stream, "populate_grid",
+                                              num_blocks, num_threads);
     kernels::populate_grid<<<num_blocks, num_threads, 0, stream>>>(
-        m_config, spacepoints_view, grid_view);
+        m_config, spacepoints_view, grid_view, grid_capacities_view);
+    populate_grid_timer.stop();
+    CUDA_ERROR_CHECK(cudaGetLastError());
+
+    // Sort the spacepoints of every bin by radius.
+    const unsigned int num_bin_blocks =
+        (grid_bins + num_threads - 1) / num_threads;
+    details::kernel_timer sort_grid_bins_timer(m_stream, "sort_grid_bins",
+                                               num_bin_blocks, num_threads);
+    kernels::sort_grid_bins<<<num_bin_blocks, num_threads, 0, stream>>>(
+        grid_view);
+    sort_grid_bins_timer.stop();
     CUDA_ERROR_CHECK(cudaGetLastError());
 
     // Return the freshly filled buffer.
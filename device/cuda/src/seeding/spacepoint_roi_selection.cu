@@ -0,0 +1,71 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Local include(s).
+#include "../utils/kernel_timer.hpp"
+#include "../utils/utils.hpp"
+#include "traccc/cuda/seeding/spacepoint_roi_selection.hpp"
+#include "traccc/cuda/utils/definitions.hpp"
+
+// Project include(s).
+#include "traccc/seeding/device/select_roi_spacepoints.hpp"
+#include "traccc/utils/trace.hpp"
+
+namespace traccc::cuda {
+namespace kernels {
+
+/// CUDA kernel for running @c traccc::device::select_roi_spacepoints
+__global__ void select_roi_spacepoints(
+    spacepoint_collection_types::const_view spacepoints_view,
+    region_of_interest_collection_types::const_view rois_view,
+    spacepoint_collection_types::view selected_view) {
+
+    device::select_roi_spacepoints(threadIdx.x + blockIdx.x * blockDim.x,
+                                   spacepoints_view, rois_view, selected_view);
+}
+
+}  // namespace kernels
+
+spacepoint_roi_selection::spacepoint_roi_selection(
+    const traccc::memory_resource& mr, vecmem::copy& copy, stream& str)
+    : m_mr(mr), m_copy(copy), m_stream(str) {}
+
+spacepoint_roi_selection::output_type spacepoint_roi_selection::operator()(
+    const spacepoint_collection_types::const_view& spacepoints_view,
+    const region_of_interest_collection_types::const_view& rois_view) const {
+
+    TRACCC_TRACE_RANGE("traccc::cuda::spacepoint_roi_selection");
+
+    // Get a convenience variable for the stream that we'll be using.
+    cudaStream_t stream = details::get_stream(m_stream);
+
+    // Create the result buffer, big enough for all of the spacepoints.
+    const unsigned int num_spacepoints = m_copy.get_size(spacepoints_view);
+    output_type result(num_spacepoints, m_mr.event_memory(),
+                       vecmem::data::buffer_type::resizable);
+    m_copy.setup(result);
+
+    // Check if anything needs to be done.
+    if (num_spacepoints == 0) {
+        return result;
+    }
+
+    // Select the spacepoints.
+    const unsigned int nThreads = WARP_SIZE * 2;
+    const unsigned int nBlocks = (num_spacepoints + nThreads - 1) / nThreads;
+    details::kernel_timer select_roi_spacepoints_timer(m_stream,
+                                                       "select_roi_spacepoints",
+                                                       nBlocks, nThreads);
+    kernels::select_roi_spacepoints<<<nBlocks, nThreads, 0, stream>>>(
+        spacepoints_view, rois_view, result);
+    select_roi_spacepoints_timer.stop();
+    CUDA_ERROR_CHECK(cudaGetLastError());
+
+    return result;
+}
+
+}  // namespace traccc::cuda
@@ -6,12 +6,15 @@
  */
 
 // Local include(s).
+#include "../utils/kernel_timer.hpp"
 #include "../utils/utils.hpp"
 #include "traccc/cuda/seeding/track_params_estimation.hpp"
 #include "traccc/cuda/utils/definitions.hpp"
 
 // Project include(s).
 #include "traccc/seeding/device/estimate_track_params.hpp"
+#include "traccc/utils/trace.hpp"
+#include "traccc/utils/work_model.hpp"
 
 // VecMem include(s).
 #include <vecmem/utils/cuda/copy.hpp>
@@ -42,6 +45,8 @@ track_params_estimation::output_type track_params_estimation::operator()(
     const seed_collection_types::const_view& seeds_view, const vector3& bfield,
     const std::array<traccc::scalar, traccc::e_bound_size>& stddev) const {
 
+    TRACCC_TRACE_RANGE("traccc::cuda::track_params_estimation");
+
     // Get a convenience variable for the stream that we'll be using.
     cudaStream_t stream = details::get_stream(m_stream);
 
@@ -49,8 +54,8 @@ track_params_estimation::output_type track_params_estimation::operator()(
     const std::size_t seeds_size = m_copy.get_size(seeds_view);
 
     // Create device buffer for the parameters
-    bound_track_parameters_collection_types::buffer params_buffer(seeds_size,
-                                                                  m_mr.main);
+    bound_track_parameters_collection_types::buffer params_buffer(
+        seeds_size, m_mr.event_memory());
     m_copy.setup(params_buffer);
 
     // Check if anything needs to be done.
@@ -68,10 +73,15 @@ track_params_estimation::output_type track_params_estimation::operator()(
     unsigned int num_blocks = (seeds_size + num_threads - 1) / num_threads;
 
     // run the kernel
+    details::kernel_timer estimate_track_params_timer(m_stream,
+                                                      "estimate_track_params",
+                                                      num_blocks, num_threads);
     kernels::estimate_track_params<<<num_blocks, num_threads, 0, stream>>>(
         spacepoints_view, seeds_view, bfield, stddev, params_buffer);
+    estimate_track_params_timer.stop();
     CUDA_ERROR_CHECK(cudaGetLastError());
 
+    count_work(work_model::track_params_estimation(seeds_size));
     return params_buffer;
 }
 
@@ -0,0 +1,95 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Project include(s).
+#include "../utils/kernel_timer.hpp"
+#include "../utils/launch_parameters.cuh"
+#include "../utils/utils.hpp"
+#include "traccc/cuda/seeding/truth_seed_generator.hpp"
+#include "traccc/cuda/utils/definitions.hpp"
+#include "traccc/seeding/device/make_truth_seeds.hpp"
+#include "traccc/utils/trace.hpp"
+
+// detray include(s).
+#include "detray/core/detector.hpp"
+#include "detray/core/detector_metadata.hpp"
+
+namespace traccc::cuda {
+
+namespace kernels {
+
+template <typename detector_t>
+__global__ void make_truth_seeds(
+    typename detector_t::view_type det_data,
+    truth_seed_input_collection_types::const_view inputs_view,
+    const std::array<scalar, e_bound_size> stddevs, const std::uint64_t seed,
+    const std::uint64_t event,
+    bound_track_parameters_collection_types::view seeds_view) {
+
+    device::make_truth_seeds<detector_t>(threadIdx.x + blockIdx.x * blockDim.x,
+                                         det_data, inputs_view, stddevs, seed,
+                                         event, seeds_view);
+}
+
+}  // namespace kernels
+
+template <typename detector_t>
+truth_seed_generator<detector_t>::truth_seed_generator(
+    const std::array<scalar, e_bound_size>& stddevs, std::uint64_t seed,
+    const traccc::memory_resource& mr, vecmem::copy& copy, stream& str)
+    : m_stddevs(stddevs),
+      m_seed(seed),
+      m_mr(mr),
+      m_copy(copy),
+      m_stream(str) {}
+
+template <typename detector_t>
+bound_track_parameters_collection_types::buffer
+truth_seed_generator<detector_t>::operator()(
+    const typename detector_t::view_type& det_view,
+    const truth_seed_input_collection_types::const_view& inputs_view,
+    std::uint64_t event) const {
+
+    TRACCC_TRACE_RANGE("traccc::cuda::truth_seed_generator");
+
+    // Get a convenience variable for the stream that we'll be using.
+    cudaStream_t stream = details::get_stream(m_stream);
+
+    // Every particle makes exactly one seed.
+    const unsigned int n_seeds = m_copy.get_size(inputs_view);
+    bound_track_parameters_collection_types::buffer seeds_buffer(n_seeds,
+                                                                 m_mr.main);
+    m_copy.setup(seeds_buffer);
+
+    if (n_seeds > 0) {
+        const unsigned int nThreads = details::threads_per_block(
+            m_stream, "make_truth_seeds",
+            kernels::make_truth_seeds<detector_t>, WARP_SIZE * 2);
+        const unsigned int nBlocks = (n_seeds + nThreads - 1) / nThreads;
+
+        // Make the seeds
+        details::kernel_timer seeds_timer(m_stream, "make_truth_seeds",
+                                          nBlocks, nThreads);
+        kernels::make_truth_seeds<detector_t>
+            <<<nBlocks, nThreads, 0, stream>>>(det_view, inputs_view,
+                                               m_stddevs, m_seed, event,
+                                               seeds_buffer);
+        seeds_timer.stop();
+        CUDA_ERROR_CHECK(cudaGetLastError());
+    }
+
+    m_stream.synchronize();
+
+    return seeds_buffer;
+}
+
+// Explicit template instantiation
+using default_detector_type =
+    detray::detector<detray::default_metadata, detray::device_container_types>;
+template class truth_seed_generator<default_detector_type>;
+
+}  // namespace traccc::cuda
@@ -0,0 +1,114 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Project include(s).
+#include "../utils/kernel_timer.hpp"
+#include "../utils/launch_parameters.cuh"
+#include "../utils/navigation_grid.hpp"
+#include "../utils/utils.hpp"
+#include "traccc/cuda/simulation/simulation_algorithm.hpp"
+#include "traccc/cuda/utils/definitions.hpp"
+#include "traccc/simulation/device/simulate_tracks.hpp"
+#include "traccc/utils/trace.hpp"
+
+// detray include(s).
+#include "detray/core/detector_metadata.hpp"
+#include "detray/detectors/bfield.hpp"
+#include "detray/navigation/navigator.hpp"
+#include "detray/propagator/rk_stepper.hpp"
+
+namespace traccc::cuda {
+
+namespace kernels {
+
+template <typename simulator_t, typename detector_view_t>
+__global__ void simulate_tracks(
+    detector_view_t det_data,
+    const typename simulator_t::bfield_type field_data,
+    const typename simulator_t::config_type cfg,
+    vecmem::data::jagged_vector_view<typename simulator_t::intersection_type>
+        nav_candidates_buffer,
+    vecmem::data::vector_view<const free_track_parameters> tracks_view,
+    const unsigned int n_tracks, const std::uint64_t event,
+    measurement_collection_types::view measurements_view) {
+
+    for (unsigned int gid = threadIdx.x + blockIdx.x * blockDim.x;
+         gid < n_tracks; gid += blockDim.x * gridDim.x) {
+        device::simulate_tracks<simulator_t>(gid, det_data, field_data, cfg,
+                                             nav_candidates_buffer,
+                                             tracks_view, event,
+                                             measurements_view);
+    }
+}
+
+}  // namespace kernels
+
+template <typename simulator_t>
+simulation_algorithm<simulator_t>::simulation_algorithm(
+    const config_type& cfg, const traccc::memory_resource& mr,
+    vecmem::copy& copy, stream& str)
+    : m_cfg(cfg), m_mr(mr), m_copy(copy), m_stream(str) {}
+
+template <typename simulator_t>
+measurement_collection_types::buffer
+simulation_algorithm<simulator_t>::operator()(
+    const typename simulator_t::detector_type::view_type& det_view,
+    const typename simulator_t::bfield_type& field_view,
+    const vecmem::data::jagged_vector_view<
+        typename simulator_t::intersection_type>& navigation_buffer,
+    const vecmem::data::vector_view<const free_track_parameters>& tracks_view,
+    std::uint64_t event) const {
+
+    TRACCC_TRACE_RANGE("traccc::cuda::simulation_algorithm");
+
+    // Get a convenience variable for the stream that we'll be using.
+    cudaStream_t stream = details::get_stream(m_stream);
+
+    // Every track can write up to the configured number of measurements.
+    const unsigned int n_tracks = m_copy.get_size(tracks_view);
+    measurement_collection_types::buffer measurements_buffer(
+        n_tracks * m_cfg.max_measurements_per_track, m_mr.main,
+        vecmem::data::buffer_type::resizable);
+    m_copy.setup(measurements_buffer);
+    m_copy.setup(navigation_buffer);
+
+    if (n_tracks > 0) {
+        const unsigned int nThreads = details::threads_per_block(
+            m_stream, "simulate_tracks",
+            kernels::simulate_tracks<
+                simulator_t, typename simulator_t::detector_type::view_type>,
+            WARP_SIZE * 2);
+        const auto grid = details::make_navigation_grid(navigation_buffer,
+                                                        n_tracks, nThreads);
+
+        // Run the simulation
+        details::kernel_timer simulate_timer(m_stream, "simulate_tracks",
+                                             grid.n_blocks, nThreads);
+        kernels::simulate_tracks<simulator_t>
+            <<<grid.n_blocks, nThreads, 0, stream>>>(
+                det_view, field_view, m_cfg, grid.candidates, tracks_view,
+                n_tracks, event, measurements_buffer);
+        simulate_timer.stop();
+        CUDA_ERROR_CHECK(cudaGetLastError());
+    }
+
+    m_stream.synchronize();
+
+    return measurements_buffer;
+}
+
+// Explicit template instantiation
+using default_detector_type =
+    detray::detector<detray::default_metadata, detray::device_container_types>;
+using default_stepper_type =
+    detray::rk_stepper<covfie::field<detray::bfield::const_bknd_t>::view_t,
+                       transform3, detray::constrained_step<>>;
+using default_navigator_type = detray::navigator<const default_detector_type>;
+template class simulation_algorithm<
+    track_simulator<default_stepper_type, default_navigator_type>>;
+
+}  // namespace traccc::cuda
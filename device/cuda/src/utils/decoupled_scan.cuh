@@ -0,0 +1,160 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s).
+#include "traccc/cuda/utils/definitions.hpp"
+
+namespace traccc::cuda::details {
+
+/// Single-pass inclusive prefix sum over the threads of a whole grid, with a
+/// decoupled look-back between the blocks
+///
+/// The blocks pick up their tiles in the order in which they start running,
+/// so they only ever wait for blocks that are already running. Every block
+/// publishes the sum of its tile as soon as it knows it, and the inclusive
+/// prefix of its tile once that is known. A block looks back over the
+/// published values of its predecessors until it finds an inclusive prefix.
+///
+/// The states live in device memory, with one element for the tile counter
+/// followed by one element per tile. They need to be zeroed before every
+/// scan. The block size must be a multiple of the warp size, and all threads
+/// of the block have to take part in the scan.
+///
+class decoupled_lookback_scan {
+
+    public:
+    /// The status of a tile, in the upper half of its state
+    enum status : unsigned long long {
+        invalid = 0ull,
+        aggregate = 1ull,
+        prefix = 2ull
+    };
+
+    /// The number of state elements needed for a given number of tiles
+    static constexpr unsigned int state_size(unsigned int n_tiles) {
+        return n_tiles + 1u;
+    }
+
+    /// Constructor with the (zeroed) states of the scan
+    __device__ explicit decoupled_lookback_scan(unsigned long long* states)
+        : m_states(states) {}
+
+    /// Pick up the tile of the current block
+    ///
+    /// @note This function synchronises the threads of the block.
+    ///
+    __device__ unsigned int tile() const {
+
+        __shared__ unsigned int tile_id;
+        if (threadIdx.x == 0u) {
+            tile_id = static_cast<unsigned int>(atomicAdd(m_states, 1ull));
+        }
+        __syncthreads();
+        return tile_id;
+    }
+
+    /// Scan the values of the threads
+    ///
+    /// @note This function synchronises the threads of the block.
+    ///
+    /// @param value The value of the current thread
+    /// @param tile_id The tile of the current block, from @c tile()
+    /// @return The sum of the values of all threads of this and of the
+    ///         preceding tiles, up to and including the current thread
+    ///
+    __device__ unsigned int inclusive_scan(unsigned int value,
+                                           unsigned int tile_id) const {
+
+        __shared__ unsigned int warp_sums[WARP_SIZE];
+        __shared__ unsigned int tile_prefix;
+
+        // Scan the values inside of the warps.
+        const unsigned int lane = threadIdx.x % WARP_SIZE;
+        const unsigned int warp = threadIdx.x / WARP_SIZE;
+        for (unsigned int offset = 1u; offset < WARP_SIZE; offset *= 2u) {
+            const unsigned int other =
+                __shfl_up_sync(full_mask, value, offset);
+            if (lane >= offset) {
+                value += other;
+            }
+        }
+        if (lane == WARP_SIZE - 1u) {
+            warp_sums[warp] = value;
+        }
+        __syncthreads();
+
+        // Scan the sums of the warps, with the first warp.
+        const unsigned int n_warps = blockDim.x / WARP_SIZE;
+        if (warp == 0u) {
+            unsigned int sum = (lane < n_warps ? warp_sums[lane] : 0u);
+            for (unsigned int offset = 1u; offset < WARP_SIZE; offset *= 2u) {
+                const unsigned int other =
+                    __shfl_up_sync(full_mask, sum, offset);
+                if (lane >= offset) {
+                    sum += other;
+                }
+            }
+            if (lane < n_warps) {
+                warp_sums[lane] = sum;
+            }
+        }
+        __syncthreads();
+        if (warp > 0u) {
+            value += warp_sums[warp - 1u];
+        }
+
+        // Find the prefix of the tile, publishing the sum of the tile first.
+        if (threadIdx.x == 0u) {
+            const unsigned int tile_sum = warp_sums[n_warps - 1u];
+            unsigned int exclusive = 0u;
+            if (tile_id > 0u) {
+                publish(tile_id, aggregate, tile_sum);
+                for (unsigned int i = tile_id; i > 0u; --i) {
+                    unsigned long long state = 0ull;
+                    do {
+                        state = load(i - 1u);
+                    } while ((state >> 32) == invalid);
+                    exclusive += static_cast<unsigned int>(state);
+                    if ((state >> 32) == prefix) {
+                        break;
+                    }
+                }
+            }
+            publish(tile_id, prefix, exclusive + tile_sum);
+            tile_prefix = exclusive;
+        }
+        __syncthreads();
+
+        return tile_prefix + value;
+    }
+
+    private:
+    /// Mask selecting all threads of a warp
+    static constexpr unsigned int full_mask = 0xffffffff;
+
+    /// Publish the state of a tile
+    __device__ void publish(unsigned int tile_id, status s,
+                            unsigned int value) const {
+        const unsigned long long state =
+            (static_cast<unsigned long long>(s) << 32) | value;
+        atomicExch(m_states + tile_id + 1u, state);
+    }
+
+    /// Read the state of a tile
+    __device__ unsigned long long load(unsigned int tile_id) const {
+        const volatile unsigned long long* state = m_states + tile_id + 1u;
+        return *state;
+    }
+
+    /// The states of the scan
+    unsigned long long* m_states;
+
+};  // class decoupled_lookback_scan
+
+}  // namespace traccc::cuda::details
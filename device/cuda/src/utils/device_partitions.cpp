@@ -0,0 +1,119 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Local include(s).
+#include "traccc/cuda/utils/device_partitions.hpp"
+
+#include "traccc/cuda/utils/definitions.hpp"
+
+// CUDA include(s).
+#include <cuda_runtime_api.h>
+
+// System include(s).
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <ostream>
+
+namespace traccc::cuda {
+
+namespace {
+
+/// Format a CUDA UUID the way @c nvidia-smi does
+std::string format_uuid(const cudaUUID_t& uuid, bool mig) {
+
+    std::string result = (mig ? "MIG-" : "GPU-");
+    for (int i = 0; i < 16; ++i) {
+        if ((i == 4) || (i == 6) || (i == 8) || (i == 10)) {
+            result += '-';
+        }
+        char byte[3];
+        std::snprintf(byte, sizeof(byte), "%02x",
+                      static_cast<unsigned char>(uuid.bytes[i]));
+        result += byte;
+    }
+    return result;
+}
+
+/// Get the active thread percentage of the MPS client, if the process is one
+///
+/// @return The percentage, or 0 if the process is not an MPS client
+///
+unsigned int mps_active_thread_percentage() {
+
+    if (const char* value = std::getenv("CUDA_MPS_ACTIVE_THREAD_PERCENTAGE")) {
+        const long percentage = std::strtol(value, nullptr, 10);
+        return static_cast<unsigned int>(std::clamp(percentage, 1l, 100l));
+    }
+    const char* pipe_dir = std::getenv("CUDA_MPS_PIPE_DIRECTORY");
+    const std::filesystem::path control =
+        std::filesystem::path{(pipe_dir != nullptr) ? pipe_dir
+                                                    : "/tmp/nvidia-mps"} /
+        "control";
+    std::error_code ec;
+    return (std::filesystem::exists(control, ec) ? 100u : 0u);
+}
+
+}  // namespace
+
+unsigned int device_partition::usable_sm_count() const {
+
+    // MPS rounds the share of the multiprocessors up.
+    return std::max(1u, (sm_count * active_thread_percentage + 99u) / 100u);
+}
+
+std::ostream& operator<<(std::ostream& out, const device_partition& partition) {
+
+    out << partition.name << " (" << partition.uuid << ", ";
+    switch (partition.kind) {
+        case partition_kind::full_device:
+            out << "full device";
+            break;
+        case partition_kind::mig_instance:
+            out << "MIG instance";
+            break;
+        case partition_kind::mps_client:
+            out << "MPS client, " << partition.active_thread_percentage
+                << "% of the threads";
+            break;
+    }
+    out << ", " << partition.usable_sm_count() << " SMs)";
+    return out;
+}
+
+std::vector<device_partition> get_device_partitions() {
+
+    int n_devices = 0;
+    CUDA_ERROR_CHECK(cudaGetDeviceCount(&n_devices));
+    const unsigned int mps_percentage = mps_active_thread_percentage();
+
+    std::vector<device_partition> result;
+    result.reserve(static_cast<std::size_t>(n_devices));
+    for (int device = 0; device < n_devices; ++device) {
+
+        cudaDeviceProp props;
+        CUDA_ERROR_CHECK(cudaGetDeviceProperties(&props, device));
+
+        device_partition& partition = result.emplace_back();
+        partition.device = device;
+        partition.name = props.name;
+        const bool mig = (partition.name.find("MIG") != std::string::npos);
+        partition.uuid = format_uuid(props.uuid, mig);
+        partition.sm_count =
+            static_cast<unsigned int>(props.multiProcessorCount);
+        if (mig) {
+            partition.kind = partition_kind::mig_instance;
+        } else if (mps_percentage > 0) {
+            partition.kind = partition_kind::mps_client;
+            partition.active_thread_percentage = mps_percentage;
+        }
+    }
+    return result;
+}
+
+}  // namespace traccc::cuda
@@ -0,0 +1,78 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Local include(s).
+#include "traccc/cuda/utils/device_peaks.hpp"
+
+#include "traccc/cuda/utils/definitions.hpp"
+#include "utils.hpp"
+
+// CUDA include(s).
+#include <cuda_runtime_api.h>
+
+namespace traccc::cuda {
+
+namespace {
+
+/// Get the number of FP32 cores per multiprocessor of a compute capability
+int fp32_cores_per_sm(int major, int minor) {
+
+    switch (major) {
+        case 3:
+            return 192;
+        case 5:
+            return 128;
+        case 6:
+            return (minor == 0) ? 64 : 128;
+        case 7:
+            return 64;
+        case 8:
+            return (minor == 0) ? 64 : 128;
+        default:
+            // Hopper, Blackwell and (presumably) later architectures.
+            return 128;
+    }
+}
+
+/// Get an attribute of a CUDA device
+int get_attribute(cudaDeviceAttr attr, int device) {
+
+    int value = 0;
+    CUDA_ERROR_CHECK(cudaDeviceGetAttribute(&value, attr, device));
+    return value;
+}
+
+}  // namespace
+
+device_peaks get_device_peaks(int device) {
+
+    if (device < 0) {
+        device = details::get_device();
+    }
+
+    cudaDeviceProp props;
+    CUDA_ERROR_CHECK(cudaGetDeviceProperties(&props, device));
+
+    // The clock rates are in kHz, the bus width in bits. The memory is
+    // double data rate.
+    const double memory_clock = static_cast<double>(
+        get_attribute(cudaDevAttrMemoryClockRate, device));
+    const double bus_width = static_cast<double>(
+        get_attribute(cudaDevAttrGlobalMemoryBusWidth, device));
+    const double core_clock =
+        static_cast<double>(get_attribute(cudaDevAttrClockRate, device));
+
+    device_peaks result;
+    result.name = props.name;
+    result.bandwidth = 2. * memory_clock * 1e3 * (bus_width / 8.) * 1e-9;
+    result.gflops = 2. * props.multiProcessorCount *
+                    fp32_cores_per_sm(props.major, props.minor) * core_clock *
+                    1e3 * 1e-9;
+    return result;
+}
+
+}  // namespace traccc::cuda
@@ -0,0 +1,56 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Local include(s).
+#include "traccc/cuda/utils/host_registration.hpp"
+
+#include "traccc/cuda/utils/definitions.hpp"
+
+// CUDA include(s).
+#include <cuda_runtime_api.h>
+
+namespace traccc::cuda {
+
+host_registration::host_registration(const void* ptr, std::size_t size)
+    : m_ptr(const_cast<void*>(ptr)) {
+
+    CUDA_ERROR_CHECK(cudaHostRegister(
+        m_ptr, size, cudaHostRegisterPortable | cudaHostRegisterReadOnly));
+}
+
+host_registration::host_registration(host_registration&& parent)
+    : m_ptr(parent.m_ptr) {
+
+    parent.m_ptr = nullptr;
+}
+
+host_registration::~host_registration() {
+
+    if (m_ptr != nullptr) {
+        cudaHostUnregister(m_ptr);
+    }
+}
+
+host_registration& host_registration::operator=(host_registration&& rhs) {
+
+    // Avoid self-assignment.
+    if (this == &rhs) {
+        return *this;
+    }
+
+    // Release the current registration, and take over the other one.
+    if (m_ptr != nullptr) {
+        cudaHostUnregister(m_ptr);
+    }
+    m_ptr = rhs.m_ptr;
+    rhs.m_ptr = nullptr;
+
+    // Return this object.
+    return *this;
+}
+
+}  // namespace traccc::cuda
@@ -0,0 +1,261 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Local include(s).
+#include "traccc/cuda/utils/kernel_profiler.hpp"
+
+#include "traccc/cuda/utils/definitions.hpp"
+
+// CUDA include(s).
+#include <cuda_runtime_api.h>
+
+// System include(s).
+#include <algorithm>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <map>
+#include <mutex>
+
+namespace traccc::cuda {
+
+namespace {
+
+/// Identifier of the launches that are not profiled
+constexpr std::size_t invalid_launch = std::numeric_limits<std::size_t>::max();
+
+/// Add one kernel measurement to a report
+void add_measurement(kernel_timing_report& report, std::string_view name,
+                     float time_ms, unsigned int n_blocks,
+                     unsigned int n_threads) {
+
+    auto it = std::find_if(
+        report.kernels.begin(), report.kernels.end(),
+        [name](const kernel_statistics& stat) { return stat.name == name; });
+    if (it == report.kernels.end()) {
+        kernel_statistics stat;
+        stat.name = name;
+        stat.min_ms = time_ms;
+        stat.max_ms = time_ms;
+        report.kernels.push_back(stat);
+        it = report.kernels.end() - 1;
+    }
+    ++(it->launches);
+    it->total_ms += time_ms;
+    it->min_ms = std::min(it->min_ms, time_ms);
+    it->max_ms = std::max(it->max_ms, time_ms);
+    it->total_blocks += n_blocks;
+    it->max_blocks = std::max(it->max_blocks, n_blocks);
+    it->threads_per_block = std::max(it->threads_per_block, n_threads);
+}
+
+}  // namespace
+
+void kernel_timing_report::merge(const kernel_timing_report& other) {
+
+    for (const kernel_statistics& stat : other.kernels) {
+        auto it = std::find_if(kernels.begin(), kernels.end(),
+                               [&stat](const kernel_statistics& s) {
+                                   return s.name == stat.name;
+                               });
+        if (it == kernels.end()) {
+            kernels.push_back(stat);
+            continue;
+        }
+        it->min_ms = std::min(it->min_ms, stat.min_ms);
+        it->max_ms = std::max(it->max_ms, stat.max_ms);
+        it->launches += stat.launches;
+        it->total_ms += stat.total_ms;
+        it->total_blocks += stat.total_blocks;
+        it->max_blocks = std::max(it->max_blocks, stat.max_blocks);
+        it->threads_per_block =
+            std::max(it->threads_per_block, stat.threads_per_block);
+    }
+}
+
+std::ostream& operator<<(std::ostream& out,
+                         const kernel_timing_report& report) {
+
+    out << std::setw(36) << std::left << "Kernel" << std::right
+        << std::setw(10) << "launches" << std::setw(12) << "total [ms]"
+        << std::setw(11) << "mean [ms]" << std::setw(11) << "max [ms]"
+        << std::setw(12) << "mean blocks" << std::setw(9) << "threads";
+    const auto flags = out.flags();
+    const auto precision = out.precision();
+    out << std::fixed << std::setprecision(3);
+    for (const kernel_statistics& stat : report.kernels) {
+        const double n = static_cast<double>(std::max<std::size_t>(
+            stat.launches, 1u));
+        out << "\n"
+            << std::setw(36) << std::left << stat.name << std::right
+            << std::setw(10) << stat.launches << std::setw(12)
+            << stat.total_ms << std::setw(11) << stat.total_ms / n
+            << std::setw(11) << stat.max_ms << std::setw(12)
+            << std::setprecision(1)
+            << static_cast<double>(stat.total_blocks) / n
+            << std::setprecision(3) << std::setw(9)
+            << stat.threads_per_block;
+    }
+    out.flags(flags);
+    out.precision(precision);
+    return out;
+}
+
+/// Internal data of @c traccc::cuda::kernel_profiler
+struct kernel_profiler::impl {
+
+    /// One (started) kernel launch
+    struct launch {
+        /// The name of the kernel
+        std::string name;
+        /// The number of blocks of the launch
+        unsigned int n_blocks = 0;
+        /// The number of threads per block of the launch
+        unsigned int n_threads = 0;
+        /// Event recorded before the kernel
+        cudaEvent_t start = nullptr;
+        /// Event recorded after the kernel
+        cudaEvent_t stop = nullptr;
+        /// Whether the stop event was recorded already
+        bool stopped = false;
+    };
+
+    /// Get an event from the pool, or create a new one
+    cudaEvent_t get_event() {
+        if (event_pool.empty()) {
+            cudaEvent_t event = nullptr;
+            CUDA_ERROR_CHECK(cudaEventCreate(&event));
+            return event;
+        }
+        cudaEvent_t event = event_pool.back();
+        event_pool.pop_back();
+        return event;
+    }
+
+    /// Resolve the launches that finished (or all of them, if requested)
+    void resolve(bool wait) {
+        for (auto it = launches.begin(); it != launches.end();) {
+            launch& l = it->second;
+            if (!l.stopped) {
+                ++it;
+                continue;
+            }
+            if (wait) {
+                CUDA_ERROR_CHECK(cudaEventSynchronize(l.stop));
+            } else {
+                const cudaError_t status = cudaEventQuery(l.stop);
+                if (status == cudaErrorNotReady) {
+                    ++it;
+                    continue;
+                }
+                CUDA_ERROR_CHECK(status);
+            }
+            float time_ms = 0.f;
+            CUDA_ERROR_CHECK(cudaEventElapsedTime(&time_ms, l.start, l.stop));
+            add_measurement(current, l.name, time_ms, l.n_blocks,
+                            l.n_threads);
+            event_pool.push_back(l.start);
+            event_pool.push_back(l.stop);
+            it = launches.erase(it);
+        }
+    }
+
+    /// Mutex protecting the data
+    mutable std::mutex mutex;
+    /// The launches not resolved yet
+    std::map<std::size_t, launch> launches;
+    /// Identifier of the next launch
+    std::size_t next_launch = 0;
+    /// Events not in use at the moment
+    std::vector<cudaEvent_t> event_pool;
+    /// Statistics of the current event
+    kernel_timing_report current;
+    /// Statistics of all finished events
+    kernel_timing_report totals;
+
+};  // struct kernel_profiler::impl
+
+kernel_profiler::kernel_profiler() : m_impl(std::make_unique<impl>()) {}
+
+kernel_profiler::~kernel_profiler() {
+
+    // Wait for the launches still in flight, before destroying their events.
+    for (auto& [id, l] : m_impl->launches) {
+        if (l.stopped) {
+            cudaEventSynchronize(l.stop);
+        }
+        cudaEventDestroy(l.start);
+        cudaEventDestroy(l.stop);
+    }
+    for (cudaEvent_t event : m_impl->event_pool) {
+        cudaEventDestroy(event);
+    }
+}
+
+void kernel_profiler::poll() {
+
+    std::lock_guard lock{m_impl->mutex};
+    m_impl->resolve(false);
+}
+
+kernel_timing_report kernel_profiler::finish_event() {
+
+    std::lock_guard lock{m_impl->mutex};
+    m_impl->resolve(true);
+    kernel_timing_report result;
+    std::swap(result, m_impl->current);
+    m_impl->totals.merge(result);
+    return result;
+}
+
+kernel_timing_report kernel_profiler::totals() const {
+
+    std::lock_guard lock{m_impl->mutex};
+    return m_impl->totals;
+}
+
+std::size_t kernel_profiler::start_kernel(std::string_view name,
+                                          unsigned int n_blocks,
+                                          unsigned int n_threads,
+                                          void* stream) {
+
+    // Events can not be recorded into streams that are being captured into a
+    // graph. Launches made during a capture are not profiled.
+    cudaStreamCaptureStatus capture = cudaStreamCaptureStatusNone;
+    CUDA_ERROR_CHECK(
+        cudaStreamIsCapturing(static_cast<cudaStream_t>(stream), &capture));
+    if (capture != cudaStreamCaptureStatusNone) {
+        return invalid_launch;
+    }
+
+    std::lock_guard lock{m_impl->mutex};
+    impl::launch l;
+    l.name = name;
+    l.n_blocks = n_blocks;
+    l.n_threads = n_threads;
+    l.start = m_impl->get_event();
+    l.stop = m_impl->get_event();
+    CUDA_ERROR_CHECK(
+        cudaEventRecord(l.start, static_cast<cudaStream_t>(stream)));
+    const std::size_t id = m_impl->next_launch++;
+    m_impl->launches.emplace(id, std::move(l));
+    return id;
+}
+
+void kernel_profiler::stop_kernel(std::size_t launch, void* stream) {
+
+    std::lock_guard lock{m_impl->mutex};
+    auto it = m_impl->launches.find(launch);
+    if (it == m_impl->launches.end()) {
+        return;
+    }
+    CUDA_ERROR_CHECK(
+        cudaEventRecord(it->second.stop, static_cast<cudaStream_t>(stream)));
+    it->second.stopped = true;
+}
+
+}  // namespace traccc::cuda
@@ -0,0 +1,73 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s).
+#include "traccc/cuda/utils/kernel_profiler.hpp"
+#include "traccc/cuda/utils/stream.hpp"
+
+// System include(s).
+#include <cstddef>
+#include <string_view>
+
+namespace traccc::cuda::details {
+
+/// Helper recording the execution time of a kernel launch
+///
+/// It does nothing, unless a @c traccc::cuda::kernel_profiler is attached to
+/// the stream that the kernel is launched on. Must be constructed right
+/// before the kernel launch, and stopped (or destructed) right after it.
+///
+class kernel_timer {
+
+    public:
+    /// Record the start of a kernel launch
+    ///
+    /// @param str The stream that the kernel is launched on
+    /// @param name The name of the kernel
+    /// @param n_blocks The number of blocks of the launch
+    /// @param n_threads The number of threads per block of the launch
+    ///
+    kernel_timer(const stream& str, std::string_view name,
+                 unsigned int n_blocks, unsigned int n_threads)
+        : m_profiler(str.profiler()), m_stream(str.cudaStream()) {
+
+        if (m_profiler != nullptr) {
+            m_launch =
+                m_profiler->start_kernel(name, n_blocks, n_threads, m_stream);
+        }
+    }
+
+    /// Record the end of the kernel launch, if it was not done yet
+    ~kernel_timer() { stop(); }
+
+    /// Record the end of the kernel launch
+    void stop() {
+
+        if (m_profiler != nullptr) {
+            m_profiler->stop_kernel(m_launch, m_stream);
+            m_profiler = nullptr;
+        }
+    }
+
+    /// The timer can not be copied
+    kernel_timer(const kernel_timer&) = delete;
+    /// The timer can not be copied
+    kernel_timer& operator=(const kernel_timer&) = delete;
+
+    private:
+    /// The profiler to record the launch with (if any)
+    kernel_profiler* m_profiler;
+    /// The (typeless) stream of the launch
+    void* m_stream;
+    /// Identifier of the launch in the profiler
+    std::size_t m_launch = 0;
+
+};  // class kernel_timer
+
+}  // namespace traccc::cuda::details
@@ -0,0 +1,102 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Local include(s).
+#include "traccc/cuda/utils/l2_persistence.hpp"
+
+#include "traccc/cuda/utils/definitions.hpp"
+
+// CUDA include(s).
+#include <cuda_runtime_api.h>
+
+namespace traccc::cuda {
+
+l2_persistence::l2_persistence(stream& str, const void* ptr, std::size_t size)
+    : m_stream(str.cudaStream()) {
+
+    // Check whether the device can keep the whole range persistent.
+    int device = 0, max_persisting = 0, max_window = 0;
+    CUDA_ERROR_CHECK(cudaGetDevice(&device));
+    CUDA_ERROR_CHECK(cudaDeviceGetAttribute(
+        &max_persisting, cudaDevAttrMaxPersistingL2CacheSize, device));
+    CUDA_ERROR_CHECK(cudaDeviceGetAttribute(
+        &max_window, cudaDevAttrMaxAccessPolicyWindowSize, device));
+    if ((ptr == nullptr) || (size == 0) ||
+        (size > static_cast<std::size_t>(max_persisting)) ||
+        (size > static_cast<std::size_t>(max_window))) {
+        return;
+    }
+
+    // Set aside (at least) enough of the L2 cache for the range. The limit is
+    // device-wide, so it is only ever increased here.
+    std::size_t limit = 0;
+    CUDA_ERROR_CHECK(
+        cudaDeviceGetLimit(&limit, cudaLimitPersistingL2CacheSize));
+    if (limit < size) {
+        CUDA_ERROR_CHECK(
+            cudaDeviceSetLimit(cudaLimitPersistingL2CacheSize, size));
+    }
+
+    // Set the access window on the stream.
+    cudaStreamAttrValue attribute{};
+    attribute.accessPolicyWindow.base_ptr = const_cast<void*>(ptr);
+    attribute.accessPolicyWindow.num_bytes = size;
+    attribute.accessPolicyWindow.hitRatio = 1.f;
+    attribute.accessPolicyWindow.hitProp = cudaAccessPropertyPersisting;
+    attribute.accessPolicyWindow.missProp = cudaAccessPropertyStreaming;
+    CUDA_ERROR_CHECK(cudaStreamSetAttribute(
+        static_cast<cudaStream_t>(m_stream),
+        cudaStreamAttributeAccessPolicyWindow, &attribute));
+    m_size = size;
+}
+
+l2_persistence::l2_persistence(l2_persistence&& parent)
+    : m_stream(parent.m_stream), m_size(parent.m_size) {
+
+    parent.m_size = 0;
+}
+
+l2_persistence::~l2_persistence() {
+
+    reset();
+}
+
+l2_persistence& l2_persistence::operator=(l2_persistence&& rhs) {
+
+    // Avoid self-assignment.
+    if (this == &rhs) {
+        return *this;
+    }
+
+    // Release the current window, and take over the other one.
+    reset();
+    m_stream = rhs.m_stream;
+    m_size = rhs.m_size;
+    rhs.m_size = 0;
+
+    // Return this object.
+    return *this;
+}
+
+std::size_t l2_persistence::size() const {
+
+    return m_size;
+}
+
+void l2_persistence::reset() {
+
+    if (m_size == 0) {
+        return;
+    }
+    cudaStreamAttrValue attribute{};
+    attribute.accessPolicyWindow.num_bytes = 0;
+    cudaStreamSetAttribute(static_cast<cudaStream_t>(m_stream),
+                           cudaStreamAttributeAccessPolicyWindow, &attribute);
+    m_size = 0;
+}
+
+}  // namespace traccc::cuda
@@ -0,0 +1,57 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s).
+#include "traccc/cuda/utils/definitions.hpp"
+#include "traccc/cuda/utils/launch_tuning.hpp"
+#include "traccc/cuda/utils/stream.hpp"
+
+// CUDA include(s).
+#include <cuda_runtime.h>
+
+// System include(s).
+#include <string_view>
+
+namespace traccc::cuda::details {
+
+/// Get the number of threads per block to launch a tunable kernel with
+///
+/// Uses the block size of the launch tuning attached to the stream, limited
+/// to the largest (full warp) block size that the kernel can be launched
+/// with. Without a tuning, the default block size is used.
+///
+/// @param str The stream that the kernel is launched on
+/// @param name The name of the kernel, as used by its @c kernel_timer
+/// @param kernel The kernel function
+/// @param default_threads The default block size of the kernel
+///
+template <typename kernel_t>
+unsigned int threads_per_block(const stream& str, std::string_view name,
+                               kernel_t* kernel,
+                               unsigned int default_threads) {
+
+    const launch_tuning* tuning = str.tuning();
+    if (tuning == nullptr) {
+        return default_threads;
+    }
+    const unsigned int threads =
+        tuning->threads_per_block(name, default_threads);
+    if (threads == default_threads) {
+        return threads;
+    }
+
+    cudaFuncAttributes attributes;
+    CUDA_ERROR_CHECK(cudaFuncGetAttributes(&attributes, kernel));
+    const unsigned int max_threads =
+        static_cast<unsigned int>(attributes.maxThreadsPerBlock) / WARP_SIZE *
+        WARP_SIZE;
+    return (threads < max_threads) ? threads : max_threads;
+}
+
+}  // namespace traccc::cuda::details
@@ -0,0 +1,208 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Local include(s).
+#include "traccc/cuda/utils/launch_tuning.hpp"
+
+#include "traccc/cuda/utils/definitions.hpp"
+#include "traccc/cuda/utils/kernel_profiler.hpp"
+#include "traccc/cuda/utils/stream.hpp"
+#include "utils.hpp"
+
+// CUDA include(s).
+#include <cuda_runtime_api.h>
+
+// System include(s).
+#include <fstream>
+#include <limits>
+#include <set>
+#include <sstream>
+#include <stdexcept>
+
+namespace traccc::cuda {
+
+namespace {
+
+/// Keyword of the line holding the device name in the tuning files
+constexpr std::string_view device_keyword = "device";
+
+}  // namespace
+
+launch_tuning launch_tuning::uniform(unsigned int threads_per_block) {
+
+    launch_tuning result;
+    result.m_uniform = threads_per_block;
+    return result;
+}
+
+launch_tuning launch_tuning::read(const std::string& filename) {
+
+    std::ifstream file(filename);
+    if (!file.good()) {
+        throw std::runtime_error("Could not open launch tuning file: " +
+                                 filename);
+    }
+
+    launch_tuning result;
+    std::string line;
+    while (std::getline(file, line)) {
+
+        // Skip empty and comment lines.
+        const std::size_t start = line.find_first_not_of(" \t");
+        if ((start == std::string::npos) || (line[start] == '#')) {
+            continue;
+        }
+
+        std::istringstream fields(line.substr(start));
+        std::string kernel;
+        fields >> kernel;
+        if (kernel == device_keyword) {
+            std::string name;
+            std::getline(fields >> std::ws, name);
+            result.set_device_name(name);
+            continue;
+        }
+        unsigned int threads = 0;
+        if (!(fields >> threads) || (threads == 0u) ||
+            (threads % WARP_SIZE != 0u)) {
+            throw std::runtime_error("Invalid line in launch tuning file " +
+                                     filename + ": " + line);
+        }
+        result.set(kernel, threads);
+    }
+    return result;
+}
+
+void launch_tuning::write(const std::string& filename) const {
+
+    std::ofstream file(filename);
+    if (!file.good()) {
+        throw std::runtime_error("Could not open launch tuning file: " +
+                                 filename);
+    }
+
+    file << "# Threads per block of the traccc CUDA kernels\n";
+    if (!m_device_name.empty()) {
+        file << device_keyword << " " << m_device_name << "\n";
+    }
+    for (const auto& [kernel, threads] : m_threads) {
+        file << kernel << " " << threads << "\n";
+    }
+    if (!file.good()) {
+        throw std::runtime_error("Could not write launch tuning file: " +
+                                 filename);
+    }
+}
+
+void launch_tuning::set(std::string_view kernel,
+                        unsigned int threads_per_block) {
+
+    auto it = m_threads.find(kernel);
+    if (it == m_threads.end()) {
+        m_threads.emplace(std::string{kernel}, threads_per_block);
+    } else {
+        it->second = threads_per_block;
+    }
+}
+
+unsigned int launch_tuning::threads_per_block(
+    std::string_view kernel, unsigned int default_threads) const {
+
+    if (m_uniform != 0u) {
+        return m_uniform;
+    }
+    auto it = m_threads.find(kernel);
+    return (it == m_threads.end()) ? default_threads : it->second;
+}
+
+std::size_t launch_tuning::size() const {
+
+    return m_threads.size();
+}
+
+const std::string& launch_tuning::device_name() const {
+
+    return m_device_name;
+}
+
+void launch_tuning::set_device_name(std::string_view name) {
+
+    m_device_name = name;
+}
+
+std::vector<unsigned int> launch_tuning_candidates() {
+
+    return {WARP_SIZE, WARP_SIZE * 2, WARP_SIZE * 4, WARP_SIZE * 8,
+            WARP_SIZE * 16, WARP_SIZE * 32};
+}
+
+launch_tuning autotune_launches(stream& str,
+                                const std::function<void()>& process_event,
+                                unsigned int repetitions) {
+
+    // Remember what was attached to the stream.
+    kernel_profiler* const old_profiler = str.profiler();
+    const launch_tuning* const old_tuning = str.tuning();
+
+    // The best mean execution time of every kernel, with the block size that
+    // it was reached with, and the block sizes that each kernel was actually
+    // launched with.
+    struct best_launch {
+        float mean_ms = std::numeric_limits<float>::max();
+        unsigned int threads_per_block = 0;
+        std::set<unsigned int> launched_with;
+    };
+    std::map<std::string, best_launch, std::less<>> best;
+
+    for (unsigned int candidate : launch_tuning_candidates()) {
+
+        const launch_tuning tuning = launch_tuning::uniform(candidate);
+        kernel_profiler profiler;
+        str.set_tuning(&tuning);
+        str.set_profiler(&profiler);
+
+        // Warm up with the new block sizes, before measuring them.
+        process_event();
+        profiler.finish_event();
+        for (unsigned int i = 0; i < repetitions; ++i) {
+            process_event();
+        }
+        const kernel_timing_report report = profiler.finish_event();
+
+        for (const kernel_statistics& stat : report.kernels) {
+            best_launch& b = best[stat.name];
+            b.launched_with.insert(stat.threads_per_block);
+            if (stat.launches == 0u) {
+                continue;
+            }
+            const float mean_ms =
+                stat.total_ms / static_cast<float>(stat.launches);
+            if (mean_ms < b.mean_ms) {
+                b.mean_ms = mean_ms;
+                b.threads_per_block = stat.threads_per_block;
+            }
+        }
+    }
+    str.set_profiler(old_profiler);
+    str.set_tuning(old_tuning);
+
+    // Only record the kernels that did follow the candidate block sizes.
+    // The others have fixed launch parameters.
+    launch_tuning result;
+    for (const auto& [kernel, b] : best) {
+        if ((b.launched_with.size() > 1u) && (b.threads_per_block > 0u)) {
+            result.set(kernel, b.threads_per_block);
+        }
+    }
+
+    cudaDeviceProp props;
+    CUDA_ERROR_CHECK(cudaGetDeviceProperties(&props, details::get_device()));
+    result.set_device_name(props.name);
+    return result;
+}
+
+}  // namespace traccc::cuda
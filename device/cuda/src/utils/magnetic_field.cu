@@ -0,0 +1,39 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Project include(s).
+#include "traccc/cuda/utils/magnetic_field.hpp"
+
+// Covfie include(s).
+#include <covfie/core/parameter_pack.hpp>
+
+namespace traccc::cuda {
+
+inhom_global_field_t make_global_field(
+    const detray::bfield::inhom_field_t& field) {
+
+    // Keep the affine transformation of the host field, and copy its strided
+    // grid into device memory. (With a linear interpolation replacing the
+    // nearest neighbour look-up, which has no configuration either.)
+    return inhom_global_field_t(covfie::make_parameter_pack(
+        field.backend().get_configuration(),
+        field.backend().get_backend().get_configuration(),
+        field.backend().get_backend().get_backend()));
+}
+
+inhom_texture_field_t make_texture_field(
+    const detray::bfield::inhom_field_t& field) {
+
+    // Keep the affine transformation of the host field, and create the
+    // texture from its strided grid. (Whose interpolation replaces the
+    // nearest neighbour look-up.)
+    return inhom_texture_field_t(covfie::make_parameter_pack(
+        field.backend().get_configuration(),
+        field.backend().get_backend().get_backend()));
+}
+
+}  // namespace traccc::cuda
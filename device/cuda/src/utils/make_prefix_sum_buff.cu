@@ -6,6 +6,8 @@
  */
 
 // Local include(s).
+#include "decoupled_scan.cuh"
+#include "kernel_timer.hpp"
 #include "traccc/cuda/utils/definitions.hpp"
 #include "utils.hpp"
 
@@ -13,6 +15,9 @@
 #include "traccc/cuda/utils/make_prefix_sum_buff.hpp"
 #include "traccc/device/make_prefix_sum_buffer.hpp"
 
+// System include(s).
+#include <type_traits>
+
 namespace traccc::cuda {
 
 namespace kernels {
@@ -26,6 +31,30 @@ __global__ void fill_prefix_sum(
                             ps_view);
 }
 
+/// CUDA kernel summing up the sizes of a jagged vector, in a single pass
+__global__ void sum_prefix_sum_sizes(
+    vecmem::data::vector_view<const device::prefix_sum_size_t> sizes_view,
+    vecmem::data::vector_view<device::prefix_sum_size_t> sums_view,
+    unsigned long long* scan_states) {
+
+    static_assert(std::is_same_v<device::prefix_sum_size_t, unsigned int>,
+                  "The scan is implemented for unsigned int sizes");
+
+    const details::decoupled_lookback_scan scan(scan_states);
+    const unsigned int tile = scan.tile();
+    const unsigned int gid = threadIdx.x + tile * blockDim.x;
+
+    const vecmem::device_vector<const device::prefix_sum_size_t> sizes(
+        sizes_view);
+    vecmem::device_vector<device::prefix_sum_size_t> sums(sums_view);
+
+    const unsigned int sum =
+        scan.inclusive_scan((gid < sizes.size() ? sizes[gid] : 0u), tile);
+    if (gid < sums.size()) {
+        sums[gid] = sum;
+    }
+}
+
 }  // namespace kernels
 
 vecmem::data::vector_buffer<device::prefix_sum_element_t> make_prefix_sum_buff(
@@ -82,11 +111,74 @@ vecmem::data::vector_buffer<device::prefix_sum_element_t> make_prefix_sum_buff(
     static const unsigned int threadsPerBlock = 32;
     const unsigned int blocks =
         (sizes_sum_view.size() + threadsPerBlock - 1) / threadsPerBlock;
+    details::kernel_timer fill_prefix_sum_timer(str, "fill_prefix_sum", blocks,
+                                                threadsPerBlock);
     kernels::fill_prefix_sum<<<blocks, threadsPerBlock, 0,
                                details::get_stream(str)>>>(sizes_sum_view,
                                                            prefix_sum_buff);
+    fill_prefix_sum_timer.stop();
+    CUDA_ERROR_CHECK(cudaGetLastError());
+
+    return prefix_sum_buff;
+}
+
+vecmem::data::vector_buffer<device::prefix_sum_element_t> make_prefix_sum_buff(
+    const vecmem::data::vector_view<const device::prefix_sum_size_t>& sizes,
+    vecmem::copy& copy, const traccc::memory_resource& mr, const stream& str) {
+
+    if (sizes.size() == 0) {
+        return {0, mr.main};
+    }
+    cudaStream_t stream = details::get_stream(str);
+
+    // Sum up the sizes on the device.
+    static const unsigned int threadsPerBlock = WARP_SIZE * 2;
+    const unsigned int blocks =
+        (sizes.size() + threadsPerBlock - 1) / threadsPerBlock;
+    vecmem::data::vector_buffer<device::prefix_sum_size_t> sizes_sum_buff(
+        sizes.size(), mr.main);
+    copy.setup(sizes_sum_buff);
+    const unsigned int n_states =
+        details::decoupled_lookback_scan::state_size(blocks);
+    vecmem::data::vector_buffer<unsigned long long> scan_states_buff(n_states,
+                                                                     mr.main);
+    CUDA_ERROR_CHECK(cudaMemsetAsync(scan_states_buff.ptr(), 0,
+                                     n_states * sizeof(unsigned long long),
+                                     stream));
+    details::kernel_timer sum_sizes_timer(str, "sum_prefix_sum_sizes", blocks,
+                                          threadsPerBlock);
+    kernels::sum_prefix_sum_sizes<<<blocks, threadsPerBlock, 0, stream>>>(
+        sizes, sizes_sum_buff, scan_states_buff.ptr());
+    sum_sizes_timer.stop();
     CUDA_ERROR_CHECK(cudaGetLastError());
 
+    // Fetch the total size, to allocate the result with.
+    device::prefix_sum_size_t totalSize = 0;
+    CUDA_ERROR_CHECK(cudaMemcpyAsync(
+        &totalSize, sizes_sum_buff.ptr() + sizes.size() - 1,
+        sizeof(device::prefix_sum_size_t), cudaMemcpyDeviceToHost, stream));
+    str.synchronize();
+
+    if (totalSize == 0) {
+        return {0, mr.main};
+    }
+
+    // Create buffer and view objects for prefix sum vector
+    vecmem::data::vector_buffer<device::prefix_sum_element_t> prefix_sum_buff(
+        totalSize, mr.main);
+    copy.setup(prefix_sum_buff);
+
+    // Fill the prefix sum vector
+    details::kernel_timer fill_prefix_sum_timer(str, "fill_prefix_sum", blocks,
+                                                threadsPerBlock);
+    kernels::fill_prefix_sum<<<blocks, threadsPerBlock, 0, stream>>>(
+        sizes_sum_buff, prefix_sum_buff);
+    fill_prefix_sum_timer.stop();
+    CUDA_ERROR_CHECK(cudaGetLastError());
+
+    // Wait for the result, before releasing the sums of the sizes.
+    str.synchronize();
+
     return prefix_sum_buff;
 }
 
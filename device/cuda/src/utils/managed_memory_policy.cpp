@@ -0,0 +1,113 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Local include(s).
+#include "traccc/cuda/utils/managed_memory_policy.hpp"
+
+#include "traccc/cuda/utils/definitions.hpp"
+
+// CUDA include(s).
+#include <cuda_runtime_api.h>
+
+namespace traccc::cuda {
+namespace {
+
+/// Check whether the current device supports memory hints for managed memory
+bool supports_hints(int& device) {
+
+    CUDA_ERROR_CHECK(cudaGetDevice(&device));
+    int concurrent_access = 0;
+    CUDA_ERROR_CHECK(cudaDeviceGetAttribute(
+        &concurrent_access, cudaDevAttrConcurrentManagedAccess, device));
+    return (concurrent_access != 0);
+}
+
+}  // namespace
+
+managed_memory_policy::managed_memory_policy(vecmem::memory_resource& upstream,
+                                             usage u)
+    : m_upstream(upstream), m_usage(u) {}
+
+void managed_memory_policy::prefetch_to_device(stream& str) const {
+
+    // Devices without concurrent managed access migrate all managed memory
+    // at every kernel launch anyway.
+    int device = 0;
+    if (!supports_hints(device)) {
+        return;
+    }
+
+    std::lock_guard lock(m_mutex);
+    for (const auto& [ptr, size] : m_ranges) {
+        switch (m_usage) {
+            case usage::read_mostly:
+                CUDA_ERROR_CHECK(cudaMemAdvise(
+                    ptr, size, cudaMemAdviseSetReadMostly, device));
+                break;
+            case usage::device_resident:
+                CUDA_ERROR_CHECK(cudaMemAdvise(
+                    ptr, size, cudaMemAdviseSetPreferredLocation, device));
+                CUDA_ERROR_CHECK(cudaMemAdvise(
+                    ptr, size, cudaMemAdviseSetAccessedBy, device));
+                break;
+        }
+        CUDA_ERROR_CHECK(cudaMemPrefetchAsync(
+            ptr, size, device, static_cast<cudaStream_t>(str.cudaStream())));
+    }
+}
+
+void managed_memory_policy::prefetch_to_host(stream& str) const {
+
+    int device = 0;
+    if (!supports_hints(device)) {
+        return;
+    }
+
+    std::lock_guard lock(m_mutex);
+    for (const auto& [ptr, size] : m_ranges) {
+        CUDA_ERROR_CHECK(
+            cudaMemPrefetchAsync(ptr, size, cudaCpuDeviceId,
+                                 static_cast<cudaStream_t>(str.cudaStream())));
+    }
+}
+
+std::size_t managed_memory_policy::size() const {
+
+    std::lock_guard lock(m_mutex);
+    std::size_t result = 0;
+    for (const auto& range : m_ranges) {
+        result += range.second;
+    }
+    return result;
+}
+
+void* managed_memory_policy::do_allocate(std::size_t bytes,
+                                         std::size_t alignment) {
+
+    void* ptr = m_upstream.allocate(bytes, alignment);
+    std::lock_guard lock(m_mutex);
+    m_ranges[ptr] = bytes;
+    return ptr;
+}
+
+void managed_memory_policy::do_deallocate(void* ptr, std::size_t bytes,
+                                          std::size_t alignment) {
+
+    {
+        std::lock_guard lock(m_mutex);
+        m_ranges.erase(ptr);
+    }
+    m_upstream.deallocate(ptr, bytes, alignment);
+}
+
+bool managed_memory_policy::do_is_equal(
+    const vecmem::memory_resource& other) const noexcept {
+
+    return (this == &other);
+}
+
+}  // namespace traccc::cuda
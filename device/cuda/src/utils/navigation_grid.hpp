@@ -0,0 +1,68 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// VecMem include(s).
+#include <vecmem/containers/data/jagged_vector_view.hpp>
+
+// System include(s).
+#include <stdexcept>
+
+namespace traccc::cuda::details {
+
+/// Launch grid of a kernel re-using the navigation candidate vectors of a
+/// buffer
+///
+/// The navigation buffer needs no more candidate vectors than there are
+/// threads running concurrently. If it has fewer vectors than the number of
+/// tracks to process, the grid is shrunk to one thread per candidate
+/// vector, and every thread processes multiple tracks in a grid-stride loop.
+///
+/// @tparam intersection_t The type of the navigation candidates
+///
+template <typename intersection_t>
+struct navigation_grid {
+
+    /// The candidate vectors, one per thread of the grid if the grid is
+    /// shrunk
+    vecmem::data::jagged_vector_view<intersection_t> candidates;
+    /// The number of blocks to launch
+    unsigned int n_blocks;
+
+};  // struct navigation_grid
+
+/// Set up the launch grid of a kernel using a navigation buffer
+///
+/// @param buffer    The navigation candidate buffer
+/// @param n_items   The (maximal) number of tracks to process
+/// @param n_threads The number of threads per block
+/// @return The launch grid of the kernel
+///
+template <typename intersection_t>
+navigation_grid<intersection_t> make_navigation_grid(
+    const vecmem::data::jagged_vector_view<intersection_t>& buffer,
+    unsigned int n_items, unsigned int n_threads) {
+
+    // Every track can use its own candidate vector.
+    if (n_items <= buffer.size()) {
+        return {buffer, (n_items + n_threads - 1) / n_threads};
+    }
+
+    // If not, make the grid stride equal to the number of candidate vectors
+    // used, so that the tracks of one thread all map to the same vector.
+    const unsigned int n_blocks =
+        static_cast<unsigned int>(buffer.size()) / n_threads;
+    if (n_blocks == 0u) {
+        throw std::invalid_argument(
+            "The navigation buffer needs at least one candidate vector per "
+            "thread of a block");
+    }
+    return {{n_blocks * n_threads, buffer.ptr(), buffer.host_ptr()}, n_blocks};
+}
+
+}  // namespace traccc::cuda::details
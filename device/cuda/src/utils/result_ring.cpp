@@ -0,0 +1,164 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Local include(s).
+#include "traccc/cuda/utils/result_ring.hpp"
+
+#include "traccc/cuda/utils/definitions.hpp"
+
+// CUDA include(s).
+#include <cuda_runtime_api.h>
+
+// System include(s).
+#include <cstddef>
+#include <stdexcept>
+
+namespace traccc::cuda {
+
+struct result_ring::slot {
+
+    /// Destructor, releasing the page-locked buffer
+    ~slot() {
+        if (m_data != nullptr) {
+            cudaFreeHost(m_data);
+        }
+    }
+
+    /// Host function marking the copy into a slot as complete
+    ///
+    /// It runs on a thread of the CUDA runtime, so it must not make any CUDA
+    /// calls. It only hands the slot to the completion thread.
+    ///
+    static void CUDART_CB copied(void* user_data) {
+
+        slot* s = static_cast<slot*>(user_data);
+        {
+            std::lock_guard<std::mutex> lock(s->m_ring->m_mutex);
+            s->m_ring->m_ready.push_back(s);
+        }
+        s->m_ring->m_ready_cv.notify_one();
+    }
+
+    /// The ring of the slot
+    result_ring* m_ring = nullptr;
+    /// The page-locked buffer of the slot
+    void* m_data = nullptr;
+    /// The size of the buffer
+    std::size_t m_capacity = 0;
+    /// The size of the result in the buffer
+    std::size_t m_size = 0;
+    /// The callback of the result in the buffer
+    callback_type m_callback;
+
+};  // struct result_ring::slot
+
+result_ring::result_ring(stream& str, std::size_t n_slots) : m_stream(str) {
+
+    if (n_slots == 0u) {
+        throw std::invalid_argument("A result ring needs at least one slot");
+    }
+    m_slots.reserve(n_slots);
+    m_free.reserve(n_slots);
+    for (std::size_t i = 0; i < n_slots; ++i) {
+        m_slots.push_back(std::make_unique<slot>());
+        m_slots.back()->m_ring = this;
+        m_free.push_back(m_slots.back().get());
+    }
+    m_thread = std::thread([this]() { deliver(); });
+}
+
+result_ring::~result_ring() {
+
+    // Deliver the results still in flight, and stop the completion thread.
+    drain();
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_stop = true;
+    }
+    m_ready_cv.notify_all();
+    m_thread.join();
+}
+
+void result_ring::enqueue(const std::vector<block>& blocks,
+                          callback_type callback) {
+
+    // Take a free slot, waiting for one if necessary.
+    slot* s = nullptr;
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_free_cv.wait(lock, [this]() { return !m_free.empty(); });
+        s = m_free.back();
+        m_free.pop_back();
+        ++m_in_flight;
+    }
+
+    // Grow its buffer if the result does not fit into it. The slot is free,
+    // so no copy into the buffer is pending.
+    std::size_t size = 0;
+    for (const block& b : blocks) {
+        size += b.second;
+    }
+    if (size > s->m_capacity) {
+        if (s->m_data != nullptr) {
+            CUDA_ERROR_CHECK(cudaFreeHost(s->m_data));
+            s->m_data = nullptr;
+            s->m_capacity = 0;
+        }
+        CUDA_ERROR_CHECK(cudaMallocHost(&(s->m_data), size));
+        s->m_capacity = size;
+    }
+    s->m_size = size;
+    s->m_callback = std::move(callback);
+
+    // Queue the copies, and the host function completing them.
+    cudaStream_t stream = static_cast<cudaStream_t>(m_stream.cudaStream());
+    std::size_t offset = 0;
+    for (const block& b : blocks) {
+        if (b.second > 0u) {
+            CUDA_ERROR_CHECK(cudaMemcpyAsync(
+                static_cast<char*>(s->m_data) + offset, b.first, b.second,
+                cudaMemcpyDeviceToHost, stream));
+        }
+        offset += b.second;
+    }
+    CUDA_ERROR_CHECK(cudaLaunchHostFunc(stream, slot::copied, s));
+}
+
+void result_ring::drain() {
+
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_free_cv.wait(lock, [this]() { return m_in_flight == 0u; });
+}
+
+void result_ring::deliver() {
+
+    std::unique_lock<std::mutex> lock(m_mutex);
+    while (true) {
+
+        // Wait for a completed copy, or for the ring to stop.
+        m_ready_cv.wait(lock,
+                        [this]() { return (m_stop || !m_ready.empty()); });
+        if (m_ready.empty()) {
+            return;
+        }
+        slot* s = m_ready.front();
+        m_ready.pop_front();
+
+        // Hand the result to its callback, without holding the lock.
+        lock.unlock();
+        s->m_callback(s->m_data, s->m_size);
+        s->m_callback = nullptr;
+        lock.lock();
+
+        // Free the slot again.
+        m_free.push_back(s);
+        --m_in_flight;
+        m_free_cv.notify_all();
+    }
+}
+
+}  // namespace traccc::cuda
@@ -1,6 +1,6 @@
 /** TRACCC library, part of the ACTS project (R&D line)
  *
- * (c) 2022 CERN for the benefit of the ACTS project
+ * (c) 2022-2024 CERN for the benefit of the ACTS project
  *
  * Mozilla Public License Version 2.0
  */
@@ -12,6 +12,9 @@
 #include "traccc/cuda/utils/definitions.hpp"
 #include "utils.hpp"
 
+// Project include(s).
+#include "traccc/utils/trace.hpp"
+
 // CUDA include(s).
 #include <cuda_runtime_api.h>
 
@@ -27,7 +30,10 @@ stream::stream(int device) {
     m_stream = std::make_unique<details::opaque_stream>();
 }
 
-stream::stream(stream&& parent) : m_stream(std::move(parent.m_stream)) {}
+stream::stream(stream&& parent)
+    : m_stream(std::move(parent.m_stream)),
+      m_profiler(parent.m_profiler),
+      m_tuning(parent.m_tuning) {}
 
 /// The destructor is implemented explicitly to avoid clients of the class
 /// having to know how to destruct @c traccc::cuda::details::opaque_stream.
@@ -40,8 +46,11 @@ stream& stream::operator=(stream&& rhs) {
         return *this;
     }
 
-    // Move the managed queue object.
+    // Move the managed queue object, and the profiler and tuning attached to
+    // it.
     m_stream = std::move(rhs.m_stream);
+    m_profiler = rhs.m_profiler;
+    m_tuning = rhs.m_tuning;
 
     // Return this object.
     return *this;
@@ -54,7 +63,28 @@ void* stream::cudaStream() const {
 
 void stream::synchronize() const {
 
+    TRACCC_TRACE_RANGE("traccc::cuda::stream::synchronize");
     CUDA_ERROR_CHECK(cudaStreamSynchronize(m_stream->m_stream));
 }
 
+void stream::set_profiler(kernel_profiler* profiler) {
+
+    m_profiler = profiler;
+}
+
+kernel_profiler* stream::profiler() const {
+
+    return m_profiler;
+}
+
+void stream::set_tuning(const launch_tuning* tuning) {
+
+    m_tuning = tuning;
+}
+
+const launch_tuning* stream::tuning() const {
+
+    return m_tuning;
+}
+
 }  // namespace traccc::cuda
@@ -0,0 +1,141 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Local include(s).
+#include "traccc/cuda/utils/stream_ordered_memory_resource.hpp"
+
+#include "traccc/cuda/utils/definitions.hpp"
+#include "utils.hpp"
+
+// CUDA include(s).
+#include <cuda_runtime_api.h>
+
+// System include(s).
+#include <cstdint>
+#include <new>
+
+namespace traccc::cuda {
+namespace {
+
+/// Get a concrete @c cudaMemPool_t object out of its typeless pointer
+cudaMemPool_t get_pool(void* pool) {
+
+    return static_cast<cudaMemPool_t>(pool);
+}
+
+/// Get a (64-bit) attribute of a memory pool
+std::size_t get_attribute(void* pool, cudaMemPoolAttr attr) {
+
+    std::uint64_t value = 0;
+    CUDA_ERROR_CHECK(cudaMemPoolGetAttribute(get_pool(pool), attr, &value));
+    return static_cast<std::size_t>(value);
+}
+
+}  // namespace
+
+stream_ordered_memory_resource::stream_ordered_memory_resource(
+    const stream& str, int device, std::size_t release_threshold)
+    : m_stream(str),
+      m_device(device == stream::INVALID_DEVICE ? details::get_device()
+                                                : device) {
+
+    // Create a pool of device memory on the requested device.
+    cudaMemPoolProps props = {};
+    props.allocType = cudaMemAllocationTypePinned;
+    props.handleTypes = cudaMemHandleTypeNone;
+    props.location.type = cudaMemLocationTypeDevice;
+    props.location.id = m_device;
+    cudaMemPool_t pool = nullptr;
+    CUDA_ERROR_CHECK(cudaMemPoolCreate(&pool, &props));
+    m_pool = pool;
+
+    set_release_threshold(release_threshold);
+}
+
+stream_ordered_memory_resource::~stream_ordered_memory_resource() {
+
+    // Let the pending (stream-ordered) frees complete. The pool itself is
+    // only released by CUDA once all of its memory was given back to it.
+    m_stream.synchronize();
+    cudaMemPoolDestroy(get_pool(m_pool));
+}
+
+bool stream_ordered_memory_resource::is_supported(int device) {
+
+    int supported = 0;
+    CUDA_ERROR_CHECK(cudaDeviceGetAttribute(
+        &supported, cudaDevAttrMemoryPoolsSupported,
+        device == stream::INVALID_DEVICE ? details::get_device() : device));
+    return (supported != 0);
+}
+
+void stream_ordered_memory_resource::set_release_threshold(std::size_t bytes) {
+
+    std::uint64_t value = static_cast<std::uint64_t>(bytes);
+    CUDA_ERROR_CHECK(cudaMemPoolSetAttribute(
+        get_pool(m_pool), cudaMemPoolAttrReleaseThreshold, &value));
+}
+
+std::size_t stream_ordered_memory_resource::release_threshold() const {
+
+    return get_attribute(m_pool, cudaMemPoolAttrReleaseThreshold);
+}
+
+void stream_ordered_memory_resource::trim(std::size_t bytes_to_keep) {
+
+    // Memory freed on the stream is only given back to the pool once the
+    // stream reaches the frees.
+    m_stream.synchronize();
+    CUDA_ERROR_CHECK(cudaMemPoolTrimTo(get_pool(m_pool), bytes_to_keep));
+}
+
+std::size_t stream_ordered_memory_resource::reserved_size() const {
+
+    return get_attribute(m_pool, cudaMemPoolAttrReservedMemCurrent);
+}
+
+std::size_t stream_ordered_memory_resource::used_size() const {
+
+    return get_attribute(m_pool, cudaMemPoolAttrUsedMemCurrent);
+}
+
+void* stream_ordered_memory_resource::do_allocate(std::size_t bytes,
+                                                  std::size_t) {
+
+    // The allocations of the pool are aligned for any type, just like the
+    // ones of cudaMalloc(...).
+    if (bytes == 0) {
+        return nullptr;
+    }
+    void* ptr = nullptr;
+    const cudaError_t status = cudaMallocFromPoolAsync(
+        &ptr, bytes, get_pool(m_pool), details::get_stream(m_stream));
+    if (status == cudaErrorMemoryAllocation) {
+        // Clear the (non-sticky) error, and report it the C++ way.
+        cudaGetLastError();
+        throw std::bad_alloc();
+    }
+    CUDA_ERROR_CHECK(status);
+    return ptr;
+}
+
+void stream_ordered_memory_resource::do_deallocate(void* ptr, std::size_t,
+                                                   std::size_t) {
+
+    if (ptr == nullptr) {
+        return;
+    }
+    CUDA_ERROR_CHECK(cudaFreeAsync(ptr, details::get_stream(m_stream)));
+}
+
+bool stream_ordered_memory_resource::do_is_equal(
+    const vecmem::memory_resource& other) const noexcept {
+
+    return (this == &other);
+}
+
+}  // namespace traccc::cuda
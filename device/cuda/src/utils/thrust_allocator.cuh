@@ -0,0 +1,60 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// VecMem include(s).
+#include <vecmem/memory/memory_resource.hpp>
+
+// System include(s).
+#include <cstddef>
+
+namespace traccc::cuda::details {
+
+/// Allocator for the temporary storage of the Thrust algorithms
+///
+/// Without it, Thrust allocates (and frees) its temporary storage with
+/// @c cudaMalloc and @c cudaFree in every call, which synchronises the device
+/// implicitly. With this allocator the temporaries come from a memory
+/// resource of the algorithm, preferably a caching or arena resource. It is
+/// meant to be used like:
+///
+/// @code
+/// details::thrust_allocator alloc(m_mr.event_memory());
+/// thrust::sort(thrust::cuda::par_nosync(alloc).on(stream), ...);
+/// @endcode
+///
+/// The execution policies only hold a reference to the allocator, so it has
+/// to outlive them.
+///
+class thrust_allocator {
+
+    public:
+    /// The type allocated by Thrust
+    using value_type = char;
+
+    /// Constructor with the memory resource to allocate from
+    explicit thrust_allocator(vecmem::memory_resource& mr) : m_mr(&mr) {}
+
+    /// Allocate temporary storage
+    char* allocate(std::ptrdiff_t size) {
+        return static_cast<char*>(
+            m_mr->allocate(static_cast<std::size_t>(size)));
+    }
+
+    /// Release temporary storage
+    void deallocate(char* ptr, std::size_t size) {
+        m_mr->deallocate(ptr, size);
+    }
+
+    private:
+    /// The memory resource to allocate from
+    vecmem::memory_resource* m_mr;
+
+};  // class thrust_allocator
+
+}  // namespace traccc::cuda::details
@@ -0,0 +1,42 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// CUDA include(s).
+#include <cooperative_groups.h>
+
+namespace traccc::cuda::details {
+
+/// Functor reserving one element at the end of a compacted output, with one
+/// atomic operation per warp
+///
+/// The threads of a warp that append at the same time are grouped together,
+/// and one of them reserves the elements for all of them. It has the same
+/// interface as @c traccc::device::atomic_append.
+///
+struct warp_aggregated_append {
+
+    /// Reserve one element in an output
+    ///
+    /// @param counter The number of elements in the output
+    /// @return The index of the reserved element
+    ///
+    __device__ unsigned int operator()(unsigned int& counter) const {
+
+        const cooperative_groups::coalesced_group group =
+            cooperative_groups::coalesced_threads();
+        unsigned int first = 0u;
+        if (group.thread_rank() == 0u) {
+            first = atomicAdd(&counter, group.size());
+        }
+        return group.shfl(first, 0u) + group.thread_rank();
+    }
+
+};  // struct warp_aggregated_append
+
+}  // namespace traccc::cuda::details
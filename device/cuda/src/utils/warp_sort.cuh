@@ -0,0 +1,128 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s).
+#include "traccc/cuda/utils/definitions.hpp"
+#include "traccc/definitions/primitives.hpp"
+
+// System include(s).
+#include <cstdint>
+
+namespace traccc::cuda::details {
+
+/// Candidate object ranked by the warp-level sorting functions
+///
+/// Candidates are ordered by their weight first, and by their secondary key
+/// for equal weights. Invalid candidates rank below all valid ones.
+///
+struct warp_candidate {
+    /// The primary key of the candidate
+    scalar weight;
+    /// The secondary key of the candidate
+    scalar secondary;
+    /// The index of the candidate, or @c invalid_index for no candidate
+    unsigned int index;
+
+    /// Index value signalling an invalid candidate
+    static constexpr unsigned int invalid_index = 0xFFFFFFFFu;
+
+    /// Check whether this is a valid candidate
+    __device__ bool valid() const { return index != invalid_index; }
+
+    /// Check whether this candidate ranks higher than another one
+    __device__ bool better_than(const warp_candidate& other) const {
+        if (!valid()) {
+            return false;
+        }
+        if (!other.valid()) {
+            return true;
+        }
+        if (weight != other.weight) {
+            return weight > other.weight;
+        }
+        return secondary > other.secondary;
+    }
+};
+
+/// Get the candidate of another lane of the warp
+__device__ __forceinline__ warp_candidate shfl_candidate(
+    const warp_candidate& c, unsigned int src_lane,
+    uint32_t mask = 0xFFFFFFFFu) {
+    return {__shfl_sync(mask, c.weight, src_lane),
+            __shfl_sync(mask, c.secondary, src_lane),
+            __shfl_sync(mask, c.index, src_lane)};
+}
+
+/// Compare-exchange step of a bitonic sorting network across the warp
+///
+/// @param c The candidate of the current lane
+/// @param j The lane distance of the comparison
+/// @param descending Whether the current lane's sub-sequence is sorted in
+///                   descending order
+///
+__device__ __forceinline__ warp_candidate bitonic_step(
+    const warp_candidate& c, unsigned int j, bool descending,
+    uint32_t mask = 0xFFFFFFFFu) {
+
+    const unsigned int lane = threadIdx.x % WARP_SIZE;
+    const warp_candidate other = {__shfl_xor_sync(mask, c.weight, j),
+                                  __shfl_xor_sync(mask, c.secondary, j),
+                                  __shfl_xor_sync(mask, c.index, j)};
+    // In a descending sub-sequence the lower lane keeps the better candidate.
+    const bool keep_better = (((lane & j) == 0) == descending);
+    return (keep_better ? other.better_than(c) : c.better_than(other)) ? other
+                                                                         : c;
+}
+
+/**
+ * @brief Sort one candidate per lane, across a full warp, in descending order.
+ *
+ * @note All lanes of the warp must call this function.
+ */
+__device__ __forceinline__ warp_candidate warp_bitonic_sort(warp_candidate c) {
+
+    const unsigned int lane = threadIdx.x % WARP_SIZE;
+#pragma unroll
+    for (unsigned int k = 2; k <= WARP_SIZE; k <<= 1) {
+#pragma unroll
+        for (unsigned int j = k >> 1; j > 0; j >>= 1) {
+            c = bitonic_step(c, j, (lane & k) == 0);
+        }
+    }
+    return c;
+}
+
+/**
+ * @brief Merge two descending warp-wide sequences, keeping the best ones.
+ *
+ * @param best The current best candidates, sorted in descending order
+ * @param next New candidates, sorted in descending order
+ * @returns The warp-size best candidates of the two sequences, sorted in
+ *          descending order
+ *
+ * @note All lanes of the warp must call this function.
+ */
+__device__ __forceinline__ warp_candidate warp_merge_top(
+    const warp_candidate& best, const warp_candidate& next) {
+
+    // Pairing up the sequences in opposite orders results in a bitonic
+    // sequence holding the best candidates of both.
+    const unsigned int lane = threadIdx.x % WARP_SIZE;
+    const warp_candidate reversed = shfl_candidate(next, WARP_SIZE - 1 - lane);
+    warp_candidate c = reversed.better_than(best) ? reversed : best;
+
+    // Which only needs to be merged to be sorted.
+#pragma unroll
+    for (unsigned int j = WARP_SIZE >> 1; j > 0; j >>= 1) {
+        c = bitonic_step(c, j, true);
+    }
+    return c;
+}
+
+}  // namespace traccc::cuda::details
@@ -0,0 +1,71 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "traccc/edm/cell.hpp"
+#include "traccc/edm/spacepoint.hpp"
+#include "traccc/utils/algorithm.hpp"
+#include "vecmem/memory/memory_resource.hpp"
+
+namespace traccc::futhark {
+
+/// Clusterization algorithm, creating spacepoints from cells
+///
+/// The connected component labeling, the measurement creation and the
+/// spacepoint formation all run in a single Futhark entry point, so none of
+/// the intermediate data leaves the Futhark context.
+///
+/// Calls can be made from multiple threads, but they are serialised, as they
+/// all use the same Futhark context. The host arrays exchanged with the
+/// context are kept from one call to the next, so that they only need to be
+/// allocated for the first (largest) events.
+///
+struct clusterization_algorithm
+    : algorithm<spacepoint_collection_types::host(
+          const cell_collection_types::host&,
+          const cell_module_collection_types::host&)> {
+
+    /// The cells and the modules of one event of a batch
+    struct event_input {
+        /// The cells of the event
+        const cell_collection_types::host& cells;
+        /// The modules of the event
+        const cell_module_collection_types::host& modules;
+    };
+
+    clusterization_algorithm(vecmem::memory_resource&);
+
+    output_type operator()(
+        const cell_collection_types::host& cells,
+        const cell_module_collection_types::host& modules) const override;
+
+    /// Run the clusterization of several events in a single call
+    ///
+    /// The cells and the modules of all events are handed to the Futhark
+    /// context at once, which makes the fixed cost of a call (converting to
+    /// and from Futhark arrays, and synchronising) shared by all of them.
+    ///
+    /// @param events The cells and the modules of the events
+    /// @return The spacepoints of every event, in the order of the events
+    ///
+    std::vector<output_type> operator()(
+        const std::vector<event_input>& events) const;
+
+    private:
+    /// Host arrays exchanged with the Futhark context
+    struct staging_arrays;
+
+    vecmem::memory_resource& m_mr;
+    /// The arrays used by the calls of the algorithm (and its copies)
+    std::shared_ptr<staging_arrays> m_staging;
+};
+
+}  // namespace traccc::futhark
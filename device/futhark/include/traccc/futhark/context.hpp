@@ -1,6 +1,6 @@
 /** TRACCC library, part of the ACTS project (R&D line)
  *
- * (c) 2022 CERN for the benefit of the ACTS project
+ * (c) 2022-2024 CERN for the benefit of the ACTS project
  *
  * Mozilla Public License Version 2.0
  */
@@ -9,6 +9,12 @@
 
 #include <traccc/futhark/entry.h>
 
+#include <mutex>
+
 namespace traccc::futhark {
+/// The Futhark context shared by all algorithms, which stays alive (with the
+/// memory that it cached) for the lifetime of the process
 struct futhark_context& get_context();
+/// The mutex serialising the use of the shared Futhark context
+std::mutex& get_context_mutex();
 }  // namespace traccc::futhark
@@ -1,6 +1,6 @@
 /** TRACCC library, part of the ACTS project (R&D line)
  *
- * (c) 2022 CERN for the benefit of the ACTS project
+ * (c) 2022-2024 CERN for the benefit of the ACTS project
  *
  * Mozilla Public License Version 2.0
  */
@@ -9,7 +9,9 @@
 
 #include <traccc/futhark/entry.h>
 
+#include <array>
 #include <cstring>
+#include <functional>
 #include <numeric>
 #include <traccc/futhark/context.hpp>
 #include <traccc/futhark/utils.hpp>
@@ -70,25 +72,23 @@ struct wrapper<T, std::tuple<IArgs...>, std::tuple<OArgs...>> {
     using output_t = std::tuple<std::vector<typename OArgs::cpp_t>...>;
 
     template <std::size_t... IIdxs, std::size_t... OIdxs>
-    static output_t run_helper(struct futhark_context &ctx,
-                               std::vector<typename IArgs::cpp_t> &&... args,
-                               std::index_sequence<IIdxs...>,
-                               std::index_sequence<OIdxs...>) {
+    static void run_helper(struct futhark_context &ctx, output_t &out,
+                           const std::vector<typename IArgs::cpp_t> &... args,
+                           std::index_sequence<IIdxs...>,
+                           std::index_sequence<OIdxs...>) {
         std::tuple<typename IArgs::futhark_t *...> futhark_inputs = {
             IArgs::alloc_f(&ctx, args.data(), args.size())...};
         std::tuple<typename OArgs::futhark_t *...> futhark_outputs;
 
-        FUTHARK_ERROR_CHECK(futhark_context_sync(&ctx));
-
         /*
-         * Make the call to the Futhark entry point.
+         * Make the call to the Futhark entry point. The operations of the
+         * context are executed in order, so there is no need to synchronise
+         * until the results are needed on the host.
          */
         FUTHARK_ERROR_CHECK(T::entry_f(&ctx,
                                        (&std::get<OIdxs>(futhark_outputs))...,
                                        std::get<IIdxs>(futhark_inputs)...));
 
-        FUTHARK_ERROR_CHECK(futhark_context_sync(&ctx));
-
         /*
          * Free the inputs, which are no longer needed.
          */
@@ -96,8 +96,6 @@ struct wrapper<T, std::tuple<IArgs...>, std::tuple<OArgs...>> {
              IArgs::free_f(&ctx, std::get<IIdxs>(futhark_inputs))),
          ...);
 
-        FUTHARK_ERROR_CHECK(futhark_context_sync(&ctx));
-
         /*
          * Retrieve the shapes of output vectors.
          */
@@ -107,20 +105,19 @@ struct wrapper<T, std::tuple<IArgs...>, std::tuple<OArgs...>> {
               OArgs::shape_f(&ctx, std::get<OIdxs>(futhark_outputs))),
          ...);
 
-        FUTHARK_ERROR_CHECK(futhark_context_sync(&ctx));
-
         ((std::memcpy(std::get<OIdxs>(output_ranks).data(),
                       std::get<OIdxs>(output_rank_ptrs),
                       OArgs::rank_v * sizeof(int64_t))),
          ...);
 
         /*
-         * Create the output vectors.
+         * Size the output vectors, re-using their existing capacity.
          */
-        std::tuple<std::vector<typename OArgs::cpp_t>...> out(
-            std::accumulate(std::get<OIdxs>(output_ranks).begin(),
-                            std::get<OIdxs>(output_ranks).end(), 1,
-                            std::multiplies<int64_t>())...);
+        (std::get<OIdxs>(out).resize(static_cast<std::size_t>(
+             std::accumulate(std::get<OIdxs>(output_ranks).begin(),
+                             std::get<OIdxs>(output_ranks).end(), int64_t{1},
+                             std::multiplies<int64_t>()))),
+         ...);
 
         /*
          * Copy the values from the Futhark output vectors.
@@ -138,19 +135,28 @@ struct wrapper<T, std::tuple<IArgs...>, std::tuple<OArgs...>> {
         (FUTHARK_ERROR_CHECK(
              OArgs::free_f(&ctx, std::get<OIdxs>(futhark_outputs))),
          ...);
+    }
 
-        FUTHARK_ERROR_CHECK(futhark_context_sync(&ctx));
-
-        return out;
+    /// Run the entry point, writing its results into existing vectors
+    ///
+    /// Meant for calling the entry point repeatedly (for every event), with
+    /// the same input and output vectors, which then don't need to allocate
+    /// memory once they have grown large enough. The Futhark context keeps
+    /// the device memory of the freed arrays around for the next call, in
+    /// the same way.
+    ///
+    static void run_into(output_t &out,
+                         const std::vector<typename IArgs::cpp_t> &... args) {
+        run_helper(get_context(), out, args...,
+                   std::index_sequence_for<IArgs...>{},
+                   std::index_sequence_for<OArgs...>{});
     }
 
     static std::tuple<std::vector<typename OArgs::cpp_t>...> run(
         std::vector<typename IArgs::cpp_t> &&... args) {
-        return run_helper(
-            get_context(),
-            std::forward<std::vector<typename IArgs::cpp_t>>(args)...,
-            std::index_sequence_for<IArgs...>{},
-            std::index_sequence_for<OArgs...>{});
+        output_t out;
+        run_into(out, args...);
+        return out;
     }
 };
 }  // namespace traccc::futhark
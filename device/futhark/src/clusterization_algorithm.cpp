@@ -0,0 +1,204 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#include <mutex>
+#include <traccc/futhark/clusterization_algorithm.hpp>
+#include <traccc/futhark/wrapper.hpp>
+#include <vector>
+
+namespace traccc::futhark {
+struct cells_to_spacepoints_wrapper
+    : public wrapper<
+          cells_to_spacepoints_wrapper,
+          std::tuple<futhark_u64_1d_wrapper, futhark_u64_1d_wrapper,
+                     futhark_i64_1d_wrapper, futhark_i64_1d_wrapper,
+                     futhark_f32_1d_wrapper, futhark_f32_1d_wrapper,
+                     futhark_f32_1d_wrapper, futhark_f32_1d_wrapper,
+                     futhark_f32_1d_wrapper, futhark_f32_1d_wrapper>,
+          std::tuple<futhark_u64_1d_wrapper, futhark_f32_1d_wrapper,
+                     futhark_f32_1d_wrapper, futhark_f32_1d_wrapper,
+                     futhark_f32_1d_wrapper, futhark_f32_1d_wrapper,
+                     futhark_f32_1d_wrapper, futhark_f32_1d_wrapper>> {
+    static constexpr auto* entry_f = &futhark_entry_cells_to_spacepoints;
+};
+
+struct cells_to_spacepoints_batched_wrapper
+    : public wrapper<
+          cells_to_spacepoints_batched_wrapper,
+          std::tuple<futhark_i64_1d_wrapper, futhark_i64_1d_wrapper,
+                     futhark_u64_1d_wrapper, futhark_i64_1d_wrapper,
+                     futhark_i64_1d_wrapper, futhark_f32_1d_wrapper,
+                     futhark_f32_1d_wrapper, futhark_f32_1d_wrapper,
+                     futhark_f32_1d_wrapper, futhark_f32_1d_wrapper,
+                     futhark_f32_1d_wrapper>,
+          std::tuple<futhark_u64_1d_wrapper, futhark_u64_1d_wrapper,
+                     futhark_f32_1d_wrapper, futhark_f32_1d_wrapper,
+                     futhark_f32_1d_wrapper, futhark_f32_1d_wrapper,
+                     futhark_f32_1d_wrapper, futhark_f32_1d_wrapper,
+                     futhark_f32_1d_wrapper>> {
+    static constexpr auto* entry_f =
+        &futhark_entry_cells_to_spacepoints_batched;
+};
+
+struct clusterization_algorithm::staging_arrays {
+    // Offsets of the events in the flattened cell and module arrays.
+    std::vector<int64_t> cell_offsets;
+    std::vector<int64_t> module_offsets;
+
+    // The cells of the event(s).
+    std::vector<uint64_t> event;
+    std::vector<uint64_t> geometry;
+    std::vector<int64_t> channel0;
+    std::vector<int64_t> channel1;
+    std::vector<float> activation;
+
+    // The modules of the event(s).
+    std::vector<float> module_transform;
+    std::vector<float> module_min_center_x;
+    std::vector<float> module_min_center_y;
+    std::vector<float> module_pitch_x;
+    std::vector<float> module_pitch_y;
+
+    // The results of the entry points.
+    cells_to_spacepoints_wrapper::output_t output;
+    cells_to_spacepoints_batched_wrapper::output_t batched_output;
+
+    /// Clear all inputs, keeping their capacity
+    void clear() {
+        cell_offsets.clear();
+        module_offsets.clear();
+        event.clear();
+        geometry.clear();
+        channel0.clear();
+        channel1.clear();
+        activation.clear();
+        module_transform.clear();
+        module_min_center_x.clear();
+        module_min_center_y.clear();
+        module_pitch_x.clear();
+        module_pitch_y.clear();
+    }
+
+    /// Append the cells and the modules of one event to the inputs
+    void append(const cell_collection_types::host& cells,
+                const cell_module_collection_types::host& modules) {
+        cell_offsets.push_back(static_cast<int64_t>(geometry.size()));
+        module_offsets.push_back(
+            static_cast<int64_t>(module_min_center_x.size()));
+
+        for (std::size_t i = 0; i < cells.size(); ++i) {
+            geometry.push_back(cells.at(i).module_link);
+            channel0.push_back(cells.at(i).channel0);
+            channel1.push_back(cells.at(i).channel1);
+            activation.push_back(cells.at(i).activation);
+        }
+
+        for (std::size_t i = 0; i < modules.size(); ++i) {
+            const cell_module& module = modules.at(i);
+            transform3::element_getter getter;
+            for (std::size_t x = 0; x < 4; ++x) {
+                for (std::size_t y = 0; y < 4; ++y) {
+                    module_transform.push_back(
+                        getter(module.placement.matrix(), x, y));
+                }
+            }
+            module_min_center_x.push_back(module.pixel.min_center_x);
+            module_min_center_y.push_back(module.pixel.min_center_y);
+            module_pitch_x.push_back(module.pixel.pitch_x);
+            module_pitch_y.push_back(module.pixel.pitch_y);
+        }
+    }
+};
+
+clusterization_algorithm::clusterization_algorithm(vecmem::memory_resource& mr)
+    : m_mr(mr), m_staging(std::make_shared<staging_arrays>()) {}
+
+clusterization_algorithm::output_type clusterization_algorithm::operator()(
+    const cell_collection_types::host& cells,
+    const cell_module_collection_types::host& modules) const {
+
+    // All calls share the same Futhark context, and the same arrays.
+    std::lock_guard<std::mutex> lock(get_context_mutex());
+    staging_arrays& s = *m_staging;
+
+    s.clear();
+    s.append(cells, modules);
+    s.event.assign(cells.size(), 0);
+
+    cells_to_spacepoints_wrapper::run_into(
+        s.output, s.event, s.geometry, s.channel0, s.channel1, s.activation,
+        s.module_transform, s.module_min_center_x, s.module_min_center_y,
+        s.module_pitch_x, s.module_pitch_y);
+    const cells_to_spacepoints_wrapper::output_t& r = s.output;
+
+    output_type out(&m_mr);
+    out.reserve(std::get<0>(r).size());
+
+    for (std::size_t i = 0; i < std::get<0>(r).size(); ++i) {
+        measurement m;
+
+        m.local = {std::get<1>(r)[i], std::get<2>(r)[i]};
+        m.variance = {std::get<3>(r)[i], std::get<4>(r)[i]};
+        m.module_link = static_cast<cell::link_type>(std::get<0>(r)[i]);
+        m.surface_link = modules.at(m.module_link).surface_link;
+
+        out.push_back(
+            {{std::get<5>(r)[i], std::get<6>(r)[i], std::get<7>(r)[i]}, m});
+    }
+
+    return out;
+}
+
+std::vector<clusterization_algorithm::output_type>
+clusterization_algorithm::operator()(
+    const std::vector<event_input>& events) const {
+
+    // All calls share the same Futhark context, and the same arrays.
+    std::lock_guard<std::mutex> lock(get_context_mutex());
+    staging_arrays& s = *m_staging;
+
+    s.clear();
+    for (const event_input& event : events) {
+        s.append(event.cells, event.modules);
+    }
+
+    std::vector<output_type> out;
+    out.reserve(events.size());
+    for (std::size_t i = 0; i < events.size(); ++i) {
+        out.emplace_back(&m_mr);
+    }
+    if (s.geometry.empty()) {
+        return out;
+    }
+
+    cells_to_spacepoints_batched_wrapper::run_into(
+        s.batched_output, s.cell_offsets, s.module_offsets, s.geometry,
+        s.channel0, s.channel1, s.activation, s.module_transform,
+        s.module_min_center_x, s.module_min_center_y, s.module_pitch_x,
+        s.module_pitch_y);
+    const cells_to_spacepoints_batched_wrapper::output_t& r =
+        s.batched_output;
+
+    for (std::size_t i = 0; i < std::get<0>(r).size(); ++i) {
+        const std::size_t e = static_cast<std::size_t>(std::get<0>(r)[i]);
+        measurement m;
+
+        m.local = {std::get<2>(r)[i], std::get<3>(r)[i]};
+        m.variance = {std::get<4>(r)[i], std::get<5>(r)[i]};
+        // The modules are identified in the concatenated module arrays by
+        // the Futhark code, and by their index in their own event here.
+        m.module_link = static_cast<cell::link_type>(
+            std::get<1>(r)[i] - static_cast<uint64_t>(s.module_offsets[e]));
+        m.surface_link = events[e].modules.at(m.module_link).surface_link;
+
+        out[e].push_back(
+            {{std::get<6>(r)[i], std::get<7>(r)[i], std::get<8>(r)[i]}, m});
+    }
+
+    return out;
+}
+}  // namespace traccc::futhark
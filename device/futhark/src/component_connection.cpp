@@ -1,11 +1,12 @@
 /** TRACCC library, part of the ACTS project (R&D line)
  *
- * (c) 2021-2022 CERN for the benefit of the ACTS project
+ * (c) 2021-2024 CERN for the benefit of the ACTS project
  *
  * Mozilla Public License Version 2.0
  */
 
 #include <memory>
+#include <mutex>
 #include <traccc/futhark/component_connection.hpp>
 #include <traccc/futhark/utils.hpp>
 #include <traccc/futhark/wrapper.hpp>
@@ -53,11 +54,14 @@ component_connection::output_type component_connection::operator()(
         }
     }
 
-    cells_to_measurements_wrapper::output_t r =
-        cells_to_measurements_wrapper::run(
+    cells_to_measurements_wrapper::output_t r;
+    {
+        std::lock_guard<std::mutex> lock(get_context_mutex());
+        r = cells_to_measurements_wrapper::run(
             std::move(host_event), std::move(host_geometry),
             std::move(host_channel0), std::move(host_channel1),
             std::move(host_activation));
+    }
 
     output_type out(&m_mr);
 
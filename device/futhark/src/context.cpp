@@ -1,10 +1,11 @@
 /** TRACCC library, part of the ACTS project (R&D line)
  *
- * (c) 2022 CERN for the benefit of the ACTS project
+ * (c) 2022-2024 CERN for the benefit of the ACTS project
  *
  * Mozilla Public License Version 2.0
  */
 
+#include <traccc/futhark/context.hpp>
 #include <traccc/futhark/entry.h>
 
 namespace traccc::futhark {
@@ -22,4 +23,9 @@ struct futhark_context& get_context() {
 
     return *__global_futhark_context;
 }
+
+std::mutex& get_context_mutex() {
+    static std::mutex context_mutex;
+    return context_mutex;
+}
 }  // namespace traccc::futhark
@@ -1,10 +1,11 @@
 /** TRACCC library, part of the ACTS project (R&D line)
  *
- * (c) 2021-2022 CERN for the benefit of the ACTS project
+ * (c) 2021-2024 CERN for the benefit of the ACTS project
  *
  * Mozilla Public License Version 2.0
  */
 
+#include <mutex>
 #include <sstream>
 #include <traccc/edm/measurement.hpp>
 #include <traccc/edm/spacepoint.hpp>
@@ -75,8 +76,10 @@ spacepoint_formation::output_type spacepoint_formation::operator()(
         }
     }
 
-    measurements_to_spacepoints_wrapper::output_t r =
-        measurements_to_spacepoints_wrapper::run(
+    measurements_to_spacepoints_wrapper::output_t r;
+    {
+        std::lock_guard<std::mutex> lock(get_context_mutex());
+        r = measurements_to_spacepoints_wrapper::run(
             std::move(host_transform_geometry),
             std::move(host_transform_transform),
             std::move(host_measurement_event),
@@ -85,6 +88,7 @@ spacepoint_formation::output_type spacepoint_formation::operator()(
             std::move(host_measurement_position1),
             std::move(host_measurement_variance0),
             std::move(host_measurement_variance1));
+    }
 
     output_type out(&m_mr);
 
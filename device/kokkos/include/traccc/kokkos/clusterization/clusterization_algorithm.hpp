@@ -0,0 +1,74 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s).
+#include "traccc/edm/cell.hpp"
+#include "traccc/edm/spacepoint.hpp"
+#include "traccc/utils/algorithm.hpp"
+#include "traccc/utils/memory_resource.hpp"
+
+// VecMem include(s).
+#include <vecmem/containers/data/vector_buffer.hpp>
+#include <vecmem/utils/copy.hpp>
+
+// System include(s).
+#include <utility>
+
+namespace traccc::kokkos {
+
+/// Algorithm performing hit clusterization with Kokkos
+///
+/// Every team of threads handles one partition of the cells, the same way as
+/// the thread blocks of the CUDA and SYCL algorithms do.
+///
+class clusterization_algorithm
+    : public algorithm<std::pair<spacepoint_collection_types::buffer,
+                                 vecmem::data::vector_buffer<unsigned int>>(
+          const cell_collection_types::const_view&,
+          const cell_module_collection_types::const_view&)> {
+
+    public:
+    /// Constructor for clusterization algorithm
+    ///
+    /// @param mr The memory resource(s) to use in the algorithm
+    /// @param copy The copy object to use for copying data between device
+    ///             and host memory blocks
+    /// @param target_cells_per_partition the average number of cells in each
+    /// partition (lowered if the execution space can not run teams large
+    /// enough for it)
+    /// @param produce_cell_links whether to fill the links from the cells to
+    /// their spacepoints. If not, an empty link buffer is returned.
+    ///
+    clusterization_algorithm(const traccc::memory_resource& mr,
+                             vecmem::copy& copy,
+                             const unsigned short target_cells_per_partition,
+                             bool produce_cell_links = true);
+
+    /// Callable operator for clusterization algorithm
+    ///
+    /// @param cells        a collection of cells
+    /// @param modules      a collection of modules
+    /// @return a spacepoint collection (buffer) and a collection (buffer) of
+    /// links from cells to the spacepoints they belong to.
+    output_type operator()(
+        const cell_collection_types::const_view& cells,
+        const cell_module_collection_types::const_view& modules) const override;
+
+    private:
+    /// The average number of cells in each partition
+    unsigned short m_target_cells_per_partition;
+    /// Whether to fill the links from the cells to their spacepoints
+    bool m_produce_cell_links;
+    /// The memory resource(s) to use
+    traccc::memory_resource m_mr;
+    /// The copy object to use
+    vecmem::copy& m_copy;
+};
+
+}  // namespace traccc::kokkos
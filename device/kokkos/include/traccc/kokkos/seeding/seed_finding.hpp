@@ -0,0 +1,79 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s).
+#include "traccc/edm/seed.hpp"
+#include "traccc/edm/spacepoint.hpp"
+#include "traccc/seeding/detail/seed_finding_capacities.hpp"
+#include "traccc/seeding/detail/seeding_config.hpp"
+#include "traccc/seeding/detail/spacepoint_soa_grid.hpp"
+#include "traccc/utils/algorithm.hpp"
+#include "traccc/utils/memory_resource.hpp"
+
+// VecMem include(s).
+#include <vecmem/utils/copy.hpp>
+
+namespace traccc::kokkos {
+
+/// Seed finding for Kokkos
+class seed_finding : public algorithm<seed_collection_types::buffer(
+                         const spacepoint_collection_types::const_view&,
+                         const sp_soa_grid_types::const_view&)> {
+
+    public:
+    /// Constructor for the Kokkos seed finding
+    ///
+    /// @param config is seed finder configuration parameters
+    /// @param filter_config is seed filter configuration parameters
+    /// @param mr vecmem memory resource
+    /// @param copy The copy object to use for copying data between device
+    ///             and host memory blocks
+    /// @param capacities The capacities to use for finding the seeds without
+    ///                   intermediate host synchronisation (disabled by
+    ///                   default)
+    seed_finding(const seedfinder_config& config,
+                 const seedfilter_config& filter_config,
+                 const traccc::memory_resource& mr, vecmem::copy& copy,
+                 const seed_finding_capacities& capacities = {});
+
+    /// Callable operator for the seed finding
+    ///
+    /// @param spacepoints_view     is a view of all spacepoints in the event
+    /// @param g2_view              is a view of the spacepoint grid
+    /// @return                     a vector buffer of seeds
+    ///
+    output_type operator()(
+        const spacepoint_collection_types::const_view& spacepoints_view,
+        const sp_soa_grid_types::const_view& g2_view) const override;
+
+    private:
+    /// Find the seeds, with either exactly sized or capacity-bounded buffers
+    ///
+    /// @param spacepoints_view     is a view of all spacepoints in the event
+    /// @param g2_view              is a view of the spacepoint grid
+    /// @param num_spacepoints      is the number of spacepoints in the grid
+    /// @param bounded              whether to use @c m_capacities
+    /// @param fits                 set to whether all doublets and triplets
+    ///                             fit into the buffers
+    /// @return                     a vector buffer of seeds
+    ///
+    output_type find_seeds(
+        const spacepoint_collection_types::const_view& spacepoints_view,
+        const sp_soa_grid_types::const_view& g2_view,
+        unsigned int num_spacepoints, bool bounded, bool& fits) const;
+
+    seedfinder_config m_seedfinder_config;
+    seedfilter_config m_seedfilter_config;
+    /// Capacities for the bounded (synchronisation-free) mode
+    seed_finding_capacities m_capacities;
+    traccc::memory_resource m_mr;
+    vecmem::copy& m_copy;
+};
+
+}  // namespace traccc::kokkos
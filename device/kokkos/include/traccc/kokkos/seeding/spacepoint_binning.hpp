@@ -1,6 +1,6 @@
 /** TRACCC library, part of the ACTS project (R&D line)
  *
- * (c) 2021-2022 CERN for the benefit of the ACTS project
+ * (c) 2021-2024 CERN for the benefit of the ACTS project
  *
  * Mozilla Public License Version 2.0
  */
@@ -10,7 +10,7 @@
 // Project include(s).
 #include "traccc/edm/spacepoint.hpp"
 #include "traccc/seeding/detail/seeding_config.hpp"
-#include "traccc/seeding/detail/spacepoint_grid.hpp"
+#include "traccc/seeding/detail/spacepoint_soa_grid.hpp"
 #include "traccc/utils/algorithm.hpp"
 #include "traccc/utils/memory_resource.hpp"
 
@@ -24,8 +24,12 @@
 namespace traccc::kokkos {
 
 /// Spacepoing binning executed on a Kokkos device
+///
+/// The spacepoints of every bin of the produced grid are sorted by radius,
+/// the same way as by the host algorithm.
+///
 class spacepoint_binning
-    : public algorithm<sp_grid_buffer(
+    : public algorithm<sp_soa_grid_types::buffer(
           const spacepoint_collection_types::const_view&)> {
 
     public:
@@ -41,7 +45,7 @@ class spacepoint_binning
     private:
     /// Member variables
     seedfinder_config m_config;
-    std::pair<sp_grid::axis_p0_type, sp_grid::axis_p1_type> m_axes;
+    std::pair<sp_soa_grid_axis_p0_type, sp_soa_grid_axis_p1_type> m_axes;
     traccc::memory_resource m_mr;
     std::unique_ptr<vecmem::copy> m_copy;
 
@@ -0,0 +1,184 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Local include(s).
+#include "traccc/kokkos/clusterization/clusterization_algorithm.hpp"
+
+#include "../utils/barrier.hpp"
+#include "traccc/kokkos/utils/definitions.hpp"
+
+// Project include(s)
+#include "traccc/clusterization/device/ccl_kernel.hpp"
+#include "traccc/clusterization/device/form_spacepoints.hpp"
+
+// System include(s).
+#include <algorithm>
+#include <cstddef>
+
+namespace traccc::kokkos {
+
+namespace {
+/// These indices in clusterization will only range from 0 to
+/// max_cells_per_partition, so we only need a short
+using index_t = unsigned short;
+
+static constexpr int TARGET_CELLS_PER_THREAD = 8;
+static constexpr int MAX_CELLS_PER_THREAD = 12;
+
+/// Functor running @c traccc::device::ccl_kernel, with one team per partition
+struct ccl_functor {
+
+    /// The cells to label
+    cell_collection_types::const_view cells;
+    /// The modules of the cells
+    cell_module_collection_types::const_view modules;
+    /// The maximum number of cells in a partition labeled in scratch memory
+    index_t max_cells_per_partition = 0;
+    /// The average number of cells in a partition
+    index_t target_cells_per_partition = 0;
+    /// The measurements to fill
+    measurement_collection_types::view measurements;
+    /// The (device) counter of the measurements
+    Kokkos::View<unsigned int, MemSpace> measurement_count;
+    /// The links from the cells to their measurements (possibly empty)
+    vecmem::data::vector_view<unsigned int> cell_links;
+    /// Scratch space for the partitions not fitting into scratch memory
+    vecmem::data::vector_view<unsigned int> ccl_backup;
+
+    /// The team scratch memory needed by the functor
+    KOKKOS_INLINE_FUNCTION
+    std::size_t scratch_size() const {
+        return 3 * sizeof(unsigned int) +
+               2 * max_cells_per_partition * sizeof(index_t);
+    }
+
+    KOKKOS_INLINE_FUNCTION
+    void operator()(const member_type& member) const {
+
+        // Set up the team's scratch memory.
+        unsigned int* const shared_uint = static_cast<unsigned int*>(
+            member.team_scratch(0).get_shmem(3 * sizeof(unsigned int)));
+        index_t* const f =
+            static_cast<index_t*>(member.team_scratch(0).get_shmem(
+                2 * max_cells_per_partition * sizeof(index_t)));
+        index_t* const f_next = f + max_cells_per_partition;
+        details::barrier barry_r(member);
+
+        device::ccl_kernel(
+            static_cast<index_t>(member.team_rank()),
+            static_cast<index_t>(member.team_size()), member.league_rank(),
+            cells, modules, max_cells_per_partition, target_cells_per_partition,
+            shared_uint[0], shared_uint[1], shared_uint[2], f, f_next, barry_r,
+            measurements, measurement_count(), cell_links, ccl_backup);
+    }
+};
+
+}  // namespace
+
+clusterization_algorithm::clusterization_algorithm(
+    const traccc::memory_resource& mr, vecmem::copy& copy,
+    const unsigned short target_cells_per_partition, bool produce_cell_links)
+    : m_target_cells_per_partition(target_cells_per_partition),
+      m_produce_cell_links(produce_cell_links),
+      m_mr(mr),
+      m_copy(copy) {}
+
+clusterization_algorithm::output_type clusterization_algorithm::operator()(
+    const cell_collection_types::const_view& cells,
+    const cell_module_collection_types::const_view& modules) const {
+
+    // Number of cells
+    const cell_collection_types::view::size_type num_cells =
+        m_copy.get_size(cells);
+
+    if (num_cells == 0) {
+        return {output_type::first_type{0, m_mr.main},
+                output_type::second_type{0, m_mr.main}};
+    }
+
+    // Create result object for the CCL kernel with size overestimation
+    measurement_collection_types::buffer measurements_buffer(num_cells,
+                                                             m_mr.main);
+    m_copy.setup(measurements_buffer);
+
+    // Create buffer for linking cells to their spacepoints, if requested.
+    vecmem::data::vector_buffer<unsigned int> cell_links(
+        m_produce_cell_links ? num_cells : 0u, m_mr.main);
+    m_copy.setup(cell_links);
+
+    // Scratch space for the partitions that would not fit into team scratch
+    // memory, and for the cooperative aggregation of the clusters.
+    vecmem::data::vector_buffer<unsigned int> ccl_backup(
+        device::ccl_backup_size(num_cells), m_mr.main);
+
+    // Set up the labeling functor. Counter for the number of measurements is
+    // zero-initialised by Kokkos.
+    ccl_functor functor;
+    functor.cells = cells;
+    functor.modules = modules;
+    functor.measurements = measurements_buffer;
+    functor.measurement_count =
+        Kokkos::View<unsigned int, MemSpace>("measurement_count");
+    functor.cell_links = cell_links;
+    functor.ccl_backup = ccl_backup;
+
+    // Every thread of a team handles (up to) MAX_CELLS_PER_THREAD cells, so
+    // the partitions have to be made smaller if the execution space can not
+    // run large enough teams.
+    const unsigned int max_team_size = static_cast<unsigned int>(
+        team_policy(1, 1).team_size_max(functor, Kokkos::ParallelForTag()));
+    const unsigned int threads_per_partition =
+        std::min((m_target_cells_per_partition + TARGET_CELLS_PER_THREAD - 1) /
+                     TARGET_CELLS_PER_THREAD,
+                 max_team_size);
+    const unsigned int target_cells_per_partition =
+        std::min<unsigned int>(m_target_cells_per_partition,
+                               threads_per_partition * TARGET_CELLS_PER_THREAD);
+    functor.target_cells_per_partition =
+        static_cast<index_t>(target_cells_per_partition);
+    functor.max_cells_per_partition = static_cast<index_t>(
+        (target_cells_per_partition * MAX_CELLS_PER_THREAD +
+         TARGET_CELLS_PER_THREAD - 1) /
+        TARGET_CELLS_PER_THREAD);
+    const unsigned int num_partitions =
+        (num_cells + target_cells_per_partition - 1) /
+        target_cells_per_partition;
+
+    // Run the CCL kernel. (With some slack in the scratch memory, for the
+    // alignment of the two scratch arrays.)
+    const std::size_t scratch_size =
+        functor.scratch_size() + 2 * sizeof(double);
+    Kokkos::parallel_for(
+        "ccl_kernel",
+        team_policy(num_partitions, threads_per_partition)
+            .set_scratch_size(0, Kokkos::PerTeam(scratch_size)),
+        functor);
+
+    // Copy number of measurements to host
+    unsigned int num_measurements = 0;
+    Kokkos::deep_copy(num_measurements, functor.measurement_count);
+
+    spacepoint_collection_types::buffer spacepoints_buffer(num_measurements,
+                                                           m_mr.main);
+    m_copy.setup(spacepoints_buffer);
+    spacepoint_collection_types::view spacepoints_view(spacepoints_buffer);
+    measurement_collection_types::const_view measurements_view =
+        measurements_buffer;
+
+    // Run form spacepoints kernel, turning 2D measurements into 3D spacepoints
+    Kokkos::parallel_for(
+        "form_spacepoints", range_policy(0, num_measurements),
+        KOKKOS_LAMBDA(const unsigned int i) {
+            device::form_spacepoints(i, measurements_view, modules,
+                                     num_measurements, spacepoints_view);
+        });
+    Kokkos::fence();
+
+    return {std::move(spacepoints_buffer), std::move(cell_links)};
+}
+
+}  // namespace traccc::kokkos
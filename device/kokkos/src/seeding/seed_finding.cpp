@@ -0,0 +1,299 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Local include(s).
+#include "traccc/kokkos/seeding/seed_finding.hpp"
+
+#include "traccc/kokkos/utils/definitions.hpp"
+
+// Project include(s).
+#include "traccc/edm/device/device_doublet.hpp"
+#include "traccc/edm/device/device_triplet.hpp"
+#include "traccc/edm/device/doublet_counter.hpp"
+#include "traccc/edm/device/seeding_global_counter.hpp"
+#include "traccc/edm/device/triplet_counter.hpp"
+#include "traccc/seeding/device/count_doublets.hpp"
+#include "traccc/seeding/device/count_triplets.hpp"
+#include "traccc/seeding/device/find_doublets.hpp"
+#include "traccc/seeding/device/find_triplets.hpp"
+#include "traccc/seeding/device/reduce_triplet_counts.hpp"
+#include "traccc/seeding/device/select_seeds.hpp"
+#include "traccc/seeding/device/set_seeding_buffer_sizes.hpp"
+#include "traccc/seeding/device/update_triplet_weights.hpp"
+
+// VecMem include(s).
+#include <vecmem/containers/data/vector_buffer.hpp>
+
+namespace traccc::kokkos {
+
+seed_finding::seed_finding(const seedfinder_config& config,
+                           const seedfilter_config& filter_config,
+                           const traccc::memory_resource& mr,
+                           vecmem::copy& copy,
+                           const seed_finding_capacities& capacities)
+    : m_seedfinder_config(config),
+      m_seedfilter_config(filter_config),
+      m_capacities(capacities),
+      m_mr(mr),
+      m_copy(copy) {}
+
+seed_finding::output_type seed_finding::operator()(
+    const spacepoint_collection_types::const_view& spacepoints_view,
+    const sp_soa_grid_types::const_view& g2_view) const {
+
+    // Get the number of spacepoints in the grid. The threads of the doublet
+    // counting can find their spacepoints using the offsets of the bins, so
+    // no prefix sum is needed for iterating over the grid.
+    const auto num_spacepoints = m_copy.get_size(g2_view.x);
+    if (num_spacepoints == 0) {
+        return {0, m_mr.main};
+    }
+
+    // Try to find the seeds with bounded capacities first, if configured to.
+    if (m_capacities.enabled()) {
+        bool fits = false;
+        output_type result = find_seeds(spacepoints_view, g2_view,
+                                        num_spacepoints, true, fits);
+        if (fits) {
+            return result;
+        }
+    }
+
+    // Find the seeds with exactly sized buffers.
+    bool fits = false;
+    return find_seeds(spacepoints_view, g2_view, num_spacepoints, false, fits);
+}
+
+seed_finding::output_type seed_finding::find_seeds(
+    const spacepoint_collection_types::const_view& spacepoints_view,
+    const sp_soa_grid_types::const_view& g2_view, unsigned int num_spacepoints,
+    bool bounded, bool& fits) const {
+
+    // Local copies of the configurations, for capturing them in the kernels.
+    const seedfinder_config finder_config = m_seedfinder_config;
+    const seedfilter_config filter_config = m_seedfilter_config;
+
+    // Without bounded capacities, the buffers always fit.
+    fits = true;
+
+    // The type of the (doublet and triplet) buffers to use.
+    const vecmem::data::buffer_type buffer_type =
+        (bounded ? vecmem::data::buffer_type::resizable
+                 : vecmem::data::buffer_type::fixed_size);
+
+    // Set up the doublet counter buffer.
+    device::doublet_counter_collection_types::buffer doublet_counter_buffer = {
+        num_spacepoints, m_mr.main, vecmem::data::buffer_type::resizable};
+    m_copy.setup(doublet_counter_buffer);
+    device::doublet_counter_collection_types::view doublet_counter_view =
+        doublet_counter_buffer;
+
+    // Counter for the total number of doublets and triplets, zero-initialised
+    // by Kokkos.
+    Kokkos::View<device::seeding_global_counter, MemSpace> counter(
+        "seeding_global_counter");
+    auto counter_host = Kokkos::create_mirror_view(counter);
+
+    // Count the number of doublets that we need to produce.
+    Kokkos::parallel_for(
+        "count_doublets", range_policy(0, num_spacepoints),
+        KOKKOS_LAMBDA(const unsigned int i) {
+            device::count_doublets(i, finder_config, g2_view,
+                                   doublet_counter_view, counter().m_nMidBot,
+                                   counter().m_nMidTop);
+        });
+
+    // Decide about the doublet buffer capacities. In bounded mode these come
+    // from the configured factors, otherwise from the doublet counts.
+    unsigned int mb_capacity = 0, mt_capacity = 0;
+    if (bounded) {
+        mb_capacity = seed_finding_capacities::capacity(
+            m_capacities.mid_bot_doublets_per_spacepoint, num_spacepoints);
+        mt_capacity = seed_finding_capacities::capacity(
+            m_capacities.mid_top_doublets_per_spacepoint, num_spacepoints);
+    } else {
+        // Get the summary values.
+        Kokkos::deep_copy(counter_host, counter);
+
+        if (counter_host().m_nMidBot == 0 || counter_host().m_nMidTop == 0) {
+            return {0, m_mr.main};
+        }
+        mb_capacity = counter_host().m_nMidBot;
+        mt_capacity = counter_host().m_nMidTop;
+    }
+
+    // Set up the doublet buffers.
+    device::device_doublet_collection_types::buffer doublet_buffer_mb = {
+        mb_capacity, m_mr.main, buffer_type};
+    m_copy.setup(doublet_buffer_mb);
+    device::device_doublet_collection_types::view doublet_view_mb =
+        doublet_buffer_mb;
+    device::device_doublet_collection_types::buffer doublet_buffer_mt = {
+        mt_capacity, m_mr.main, buffer_type};
+    m_copy.setup(doublet_buffer_mt);
+    device::device_doublet_collection_types::view doublet_view_mt =
+        doublet_buffer_mt;
+
+    // In bounded mode, set the sizes of the doublet buffers on the device.
+    if (bounded) {
+        Kokkos::parallel_for(
+            "set_doublet_buffer_sizes", range_policy(0, 1),
+            KOKKOS_LAMBDA(const unsigned int i) {
+                device::set_doublet_buffer_sizes(i, counter(), doublet_view_mb,
+                                                 doublet_view_mt);
+            });
+    }
+
+    // The number of middle spacepoints to run the following kernels for. (In
+    // bounded mode the kernels are launched for the maximal number of middle
+    // spacepoints, to avoid reading back the size of the doublet counter
+    // buffer.)
+    const unsigned int doublet_counter_buffer_size =
+        (bounded ? num_spacepoints : m_copy.get_size(doublet_counter_buffer));
+
+    // Find all of the spacepoint doublets.
+    Kokkos::parallel_for(
+        "find_doublets", range_policy(0, doublet_counter_buffer_size),
+        KOKKOS_LAMBDA(const unsigned int i) {
+            device::find_doublets(i, finder_config, g2_view,
+                                  doublet_counter_view, doublet_view_mb,
+                                  doublet_view_mt);
+        });
+
+    // Set up the triplet counter buffers
+    device::triplet_counter_spM_collection_types::buffer
+        triplet_counter_spM_buffer = {doublet_counter_buffer_size, m_mr.main};
+    m_copy.setup(triplet_counter_spM_buffer);
+    m_copy.memset(triplet_counter_spM_buffer, 0);
+    device::triplet_counter_spM_collection_types::view
+        triplet_counter_spM_view = triplet_counter_spM_buffer;
+    device::triplet_counter_collection_types::buffer
+        triplet_counter_midBot_buffer = {mb_capacity, m_mr.main,
+                                         vecmem::data::buffer_type::resizable};
+    m_copy.setup(triplet_counter_midBot_buffer);
+    device::triplet_counter_collection_types::view triplet_counter_midBot_view =
+        triplet_counter_midBot_buffer;
+
+    // Count the number of triplets that we need to produce.
+    Kokkos::parallel_for(
+        "count_triplets", range_policy(0, mb_capacity),
+        KOKKOS_LAMBDA(const unsigned int i) {
+            device::count_triplets(i, finder_config, g2_view,
+                                   doublet_counter_view, doublet_view_mb,
+                                   doublet_view_mt, triplet_counter_spM_view,
+                                   triplet_counter_midBot_view);
+        });
+
+    // Reduce the triplet counts per spM.
+    Kokkos::parallel_for(
+        "reduce_triplet_counts", range_policy(0, doublet_counter_buffer_size),
+        KOKKOS_LAMBDA(const unsigned int i) {
+            device::reduce_triplet_counts(i, doublet_counter_view,
+                                          triplet_counter_spM_view,
+                                          counter().m_nTriplets);
+        });
+
+    // Decide about the triplet buffer capacity.
+    unsigned int triplet_capacity = 0;
+    if (bounded) {
+        triplet_capacity = seed_finding_capacities::capacity(
+            m_capacities.triplets_per_spacepoint, num_spacepoints);
+    } else {
+        Kokkos::deep_copy(counter_host, counter);
+
+        if (counter_host().m_nTriplets == 0) {
+            return {0, m_mr.main};
+        }
+        triplet_capacity = counter_host().m_nTriplets;
+    }
+
+    // Set up the triplet buffer.
+    device::device_triplet_collection_types::buffer triplet_buffer = {
+        triplet_capacity, m_mr.main, buffer_type};
+    m_copy.setup(triplet_buffer);
+    device::device_triplet_collection_types::view triplet_view =
+        triplet_buffer;
+
+    // In bounded mode, set the size of the triplet buffer on the device.
+    if (bounded) {
+        Kokkos::parallel_for(
+            "set_triplet_buffer_size", range_policy(0, 1),
+            KOKKOS_LAMBDA(const unsigned int i) {
+                device::set_triplet_buffer_size(i, counter(), triplet_view);
+            });
+    }
+
+    // Find all of the spacepoint triplets.
+    Kokkos::parallel_for(
+        "find_triplets", range_policy(0, mb_capacity),
+        KOKKOS_LAMBDA(const unsigned int i) {
+            device::find_triplets(i, finder_config, filter_config, g2_view,
+                                  doublet_counter_view, doublet_view_mt,
+                                  triplet_counter_spM_view,
+                                  triplet_counter_midBot_view, triplet_view);
+        });
+
+    // Scratch space for comparing the triplets while updating their weights.
+    // Instead of the shared memory used by the other backends, every thread
+    // uses its own compatSeedLimit elements of a global buffer.
+    const unsigned int compat_seed_limit = filter_config.compatSeedLimit;
+    vecmem::data::vector_buffer<scalar> weight_scratch(
+        triplet_capacity * compat_seed_limit, m_mr.main);
+    vecmem::data::vector_view<scalar> weight_scratch_view = weight_scratch;
+
+    // Update the weights of all spacepoint triplets.
+    Kokkos::parallel_for(
+        "update_triplet_weights", range_policy(0, triplet_capacity),
+        KOKKOS_LAMBDA(const unsigned int i) {
+            device::update_triplet_weights(
+                i, filter_config, g2_view, triplet_counter_spM_view,
+                triplet_counter_midBot_view,
+                weight_scratch_view.ptr() + i * compat_seed_limit,
+                triplet_view);
+        });
+
+    // Create result object: collection of seeds
+    seed_collection_types::buffer seed_buffer(
+        triplet_capacity, m_mr.main, vecmem::data::buffer_type::resizable);
+    m_copy.setup(seed_buffer);
+    seed_collection_types::view seed_view = seed_buffer;
+
+    // Scratch space for the triplets of every middle spacepoint, used while
+    // selecting the seeds.
+    const unsigned int max_triplets_per_spM =
+        filter_config.max_triplets_per_spM;
+    vecmem::data::vector_buffer<device::device_triplet> seed_scratch(
+        doublet_counter_buffer_size * max_triplets_per_spM, m_mr.main);
+    vecmem::data::vector_view<device::device_triplet> seed_scratch_view =
+        seed_scratch;
+
+    // Create seeds out of selected triplets
+    Kokkos::parallel_for(
+        "select_seeds", range_policy(0, doublet_counter_buffer_size),
+        KOKKOS_LAMBDA(const unsigned int i) {
+            device::select_seeds(
+                i, filter_config, spacepoints_view, g2_view,
+                triplet_counter_spM_view, triplet_counter_midBot_view,
+                triplet_view,
+                seed_scratch_view.ptr() + i * max_triplets_per_spM,
+                seed_view);
+        });
+
+    // In bounded mode, check (with the only synchronisation of this mode)
+    // whether everything fit into the buffers.
+    if (bounded) {
+        Kokkos::deep_copy(counter_host, counter);
+        fits = (counter_host().m_nMidBot <= mb_capacity) &&
+               (counter_host().m_nMidTop <= mt_capacity) &&
+               (counter_host().m_nTriplets <= triplet_capacity);
+    }
+    Kokkos::fence();
+
+    return seed_buffer;
+}
+
+}  // namespace traccc::kokkos
@@ -1,6 +1,6 @@
 /** TRACCC library, part of the ACTS project (R&D line)
  *
- * (c) 2021-2022 CERN for the benefit of the ACTS project
+ * (c) 2021-2024 CERN for the benefit of the ACTS project
  *
  * Mozilla Public License Version 2.0
  */
@@ -13,10 +13,14 @@
 // Project include(s).
 #include "traccc/seeding/device/count_grid_capacities.hpp"
 #include "traccc/seeding/device/populate_grid.hpp"
+#include "traccc/seeding/device/sort_grid_bins.hpp"
 
 // VecMem include(s).
 #include <vecmem/utils/copy.hpp>
 
+// System include(s).
+#include <numeric>
+
 namespace traccc::kokkos {
 
 spacepoint_binning::spacepoint_binning(
@@ -53,28 +57,30 @@ spacepoint_binning::output_type spacepoint_binning::operator()(
                 Kokkos::TeamThreadRange(team_member, num_threads),
                 [&](const int& thr) {
                     device::count_grid_capacities(
-                        team_member.league_rank() * team_member.team_size() +
-                            thr,
+                        team_member.league_rank() * num_threads + thr,
                         m_config, m_axes.first, m_axes.second, spacepoints_view,
                         grid_capacities_view);
                 });
         });
 
-    // Copy grid capacities back to the host
-    vecmem::vector<unsigned int> grid_capacities_host(m_mr.host ? m_mr.host
-                                                                : &(m_mr.main));
-    (*m_copy)(grid_capacities_buff, grid_capacities_host);
+    // Copy grid capacities back to the host, and turn them into the offsets of
+    // the bins.
+    Kokkos::fence();
+    vecmem::vector<unsigned int> bin_offsets_host(m_mr.host ? m_mr.host
+                                                            : &(m_mr.main));
+    (*m_copy)(grid_capacities_buff, bin_offsets_host);
+    bin_offsets_host.insert(bin_offsets_host.begin(), 0u);
+    std::partial_sum(bin_offsets_host.begin(), bin_offsets_host.end(),
+                     bin_offsets_host.begin());
 
     // Create the grid buffer.
-    sp_grid_buffer grid_buffer(
-        m_axes.first, m_axes.second,
-        std::vector<std::size_t>(grid_capacities_host.begin(),
-                                 grid_capacities_host.end()),
-        m_mr.main, m_mr.host, vecmem::data::buffer_type::resizable);
-    m_copy->setup(grid_buffer._buffer);
-    sp_grid_view grid_view = grid_buffer;
-
-    // Populate the grid.
+    output_type grid_buffer(m_axes.first, m_axes.second,
+                            bin_offsets_host.back(), m_mr.main);
+    (*m_copy)(vecmem::get_data(bin_offsets_host), grid_buffer.bin_offsets);
+    sp_soa_grid_types::view grid_view = get_data(grid_buffer);
+
+    // Populate the grid, re-using the capacity buffer as the bin cursors.
+    m_copy->memset(grid_capacities_buff, 0);
     Kokkos::parallel_for(
         "populate_grid", team_policy(num_blocks, Kokkos::AUTO),
         KOKKOS_LAMBDA(const member_type& team_member) {
@@ -82,9 +88,24 @@ spacepoint_binning::output_type spacepoint_binning::operator()(
                 Kokkos::TeamThreadRange(team_member, num_threads),
                 [&](const int& thr) {
                     device::populate_grid(
-                        team_member.league_rank() * team_member.team_size() +
-                            thr,
-                        m_config, spacepoints_view, grid_view);
+                        team_member.league_rank() * num_threads + thr,
+                        m_config, spacepoints_view, grid_view,
+                        grid_capacities_view);
+                });
+        });
+
+    // Sort the spacepoints of every bin by radius.
+    const unsigned int num_bin_blocks =
+        (grid_bins + num_threads - 1) / num_threads;
+    Kokkos::parallel_for(
+        "sort_grid_bins", team_policy(num_bin_blocks, Kokkos::AUTO),
+        KOKKOS_LAMBDA(const member_type& team_member) {
+            Kokkos::parallel_for(
+                Kokkos::TeamThreadRange(team_member, num_threads),
+                [&](const int& thr) {
+                    device::sort_grid_bins(
+                        team_member.league_rank() * num_threads + thr,
+                        grid_view);
                 });
         });
 
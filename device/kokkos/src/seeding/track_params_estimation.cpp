@@ -0,0 +1,53 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Local include(s).
+#include "traccc/kokkos/seeding/track_params_estimation.hpp"
+
+#include "traccc/kokkos/utils/definitions.hpp"
+
+// Project include(s).
+#include "traccc/seeding/device/estimate_track_params.hpp"
+
+namespace traccc::kokkos {
+
+track_params_estimation::track_params_estimation(
+    const traccc::memory_resource& mr, vecmem::copy& copy)
+    : m_mr(mr), m_copy(copy) {}
+
+track_params_estimation::output_type track_params_estimation::operator()(
+    const spacepoint_collection_types::const_view& spacepoints_view,
+    const seed_collection_types::const_view& seeds_view, const vector3& bfield,
+    const std::array<traccc::scalar, traccc::e_bound_size>& stddev) const {
+
+    // Get the size of the seeds view
+    const unsigned int seeds_size = m_copy.get_size(seeds_view);
+
+    // Create device buffer for the parameters
+    bound_track_parameters_collection_types::buffer params_buffer(seeds_size,
+                                                                  m_mr.main);
+    m_copy.setup(params_buffer);
+
+    // Check if anything needs to be done.
+    if (seeds_size == 0) {
+        return params_buffer;
+    }
+
+    // Run the kernel
+    bound_track_parameters_collection_types::view params_view = params_buffer;
+    Kokkos::parallel_for(
+        "estimate_track_params", range_policy(0, seeds_size),
+        KOKKOS_LAMBDA(const unsigned int i) {
+            device::estimate_track_params(i, spacepoints_view, seeds_view,
+                                          bfield, stddev, params_view);
+        });
+    Kokkos::fence();
+
+    return params_buffer;
+}
+
+}  // namespace traccc::kokkos
@@ -0,0 +1,38 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s).
+#include "traccc/kokkos/utils/definitions.hpp"
+
+namespace traccc::kokkos::details {
+
+/// Barrier synchronising the threads of a Kokkos team
+///
+/// Allows running the block-level algorithms of @c traccc::device with
+/// Kokkos teams in place of thread blocks.
+///
+struct barrier {
+    KOKKOS_INLINE_FUNCTION
+    barrier(const member_type& member) : m_member(member) {}
+
+    KOKKOS_INLINE_FUNCTION
+    void blockBarrier() { m_member.team_barrier(); }
+
+    KOKKOS_INLINE_FUNCTION
+    bool blockOr(bool predicate) {
+        int result = (predicate ? 1 : 0);
+        m_member.team_reduce(Kokkos::Max<int>(result));
+        return (result != 0);
+    }
+
+    private:
+    const member_type& m_member;
+};
+
+}  // namespace traccc::kokkos::details
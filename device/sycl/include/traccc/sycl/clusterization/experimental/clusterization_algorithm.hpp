@@ -1,6 +1,6 @@
 /** TRACCC library, part of the ACTS project (R&D line)
  *
- * (c) 2023 CERN for the benefit of the ACTS project
+ * (c) 2023-2024 CERN for the benefit of the ACTS project
  *
  * Mozilla Public License Version 2.0
  */
@@ -43,10 +43,15 @@ class clusterization_algorithm
     /// @param str The CUDA stream to perform the operations in
     /// @param target_cells_per_partition the average number of cells in each
     /// partition
+    /// @param sub_group_ccl_max_cells_per_module the mean number of cells per
+    /// module below which the connected component labeling is done with one
+    /// sub-group per (smaller) partition, instead of one work-group. If the
+    /// device supports a suitable sub-group size.
     ///
     clusterization_algorithm(const traccc::memory_resource& mr,
                              vecmem::copy& copy, queue_wrapper queue,
-                             const unsigned short target_cells_per_partition);
+                             const unsigned short target_cells_per_partition,
+                             float sub_group_ccl_max_cells_per_module = 32.f);
     // const unsigned short target_cells_per_partition);
 
     /// Callable operator for clusterization algorithm
@@ -62,6 +67,11 @@ class clusterization_algorithm
     private:
     /// The average number of cells in each partition
     unsigned short m_target_cells_per_partition;
+    /// The mean number of cells per module below which sub-group level CCL
+    /// is used
+    float m_sub_group_ccl_max_cells_per_module;
+    /// The sub-group size of the sub-group level CCL (0 if not supported)
+    unsigned int m_sub_group_size;
     /// The maximum number of threads in a work group
     unsigned int m_max_work_group_size;
 
@@ -0,0 +1,67 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s).
+#include "traccc/edm/measurement.hpp"
+#include "traccc/finding/measurement_range.hpp"
+#include "traccc/sycl/utils/queue_wrapper.hpp"
+#include "traccc/utils/algorithm.hpp"
+#include "traccc/utils/memory_resource.hpp"
+
+// VecMem include(s).
+#include <vecmem/utils/copy.hpp>
+
+namespace traccc::sycl {
+
+/// Algorithm building the per-surface segment table of sorted measurements
+///
+/// The track finding looks up the measurements of a surface through a table,
+/// indexed by the surface index of the measurements' barcodes, holding the
+/// range of measurements on every surface. This algorithm builds that table
+/// on the device, for measurements sorted by
+/// @c traccc::sycl::measurement_sorting_algorithm.
+///
+class measurement_segmentation_algorithm
+    : public algorithm<measurement_range_collection_types::buffer(
+          const measurement_collection_types::const_view&)> {
+
+    public:
+    /// Constructor for the algorithm
+    ///
+    /// @param mr The memory resource(s) to use
+    /// @param copy The copy object to use for copying data between device
+    ///             and host memory blocks
+    /// @param queue The SYCL queue to perform the operations in
+    ///
+    measurement_segmentation_algorithm(const traccc::memory_resource& mr,
+                                       vecmem::copy& copy,
+                                       queue_wrapper queue);
+
+    /// Callable operator for the algorithm
+    ///
+    /// The size of the table is set by the largest surface index among the
+    /// measurements, which is read back from the device synchronously.
+    ///
+    /// @param measurements The measurements, sorted by surface
+    /// @return The measurement ranges, indexed by surface
+    ///
+    output_type operator()(const measurement_collection_types::const_view&
+                               measurements) const override;
+
+    private:
+    /// The memory resource(s) to use
+    traccc::memory_resource m_mr;
+    /// The copy object to use
+    vecmem::copy& m_copy;
+    /// The SYCL queue to use
+    mutable queue_wrapper m_queue;
+
+};  // class measurement_segmentation_algorithm
+
+}  // namespace traccc::sycl
@@ -1,6 +1,6 @@
 /** TRACCC library, part of the ACTS project (R&D line)
  *
- * (c) 2021-2022 CERN for the benefit of the ACTS project
+ * (c) 2021-2024 CERN for the benefit of the ACTS project
  *
  * Mozilla Public License Version 2.0
  */
@@ -13,8 +13,9 @@
 // Project include(s).
 #include "traccc/edm/seed.hpp"
 #include "traccc/edm/spacepoint.hpp"
+#include "traccc/seeding/detail/seed_finding_capacities.hpp"
 #include "traccc/seeding/detail/seeding_config.hpp"
-#include "traccc/seeding/detail/spacepoint_grid.hpp"
+#include "traccc/seeding/detail/spacepoint_soa_grid.hpp"
 #include "traccc/utils/algorithm.hpp"
 #include "traccc/utils/memory_resource.hpp"
 
@@ -30,7 +31,7 @@ namespace traccc::sycl {
 // Sycl seeding function object
 class seed_finding : public algorithm<seed_collection_types::buffer(
                          const spacepoint_collection_types::const_view&,
-                         const sp_grid_const_view&)> {
+                         const sp_soa_grid_types::const_view&)> {
 
     public:
     /// Constructor for the sycl seed finding
@@ -43,10 +44,14 @@ class seed_finding : public algorithm<seed_collection_types::buffer(
     ///             and host memory blocks
     /// @param queue    is a wrapper for the sycl queue for kernel
     /// invocation
+    /// @param capacities The capacities to use for finding the seeds without
+    ///                   intermediate host synchronisation (disabled by
+    ///                   default)
     seed_finding(const seedfinder_config& config,
                  const seedfilter_config& filter_config,
                  const traccc::memory_resource& mr, vecmem::copy& copy,
-                 queue_wrapper queue);
+                 queue_wrapper queue,
+                 const seed_finding_capacities& capacities = {});
 
     /// Callable operator for the seed finding
     ///
@@ -56,12 +61,28 @@ class seed_finding : public algorithm<seed_collection_types::buffer(
     ///
     output_type operator()(
         const spacepoint_collection_types::const_view& spacepoints_view,
-        const sp_grid_const_view& g2_view) const override;
+        const sp_soa_grid_types::const_view& g2_view) const override;
 
     private:
+    /// Find the seeds, with either exactly sized or capacity-bounded buffers
+    ///
+    /// @param spacepoints_view     is a view of all spacepoints in the event
+    /// @param g2_view              is a view of the spacepoint grid
+    /// @param num_spacepoints      is the number of spacepoints in the grid
+    /// @param bounded              whether to use @c m_capacities
+    /// @param fits                 set to whether all doublets and triplets
+    ///                             fit into the buffers
+    /// @return                     a vector buffer of seeds
+    ///
+    output_type find_seeds(
+        const spacepoint_collection_types::const_view& spacepoints_view,
+        const sp_soa_grid_types::const_view& g2_view,
+        unsigned int num_spacepoints, bool bounded, bool& fits) const;
+
     /// Private member variables
     seedfinder_config m_seedfinder_config;
     seedfilter_config m_seedfilter_config;
+    seed_finding_capacities m_capacities;
     traccc::memory_resource m_mr;
     mutable queue_wrapper m_queue;
     vecmem::copy& m_copy;
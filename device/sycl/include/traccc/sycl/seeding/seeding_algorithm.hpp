@@ -1,6 +1,6 @@
 /** TRACCC library, part of the ACTS project (R&D line)
  *
- * (c) 2021-2022 CERN for the benefit of the ACTS project
+ * (c) 2021-2024 CERN for the benefit of the ACTS project
  *
  * Mozilla Public License Version 2.0
  */
@@ -37,12 +37,16 @@ class seeding_algorithm : public algorithm<seed_collection_types::buffer(
     /// @param copy The copy object to use for copying data between device
     ///             and host memory blocks
     /// @param queue The SYCL queue to work with
+    /// @param capacities The capacities to use for finding the seeds without
+    ///                   intermediate host synchronisation (disabled by
+    ///                   default)
     ///
     seeding_algorithm(const seedfinder_config& finder_config,
                       const spacepoint_grid_config& grid_config,
                       const seedfilter_config& filter_config,
                       const traccc::memory_resource& mr, vecmem::copy& copy,
-                      const queue_wrapper& queue);
+                      const queue_wrapper& queue,
+                      const seed_finding_capacities& capacities = {});
 
     /// Operator executing the algorithm.
     ///
@@ -1,6 +1,6 @@
 /** TRACCC library, part of the ACTS project (R&D line)
  *
- * (c) 2021-2022 CERN for the benefit of the ACTS project
+ * (c) 2021-2024 CERN for the benefit of the ACTS project
  *
  * Mozilla Public License Version 2.0
  */
@@ -13,7 +13,7 @@
 // Project include(s).
 #include "traccc/edm/spacepoint.hpp"
 #include "traccc/seeding/detail/seeding_config.hpp"
-#include "traccc/seeding/detail/spacepoint_grid.hpp"
+#include "traccc/seeding/detail/spacepoint_soa_grid.hpp"
 #include "traccc/utils/algorithm.hpp"
 #include "traccc/utils/memory_resource.hpp"
 
@@ -28,8 +28,12 @@
 namespace traccc::sycl {
 
 /// Spacepoing binning executed on a SYCL device
+///
+/// The spacepoints of every bin of the produced grid are sorted by radius,
+/// the same way as by the host algorithm.
+///
 class spacepoint_binning
-    : public algorithm<sp_grid_buffer(
+    : public algorithm<sp_soa_grid_types::buffer(
           const spacepoint_collection_types::const_view&)> {
 
     public:
@@ -40,13 +44,13 @@ class spacepoint_binning
                        queue_wrapper queue);
 
     /// Function executing the algorithm with a a view of spacepoints
-    sp_grid_buffer operator()(const spacepoint_collection_types::const_view&
-                                  spacepoints_view) const override;
+    output_type operator()(const spacepoint_collection_types::const_view&
+                               spacepoints_view) const override;
 
     private:
     /// Member variables
     seedfinder_config m_config;
-    std::pair<sp_grid::axis_p0_type, sp_grid::axis_p1_type> m_axes;
+    std::pair<sp_soa_grid_axis_p0_type, sp_soa_grid_axis_p1_type> m_axes;
     traccc::memory_resource m_mr;
     mutable queue_wrapper m_queue;
     vecmem::copy& m_copy;
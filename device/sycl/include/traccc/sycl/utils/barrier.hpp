@@ -1,6 +1,6 @@
 /** TRACCC library, part of the ACTS project (R&D line)
  *
- * (c) 2023 CERN for the benefit of the ACTS project
+ * (c) 2023-2024 CERN for the benefit of the ACTS project
  *
  * Mozilla Public License Version 2.0
  */
@@ -28,4 +28,26 @@ struct barrier {
     ::sycl::nd_item<1> m_item;
 };
 
+/// Barrier synchronising the work-items of a single sub-group
+///
+/// Allows running the work-group level algorithms of @c traccc::device on
+/// individual sub-groups, using sub-group synchronisation and reductions
+/// instead of work-group barriers.
+///
+struct sub_group_barrier {
+    sub_group_barrier(::sycl::sub_group sub_group) : m_sub_group(sub_group){};
+
+    TRACCC_DEVICE
+    void blockBarrier() { ::sycl::group_barrier(m_sub_group); }
+
+    TRACCC_DEVICE
+    bool blockOr(bool predicate) {
+        ::sycl::group_barrier(m_sub_group);
+        return ::sycl::any_of_group(m_sub_group, predicate);
+    }
+
+    private:
+    ::sycl::sub_group m_sub_group;
+};
+
 }  // namespace traccc::sycl
\ No newline at end of file
@@ -0,0 +1,52 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s).
+#include "traccc/edm/cell.hpp"
+#include "traccc/edm/measurement.hpp"
+
+// VecMem include(s).
+#include <vecmem/containers/data/vector_view.hpp>
+
+// SYCL include(s).
+#include <CL/sycl.hpp>
+
+namespace traccc::sycl::details {
+
+/// Get the sub-group size to run the sub-group level CCL with on a device
+///
+/// @param queue The queue of the device
+/// @return The largest of the supported sub-group sizes, or 0 if the device
+///         supports none of them
+///
+unsigned int sub_group_ccl_size(const ::sycl::queue& queue);
+
+/// Run @c traccc::device::ccl_kernel with one sub-group per partition
+///
+/// Meant for sparse events, where the partitions are small enough for the
+/// sub-group level synchronisation and reductions to be much cheaper than
+/// work-group barriers.
+///
+/// @param queue The queue to run the kernel in
+/// @param sub_group_size The sub-group size to use, as returned by
+///                       @c sub_group_ccl_size
+/// @param n_cells The number of cells
+/// @param measurement_count The counter of the measurements, in device
+///                          memory
+///
+void launch_sub_group_ccl(
+    ::sycl::queue& queue, unsigned int sub_group_size,
+    const cell_collection_types::const_view& cells,
+    const cell_module_collection_types::const_view& modules,
+    unsigned int n_cells, measurement_collection_types::view measurements,
+    unsigned int* measurement_count,
+    vecmem::data::vector_view<unsigned int> cell_links,
+    vecmem::data::vector_view<unsigned int> ccl_backup);
+
+}  // namespace traccc::sycl::details
@@ -0,0 +1,96 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Project include(s).
+#include "traccc/io/read_cells.hpp"
+#include "traccc/io/read_digitization_config.hpp"
+#include "traccc/io/read_geometry.hpp"
+#include "traccc/options/detector.hpp"
+#include "traccc/options/input_data.hpp"
+#include "traccc/options/program_options.hpp"
+#include "traccc/performance/timer.hpp"
+#include "traccc/performance/timing_info.hpp"
+
+// VecMem include(s).
+#include <vecmem/memory/host_memory_resource.hpp>
+
+// System include(s).
+#include <cstdlib>
+#include <iostream>
+
+int benchmark_read_cells(const traccc::opts::detector& detector_opts,
+                         const traccc::opts::input_data& input_opts) {
+
+    // Read the surface transforms
+    auto [surface_transforms, barcode_map] = traccc::io::read_geometry(
+        detector_opts.detector_file,
+        (detector_opts.use_detray_detector ? traccc::data_format::json
+                                           : traccc::data_format::csv),
+        detector_opts.cache_directory);
+
+    // Read the digitization configuration file
+    auto digi_cfg = traccc::io::read_digitization_config(
+        detector_opts.digitization_file, traccc::data_format::json,
+        detector_opts.cache_directory);
+
+    // Memory resource used by the EDM.
+    vecmem::host_memory_resource host_mr;
+
+    // Timing information of the two readers.
+    traccc::performance::timing_info times;
+
+    // Loop over events
+    std::size_t n_mismatches = 0;
+    for (std::size_t event = input_opts.skip;
+         event < input_opts.events + input_opts.skip; ++event) {
+
+        // Read the cells of the event with both readers.
+        traccc::io::cell_reader_output linear(&host_mr), indexed(&host_mr);
+        {
+            traccc::performance::timer t{"Linear module lookup", times};
+            traccc::io::read_cells(linear, event, input_opts.directory,
+                                   traccc::data_format::csv,
+                                   &surface_transforms, &digi_cfg,
+                                   barcode_map.get(), false);
+        }
+        {
+            traccc::performance::timer t{"Indexed module lookup", times};
+            traccc::io::read_cells(indexed, event, input_opts.directory,
+                                   traccc::data_format::csv,
+                                   &surface_transforms, &digi_cfg,
+                                   barcode_map.get(), true);
+        }
+
+        // Make sure that they produced the same output.
+        if (!((linear.cells == indexed.cells) &&
+              (linear.modules == indexed.modules))) {
+            std::cerr << "Different cells read for event " << event
+                      << std::endl;
+            ++n_mismatches;
+        }
+    }
+
+    // Print the results.
+    std::cout << "Time totals:" << std::endl;
+    std::cout << times << std::endl;
+
+    return (n_mismatches == 0 ? EXIT_SUCCESS : EXIT_FAILURE);
+}
+
+// The main routine
+//
+int main(int argc, char* argv[]) {
+
+    // Program options.
+    traccc::opts::detector detector_opts;
+    traccc::opts::input_data input_opts;
+    traccc::opts::program_options program_opts{
+        "CSV Cell Reading Benchmark", {detector_opts, input_opts}, argc, argv};
+
+    // Run the application.
+    return benchmark_read_cells(detector_opts, input_opts);
+}
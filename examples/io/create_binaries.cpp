@@ -6,6 +6,7 @@
  */
 
 // Project include(s).
+#include "traccc/io/demonstrator_edm.hpp"
 #include "traccc/io/read_cells.hpp"
 #include "traccc/io/read_digitization_config.hpp"
 #include "traccc/io/read_geometry.hpp"
@@ -22,6 +23,7 @@
 
 // System include(s).
 #include <cstdlib>
+#include <utility>
 
 int create_binaries(const traccc::opts::detector& detector_opts,
                     const traccc::opts::input_data& input_opts,
@@ -38,6 +40,9 @@ int create_binaries(const traccc::opts::detector& detector_opts,
     // Memory resource used by the EDM.
     vecmem::host_memory_resource host_mr;
 
+    // All events' cells, if they are to be written into a packed file.
+    traccc::demonstrator_input packed_cells(&host_mr);
+
     // Loop over events
     for (unsigned int event = input_opts.skip;
          event < input_opts.events + input_opts.skip; ++event) {
@@ -48,11 +53,19 @@ int create_binaries(const traccc::opts::detector& detector_opts,
                                input_opts.format, &surface_transforms,
                                &digi_cfg);
 
-        // Write binary file
-        traccc::io::write(event, output_opts.directory,
-                          traccc::data_format::binary,
-                          vecmem::get_data(cells_csv.cells),
-                          vecmem::get_data(cells_csv.modules));
+        // Write binary (or compressed) file, or collect the cells for the
+        // packed file
+        if (output_opts.format == traccc::data_format::packed) {
+            packed_cells.push_back(std::move(cells_csv));
+        } else {
+            traccc::io::write(
+                event, output_opts.directory,
+                (output_opts.format == traccc::data_format::compressed
+                     ? traccc::data_format::compressed
+                     : traccc::data_format::binary),
+                vecmem::get_data(cells_csv.cells),
+                vecmem::get_data(cells_csv.modules));
+        }
 
         // Read the hits from the relevant event file
         traccc::io::spacepoint_reader_output spacepoints_csv(&host_mr);
@@ -78,6 +91,12 @@ int create_binaries(const traccc::opts::detector& detector_opts,
                           vecmem::get_data(measurements_csv.modules));
     }
 
+    // Write the packed cell file, if requested
+    if (output_opts.format == traccc::data_format::packed) {
+        traccc::io::write(output_opts.directory, traccc::data_format::packed,
+                          packed_cells);
+    }
+
     return EXIT_SUCCESS;
 }
 
@@ -21,6 +21,20 @@ class accelerator : public interface {
 
     /// Whether to compare the accelerator code's output with that of the CPU
     bool compare_with_cpu = false;
+    /// Whether to compare the accelerator code's output with that of its
+    /// mixed-precision version
+    bool compare_mixed_precision = false;
+    /// Whether to read binary cell files straight into device memory
+    bool direct_input = false;
+    /// Whether to time the individual kernels launched by the algorithms
+    bool profile_kernels = false;
+    /// Whether to print a roofline report of the processing stages
+    bool roofline = false;
+    /// The peak memory bandwidth of the host [GB/s], 0 if unknown
+    double host_peak_bandwidth = 0.;
+    /// The peak floating point throughput of the host [GFLOP/s], 0 if
+    /// unknown
+    double host_peak_gflops = 0.;
 
     /// @}
 
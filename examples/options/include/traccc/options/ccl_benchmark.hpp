@@ -0,0 +1,48 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s).
+#include "traccc/options/details/interface.hpp"
+
+// System include(s).
+#include <cstddef>
+#include <string>
+
+namespace traccc::opts {
+
+/// Command line options used in the clusterization benchmarks
+class ccl_benchmark : public interface {
+
+    public:
+    /// @name Options
+    /// @{
+
+    /// The number of times to process every event, while measuring
+    std::size_t repetitions = 10;
+    /// The number of times to process every event "cold", i.e. without
+    /// accounting for them in the performance measurements
+    std::size_t cold_runs = 1;
+    /// The number of events to process in a single call, for the algorithms
+    /// able to process batches of events
+    std::size_t batch_size = 1;
+    /// Output log file
+    std::string log_file;
+
+    /// @}
+
+    /// Constructor
+    ccl_benchmark();
+
+    private:
+    /// Print the specific options of this class
+    std::ostream& print_impl(std::ostream& out) const override;
+
+};  // class ccl_benchmark
+
+}  // namespace traccc::opts
@@ -28,6 +28,8 @@ class detector : public interface {
     std::string material_file;
     /// The file containing the surface grid description
     std::string grid_file;
+    /// The file containing the magnetic field map (in covfie format)
+    std::string bfield_file;
     /// Use detray::detector for the geometry handling
     bool use_detray_detector = false;
 
@@ -35,6 +37,10 @@ class detector : public interface {
     std::string digitization_file =
         "tml_detector/default-geometric-config-generic.json";
 
+    /// Directory for binary snapshots of the geometry and digitization
+    /// configuration (no caching if empty)
+    std::string cache_directory;
+
     /// @}
 
     /// Constructor
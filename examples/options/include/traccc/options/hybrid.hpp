@@ -0,0 +1,46 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s).
+#include "traccc/options/details/interface.hpp"
+
+// System include(s).
+#include <cstddef>
+
+namespace traccc::opts {
+
+/// Option(s) for sharing the event processing between the host and devices
+class hybrid : public interface {
+
+    public:
+    /// @name Options
+    /// @{
+
+    /// The number of host algorithm instances (0: one per thread not used
+    /// by a device instance)
+    std::size_t host_instances = 0;
+    /// The number of cells from which events are preferably processed on a
+    /// device (0: the median event size)
+    std::size_t size_threshold = 0;
+    /// The maximal number of cells of the events that the host may take over
+    /// from the devices (0: no limit)
+    std::size_t host_max_cells = 0;
+
+    /// @}
+
+    /// Constructor
+    hybrid();
+
+    private:
+    /// Print the specific options of this class
+    std::ostream& print_impl(std::ostream& out) const override;
+
+};  // class hybrid
+
+}  // namespace traccc::opts
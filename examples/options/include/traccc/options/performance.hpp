@@ -21,6 +21,9 @@ class performance : public interface {
 
     /// Whether to run performance checks
     bool run = false;
+    /// Whether to read the hardware performance counters in the timed
+    /// (host) stages
+    bool hardware_counters = false;
 
     /// @}
 
@@ -0,0 +1,63 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s).
+#include "traccc/options/details/interface.hpp"
+
+// System include(s).
+#include <cstddef>
+#include <map>
+#include <string>
+
+namespace traccc::opts {
+
+/// Option(s) for the pipelined (flow graph) event processing
+class pipeline : public interface {
+
+    public:
+    /// @name Options
+    /// @{
+
+    /// The maximal number of events in flight in the pipeline
+    std::size_t tokens = 8;
+    /// The number of events read concurrently
+    std::size_t read_concurrency = 1;
+    /// The number of events written concurrently
+    std::size_t write_concurrency = 1;
+    /// The default number of events processed concurrently by each
+    /// reconstruction stage (0: unlimited)
+    std::size_t stage_concurrency = 0;
+    /// Concurrency limits of individual stages, overriding the default
+    std::map<std::string, std::size_t> stage_limits;
+    /// File to write the reconstruction results into (empty: don't write)
+    std::string output_file;
+    /// The maximal number of events waiting to be written
+    std::size_t output_queue_depth = 16;
+
+    /// @}
+
+    /// Constructor
+    pipeline();
+
+    /// Read/process the command line options
+    ///
+    /// @param vm The command line options to interpret/read
+    ///
+    void read(const boost::program_options::variables_map& vm) override;
+
+    /// Get the concurrency limit of a given stage (0: unlimited)
+    std::size_t concurrency(const std::string& stage) const;
+
+    private:
+    /// Print the specific options of this class
+    std::ostream& print_impl(std::ostream& out) const override;
+
+};  // class pipeline
+
+}  // namespace traccc::opts
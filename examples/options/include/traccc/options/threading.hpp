@@ -24,6 +24,8 @@ class threading : public interface {
 
     /// The number of threads to use for the data processing
     std::size_t threads = 1;
+    /// Whether to pin the threads to NUMA nodes, with node-local input data
+    bool numa = false;
 
     /// @}
 
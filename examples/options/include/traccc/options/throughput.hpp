@@ -13,9 +13,27 @@
 // System include(s).
 #include <cstddef>
 #include <string>
+#include <vector>
 
 namespace traccc::opts {
 
+/// Order in which the throughput applications process their input events
+enum class event_ordering {
+    /// Events chosen randomly (with repetitions)
+    random,
+    /// Events processed in the order of their indices
+    sequential,
+    /// Events processed in (repeated) random permutations
+    shuffle,
+    /// Events processed in the order of their number of cells
+    by_size,
+    /// Every batch of events processed in decreasing order of its estimated
+    /// cost (longest processing time first)
+    largest_first,
+    /// Events processed in the order given by a file
+    replay
+};
+
 /// Command line options used in the throughput tests
 class throughput : public interface {
 
@@ -32,11 +50,137 @@ class throughput : public interface {
     /// Output log file
     std::string log_file;
 
+    /// Capture and replay the (device) processing of the events as a graph,
+    /// where the algorithm supports it
+    bool use_graph = false;
+
+    /// The number of (page-locked) staging slots per algorithm, that the input
+    /// of upcoming events is uploaded into ahead of time, where the algorithm
+    /// supports it. Zero turns the staging off.
+    unsigned int staging_ring_size = 0;
+
+    /// Re-link the cells of all (preloaded) events to a single table of
+    /// modules, which algorithms supporting it keep on the device for all
+    /// events
+    bool use_module_table = false;
+
+    /// The number of algorithm instances (streams) to set up on each of the
+    /// visible devices, with the events being routed to the least loaded
+    /// device. Zero sets up one algorithm instance per thread, on the default
+    /// device.
+    unsigned int streams_per_device = 0;
+
+    /// The number of events to buffer when streaming the input events during
+    /// the processing, instead of reading all of them up front. Zero turns
+    /// the streaming off.
+    unsigned int input_queue_depth = 0;
+    /// The number of threads reading the input events, when streaming them
+    unsigned int input_reader_threads = 1;
+
+    /// File to write the reconstructed track parameters into, in the
+    /// background. No output is written if empty.
+    std::string output_file;
+    /// The number of events that can wait for being written at once
+    unsigned int output_queue_depth = 16;
+
+    /// File to write the latency statistics of the processing stages into,
+    /// in JSON format. No such file is written if empty.
+    std::string timing_file;
+    /// File to write the summary of the measurement (throughput, times and
+    /// memory use) into, in JSON format. No such file is written if empty.
+    std::string summary_file;
+    /// File to periodically write the live metrics of the processing into,
+    /// in JSON format if it ends in ".json", and in the Prometheus text
+    /// format otherwise. No metrics are exported if empty.
+    std::string metrics_file;
+    /// The interval of writing the live metrics, in milliseconds
+    unsigned int metrics_interval = 10000;
+
+    /// The order to process the input events in
+    event_ordering ordering = event_ordering::random;
+    /// The seed of the random event orderings (0: based on the time)
+    unsigned int random_seed = 0;
+    /// File with the event indices to process, for the replay ordering
+    std::string event_list_file;
+    /// File to write the latency and size of every processed event into, in
+    /// CSV format. No such file is written if empty.
+    std::string event_log_file;
+
+    /// Measure the energy used by the devices during the event processing
+    bool measure_energy = false;
+    /// The interval of sampling the energy counters, in milliseconds
+    unsigned int energy_sampling_interval = 100;
+
+    /// File with the tuned launch parameters of the device kernels, where
+    /// the algorithm supports it. The default launch parameters are used if
+    /// empty.
+    std::string launch_tuning_file;
+    /// Tune the launch parameters of the device kernels on the first input
+    /// event before the processing, writing them into the launch tuning file
+    bool autotune_launches = false;
+    /// Prepare every algorithm instance (memory pools, loaded kernels) with
+    /// the first input event before the processing, where the algorithm
+    /// supports it
+    bool warm_up_algorithms = false;
+
+    /// @}
+
+    /// @name Options of the throughput sweep / regression test mode
+    /// @{
+
+    /// Thread counts to measure the throughput with
+    std::vector<unsigned int> sweep_threads;
+    /// Streams per device values to measure the throughput with
+    std::vector<unsigned int> sweep_streams_per_device;
+    /// Target cells per partition values to measure the throughput with
+    std::vector<unsigned int> sweep_cells_per_partition;
+    /// Pileup values to measure the throughput with, using events made by
+    /// overlaying the input events
+    std::vector<unsigned int> sweep_pileup;
+    /// The (average) pileup of the input events, that the overlaid events
+    /// are made of
+    unsigned int input_pileup = 0;
+    /// The number of measurements to make with each configuration
+    unsigned int sweep_repetitions = 3;
+    /// File to write the results of the sweep into, in JSON format
+    std::string results_file;
+    /// File with the baseline results (of an earlier sweep) to compare to
+    std::string baseline_file;
+    /// The p-value below which a throughput decrease is significant
+    float regression_significance = 0.05f;
+    /// The relative throughput decrease still tolerated without a regression
+    float regression_tolerance = 0.05f;
+
+    /// Whether the throughput sweep / regression test mode was requested
+    bool sweep() const;
+
+    /// @}
+
+    /// @name Options of the (open loop) latency mode
+    /// @{
+
+    /// Mean arrival rates of the events (in Hz) to measure the end-to-end
+    /// latency of the events at, with their arrival times following a Poisson
+    /// process
+    std::vector<float> latency_arrival_rates;
+    /// File to write the latencies against the load into, in CSV format. No
+    /// such file is written if empty.
+    std::string latency_file;
+
+    /// Whether the latency mode was requested
+    bool latency() const;
+
     /// @}
 
     /// Constructor
     throughput();
 
+    /// Read/process the command line options
+    ///
+    /// @param vm The command line options to interpret/read
+    ///
+    void read(const boost::program_options::variables_map& vm) override;
+
     private:
     /// Print the specific options of this class
     std::ostream& print_impl(std::ostream& out) const override;
@@ -29,6 +29,32 @@ class track_finding : public interface {
     float chi2_max = 30.f;
     /// Maximum number of branches which each initial seed can have at a step
     unsigned int nmax_per_seed = std::numeric_limits<unsigned int>::max();
+    /// Run the step loop of the device track finding without host
+    /// synchronisation
+    bool run_step_loop_on_device = false;
+    /// Minimum number of parameters in a device track finding step for
+    /// sorting them by surface (0 for no sorting)
+    unsigned int min_params_for_surface_sort = 0;
+    /// Memory budget of the device track finding of one event, in MB (0 for
+    /// no limit)
+    unsigned int device_memory_budget_mb = 0;
+    /// Number of input parameters per task in the host track finding (0 for
+    /// serial processing)
+    unsigned int host_params_per_task = 0;
+    /// Keep the best chi2 measurements of every surface, instead of the
+    /// first compatible ones
+    bool best_chi2_branching = false;
+    /// Prune the branches sharing their measurements with better branches,
+    /// in every (device) track finding step
+    bool prune_shared_hits = false;
+    /// Maximum number of seeds of one event (0 for no limit)
+    unsigned int max_num_seeds = 0;
+    /// Maximum number of branches in flight in a device track finding step,
+    /// above which the following steps stop branching (0 for no limit)
+    unsigned int max_num_branches_in_flight = 0;
+    /// Wall-clock budget of the device track finding of one event, in ms (0
+    /// for no limit)
+    unsigned int max_event_time_ms = 0;
 
     /// @}
 
@@ -25,6 +25,9 @@ class track_propagation : public interface {
 
     /// Propagation configuration object
     detray::propagation::config<float> config;
+    /// Maximum number of navigation candidate vectors of the device
+    /// propagation
+    unsigned int navigation_buffer_size = 16384;
 
     /// @}
 
@@ -8,11 +8,14 @@
 #pragma once
 
 // Project include(s).
+#include "traccc/edm/region_of_interest.hpp"
 #include "traccc/options/details/interface.hpp"
+#include "traccc/options/details/value_array.hpp"
 #include "traccc/seeding/detail/seeding_config.hpp"
 
 // System include(s).
 #include <iosfwd>
+#include <vector>
 
 namespace traccc::opts {
 
@@ -27,12 +30,38 @@ class track_seeding : public interface {
     traccc::seedfinder_config seedfinder;
     /// Configuration for the seed filtering
     traccc::seedfilter_config seedfilter;
+    /// Configuration for the selection of the seeds handed to the track
+    /// finding
+    traccc::seed_selection_config seedselection;
+
+    /// Regions of interest, as ETA_MIN:ETA_MAX:PHI_MIN:PHI_MAX:Z_MIN:Z_MAX,
+    /// with the angles in degrees and the vertex positions in mm
+    std::vector<opts::value_array<float, 6> > roi_specs;
+
+    /// @}
+
+    /// @name Derived options
+    /// @{
+
+    /// The regions of interest to run the reconstruction in. When empty, the
+    /// full event is reconstructed.
+    std::vector<traccc::region_of_interest> rois;
 
     /// @}
 
     /// Constructor
     track_seeding();
 
+    /// Read/process the command line options
+    ///
+    /// @param vm The command line options to interpret/read
+    ///
+    void read(const boost::program_options::variables_map& vm) override;
+
+    private:
+    /// Print the specific options of this class
+    std::ostream& print_impl(std::ostream& out) const override;
+
 };  // struct track_seeding
 
 }  // namespace traccc::opts
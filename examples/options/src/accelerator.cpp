@@ -18,11 +18,50 @@ accelerator::accelerator() : interface("Accelerator Options") {
     m_desc.add_options()("compare-with-cpu",
                          boost::program_options::bool_switch(&compare_with_cpu),
                          "Compare accelerator output with that of the CPU");
+    m_desc.add_options()(
+        "compare-mixed-precision",
+        boost::program_options::bool_switch(&compare_mixed_precision),
+        "Compare accelerator output with that of the mixed-precision code");
+    m_desc.add_options()(
+        "direct-input", boost::program_options::bool_switch(&direct_input),
+        "Read binary cell files straight into device memory (with GPUDirect "
+        "Storage, if available)");
+    m_desc.add_options()(
+        "profile-kernels",
+        boost::program_options::bool_switch(&profile_kernels),
+        "Time the individual kernels launched by the algorithms");
+    m_desc.add_options()(
+        "roofline", boost::program_options::bool_switch(&roofline),
+        "Report the estimated memory traffic and floating point operations of "
+        "the processing stages, against the peaks of the devices");
+    m_desc.add_options()(
+        "host-peak-bandwidth",
+        boost::program_options::value(&host_peak_bandwidth)
+            ->default_value(host_peak_bandwidth),
+        "Peak memory bandwidth of the host [GB/s], for the roofline report");
+    m_desc.add_options()(
+        "host-peak-gflops",
+        boost::program_options::value(&host_peak_gflops)
+            ->default_value(host_peak_gflops),
+        "Peak floating point throughput of the host [GFLOP/s], for the "
+        "roofline report");
 }
 
 std::ostream& accelerator::print_impl(std::ostream& out) const {
 
-    out << "  Compare with CPU results: " << (compare_with_cpu ? "yes" : "no");
+    out << "  Compare with CPU results: " << (compare_with_cpu ? "yes" : "no")
+        << "\n"
+        << "  Compare with mixed-precision results: "
+        << (compare_mixed_precision ? "yes" : "no") << "\n"
+        << "  Direct input to the device: " << (direct_input ? "yes" : "no")
+        << "\n"
+        << "  Profile kernels: " << (profile_kernels ? "yes" : "no") << "\n"
+        << "  Roofline report: " << (roofline ? "yes" : "no");
+    if (roofline) {
+        out << "\n"
+            << "  Host peak bandwidth: " << host_peak_bandwidth << " GB/s\n"
+            << "  Host peak throughput: " << host_peak_gflops << " GFLOP/s";
+    }
     return out;
 }
 
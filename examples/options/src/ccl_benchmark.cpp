@@ -0,0 +1,44 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Library include(s).
+#include "traccc/options/ccl_benchmark.hpp"
+
+// System include(s).
+#include <iostream>
+
+namespace traccc::opts {
+
+/// Convenience namespace shorthand
+namespace po = boost::program_options;
+
+ccl_benchmark::ccl_benchmark() : interface("CCL Benchmark Options") {
+
+    m_desc.add_options()(
+        "repetitions", po::value(&repetitions)->default_value(repetitions),
+        "Number of times to process every event");
+    m_desc.add_options()("cold-runs",
+                         po::value(&cold_runs)->default_value(cold_runs),
+                         "Number of times to process every event 'cold'");
+    m_desc.add_options()(
+        "batch-size", po::value(&batch_size)->default_value(batch_size),
+        "Number of events to process in a single call");
+    m_desc.add_options()(
+        "log-file", po::value(&log_file),
+        "File where result logs will be printed (in append mode).");
+}
+
+std::ostream& ccl_benchmark::print_impl(std::ostream& out) const {
+
+    out << "  Repetitions: " << repetitions << "\n"
+        << "  Cold runs  : " << cold_runs << "\n"
+        << "  Batch size : " << batch_size << "\n"
+        << "  Log file   : " << log_file;
+    return out;
+}
+
+}  // namespace traccc::opts
@@ -28,6 +28,9 @@ detector::detector() : interface("Detector Options") {
     m_desc.add_options()("grid-file",
                          po::value(&grid_file)->default_value(grid_file),
                          "Surface grid file");
+    m_desc.add_options()("bfield-file",
+                         po::value(&bfield_file)->default_value(bfield_file),
+                         "Magnetic field map file (in covfie format)");
     m_desc.add_options()("use-detray-detector",
                          po::bool_switch(&use_detray_detector),
                          "Use detray::detector for the geometry handling");
@@ -35,6 +38,11 @@ detector::detector() : interface("Detector Options") {
         "digitization-file",
         po::value(&digitization_file)->default_value(digitization_file),
         "Digitization file");
+    m_desc.add_options()(
+        "cache-directory",
+        po::value(&cache_directory)->default_value(cache_directory),
+        "Directory for binary snapshots of the geometry and digitization "
+        "configuration");
 }
 
 std::ostream& detector::print_impl(std::ostream& out) const {
@@ -42,9 +50,11 @@ std::ostream& detector::print_impl(std::ostream& out) const {
     out << "  Detector file       : " << detector_file << "\n"
         << "  Material file       : " << material_file << "\n"
         << "  Surface rid file    : " << grid_file << "\n"
+        << "  B-field file        : " << bfield_file << "\n"
         << "  Use detray::detector: " << (use_detray_detector ? "yes" : "no")
         << "\n"
-        << "  Digitization file   : " << digitization_file;
+        << "  Digitization file   : " << digitization_file << "\n"
+        << "  Cache directory     : " << cache_directory;
     return out;
 }
 
@@ -0,0 +1,45 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Library include(s).
+#include "traccc/options/hybrid.hpp"
+
+// System include(s).
+#include <iostream>
+
+namespace traccc::opts {
+
+/// Convenience namespace shorthand
+namespace po = boost::program_options;
+
+hybrid::hybrid() : interface("Hybrid Host/Device Processing Options") {
+
+    m_desc.add_options()(
+        "hybrid-host-instances",
+        po::value(&host_instances)->default_value(host_instances),
+        "Number of host algorithm instances (0: one per remaining thread)");
+    m_desc.add_options()(
+        "hybrid-size-threshold",
+        po::value(&size_threshold)->default_value(size_threshold),
+        "Number of cells from which events are preferably processed on a "
+        "device (0: the median event size)");
+    m_desc.add_options()(
+        "hybrid-host-max-cells",
+        po::value(&host_max_cells)->default_value(host_max_cells),
+        "Largest event (in cells) that the host may take over from a device "
+        "(0: no limit)");
+}
+
+std::ostream& hybrid::print_impl(std::ostream& out) const {
+
+    out << "  Host instances    : " << host_instances << "\n"
+        << "  Size threshold    : " << size_threshold << "\n"
+        << "  Host max. cells   : " << host_max_cells;
+    return out;
+}
+
+}  // namespace traccc::opts
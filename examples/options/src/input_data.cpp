@@ -49,6 +49,12 @@ void input_data::read(const po::variables_map& vm) {
             format = data_format::binary;
         } else if (input_format_string == "json") {
             format = data_format::json;
+        } else if (input_format_string == "mapped") {
+            format = data_format::mapped;
+        } else if (input_format_string == "packed") {
+            format = data_format::packed;
+        } else if (input_format_string == "compressed") {
+            format = data_format::compressed;
         } else {
             throw std::invalid_argument("Unknown input data format");
         }
@@ -18,11 +18,16 @@ performance::performance() : interface("Performance Measurement Options") {
     m_desc.add_options()("check-performance",
                          boost::program_options::bool_switch(&run),
                          "Run performance checks");
+    m_desc.add_options()(
+        "hardware-counters",
+        boost::program_options::bool_switch(&hardware_counters),
+        "Read the hardware performance counters in the timed (host) stages");
 }
 
 std::ostream& performance::print_impl(std::ostream& out) const {
 
-    out << "  Run performance checks: " << (run ? "yes" : "no");
+    out << "  Run performance checks: " << (run ? "yes" : "no") << "\n"
+        << "  Hardware counters     : " << (hardware_counters ? "yes" : "no");
     return out;
 }
 
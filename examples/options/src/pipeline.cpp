@@ -0,0 +1,115 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Library include(s).
+#include "traccc/options/pipeline.hpp"
+
+// System include(s).
+#include <iostream>
+#include <stdexcept>
+#include <vector>
+
+namespace traccc::opts {
+
+/// Convenience namespace shorthand
+namespace po = boost::program_options;
+
+/// Name of the per-stage concurrency limit option
+static const char* stage_limit_option = "pipeline-stage-limit";
+
+pipeline::pipeline() : interface("Pipeline Options") {
+
+    m_desc.add_options()("pipeline-tokens",
+                         po::value(&tokens)->default_value(tokens),
+                         "Maximal number of events in flight in the pipeline");
+    m_desc.add_options()(
+        "pipeline-read-concurrency",
+        po::value(&read_concurrency)->default_value(read_concurrency),
+        "Number of events read concurrently");
+    m_desc.add_options()(
+        "pipeline-write-concurrency",
+        po::value(&write_concurrency)->default_value(write_concurrency),
+        "Number of events written concurrently");
+    m_desc.add_options()(
+        "pipeline-stage-concurrency",
+        po::value(&stage_concurrency)->default_value(stage_concurrency),
+        "Number of events processed concurrently by each reconstruction "
+        "stage (0: unlimited)");
+    m_desc.add_options()(
+        stage_limit_option,
+        po::value<std::vector<std::string> >()->multitoken(),
+        "Concurrency limits of individual stages, as <stage>=<N> (stages: "
+        "read, clusterization, spacepoints, seeding, params, finding, "
+        "fitting, resolution, write)");
+    m_desc.add_options()(
+        "output-file", po::value(&output_file)->default_value(output_file),
+        "File to write the reconstructed tracks into");
+    m_desc.add_options()(
+        "output-queue-depth",
+        po::value(&output_queue_depth)->default_value(output_queue_depth),
+        "Number of events waiting to be written at once");
+}
+
+void pipeline::read(const po::variables_map& vm) {
+
+    if (tokens == 0) {
+        throw std::invalid_argument{"Must use pipeline-tokens>0"};
+    }
+    if ((read_concurrency == 0) || (write_concurrency == 0)) {
+        throw std::invalid_argument{
+            "Must use a non-zero read and write concurrency"};
+    }
+
+    // Decode the per-stage limits.
+    if (vm.count(stage_limit_option)) {
+        for (const std::string& limit :
+             vm[stage_limit_option].as<std::vector<std::string> >()) {
+            const std::size_t pos = limit.find('=');
+            if ((pos == 0) || (pos == std::string::npos)) {
+                throw std::invalid_argument{"Invalid stage limit: " + limit};
+            }
+            try {
+                stage_limits[limit.substr(0, pos)] =
+                    std::stoul(limit.substr(pos + 1));
+            } catch (const std::exception&) {
+                throw std::invalid_argument{"Invalid stage limit: " + limit};
+            }
+        }
+    }
+}
+
+std::size_t pipeline::concurrency(const std::string& stage) const {
+
+    auto it = stage_limits.find(stage);
+    if (it != stage_limits.end()) {
+        return it->second;
+    }
+    if (stage == "read") {
+        return read_concurrency;
+    }
+    if (stage == "write") {
+        return write_concurrency;
+    }
+    return stage_concurrency;
+}
+
+std::ostream& pipeline::print_impl(std::ostream& out) const {
+
+    out << "  Tokens            : " << tokens << "\n"
+        << "  Read concurrency  : " << read_concurrency << "\n"
+        << "  Write concurrency : " << write_concurrency << "\n"
+        << "  Stage concurrency : " << stage_concurrency;
+    for (const auto& [stage, limit] : stage_limits) {
+        out << "\n  Limit of " << stage << ": " << limit;
+    }
+    out << "\n"
+        << "  Output file       : " << output_file << "\n"
+        << "  Output queue depth: " << output_queue_depth;
+    return out;
+}
+
+}  // namespace traccc::opts
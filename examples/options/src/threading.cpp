@@ -20,6 +20,9 @@ threading::threading() : interface("Multi-Threading Options") {
         "cpu-threads",
         boost::program_options::value(&threads)->default_value(threads),
         "The number of CPU threads to use");
+    m_desc.add_options()(
+        "numa-aware", boost::program_options::bool_switch(&numa),
+        "Process the events in one (pinned) task arena per NUMA node");
 }
 
 void threading::read(const boost::program_options::variables_map&) {
@@ -31,7 +34,8 @@ void threading::read(const boost::program_options::variables_map&) {
 
 std::ostream& threading::print_impl(std::ostream& out) const {
 
-    out << "  CPU threads: " << threads;
+    out << "  CPU threads: " << threads << "\n"
+        << "  NUMA aware : " << (numa ? "yes" : "no");
     return out;
 }
 
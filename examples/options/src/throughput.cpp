@@ -10,12 +10,17 @@
 
 // System include(s).
 #include <iostream>
+#include <stdexcept>
+#include <string>
 
 namespace traccc::opts {
 
 /// Convenience namespace shorthand
 namespace po = boost::program_options;
 
+/// Name of the event ordering option
+static const char* event_order_option = "event-order";
+
 throughput::throughput() : interface("Throughput Measurement Options") {
 
     m_desc.add_options()(
@@ -29,13 +34,269 @@ throughput::throughput() : interface("Throughput Measurement Options") {
     m_desc.add_options()(
         "log-file", po::value(&log_file),
         "File where result logs will be printed (in append mode).");
+    m_desc.add_options()(
+        "use-graph", po::bool_switch(&use_graph),
+        "Capture and replay the device processing as a graph (if supported)");
+    m_desc.add_options()(
+        "staging-ring-size",
+        po::value(&staging_ring_size)->default_value(staging_ring_size),
+        "Number of event input staging slots per algorithm (if supported)");
+    m_desc.add_options()(
+        "use-module-table", po::bool_switch(&use_module_table),
+        "Share one table of modules between all events (if supported)");
+    m_desc.add_options()(
+        "streams-per-device",
+        po::value(&streams_per_device)->default_value(streams_per_device),
+        "Number of algorithm instances per device (0: one per thread)");
+    m_desc.add_options()(
+        "input-queue-depth",
+        po::value(&input_queue_depth)->default_value(input_queue_depth),
+        "Number of events to buffer when streaming the input (0: preload)");
+    m_desc.add_options()(
+        "input-reader-threads",
+        po::value(&input_reader_threads)->default_value(input_reader_threads),
+        "Number of threads reading the input, when streaming it");
+    m_desc.add_options()(
+        "output-file", po::value(&output_file)->default_value(output_file),
+        "File to write the reconstructed track parameters into");
+    m_desc.add_options()(
+        "output-queue-depth",
+        po::value(&output_queue_depth)->default_value(output_queue_depth),
+        "Number of events waiting to be written at once");
+    m_desc.add_options()(
+        "timing-file", po::value(&timing_file)->default_value(timing_file),
+        "File to write the per-event latency statistics into, as JSON");
+    m_desc.add_options()(
+        "summary-file", po::value(&summary_file)->default_value(summary_file),
+        "File to write the summary of the measurement into, as JSON");
+    m_desc.add_options()(
+        "metrics-file", po::value(&metrics_file)->default_value(metrics_file),
+        "File to periodically write the live metrics into (JSON if it ends "
+        "in .json, Prometheus text format otherwise)");
+    m_desc.add_options()(
+        "metrics-interval",
+        po::value(&metrics_interval)->default_value(metrics_interval),
+        "Interval of writing the live metrics [ms]");
+    m_desc.add_options()(
+        event_order_option, po::value<std::string>()->default_value("random"),
+        "Order of the processed events (random, sequential, shuffle, "
+        "by-size, largest-first, replay)");
+    m_desc.add_options()(
+        "random-seed", po::value(&random_seed)->default_value(random_seed),
+        "Seed of the random event orderings (0: based on the time)");
+    m_desc.add_options()(
+        "event-list-file",
+        po::value(&event_list_file)->default_value(event_list_file),
+        "File with the event indices to process, for the replay ordering");
+    m_desc.add_options()(
+        "event-log-file",
+        po::value(&event_log_file)->default_value(event_log_file),
+        "File to write the latency and size of every event into, as CSV");
+    m_desc.add_options()(
+        "measure-energy", po::bool_switch(&measure_energy),
+        "Measure the energy used by the CPUs/GPUs during the processing");
+    m_desc.add_options()(
+        "energy-sampling-interval",
+        po::value(&energy_sampling_interval)
+            ->default_value(energy_sampling_interval),
+        "Interval of sampling the energy counters [ms]");
+    m_desc.add_options()(
+        "launch-tuning-file",
+        po::value(&launch_tuning_file)->default_value(launch_tuning_file),
+        "File with the tuned launch parameters of the kernels (if supported)");
+    m_desc.add_options()(
+        "autotune-launches", po::bool_switch(&autotune_launches),
+        "Tune the launch parameters of the kernels on the first event, and "
+        "write them into the launch tuning file");
+    m_desc.add_options()(
+        "warm-up-algorithms", po::bool_switch(&warm_up_algorithms),
+        "Prepare every algorithm instance with the first event before the "
+        "processing (if supported)");
+    m_desc.add_options()(
+        "sweep-threads", po::value(&sweep_threads)->multitoken(),
+        "Thread counts to measure the throughput with");
+    m_desc.add_options()(
+        "sweep-streams-per-device",
+        po::value(&sweep_streams_per_device)->multitoken(),
+        "Streams per device values to measure the throughput with");
+    m_desc.add_options()(
+        "sweep-cells-per-partition",
+        po::value(&sweep_cells_per_partition)->multitoken(),
+        "Target cells per partition values to measure the throughput with");
+    m_desc.add_options()(
+        "sweep-pileup", po::value(&sweep_pileup)->multitoken(),
+        "Pileup values to measure the throughput with, overlaying the input "
+        "events");
+    m_desc.add_options()(
+        "input-pileup", po::value(&input_pileup)->default_value(input_pileup),
+        "The pileup of the input events, for the pileup sweep");
+    m_desc.add_options()(
+        "sweep-repetitions",
+        po::value(&sweep_repetitions)->default_value(sweep_repetitions),
+        "Number of measurements with each configuration of the sweep");
+    m_desc.add_options()(
+        "results-file", po::value(&results_file)->default_value(results_file),
+        "File to write the throughput sweep results into, as JSON");
+    m_desc.add_options()(
+        "baseline-file",
+        po::value(&baseline_file)->default_value(baseline_file),
+        "File with baseline sweep results, to check for regressions against");
+    m_desc.add_options()(
+        "regression-significance",
+        po::value(&regression_significance)
+            ->default_value(regression_significance),
+        "p-value below which a throughput decrease is significant");
+    m_desc.add_options()(
+        "regression-tolerance",
+        po::value(&regression_tolerance)->default_value(regression_tolerance),
+        "Relative throughput decrease tolerated without a regression");
+    m_desc.add_options()(
+        "latency-arrival-rates",
+        po::value(&latency_arrival_rates)->multitoken(),
+        "Mean (Poisson) arrival rates of the events to measure the end-to-end "
+        "latency at [Hz]");
+    m_desc.add_options()(
+        "latency-file", po::value(&latency_file)->default_value(latency_file),
+        "File to write the latencies against the load into, as CSV");
+}
+
+void throughput::read(const po::variables_map& vm) {
+
+    // Decode the event ordering.
+    if (vm.count(event_order_option)) {
+        const std::string order = vm[event_order_option].as<std::string>();
+        if (order == "random") {
+            ordering = event_ordering::random;
+        } else if (order == "sequential") {
+            ordering = event_ordering::sequential;
+        } else if (order == "shuffle") {
+            ordering = event_ordering::shuffle;
+        } else if (order == "by-size") {
+            ordering = event_ordering::by_size;
+        } else if (order == "largest-first") {
+            ordering = event_ordering::largest_first;
+        } else if (order == "replay") {
+            ordering = event_ordering::replay;
+        } else {
+            throw std::invalid_argument("Unknown event ordering");
+        }
+    }
+    if ((ordering == event_ordering::replay) && event_list_file.empty()) {
+        throw std::invalid_argument(
+            "The replay event ordering needs an event list file");
+    }
+    if (!sweep_pileup.empty() && (input_pileup == 0)) {
+        throw std::invalid_argument(
+            "The pileup sweep needs the pileup of the input events");
+    }
+    if (autotune_launches && launch_tuning_file.empty()) {
+        throw std::invalid_argument(
+            "The launch autotuning needs a launch tuning file");
+    }
+    if (!metrics_file.empty() && (metrics_interval == 0)) {
+        throw std::invalid_argument(
+            "The interval of the live metrics must be positive");
+    }
+    for (float rate : latency_arrival_rates) {
+        if (!(rate > 0.f)) {
+            throw std::invalid_argument(
+                "The arrival rates of the latency mode must be positive");
+        }
+    }
+}
+
+bool throughput::sweep() const {
+
+    return (!sweep_threads.empty() || !sweep_streams_per_device.empty() ||
+            !sweep_cells_per_partition.empty() || !sweep_pileup.empty() ||
+            !results_file.empty() || !baseline_file.empty());
+}
+
+bool throughput::latency() const {
+
+    return !latency_arrival_rates.empty();
 }
 
 std::ostream& throughput::print_impl(std::ostream& out) const {
 
     out << "  Cold run event(s) : " << cold_run_events << "\n"
         << "  Processed event(s): " << processed_events << "\n"
-        << "  Log file          : " << log_file;
+        << "  Log file          : " << log_file << "\n"
+        << "  Use graph         : " << (use_graph ? "yes" : "no") << "\n"
+        << "  Staging ring size : " << staging_ring_size << "\n"
+        << "  Use module table  : " << (use_module_table ? "yes" : "no")
+        << "\n"
+        << "  Streams per device: " << streams_per_device << "\n"
+        << "  Input queue depth : " << input_queue_depth << "\n"
+        << "  Input readers     : " << input_reader_threads << "\n"
+        << "  Output file       : " << output_file << "\n"
+        << "  Output queue depth: " << output_queue_depth << "\n"
+        << "  Timing file       : " << timing_file << "\n"
+        << "  Summary file      : " << summary_file << "\n"
+        << "  Metrics file      : " << metrics_file << "\n"
+        << "  Metrics interval  : " << metrics_interval << " ms\n"
+        << "  Event order       : ";
+    switch (ordering) {
+        case event_ordering::random:
+            out << "random";
+            break;
+        case event_ordering::sequential:
+            out << "sequential";
+            break;
+        case event_ordering::shuffle:
+            out << "shuffle";
+            break;
+        case event_ordering::by_size:
+            out << "by-size";
+            break;
+        case event_ordering::largest_first:
+            out << "largest-first";
+            break;
+        case event_ordering::replay:
+            out << "replay (" << event_list_file << ")";
+            break;
+    }
+    out << "\n"
+        << "  Random seed       : " << random_seed << "\n"
+        << "  Event log file    : " << event_log_file << "\n"
+        << "  Measure energy    : " << (measure_energy ? "yes" : "no")
+        << "\n"
+        << "  Launch tuning file: " << launch_tuning_file << "\n"
+        << "  Autotune launches : " << (autotune_launches ? "yes" : "no")
+        << "\n"
+        << "  Warm-up algorithms: " << (warm_up_algorithms ? "yes" : "no");
+    if (sweep()) {
+        auto print_values = [&out](const std::vector<unsigned int>& values) {
+            if (values.empty()) {
+                out << "default";
+            }
+            for (unsigned int value : values) {
+                out << value << " ";
+            }
+        };
+        out << "\n  Sweep threads     : ";
+        print_values(sweep_threads);
+        out << "\n  Sweep streams     : ";
+        print_values(sweep_streams_per_device);
+        out << "\n  Sweep partitions  : ";
+        print_values(sweep_cells_per_partition);
+        out << "\n  Sweep pileup      : ";
+        print_values(sweep_pileup);
+        out << "\n  Input pileup      : " << input_pileup;
+        out << "\n  Sweep repetitions : " << sweep_repetitions << "\n"
+            << "  Results file      : " << results_file << "\n"
+            << "  Baseline file     : " << baseline_file << "\n"
+            << "  Significance      : " << regression_significance << "\n"
+            << "  Tolerance         : " << regression_tolerance;
+    }
+    if (latency()) {
+        out << "\n  Arrival rates     : ";
+        for (float rate : latency_arrival_rates) {
+            out << rate << " ";
+        }
+        out << "Hz\n"
+            << "  Latency file      : " << latency_file;
+    }
     return out;
 }
 
@@ -31,13 +31,72 @@ track_finding::track_finding() : interface("Track Finding Options") {
         po::value<unsigned int>(&nmax_per_seed)->default_value(nmax_per_seed),
         "Maximum number of branches which each initial seed can have at a "
         "step.");
+    m_desc.add_options()(
+        "run-step-loop-on-device", po::bool_switch(&run_step_loop_on_device),
+        "Run the device track finding steps without host synchronisation");
+    m_desc.add_options()(
+        "min-params-for-surface-sort",
+        po::value(&min_params_for_surface_sort)
+            ->default_value(min_params_for_surface_sort),
+        "Minimum number of parameters in a device track finding step for "
+        "sorting them by surface (0 for no sorting)");
+    m_desc.add_options()(
+        "device-memory-budget-mb",
+        po::value(&device_memory_budget_mb)
+            ->default_value(device_memory_budget_mb),
+        "Memory budget of the device track finding of one event, in MB, "
+        "above which the seeds are processed in chunks (0 for no limit)");
+    m_desc.add_options()(
+        "host-params-per-task",
+        po::value(&host_params_per_task)->default_value(host_params_per_task),
+        "Number of parameters per task in the host track finding steps (0 "
+        "for serial processing)");
+    m_desc.add_options()(
+        "best-chi2-branching", po::bool_switch(&best_chi2_branching),
+        "Branch on the best chi2 measurements of every surface, instead of "
+        "the first compatible ones");
+    m_desc.add_options()(
+        "prune-shared-hits", po::bool_switch(&prune_shared_hits),
+        "Prune the branches reaching the same measurement as a better branch "
+        "in every device track finding step");
+    m_desc.add_options()(
+        "max-num-seeds",
+        po::value(&max_num_seeds)->default_value(max_num_seeds),
+        "Maximum number of seeds of one event, above which the remaining "
+        "seeds are dropped (0 for no limit)");
+    m_desc.add_options()(
+        "max-branches-in-flight",
+        po::value(&max_num_branches_in_flight)
+            ->default_value(max_num_branches_in_flight),
+        "Maximum number of branches in a device track finding step, above "
+        "which the following steps stop branching (0 for no limit)");
+    m_desc.add_options()(
+        "max-event-time-ms",
+        po::value(&max_event_time_ms)->default_value(max_event_time_ms),
+        "Wall-clock budget of the device track finding of one event, in ms, "
+        "after which its step loop is ended (0 for no limit)");
 }
 
 std::ostream& track_finding::print_impl(std::ostream& out) const {
 
     out << "  Track candidates range   : " << track_candidates_range << "\n"
         << "  Maximum Chi2             : " << chi2_max << "\n"
-        << "  Maximum branches per step: " << nmax_per_seed;
+        << "  Maximum branches per step: " << nmax_per_seed << "\n"
+        << "  Step loop on device      : "
+        << (run_step_loop_on_device ? "yes" : "no") << "\n"
+        << "  Min. params for sorting  : " << min_params_for_surface_sort
+        << "\n"
+        << "  Device memory budget     : " << device_memory_budget_mb
+        << " [MB]\n"
+        << "  Host parameters per task : " << host_params_per_task << "\n"
+        << "  Best chi2 branching      : "
+        << (best_chi2_branching ? "yes" : "no") << "\n"
+        << "  Prune shared hits        : "
+        << (prune_shared_hits ? "yes" : "no") << "\n"
+        << "  Maximum seeds            : " << max_num_seeds << "\n"
+        << "  Max. branches in flight  : " << max_num_branches_in_flight
+        << "\n"
+        << "  Event time budget        : " << max_event_time_ms << " [ms]";
     return out;
 }
 
@@ -42,6 +42,12 @@ track_propagation::track_propagation()
         "rk-tolerance",
         po::value(&(config.stepping.rk_error_tol))->default_value(1e-4),
         "The Runge-Kutta stepper tolerance");
+    m_desc.add_options()(
+        "navigation-buffer-size",
+        po::value(&navigation_buffer_size)
+            ->default_value(navigation_buffer_size),
+        "Maximum number of navigation candidate vectors of the device "
+        "propagation");
 }
 
 void track_propagation::read(const po::variables_map&) {
@@ -65,7 +71,8 @@ std::ostream& track_propagation::print_impl(std::ostream& out) const {
         << " [um]\n"
         << "  Search window        : " << config.navigation.search_window[0]
         << " x " << config.navigation.search_window[1] << "\n"
-        << "  Runge-Kutta tolerance: " << config.stepping.rk_error_tol;
+        << "  Runge-Kutta tolerance: " << config.stepping.rk_error_tol << "\n"
+        << "  Navigation buffer    : " << navigation_buffer_size;
     return out;
 }
 
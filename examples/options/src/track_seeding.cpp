@@ -8,8 +8,72 @@
 // Local include(s).
 #include "traccc/options/track_seeding.hpp"
 
+// Detray include(s).
+#include "detray/definitions/units.hpp"
+
+// System include(s).
+#include <iostream>
+
 namespace traccc::opts {
 
-track_seeding::track_seeding() : interface("Track Seeding Options") {}
+/// Convenience namespace shorthand
+namespace po = boost::program_options;
+
+track_seeding::track_seeding() : interface("Track Seeding Options") {
+
+    m_desc.add_options()(
+        "seed-roi",
+        po::value(&roi_specs)
+            ->value_name("ETA_MIN:ETA_MAX:PHI_MIN:PHI_MAX:Z_MIN:Z_MAX")
+            ->composing(),
+        "Region of interest to reconstruct, with phi in [Degree] and the "
+        "vertex Z range in [mm] (may be given multiple times)");
+    m_desc.add_options()(
+        "seed-selection", po::bool_switch(&seedselection.enabled),
+        "Remove near-duplicate seeds before the (device) track finding");
+    m_desc.add_options()(
+        "seed-selection-min-shared",
+        po::value(&seedselection.min_shared_spacepoints)
+            ->default_value(seedselection.min_shared_spacepoints),
+        "Minimum number of spacepoints shared by duplicate seeds");
+    m_desc.add_options()(
+        "seed-selection-max-per-region",
+        po::value(&seedselection.max_seeds_per_region)
+            ->default_value(seedselection.max_seeds_per_region),
+        "Maximum number of seeds per (eta, phi) region, by weight (0 for no "
+        "limit)");
+}
+
+void track_seeding::read(const po::variables_map&) {
+
+    rois.clear();
+    for (const auto& spec : roi_specs) {
+        rois.push_back({spec[0], spec[1],
+                        spec[2] * detray::unit<float>::degree,
+                        spec[3] * detray::unit<float>::degree,
+                        spec[4] * detray::unit<float>::mm,
+                        spec[5] * detray::unit<float>::mm});
+    }
+}
+
+std::ostream& track_seeding::print_impl(std::ostream& out) const {
+
+    out << "  Regions of interest            : ";
+    if (roi_specs.empty()) {
+        out << "none (full event)";
+    }
+    for (const auto& spec : roi_specs) {
+        out << "\n    " << spec;
+    }
+    out << "\n  Seed selection                 : "
+        << (seedselection.enabled ? "yes" : "no");
+    if (seedselection.enabled) {
+        out << "\n  Min. shared spacepoints        : "
+            << seedselection.min_shared_spacepoints
+            << "\n  Max. seeds per region          : "
+            << seedselection.max_seeds_per_region;
+    }
+    return out;
+}
 
 }  // namespace traccc::opts
@@ -0,0 +1,181 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Local include(s).
+#include "full_chain_algorithm.hpp"
+
+// Project include(s).
+#include "traccc/edm/measurement.hpp"
+
+// VecMem include(s).
+#include <vecmem/containers/vector.hpp>
+
+// System include(s).
+#include <algorithm>
+#include <iostream>
+
+namespace traccc::alpaka {
+
+full_chain_algorithm::full_chain_algorithm(
+    vecmem::memory_resource& host_mr,
+    const unsigned short target_cells_per_partition,
+    const seedfinder_config& finder_config,
+    const spacepoint_grid_config& grid_config,
+    const seedfilter_config& filter_config,
+    const finding_config<scalar>& track_finding_config,
+    const fitting_config<scalar>&, const host_detector_type* detector, bool,
+    bool, unsigned int, int)
+    : m_host_mr(host_mr),
+#ifdef ALPAKA_ACC_GPU_CUDA_ENABLED
+      m_device_mr(),
+      m_copy(),
+      m_mr{m_device_mr, &m_host_mr},
+#else
+      m_copy(),
+      m_mr{m_host_mr, &m_host_mr},
+#endif
+      m_detector(detector),
+      m_field(detray::bfield::create_const_field(
+          vector3{0.f, 0.f, finder_config.bFieldInZ})),
+      m_navigation_buffer_capacity(0),
+      m_target_cells_per_partition(target_cells_per_partition),
+      m_clusterization(m_mr, m_copy, m_target_cells_per_partition),
+      m_seeding(finder_config, grid_config, filter_config, m_mr, m_copy),
+      m_track_parameter_estimation(m_mr, m_copy),
+      m_finding(track_finding_config, m_mr, m_copy),
+      m_finder_config(finder_config),
+      m_grid_config(grid_config),
+      m_filter_config(filter_config),
+      m_finding_config(track_finding_config) {
+
+#ifdef ALPAKA_ACC_GPU_CUDA_ENABLED
+    std::cout << "Using Alpaka with the CUDA accelerator" << std::endl;
+#else
+    std::cout << "Using Alpaka with a host accelerator" << std::endl;
+#endif
+
+    // Copy the detector to the device.
+    setup_detector();
+}
+
+full_chain_algorithm::full_chain_algorithm(const full_chain_algorithm& parent)
+    : m_host_mr(parent.m_host_mr),
+#ifdef ALPAKA_ACC_GPU_CUDA_ENABLED
+      m_device_mr(),
+      m_copy(),
+      m_mr{m_device_mr, &m_host_mr},
+#else
+      m_copy(),
+      m_mr{m_host_mr, &m_host_mr},
+#endif
+      m_detector(parent.m_detector),
+      m_field(parent.m_field),
+      m_navigation_buffer_capacity(0),
+      m_target_cells_per_partition(parent.m_target_cells_per_partition),
+      m_clusterization(m_mr, m_copy, m_target_cells_per_partition),
+      m_seeding(parent.m_finder_config, parent.m_grid_config,
+                parent.m_filter_config, m_mr, m_copy),
+      m_track_parameter_estimation(m_mr, m_copy),
+      m_finding(parent.m_finding_config, m_mr, m_copy),
+      m_finder_config(parent.m_finder_config),
+      m_grid_config(parent.m_grid_config),
+      m_filter_config(parent.m_filter_config),
+      m_finding_config(parent.m_finding_config) {
+
+    // Copy the detector to the device.
+    setup_detector();
+}
+
+void full_chain_algorithm::setup_detector() {
+
+    // Without a detector there is nothing to do.
+    if (m_detector == nullptr) {
+        return;
+    }
+
+    // Copy the detector's payload into the main memory resource, where it
+    // stays for the lifetime of the algorithm.
+    m_device_detector = detray::get_buffer(*m_detector, m_mr.main, m_copy);
+    m_device_detector_view = detray::get_data(m_device_detector);
+}
+
+vecmem::data::jagged_vector_view<
+    full_chain_algorithm::navigator_type::intersection_type>
+full_chain_algorithm::navigation_buffer(unsigned int n_tracks) const {
+
+    // Re-allocate the buffer if it is too small. Growing its capacity
+    // geometrically, to avoid re-allocating it for every slightly larger
+    // event.
+    if (n_tracks > m_navigation_buffer_capacity) {
+        m_navigation_buffer_capacity =
+            std::max(n_tracks, 2 * m_navigation_buffer_capacity);
+        m_navigation_buffer = detray::create_candidates_buffer(
+            *m_detector, m_navigation_buffer_capacity, m_mr.main, &m_host_mr);
+        m_copy.setup(m_navigation_buffer);
+    }
+    return m_navigation_buffer;
+}
+
+full_chain_algorithm::output_type full_chain_algorithm::operator()(
+    const cell_collection_types::host& cells,
+    const cell_module_collection_types::host& modules) const {
+
+    // Create device copy of input collections
+    cell_collection_types::buffer cells_buffer(cells.size(), m_mr.main);
+    m_copy(vecmem::get_data(cells), cells_buffer);
+    cell_module_collection_types::buffer modules_buffer(modules.size(),
+                                                        m_mr.main);
+    m_copy(vecmem::get_data(modules), modules_buffer);
+
+    // Execute the algorithms.
+    const clusterization_algorithm::measurements_output_type clusters =
+        m_clusterization.run_with_measurements(cells_buffer, modules_buffer);
+    const spacepoint_collection_types::buffer& spacepoints =
+        std::get<1>(clusters);
+    const track_params_estimation::output_type track_params =
+        m_track_parameter_estimation(spacepoints, m_seeding(spacepoints),
+                                     modules_buffer,
+                                     {0.f, 0.f, m_finder_config.bFieldInZ});
+
+    // Without a Detray detector, stop at the track parameter estimation.
+    if (m_detector == nullptr) {
+
+        // Get the final data into a host container.
+        bound_track_parameters_collection_types::host result(&m_host_mr);
+        m_copy(track_params, result);
+
+        // Return the host container.
+        return result;
+    }
+
+    // The track finding expects the measurements to be ordered by surface.
+    // There is no Alpaka sorting algorithm yet, so this is done on the host.
+    vecmem::vector<measurement> measurements_host(&m_host_mr);
+    m_copy(std::get<0>(clusters), measurements_host);
+    std::sort(measurements_host.begin(), measurements_host.end(),
+              measurement_sort_comp());
+    measurement_collection_types::buffer sorted_measurements(
+        static_cast<unsigned int>(measurements_host.size()), m_mr.main);
+    m_copy.setup(sorted_measurements);
+    m_copy(vecmem::get_data(measurements_host), sorted_measurements);
+
+    // Run the track finding.
+    const unsigned int n_seeds = m_copy.get_size(track_params);
+    const finding_algorithm::output_type track_candidates = m_finding(
+        m_device_detector_view, m_field,
+        navigation_buffer(n_seeds * m_finding_config.max_num_branches_per_seed),
+        sorted_measurements, track_params);
+
+    // Collect the (seed) parameters of the track candidates on the host.
+    bound_track_parameters_collection_types::host result(&m_host_mr);
+    m_copy(track_candidates.headers, result);
+
+    // Return the host container.
+    return result;
+}
+
+}  // namespace traccc::alpaka
@@ -0,0 +1,283 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s).
+#include "traccc/alpaka/clusterization/clusterization_algorithm.hpp"
+#include "traccc/alpaka/finding/finding_algorithm.hpp"
+#include "traccc/alpaka/seeding/seeding_algorithm.hpp"
+#include "traccc/alpaka/seeding/track_params_estimation.hpp"
+#include "traccc/edm/cell.hpp"
+#include "traccc/finding/finding_config.hpp"
+#include "traccc/fitting/fitting_config.hpp"
+#include "traccc/utils/algorithm.hpp"
+#include "traccc/utils/instrumented_memory_resource.hpp"
+
+// Detray include(s).
+#include "detray/core/detector.hpp"
+#include "detray/detectors/bfield.hpp"
+#include "detray/navigation/navigator.hpp"
+#include "detray/propagator/rk_stepper.hpp"
+
+// VecMem include(s).
+#include <vecmem/containers/data/jagged_vector_buffer.hpp>
+#include <vecmem/memory/memory_resource.hpp>
+#include <vecmem/utils/copy.hpp>
+
+#ifdef ALPAKA_ACC_GPU_CUDA_ENABLED
+#include <vecmem/memory/cuda/device_memory_resource.hpp>
+#include <vecmem/utils/cuda/copy.hpp>
+#endif
+
+// System include(s).
+#include <chrono>
+#include <optional>
+#include <string>
+
+namespace traccc::alpaka {
+
+/// Algorithm performing the full chain of track reconstruction
+///
+/// At least as much as is implemented in the project at any given moment.
+///
+/// With a CUDA accelerator the intermediate objects are created in device
+/// memory, otherwise in the host memory resource received by the constructor.
+///
+class full_chain_algorithm
+    : public algorithm<bound_track_parameters_collection_types::host(
+          const cell_collection_types::host&,
+          const cell_module_collection_types::host&)> {
+
+    public:
+    /// @name Type declaration(s)
+    /// @{
+
+    /// (Host) Detector type used during track finding
+    using host_detector_type = detray::detector<detray::default_metadata,
+                                                detray::host_container_types>;
+    /// (Device) Detector type used during track finding
+    using device_detector_type =
+        detray::detector<detray::default_metadata,
+                         detray::device_container_types>;
+
+    /// Stepper type used by the track finding algorithm
+    using stepper_type =
+        detray::rk_stepper<detray::bfield::const_field_t::view_t,
+                           host_detector_type::transform3,
+                           detray::constrained_step<>>;
+    /// Navigator type used by the track finding algorithm
+    using navigator_type = detray::navigator<const device_detector_type>;
+
+    /// Track finding algorithm type
+    using finding_algorithm =
+        traccc::alpaka::finding_algorithm<stepper_type, navigator_type>;
+
+    /// @}
+
+    /// Algorithm constructor
+    ///
+    /// @param mr The memory resource to use for the intermediate and result
+    ///           objects
+    /// @param target_cells_per_partition The average number of cells in each
+    /// partition.
+    /// @param track_finding_config The configuration of the track finding
+    /// @param track_fitting_config Not used by the Alpaka algorithm (yet).
+    /// @param detector The Detray detector to run the track finding with. If
+    ///                 it is a null pointer, the chain stops after the track
+    ///                 parameter estimation.
+    /// @param run_ambiguity_resolution Not used by the Alpaka algorithm (yet).
+    /// @param use_graph Not used by the Alpaka algorithm. Allows templating
+    /// the different algorithms.
+    /// @param staging_ring_size Not used by the Alpaka algorithm.
+    /// @param device Not used by the Alpaka algorithm (yet).
+    ///
+    full_chain_algorithm(vecmem::memory_resource& host_mr,
+                         const unsigned short target_cells_per_partition,
+                         const seedfinder_config& finder_config,
+                         const spacepoint_grid_config& grid_config,
+                         const seedfilter_config& filter_config,
+                         const finding_config<scalar>& track_finding_config,
+                         const fitting_config<scalar>& track_fitting_config,
+                         const host_detector_type* detector,
+                         bool run_ambiguity_resolution,
+                         bool use_graph = false,
+                         unsigned int staging_ring_size = 0,
+                         int device = -1);
+
+    /// Copy constructor
+    ///
+    /// An explicit copy constructor is necessary because the sub-algorithms
+    /// have to refer to the copy object of the new instance.
+    ///
+    /// @param parent The parent algorithm chain to copy
+    ///
+    full_chain_algorithm(const full_chain_algorithm& parent);
+
+    /// Reconstruct track parameters in the entire detector
+    ///
+    /// @param cells The cells for every detector module in the event
+    /// @return The track parameters reconstructed. The parameters of the
+    ///         found track candidates' seeds when running with a Detray
+    ///         detector, as there is no Alpaka track fitting yet.
+    ///
+    output_type operator()(
+        const cell_collection_types::host& cells,
+        const cell_module_collection_types::host& modules) const override;
+
+    /// Prepare the processing of an upcoming event
+    ///
+    /// Does nothing for the Alpaka algorithm. Allows templating the different
+    /// algorithms.
+    ///
+    void prefetch(const cell_collection_types::host&,
+                  const cell_module_collection_types::host&) const {}
+
+    /// Use a fixed table of modules for all upcoming events
+    ///
+    /// Does nothing for this algorithm, which processes the modules of
+    /// every event as they come. Allows templating the different algorithms.
+    ///
+    void set_module_table(const cell_module_collection_types::host&) {}
+
+    /// Get the number of devices that instances of the chain can run on
+    ///
+    /// Always one for the Alpaka algorithm. Allows templating the different
+    /// algorithms.
+    ///
+    static unsigned int device_count() { return 1; }
+
+    /// Get the NUMA node closest to a device
+    ///
+    /// Always unknown for the Alpaka algorithm.
+    ///
+    static int device_numa_node(int) { return -1; }
+
+    /// Get the description of a device
+    ///
+    /// Always empty for the Alpaka algorithm.
+    ///
+    static std::string device_description(int) { return {}; }
+
+    /// Get the statistics of the device memory used by the algorithms
+    ///
+    /// Always empty for the Alpaka algorithm. Allows templating the different
+    /// algorithms.
+    ///
+    memory_statistics device_memory_statistics() const { return {}; }
+
+    /// Get the number of events processed in a degraded mode, for exceeding
+    /// the budgets of the track finding
+    ///
+    /// Always zero for the Alpaka algorithm, which does not report the budgets
+    /// of its track finding. Allows templating the different algorithms.
+    ///
+    std::size_t n_degraded_events() const { return 0; }
+
+    /// Get the device time of processing the last event
+    ///
+    /// Always empty for the Alpaka algorithm (yet). Allows templating the
+    /// different algorithms.
+    ///
+    std::optional<std::chrono::nanoseconds> device_latency() const {
+        return {};
+    }
+
+    /// Hand back a result of the algorithm, once it is no longer needed
+    ///
+    /// Does nothing for the Alpaka algorithm, which does not re-use its
+    /// results. Allows templating the different algorithms.
+    ///
+    void recycle(output_type&&) const {}
+
+    /// Launch the kernels with the block sizes of a tuning file
+    ///
+    /// Does nothing for the Alpaka algorithm, which has no tunable kernel
+    /// launches. Allows templating the different algorithms.
+    ///
+    void load_launch_tuning(const std::string&) {}
+
+    /// Tune the launch parameters of the kernels on a sample event
+    ///
+    /// Does nothing for the Alpaka algorithm, which has no tunable kernel
+    /// launches. Allows templating the different algorithms.
+    ///
+    void autotune_launches(const cell_collection_types::host&,
+                           const cell_module_collection_types::host&,
+                           const std::string&) {}
+
+    private:
+    /// Copy the detector to the device, if the chain has one
+    void setup_detector();
+
+    /// Get a navigation buffer for (at least) a given number of tracks
+    ///
+    /// @param n_tracks The number of tracks to navigate
+    /// @return A view of the navigation buffer
+    ///
+    vecmem::data::jagged_vector_view<navigator_type::intersection_type>
+    navigation_buffer(unsigned int n_tracks) const;
+
+    /// Host memory resource
+    vecmem::memory_resource& m_host_mr;
+#ifdef ALPAKA_ACC_GPU_CUDA_ENABLED
+    /// Device memory resource
+    vecmem::cuda::device_memory_resource m_device_mr;
+    /// Memory copy object
+    mutable vecmem::cuda::copy m_copy;
+#else
+    /// Memory copy object
+    mutable vecmem::copy m_copy;
+#endif
+    /// The memory resource(s) used by the sub-algorithms
+    memory_resource m_mr;
+
+    /// @name Members used for the track finding
+    /// @{
+
+    /// Host detector, used during track finding
+    const host_detector_type* m_detector;
+    /// Buffer holding the detector's payload on the device
+    host_detector_type::buffer_type m_device_detector;
+    /// View of the detector's payload on the device
+    host_detector_type::view_type m_device_detector_view;
+    /// Constant magnetic field used by the track finding
+    detray::bfield::const_field_t m_field;
+    /// Navigation buffer used by the track finding
+    mutable vecmem::data::jagged_vector_buffer<
+        navigator_type::intersection_type>
+        m_navigation_buffer;
+    /// The number of tracks that @c m_navigation_buffer can be used for
+    mutable unsigned int m_navigation_buffer_capacity;
+
+    /// @}
+
+    /// @name Sub-algorithms used by this full-chain algorithm
+    /// @{
+
+    /// The number of cells to put together in each partition.
+    unsigned short m_target_cells_per_partition;
+    /// Clusterization algorithm
+    clusterization_algorithm m_clusterization;
+    /// Seeding algorithm
+    seeding_algorithm m_seeding;
+    /// Track parameter estimation algorithm
+    track_params_estimation m_track_parameter_estimation;
+    /// Track finding algorithm
+    finding_algorithm m_finding;
+
+    /// Configs
+    seedfinder_config m_finder_config;
+    spacepoint_grid_config m_grid_config;
+    seedfilter_config m_filter_config;
+    finding_config<scalar> m_finding_config;
+
+    /// @}
+
+};  // class full_chain_algorithm
+
+}  // namespace traccc::alpaka
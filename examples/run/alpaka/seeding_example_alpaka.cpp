@@ -34,6 +34,7 @@
 #include "traccc/resolution/fitting_performance_writer.hpp"
 #include "traccc/seeding/seeding_algorithm.hpp"
 #include "traccc/seeding/track_params_estimation.hpp"
+#include "traccc/utils/trace.hpp"
 
 // Detray include(s).
 #include "detray/core/detector.hpp"
@@ -149,6 +150,9 @@ int seq_run(const traccc::opts::track_seeding& seeding_opts,
     for (unsigned int event = input_opts.skip;
          event < input_opts.events + input_opts.skip; ++event) {
 
+        // Annotate the profiler ranges with the event number.
+        TRACCC_TRACE_EVENT(event);
+
         // Instantiate host containers/collections
         traccc::io::spacepoint_reader_output sp_reader_output(mr.host);
         traccc::io::measurement_reader_output meas_reader_output(mr.host);
@@ -0,0 +1,31 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Local include(s).
+#include "../common/throughput_mt.hpp"
+
+#include "full_chain_algorithm.hpp"
+
+#ifdef ALPAKA_ACC_GPU_CUDA_ENABLED
+// VecMem include(s).
+#include <vecmem/memory/cuda/host_memory_resource.hpp>
+#endif
+
+int main(int argc, char* argv[]) {
+
+    // Execute the throughput test.
+#ifdef ALPAKA_ACC_GPU_CUDA_ENABLED
+    static const bool use_host_caching = true;
+    return traccc::throughput_mt<traccc::alpaka::full_chain_algorithm,
+                                 vecmem::cuda::host_memory_resource>(
+        "Multi-threaded Alpaka throughput tests", argc, argv,
+        use_host_caching);
+#else
+    return traccc::throughput_mt<traccc::alpaka::full_chain_algorithm>(
+        "Multi-threaded Alpaka throughput tests", argc, argv);
+#endif
+}
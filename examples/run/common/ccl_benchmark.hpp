@@ -0,0 +1,80 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s).
+#include "traccc/edm/cell.hpp"
+#include "traccc/options/clusterization.hpp"
+
+// VecMem include(s).
+#include <vecmem/memory/memory_resource.hpp>
+
+// System include(s).
+#include <cstddef>
+#include <functional>
+#include <string_view>
+#include <vector>
+
+namespace traccc {
+
+/// Function type benchmarked by @c traccc::ccl_benchmark
+///
+/// It needs to run the clusterization of one event to completion, and return
+/// the number of clusters (measurements) that it found.
+///
+using ccl_benchmark_function_type =
+    std::function<std::size_t(const cell_collection_types::host&,
+                              const cell_module_collection_types::host&)>;
+
+/// The input of one event, for @c traccc::ccl_benchmark_batch_function_type
+struct ccl_benchmark_event {
+    /// The cells of the event
+    const cell_collection_types::host& cells;
+    /// The modules of the event
+    const cell_module_collection_types::host& modules;
+};
+
+/// Function type benchmarked by @c traccc::ccl_benchmark, for algorithms
+/// that can process batches of events in a single call
+///
+/// It needs to run the clusterization of all events of the batch to
+/// completion, and return the number of clusters found in each of them.
+///
+using ccl_benchmark_batch_function_type =
+    std::function<std::vector<std::size_t>(
+        const std::vector<ccl_benchmark_event>&)>;
+
+/// Helper function running a clusterization benchmark
+///
+/// The events of the input directory are all read into memory up front,
+/// without a detector description, so that synthetic inputs (like the ones
+/// made by @c extras/ccl_generator) can be used. Every event is then
+/// processed a configurable number of times, and the throughput (in cells
+/// per second) and the per-call latency percentiles are reported. Events are
+/// processed in batches of a configurable size, in a single call of a
+/// @c traccc::ccl_benchmark_batch_function_type, or one by one by a
+/// @c traccc::ccl_benchmark_function_type. So the average time per event is
+/// reported as well.
+///
+/// @tparam MAKE_FUNCTION Callable creating the benchmarked function (of
+///         either type), from the clusterization options and a host memory
+///         resource
+/// @param description A short description of the application
+/// @param argc The count of command line arguments (from @c main(...))
+/// @param argv The command line arguments (from @c main(...))
+/// @param make_function The callable creating the benchmarked function
+/// @return The value to be returned from @c main(...)
+///
+template <typename MAKE_FUNCTION>
+int ccl_benchmark(std::string_view description, int argc, char* argv[],
+                  MAKE_FUNCTION make_function);
+
+}  // namespace traccc
+
+// Local include(s).
+#include "ccl_benchmark.ipp"
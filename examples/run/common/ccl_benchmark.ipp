@@ -0,0 +1,202 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Command line option include(s).
+#include "traccc/options/ccl_benchmark.hpp"
+#include "traccc/options/input_data.hpp"
+#include "traccc/options/program_options.hpp"
+
+// I/O include(s).
+#include "traccc/io/read_cells.hpp"
+
+// VecMem include(s).
+#include <vecmem/memory/host_memory_resource.hpp>
+
+// System include(s).
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace traccc {
+
+namespace details {
+
+/// Get a percentile of the sorted latencies
+inline double latency_percentile(const std::vector<double>& sorted,
+                                 double fraction) {
+
+    if (sorted.empty()) {
+        return 0.;
+    }
+    const std::size_t rank = static_cast<std::size_t>(
+        std::ceil(fraction * static_cast<double>(sorted.size())));
+    return sorted[std::clamp<std::size_t>(rank, 1, sorted.size()) - 1];
+}
+
+}  // namespace details
+
+template <typename MAKE_FUNCTION>
+int ccl_benchmark(std::string_view description, int argc, char* argv[],
+                  MAKE_FUNCTION make_function) {
+
+    // Program options.
+    opts::input_data input_opts;
+    opts::clusterization clusterization_opts;
+    opts::ccl_benchmark benchmark_opts;
+    opts::program_options program_opts{
+        description,
+        {input_opts, clusterization_opts, benchmark_opts},
+        argc,
+        argv};
+
+    // Memory resource used by the EDM.
+    vecmem::host_memory_resource host_mr;
+
+    // Read in all input events into memory.
+    std::vector<io::cell_reader_output> input;
+    std::size_t n_cells_per_pass = 0;
+    for (std::size_t event = input_opts.skip;
+         event < input_opts.skip + input_opts.events; ++event) {
+        io::cell_reader_output& event_input = input.emplace_back(&host_mr);
+        io::read_cells(event_input, event, input_opts.directory,
+                       input_opts.format);
+        n_cells_per_pass += event_input.cells.size();
+    }
+
+    // Set up the benchmarked function, processing batches of events.
+    ccl_benchmark_batch_function_type ccl;
+    {
+        auto func = make_function(clusterization_opts, host_mr);
+        using function_type = decltype(func);
+        if constexpr (std::is_convertible_v<
+                          function_type, ccl_benchmark_batch_function_type>) {
+            ccl = std::move(func);
+        } else {
+            ccl = [single = ccl_benchmark_function_type{std::move(func)}](
+                      const std::vector<ccl_benchmark_event>& events) {
+                std::vector<std::size_t> result;
+                result.reserve(events.size());
+                for (const ccl_benchmark_event& event : events) {
+                    result.push_back(single(event.cells, event.modules));
+                }
+                return result;
+            };
+        }
+    }
+
+    // Group the events into batches.
+    const std::size_t batch_size =
+        std::max<std::size_t>(benchmark_opts.batch_size, 1);
+    std::vector<std::vector<ccl_benchmark_event>> batches;
+    for (std::size_t event = 0; event < input.size(); ++event) {
+        if (event % batch_size == 0) {
+            batches.emplace_back();
+        }
+        batches.back().push_back({input[event].cells, input[event].modules});
+    }
+
+    // Process the events "cold" (at least once), remembering the number of
+    // clusters found in each of them.
+    std::vector<std::size_t> n_clusters(input.size(), 0);
+    const std::size_t cold_runs =
+        std::max<std::size_t>(benchmark_opts.cold_runs, 1);
+    for (std::size_t i = 0; i < cold_runs; ++i) {
+        for (std::size_t batch = 0; batch < batches.size(); ++batch) {
+            const std::vector<std::size_t> result = ccl(batches[batch]);
+            std::copy(result.begin(), result.end(),
+                      n_clusters.begin() + batch * batch_size);
+        }
+    }
+
+    // Process the events while measuring the latency of each call. Check
+    // that the results do not change from one repetition to the next.
+    std::vector<double> latencies;
+    latencies.reserve(benchmark_opts.repetitions * batches.size());
+    std::size_t n_mismatches = 0;
+    const auto start = std::chrono::steady_clock::now();
+    for (std::size_t i = 0; i < benchmark_opts.repetitions; ++i) {
+        for (std::size_t batch = 0; batch < batches.size(); ++batch) {
+            const auto batch_start = std::chrono::steady_clock::now();
+            const std::vector<std::size_t> result = ccl(batches[batch]);
+            const auto batch_end = std::chrono::steady_clock::now();
+            latencies.push_back(std::chrono::duration<double, std::milli>(
+                                    batch_end - batch_start)
+                                    .count());
+            if ((result.size() != batches[batch].size()) ||
+                !std::equal(result.begin(), result.end(),
+                            n_clusters.begin() + batch * batch_size)) {
+                ++n_mismatches;
+            }
+        }
+    }
+    const double total_seconds =
+        std::chrono::duration<double>(std::chrono::steady_clock::now() - start)
+            .count();
+
+    // Compute the statistics.
+    std::sort(latencies.begin(), latencies.end());
+    const double cells_per_second =
+        (total_seconds > 0.
+             ? static_cast<double>(n_cells_per_pass *
+                                   benchmark_opts.repetitions) /
+                   total_seconds
+             : 0.);
+    std::size_t total_clusters = 0;
+    for (std::size_t n : n_clusters) {
+        total_clusters += n;
+    }
+    const double p50 = details::latency_percentile(latencies, 0.50);
+    const double p90 = details::latency_percentile(latencies, 0.90);
+    const double p99 = details::latency_percentile(latencies, 0.99);
+    const double max = (latencies.empty() ? 0. : latencies.back());
+    const std::size_t n_processed = input.size() * benchmark_opts.repetitions;
+    const double ms_per_event =
+        (n_processed > 0
+             ? total_seconds * 1000. / static_cast<double>(n_processed)
+             : 0.);
+
+    // Print the results.
+    std::cout << "\nReport:\n"
+              << "  Events          : " << input.size() << "\n"
+              << "  Cells per pass  : " << n_cells_per_pass << "\n"
+              << "  Clusters/pass   : " << total_clusters << "\n"
+              << "  Cells/s         : " << cells_per_second << "\n"
+              << "  Events per call : " << batch_size << "\n"
+              << "  Time/event [ms] : " << ms_per_event << "\n"
+              << "  Latency p50 [ms]: " << p50 << "\n"
+              << "  Latency p90 [ms]: " << p90 << "\n"
+              << "  Latency p99 [ms]: " << p99 << "\n"
+              << "  Latency max [ms]: " << max << std::endl;
+
+    // Print results to the log file, as comma separated values.
+    if (!benchmark_opts.log_file.empty()) {
+        std::ofstream logFile(benchmark_opts.log_file, std::fstream::app);
+        logFile << "\"" << input_opts.directory << "\"," << input.size()
+                << "," << n_cells_per_pass << "," << total_clusters << ","
+                << benchmark_opts.repetitions << "," << cells_per_second
+                << "," << p50 << "," << p90 << "," << p99 << "," << max
+                << "," << batch_size << "," << ms_per_event << std::endl;
+    }
+
+    // Fail if the results were not reproducible.
+    if (n_mismatches != 0) {
+        std::cerr << "The number of clusters changed between repetitions "
+                  << n_mismatches << " time(s)!" << std::endl;
+        return EXIT_FAILURE;
+    }
+    return EXIT_SUCCESS;
+}
+
+}  // namespace traccc
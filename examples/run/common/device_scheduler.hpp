@@ -0,0 +1,134 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// System include(s).
+#include <condition_variable>
+#include <cstddef>
+#include <mutex>
+#include <vector>
+
+namespace traccc {
+
+/// Scheduler distributing events between algorithm instances on many devices
+///
+/// Algorithm instance @c i is assumed to run on device
+/// <tt>i % n_devices</tt>. Every event is given to a free instance on the
+/// device with the fewest events in flight, so that faster (or less busy)
+/// devices end up processing more events.
+///
+class device_scheduler {
+
+    public:
+    /// Constructor
+    ///
+    /// @param n_devices The number of devices to schedule events on
+    /// @param instances_per_device The number of algorithm instances on each
+    ///                             device
+    ///
+    device_scheduler(std::size_t n_devices, std::size_t instances_per_device)
+        : m_n_devices(n_devices),
+          m_in_flight(n_devices, 0),
+          m_processed(n_devices, 0),
+          m_free(n_devices) {
+
+        for (std::size_t i = 0; i < n_devices * instances_per_device; ++i) {
+            m_free[i % n_devices].push_back(i);
+        }
+    }
+
+    /// Get the algorithm instance that an event should be processed with
+    ///
+    /// Blocks until an instance becomes free, if all of them are busy.
+    ///
+    /// @return The index of the algorithm instance to use
+    ///
+    std::size_t acquire() {
+
+        std::unique_lock<std::mutex> lock{m_mutex};
+        std::size_t device = m_n_devices;
+        m_cv.wait(lock, [&]() {
+            device = least_loaded_device();
+            return device < m_n_devices;
+        });
+        const std::size_t instance = m_free[device].back();
+        m_free[device].pop_back();
+        ++(m_in_flight[device]);
+        return instance;
+    }
+
+    /// Give back an algorithm instance, after it processed an event
+    ///
+    /// @param instance The index of the algorithm instance, as returned by
+    ///                 @c acquire()
+    ///
+    void release(std::size_t instance) {
+
+        {
+            std::lock_guard<std::mutex> lock{m_mutex};
+            const std::size_t device = instance % m_n_devices;
+            m_free[device].push_back(instance);
+            --(m_in_flight[device]);
+            ++(m_processed[device]);
+        }
+        m_cv.notify_one();
+    }
+
+    /// Reset the per-device event counters
+    void reset() {
+
+        std::lock_guard<std::mutex> lock{m_mutex};
+        m_processed.assign(m_n_devices, 0);
+    }
+
+    /// Get the number of events processed on each device since the last
+    /// @c reset()
+    std::vector<std::size_t> processed_events() const {
+
+        std::lock_guard<std::mutex> lock{m_mutex};
+        return m_processed;
+    }
+
+    private:
+    /// Find the device with a free instance and the fewest events in flight
+    ///
+    /// @return The index of the device, or the number of devices if all
+    ///         instances are busy
+    ///
+    std::size_t least_loaded_device() const {
+
+        std::size_t result = m_n_devices;
+        for (std::size_t device = 0; device < m_n_devices; ++device) {
+            if (m_free[device].empty()) {
+                continue;
+            }
+            if ((result == m_n_devices) ||
+                (m_in_flight[device] < m_in_flight[result])) {
+                result = device;
+            }
+        }
+        return result;
+    }
+
+    /// The number of devices
+    std::size_t m_n_devices;
+    /// The number of events currently being processed on each device
+    std::vector<std::size_t> m_in_flight;
+    /// The number of events processed on each device
+    std::vector<std::size_t> m_processed;
+    /// The free algorithm instances of each device
+    std::vector<std::vector<std::size_t>> m_free;
+
+    /// Mutex protecting the state of the scheduler
+    mutable std::mutex m_mutex;
+    /// Condition variable signalling the release of an instance
+    std::condition_variable m_cv;
+
+};  // class device_scheduler
+
+}  // namespace traccc
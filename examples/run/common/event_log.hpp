@@ -0,0 +1,156 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// System include(s).
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <mutex>
+#include <ostream>
+#include <vector>
+
+namespace traccc {
+
+/// Thread-safe log of the latency and size of the processed events
+///
+/// Allows correlating the processing time of the events with their
+/// occupancy, and (through the replay event ordering) re-processing the
+/// slowest events.
+///
+class event_log {
+
+    public:
+    /// The clock used for the measurements
+    using clock_type = std::chrono::steady_clock;
+
+    /// Information about one processed event
+    struct entry {
+        /// The index of the input event
+        std::size_t event = 0;
+        /// The number of cells in the event
+        std::size_t cells = 0;
+        /// The number of modules in the event
+        std::size_t modules = 0;
+        /// The number of reconstructed objects in the event
+        std::size_t results = 0;
+        /// The start of the processing, relative to the start of the log
+        std::chrono::nanoseconds start{0};
+        /// The time it took to process the event
+        std::chrono::nanoseconds latency{0};
+    };
+
+    /// Forget about all events recorded so far, and restart the clock
+    void reset() {
+
+        std::lock_guard<std::mutex> lock{m_mutex};
+        m_entries.clear();
+        m_start = clock_type::now();
+    }
+
+    /// Record the processing of an event
+    ///
+    /// @param event The index of the input event
+    /// @param cells The number of cells in the event
+    /// @param modules The number of modules in the event
+    /// @param results The number of reconstructed objects in the event
+    /// @param start The start of the processing of the event
+    ///
+    void record(std::size_t event, std::size_t cells, std::size_t modules,
+                std::size_t results, clock_type::time_point start) {
+
+        using std::chrono::duration_cast;
+        using std::chrono::nanoseconds;
+        const clock_type::time_point end = clock_type::now();
+        std::lock_guard<std::mutex> lock{m_mutex};
+        m_entries.push_back({event, cells, modules, results,
+                             duration_cast<nanoseconds>(start - m_start),
+                             duration_cast<nanoseconds>(end - start)});
+    }
+
+    /// Get (a copy of) the recorded events, in the order of their start
+    std::vector<entry> entries() const {
+
+        std::vector<entry> result;
+        {
+            std::lock_guard<std::mutex> lock{m_mutex};
+            result = m_entries;
+        }
+        std::stable_sort(result.begin(), result.end(),
+                         [](const entry& a, const entry& b) {
+                             return a.start < b.start;
+                         });
+        return result;
+    }
+
+    /// Summary of how well the recorded events filled up the threads
+    struct schedule {
+        /// The time from the start of the first event to the end of the last
+        std::chrono::nanoseconds makespan{0};
+        /// The time that threads sat idle at the end, after finishing their
+        /// last event, summed over the threads
+        std::chrono::nanoseconds tail_idle{0};
+    };
+
+    /// Summarise the schedule of the recorded events
+    ///
+    /// Assumes that the threads picked up new events, without delay, for as
+    /// long as there were any left. In which case the last @c threads events
+    /// to finish are the last events of the individual threads.
+    ///
+    /// @param threads The number of threads that processed the events
+    /// @return The makespan and the tail idle time of the events
+    ///
+    schedule summarise(std::size_t threads) const {
+
+        const std::vector<entry> all = entries();
+        schedule result;
+        if (all.empty() || threads == 0) {
+            return result;
+        }
+        std::vector<std::chrono::nanoseconds> ends;
+        ends.reserve(all.size());
+        for (const entry& e : all) {
+            ends.push_back(e.start + e.latency);
+        }
+        std::sort(ends.begin(), ends.end());
+        const std::chrono::nanoseconds last = ends.back();
+        result.makespan = last - all.front().start;
+        const std::size_t n_tail = std::min(threads, ends.size());
+        for (std::size_t i = ends.size() - n_tail; i < ends.size(); ++i) {
+            result.tail_idle += last - ends[i];
+        }
+        // Threads that did not process any event were idle all along.
+        result.tail_idle += static_cast<std::chrono::nanoseconds::rep>(
+                                threads - n_tail) *
+                            result.makespan;
+        return result;
+    }
+
+    /// Write the recorded events in CSV format, in the order of their start
+    void write_csv(std::ostream& out) const {
+
+        out << "event,cells,modules,results,start_ns,latency_ns\n";
+        for (const entry& e : entries()) {
+            out << e.event << "," << e.cells << "," << e.modules << ","
+                << e.results << "," << e.start.count() << ","
+                << e.latency.count() << "\n";
+        }
+    }
+
+    private:
+    /// Mutex protecting the log
+    mutable std::mutex m_mutex;
+    /// The start of the log
+    clock_type::time_point m_start = clock_type::now();
+    /// The recorded events
+    std::vector<entry> m_entries;
+
+};  // class event_log
+
+}  // namespace traccc
@@ -0,0 +1,220 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Command line option include(s).
+#include "traccc/options/throughput.hpp"
+
+// System include(s).
+#include <algorithm>
+#include <cctype>
+#include <cstddef>
+#include <fstream>
+#include <numeric>
+#include <random>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace traccc {
+
+/// Helper choosing the (order of the) events to process in the throughput
+/// applications
+///
+/// Apart from the random ordering, every ordering is a fixed sequence of
+/// events, that successive calls to @c next() walk through, starting over
+/// once it is exhausted. With a fixed random seed, all orderings are
+/// reproducible.
+///
+/// The largest-first ordering walks through the events sequentially, but
+/// sorts every batch returned by @c next() by decreasing estimated cost. So
+/// that the expensive events of the batch are started first, and the cheap
+/// ones fill up the threads at the end of the batch.
+///
+class event_order {
+
+    public:
+    /// Constructor
+    ///
+    /// @param opts The throughput options, selecting the ordering
+    /// @param n_input_events The number of available input events
+    /// @param event_sizes The number of cells in each input event, needed
+    ///                    for the orderings by size and by cost only
+    /// @param event_modules The number of modules in each input event, used
+    ///                      (if available) by the ordering by cost
+    ///
+    event_order(const opts::throughput& opts, std::size_t n_input_events,
+                const std::vector<std::size_t>& event_sizes = {},
+                const std::vector<std::size_t>& event_modules = {})
+        : m_ordering(opts.ordering),
+          m_n_input_events(n_input_events),
+          m_seed((opts.random_seed != 0) ? opts.random_seed
+                                         : std::random_device{}()),
+          m_rng(m_seed) {
+
+        if (n_input_events == 0) {
+            throw std::invalid_argument("No input events to process");
+        }
+        switch (m_ordering) {
+            case opts::event_ordering::random:
+                break;
+            case opts::event_ordering::sequential:
+            case opts::event_ordering::shuffle:
+                m_sequence.resize(n_input_events);
+                std::iota(m_sequence.begin(), m_sequence.end(), 0u);
+                break;
+            case opts::event_ordering::by_size:
+                if (event_sizes.size() != n_input_events) {
+                    throw std::invalid_argument(
+                        "Ordering the events by size needs all of them to be "
+                        "read up front");
+                }
+                m_sequence.resize(n_input_events);
+                std::iota(m_sequence.begin(), m_sequence.end(), 0u);
+                std::stable_sort(m_sequence.begin(), m_sequence.end(),
+                                 [&event_sizes](std::size_t a, std::size_t b) {
+                                     return event_sizes[a] < event_sizes[b];
+                                 });
+                break;
+            case opts::event_ordering::largest_first:
+                if (event_sizes.size() != n_input_events) {
+                    throw std::invalid_argument(
+                        "Ordering the events by cost needs all of them to be "
+                        "read up front");
+                }
+                m_sequence.resize(n_input_events);
+                std::iota(m_sequence.begin(), m_sequence.end(), 0u);
+                m_costs.resize(n_input_events);
+                for (std::size_t i = 0; i < n_input_events; ++i) {
+                    m_costs[i] = estimated_cost(
+                        event_sizes[i], (event_modules.size() == n_input_events
+                                             ? event_modules[i]
+                                             : 0u));
+                }
+                break;
+            case opts::event_ordering::replay:
+                m_sequence = read_event_list(opts.event_list_file);
+                break;
+        }
+    }
+
+    /// Estimate the (relative) processing cost of an event
+    ///
+    /// The cost is dominated by the cells, which drive the number of
+    /// measurements, spacepoints and seeds. Every module adds a fixed
+    /// overhead on top, about that of a cell, for its partitioning and
+    /// for the sorting of its measurements.
+    ///
+    /// @param cells The number of cells in the event
+    /// @param modules The number of modules in the event
+    /// @return The estimated cost, in units of the cost of one cell
+    ///
+    static double estimated_cost(std::size_t cells, std::size_t modules) {
+        return static_cast<double>(cells) + static_cast<double>(modules);
+    }
+
+    /// The random seed used by the ordering
+    unsigned int seed() const { return m_seed; }
+
+    /// Get the next events to process
+    ///
+    /// @param n_events The number of events to get
+    /// @return The indices of the input events to process, in order
+    ///
+    std::vector<std::size_t> next(std::size_t n_events) {
+
+        std::vector<std::size_t> result(n_events);
+        if (m_ordering == opts::event_ordering::random) {
+            std::uniform_int_distribution<std::size_t> dist(
+                0u, m_n_input_events - 1u);
+            for (std::size_t& event : result) {
+                event = dist(m_rng);
+            }
+            return result;
+        }
+        for (std::size_t& event : result) {
+            if (m_position == 0 &&
+                m_ordering == opts::event_ordering::shuffle) {
+                std::shuffle(m_sequence.begin(), m_sequence.end(), m_rng);
+            }
+            event = m_sequence[m_position];
+            m_position = (m_position + 1) % m_sequence.size();
+        }
+        if (m_ordering == opts::event_ordering::largest_first) {
+            std::stable_sort(result.begin(), result.end(),
+                             [this](std::size_t a, std::size_t b) {
+                                 return m_costs[a] > m_costs[b];
+                             });
+        }
+        return result;
+    }
+
+    /// Whether the events need to be started in the order given by
+    /// @c next(), instead of being just spread over the threads
+    bool strict() const {
+        return m_ordering == opts::event_ordering::largest_first;
+    }
+
+    private:
+    /// Read the events to replay from a file
+    ///
+    /// Every line of the file is expected to start with an event index,
+    /// followed by anything after a comma or a space. Lines not starting
+    /// with a number (like the header of a CSV file) are skipped. So the
+    /// event log files of the throughput applications can be replayed
+    /// directly.
+    ///
+    std::vector<std::size_t> read_event_list(const std::string& fname) const {
+
+        std::ifstream file(fname);
+        if (!file) {
+            throw std::runtime_error("Could not open event list file: " +
+                                     fname);
+        }
+        std::vector<std::size_t> result;
+        std::string line;
+        while (std::getline(file, line)) {
+            if (line.empty() ||
+                !std::isdigit(static_cast<unsigned char>(line[0]))) {
+                continue;
+            }
+            const std::size_t event = std::stoul(line);
+            if (event >= m_n_input_events) {
+                std::ostringstream msg;
+                msg << "Event " << event << " in " << fname
+                    << " is not among the " << m_n_input_events
+                    << " input events";
+                throw std::invalid_argument(msg.str());
+            }
+            result.push_back(event);
+        }
+        if (result.empty()) {
+            throw std::invalid_argument("No events found in " + fname);
+        }
+        return result;
+    }
+
+    /// The ordering of the events
+    opts::event_ordering m_ordering;
+    /// The number of available input events
+    std::size_t m_n_input_events;
+    /// The random seed of the ordering
+    unsigned int m_seed;
+    /// Random number generator of the random orderings
+    std::mt19937 m_rng;
+    /// The (repeated) sequence of events, for the non-random orderings
+    std::vector<std::size_t> m_sequence;
+    /// The estimated costs of the input events, for the ordering by cost
+    std::vector<double> m_costs;
+    /// The position of the next event in the sequence
+    std::size_t m_position = 0;
+
+};  // class event_order
+
+}  // namespace traccc
@@ -0,0 +1,226 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s).
+#include "traccc/io/reader_edm.hpp"
+
+// VecMem include(s).
+#include <vecmem/memory/memory_resource.hpp>
+
+// System include(s).
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace traccc {
+
+/// Bounded, prefetching source of events
+///
+/// A pool of reader threads reads the requested events into a fixed number
+/// of slots, that consumers pick up, process and give back. So the memory
+/// used for the input stays proportional to the number of slots, no matter
+/// how many events are processed.
+///
+class streaming_event_source {
+
+    public:
+    /// Function reading one event into a (cleared) slot
+    using reader_type =
+        std::function<void(std::size_t event, io::cell_reader_output& out)>;
+
+    /// Constructor, starting the reader threads
+    ///
+    /// @param events The events to deliver, in order
+    /// @param queue_depth The number of events that can be buffered at once
+    /// @param n_readers The number of reader threads to use
+    /// @param reader The function reading one event
+    /// @param mr The memory resource to use for the buffered events
+    ///
+    streaming_event_source(std::vector<std::size_t> events,
+                           std::size_t queue_depth, std::size_t n_readers,
+                           reader_type reader, vecmem::memory_resource& mr)
+        : m_events(std::move(events)), m_reader(std::move(reader)) {
+
+        m_slots.reserve(queue_depth);
+        m_slot_events.resize(queue_depth, 0);
+        for (std::size_t i = 0; i < queue_depth; ++i) {
+            m_slots.emplace_back(&mr);
+            m_free.push_back(i);
+        }
+        for (std::size_t i = 0; i < n_readers; ++i) {
+            m_readers.emplace_back([this]() { read_events(); });
+        }
+    }
+
+    /// Destructor, stopping the reader threads
+    ~streaming_event_source() {
+
+        {
+            std::lock_guard<std::mutex> lock{m_mutex};
+            m_stop = true;
+        }
+        m_free_cv.notify_all();
+        for (std::thread& reader : m_readers) {
+            reader.join();
+        }
+    }
+
+    /// Get the next event to process
+    ///
+    /// Blocks until an event is read, measuring the time spent waiting as an
+    /// input stall.
+    ///
+    /// @return The index of the slot holding the event, or nothing if all
+    ///         events were delivered already
+    ///
+    std::optional<std::size_t> pop() {
+
+        const auto start = std::chrono::steady_clock::now();
+        std::unique_lock<std::mutex> lock{m_mutex};
+        m_ready_cv.wait(lock, [this]() {
+            return (!m_ready.empty()) ||
+                   (m_delivered + m_ready.size() == m_events.size()) ||
+                   m_error;
+        });
+        m_stall_time += std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now() - start);
+        if (m_error) {
+            std::rethrow_exception(m_error);
+        }
+        if (m_ready.empty()) {
+            return {};
+        }
+        const std::size_t slot = m_ready.front();
+        m_ready.pop_front();
+        ++m_delivered;
+        return slot;
+    }
+
+    /// Access the event in a given slot
+    const io::cell_reader_output& at(std::size_t slot) const {
+        return m_slots.at(slot);
+    }
+
+    /// Get the index of the event in a given slot
+    std::size_t event(std::size_t slot) const { return m_slot_events.at(slot); }
+
+    /// Give back a slot, after processing the event in it
+    void release(std::size_t slot) {
+
+        {
+            std::lock_guard<std::mutex> lock{m_mutex};
+            m_free.push_back(slot);
+        }
+        m_free_cv.notify_one();
+    }
+
+    /// Get the total time that consumers spent waiting for events
+    std::chrono::nanoseconds stall_time() const {
+
+        std::lock_guard<std::mutex> lock{m_mutex};
+        return m_stall_time;
+    }
+
+    /// Get the number of events read, but not picked up for processing yet
+    std::size_t buffered() const {
+
+        std::lock_guard<std::mutex> lock{m_mutex};
+        return m_ready.size();
+    }
+
+    private:
+    /// Function run by the reader threads
+    void read_events() {
+
+        while (true) {
+
+            // Get a free slot, and the next event to read into it.
+            std::size_t slot = 0, event_index = 0;
+            {
+                std::unique_lock<std::mutex> lock{m_mutex};
+                m_free_cv.wait(lock, [this]() {
+                    return (!m_free.empty()) || m_stop ||
+                           (m_next_event == m_events.size());
+                });
+                if (m_stop || (m_next_event == m_events.size())) {
+                    return;
+                }
+                slot = m_free.front();
+                m_free.pop_front();
+                event_index = m_next_event++;
+            }
+
+            // Read the event.
+            try {
+                io::cell_reader_output& out = m_slots[slot];
+                m_slot_events[slot] = m_events[event_index];
+                out.cells.clear();
+                out.modules.clear();
+                m_reader(m_events[event_index], out);
+            } catch (...) {
+                std::lock_guard<std::mutex> lock{m_mutex};
+                m_error = std::current_exception();
+                m_ready_cv.notify_all();
+                return;
+            }
+
+            // Hand it to the consumers.
+            {
+                std::lock_guard<std::mutex> lock{m_mutex};
+                m_ready.push_back(slot);
+            }
+            m_ready_cv.notify_all();
+        }
+    }
+
+    /// The events to deliver
+    std::vector<std::size_t> m_events;
+    /// The function reading one event
+    reader_type m_reader;
+    /// The slots holding the buffered events
+    std::vector<io::cell_reader_output> m_slots;
+    /// The index of the event held by every slot
+    std::vector<std::size_t> m_slot_events;
+
+    /// Slots that readers can read events into
+    std::deque<std::size_t> m_free;
+    /// Slots holding events, ready for processing
+    std::deque<std::size_t> m_ready;
+    /// The index of the next event to read
+    std::size_t m_next_event = 0;
+    /// The number of events handed to consumers so far
+    std::size_t m_delivered = 0;
+    /// Time spent by the consumers waiting for events
+    std::chrono::nanoseconds m_stall_time{0};
+    /// Flag telling the readers to stop
+    bool m_stop = false;
+    /// Exception thrown by one of the readers
+    std::exception_ptr m_error;
+
+    /// Mutex protecting the state of the source
+    mutable std::mutex m_mutex;
+    /// Condition variable signalling a newly freed slot
+    std::condition_variable m_free_cv;
+    /// Condition variable signalling a newly read event
+    std::condition_variable m_ready_cv;
+
+    /// The reader threads
+    std::vector<std::thread> m_readers;
+
+};  // class streaming_event_source
+
+}  // namespace traccc
@@ -0,0 +1,178 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// System include(s).
+#include <array>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <mutex>
+#include <vector>
+
+namespace traccc {
+
+/// Scheduler sharing events between host and device algorithm instances
+///
+/// Every event is given to a free instance of its preferred backend: the
+/// device for events with at least a threshold number of cells, the host
+/// for smaller ones. If all instances of the preferred backend are busy, a
+/// free instance of the other backend "steals" the event. Except that the
+/// host only steals events up to a maximal size, as a very large event
+/// could keep a host instance busy for much longer than it would have had
+/// to wait for a device.
+///
+class hybrid_scheduler {
+
+    public:
+    /// The backends that events can be processed on
+    enum class backend : std::size_t { host = 0, device = 1 };
+
+    /// The algorithm instance that an event got assigned to
+    struct assignment {
+        /// The backend of the instance
+        backend where;
+        /// The index of the instance among the instances of its backend
+        std::size_t instance;
+    };
+
+    /// Statistics of the events processed on one backend
+    struct statistics {
+        /// The number of events processed
+        std::size_t events = 0;
+        /// The number of cells processed
+        std::size_t cells = 0;
+        /// The number of events taken over from the other backend
+        std::size_t stolen = 0;
+        /// The total time that the backend's instances were busy
+        std::chrono::nanoseconds busy{0};
+    };
+
+    /// Constructor
+    ///
+    /// @param host_instances The number of host algorithm instances
+    /// @param device_instances The number of device algorithm instances
+    /// @param size_threshold The number of cells from which an event is
+    ///                       preferably processed on the device
+    /// @param host_max_cells The maximal number of cells of the events that
+    ///                       the host steals from the device (0: no limit)
+    ///
+    hybrid_scheduler(std::size_t host_instances, std::size_t device_instances,
+                     std::size_t size_threshold, std::size_t host_max_cells)
+        : m_size_threshold(size_threshold), m_host_max_cells(host_max_cells) {
+
+        for (std::size_t i = 0; i < host_instances; ++i) {
+            m_free[index(backend::host)].push_back(i);
+        }
+        for (std::size_t i = 0; i < device_instances; ++i) {
+            m_free[index(backend::device)].push_back(i);
+        }
+        m_has_device = (device_instances > 0);
+    }
+
+    /// Get the algorithm instance that an event should be processed with
+    ///
+    /// Blocks until a suitable instance becomes free, if all of them are
+    /// busy.
+    ///
+    /// @param cells The number of cells in the event
+    /// @return The algorithm instance to use
+    ///
+    assignment acquire(std::size_t cells) {
+
+        std::unique_lock<std::mutex> lock{m_mutex};
+        const backend preferred =
+            (cells >= m_size_threshold) ? backend::device : backend::host;
+        const backend other =
+            (preferred == backend::host) ? backend::device : backend::host;
+        backend chosen = preferred;
+        m_cv.wait(lock, [&]() {
+            if (!m_free[index(preferred)].empty()) {
+                chosen = preferred;
+                return true;
+            }
+            if (!m_free[index(other)].empty() && may_run(other, cells)) {
+                chosen = other;
+                return true;
+            }
+            return false;
+        });
+        const std::size_t instance = m_free[index(chosen)].back();
+        m_free[index(chosen)].pop_back();
+        if (chosen != preferred) {
+            ++(m_stats[index(chosen)].stolen);
+        }
+        return {chosen, instance};
+    }
+
+    /// Give back an algorithm instance, after it processed an event
+    ///
+    /// @param assigned The instance, as returned by @c acquire()
+    /// @param cells The number of cells in the processed event
+    /// @param busy The time it took to process the event
+    ///
+    void release(const assignment& assigned, std::size_t cells,
+                 std::chrono::nanoseconds busy) {
+
+        {
+            std::lock_guard<std::mutex> lock{m_mutex};
+            m_free[index(assigned.where)].push_back(assigned.instance);
+            statistics& stats = m_stats[index(assigned.where)];
+            ++(stats.events);
+            stats.cells += cells;
+            stats.busy += busy;
+        }
+        // Any waiting event may be able to use the freed instance.
+        m_cv.notify_all();
+    }
+
+    /// Reset the per-backend statistics
+    void reset() {
+
+        std::lock_guard<std::mutex> lock{m_mutex};
+        m_stats = {};
+    }
+
+    /// Get the statistics of a backend since the last @c reset()
+    statistics stats(backend where) const {
+
+        std::lock_guard<std::mutex> lock{m_mutex};
+        return m_stats[index(where)];
+    }
+
+    private:
+    /// Convert a backend into an array index
+    static constexpr std::size_t index(backend where) {
+        return static_cast<std::size_t>(where);
+    }
+
+    /// Check whether a backend may take over an event from the other one
+    bool may_run(backend where, std::size_t cells) const {
+        return ((where == backend::device) || (m_host_max_cells == 0) ||
+                (cells <= m_host_max_cells) || (!m_has_device));
+    }
+
+    /// The number of cells from which the device is preferred
+    std::size_t m_size_threshold;
+    /// The largest event that the host can steal from the device
+    std::size_t m_host_max_cells;
+    /// Whether there are any device instances
+    bool m_has_device = false;
+    /// The free algorithm instances of each backend
+    std::array<std::vector<std::size_t>, 2> m_free;
+    /// The statistics of each backend
+    std::array<statistics, 2> m_stats;
+
+    /// Mutex protecting the state of the scheduler
+    mutable std::mutex m_mutex;
+    /// Condition variable signalling the release of an instance
+    std::condition_variable m_cv;
+
+};  // class hybrid_scheduler
+
+}  // namespace traccc
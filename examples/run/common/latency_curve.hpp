@@ -0,0 +1,193 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Performance measurement include(s).
+#include "traccc/performance/timing_registry.hpp"
+
+// System include(s).
+#include <chrono>
+#include <cstddef>
+#include <iomanip>
+#include <ios>
+#include <optional>
+#include <ostream>
+#include <random>
+#include <utility>
+#include <vector>
+
+namespace traccc {
+
+/// End-to-end latency of the events against the load of the processing
+///
+/// The events "arrive" at the times of a Poisson process of a given mean
+/// rate, independently of how fast they are processed (open loop). So an
+/// event arriving while an earlier one is still processed waits for its
+/// turn, and the measured latency includes this queueing delay. (Unlike in
+/// a closed loop, where a slow event just delays the start of the next
+/// measurement.)
+///
+/// The latency of an event is the time from its arrival to the time its
+/// results were on the host. When the algorithm provides device timestamps
+/// for the span of an event from the start of its upload to the end of the
+/// copy of its results, the latency is the queueing delay (on the host
+/// clock) plus that span. Otherwise it is taken from the host clock alone,
+/// which includes the time of the host noticing that the results arrived.
+///
+class latency_curve {
+
+    public:
+    /// The clock used for the arrival times
+    using clock_type = std::chrono::steady_clock;
+
+    /// Get the arrival times of a number of events
+    ///
+    /// @param rate The mean arrival rate of the events, in Hz
+    /// @param n_events The number of events to get the arrival times of
+    /// @param seed The seed of the random arrival times
+    /// @return The arrival times, relative to the start of the measurement
+    ///
+    static std::vector<std::chrono::nanoseconds> arrival_times(
+        double rate, std::size_t n_events, unsigned int seed) {
+
+        std::mt19937_64 rng{seed};
+        std::exponential_distribution<double> gap{rate};
+        std::vector<std::chrono::nanoseconds> result;
+        result.reserve(n_events);
+        double time = 0.;
+        for (std::size_t i = 0; i < n_events; ++i) {
+            time += gap(rng);
+            result.push_back(
+                std::chrono::duration_cast<std::chrono::nanoseconds>(
+                    std::chrono::duration<double>(time)));
+        }
+        return result;
+    }
+
+    /// The latencies of the events processed at one arrival rate
+    struct point {
+
+        /// The mean arrival rate of the events, in Hz
+        double offered_rate = 0.;
+        /// The rate that the events were processed at, in Hz
+        double achieved_rate = 0.;
+        /// The end-to-end latencies of the events
+        performance::latency_histogram latencies;
+        /// The times that the events waited for the earlier ones
+        performance::latency_histogram queueing;
+        /// The latencies of the events on the host clock alone
+        performance::latency_histogram host_latencies;
+        /// The number of events whose latency used device timestamps
+        std::size_t device_timestamped = 0;
+
+        /// Record the processing of an event
+        ///
+        /// @param arrival The arrival time of the event
+        /// @param start The time the processing of the event started
+        /// @param end The time the algorithm returned the results
+        /// @param device_span The time from the start of the upload of the
+        ///                    event to the end of the copy of its results,
+        ///                    measured on the device, if available
+        ///
+        void record(clock_type::time_point arrival,
+                    clock_type::time_point start, clock_type::time_point end,
+                    std::optional<std::chrono::nanoseconds> device_span) {
+
+            using std::chrono::duration_cast;
+            using std::chrono::nanoseconds;
+            const nanoseconds wait =
+                duration_cast<nanoseconds>(start - arrival);
+            const nanoseconds host =
+                duration_cast<nanoseconds>(end - arrival);
+            queueing.add(wait);
+            host_latencies.add(host);
+            if (device_span) {
+                latencies.add(wait + *device_span);
+                ++device_timestamped;
+            } else {
+                latencies.add(host);
+            }
+        }
+    };
+
+    /// Add the measurement at one arrival rate
+    void add(point p) { m_points.push_back(std::move(p)); }
+
+    /// Get the measurements, in the order they were made
+    const std::vector<point>& points() const { return m_points; }
+
+    /// Print the latencies against the load
+    ///
+    /// @param out The stream to print to
+    /// @param saturation_rate The (closed loop) throughput of the algorithm,
+    ///                        that the load is expressed relative to
+    ///
+    void print(std::ostream& out, double saturation_rate) const {
+
+        const std::ios_base::fmtflags flags = out.flags();
+        const std::streamsize precision = out.precision();
+        out << std::fixed << std::setprecision(2);
+        for (const point& p : m_points) {
+            out << "  " << p.offered_rate << " Hz (load "
+                << load(p, saturation_rate) << "): achieved "
+                << p.achieved_rate << " Hz, latency p50 "
+                << to_ms(p.latencies.quantile(0.5)) << " ms, p90 "
+                << to_ms(p.latencies.quantile(0.9)) << " ms, p99 "
+                << to_ms(p.latencies.quantile(0.99)) << " ms, max "
+                << to_ms(p.latencies.max()) << " ms, mean queueing "
+                << to_ms(p.queueing.mean()) << " ms ("
+                << p.device_timestamped << "/" << p.latencies.count()
+                << " device timestamped)\n";
+        }
+        out.flags(flags);
+        out.precision(precision);
+    }
+
+    /// Write the latencies against the load in CSV format
+    ///
+    /// @param out The stream to write to
+    /// @param saturation_rate The (closed loop) throughput of the algorithm,
+    ///                        that the load is expressed relative to
+    ///
+    void write_csv(std::ostream& out, double saturation_rate) const {
+
+        out << "offered_rate_hz,load,achieved_rate_hz,events,"
+               "device_timestamped,mean_ns,p50_ns,p90_ns,p99_ns,max_ns,"
+               "queueing_mean_ns,queueing_p99_ns,host_p50_ns,host_p99_ns\n";
+        for (const point& p : m_points) {
+            out << p.offered_rate << "," << load(p, saturation_rate) << ","
+                << p.achieved_rate << "," << p.latencies.count() << ","
+                << p.device_timestamped << ","
+                << p.latencies.mean().count() << ","
+                << p.latencies.quantile(0.5).count() << ","
+                << p.latencies.quantile(0.9).count() << ","
+                << p.latencies.quantile(0.99).count() << ","
+                << p.latencies.max().count() << ","
+                << p.queueing.mean().count() << ","
+                << p.queueing.quantile(0.99).count() << ","
+                << p.host_latencies.quantile(0.5).count() << ","
+                << p.host_latencies.quantile(0.99).count() << "\n";
+        }
+    }
+
+    private:
+    /// Get the load of a measurement, relative to the saturation throughput
+    static double load(const point& p, double saturation_rate) {
+        return (saturation_rate > 0. ? p.offered_rate / saturation_rate : 0.);
+    }
+    /// Convert a time to milliseconds
+    static double to_ms(std::chrono::nanoseconds time) {
+        return std::chrono::duration<double, std::milli>(time).count();
+    }
+
+    /// The measurements at the different arrival rates
+    std::vector<point> m_points;
+
+};  // class latency_curve
+
+}  // namespace traccc
@@ -0,0 +1,132 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// TBB include(s).
+#include <tbb/info.h>
+#include <tbb/task_arena.h>
+#include <tbb/task_group.h>
+
+// System include(s).
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace traccc {
+
+/// Set of task arenas, one pinned to each NUMA node of the host
+///
+/// The processing threads are shared out evenly between the nodes. Work
+/// submitted to one of the arenas only runs on the cores of its node, so the
+/// memory that it touches first (following the usual first-touch policy of
+/// the OS) is placed on that node.
+///
+class numa_arenas {
+
+    public:
+    /// Check whether the host has multiple NUMA nodes (that TBB knows about)
+    static bool available() {
+        const std::vector<tbb::numa_node_id> nodes = tbb::info::numa_nodes();
+        return ((nodes.size() > 1) && (nodes.front() >= 0));
+    }
+
+    /// Constructor
+    ///
+    /// @param n_threads The total number of processing threads
+    ///
+    explicit numa_arenas(std::size_t n_threads) {
+
+        const std::vector<tbb::numa_node_id> nodes = tbb::info::numa_nodes();
+        const std::size_t n_nodes = std::min(nodes.size(), n_threads);
+        std::size_t first_thread = 0;
+        for (std::size_t i = 0; i < n_nodes; ++i) {
+            node_arena& na = m_arenas.emplace_back();
+            na.node = nodes[i];
+            na.threads =
+                n_threads / n_nodes + ((i < (n_threads % n_nodes)) ? 1 : 0);
+            na.first_thread = first_thread;
+            first_thread += na.threads;
+            tbb::task_arena::constraints constraints{na.node,
+                                                     static_cast<int>(
+                                                         na.threads)};
+            na.arena = std::make_unique<tbb::task_arena>(constraints, 0);
+            na.group = std::make_unique<tbb::task_group>();
+        }
+    }
+
+    /// The number of arenas (NUMA nodes used)
+    std::size_t size() const { return m_arenas.size(); }
+
+    /// The NUMA node of an arena
+    tbb::numa_node_id node(std::size_t i) const { return m_arenas.at(i).node; }
+    /// The number of threads of an arena
+    std::size_t threads(std::size_t i) const { return m_arenas.at(i).threads; }
+    /// The index of the first thread of an arena, among all threads
+    std::size_t first_thread(std::size_t i) const {
+        return m_arenas.at(i).first_thread;
+    }
+
+    /// Find the arena of a NUMA node
+    ///
+    /// @param node The NUMA node (as reported by the OS), or -1 if unknown
+    /// @return The index of the arena pinned to that node, or @c size() if
+    ///         there is no such arena
+    ///
+    std::size_t find(int node) const {
+        for (std::size_t i = 0; i < m_arenas.size(); ++i) {
+            if (m_arenas[i].node == node) {
+                return i;
+            }
+        }
+        return m_arenas.size();
+    }
+
+    /// Execute a function (synchronously) in one of the arenas
+    template <typename FUNC>
+    auto execute(std::size_t i, FUNC&& func) {
+        return m_arenas.at(i).arena->execute(std::forward<FUNC>(func));
+    }
+
+    /// Launch a task in one of the arenas
+    template <typename FUNC>
+    void run(std::size_t i, FUNC&& func) {
+        node_arena& na = m_arenas.at(i);
+        na.arena->execute(
+            [&na, &func]() { na.group->run(std::forward<FUNC>(func)); });
+    }
+
+    /// Wait for all tasks launched in all arenas to finish
+    void wait() {
+        for (node_arena& na : m_arenas) {
+            na.arena->execute([&na]() { na.group->wait(); });
+        }
+    }
+
+    private:
+    /// The arena (and task group) of one NUMA node
+    struct node_arena {
+        /// The NUMA node
+        tbb::numa_node_id node = -1;
+        /// The number of threads
+        std::size_t threads = 0;
+        /// The index of the first thread, among all threads
+        std::size_t first_thread = 0;
+        /// The arena pinned to the node
+        std::unique_ptr<tbb::task_arena> arena;
+        /// The task group of the tasks running in the arena
+        std::unique_ptr<tbb::task_group> group;
+    };
+
+    /// The arenas of the NUMA nodes
+    std::vector<node_arena> m_arenas;
+
+};  // class numa_arenas
+
+}  // namespace traccc
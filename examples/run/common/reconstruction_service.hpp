@@ -0,0 +1,187 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s).
+#include "traccc/edm/cell.hpp"
+#include "traccc/finding/finding_config.hpp"
+#include "traccc/fitting/fitting_config.hpp"
+#include "traccc/seeding/detail/seeding_config.hpp"
+
+// VecMem include(s).
+#include <vecmem/memory/memory_resource.hpp>
+
+// System include(s).
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace traccc {
+
+/// Service reconstructing events on a pool of full chain instances
+///
+/// Meant for embedding the reconstruction into another framework, like a
+/// trigger. The detector is read, and the full chain algorithms are set up,
+/// once in the constructor. After that, events can be submitted from any
+/// number of threads. Every worker thread of the service owns one instance of
+/// the full chain (on one device, for the device backends), and picks up the
+/// submitted events in order.
+///
+/// The configuration can be replaced while the service is running. The new
+/// context (detector and algorithms) is set up in the calling thread, and
+/// the workers switch to it with their next event. The events that were
+/// started already finish with the old context, which is released once its
+/// last event is done. So for a while, both contexts occupy (device) memory.
+///
+/// @tparam FULL_CHAIN_ALG The type of the full chain algorithm to use
+///
+template <typename FULL_CHAIN_ALG>
+class reconstruction_service {
+
+    public:
+    /// The result of reconstructing one event
+    using result_type = typename FULL_CHAIN_ALG::output_type;
+
+    /// Configuration of the service
+    struct config {
+        /// @name Detector description, relative to the data directory
+        /// @{
+
+        /// The Detray detector file. Without it, the chain stops at the
+        /// track parameter estimation.
+        std::string detector_file;
+        /// The (optional) material file of the detector
+        std::string material_file;
+        /// The (optional) surface grid file of the detector
+        std::string grid_file;
+
+        /// @}
+
+        /// @name Configuration of the reconstruction
+        /// @{
+
+        /// The average number of cells in each clusterization partition
+        unsigned short target_cells_per_partition = 1024;
+        /// The seed finding configuration
+        seedfinder_config seedfinder;
+        /// The seed filtering configuration
+        seedfilter_config seedfilter;
+        /// The track finding configuration
+        finding_config<scalar> track_finding;
+        /// The track fitting configuration
+        fitting_config<scalar> track_fitting;
+        /// Whether to run the ambiguity resolution on the fitted tracks
+        bool run_ambiguity_resolution = false;
+
+        /// @}
+
+        /// @name Configuration of the worker pool
+        /// @{
+
+        /// The number of worker threads (and full chain instances)
+        unsigned int n_workers = 1u;
+        /// Whether to spread the instances over all visible devices,
+        /// instead of using the default device
+        bool use_all_devices = false;
+
+        /// @}
+    };
+
+    /// The input of one event
+    struct event {
+        /// The cells of the event
+        cell_collection_types::host cells;
+        /// The modules that the cells link to
+        cell_module_collection_types::host modules;
+    };
+
+    /// Constructor, setting up the context and starting the workers
+    ///
+    /// @param cfg The configuration of the service
+    /// @param host_mr The host memory resource for the algorithms and their
+    ///                results. It is used by the workers at the same time,
+    ///                so it needs to be thread safe, and it needs to outlive
+    ///                the results returned by the service.
+    ///
+    reconstruction_service(const config& cfg,
+                           vecmem::memory_resource& host_mr);
+
+    /// Destructor, finishing the submitted events and stopping the workers
+    ~reconstruction_service();
+
+    /// The service can not be copied
+    reconstruction_service(const reconstruction_service&) = delete;
+    /// The service can not be copied
+    reconstruction_service& operator=(const reconstruction_service&) = delete;
+
+    /// Submit an event for reconstruction
+    ///
+    /// Can be called concurrently from multiple threads.
+    ///
+    /// @param evt The input of the event. The service keeps it until the
+    ///            event is done.
+    /// @return The future result of the event. It holds the exception of
+    ///         the reconstruction if that failed.
+    ///
+    std::future<result_type> submit(event evt);
+
+    /// Replace the configuration of the service
+    ///
+    /// Reads the detector and sets up the algorithms of the new
+    /// configuration, without interrupting the processing of the events.
+    /// The size of the worker pool is kept.
+    ///
+    /// @param cfg The new configuration of the service
+    ///
+    void reconfigure(const config& cfg);
+
+    /// The number of events submitted, but not yet started
+    std::size_t n_queued() const;
+
+    private:
+    /// The immutable context of one configuration
+    struct context;
+    /// One submitted event
+    struct job;
+
+    /// Set up the context of a configuration, for a number of workers
+    std::shared_ptr<const context> make_context(const config& cfg,
+                                                unsigned int n_workers) const;
+
+    /// The function run by the worker threads
+    void work(unsigned int index);
+
+    /// The host memory resource to use
+    vecmem::memory_resource& m_host_mr;
+
+    /// Mutex protecting the members below
+    mutable std::mutex m_mutex;
+    /// Condition signalling new events (and the stop of the service)
+    std::condition_variable m_cv;
+    /// The current context, used for the events started from now on
+    std::shared_ptr<const context> m_context;
+    /// The submitted events, not yet started
+    std::deque<job> m_queue;
+    /// Whether the service is being stopped
+    bool m_stop = false;
+
+    /// The worker threads
+    std::vector<std::thread> m_workers;
+
+};  // class reconstruction_service
+
+}  // namespace traccc
+
+// Local include(s).
+#include "reconstruction_service.ipp"
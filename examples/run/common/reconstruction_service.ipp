@@ -0,0 +1,199 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// I/O include(s).
+#include "traccc/io/utils.hpp"
+
+// Detray include(s).
+#include "detray/io/frontend/detector_reader.hpp"
+
+// System include(s).
+#include <algorithm>
+#include <exception>
+#include <optional>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+namespace traccc {
+
+template <typename FULL_CHAIN_ALG>
+struct reconstruction_service<FULL_CHAIN_ALG>::context {
+
+    /// Constructor
+    context(const config& c, vecmem::memory_resource& mr)
+        : cfg(c), detector(mr) {}
+
+    /// The configuration of the context
+    config cfg;
+    /// The detector of the configuration (if any)
+    typename FULL_CHAIN_ALG::host_detector_type detector;
+    /// The algorithm instances of the workers, declared after the detector
+    /// that they refer to
+    std::vector<std::unique_ptr<FULL_CHAIN_ALG>> algs;
+
+};  // struct reconstruction_service::context
+
+template <typename FULL_CHAIN_ALG>
+struct reconstruction_service<FULL_CHAIN_ALG>::job {
+
+    /// The input of the event
+    event evt;
+    /// The promise of the result of the event
+    std::promise<result_type> result;
+
+};  // struct reconstruction_service::job
+
+template <typename FULL_CHAIN_ALG>
+reconstruction_service<FULL_CHAIN_ALG>::reconstruction_service(
+    const config& cfg, vecmem::memory_resource& host_mr)
+    : m_host_mr(host_mr) {
+
+    if (cfg.n_workers == 0u) {
+        throw std::invalid_argument(
+            "The reconstruction service needs at least one worker");
+    }
+    m_context = make_context(cfg, cfg.n_workers);
+    m_workers.reserve(cfg.n_workers);
+    for (unsigned int i = 0; i < cfg.n_workers; ++i) {
+        m_workers.emplace_back([this, i]() { work(i); });
+    }
+}
+
+template <typename FULL_CHAIN_ALG>
+reconstruction_service<FULL_CHAIN_ALG>::~reconstruction_service() {
+
+    {
+        std::lock_guard lock(m_mutex);
+        m_stop = true;
+    }
+    m_cv.notify_all();
+    for (std::thread& worker : m_workers) {
+        worker.join();
+    }
+}
+
+template <typename FULL_CHAIN_ALG>
+auto reconstruction_service<FULL_CHAIN_ALG>::submit(event evt)
+    -> std::future<result_type> {
+
+    job j{std::move(evt), {}};
+    std::future<result_type> result = j.result.get_future();
+    {
+        std::lock_guard lock(m_mutex);
+        if (m_stop) {
+            throw std::logic_error("The reconstruction service is stopping");
+        }
+        m_queue.push_back(std::move(j));
+    }
+    m_cv.notify_one();
+    return result;
+}
+
+template <typename FULL_CHAIN_ALG>
+void reconstruction_service<FULL_CHAIN_ALG>::reconfigure(const config& cfg) {
+
+    // Set up the new context outside of the lock, so that the workers keep
+    // processing events in the meantime.
+    std::shared_ptr<const context> ctx =
+        make_context(cfg, static_cast<unsigned int>(m_workers.size()));
+    std::lock_guard lock(m_mutex);
+    m_context = std::move(ctx);
+}
+
+template <typename FULL_CHAIN_ALG>
+std::size_t reconstruction_service<FULL_CHAIN_ALG>::n_queued() const {
+
+    std::lock_guard lock(m_mutex);
+    return m_queue.size();
+}
+
+template <typename FULL_CHAIN_ALG>
+auto reconstruction_service<FULL_CHAIN_ALG>::make_context(
+    const config& cfg, unsigned int n_workers) const
+    -> std::shared_ptr<const context> {
+
+    auto result = std::make_shared<context>(cfg, m_host_mr);
+
+    // Read the detector, if one was configured.
+    if (!cfg.detector_file.empty()) {
+        detray::io::detector_reader_config reader_cfg;
+        reader_cfg.add_file(io::data_directory() + cfg.detector_file);
+        if (!cfg.material_file.empty()) {
+            reader_cfg.add_file(io::data_directory() + cfg.material_file);
+        }
+        if (!cfg.grid_file.empty()) {
+            reader_cfg.add_file(io::data_directory() + cfg.grid_file);
+        }
+        auto det = detray::io::read_detector<
+            typename FULL_CHAIN_ALG::host_detector_type>(m_host_mr,
+                                                         reader_cfg);
+        result->detector = std::move(det.first);
+    }
+
+    // Set up the algorithm instances. Algorithms that can be cloned are only
+    // set up fully once per device, with the other instances sharing the
+    // (immutable) state of those prototypes.
+    const unsigned int n_devices =
+        cfg.use_all_devices ? std::max(FULL_CHAIN_ALG::device_count(), 1u)
+                            : 1u;
+    constexpr bool cloneable =
+        std::is_constructible_v<FULL_CHAIN_ALG, const FULL_CHAIN_ALG&,
+                                vecmem::memory_resource&>;
+    result->algs.reserve(n_workers);
+    for (unsigned int i = 0; i < n_workers; ++i) {
+        if constexpr (cloneable) {
+            if (i >= n_devices) {
+                result->algs.push_back(std::make_unique<FULL_CHAIN_ALG>(
+                    *(result->algs.at(i % n_devices)), m_host_mr));
+                continue;
+            }
+        }
+        result->algs.push_back(std::make_unique<FULL_CHAIN_ALG>(
+            m_host_mr, cfg.target_cells_per_partition, cfg.seedfinder,
+            spacepoint_grid_config{cfg.seedfinder}, cfg.seedfilter,
+            cfg.track_finding, cfg.track_fitting,
+            (cfg.detector_file.empty() ? nullptr : &(result->detector)),
+            cfg.run_ambiguity_resolution, false, 0u,
+            cfg.use_all_devices ? static_cast<int>(i % n_devices) : -1));
+    }
+    return result;
+}
+
+template <typename FULL_CHAIN_ALG>
+void reconstruction_service<FULL_CHAIN_ALG>::work(unsigned int index) {
+
+    while (true) {
+
+        // Wait for an event, and pick up the current context with it. The
+        // context is kept alive by this worker until the event is done.
+        std::optional<job> j;
+        std::shared_ptr<const context> ctx;
+        {
+            std::unique_lock lock(m_mutex);
+            m_cv.wait(lock, [this]() { return m_stop || !m_queue.empty(); });
+            if (m_queue.empty()) {
+                return;
+            }
+            j.emplace(std::move(m_queue.front()));
+            m_queue.pop_front();
+            ctx = m_context;
+        }
+
+        // Reconstruct the event.
+        try {
+            j->result.set_value(
+                (*(ctx->algs.at(index)))(j->evt.cells, j->evt.modules));
+        } catch (...) {
+            j->result.set_exception(std::current_exception());
+        }
+    }
+}
+
+}  // namespace traccc
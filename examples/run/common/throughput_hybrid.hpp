@@ -0,0 +1,43 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// VecMem include(s).
+#include <vecmem/memory/host_memory_resource.hpp>
+
+// System include(s).
+#include <string_view>
+
+namespace traccc {
+
+/// Helper function running a multi-threaded, hybrid host/device throughput
+/// test
+///
+/// Host and device full-chain instances process the events side by side, in
+/// the same task arena. Each event is handed to a free instance by a
+/// @c traccc::hybrid_scheduler, which prefers the host for small and the
+/// device for large events.
+///
+/// @tparam HOST_CHAIN_ALG The type of the host full chain algorithm to use
+/// @tparam DEVICE_CHAIN_ALG The type of the device full chain algorithm to
+///                          use
+/// @tparam HOST_MR The host memory resource type to use for the device
+///                 algorithms
+/// @param description A short description of the application
+/// @param argc The count of command line arguments (from @c main(...))
+/// @param argv The command line arguments (from @c main(...))
+/// @return The value to be returned from @c main(...)
+///
+template <typename HOST_CHAIN_ALG, typename DEVICE_CHAIN_ALG,
+          typename HOST_MR = vecmem::host_memory_resource>
+int throughput_hybrid(std::string_view description, int argc, char* argv[]);
+
+}  // namespace traccc
+
+// Local include(s).
+#include "throughput_hybrid.ipp"
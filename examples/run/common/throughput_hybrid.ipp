@@ -0,0 +1,353 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Command line option include(s).
+#include "traccc/options/clusterization.hpp"
+#include "traccc/options/detector.hpp"
+#include "traccc/options/hybrid.hpp"
+#include "traccc/options/input_data.hpp"
+#include "traccc/options/program_options.hpp"
+#include "traccc/options/threading.hpp"
+#include "traccc/options/throughput.hpp"
+#include "traccc/options/track_finding.hpp"
+#include "traccc/options/track_propagation.hpp"
+#include "traccc/options/track_resolution.hpp"
+#include "traccc/options/track_seeding.hpp"
+
+// Reconstruction include(s).
+#include "traccc/finding/finding_config.hpp"
+#include "traccc/fitting/fitting_config.hpp"
+
+// I/O include(s).
+#include "traccc/io/demonstrator_edm.hpp"
+#include "traccc/io/read.hpp"
+#include "traccc/io/utils.hpp"
+
+// Local include(s).
+#include "event_order.hpp"
+#include "hybrid_scheduler.hpp"
+
+// Performance measurement include(s).
+#include "traccc/performance/throughput.hpp"
+#include "traccc/performance/timer.hpp"
+#include "traccc/performance/timing_info.hpp"
+#include "traccc/utils/trace.hpp"
+
+// Detray include(s).
+#include "detray/io/frontend/detector_reader.hpp"
+
+// VecMem include(s).
+#include <vecmem/memory/binary_page_memory_resource.hpp>
+
+// TBB include(s).
+#include <tbb/global_control.h>
+#include <tbb/task_arena.h>
+#include <tbb/task_group.h>
+
+// System include(s).
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <iostream>
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+namespace traccc {
+
+template <typename HOST_CHAIN_ALG, typename DEVICE_CHAIN_ALG, typename HOST_MR>
+int throughput_hybrid(std::string_view description, int argc, char* argv[]) {
+
+    static_assert(
+        std::is_same_v<typename HOST_CHAIN_ALG::host_detector_type,
+                       typename DEVICE_CHAIN_ALG::host_detector_type>,
+        "The host and device chains must use the same detector type");
+    static_assert(std::is_same_v<typename HOST_CHAIN_ALG::output_type,
+                                 typename DEVICE_CHAIN_ALG::output_type>,
+                  "The host and device chains must produce the same output");
+
+    // Program options.
+    opts::detector detector_opts;
+    opts::input_data input_opts;
+    opts::clusterization clusterization_opts;
+    opts::track_seeding seeding_opts;
+    opts::track_finding finding_opts;
+    opts::track_propagation propagation_opts;
+    opts::track_resolution resolution_opts;
+    opts::throughput throughput_opts;
+    opts::threading threading_opts;
+    opts::hybrid hybrid_opts;
+    opts::program_options program_opts{
+        description,
+        {detector_opts, input_opts, clusterization_opts, seeding_opts,
+         finding_opts, propagation_opts, resolution_opts, throughput_opts,
+         threading_opts, hybrid_opts},
+        argc,
+        argv};
+
+    // Set up the timing info holder.
+    performance::timing_info times;
+
+    // Memory resources to use in the test. The host algorithms use plain
+    // host memory, the device algorithms the (possibly pinned) memory of the
+    // specified type.
+    vecmem::host_memory_resource uncached_host_mr;
+    HOST_MR uncached_device_host_mr;
+
+    // Read in all input events into memory.
+    demonstrator_input input(&uncached_host_mr);
+    {
+        performance::timer t{"File reading", times};
+        // Create empty inputs using the correct memory resource
+        for (std::size_t i = 0; i < input_opts.events; ++i) {
+            input.push_back(demonstrator_input::value_type(&uncached_host_mr));
+        }
+        // Read event data into input vector
+        io::read(input, input_opts.events, input_opts.directory,
+                 detector_opts.detector_file, detector_opts.digitization_file,
+                 input_opts.format,
+                 (detector_opts.use_detray_detector ? data_format::json
+                                                    : data_format::csv));
+    }
+
+    // Read in the Detray detector, if the track finding and fitting are to be
+    // run as well.
+    typename HOST_CHAIN_ALG::host_detector_type detector{uncached_host_mr};
+    if (detector_opts.use_detray_detector) {
+        performance::timer t{"Detector reading", times};
+        // Set up the detector reader configuration.
+        detray::io::detector_reader_config cfg;
+        cfg.add_file(io::data_directory() + detector_opts.detector_file);
+        if (detector_opts.material_file.empty() == false) {
+            cfg.add_file(io::data_directory() + detector_opts.material_file);
+        }
+        if (detector_opts.grid_file.empty() == false) {
+            cfg.add_file(io::data_directory() + detector_opts.grid_file);
+        }
+        // Read the detector.
+        auto det = detray::io::read_detector<
+            typename HOST_CHAIN_ALG::host_detector_type>(uncached_host_mr,
+                                                         cfg);
+        detector = std::move(det.first);
+    }
+
+    // Track finding and fitting configuration(s).
+    finding_config<scalar> finding_cfg;
+    finding_cfg.min_track_candidates_per_track =
+        finding_opts.track_candidates_range[0];
+    finding_cfg.max_track_candidates_per_track =
+        finding_opts.track_candidates_range[1];
+    finding_cfg.chi2_max = finding_opts.chi2_max;
+    finding_cfg.run_step_loop_on_device = finding_opts.run_step_loop_on_device;
+    finding_cfg.min_params_for_surface_sort =
+        finding_opts.min_params_for_surface_sort;
+    finding_cfg.device_memory_budget =
+        std::size_t{finding_opts.device_memory_budget_mb} * 1024u * 1024u;
+    finding_cfg.branching = finding_opts.best_chi2_branching
+                                ? traccc::branching_policy::e_best_chi2
+                                : traccc::branching_policy::e_first_compatible;
+    finding_cfg.prune_shared_hits = finding_opts.prune_shared_hits;
+    finding_cfg.max_num_seeds = finding_opts.max_num_seeds;
+    finding_cfg.max_num_branches_in_flight =
+        finding_opts.max_num_branches_in_flight;
+    finding_cfg.max_event_time_ms = finding_opts.max_event_time_ms;
+    finding_cfg.propagation = propagation_opts.config;
+
+    fitting_config<scalar> fitting_cfg;
+    fitting_cfg.propagation = propagation_opts.config;
+
+    // Set up the choice of the events to process.
+    std::vector<std::size_t> event_sizes;
+    for (const auto& event : input) {
+        event_sizes.push_back(event.cells.size());
+    }
+    event_order order{throughput_opts, input_opts.events, event_sizes};
+    std::cout << "Random seed of the event ordering: " << order.seed()
+              << std::endl;
+
+    // The event size from which the device is preferred. By default the
+    // median, so that (with similarly fast backends) both would get about
+    // half of the events.
+    std::size_t size_threshold = hybrid_opts.size_threshold;
+    if ((size_threshold == 0) && (!event_sizes.empty())) {
+        std::vector<std::size_t> sorted_sizes = event_sizes;
+        std::nth_element(sorted_sizes.begin(),
+                         sorted_sizes.begin() + sorted_sizes.size() / 2,
+                         sorted_sizes.end());
+        size_threshold = sorted_sizes[sorted_sizes.size() / 2];
+    }
+
+    // Set up the TBB arena and thread group.
+    const std::size_t n_threads = threading_opts.threads;
+    tbb::global_control global_thread_limit(
+        tbb::global_control::max_allowed_parallelism, n_threads + 1);
+    tbb::task_arena arena{static_cast<int>(n_threads), 0};
+    tbb::task_group group;
+
+    // Decide how many algorithm instances to set up for each backend.
+    const std::size_t n_devices =
+        std::max(DEVICE_CHAIN_ALG::device_count(), 1u);
+    const std::size_t n_device_algs =
+        n_devices * std::max(throughput_opts.streams_per_device, 1u);
+    const std::size_t n_host_algs =
+        (hybrid_opts.host_instances > 0)
+            ? hybrid_opts.host_instances
+            : ((n_threads > n_device_algs) ? n_threads - n_device_algs : 0u);
+    std::cout << "Using " << n_host_algs << " host and " << n_device_algs
+              << " device algorithm instance(s), preferring the device from "
+              << size_threshold << " cells" << std::endl;
+
+    // Set up cached memory resources on top of the host memory resources
+    // separately for each algorithm instance.
+    std::vector<std::unique_ptr<vecmem::binary_page_memory_resource> >
+        cached_host_mrs;
+
+    // Set up the full-chain algorithm(s).
+    std::vector<HOST_CHAIN_ALG> host_algs;
+    host_algs.reserve(n_host_algs);
+    for (std::size_t i = 0; i < n_host_algs; ++i) {
+        host_algs.push_back(
+            {uncached_host_mr, clusterization_opts.target_cells_per_partition,
+             seeding_opts.seedfinder, {seeding_opts.seedfinder},
+             seeding_opts.seedfilter, finding_cfg, fitting_cfg,
+             (detector_opts.use_detray_detector ? &detector : nullptr),
+             resolution_opts.run});
+    }
+    std::vector<DEVICE_CHAIN_ALG> device_algs;
+    device_algs.reserve(n_device_algs);
+    for (std::size_t i = 0; i < n_device_algs; ++i) {
+        cached_host_mrs.push_back(
+            std::make_unique<vecmem::binary_page_memory_resource>(
+                uncached_device_host_mr));
+        device_algs.push_back(
+            {*(cached_host_mrs.back()),
+             clusterization_opts.target_cells_per_partition,
+             seeding_opts.seedfinder,
+             {seeding_opts.seedfinder},
+             seeding_opts.seedfilter,
+             finding_cfg,
+             fitting_cfg,
+             (detector_opts.use_detray_detector ? &detector : nullptr),
+             resolution_opts.run,
+             throughput_opts.use_graph,
+             throughput_opts.staging_ring_size,
+             static_cast<int>(i % n_devices)});
+    }
+
+    // The scheduler distributing the events between the backends.
+    hybrid_scheduler scheduler{n_host_algs, n_device_algs, size_threshold,
+                               hybrid_opts.host_max_cells};
+
+    // Dummy count uses output of tp algorithm to ensure the compiler
+    // optimisations don't skip any step
+    std::atomic_size_t rec_track_params = 0;
+
+    // Function processing a given number of events.
+    auto process_events = [&](std::size_t n_events) {
+        for (std::size_t event : order.next(n_events)) {
+            arena.execute([&, event]() {
+                group.run([&, event]() {
+                    TRACCC_TRACE_EVENT(event);
+                    const std::size_t cells = input[event].cells.size();
+                    const hybrid_scheduler::assignment assigned =
+                        scheduler.acquire(cells);
+                    const auto start = std::chrono::steady_clock::now();
+                    if (assigned.where == hybrid_scheduler::backend::host) {
+                        rec_track_params.fetch_add(
+                            host_algs.at(assigned.instance)(
+                                         input[event].cells,
+                                         input[event].modules)
+                                .size());
+                    } else {
+                        rec_track_params.fetch_add(
+                            device_algs.at(assigned.instance)(
+                                           input[event].cells,
+                                           input[event].modules)
+                                .size());
+                    }
+                    scheduler.release(assigned, cells,
+                                      std::chrono::steady_clock::now() - start);
+                });
+            });
+        }
+        // Wait for all tasks to finish.
+        group.wait();
+    };
+
+    // Cold Run events. To discard any "initialisation issues" in the
+    // measurements.
+    {
+        performance::timer t{"Warm-up processing", times};
+        process_events(throughput_opts.cold_run_events);
+    }
+
+    // Reset the dummy counter, and the per-backend statistics.
+    rec_track_params = 0;
+    scheduler.reset();
+
+    {
+        performance::timer t{"Event processing", times};
+        process_events(throughput_opts.processed_events);
+    }
+
+    // Delete the algorithms and host memory caches explicitly before their
+    // parent object would go out of scope.
+    host_algs.clear();
+    device_algs.clear();
+    cached_host_mrs.clear();
+
+    // Print some results.
+    std::cout << "Reconstructed track parameters: " << rec_track_params.load()
+              << std::endl;
+    std::cout << "Time totals:" << std::endl;
+    std::cout << times << std::endl;
+    std::cout << "Throughput:" << std::endl;
+    std::cout << performance::throughput{throughput_opts.cold_run_events,
+                                         times, "Warm-up processing"}
+              << "\n"
+              << performance::throughput{throughput_opts.processed_events,
+                                         times, "Event processing"}
+              << std::endl;
+
+    // Print the share and the throughput of the backends.
+    const double processing_seconds =
+        std::chrono::duration<double>(times.get_time("Event processing"))
+            .count();
+    std::cout << "Throughput per backend:" << std::endl;
+    for (hybrid_scheduler::backend where :
+         {hybrid_scheduler::backend::host, hybrid_scheduler::backend::device}) {
+        const hybrid_scheduler::statistics stats = scheduler.stats(where);
+        const double events = static_cast<double>(stats.events);
+        std::cout << "  "
+                  << ((where == hybrid_scheduler::backend::host) ? "Host  "
+                                                                 : "Device")
+                  << ": " << stats.events << " events ("
+                  << ((throughput_opts.processed_events > 0)
+                          ? 100. * events /
+                                static_cast<double>(
+                                    throughput_opts.processed_events)
+                          : 0.)
+                  << "%, " << stats.stolen << " taken over), "
+                  << events / processing_seconds << " events/s, "
+                  << static_cast<double>(stats.cells) / processing_seconds
+                  << " cells/s, "
+                  << ((stats.events > 0)
+                          ? std::chrono::duration<double, std::milli>(
+                                stats.busy)
+                                    .count() /
+                                events
+                          : 0.)
+                  << " ms/event" << std::endl;
+    }
+
+    // Return gracefully.
+    return 0;
+}
+
+}  // namespace traccc
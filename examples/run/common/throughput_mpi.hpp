@@ -0,0 +1,43 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// VecMem include(s).
+#include <vecmem/memory/host_memory_resource.hpp>
+
+// System include(s).
+#include <string_view>
+
+namespace traccc {
+
+/// Helper function running a throughput test distributed with MPI
+///
+/// The input events, which need to be in the packed format, are sharded
+/// across the MPI ranks. Every rank reads and processes only its own shard,
+/// with one full chain algorithm. The per-rank timing and the per-event
+/// latencies are gathered on the first rank, which reports the global
+/// throughput and the scaling efficiency of the job.
+///
+/// @tparam FULL_CHAIN_ALG The type of the full chain algorithm to use
+/// @tparam HOST_MR The host memory resource type to use
+/// @param description A short description of the application
+/// @param argc The count of command line arguments (from @c main(...))
+/// @param argv The command line arguments (from @c main(...))
+/// @param use_host_caching Flag specifying whether host-side memory caching
+///                         should be used
+/// @return The value to be returned from @c main(...)
+///
+template <typename FULL_CHAIN_ALG,
+          typename HOST_MR = vecmem::host_memory_resource>
+int throughput_mpi(std::string_view description, int argc, char* argv[],
+                   bool use_host_caching = false);
+
+}  // namespace traccc
+
+// Local include(s).
+#include "throughput_mpi.ipp"
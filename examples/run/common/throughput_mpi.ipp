@@ -0,0 +1,448 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Command line option include(s).
+#include "traccc/options/clusterization.hpp"
+#include "traccc/options/detector.hpp"
+#include "traccc/options/input_data.hpp"
+#include "traccc/options/program_options.hpp"
+#include "traccc/options/throughput.hpp"
+#include "traccc/options/track_finding.hpp"
+#include "traccc/options/track_propagation.hpp"
+#include "traccc/options/track_resolution.hpp"
+#include "traccc/options/track_seeding.hpp"
+
+// Reconstruction include(s).
+#include "traccc/finding/finding_config.hpp"
+#include "traccc/fitting/fitting_config.hpp"
+
+// I/O include(s).
+#include "traccc/io/data_format.hpp"
+#include "traccc/io/demonstrator_edm.hpp"
+#include "traccc/io/read_packed.hpp"
+#include "traccc/io/utils.hpp"
+
+// Local include(s).
+#include "event_log.hpp"
+#include "event_order.hpp"
+
+// Performance measurement include(s).
+#include "traccc/performance/timer.hpp"
+#include "traccc/performance/timing_info.hpp"
+#include "traccc/utils/trace.hpp"
+
+// Detray include(s).
+#include "detray/io/frontend/detector_reader.hpp"
+
+// VecMem include(s).
+#include <vecmem/memory/binary_page_memory_resource.hpp>
+
+// MPI include(s).
+#include <mpi.h>
+
+// System include(s).
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <numeric>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace traccc {
+namespace details {
+
+/// Scope of the MPI environment of the application
+class mpi_session {
+
+    public:
+    /// Initialise MPI
+    mpi_session(int& argc, char**& argv) {
+        MPI_Init(&argc, &argv);
+        MPI_Comm_rank(MPI_COMM_WORLD, &m_rank);
+        MPI_Comm_size(MPI_COMM_WORLD, &m_size);
+
+        // The index of the rank among the ranks of its own node, used for
+        // choosing a device for it.
+        MPI_Comm node_comm;
+        MPI_Comm_split_type(MPI_COMM_WORLD, MPI_COMM_TYPE_SHARED, m_rank,
+                            MPI_INFO_NULL, &node_comm);
+        MPI_Comm_rank(node_comm, &m_node_rank);
+        MPI_Comm_free(&node_comm);
+    }
+    /// Finalise MPI
+    ~mpi_session() { MPI_Finalize(); }
+
+    /// No copies of the session
+    mpi_session(const mpi_session&) = delete;
+    /// No copies of the session
+    mpi_session& operator=(const mpi_session&) = delete;
+
+    /// The rank of this process
+    int rank() const { return m_rank; }
+    /// The number of ranks
+    int size() const { return m_size; }
+    /// The rank of this process among the ranks of its node
+    int node_rank() const { return m_node_rank; }
+
+    private:
+    /// The rank of this process
+    int m_rank = 0;
+    /// The number of ranks
+    int m_size = 1;
+    /// The rank of this process among the ranks of its node
+    int m_node_rank = 0;
+
+};  // class mpi_session
+
+/// Get the part of a range of elements that belongs to one rank
+///
+/// @param n The number of elements to distribute
+/// @param rank The rank to get the part of
+/// @param n_ranks The number of ranks
+/// @return The first and one-past-the-last element of the rank
+///
+inline std::pair<std::size_t, std::size_t> mpi_shard(std::size_t n, int rank,
+                                                     int n_ranks) {
+    const std::size_t r = static_cast<std::size_t>(rank);
+    const std::size_t size = static_cast<std::size_t>(n_ranks);
+    return {(n * r) / size, (n * (r + 1)) / size};
+}
+
+/// Get a percentile of a sorted, non-empty range of values
+inline double mpi_percentile(const std::vector<double>& sorted, double p) {
+    const std::size_t i = static_cast<std::size_t>(
+        p * static_cast<double>(sorted.size() - 1) + 0.5);
+    return sorted[std::min(i, sorted.size() - 1)];
+}
+
+}  // namespace details
+
+template <typename FULL_CHAIN_ALG, typename HOST_MR>
+int throughput_mpi(std::string_view description, int argc, char* argv[],
+                   bool use_host_caching) {
+
+    // Set up MPI, before the command line is looked at.
+    details::mpi_session mpi{argc, argv};
+    const bool is_root = (mpi.rank() == 0);
+
+    // Program options. Only printed by the first rank.
+    opts::detector detector_opts;
+    opts::input_data input_opts;
+    opts::clusterization clusterization_opts;
+    opts::track_seeding seeding_opts;
+    opts::track_finding finding_opts;
+    opts::track_propagation propagation_opts;
+    opts::track_resolution resolution_opts;
+    opts::throughput throughput_opts;
+    std::streambuf* cout_buffer = std::cout.rdbuf();
+    if (!is_root) {
+        std::cout.rdbuf(nullptr);
+    }
+    opts::program_options program_opts{
+        description,
+        {detector_opts, input_opts, clusterization_opts, seeding_opts,
+         finding_opts, propagation_opts, resolution_opts, throughput_opts},
+        argc,
+        argv};
+    std::cout.rdbuf(cout_buffer);
+    std::cout.clear();
+
+    // The events are sharded by reading just some of them from a packed file.
+    if (input_opts.format != data_format::packed) {
+        if (is_root) {
+            std::cerr << "The MPI throughput test needs its input in the "
+                         "packed format"
+                      << std::endl;
+        }
+        return 1;
+    }
+    const std::size_t n_input_events =
+        std::min(input_opts.events, io::packed_events(input_opts.directory));
+    if (n_input_events < static_cast<std::size_t>(mpi.size())) {
+        if (is_root) {
+            std::cerr << "Too few input events (" << n_input_events
+                      << ") for " << mpi.size() << " ranks" << std::endl;
+        }
+        return 1;
+    }
+
+    // Set up the timing info holder.
+    performance::timing_info times;
+
+    // Memory resource to use in the test.
+    HOST_MR uncached_host_mr;
+    std::unique_ptr<vecmem::binary_page_memory_resource> cached_host_mr =
+        std::make_unique<vecmem::binary_page_memory_resource>(uncached_host_mr);
+    vecmem::memory_resource& alg_host_mr =
+        use_host_caching
+            ? static_cast<vecmem::memory_resource&>(*cached_host_mr)
+            : static_cast<vecmem::memory_resource&>(uncached_host_mr);
+
+    // Read in the shard of the input events that belongs to this rank.
+    const auto [first_event, last_event] =
+        details::mpi_shard(n_input_events, mpi.rank(), mpi.size());
+    std::vector<std::size_t> shard(last_event - first_event);
+    std::iota(shard.begin(), shard.end(), first_event);
+    demonstrator_input input(&uncached_host_mr);
+    {
+        performance::timer t{"File reading", times};
+        for (std::size_t i = 0; i < shard.size(); ++i) {
+            input.push_back(demonstrator_input::value_type(&uncached_host_mr));
+        }
+        io::read_packed(input, input_opts.directory, shard);
+    }
+
+    // Read in the Detray detector, if the track finding and fitting are to be
+    // run as well.
+    typename FULL_CHAIN_ALG::host_detector_type detector{uncached_host_mr};
+    if (detector_opts.use_detray_detector) {
+        performance::timer t{"Detector reading", times};
+        // Set up the detector reader configuration.
+        detray::io::detector_reader_config cfg;
+        cfg.add_file(io::data_directory() + detector_opts.detector_file);
+        if (detector_opts.material_file.empty() == false) {
+            cfg.add_file(io::data_directory() + detector_opts.material_file);
+        }
+        if (detector_opts.grid_file.empty() == false) {
+            cfg.add_file(io::data_directory() + detector_opts.grid_file);
+        }
+        // Read the detector.
+        auto det = detray::io::read_detector<
+            typename FULL_CHAIN_ALG::host_detector_type>(uncached_host_mr, cfg);
+        detector = std::move(det.first);
+    }
+
+    // Track finding and fitting configuration(s).
+    finding_config<scalar> finding_cfg;
+    finding_cfg.min_track_candidates_per_track =
+        finding_opts.track_candidates_range[0];
+    finding_cfg.max_track_candidates_per_track =
+        finding_opts.track_candidates_range[1];
+    finding_cfg.chi2_max = finding_opts.chi2_max;
+    finding_cfg.run_step_loop_on_device = finding_opts.run_step_loop_on_device;
+    finding_cfg.min_params_for_surface_sort =
+        finding_opts.min_params_for_surface_sort;
+    finding_cfg.device_memory_budget =
+        std::size_t{finding_opts.device_memory_budget_mb} * 1024u * 1024u;
+    finding_cfg.branching = finding_opts.best_chi2_branching
+                            ? traccc::branching_policy::e_best_chi2
+                            : traccc::branching_policy::e_first_compatible;
+    finding_cfg.prune_shared_hits = finding_opts.prune_shared_hits;
+    finding_cfg.max_num_seeds = finding_opts.max_num_seeds;
+    finding_cfg.max_num_branches_in_flight =
+        finding_opts.max_num_branches_in_flight;
+    finding_cfg.max_event_time_ms = finding_opts.max_event_time_ms;
+    finding_cfg.propagation = propagation_opts.config;
+
+    fitting_config<scalar> fitting_cfg;
+    fitting_cfg.propagation = propagation_opts.config;
+
+    // Set up the full-chain algorithm, on a device of the node chosen by the
+    // rank's position on its node.
+    std::unique_ptr<FULL_CHAIN_ALG> alg = std::make_unique<FULL_CHAIN_ALG>(
+        alg_host_mr, clusterization_opts.target_cells_per_partition,
+        seeding_opts.seedfinder,
+        spacepoint_grid_config{seeding_opts.seedfinder},
+        seeding_opts.seedfilter, finding_cfg, fitting_cfg,
+        (detector_opts.use_detray_detector ? &detector : nullptr),
+        resolution_opts.run, throughput_opts.use_graph,
+        throughput_opts.staging_ring_size,
+        static_cast<int>(static_cast<unsigned int>(mpi.node_rank()) %
+                         std::max(FULL_CHAIN_ALG::device_count(), 1u)));
+
+    // Tune the launch parameters of the kernels on the first rank only, and
+    // let all other ranks pick them up from the file.
+    if (throughput_opts.autotune_launches && is_root) {
+        performance::timer t{"Launch autotuning", times};
+        alg->autotune_launches(input[0].cells, input[0].modules,
+                               throughput_opts.launch_tuning_file);
+    }
+    MPI_Barrier(MPI_COMM_WORLD);
+    if ((throughput_opts.launch_tuning_file.empty() == false) &&
+        !(throughput_opts.autotune_launches && is_root)) {
+        alg->load_launch_tuning(throughput_opts.launch_tuning_file);
+    }
+
+    // Set up the choice of the events to process, out of the rank's shard.
+    std::vector<std::size_t> event_sizes;
+    for (const auto& event : input) {
+        event_sizes.push_back(event.cells.size());
+    }
+    event_order order{throughput_opts, input.size(), event_sizes};
+
+    // Dummy count uses output of tp algorithm to ensure the compiler
+    // optimisations don't skip any step
+    std::size_t rec_track_params = 0;
+
+    // Cold Run events, on every rank.
+    {
+        performance::timer t{"Warm-up processing", times};
+        for (std::size_t i : order.next(throughput_opts.cold_run_events)) {
+            TRACCC_TRACE_EVENT(shard[i]);
+            rec_track_params += (*alg)(input[i].cells, input[i].modules).size();
+        }
+    }
+    rec_track_params = 0;
+
+    // Process the rank's share of the requested events, with all ranks
+    // starting at the same time.
+    const auto [first_processed, last_processed] = details::mpi_shard(
+        throughput_opts.processed_events, mpi.rank(), mpi.size());
+    const std::vector<std::size_t> events =
+        order.next(last_processed - first_processed);
+    event_log events_log;
+    MPI_Barrier(MPI_COMM_WORLD);
+    const auto start = std::chrono::steady_clock::now();
+    {
+        performance::timer t{"Event processing", times};
+        events_log.reset();
+        for (std::size_t i : events) {
+            const event_log::clock_type::time_point event_start =
+                event_log::clock_type::now();
+            TRACCC_TRACE_EVENT(shard[i]);
+            const auto& event = input[i];
+            const std::size_t n_results =
+                (*alg)(event.cells, event.modules).size();
+            rec_track_params += n_results;
+            events_log.record(shard[i], event.cells.size(),
+                              event.modules.size(), n_results, event_start);
+        }
+    }
+    const double elapsed = std::chrono::duration<double>(
+                               std::chrono::steady_clock::now() - start)
+                               .count();
+    const std::size_t n_degraded_events = alg->n_degraded_events();
+
+    // Explicitly delete the objects in the correct order.
+    alg.reset();
+    cached_host_mr.reset();
+
+    // Gather the per-rank summaries on the first rank.
+    const std::size_t n_ranks = static_cast<std::size_t>(mpi.size());
+    const std::array<double, 4> summary{
+        static_cast<double>(events.size()), elapsed,
+        static_cast<double>(rec_track_params),
+        static_cast<double>(n_degraded_events)};
+    std::vector<double> summaries(is_root ? summary.size() * n_ranks : 0u);
+    MPI_Gather(summary.data(), static_cast<int>(summary.size()), MPI_DOUBLE,
+               summaries.data(), static_cast<int>(summary.size()), MPI_DOUBLE,
+               0, MPI_COMM_WORLD);
+
+    std::array<char, MPI_MAX_PROCESSOR_NAME> host_name{};
+    int host_name_length = 0;
+    MPI_Get_processor_name(host_name.data(), &host_name_length);
+    std::vector<char> host_names(is_root ? host_name.size() * n_ranks : 0u);
+    MPI_Gather(host_name.data(), static_cast<int>(host_name.size()), MPI_CHAR,
+               host_names.data(), static_cast<int>(host_name.size()),
+               MPI_CHAR, 0, MPI_COMM_WORLD);
+
+    // Gather the per-event latencies on the first rank, as (event, start,
+    // latency) triplets.
+    std::vector<unsigned long long> records;
+    for (const event_log::entry& e : events_log.entries()) {
+        records.push_back(e.event);
+        records.push_back(static_cast<unsigned long long>(e.start.count()));
+        records.push_back(static_cast<unsigned long long>(e.latency.count()));
+    }
+    const int n_records = static_cast<int>(records.size());
+    std::vector<int> record_counts(is_root ? n_ranks : 0u);
+    MPI_Gather(&n_records, 1, MPI_INT, record_counts.data(), 1, MPI_INT, 0,
+               MPI_COMM_WORLD);
+    std::vector<int> record_offsets(record_counts.size() + 1, 0);
+    std::partial_sum(record_counts.begin(), record_counts.end(),
+                     record_offsets.begin() + 1);
+    std::vector<unsigned long long> all_records(
+        is_root ? static_cast<std::size_t>(record_offsets.back()) : 0u);
+    MPI_Gatherv(records.data(), n_records, MPI_UNSIGNED_LONG_LONG,
+                all_records.data(), record_counts.data(),
+                record_offsets.data(), MPI_UNSIGNED_LONG_LONG, 0,
+                MPI_COMM_WORLD);
+
+    if (!is_root) {
+        return 0;
+    }
+
+    // Print the per-rank results.
+    std::cout << "Time totals (of rank 0):" << std::endl;
+    std::cout << times << std::endl;
+    std::cout << "Ranks:" << std::endl;
+    double total_events = 0., total_results = 0., total_degraded = 0.;
+    double max_elapsed = 0., sum_rank_throughputs = 0.;
+    for (std::size_t r = 0; r < n_ranks; ++r) {
+        const double* s = summaries.data() + summary.size() * r;
+        const double rank_throughput = (s[1] > 0.) ? s[0] / s[1] : 0.;
+        std::cout << "  Rank " << r << " ("
+                  << std::string(host_names.data() + host_name.size() * r)
+                  << "): " << s[0] << " events in " << s[1] << " s, "
+                  << rank_throughput << " events/s" << std::endl;
+        total_events += s[0];
+        total_results += s[2];
+        total_degraded += s[3];
+        max_elapsed = std::max(max_elapsed, s[1]);
+        sum_rank_throughputs += rank_throughput;
+    }
+
+    // Print the global results. The scaling efficiency compares the global
+    // throughput with the sum of the throughputs of the individual ranks,
+    // which only differ because of load imbalance between the ranks.
+    const double global_throughput =
+        (max_elapsed > 0.) ? total_events / max_elapsed : 0.;
+    std::cout << "Reconstructed track parameters: " << total_results
+              << std::endl;
+    std::cout << "Degraded events: " << total_degraded << std::endl;
+    std::cout << "Global throughput: " << global_throughput << " events/s, "
+              << global_throughput / static_cast<double>(n_ranks)
+              << " events/s/rank" << std::endl;
+    std::cout << "Scaling efficiency: "
+              << ((sum_rank_throughputs > 0.)
+                      ? 100. * global_throughput / sum_rank_throughputs
+                      : 0.)
+              << " %" << std::endl;
+
+    // Print the statistics of the per-event latencies.
+    std::vector<double> latencies;
+    for (std::size_t i = 2; i < all_records.size(); i += 3) {
+        latencies.push_back(static_cast<double>(all_records[i]) * 1e-6);
+    }
+    std::sort(latencies.begin(), latencies.end());
+    if (!latencies.empty()) {
+        std::cout << "Event latency: mean "
+                  << std::accumulate(latencies.begin(), latencies.end(), 0.) /
+                         static_cast<double>(latencies.size())
+                  << " ms, median " << details::mpi_percentile(latencies, 0.5)
+                  << " ms, 99th percentile "
+                  << details::mpi_percentile(latencies, 0.99) << " ms, max "
+                  << latencies.back() << " ms" << std::endl;
+    }
+
+    // Write the latencies of all ranks, if requested.
+    if (!throughput_opts.event_log_file.empty()) {
+        std::ofstream event_log_file(throughput_opts.event_log_file);
+        event_log_file << "rank,event,start_ns,latency_ns\n";
+        for (std::size_t r = 0; r < n_ranks; ++r) {
+            for (int i = record_offsets[r]; i < record_offsets[r + 1];
+                 i += 3) {
+                const std::size_t j = static_cast<std::size_t>(i);
+                event_log_file << r << "," << all_records[j] << ","
+                               << all_records[j + 1] << ","
+                               << all_records[j + 2] << "\n";
+            }
+        }
+    }
+
+    // Return gracefully.
+    return 0;
+}
+
+}  // namespace traccc
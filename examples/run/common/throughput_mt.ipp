@@ -14,16 +14,48 @@
 #include "traccc/options/program_options.hpp"
 #include "traccc/options/threading.hpp"
 #include "traccc/options/throughput.hpp"
+#include "traccc/options/track_finding.hpp"
+#include "traccc/options/track_propagation.hpp"
+#include "traccc/options/track_resolution.hpp"
 #include "traccc/options/track_seeding.hpp"
 
+// Reconstruction include(s).
+#include "traccc/finding/finding_config.hpp"
+#include "traccc/fitting/fitting_config.hpp"
+#include "traccc/geometry/module_table.hpp"
+
 // I/O include(s).
+#include "traccc/io/async_writer.hpp"
 #include "traccc/io/demonstrator_edm.hpp"
+#include "traccc/io/overlay_events.hpp"
 #include "traccc/io/read.hpp"
+#include "traccc/io/read_cells.hpp"
+#include "traccc/io/read_digitization_config.hpp"
+#include "traccc/io/read_geometry.hpp"
+#include "traccc/io/utils.hpp"
+
+// Local include(s).
+#include "device_scheduler.hpp"
+#include "event_log.hpp"
+#include "event_order.hpp"
+#include "event_source.hpp"
+#include "numa_arenas.hpp"
 
 // Performance measurement include(s).
+#include "traccc/performance/benchmark_summary.hpp"
+#include "traccc/performance/energy_meter.hpp"
+#include "traccc/performance/metrics_exporter.hpp"
 #include "traccc/performance/throughput.hpp"
+#include "traccc/performance/throughput_sweep.hpp"
+#include "traccc/performance/scoped_timer.hpp"
 #include "traccc/performance/timer.hpp"
 #include "traccc/performance/timing_info.hpp"
+#include "traccc/performance/timing_registry.hpp"
+#include "traccc/utils/instrumented_memory_resource.hpp"
+#include "traccc/utils/trace.hpp"
+
+// Detray include(s).
+#include "detray/io/frontend/detector_reader.hpp"
 
 // VecMem include(s).
 #include <vecmem/memory/binary_page_memory_resource.hpp>
@@ -34,15 +66,58 @@
 #include <tbb/task_group.h>
 
 // System include(s).
+#include <algorithm>
 #include <atomic>
-#include <cstdlib>
-#include <ctime>
+#include <chrono>
 #include <fstream>
 #include <iostream>
+#include <map>
 #include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <type_traits>
+#include <utility>
 #include <vector>
 
 namespace traccc {
+namespace details {
+
+/// Trait telling whether an algorithm can be warmed up with an event
+template <typename alg_t, typename = void>
+struct has_warm_up : std::false_type {};
+
+template <typename alg_t>
+struct has_warm_up<
+    alg_t, std::void_t<decltype(std::declval<const alg_t&>().warm_up(
+               std::declval<const cell_collection_types::host&>(),
+               std::declval<const cell_module_collection_types::host&>()))>>
+    : std::true_type {};
+
+template <typename alg_t>
+inline constexpr bool has_warm_up_v = has_warm_up<alg_t>::value;
+
+/// The time spent before the processing of the first event
+///
+/// Everything that a process needs to do before it can start processing any
+/// event: the reading of its input (files, detector, ...), and the setup,
+/// tuning and warm-up of its algorithms.
+///
+inline std::chrono::nanoseconds startup_time(
+    const performance::timing_info& times) {
+
+    std::chrono::nanoseconds result{0};
+    for (const performance::timing_info_pair& entry : times.data) {
+        if ((entry.first != "Warm-up processing") &&
+            (entry.first != "Event processing") &&
+            (entry.first != "Output flushing")) {
+            result += entry.second;
+        }
+    }
+    return result;
+}
+
+}  // namespace details
 
 template <typename FULL_CHAIN_ALG, typename HOST_MR>
 int throughput_mt(std::string_view description, int argc, char* argv[],
@@ -53,160 +128,1090 @@ int throughput_mt(std::string_view description, int argc, char* argv[],
     opts::input_data input_opts;
     opts::clusterization clusterization_opts;
     opts::track_seeding seeding_opts;
+    opts::track_finding finding_opts;
+    opts::track_propagation propagation_opts;
+    opts::track_resolution resolution_opts;
     opts::throughput throughput_opts;
     opts::threading threading_opts;
     opts::program_options program_opts{
         description,
         {detector_opts, input_opts, clusterization_opts, seeding_opts,
-         throughput_opts, threading_opts},
+         finding_opts, propagation_opts, resolution_opts, throughput_opts,
+         threading_opts},
         argc,
         argv};
 
-    // Set up the timing info holder.
-    performance::timing_info times;
-
-    // Set up the TBB arena and thread group.
-    tbb::global_control global_thread_limit(
-        tbb::global_control::max_allowed_parallelism,
-        threading_opts.threads + 1);
-    tbb::task_arena arena{static_cast<int>(threading_opts.threads), 0};
-    tbb::task_group group;
+    // Set up the timing info holder of the setup steps.
+    performance::timing_info setup_times;
 
     // Memory resource to use in the test.
     HOST_MR uncached_host_mr;
 
-    // Read in all input events into memory.
+    // Read in all input events into memory, or just the information needed
+    // for reading them one by one during the processing.
+    const bool stream_input = (throughput_opts.input_queue_depth > 0);
     demonstrator_input input(&uncached_host_mr);
+    using barcode_map_type = std::map<std::uint64_t, detray::geometry::barcode>;
+    std::pair<geometry, std::unique_ptr<barcode_map_type> > geom_pair;
+    digitization_config digi_cfg;
 
     {
-        performance::timer t{"File reading", times};
-        // Create empty inputs using the correct memory resource
-        for (std::size_t i = 0; i < input_opts.events; ++i) {
-            input.push_back(demonstrator_input::value_type(&uncached_host_mr));
-        }
-        // Read event data into input vector
-        io::read(input, input_opts.events, input_opts.directory,
-                 detector_opts.detector_file, detector_opts.digitization_file,
-                 input_opts.format);
+        performance::timer t{"File reading", setup_times};
+        if (stream_input) {
+            geom_pair = io::read_geometry(
+                detector_opts.detector_file,
+                (detector_opts.use_detray_detector ? data_format::json
+                                                   : data_format::csv),
+                detector_opts.cache_directory);
+            digi_cfg = io::read_digitization_config(
+                detector_opts.digitization_file, data_format::json,
+                detector_opts.cache_directory);
+        } else {
+            // Create empty inputs using the correct memory resource
+            for (std::size_t i = 0; i < input_opts.events; ++i) {
+                input.push_back(
+                    demonstrator_input::value_type(&uncached_host_mr));
+            }
+            // Read event data into input vector
+            io::read(input, input_opts.events, input_opts.directory,
+                     detector_opts.detector_file,
+                     detector_opts.digitization_file, input_opts.format,
+                     (detector_opts.use_detray_detector ? data_format::json
+                                                        : data_format::csv));
+        }
+    }
+
+    // Function copying events, into the host memory resource of the test.
+    auto copy_events = [&uncached_host_mr](const demonstrator_input& from,
+                                           demonstrator_input& to) {
+        to.clear();
+        to.reserve(from.size());
+        for (const io::cell_reader_output& event : from) {
+            to.push_back(demonstrator_input::value_type(&uncached_host_mr));
+            to.back().cells = event.cells;
+            to.back().modules = event.modules;
+        }
+    };
+
+    // Keep the events as they were read, for making the overlaid events of
+    // the pileup sweep out of them.
+    demonstrator_input base_input(&uncached_host_mr);
+    if (!throughput_opts.sweep_pileup.empty()) {
+        if (stream_input) {
+            std::cout << "A pileup sweep is not available with streamed "
+                         "input, ignoring it"
+                      << std::endl;
+        } else {
+            copy_events(input, base_input);
+        }
     }
 
-    // Set up cached memory resources on top of the host memory resource
-    // separately for each CPU thread.
-    std::vector<std::unique_ptr<vecmem::binary_page_memory_resource> >
-        cached_host_mrs{threading_opts.threads + 1};
-
-    // Set up the full-chain algorithm(s). One for each thread.
-    std::vector<FULL_CHAIN_ALG> algs;
-    algs.reserve(threading_opts.threads + 1);
-    for (std::size_t i = 0; i < threading_opts.threads + 1; ++i) {
-
-        cached_host_mrs.at(i) =
-            std::make_unique<vecmem::binary_page_memory_resource>(
-                uncached_host_mr);
-        vecmem::memory_resource& alg_host_mr =
-            use_host_caching
-                ? static_cast<vecmem::memory_resource&>(
-                      *(cached_host_mrs.at(i)))
-                : static_cast<vecmem::memory_resource&>(uncached_host_mr);
-        algs.push_back({alg_host_mr,
-                        clusterization_opts.target_cells_per_partition,
-                        seeding_opts.seedfinder,
-                        {seeding_opts.seedfinder},
-                        seeding_opts.seedfilter});
+    // The module table that the events are re-linked to, if requested.
+    std::unique_ptr<module_table> modules_table;
+    // The modules to process the cells of an event with.
+    auto event_modules = [&modules_table](const io::cell_reader_output& event)
+        -> const cell_module_collection_types::host& {
+        return (modules_table ? modules_table->modules() : event.modules);
+    };
+
+    // Read in the Detray detector, if the track finding and fitting are to be
+    // run as well.
+    typename FULL_CHAIN_ALG::host_detector_type detector{uncached_host_mr};
+    if (detector_opts.use_detray_detector) {
+        performance::timer t{"Detector reading", setup_times};
+        // Set up the detector reader configuration.
+        detray::io::detector_reader_config cfg;
+        cfg.add_file(io::data_directory() + detector_opts.detector_file);
+        if (detector_opts.material_file.empty() == false) {
+            cfg.add_file(io::data_directory() + detector_opts.material_file);
+        }
+        if (detector_opts.grid_file.empty() == false) {
+            cfg.add_file(io::data_directory() + detector_opts.grid_file);
+        }
+        // Read the detector.
+        auto det = detray::io::read_detector<
+            typename FULL_CHAIN_ALG::host_detector_type>(uncached_host_mr, cfg);
+        detector = std::move(det.first);
     }
 
-    // Seed the random number generator.
-    std::srand(std::time(0));
+    // Track finding and fitting configuration(s).
+    finding_config<scalar> finding_cfg;
+    finding_cfg.min_track_candidates_per_track =
+        finding_opts.track_candidates_range[0];
+    finding_cfg.max_track_candidates_per_track =
+        finding_opts.track_candidates_range[1];
+    finding_cfg.chi2_max = finding_opts.chi2_max;
+    finding_cfg.run_step_loop_on_device = finding_opts.run_step_loop_on_device;
+    finding_cfg.min_params_for_surface_sort =
+        finding_opts.min_params_for_surface_sort;
+    finding_cfg.device_memory_budget =
+        std::size_t{finding_opts.device_memory_budget_mb} * 1024u * 1024u;
+    finding_cfg.branching = finding_opts.best_chi2_branching
+                            ? traccc::branching_policy::e_best_chi2
+                            : traccc::branching_policy::e_first_compatible;
+    finding_cfg.prune_shared_hits = finding_opts.prune_shared_hits;
+    finding_cfg.max_num_seeds = finding_opts.max_num_seeds;
+    finding_cfg.max_num_branches_in_flight =
+        finding_opts.max_num_branches_in_flight;
+    finding_cfg.max_event_time_ms = finding_opts.max_event_time_ms;
+    finding_cfg.propagation = propagation_opts.config;
 
-    // Dummy count uses output of tp algorithm to ensure the compiler
-    // optimisations don't skip any step
-    std::atomic_size_t rec_track_params = 0;
+    fitting_config<scalar> fitting_cfg;
+    fitting_cfg.propagation = propagation_opts.config;
 
-    // Cold Run events. To discard any "initialisation issues" in the
-    // measurements.
-    {
-        // Measure the time of execution.
-        performance::timer t{"Warm-up processing", times};
-
-        // Process the requested number of events.
-        for (std::size_t i = 0; i < throughput_opts.cold_run_events; ++i) {
-
-            // Choose which event to process.
-            const std::size_t event = std::rand() % input_opts.events;
-
-            // Launch the processing of the event.
-            arena.execute([&, event]() {
-                group.run([&, event]() {
-                    rec_track_params.fetch_add(
-                        algs.at(tbb::this_task_arena::current_thread_index())(
-                                input[event].cells, input[event].modules)
-                            .size());
-                });
-            });
+    // The choice of the events to process. Every configuration that is
+    // measured starts from the same state, processing the same events.
+    std::optional<event_order> initial_order;
+
+    // Function preparing the events to process. Overlaying the events that
+    // were read, for a given pileup (if non-zero), and re-linking them to a
+    // single module table, if requested.
+    auto prepare_input = [&](unsigned int pileup) {
+
+        if (!base_input.empty()) {
+            if (pileup == 0) {
+                copy_events(base_input, input);
+            } else {
+                // Overlay as many input events as needed for the pileup,
+                // going through all of the input events in turn.
+                const std::size_t n_overlaid = std::max<std::size_t>(
+                    (pileup + throughput_opts.input_pileup / 2) /
+                        throughput_opts.input_pileup,
+                    1u);
+                std::cout << "Overlaying " << n_overlaid
+                          << " input events per event, for a pileup of "
+                          << pileup << std::endl;
+                input.clear();
+                std::vector<const io::cell_reader_output*> overlaid;
+                for (std::size_t i = 0; i < base_input.size(); ++i) {
+                    overlaid.clear();
+                    for (std::size_t j = 0; j < n_overlaid; ++j) {
+                        overlaid.push_back(
+                            &(base_input[(i * n_overlaid + j) %
+                                         base_input.size()]));
+                    }
+                    input.push_back(
+                        demonstrator_input::value_type(&uncached_host_mr));
+                    io::overlay_cells(input.back(), overlaid);
+                }
+            }
         }
 
-        // Wait for all tasks to finish.
-        group.wait();
-    }
+        // Re-link all events to a single module table, if requested.
+        modules_table.reset();
+        if (throughput_opts.use_module_table) {
+            if (stream_input) {
+                std::cout << "A module table is not available with streamed "
+                             "input, ignoring it"
+                          << std::endl;
+            } else {
+                performance::timer t{"Module table", setup_times};
+                modules_table =
+                    std::make_unique<module_table>(&uncached_host_mr);
+                for (io::cell_reader_output& event : input) {
+                    modules_table->relink(event.cells, event.modules);
+                }
+            }
+        }
+
+        // Set up the choice of the events to process.
+        std::vector<std::size_t> event_sizes, event_module_counts;
+        for (const auto& event : input) {
+            event_sizes.push_back(event.cells.size());
+            event_module_counts.push_back(event.modules.size());
+        }
+        initial_order.emplace(throughput_opts, input_opts.events, event_sizes,
+                              event_module_counts);
+        std::cout << "Random seed of the event ordering: "
+                  << initial_order->seed() << std::endl;
+    };
 
-    // Reset the dummy counter.
-    rec_track_params = 0;
+    // Function measuring the throughput of one configuration, returning the
+    // event processing throughput in events per second.
+    auto run_configuration = [&](const performance::sweep_configuration&
+                                     config) -> double {
 
-    {
-        // Measure the total time of execution.
-        performance::timer t{"Event processing", times};
-
-        // Process the requested number of events.
-        for (std::size_t i = 0; i < throughput_opts.processed_events; ++i) {
-
-            // Choose which event to process.
-            const std::size_t event = std::rand() % input_opts.events;
-
-            // Launch the processing of the event.
-            arena.execute([&, event]() {
-                group.run([&, event]() {
-                    rec_track_params.fetch_add(
-                        algs.at(tbb::this_task_arena::current_thread_index())(
-                                input[event].cells, input[event].modules)
-                            .size());
+        // Set up the timing info holder, starting from the setup steps.
+        performance::timing_info times = setup_times;
+        // Set up the holder of the per-event latencies, which are recorded
+        // concurrently by the processing threads.
+        performance::timing_registry latencies;
+        // The scope that the timing of the individual events belongs to.
+        std::string event_scope;
+
+        // Set up the TBB arena and thread group.
+        tbb::global_control global_thread_limit(
+            tbb::global_control::max_allowed_parallelism, config.threads + 1);
+        tbb::task_arena arena{static_cast<int>(config.threads), 0};
+        tbb::task_group group;
+
+        // Set up one (pinned) arena per NUMA node, if requested and possible.
+        // Streamed and staged input are always processed in the single arena.
+        std::unique_ptr<numa_arenas> numa;
+        if (threading_opts.numa) {
+            if (stream_input || (throughput_opts.staging_ring_size > 0)) {
+                std::cout << "NUMA aware processing is not available with "
+                             "streamed or staged input, ignoring it"
+                          << std::endl;
+            } else if (!numa_arenas::available()) {
+                std::cout << "No NUMA information available, ignoring the "
+                             "NUMA aware processing"
+                          << std::endl;
+            } else {
+                numa = std::make_unique<numa_arenas>(config.threads);
+                std::cout << "Processing events on " << numa->size()
+                          << " NUMA nodes" << std::endl;
+            }
+        }
+
+        // Decide how many algorithm instances to set up. Either one for each
+        // thread, or the requested number for each visible device.
+        const std::size_t n_devices =
+            (config.streams_per_device > 0)
+                ? std::max(FULL_CHAIN_ALG::device_count(), 1u)
+                : 1u;
+        const std::size_t n_algs =
+            (config.streams_per_device > 0)
+                ? n_devices * config.streams_per_device
+                : config.threads + 1;
+
+        // Describe the (logical) devices that the instances are spread over.
+        // Full GPUs, MIG instances and GPUs shared through MPS all show up as
+        // separate devices, so that the throughput of every partitioning can
+        // be compared.
+        std::vector<std::string> device_descriptions(n_devices);
+        if (config.streams_per_device > 0) {
+            for (std::size_t device = 0; device < n_devices; ++device) {
+                device_descriptions[device] =
+                    FULL_CHAIN_ALG::device_description(
+                        static_cast<int>(device));
+                std::cout << "Running " << config.streams_per_device
+                          << " algorithm instance(s) on device " << device;
+                if (!device_descriptions[device].empty()) {
+                    std::cout << ": " << device_descriptions[device];
+                }
+                std::cout << std::endl;
+            }
+        }
+
+        // Set up cached memory resources on top of the host memory resource
+        // separately for each algorithm instance.
+        std::vector<std::unique_ptr<vecmem::binary_page_memory_resource> >
+            cached_host_mrs{n_algs};
+        // Set up monitors of the host memory used by each algorithm instance.
+        std::vector<std::unique_ptr<instrumented_memory_resource> >
+            host_mr_monitors{n_algs};
+
+        // The NUMA arena of each algorithm instance. Either the one that the
+        // instance's thread belongs to, or the one closest to its device.
+        std::vector<std::size_t> alg_arenas(n_algs, 0);
+        if (numa) {
+            for (std::size_t i = 0; i < n_algs; ++i) {
+                if (config.streams_per_device > 0) {
+                    alg_arenas[i] =
+                        numa->find(FULL_CHAIN_ALG::device_numa_node(
+                            static_cast<int>(i % n_devices)));
+                    if (alg_arenas[i] == numa->size()) {
+                        alg_arenas[i] = (i % n_devices) % numa->size();
+                    }
+                } else {
+                    while ((alg_arenas[i] + 1 < numa->size()) &&
+                           (i >= numa->first_thread(alg_arenas[i] + 1))) {
+                        ++(alg_arenas[i]);
+                    }
+                }
+            }
+        }
+
+        // Set up the full-chain algorithm(s). With NUMA arenas, in the arena
+        // of the instance's node, so that its memory would be node-local.
+        // Algorithms that can be cloned are only set up fully once per
+        // device, with the other instances sharing the (immutable) state of
+        // those prototypes.
+        std::vector<FULL_CHAIN_ALG> algs;
+        algs.reserve(n_algs);
+        constexpr bool cloneable =
+            std::is_constructible_v<FULL_CHAIN_ALG, const FULL_CHAIN_ALG&,
+                                    vecmem::memory_resource&>;
+        [[maybe_unused]] const std::size_t n_prototypes =
+            cloneable ? n_devices : n_algs;
+        auto make_alg = [&](std::size_t i) {
+
+            cached_host_mrs.at(i) =
+                std::make_unique<vecmem::binary_page_memory_resource>(
+                    uncached_host_mr);
+            host_mr_monitors.at(i) =
+                std::make_unique<instrumented_memory_resource>(
+                    use_host_caching
+                        ? static_cast<vecmem::memory_resource&>(
+                              *(cached_host_mrs.at(i)))
+                        : static_cast<vecmem::memory_resource&>(
+                              uncached_host_mr));
+            vecmem::memory_resource& alg_host_mr = *(host_mr_monitors.at(i));
+            if constexpr (cloneable) {
+                if (i >= n_prototypes) {
+                    algs.emplace_back(algs.at(i % n_prototypes), alg_host_mr);
+                    return;
+                }
+            }
+            algs.push_back({alg_host_mr,
+                            config.target_cells_per_partition,
+                            seeding_opts.seedfinder,
+                            {seeding_opts.seedfinder},
+                            seeding_opts.seedfilter,
+                            finding_cfg,
+                            fitting_cfg,
+                            (detector_opts.use_detray_detector ? &detector
+                                                               : nullptr),
+                            resolution_opts.run,
+                            throughput_opts.use_graph,
+                            throughput_opts.staging_ring_size,
+                            (config.streams_per_device > 0)
+                                ? static_cast<int>(i % n_devices)
+                                : -1});
+        };
+        {
+            performance::timer t{"Algorithm setup", times};
+            for (std::size_t i = 0; i < n_algs; ++i) {
+                if (numa) {
+                    numa->execute(alg_arenas[i], [&, i]() { make_alg(i); });
+                } else {
+                    make_alg(i);
+                }
+            }
+        }
+
+        // Hand the module table to the algorithms, if one is used.
+        if (modules_table) {
+            for (FULL_CHAIN_ALG& alg : algs) {
+                alg.set_module_table(modules_table->modules());
+            }
+        }
+
+        // Tune the launch parameters of the kernels with the first algorithm,
+        // or load them from a file, if requested.
+        if (throughput_opts.launch_tuning_file.empty() == false) {
+            std::size_t first_tuned = 0;
+            if (throughput_opts.autotune_launches && (input.empty() == false)) {
+                performance::timer t{"Launch autotuning", times};
+                algs.front().autotune_launches(
+                    input.front().cells, event_modules(input.front()),
+                    throughput_opts.launch_tuning_file);
+                first_tuned = 1;
+            }
+            for (std::size_t i = first_tuned; i < algs.size(); ++i) {
+                algs.at(i).load_launch_tuning(
+                    throughput_opts.launch_tuning_file);
+            }
+        }
+
+        // Prepare all algorithm instances with the first event, if requested
+        // and supported, so that none of them would need to set up its
+        // memory pools or load its kernels during the timed processing.
+        if constexpr (details::has_warm_up_v<FULL_CHAIN_ALG>) {
+            if (throughput_opts.warm_up_algorithms &&
+                (input.empty() == false)) {
+                performance::timer t{"Algorithm warm-up", times};
+                arena.execute([&]() {
+                    for (FULL_CHAIN_ALG& alg : algs) {
+                        group.run([&]() {
+                            alg.warm_up(input.front().cells,
+                                        event_modules(input.front()));
+                        });
+                    }
+                });
+                group.wait();
+            }
+        }
+
+        // Replicate the input events on every NUMA node, writing them from
+        // the node's own arena.
+        std::vector<demonstrator_input> replicas;
+        if (numa) {
+            performance::timer t{"Input replication", times};
+            replicas.reserve(numa->size());
+            for (std::size_t i = 0; i < numa->size(); ++i) {
+                demonstrator_input& replica =
+                    replicas.emplace_back(&uncached_host_mr);
+                numa->execute(i, [&]() {
+                    replica.reserve(input.size());
+                    for (const io::cell_reader_output& event : input) {
+                        replica.push_back(
+                            demonstrator_input::value_type(&uncached_host_mr));
+                        replica.back().cells = event.cells;
+                        replica.back().modules = event.modules;
+                    }
                 });
+            }
+        }
+
+        // Scheduler routing the events to the least loaded device, if the
+        // algorithms were set up per device.
+        std::unique_ptr<device_scheduler> scheduler;
+        if (config.streams_per_device > 0) {
+            scheduler = std::make_unique<device_scheduler>(
+                n_devices, config.streams_per_device);
+        }
+
+        // The choice of the events to process.
+        event_order order = *initial_order;
+
+        // Log of the processed events, filled during the (measured) event
+        // processing.
+        event_log events_log;
+        bool log_events = false;
+
+        // Dummy count uses output of tp algorithm to ensure the compiler
+        // optimisations don't skip any step
+        std::atomic_size_t rec_track_params = 0;
+
+        // Writer of the reconstructed track parameters, if requested.
+        std::unique_ptr<io::async_writer> writer;
+        if (!throughput_opts.output_file.empty()) {
+            writer = std::make_unique<io::async_writer>(
+                throughput_opts.output_file,
+                throughput_opts.output_queue_depth);
+        }
+
+        // Counters of the events being processed at the moment, and of the
+        // ones that were processed in a degraded mode, for the live metrics.
+        std::atomic_size_t events_in_flight = 0;
+        std::atomic_size_t degraded_events = 0;
+        // The source of the streamed input events, while it exists.
+        std::mutex source_mutex;
+        const streaming_event_source* active_source = nullptr;
+
+        // Exporter of the live metrics of the processing, if requested.
+        std::unique_ptr<performance::metrics_exporter> metrics;
+        if (!throughput_opts.metrics_file.empty()) {
+            metrics = std::make_unique<performance::metrics_exporter>(
+                throughput_opts.metrics_file,
+                std::chrono::milliseconds{throughput_opts.metrics_interval});
+            metrics->add_timings(latencies);
+            metrics->add_memory("host", [&]() {
+                memory_statistics result;
+                for (const auto& monitor : host_mr_monitors) {
+                    result.merge(monitor->statistics());
+                }
+                return result;
             });
+            metrics->add_memory("device", [&]() {
+                memory_statistics result;
+                for (const FULL_CHAIN_ALG& alg : algs) {
+                    result.merge(alg.device_memory_statistics());
+                }
+                return result;
+            });
+            metrics->add_gauge(
+                "events_in_flight", "Events being processed at the moment",
+                [&]() { return static_cast<double>(events_in_flight.load()); });
+            metrics->add_gauge("input_queue_depth",
+                               "Streamed input events waiting for processing",
+                               [&]() {
+                                   std::lock_guard lock{source_mutex};
+                                   return static_cast<double>(
+                                       active_source ? active_source->buffered()
+                                                     : 0u);
+                               });
+            metrics->add_gauge(
+                "output_queue_depth", "Events waiting for being written",
+                [&]() {
+                    return static_cast<double>(writer ? writer->queued() : 0u);
+                });
+            metrics->add_counter(
+                "degraded_events_total",
+                "Events processed in a degraded mode, after exceeding a budget",
+                [&]() { return static_cast<double>(degraded_events.load()); });
+            metrics->start();
         }
 
-        // Wait for all tasks to finish.
-        group.wait();
+        // Function recording the result of one event.
+        auto record_result =
+            [&](std::size_t event, const io::cell_reader_output& input_event,
+                const typename FULL_CHAIN_ALG::output_type& result,
+                event_log::clock_type::time_point start) {
+                rec_track_params.fetch_add(result.size());
+                if (log_events) {
+                    events_log.record(event, input_event.cells.size(),
+                                      input_event.modules.size(),
+                                      result.size(), start);
+                }
+                if (writer) {
+                    writer->write(event, result);
+                }
+            };
+
+        // Function processing one event, on the algorithm instance of the
+        // current thread (counting from the first thread of its arena), on
+        // an already assigned one, or on the one picked by the scheduler.
+        auto process_event = [&](std::size_t event_index,
+                                 const io::cell_reader_output& event,
+                                 std::size_t first_thread = 0,
+                                 std::optional<std::size_t> assigned = {}) {
+            TRACCC_TRACE_EVENT(event_index);
+            const event_log::clock_type::time_point start =
+                event_log::clock_type::now();
+            performance::scoped_timer event_timer{event_scope, latencies};
+            std::size_t instance = 0;
+            if (assigned) {
+                instance = *assigned;
+            } else if (scheduler) {
+                performance::scoped_timer t{"Device acquisition", latencies};
+                instance = scheduler->acquire();
+            } else {
+                instance = first_thread + static_cast<std::size_t>(
+                                              tbb::this_task_arena::
+                                                  current_thread_index());
+            }
+            std::optional<typename FULL_CHAIN_ALG::output_type> result;
+            {
+                performance::scoped_timer t{"Reconstruction", latencies};
+                const std::size_t degraded =
+                    algs.at(instance).n_degraded_events();
+                ++events_in_flight;
+                // Isolated, so that the thread does not pick up another event
+                // while waiting for the parallel loops of the chain, which
+                // would re-enter the same algorithm instance.
+                tbb::this_task_arena::isolate([&]() {
+                    result.emplace(
+                        algs.at(instance)(event.cells, event_modules(event)));
+                });
+                --events_in_flight;
+                degraded_events +=
+                    algs.at(instance).n_degraded_events() - degraded;
+            }
+            if (scheduler) {
+                scheduler->release(instance);
+            }
+            performance::scoped_timer t{"Result recording", latencies};
+            record_result(event_index, event, *result, start);
+            algs.at(instance).recycle(std::move(*result));
+        };
+
+        // Time that the processing spent waiting for the input to be read, when
+        // streaming it.
+        std::chrono::nanoseconds input_stall_time{0};
+
+        // Function processing a given number of events, chosen according to
+        // the requested event ordering.
+        auto process_events = [&](std::size_t n_events) {
+
+            // Choose the events to process.
+            std::vector<std::size_t> events = order.next(n_events);
+
+            if (stream_input) {
+
+                // Set up the source of the events, reading them in the
+                // background.
+                streaming_event_source source(
+                    std::move(events), throughput_opts.input_queue_depth,
+                    std::max(throughput_opts.input_reader_threads, 1u),
+                    [&](std::size_t event, io::cell_reader_output& out) {
+                        io::read_cells(out, event, input_opts.directory,
+                                       input_opts.format, &(geom_pair.first),
+                                       &digi_cfg, geom_pair.second.get());
+                    },
+                    uncached_host_mr);
+                {
+                    std::lock_guard lock{source_mutex};
+                    active_source = &source;
+                }
+
+                // Process the events as they become available.
+                for (std::size_t i = 0; i < config.threads; ++i) {
+                    arena.execute([&]() {
+                        group.run([&]() {
+                            while (const std::optional<std::size_t> slot =
+                                       source.pop()) {
+                                process_event(source.event(*slot),
+                                              source.at(*slot));
+                                source.release(*slot);
+                            }
+                        });
+                    });
+                }
+
+                // Wait for all events to be processed.
+                group.wait();
+                input_stall_time = source.stall_time();
+                std::lock_guard lock{source_mutex};
+                active_source = nullptr;
+                return;
+            }
+
+            if (numa) {
+
+                if (scheduler) {
+
+                    // Pick the instance for every event up front, and
+                    // process the event in the arena of its device, on the
+                    // replica of that node.
+                    for (std::size_t i = 0; i < n_events; ++i) {
+                        const std::size_t event = events[i];
+                        std::size_t instance = 0;
+                        {
+                            performance::scoped_timer t{"Device acquisition",
+                                                        latencies};
+                            instance = scheduler->acquire();
+                        }
+                        const std::size_t node = alg_arenas[instance];
+                        numa->run(node, [&, event, instance, node]() {
+                            process_event(event, replicas[node][event], 0,
+                                          instance);
+                        });
+                    }
+                } else {
+
+                    // Let the threads of every node pull the events from a
+                    // shared counter, processing them on the node's replica.
+                    std::atomic_size_t next_event = 0;
+                    for (std::size_t node = 0; node < numa->size(); ++node) {
+                        for (std::size_t i = 0; i < numa->threads(node); ++i) {
+                            numa->run(node, [&, node]() {
+                                for (std::size_t j = next_event++;
+                                     j < events.size(); j = next_event++) {
+                                    process_event(
+                                        events[j], replicas[node][events[j]],
+                                        numa->first_thread(node));
+                                }
+                            });
+                        }
+                    }
+                }
+
+                // Wait for all events to be processed.
+                numa->wait();
+                return;
+            }
+
+            if (scheduler) {
+
+                // Process the requested number of events.
+                for (std::size_t i = 0; i < n_events; ++i) {
+
+                    // The event to process.
+                    const std::size_t event = events[i];
+
+                    // Launch the processing of the event, on whichever
+                    // algorithm instance the scheduler picks for it.
+                    arena.execute([&, event]() {
+                        group.run([&, event]() {
+                            process_event(event, input[event]);
+                        });
+                    });
+                }
+            } else if (order.strict() &&
+                       (throughput_opts.staging_ring_size == 0)) {
+
+                // Let every thread pull the next event from a shared
+                // counter. So that the events are started exactly in the
+                // order of the batch, whichever thread becomes free first.
+                std::atomic_size_t next_event = 0;
+                for (std::size_t i = 0; i < config.threads; ++i) {
+                    arena.execute([&]() {
+                        group.run([&]() {
+                            for (std::size_t j = next_event++;
+                                 j < events.size(); j = next_event++) {
+                                process_event(events[j], input[events[j]]);
+                            }
+                        });
+                    });
+                }
+            } else if (throughput_opts.staging_ring_size == 0) {
+
+                // Process the requested number of events.
+                for (std::size_t i = 0; i < n_events; ++i) {
+
+                    // The event to process.
+                    const std::size_t event = events[i];
+
+                    // Launch the processing of the event.
+                    arena.execute([&, event]() {
+                        group.run([&, event]() {
+                            process_event(event, input[event]);
+                        });
+                    });
+                }
+            } else {
+
+                // Hand the events to the threads in fixed, interleaved
+                // sequences. So that every algorithm knows which events it
+                // will process next, and can stage their input while it is
+                // processing the current one.
+                const std::size_t n_sequences = config.threads;
+
+                // Launch the processing of the sequences.
+                for (std::size_t seq = 0; seq < n_sequences; ++seq) {
+                    arena.execute([&, seq]() {
+                        group.run([&, seq]() {
+                            const FULL_CHAIN_ALG& alg = algs.at(
+                                tbb::this_task_arena::current_thread_index());
+                            for (std::size_t i = seq; i < events.size();
+                                 i += n_sequences) {
+                                const event_log::clock_type::time_point start =
+                                    event_log::clock_type::now();
+                                performance::scoped_timer event_timer{
+                                    event_scope, latencies};
+                                // Stage the input of this, and of the upcoming
+                                // events of the sequence.
+                                {
+                                    performance::scoped_timer t{"Input staging",
+                                                                latencies};
+                                    for (std::size_t j = 0;
+                                         j < throughput_opts.staging_ring_size;
+                                         ++j) {
+                                        const std::size_t next =
+                                            i + j * n_sequences;
+                                        if (next >= events.size()) {
+                                            break;
+                                        }
+                                        alg.prefetch(
+                                            input[events[next]].cells,
+                                            event_modules(input[events[next]]));
+                                    }
+                                }
+                                // Process the current event.
+                                std::optional<
+                                    typename FULL_CHAIN_ALG::output_type>
+                                    result;
+                                {
+                                    performance::scoped_timer t{
+                                        "Reconstruction", latencies};
+                                    const std::size_t degraded =
+                                        alg.n_degraded_events();
+                                    ++events_in_flight;
+                                    // Isolated, like in process_event.
+                                    tbb::this_task_arena::isolate([&]() {
+                                        result.emplace(alg(
+                                            input[events[i]].cells,
+                                            event_modules(input[events[i]])));
+                                    });
+                                    --events_in_flight;
+                                    degraded_events +=
+                                        alg.n_degraded_events() - degraded;
+                                }
+                                performance::scoped_timer t{"Result recording",
+                                                            latencies};
+                                record_result(events[i], input[events[i]],
+                                              *result, start);
+                                alg.recycle(std::move(*result));
+                            }
+                        });
+                    });
+                }
+            }
+
+            // Wait for all tasks to finish.
+            group.wait();
+        };
+
+        // Cold Run events. To discard any "initialisation issues" in the
+        // measurements.
+        {
+            // Measure the time of execution.
+            performance::timer t{"Warm-up processing", times};
+            performance::scoped_timer st{"Warm-up processing", latencies};
+            event_scope = "Warm-up processing/Event";
+
+            // Process the requested number of events.
+            process_events(throughput_opts.cold_run_events);
+        }
+
+        // Reset the dummy counter, and the per-device counters.
+        rec_track_params = 0;
+        if (scheduler) {
+            scheduler->reset();
+        }
+
+        // Set up the measurement of the energy used, if requested.
+        std::optional<performance::energy_meter> energy;
+        if (throughput_opts.measure_energy) {
+            energy.emplace(std::chrono::milliseconds{
+                throughput_opts.energy_sampling_interval});
+        }
+
+        {
+            // Measure the total time of execution.
+            performance::timer t{"Event processing", times};
+            performance::scoped_timer st{"Event processing", latencies};
+            event_scope = "Event processing/Event";
+            log_events = true;
+            events_log.reset();
+            if (energy) {
+                energy->start();
+            }
+
+            // Process the requested number of events.
+            process_events(throughput_opts.processed_events);
+            if (energy) {
+                energy->stop();
+            }
+        }
+
+        // Stop the export of the live metrics, writing the final ones.
+        metrics.reset();
+
+        // Write out all remaining results.
+        std::chrono::nanoseconds output_stall_time{0};
+        if (writer) {
+            performance::timer t{"Output flushing", times};
+            writer->flush();
+            output_stall_time = writer->stall_time();
+            writer.reset();
+        }
+
+        // Collect the memory statistics of the algorithm instances. Describing
+        // the most demanding instance, as every instance processes one event at
+        // a time.
+        memory_statistics host_memory, device_memory;
+        std::size_t n_degraded_events = 0;
+        for (std::size_t i = 0; i < n_algs; ++i) {
+            host_memory.merge(host_mr_monitors.at(i)->statistics());
+            device_memory.merge(algs.at(i).device_memory_statistics());
+            n_degraded_events += algs.at(i).n_degraded_events();
+        }
+
+        // Delete the algorithms and host memory caches explicitly before their
+        // parent object would go out of scope.
+        algs.clear();
+        host_mr_monitors.clear();
+        cached_host_mrs.clear();
+
+        // Print some results.
+        std::cout << "Reconstructed track parameters: "
+                  << rec_track_params.load() << std::endl;
+        std::cout << "Degraded events: " << n_degraded_events << std::endl;
+        std::cout << "Time totals:" << std::endl;
+        std::cout << times << std::endl;
+        std::cout << "Startup time (until the first event): "
+                  << std::chrono::duration<double, std::milli>(
+                         details::startup_time(times))
+                         .count()
+                  << " ms" << std::endl;
+        std::cout << "Latencies:" << std::endl;
+        std::cout << latencies << std::endl;
+        if (!throughput_opts.timing_file.empty()) {
+            std::ofstream timing_file(throughput_opts.timing_file);
+            latencies.write_json(timing_file);
+        }
+        if (!throughput_opts.event_log_file.empty()) {
+            std::ofstream event_log_file(throughput_opts.event_log_file);
+            events_log.write_csv(event_log_file);
+        }
+        std::cout << "Host memory use (with the peaks of the most demanding "
+                     "algorithm instance):"
+                  << std::endl;
+        std::cout << host_memory << std::endl;
+        if (device_memory.total.allocations > 0) {
+            std::cout << "Device memory use (with the peaks of the most "
+                         "demanding algorithm instance):"
+                      << std::endl;
+            std::cout << device_memory << std::endl;
+        }
+        std::cout << "Throughput:" << std::endl;
+        std::cout << performance::throughput{throughput_opts.cold_run_events,
+                                             times, "Warm-up processing"}
+                  << "\n"
+                  << performance::throughput{throughput_opts.processed_events,
+                                             times, "Event processing"}
+                  << std::endl;
+        const event_log::schedule schedule =
+            events_log.summarise(config.threads);
+        std::cout << "Makespan: "
+                  << std::chrono::duration<double, std::milli>(
+                         schedule.makespan)
+                         .count()
+                  << " ms, tail idle time: "
+                  << std::chrono::duration<double, std::milli>(
+                         schedule.tail_idle)
+                         .count()
+                  << " ms (summed over " << config.threads << " threads)"
+                  << std::endl;
+        if (energy) {
+            std::cout << "Energy efficiency (of the event processing):"
+                      << std::endl;
+            if (energy->empty()) {
+                std::cout << "  No energy counters are available" << std::endl;
+            }
+            for (const performance::energy_reading& reading :
+                 energy->readings()) {
+                std::cout << performance::energy_efficiency{
+                                 throughput_opts.processed_events, reading}
+                          << std::endl;
+            }
+        }
+        const double processing_seconds =
+            std::chrono::duration<double>(times.get_time("Event processing"))
+                .count();
+        if (stream_input) {
+            // Subtract the average time that the processing threads spent
+            // waiting for input, to get the throughput of the processing
+            // itself.
+            const double stall_seconds =
+                std::chrono::duration<double>(input_stall_time).count();
+            const double seconds =
+                processing_seconds -
+                stall_seconds / static_cast<double>(config.threads);
+            std::cout << "Input stalls: " << stall_seconds * 1000.
+                      << " ms (summed over " << config.threads
+                      << " threads)\n"
+                      << "Steady-state throughput: "
+                      << static_cast<double>(throughput_opts.processed_events) /
+                             seconds
+                      << " events/s" << std::endl;
+        }
+        if (!throughput_opts.output_file.empty()) {
+            std::cout << "Output stalls: "
+                      << std::chrono::duration<double>(output_stall_time)
+                                 .count() *
+                             1000.
+                      << " ms (summed over all threads)" << std::endl;
+        }
+        std::vector<performance::device_throughput> device_throughputs;
+        if (scheduler) {
+            const std::vector<std::size_t> device_events =
+                scheduler->processed_events();
+            std::cout << "Throughput per device:" << std::endl;
+            for (std::size_t device = 0; device < device_events.size();
+                 ++device) {
+                device_throughputs.push_back(
+                    {device_descriptions[device], device_events[device],
+                     static_cast<double>(device_events[device]) /
+                         processing_seconds});
+                std::cout << "  Device " << device << ": "
+                          << device_throughputs.back().processed_events
+                          << " events, "
+                          << device_throughputs.back().events_per_second
+                          << " events/s";
+                if (!device_descriptions[device].empty()) {
+                    std::cout << " [" << device_descriptions[device] << "]";
+                }
+                std::cout << std::endl;
+            }
+        }
+
+        // Write the summary of the measurement, if requested.
+        if (!throughput_opts.summary_file.empty()) {
+            std::ofstream summary_file(throughput_opts.summary_file);
+            performance::write_json(
+                summary_file,
+                {std::string(description), input_opts.directory,
+                 throughput_opts.processed_events, rec_track_params.load(),
+                 static_cast<double>(throughput_opts.processed_events) /
+                     processing_seconds,
+                 times, latencies.statistics(), host_memory, device_memory,
+                 std::move(device_throughputs)});
+        }
+
+        // Print results to log file
+        if (throughput_opts.log_file != "\0") {
+            std::ofstream logFile;
+            logFile.open(throughput_opts.log_file, std::fstream::app);
+            logFile << "\"" << input_opts.directory << "\""
+                    << "," << config.threads << "," << input_opts.events
+                    << "," << throughput_opts.cold_run_events << ","
+                    << throughput_opts.processed_events << ","
+                    << config.target_cells_per_partition << ","
+                    << times.get_time("Warm-up processing").count() << ","
+                    << times.get_time("Event processing").count()
+                    << std::endl;
+            logFile.close();
+        }
+
+        return static_cast<double>(throughput_opts.processed_events) /
+               processing_seconds;
+    };
+
+    // Measure just the configuration given on the command line, unless a
+    // throughput sweep was requested.
+    if (!throughput_opts.sweep()) {
+        prepare_input(0u);
+        run_configuration({threading_opts.threads,
+                           throughput_opts.streams_per_device,
+                           clusterization_opts.target_cells_per_partition});
+        return 0;
     }
 
-    // Delete the algorithms and host memory caches explicitly before their
-    // parent object would go out of scope.
-    algs.clear();
-    cached_host_mrs.clear();
-
-    // Print some results.
-    std::cout << "Reconstructed track parameters: " << rec_track_params.load()
-              << std::endl;
-    std::cout << "Time totals:" << std::endl;
-    std::cout << times << std::endl;
-    std::cout << "Throughput:" << std::endl;
-    std::cout << performance::throughput{throughput_opts.cold_run_events, times,
-                                         "Warm-up processing"}
-              << "\n"
-              << performance::throughput{throughput_opts.processed_events,
-                                         times, "Event processing"}
-              << std::endl;
-
-    // Print results to log file
-    if (throughput_opts.log_file != "\0") {
-        std::ofstream logFile;
-        logFile.open(throughput_opts.log_file, std::fstream::app);
-        logFile << "\"" << input_opts.directory << "\""
-                << "," << threading_opts.threads << "," << input_opts.events
-                << "," << throughput_opts.cold_run_events << ","
-                << throughput_opts.processed_events << ","
-                << clusterization_opts.target_cells_per_partition << ","
-                << times.get_time("Warm-up processing").count() << ","
-                << times.get_time("Event processing").count() << std::endl;
-        logFile.close();
+    // Measure the throughput with all requested configurations, falling back
+    // to the single values of the options not swept over.
+    auto sweep_values = [](const std::vector<unsigned int>& values,
+                           unsigned int value) {
+        return (values.empty() ? std::vector<unsigned int>{value} : values);
+    };
+    performance::sweep_results results;
+    results.input = input_opts.directory;
+    results.processed_events = throughput_opts.processed_events;
+    for (unsigned int pileup : sweep_values(throughput_opts.sweep_pileup, 0u)) {
+        prepare_input(pileup);
+        for (unsigned int threads : sweep_values(throughput_opts.sweep_threads,
+                                                 threading_opts.threads)) {
+            for (unsigned int streams :
+                 sweep_values(throughput_opts.sweep_streams_per_device,
+                              throughput_opts.streams_per_device)) {
+                for (unsigned int cells : sweep_values(
+                         throughput_opts.sweep_cells_per_partition,
+                         clusterization_opts.target_cells_per_partition)) {
+                    performance::sweep_point& point =
+                        results.points.emplace_back();
+                    point.config = {threads, streams, cells, pileup};
+                    for (unsigned int rep = 0;
+                         rep < std::max(throughput_opts.sweep_repetitions, 1u);
+                         ++rep) {
+                        std::cout << "\n>>> Sweep point "
+                                  << results.points.size() << " ("
+                                  << point.config << "), repetition "
+                                  << rep + 1 << std::endl;
+                        point.events_per_second.push_back(
+                            run_configuration(point.config));
+                    }
+                }
+            }
+        }
+    }
+    std::cout << "\nThroughput sweep:\n" << results << std::endl;
+    if (!throughput_opts.results_file.empty()) {
+        std::ofstream results_file(throughput_opts.results_file);
+        performance::write_json(results_file, results);
+    }
+
+    // Compare the results with the baseline, if one was given.
+    if (!throughput_opts.baseline_file.empty()) {
+        std::ifstream baseline_file(throughput_opts.baseline_file);
+        if (!baseline_file) {
+            std::cerr << "Could not open baseline file: "
+                      << throughput_opts.baseline_file << std::endl;
+            return 1;
+        }
+        const performance::sweep_results baseline =
+            performance::read_sweep_results(baseline_file);
+        if ((baseline.input != results.input) ||
+            (baseline.processed_events != results.processed_events)) {
+            std::cout << "WARNING: The baseline was measured on \""
+                      << baseline.input << "\" with "
+                      << baseline.processed_events << " events" << std::endl;
+        }
+        const std::vector<performance::sweep_comparison> comparisons =
+            performance::compare(baseline, results,
+                                 throughput_opts.regression_significance,
+                                 throughput_opts.regression_tolerance);
+        std::cout << "Comparison with the baseline:\n"
+                  << comparisons << std::endl;
+        const std::size_t n_regressions = static_cast<std::size_t>(
+            std::count_if(comparisons.begin(), comparisons.end(),
+                          [](const performance::sweep_comparison& comp) {
+                              return comp.regression;
+                          }));
+        if (comparisons.size() < results.points.size()) {
+            std::cout << "WARNING: "
+                      << results.points.size() - comparisons.size()
+                      << " configuration(s) not found in the baseline"
+                      << std::endl;
+        }
+        if (n_regressions > 0) {
+            std::cerr << "Found " << n_regressions
+                      << " throughput regression(s)!" << std::endl;
+            return 1;
+        }
     }
 
     // Return gracefully.
@@ -13,25 +13,51 @@
 #include "traccc/options/input_data.hpp"
 #include "traccc/options/program_options.hpp"
 #include "traccc/options/throughput.hpp"
+#include "traccc/options/track_finding.hpp"
+#include "traccc/options/track_propagation.hpp"
+#include "traccc/options/track_resolution.hpp"
 #include "traccc/options/track_seeding.hpp"
 
+// Reconstruction include(s).
+#include "traccc/finding/finding_config.hpp"
+#include "traccc/fitting/fitting_config.hpp"
+
 // I/O include(s).
+#include "traccc/io/async_writer.hpp"
 #include "traccc/io/demonstrator_edm.hpp"
 #include "traccc/io/read.hpp"
+#include "traccc/io/utils.hpp"
+
+// Local include(s).
+#include "event_log.hpp"
+#include "event_order.hpp"
+#include "latency_curve.hpp"
 
 // Performance measurement include(s).
+#include "traccc/performance/benchmark_summary.hpp"
+#include "traccc/performance/energy_meter.hpp"
 #include "traccc/performance/throughput.hpp"
 #include "traccc/performance/timer.hpp"
 #include "traccc/performance/timing_info.hpp"
+#include "traccc/utils/instrumented_memory_resource.hpp"
+#include "traccc/utils/trace.hpp"
+
+// Detray include(s).
+#include "detray/io/frontend/detector_reader.hpp"
 
 // VecMem include(s).
 #include <vecmem/memory/binary_page_memory_resource.hpp>
 
 // System include(s).
-#include <cstdlib>
-#include <ctime>
+#include <chrono>
+#include <fstream>
 #include <iostream>
 #include <memory>
+#include <optional>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
 
 namespace traccc {
 
@@ -44,11 +70,14 @@ int throughput_st(std::string_view description, int argc, char* argv[],
     opts::input_data input_opts;
     opts::clusterization clusterization_opts;
     opts::track_seeding seeding_opts;
+    opts::track_finding finding_opts;
+    opts::track_propagation propagation_opts;
+    opts::track_resolution resolution_opts;
     opts::throughput throughput_opts;
     opts::program_options program_opts{
         description,
         {detector_opts, input_opts, clusterization_opts, seeding_opts,
-         throughput_opts},
+         finding_opts, propagation_opts, resolution_opts, throughput_opts},
         argc,
         argv};
 
@@ -60,10 +89,12 @@ int throughput_st(std::string_view description, int argc, char* argv[],
     std::unique_ptr<vecmem::binary_page_memory_resource> cached_host_mr =
         std::make_unique<vecmem::binary_page_memory_resource>(uncached_host_mr);
 
-    vecmem::memory_resource& alg_host_mr =
+    // Monitor of the host memory used by the algorithm.
+    instrumented_memory_resource host_mr_monitor{
         use_host_caching
             ? static_cast<vecmem::memory_resource&>(*cached_host_mr)
-            : static_cast<vecmem::memory_resource&>(uncached_host_mr);
+            : static_cast<vecmem::memory_resource&>(uncached_host_mr)};
+    vecmem::memory_resource& alg_host_mr = host_mr_monitor;
 
     // Read in all input events into memory.
     demonstrator_input input(&uncached_host_mr);
@@ -77,18 +108,98 @@ int throughput_st(std::string_view description, int argc, char* argv[],
         // Read event data into input vector
         io::read(input, input_opts.events, input_opts.directory,
                  detector_opts.detector_file, detector_opts.digitization_file,
-                 input_opts.format);
+                 input_opts.format,
+                 (detector_opts.use_detray_detector ? data_format::json
+                                                    : data_format::csv));
     }
 
+    // Read in the Detray detector, if the track finding and fitting are to be
+    // run as well.
+    typename FULL_CHAIN_ALG::host_detector_type detector{uncached_host_mr};
+    if (detector_opts.use_detray_detector) {
+        performance::timer t{"Detector reading", times};
+        // Set up the detector reader configuration.
+        detray::io::detector_reader_config cfg;
+        cfg.add_file(io::data_directory() + detector_opts.detector_file);
+        if (detector_opts.material_file.empty() == false) {
+            cfg.add_file(io::data_directory() + detector_opts.material_file);
+        }
+        if (detector_opts.grid_file.empty() == false) {
+            cfg.add_file(io::data_directory() + detector_opts.grid_file);
+        }
+        // Read the detector.
+        auto det = detray::io::read_detector<
+            typename FULL_CHAIN_ALG::host_detector_type>(uncached_host_mr, cfg);
+        detector = std::move(det.first);
+    }
+
+    // Track finding and fitting configuration(s).
+    finding_config<scalar> finding_cfg;
+    finding_cfg.min_track_candidates_per_track =
+        finding_opts.track_candidates_range[0];
+    finding_cfg.max_track_candidates_per_track =
+        finding_opts.track_candidates_range[1];
+    finding_cfg.chi2_max = finding_opts.chi2_max;
+    finding_cfg.run_step_loop_on_device = finding_opts.run_step_loop_on_device;
+    finding_cfg.min_params_for_surface_sort =
+        finding_opts.min_params_for_surface_sort;
+    finding_cfg.device_memory_budget =
+        std::size_t{finding_opts.device_memory_budget_mb} * 1024u * 1024u;
+    finding_cfg.branching = finding_opts.best_chi2_branching
+                            ? traccc::branching_policy::e_best_chi2
+                            : traccc::branching_policy::e_first_compatible;
+    finding_cfg.prune_shared_hits = finding_opts.prune_shared_hits;
+    finding_cfg.max_num_seeds = finding_opts.max_num_seeds;
+    finding_cfg.max_num_branches_in_flight =
+        finding_opts.max_num_branches_in_flight;
+    finding_cfg.max_event_time_ms = finding_opts.max_event_time_ms;
+    finding_cfg.propagation = propagation_opts.config;
+
+    fitting_config<scalar> fitting_cfg;
+    fitting_cfg.propagation = propagation_opts.config;
+
     // Set up the full-chain algorithm.
     std::unique_ptr<FULL_CHAIN_ALG> alg = std::make_unique<FULL_CHAIN_ALG>(
         alg_host_mr, clusterization_opts.target_cells_per_partition,
         seeding_opts.seedfinder,
         spacepoint_grid_config{seeding_opts.seedfinder},
-        seeding_opts.seedfilter);
+        seeding_opts.seedfilter, finding_cfg, fitting_cfg,
+        (detector_opts.use_detray_detector ? &detector : nullptr),
+        resolution_opts.run, throughput_opts.use_graph,
+        throughput_opts.staging_ring_size);
 
-    // Seed the random number generator.
-    std::srand(std::time(0));
+    // Tune the launch parameters of the kernels, or load them from a file, if
+    // requested.
+    if (throughput_opts.autotune_launches && (input.empty() == false)) {
+        performance::timer t{"Launch autotuning", times};
+        alg->autotune_launches(input[0].cells, input[0].modules,
+                               throughput_opts.launch_tuning_file);
+    } else if (throughput_opts.launch_tuning_file.empty() == false) {
+        alg->load_launch_tuning(throughput_opts.launch_tuning_file);
+    }
+
+    // Set up the choice of the events to process.
+    std::vector<std::size_t> event_sizes;
+    for (const auto& event : input) {
+        event_sizes.push_back(event.cells.size());
+    }
+    event_order order{throughput_opts, input.size(), event_sizes};
+    std::cout << "Random seed of the event ordering: " << order.seed()
+              << std::endl;
+
+    // Log of the processed events.
+    event_log events_log;
+
+    // Function staging the input of the event at a given position, and of the
+    // ones following it, according to the size of the staging ring.
+    auto stage_events = [&](const std::vector<std::size_t>& events,
+                            std::size_t i) {
+        for (std::size_t j = i; (j < i + throughput_opts.staging_ring_size) &&
+                                (j < events.size());
+             ++j) {
+            alg->prefetch(input[events[j]].cells, input[events[j]].modules);
+        }
+    };
 
     // Dummy count uses output of tp algorithm to ensure the compiler
     // optimisations don't skip any step
@@ -101,36 +212,141 @@ int throughput_st(std::string_view description, int argc, char* argv[],
         performance::timer t{"Warm-up processing", times};
 
         // Process the requested number of events.
-        for (std::size_t i = 0; i < throughput_opts.cold_run_events; ++i) {
+        const std::vector<std::size_t> events =
+            order.next(throughput_opts.cold_run_events);
+        for (std::size_t i = 0; i < events.size(); ++i) {
 
-            // Choose which event to process.
-            const std::size_t event = std::rand() % input_opts.events;
+            // Stage the input of the upcoming events, if requested.
+            stage_events(events, i);
 
             // Process one event.
-            rec_track_params +=
-                (*alg)(input[event].cells, input[event].modules).size();
+            TRACCC_TRACE_EVENT(events[i]);
+            typename FULL_CHAIN_ALG::output_type result =
+                (*alg)(input[events[i]].cells, input[events[i]].modules);
+            rec_track_params += result.size();
+            alg->recycle(std::move(result));
         }
     }
 
     // Reset the dummy counter.
     rec_track_params = 0;
 
+    // Set up the measurement of the energy used, if requested.
+    std::optional<performance::energy_meter> energy;
+    if (throughput_opts.measure_energy) {
+        energy.emplace(std::chrono::milliseconds{
+            throughput_opts.energy_sampling_interval});
+    }
+
+    // Writer of the reconstructed track parameters, if requested.
+    std::unique_ptr<io::async_writer> writer;
+    if (!throughput_opts.output_file.empty()) {
+        writer = std::make_unique<io::async_writer>(
+            throughput_opts.output_file, throughput_opts.output_queue_depth);
+    }
+
     {
+        // Choose the events to process.
+        const std::vector<std::size_t> events =
+            order.next(throughput_opts.processed_events);
+
         // Measure the total time of execution.
         performance::timer t{"Event processing", times};
+        events_log.reset();
+        if (energy) {
+            energy->start();
+        }
 
         // Process the requested number of events.
-        for (std::size_t i = 0; i < throughput_opts.processed_events; ++i) {
+        for (std::size_t i = 0; i < events.size(); ++i) {
 
-            // Choose which event to process.
-            const std::size_t event = std::rand() % input_opts.events;
+            // Stage the input of the upcoming events, if requested.
+            const event_log::clock_type::time_point start =
+                event_log::clock_type::now();
+            stage_events(events, i);
 
             // Process one event.
-            rec_track_params +=
-                (*alg)(input[event].cells, input[event].modules).size();
+            TRACCC_TRACE_EVENT(events[i]);
+            const auto& event = input[events[i]];
+            typename FULL_CHAIN_ALG::output_type result =
+                (*alg)(event.cells, event.modules);
+            const std::size_t n_results = result.size();
+            rec_track_params += n_results;
+            events_log.record(events[i], event.cells.size(),
+                              event.modules.size(), n_results, start);
+            if (writer) {
+                writer->write(events[i], result);
+            }
+            alg->recycle(std::move(result));
+        }
+        if (energy) {
+            energy->stop();
+        }
+    }
+
+    // Write out all remaining results.
+    if (writer) {
+        performance::timer t{"Output flushing", times};
+        writer->flush();
+        writer.reset();
+    }
+
+    // Measure the end-to-end latency of the events against their load, if
+    // requested. The input of the events is not staged, as it is not "ready"
+    // before the arrival of the events.
+    latency_curve latencies;
+    if (throughput_opts.latency()) {
+        performance::timer t{"Latency measurement", times};
+        using clock_type = latency_curve::clock_type;
+        for (std::size_t i_rate = 0;
+             i_rate < throughput_opts.latency_arrival_rates.size(); ++i_rate) {
+
+            // Choose the events, and their arrival times.
+            latency_curve::point point;
+            point.offered_rate = throughput_opts.latency_arrival_rates[i_rate];
+            const std::vector<std::size_t> events =
+                order.next(throughput_opts.processed_events);
+            const std::vector<std::chrono::nanoseconds> arrivals =
+                latency_curve::arrival_times(
+                    point.offered_rate, events.size(),
+                    order.seed() + static_cast<unsigned int>(i_rate));
+
+            // Process the events in the order of their arrival.
+            const clock_type::time_point start = clock_type::now();
+            clock_type::time_point end = start;
+            for (std::size_t i = 0; i < events.size(); ++i) {
+
+                // Wait for the arrival of the event, if it did not arrive
+                // while the earlier events were processed.
+                const clock_type::time_point arrival =
+                    start + std::chrono::duration_cast<clock_type::duration>(
+                                arrivals[i]);
+                std::this_thread::sleep_until(arrival);
+
+                // Process one event.
+                TRACCC_TRACE_EVENT(events[i]);
+                const auto& event = input[events[i]];
+                const clock_type::time_point processing_start =
+                    clock_type::now();
+                typename FULL_CHAIN_ALG::output_type result =
+                    (*alg)(event.cells, event.modules);
+                end = clock_type::now();
+                point.record(arrival, processing_start, end,
+                             alg->device_latency());
+                alg->recycle(std::move(result));
+            }
+            point.achieved_rate =
+                static_cast<double>(events.size()) /
+                std::chrono::duration<double>(end - start).count();
+            latencies.add(std::move(point));
         }
     }
 
+    // Collect the memory statistics of the algorithm, before deleting it.
+    const memory_statistics host_memory = host_mr_monitor.statistics();
+    const memory_statistics device_memory = alg->device_memory_statistics();
+    const std::size_t n_degraded_events = alg->n_degraded_events();
+
     // Explicitly delete the objects in the correct order.
     alg.reset();
     cached_host_mr.reset();
@@ -138,6 +354,7 @@ int throughput_st(std::string_view description, int argc, char* argv[],
     // Print some results.
     std::cout << "Reconstructed track parameters: " << rec_track_params
               << std::endl;
+    std::cout << "Degraded events: " << n_degraded_events << std::endl;
     std::cout << "Time totals:" << std::endl;
     std::cout << times << std::endl;
     std::cout << "Throughput:" << std::endl;
@@ -147,6 +364,55 @@ int throughput_st(std::string_view description, int argc, char* argv[],
               << performance::throughput{throughput_opts.processed_events,
                                          times, "Event processing"}
               << std::endl;
+    const double saturation_rate =
+        static_cast<double>(throughput_opts.processed_events) /
+        std::chrono::duration<double>(times.get_time("Event processing"))
+            .count();
+    if (throughput_opts.latency()) {
+        std::cout << "End-to-end latency against the load:" << std::endl;
+        latencies.print(std::cout, saturation_rate);
+    }
+    if (energy) {
+        std::cout << "Energy efficiency (of the event processing):"
+                  << std::endl;
+        if (energy->empty()) {
+            std::cout << "  No energy counters are available" << std::endl;
+        }
+        for (const performance::energy_reading& reading :
+             energy->readings()) {
+            std::cout << performance::energy_efficiency{
+                             throughput_opts.processed_events, reading}
+                      << std::endl;
+        }
+    }
+    if (!throughput_opts.event_log_file.empty()) {
+        std::ofstream event_log_file(throughput_opts.event_log_file);
+        events_log.write_csv(event_log_file);
+    }
+    if (!throughput_opts.latency_file.empty()) {
+        std::ofstream latency_file(throughput_opts.latency_file);
+        latencies.write_csv(latency_file, saturation_rate);
+    }
+    if (!throughput_opts.summary_file.empty()) {
+        std::ofstream summary_file(throughput_opts.summary_file);
+        performance::write_json(
+            summary_file,
+            {std::string(description),
+             input_opts.directory,
+             throughput_opts.processed_events,
+             rec_track_params,
+             saturation_rate,
+             times,
+             {},
+             host_memory,
+             device_memory});
+    }
+    std::cout << "Host memory use:" << std::endl;
+    std::cout << host_memory << std::endl;
+    if (device_memory.total.allocations > 0) {
+        std::cout << "Device memory use:" << std::endl;
+        std::cout << device_memory << std::endl;
+    }
 
     // Return gracefully.
     return 0;
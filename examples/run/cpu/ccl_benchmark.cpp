@@ -0,0 +1,27 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Local include(s).
+#include "../common/ccl_benchmark.hpp"
+
+// Project include(s).
+#include "traccc/clusterization/component_connection.hpp"
+
+int main(int argc, char* argv[]) {
+
+    // Execute the benchmark.
+    return traccc::ccl_benchmark(
+        "Host-only CCL benchmark", argc, argv,
+        [](const traccc::opts::clusterization&, vecmem::memory_resource& mr)
+            -> traccc::ccl_benchmark_function_type {
+            return [cc = traccc::component_connection{mr}](
+                       const traccc::cell_collection_types::host& cells,
+                       const traccc::cell_module_collection_types::host&) {
+                return cc(cells).size();
+            };
+        });
+}
@@ -0,0 +1,189 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Project include(s).
+#include "traccc/definitions/common.hpp"
+#include "traccc/definitions/primitives.hpp"
+#include "traccc/finding/finding_algorithm.hpp"
+#include "traccc/io/event_map2.hpp"
+#include "traccc/io/read_measurements.hpp"
+#include "traccc/io/utils.hpp"
+#include "traccc/options/detector.hpp"
+#include "traccc/options/input_data.hpp"
+#include "traccc/options/program_options.hpp"
+#include "traccc/options/threading.hpp"
+#include "traccc/options/track_finding.hpp"
+#include "traccc/options/track_propagation.hpp"
+#include "traccc/utils/seed_generator.hpp"
+
+// Detray include(s).
+#include "detray/core/detector.hpp"
+#include "detray/core/detector_metadata.hpp"
+#include "detray/detectors/bfield.hpp"
+#include "detray/io/frontend/detector_reader.hpp"
+#include "detray/navigation/navigator.hpp"
+#include "detray/propagator/propagator.hpp"
+#include "detray/propagator/rk_stepper.hpp"
+
+// VecMem include(s).
+#include <vecmem/memory/host_memory_resource.hpp>
+
+// TBB include(s).
+#include <tbb/global_control.h>
+
+// System include(s).
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <vector>
+
+// The main routine
+//
+int main(int argc, char* argv[]) {
+
+    // Program options.
+    traccc::opts::detector detector_opts;
+    traccc::opts::input_data input_opts;
+    traccc::opts::track_finding finding_opts;
+    traccc::opts::track_propagation propagation_opts;
+    traccc::opts::threading threading_opts;
+    traccc::opts::program_options program_opts{
+        "Host Track Finding Scaling Benchmark",
+        {detector_opts, input_opts, finding_opts, propagation_opts,
+         threading_opts},
+        argc,
+        argv};
+
+    /// Type declarations
+    using host_detector_type = detray::detector<detray::default_metadata,
+                                                detray::host_container_types>;
+
+    using b_field_t = covfie::field<detray::bfield::const_bknd_t>;
+    using rk_stepper_type =
+        detray::rk_stepper<b_field_t::view_t, traccc::transform3,
+                           detray::constrained_step<>>;
+    using host_navigator_type = detray::navigator<const host_detector_type>;
+    using finding_algorithm =
+        traccc::finding_algorithm<rk_stepper_type, host_navigator_type>;
+
+    // Memory resources used by the application.
+    vecmem::host_memory_resource host_mr;
+
+    // B field value and its type
+    const traccc::vector3 B{0, 0, 2 * detray::unit<traccc::scalar>::T};
+    auto field = detray::bfield::create_const_field(B);
+
+    // Read the detector
+    detray::io::detector_reader_config reader_cfg{};
+    reader_cfg.add_file(traccc::io::data_directory() +
+                        detector_opts.detector_file);
+    if (!detector_opts.material_file.empty()) {
+        reader_cfg.add_file(traccc::io::data_directory() +
+                            detector_opts.material_file);
+    }
+    if (!detector_opts.grid_file.empty()) {
+        reader_cfg.add_file(traccc::io::data_directory() +
+                            detector_opts.grid_file);
+    }
+    // (Not using a structured binding, as that could not be captured by the
+    // lambda below in C++17.)
+    const auto detector_and_names =
+        detray::io::read_detector<host_detector_type>(host_mr, reader_cfg);
+    const host_detector_type& host_det = detector_and_names.first;
+
+    // Standard deviations for seed track parameters
+    static constexpr std::array<traccc::scalar, traccc::e_bound_size> stddevs =
+        {1e-4 * detray::unit<traccc::scalar>::mm,
+         1e-4 * detray::unit<traccc::scalar>::mm,
+         1e-3,
+         1e-3,
+         1e-4 / detray::unit<traccc::scalar>::GeV,
+         1e-4 * detray::unit<traccc::scalar>::ns};
+    traccc::seed_generator<host_detector_type> sg(host_det, stddevs);
+
+    // Read all events into memory, with truth seeds.
+    std::vector<traccc::measurement_collection_types::host> measurements;
+    std::vector<traccc::bound_track_parameters_collection_types::host> seeds;
+    for (unsigned int event = input_opts.skip;
+         event < input_opts.events + input_opts.skip; ++event) {
+
+        traccc::event_map2 evt_map2(event, input_opts.directory,
+                                    input_opts.directory, input_opts.directory);
+        const traccc::track_candidate_container_types::host truth_candidates =
+            evt_map2.generate_truth_candidates(sg, host_mr);
+        seeds.emplace_back(&host_mr);
+        for (std::size_t i = 0; i < truth_candidates.size(); ++i) {
+            seeds.back().push_back(truth_candidates.at(i).header);
+        }
+
+        traccc::io::measurement_reader_output meas_read_out(&host_mr);
+        traccc::io::read_measurements(meas_read_out, event,
+                                      input_opts.directory, input_opts.format);
+        measurements.push_back(std::move(meas_read_out.measurements));
+    }
+
+    // Finding algorithm configurations, serial and parallel.
+    finding_algorithm::config_type cfg;
+    cfg.min_track_candidates_per_track = finding_opts.track_candidates_range[0];
+    cfg.max_track_candidates_per_track = finding_opts.track_candidates_range[1];
+    cfg.chi2_max = finding_opts.chi2_max;
+    cfg.max_num_branches_per_initial_seed = finding_opts.nmax_per_seed;
+    cfg.propagation = propagation_opts.config;
+    cfg.host_params_per_task = 0;
+    finding_algorithm::config_type parallel_cfg = cfg;
+    parallel_cfg.host_params_per_task =
+        (finding_opts.host_params_per_task > 0
+             ? finding_opts.host_params_per_task
+             : 1u);
+    const finding_algorithm serial_finding(cfg);
+    const finding_algorithm parallel_finding(parallel_cfg);
+
+    // Helper function running the track finding on all events.
+    auto run = [&](const finding_algorithm& alg, std::size_t& n_tracks) {
+        n_tracks = 0;
+        const auto start = std::chrono::steady_clock::now();
+        for (std::size_t i = 0; i < measurements.size(); ++i) {
+            n_tracks += alg(host_det, field, measurements[i], seeds[i]).size();
+        }
+        return std::chrono::duration<double>(std::chrono::steady_clock::now() -
+                                             start)
+            .count();
+    };
+
+    // Serial reference.
+    std::size_t n_serial_tracks = 0;
+    const double serial_time = run(serial_finding, n_serial_tracks);
+    std::cout << "Serial track finding: " << std::fixed << std::setprecision(3)
+              << serial_time << " s, " << n_serial_tracks << " tracks"
+              << std::endl;
+
+    // Parallel processing, with a doubling number of threads.
+    bool all_match = true;
+    for (std::size_t threads = 1; threads <= threading_opts.threads;
+         threads *= 2) {
+
+        tbb::global_control thread_limit(
+            tbb::global_control::max_allowed_parallelism, threads);
+        std::size_t n_tracks = 0;
+        const double time = run(parallel_finding, n_tracks);
+        all_match = all_match && (n_tracks == n_serial_tracks);
+        std::cout << "Threads: " << std::setw(3) << threads
+                  << "  time: " << std::setprecision(3) << time
+                  << " s  speedup: " << std::setprecision(2)
+                  << serial_time / time << "  tracks: " << n_tracks
+                  << std::endl;
+    }
+
+    if (!all_match) {
+        std::cerr << "The parallel track finding did not reproduce the serial "
+                     "results!"
+                  << std::endl;
+        return EXIT_FAILURE;
+    }
+    return EXIT_SUCCESS;
+}
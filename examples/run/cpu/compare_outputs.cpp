@@ -0,0 +1,87 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Project include(s).
+#include "traccc/edm/track_parameters.hpp"
+#include "traccc/io/async_writer.hpp"
+#include "traccc/performance/collection_comparator.hpp"
+
+// VecMem include(s).
+#include <vecmem/memory/host_memory_resource.hpp>
+
+// System include(s).
+#include <cstddef>
+#include <exception>
+#include <iostream>
+#include <map>
+#include <string>
+
+/// Compare the track parameters written by two throughput applications
+///
+/// The files are the ones written by the applications' @c --output-file
+/// option. The track parameters of every event found in both files are
+/// compared with @c traccc::collection_comparator. The application fails if
+/// the files do not hold the same events, or if the number of track
+/// parameters of any event differs between them.
+///
+int main(int argc, char* argv[]) {
+
+    if ((argc < 3) || (argc > 4)) {
+        std::cerr << "Usage: " << argv[0]
+                  << " <reference file> <test file> [test name]" << std::endl;
+        return 1;
+    }
+    const std::string test_name = (argc > 3 ? argv[3] : "test");
+
+    try {
+        // Read the track parameters of both applications.
+        vecmem::host_memory_resource host_mr;
+        const auto reference =
+            traccc::io::read_track_parameters(argv[1], host_mr);
+        const auto test = traccc::io::read_track_parameters(argv[2], host_mr);
+
+        // Compare them event by event.
+        traccc::collection_comparator<traccc::bound_track_parameters>
+            compare_track_parameters{"track parameters", {}, "reference",
+                                     test_name};
+        std::size_t n_missing = 0, n_different = 0;
+        for (const auto& [event, ref_params] : reference) {
+            const auto it = test.find(event);
+            if (it == test.end()) {
+                std::cout << "Event " << event << ": missing from "
+                          << test_name << std::endl;
+                ++n_missing;
+                continue;
+            }
+            std::cout << "Event " << event << ":" << std::endl;
+            compare_track_parameters(vecmem::get_data(ref_params),
+                                     vecmem::get_data(it->second));
+            if (ref_params.size() != it->second.size()) {
+                ++n_different;
+            }
+        }
+        for (const auto& [event, params] : test) {
+            if (reference.find(event) == reference.end()) {
+                std::cout << "Event " << event << ": missing from reference"
+                          << std::endl;
+                ++n_missing;
+            }
+        }
+
+        std::cout << "Compared events: " << reference.size()
+                  << " (reference), " << test.size() << " (" << test_name
+                  << ")\n"
+                  << "Events missing from either file: " << n_missing << "\n"
+                  << "Events with a different number of track parameters: "
+                  << n_different << std::endl;
+        return ((n_missing == 0) && (n_different == 0)) ? 0 : 2;
+    } catch (const std::exception& e) {
+        std::cerr << "Failed to compare the outputs: " << e.what()
+                  << std::endl;
+        return 1;
+    }
+}
@@ -1,6 +1,6 @@
 /** TRACCC library, part of the ACTS project (R&D line)
  *
- * (c) 2022 CERN for the benefit of the ACTS project
+ * (c) 2022-2024 CERN for the benefit of the ACTS project
  *
  * Mozilla Public License Version 2.0
  */
@@ -8,29 +8,108 @@
 // Local include(s).
 #include "full_chain_algorithm.hpp"
 
+// System include(s).
+#include <algorithm>
+#include <optional>
+#include <utility>
+
 namespace traccc {
 
 full_chain_algorithm::full_chain_algorithm(
     vecmem::memory_resource& mr, unsigned int,
     const seedfinder_config& finder_config,
     const spacepoint_grid_config& grid_config,
-    const seedfilter_config& filter_config)
-    : m_clusterization(mr),
-      m_spacepoint_formation(mr),
+    const seedfilter_config& filter_config,
+    const finding_config<scalar>& track_finding_config,
+    const fitting_config<scalar>& track_fitting_config,
+    const host_detector_type* detector, bool run_ambiguity_resolution, bool,
+    unsigned int, int)
+    : m_mr(mr),
+      m_workspace(std::make_unique<workspace_resource>(mr)),
+      m_detector(detector),
+      m_field(detray::bfield::create_const_field(
+          vector3{0.f, 0.f, finder_config.bFieldInZ})),
+      m_clusterization(*m_workspace),
+      m_spacepoint_formation(*m_workspace),
+      // The seeding allocates its (persistent) grid axes on construction.
       m_seeding(finder_config, grid_config, filter_config, mr),
-      m_track_parameter_estimation(mr),
+      m_track_parameter_estimation(*m_workspace),
+      m_finding(track_finding_config, mr),
+      m_fitting(track_fitting_config),
+      m_ambiguity_resolution({}, mr),
       m_finder_config(finder_config),
       m_grid_config(grid_config),
-      m_filter_config(filter_config) {}
+      m_filter_config(filter_config),
+      m_run_ambiguity_resolution(run_ambiguity_resolution) {}
 
 full_chain_algorithm::output_type full_chain_algorithm::operator()(
     const cell_collection_types::host& cells,
     const cell_module_collection_types::host& modules) const {
 
+    // Release the intermediate objects of the previous event.
+    m_workspace->reset();
+
+    // The stage of the chain that the memory allocations are attributed to.
+    std::optional<instrumented_memory_resource::stage> stage;
+    stage.emplace("Clusterization");
+    clusterization_algorithm::output_type measurements =
+        m_clusterization(cells, modules);
     const spacepoint_formation::output_type spacepoints =
-        m_spacepoint_formation(m_clusterization(cells, modules), modules);
-    return m_track_parameter_estimation(spacepoints, m_seeding(spacepoints),
-                                        {0.f, 0.f, m_finder_config.bFieldInZ});
+        m_spacepoint_formation(measurements, modules);
+    stage.emplace("Seeding");
+    track_params_estimation::output_type track_params =
+        m_track_parameter_estimation(spacepoints, m_seeding(spacepoints),
+                                     {0.f, 0.f, m_finder_config.bFieldInZ});
+
+    // Stop at the track parameter estimation without a Detray detector.
+    if (m_detector == nullptr) {
+        output_type result = make_output();
+        result.assign(track_params.begin(), track_params.end());
+        return result;
+    }
+
+    // The track finding expects the measurements to be ordered by surface.
+    stage.emplace("Track finding");
+    std::sort(measurements.begin(), measurements.end(),
+              measurement_sort_comp());
+
+    // Run the track finding and fitting.
+    const finding_algorithm::output_type track_candidates =
+        m_finding(*m_detector, m_field, measurements, track_params);
+    stage.emplace("Track fitting");
+    track_state_container_types::host track_states =
+        m_fitting(*m_detector, m_field, track_candidates);
+
+    // Remove the ambiguous tracks, if requested.
+    if (m_run_ambiguity_resolution) {
+        stage.emplace("Ambiguity resolution");
+        track_states = m_ambiguity_resolution(track_states);
+    }
+
+    // Return the parameters of the fitted tracks.
+    output_type result = make_output();
+    result.reserve(track_states.size());
+    for (const fitting_result<transform3>& fit_res :
+         track_states.get_headers()) {
+        result.push_back(fit_res.fit_params);
+    }
+    return result;
+}
+
+void full_chain_algorithm::recycle(output_type&& result) const {
+
+    m_output_pool->release(std::move(result));
+}
+
+full_chain_algorithm::output_type full_chain_algorithm::make_output() const {
+
+    // Re-use a result handed back to the algorithm, keeping its capacity.
+    std::optional<output_type> result = m_output_pool->acquire();
+    if (result.has_value()) {
+        result->clear();
+        return std::move(*result);
+    }
+    return output_type(&m_mr);
 }
 
 }  // namespace traccc
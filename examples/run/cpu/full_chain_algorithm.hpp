@@ -1,6 +1,6 @@
 /** TRACCC library, part of the ACTS project (R&D line)
  *
- * (c) 2022 CERN for the benefit of the ACTS project
+ * (c) 2022-2024 CERN for the benefit of the ACTS project
  *
  * Mozilla Public License Version 2.0
  */
@@ -8,16 +8,37 @@
 #pragma once
 
 // Project include(s).
+#include "traccc/ambiguity_resolution/greedy_ambiguity_resolution_algorithm.hpp"
 #include "traccc/clusterization/clusterization_algorithm.hpp"
 #include "traccc/clusterization/spacepoint_formation.hpp"
 #include "traccc/edm/cell.hpp"
+#include "traccc/finding/finding_algorithm.hpp"
+#include "traccc/finding/finding_config.hpp"
+#include "traccc/fitting/fitting_algorithm.hpp"
+#include "traccc/fitting/fitting_config.hpp"
+#include "traccc/fitting/kalman_filter/kalman_fitter.hpp"
 #include "traccc/seeding/seeding_algorithm.hpp"
 #include "traccc/seeding/track_params_estimation.hpp"
 #include "traccc/utils/algorithm.hpp"
+#include "traccc/utils/instrumented_memory_resource.hpp"
+#include "traccc/utils/object_pool.hpp"
+#include "traccc/utils/workspace_resource.hpp"
+
+// Detray include(s).
+#include "detray/core/detector.hpp"
+#include "detray/detectors/bfield.hpp"
+#include "detray/navigation/navigator.hpp"
+#include "detray/propagator/rk_stepper.hpp"
 
 // VecMem include(s).
 #include <vecmem/memory/memory_resource.hpp>
 
+// System include(s).
+#include <chrono>
+#include <memory>
+#include <optional>
+#include <string>
+
 namespace traccc {
 
 /// Algorithm performing the full chain of track reconstruction
@@ -30,29 +51,177 @@ class full_chain_algorithm
           const cell_module_collection_types::host&)> {
 
     public:
+    /// @name Type declaration(s)
+    /// @{
+
+    /// Detector type used during track finding and fitting
+    using host_detector_type = detray::detector<detray::default_metadata,
+                                                detray::host_container_types>;
+
+    /// Stepper type used by the track finding and fitting algorithms
+    using stepper_type =
+        detray::rk_stepper<detray::bfield::const_field_t::view_t,
+                           host_detector_type::transform3,
+                           detray::constrained_step<>>;
+    /// Navigator type used by the track finding and fitting algorithms
+    using navigator_type = detray::navigator<const host_detector_type>;
+
+    /// Track finding algorithm type
+    using finding_algorithm =
+        traccc::finding_algorithm<stepper_type, navigator_type>;
+    /// Track fitting algorithm type
+    using fitting_algorithm = traccc::fitting_algorithm<
+        traccc::kalman_fitter<stepper_type, navigator_type>>;
+
+    /// @}
+
     /// Algorithm constructor
     ///
     /// @param mr The memory resource to use for the intermediate and result
     ///           objects
     /// @param dummy This is not used anywhere. Allows templating CPU/Device
     /// algorithm.
+    /// @param track_finding_config The configuration of the track finding
+    /// @param track_fitting_config The configuration of the track fitting
+    /// @param detector The Detray detector to run the track finding and
+    ///                 fitting with. If it is a null pointer, the chain stops
+    ///                 at the track parameter estimation.
+    /// @param run_ambiguity_resolution Flag for running the ambiguity
+    ///                                 resolution on the fitted tracks
+    /// @param use_graph Not used by the host algorithm either. Allows
+    /// templating CPU/Device algorithm.
+    /// @param staging_ring_size Not used by the host algorithm either.
+    /// @param device Not used by the host algorithm either.
     ///
 
     full_chain_algorithm(vecmem::memory_resource& mr, unsigned int dummy,
                          const seedfinder_config& finder_config,
                          const spacepoint_grid_config& grid_config,
-                         const seedfilter_config& filter_config);
+                         const seedfilter_config& filter_config,
+                         const finding_config<scalar>& track_finding_config,
+                         const fitting_config<scalar>& track_fitting_config,
+                         const host_detector_type* detector,
+                         bool run_ambiguity_resolution,
+                         bool use_graph = false,
+                         unsigned int staging_ring_size = 0,
+                         int device = -1);
 
     /// Reconstruct track parameters in the entire detector
     ///
     /// @param cells The cells for every detector module in the event
-    /// @return The track parameters reconstructed
+    /// @return The track parameters reconstructed. The parameters of the
+    ///         fitted tracks when running with a Detray detector, the
+    ///         parameters of the seeds otherwise.
+    ///
+    /// Not re-entrant, as the workspace of the previous event is released
+    /// at the start of the call. (So a thread waiting in the parallel loops
+    /// of the chain must not pick up another event for the same instance.)
     ///
     output_type operator()(
         const cell_collection_types::host& cells,
         const cell_module_collection_types::host& modules) const override;
 
+    /// Hand back a result of the algorithm, once it is no longer needed
+    ///
+    /// The memory of the result is re-used for the result of a later event.
+    /// Can be called from any thread.
+    ///
+    /// @param result A result returned by this algorithm earlier
+    ///
+    void recycle(output_type&& result) const;
+
+    /// Prepare the processing of an upcoming event
+    ///
+    /// Does nothing for the host algorithm. Allows templating CPU/Device
+    /// algorithm.
+    ///
+    void prefetch(const cell_collection_types::host&,
+                  const cell_module_collection_types::host&) const {}
+
+    /// Use a fixed table of modules for all upcoming events
+    ///
+    /// Does nothing for this algorithm, which processes the modules of
+    /// every event as they come. Allows templating the different algorithms.
+    ///
+    void set_module_table(const cell_module_collection_types::host&) {}
+
+    /// Get the number of devices that instances of the chain can run on
+    ///
+    /// Always one for the host algorithm. Allows templating CPU/Device
+    /// algorithm.
+    ///
+    static unsigned int device_count() { return 1; }
+
+    /// Get the NUMA node closest to a device
+    ///
+    /// Always unknown for the host algorithm.
+    ///
+    static int device_numa_node(int) { return -1; }
+
+    /// Get the description of a device
+    ///
+    /// Always empty for the host algorithm.
+    ///
+    static std::string device_description(int) { return {}; }
+
+    /// Get the statistics of the device memory used by the algorithms
+    ///
+    /// Always empty for the host algorithm. Allows templating CPU/Device
+    /// algorithm.
+    ///
+    memory_statistics device_memory_statistics() const { return {}; }
+
+    /// Get the number of events processed in a degraded mode, for exceeding
+    /// the budgets of the track finding
+    ///
+    /// Always zero for the host algorithm, which does not report the budgets of
+    /// its track finding. Allows templating the different algorithms.
+    ///
+    std::size_t n_degraded_events() const { return 0; }
+
+    /// Get the device time of processing the last event
+    ///
+    /// Always empty for the host algorithm, which does not run on a device.
+    /// Allows templating the different algorithms.
+    ///
+    std::optional<std::chrono::nanoseconds> device_latency() const {
+        return {};
+    }
+
+    /// Launch the kernels with the block sizes of a tuning file
+    ///
+    /// Does nothing for the host algorithm, which does not launch any
+    /// kernels. Allows templating the different algorithms.
+    ///
+    void load_launch_tuning(const std::string&) {}
+
+    /// Tune the launch parameters of the kernels on a sample event
+    ///
+    /// Does nothing for the host algorithm, which does not launch any
+    /// kernels. Allows templating the different algorithms.
+    ///
+    void autotune_launches(const cell_collection_types::host&,
+                           const cell_module_collection_types::host&,
+                           const std::string&) {}
+
     private:
+    /// Get an (empty) object for the result of the algorithm
+    output_type make_output() const;
+
+    /// Memory resource used by the algorithm
+    vecmem::memory_resource& m_mr;
+    /// Workspace for the intermediate objects of the chain, reset at the
+    /// start of every event
+    std::unique_ptr<workspace_resource> m_workspace;
+    /// Results handed back to the algorithm, for re-use
+    std::unique_ptr<object_pool<output_type>> m_output_pool =
+        std::make_unique<object_pool<output_type>>();
+
+    /// Detector used by the track finding and fitting
+    const host_detector_type* m_detector;
+    /// Constant magnetic field used by the track finding and fitting
+    detray::bfield::const_field_t m_field;
+
     /// @name Sub-algorithms used by this full-chain algorithm
     /// @{
 
@@ -64,12 +233,21 @@ class full_chain_algorithm
     seeding_algorithm m_seeding;
     /// Track parameter estimation algorithm
     track_params_estimation m_track_parameter_estimation;
+    /// Track finding algorithm
+    finding_algorithm m_finding;
+    /// Track fitting algorithm
+    fitting_algorithm m_fitting;
+    /// Ambiguity resolution algorithm
+    greedy_ambiguity_resolution_algorithm m_ambiguity_resolution;
 
     /// Configs
     seedfinder_config m_finder_config;
     spacepoint_grid_config m_grid_config;
     seedfilter_config m_filter_config;
 
+    /// Flag for running the ambiguity resolution
+    bool m_run_ambiguity_resolution;
+
     /// @}
 
 };  // class full_chain_algorithm
@@ -0,0 +1,123 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Local include(s).
+#include "../common/reconstruction_service.hpp"
+
+#include "full_chain_algorithm.hpp"
+
+// Project include(s).
+#include "traccc/io/read_cells.hpp"
+#include "traccc/io/read_digitization_config.hpp"
+#include "traccc/io/read_geometry.hpp"
+#include "traccc/options/clusterization.hpp"
+#include "traccc/options/detector.hpp"
+#include "traccc/options/input_data.hpp"
+#include "traccc/options/program_options.hpp"
+#include "traccc/options/threading.hpp"
+#include "traccc/options/track_finding.hpp"
+#include "traccc/options/track_propagation.hpp"
+#include "traccc/options/track_resolution.hpp"
+#include "traccc/options/track_seeding.hpp"
+
+// VecMem include(s).
+#include <vecmem/memory/host_memory_resource.hpp>
+
+// System include(s).
+#include <cstddef>
+#include <exception>
+#include <future>
+#include <iostream>
+#include <vector>
+
+int main(int argc, char* argv[]) {
+
+    // Program options.
+    traccc::opts::detector detector_opts;
+    traccc::opts::input_data input_opts;
+    traccc::opts::clusterization clusterization_opts;
+    traccc::opts::track_seeding seeding_opts;
+    traccc::opts::track_finding finding_opts;
+    traccc::opts::track_propagation propagation_opts;
+    traccc::opts::track_resolution resolution_opts;
+    traccc::opts::threading threading_opts;
+    traccc::opts::program_options program_opts{
+        "Reconstruction service example",
+        {detector_opts, input_opts, clusterization_opts, seeding_opts,
+         finding_opts, propagation_opts, resolution_opts, threading_opts},
+        argc,
+        argv};
+
+    // The (thread safe) memory resource of the service.
+    vecmem::host_memory_resource host_mr;
+
+    // Configure the service.
+    using service_type =
+        traccc::reconstruction_service<traccc::full_chain_algorithm>;
+    service_type::config cfg;
+    if (detector_opts.use_detray_detector) {
+        cfg.detector_file = detector_opts.detector_file;
+        cfg.material_file = detector_opts.material_file;
+        cfg.grid_file = detector_opts.grid_file;
+    }
+    cfg.target_cells_per_partition =
+        clusterization_opts.target_cells_per_partition;
+    cfg.seedfinder = seeding_opts.seedfinder;
+    cfg.seedfilter = seeding_opts.seedfilter;
+    cfg.track_finding.min_track_candidates_per_track =
+        finding_opts.track_candidates_range[0];
+    cfg.track_finding.max_track_candidates_per_track =
+        finding_opts.track_candidates_range[1];
+    cfg.track_finding.chi2_max = finding_opts.chi2_max;
+    cfg.track_finding.propagation = propagation_opts.config;
+    cfg.track_fitting.propagation = propagation_opts.config;
+    cfg.run_ambiguity_resolution = resolution_opts.run;
+    cfg.n_workers = static_cast<unsigned int>(threading_opts.threads);
+
+    // Set up the service, once.
+    service_type service{cfg, host_mr};
+
+    // Read the geometry and digitization needed for reading the cells.
+    auto geom_pair = traccc::io::read_geometry(
+        detector_opts.detector_file,
+        (detector_opts.use_detray_detector ? traccc::data_format::json
+                                           : traccc::data_format::csv));
+    const traccc::digitization_config digi_cfg =
+        traccc::io::read_digitization_config(detector_opts.digitization_file);
+
+    // Submit all events, reconfiguring the service (with a tighter track
+    // finding) half way through.
+    std::vector<std::future<service_type::result_type>> results;
+    for (std::size_t event = input_opts.skip;
+         event < input_opts.skip + input_opts.events; ++event) {
+        if (event == input_opts.skip + input_opts.events / 2) {
+            cfg.track_finding.chi2_max *= 0.5f;
+            service.reconfigure(cfg);
+        }
+        traccc::io::cell_reader_output cells(&host_mr);
+        traccc::io::read_cells(cells, event, input_opts.directory,
+                               input_opts.format, &(geom_pair.first),
+                               &digi_cfg, geom_pair.second.get());
+        results.push_back(service.submit(
+            {std::move(cells.cells), std::move(cells.modules)}));
+    }
+
+    // Collect the results.
+    std::size_t n_tracks = 0;
+    for (std::size_t i = 0; i < results.size(); ++i) {
+        try {
+            n_tracks += results[i].get().size();
+        } catch (const std::exception& e) {
+            std::cerr << "Event " << input_opts.skip + i
+                      << " failed: " << e.what() << std::endl;
+            return 1;
+        }
+    }
+    std::cout << "Reconstructed " << n_tracks << " tracks in "
+              << results.size() << " events" << std::endl;
+    return 0;
+}
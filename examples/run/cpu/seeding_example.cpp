@@ -139,6 +139,10 @@ int seq_run(const traccc::opts::track_seeding& seeding_opts,
     cfg.min_track_candidates_per_track = finding_opts.track_candidates_range[0];
     cfg.max_track_candidates_per_track = finding_opts.track_candidates_range[1];
     cfg.chi2_max = finding_opts.chi2_max;
+    cfg.host_params_per_task = finding_opts.host_params_per_task;
+    cfg.branching = finding_opts.best_chi2_branching
+                    ? traccc::branching_policy::e_best_chi2
+                    : traccc::branching_policy::e_first_compatible;
     cfg.propagation = propagation_opts.config;
 
     traccc::finding_algorithm<rk_stepper_type, host_navigator_type>
@@ -18,11 +18,14 @@
 #include "traccc/finding/finding_algorithm.hpp"
 #include "traccc/fitting/fitting_algorithm.hpp"
 #include "traccc/seeding/seeding_algorithm.hpp"
+#include "traccc/seeding/spacepoint_roi_selection.hpp"
 #include "traccc/seeding/track_params_estimation.hpp"
 
 // performance
 #include "traccc/efficiency/finding_performance_writer.hpp"
 #include "traccc/efficiency/seeding_performance_writer.hpp"
+#include "traccc/performance/timer.hpp"
+#include "traccc/performance/timing_info.hpp"
 #include "traccc/resolution/fitting_performance_writer.hpp"
 
 // options
@@ -36,6 +39,9 @@
 #include "traccc/options/track_resolution.hpp"
 #include "traccc/options/track_seeding.hpp"
 
+// utils
+#include "traccc/utils/trace.hpp"
+
 // Detray include(s).
 #include "detray/core/detector.hpp"
 #include "detray/detectors/bfield.hpp"
@@ -71,7 +77,8 @@ int seq_run(const traccc::opts::input_data& input_opts,
     auto [surface_transforms, barcode_map] = traccc::io::read_geometry(
         detector_opts.detector_file,
         (detector_opts.use_detray_detector ? traccc::data_format::json
-                                           : traccc::data_format::csv));
+                                           : traccc::data_format::csv),
+        detector_opts.cache_directory);
 
     using detector_type = detray::detector<detray::default_metadata,
                                            detray::host_container_types>;
@@ -96,8 +103,9 @@ int seq_run(const traccc::opts::input_data& input_opts,
     }
 
     // Read the digitization configuration file
-    auto digi_cfg =
-        traccc::io::read_digitization_config(detector_opts.digitization_file);
+    auto digi_cfg = traccc::io::read_digitization_config(
+        detector_opts.digitization_file, traccc::data_format::json,
+        detector_opts.cache_directory);
 
     // Output stats
     uint64_t n_cells = 0;
@@ -133,6 +141,10 @@ int seq_run(const traccc::opts::input_data& input_opts,
     finding_cfg.max_track_candidates_per_track =
         finding_opts.track_candidates_range[1];
     finding_cfg.chi2_max = finding_opts.chi2_max;
+    finding_cfg.host_params_per_task = finding_opts.host_params_per_task;
+    finding_cfg.branching = finding_opts.best_chi2_branching
+                            ? traccc::branching_policy::e_best_chi2
+                            : traccc::branching_policy::e_first_compatible;
     finding_cfg.propagation = propagation_opts.config;
 
     fitting_algorithm::config_type fitting_cfg;
@@ -141,6 +153,7 @@ int seq_run(const traccc::opts::input_data& input_opts,
     // Algorithms
     traccc::clusterization_algorithm ca(host_mr);
     traccc::spacepoint_formation sf(host_mr);
+    traccc::spacepoint_roi_selection rs(host_mr);
     traccc::seeding_algorithm sa(seeding_opts.seedfinder,
                                  {seeding_opts.seedfinder},
                                  seeding_opts.seedfilter, host_mr);
@@ -149,6 +162,10 @@ int seq_run(const traccc::opts::input_data& input_opts,
     fitting_algorithm fitting_alg(fitting_cfg);
     traccc::greedy_ambiguity_resolution_algorithm resolution_alg;
 
+    // Regions of interest to restrict the reconstruction to
+    traccc::region_of_interest_collection_types::host rois(&host_mr);
+    rois.assign(seeding_opts.rois.begin(), seeding_opts.rois.end());
+
     // performance writer
     traccc::seeding_performance_writer sd_performance_writer(
         traccc::seeding_performance_writer::config{});
@@ -161,10 +178,17 @@ int seq_run(const traccc::opts::input_data& input_opts,
     ar_writer_cfg.algorithm_name = "ambiguity_resolution";
     traccc::finding_performance_writer ar_performance_writer(ar_writer_cfg);
 
+    // Time measurements of the (host) reconstruction stages
+    traccc::performance::timing_info elapsedTimes;
+    elapsedTimes.measure_hardware_counters = performance_opts.hardware_counters;
+
     // Loop over events
     for (unsigned int event = input_opts.skip;
          event < input_opts.events + input_opts.skip; ++event) {
 
+        // Annotate the profiler ranges with the event number.
+        TRACCC_TRACE_EVENT(event);
+
         traccc::io::cell_reader_output readOut(&host_mr);
 
         // Read the cells from the relevant event file
@@ -179,40 +203,78 @@ int seq_run(const traccc::opts::input_data& input_opts,
             Clusterization
           -------------------*/
 
-        auto measurements_per_event = ca(cells_per_event, modules_per_event);
+        traccc::measurement_collection_types::host measurements_per_event{
+            &host_mr};
+        {
+            traccc::performance::timer t("Clusterization", elapsedTimes);
+            measurements_per_event = ca(cells_per_event, modules_per_event);
+        }
 
         /*------------------------
             Spacepoint formation
           ------------------------*/
 
-        auto spacepoints_per_event =
-            sf(measurements_per_event, modules_per_event);
+        traccc::spacepoint_collection_types::host spacepoints_per_event{
+            &host_mr};
+        {
+            traccc::performance::timer t("Spacepoint formation", elapsedTimes);
+            spacepoints_per_event =
+                sf(measurements_per_event, modules_per_event);
+        }
+
+        /*-----------------------------
+          Region of interest selection
+          -----------------------------*/
+
+        // Only seed (and therefore track) in the regions of interest, if
+        // any were given.
+        if (!rois.empty()) {
+            traccc::performance::timer t("RoI selection", elapsedTimes);
+            spacepoints_per_event = rs(spacepoints_per_event, rois);
+        }
 
         /*-----------------------
           Seeding algorithm
           -----------------------*/
 
-        auto seeds = sa(spacepoints_per_event);
+        traccc::seed_collection_types::host seeds{&host_mr};
+        {
+            traccc::performance::timer t("Seeding", elapsedTimes);
+            seeds = sa(spacepoints_per_event);
+        }
 
         /*----------------------------
           Track params estimation
           ----------------------------*/
 
-        auto params = tp(spacepoints_per_event, seeds, field_vec);
+        traccc::bound_track_parameters_collection_types::host params{
+            &host_mr};
+        {
+            traccc::performance::timer t("Track params estimation",
+                                         elapsedTimes);
+            params = tp(spacepoints_per_event, seeds, field_vec);
+        }
 
         // Perform track finding and fitting only when using a Detray geometry.
         finding_algorithm::output_type track_candidates{&host_mr};
         fitting_algorithm::output_type track_states{&host_mr};
         if (detector_opts.use_detray_detector) {
-            track_candidates =
-                finding_alg(detector, field, measurements_per_event, params);
-            track_states = fitting_alg(detector, field, track_candidates);
+            {
+                traccc::performance::timer t("Track finding", elapsedTimes);
+                track_candidates = finding_alg(detector, field,
+                                               measurements_per_event, params);
+            }
+            {
+                traccc::performance::timer t("Track fitting", elapsedTimes);
+                track_states = fitting_alg(detector, field, track_candidates);
+            }
         }
 
         // Perform ambiguity resolution only if asked for.
         traccc::greedy_ambiguity_resolution_algorithm::output_type
             resolved_track_states{&host_mr};
         if (resolution_opts.run) {
+            traccc::performance::timer t("Ambiguity resolution", elapsedTimes);
             resolved_track_states = resolution_alg(track_states);
         }
 
@@ -282,6 +344,7 @@ int seq_run(const traccc::opts::input_data& input_opts,
     std::cout << "- fitted   " << n_fitted_tracks << " tracks" << std::endl;
     std::cout << "- resolved " << n_ambiguity_free_tracks << " tracks"
               << std::endl;
+    std::cout << "==>Elapsed times...\n" << elapsedTimes << std::endl;
 
     return EXIT_SUCCESS;
 }
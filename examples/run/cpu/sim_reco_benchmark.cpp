@@ -0,0 +1,239 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Project include(s).
+#include "traccc/definitions/common.hpp"
+#include "traccc/definitions/primitives.hpp"
+#include "traccc/edm/track_parameters.hpp"
+#include "traccc/finding/finding_algorithm.hpp"
+#include "traccc/fitting/fitting_algorithm.hpp"
+#include "traccc/fitting/kalman_filter/kalman_fitter.hpp"
+#include "traccc/options/generation.hpp"
+#include "traccc/options/program_options.hpp"
+#include "traccc/options/threading.hpp"
+#include "traccc/options/track_finding.hpp"
+#include "traccc/options/track_propagation.hpp"
+#include "traccc/simulation/measurement_smearer.hpp"
+#include "traccc/simulation/simulator.hpp"
+#include "traccc/simulation/smearing_recorder.hpp"
+#include "traccc/utils/seed_generator.hpp"
+
+// Detray include(s).
+#include "detray/detectors/bfield.hpp"
+#include "detray/detectors/build_toy_detector.hpp"
+#include "detray/navigation/navigator.hpp"
+#include "detray/propagator/propagator.hpp"
+#include "detray/propagator/rk_stepper.hpp"
+#include "detray/simulation/event_generator/track_generators.hpp"
+
+// VecMem include(s).
+#include <vecmem/memory/host_memory_resource.hpp>
+
+// System include(s).
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <utility>
+#include <vector>
+
+using namespace traccc;
+
+namespace {
+
+/// Helper function measuring the (wall clock) time taken by some code [s]
+template <typename function_t>
+double time_it(function_t func) {
+
+    const auto start = std::chrono::steady_clock::now();
+    func();
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() -
+                                         start)
+        .count();
+}
+
+}  // namespace
+
+int run(const traccc::opts::generation& generation_opts,
+        const traccc::opts::track_finding& finding_opts,
+        const traccc::opts::track_propagation& propagation_opts,
+        const traccc::opts::threading& threading_opts) {
+
+    // Use deterministic random number generator for testing
+    using uniform_gen_t =
+        detray::random_numbers<scalar, std::uniform_real_distribution<scalar>,
+                               std::seed_seq>;
+
+    /// Type declarations
+    using detector_type = detray::detector<detray::toy_metadata>;
+    using b_field_t = covfie::field<detray::bfield::const_bknd_t>;
+    using rk_stepper_type =
+        detray::rk_stepper<b_field_t::view_t, traccc::transform3,
+                           detray::constrained_step<>>;
+    using navigator_type = detray::navigator<const detector_type>;
+    using finding_algorithm_type =
+        traccc::finding_algorithm<rk_stepper_type, navigator_type>;
+    using fitting_algorithm_type = traccc::fitting_algorithm<
+        traccc::kalman_fitter<rk_stepper_type, navigator_type>>;
+    using generator_type =
+        detray::random_track_generator<traccc::free_track_parameters,
+                                       uniform_gen_t>;
+    using recorder_type =
+        traccc::smearing_recorder<traccc::measurement_smearer<transform3>>;
+
+    // Memory resource
+    vecmem::host_memory_resource host_mr;
+
+    /*****************************
+     * Build a toy geometry
+     *****************************/
+
+    // B field value and its type
+    // @TODO: Set B field as argument
+    const vector3 B{0, 0, 2 * detray::unit<scalar>::T};
+    auto field = detray::bfield::create_const_field(B);
+
+    // Create the toy geometry, in memory
+    detray::toy_det_config<scalar> toy_cfg{};
+    toy_cfg.n_brl_layers(4u).n_edc_layers(7u);
+    // @TODO: Increase the material budget again
+    toy_cfg.module_mat_thickness(0.11 * detray::unit<scalar>::mm);
+    // (Not using a structured binding, as that could not be captured by the
+    // lambdas below in C++17.)
+    const auto det_and_names = detray::build_toy_detector(host_mr, toy_cfg);
+    const detector_type& det = det_and_names.first;
+
+    /*****************************
+     * Set up the reconstruction
+     *****************************/
+
+    // Standard deviations for seed track parameters
+    static constexpr std::array<traccc::scalar, traccc::e_bound_size> stddevs =
+        {1e-4 * detray::unit<traccc::scalar>::mm,
+         1e-4 * detray::unit<traccc::scalar>::mm,
+         1e-3,
+         1e-3,
+         1e-4 / detray::unit<traccc::scalar>::GeV,
+         1e-4 * detray::unit<traccc::scalar>::ns};
+    traccc::seed_generator<detector_type> sg(det, stddevs);
+
+    // Finding algorithm
+    finding_algorithm_type::config_type cfg;
+    cfg.min_track_candidates_per_track = finding_opts.track_candidates_range[0];
+    cfg.max_track_candidates_per_track = finding_opts.track_candidates_range[1];
+    cfg.chi2_max = finding_opts.chi2_max;
+    cfg.max_num_branches_per_initial_seed = finding_opts.nmax_per_seed;
+    cfg.host_params_per_task = finding_opts.host_params_per_task;
+    cfg.branching = finding_opts.best_chi2_branching
+                        ? traccc::branching_policy::e_best_chi2
+                        : traccc::branching_policy::e_first_compatible;
+    cfg.propagation = propagation_opts.config;
+    const finding_algorithm_type host_finding(cfg);
+
+    // Fitting algorithm
+    fitting_algorithm_type::config_type fit_cfg;
+    fit_cfg.propagation = propagation_opts.config;
+    const fitting_algorithm_type host_fitting(fit_cfg);
+
+    /*****************************
+     * Scan the track multiplicity
+     *****************************/
+
+    // Process events with 1, 10, 100, ... tracks, up to the requested number
+    // of tracks per event.
+    std::vector<unsigned int> multiplicities;
+    for (unsigned int n = 1u; n < generation_opts.gen_nparticles; n *= 10u) {
+        multiplicities.push_back(n);
+    }
+    multiplicities.push_back(std::max(generation_opts.gen_nparticles, 1u));
+
+    std::cout << std::setw(10) << "tracks" << std::setw(14) << "sim [s]"
+              << std::setw(14) << "finding [s]" << std::setw(14)
+              << "fitting [s]" << std::setw(12) << "found"
+              << std::setw(12) << "fitted" << std::endl;
+
+    for (const unsigned int n_tracks : multiplicities) {
+
+        // Simulate the events straight into memory.
+        generator_type::configuration gen_cfg{};
+        gen_cfg.n_tracks(n_tracks);
+        gen_cfg.origin(generation_opts.vertex);
+        gen_cfg.origin_stddev(generation_opts.vertex_stddev);
+        gen_cfg.phi_range(generation_opts.phi_range[0],
+                          generation_opts.phi_range[1]);
+        gen_cfg.theta_range(generation_opts.theta_range[0],
+                            generation_opts.theta_range[1]);
+        gen_cfg.mom_range(generation_opts.mom_range[0],
+                          generation_opts.mom_range[1]);
+        gen_cfg.charge(generation_opts.charge);
+
+        traccc::measurement_smearer<transform3> meas_smearer(
+            50 * detray::unit<scalar>::um, 50 * detray::unit<scalar>::um);
+        traccc::simulated_event_store store;
+        typename recorder_type::config recorder_cfg{meas_smearer, &store};
+
+        auto sim = traccc::simulator<detector_type, b_field_t, generator_type,
+                                     recorder_type>(
+            generation_opts.events, det, field, generator_type(gen_cfg),
+            std::move(recorder_cfg));
+        sim.get_config().propagation = propagation_opts.config;
+        sim.get_config().n_threads = threading_opts.threads;
+        const double sim_time = time_it([&]() { sim.run(); });
+
+        // Make the truth seeds, which is not part of the timed processing.
+        std::vector<traccc::bound_track_parameters_collection_types::host>
+            seeds;
+        for (const traccc::simulated_event& event : store.events()) {
+            seeds.push_back(event.truth_seeds(sg, host_mr));
+        }
+
+        // Run the track finding and fitting on all events.
+        std::vector<traccc::track_candidate_container_types::host> candidates;
+        const double finding_time = time_it([&]() {
+            for (std::size_t i = 0; i < seeds.size(); ++i) {
+                candidates.push_back(host_finding(
+                    det, field, store.events()[i].measurements, seeds[i]));
+            }
+        });
+        std::size_t n_found = 0u, n_fitted = 0u;
+        const double fitting_time = time_it([&]() {
+            for (const auto& event_candidates : candidates) {
+                n_found += event_candidates.size();
+                n_fitted += host_fitting(det, field, event_candidates).size();
+            }
+        });
+
+        std::cout << std::setw(10) << n_tracks << std::fixed
+                  << std::setprecision(4) << std::setw(14) << sim_time
+                  << std::setw(14) << finding_time << std::setw(14)
+                  << fitting_time << std::setw(12) << n_found
+                  << std::setw(12) << n_fitted << std::endl;
+    }
+
+    return EXIT_SUCCESS;
+}
+
+// The main routine
+//
+int main(int argc, char* argv[]) {
+
+    // Program options.
+    traccc::opts::generation generation_opts;
+    traccc::opts::track_finding finding_opts;
+    traccc::opts::track_propagation propagation_opts;
+    traccc::opts::threading threading_opts;
+    traccc::opts::program_options program_opts{
+        "In-Memory Simulation + Reconstruction Benchmark on the Host",
+        {generation_opts, finding_opts, propagation_opts, threading_opts},
+        argc,
+        argv};
+
+    // Run the application.
+    return run(generation_opts, finding_opts, propagation_opts,
+               threading_opts);
+}
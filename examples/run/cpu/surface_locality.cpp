@@ -0,0 +1,122 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Project include(s).
+#include "traccc/definitions/primitives.hpp"
+#include "traccc/geometry/surface_locality.hpp"
+#include "traccc/io/utils.hpp"
+#include "traccc/options/detector.hpp"
+#include "traccc/options/output_data.hpp"
+#include "traccc/options/program_options.hpp"
+
+// Detray include(s).
+#include "detray/core/detector.hpp"
+#include "detray/core/detector_metadata.hpp"
+#include "detray/io/frontend/detector_reader.hpp"
+
+// VecMem include(s).
+#include <vecmem/memory/host_memory_resource.hpp>
+
+// System include(s).
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <vector>
+
+/// Analyse the navigation locality of the surface order of a detector
+///
+/// The surfaces of a Detray detector are stored in the order of its input
+/// files, with their transforms and masks in the same order. So the surfaces
+/// that a track crosses one after the other may be far apart in these
+/// stores. This application orders the surfaces by volume, layer and
+/// azimuth (see @c traccc::surface_locality_order), and compares the number
+/// of transform cache lines touched by going around every layer in the
+/// current, and in the proposed order.
+///
+/// The proposed order is written into @c surface_order.csv in the output
+/// directory, with the Acts geometry identifier, the volume, and the
+/// current and proposed (global) index of every surface. For the detector
+/// building to renumber the surfaces with. The barcode maps of
+/// @c traccc::io::read_geometry, and the surface indices of the track
+/// finding, follow from the renumbered detector.
+///
+int main(int argc, char* argv[]) {
+
+    // Program options.
+    traccc::opts::detector detector_opts;
+    traccc::opts::output_data output_opts;
+    traccc::opts::program_options program_opts{
+        "Surface Locality Analysis", {detector_opts, output_opts}, argc, argv};
+
+    // Read the detector.
+    using detector_type = detray::detector<detray::default_metadata,
+                                           detray::host_container_types>;
+    vecmem::host_memory_resource host_mr;
+    detray::io::detector_reader_config reader_cfg{};
+    reader_cfg.add_file(
+        traccc::io::data_directory() + detector_opts.detector_file);
+    if (!detector_opts.grid_file.empty()) {
+        reader_cfg.add_file(traccc::io::data_directory() +
+                            detector_opts.grid_file);
+    }
+    const auto [det, names] =
+        detray::io::read_detector<detector_type>(host_mr, reader_cfg);
+
+    // Order the surfaces for locality.
+    const std::vector<traccc::surface_locality_key> keys =
+        traccc::surface_locality_order(det);
+
+    // Count the transform cache lines touched by going around every layer,
+    // with the current and with the proposed indices of the surfaces.
+    std::size_t n_layers = 0, current_lines = 0, proposed_lines = 0;
+    std::vector<unsigned int> current, proposed;
+    for (std::size_t i = 0; i < keys.size(); ++i) {
+        current.push_back(keys[i].index);
+        proposed.push_back(static_cast<unsigned int>(i));
+        if ((i + 1 == keys.size()) || (keys[i + 1].volume != keys[i].volume) ||
+            (keys[i + 1].layer != keys[i].layer)) {
+            ++n_layers;
+            current_lines +=
+                traccc::count_cache_lines(current, sizeof(traccc::transform3));
+            proposed_lines +=
+                traccc::count_cache_lines(proposed, sizeof(traccc::transform3));
+            current.clear();
+            proposed.clear();
+        }
+    }
+    std::cout << "Surfaces: " << keys.size() << ", layers: " << n_layers
+              << "\n"
+              << "Transform cache lines touched going around the layers:\n"
+              << "  current order:  " << current_lines << "\n"
+              << "  proposed order: " << proposed_lines << " ("
+              << std::fixed << std::setprecision(1)
+              << (current_lines > 0 ? 100. * static_cast<double>(
+                                                 proposed_lines) /
+                                          static_cast<double>(current_lines)
+                                    : 100.)
+              << "%)" << std::endl;
+
+    // Write the proposed order.
+    const std::filesystem::path filename =
+        std::filesystem::path{output_opts.directory} / "surface_order.csv";
+    std::filesystem::create_directories(filename.parent_path());
+    std::ofstream out(filename);
+    if (!out) {
+        std::cerr << "Could not open file: " << filename << std::endl;
+        return EXIT_FAILURE;
+    }
+    out << "geometry_id,volume_id,current_index,proposed_index\n";
+    for (std::size_t i = 0; i < keys.size(); ++i) {
+        out << det.surfaces()[keys[i].index].source << ',' << keys[i].volume
+            << ',' << keys[i].index << ',' << i << '\n';
+    }
+    std::cout << "Wrote the proposed order into: " << filename << std::endl;
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,452 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Project include(s).
+#include "traccc/ambiguity_resolution/greedy_ambiguity_resolution_algorithm.hpp"
+#include "traccc/clusterization/clusterization_algorithm.hpp"
+#include "traccc/clusterization/spacepoint_formation.hpp"
+#include "traccc/finding/finding_algorithm.hpp"
+#include "traccc/fitting/fitting_algorithm.hpp"
+#include "traccc/seeding/seeding_algorithm.hpp"
+#include "traccc/seeding/track_params_estimation.hpp"
+
+// I/O include(s).
+#include "traccc/io/async_writer.hpp"
+#include "traccc/io/read_cells.hpp"
+#include "traccc/io/read_digitization_config.hpp"
+#include "traccc/io/read_geometry.hpp"
+#include "traccc/io/utils.hpp"
+
+// Command line option include(s).
+#include "traccc/options/detector.hpp"
+#include "traccc/options/input_data.hpp"
+#include "traccc/options/pipeline.hpp"
+#include "traccc/options/program_options.hpp"
+#include "traccc/options/threading.hpp"
+#include "traccc/options/track_finding.hpp"
+#include "traccc/options/track_propagation.hpp"
+#include "traccc/options/track_resolution.hpp"
+#include "traccc/options/track_seeding.hpp"
+
+// Detray include(s).
+#include "detray/core/detector.hpp"
+#include "detray/detectors/bfield.hpp"
+#include "detray/io/frontend/detector_reader.hpp"
+#include "detray/navigation/navigator.hpp"
+#include "detray/propagator/rk_stepper.hpp"
+
+// VecMem include(s).
+#include <vecmem/memory/host_memory_resource.hpp>
+
+// TBB include(s).
+#include <tbb/flow_graph.h>
+#include <tbb/global_control.h>
+
+// System include(s).
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace {
+
+/// Type of the detector used in the example
+using detector_type =
+    detray::detector<detray::default_metadata, detray::host_container_types>;
+/// Stepper type used by the track finding and fitting algorithms
+using stepper_type =
+    detray::rk_stepper<detray::bfield::const_field_t::view_t,
+                       detector_type::transform3, detray::constrained_step<>>;
+/// Navigator type used by the track finding and fitting algorithms
+using navigator_type = detray::navigator<const detector_type>;
+/// Track finding algorithm type
+using finding_algorithm =
+    traccc::finding_algorithm<stepper_type, navigator_type>;
+/// Track fitting algorithm type
+using fitting_algorithm = traccc::fitting_algorithm<
+    traccc::kalman_fitter<stepper_type, navigator_type>>;
+
+/// The data of one event, travelling through the pipeline
+struct event_data {
+
+    /// Constructor with the event index and the memory resource to use
+    event_data(std::size_t event_index, vecmem::memory_resource& mr)
+        : event(event_index),
+          input(&mr),
+          measurements(&mr),
+          spacepoints(&mr),
+          seeds(&mr),
+          params(&mr),
+          track_candidates(&mr),
+          track_states(&mr) {}
+
+    /// The index of the event
+    std::size_t event;
+    /// The cells and modules of the event
+    traccc::io::cell_reader_output input;
+    /// The reconstructed measurements
+    traccc::measurement_collection_types::host measurements;
+    /// The reconstructed spacepoints
+    traccc::spacepoint_collection_types::host spacepoints;
+    /// The reconstructed seeds
+    traccc::seed_collection_types::host seeds;
+    /// The estimated track parameters
+    traccc::bound_track_parameters_collection_types::host params;
+    /// The found track candidates
+    finding_algorithm::output_type track_candidates;
+    /// The fitted (and possibly resolved) tracks
+    fitting_algorithm::output_type track_states;
+
+};  // struct event_data
+
+/// Type of the messages passed between the nodes of the pipeline
+using event_ptr = std::shared_ptr<event_data>;
+
+/// Usage statistics of one node of the pipeline
+struct node_statistics {
+
+    /// Constructor with the name and concurrency limit of the node
+    node_statistics(std::string node_name, std::size_t node_concurrency)
+        : name(std::move(node_name)), concurrency(node_concurrency) {}
+
+    /// The name of the node
+    std::string name;
+    /// The concurrency limit of the node (0: unlimited)
+    std::size_t concurrency;
+    /// The number of events processed by the node
+    std::atomic<std::size_t> calls{0};
+    /// The total time spent in the node's body [ns]
+    std::atomic<std::int64_t> busy{0};
+
+};  // struct node_statistics
+
+/// Wrap a node body, recording its usage
+template <typename INPUT, typename FUNC>
+auto timed(node_statistics& stats, FUNC&& func) {
+
+    return [&stats, func = std::forward<FUNC>(func)](const INPUT& input) {
+        const auto start = std::chrono::steady_clock::now();
+        auto result = func(input);
+        stats.busy += std::chrono::duration_cast<std::chrono::nanoseconds>(
+                          std::chrono::steady_clock::now() - start)
+                          .count();
+        ++stats.calls;
+        return result;
+    };
+}
+
+/// Translate a concurrency limit into a TBB one
+std::size_t node_concurrency(std::size_t limit) {
+
+    return ((limit == 0) ? static_cast<std::size_t>(tbb::flow::unlimited)
+                         : limit);
+}
+
+}  // namespace
+
+int pipeline_run(const traccc::opts::input_data& input_opts,
+                 const traccc::opts::detector& detector_opts,
+                 const traccc::opts::track_seeding& seeding_opts,
+                 const traccc::opts::track_finding& finding_opts,
+                 const traccc::opts::track_propagation& propagation_opts,
+                 const traccc::opts::track_resolution& resolution_opts,
+                 const traccc::opts::threading& threading_opts,
+                 const traccc::opts::pipeline& pipeline_opts) {
+
+    // Limit the number of threads used by TBB.
+    tbb::global_control global_thread_limit(
+        tbb::global_control::max_allowed_parallelism, threading_opts.threads);
+
+    // Memory resource used by the application. (It is thread-safe.)
+    vecmem::host_memory_resource host_mr;
+
+    // Read in the geometry.
+    // (Not using a structured binding, as the reading node has to capture
+    // the objects.)
+    auto geometry_data = traccc::io::read_geometry(
+        detector_opts.detector_file,
+        (detector_opts.use_detray_detector ? traccc::data_format::json
+                                           : traccc::data_format::csv),
+        detector_opts.cache_directory);
+    const traccc::geometry& surface_transforms = geometry_data.first;
+    const auto* barcode_map = geometry_data.second.get();
+    detector_type detector{host_mr};
+    if (detector_opts.use_detray_detector) {
+        detray::io::detector_reader_config cfg;
+        cfg.add_file(traccc::io::data_directory() +
+                     detector_opts.detector_file);
+        if (detector_opts.material_file.empty() == false) {
+            cfg.add_file(traccc::io::data_directory() +
+                         detector_opts.material_file);
+        }
+        if (detector_opts.grid_file.empty() == false) {
+            cfg.add_file(traccc::io::data_directory() +
+                         detector_opts.grid_file);
+        }
+        detector =
+            std::move(detray::io::read_detector<detector_type>(host_mr, cfg)
+                          .first);
+    }
+
+    // Read the digitization configuration file
+    auto digi_cfg = traccc::io::read_digitization_config(
+        detector_opts.digitization_file, traccc::data_format::json,
+        detector_opts.cache_directory);
+
+    // Constant B field for the track finding and fitting
+    const traccc::vector3 field_vec = {0.f, 0.f,
+                                       seeding_opts.seedfinder.bFieldInZ};
+    const detray::bfield::const_field_t field =
+        detray::bfield::create_const_field(field_vec);
+
+    // Algorithm configuration(s).
+    finding_algorithm::config_type finding_cfg;
+    finding_cfg.min_track_candidates_per_track =
+        finding_opts.track_candidates_range[0];
+    finding_cfg.max_track_candidates_per_track =
+        finding_opts.track_candidates_range[1];
+    finding_cfg.chi2_max = finding_opts.chi2_max;
+    finding_cfg.host_params_per_task = finding_opts.host_params_per_task;
+    finding_cfg.branching = finding_opts.best_chi2_branching
+                                ? traccc::branching_policy::e_best_chi2
+                                : traccc::branching_policy::e_first_compatible;
+    finding_cfg.propagation = propagation_opts.config;
+
+    fitting_algorithm::config_type fitting_cfg;
+    fitting_cfg.propagation = propagation_opts.config;
+
+    // Algorithms. They are all stateless, so every node can run its
+    // algorithm on several events at the same time.
+    traccc::clusterization_algorithm ca(host_mr);
+    traccc::spacepoint_formation sf(host_mr);
+    traccc::seeding_algorithm sa(seeding_opts.seedfinder,
+                                 {seeding_opts.seedfinder},
+                                 seeding_opts.seedfilter, host_mr);
+    traccc::track_params_estimation tp(host_mr);
+    finding_algorithm finding_alg(finding_cfg);
+    fitting_algorithm fitting_alg(fitting_cfg);
+    traccc::greedy_ambiguity_resolution_algorithm resolution_alg;
+
+    // The writer of the results, if requested.
+    std::unique_ptr<traccc::io::async_writer> writer;
+    if (!pipeline_opts.output_file.empty()) {
+        writer = std::make_unique<traccc::io::async_writer>(
+            pipeline_opts.output_file, pipeline_opts.output_queue_depth);
+    }
+
+    // The reconstruction stages of the pipeline.
+    struct stage {
+        std::string name;
+        std::function<void(event_data&)> body;
+    };
+    std::vector<stage> stages;
+    stages.push_back({"clusterization", [&](event_data& data) {
+                          data.measurements =
+                              ca(data.input.cells, data.input.modules);
+                      }});
+    stages.push_back({"spacepoints", [&](event_data& data) {
+                          data.spacepoints =
+                              sf(data.measurements, data.input.modules);
+                      }});
+    stages.push_back({"seeding", [&](event_data& data) {
+                          data.seeds = sa(data.spacepoints);
+                      }});
+    stages.push_back({"params", [&](event_data& data) {
+                          data.params =
+                              tp(data.spacepoints, data.seeds, field_vec);
+                      }});
+    if (detector_opts.use_detray_detector) {
+        stages.push_back(
+            {"finding", [&](event_data& data) {
+                 // The track finding expects the measurements to be ordered
+                 // by surface.
+                 std::sort(data.measurements.begin(), data.measurements.end(),
+                           traccc::measurement_sort_comp());
+                 data.track_candidates = finding_alg(
+                     detector, field, data.measurements, data.params);
+             }});
+        stages.push_back({"fitting", [&](event_data& data) {
+                              data.track_states = fitting_alg(
+                                  detector, field, data.track_candidates);
+                          }});
+        if (resolution_opts.run) {
+            stages.push_back({"resolution", [&](event_data& data) {
+                                  data.track_states =
+                                      resolution_alg(data.track_states);
+                              }});
+        }
+    }
+
+    // Output stats
+    std::atomic<std::size_t> n_cells{0}, n_measurements{0}, n_spacepoints{0},
+        n_seeds{0}, n_found_tracks{0}, n_fitted_tracks{0};
+
+    // Usage statistics of all nodes, in the order of the pipeline.
+    std::vector<std::unique_ptr<node_statistics>> node_stats;
+    auto make_stats = [&](const std::string& name) -> node_statistics& {
+        node_stats.push_back(std::make_unique<node_statistics>(
+            name, pipeline_opts.concurrency(name)));
+        return *(node_stats.back());
+    };
+
+    // Set up the flow graph.
+    tbb::flow::graph graph;
+
+    // The source of the event indices.
+    std::size_t next_event = input_opts.skip;
+    tbb::flow::input_node<std::size_t> source(
+        graph, [&](tbb::flow_control& fc) -> std::size_t {
+            if (next_event >= input_opts.skip + input_opts.events) {
+                fc.stop();
+                return 0;
+            }
+            return next_event++;
+        });
+    // Bound the number of events in flight.
+    tbb::flow::limiter_node<std::size_t> token_limiter(graph,
+                                                      pipeline_opts.tokens);
+
+    // The reading of the events.
+    node_statistics& read_stats = make_stats("read");
+    tbb::flow::function_node<std::size_t, event_ptr> read_node(
+        graph, node_concurrency(read_stats.concurrency),
+        timed<std::size_t>(read_stats, [&](std::size_t event) {
+            auto data = std::make_shared<event_data>(event, host_mr);
+            traccc::io::read_cells(data->input, event, input_opts.directory,
+                                   input_opts.format, &surface_transforms,
+                                   &digi_cfg, barcode_map);
+            return data;
+        }));
+
+    // The reconstruction stages.
+    std::vector<std::unique_ptr<tbb::flow::function_node<event_ptr, event_ptr>>>
+        stage_nodes;
+    for (const stage& s : stages) {
+        node_statistics& stats = make_stats(s.name);
+        stage_nodes.push_back(
+            std::make_unique<tbb::flow::function_node<event_ptr, event_ptr>>(
+                graph, node_concurrency(stats.concurrency),
+                timed<event_ptr>(stats, [&s](const event_ptr& data) {
+                    s.body(*data);
+                    return data;
+                })));
+    }
+
+    // The writing of the results, which also collects the statistics.
+    node_statistics& write_stats = make_stats("write");
+    tbb::flow::function_node<event_ptr, tbb::flow::continue_msg> write_node(
+        graph, node_concurrency(write_stats.concurrency),
+        timed<event_ptr>(write_stats, [&](const event_ptr& data) {
+            n_cells += data->input.cells.size();
+            n_measurements += data->measurements.size();
+            n_spacepoints += data->spacepoints.size();
+            n_seeds += data->seeds.size();
+            n_found_tracks += data->track_candidates.size();
+            n_fitted_tracks += data->track_states.size();
+            if (writer) {
+                if (detector_opts.use_detray_detector) {
+                    writer->write(data->event, data->track_states);
+                } else {
+                    writer->write(data->event, data->params);
+                }
+            }
+            return tbb::flow::continue_msg{};
+        }));
+
+    // Connect the nodes.
+    tbb::flow::make_edge(source, token_limiter);
+    tbb::flow::make_edge(token_limiter, read_node);
+    tbb::flow::sender<event_ptr>* previous = &read_node;
+    for (auto& node : stage_nodes) {
+        tbb::flow::make_edge(*previous, *node);
+        previous = node.get();
+    }
+    tbb::flow::make_edge(*previous, write_node);
+    tbb::flow::make_edge(write_node, token_limiter.decrementer());
+
+    // Process all events.
+    const auto start = std::chrono::steady_clock::now();
+    source.activate();
+    graph.wait_for_all();
+    if (writer) {
+        writer->flush();
+    }
+    const std::chrono::duration<double> wall_time =
+        std::chrono::steady_clock::now() - start;
+
+    std::cout << "==> Statistics ... " << std::endl;
+    std::cout << "- read     " << n_cells << " cells" << std::endl;
+    std::cout << "- created  " << n_measurements << " measurements"
+              << std::endl;
+    std::cout << "- created  " << n_spacepoints << " space points"
+              << std::endl;
+    std::cout << "- created  " << n_seeds << " seeds" << std::endl;
+    std::cout << "- found    " << n_found_tracks << " tracks" << std::endl;
+    std::cout << "- fitted   " << n_fitted_tracks << " tracks" << std::endl;
+    std::cout << "==> Processed " << input_opts.events << " events in "
+              << wall_time.count() << " s ("
+              << static_cast<double>(input_opts.events) / wall_time.count()
+              << " events/s)" << std::endl;
+
+    // Print the utilization of the nodes. That is, the fraction of the time
+    // that the node's "slots" (as given by its concurrency limit and the
+    // number of threads) were busy.
+    std::cout << "==> Node utilization ..." << std::endl;
+    for (const auto& stats : node_stats) {
+        const std::size_t slots =
+            ((stats->concurrency == 0)
+                 ? threading_opts.threads
+                 : std::min(stats->concurrency, threading_opts.threads));
+        const double busy = static_cast<double>(stats->busy.load()) * 1e-9;
+        const std::size_t calls = stats->calls.load();
+        std::cout << std::setw(16) << std::right << stats->name << "  "
+                  << std::fixed << std::setprecision(1) << std::setw(5)
+                  << 100. * busy /
+                         (wall_time.count() * static_cast<double>(slots))
+                  << "% of " << slots << " slot(s), "
+                  << std::setprecision(3)
+                  << ((calls > 0) ? 1e3 * busy / static_cast<double>(calls)
+                                  : 0.)
+                  << " ms/event" << std::defaultfloat << std::endl;
+    }
+
+    return EXIT_SUCCESS;
+}
+
+// The main routine
+//
+int main(int argc, char* argv[]) {
+
+    // Program options.
+    traccc::opts::detector detector_opts;
+    traccc::opts::input_data input_opts;
+    traccc::opts::track_seeding seeding_opts;
+    traccc::opts::track_finding finding_opts;
+    traccc::opts::track_propagation propagation_opts;
+    traccc::opts::track_resolution resolution_opts;
+    traccc::opts::threading threading_opts;
+    traccc::opts::pipeline pipeline_opts;
+    traccc::opts::program_options program_opts{
+        "Pipelined Full Tracking Chain on the Host",
+        {detector_opts, input_opts, seeding_opts, finding_opts,
+         propagation_opts, resolution_opts, threading_opts, pipeline_opts},
+        argc,
+        argv};
+
+    // Run the application.
+    return pipeline_run(input_opts, detector_opts, seeding_opts, finding_opts,
+                        propagation_opts, resolution_opts, threading_opts,
+                        pipeline_opts);
+}
@@ -1,6 +1,6 @@
 /** TRACCC library, part of the ACTS project (R&D line)
  *
- * (c) 2021-2022 CERN for the benefit of the ACTS project
+ * (c) 2021-2024 CERN for the benefit of the ACTS project
  *
  * Mozilla Public License Version 2.0
  */
@@ -10,9 +10,14 @@
 
 #include "full_chain_algorithm.hpp"
 
+// Project include(s).
+#include "traccc/utils/thread_caching_memory_resource.hpp"
+
 int main(int argc, char* argv[]) {
 
-    // Execute the throughput test.
-    return traccc::throughput_mt<traccc::full_chain_algorithm>(
+    // Execute the throughput test, with the host memory served from the
+    // caches of the worker threads.
+    return traccc::throughput_mt<traccc::full_chain_algorithm,
+                                 traccc::thread_caching_memory_resource>(
         "Multi-threaded host-only throughput tests", argc, argv);
 }
@@ -0,0 +1,256 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Project include(s).
+#include "traccc/cuda/finding/finding_algorithm.hpp"
+#include "traccc/cuda/fitting/fitting_algorithm.hpp"
+#include "traccc/cuda/utils/magnetic_field.hpp"
+#include "traccc/cuda/utils/stream.hpp"
+#include "traccc/definitions/common.hpp"
+#include "traccc/definitions/primitives.hpp"
+#include "traccc/fitting/kalman_filter/kalman_fitter.hpp"
+#include "traccc/io/event_map2.hpp"
+#include "traccc/io/read_magnetic_field.hpp"
+#include "traccc/io/read_measurements.hpp"
+#include "traccc/io/utils.hpp"
+#include "traccc/options/detector.hpp"
+#include "traccc/options/input_data.hpp"
+#include "traccc/options/program_options.hpp"
+#include "traccc/options/track_finding.hpp"
+#include "traccc/options/track_propagation.hpp"
+#include "traccc/performance/timer.hpp"
+#include "traccc/utils/seed_generator.hpp"
+
+// detray include(s).
+#include "detray/core/detector.hpp"
+#include "detray/core/detector_metadata.hpp"
+#include "detray/detectors/bfield.hpp"
+#include "detray/io/frontend/detector_reader.hpp"
+#include "detray/navigation/navigator.hpp"
+#include "detray/propagator/propagator.hpp"
+#include "detray/propagator/rk_stepper.hpp"
+
+// VecMem include(s).
+#include <vecmem/memory/cuda/device_memory_resource.hpp>
+#include <vecmem/memory/cuda/host_memory_resource.hpp>
+#include <vecmem/memory/cuda/managed_memory_resource.hpp>
+#include <vecmem/memory/host_memory_resource.hpp>
+#include <vecmem/utils/cuda/async_copy.hpp>
+
+// System include(s).
+#include <algorithm>
+#include <iostream>
+#include <string>
+#include <vector>
+
+using namespace traccc;
+
+namespace {
+
+/// Detector types
+using host_detector_type =
+    detray::detector<detray::default_metadata, detray::host_container_types>;
+using device_detector_type =
+    detray::detector<detray::default_metadata, detray::device_container_types>;
+using device_navigator_type = detray::navigator<const device_detector_type>;
+
+/// The input of one event
+struct event_input {
+    /// The measurements of the event, on the device
+    measurement_collection_types::buffer measurements;
+    /// The truth seeds of the event, on the device
+    bound_track_parameters_collection_types::buffer seeds;
+};
+
+/// Run the device track finding and fitting with one type of magnetic field
+///
+/// @param name   The name of the field type, used for the timers
+/// @param field  The magnetic field
+/// @param inputs The inputs of all events
+///
+template <typename field_t>
+void run_with_field(const std::string& name, const field_t& field,
+                    const host_detector_type& host_det,
+                    host_detector_type::view_type det_view,
+                    const std::vector<event_input>& inputs,
+                    const opts::track_finding& finding_opts,
+                    const opts::track_propagation& propagation_opts,
+                    const traccc::memory_resource& mr, vecmem::copy& copy,
+                    cuda::stream& stream,
+                    performance::timing_info& elapsed_times) {
+
+    // Algorithm types
+    using stepper_type =
+        detray::rk_stepper<typename field_t::view_t, traccc::transform3,
+                           detray::constrained_step<>>;
+    using finding_algorithm_type =
+        cuda::finding_algorithm<stepper_type, device_navigator_type>;
+    using fitting_algorithm_type = cuda::fitting_algorithm<
+        kalman_fitter<stepper_type, device_navigator_type>>;
+
+    // Algorithm configurations
+    typename finding_algorithm_type::config_type cfg;
+    cfg.min_track_candidates_per_track = finding_opts.track_candidates_range[0];
+    cfg.max_track_candidates_per_track = finding_opts.track_candidates_range[1];
+    cfg.chi2_max = finding_opts.chi2_max;
+    cfg.propagation = propagation_opts.config;
+
+    typename fitting_algorithm_type::config_type fit_cfg;
+    fit_cfg.propagation = propagation_opts.config;
+
+    finding_algorithm_type device_finding(cfg, mr, copy, stream);
+    fitting_algorithm_type device_fitting(fit_cfg, mr, copy, stream);
+
+    std::size_t n_tracks = 0;
+    for (const event_input& input : inputs) {
+
+        // Navigation buffer
+        auto navigation_buffer = detray::create_candidates_buffer(
+            host_det,
+            std::min<std::size_t>(cfg.max_num_branches_per_seed *
+                                      copy.get_size(input.seeds),
+                                  propagation_opts.navigation_buffer_size),
+            mr.main, mr.host);
+
+        track_candidate_container_types::buffer track_candidates_buffer{
+            {{}, *(mr.host)}, {{}, *(mr.host), mr.host}};
+        {
+            performance::timer t("Track finding  (" + name + ")",
+                                 elapsed_times);
+            track_candidates_buffer =
+                device_finding(det_view, field, navigation_buffer,
+                               input.measurements, input.seeds);
+        }
+
+        track_state_container_types::buffer track_states_buffer{
+            {{}, *(mr.host)}, {{}, *(mr.host), mr.host}};
+        {
+            performance::timer t("Track fitting  (" + name + ")",
+                                 elapsed_times);
+            track_states_buffer = device_fitting(
+                det_view, field, navigation_buffer, track_candidates_buffer);
+        }
+        n_tracks += copy.get_size(track_states_buffer.headers);
+    }
+
+    std::cout << "- fitted " << n_tracks << " tracks with the " << name
+              << " field" << std::endl;
+}
+
+}  // namespace
+
+// The main routine
+//
+int main(int argc, char* argv[]) {
+
+    // Program options.
+    opts::detector detector_opts;
+    opts::input_data input_opts;
+    opts::track_finding finding_opts;
+    opts::track_propagation propagation_opts;
+    opts::program_options program_opts{
+        "Magnetic Field Benchmark of the CUDA Track Finding and Fitting",
+        {detector_opts, input_opts, finding_opts, propagation_opts},
+        argc,
+        argv};
+
+    if (detector_opts.bfield_file.empty()) {
+        std::cerr << "A magnetic field map must be given with --bfield-file"
+                  << std::endl;
+        return 1;
+    }
+
+    // Memory resources used by the application.
+    vecmem::host_memory_resource host_mr;
+    vecmem::cuda::host_memory_resource cuda_host_mr;
+    vecmem::cuda::managed_memory_resource mng_mr;
+    vecmem::cuda::device_memory_resource device_mr;
+    traccc::memory_resource mr{device_mr, &cuda_host_mr};
+
+    cuda::stream stream;
+    vecmem::cuda::async_copy copy{stream.cudaStream()};
+
+    // Read the detector
+    detray::io::detector_reader_config reader_cfg{};
+    reader_cfg.add_file(io::data_directory() + detector_opts.detector_file);
+    if (!detector_opts.material_file.empty()) {
+        reader_cfg.add_file(io::data_directory() +
+                            detector_opts.material_file);
+    }
+    if (!detector_opts.grid_file.empty()) {
+        reader_cfg.add_file(io::data_directory() + detector_opts.grid_file);
+    }
+    auto [host_det, names] =
+        detray::io::read_detector<host_detector_type>(mng_mr, reader_cfg);
+    auto det_view = detray::get_data(host_det);
+
+    // The magnetic fields
+    const traccc::vector3 B{0, 0, 2 * detray::unit<traccc::scalar>::T};
+    const detray::bfield::const_field_t const_field =
+        detray::bfield::create_const_field(B);
+    const detray::bfield::inhom_field_t& host_field = io::read_magnetic_field(
+        io::data_directory() + detector_opts.bfield_file);
+    const cuda::inhom_global_field_t global_field =
+        cuda::make_global_field(host_field);
+    const cuda::inhom_texture_field_t texture_field =
+        cuda::make_texture_field(host_field);
+
+    // Standard deviations for seed track parameters
+    static constexpr std::array<traccc::scalar, traccc::e_bound_size> stddevs =
+        {1e-4 * detray::unit<traccc::scalar>::mm,
+         1e-4 * detray::unit<traccc::scalar>::mm,
+         1e-3,
+         1e-3,
+         1e-4 / detray::unit<traccc::scalar>::GeV,
+         1e-4 * detray::unit<traccc::scalar>::ns};
+    seed_generator<host_detector_type> sg(host_det, stddevs);
+
+    // Read all events up front, so that only the algorithms are timed.
+    std::vector<event_input> inputs;
+    for (unsigned int event = input_opts.skip;
+         event < input_opts.events + input_opts.skip; ++event) {
+
+        event_map2 evt_map2(event, input_opts.directory, input_opts.directory,
+                            input_opts.directory);
+        const track_candidate_container_types::host truth_track_candidates =
+            evt_map2.generate_truth_candidates(sg, host_mr);
+        bound_track_parameters_collection_types::host seeds(mr.host);
+        for (unsigned int i_trk = 0; i_trk < truth_track_candidates.size();
+             i_trk++) {
+            seeds.push_back(truth_track_candidates.at(i_trk).header);
+        }
+
+        io::measurement_reader_output meas_reader_output(mr.host);
+        io::read_measurements(meas_reader_output, event, input_opts.directory,
+                              input_opts.format);
+        const auto& measurements = meas_reader_output.measurements;
+
+        event_input input{
+            {static_cast<unsigned int>(measurements.size()), mr.main},
+            {static_cast<unsigned int>(seeds.size()), mr.main}};
+        copy(vecmem::get_data(measurements), input.measurements);
+        copy(vecmem::get_data(seeds), input.seeds);
+        inputs.push_back(std::move(input));
+    }
+    stream.synchronize();
+
+    // Run the reconstruction with all fields.
+    performance::timing_info elapsed_times;
+    std::cout << "==> Statistics ... " << std::endl;
+    run_with_field("constant", const_field, host_det, det_view, inputs,
+                   finding_opts, propagation_opts, mr, copy, stream,
+                   elapsed_times);
+    run_with_field("global memory, trilinear", global_field, host_det,
+                   det_view, inputs, finding_opts, propagation_opts, mr, copy,
+                   stream, elapsed_times);
+    run_with_field("texture memory, trilinear", texture_field, host_det,
+                   det_view, inputs, finding_opts, propagation_opts, mr, copy,
+                   stream, elapsed_times);
+    std::cout << "==>Elapsed times...\n" << elapsed_times << std::endl;
+
+    return 0;
+}
@@ -0,0 +1,74 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Local include(s).
+#include "../common/ccl_benchmark.hpp"
+
+// Project include(s).
+#include "traccc/cuda/clusterization/clusterization_algorithm.hpp"
+#include "traccc/cuda/utils/stream.hpp"
+
+// VecMem include(s).
+#include <vecmem/memory/cuda/device_memory_resource.hpp>
+#include <vecmem/utils/cuda/async_copy.hpp>
+
+// System include(s).
+#include <memory>
+
+namespace {
+
+/// Objects needed for running the CUDA clusterization
+struct cuda_ccl {
+
+    /// Constructor
+    cuda_ccl(const traccc::opts::clusterization& opts,
+             vecmem::memory_resource& host_mr)
+        : m_copy(m_stream.cudaStream()),
+          m_clusterization({m_device_mr, &host_mr}, m_copy, m_stream,
+                           opts.target_cells_per_partition, 32.f, true,
+                           false) {}
+
+    /// Upload one event, and run the clusterization on it
+    std::size_t operator()(
+        const traccc::cell_collection_types::host& cells,
+        const traccc::cell_module_collection_types::host& modules) {
+
+        traccc::cell_collection_types::buffer cells_buffer(cells.size(),
+                                                           m_device_mr);
+        m_copy(vecmem::get_data(cells), cells_buffer);
+        traccc::cell_module_collection_types::buffer modules_buffer(
+            modules.size(), m_device_mr);
+        m_copy(vecmem::get_data(modules), modules_buffer);
+
+        const auto spacepoints =
+            m_clusterization(cells_buffer, modules_buffer).first;
+        m_stream.synchronize();
+        return m_copy.get_size(spacepoints);
+    }
+
+    vecmem::cuda::device_memory_resource m_device_mr;
+    traccc::cuda::stream m_stream;
+    vecmem::cuda::async_copy m_copy;
+    traccc::cuda::clusterization_algorithm m_clusterization;
+};
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+
+    // Execute the benchmark. The latencies include the upload of the cells.
+    return traccc::ccl_benchmark(
+        "CUDA CCL benchmark", argc, argv,
+        [](const traccc::opts::clusterization& opts,
+           vecmem::memory_resource& host_mr)
+            -> traccc::ccl_benchmark_function_type {
+            auto ccl = std::make_shared<cuda_ccl>(opts, host_mr);
+            return [ccl](const traccc::cell_collection_types::host& cells,
+                         const traccc::cell_module_collection_types::host&
+                             modules) { return (*ccl)(cells, modules); };
+        });
+}
@@ -1,6 +1,6 @@
 /** TRACCC library, part of the ACTS project (R&D line)
  *
- * (c) 2022-2023 CERN for the benefit of the ACTS project
+ * (c) 2022-2024 CERN for the benefit of the ACTS project
  *
  * Mozilla Public License Version 2.0
  */
@@ -8,12 +8,26 @@
 // Local include(s).
 #include "full_chain_algorithm.hpp"
 
+// Project include(s).
+#include "traccc/cuda/utils/device_partitions.hpp"
+
 // CUDA include(s).
 #include <cuda_runtime_api.h>
 
 // System include(s).
+#include <algorithm>
+#include <cctype>
+#include <chrono>
+#include <cstdint>
+#include <fstream>
 #include <iostream>
+#include <new>
+#include <optional>
+#include <sstream>
 #include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
 
 /// Helper macro for checking the return value of CUDA function calls
 #define CUDA_ERROR_CHECK(EXP)                                                  \
@@ -26,94 +40,1298 @@
     } while (false)
 
 namespace traccc::cuda {
+namespace details {
+
+/// Helper class making a given CUDA device current during its lifetime
+class device_selector {
+
+    public:
+    /// Constructor, selecting the device (if it is a valid one)
+    explicit device_selector(int device) {
+
+        CUDA_ERROR_CHECK(cudaGetDevice(&m_previous));
+        if ((device != stream::INVALID_DEVICE) && (device != m_previous)) {
+            CUDA_ERROR_CHECK(cudaSetDevice(device));
+        }
+    }
+    /// Destructor, restoring the previously current device
+    ~device_selector() { cudaSetDevice(m_previous); }
+
+    private:
+    /// The device that was current before the selection
+    int m_previous = 0;
+
+};  // class device_selector
+
+/// Padding allowed per allocation of the detector's payload, for alignment
+static constexpr std::size_t PAYLOAD_ALIGNMENT_SLACK = 256;
+
+/// Memory resource handing out consecutive pieces of one block of memory
+///
+/// Used for the payload of the detector, so that it can be covered by a
+/// single (persisting L2 cache) access window. Memory is only given back to
+/// the upstream resource when the object is destroyed.
+///
+class detector_payload_resource : public vecmem::memory_resource {
+
+    public:
+    /// Constructor, allocating the block from the upstream resource
+    detector_payload_resource(vecmem::memory_resource& upstream,
+                              std::size_t size)
+        : m_upstream(upstream),
+          m_begin(static_cast<char*>(upstream.allocate(size))),
+          m_capacity(size) {}
+    /// Destructor, giving the block back to the upstream resource
+    ~detector_payload_resource() override {
+        m_upstream.deallocate(m_begin, m_capacity);
+    }
+
+    /// The start of the memory handed out
+    const void* data() const { return m_begin; }
+    /// The number of bytes handed out
+    std::size_t size() const { return m_size; }
+
+    private:
+    /// Hand out the next (suitably aligned) piece of the block
+    void* do_allocate(std::size_t bytes, std::size_t alignment) override {
+        const std::size_t offset =
+            (m_size + alignment - 1) / alignment * alignment;
+        if (offset + bytes > m_capacity) {
+            throw std::bad_alloc();
+        }
+        m_size = offset + bytes;
+        return m_begin + offset;
+    }
+    /// Pieces of the block are not re-used
+    void do_deallocate(void*, std::size_t, std::size_t) override {}
+    /// Compare the resource with another one
+    bool do_is_equal(
+        const vecmem::memory_resource& other) const noexcept override {
+        return this == &other;
+    }
+
+    /// The resource the block is allocated from
+    vecmem::memory_resource& m_upstream;
+    /// The start of the block
+    char* m_begin;
+    /// The size of the block
+    std::size_t m_capacity;
+    /// The number of bytes handed out
+    std::size_t m_size = 0;
+
+};  // class detector_payload_resource
+
+/// Immutable state shared by the copies of
+/// @c traccc::cuda::full_chain_algorithm
+struct full_chain_algorithm_context {
+
+    /// Constructor, copying the detector (if there is one) to the device
+    full_chain_algorithm_context(
+        int device, unsigned short target_cells_per_partition,
+        const seedfinder_config& finder_config,
+        const spacepoint_grid_config& grid_config,
+        const seedfilter_config& filter_config,
+        const finding_config<scalar>& track_finding_config,
+        const fitting_config<scalar>& track_fitting_config,
+        const full_chain_algorithm::host_detector_type* detector,
+        bool run_ambiguity_resolution, bool use_graph)
+        : m_device(device),
+          m_target_cells_per_partition(target_cells_per_partition),
+          m_finder_config(finder_config),
+          m_grid_config(grid_config),
+          m_filter_config(filter_config),
+          m_finding_config(track_finding_config),
+          m_fitting_config(track_fitting_config),
+          m_run_ambiguity_resolution(run_ambiguity_resolution),
+          m_use_graph(use_graph),
+          m_detector(detector),
+          m_field(detray::bfield::create_const_field(
+              vector3{0.f, 0.f, finder_config.bFieldInZ})),
+          m_device_mr(device) {
+
+        // Without a detector there is nothing else to do.
+        if (m_detector == nullptr) {
+            return;
+        }
+
+        // Copy the detector's payload into one block of (non-cached) device
+        // memory, which stays allocated for the lifetime of the context. The
+        // size of the block is found by a first copy, made through an
+        // instrumented resource.
+        device_selector selector{m_device};
+        stream copy_stream{m_device};
+        vecmem::cuda::async_copy copy{copy_stream.cudaStream()};
+        std::size_t payload_size = 0;
+        {
+            instrumented_memory_resource sizing_mr(m_device_mr);
+            auto sizing_buffer =
+                detray::get_buffer(*m_detector, sizing_mr, copy);
+            copy_stream.synchronize();
+            const memory_usage usage = sizing_mr.statistics().total;
+            payload_size = usage.allocated_bytes +
+                           usage.allocations * PAYLOAD_ALIGNMENT_SLACK;
+        }
+        m_detector_mr = std::make_unique<detector_payload_resource>(
+            m_device_mr, payload_size);
+        m_device_detector =
+            detray::get_buffer(*m_detector, *m_detector_mr, copy);
+        copy_stream.synchronize();
+        m_device_detector_view = detray::get_data(m_device_detector);
+    }
+
+    /// The CUDA device that the context was set up on
+    int m_device;
+    /// The average number of cells in each partition
+    unsigned short m_target_cells_per_partition;
+
+    /// Configs
+    seedfinder_config m_finder_config;
+    spacepoint_grid_config m_grid_config;
+    seedfilter_config m_filter_config;
+    finding_config<scalar> m_finding_config;
+    fitting_config<scalar> m_fitting_config;
+
+    /// Flag for running the ambiguity resolution
+    bool m_run_ambiguity_resolution;
+    /// Flag for using a CUDA graph for the clusterization
+    bool m_use_graph;
+
+    /// Host detector, used during track finding and fitting
+    const full_chain_algorithm::host_detector_type* m_detector;
+    /// Constant magnetic field used by the track finding and fitting
+    detray::bfield::const_field_t m_field;
+    /// Device memory resource holding the detector's payload
+    vecmem::cuda::device_memory_resource m_device_mr;
+    /// The (contiguous) block of memory holding the detector's payload
+    std::unique_ptr<detector_payload_resource> m_detector_mr;
+    /// Buffer holding the detector's payload on the device
+    full_chain_algorithm::host_detector_type::buffer_type m_device_detector;
+    /// View of the detector's payload on the device
+    full_chain_algorithm::host_detector_type::view_type m_device_detector_view;
+
+};  // struct full_chain_algorithm_context
+
+/// Persistent state of the CUDA graph execution of
+/// @c traccc::cuda::full_chain_algorithm
+struct full_chain_algorithm_graph {
+
+    /// Constructor, allocating the capacity bounded buffers
+    full_chain_algorithm_graph(unsigned int cell_capacity,
+                               unsigned int module_capacity,
+                               vecmem::memory_resource& mr, vecmem::copy& copy)
+        : m_cell_capacity(cell_capacity),
+          m_module_capacity(module_capacity),
+          m_cells(cell_capacity, mr, vecmem::data::buffer_type::resizable),
+          m_modules(module_capacity, mr, vecmem::data::buffer_type::resizable),
+          m_measurements(cell_capacity, mr,
+                         vecmem::data::buffer_type::resizable),
+          m_spacepoints(cell_capacity, mr,
+                        vecmem::data::buffer_type::resizable),
+          m_ccl_backup(clusterization_algorithm::ccl_backup_size(cell_capacity),
+                       mr) {
+
+        copy.setup(m_cells);
+        copy.setup(m_modules);
+        copy.setup(m_measurements);
+        copy.setup(m_spacepoints);
+    }
+
+    /// Destructor, releasing the executable graph
+    ~full_chain_algorithm_graph() {
+
+        if (m_exec != nullptr) {
+            cudaGraphExecDestroy(m_exec);
+        }
+    }
+
+    /// The maximum number of cells that the graph can process
+    unsigned int m_cell_capacity;
+    /// The maximum number of modules that the graph can process
+    unsigned int m_module_capacity;
+
+    /// Input cells
+    cell_collection_types::buffer m_cells;
+    /// Input modules
+    cell_module_collection_types::buffer m_modules;
+    /// Measurements made by the clusterization
+    measurement_collection_types::buffer m_measurements;
+    /// Spacepoints made by the clusterization
+    spacepoint_collection_types::buffer m_spacepoints;
+    /// Scratch space of the clusterization
+    vecmem::data::vector_buffer<unsigned int> m_ccl_backup;
+
+    /// Whether the graph reads the modules from the module table, instead of
+    /// @c m_modules
+    bool m_uses_module_table = false;
+
+    /// The executable graph
+    cudaGraphExec_t m_exec = nullptr;
+
+};  // struct full_chain_algorithm_graph
+
+/// Device copy of the module table of @c traccc::cuda::full_chain_algorithm
+struct full_chain_algorithm_module_table {
+
+    /// Constructor, uploading the modules and their descriptors
+    full_chain_algorithm_module_table(
+        const cell_module_collection_types::host& modules,
+        vecmem::memory_resource& mr, vecmem::copy& copy)
+        : m_host_modules(&modules),
+          m_modules(static_cast<unsigned int>(modules.size()), mr),
+          m_descriptors(static_cast<unsigned int>(modules.size()), mr) {
+
+        copy.setup(m_modules);
+        copy(vecmem::get_data(modules), m_modules,
+             vecmem::copy::type::host_to_device);
+        m_host_descriptors = make_module_descriptors(modules);
+        traccc::copy(copy, get_data(m_host_descriptors),
+                     get_data(m_descriptors),
+                     vecmem::copy::type::host_to_device);
+    }
+
+    /// The host module collection that was uploaded
+    const cell_module_collection_types::host* m_host_modules;
+    /// The modules on the device
+    cell_module_collection_types::buffer m_modules;
+    /// The descriptors of the modules (on the host, until the upload is done)
+    module_descriptor_soa_collection_types::host m_host_descriptors;
+    /// The descriptors of the modules on the device
+    module_descriptor_soa_collection_types::buffer m_descriptors;
+
+};  // struct full_chain_algorithm_module_table
+
+/// One slot of the input staging ring of
+/// @c traccc::cuda::full_chain_algorithm
+struct full_chain_algorithm_staging_slot {
+
+    /// Constructor, setting up the (empty) host buffers and the events
+    explicit full_chain_algorithm_staging_slot(vecmem::memory_resource& host_mr)
+        : m_host_cells(&host_mr), m_host_modules(&host_mr) {
+
+        CUDA_ERROR_CHECK(
+            cudaEventCreateWithFlags(&m_uploaded, cudaEventDisableTiming));
+        CUDA_ERROR_CHECK(
+            cudaEventCreateWithFlags(&m_consumed, cudaEventDisableTiming));
+    }
+
+    /// Destructor, releasing the events
+    ~full_chain_algorithm_staging_slot() {
+
+        cudaEventDestroy(m_uploaded);
+        cudaEventDestroy(m_consumed);
+    }
+
+    /// The cells staged in this slot (@c nullptr if the slot is free)
+    const cell_collection_types::host* m_cells = nullptr;
+    /// The modules staged in this slot
+    const cell_module_collection_types::host* m_modules = nullptr;
+
+    /// Page-locked copy of the staged cells
+    cell_collection_types::host m_host_cells;
+    /// Page-locked copy of the staged modules
+    cell_module_collection_types::host m_host_modules;
+
+    /// Device buffer for the staged cells
+    cell_collection_types::buffer m_device_cells;
+    /// Device buffer for the staged modules
+    cell_module_collection_types::buffer m_device_modules;
+    /// The number of cells that @c m_device_cells can hold
+    unsigned int m_cell_capacity = 0;
+    /// The number of modules that @c m_device_modules can hold
+    unsigned int m_module_capacity = 0;
+
+    /// Event marking the end of the upload into the slot
+    cudaEvent_t m_uploaded = nullptr;
+    /// Event marking the end of the processing of the slot's payload
+    cudaEvent_t m_consumed = nullptr;
+
+};  // struct full_chain_algorithm_staging_slot
+
+/// Device timestamps of the events processed by
+/// @c traccc::cuda::full_chain_algorithm
+struct full_chain_algorithm_timestamps {
+
+    /// Constructor, creating the (timing) events on the current device
+    full_chain_algorithm_timestamps() {
+
+        CUDA_ERROR_CHECK(cudaEventCreate(&m_upload_start));
+        CUDA_ERROR_CHECK(cudaEventCreate(&m_results_on_host));
+    }
+
+    /// Destructor, releasing the events
+    ~full_chain_algorithm_timestamps() {
+
+        cudaEventDestroy(m_upload_start);
+        cudaEventDestroy(m_results_on_host);
+    }
+
+    /// Event marking the start of the upload of the event's input
+    cudaEvent_t m_upload_start = nullptr;
+    /// Event marking the end of the copy of the event's results to the host
+    cudaEvent_t m_results_on_host = nullptr;
+    /// Whether both events were recorded for the last event
+    bool m_recorded = false;
+
+};  // struct full_chain_algorithm_timestamps
+
+/// Capacities of the seed finding, learnt from the previous events
+///
+/// Lets the seed finding of most events run without waiting for the doublet
+/// and triplet counts. Events not fitting into the predicted capacities are
+/// re-done with exact ones.
+///
+seed_finding_capacities adaptive_seeding_capacities() {
+
+    seed_finding_capacities result;
+    result.adaptive = true;
+    return result;
+}
+
+/// Create the caching device memory resource of a chain
+///
+/// Stream-ordered allocations from a memory pool are used when the device
+/// supports them. Keeping all freed memory in the pool, like the binary page
+/// cache used on other devices.
+///
+std::unique_ptr<vecmem::memory_resource> make_cached_device_mr(
+    const stream& str, int device, vecmem::memory_resource& device_mr) {
+
+    if (stream_ordered_memory_resource::is_supported(device)) {
+        return std::make_unique<stream_ordered_memory_resource>(str, device);
+    }
+    return std::make_unique<vecmem::binary_page_memory_resource>(device_mr);
+}
+
+/// Additional tracking pass of @c traccc::cuda::full_chain_algorithm
+struct full_chain_algorithm_tracking_pass {
+
+    /// Constructor with the configuration of the pass
+    full_chain_algorithm_tracking_pass(
+        const seedfinder_config& finder_config,
+        const spacepoint_grid_config& grid_config,
+        const seedfilter_config& filter_config,
+        const finding_config<scalar>& track_finding_config,
+        const traccc::memory_resource& mr, vecmem::copy& copy, stream& str)
+        : m_finder_config(finder_config),
+          m_filter_config(filter_config),
+          m_finding_config(track_finding_config),
+          m_seeding(finder_config, grid_config, filter_config, mr, copy, str,
+                    adaptive_seeding_capacities()),
+          m_finding(track_finding_config, mr, copy, str) {}
+
+    /// Configs
+    seedfinder_config m_finder_config;
+    seedfilter_config m_filter_config;
+    finding_config<scalar> m_finding_config;
+
+    /// Seeding algorithm of the pass
+    seeding_algorithm m_seeding;
+    /// Track finding algorithm of the pass
+    full_chain_algorithm::finding_algorithm m_finding;
+
+};  // struct full_chain_algorithm_tracking_pass
+
+}  // namespace details
 
 full_chain_algorithm::full_chain_algorithm(
     vecmem::memory_resource& host_mr,
     const unsigned short target_cells_per_partition,
     const seedfinder_config& finder_config,
     const spacepoint_grid_config& grid_config,
-    const seedfilter_config& filter_config)
+    const seedfilter_config& filter_config,
+    const finding_config<scalar>& track_finding_config,
+    const fitting_config<scalar>& track_fitting_config,
+    const host_detector_type* detector, bool run_ambiguity_resolution,
+    bool use_graph, unsigned int staging_ring_size, int device)
     : m_host_mr(host_mr),
-      m_stream(),
-      m_device_mr(),
-      m_cached_device_mr(
-          std::make_unique<vecmem::binary_page_memory_resource>(m_device_mr)),
+      m_context(std::make_shared<details::full_chain_algorithm_context>(
+          device, target_cells_per_partition, finder_config, grid_config,
+          filter_config, track_finding_config, track_fitting_config, detector,
+          run_ambiguity_resolution, use_graph)),
+      m_device(device),
+      m_stream(m_device),
+      m_device_mr(m_device),
+      m_cached_device_mr(details::make_cached_device_mr(m_stream, m_device,
+                                                        m_device_mr)),
+      m_device_mr_monitor(*m_cached_device_mr),
+      m_event_arena(std::make_unique<workspace_resource>(m_device_mr_monitor)),
       m_copy(m_stream.cudaStream()),
-      m_target_cells_per_partition(target_cells_per_partition),
-      m_clusterization(memory_resource{*m_cached_device_mr, &m_host_mr}, m_copy,
-                       m_stream, m_target_cells_per_partition),
-      m_seeding(finder_config, grid_config, filter_config,
-                memory_resource{*m_cached_device_mr, &m_host_mr}, m_copy,
-                m_stream),
-      m_track_parameter_estimation(
-          memory_resource{*m_cached_device_mr, &m_host_mr}, m_copy, m_stream),
-      m_finder_config(finder_config),
-      m_grid_config(grid_config),
-      m_filter_config(filter_config) {
+      m_navigation_buffer_capacity(0),
+      m_clusterization(algorithm_mr(), m_copy, m_stream,
+                       target_cells_per_partition),
+      m_seeding(finder_config, grid_config, filter_config, algorithm_mr(),
+                m_copy, m_stream, details::adaptive_seeding_capacities()),
+      m_measurement_sorting(algorithm_mr(), m_copy, m_stream),
+      m_finding(track_finding_config, algorithm_mr(), m_copy, m_stream),
+      m_fitting(track_fitting_config, algorithm_mr(), m_copy, m_stream),
+      m_track_state_d2h(algorithm_mr(), m_copy),
+      m_ambiguity_resolution(),
+      m_hit_masking(algorithm_mr(), m_copy, m_stream),
+      m_pinned_host_mr(),
+      m_upload_stream(m_device),
+      m_upload_copy(m_upload_stream.cudaStream()),
+      m_staging_ring(),
+      m_next_staging_slot(0) {
+
+    // Set up everything below on the chain's device.
+    details::device_selector selector{m_device};
+    m_timestamps = std::make_unique<details::full_chain_algorithm_timestamps>();
 
     // Tell the user what device is being used.
-    int device = 0;
-    CUDA_ERROR_CHECK(cudaGetDevice(&device));
+    int current_device = 0;
+    CUDA_ERROR_CHECK(cudaGetDevice(&current_device));
     cudaDeviceProp props;
-    CUDA_ERROR_CHECK(cudaGetDeviceProperties(&props, device));
-    std::cout << "Using CUDA device: " << props.name << " [id: " << device
+    CUDA_ERROR_CHECK(cudaGetDeviceProperties(&props, current_device));
+    std::cout << "Using CUDA device: " << props.name
+              << " [id: " << current_device
               << ", bus: " << props.pciBusID
               << ", device: " << props.pciDeviceID << "]" << std::endl;
+
+    // Keep the detector's payload in the persisting L2 cache, if it is
+    // small enough for that.
+    if (m_context->m_detector_mr) {
+        m_detector_l2 = l2_persistence(m_stream,
+                                       m_context->m_detector_mr->data(),
+                                       m_context->m_detector_mr->size());
+    }
+
+    // Set up the staging ring.
+    for (unsigned int i = 0; i < staging_ring_size; ++i) {
+        m_staging_ring.push_back(
+            std::make_unique<details::full_chain_algorithm_staging_slot>(
+                m_pinned_host_mr));
+    }
 }
 
 full_chain_algorithm::full_chain_algorithm(const full_chain_algorithm& parent)
-    : m_host_mr(parent.m_host_mr),
-      m_stream(),
-      m_device_mr(),
-      m_cached_device_mr(
-          std::make_unique<vecmem::binary_page_memory_resource>(m_device_mr)),
+    : full_chain_algorithm(parent, parent.m_host_mr) {}
+
+full_chain_algorithm::full_chain_algorithm(const full_chain_algorithm& parent,
+                                           vecmem::memory_resource& host_mr)
+    : m_host_mr(host_mr),
+      m_context(parent.m_context),
+      m_device(parent.m_device),
+      m_stream(m_device),
+      m_device_mr(m_device),
+      m_cached_device_mr(details::make_cached_device_mr(m_stream, m_device,
+                                                        m_device_mr)),
+      m_device_mr_monitor(*m_cached_device_mr),
+      m_event_arena(std::make_unique<workspace_resource>(m_device_mr_monitor)),
       m_copy(m_stream.cudaStream()),
-      m_target_cells_per_partition(parent.m_target_cells_per_partition),
-      m_clusterization(memory_resource{*m_cached_device_mr, &m_host_mr}, m_copy,
-                       m_stream, m_target_cells_per_partition),
-      m_seeding(
-          parent.m_finder_config, parent.m_grid_config, parent.m_filter_config,
-          memory_resource{*m_cached_device_mr, &m_host_mr}, m_copy, m_stream),
-      m_track_parameter_estimation(
-          memory_resource{*m_cached_device_mr, &m_host_mr}, m_copy, m_stream),
-      m_finder_config(parent.m_finder_config),
-      m_grid_config(parent.m_grid_config),
-      m_filter_config(parent.m_filter_config) {}
+      m_navigation_buffer_capacity(0),
+      m_clusterization(algorithm_mr(), m_copy, m_stream,
+                       m_context->m_target_cells_per_partition),
+      m_seeding(m_context->m_finder_config, m_context->m_grid_config,
+                m_context->m_filter_config, algorithm_mr(), m_copy, m_stream,
+                details::adaptive_seeding_capacities()),
+      m_measurement_sorting(algorithm_mr(), m_copy, m_stream),
+      m_finding(m_context->m_finding_config, algorithm_mr(), m_copy, m_stream),
+      m_fitting(m_context->m_fitting_config, algorithm_mr(), m_copy, m_stream),
+      m_track_state_d2h(algorithm_mr(), m_copy),
+      m_ambiguity_resolution(),
+      m_hit_masking(algorithm_mr(), m_copy, m_stream),
+      m_pinned_host_mr(),
+      m_upload_stream(m_device),
+      m_upload_copy(m_upload_stream.cudaStream()),
+      m_staging_ring(),
+      m_next_staging_slot(0) {
+
+    // Set up everything below on the parent's device.
+    details::device_selector selector{m_device};
+    m_timestamps = std::make_unique<details::full_chain_algorithm_timestamps>();
+
+    // Keep the detector's payload in the persisting L2 cache, if it is
+    // small enough for that.
+    if (m_context->m_detector_mr) {
+        m_detector_l2 = l2_persistence(m_stream,
+                                       m_context->m_detector_mr->data(),
+                                       m_context->m_detector_mr->size());
+    }
+
+    // Set up a staging ring of the same size as the parent's.
+    for (std::size_t i = 0; i < parent.m_staging_ring.size(); ++i) {
+        m_staging_ring.push_back(
+            std::make_unique<details::full_chain_algorithm_staging_slot>(
+                m_pinned_host_mr));
+    }
+
+    // Launch the kernels the same way as the parent.
+    m_launch_tuning = parent.m_launch_tuning;
+    m_stream.set_tuning(m_launch_tuning.get());
+
+    // Run the same tracking passes as the parent.
+    for (const auto& pass : parent.m_tracking_passes) {
+        add_tracking_pass(pass->m_finder_config, pass->m_filter_config,
+                          pass->m_finding_config);
+    }
+}
 
 full_chain_algorithm::~full_chain_algorithm() {
 
     // We need to ensure that the caching memory resource would be deleted
-    // before the device memory resource that it is based on.
+    // before the device memory resource that it is based on. Together with
+    // all the buffers allocated from it.
+    details::device_selector selector{m_device};
+    if (m_result_ring) {
+        m_result_ring->drain();
+    }
+    m_upload_stream.synchronize();
+    m_staging_ring.clear();
+    m_graph.reset();
+    m_module_table.reset();
+    m_tracking_passes.clear();
+    m_event_arena.reset();
     m_cached_device_mr.reset();
 }
 
-full_chain_algorithm::output_type full_chain_algorithm::operator()(
+void full_chain_algorithm::add_tracking_pass(
+    const seedfinder_config& finder_config,
+    const seedfilter_config& filter_config,
+    const finding_config<scalar>& track_finding_config) {
+
+    details::device_selector selector{m_device};
+    m_tracking_passes.push_back(
+        std::make_unique<details::full_chain_algorithm_tracking_pass>(
+            finder_config, m_context->m_grid_config, filter_config,
+            track_finding_config, algorithm_mr(), m_copy, m_stream));
+}
+
+vecmem::data::jagged_vector_view<
+    full_chain_algorithm::navigator_type::intersection_type>
+full_chain_algorithm::navigation_buffer(unsigned int n_tracks) const {
+
+    // Re-allocate the buffer if it is too small. Growing its capacity
+    // geometrically, to avoid re-allocating it for every slightly larger
+    // event.
+    if (n_tracks > m_navigation_buffer_capacity) {
+        m_navigation_buffer_capacity =
+            std::max(n_tracks, 2 * m_navigation_buffer_capacity);
+        m_navigation_buffer = detray::create_candidates_buffer(
+            *(m_context->m_detector), m_navigation_buffer_capacity, m_device_mr,
+            &m_host_mr);
+    }
+    return m_navigation_buffer;
+}
+
+details::full_chain_algorithm_staging_slot& full_chain_algorithm::stage(
+    const cell_collection_types::host& cells,
+    const cell_module_collection_types::host& modules) const {
+
+    // Check if the event is staged already.
+    for (const auto& slot : m_staging_ring) {
+        if ((slot->m_cells == &cells) && (slot->m_modules == &modules)) {
+            return *slot;
+        }
+    }
+
+    // Pick a free slot if there is one, or re-use the slots one by one if
+    // there isn't.
+    auto slot_it = std::find_if(
+        m_staging_ring.begin(), m_staging_ring.end(),
+        [](const auto& slot) { return slot->m_cells == nullptr; });
+    if (slot_it == m_staging_ring.end()) {
+        slot_it = m_staging_ring.begin() + m_next_staging_slot;
+        m_next_staging_slot = (m_next_staging_slot + 1) % m_staging_ring.size();
+    }
+    details::full_chain_algorithm_staging_slot& slot = **slot_it;
+
+    // Make sure that the previous upload from the slot's host buffers has
+    // finished, before overwriting them.
+    CUDA_ERROR_CHECK(cudaEventSynchronize(slot.m_uploaded));
+    // The modules of the module table are on the device already.
+    const bool upload_modules = !is_module_table(modules);
+    slot.m_host_cells.assign(cells.begin(), cells.end());
+    if (upload_modules) {
+        slot.m_host_modules.assign(modules.begin(), modules.end());
+    }
+
+    // Grow the device buffers if necessary.
+    const unsigned int n_cells = static_cast<unsigned int>(cells.size());
+    const unsigned int n_modules =
+        upload_modules ? static_cast<unsigned int>(modules.size()) : 0u;
+    bool grown = false;
+    if (n_cells > slot.m_cell_capacity) {
+        slot.m_cell_capacity = std::max(n_cells, 2 * slot.m_cell_capacity);
+        slot.m_device_cells = cell_collection_types::buffer{
+            slot.m_cell_capacity, m_device_mr_monitor};
+        grown = true;
+    }
+    if (n_modules > slot.m_module_capacity) {
+        slot.m_module_capacity =
+            std::max(n_modules, 2 * slot.m_module_capacity);
+        slot.m_device_modules = cell_module_collection_types::buffer{
+            slot.m_module_capacity, m_device_mr_monitor};
+        grown = true;
+    }
+    // (Stream-ordered) allocations are made on the processing stream. Make
+    // sure that the new buffers exist before the upload stream uses them.
+    if (grown) {
+        m_stream.synchronize();
+    }
+
+    // Upload the event once the previous payload of the slot is no longer
+    // needed by the processing stream.
+    cudaStream_t upload_stream =
+        static_cast<cudaStream_t>(m_upload_stream.cudaStream());
+    CUDA_ERROR_CHECK(cudaStreamWaitEvent(upload_stream, slot.m_consumed, 0));
+    m_upload_copy(vecmem::get_data(slot.m_host_cells),
+                  cell_collection_types::view{n_cells,
+                                              slot.m_device_cells.ptr()},
+                  vecmem::copy::type::host_to_device);
+    if (upload_modules) {
+        m_upload_copy(vecmem::get_data(slot.m_host_modules),
+                      cell_module_collection_types::view{
+                          n_modules, slot.m_device_modules.ptr()},
+                      vecmem::copy::type::host_to_device);
+    }
+    CUDA_ERROR_CHECK(cudaEventRecord(slot.m_uploaded, upload_stream));
+
+    // Remember what the slot holds.
+    slot.m_cells = &cells;
+    slot.m_modules = &modules;
+    return slot;
+}
+
+void full_chain_algorithm::prefetch(
     const cell_collection_types::host& cells,
     const cell_module_collection_types::host& modules) const {
 
-    // Create device copy of input collections
-    cell_collection_types::buffer cells_buffer(cells.size(),
-                                               *m_cached_device_mr);
-    m_copy(vecmem::get_data(cells), cells_buffer);
-    cell_module_collection_types::buffer modules_buffer(modules.size(),
-                                                        *m_cached_device_mr);
-    m_copy(vecmem::get_data(modules), modules_buffer);
-
-    // Run the clusterization (asynchronously).
-    const clusterization_algorithm::output_type spacepoints =
-        m_clusterization(cells_buffer, modules_buffer);
-    const track_params_estimation::output_type track_params =
-        m_track_parameter_estimation(spacepoints.first,
-                                     m_seeding(spacepoints.first),
-                                     {0.f, 0.f, m_finder_config.bFieldInZ});
-
-    // Get the final data back to the host.
-    bound_track_parameters_collection_types::host result(&m_host_mr);
-    m_copy(track_params, result);
+    // Only do anything if there is a staging ring.
+    if (!m_staging_ring.empty()) {
+        details::device_selector selector{m_device};
+        stage(cells, modules);
+    }
+}
+
+void full_chain_algorithm::set_module_table(
+    const cell_module_collection_types::host& modules) {
+
+    details::device_selector selector{m_device};
+
+    // Make sure that nothing uses the previous table anymore, and that the
+    // graph would be re-captured with the new one.
+    m_stream.synchronize();
+    m_graph.reset();
+    m_module_table =
+        std::make_unique<details::full_chain_algorithm_module_table>(
+            modules, m_device_mr_monitor, m_copy);
     m_stream.synchronize();
+}
+
+bool full_chain_algorithm::is_module_table(
+    const cell_module_collection_types::host& modules) const {
+
+    return (m_module_table && (m_module_table->m_host_modules == &modules));
+}
+
+unsigned int full_chain_algorithm::device_count() {
+
+    int count = 0;
+    CUDA_ERROR_CHECK(cudaGetDeviceCount(&count));
+    return static_cast<unsigned int>(count);
+}
+
+int full_chain_algorithm::device_numa_node(int device) {
+
+    // Look up the node of the device's PCI bus, as reported by the kernel.
+    char bus_id[32] = {0};
+    if (cudaDeviceGetPCIBusId(bus_id, sizeof(bus_id), device) != cudaSuccess) {
+        return -1;
+    }
+    std::string id{bus_id};
+    std::transform(id.begin(), id.end(), id.begin(), [](unsigned char c) {
+        return static_cast<char>(std::tolower(c));
+    });
+    std::ifstream node_file{"/sys/bus/pci/devices/" + id + "/numa_node"};
+    int node = -1;
+    if (!(node_file >> node)) {
+        return -1;
+    }
+    return node;
+}
+
+std::string full_chain_algorithm::device_description(int device) {
+
+    const std::vector<cuda::device_partition> partitions =
+        cuda::get_device_partitions();
+    if ((device < 0) ||
+        (static_cast<std::size_t>(device) >= partitions.size())) {
+        return {};
+    }
+    std::ostringstream result;
+    result << partitions[static_cast<std::size_t>(device)];
+    return result.str();
+}
+
+memory_resource full_chain_algorithm::algorithm_mr() {
+
+    return {m_device_mr_monitor, &m_host_mr, nullptr, m_event_arena.get()};
+}
+
+memory_statistics full_chain_algorithm::device_memory_statistics() const {
+
+    return m_device_mr_monitor.statistics();
+}
+
+std::size_t full_chain_algorithm::n_degraded_events() const {
+
+    return m_n_degraded_events;
+}
+
+std::optional<std::chrono::nanoseconds> full_chain_algorithm::device_latency()
+    const {
+
+    if (!m_timestamps->m_recorded) {
+        return {};
+    }
+    details::device_selector selector{m_device};
+    CUDA_ERROR_CHECK(cudaEventSynchronize(m_timestamps->m_results_on_host));
+    float milliseconds = 0.f;
+    CUDA_ERROR_CHECK(cudaEventElapsedTime(&milliseconds,
+                                          m_timestamps->m_upload_start,
+                                          m_timestamps->m_results_on_host));
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::duration<float, std::milli>(milliseconds));
+}
+
+void full_chain_algorithm::load_launch_tuning(const std::string& filename) {
+
+    launch_tuning tuning = launch_tuning::read(filename);
+    std::cout << "Using the launch tuning of " << tuning.size()
+              << " kernel(s) from " << filename;
+    if (!tuning.device_name().empty()) {
+        std::cout << " (tuned on: " << tuning.device_name() << ")";
+    }
+    std::cout << std::endl;
+    set_launch_tuning(std::move(tuning));
+}
+
+void full_chain_algorithm::autotune_launches(
+    const cell_collection_types::host& cells,
+    const cell_module_collection_types::host& modules,
+    const std::string& filename) {
+
+    details::device_selector selector{m_device};
+
+    // The captured graph would keep launching the kernels the same way.
+    m_graph.reset();
+    launch_tuning tuning = cuda::autotune_launches(m_stream, [&]() {
+        (*this)(cells, modules);
+        m_graph.reset();
+    });
+    tuning.write(filename);
+    std::cout << "Wrote the launch tuning of " << tuning.size()
+              << " kernel(s) into " << filename << std::endl;
+    set_launch_tuning(std::move(tuning));
+}
+
+void full_chain_algorithm::warm_up(
+    const cell_collection_types::host& cells,
+    const cell_module_collection_types::host& modules) const {
+
+    // The results of the sample event are not needed.
+    (void)(*this)(cells, modules);
+}
+
+void full_chain_algorithm::set_launch_tuning(launch_tuning tuning) {
+
+    m_launch_tuning = std::make_shared<const launch_tuning>(std::move(tuning));
+    m_stream.set_tuning(m_launch_tuning.get());
+    m_graph.reset();
+}
+
+void full_chain_algorithm::capture_graph(unsigned int n_cells,
+                                         unsigned int n_modules,
+                                         bool use_module_table) const {
+
+    // Get a convenience variable for the stream that we'll be using.
+    cudaStream_t stream = static_cast<cudaStream_t>(m_stream.cudaStream());
+
+    // Grow the capacities geometrically, to avoid re-capturing the graph for
+    // every slightly larger event.
+    const unsigned int cell_capacity =
+        std::max(n_cells, m_graph ? 2 * m_graph->m_cell_capacity : n_cells);
+    const unsigned int module_capacity = std::max(
+        n_modules, m_graph ? 2 * m_graph->m_module_capacity : n_modules);
+
+    // Release the previous graph and buffers before allocating new ones.
+    m_stream.synchronize();
+    m_graph.reset();
+    m_graph = std::make_unique<details::full_chain_algorithm_graph>(
+        cell_capacity, module_capacity, m_device_mr_monitor, m_copy);
+
+    // Record the clusterization kernels into a graph. The links from the
+    // cells to the measurements are not needed by the chain.
+    CUDA_ERROR_CHECK(
+        cudaStreamBeginCapture(stream, cudaStreamCaptureModeThreadLocal));
+    cell_module_collection_types::const_view modules = m_graph->m_modules;
+    module_descriptor_soa_collection_types::const_view descriptors;
+    if (use_module_table) {
+        modules = m_module_table->m_modules;
+        descriptors = get_data(m_module_table->m_descriptors);
+    }
+    m_graph->m_uses_module_table = use_module_table;
+    m_clusterization.run_bounded(m_graph->m_cells, modules, cell_capacity,
+                                 m_graph->m_measurements,
+                                 m_graph->m_spacepoints, {},
+                                 m_graph->m_ccl_backup, descriptors);
+    cudaGraph_t graph = nullptr;
+    CUDA_ERROR_CHECK(cudaStreamEndCapture(stream, &graph));
+
+    // Create the executable graph.
+    CUDA_ERROR_CHECK(
+        cudaGraphInstantiateWithFlags(&(m_graph->m_exec), graph, 0));
+    CUDA_ERROR_CHECK(cudaGraphDestroy(graph));
+}
+
+full_chain_algorithm::output_type full_chain_algorithm::operator()(
+    const cell_collection_types::host& cells,
+    const cell_module_collection_types::host& modules) const {
+
+    return run(cells, modules, nullptr);
+}
+
+void full_chain_algorithm::enqueue(
+    const cell_collection_types::host& cells,
+    const cell_module_collection_types::host& modules,
+    result_callback callback) const {
+
+    if (!m_result_ring) {
+        m_result_ring =
+            std::make_unique<result_ring>(m_stream, result_ring_size);
+    }
+    run(cells, modules, &callback);
+}
+
+void full_chain_algorithm::drain() const {
+
+    if (m_result_ring) {
+        m_result_ring->drain();
+    }
+}
+
+full_chain_algorithm::output_type full_chain_algorithm::run(
+    const cell_collection_types::host& cells,
+    const cell_module_collection_types::host& modules,
+    const result_callback* callback) const {
+
+    // Run all kernels of the event on the chain's device.
+    details::device_selector selector{m_device};
+
+    // Get a convenience variable for the stream that we'll be using.
+    cudaStream_t stream = static_cast<cudaStream_t>(m_stream.cudaStream());
+
+    // Release the buffers of the previous event in one go. All of its work
+    // was queued on the stream already, so the buffers are only re-used by
+    // the kernels of this event after it finished. (Including the copies of
+    // the results delivered asynchronously.)
+    m_event_arena->reset();
+
+    // Mark the start of the upload of the event.
+    CUDA_ERROR_CHECK(cudaEventRecord(m_timestamps->m_upload_start, stream));
+    m_timestamps->m_recorded = false;
+
+    // The size of the input. The modules do not need to be uploaded if
+    // they are the module table, which is on the device already.
+    const unsigned int n_cells = static_cast<unsigned int>(cells.size());
+    const bool use_module_table = is_module_table(modules);
+    const unsigned int n_modules =
+        use_module_table ? 0u : static_cast<unsigned int>(modules.size());
+    module_descriptor_soa_collection_types::const_view descriptors;
+    if (use_module_table) {
+        descriptors = get_data(m_module_table->m_descriptors);
+    }
+
+    // Pick up the input of the event from the staging ring, if there is one.
+    details::full_chain_algorithm_staging_slot* slot = nullptr;
+    cell_collection_types::const_view staged_cells;
+    cell_module_collection_types::const_view staged_modules;
+    if (!m_staging_ring.empty()) {
+        slot = &(stage(cells, modules));
+        CUDA_ERROR_CHECK(cudaStreamWaitEvent(stream, slot->m_uploaded, 0));
+        staged_cells =
+            cell_collection_types::view{n_cells, slot->m_device_cells.ptr()};
+        staged_modules = cell_module_collection_types::view{
+            n_modules, slot->m_device_modules.ptr()};
+    }
+
+    // Run the clusterization, either by replaying a CUDA graph on persistent
+    // buffers, or by running the algorithm on buffers sized for this event.
+    // In both cases the measurements are kept around for the track finding.
+    cell_collection_types::buffer cells_buffer;
+    cell_module_collection_types::buffer modules_buffer;
+    measurement_collection_types::buffer measurements_buffer;
+    spacepoint_collection_types::buffer spacepoints_buffer;
+    vecmem::data::vector_buffer<unsigned int> ccl_backup_buffer;
+    measurement_collection_types::view measurements_view;
+    spacepoint_collection_types::const_view spacepoints_view;
+
+    // The stage of the chain that the memory allocations are attributed to.
+    std::optional<instrumented_memory_resource::stage> stage;
+    stage.emplace("Clusterization");
+    if (m_context->m_use_graph) {
+
+        // (Re-)Capture the graph if the event does not fit into its buffers.
+        if ((!m_graph) || (n_cells > m_graph->m_cell_capacity) ||
+            (n_modules > m_graph->m_module_capacity) ||
+            (use_module_table != m_graph->m_uses_module_table)) {
+            capture_graph(n_cells, n_modules, use_module_table);
+        }
+
+        // Copy the input into the persistent buffers, and replay the graph.
+        if (slot != nullptr) {
+            m_copy(staged_cells, m_graph->m_cells,
+                   vecmem::copy::type::device_to_device);
+            if (!use_module_table) {
+                m_copy(staged_modules, m_graph->m_modules,
+                       vecmem::copy::type::device_to_device);
+            }
+        } else {
+            m_copy(vecmem::get_data(cells), m_graph->m_cells);
+            if (!use_module_table) {
+                m_copy(vecmem::get_data(modules), m_graph->m_modules);
+            }
+        }
+        CUDA_ERROR_CHECK(cudaGraphLaunch(m_graph->m_exec, stream));
+        measurements_view = m_graph->m_measurements;
+        spacepoints_view = m_graph->m_spacepoints;
+    } else {
+
+        // Create device copy of input collections, if they were not staged.
+        cell_collection_types::const_view cells_view = staged_cells;
+        cell_module_collection_types::const_view modules_view = staged_modules;
+        if (slot == nullptr) {
+            cells_buffer = {n_cells, *m_event_arena};
+            m_copy(vecmem::get_data(cells), cells_buffer);
+            cells_view = cells_buffer;
+            if (!use_module_table) {
+                modules_buffer = {n_modules, *m_event_arena};
+                m_copy(vecmem::get_data(modules), modules_buffer);
+                modules_view = modules_buffer;
+            }
+        }
+        if (use_module_table) {
+            modules_view = m_module_table->m_modules;
+        }
+
+        // Create the (resizable) output buffers of the clusterization.
+        measurements_buffer = measurement_collection_types::buffer{
+            n_cells, *m_event_arena, vecmem::data::buffer_type::resizable};
+        m_copy.setup(measurements_buffer);
+        spacepoints_buffer = spacepoint_collection_types::buffer{
+            n_cells, *m_event_arena, vecmem::data::buffer_type::resizable};
+        m_copy.setup(spacepoints_buffer);
+        ccl_backup_buffer = {clusterization_algorithm::ccl_backup_size(n_cells),
+                             *m_event_arena};
+
+        // Run the clusterization (asynchronously). The links from the cells
+        // to the measurements are not needed by the chain.
+        m_clusterization.run_bounded(cells_view, modules_view, n_cells,
+                                     measurements_buffer, spacepoints_buffer,
+                                     {}, ccl_backup_buffer, descriptors);
+        measurements_view = measurements_buffer;
+        spacepoints_view = spacepoints_buffer;
+    }
+
+    // Let the staging ring re-use the slot once the processing stream is done
+    // with its payload.
+    if (slot != nullptr) {
+        CUDA_ERROR_CHECK(cudaEventRecord(slot->m_consumed, stream));
+        slot->m_cells = nullptr;
+        slot->m_modules = nullptr;
+    }
+
+    stage.reset();
+    return reconstruct(measurements_view, spacepoints_view, callback);
+}
+
+full_chain_algorithm::output_type full_chain_algorithm::operator()(
+    const device_cells& cells) const {
+
+    // Run all kernels of the event on the chain's device.
+    details::device_selector selector{m_device};
+
+    // Check that the cells can be used in place.
+    if (!m_module_table) {
+        throw std::logic_error(
+            "A module table must be set for processing device cells");
+    }
+    if (cells.cell_size != sizeof(cell)) {
+        throw std::invalid_argument("Device cells of " +
+                                    std::to_string(cells.cell_size) +
+                                    " bytes, instead of " +
+                                    std::to_string(sizeof(cell)));
+    }
+    if (cells.size > 0u) {
+        if (reinterpret_cast<std::uintptr_t>(cells.data) % alignof(cell) !=
+            0u) {
+            throw std::invalid_argument("Misaligned device cells");
+        }
+        int device = 0;
+        CUDA_ERROR_CHECK(cudaGetDevice(&device));
+        cudaPointerAttributes attributes;
+        CUDA_ERROR_CHECK(cudaPointerGetAttributes(&attributes, cells.data));
+        if ((attributes.type != cudaMemoryTypeManaged) &&
+            ((attributes.type != cudaMemoryTypeDevice) ||
+             (attributes.device != device))) {
+            throw std::invalid_argument(
+                "The cells are not in the memory of the chain's device");
+        }
+    }
+
+    // Get a convenience variable for the stream that we'll be using.
+    cudaStream_t stream = static_cast<cudaStream_t>(m_stream.cudaStream());
+
+    // Release the buffers of the previous event in one go.
+    m_event_arena->reset();
+
+    // Wait for the producer of the cells, if it told us how.
+    if (cells.ready_event != nullptr) {
+        CUDA_ERROR_CHECK(cudaStreamWaitEvent(
+            stream, static_cast<cudaEvent_t>(cells.ready_event), 0));
+    }
+
+    // Mark the start of the processing of the event. Its cells are on the
+    // device already, so there is no upload to time.
+    CUDA_ERROR_CHECK(cudaEventRecord(m_timestamps->m_upload_start, stream));
+    m_timestamps->m_recorded = false;
+
+    // Run the clusterization on the caller's cells, and the module table.
+    std::optional<instrumented_memory_resource::stage> stage;
+    stage.emplace("Clusterization");
+    const cell_collection_types::const_view cells_view{cells.size,
+                                                       cells.data};
+    measurement_collection_types::buffer measurements_buffer{
+        cells.size, *m_event_arena, vecmem::data::buffer_type::resizable};
+    m_copy.setup(measurements_buffer);
+    spacepoint_collection_types::buffer spacepoints_buffer{
+        cells.size, *m_event_arena, vecmem::data::buffer_type::resizable};
+    m_copy.setup(spacepoints_buffer);
+    vecmem::data::vector_buffer<unsigned int> ccl_backup_buffer{
+        clusterization_algorithm::ccl_backup_size(cells.size),
+        *m_event_arena};
+    m_clusterization.run_bounded(cells_view, m_module_table->m_modules,
+                                 cells.size, measurements_buffer,
+                                 spacepoints_buffer, {}, ccl_backup_buffer,
+                                 get_data(m_module_table->m_descriptors));
+    stage.reset();
+
+    // The cells are not read anymore once the chain returns, as it
+    // synchronises with all of its work on the device.
+    return reconstruct(measurements_buffer, spacepoints_buffer);
+}
+
+full_chain_algorithm::output_type full_chain_algorithm::reconstruct(
+    const measurement_collection_types::view& measurements_view,
+    const spacepoint_collection_types::const_view& spacepoints_view,
+    const result_callback* callback) const {
+
+    // Mark the end of the copy of the results to the host, once the (last)
+    // copy of them was queued on the stream.
+    auto mark_results_on_host = [this]() {
+        CUDA_ERROR_CHECK(cudaEventRecord(
+            m_timestamps->m_results_on_host,
+            static_cast<cudaStream_t>(m_stream.cudaStream())));
+        m_timestamps->m_recorded = true;
+    };
+
+    // The stage of the chain that the memory allocations are attributed to.
+    std::optional<instrumented_memory_resource::stage> stage;
+    stage.emplace("Seeding");
+    // Keep the spacepoint grid if later tracking passes need it. The track
+    // parameters are estimated together with the seeds.
+    std::optional<sp_soa_grid_types::buffer> grid{
+        m_seeding.bin(spacepoints_view)};
+    const auto [seeds, track_params] =
+        m_seeding(spacepoints_view, get_data(*grid),
+                  {0.f, 0.f, m_context->m_finder_config.bFieldInZ});
+    if (m_tracking_passes.empty() || (m_context->m_detector == nullptr)) {
+        grid.reset();
+    }
+
+    // Without a Detray detector, stop at the track parameter estimation.
+    if (m_context->m_detector == nullptr) {
+
+        // Queue the copy of the track parameters through the result ring, if
+        // they are to be delivered asynchronously.
+        if (callback != nullptr) {
+            const unsigned int n_params = m_copy.get_size(track_params);
+            m_result_ring->enqueue(
+                {{track_params.ptr(),
+                  n_params * sizeof(bound_track_parameters)}},
+                [this, cb = *callback](const void* data, std::size_t size) {
+                    const bound_track_parameters* params =
+                        static_cast<const bound_track_parameters*>(data);
+                    output_type result = make_output();
+                    result.assign(
+                        params, params + size / sizeof(bound_track_parameters));
+                    cb(std::move(result));
+                });
+            return output_type(&m_host_mr);
+        }
+
+        // Get the final data back to the host.
+        output_type result = make_output();
+        m_copy(track_params, result);
+        mark_results_on_host();
+        m_stream.synchronize();
+
+        // Return the host container.
+        return result;
+    }
+
+    // The track finding expects the measurements to be ordered by surface.
+    stage.emplace("Track finding");
+    const measurement_collection_types::view sorted_measurements =
+        m_measurement_sorting(measurements_view);
+
+    // Run the track finding.
+    const unsigned int n_seeds = m_copy.get_size(track_params);
+    const finding_algorithm::output_type track_candidates =
+        m_finding(m_context->m_device_detector_view, m_context->m_field,
+                  navigation_buffer(
+                      n_seeds *
+                      m_context->m_finding_config.max_num_branches_per_seed),
+                  sorted_measurements, track_params);
+    if (m_finding.get_budget_status().degraded()) {
+        ++m_n_degraded_events;
+    }
+
+    // Run the track fitting.
+    stage.emplace("Track fitting");
+    auto fit = [this](const finding_algorithm::output_type& candidates) {
+        const unsigned int n_tracks = m_copy.get_size(candidates.headers);
+        return m_fitting(m_context->m_device_detector_view, m_context->m_field,
+                         navigation_buffer(n_tracks), candidates);
+    };
+    std::vector<fitting_algorithm::output_type> track_states;
+    track_states.push_back(fit(track_candidates));
+
+    // Run the later tracking passes, on the hits not used by the earlier
+    // ones.
+    if (!m_tracking_passes.empty()) {
+        stage.emplace("Tracking passes");
+        vecmem::data::vector_buffer<unsigned int> used_measurements =
+            m_hit_masking.make_mask(sorted_measurements.size());
+        m_hit_masking.mark(sorted_measurements, track_candidates,
+                           used_measurements);
+        for (const auto& pass : m_tracking_passes) {
+            sp_soa_grid_types::buffer masked_grid =
+                m_hit_masking(get_data(*grid), spacepoints_view,
+                              sorted_measurements, used_measurements);
+            const auto [pass_seeds, pass_params] =
+                pass->m_seeding(spacepoints_view, get_data(masked_grid),
+                                {0.f, 0.f, pass->m_finder_config.bFieldInZ});
+            const unsigned int n_pass_seeds = m_copy.get_size(pass_params);
+            const finding_algorithm::output_type pass_candidates =
+                pass->m_finding(
+                    m_context->m_device_detector_view, m_context->m_field,
+                    navigation_buffer(
+                        n_pass_seeds *
+                        pass->m_finding_config.max_num_branches_per_seed),
+                    sorted_measurements, pass_params);
+            if (pass->m_finding.get_budget_status().degraded()) {
+                ++m_n_degraded_events;
+            }
+            m_hit_masking.mark(sorted_measurements, pass_candidates,
+                               used_measurements);
+            track_states.push_back(fit(pass_candidates));
+        }
+    }
+
+    // Queue the copies of the fit results of all passes through the result
+    // ring, if they are to be delivered asynchronously, and the ambiguity
+    // resolution does not need them on the host. Their buffers may go away
+    // right after, as their memory is only re-used by later work on the
+    // stream.
+    stage.emplace("Result collection");
+    if ((callback != nullptr) && !m_context->m_run_ambiguity_resolution) {
+        std::vector<result_ring::block> blocks;
+        for (const fitting_algorithm::output_type& pass_track_states :
+             track_states) {
+            const unsigned int n_tracks =
+                m_copy.get_size(pass_track_states.headers);
+            blocks.emplace_back(pass_track_states.headers.ptr(),
+                                n_tracks * sizeof(fitting_result<transform3>));
+        }
+        m_result_ring->enqueue(
+            blocks, [this, cb = *callback](const void* data, std::size_t size) {
+                const fitting_result<transform3>* fit_results =
+                    static_cast<const fitting_result<transform3>*>(data);
+                const std::size_t n_tracks =
+                    size / sizeof(fitting_result<transform3>);
+                output_type result = make_output();
+                result.reserve(n_tracks);
+                for (std::size_t i = 0; i < n_tracks; ++i) {
+                    result.push_back(fit_results[i].fit_params);
+                }
+                cb(std::move(result));
+            });
+        return output_type(&m_host_mr);
+    }
+
+    // Collect the parameters of the fitted tracks on the host. Running the
+    // ambiguity resolution on them if requested, which needs all track
+    // states on the host.
+    output_type result = make_output();
+    if (m_context->m_run_ambiguity_resolution) {
+        // Resolve the ambiguities between the tracks of all passes together.
+        track_state_container_types::host all_track_states =
+            m_track_state_d2h(track_states.front());
+        for (std::size_t i = 1; i < track_states.size(); ++i) {
+            track_state_container_types::host pass_track_states =
+                m_track_state_d2h(track_states[i]);
+            for (std::size_t j = 0; j < pass_track_states.size(); ++j) {
+                all_track_states.push_back(
+                    std::move(pass_track_states.get_headers()[j]),
+                    std::move(pass_track_states.get_items()[j]));
+            }
+        }
+        mark_results_on_host();
+        const track_state_container_types::host resolved_track_states =
+            m_ambiguity_resolution(all_track_states);
+        result.reserve(resolved_track_states.size());
+        for (const fitting_result<transform3>& fit_res :
+             resolved_track_states.get_headers()) {
+            result.push_back(fit_res.fit_params);
+        }
+    } else {
+        for (const fitting_algorithm::output_type& pass_track_states :
+             track_states) {
+            m_copy(pass_track_states.headers, m_fit_results);
+            mark_results_on_host();
+            m_stream.synchronize();
+            result.reserve(result.size() + m_fit_results.size());
+            for (const fitting_result<transform3>& fit_res : m_fit_results) {
+                result.push_back(fit_res.fit_params);
+            }
+        }
+    }
+
+    // Hand the results to the callback right away, if there is one.
+    if (callback != nullptr) {
+        (*callback)(std::move(result));
+        return output_type(&m_host_mr);
+    }
 
     // Return the host container.
     return result;
 }
 
+void full_chain_algorithm::recycle(output_type&& result) const {
+
+    m_output_pool->release(std::move(result));
+}
+
+full_chain_algorithm::output_type full_chain_algorithm::make_output() const {
+
+    // Re-use a result handed back to the algorithm, keeping its capacity.
+    std::optional<output_type> result = m_output_pool->acquire();
+    if (result.has_value()) {
+        result->clear();
+        return std::move(*result);
+    }
+    return output_type(&m_host_mr);
+}
+
 }  // namespace traccc::cuda
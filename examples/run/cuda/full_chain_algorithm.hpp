@@ -1,6 +1,6 @@
 /** TRACCC library, part of the ACTS project (R&D line)
  *
- * (c) 2022 CERN for the benefit of the ACTS project
+ * (c) 2022-2024 CERN for the benefit of the ACTS project
  *
  * Mozilla Public License Version 2.0
  */
@@ -8,102 +8,605 @@
 #pragma once
 
 // Project include(s).
+#include "traccc/ambiguity_resolution/greedy_ambiguity_resolution_algorithm.hpp"
 #include "traccc/cuda/clusterization/clusterization_algorithm.hpp"
+#include "traccc/cuda/clusterization/measurement_sorting_algorithm.hpp"
+#include "traccc/cuda/finding/finding_algorithm.hpp"
+#include "traccc/cuda/fitting/fitting_algorithm.hpp"
+#include "traccc/cuda/seeding/hit_masking.hpp"
 #include "traccc/cuda/seeding/seeding_algorithm.hpp"
-#include "traccc/cuda/seeding/track_params_estimation.hpp"
+#include "traccc/cuda/utils/l2_persistence.hpp"
+#include "traccc/cuda/utils/launch_tuning.hpp"
+#include "traccc/cuda/utils/result_ring.hpp"
 #include "traccc/cuda/utils/stream.hpp"
+#include "traccc/cuda/utils/stream_ordered_memory_resource.hpp"
+#include "traccc/device/container_d2h_copy_alg.hpp"
 #include "traccc/device/container_h2d_copy_alg.hpp"
 #include "traccc/edm/cell.hpp"
+#include "traccc/finding/finding_config.hpp"
+#include "traccc/fitting/fitting_config.hpp"
+#include "traccc/fitting/kalman_filter/kalman_fitter.hpp"
 #include "traccc/utils/algorithm.hpp"
+#include "traccc/utils/instrumented_memory_resource.hpp"
+#include "traccc/utils/object_pool.hpp"
+#include "traccc/utils/workspace_resource.hpp"
+
+// Detray include(s).
+#include "detray/core/detector.hpp"
+#include "detray/detectors/bfield.hpp"
+#include "detray/navigation/navigator.hpp"
+#include "detray/propagator/rk_stepper.hpp"
 
 // VecMem include(s).
 #include <vecmem/memory/binary_page_memory_resource.hpp>
 #include <vecmem/memory/cuda/device_memory_resource.hpp>
+#include <vecmem/memory/cuda/host_memory_resource.hpp>
 #include <vecmem/memory/memory_resource.hpp>
 #include <vecmem/utils/cuda/async_copy.hpp>
 
 // System include(s).
+#include <chrono>
+#include <cstddef>
+#include <functional>
 #include <memory>
+#include <optional>
+#include <string>
+#include <vector>
 
 namespace traccc::cuda {
+namespace details {
+/// Immutable state shared by the copies of
+/// @c traccc::cuda::full_chain_algorithm
+struct full_chain_algorithm_context;
+/// Internal data type used by the CUDA graph mode of
+/// @c traccc::cuda::full_chain_algorithm
+struct full_chain_algorithm_graph;
+/// Internal data type used by the input staging of
+/// @c traccc::cuda::full_chain_algorithm
+struct full_chain_algorithm_staging_slot;
+/// Device copy of the module table of @c traccc::cuda::full_chain_algorithm
+struct full_chain_algorithm_module_table;
+/// Additional tracking pass of @c traccc::cuda::full_chain_algorithm
+struct full_chain_algorithm_tracking_pass;
+/// Device timestamps of the events processed by
+/// @c traccc::cuda::full_chain_algorithm
+struct full_chain_algorithm_timestamps;
+}  // namespace details
 
 /// Algorithm performing the full chain of track reconstruction
 ///
 /// At least as much as is implemented in the project at any given moment.
 ///
+/// The configuration, the magnetic field and the device copy of the detector
+/// are held in an immutable context, that is shared by all copies of the
+/// algorithm. Each copy only owns what it needs for processing events on its
+/// own: its streams, memory resources and per-event buffers.
+///
 class full_chain_algorithm
     : public algorithm<bound_track_parameters_collection_types::host(
           const cell_collection_types::host&,
           const cell_module_collection_types::host&)> {
 
     public:
+    /// @name Type declaration(s)
+    /// @{
+
+    /// (Host) Detector type used during track finding and fitting
+    using host_detector_type = detray::detector<detray::default_metadata,
+                                                detray::host_container_types>;
+    /// (Device) Detector type used during track finding and fitting
+    using device_detector_type =
+        detray::detector<detray::default_metadata,
+                         detray::device_container_types>;
+
+    /// Stepper type used by the track finding and fitting algorithms
+    using stepper_type =
+        detray::rk_stepper<detray::bfield::const_field_t::view_t,
+                           host_detector_type::transform3,
+                           detray::constrained_step<>>;
+    /// Navigator type used by the track finding and fitting algorithms
+    using navigator_type = detray::navigator<const device_detector_type>;
+
+    /// Track finding algorithm type
+    using finding_algorithm =
+        traccc::cuda::finding_algorithm<stepper_type, navigator_type>;
+    /// Track fitting algorithm type
+    using fitting_algorithm = traccc::cuda::fitting_algorithm<
+        traccc::kalman_fitter<stepper_type, navigator_type>>;
+
+    /// Description of cells in caller-owned device memory
+    ///
+    /// Used for cells that are written into the memory of the chain's device
+    /// directly, for instance by readout boards through RDMA.
+    ///
+    struct device_cells {
+        /// The cells, ordered by module, in device (or managed) memory
+        const cell* data = nullptr;
+        /// The number of cells
+        unsigned int size = 0u;
+        /// The size (in bytes) of one cell in the caller's layout
+        ///
+        /// The cells are used in place, so this must be
+        /// @c sizeof(traccc::cell). It is checked, to catch a producer built
+        /// against a different definition of the cells.
+        ///
+        std::size_t cell_size = sizeof(cell);
+        /// A @c cudaEvent_t recorded once the cells are written (optional)
+        ///
+        /// The chain's stream waits for the event before reading the cells.
+        /// Without an event, the cells must be complete before the call.
+        ///
+        void* ready_event = nullptr;
+    };
+
+    /// Function receiving the results of the events queued with @c enqueue
+    using result_callback = std::function<void(output_type&&)>;
+
+    /// @}
+
     /// Algorithm constructor
     ///
     /// @param mr The memory resource to use for the intermediate and result
     ///           objects
     /// @param target_cells_per_partition The average number of cells in each
     /// partition.
+    /// @param track_finding_config The configuration of the track finding
+    /// @param track_fitting_config The configuration of the track fitting
+    /// @param detector The Detray detector to run the track finding and
+    ///                 fitting with. If it is a null pointer, the chain stops
+    ///                 at the track parameter estimation.
+    /// @param run_ambiguity_resolution Flag for running the (host) ambiguity
+    ///                                 resolution on the fitted tracks
+    /// @param use_graph Flag for capturing the clusterization of the events
+    ///                  into a CUDA graph, and replaying it for every event
+    /// @param staging_ring_size The number of page-locked staging slots that
+    ///                          the input of upcoming events can be uploaded
+    ///                          into with @c prefetch. Zero turns the staging
+    ///                          off.
+    /// @param device The CUDA device to run the chain on. The default device
+    ///               is used if it is @c traccc::cuda::stream::INVALID_DEVICE.
     ///
     full_chain_algorithm(vecmem::memory_resource& host_mr,
                          const unsigned short target_cells_per_partiton,
                          const seedfinder_config& finder_config,
                          const spacepoint_grid_config& grid_config,
-                         const seedfilter_config& filter_config);
+                         const seedfilter_config& filter_config,
+                         const finding_config<scalar>& track_finding_config,
+                         const fitting_config<scalar>& track_fitting_config,
+                         const host_detector_type* detector,
+                         bool run_ambiguity_resolution,
+                         bool use_graph = false,
+                         unsigned int staging_ring_size = 0,
+                         int device = stream::INVALID_DEVICE);
 
     /// Copy constructor
     ///
     /// An explicit copy constructor is necessary because in the MT tests
     /// we do want to copy such objects, but a default copy-constructor can
-    /// not be generated for them.
+    /// not be generated for them. The copy runs on the same device as its
+    /// parent, sharing the parent's context (including the detector copied
+    /// to the device) instead of setting up its own.
     ///
     /// @param parent The parent algorithm chain to copy
     ///
     full_chain_algorithm(const full_chain_algorithm& parent);
 
+    /// Constructor of a copy using a different host memory resource
+    ///
+    /// Sets up a new (lightweight) executor of the parent's context, with
+    /// its own streams and memory resources, on the parent's device.
+    ///
+    /// @param parent The parent algorithm chain to copy
+    /// @param host_mr The host memory resource to use in the copy
+    ///
+    full_chain_algorithm(const full_chain_algorithm& parent,
+                         vecmem::memory_resource& host_mr);
+
     /// Algorithm destructor
     ~full_chain_algorithm();
 
     /// Reconstruct track parameters in the entire detector
     ///
     /// @param cells The cells for every detector module in the event
-    /// @return The track parameters reconstructed
+    /// @return The track parameters reconstructed. The parameters of the
+    ///         fitted tracks when running with a Detray detector, the
+    ///         parameters of the seeds otherwise.
     ///
     output_type operator()(
         const cell_collection_types::host& cells,
         const cell_module_collection_types::host& modules) const override;
 
+    /// Reconstruct track parameters from cells in caller-owned device memory
+    ///
+    /// The cells are read in place, without any host staging, and they link
+    /// to the module table set with @c set_module_table. The chain takes no
+    /// ownership of the cells. It only reads them during the call, which
+    /// returns once all work on them has finished. So the caller may re-use
+    /// or free their memory as soon as the call returns, but must not modify
+    /// it during the call. The module table must stay set (and its host
+    /// collection alive) for as long as events are processed this way.
+    ///
+    /// The events are not processed with the CUDA graph of the chain, as that
+    /// would need a copy of the cells into the graph's buffers.
+    ///
+    /// @param cells The description of the cells of the event
+    /// @return The track parameters reconstructed, like the ones of the
+    ///         operator taking host collections
+    ///
+    output_type operator()(const device_cells& cells) const;
+
+    /// Reconstruct the track parameters of an event, delivering them
+    /// asynchronously
+    ///
+    /// The event is processed like with the operator taking host collections,
+    /// but the results are not copied back synchronously. Their copy is
+    /// queued into a ring of page-locked host buffers right after the last
+    /// kernel of the event, and the callback receives them from the
+    /// completion thread of the ring, once the copy finished. So the calling
+    /// thread can go on with the next event meanwhile. It only waits if the
+    /// results of @c result_ring_size events are still in flight.
+    ///
+    /// With the ambiguity resolution turned on, the track states are needed
+    /// on the host. The results are then collected synchronously, and the
+    /// callback is called before this function returns.
+    ///
+    /// @param cells The cells for every detector module in the event
+    /// @param modules The modules of the event
+    /// @param callback The function to hand the results of the event to. It
+    ///                 must not throw.
+    ///
+    void enqueue(const cell_collection_types::host& cells,
+                 const cell_module_collection_types::host& modules,
+                 result_callback callback) const;
+
+    /// Wait until the results of all events queued with @c enqueue were
+    /// delivered
+    void drain() const;
+
+    /// The number of events whose results can be in flight at once
+    static constexpr std::size_t result_ring_size = 4;
+
+    /// Hand back a result of the algorithm, once it is no longer needed
+    ///
+    /// The memory of the result is re-used for the result of a later event.
+    /// Can be called from any thread.
+    ///
+    /// @param result A result returned by this algorithm earlier
+    ///
+    void recycle(output_type&& result) const;
+
+    /// Start uploading the input of an upcoming event to the device
+    ///
+    /// The upload happens on a separate stream, so it can overlap with the
+    /// processing of the current event. A later call to the operator with the
+    /// same (unmodified) objects picks up the uploaded data. Does nothing if
+    /// the algorithm was created without a staging ring.
+    ///
+    /// @param cells The cells for every detector module in the event
+    /// @param modules The modules of the event
+    ///
+    void prefetch(const cell_collection_types::host& cells,
+                  const cell_module_collection_types::host& modules) const;
+
+    /// Set the module table that the cells of the upcoming events link to
+    ///
+    /// The modules, and their compact descriptors, are uploaded to the
+    /// device once. Later calls to the operator with the same (unmodified)
+    /// module collection use the device copy, instead of uploading the
+    /// modules with every event.
+    ///
+    /// @param modules The modules of the detector (as used by all events)
+    ///
+    void set_module_table(const cell_module_collection_types::host& modules);
+
+    /// Add a tracking pass, run on the hits not used by the earlier passes
+    ///
+    /// Meant for (looser) iterations looking for low momentum or displaced
+    /// tracks. The measurements used by the track candidates of every pass
+    /// are marked in a device bitmask. The spacepoint grid of the first pass
+    /// is kept, and the later passes seed on a copy of it that has the
+    /// spacepoints of the used measurements masked. The track candidates of
+    /// all passes are fitted, and their parameters are returned together.
+    ///
+    /// @param finder_config The seed finding configuration of the pass. The
+    ///                      grid of the first pass is used with it, so its
+    ///                      spacepoint selection should not be looser.
+    /// @param filter_config The seed filter configuration of the pass
+    /// @param track_finding_config The track finding configuration of the
+    ///                             pass
+    ///
+    void add_tracking_pass(const seedfinder_config& finder_config,
+                           const seedfilter_config& filter_config,
+                           const finding_config<scalar>& track_finding_config);
+
+    /// Get the number of devices that instances of the chain can run on
+    ///
+    /// @return The number of visible CUDA devices
+    ///
+    static unsigned int device_count();
+
+    /// Get the NUMA node closest to a CUDA device
+    ///
+    /// @param device The index of the CUDA device
+    /// @return The NUMA node of the device's PCI bus, or -1 if unknown
+    ///
+    static int device_numa_node(int device);
+
+    /// Get the description of a CUDA device
+    ///
+    /// Tells whether the device is a full GPU, a MIG instance or a GPU
+    /// shared through MPS, and how many multiprocessors the process can use
+    /// on it.
+    ///
+    /// @param device The index of the CUDA device
+    /// @return The description of the (logical) device
+    ///
+    static std::string device_description(int device);
+
+    /// Get the statistics of the device memory used by the algorithms
+    ///
+    /// Covers the memory used by the sub-algorithms and the per-event
+    /// buffers of the chain, attributed to the stages of the chain. The
+    /// (persistent) detector and navigation buffers are not included. The
+    /// per-event buffers are served from an event arena, so they show up as
+    /// the blocks of the arena, in the stages that had to grow it.
+    ///
+    /// @return The statistics of this instance of the chain
+    ///
+    memory_statistics device_memory_statistics() const;
+
+    /// Get the number of events processed in a degraded mode
+    ///
+    /// Counts the events for which the track finding exceeded one of its
+    /// budgets (see @c traccc::finding_budget_status), over the lifetime of
+    /// this instance of the chain.
+    ///
+    std::size_t n_degraded_events() const;
+
+    /// Get the device time of processing the last event
+    ///
+    /// The time between two CUDA events, recorded on the stream of the chain
+    /// at the start of the upload of the event's cells, and after the copy
+    /// of its results to the host. Without the host side synchronisation of
+    /// the chain, and the time of the host noticing that the results
+    /// arrived. If the cells were staged, their upload happened ahead of
+    /// the event, and is not included.
+    ///
+    /// @return The device time of the last event, or nothing if its results
+    ///         were delivered asynchronously (through @c enqueue)
+    ///
+    std::optional<std::chrono::nanoseconds> device_latency() const;
+
+    /// Launch the tunable kernels of the chain with the block sizes of a
+    /// tuning file
+    ///
+    /// @param filename The file written by @c autotune_launches
+    ///
+    void load_launch_tuning(const std::string& filename);
+
+    /// Tune the launch parameters of the kernels of the chain on a sample
+    /// event
+    ///
+    /// The event is processed with every candidate block size (see
+    /// @c traccc::cuda::autotune_launches). The resulting tuning is used for
+    /// all following events, and is written into a file for later jobs on
+    /// the same type of device.
+    ///
+    /// @param cells The cells of the sample event
+    /// @param modules The modules of the sample event
+    /// @param filename The file to write the tuning into
+    ///
+    void autotune_launches(const cell_collection_types::host& cells,
+                           const cell_module_collection_types::host& modules,
+                           const std::string& filename);
+
+    /// Prepare the chain for the processing of events like a sample event
+    ///
+    /// Processes the sample event once, and throws away its results. This
+    /// loads the kernels of the chain (which are loaded lazily with
+    /// @c CUDA_MODULE_LOADING=LAZY), grows the caching memory resources and
+    /// the event arena of the chain, and captures its CUDA graph, all before
+    /// the first event that is actually timed.
+    ///
+    /// @param cells The cells of the sample event
+    /// @param modules The modules of the sample event
+    ///
+    void warm_up(const cell_collection_types::host& cells,
+                 const cell_module_collection_types::host& modules) const;
+
     private:
+    /// Get an (empty) host object for the result of the algorithm
+    output_type make_output() const;
+
+    /// Reconstruct the track parameters of an event, given in host
+    /// collections
+    ///
+    /// @param cells The cells for every detector module in the event
+    /// @param modules The modules of the event
+    /// @param callback The function to deliver the results to asynchronously,
+    ///                 or a null pointer to return them
+    /// @return The track parameters reconstructed, if not delivered
+    ///         asynchronously
+    ///
+    output_type run(const cell_collection_types::host& cells,
+                    const cell_module_collection_types::host& modules,
+                    const result_callback* callback) const;
+
+    /// Attach a launch tuning to the stream of the chain
+    void set_launch_tuning(launch_tuning tuning);
+
+    /// Get the memory resource(s) for the sub-algorithms
+    ///
+    /// It has the device memory monitor as its main resource, and the event
+    /// arena for the buffers living for (at most) one event.
+    ///
+    memory_resource algorithm_mr();
+
+    /// (Re-)Capture the CUDA graph for events of a given size
+    ///
+    /// @param n_cells The number of cells that the graph must be able to
+    ///                process
+    /// @param n_modules The number of modules that the graph must be able to
+    ///                  process
+    /// @param use_module_table Whether the graph should read the modules from
+    ///                         the (device copy of the) module table
+    ///
+    void capture_graph(unsigned int n_cells, unsigned int n_modules,
+                       bool use_module_table) const;
+
+    /// Get the staging slot holding the input of an event
+    ///
+    /// Starts the upload of the event into a (preferably free) slot if it is
+    /// not staged already.
+    ///
+    /// @param cells The cells for every detector module in the event
+    /// @param modules The modules of the event
+    /// @return The slot that the event is (being) uploaded into
+    ///
+    /// Check whether a module collection is the (uploaded) module table
+    bool is_module_table(
+        const cell_module_collection_types::host& modules) const;
+
+    details::full_chain_algorithm_staging_slot& stage(
+        const cell_collection_types::host& cells,
+        const cell_module_collection_types::host& modules) const;
+
+    /// Run the chain after the clusterization of an event
+    ///
+    /// @param measurements The measurements of the event (on the device)
+    /// @param spacepoints The spacepoints of the event (on the device)
+    /// @param callback The function to deliver the results to asynchronously,
+    ///                 or a null pointer to return them
+    /// @return The track parameters reconstructed, if not delivered
+    ///         asynchronously
+    ///
+    output_type reconstruct(
+        const measurement_collection_types::view& measurements,
+        const spacepoint_collection_types::const_view& spacepoints,
+        const result_callback* callback = nullptr) const;
+
+    /// Get a navigation buffer for (at least) a given number of tracks
+    ///
+    /// The persistent buffer is only re-allocated when it is too small.
+    ///
+    /// @param n_tracks The number of tracks that the buffer is needed for
+    /// @return A view of the navigation buffer
+    ///
+    vecmem::data::jagged_vector_view<
+        navigator_type::intersection_type>
+    navigation_buffer(unsigned int n_tracks) const;
+
     /// Host memory resource
     vecmem::memory_resource& m_host_mr;
+    /// The state shared with the copies of the algorithm
+    std::shared_ptr<const details::full_chain_algorithm_context> m_context;
+    /// The CUDA device that the chain runs on
+    int m_device;
     /// CUDA stream to use
     stream m_stream;
+    /// Persisting L2 cache window of the detector's payload on the stream
+    l2_persistence m_detector_l2;
     /// Device memory resource
     vecmem::cuda::device_memory_resource m_device_mr;
-    /// Device caching memory resource
-    std::unique_ptr<vecmem::binary_page_memory_resource> m_cached_device_mr;
+    /// Device caching memory resource. A stream-ordered memory pool on the
+    /// stream of the chain, if the device supports it.
+    std::unique_ptr<vecmem::memory_resource> m_cached_device_mr;
+    /// Monitor of the device memory used by the algorithms
+    mutable instrumented_memory_resource m_device_mr_monitor;
+    /// Arena for the device buffers of the current event, reset at the start
+    /// of every event
+    std::unique_ptr<workspace_resource> m_event_arena;
     /// (Asynchronous) Memory copy object
     mutable vecmem::cuda::async_copy m_copy;
 
+    /// @name Members used for the track finding and fitting
+    /// @{
+
+    /// Navigation buffer used by the track finding and fitting
+    mutable vecmem::data::jagged_vector_buffer<
+        navigator_type::intersection_type>
+        m_navigation_buffer;
+    /// The number of tracks that @c m_navigation_buffer can be used for
+    mutable unsigned int m_navigation_buffer_capacity;
+    /// Host copy of the fitting results of a tracking pass
+    mutable vecmem::vector<fitting_result<transform3>> m_fit_results{
+        &m_host_mr};
+
+    /// @}
+
     /// @name Sub-algorithms used by this full-chain algorithm
     /// @{
 
-    /// The average number of cells in each partition.
-    /// Adapt to different GPUs' capabilities.
-    unsigned short m_target_cells_per_partition;
     /// Clusterization algorithm
     clusterization_algorithm m_clusterization;
     /// Seeding algorithm
     seeding_algorithm m_seeding;
-    /// Track parameter estimation algorithm
-    track_params_estimation m_track_parameter_estimation;
+    /// Measurement sorting algorithm
+    measurement_sorting_algorithm m_measurement_sorting;
+    /// Track finding algorithm
+    finding_algorithm m_finding;
+    /// Track fitting algorithm
+    fitting_algorithm m_fitting;
+    /// Track state (device to host) copy algorithm
+    device::container_d2h_copy_alg<track_state_container_types>
+        m_track_state_d2h;
+    /// Ambiguity resolution algorithm
+    greedy_ambiguity_resolution_algorithm m_ambiguity_resolution;
+    /// Masking of the hits used by the earlier tracking passes
+    hit_masking m_hit_masking;
+    /// The additional tracking passes
+    std::vector<std::unique_ptr<details::full_chain_algorithm_tracking_pass>>
+        m_tracking_passes;
+
+    /// @}
+
+    /// @name Members used for the CUDA graph execution
+    /// @{
 
-    /// Configs
-    seedfinder_config m_finder_config;
-    spacepoint_grid_config m_grid_config;
-    seedfilter_config m_filter_config;
+    /// The graph, and the capacity bounded buffers that it works on
+    mutable std::unique_ptr<details::full_chain_algorithm_graph> m_graph;
 
     /// @}
 
+    /// The number of events that exceeded a budget of the track finding
+    mutable std::size_t m_n_degraded_events = 0;
+    /// The device timestamps of the last event
+    std::unique_ptr<details::full_chain_algorithm_timestamps> m_timestamps;
+
+    /// Results handed back to the algorithm, for re-use
+    std::unique_ptr<object_pool<output_type>> m_output_pool =
+        std::make_unique<object_pool<output_type>>();
+
+    /// The launch tuning attached to the stream of the chain (if any),
+    /// shared with the copies of the chain
+    std::shared_ptr<const launch_tuning> m_launch_tuning;
+
+    /// The device copy of the module table, if one was set
+    std::unique_ptr<details::full_chain_algorithm_module_table> m_module_table;
+
+    /// @name Members used for staging the input of upcoming events
+    /// @{
+
+    /// Page-locked host memory resource for the staging buffers
+    vecmem::cuda::host_memory_resource m_pinned_host_mr;
+    /// CUDA stream used for the uploads
+    stream m_upload_stream;
+    /// (Asynchronous) Memory copy object used for the uploads
+    mutable vecmem::cuda::async_copy m_upload_copy;
+    /// The slots of the staging ring
+    mutable std::vector<
+        std::unique_ptr<details::full_chain_algorithm_staging_slot>>
+        m_staging_ring;
+    /// The slot to re-use next, if none of them are free
+    mutable std::size_t m_next_staging_slot;
+
+    /// @}
+
+    /// The ring that the results of @c enqueue are copied back through,
+    /// created on first use. Declared last, so that it delivers the results
+    /// still in flight before any other member goes away.
+    mutable std::unique_ptr<result_ring> m_result_ring;
+
 };  // class full_chain_algorithm
 
 }  // namespace traccc::cuda
@@ -0,0 +1,150 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Local include(s).
+#include "full_chain_pipeline.hpp"
+
+// System include(s).
+#include <algorithm>
+#include <exception>
+#include <memory>
+#include <stdexcept>
+#include <utility>
+
+namespace traccc::cuda {
+
+full_chain_pipeline::full_chain_pipeline(const full_chain_algorithm& parent,
+                                         std::size_t n_lanes,
+                                         std::size_t queue_depth)
+    : m_queue_depth(queue_depth) {
+
+    if (n_lanes == 0u) {
+        throw std::invalid_argument(
+            "A full chain pipeline needs at least one lane");
+    }
+
+    // Set up all of the lanes first, and only then start their threads.
+    m_lanes.reserve(n_lanes);
+    for (std::size_t i = 0u; i < n_lanes; ++i) {
+        m_lanes.push_back(std::make_unique<lane>(parent));
+    }
+    for (auto& l : m_lanes) {
+        l->thread = std::thread([this, &l = *l]() { run(l); });
+    }
+}
+
+full_chain_pipeline::~full_chain_pipeline() {
+
+    // Let the lanes finish their events, and stop.
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_stop = true;
+    }
+    m_work_cv.notify_all();
+    for (auto& l : m_lanes) {
+        l->thread.join();
+    }
+    // Deliver the results still in flight, while the pipeline is intact.
+    for (auto& l : m_lanes) {
+        l->algorithm.drain();
+    }
+}
+
+std::future<full_chain_pipeline::output_type> full_chain_pipeline::submit(
+    cell_collection_types::host cells,
+    cell_module_collection_types::host modules) {
+
+    // Take ownership of the input of the event.
+    auto new_job = std::make_unique<job>();
+    new_job->cells = std::move(cells);
+    new_job->modules = std::move(modules);
+    std::future<output_type> result = new_job->result.get_future();
+
+    {
+        // Wait for a lane with space for the event.
+        std::unique_lock<std::mutex> lock(m_mutex);
+        auto less_loaded = [](const std::unique_ptr<lane>& a,
+                              const std::unique_ptr<lane>& b) {
+            return a->jobs.size() < b->jobs.size();
+        };
+        m_done_cv.wait(lock, [&]() {
+            return (*std::min_element(m_lanes.begin(), m_lanes.end(),
+                                      less_loaded))
+                       ->jobs.size() <= m_queue_depth;
+        });
+
+        // Give the event to the least loaded lane.
+        lane& l =
+            **std::min_element(m_lanes.begin(), m_lanes.end(), less_loaded);
+        l.jobs.push_back(std::move(new_job));
+        ++m_in_flight;
+    }
+    m_work_cv.notify_all();
+
+    return result;
+}
+
+void full_chain_pipeline::wait() const {
+
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_done_cv.wait(lock, [this]() { return m_in_flight == 0u; });
+}
+
+void full_chain_pipeline::run(lane& l) {
+
+    std::unique_lock<std::mutex> lock(m_mutex);
+    while (true) {
+
+        // Wait for an event, or for the pipeline to stop. The lane only stops
+        // once it has no events left.
+        m_work_cv.wait(lock, [&]() { return (m_stop || !l.jobs.empty()); });
+        if (l.jobs.empty()) {
+            return;
+        }
+
+        // The jobs are only removed from the lane by this thread, so they
+        // stay available without holding the lock.
+        job& current = *(l.jobs.front());
+        const job* next = (l.jobs.size() > 1u ? l.jobs[1].get() : nullptr);
+        lock.unlock();
+
+        // The promise of the event is fulfilled by the completion thread of
+        // the lane's result ring, once the results arrived on the host.
+        auto result = std::make_shared<std::promise<output_type>>(
+            std::move(current.result));
+        try {
+            // Start uploading the next event, before processing the current
+            // one, so that the upload overlaps with the processing.
+            if (next != nullptr) {
+                l.algorithm.prefetch(next->cells, next->modules);
+            }
+            l.algorithm.enqueue(current.cells, current.modules,
+                                [this, result](output_type&& event_result) {
+                                    result->set_value(std::move(event_result));
+                                    finish_event();
+                                });
+        } catch (...) {
+            result->set_exception(std::current_exception());
+            finish_event();
+        }
+
+        lock.lock();
+        l.jobs.pop_front();
+        m_done_cv.notify_all();
+    }
+}
+
+void full_chain_pipeline::finish_event() {
+
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        --m_in_flight;
+    }
+    m_done_cv.notify_all();
+}
+
+}  // namespace traccc::cuda
@@ -0,0 +1,138 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Local include(s).
+#include "full_chain_algorithm.hpp"
+
+// Project include(s).
+#include "traccc/edm/cell.hpp"
+
+// System include(s).
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace traccc::cuda {
+
+/// Asynchronous front-end of @c traccc::cuda::full_chain_algorithm, keeping
+/// several events in flight on one device
+///
+/// Events are submitted from any (one or more) host thread(s), and their
+/// results are delivered through futures. The pipeline processes the events
+/// with a number of "lanes". Each lane is a copy of the parent algorithm, with
+/// its own streams and memory, driven by one internal host thread. While a
+/// lane processes an event, it already uploads the input of its next event
+/// on its upload stream (if the parent has a staging ring). So the uploads,
+/// the kernels and the downloads of the events overlap with each other, both
+/// inside of the lanes and across them.
+///
+/// The lanes need host threads of their own, as the chain synchronises with
+/// the host while processing an event (to size its buffers). But the
+/// submitting side does not, so a single reader thread can keep the device
+/// busy. The results come back through the result rings of the lanes (see
+/// @c traccc::cuda::full_chain_algorithm::enqueue), so a lane moves on to
+/// its next event without waiting for the download of the previous one.
+///
+class full_chain_pipeline {
+
+    public:
+    /// The type of the results of the events
+    using output_type = full_chain_algorithm::output_type;
+
+    /// Constructor
+    ///
+    /// @param parent The algorithm chain to make the lanes from
+    /// @param n_lanes The number of events processed at the same time
+    /// @param queue_depth The number of events waiting for each lane, beyond
+    ///                    the one being processed by it. @c submit() blocks
+    ///                    while all lanes have this many waiting events.
+    ///
+    full_chain_pipeline(const full_chain_algorithm& parent,
+                        std::size_t n_lanes, std::size_t queue_depth = 1);
+
+    /// Destructor, finishing all of the submitted events
+    ~full_chain_pipeline();
+
+    /// No copying of the pipeline
+    full_chain_pipeline(const full_chain_pipeline&) = delete;
+    /// No copying of the pipeline
+    full_chain_pipeline& operator=(const full_chain_pipeline&) = delete;
+
+    /// Submit an event for processing
+    ///
+    /// The event is given to the lane with the fewest events. Exceptions
+    /// thrown while processing the event are re-thrown by the future.
+    ///
+    /// @param cells The cells for every detector module in the event
+    /// @param modules The modules of the event
+    /// @return The future result of the event
+    ///
+    std::future<output_type> submit(
+        cell_collection_types::host cells,
+        cell_module_collection_types::host modules);
+
+    /// Wait for all of the submitted events to finish
+    void wait() const;
+
+    /// Get the number of lanes of the pipeline
+    std::size_t n_lanes() const { return m_lanes.size(); }
+
+    private:
+    /// One event, waiting for processing or being processed
+    struct job {
+        /// The cells of the event
+        cell_collection_types::host cells;
+        /// The modules of the event
+        cell_module_collection_types::host modules;
+        /// The promise of the result of the event
+        std::promise<output_type> result;
+    };
+
+    /// One lane of the pipeline
+    struct lane {
+        /// Constructor
+        explicit lane(const full_chain_algorithm& parent) : algorithm(parent) {}
+        /// The algorithm chain of the lane
+        full_chain_algorithm algorithm;
+        /// The events of the lane, the first one being processed
+        std::deque<std::unique_ptr<job>> jobs;
+        /// The thread driving the lane
+        std::thread thread;
+    };
+
+    /// The loop run by the thread of one lane
+    void run(lane& l);
+
+    /// Account for an event whose result was delivered
+    void finish_event();
+
+    /// The lanes of the pipeline
+    std::vector<std::unique_ptr<lane>> m_lanes;
+    /// The number of events waiting for each lane
+    std::size_t m_queue_depth;
+    /// The number of submitted events whose results were not delivered yet
+    std::size_t m_in_flight = 0;
+    /// Whether the pipeline is being shut down
+    bool m_stop = false;
+
+    /// Mutex protecting the state of the lanes
+    mutable std::mutex m_mutex;
+    /// Condition variable signalling that a lane has a new event
+    std::condition_variable m_work_cv;
+    /// Condition variable signalling that a lane finished an event
+    mutable std::condition_variable m_done_cv;
+
+};  // class full_chain_pipeline
+
+}  // namespace traccc::cuda
@@ -7,7 +7,9 @@
 
 // Project include(s).
 #include "traccc/cuda/finding/finding_algorithm.hpp"
+#include "traccc/cuda/finding/truth_matching_algorithm.hpp"
 #include "traccc/cuda/fitting/fitting_algorithm.hpp"
+#include "traccc/cuda/seeding/seed_selection.hpp"
 #include "traccc/cuda/seeding/seeding_algorithm.hpp"
 #include "traccc/cuda/seeding/track_params_estimation.hpp"
 #include "traccc/definitions/common.hpp"
@@ -55,9 +57,11 @@
 #include <vecmem/utils/cuda/copy.hpp>
 
 // System include(s).
+#include <algorithm>
 #include <exception>
 #include <iomanip>
 #include <iostream>
+#include <tuple>
 
 using namespace traccc;
 
@@ -97,6 +101,14 @@ int seq_run(const traccc::opts::track_seeding& seeding_opts,
     // Performance writer
     traccc::seeding_performance_writer sd_performance_writer(
         traccc::seeding_performance_writer::config{});
+    // The seeds handed to the track finding after the seed selection are
+    // plotted next to the ones made by the seeding, to show the efficiency
+    // lost by the selection.
+    traccc::seeding_performance_writer::config sd_selected_cfg;
+    sd_selected_cfg.file_mode = "UPDATE";
+    sd_selected_cfg.name = "selected_seeding";
+    traccc::seeding_performance_writer sd_selected_performance_writer(
+        sd_selected_cfg);
     traccc::finding_performance_writer find_performance_writer(
         traccc::finding_performance_writer::config{});
     traccc::fitting_performance_writer fit_performance_writer(
@@ -117,8 +129,10 @@ int seq_run(const traccc::opts::track_seeding& seeding_opts,
     uint64_t n_spacepoints = 0;
     uint64_t n_seeds = 0;
     uint64_t n_seeds_cuda = 0;
+    uint64_t n_selected_seeds_cuda = 0;
     uint64_t n_found_tracks = 0;
     uint64_t n_found_tracks_cuda = 0;
+    uint64_t n_degraded_events_cuda = 0;
     uint64_t n_fitted_tracks = 0;
     uint64_t n_fitted_tracks_cuda = 0;
 
@@ -179,6 +193,15 @@ int seq_run(const traccc::opts::track_seeding& seeding_opts,
                                             async_copy,
                                             stream};
     traccc::cuda::track_params_estimation tp_cuda{mr, async_copy, stream};
+    traccc::cuda::seed_selection ss_cuda{seeding_opts.seedselection, mr,
+                                         async_copy, stream};
+
+    // Truth matching of the track candidates, for the performance writer
+    traccc::device::container_h2d_copy_alg<
+        traccc::measurement_particle_container_types>
+        truth_h2d{mr, async_copy};
+    traccc::cuda::truth_matching_algorithm truth_matching_cuda{mr, async_copy,
+                                                               stream};
 
     // Finding algorithm configuration
     typename traccc::cuda::finding_algorithm<
@@ -186,6 +209,17 @@ int seq_run(const traccc::opts::track_seeding& seeding_opts,
     cfg.min_track_candidates_per_track = finding_opts.track_candidates_range[0];
     cfg.max_track_candidates_per_track = finding_opts.track_candidates_range[1];
     cfg.chi2_max = finding_opts.chi2_max;
+    cfg.run_step_loop_on_device = finding_opts.run_step_loop_on_device;
+    cfg.min_params_for_surface_sort = finding_opts.min_params_for_surface_sort;
+    cfg.device_memory_budget =
+        std::size_t{finding_opts.device_memory_budget_mb} * 1024u * 1024u;
+    cfg.branching = finding_opts.best_chi2_branching
+                    ? traccc::branching_policy::e_best_chi2
+                    : traccc::branching_policy::e_first_compatible;
+    cfg.prune_shared_hits = finding_opts.prune_shared_hits;
+    cfg.max_num_seeds = finding_opts.max_num_seeds;
+    cfg.max_num_branches_in_flight = finding_opts.max_num_branches_in_flight;
+    cfg.max_event_time_ms = finding_opts.max_event_time_ms;
     cfg.propagation = propagation_opts.config;
 
     // Finding algorithm object
@@ -220,6 +254,10 @@ int seq_run(const traccc::opts::track_seeding& seeding_opts,
         traccc::seed_collection_types::buffer seeds_cuda_buffer(0, *(mr.host));
         traccc::bound_track_parameters_collection_types::buffer
             params_cuda_buffer(0, *mr.host);
+        traccc::seed_collection_types::buffer selected_seeds_cuda_buffer(
+            0, *(mr.host));
+        traccc::bound_track_parameters_collection_types::buffer
+            selected_params_cuda_buffer(0, *mr.host);
 
         traccc::track_candidate_container_types::buffer
             track_candidates_cuda_buffer{{{}, *(mr.host)},
@@ -312,11 +350,32 @@ int seq_run(const traccc::opts::track_seeding& seeding_opts,
                             {0.f, 0.f, seeding_opts.seedfinder.bFieldInZ});
             }  // stop measuring track params cpu timer
 
+            /*----------------------------
+                   Seed selection
+            ----------------------------*/
+
+            // CUDA
+            if (seeding_opts.seedselection.enabled) {
+                traccc::performance::timer t("Seed selection (cuda)",
+                                             elapsedTimes);
+                std::tie(selected_seeds_cuda_buffer,
+                         selected_params_cuda_buffer) =
+                    ss_cuda(seeds_cuda_buffer, params_cuda_buffer);
+                stream.synchronize();
+            }  // stop measuring seed selection cuda timer
+            const traccc::bound_track_parameters_collection_types::const_view
+                finding_params_cuda_view =
+                    (seeding_opts.seedselection.enabled
+                         ? selected_params_cuda_buffer
+                         : params_cuda_buffer);
+
             // Navigation buffer
             auto navigation_buffer = detray::create_candidates_buffer(
                 host_det,
-                device_finding.get_config().max_num_branches_per_seed *
-                    copy.get_size(seeds_cuda_buffer),
+                std::min<std::size_t>(
+                    device_finding.get_config().max_num_branches_per_seed *
+                        copy.get_size(finding_params_cuda_view),
+                    propagation_opts.navigation_buffer_size),
                 mr.main, mr.host);
 
             /*------------------------
@@ -328,7 +387,10 @@ int seq_run(const traccc::opts::track_seeding& seeding_opts,
                                              elapsedTimes);
                 track_candidates_cuda_buffer = device_finding(
                     det_view, field, navigation_buffer,
-                    measurements_cuda_buffer, params_cuda_buffer);
+                    measurements_cuda_buffer, finding_params_cuda_view);
+            }
+            if (device_finding.get_budget_status().degraded()) {
+                ++n_degraded_events_cuda;
             }
 
             if (accelerator_opts.compare_with_cpu) {
@@ -368,6 +430,11 @@ int seq_run(const traccc::opts::track_seeding& seeding_opts,
         traccc::bound_track_parameters_collection_types::host params_cuda;
         async_copy(seeds_cuda_buffer, seeds_cuda)->wait();
         async_copy(params_cuda_buffer, params_cuda)->wait();
+        traccc::seed_collection_types::host selected_seeds_cuda;
+        if (seeding_opts.seedselection.enabled) {
+            async_copy(selected_seeds_cuda_buffer, selected_seeds_cuda)
+                ->wait();
+        }
 
         // Copy track candidates from device to host
         traccc::track_candidate_container_types::host track_candidates_cuda =
@@ -422,6 +489,7 @@ int seq_run(const traccc::opts::track_seeding& seeding_opts,
         n_spacepoints += sp_reader_output.spacepoints.size();
         n_modules += sp_reader_output.modules.size();
         n_seeds_cuda += seeds_cuda.size();
+        n_selected_seeds_cuda += selected_seeds_cuda.size();
         n_seeds += seeds.size();
         n_found_tracks_cuda += track_candidates_cuda.size();
         n_found_tracks += track_candidates.size();
@@ -439,9 +507,26 @@ int seq_run(const traccc::opts::track_seeding& seeding_opts,
             sd_performance_writer.write(
                 vecmem::get_data(seeds_cuda),
                 vecmem::get_data(sp_reader_output.spacepoints), evt_map);
+            if (seeding_opts.seedselection.enabled) {
+                sd_selected_performance_writer.write(
+                    vecmem::get_data(selected_seeds_cuda),
+                    vecmem::get_data(sp_reader_output.spacepoints), evt_map);
+            }
 
-            find_performance_writer.write(
-                traccc::get_data(track_candidates_cuda), evt_map);
+            // Match the track candidates to the particles on the device, and
+            // only copy the matches back.
+            const traccc::measurement_particle_container_types::host
+                truth_host = evt_map.make_measurement_particles(*(mr.host));
+            const traccc::measurement_particle_container_types::buffer
+                truth_buffer = truth_h2d(traccc::get_data(truth_host));
+            traccc::track_truth_match_collection_types::host matches_cuda{
+                mr.host};
+            async_copy(truth_matching_cuda(track_candidates_cuda_buffer,
+                                           truth_buffer),
+                       matches_cuda)
+                ->wait();
+            find_performance_writer.write(vecmem::get_data(matches_cuda),
+                                          evt_map);
 
             for (unsigned int i = 0; i < track_states_cuda.size(); i++) {
                 const auto& trk_states_per_track =
@@ -457,6 +542,9 @@ int seq_run(const traccc::opts::track_seeding& seeding_opts,
 
     if (performance_opts.run) {
         sd_performance_writer.finalize();
+        if (seeding_opts.seedselection.enabled) {
+            sd_selected_performance_writer.finalize();
+        }
         nsd_performance_writer.finalize();
         find_performance_writer.finalize();
         fit_performance_writer.finalize();
@@ -468,10 +556,19 @@ int seq_run(const traccc::opts::track_seeding& seeding_opts,
               << n_modules << " modules" << std::endl;
     std::cout << "- created  (cpu)  " << n_seeds << " seeds" << std::endl;
     std::cout << "- created (cuda)  " << n_seeds_cuda << " seeds" << std::endl;
+    if (seeding_opts.seedselection.enabled) {
+        std::cout << "- selected (cuda) " << n_selected_seeds_cuda
+                  << " seeds for the track finding" << std::endl;
+    }
     std::cout << "- created  (cpu) " << n_found_tracks << " found tracks"
               << std::endl;
     std::cout << "- created (cuda) " << n_found_tracks_cuda << " found tracks"
               << std::endl;
+    if (n_degraded_events_cuda > 0) {
+        std::cout << "- degraded (cuda) " << n_degraded_events_cuda
+                  << " events, exceeding the track finding budgets"
+                  << std::endl;
+    }
     std::cout << "- created  (cpu) " << n_fitted_tracks << " fitted tracks"
               << std::endl;
     std::cout << "- created (cuda) " << n_fitted_tracks_cuda << " fitted tracks"
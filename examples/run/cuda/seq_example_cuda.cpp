@@ -9,8 +9,12 @@
 #include "traccc/clusterization/clusterization_algorithm.hpp"
 #include "traccc/clusterization/spacepoint_formation.hpp"
 #include "traccc/cuda/clusterization/clusterization_algorithm.hpp"
+#include "traccc/cuda/io/direct_cell_reader.hpp"
 #include "traccc/cuda/seeding/seeding_algorithm.hpp"
+#include "traccc/cuda/seeding/spacepoint_roi_selection.hpp"
 #include "traccc/cuda/seeding/track_params_estimation.hpp"
+#include "traccc/cuda/utils/device_peaks.hpp"
+#include "traccc/cuda/utils/kernel_profiler.hpp"
 #include "traccc/cuda/utils/stream.hpp"
 #include "traccc/efficiency/seeding_performance_writer.hpp"
 #include "traccc/io/read_cells.hpp"
@@ -26,9 +30,14 @@
 #include "traccc/options/track_seeding.hpp"
 #include "traccc/performance/collection_comparator.hpp"
 #include "traccc/performance/container_comparator.hpp"
+#include "traccc/performance/roofline.hpp"
 #include "traccc/performance/timer.hpp"
 #include "traccc/seeding/seeding_algorithm.hpp"
+#include "traccc/seeding/spacepoint_roi_selection.hpp"
 #include "traccc/seeding/track_params_estimation.hpp"
+#include "traccc/utils/trace.hpp"
+#include "traccc/utils/traced_memory_resource.hpp"
+#include "traccc/utils/work_counter.hpp"
 
 // VecMem include(s).
 #include <vecmem/memory/cuda/device_memory_resource.hpp>
@@ -41,6 +50,7 @@
 #include <iomanip>
 #include <iostream>
 #include <memory>
+#include <tuple>
 
 int seq_run(const traccc::opts::detector& detector_opts,
             const traccc::opts::input_data& input_opts,
@@ -53,11 +63,13 @@ int seq_run(const traccc::opts::detector& detector_opts,
     auto [surface_transforms, barcode_map] = traccc::io::read_geometry(
         detector_opts.detector_file,
         (detector_opts.use_detray_detector ? traccc::data_format::json
-                                           : traccc::data_format::csv));
+                                           : traccc::data_format::csv),
+        detector_opts.cache_directory);
 
     // Read the digitization configuration file
-    auto digi_cfg =
-        traccc::io::read_digitization_config(detector_opts.digitization_file);
+    auto digi_cfg = traccc::io::read_digitization_config(
+        detector_opts.digitization_file, traccc::data_format::json,
+        detector_opts.cache_directory);
 
     // Output stats
     uint64_t n_cells = 0;
@@ -76,7 +88,9 @@ int seq_run(const traccc::opts::detector& detector_opts,
     // Memory resources used by the application.
     vecmem::host_memory_resource host_mr;
     vecmem::cuda::host_memory_resource cuda_host_mr;
-    vecmem::cuda::device_memory_resource device_mr;
+    vecmem::cuda::device_memory_resource cuda_device_mr;
+    traccc::traced_memory_resource device_mr{cuda_device_mr,
+                                             "Device memory management"};
     traccc::memory_resource mr{device_mr, &cuda_host_mr};
 
     traccc::clusterization_algorithm ca(host_mr);
@@ -85,8 +99,15 @@ int seq_run(const traccc::opts::detector& detector_opts,
                                  {seeding_opts.seedfinder},
                                  seeding_opts.seedfilter, host_mr);
     traccc::track_params_estimation tp(host_mr);
+    traccc::spacepoint_roi_selection rs(host_mr);
+
+    // Profiler of the individual kernels, if requested.
+    traccc::cuda::kernel_profiler kernel_profiler;
 
     traccc::cuda::stream stream;
+    if (accelerator_opts.profile_kernels) {
+        stream.set_profiler(&kernel_profiler);
+    }
 
     vecmem::cuda::async_copy copy{stream.cudaStream()};
 
@@ -96,17 +117,48 @@ int seq_run(const traccc::opts::detector& detector_opts,
         seeding_opts.seedfinder, {seeding_opts.seedfinder},
         seeding_opts.seedfilter, mr, copy, stream);
     traccc::cuda::track_params_estimation tp_cuda(mr, copy, stream);
+    traccc::cuda::spacepoint_roi_selection rs_cuda(mr, copy, stream);
+
+    // Reader of binary cell files straight into device memory, if requested.
+    std::unique_ptr<traccc::cuda::direct_cell_reader> direct_reader;
+    if (accelerator_opts.direct_input &&
+        (input_opts.format == traccc::data_format::binary)) {
+        direct_reader =
+            std::make_unique<traccc::cuda::direct_cell_reader>(device_mr,
+                                                               stream);
+    }
+
+    // Regions of interest to restrict the reconstruction to, on the host and
+    // on the device
+    traccc::region_of_interest_collection_types::host rois(&host_mr);
+    rois.assign(seeding_opts.rois.begin(), seeding_opts.rois.end());
+    traccc::region_of_interest_collection_types::buffer rois_buffer(
+        static_cast<unsigned int>(rois.size()), mr.main);
+    copy(vecmem::get_data(rois), rois_buffer)->wait();
 
     // performance writer
     traccc::seeding_performance_writer sd_performance_writer(
         traccc::seeding_performance_writer::config{});
 
     traccc::performance::timing_info elapsedTimes;
+    elapsedTimes.measure_hardware_counters = performance_opts.hardware_counters;
+
+    // Estimates of the work done on the device and on the host, if a
+    // roofline report was requested. The stages are named the same as their
+    // timers.
+    traccc::work_counter cuda_work, host_work;
+    traccc::work_counter* cuda_counter =
+        (accelerator_opts.roofline ? &cuda_work : nullptr);
+    traccc::work_counter* host_counter =
+        (accelerator_opts.roofline ? &host_work : nullptr);
 
     // Loop over events
     for (unsigned int event = input_opts.skip;
          event < input_opts.events + input_opts.skip; ++event) {
 
+        // Annotate the profiler ranges with the event number.
+        TRACCC_TRACE_EVENT(event);
+
         // Instantiate host containers/collections
         traccc::io::cell_reader_output read_out_per_event(mr.host);
         traccc::clusterization_algorithm::output_type measurements_per_event;
@@ -124,7 +176,26 @@ int seq_run(const traccc::opts::detector& detector_opts,
         {
             traccc::performance::timer wall_t("Wall time", elapsedTimes);
 
-            {
+            // The input cells and modules on the device.
+            traccc::cell_collection_types::buffer cells_buffer(0, *mr.host);
+            traccc::cell_module_collection_types::buffer modules_buffer(
+                0, *mr.host);
+
+            if (direct_reader) {
+                traccc::performance::timer t("File reading  (cuda)",
+                                             elapsedTimes);
+                // Read the cells from the relevant event file straight into
+                // device memory.
+                const std::string prefix =
+                    traccc::io::data_directory() + input_opts.directory;
+                std::tie(cells_buffer, modules_buffer) = (*direct_reader)(
+                    prefix +
+                        traccc::io::get_event_filename(event, "-cells.dat"),
+                    prefix +
+                        traccc::io::get_event_filename(event, "-modules.dat"));
+            }  // stop measuring file reading timer
+
+            if ((!direct_reader) || accelerator_opts.compare_with_cpu) {
                 traccc::performance::timer t("File reading  (cpu)",
                                              elapsedTimes);
                 // Read the cells from the relevant event file into host memory.
@@ -142,17 +213,24 @@ int seq_run(const traccc::opts::detector& detector_opts,
             /*-----------------------------
                 Clusterization and Spacepoint Creation (cuda)
             -----------------------------*/
-            // Create device copy of input collections
-            traccc::cell_collection_types::buffer cells_buffer(
-                cells_per_event.size(), mr.main);
-            copy(vecmem::get_data(cells_per_event), cells_buffer);
-            traccc::cell_module_collection_types::buffer modules_buffer(
-                modules_per_event.size(), mr.main);
-            copy(vecmem::get_data(modules_per_event), modules_buffer);
+            // Create device copy of input collections, if they were not read
+            // into device memory directly.
+            if (!direct_reader) {
+                cells_buffer = traccc::cell_collection_types::buffer(
+                    cells_per_event.size(), mr.main);
+                copy(vecmem::get_data(cells_per_event), cells_buffer);
+                modules_buffer = traccc::cell_module_collection_types::buffer(
+                    modules_per_event.size(), mr.main);
+                copy(vecmem::get_data(modules_per_event), modules_buffer);
+            }
+            n_cells += cells_buffer.size();
+            n_modules += modules_buffer.size();
 
             {
                 traccc::performance::timer t("Clusterization (cuda)",
                                              elapsedTimes);
+                traccc::work_counter::scope w(cuda_counter,
+                                              "Clusterization (cuda)");
                 // Reconstruct it into spacepoints on the device.
                 spacepoints_cuda_buffer =
                     ca_cuda(cells_buffer, modules_buffer).first;
@@ -168,6 +246,8 @@ int seq_run(const traccc::opts::detector& detector_opts,
                 {
                     traccc::performance::timer t("Clusterization  (cpu)",
                                                  elapsedTimes);
+                    traccc::work_counter::scope w(host_counter,
+                                                  "Clusterization  (cpu)");
                     measurements_per_event =
                         ca(cells_per_event, modules_per_event);
                 }  // stop measuring clusterization cpu timer
@@ -179,11 +259,35 @@ int seq_run(const traccc::opts::detector& detector_opts,
                 {
                     traccc::performance::timer t("Spacepoint formation  (cpu)",
                                                  elapsedTimes);
+                    traccc::work_counter::scope w(
+                        host_counter, "Spacepoint formation  (cpu)");
                     spacepoints_per_event =
                         sf(measurements_per_event, modules_per_event);
                 }  // stop measuring spacepoint formation cpu timer
             }
 
+            /*----------------------------
+                Region of interest selection
+            ----------------------------*/
+
+            // Only seed (and therefore track) in the regions of interest, if
+            // any were given.
+            if (!rois.empty()) {
+                {
+                    traccc::performance::timer t("RoI selection (cuda)",
+                                                 elapsedTimes);
+                    spacepoints_cuda_buffer =
+                        rs_cuda(spacepoints_cuda_buffer, rois_buffer);
+                    stream.synchronize();
+                }  // stop measuring RoI selection cuda timer
+
+                if (accelerator_opts.compare_with_cpu) {
+                    traccc::performance::timer t("RoI selection  (cpu)",
+                                                 elapsedTimes);
+                    spacepoints_per_event = rs(spacepoints_per_event, rois);
+                }  // stop measuring RoI selection cpu timer
+            }
+
             /*----------------------------
                 Seeding algorithm
             ----------------------------*/
@@ -192,6 +296,7 @@ int seq_run(const traccc::opts::detector& detector_opts,
 
             {
                 traccc::performance::timer t("Seeding (cuda)", elapsedTimes);
+                traccc::work_counter::scope w(cuda_counter, "Seeding (cuda)");
                 seeds_cuda_buffer = sa_cuda(spacepoints_cuda_buffer);
                 stream.synchronize();
             }  // stop measuring seeding cuda timer
@@ -200,6 +305,7 @@ int seq_run(const traccc::opts::detector& detector_opts,
 
             if (accelerator_opts.compare_with_cpu) {
                 traccc::performance::timer t("Seeding  (cpu)", elapsedTimes);
+                traccc::work_counter::scope w(host_counter, "Seeding  (cpu)");
                 seeds = sa(spacepoints_per_event);
             }  // stop measuring seeding cpu timer
 
@@ -212,6 +318,8 @@ int seq_run(const traccc::opts::detector& detector_opts,
             {
                 traccc::performance::timer t("Track params (cuda)",
                                              elapsedTimes);
+                traccc::work_counter::scope w(cuda_counter,
+                                              "Track params (cuda)");
                 params_cuda_buffer = tp_cuda(spacepoints_cuda_buffer,
                                              seeds_cuda_buffer, field_vec);
                 stream.synchronize();
@@ -222,6 +330,8 @@ int seq_run(const traccc::opts::detector& detector_opts,
             if (accelerator_opts.compare_with_cpu) {
                 traccc::performance::timer t("Track params  (cpu)",
                                              elapsedTimes);
+                traccc::work_counter::scope w(host_counter,
+                                              "Track params  (cpu)");
                 params = tp(spacepoints_per_event, seeds, field_vec);
             }  // stop measuring track params cpu timer
 
@@ -264,9 +374,13 @@ int seq_run(const traccc::opts::detector& detector_opts,
             compare_track_parameters(vecmem::get_data(params),
                                      vecmem::get_data(params_cuda));
         }
+        if (accelerator_opts.profile_kernels) {
+            std::cout << "===>>> Kernel timing of event " << event
+                      << " <<<===\n"
+                      << kernel_profiler.finish_event() << std::endl;
+        }
+
         /// Statistics
-        n_modules += read_out_per_event.modules.size();
-        n_cells += read_out_per_event.cells.size();
         n_measurements += measurements_per_event.size();
         n_spacepoints += spacepoints_per_event.size();
         n_seeds += seeds.size();
@@ -302,6 +416,25 @@ int seq_run(const traccc::opts::detector& detector_opts,
     std::cout << "- created  (cpu) " << n_seeds << " seeds" << std::endl;
     std::cout << "- created (cuda) " << n_seeds_cuda << " seeds" << std::endl;
     std::cout << "==>Elapsed times...\n" << elapsedTimes << std::endl;
+    if (accelerator_opts.profile_kernels) {
+        std::cout << "==>Kernel timing...\n"
+                  << kernel_profiler.totals() << std::endl;
+    }
+    if (accelerator_opts.roofline) {
+        std::cout << "==>Roofline (cuda)...\n"
+                  << traccc::performance::roofline_report{
+                         elapsedTimes, cuda_work,
+                         traccc::cuda::get_device_peaks()}
+                  << std::endl;
+        if (accelerator_opts.compare_with_cpu) {
+            std::cout << "==>Roofline (cpu)...\n"
+                      << traccc::performance::roofline_report{
+                             elapsedTimes, host_work,
+                             {"Host", accelerator_opts.host_peak_bandwidth,
+                              accelerator_opts.host_peak_gflops}}
+                      << std::endl;
+        }
+    }
 
     return 0;
 }
@@ -0,0 +1,24 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Local include(s).
+#include "../common/throughput_hybrid.hpp"
+
+#include "../cpu/full_chain_algorithm.hpp"
+#include "full_chain_algorithm.hpp"
+
+// VecMem include(s).
+#include <vecmem/memory/cuda/host_memory_resource.hpp>
+
+int main(int argc, char* argv[]) {
+
+    // Execute the throughput test.
+    return traccc::throughput_hybrid<traccc::full_chain_algorithm,
+                                     traccc::cuda::full_chain_algorithm,
+                                     vecmem::cuda::host_memory_resource>(
+        "Multi-threaded hybrid host + CUDA GPU throughput tests", argc, argv);
+}
@@ -13,8 +13,18 @@
 // VecMem include(s).
 #include <vecmem/memory/cuda/host_memory_resource.hpp>
 
+// System include(s).
+#include <cstdlib>
+
 int main(int argc, char* argv[]) {
 
+    // Load the CUDA kernels only when they are first launched, instead of
+    // loading all of them when the CUDA context is created. Unless the user
+    // chose a module loading mode already.
+#ifndef _WIN32
+    setenv("CUDA_MODULE_LOADING", "LAZY", 0);
+#endif  // not _WIN32
+
     // Execute the throughput test.
     static const bool use_host_caching = true;
     return traccc::throughput_mt<traccc::cuda::full_chain_algorithm,
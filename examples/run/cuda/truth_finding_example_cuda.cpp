@@ -8,6 +8,8 @@
 // Project include(s).
 #include "traccc/cuda/finding/finding_algorithm.hpp"
 #include "traccc/cuda/fitting/fitting_algorithm.hpp"
+#include "traccc/cuda/seeding/truth_seed_generator.hpp"
+#include "traccc/cuda/utils/managed_memory_policy.hpp"
 #include "traccc/cuda/utils/stream.hpp"
 #include "traccc/definitions/common.hpp"
 #include "traccc/definitions/primitives.hpp"
@@ -31,7 +33,7 @@
 #include "traccc/performance/container_comparator.hpp"
 #include "traccc/performance/timer.hpp"
 #include "traccc/resolution/fitting_performance_writer.hpp"
-#include "traccc/utils/seed_generator.hpp"
+#include "traccc/utils/batched_seed_generator.hpp"
 
 // detray include(s).
 #include "detray/core/detector.hpp"
@@ -50,9 +52,11 @@
 #include <vecmem/utils/cuda/async_copy.hpp>
 
 // System include(s).
+#include <algorithm>
 #include <exception>
 #include <iomanip>
 #include <iostream>
+#include <vector>
 
 using namespace traccc;
 
@@ -85,6 +89,8 @@ int seq_run(const traccc::opts::track_finding& finding_opts,
     vecmem::host_memory_resource host_mr;
     vecmem::cuda::host_memory_resource cuda_host_mr;
     vecmem::cuda::managed_memory_resource mng_mr;
+    traccc::cuda::managed_memory_policy detector_mr{
+        mng_mr, traccc::cuda::managed_memory_policy::usage::read_mostly};
     vecmem::cuda::device_memory_resource device_mr;
     traccc::memory_resource mr{device_mr, &cuda_host_mr};
 
@@ -99,6 +105,8 @@ int seq_run(const traccc::opts::track_finding& finding_opts,
     uint64_t n_found_tracks_cuda = 0;
     uint64_t n_fitted_tracks = 0;
     uint64_t n_fitted_tracks_cuda = 0;
+    // The number of active (cuda) track finding branches per step
+    std::vector<uint64_t> n_active_branches_cuda;
 
     /*****************************
      * Build a geometry
@@ -122,7 +130,7 @@ int seq_run(const traccc::opts::track_finding& finding_opts,
                             detector_opts.grid_file);
     }
     auto [host_det, names] =
-        detray::io::read_detector<host_detector_type>(mng_mr, reader_cfg);
+        detray::io::read_detector<host_detector_type>(detector_mr, reader_cfg);
 
     const auto surface_transforms = traccc::io::alt_read_geometry(host_det);
 
@@ -136,6 +144,10 @@ int seq_run(const traccc::opts::track_finding& finding_opts,
     // Stream object
     traccc::cuda::stream stream;
 
+    // Duplicate the (managed memory) detector onto the device, instead of
+    // having the first events page fault on it.
+    detector_mr.prefetch_to_device(stream);
+
     // Copy object
     vecmem::cuda::async_copy async_copy{stream.cudaStream()};
 
@@ -161,6 +173,17 @@ int seq_run(const traccc::opts::track_finding& finding_opts,
     cfg.min_track_candidates_per_track = finding_opts.track_candidates_range[0];
     cfg.max_track_candidates_per_track = finding_opts.track_candidates_range[1];
     cfg.chi2_max = finding_opts.chi2_max;
+    cfg.run_step_loop_on_device = finding_opts.run_step_loop_on_device;
+    cfg.min_params_for_surface_sort = finding_opts.min_params_for_surface_sort;
+    cfg.device_memory_budget =
+        std::size_t{finding_opts.device_memory_budget_mb} * 1024u * 1024u;
+    cfg.branching = finding_opts.best_chi2_branching
+                    ? traccc::branching_policy::e_best_chi2
+                    : traccc::branching_policy::e_first_compatible;
+    cfg.prune_shared_hits = finding_opts.prune_shared_hits;
+    cfg.max_num_seeds = finding_opts.max_num_seeds;
+    cfg.max_num_branches_in_flight = finding_opts.max_num_branches_in_flight;
+    cfg.max_event_time_ms = finding_opts.max_event_time_ms;
     cfg.propagation = propagation_opts.config;
 
     // Finding algorithm object
@@ -179,33 +202,33 @@ int seq_run(const traccc::opts::track_finding& finding_opts,
 
     traccc::performance::timing_info elapsedTimes;
 
-    // Seed generator
-    traccc::seed_generator<host_detector_type> sg(host_det, stddevs);
+    // Seed generators, making the same seeds on the host and on the device
+    traccc::batched_seed_generator<host_detector_type> host_sg(host_det,
+                                                               stddevs);
+    traccc::cuda::truth_seed_generator<device_detector_type> device_sg(
+        stddevs, 0u, mr, async_copy, stream);
 
     // Iterate over events
     for (unsigned int event = input_opts.skip;
          event < input_opts.events + input_opts.skip; ++event) {
 
-        // Truth Track Candidates
+        // Truth states of the particles
         traccc::event_map2 evt_map2(event, input_opts.directory,
                                     input_opts.directory, input_opts.directory);
 
-        traccc::track_candidate_container_types::host truth_track_candidates =
-            evt_map2.generate_truth_candidates(sg, host_mr);
-
-        // Prepare truth seeds
-        traccc::bound_track_parameters_collection_types::host seeds(mr.host);
-        const unsigned int n_tracks = truth_track_candidates.size();
-        for (unsigned int i_trk = 0; i_trk < n_tracks; i_trk++) {
-            seeds.push_back(truth_track_candidates.at(i_trk).header);
-        }
+        const traccc::truth_seed_input_collection_types::host seed_inputs =
+            evt_map2.make_truth_seed_inputs(host_mr);
 
-        traccc::bound_track_parameters_collection_types::buffer seeds_buffer{
-            static_cast<unsigned int>(seeds.size()), mr.main};
-        async_copy.setup(seeds_buffer);
-        async_copy(vecmem::get_data(seeds), seeds_buffer,
+        traccc::truth_seed_input_collection_types::buffer seed_inputs_buffer{
+            static_cast<unsigned int>(seed_inputs.size()), mr.main};
+        async_copy.setup(seed_inputs_buffer);
+        async_copy(vecmem::get_data(seed_inputs), seed_inputs_buffer,
                    vecmem::copy::type::host_to_device);
 
+        // Make the truth seeds on the device
+        traccc::bound_track_parameters_collection_types::buffer seeds_buffer =
+            device_sg(det_view, seed_inputs_buffer, event);
+
         // Read measurements
         traccc::io::measurement_reader_output meas_reader_output(mr.host);
         traccc::io::read_measurements(meas_reader_output, event,
@@ -227,8 +250,10 @@ int seq_run(const traccc::opts::track_finding& finding_opts,
         // Navigation buffer
         auto navigation_buffer = detray::create_candidates_buffer(
             host_det,
-            device_finding.get_config().max_num_branches_per_seed *
-                seeds.size(),
+            std::min<std::size_t>(
+                device_finding.get_config().max_num_branches_per_seed *
+                    seed_inputs.size(),
+                propagation_opts.navigation_buffer_size),
             mr.main, mr.host);
 
         {
@@ -265,6 +290,10 @@ int seq_run(const traccc::opts::track_finding& finding_opts,
 
         if (accelerator_opts.compare_with_cpu) {
 
+            // Make the same truth seeds on the host
+            const traccc::bound_track_parameters_collection_types::host seeds =
+                host_sg(seed_inputs, event, host_mr);
+
             {
                 traccc::performance::timer t("Track finding  (cpu)",
                                              elapsedTimes);
@@ -318,6 +347,15 @@ int seq_run(const traccc::opts::track_finding& finding_opts,
         n_found_tracks_cuda += track_candidates_cuda.size();
         n_fitted_tracks_cuda += track_states_cuda.size();
 
+        const traccc::branch_histogram& branches =
+            device_finding.get_branch_histogram();
+        if (n_active_branches_cuda.size() < branches.n_active.size()) {
+            n_active_branches_cuda.resize(branches.n_active.size(), 0);
+        }
+        for (std::size_t step = 0; step < branches.n_active.size(); ++step) {
+            n_active_branches_cuda[step] += branches.n_active[step];
+        }
+
         if (performance_opts.run) {
             find_performance_writer.write(
                 traccc::get_data(track_candidates_cuda), evt_map2);
@@ -344,6 +382,11 @@ int seq_run(const traccc::opts::track_finding& finding_opts,
               << std::endl;
     std::cout << "- created (cuda) " << n_fitted_tracks_cuda << " fitted tracks"
               << std::endl;
+    std::cout << "- active (cuda) branches per step:";
+    for (uint64_t n_branches : n_active_branches_cuda) {
+        std::cout << " " << n_branches;
+    }
+    std::cout << std::endl;
     std::cout << "- created  (cpu) " << n_found_tracks << " found tracks"
               << std::endl;
     std::cout << "- created  (cpu) " << n_fitted_tracks << " fitted tracks"
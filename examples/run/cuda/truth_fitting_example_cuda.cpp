@@ -7,6 +7,7 @@
 
 // Project include(s).
 #include "traccc/cuda/fitting/fitting_algorithm.hpp"
+#include "traccc/cuda/utils/managed_memory_policy.hpp"
 #include "traccc/cuda/utils/stream.hpp"
 #include "traccc/definitions/common.hpp"
 #include "traccc/definitions/primitives.hpp"
@@ -46,6 +47,7 @@
 #include <vecmem/utils/cuda/async_copy.hpp>
 
 // System include(s).
+#include <algorithm>
 #include <cstdlib>
 #include <exception>
 #include <iomanip>
@@ -87,11 +89,15 @@ int main(int argc, char* argv[]) {
     using device_navigator_type = detray::navigator<const device_detector_type>;
     using device_fitter_type =
         traccc::kalman_fitter<rk_stepper_type, device_navigator_type>;
+    using mixed_device_fitter_type =
+        traccc::kalman_fitter<rk_stepper_type, device_navigator_type, double>;
 
     // Memory resources used by the application.
     vecmem::host_memory_resource host_mr;
     vecmem::cuda::host_memory_resource cuda_host_mr;
     vecmem::cuda::managed_memory_resource mng_mr;
+    traccc::cuda::managed_memory_policy detector_mr{
+        mng_mr, traccc::cuda::managed_memory_policy::usage::read_mostly};
     vecmem::cuda::device_memory_resource device_mr;
     traccc::memory_resource mr{device_mr, &cuda_host_mr};
 
@@ -125,7 +131,7 @@ int main(int argc, char* argv[]) {
                             detector_opts.grid_file);
     }
     auto [host_det, names] =
-        detray::io::read_detector<host_detector_type>(mng_mr, reader_cfg);
+        detray::io::read_detector<host_detector_type>(detector_mr, reader_cfg);
 
     // Detector view object
     auto det_view = detray::get_data(host_det);
@@ -137,6 +143,10 @@ int main(int argc, char* argv[]) {
     // Stream object
     traccc::cuda::stream stream;
 
+    // Duplicate the (managed memory) detector onto the device, instead of
+    // having the first events page fault on it.
+    detector_mr.prefetch_to_device(stream);
+
     // Copy object
     vecmem::cuda::async_copy async_copy{stream.cudaStream()};
 
@@ -163,6 +173,8 @@ int main(int argc, char* argv[]) {
     traccc::fitting_algorithm<host_fitter_type> host_fitting(fit_cfg);
     traccc::cuda::fitting_algorithm<device_fitter_type> device_fitting(
         fit_cfg, mr, async_copy, stream);
+    traccc::cuda::fitting_algorithm<mixed_device_fitter_type>
+        mixed_device_fitting(fit_cfg, mr, async_copy, stream);
 
     // Seed generator
     traccc::seed_generator<host_detector_type> sg(host_det, stddevs);
@@ -187,7 +199,10 @@ int main(int argc, char* argv[]) {
 
         // Navigation buffer
         auto navigation_buffer = detray::create_candidates_buffer(
-            host_det, truth_track_candidates.size(), mr.main, mr.host);
+            host_det,
+            std::min<std::size_t>(truth_track_candidates.size(),
+                                  propagation_opts.navigation_buffer_size),
+            mr.main, mr.host);
 
         // Instantiate cuda containers/collections
         traccc::track_state_container_types::buffer track_states_cuda_buffer{
@@ -232,6 +247,35 @@ int main(int argc, char* argv[]) {
                 vecmem::get_data(track_states_cuda.get_headers()));
         }
 
+        if (accelerator_opts.compare_mixed_precision) {
+
+            traccc::track_state_container_types::buffer
+                mixed_track_states_cuda_buffer{{{}, *(mr.host)},
+                                               {{}, *(mr.host), mr.host}};
+            {
+                traccc::performance::timer t("Track fitting  (cuda, mixed)",
+                                             elapsedTimes);
+
+                // Run fitting
+                mixed_track_states_cuda_buffer =
+                    mixed_device_fitting(det_view, field, navigation_buffer,
+                                         truth_track_candidates_cuda_buffer);
+            }
+            const traccc::track_state_container_types::host
+                mixed_track_states_cuda =
+                    track_state_d2h(mixed_track_states_cuda_buffer);
+
+            // Show which event we are currently presenting the results for.
+            std::cout << "===>>> Event " << event << " <<<===" << std::endl;
+
+            // Compare the track parameters fitted with the two precisions.
+            traccc::collection_comparator<traccc::fitting_result<transform3>>
+                compare_fitting_results{"mixed-precision fitted tracks"};
+            compare_fitting_results(
+                vecmem::get_data(track_states_cuda.get_headers()),
+                vecmem::get_data(mixed_track_states_cuda.get_headers()));
+        }
+
         // Statistics
         n_fitted_tracks += track_states.size();
         n_fitted_tracks_cuda += track_states_cuda.size();
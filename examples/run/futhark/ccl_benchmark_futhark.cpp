@@ -0,0 +1,43 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Local include(s).
+#include "../common/ccl_benchmark.hpp"
+
+// Project include(s).
+#include "traccc/futhark/clusterization_algorithm.hpp"
+
+// System include(s).
+#include <vector>
+
+int main(int argc, char* argv[]) {
+
+    // Execute the benchmark, handing all events of a batch to the Futhark
+    // context in a single call.
+    return traccc::ccl_benchmark(
+        "Futhark CCL benchmark", argc, argv,
+        [](const traccc::opts::clusterization&, vecmem::memory_resource& mr)
+            -> traccc::ccl_benchmark_batch_function_type {
+            return [ca = traccc::futhark::clusterization_algorithm{mr}](
+                       const std::vector<traccc::ccl_benchmark_event>&
+                           events) {
+                std::vector<
+                    traccc::futhark::clusterization_algorithm::event_input>
+                    inputs;
+                inputs.reserve(events.size());
+                for (const traccc::ccl_benchmark_event& event : events) {
+                    inputs.push_back({event.cells, event.modules});
+                }
+                std::vector<std::size_t> result;
+                result.reserve(events.size());
+                for (const auto& spacepoints : ca(inputs)) {
+                    result.push_back(spacepoints.size());
+                }
+                return result;
+            };
+        });
+}
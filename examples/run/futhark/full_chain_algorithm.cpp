@@ -0,0 +1,36 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Local include(s).
+#include "full_chain_algorithm.hpp"
+
+namespace traccc::futhark {
+
+full_chain_algorithm::full_chain_algorithm(
+    vecmem::memory_resource& mr, unsigned int,
+    const seedfinder_config& finder_config,
+    const spacepoint_grid_config& grid_config,
+    const seedfilter_config& filter_config, const finding_config<scalar>&,
+    const fitting_config<scalar>&, const host_detector_type*, bool, bool,
+    unsigned int, int)
+    : m_mr(mr),
+      m_clusterization(mr),
+      m_seeding(finder_config, grid_config, filter_config, mr),
+      m_track_parameter_estimation(mr),
+      m_finder_config(finder_config) {}
+
+full_chain_algorithm::output_type full_chain_algorithm::operator()(
+    const cell_collection_types::host& cells,
+    const cell_module_collection_types::host& modules) const {
+
+    const clusterization_algorithm::output_type spacepoints =
+        m_clusterization(cells, modules);
+    return m_track_parameter_estimation(spacepoints, m_seeding(spacepoints),
+                                        {0.f, 0.f, m_finder_config.bFieldInZ});
+}
+
+}  // namespace traccc::futhark
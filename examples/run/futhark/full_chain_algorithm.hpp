@@ -0,0 +1,187 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s).
+#include "traccc/edm/cell.hpp"
+#include "traccc/finding/finding_config.hpp"
+#include "traccc/fitting/fitting_config.hpp"
+#include "traccc/futhark/clusterization_algorithm.hpp"
+#include "traccc/seeding/seeding_algorithm.hpp"
+#include "traccc/seeding/track_params_estimation.hpp"
+#include "traccc/utils/algorithm.hpp"
+#include "traccc/utils/instrumented_memory_resource.hpp"
+
+// Detray include(s).
+#include "detray/core/detector.hpp"
+
+// VecMem include(s).
+#include <vecmem/memory/memory_resource.hpp>
+
+// System include(s).
+#include <chrono>
+#include <optional>
+#include <string>
+
+namespace traccc::futhark {
+
+/// Algorithm performing the full chain of track reconstruction
+///
+/// The clusterization runs in Futhark, from the cells all the way to the
+/// spacepoints. The seeding and the track parameter estimation run on the
+/// host.
+///
+class full_chain_algorithm
+    : public algorithm<bound_track_parameters_collection_types::host(
+          const cell_collection_types::host&,
+          const cell_module_collection_types::host&)> {
+
+    public:
+    /// (Host) Detector type used during track finding and fitting
+    using host_detector_type = detray::detector<detray::default_metadata,
+                                                detray::host_container_types>;
+
+    /// Algorithm constructor
+    ///
+    /// @param mr The memory resource to use for the intermediate and result
+    ///           objects
+    /// @param dummy Not used by the Futhark algorithm. Allows templating the
+    /// different algorithms.
+    /// @param track_finding_config Not used by the Futhark algorithm (yet).
+    /// @param track_fitting_config Not used by the Futhark algorithm (yet).
+    /// @param detector Not used by the Futhark algorithm (yet).
+    /// @param run_ambiguity_resolution Not used by the Futhark algorithm
+    /// (yet).
+    /// @param use_graph Not used by the Futhark algorithm.
+    /// @param staging_ring_size Not used by the Futhark algorithm.
+    /// @param device Not used by the Futhark algorithm.
+    ///
+    full_chain_algorithm(vecmem::memory_resource& mr, unsigned int dummy,
+                         const seedfinder_config& finder_config,
+                         const spacepoint_grid_config& grid_config,
+                         const seedfilter_config& filter_config,
+                         const finding_config<scalar>& track_finding_config,
+                         const fitting_config<scalar>& track_fitting_config,
+                         const host_detector_type* detector,
+                         bool run_ambiguity_resolution,
+                         bool use_graph = false,
+                         unsigned int staging_ring_size = 0,
+                         int device = -1);
+
+    /// Reconstruct track parameters in the entire detector
+    ///
+    /// @param cells The cells for every detector module in the event
+    /// @return The track parameters of the seeds
+    ///
+    output_type operator()(
+        const cell_collection_types::host& cells,
+        const cell_module_collection_types::host& modules) const override;
+
+    /// Prepare the processing of an upcoming event
+    ///
+    /// Does nothing for the Futhark algorithm. Allows templating the
+    /// different algorithms.
+    ///
+    void prefetch(const cell_collection_types::host&,
+                  const cell_module_collection_types::host&) const {}
+
+    /// Use a fixed table of modules for all upcoming events
+    ///
+    /// Does nothing for this algorithm, which processes the modules of
+    /// every event as they come. Allows templating the different algorithms.
+    ///
+    void set_module_table(const cell_module_collection_types::host&) {}
+
+    /// Get the number of devices that instances of the chain can run on
+    ///
+    /// Always one for the Futhark algorithm, which uses a single Futhark
+    /// context.
+    ///
+    static unsigned int device_count() { return 1; }
+
+    /// Get the NUMA node closest to a device
+    ///
+    /// Always unknown for the Futhark algorithm.
+    ///
+    static int device_numa_node(int) { return -1; }
+
+    /// Get the description of a device
+    ///
+    /// Always empty for the Futhark algorithm.
+    ///
+    static std::string device_description(int) { return {}; }
+
+    /// Get the statistics of the device memory used by the algorithms
+    ///
+    /// Always empty for the Futhark algorithm. Allows templating the
+    /// different algorithms.
+    ///
+    memory_statistics device_memory_statistics() const { return {}; }
+
+    /// Get the number of events processed in a degraded mode, for exceeding
+    /// the budgets of the track finding
+    ///
+    /// Always zero for the Futhark algorithm, which does not report the budgets
+    /// of its track finding. Allows templating the different algorithms.
+    ///
+    std::size_t n_degraded_events() const { return 0; }
+
+    /// Get the device time of processing the last event
+    ///
+    /// Always empty for the Futhark algorithm (yet). Allows templating the
+    /// different algorithms.
+    ///
+    std::optional<std::chrono::nanoseconds> device_latency() const {
+        return {};
+    }
+
+    /// Hand back a result of the algorithm, once it is no longer needed
+    ///
+    /// Does nothing for the Futhark algorithm, which does not re-use its
+    /// results. Allows templating the different algorithms.
+    ///
+    void recycle(output_type&&) const {}
+
+    /// Launch the kernels with the block sizes of a tuning file
+    ///
+    /// Does nothing for the Futhark algorithm, which has no tunable kernel
+    /// launches. Allows templating the different algorithms.
+    ///
+    void load_launch_tuning(const std::string&) {}
+
+    /// Tune the launch parameters of the kernels on a sample event
+    ///
+    /// Does nothing for the Futhark algorithm, which has no tunable kernel
+    /// launches. Allows templating the different algorithms.
+    ///
+    void autotune_launches(const cell_collection_types::host&,
+                           const cell_module_collection_types::host&,
+                           const std::string&) {}
+
+    private:
+    /// Memory resource used by the algorithm
+    vecmem::memory_resource& m_mr;
+
+    /// @name Sub-algorithms used by this full-chain algorithm
+    /// @{
+
+    /// Clusterization algorithm
+    clusterization_algorithm m_clusterization;
+    /// Seeding algorithm
+    seeding_algorithm m_seeding;
+    /// Track parameter estimation algorithm
+    track_params_estimation m_track_parameter_estimation;
+
+    /// Configs
+    seedfinder_config m_finder_config;
+
+    /// @}
+
+};  // class full_chain_algorithm
+
+}  // namespace traccc::futhark
@@ -0,0 +1,78 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Local include(s).
+#include "full_chain_algorithm.hpp"
+
+// Kokkos include(s).
+#include <Kokkos_Core.hpp>
+
+// System include(s).
+#include <iostream>
+
+namespace traccc::kokkos {
+
+full_chain_algorithm::full_chain_algorithm(
+    vecmem::memory_resource& host_mr,
+    const unsigned short target_cells_per_partition,
+    const seedfinder_config& finder_config,
+    const spacepoint_grid_config& grid_config,
+    const seedfilter_config& filter_config, const finding_config<scalar>&,
+    const fitting_config<scalar>&, const host_detector_type*, bool, bool,
+    unsigned int, int)
+    : m_host_mr(host_mr),
+      m_target_cells_per_partition(target_cells_per_partition),
+      m_clusterization(memory_resource{m_host_mr, &m_host_mr}, m_copy,
+                       m_target_cells_per_partition),
+      m_seeding(finder_config, grid_config, filter_config,
+                memory_resource{m_host_mr, &m_host_mr}, m_copy),
+      m_track_parameter_estimation(memory_resource{m_host_mr, &m_host_mr},
+                                   m_copy),
+      m_finder_config(finder_config),
+      m_grid_config(grid_config),
+      m_filter_config(filter_config) {
+
+    // Tell the user what execution space is being used.
+    std::cout << "Using Kokkos execution space: "
+              << Kokkos::DefaultExecutionSpace::name() << std::endl;
+}
+
+full_chain_algorithm::full_chain_algorithm(const full_chain_algorithm& parent)
+    : m_host_mr(parent.m_host_mr),
+      m_target_cells_per_partition(parent.m_target_cells_per_partition),
+      m_clusterization(memory_resource{m_host_mr, &m_host_mr}, m_copy,
+                       m_target_cells_per_partition),
+      m_seeding(parent.m_finder_config, parent.m_grid_config,
+                parent.m_filter_config, memory_resource{m_host_mr, &m_host_mr},
+                m_copy),
+      m_track_parameter_estimation(memory_resource{m_host_mr, &m_host_mr},
+                                   m_copy),
+      m_finder_config(parent.m_finder_config),
+      m_grid_config(parent.m_grid_config),
+      m_filter_config(parent.m_filter_config) {}
+
+full_chain_algorithm::output_type full_chain_algorithm::operator()(
+    const cell_collection_types::host& cells,
+    const cell_module_collection_types::host& modules) const {
+
+    // Execute the algorithms.
+    const clusterization_algorithm::output_type spacepoints =
+        m_clusterization(vecmem::get_data(cells), vecmem::get_data(modules));
+    const track_params_estimation::output_type track_params =
+        m_track_parameter_estimation(spacepoints.first,
+                                     m_seeding(spacepoints.first),
+                                     {0.f, 0.f, m_finder_config.bFieldInZ});
+
+    // Get the final data into a host container.
+    bound_track_parameters_collection_types::host result(&m_host_mr);
+    m_copy(track_params, result);
+
+    // Return the host container.
+    return result;
+}
+
+}  // namespace traccc::kokkos
@@ -9,7 +9,8 @@
 #include "traccc/efficiency/seeding_performance_writer.hpp"
 #include "traccc/io/read_geometry.hpp"
 #include "traccc/io/read_spacepoints.hpp"
-#include "traccc/kokkos/seeding/spacepoint_binning.hpp"
+#include "traccc/kokkos/seeding/seeding_algorithm.hpp"
+#include "traccc/kokkos/seeding/track_params_estimation.hpp"
 #include "traccc/options/accelerator.hpp"
 #include "traccc/options/detector.hpp"
 #include "traccc/options/input_data.hpp"
@@ -25,6 +26,7 @@
 
 // VecMem include(s).
 #include <vecmem/memory/host_memory_resource.hpp>
+#include <vecmem/utils/copy.hpp>
 
 // System include(s).
 #include <chrono>
@@ -56,15 +58,20 @@ int seq_run(const traccc::opts::track_seeding& seeding_opts,
     // Memory resources used by the application.
     vecmem::host_memory_resource host_mr;
     traccc::memory_resource mr{host_mr, &host_mr};
+    vecmem::copy copy;
 
     traccc::seeding_algorithm sa(seeding_opts.seedfinder,
                                  {seeding_opts.seedfinder},
                                  seeding_opts.seedfilter, host_mr);
     traccc::track_params_estimation tp(host_mr);
 
-    // KOKKOS Spacepoint Binning
-    traccc::kokkos::spacepoint_binning m_spacepoint_binning(
-        seeding_opts.seedfinder, {seeding_opts.seedfinder}, mr);
+    // Kokkos Algorithms
+    traccc::kokkos::seeding_algorithm sa_kokkos{seeding_opts.seedfinder,
+                                                {seeding_opts.seedfinder},
+                                                seeding_opts.seedfilter,
+                                                mr,
+                                                copy};
+    traccc::kokkos::track_params_estimation tp_kokkos{mr, copy};
 
     // performance writer
     traccc::seeding_performance_writer sd_performance_writer(
@@ -80,6 +87,11 @@ int seq_run(const traccc::opts::track_seeding& seeding_opts,
         traccc::seeding_algorithm::output_type seeds;
         traccc::track_params_estimation::output_type params;
 
+        // Instantiate Kokkos containers/collections
+        traccc::seed_collection_types::buffer seeds_kokkos_buffer(0, host_mr);
+        traccc::bound_track_parameters_collection_types::buffer
+            params_kokkos_buffer(0, host_mr);
+
         {  // Start measuring wall time
             traccc::performance::timer wall_t("Wall time", elapsedTimes);
 
@@ -98,16 +110,18 @@ int seq_run(const traccc::opts::track_seeding& seeding_opts,
             traccc::spacepoint_collection_types::host& spacepoints_per_event =
                 reader_output.spacepoints;
 
-            {  // Spacepoin binning for kokkos
-                traccc::performance::timer t("Spacepoint binning (kokkos)",
-                                             elapsedTimes);
-                m_spacepoint_binning(vecmem::get_data(spacepoints_per_event));
-            }
-
             /*----------------------------
                 Seeding algorithm
             ----------------------------*/
 
+            // Kokkos
+
+            {
+                traccc::performance::timer t("Seeding (kokkos)", elapsedTimes);
+                seeds_kokkos_buffer =
+                    sa_kokkos(vecmem::get_data(spacepoints_per_event));
+            }  // stop measuring seeding kokkos timer
+
             // CPU
 
             if (accelerator_opts.compare_with_cpu) {
@@ -119,16 +133,79 @@ int seq_run(const traccc::opts::track_seeding& seeding_opts,
             Track params estimation
             ----------------------------*/
 
+            // Kokkos
+
+            {
+                traccc::performance::timer t("Track params (kokkos)",
+                                             elapsedTimes);
+                params_kokkos_buffer = tp_kokkos(
+                    vecmem::get_data(spacepoints_per_event),
+                    seeds_kokkos_buffer,
+                    {0.f, 0.f, seeding_opts.seedfinder.bFieldInZ});
+            }  // stop measuring track params kokkos timer
+
             // CPU
 
             if (accelerator_opts.compare_with_cpu) {
                 traccc::performance::timer t("Track params  (cpu)",
                                              elapsedTimes);
-                params = tp(std::move(spacepoints_per_event), seeds,
+                params = tp(spacepoints_per_event, seeds,
                             {0.f, 0.f, seeding_opts.seedfinder.bFieldInZ});
             }  // stop measuring track params cpu timer
 
         }  // Stop measuring wall time
+
+        /*----------------------------------
+          compare seeds from cpu and kokkos
+          ----------------------------------*/
+
+        // Copy the seeds to the host for comparisons
+        traccc::seed_collection_types::host seeds_kokkos;
+        traccc::bound_track_parameters_collection_types::host params_kokkos;
+        copy(seeds_kokkos_buffer, seeds_kokkos);
+        copy(params_kokkos_buffer, params_kokkos);
+
+        if (accelerator_opts.compare_with_cpu) {
+            // Show which event we are currently presenting the results for.
+            std::cout << "===>>> Event " << event << " <<<===" << std::endl;
+
+            // Compare the seeds made on the host and on the device
+            traccc::collection_comparator<traccc::seed> compare_seeds{
+                "seeds", traccc::details::comparator_factory<traccc::seed>{
+                             vecmem::get_data(reader_output.spacepoints),
+                             vecmem::get_data(reader_output.spacepoints)}};
+            compare_seeds(vecmem::get_data(seeds),
+                          vecmem::get_data(seeds_kokkos));
+
+            // Compare the track parameters made on the host and on the device.
+            traccc::collection_comparator<traccc::bound_track_parameters>
+                compare_track_parameters{"track parameters"};
+            compare_track_parameters(vecmem::get_data(params),
+                                     vecmem::get_data(params_kokkos));
+        }
+
+        /*----------------
+             Statistics
+          ---------------*/
+
+        n_spacepoints += reader_output.spacepoints.size();
+        n_modules += reader_output.modules.size();
+        n_seeds_kokkos += seeds_kokkos.size();
+        n_seeds += seeds.size();
+
+        /*------------
+          Writer
+          ------------*/
+
+        if (performance_opts.run) {
+            traccc::event_map2 evt_map(event, input_opts.directory,
+                                       input_opts.directory,
+                                       input_opts.directory);
+
+            sd_performance_writer.write(
+                vecmem::get_data(seeds_kokkos),
+                vecmem::get_data(reader_output.spacepoints), evt_map);
+        }
     }
 
     if (performance_opts.run) {
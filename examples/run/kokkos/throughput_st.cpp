@@ -0,0 +1,24 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Local include(s).
+#include "../common/throughput_st.hpp"
+
+#include "full_chain_algorithm.hpp"
+
+// Kokkos include(s).
+#include <Kokkos_Core.hpp>
+
+int main(int argc, char* argv[]) {
+
+    // Initialise Kokkos for the lifetime of the application.
+    Kokkos::ScopeGuard kokkos_guard(argc, argv);
+
+    // Execute the throughput test.
+    return traccc::throughput_st<traccc::kokkos::full_chain_algorithm>(
+        "Single-threaded Kokkos throughput tests", argc, argv);
+}
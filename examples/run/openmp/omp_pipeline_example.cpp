@@ -0,0 +1,429 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Project include(s).
+#include "traccc/ambiguity_resolution/greedy_ambiguity_resolution_algorithm.hpp"
+#include "traccc/clusterization/parallel_clusterization_algorithm.hpp"
+#include "traccc/clusterization/spacepoint_formation.hpp"
+#include "traccc/finding/finding_algorithm.hpp"
+#include "traccc/fitting/fitting_algorithm.hpp"
+#include "traccc/seeding/seeding_algorithm.hpp"
+#include "traccc/seeding/track_params_estimation.hpp"
+
+// I/O include(s).
+#include "traccc/io/async_writer.hpp"
+#include "traccc/io/read_cells.hpp"
+#include "traccc/io/read_digitization_config.hpp"
+#include "traccc/io/read_geometry.hpp"
+#include "traccc/io/utils.hpp"
+
+// Command line option include(s).
+#include "traccc/options/detector.hpp"
+#include "traccc/options/input_data.hpp"
+#include "traccc/options/pipeline.hpp"
+#include "traccc/options/program_options.hpp"
+#include "traccc/options/threading.hpp"
+#include "traccc/options/track_finding.hpp"
+#include "traccc/options/track_propagation.hpp"
+#include "traccc/options/track_resolution.hpp"
+#include "traccc/options/track_seeding.hpp"
+
+// Detray include(s).
+#include "detray/core/detector.hpp"
+#include "detray/detectors/bfield.hpp"
+#include "detray/io/frontend/detector_reader.hpp"
+#include "detray/navigation/navigator.hpp"
+#include "detray/propagator/rk_stepper.hpp"
+
+// VecMem include(s).
+#include <vecmem/memory/host_memory_resource.hpp>
+
+// OpenMP
+#ifdef _OPENMP
+#include "omp.h"
+#endif
+
+// System include(s).
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace {
+
+/// Type of the detector used in the example
+using detector_type =
+    detray::detector<detray::default_metadata, detray::host_container_types>;
+/// Stepper type used by the track finding and fitting algorithms
+using stepper_type =
+    detray::rk_stepper<detray::bfield::const_field_t::view_t,
+                       detector_type::transform3, detray::constrained_step<>>;
+/// Navigator type used by the track finding and fitting algorithms
+using navigator_type = detray::navigator<const detector_type>;
+/// Track finding algorithm type
+using finding_algorithm =
+    traccc::finding_algorithm<stepper_type, navigator_type>;
+/// Track fitting algorithm type
+using fitting_algorithm = traccc::fitting_algorithm<
+    traccc::kalman_fitter<stepper_type, navigator_type>>;
+
+/// The data of one event, passed between the tasks of its stages
+struct event_data {
+
+    /// Constructor with the event index and the memory resource to use
+    event_data(std::size_t event_index, vecmem::memory_resource& mr)
+        : event(event_index),
+          input(&mr),
+          measurements(&mr),
+          spacepoints(&mr),
+          seeds(&mr),
+          params(&mr),
+          track_candidates(&mr),
+          track_states(&mr) {}
+
+    /// The index of the event
+    std::size_t event;
+    /// The cells and modules of the event
+    traccc::io::cell_reader_output input;
+    /// The reconstructed measurements
+    traccc::measurement_collection_types::host measurements;
+    /// The reconstructed spacepoints
+    traccc::spacepoint_collection_types::host spacepoints;
+    /// The reconstructed seeds
+    traccc::seed_collection_types::host seeds;
+    /// The estimated track parameters
+    traccc::bound_track_parameters_collection_types::host params;
+    /// The found track candidates
+    finding_algorithm::output_type track_candidates;
+    /// The fitted (and possibly resolved) tracks
+    fitting_algorithm::output_type track_states;
+
+};  // struct event_data
+
+/// The statistics of one event
+struct event_statistics {
+
+    std::size_t n_cells = 0;
+    std::size_t n_measurements = 0;
+    std::size_t n_spacepoints = 0;
+    std::size_t n_seeds = 0;
+    std::size_t n_found_tracks = 0;
+    std::size_t n_fitted_tracks = 0;
+
+};  // struct event_statistics
+
+/// Run a function, and return the time that it took [ns]
+template <typename FUNC>
+std::int64_t timed(FUNC&& func) {
+
+    const auto start = std::chrono::steady_clock::now();
+    func();
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+               std::chrono::steady_clock::now() - start)
+        .count();
+}
+
+}  // namespace
+
+int pipeline_run(const traccc::opts::input_data& input_opts,
+                 const traccc::opts::detector& detector_opts,
+                 const traccc::opts::track_seeding& seeding_opts,
+                 const traccc::opts::track_finding& finding_opts,
+                 const traccc::opts::track_propagation& propagation_opts,
+                 const traccc::opts::track_resolution& resolution_opts,
+                 const traccc::opts::threading& threading_opts,
+                 const traccc::opts::pipeline& pipeline_opts) {
+
+    // Set the number of threads used by OpenMP.
+#ifdef _OPENMP
+    omp_set_num_threads(static_cast<int>(threading_opts.threads));
+#endif
+
+    // Memory resource used by the application. (It is thread-safe.)
+    vecmem::host_memory_resource host_mr;
+
+    // Read in the geometry. Not using structured bindings, as the old Intel
+    // compiler crashes on them when using OpenMP.
+    auto geometry_data = traccc::io::read_geometry(
+        detector_opts.detector_file,
+        (detector_opts.use_detray_detector ? traccc::data_format::json
+                                           : traccc::data_format::csv),
+        detector_opts.cache_directory);
+    const traccc::geometry& surface_transforms = geometry_data.first;
+    const auto* barcode_map = geometry_data.second.get();
+    detector_type detector{host_mr};
+    if (detector_opts.use_detray_detector) {
+        detray::io::detector_reader_config cfg;
+        cfg.add_file(traccc::io::data_directory() +
+                     detector_opts.detector_file);
+        if (detector_opts.material_file.empty() == false) {
+            cfg.add_file(traccc::io::data_directory() +
+                         detector_opts.material_file);
+        }
+        if (detector_opts.grid_file.empty() == false) {
+            cfg.add_file(traccc::io::data_directory() +
+                         detector_opts.grid_file);
+        }
+        detector =
+            std::move(detray::io::read_detector<detector_type>(host_mr, cfg)
+                          .first);
+    }
+
+    // Read the digitization configuration file
+    auto digi_cfg = traccc::io::read_digitization_config(
+        detector_opts.digitization_file, traccc::data_format::json,
+        detector_opts.cache_directory);
+
+    // Constant B field for the track finding and fitting
+    const traccc::vector3 field_vec = {0.f, 0.f,
+                                       seeding_opts.seedfinder.bFieldInZ};
+    const detray::bfield::const_field_t field =
+        detray::bfield::create_const_field(field_vec);
+
+    // Algorithm configuration(s).
+    finding_algorithm::config_type finding_cfg;
+    finding_cfg.min_track_candidates_per_track =
+        finding_opts.track_candidates_range[0];
+    finding_cfg.max_track_candidates_per_track =
+        finding_opts.track_candidates_range[1];
+    finding_cfg.chi2_max = finding_opts.chi2_max;
+    finding_cfg.host_params_per_task = finding_opts.host_params_per_task;
+    finding_cfg.branching = finding_opts.best_chi2_branching
+                                ? traccc::branching_policy::e_best_chi2
+                                : traccc::branching_policy::e_first_compatible;
+    finding_cfg.propagation = propagation_opts.config;
+
+    fitting_algorithm::config_type fitting_cfg;
+    fitting_cfg.propagation = propagation_opts.config;
+
+    // Algorithms. They are all stateless, so the tasks of different events
+    // can run them at the same time. The clusterization and the seeding
+    // split their own work into (taskloop) tasks, when the core library is
+    // built with TRACCC_USE_OPENMP.
+    traccc::parallel_clusterization_algorithm ca(host_mr);
+    traccc::spacepoint_formation sf(host_mr);
+    traccc::seeding_algorithm sa(seeding_opts.seedfinder,
+                                 {seeding_opts.seedfinder},
+                                 seeding_opts.seedfilter, host_mr, true);
+    traccc::track_params_estimation tp(host_mr);
+    finding_algorithm finding_alg(finding_cfg);
+    fitting_algorithm fitting_alg(fitting_cfg);
+    traccc::greedy_ambiguity_resolution_algorithm resolution_alg;
+
+    // The writer of the results, if requested.
+    std::unique_ptr<traccc::io::async_writer> writer;
+    if (!pipeline_opts.output_file.empty()) {
+        writer = std::make_unique<traccc::io::async_writer>(
+            pipeline_opts.output_file, pipeline_opts.output_queue_depth);
+    }
+
+    // The reconstruction stages of every event.
+    struct stage {
+        std::string name;
+        std::function<void(event_data&)> body;
+    };
+    std::vector<stage> stages;
+    stages.push_back({"clusterization", [&](event_data& data) {
+                          data.measurements =
+                              ca(data.input.cells, data.input.modules);
+                      }});
+    stages.push_back({"spacepoints", [&](event_data& data) {
+                          data.spacepoints =
+                              sf(data.measurements, data.input.modules);
+                      }});
+    stages.push_back({"seeding", [&](event_data& data) {
+                          data.seeds = sa(data.spacepoints);
+                      }});
+    stages.push_back({"params", [&](event_data& data) {
+                          data.params =
+                              tp(data.spacepoints, data.seeds, field_vec);
+                      }});
+    if (detector_opts.use_detray_detector) {
+        stages.push_back(
+            {"finding", [&](event_data& data) {
+                 // The track finding expects the measurements to be ordered
+                 // by surface.
+                 std::sort(data.measurements.begin(), data.measurements.end(),
+                           traccc::measurement_sort_comp());
+                 data.track_candidates = finding_alg(
+                     detector, field, data.measurements, data.params);
+             }});
+        stages.push_back({"fitting", [&](event_data& data) {
+                              data.track_states = fitting_alg(
+                                  detector, field, data.track_candidates);
+                          }});
+        if (resolution_opts.run) {
+            stages.push_back({"resolution", [&](event_data& data) {
+                                  data.track_states =
+                                      resolution_alg(data.track_states);
+                              }});
+        }
+    }
+
+    // Every task writes its results into its own elements of these vectors,
+    // which are only summed up once all tasks are done. So no critical
+    // sections or atomics are needed. The first "stage" is the reading of
+    // the events, and the last one is their writing.
+    const std::size_t n_events = input_opts.events;
+    std::vector<event_statistics> event_stats(n_events);
+    std::vector<std::vector<std::int64_t>> stage_busy(
+        stages.size() + 2, std::vector<std::int64_t>(n_events, 0));
+
+    // The events in flight. Event i uses slot (i % n_slots), and all of its
+    // tasks depend on that slot. This runs the stages of an event one after
+    // the other, and makes the reading of an event wait for the event that
+    // used its slot before to be written out.
+    const std::size_t n_slots = std::max<std::size_t>(pipeline_opts.tokens, 1);
+    std::vector<std::unique_ptr<event_data>> slots(n_slots);
+    // Dependency ordering the writing of the events, instead of a critical
+    // section around the writer.
+    char write_order = 0;
+
+    // Process all events.
+    const auto start = std::chrono::steady_clock::now();
+#pragma omp parallel
+#pragma omp single
+    {
+        for (std::size_t i = 0; i < n_events; ++i) {
+
+            std::unique_ptr<event_data>* slot = &(slots[i % n_slots]);
+
+            // Read the event.
+#pragma omp task depend(inout : slot[0]) firstprivate(slot, i)
+            stage_busy.front()[i] = timed([&]() {
+                const std::size_t event = input_opts.skip + i;
+                *slot = std::make_unique<event_data>(event, host_mr);
+                traccc::io::read_cells((*slot)->input, event,
+                                       input_opts.directory, input_opts.format,
+                                       &surface_transforms, &digi_cfg,
+                                       barcode_map);
+            });
+
+            // Reconstruct it.
+            for (std::size_t s = 0; s < stages.size(); ++s) {
+#pragma omp task depend(inout : slot[0]) firstprivate(slot, i, s)
+                stage_busy[s + 1][i] =
+                    timed([&]() { stages[s].body(**slot); });
+            }
+
+            // Collect its statistics, write it out, and free its slot.
+#pragma omp task depend(inout : slot[0]) depend(inout : write_order) \
+    firstprivate(slot, i)
+            stage_busy.back()[i] = timed([&]() {
+                const event_data& data = **slot;
+                event_statistics& stats = event_stats[i];
+                stats.n_cells = data.input.cells.size();
+                stats.n_measurements = data.measurements.size();
+                stats.n_spacepoints = data.spacepoints.size();
+                stats.n_seeds = data.seeds.size();
+                stats.n_found_tracks = data.track_candidates.size();
+                stats.n_fitted_tracks = data.track_states.size();
+                if (writer) {
+                    if (detector_opts.use_detray_detector) {
+                        writer->write(data.event, data.track_states);
+                    } else {
+                        writer->write(data.event, data.params);
+                    }
+                }
+                slot->reset();
+            });
+        }
+    }
+    if (writer) {
+        writer->flush();
+    }
+    const std::chrono::duration<double> wall_time =
+        std::chrono::steady_clock::now() - start;
+
+    // Reduce the statistics of the events.
+    event_statistics total;
+    for (const event_statistics& stats : event_stats) {
+        total.n_cells += stats.n_cells;
+        total.n_measurements += stats.n_measurements;
+        total.n_spacepoints += stats.n_spacepoints;
+        total.n_seeds += stats.n_seeds;
+        total.n_found_tracks += stats.n_found_tracks;
+        total.n_fitted_tracks += stats.n_fitted_tracks;
+    }
+
+    std::cout << "==> Statistics ... " << std::endl;
+    std::cout << "- read     " << total.n_cells << " cells" << std::endl;
+    std::cout << "- created  " << total.n_measurements << " measurements"
+              << std::endl;
+    std::cout << "- created  " << total.n_spacepoints << " space points"
+              << std::endl;
+    std::cout << "- created  " << total.n_seeds << " seeds" << std::endl;
+    std::cout << "- found    " << total.n_found_tracks << " tracks"
+              << std::endl;
+    std::cout << "- fitted   " << total.n_fitted_tracks << " tracks"
+              << std::endl;
+    std::cout << "==> Processed " << n_events << " events in "
+              << wall_time.count() << " s ("
+              << static_cast<double>(n_events) / wall_time.count()
+              << " events/s)" << std::endl;
+
+    // Print the utilization of the stages. That is, the fraction of the time
+    // that all threads spent in the tasks of the stage.
+    std::cout << "==> Stage utilization ..." << std::endl;
+    for (std::size_t s = 0; s < stage_busy.size(); ++s) {
+        const std::string name =
+            ((s == 0) ? std::string{"read"}
+                      : ((s == stage_busy.size() - 1) ? std::string{"write"}
+                                                      : stages[s - 1].name));
+        std::int64_t busy_ns = 0;
+        for (std::int64_t t : stage_busy[s]) {
+            busy_ns += t;
+        }
+        const double busy = static_cast<double>(busy_ns) * 1e-9;
+        std::cout << std::setw(16) << std::right << name << "  " << std::fixed
+                  << std::setprecision(1) << std::setw(5)
+                  << 100. * busy /
+                         (wall_time.count() *
+                          static_cast<double>(threading_opts.threads))
+                  << "% of " << threading_opts.threads << " thread(s), "
+                  << std::setprecision(3)
+                  << ((n_events > 0)
+                          ? 1e3 * busy / static_cast<double>(n_events)
+                          : 0.)
+                  << " ms/event" << std::defaultfloat << std::endl;
+    }
+
+    return EXIT_SUCCESS;
+}
+
+// The main routine
+//
+int main(int argc, char* argv[]) {
+
+    // Program options.
+    traccc::opts::detector detector_opts;
+    traccc::opts::input_data input_opts;
+    traccc::opts::track_seeding seeding_opts;
+    traccc::opts::track_finding finding_opts;
+    traccc::opts::track_propagation propagation_opts;
+    traccc::opts::track_resolution resolution_opts;
+    traccc::opts::threading threading_opts;
+    traccc::opts::pipeline pipeline_opts;
+    traccc::opts::program_options program_opts{
+        "OpenMP Task Based Full Tracking Chain on the Host",
+        {detector_opts, input_opts, seeding_opts, finding_opts,
+         propagation_opts, resolution_opts, threading_opts, pipeline_opts},
+        argc,
+        argv};
+
+    // Run the application.
+    return pipeline_run(input_opts, detector_opts, seeding_opts, finding_opts,
+                        propagation_opts, resolution_opts, threading_opts,
+                        pipeline_opts);
+}
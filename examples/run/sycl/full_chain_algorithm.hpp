@@ -1,6 +1,6 @@
 /** TRACCC library, part of the ACTS project (R&D line)
  *
- * (c) 2022 CERN for the benefit of the ACTS project
+ * (c) 2022-2024 CERN for the benefit of the ACTS project
  *
  * Mozilla Public License Version 2.0
  */
@@ -8,11 +8,27 @@
 #pragma once
 
 // Project include(s).
+#include "traccc/ambiguity_resolution/greedy_ambiguity_resolution_algorithm.hpp"
+#include "traccc/device/container_d2h_copy_alg.hpp"
 #include "traccc/edm/cell.hpp"
+#include "traccc/finding/finding_config.hpp"
+#include "traccc/fitting/fitting_config.hpp"
+#include "traccc/fitting/kalman_filter/kalman_fitter.hpp"
 #include "traccc/sycl/clusterization/clusterization_algorithm.hpp"
+#include "traccc/sycl/clusterization/measurement_sorting_algorithm.hpp"
+#include "traccc/sycl/finding/finding_algorithm.hpp"
+#include "traccc/sycl/fitting/fitting_algorithm.hpp"
 #include "traccc/sycl/seeding/seeding_algorithm.hpp"
 #include "traccc/sycl/seeding/track_params_estimation.hpp"
 #include "traccc/utils/algorithm.hpp"
+#include "traccc/utils/instrumented_memory_resource.hpp"
+#include "traccc/utils/workspace_resource.hpp"
+
+// Detray include(s).
+#include "detray/core/detector.hpp"
+#include "detray/detectors/bfield.hpp"
+#include "detray/navigation/navigator.hpp"
+#include "detray/propagator/rk_stepper.hpp"
 
 // VecMem include(s).
 #include <vecmem/memory/binary_page_memory_resource.hpp>
@@ -21,60 +37,228 @@
 #include <vecmem/utils/sycl/async_copy.hpp>
 
 // System include(s).
+#include <chrono>
 #include <memory>
+#include <optional>
+#include <string>
 
 namespace traccc::sycl {
 namespace details {
 /// Internal data type used by @c traccc::sycl::full_chain_algorithm
 struct full_chain_algorithm_data;
+/// Immutable state shared by the copies of
+/// @c traccc::sycl::full_chain_algorithm
+struct full_chain_algorithm_context;
 }  // namespace details
 
 /// Algorithm performing the full chain of track reconstruction
 ///
 /// At least as much as is implemented in the project at any given moment.
 ///
+/// The configuration, the magnetic field and the device copy of the detector
+/// are held in an immutable context, that is shared by all copies of the
+/// algorithm. The copies run their own queues, in the SYCL context of the
+/// queue that the detector was uploaded with.
+///
 class full_chain_algorithm
     : public algorithm<bound_track_parameters_collection_types::host(
           const cell_collection_types::host&,
           const cell_module_collection_types::host&)> {
 
     public:
+    /// @name Type declaration(s)
+    /// @{
+
+    /// (Host) Detector type used during track finding and fitting
+    using host_detector_type = detray::detector<detray::default_metadata,
+                                                detray::host_container_types>;
+    /// (Device) Detector type used during track finding and fitting
+    using device_detector_type =
+        detray::detector<detray::default_metadata,
+                         detray::device_container_types>;
+
+    /// Stepper type used by the track finding and fitting algorithms
+    using stepper_type =
+        detray::rk_stepper<detray::bfield::const_field_t::view_t,
+                           host_detector_type::transform3,
+                           detray::constrained_step<>>;
+    /// Navigator type used by the track finding and fitting algorithms
+    using navigator_type = detray::navigator<const device_detector_type>;
+
+    /// Track finding algorithm type
+    using finding_algorithm =
+        traccc::sycl::finding_algorithm<stepper_type, navigator_type>;
+    /// Track fitting algorithm type
+    using fitting_algorithm = traccc::sycl::fitting_algorithm<
+        traccc::kalman_fitter<stepper_type, navigator_type>>;
+
+    /// @}
+
     /// Algorithm constructor
     ///
     /// @param mr The memory resource to use for the intermediate and result
     ///           objects
     /// @param target_cells_per_partition The average number of cells in each
     /// partition.
+    /// @param track_finding_config The configuration of the track finding
+    /// @param track_fitting_config The configuration of the track fitting
+    /// @param detector The Detray detector to run the track finding and
+    ///                 fitting with. If it is a null pointer, the chain stops
+    ///                 at the track parameter estimation.
+    /// @param run_ambiguity_resolution Flag for running the (host) ambiguity
+    ///                                 resolution on the fitted tracks
+    /// @param use_graph Not used by the SYCL algorithm (yet). Allows templating
+    /// the different algorithms.
+    /// @param staging_ring_size Not used by the SYCL algorithm (yet).
+    /// @param device Not used by the SYCL algorithm (yet).
     ///
     full_chain_algorithm(vecmem::memory_resource& host_mr,
                          const unsigned short target_cells_per_partition,
                          const seedfinder_config& finder_config,
                          const spacepoint_grid_config& grid_config,
-                         const seedfilter_config& filter_config);
+                         const seedfilter_config& filter_config,
+                         const finding_config<scalar>& track_finding_config,
+                         const fitting_config<scalar>& track_fitting_config,
+                         const host_detector_type* detector,
+                         bool run_ambiguity_resolution,
+                         bool use_graph = false,
+                         unsigned int staging_ring_size = 0,
+                         int device = -1);
 
     /// Copy constructor
     ///
     /// An explicit copy constructor is necessary because in the MT tests
     /// we do want to copy such objects, but a default copy-constructor can
-    /// not be generated for them.
+    /// not be generated for them. The copy shares the parent's context,
+    /// including the detector uploaded to the device.
     ///
     /// @param parent The parent algorithm chain to copy
     ///
     full_chain_algorithm(const full_chain_algorithm& parent);
 
+    /// Constructor of a copy using a different host memory resource
+    ///
+    /// @param parent The parent algorithm chain to copy
+    /// @param host_mr The host memory resource to use in the copy
+    ///
+    full_chain_algorithm(const full_chain_algorithm& parent,
+                         vecmem::memory_resource& host_mr);
+
     /// Algorithm destructor
     ~full_chain_algorithm();
 
     /// Reconstruct track parameters in the entire detector
     ///
     /// @param cells The cells for every detector module in the event
-    /// @return The track parameters reconstructed
+    /// @return The track parameters reconstructed. The parameters of the
+    ///         fitted tracks when running with a Detray detector, the
+    ///         parameters of the seeds otherwise.
     ///
     output_type operator()(
         const cell_collection_types::host& cells,
         const cell_module_collection_types::host& modules) const override;
 
+    /// Prepare the processing of an upcoming event
+    ///
+    /// Does nothing for the SYCL algorithm (yet). Allows templating the
+    /// different algorithms.
+    ///
+    void prefetch(const cell_collection_types::host&,
+                  const cell_module_collection_types::host&) const {}
+
+    /// Use a fixed table of modules for all upcoming events
+    ///
+    /// Does nothing for this algorithm, which processes the modules of
+    /// every event as they come. Allows templating the different algorithms.
+    ///
+    void set_module_table(const cell_module_collection_types::host&) {}
+
+    /// Get the number of devices that instances of the chain can run on
+    ///
+    /// Always one for the SYCL algorithm (yet). Allows templating the
+    /// different algorithms.
+    ///
+    static unsigned int device_count() { return 1; }
+
+    /// Get the NUMA node closest to a device
+    ///
+    /// Always unknown for the SYCL algorithm.
+    ///
+    static int device_numa_node(int) { return -1; }
+
+    /// Get the description of a device
+    ///
+    /// Always empty for the SYCL algorithm.
+    ///
+    static std::string device_description(int) { return {}; }
+
+    /// Get the statistics of the device memory used by the algorithms
+    ///
+    /// Always empty for the SYCL algorithm (yet). Allows templating the
+    /// different algorithms.
+    ///
+    memory_statistics device_memory_statistics() const { return {}; }
+
+    /// Get the number of events processed in a degraded mode, for exceeding
+    /// the budgets of the track finding
+    ///
+    /// Always zero for the SYCL algorithm, which does not report the budgets of
+    /// its track finding. Allows templating the different algorithms.
+    ///
+    std::size_t n_degraded_events() const { return 0; }
+
+    /// Get the device time of processing the last event
+    ///
+    /// The time from the start of the upload of the event's input to the end
+    /// of the copy of its results to the host, from the profiling
+    /// information of the (profiled) queue of the algorithm. Without the host
+    /// side synchronisation of the chain, and the time of the host noticing
+    /// that the results arrived.
+    ///
+    /// @return The device time of the last event, or nothing if the track
+    ///         states were copied to the host for the ambiguity resolution
+    ///
+    std::optional<std::chrono::nanoseconds> device_latency() const;
+
+    /// Hand back a result of the algorithm, once it is no longer needed
+    ///
+    /// Does nothing for the SYCL algorithm, which does not re-use its
+    /// results. Allows templating the different algorithms.
+    ///
+    void recycle(output_type&&) const {}
+
+    /// Launch the kernels with the block sizes of a tuning file
+    ///
+    /// Does nothing for the SYCL algorithm, which has no tunable kernel
+    /// launches. Allows templating the different algorithms.
+    ///
+    void load_launch_tuning(const std::string&) {}
+
+    /// Tune the launch parameters of the kernels on a sample event
+    ///
+    /// Does nothing for the SYCL algorithm, which has no tunable kernel
+    /// launches. Allows templating the different algorithms.
+    ///
+    void autotune_launches(const cell_collection_types::host&,
+                           const cell_module_collection_types::host&,
+                           const std::string&) {}
+
     private:
+    /// Get the memory resource(s) for the sub-algorithms
+    memory_resource algorithm_mr() const;
+
+    /// Get a navigation buffer for (at least) a given number of tracks
+    ///
+    /// The persistent buffer is only re-allocated when it is too small.
+    ///
+    /// @param n_tracks The number of tracks that the buffer is needed for
+    /// @return A view of the navigation buffer
+    ///
+    vecmem::data::jagged_vector_view<navigator_type::intersection_type>
+    navigation_buffer(unsigned int n_tracks) const;
+
+    /// The state shared with the copies of the algorithm
+    std::shared_ptr<const details::full_chain_algorithm_context> m_context;
     /// Private data object
     details::full_chain_algorithm_data* m_data;
     /// Host memory resource
@@ -83,26 +267,40 @@ class full_chain_algorithm
     std::unique_ptr<vecmem::sycl::device_memory_resource> m_device_mr;
     /// Device caching memory resource
     std::unique_ptr<vecmem::binary_page_memory_resource> m_cached_device_mr;
+    /// Pool of (USM) device memory persisting across events, that all
+    /// buffers of an event are allocated from. Reset at the start of every
+    /// event.
+    std::unique_ptr<workspace_resource> m_event_arena;
     /// Memory copy object
     mutable vecmem::sycl::async_copy m_copy;
 
+    /// Navigation buffer used by the track finding and fitting
+    mutable vecmem::data::jagged_vector_buffer<
+        navigator_type::intersection_type>
+        m_navigation_buffer;
+    /// The number of tracks that @c m_navigation_buffer can be used for
+    mutable unsigned int m_navigation_buffer_capacity;
+
     /// @name Sub-algorithms used by this full-chain algorithm
     /// @{
 
-    /// The number of cells to put together in each partition.
-    /// Adapt to different GPUs' capabilities.
-    unsigned short m_target_cells_per_partition;
     /// Clusterization algorithm
     clusterization_algorithm m_clusterization;
     /// Seeding algorithm
     seeding_algorithm m_seeding;
     /// Track parameter estimation algorithm
     track_params_estimation m_track_parameter_estimation;
-
-    /// Configs
-    seedfinder_config m_finder_config;
-    spacepoint_grid_config m_grid_config;
-    seedfilter_config m_filter_config;
+    /// Measurement sorting algorithm
+    measurement_sorting_algorithm m_measurement_sorting;
+    /// Track finding algorithm
+    finding_algorithm m_finding;
+    /// Track fitting algorithm
+    fitting_algorithm m_fitting;
+    /// Track state (device to host) copy algorithm
+    device::container_d2h_copy_alg<track_state_container_types>
+        m_track_state_d2h;
+    /// Ambiguity resolution algorithm
+    greedy_ambiguity_resolution_algorithm m_ambiguity_resolution;
 
     /// @}
 
@@ -13,6 +13,7 @@
 #include "traccc/options/generation.hpp"
 #include "traccc/options/output_data.hpp"
 #include "traccc/options/program_options.hpp"
+#include "traccc/options/threading.hpp"
 #include "traccc/options/track_propagation.hpp"
 #include "traccc/simulation/measurement_smearer.hpp"
 #include "traccc/simulation/simulator.hpp"
@@ -45,9 +46,11 @@ int main(int argc, char* argv[]) {
     traccc::opts::generation generation_opts;
     traccc::opts::output_data output_opts;
     traccc::opts::track_propagation propagation_opts;
+    traccc::opts::threading threading_opts;
     traccc::opts::program_options program_opts{
         "Detector Simulation",
-        {det_opts, generation_opts, output_opts, propagation_opts},
+        {det_opts, generation_opts, output_opts, propagation_opts,
+         threading_opts},
         argc,
         argv};
 
@@ -109,7 +112,8 @@ int main(int argc, char* argv[]) {
         traccc::smearing_writer<traccc::measurement_smearer<transform3>>;
 
     // Writer config
-    typename writer_type::config smearer_writer_cfg{meas_smearer};
+    typename writer_type::config smearer_writer_cfg{meas_smearer,
+                                                    output_opts.format};
 
     // Run simulator
     const std::string full_path = io::data_directory() + output_opts.directory;
@@ -122,6 +126,7 @@ int main(int argc, char* argv[]) {
         std::move(smearer_writer_cfg), full_path);
 
     sim.get_config().propagation = propagation_opts.config;
+    sim.get_config().n_threads = threading_opts.threads;
 
     sim.run();
 
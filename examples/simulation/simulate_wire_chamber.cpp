@@ -12,6 +12,7 @@
 #include "traccc/options/generation.hpp"
 #include "traccc/options/output_data.hpp"
 #include "traccc/options/program_options.hpp"
+#include "traccc/options/threading.hpp"
 #include "traccc/options/track_propagation.hpp"
 #include "traccc/simulation/measurement_smearer.hpp"
 #include "traccc/simulation/simulator.hpp"
@@ -33,7 +34,8 @@ using namespace traccc;
 
 int simulate(const traccc::opts::generation& generation_opts,
              const traccc::opts::output_data& output_opts,
-             const traccc::opts::track_propagation& propagation_opts) {
+             const traccc::opts::track_propagation& propagation_opts,
+             const traccc::opts::threading& threading_opts) {
 
     // Use deterministic random number generator for testing
     using uniform_gen_t =
@@ -94,7 +96,8 @@ int simulate(const traccc::opts::generation& generation_opts,
         traccc::smearing_writer<traccc::measurement_smearer<transform3>>;
 
     // Writer config
-    typename writer_type::config smearer_writer_cfg{meas_smearer};
+    typename writer_type::config smearer_writer_cfg{meas_smearer,
+                                                    output_opts.format};
 
     // Run simulator
     const std::string full_path = io::data_directory() + output_opts.directory;
@@ -106,6 +109,7 @@ int simulate(const traccc::opts::generation& generation_opts,
         generation_opts.events, det, field, std::move(generator),
         std::move(smearer_writer_cfg), full_path);
     sim.get_config().propagation = propagation_opts.config;
+    sim.get_config().n_threads = threading_opts.threads;
 
     sim.run();
 
@@ -126,12 +130,14 @@ int main(int argc, char* argv[]) {
     traccc::opts::generation generation_opts;
     traccc::opts::output_data output_opts;
     traccc::opts::track_propagation propagation_opts;
+    traccc::opts::threading threading_opts;
     traccc::opts::program_options program_opts{
         "Wire-Chamber Simulation",
-        {generation_opts, output_opts, propagation_opts},
+        {generation_opts, output_opts, propagation_opts, threading_opts},
         argc,
         argv};
 
     // Run the application.
-    return simulate(generation_opts, output_opts, propagation_opts);
+    return simulate(generation_opts, output_opts, propagation_opts,
+                    threading_opts);
 }
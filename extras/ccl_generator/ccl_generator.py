@@ -8,6 +8,7 @@ import scipy.stats
 import random
 import collections
 import csv
+import os
 
 
 def neighbourhood(p, m):
@@ -31,9 +32,11 @@ def rand(d):
     return int(round(d.rvs()))
 
 
-def generate_file(name, Md, Hd, size, N):
+def generate_file(name, Md, Hd, size, N, shuffle=False):
     print("Generating file %s..." % name)
 
+    rows = []
+
     with open(name, "w") as f:
         h = 0
         w = csv.DictWriter(
@@ -70,7 +73,7 @@ def generate_file(name, Md, Hd, size, N):
                     p = random.choice(cands)
 
                     if p not in points:
-                        w.writerow(
+                        rows.append(
                             {
                                 "geometry_id": m,
                                 "hit_id": h,
@@ -90,6 +93,11 @@ def generate_file(name, Md, Hd, size, N):
                 h += 1
                 points |= seen
 
+        if shuffle:
+            random.shuffle(rows)
+
+        w.writerows(rows)
+
 
 if __name__ == "__main__":
     parser = argparse.ArgumentParser(description="Generate some CCL examples")
@@ -144,9 +152,29 @@ if __name__ == "__main__":
         default="ccl",
         help="output name",
     )
+    parser.add_argument(
+        "-d",
+        "--directory",
+        type=str,
+        help="output directory, for files named like traccc event files",
+    )
+    parser.add_argument(
+        "--shuffle",
+        action="store_true",
+        help="write the cells of every file in a random order",
+    )
+    parser.add_argument(
+        "--seed",
+        type=int,
+        help="seed of the random number generators",
+    )
 
     args = parser.parse_args()
 
+    if args.seed is not None:
+        random.seed(args.seed)
+        numpy.random.seed(args.seed)
+
     hits_dist = scipy.stats.lognorm(args.Ms, scale=math.exp(args.Mm))
     cell_dist = scipy.stats.lognorm(args.Hs, scale=math.exp(args.Hm))
 
@@ -179,10 +207,28 @@ if __name__ == "__main__":
     )
     print()
 
-    if args.C is None:
-        generate_file(("%s.csv" % args.o), hits_dist, cell_dist, args.S, args.N)
+    if args.directory is not None:
+        os.makedirs(args.directory, exist_ok=True)
+        for i in range(1 if args.C is None else args.C):
+            generate_file(
+                os.path.join(args.directory, "event%09d-cells.csv" % i),
+                hits_dist,
+                cell_dist,
+                args.S,
+                args.N,
+                args.shuffle,
+            )
+    elif args.C is None:
+        generate_file(
+            ("%s.csv" % args.o), hits_dist, cell_dist, args.S, args.N, args.shuffle
+        )
     else:
         for i in range(args.C):
             generate_file(
-                "%s_%010d.csv" % (args.o, i), hits_dist, cell_dist, args.S, args.N
+                "%s_%010d.csv" % (args.o, i),
+                hits_dist,
+                cell_dist,
+                args.S,
+                args.N,
+                args.shuffle,
             )
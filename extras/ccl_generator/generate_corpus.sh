@@ -0,0 +1,75 @@
+#!/bin/bash
+#
+# TRACCC library, part of the ACTS project (R&D line)
+#
+# (c) 2024 CERN for the benefit of the ACTS project
+#
+# Mozilla Public License Version 2.0
+#
+# Generate a corpus of synthetic cell events for the CCL benchmarks, sweeping
+# the module occupancy, the cluster size and the number of modules per event.
+#
+
+# Stop on errors.
+set -e
+
+# Parse the command line arguments.
+OUTPUT_DIR="ccl_corpus"
+EVENTS=10
+MODULE_SIZE=655
+while getopts ":o:e:s:h" opt; do
+   case $opt in
+      o )
+         OUTPUT_DIR=$OPTARG
+         ;;
+      e )
+         EVENTS=$OPTARG
+         ;;
+      s )
+         MODULE_SIZE=$OPTARG
+         ;;
+      h )
+         echo "Usage: $0 [-o output directory] [-e events] [-s module size]"
+         exit 0
+         ;;
+      : )
+         echo "Argument -$OPTARG requires a parameter!"
+         exit 1
+         ;;
+      ? )
+         echo "Unknown argument: -$OPTARG"
+         exit 1
+         ;;
+   esac
+done
+
+# The generator script.
+GENERATOR="$(dirname "${BASH_SOURCE[0]}")/ccl_generator.py"
+
+# Generate one corpus with the generator.
+#   $1: name of the corpus, $2: number of modules, $3: log of the mean hits
+#   per module, $4: log of the mean cells per hit, $5...: extra arguments
+generate() {
+   local name=$1 modules=$2 mm=$3 hm=$4
+   shift 4
+   python3 "${GENERATOR}" -C "${EVENTS}" -N "${modules}" -S "${MODULE_SIZE}" \
+      --Mm "${mm}" --Hm "${hm}" --seed 42 -d "${OUTPUT_DIR}/${name}" "$@"
+}
+
+# Occupancy sweep, at the default cluster size and module count.
+for mm in 0.5 1.65 3.0 4.5; do
+   generate "occupancy_${mm}" 2500 "${mm}" 1.80
+done
+
+# Cluster size sweep, at the default occupancy and module count.
+for hm in 0.5 1.80 3.0 4.0; do
+   generate "cluster_size_${hm}" 2500 1.65 "${hm}"
+done
+
+# Module count sweep, at the default occupancy and cluster size.
+for modules in 500 2500 10000 25000; do
+   generate "modules_${modules}" "${modules}" 1.65 1.80
+done
+
+# The default configuration, with the cells of every event shuffled.
+generate "default_unsorted" 2500 1.65 1.80 --shuffle
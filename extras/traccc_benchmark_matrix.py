@@ -0,0 +1,235 @@
+#!/usr/bin/env python3
+#
+# TRACCC library, part of the ACTS project (R&D line)
+#
+# (c) 2024 CERN for the benefit of the ACTS project
+#
+# Mozilla Public License Version 2.0
+#
+# Script running the single-threaded throughput applications of all built
+# backends on the same input, with the same configuration, tabulating their
+# performance, and checking that they all produce equivalent results.
+#
+
+# Python import(s).
+import argparse
+import json
+import os
+import subprocess
+import sys
+import tempfile
+
+# The backends that the script knows about, with the suffixes of their
+# single-threaded throughput executables. The first one is the reference that
+# all other backends' results are compared to.
+BACKENDS = [('cpu', ''), ('cuda', '_cuda'), ('sycl', '_sycl'),
+            ('alpaka', '_alpaka'), ('kokkos', '_kokkos'),
+            ('futhark', '_futhark')]
+
+def findExecutables(binDir, backends):
+    '''Find the throughput executables of the requested backends
+
+    Argument(s):
+       binDir   -- The directory holding the traccc executables
+       backends -- The names of the backends to look for
+
+    Return:
+       A list of (backend name, executable path) pairs, in the order of
+       the known backends
+    '''
+
+    result = []
+    for name, suffix in BACKENDS:
+        if not name in backends:
+            continue
+        path = os.path.join(binDir, 'traccc_throughput_st' + suffix)
+        if os.access(path, os.X_OK):
+            result.append((name, path))
+            pass
+        pass
+    return result
+
+def runBackend(name, executable, options, workDir):
+    '''Run the throughput application of one backend
+
+    Argument(s):
+       name       -- The name of the backend
+       executable -- The throughput executable of the backend
+       options    -- The (common) command line options of the measurement
+       workDir    -- The directory to write the files of the measurement into
+
+    Return:
+       The summary of the measurement, with the name of its output file
+       added as "output_file"
+    '''
+
+    summaryFile = os.path.join(workDir, name + '_summary.json')
+    outputFile = os.path.join(workDir, name + '_output.dat')
+    command = ([executable] + options +
+               ['--event-order=sequential', '--summary-file=' + summaryFile,
+                '--output-file=' + outputFile])
+    print('Running: %s' % ' '.join(command), flush=True)
+    subprocess.run(command, check=True, stdout=subprocess.DEVNULL)
+    with open(summaryFile, 'r') as jsonFile:
+        summary = json.load(jsonFile)
+        pass
+    summary['output_file'] = outputFile
+    return summary
+
+def compareOutputs(comparator, name, reference, test):
+    '''Compare the output of one backend to the reference output
+
+    Argument(s):
+       comparator -- The traccc_compare_outputs executable
+       name       -- The name of the tested backend
+       reference  -- The output file of the reference backend
+       test       -- The output file of the tested backend
+
+    Return:
+       True if the outputs agree, False otherwise
+    '''
+
+    result = subprocess.run([comparator, reference, test, name],
+                            stdout=subprocess.PIPE, universal_newlines=True)
+    # Keep just the final summary lines of the comparison.
+    for line in result.stdout.splitlines():
+        if not line.startswith(('Event ', '  ', 'Number of')):
+            print('  %s' % line)
+            pass
+        pass
+    return result.returncode == 0
+
+def printTable(summaries):
+    '''Print the performance numbers of all backends in one table
+
+    Argument(s):
+       summaries -- A list of (backend name, measurement summary) pairs
+    '''
+
+    # Collect the rows of the table: the throughput, the total times of the
+    # application's steps, and the per-stage memory peaks.
+    rows = [('Throughput [events/s]',
+             ['%.2f' % s['events_per_second'] for _, s in summaries])]
+    rows.append(('Track parameters',
+                 [str(s['reconstructed_track_params']) for _, s in summaries]))
+    timeNames = []
+    for _, summary in summaries:
+        for entry in summary['times']:
+            if not entry['name'] in timeNames:
+                timeNames.append(entry['name'])
+                pass
+            pass
+        pass
+    for timeName in timeNames:
+        values = []
+        for _, summary in summaries:
+            times = {e['name']: e['ms'] for e in summary['times']}
+            values.append('%.1f' % times[timeName] if timeName in times
+                          else '-')
+            pass
+        rows.append(('%s [ms]' % timeName, values))
+        pass
+    for memory in ['host_memory', 'device_memory']:
+        stageNames = ['total']
+        for _, summary in summaries:
+            for stage in summary[memory]['stages']:
+                if not stage in stageNames:
+                    stageNames.append(stage)
+                    pass
+                pass
+            pass
+        for stage in stageNames:
+            values = []
+            for _, summary in summaries:
+                usage = (summary[memory]['total'] if stage == 'total' else
+                         summary[memory]['stages'].get(stage))
+                values.append('%.1f' % (usage['peak_bytes'] / 1048576.)
+                              if usage and usage['allocations'] > 0 else '-')
+                pass
+            rows.append(('%s peak, %s [MB]' % (memory.split('_')[0], stage),
+                         values))
+            pass
+        pass
+
+    # Print them.
+    headers = [name for name, _ in summaries]
+    labelWidth = max(len(label) for label, _ in rows)
+    widths = [max([len(h)] + [len(values[i]) for _, values in rows])
+              for i, h in enumerate(headers)]
+    print(' ' * labelWidth + ''.join(' | %*s' % (w, h)
+                                     for w, h in zip(widths, headers)))
+    print('-' * (labelWidth + sum(w + 3 for w in widths)))
+    for label, values in rows:
+        print('%-*s' % (labelWidth, label) +
+              ''.join(' | %*s' % (w, v) for w, v in zip(widths, values)))
+        pass
+    return
+
+def main():
+    '''C(++)-style main function
+    '''
+
+    # Parse the command line arguments.
+    parser = argparse.ArgumentParser(
+        description='Cross-Backend Benchmark Matrix Runner',
+        epilog='Any further arguments are passed to all of the throughput '
+               'applications unchanged.')
+    parser.add_argument('-b', '--bin-dir', dest='bin_dir', default='bin',
+                        help='Directory holding the traccc executables')
+    parser.add_argument('--backends', default=','.join(n for n, _ in BACKENDS),
+                        help='Comma separated list of the backends to run')
+    parser.add_argument('-w', '--work-dir', dest='work_dir', default=None,
+                        help='Directory to keep the files of the measurements '
+                             'in (a temporary one by default)')
+    parser.add_argument('-j', '--json', default=None,
+                        help='JSON file to write all summaries into')
+    args, options = parser.parse_known_args()
+
+    # Find the throughput applications to run.
+    executables = findExecutables(args.bin_dir, args.backends.split(','))
+    if len(executables) == 0:
+        print('No throughput applications found in "%s"' % args.bin_dir)
+        return 1
+    comparator = os.path.join(args.bin_dir, 'traccc_compare_outputs')
+
+    # Run all of them, with the same options.
+    workDir = args.work_dir
+    tempDir = None
+    if workDir is None:
+        tempDir = tempfile.TemporaryDirectory(prefix='traccc_matrix_')
+        workDir = tempDir.name
+        pass
+    summaries = []
+    for name, executable in executables:
+        summaries.append((name,
+                          runBackend(name, executable, options, workDir)))
+        pass
+
+    # Print the performance of all of them.
+    print()
+    printTable(summaries)
+
+    # Compare the results of every backend to the first one's.
+    print()
+    allAgree = True
+    referenceName, reference = summaries[0]
+    for name, summary in summaries[1:]:
+        print('Comparing %s to %s:' % (name, referenceName))
+        if not compareOutputs(comparator, name, reference['output_file'],
+                              summary['output_file']):
+            allAgree = False
+            pass
+        pass
+
+    # Save the summaries, if requested.
+    if args.json:
+        with open(args.json, 'w') as jsonFile:
+            json.dump(dict(summaries), jsonFile, indent=2)
+            pass
+        pass
+
+    # Return gracefully.
+    return 0 if allAgree else 2
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -0,0 +1,156 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s).
+#include "traccc/edm/track_candidate.hpp"
+#include "traccc/edm/track_parameters.hpp"
+#include "traccc/edm/track_state.hpp"
+
+// VecMem include(s).
+#include <vecmem/memory/memory_resource.hpp>
+
+// System include(s).
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <exception>
+#include <fstream>
+#include <map>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <thread>
+
+namespace traccc::io {
+
+/// Asynchronous, batching writer of reconstruction results
+///
+/// The results of the events can be handed to the writer from any thread.
+/// They are serialised right away (so the caller can release them), and are
+/// queued for a background thread, which writes the queued events in large,
+/// sequential batches. The queue is bounded, so that a slow disk throttles
+/// the producers, instead of the memory usage growing without limits.
+///
+/// All events are written into a single file, as a sequence of records. Every
+/// record starts with a @c record_header, followed by the payload. Containers
+/// are stored with the same layout as by @c traccc::data_format::binary:
+/// the number of headers, the number of items of every header, the headers
+/// and then all the items. Collections as their size, followed by the
+/// elements.
+///
+class async_writer {
+
+    public:
+    /// The type of the results in a record
+    enum class record_type : std::uint32_t {
+        track_candidates = 0,
+        track_states = 1,
+        track_parameters = 2
+    };
+
+    /// The header of every record in the output file
+    struct record_header {
+        /// The type of the results in the record
+        record_type type;
+        /// Padding, always zero
+        std::uint32_t padding;
+        /// The event that the results belong to
+        std::uint64_t event;
+        /// The size of the record's payload (in bytes)
+        std::uint64_t size;
+    };
+
+    /// Constructor, opening the output file and starting the writer thread
+    ///
+    /// @param filename    The full name of the file to write
+    /// @param queue_depth The maximal number of events waiting to be written
+    /// @param batch_size  The (approximate) size of the batches written at
+    ///                    once, in bytes
+    ///
+    explicit async_writer(std::string_view filename,
+                          std::size_t queue_depth = 16,
+                          std::size_t batch_size = 16 * 1024 * 1024);
+
+    /// Destructor, writing all queued events and stopping the writer thread
+    ~async_writer();
+
+    /// Copying is not allowed
+    async_writer(const async_writer&) = delete;
+    /// Copying is not allowed
+    async_writer& operator=(const async_writer&) = delete;
+
+    /// Queue the track candidates of an event for writing
+    void write(std::size_t event,
+               const track_candidate_container_types::host& candidates);
+    /// Queue the track states of an event for writing
+    void write(std::size_t event,
+               const track_state_container_types::host& track_states);
+    /// Queue the track parameters of an event for writing
+    void write(std::size_t event,
+               const bound_track_parameters_collection_types::host& params);
+
+    /// Wait for all queued events to be written to the file
+    void flush();
+
+    /// Get the total time that producers spent waiting for the queue
+    std::chrono::nanoseconds stall_time() const;
+    /// Get the number of events waiting to be written at the moment
+    std::size_t queued() const;
+
+    private:
+    /// Queue one serialised record
+    void push(std::string record);
+    /// Function run by the writer thread
+    void write_records();
+
+    /// The output file
+    std::ofstream m_file;
+    /// The maximal number of records waiting to be written
+    std::size_t m_queue_depth;
+    /// The size of the batches written at once
+    std::size_t m_batch_size;
+
+    /// Serialised records waiting to be written
+    std::deque<std::string> m_queue;
+    /// The number of records taken by the writer thread, but not written yet
+    std::size_t m_writing = 0;
+    /// Time spent by the producers waiting for space in the queue
+    std::chrono::nanoseconds m_stall_time{0};
+    /// Flag telling the writer thread to stop
+    bool m_stop = false;
+    /// Exception thrown while writing
+    std::exception_ptr m_error;
+
+    /// Mutex protecting the state of the writer
+    mutable std::mutex m_mutex;
+    /// Condition variable signalling newly queued records
+    std::condition_variable m_queued_cv;
+    /// Condition variable signalling newly written records
+    std::condition_variable m_written_cv;
+
+    /// The writer thread
+    std::thread m_thread;
+
+};  // class async_writer
+
+/// Read the track parameters from a file written by @c traccc::io::async_writer
+///
+/// Records of other types in the file are skipped. Should an event have
+/// multiple track parameter records, only the first one is used.
+///
+/// @param filename The full name of the file to read
+/// @param mr       The memory resource to create the collections with
+/// @return The track parameters of the events found in the file, by event
+///
+std::map<std::size_t, bound_track_parameters_collection_types::host>
+read_track_parameters(std::string_view filename, vecmem::memory_resource& mr);
+
+}  // namespace traccc::io
@@ -1,6 +1,6 @@
 /** TRACCC library, part of the ACTS project (R&D line)
  *
- * (c) 2022 CERN for the benefit of the ACTS project
+ * (c) 2022-2024 CERN for the benefit of the ACTS project
  *
  * Mozilla Public License Version 2.0
  */
@@ -17,6 +17,9 @@ enum data_format : int {
     csv = 0,
     binary = 1,
     json = 2,
+    mapped = 3,
+    packed = 4,
+    compressed = 5,
 };
 
 /// Printout helper for @c traccc::data_format
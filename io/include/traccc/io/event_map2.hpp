@@ -1,6 +1,6 @@
 /** TRACCC library, part of the ACTS project (R&D line)
  *
- * (c) 2022 CERN for the benefit of the ACTS project
+ * (c) 2022-2024 CERN for the benefit of the ACTS project
  *
  * Mozilla Public License Version 2.0
  */
@@ -12,6 +12,11 @@
 #include "traccc/edm/particle.hpp"
 #include "traccc/edm/spacepoint.hpp"
 #include "traccc/edm/track_candidate.hpp"
+#include "traccc/edm/truth_match.hpp"
+#include "traccc/edm/truth_seed_input.hpp"
+
+// VecMem include(s).
+#include <vecmem/memory/memory_resource.hpp>
 
 namespace traccc {
 
@@ -51,6 +56,30 @@ struct event_map2 {
         return track_candidates;
     }
 
+    /// Get the truth states that the seeds of the particles are made from
+    ///
+    /// The result can be handed to @c traccc::batched_seed_generator, or
+    /// copied to a device, and be handed to a device seed generator there.
+    ///
+    /// @param resource The memory resource to use for the result
+    /// @return The truth states of the particles, in the same order as the
+    ///         candidates of @c generate_truth_candidates
+    ///
+    truth_seed_input_collection_types::host make_truth_seed_inputs(
+        vecmem::memory_resource& resource) const;
+
+    /// Get the particles contributing to the measurements in a flat form
+    ///
+    /// The result can be copied to a device, to match the reconstructed
+    /// tracks to the particles there (see @c traccc::track_truth_match).
+    ///
+    /// @param resource The memory resource to use for the result
+    /// @return The contributing particles of every measurement, with the
+    ///         measurements in the order of @c meas_ptc_map
+    ///
+    measurement_particle_container_types::host make_measurement_particles(
+        vecmem::memory_resource& resource) const;
+
     /// Map for measurement to truth global position and momentum
     using measurement_xp_map = std::map<measurement, std::pair<point3, point3>>;
     /// Map for measurement to the contributing particles
@@ -0,0 +1,99 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// VecMem include(s).
+#include <vecmem/containers/data/vector_view.hpp>
+
+// System include(s).
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <utility>
+
+namespace traccc::io {
+
+/// Read-only memory mapping of a file in the @c traccc::data_format::mapped
+/// format
+///
+/// The file is made of a versioned header, a table of sections, and the
+/// payload of the sections. Every section holds a flat array of trivially
+/// copyable objects, aligned to @c mapped_file::alignment bytes, which can be
+/// used in place through vecmem views.
+///
+class mapped_file {
+
+    public:
+    /// The version of the file layout written/understood by this code
+    static constexpr std::uint32_t version = 1;
+    /// The alignment of the sections inside of the file (in bytes)
+    static constexpr std::size_t alignment = 64;
+
+    /// Map a file into memory
+    ///
+    /// @param filename The full name of the file to map
+    ///
+    explicit mapped_file(std::string_view filename);
+
+    /// Move constructor
+    mapped_file(mapped_file&& parent) noexcept;
+
+    /// Destructor, unmapping the file
+    ~mapped_file();
+
+    /// Move assignment
+    mapped_file& operator=(mapped_file&& rhs) noexcept;
+
+    /// Copying is not allowed
+    mapped_file(const mapped_file&) = delete;
+    /// Copying is not allowed
+    mapped_file& operator=(const mapped_file&) = delete;
+
+    /// Get the number of sections in the file
+    std::size_t n_sections() const;
+
+    /// Get a (non-owning) view of one section of the file
+    ///
+    /// @tparam T The type of the objects in the section
+    /// @param index The index of the section
+    /// @return A view pointing directly into the mapped memory
+    ///
+    template <typename T>
+    vecmem::data::vector_view<const T> section(std::size_t index) const {
+
+        const std::pair<const void*, std::size_t> result =
+            section_data(index, sizeof(T));
+        return {static_cast<
+                    typename vecmem::data::vector_view<const T>::size_type>(
+                    result.second),
+                static_cast<const T*>(result.first)};
+    }
+
+    /// Get the start of the mapped memory
+    ///
+    /// It is page aligned, so it can be used to register the mapping with
+    /// a device runtime for direct host-to-device transfers.
+    ///
+    const void* data() const;
+
+    /// Get the size of the mapped memory (in bytes)
+    std::size_t size() const;
+
+    private:
+    /// Get the (checked) start and number of elements of a section
+    std::pair<const void*, std::size_t> section_data(
+        std::size_t index, std::size_t element_size) const;
+
+    /// The start of the mapped memory
+    void* m_data = nullptr;
+    /// The size of the mapped memory
+    std::size_t m_size = 0;
+
+};  // class mapped_file
+
+}  // namespace traccc::io
@@ -0,0 +1,62 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Local include(s).
+#include "traccc/io/mapped_file.hpp"
+
+// Project include(s).
+#include "traccc/geometry/geometry.hpp"
+
+// Detray include(s).
+#include <detray/geometry/barcode.hpp>
+
+// System include(s).
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <string_view>
+
+namespace traccc::io {
+
+/// Geometry description, used directly from a mapped file
+///
+/// The file is mapped read-only, so all processes of a node mapping the same
+/// file (e.g. one in @c /dev/shm) share the same physical memory for the
+/// geometry, and attaching to it does not need any conversion.
+///
+struct mapped_geometry {
+    /// The mapped file, owning the memory that the geometry points into
+    mapped_file file;
+    /// The geometry, pointing into the mapped file
+    geometry geom;
+    /// The map from Acts surface identifiers to Detray barcodes, if the file
+    /// has one (built from the file's contents)
+    std::unique_ptr<std::map<std::uint64_t, detray::geometry::barcode>>
+        barcode_map;
+};
+
+/// Write a geometry description into a @c traccc::data_format::mapped file
+///
+/// @param filename    The full name of the file to write
+/// @param geom        The geometry to write
+/// @param barcode_map The barcode map to write (optional)
+///
+void write_mapped_geometry(
+    std::string_view filename, const geometry& geom,
+    const std::map<std::uint64_t, detray::geometry::barcode>* barcode_map =
+        nullptr);
+
+/// Map a geometry description file into memory, without copying the geometry
+///
+/// @param filename The full name of the file to map
+/// @return The mapped file, and the geometry using it
+///
+mapped_geometry read_mapped_geometry(std::string_view filename);
+
+}  // namespace traccc::io
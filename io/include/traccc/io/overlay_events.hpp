@@ -0,0 +1,47 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Local include(s).
+#include "traccc/io/reader_edm.hpp"
+
+// System include(s).
+#include <vector>
+
+namespace traccc::io {
+
+/// Overlay the cells of several events into a single event
+///
+/// Meant for making events of a higher pileup out of (in-memory) events of a
+/// lower one. The modules of the events are identified by their surfaces,
+/// and cells with the same channel identifiers on the same module are merged
+/// into one cell. Merged cells get the sum of the activations, and the
+/// earliest time of the overlaid cells. The cells of the result are ordered
+/// by module and channel, like the ones read by @c traccc::io::read_cells.
+///
+/// @param out The overlaid event, replacing its previous contents
+/// @param events The (non-null) events to overlay
+///
+void overlay_cells(cell_reader_output& out,
+                   const std::vector<const cell_reader_output*>& events);
+
+/// Overlay the measurements of several events into a single event
+///
+/// The modules of the events are identified by their surfaces, as with
+/// @c traccc::io::overlay_cells. Measurements are not merged with each other,
+/// only re-linked to the modules of the result, and numbered anew (in the
+/// order of the events), to keep their identifiers unique.
+///
+/// @param out The overlaid event, replacing its previous contents
+/// @param events The (non-null) events to overlay
+///
+void overlay_measurements(
+    measurement_reader_output& out,
+    const std::vector<const measurement_reader_output*>& events);
+
+}  // namespace traccc::io
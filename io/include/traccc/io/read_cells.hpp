@@ -1,6 +1,6 @@
 /** TRACCC library, part of the ACTS project (R&D line)
  *
- * (c) 2022-2023 CERN for the benefit of the ACTS project
+ * (c) 2022-2024 CERN for the benefit of the ACTS project
  *
  * Mozilla Public License Version 2.0
  */
@@ -37,13 +37,18 @@ namespace traccc::io {
 /// @param dconfig The detector's digitization configuration
 /// @param bardoce_map An object to perform barcode re-mapping with
 ///                    (For Acts->Detray identifier re-mapping, if necessary)
+/// @param use_module_index Look up the modules of the cells through a hash
+///                         map, and order the cells with counting sorts,
+///                         instead of using a linear search and per-module
+///                         sorts (only used for CSV files)
 ///
 void read_cells(
     cell_reader_output &out, std::size_t event, std::string_view directory,
     data_format format = data_format::csv, const geometry *geom = nullptr,
     const digitization_config *dconfig = nullptr,
     const std::map<std::uint64_t, detray::geometry::barcode> *barcode_map =
-        nullptr);
+        nullptr,
+    bool use_module_index = true);
 
 /// Read cell data into memory
 ///
@@ -56,12 +61,17 @@ void read_cells(
 /// @param dconfig The detector's digitization configuration
 /// @param bardoce_map An object to perform barcode re-mapping with
 ///                    (For Acts->Detray identifier re-mapping, if necessary)
+/// @param use_module_index Look up the modules of the cells through a hash
+///                         map, and order the cells with counting sorts,
+///                         instead of using a linear search and per-module
+///                         sorts (only used for CSV files)
 ///
 void read_cells(cell_reader_output &out, std::string_view filename,
                 data_format format = data_format::csv,
                 const geometry *geom = nullptr,
                 const digitization_config *dconfig = nullptr,
                 const std::map<std::uint64_t, detray::geometry::barcode>
-                    *barcode_map = nullptr);
+                    *barcode_map = nullptr,
+                bool use_module_index = true);
 
 }  // namespace traccc::io
@@ -22,10 +22,14 @@ namespace traccc::io {
 ///
 /// @param filename The name of the file to read the data from
 /// @param format The format of the input file
+/// @param cache_directory Directory for binary snapshots of the result, keyed
+///                        by the contents of the input file (no caching if
+///                        empty)
 /// @return An object describing the digitization configuration of the
 ///         detector
 ///
 digitization_config read_digitization_config(
-    std::string_view filename, data_format format = data_format::json);
+    std::string_view filename, data_format format = data_format::json,
+    std::string_view cache_directory = "");
 
 }  // namespace traccc::io
@@ -30,11 +30,15 @@ namespace traccc::io {
 ///
 /// @param filename The name of the input file to read
 /// @param format The format of the input file
+/// @param cache_directory Directory for binary snapshots of the result, keyed
+///                        by the contents of the input file (no caching if
+///                        empty)
 /// @return A description of the detector modules
 ///
 std::pair<geometry,
           std::unique_ptr<std::map<std::uint64_t, detray::geometry::barcode>>>
-read_geometry(std::string_view filename, data_format format = data_format::csv);
+read_geometry(std::string_view filename, data_format format = data_format::csv,
+              std::string_view cache_directory = "");
 
 /// Read in the detector geometry description from a detector object
 template <typename detector_t>
@@ -0,0 +1,31 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Detray include(s).
+#include <detray/detectors/bfield.hpp>
+
+// System include(s).
+#include <string_view>
+
+namespace traccc::io {
+
+/// Read in an inhomogeneous magnetic field map from a covfie file
+///
+/// Every file is only read once. Later requests for the same file are served
+/// from a host-side cache, so that all algorithms (and threads) of an
+/// application can ask for the field map, without reading it again, or
+/// holding more than one copy of it in host memory.
+///
+/// @param filename The name of the (covfie) field map file
+/// @return The field map, owned by the cache
+///
+const detray::bfield::inhom_field_t& read_magnetic_field(
+    std::string_view filename);
+
+}  // namespace traccc::io
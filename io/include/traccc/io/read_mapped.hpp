@@ -0,0 +1,84 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Local include(s).
+#include "traccc/io/mapped_file.hpp"
+
+// Project include(s).
+#include "traccc/edm/cell.hpp"
+#include "traccc/edm/measurement.hpp"
+#include "traccc/edm/spacepoint.hpp"
+
+// System include(s).
+#include <cstddef>
+#include <string_view>
+
+namespace traccc::io {
+
+/// Cells and modules of an event, viewed directly in a mapped file
+struct mapped_cell_reader_output {
+    /// The mapped file, owning the memory that the views point into
+    mapped_file file;
+    /// The cells of the event
+    cell_collection_types::const_view cells;
+    /// The modules of the event
+    cell_module_collection_types::const_view modules;
+};
+
+/// Measurements and modules of an event, viewed directly in a mapped file
+struct mapped_measurement_reader_output {
+    /// The mapped file, owning the memory that the views point into
+    mapped_file file;
+    /// The measurements of the event
+    measurement_collection_types::const_view measurements;
+    /// The modules of the event
+    cell_module_collection_types::const_view modules;
+};
+
+/// Spacepoints and modules of an event, viewed directly in a mapped file
+struct mapped_spacepoint_reader_output {
+    /// The mapped file, owning the memory that the views point into
+    mapped_file file;
+    /// The spacepoints of the event
+    spacepoint_collection_types::const_view spacepoints;
+    /// The modules of the event
+    cell_module_collection_types::const_view modules;
+};
+
+/// Map the cell data of an event into memory, without copying it
+///
+/// The file to read is selected according the naming conventions used in
+/// our data.
+///
+/// @param event The event ID to read in the cells for
+/// @param directory The directory holding the cell data files
+/// @return The mapped file, and views of its contents
+///
+mapped_cell_reader_output read_mapped_cells(std::size_t event,
+                                            std::string_view directory);
+
+/// Map the measurement data of an event into memory, without copying it
+///
+/// @param event The event ID to read in the measurements for
+/// @param directory The directory holding the measurement data files
+/// @return The mapped file, and views of its contents
+///
+mapped_measurement_reader_output read_mapped_measurements(
+    std::size_t event, std::string_view directory);
+
+/// Map the spacepoint data of an event into memory, without copying it
+///
+/// @param event The event ID to read in the spacepoints for
+/// @param directory The directory holding the spacepoint data files
+/// @return The mapped file, and views of its contents
+///
+mapped_spacepoint_reader_output read_mapped_spacepoints(
+    std::size_t event, std::string_view directory);
+
+}  // namespace traccc::io
@@ -0,0 +1,41 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Local include(s).
+#include "traccc/io/demonstrator_edm.hpp"
+
+// System include(s).
+#include <cstddef>
+#include <string_view>
+#include <vector>
+
+namespace traccc::io {
+
+/// Get the number of events stored in a packed cell file
+///
+/// @param directory The directory holding the packed cell file
+/// @return The number of events in the file
+///
+std::size_t packed_events(std::string_view directory);
+
+/// Read (a subset of) the events from a packed cell file
+///
+/// The events are read in parallel (with TBB) if possible, each of them with
+/// just two contiguous reads from the file.
+///
+/// @param out An object with (at least) as many elements as the number of
+///            requested events. Its i-th element receives the cells and
+///            modules of event @c events[i].
+/// @param directory The directory holding the packed cell file
+/// @param events The indices of the events to read
+///
+void read_packed(demonstrator_input& out, std::string_view directory,
+                 const std::vector<std::size_t>& events);
+
+}  // namespace traccc::io
@@ -1,6 +1,6 @@
 /** TRACCC library, part of the ACTS project (R&D line)
  *
- * (c) 2021-2022 CERN for the benefit of the ACTS project
+ * (c) 2021-2024 CERN for the benefit of the ACTS project
  *
  * Mozilla Public License Version 2.0
  */
@@ -11,6 +11,7 @@
 #include "traccc/edm/cell.hpp"
 #include "traccc/edm/spacepoint.hpp"
 #include "traccc/io/data_format.hpp"
+#include "traccc/io/demonstrator_edm.hpp"
 
 // System include(s).
 #include <cstddef>
@@ -57,4 +58,31 @@ void write(std::size_t event, std::string_view directory,
            measurement_collection_types::const_view measurements,
            traccc::cell_module_collection_types::const_view modules);
 
+/// Function for measurement file writing, into explicitly named files
+///
+/// Only supports @c traccc::data_format::binary.
+///
+/// @param measurements_file is the full name of the output measurement file
+/// @param modules_file is the full name of the output module file
+/// @param format is the data format of the output files
+/// @param measurements is the measurement collection to write
+/// @param modules is the module collection to write
+///
+void write(std::string_view measurements_file, std::string_view modules_file,
+           traccc::data_format format,
+           measurement_collection_types::const_view measurements,
+           traccc::cell_module_collection_types::const_view modules);
+
+/// Function for writing the cells of many events into a single file
+///
+/// Only supports @c traccc::data_format::packed, which stores all events
+/// together with an index of their positions in the file.
+///
+/// @param directory is the directory for the output cell file
+/// @param format is the data format of the output file
+/// @param events are the cells and modules of all events to write
+///
+void write(std::string_view directory, traccc::data_format format,
+           const demonstrator_input& events);
+
 }  // namespace traccc::io
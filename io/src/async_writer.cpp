@@ -0,0 +1,287 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Local include(s).
+#include "traccc/io/async_writer.hpp"
+
+// System include(s).
+#include <algorithm>
+#include <cstring>
+#include <iterator>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace {
+
+/// Append the raw bytes of some objects to a buffer
+template <typename T>
+void append(std::string& buffer, const T* data, std::size_t size) {
+
+    static_assert(std::is_standard_layout_v<T>,
+                  "Only standard layout types can be written.");
+    buffer.append(reinterpret_cast<const char*>(data), size * sizeof(T));
+}
+
+/// Serialise a container into a record
+template <typename container_t>
+std::string make_container_record(traccc::io::async_writer::record_type type,
+                                  std::size_t event,
+                                  const container_t& container) {
+
+    // Calculate the size of the payload.
+    std::vector<std::size_t> item_sizes;
+    item_sizes.reserve(container.size());
+    std::size_t n_items = 0;
+    for (const auto& items : container.get_items()) {
+        item_sizes.push_back(items.size());
+        n_items += items.size();
+    }
+    const std::size_t payload_size =
+        sizeof(std::size_t) * (1 + item_sizes.size()) +
+        container.size() * sizeof(typename container_t::header_type) +
+        n_items * sizeof(typename container_t::item_type);
+
+    // Serialise the header and the payload.
+    std::string result;
+    result.reserve(sizeof(traccc::io::async_writer::record_header) +
+                   payload_size);
+    const traccc::io::async_writer::record_header header{
+        type, 0u, static_cast<std::uint64_t>(event), payload_size};
+    append(result, &header, 1u);
+    const std::size_t headers_size = container.size();
+    append(result, &headers_size, 1u);
+    append(result, item_sizes.data(), item_sizes.size());
+    append(result, container.get_headers().data(), container.size());
+    for (const auto& items : container.get_items()) {
+        append(result, items.data(), items.size());
+    }
+    return result;
+}
+
+/// Serialise a collection into a record
+template <typename collection_t>
+std::string make_collection_record(traccc::io::async_writer::record_type type,
+                                   std::size_t event,
+                                   const collection_t& collection) {
+
+    const std::size_t payload_size =
+        sizeof(std::size_t) +
+        collection.size() * sizeof(typename collection_t::value_type);
+
+    std::string result;
+    result.reserve(sizeof(traccc::io::async_writer::record_header) +
+                   payload_size);
+    const traccc::io::async_writer::record_header header{
+        type, 0u, static_cast<std::uint64_t>(event), payload_size};
+    append(result, &header, 1u);
+    const std::size_t size = collection.size();
+    append(result, &size, 1u);
+    append(result, collection.data(), collection.size());
+    return result;
+}
+
+}  // namespace
+
+namespace traccc::io {
+
+async_writer::async_writer(std::string_view filename, std::size_t queue_depth,
+                           std::size_t batch_size)
+    : m_file(std::string(filename), std::ios::binary),
+      m_queue_depth(std::max<std::size_t>(queue_depth, 1u)),
+      m_batch_size(batch_size) {
+
+    if (!m_file) {
+        throw std::runtime_error("Could not open file: " +
+                                 std::string(filename));
+    }
+    m_thread = std::thread([this]() { write_records(); });
+}
+
+async_writer::~async_writer() {
+
+    {
+        std::lock_guard<std::mutex> lock{m_mutex};
+        m_stop = true;
+    }
+    m_queued_cv.notify_all();
+    m_thread.join();
+}
+
+void async_writer::write(
+    std::size_t event,
+    const track_candidate_container_types::host& candidates) {
+
+    push(::make_container_record(record_type::track_candidates, event,
+                                 candidates));
+}
+
+void async_writer::write(
+    std::size_t event, const track_state_container_types::host& track_states) {
+
+    push(::make_container_record(record_type::track_states, event,
+                                 track_states));
+}
+
+void async_writer::write(
+    std::size_t event,
+    const bound_track_parameters_collection_types::host& params) {
+
+    push(::make_collection_record(record_type::track_parameters, event,
+                                  params));
+}
+
+void async_writer::flush() {
+
+    std::unique_lock<std::mutex> lock{m_mutex};
+    m_written_cv.wait(lock, [this]() {
+        return (m_queue.empty() && (m_writing == 0)) || m_error;
+    });
+    if (m_error) {
+        std::rethrow_exception(m_error);
+    }
+}
+
+std::chrono::nanoseconds async_writer::stall_time() const {
+
+    std::lock_guard<std::mutex> lock{m_mutex};
+    return m_stall_time;
+}
+
+std::size_t async_writer::queued() const {
+
+    std::lock_guard<std::mutex> lock{m_mutex};
+    return m_queue.size() + m_writing;
+}
+
+void async_writer::push(std::string record) {
+
+    {
+        const auto start = std::chrono::steady_clock::now();
+        std::unique_lock<std::mutex> lock{m_mutex};
+        m_written_cv.wait(lock, [this]() {
+            return (m_queue.size() < m_queue_depth) || m_error;
+        });
+        m_stall_time += std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now() - start);
+        if (m_error) {
+            std::rethrow_exception(m_error);
+        }
+        m_queue.push_back(std::move(record));
+    }
+    m_queued_cv.notify_one();
+}
+
+void async_writer::write_records() {
+
+    // The records of one batch, and the buffer that they are collected into.
+    // Both re-used between the batches.
+    std::vector<std::string> records;
+    std::string batch;
+
+    while (true) {
+
+        // Take as many of the queued records as fit into one batch.
+        records.clear();
+        {
+            std::unique_lock<std::mutex> lock{m_mutex};
+            m_queued_cv.wait(lock,
+                             [this]() { return (!m_queue.empty()) || m_stop; });
+            if (m_queue.empty()) {
+                return;
+            }
+            std::size_t size = 0;
+            while ((!m_queue.empty()) &&
+                   (records.empty() ||
+                    (size + m_queue.front().size() <= m_batch_size))) {
+                size += m_queue.front().size();
+                records.push_back(std::move(m_queue.front()));
+                m_queue.pop_front();
+            }
+            m_writing = records.size();
+        }
+        m_written_cv.notify_all();
+
+        // Write them with one sequential write.
+        batch.clear();
+        for (const std::string& record : records) {
+            batch.append(record);
+        }
+        m_file.write(batch.data(), static_cast<std::streamsize>(batch.size()));
+        m_file.flush();
+
+        // Mark them as written.
+        {
+            std::lock_guard<std::mutex> lock{m_mutex};
+            m_writing = 0;
+            if ((!m_file) && (!m_error)) {
+                m_error = std::make_exception_ptr(
+                    std::runtime_error("Failed to write the output file"));
+            }
+        }
+        m_written_cv.notify_all();
+    }
+}
+
+std::map<std::size_t, bound_track_parameters_collection_types::host>
+read_track_parameters(std::string_view filename, vecmem::memory_resource& mr) {
+
+    std::ifstream in_file(std::string(filename), std::ios::binary);
+    if (!in_file) {
+        throw std::runtime_error("Could not open file: " +
+                                 std::string(filename));
+    }
+    const std::string data{std::istreambuf_iterator<char>(in_file),
+                           std::istreambuf_iterator<char>()};
+
+    std::map<std::size_t, bound_track_parameters_collection_types::host>
+        result;
+    std::size_t pos = 0;
+    while (pos < data.size()) {
+
+        // Read the header of the record.
+        async_writer::record_header header;
+        if (pos + sizeof(header) > data.size()) {
+            throw std::runtime_error("Truncated record header in file: " +
+                                     std::string(filename));
+        }
+        std::memcpy(&header, data.data() + pos, sizeof(header));
+        pos += sizeof(header);
+        if (pos + header.size > data.size()) {
+            throw std::runtime_error("Truncated record in file: " +
+                                     std::string(filename));
+        }
+        const std::size_t payload = pos;
+        pos += header.size;
+        if ((header.type != async_writer::record_type::track_parameters) ||
+            (result.find(header.event) != result.end())) {
+            continue;
+        }
+
+        // Read the track parameters of the event.
+        std::size_t size = 0;
+        if (header.size < sizeof(size)) {
+            throw std::runtime_error("Malformed record in file: " +
+                                     std::string(filename));
+        }
+        std::memcpy(&size, data.data() + payload, sizeof(size));
+        if (sizeof(size) + size * sizeof(bound_track_parameters) !=
+            header.size) {
+            throw std::runtime_error("Malformed record in file: " +
+                                     std::string(filename));
+        }
+        bound_track_parameters_collection_types::host params{size, &mr};
+        std::memcpy(params.data(), data.data() + payload + sizeof(size),
+                    size * sizeof(bound_track_parameters));
+        result.emplace(static_cast<std::size_t>(header.event),
+                       std::move(params));
+    }
+    return result;
+}
+
+}  // namespace traccc::io
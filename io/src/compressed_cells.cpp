@@ -0,0 +1,394 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Local include(s).
+#include "compressed_cells.hpp"
+
+#include "compressed_file_format.hpp"
+
+// Zstandard include(s).
+#ifdef TRACCC_IO_HAVE_ZSTD
+#include <zstd.h>
+#endif
+
+// TBB include(s).
+#ifdef TRACCC_IO_HAVE_TBB
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+#endif
+
+// System include(s).
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace {
+
+using traccc::io::details::compressed_file_block;
+using traccc::io::details::compressed_file_codec;
+using traccc::io::details::compressed_file_header;
+
+/// The codec used for writing new files
+constexpr compressed_file_codec default_codec =
+#ifdef TRACCC_IO_HAVE_ZSTD
+    compressed_file_codec::zstd;
+#else
+    compressed_file_codec::none;
+#endif
+
+/// The Zstandard compression level used for writing new files
+constexpr int zstd_level = 3;
+
+/// Map signed differences onto (small) unsigned integers
+std::uint64_t zigzag_encode(std::int64_t value) {
+    return (static_cast<std::uint64_t>(value) << 1) ^
+           static_cast<std::uint64_t>(value >> 63);
+}
+
+/// Inverse of @c zigzag_encode
+std::int64_t zigzag_decode(std::uint64_t value) {
+    return static_cast<std::int64_t>(value >> 1) ^
+           -static_cast<std::int64_t>(value & 1u);
+}
+
+/// Append an unsigned integer to a buffer, with a variable length encoding
+void put_varint(std::string& buffer, std::uint64_t value) {
+    while (value >= 0x80u) {
+        buffer.push_back(static_cast<char>((value & 0x7fu) | 0x80u));
+        value >>= 7;
+    }
+    buffer.push_back(static_cast<char>(value));
+}
+
+/// Read an unsigned integer written by @c put_varint
+std::uint64_t get_varint(const char*& data, const char* end) {
+    std::uint64_t result = 0;
+    for (unsigned int shift = 0; (data != end) && (shift < 64); shift += 7) {
+        const auto byte = static_cast<unsigned char>(*(data++));
+        result |= static_cast<std::uint64_t>(byte & 0x7fu) << shift;
+        if ((byte & 0x80u) == 0u) {
+            return result;
+        }
+    }
+    throw std::runtime_error("Corrupt block in compressed cell file");
+}
+
+/// Delta encode the columns of a range of cells
+///
+/// The module links are stored as differences to the previous cell, the
+/// channels as differences to the previous cell on the same module, and the
+/// activation and time values verbatim.
+///
+std::string encode_block(
+    const traccc::cell_collection_types::const_device& cells,
+    std::size_t begin, std::size_t end) {
+
+    std::string result;
+    result.reserve((end - begin) * (3 + 2 * sizeof(traccc::scalar)));
+
+    std::int64_t previous_link = 0;
+    for (std::size_t i = begin; i < end; ++i) {
+        const auto link = static_cast<std::int64_t>(cells[i].module_link);
+        put_varint(result, zigzag_encode(link - previous_link));
+        previous_link = link;
+    }
+    for (std::size_t i = begin; i < end; ++i) {
+        const bool same_module =
+            (i > begin) && (cells[i].module_link == cells[i - 1].module_link);
+        const std::int64_t previous =
+            same_module ? static_cast<std::int64_t>(cells[i - 1].channel0) : 0;
+        put_varint(result,
+                   zigzag_encode(static_cast<std::int64_t>(cells[i].channel0) -
+                                 previous));
+    }
+    for (std::size_t i = begin; i < end; ++i) {
+        const bool same_module =
+            (i > begin) && (cells[i].module_link == cells[i - 1].module_link);
+        const std::int64_t previous =
+            same_module ? static_cast<std::int64_t>(cells[i - 1].channel1) : 0;
+        put_varint(result,
+                   zigzag_encode(static_cast<std::int64_t>(cells[i].channel1) -
+                                 previous));
+    }
+    for (std::size_t i = begin; i < end; ++i) {
+        result.append(reinterpret_cast<const char*>(&(cells[i].activation)),
+                      sizeof(traccc::scalar));
+    }
+    for (std::size_t i = begin; i < end; ++i) {
+        result.append(reinterpret_cast<const char*>(&(cells[i].time)),
+                      sizeof(traccc::scalar));
+    }
+    return result;
+}
+
+/// Inverse of @c encode_block
+void decode_block(const std::string& block, traccc::cell* cells,
+                  std::size_t n_cells) {
+
+    const char* data = block.data();
+    const char* const end = block.data() + block.size();
+
+    std::int64_t link = 0;
+    for (std::size_t i = 0; i < n_cells; ++i) {
+        link += zigzag_decode(get_varint(data, end));
+        cells[i].module_link = static_cast<traccc::cell::link_type>(link);
+    }
+    for (std::size_t i = 0; i < n_cells; ++i) {
+        const bool same_module =
+            (i > 0) && (cells[i].module_link == cells[i - 1].module_link);
+        const std::int64_t previous =
+            same_module ? static_cast<std::int64_t>(cells[i - 1].channel0) : 0;
+        cells[i].channel0 = static_cast<traccc::channel_id>(
+            previous + zigzag_decode(get_varint(data, end)));
+    }
+    for (std::size_t i = 0; i < n_cells; ++i) {
+        const bool same_module =
+            (i > 0) && (cells[i].module_link == cells[i - 1].module_link);
+        const std::int64_t previous =
+            same_module ? static_cast<std::int64_t>(cells[i - 1].channel1) : 0;
+        cells[i].channel1 = static_cast<traccc::channel_id>(
+            previous + zigzag_decode(get_varint(data, end)));
+    }
+    if (static_cast<std::size_t>(end - data) !=
+        2 * n_cells * sizeof(traccc::scalar)) {
+        throw std::runtime_error("Corrupt block in compressed cell file");
+    }
+    for (std::size_t i = 0; i < n_cells; ++i) {
+        std::memcpy(&(cells[i].activation), data, sizeof(traccc::scalar));
+        data += sizeof(traccc::scalar);
+    }
+    for (std::size_t i = 0; i < n_cells; ++i) {
+        std::memcpy(&(cells[i].time), data, sizeof(traccc::scalar));
+        data += sizeof(traccc::scalar);
+    }
+}
+
+/// Compress a block of data with a given codec
+std::string compress(compressed_file_codec codec, std::string data) {
+
+    switch (codec) {
+        case compressed_file_codec::none:
+            return data;
+#ifdef TRACCC_IO_HAVE_ZSTD
+        case compressed_file_codec::zstd: {
+            std::string result(ZSTD_compressBound(data.size()), '\0');
+            const std::size_t size =
+                ZSTD_compress(result.data(), result.size(), data.data(),
+                              data.size(), zstd_level);
+            if (ZSTD_isError(size)) {
+                throw std::runtime_error(
+                    std::string("Zstandard compression failed: ") +
+                    ZSTD_getErrorName(size));
+            }
+            result.resize(size);
+            return result;
+        }
+#endif
+        default:
+            throw std::invalid_argument("Unsupported compression codec");
+    }
+}
+
+/// Decompress a block of data with a given codec
+std::string decompress(compressed_file_codec codec, const char* data,
+                       std::size_t size, std::size_t decompressed_size) {
+
+    switch (codec) {
+        case compressed_file_codec::none:
+            if (size != decompressed_size) {
+                throw std::runtime_error(
+                    "Corrupt block in compressed cell file");
+            }
+            return std::string(data, size);
+#ifdef TRACCC_IO_HAVE_ZSTD
+        case compressed_file_codec::zstd: {
+            std::string result(decompressed_size, '\0');
+            const std::size_t result_size =
+                ZSTD_decompress(result.data(), result.size(), data, size);
+            if (ZSTD_isError(result_size) ||
+                (result_size != decompressed_size)) {
+                throw std::runtime_error(
+                    "Corrupt block in compressed cell file");
+            }
+            return result;
+        }
+#endif
+        default:
+            throw std::runtime_error(
+                "Compressed cell file uses an unsupported codec (" +
+                std::to_string(static_cast<std::uint32_t>(codec)) + ")");
+    }
+}
+
+}  // namespace
+
+namespace traccc::io::details {
+
+void write_compressed_cells(
+    std::string_view filename,
+    const cell_collection_types::const_device& cells,
+    const cell_module_collection_types::const_device& modules) {
+
+    // Encode and compress the blocks of cells.
+    const std::size_t n_blocks =
+        (cells.size() + compressed_file_block_size - 1) /
+        compressed_file_block_size;
+    std::vector<std::string> blocks(n_blocks);
+    std::vector<compressed_file_block> index(n_blocks);
+    auto make_block = [&](std::size_t i) {
+        const std::size_t begin = i * compressed_file_block_size;
+        const std::size_t end =
+            std::min<std::size_t>(begin + compressed_file_block_size,
+                                  cells.size());
+        std::string encoded = encode_block(cells, begin, end);
+        index[i].encoded_size = encoded.size();
+        index[i].first_cell = begin;
+        index[i].n_cells = end - begin;
+        blocks[i] = compress(default_codec, std::move(encoded));
+        index[i].size = blocks[i].size();
+    };
+#ifdef TRACCC_IO_HAVE_TBB
+    tbb::parallel_for(tbb::blocked_range<std::size_t>(0, n_blocks),
+                      [&](const tbb::blocked_range<std::size_t>& range) {
+                          for (std::size_t i = range.begin(); i != range.end();
+                               ++i) {
+                              make_block(i);
+                          }
+                      });
+#else
+    for (std::size_t i = 0; i < n_blocks; ++i) {
+        make_block(i);
+    }
+#endif
+
+    // Compress the modules.
+    const std::string compressed_modules = compress(
+        default_codec,
+        std::string(reinterpret_cast<const char*>(modules.data()),
+                    modules.size() * sizeof(cell_module)));
+
+    // Lay out the file.
+    compressed_file_header header;
+    std::memcpy(header.magic, compressed_file_magic,
+                sizeof(compressed_file_magic));
+    header.version = compressed_file_version;
+    header.codec = default_codec;
+    header.cell_size = sizeof(cell);
+    header.module_size = sizeof(cell_module);
+    header.n_cells = cells.size();
+    header.n_modules = modules.size();
+    header.n_blocks = n_blocks;
+    header.modules_offset = sizeof(compressed_file_header) +
+                            n_blocks * sizeof(compressed_file_block);
+    header.modules_size = compressed_modules.size();
+    std::uint64_t offset = header.modules_offset + header.modules_size;
+    for (compressed_file_block& block : index) {
+        block.offset = offset;
+        offset += block.size;
+    }
+
+    // Write the file.
+    std::ofstream out_file(filename.data(), std::ios::binary);
+    if (!out_file) {
+        throw std::runtime_error("Could not open file: " +
+                                 std::string(filename));
+    }
+    out_file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    out_file.write(reinterpret_cast<const char*>(index.data()),
+                   index.size() * sizeof(compressed_file_block));
+    out_file.write(compressed_modules.data(), compressed_modules.size());
+    for (const std::string& block : blocks) {
+        out_file.write(block.data(), block.size());
+    }
+}
+
+void read_compressed_cells(cell_reader_output& out,
+                           std::string_view filename) {
+
+    // Read the whole file in one go.
+    std::ifstream in_file(filename.data(), std::ios::binary);
+    if (!in_file) {
+        throw std::runtime_error("Could not open file: " +
+                                 std::string(filename));
+    }
+    const std::string data{std::istreambuf_iterator<char>(in_file),
+                           std::istreambuf_iterator<char>()};
+
+    // Check the header and the index.
+    compressed_file_header header;
+    if (data.size() < sizeof(header)) {
+        throw std::runtime_error("Could not read header of file: " +
+                                 std::string(filename));
+    }
+    std::memcpy(&header, data.data(), sizeof(header));
+    if (std::memcmp(header.magic, compressed_file_magic,
+                    sizeof(compressed_file_magic)) != 0) {
+        throw std::runtime_error("Not a compressed traccc file: " +
+                                 std::string(filename));
+    }
+    if (header.version != compressed_file_version) {
+        throw std::runtime_error("Unsupported compressed file version (" +
+                                 std::to_string(header.version) +
+                                 ") in file: " + std::string(filename));
+    }
+    if ((header.cell_size != sizeof(cell)) ||
+        (header.module_size != sizeof(cell_module))) {
+        throw std::runtime_error("Incompatible EDM in compressed file: " +
+                                 std::string(filename));
+    }
+    std::vector<compressed_file_block> index(header.n_blocks);
+    if ((header.modules_offset + header.modules_size > data.size()) ||
+        (sizeof(header) + index.size() * sizeof(compressed_file_block) >
+         data.size())) {
+        throw std::runtime_error("Truncated compressed file: " +
+                                 std::string(filename));
+    }
+    std::memcpy(index.data(), data.data() + sizeof(header),
+                index.size() * sizeof(compressed_file_block));
+    for (const compressed_file_block& block : index) {
+        if ((block.offset + block.size > data.size()) ||
+            (block.first_cell + block.n_cells > header.n_cells)) {
+            throw std::runtime_error("Truncated compressed file: " +
+                                     std::string(filename));
+        }
+    }
+
+    // Decompress the modules.
+    const std::string modules = decompress(
+        header.codec, data.data() + header.modules_offset,
+        header.modules_size, header.n_modules * sizeof(cell_module));
+    out.modules.resize(header.n_modules);
+    std::memcpy(out.modules.data(), modules.data(), modules.size());
+
+    // Decompress and decode the blocks of cells, straight into their final
+    // place.
+    out.cells.resize(header.n_cells);
+    auto read_block = [&](std::size_t i) {
+        decode_block(decompress(header.codec, data.data() + index[i].offset,
+                                index[i].size, index[i].encoded_size),
+                     out.cells.data() + index[i].first_cell, index[i].n_cells);
+    };
+#ifdef TRACCC_IO_HAVE_TBB
+    tbb::parallel_for(tbb::blocked_range<std::size_t>(0, index.size()),
+                      [&](const tbb::blocked_range<std::size_t>& range) {
+                          for (std::size_t i = range.begin(); i != range.end();
+                               ++i) {
+                              read_block(i);
+                          }
+                      });
+#else
+    for (std::size_t i = 0; i < index.size(); ++i) {
+        read_block(i);
+    }
+#endif
+}
+
+}  // namespace traccc::io::details
@@ -0,0 +1,47 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Local include(s).
+#include "traccc/io/reader_edm.hpp"
+
+// Project include(s).
+#include "traccc/edm/cell.hpp"
+
+// System include(s).
+#include <string_view>
+
+namespace traccc::io::details {
+
+/// Write the cells and modules of an event into a compressed file
+///
+/// The cells are split into blocks, and the columns of every block are delta
+/// encoded (with variable length integers) separately. The blocks, and the
+/// modules, are then compressed with Zstandard, if the library was built
+/// with it.
+///
+/// @param filename is the output filename which includes the path
+/// @param cells    The cells to write
+/// @param modules  The modules to write
+///
+void write_compressed_cells(
+    std::string_view filename,
+    const cell_collection_types::const_device& cells,
+    const cell_module_collection_types::const_device& modules);
+
+/// Read the cells and modules of an event from a compressed file
+///
+/// The whole file is read with a single sequential read, after which the
+/// blocks are decompressed in parallel (with TBB) if possible.
+///
+/// @param out      The object to fill with the cells and modules
+/// @param filename is the input filename which includes the path
+///
+void read_compressed_cells(cell_reader_output& out, std::string_view filename);
+
+}  // namespace traccc::io::details
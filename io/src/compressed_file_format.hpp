@@ -0,0 +1,73 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// System include(s).
+#include <cstddef>
+#include <cstdint>
+
+namespace traccc::io::details {
+
+/// The identifier at the start of every @c traccc::data_format::compressed
+/// file
+constexpr char compressed_file_magic[8] = {'T', 'R', 'C', 'C',
+                                           'Z', 'C', 'E', 'L'};
+
+/// The version of the compressed file layout written/understood by this code
+constexpr std::uint32_t compressed_file_version = 1;
+
+/// The (maximal) number of cells encoded into one block of the file
+constexpr std::size_t compressed_file_block_size = 65536;
+
+/// The compression applied to the (delta encoded) blocks of a file
+enum class compressed_file_codec : std::uint32_t {
+    /// The blocks are stored as they come out of the delta encoding
+    none = 0,
+    /// The blocks are compressed with Zstandard
+    zstd = 1
+};
+
+/// Header of a @c traccc::data_format::compressed file
+struct compressed_file_header {
+    /// File type identifier, must be @c compressed_file_magic
+    char magic[8];
+    /// Version of the file layout
+    std::uint32_t version;
+    /// The compression applied to the blocks
+    compressed_file_codec codec;
+    /// Size of one cell (in bytes)
+    std::uint32_t cell_size;
+    /// Size of one module (in bytes)
+    std::uint32_t module_size;
+    /// Number of cells in the file
+    std::uint64_t n_cells;
+    /// Number of modules in the file
+    std::uint64_t n_modules;
+    /// Number of cell blocks in the file
+    std::uint64_t n_blocks;
+    /// Offset of the (compressed) modules from the start of the file
+    std::uint64_t modules_offset;
+    /// Size of the (compressed) modules in the file
+    std::uint64_t modules_size;
+};
+
+/// Entry of the block index, following the header of the file
+struct compressed_file_block {
+    /// Offset of the block from the start of the file
+    std::uint64_t offset;
+    /// Size of the block in the file
+    std::uint64_t size;
+    /// Size of the block after decompression, before the delta decoding
+    std::uint64_t encoded_size;
+    /// Index of the first cell of the block
+    std::uint64_t first_cell;
+    /// Number of cells in the block
+    std::uint64_t n_cells;
+};
+
+}  // namespace traccc::io::details
@@ -0,0 +1,123 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Local include(s).
+#include "fast_reader.hpp"
+
+// TBB include(s).
+#ifdef TRACCC_IO_HAVE_TBB
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+#endif
+
+// System include(s).
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+
+namespace traccc::io::csv {
+
+mapped_text_file::mapped_text_file(std::string_view filename) {
+
+    // Open the file.
+    const std::string fname(filename);
+    const int fd = ::open(fname.c_str(), O_RDONLY);
+    if (fd < 0) {
+        throw std::runtime_error("Could not open file: " + fname);
+    }
+
+    // Get its size.
+    struct stat file_stat;
+    if (::fstat(fd, &file_stat) != 0) {
+        ::close(fd);
+        throw std::runtime_error("Could not open file: " + fname);
+    }
+    const std::size_t size = static_cast<std::size_t>(file_stat.st_size);
+
+    // Empty files can not be mapped, and are just represented by an empty
+    // text.
+    if (size == 0) {
+        ::close(fd);
+        return;
+    }
+
+    // Map it into memory. The mapping stays valid after closing the file.
+    void* data = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd);
+    if (data == MAP_FAILED) {
+        throw std::runtime_error("Could not map file: " + fname);
+    }
+    m_data = data;
+    m_size = size;
+}
+
+mapped_text_file::~mapped_text_file() {
+
+    if (m_data != nullptr) {
+        ::munmap(m_data, m_size);
+    }
+}
+
+std::string_view mapped_text_file::text() const {
+
+    return {static_cast<const char*>(m_data), m_size};
+}
+
+std::vector<std::string_view> split_into_chunks(std::string_view text,
+                                                std::size_t chunk_size) {
+
+    std::vector<std::string_view> result;
+    result.reserve(text.size() / chunk_size + 1);
+    while (!text.empty()) {
+        // End the chunk after the first newline following the target size.
+        std::size_t end = std::min(chunk_size, text.size());
+        if (end < text.size()) {
+            end = text.find('\n', end - 1);
+            end = (end == std::string_view::npos) ? text.size() : end + 1;
+        }
+        result.push_back(text.substr(0, end));
+        text.remove_prefix(end);
+    }
+    return result;
+}
+
+std::size_t count_lines(std::string_view text) {
+
+    std::size_t result = 0;
+    while (!text.empty()) {
+        const std::size_t end = text.find('\n');
+        if (!details::trim_line(text.substr(0, end)).empty()) {
+            ++result;
+        }
+        text.remove_prefix((end == std::string_view::npos) ? text.size()
+                                                           : end + 1);
+    }
+    return result;
+}
+
+void for_each_chunk(std::size_t n_chunks,
+                    const std::function<void(std::size_t)>& func) {
+
+#ifdef TRACCC_IO_HAVE_TBB
+    tbb::parallel_for(tbb::blocked_range<std::size_t>(0, n_chunks),
+                      [&](const tbb::blocked_range<std::size_t>& range) {
+                          for (std::size_t i = range.begin(); i != range.end();
+                               ++i) {
+                              func(i);
+                          }
+                      });
+#else
+    for (std::size_t i = 0; i < n_chunks; ++i) {
+        func(i);
+    }
+#endif
+}
+
+}  // namespace traccc::io::csv
@@ -0,0 +1,258 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// System include(s).
+#include <array>
+#include <charconv>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace traccc::io::csv {
+
+/// Read-only memory mapping of a text file
+class mapped_text_file {
+
+    public:
+    /// Map a file into memory
+    ///
+    /// @param filename The full name of the file to map
+    ///
+    explicit mapped_text_file(std::string_view filename);
+    /// Destructor, unmapping the file
+    ~mapped_text_file();
+
+    /// Copying is not allowed
+    mapped_text_file(const mapped_text_file&) = delete;
+    /// Copying is not allowed
+    mapped_text_file& operator=(const mapped_text_file&) = delete;
+
+    /// The contents of the file
+    std::string_view text() const;
+
+    private:
+    /// The start of the mapped memory
+    void* m_data = nullptr;
+    /// The size of the mapped memory
+    std::size_t m_size = 0;
+
+};  // class mapped_text_file
+
+/// Split a text into chunks of (roughly) equal size, at line boundaries
+///
+/// @param text       The text to split
+/// @param chunk_size The target size of the chunks, in bytes
+/// @return The chunks, with every line of the text in exactly one chunk
+///
+std::vector<std::string_view> split_into_chunks(std::string_view text,
+                                                std::size_t chunk_size);
+
+/// Count the non-empty lines of a text
+std::size_t count_lines(std::string_view text);
+
+/// Call a function for every chunk index, in parallel if possible
+///
+/// @param n_chunks The number of chunks
+/// @param func     The function to call with every index in [0, n_chunks)
+///
+void for_each_chunk(std::size_t n_chunks,
+                    const std::function<void(std::size_t)>& func);
+
+namespace details {
+
+/// The maximum number of columns supported by the fast reader
+static constexpr std::size_t max_columns = 64;
+
+/// Remove a trailing carriage return from a line
+inline std::string_view trim_line(std::string_view line) {
+    if (!line.empty() && (line.back() == '\r')) {
+        line.remove_suffix(1);
+    }
+    return line;
+}
+
+/// Split a line into its (comma separated) fields
+///
+/// @return The number of fields, or @c max_columns + 1 if there are too many
+///
+inline std::size_t split_fields(
+    std::string_view line,
+    std::array<std::string_view, max_columns>& fields) {
+
+    std::size_t n = 0;
+    while (true) {
+        if (n == max_columns) {
+            return max_columns + 1;
+        }
+        const std::size_t pos = line.find(',');
+        fields[n++] = line.substr(0, pos);
+        if (pos == std::string_view::npos) {
+            return n;
+        }
+        line.remove_prefix(pos + 1);
+    }
+}
+
+/// Parse one value from a field
+template <typename T>
+void parse_value(std::string_view field, T& value) {
+
+    // Skip the leading whitespace, like stream based parsing does
+    while (!field.empty() &&
+           ((field.front() == ' ') || (field.front() == '\t'))) {
+        field.remove_prefix(1);
+    }
+
+    if constexpr (std::is_same_v<T, std::uint8_t>) {
+        // Stream based parsing reads one character into (unsigned) chars.
+        // Which is what the DFE reader does for the (single digit) keys.
+        if (field.empty()) {
+            throw std::invalid_argument("Empty field");
+        }
+        value = static_cast<std::uint8_t>(field.front());
+    } else {
+        const auto result =
+            std::from_chars(field.data(), field.data() + field.size(), value);
+        if (result.ec != std::errc{}) {
+            throw std::invalid_argument("Could not parse field \"" +
+                                        std::string(field) + "\"");
+        }
+    }
+}
+
+/// Parse all (mapped) fields of a line into a named tuple
+template <typename T, std::size_t... Is>
+void parse_row(const std::array<std::string_view, max_columns>& fields,
+               const std::array<std::size_t, sizeof...(Is)>& columns, T& row,
+               std::index_sequence<Is...>) {
+
+    auto values = row.tuple();
+    (parse_value(fields[columns[Is]], std::get<Is>(values)), ...);
+}
+
+}  // namespace details
+
+/// Read all rows of a CSV file into named tuples, in parallel
+///
+/// The file is mapped into memory, and split into chunks at line
+/// boundaries. The rows of every chunk are counted first, so that every
+/// chunk can then be parsed (with @c std::from_chars) directly into its
+/// place in the pre-sized output.
+///
+/// @param filename The name of the file to read
+/// @param rows The rows of the file (resized as needed)
+/// @return @c false if the header of the file does not have the layout that
+///         the fast reader can handle (e.g. a missing column), @c true if the
+///         rows were read
+///
+template <typename T>
+bool read_rows_fast(std::string_view filename, std::vector<T>& rows) {
+
+    const mapped_text_file file(filename);
+    std::string_view text = file.text();
+
+    // Parse the header, and find the column of every field of the tuple.
+    std::array<std::string_view, details::max_columns> fields;
+    const std::size_t header_end = text.find('\n');
+    const std::size_t n_columns = details::split_fields(
+        details::trim_line(text.substr(0, header_end)), fields);
+    if (n_columns > details::max_columns) {
+        return false;
+    }
+    static constexpr std::size_t n_fields =
+        std::tuple_size_v<decltype(std::declval<T&>().tuple())>;
+    const auto& names = T::names();
+    std::array<std::size_t, n_fields> columns;
+    for (std::size_t i = 0; i < n_fields; ++i) {
+        columns[i] = n_columns;
+        for (std::size_t j = 0; j < n_columns; ++j) {
+            if (fields[j] == names[i]) {
+                columns[i] = j;
+                break;
+            }
+        }
+        if (columns[i] == n_columns) {
+            return false;
+        }
+    }
+    text.remove_prefix(
+        (header_end == std::string_view::npos) ? text.size() : header_end + 1);
+
+    // Count the rows of every chunk.
+    static constexpr std::size_t chunk_size = 1024 * 1024;
+    const std::vector<std::string_view> chunks =
+        split_into_chunks(text, chunk_size);
+    std::vector<std::size_t> offsets(chunks.size() + 1, 0);
+    for_each_chunk(chunks.size(), [&](std::size_t i) {
+        offsets[i + 1] = count_lines(chunks[i]);
+    });
+    for (std::size_t i = 0; i < chunks.size(); ++i) {
+        offsets[i + 1] += offsets[i];
+    }
+
+    // Parse the chunks into their part of the output.
+    rows.resize(offsets.back());
+    for_each_chunk(chunks.size(), [&](std::size_t i) {
+        std::array<std::string_view, details::max_columns> row_fields;
+        std::size_t row_index = offsets[i];
+        std::string_view chunk = chunks[i];
+        while (!chunk.empty()) {
+            const std::size_t end = chunk.find('\n');
+            const std::string_view line =
+                details::trim_line(chunk.substr(0, end));
+            chunk.remove_prefix((end == std::string_view::npos) ? chunk.size()
+                                                                : end + 1);
+            if (line.empty()) {
+                continue;
+            }
+            if (details::split_fields(line, row_fields) != n_columns) {
+                throw std::runtime_error(
+                    "Wrong number of columns in a line of file: " +
+                    std::string(filename));
+            }
+            details::parse_row(row_fields, columns, rows[row_index++],
+                               std::make_index_sequence<n_fields>{});
+        }
+    });
+    return true;
+}
+
+/// Read all rows of a CSV file into named tuples
+///
+/// Uses @c read_rows_fast, and the (slower) DFE reader for files that the
+/// fast reader can not handle.
+///
+/// @param filename    The name of the file to read
+/// @param make_reader Function creating the DFE reader for the file
+/// @return The rows of the file
+///
+template <typename T, typename reader_factory_t>
+std::vector<T> read_rows(std::string_view filename,
+                         reader_factory_t&& make_reader) {
+
+    std::vector<T> rows;
+    if (read_rows_fast(filename, rows)) {
+        return rows;
+    }
+    auto reader = make_reader(filename);
+    T row;
+    while (reader.read(row)) {
+        rows.push_back(row);
+    }
+    return rows;
+}
+
+}  // namespace traccc::io::csv
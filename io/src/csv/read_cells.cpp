@@ -1,6 +1,6 @@
 /** TRACCC library, part of the ACTS project (R&D line)
  *
- * (c) 2022-2023 CERN for the benefit of the ACTS project
+ * (c) 2022-2024 CERN for the benefit of the ACTS project
  *
  * Mozilla Public License Version 2.0
  */
@@ -8,12 +8,15 @@
 // Local include(s).
 #include "read_cells.hpp"
 
+#include "fast_reader.hpp"
 #include "traccc/io/csv/make_cell_reader.hpp"
 
 // System include(s).
 #include <algorithm>
 #include <cassert>
+#include <numeric>
 #include <stdexcept>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
@@ -64,25 +67,55 @@ traccc::cell_module get_module(traccc::io::csv::cell c,
 
         // Set the value on the module description.
         const auto& binning_data = geo_it->segmentation.binningData();
-        assert(binning_data.size() >= 2);
-        result.pixel = {binning_data[0].min, binning_data[1].min,
-                        binning_data[0].step, binning_data[1].step};
+        assert(binning_data.size() >= 1);
+        if (binning_data.size() == 1) {
+            // Strip modules are only segmented along channel0.
+            result.pixel = {binning_data[0].min, 0.f, binning_data[0].step,
+                            1.f, 1};
+        } else {
+            result.pixel = {binning_data[0].min, binning_data[1].min,
+                            binning_data[0].step, binning_data[1].step};
+        }
     }
 
     return result;
 }
 
-}  // namespace
+/// Helper function re-mapping the geometry ID of a cell, if a barcode map is
+/// provided
+///
+/// @return The original geometry ID of the cell
+///
+std::uint64_t remap_geometry_id(
+    traccc::io::csv::cell& c,
+    const std::map<std::uint64_t, detray::geometry::barcode>* barcode_map) {
 
-namespace traccc::io::csv {
+    const std::uint64_t original_geometry_id = c.geometry_id;
+    if (barcode_map != nullptr) {
+        const auto it = barcode_map->find(c.geometry_id);
+        if (it != barcode_map->end()) {
+            c.geometry_id = it->second.value();
+        } else {
+            throw std::runtime_error("Could not find barcode for geometry ID " +
+                                     std::to_string(c.geometry_id));
+        }
+    }
+    return original_geometry_id;
+}
 
-void read_cells(
-    cell_reader_output& out, std::string_view filename, const geometry* geom,
-    const digitization_config* dconfig,
+/// Read the cells with a linear search for the module of every cell, and
+/// sort them with separate sorts for every module
+void read_cells_linear(
+    traccc::io::cell_reader_output& out, std::string_view filename,
+    const traccc::geometry* geom, const traccc::digitization_config* dconfig,
     const std::map<std::uint64_t, detray::geometry::barcode>* barcode_map) {
 
-    // Construct the cell reader object.
-    auto reader = make_cell_reader(filename);
+    using namespace traccc;
+    using namespace traccc::io;
+
+    // Read all cells from the input file.
+    std::vector<csv::cell> iocells =
+        csv::read_rows<csv::cell>(filename, csv::make_cell_reader);
 
     // Create cell counter vector.
     std::vector<unsigned int> cellCounts;
@@ -96,22 +129,12 @@ void read_cells(
     std::vector<std::pair<csv::cell, unsigned int>> allCells;
     allCells.reserve(50000);
 
-    // Read all cells from input file.
-    csv::cell iocell;
-    while (reader.read(iocell)) {
+    // Process all cells of the input file.
+    for (csv::cell& iocell : iocells) {
 
         // Modify the geometry ID of the cell if a barcode map is provided.
-        const std::uint64_t original_geometry_id = iocell.geometry_id;
-        if (barcode_map != nullptr) {
-            const auto it = barcode_map->find(iocell.geometry_id);
-            if (it != barcode_map->end()) {
-                iocell.geometry_id = it->second.value();
-            } else {
-                throw std::runtime_error(
-                    "Could not find barcode for geometry ID " +
-                    std::to_string(iocell.geometry_id));
-            }
-        }
+        const std::uint64_t original_geometry_id =
+            remap_geometry_id(iocell, barcode_map);
 
         // Look for current module in cell counter vector.
         auto rit = std::find_if(result_modules.rbegin(), result_modules.rend(),
@@ -170,16 +193,138 @@ void read_cells(
      * manually setting the 1st & 2nd modules instead of just the 1st.
      */
 
-    // Sort the cells belonging to the first module.
-    std::sort(result_cells.begin(), result_cells.begin() + nCellsZero, comp);
+    // Sort the cells belonging to the first module. (Stably, to keep the
+    // cells with the same channel1 in their order in the file.)
+    std::stable_sort(result_cells.begin(), result_cells.begin() + nCellsZero,
+                     comp);
     // Sort the cells belonging to the second module.
-    std::sort(result_cells.begin() + nCellsZero,
-              result_cells.begin() + cellCounts[0], comp);
+    std::stable_sort(result_cells.begin() + nCellsZero,
+                     result_cells.begin() + cellCounts[0], comp);
 
     // Sort cells belonging to all other modules.
     for (unsigned int i = 1; i < cellCounts.size() - 1; ++i) {
-        std::sort(result_cells.begin() + cellCounts[i - 1],
-                  result_cells.begin() + cellCounts[i], comp);
+        std::stable_sort(result_cells.begin() + cellCounts[i - 1],
+                         result_cells.begin() + cellCounts[i], comp);
+    }
+}
+
+/// Read the cells with a hash map based lookup of the module of every cell,
+/// and order them with counting sorts over the whole event
+void read_cells_indexed(
+    traccc::io::cell_reader_output& out, std::string_view filename,
+    const traccc::geometry* geom, const traccc::digitization_config* dconfig,
+    const std::map<std::uint64_t, detray::geometry::barcode>* barcode_map) {
+
+    using namespace traccc;
+    using namespace traccc::io;
+
+    // Read all cells from the input file.
+    std::vector<csv::cell> iocells =
+        csv::read_rows<csv::cell>(filename, csv::make_cell_reader);
+
+    // Create the cell counter vector, and the index of the modules.
+    std::vector<unsigned int> cellCounts;
+    cellCounts.reserve(5000);
+    std::unordered_map<std::uint64_t, unsigned int> moduleIndex;
+    moduleIndex.reserve(5000);
+
+    cell_module_collection_types::host& result_modules = out.modules;
+    result_modules.reserve(5000);
+
+    // Create a cell collection, which holds on to a flat list of all the cells
+    // and the position of their respective cell counter & module.
+    std::vector<std::pair<csv::cell, unsigned int>> allCells;
+    allCells.reserve(50000);
+
+    // The largest channel1 value in the event.
+    unsigned int maxChannel1 = 0;
+
+    // Process all cells of the input file.
+    for (csv::cell& iocell : iocells) {
+
+        // Modify the geometry ID of the cell if a barcode map is provided.
+        const std::uint64_t original_geometry_id =
+            remap_geometry_id(iocell, barcode_map);
+
+        // Look up the module of the cell, adding it if it's a new one.
+        auto it = moduleIndex.find(iocell.geometry_id);
+        if (it == moduleIndex.end()) {
+            result_modules.push_back(
+                get_module(iocell, geom, dconfig, original_geometry_id));
+            cellCounts.push_back(0);
+            it = moduleIndex
+                     .emplace(iocell.geometry_id, result_modules.size() - 1)
+                     .first;
+        }
+        allCells.push_back({iocell, it->second});
+        ++(cellCounts[it->second]);
+        maxChannel1 = std::max(maxChannel1, iocell.channel1);
+    }
+
+    // The total number cells.
+    const unsigned int totalCells = allCells.size();
+
+    // Order the cells by channel1 with a (stable) counting sort, if the range
+    // of the channel1 values allows it. Otherwise just keep the order of the
+    // file, and sort the cells of every module separately at the end.
+    const bool sortByChannel =
+        (maxChannel1 < 4u * static_cast<std::uint64_t>(totalCells) + 1024u);
+    std::vector<unsigned int> order(totalCells);
+    if (sortByChannel) {
+        std::vector<unsigned int> channelOffsets(maxChannel1 + 2, 0);
+        for (const auto& c : allCells) {
+            ++(channelOffsets[c.first.channel1 + 1]);
+        }
+        std::partial_sum(channelOffsets.begin(), channelOffsets.end(),
+                         channelOffsets.begin());
+        for (unsigned int i = 0; i < totalCells; ++i) {
+            order[channelOffsets[allCells[i].first.channel1]++] = i;
+        }
+    } else {
+        std::iota(order.begin(), order.end(), 0u);
+    }
+
+    // Group the cells by module with a second (stable) counting sort, which
+    // keeps the channel1 ordering within each module.
+    std::vector<unsigned int> moduleOffsets(cellCounts.size() + 1, 0);
+    std::partial_sum(cellCounts.begin(), cellCounts.end(),
+                     moduleOffsets.begin() + 1);
+
+    cell_collection_types::host& result_cells = out.cells;
+    result_cells.resize(totalCells);
+    std::vector<unsigned int> fillPos(moduleOffsets.begin(),
+                                      moduleOffsets.end() - 1);
+    for (const unsigned int i : order) {
+        const csv::cell& c = allCells[i].first;
+        const unsigned int moduleIdx = allCells[i].second;
+        result_cells[fillPos[moduleIdx]++] = traccc::cell{
+            c.channel0, c.channel1, c.value, c.timestamp, moduleIdx};
+    }
+
+    // Sort the cells of every module, if the counting sort was not possible.
+    if (!sortByChannel) {
+        for (std::size_t i = 0; i < cellCounts.size(); ++i) {
+            std::stable_sort(result_cells.begin() + moduleOffsets[i],
+                             result_cells.begin() + moduleOffsets[i + 1],
+                             comp);
+        }
+    }
+}
+
+}  // namespace
+
+namespace traccc::io::csv {
+
+void read_cells(
+    cell_reader_output& out, std::string_view filename, const geometry* geom,
+    const digitization_config* dconfig,
+    const std::map<std::uint64_t, detray::geometry::barcode>* barcode_map,
+    bool use_module_index) {
+
+    if (use_module_index) {
+        read_cells_indexed(out, filename, geom, dconfig, barcode_map);
+    } else {
+        read_cells_linear(out, filename, geom, dconfig, barcode_map);
     }
 }
 
@@ -1,6 +1,6 @@
 /** TRACCC library, part of the ACTS project (R&D line)
  *
- * (c) 2022 CERN for the benefit of the ACTS project
+ * (c) 2022-2024 CERN for the benefit of the ACTS project
  *
  * Mozilla Public License Version 2.0
  */
@@ -8,6 +8,7 @@
 // Local include(s).
 #include "read_measurements.hpp"
 
+#include "fast_reader.hpp"
 #include "traccc/io/csv/make_measurement_reader.hpp"
 
 // Detray include(s).
@@ -15,24 +16,26 @@
 
 // System include(s).
 #include <algorithm>
+#include <vector>
 
 namespace traccc::io::csv {
 
 void read_measurements(measurement_reader_output& out,
                        std::string_view filename, const bool do_sort) {
 
-    // Construct the measurement reader object.
-    auto reader = make_measurement_reader(filename);
+    // Read all measurements from the input file.
+    const std::vector<csv::measurement> iomeasurements =
+        read_rows<csv::measurement>(filename, make_measurement_reader);
 
     // Create the result collection.
     measurement_collection_types::host& result_measurements = out.measurements;
+    result_measurements.reserve(iomeasurements.size());
     cell_module_collection_types::host& result_modules = out.modules;
 
     std::map<geometry_id, unsigned int> m;
 
-    // Read the measurements from the input file.
-    csv::measurement iomeas;
-    while (reader.read(iomeas)) {
+    // Convert the measurements of the input file.
+    for (const csv::measurement& iomeas : iomeasurements) {
 
         unsigned int link;
         auto it = m.find(iomeas.geometry_id);
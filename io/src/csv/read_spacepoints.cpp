@@ -1,6 +1,6 @@
 /** TRACCC library, part of the ACTS project (R&D line)
  *
- * (c) 2022 CERN for the benefit of the ACTS project
+ * (c) 2022-2024 CERN for the benefit of the ACTS project
  *
  * Mozilla Public License Version 2.0
  */
@@ -8,6 +8,7 @@
 // Local include(s).
 #include "read_spacepoints.hpp"
 
+#include "fast_reader.hpp"
 #include "read_measurements.hpp"
 #include "traccc/io/csv/make_hit_reader.hpp"
 #include "traccc/io/csv/make_measurement_hit_id_reader.hpp"
@@ -18,6 +19,7 @@
 // System include(s).
 #include <algorithm>
 #include <map>
+#include <vector>
 
 namespace traccc::io::csv {
 
@@ -38,8 +40,8 @@ void read_spacepoints(spacepoint_reader_output& out, std::string_view filename,
         measurement_hit_ids.push_back(io_mh_id);
     }
 
-    // Construct the spacepoint reader object.
-    auto reader = make_hit_reader(filename);
+    // Read all hits from the input file.
+    const std::vector<hit> iohits = read_rows<hit>(filename, make_hit_reader);
 
     // Create the result collection.
     spacepoint_collection_types::host& result_spacepoints = out.spacepoints;
@@ -47,9 +49,9 @@ void read_spacepoints(spacepoint_reader_output& out, std::string_view filename,
 
     std::map<geometry_id, unsigned int> m;
 
-    // Read the spacepoints from the input file.
-    hit iohit;
-    while (reader.read(iohit)) {
+    // Create the spacepoints from the hits of the input file.
+    result_spacepoints.reserve(iohits.size());
+    for (const hit& iohit : iohits) {
         unsigned int link;
         auto it = m.find(iohit.geometry_id);
         if (it != m.end()) {
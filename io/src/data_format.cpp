@@ -1,6 +1,6 @@
 /** TRACCC library, part of the ACTS project (R&D line)
  *
- * (c) 2022 CERN for the benefit of the ACTS project
+ * (c) 2022-2024 CERN for the benefit of the ACTS project
  *
  * Mozilla Public License Version 2.0
  */
@@ -25,6 +25,15 @@ std::ostream& operator<<(std::ostream& out, data_format format) {
         case data_format::json:
             out << "json";
             break;
+        case data_format::mapped:
+            out << "mapped";
+            break;
+        case data_format::packed:
+            out << "packed";
+            break;
+        case data_format::compressed:
+            out << "compressed";
+            break;
         default:
             out << "?!?unknown?!?";
             break;
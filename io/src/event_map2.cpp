@@ -1,6 +1,6 @@
 /** TRACCC library, part of the ACTS project (R&D line)
  *
- * (c) 2022 CERN for the benefit of the ACTS project
+ * (c) 2022-2024 CERN for the benefit of the ACTS project
  *
  * Mozilla Public License Version 2.0
  */
@@ -8,11 +8,33 @@
 // Local include(s).
 #include "traccc/io/event_map2.hpp"
 
+#include "parallel_sort.hpp"
 #include "traccc/io/csv/make_hit_reader.hpp"
 #include "traccc/io/csv/make_measurement_hit_id_reader.hpp"
 #include "traccc/io/csv/make_measurement_reader.hpp"
 #include "traccc/io/csv/make_particle_reader.hpp"
 #include "traccc/io/utils.hpp"
+
+// System include(s).
+#include <numeric>
+#include <vector>
+
+namespace {
+
+/// Truth information belonging to one measurement
+struct measurement_truth {
+    /// The measurement itself
+    traccc::measurement meas;
+    /// The global position of its hit
+    traccc::point3 global_pos;
+    /// The global momentum of its hit
+    traccc::point3 global_mom;
+    /// The particle making the hit
+    traccc::particle ptc;
+};
+
+}  // namespace
+
 namespace traccc {
 
 event_map2::event_map2(std::size_t event, const std::string& measurement_dir,
@@ -76,27 +98,31 @@ event_map2::event_map2(std::size_t event, const std::string& measurement_dir,
         measurements.push_back(io_measurement);
     }
 
-    for (const auto& csv_meas : measurements) {
+    // Construct the truth information of all measurements, in parallel.
+    std::vector<measurement_truth> truths(measurements.size());
+    auto make_truth = [&](std::size_t i) {
+        const auto& csv_meas = measurements[i];
+        measurement_truth& truth = truths[i];
 
         // Hit index
         const auto h_id = measurement_hit_ids[csv_meas.measurement_id].hit_id;
 
         // Make spacepoint
-        const auto csv_hit = hits[h_id];
-        point3 global_pos{csv_hit.tx, csv_hit.ty, csv_hit.tz};
-        point3 global_mom{csv_hit.tpx, csv_hit.tpy, csv_hit.tpz};
+        const auto& csv_hit = hits[h_id];
+        truth.global_pos = {csv_hit.tx, csv_hit.ty, csv_hit.tz};
+        truth.global_mom = {csv_hit.tpx, csv_hit.tpy, csv_hit.tpz};
 
         // Make particle
-        const auto csv_ptc = particles[csv_hit.particle_id];
+        const auto& csv_ptc = particles[csv_hit.particle_id];
         point3 pos{csv_ptc.vx, csv_ptc.vy, csv_ptc.vz};
         vector3 mom{csv_ptc.px, csv_ptc.py, csv_ptc.pz};
-        particle ptc{csv_ptc.particle_id, csv_ptc.particle_type,
-                     csv_ptc.process,     pos,
-                     csv_ptc.vt,          mom,
-                     csv_ptc.m,           csv_ptc.q};
+        truth.ptc = particle{csv_ptc.particle_id, csv_ptc.particle_type,
+                             csv_ptc.process,     pos,
+                             csv_ptc.vt,          mom,
+                             csv_ptc.m,           csv_ptc.q};
 
         // Construct the measurement object.
-        traccc::measurement meas;
+        traccc::measurement& meas = truth.meas;
         std::array<typename transform3::size_type, 2u> indices{0u, 0u};
         meas.meas_dim = 0u;
 
@@ -125,17 +151,90 @@ event_map2::event_map2(std::size_t event, const std::string& measurement_dir,
 
         meas.subs.set_indices(indices);
         meas.surface_link = detray::geometry::barcode{csv_meas.geometry_id};
+    };
+    io::details::parallel_for_each_index(measurements.size(), make_truth);
+
+    // Order the measurements by measurement, and separately by particle.
+    // Keeping the original order of the measurements for equal keys.
+    std::vector<std::size_t> by_meas(truths.size());
+    std::iota(by_meas.begin(), by_meas.end(), 0u);
+    std::vector<std::size_t> by_ptc = by_meas;
+    io::details::parallel_sort(
+        by_meas.begin(), by_meas.end(), [&](std::size_t lhs, std::size_t rhs) {
+            if (truths[lhs].meas < truths[rhs].meas) {
+                return true;
+            } else if (truths[rhs].meas < truths[lhs].meas) {
+                return false;
+            }
+            return lhs < rhs;
+        });
+    io::details::parallel_sort(
+        by_ptc.begin(), by_ptc.end(), [&](std::size_t lhs, std::size_t rhs) {
+            if (truths[lhs].ptc.particle_id != truths[rhs].ptc.particle_id) {
+                return truths[lhs].ptc.particle_id <
+                       truths[rhs].ptc.particle_id;
+            }
+            return lhs < rhs;
+        });
+
+    // Fill the maps in order, so that every element is appended to them
+    // without searching for its place.
+    for (std::size_t i : by_meas) {
+        const measurement_truth& truth = truths[i];
 
         // Fill measurement to truth global position and momentum map
-        meas_xp_map[meas] = std::make_pair(global_pos, global_mom);
+        const auto xp_it = meas_xp_map.emplace_hint(
+            meas_xp_map.end(), truth.meas, std::pair<point3, point3>{});
+        xp_it->second = std::make_pair(truth.global_pos, truth.global_mom);
+
+        // Fill measurement to particle map
+        auto& contributing_particles =
+            meas_ptc_map
+                .emplace_hint(meas_ptc_map.end(), truth.meas,
+                              std::map<particle, uint64_t>{})
+                ->second;
+        contributing_particles[truth.ptc]++;
+    }
+    for (std::size_t i : by_ptc) {
+        const measurement_truth& truth = truths[i];
 
         // Fill particle to measurement map
-        ptc_meas_map[ptc].push_back(meas);
+        ptc_meas_map
+            .emplace_hint(ptc_meas_map.end(), truth.ptc,
+                          std::vector<measurement>{})
+            ->second.push_back(truth.meas);
+    }
+}
 
-        // Fill measurement to particle map
-        auto& contributing_particles = meas_ptc_map[meas];
-        contributing_particles[ptc]++;
+truth_seed_input_collection_types::host event_map2::make_truth_seed_inputs(
+    vecmem::memory_resource& resource) const {
+
+    truth_seed_input_collection_types::host result(&resource);
+    result.reserve(ptc_meas_map.size());
+    for (const auto& [ptc, measurements] : ptc_meas_map) {
+        const auto& xp = meas_xp_map.at(measurements[0]);
+        result.push_back({measurements[0].surface_link,
+                          free_track_parameters(xp.first, 0.f, xp.second,
+                                                ptc.charge)});
+    }
+    return result;
+}
+
+measurement_particle_container_types::host
+event_map2::make_measurement_particles(
+    vecmem::memory_resource& resource) const {
+
+    measurement_particle_container_types::host result(&resource);
+    result.reserve(meas_ptc_map.size());
+    for (const auto& [meas, ptcs] : meas_ptc_map) {
+        vecmem::vector<std::uint64_t> ids(&resource);
+        ids.reserve(ptcs.size());
+        for (const auto& ptc : ptcs) {
+            ids.push_back(ptc.first.particle_id);
+        }
+        result.push_back(measurement{meas}, std::move(ids));
     }
+    return result;
 }
 
 }  // namespace traccc
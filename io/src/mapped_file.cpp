@@ -0,0 +1,149 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Local include(s).
+#include "traccc/io/mapped_file.hpp"
+
+#include "mapped_file_format.hpp"
+
+// System include(s).
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cstring>
+#include <stdexcept>
+#include <string>
+
+namespace traccc::io {
+
+mapped_file::mapped_file(std::string_view filename) {
+
+    // Open the file.
+    const std::string fname(filename);
+    const int fd = ::open(fname.c_str(), O_RDONLY);
+    if (fd < 0) {
+        throw std::runtime_error("Could not open file: " + fname);
+    }
+
+    // Check that it is large enough to hold a header.
+    struct stat file_stat;
+    if ((::fstat(fd, &file_stat) != 0) ||
+        (static_cast<std::size_t>(file_stat.st_size) <
+         sizeof(details::mapped_file_header))) {
+        ::close(fd);
+        throw std::runtime_error("Invalid mapped file: " + fname);
+    }
+    m_size = static_cast<std::size_t>(file_stat.st_size);
+
+    // Map it into memory. The mapping stays valid after closing the file.
+    void* data = ::mmap(nullptr, m_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd);
+    if (data == MAP_FAILED) {
+        throw std::runtime_error("Could not map file: " + fname);
+    }
+    m_data = data;
+
+    // Check the header of the file.
+    const auto* header =
+        static_cast<const details::mapped_file_header*>(m_data);
+    if (std::memcmp(header->magic, details::mapped_file_magic,
+                    sizeof(details::mapped_file_magic)) != 0) {
+        ::munmap(m_data, m_size);
+        throw std::runtime_error("Not a mapped traccc file: " + fname);
+    }
+    if (header->version != version) {
+        ::munmap(m_data, m_size);
+        throw std::runtime_error("Unsupported mapped file version (" +
+                                 std::to_string(header->version) +
+                                 ") in file: " + fname);
+    }
+    if (sizeof(details::mapped_file_header) +
+            header->n_sections * sizeof(details::mapped_file_section) >
+        m_size) {
+        ::munmap(m_data, m_size);
+        throw std::runtime_error("Truncated mapped file: " + fname);
+    }
+}
+
+mapped_file::mapped_file(mapped_file&& parent) noexcept
+    : m_data(parent.m_data), m_size(parent.m_size) {
+
+    parent.m_data = nullptr;
+    parent.m_size = 0;
+}
+
+mapped_file::~mapped_file() {
+
+    if (m_data != nullptr) {
+        ::munmap(m_data, m_size);
+    }
+}
+
+mapped_file& mapped_file::operator=(mapped_file&& rhs) noexcept {
+
+    // Avoid self-assignment.
+    if (this == &rhs) {
+        return *this;
+    }
+
+    // Release the current mapping, and take over the other one.
+    if (m_data != nullptr) {
+        ::munmap(m_data, m_size);
+    }
+    m_data = rhs.m_data;
+    m_size = rhs.m_size;
+    rhs.m_data = nullptr;
+    rhs.m_size = 0;
+
+    // Return this object.
+    return *this;
+}
+
+std::size_t mapped_file::n_sections() const {
+
+    return static_cast<const details::mapped_file_header*>(m_data)->n_sections;
+}
+
+const void* mapped_file::data() const {
+
+    return m_data;
+}
+
+std::size_t mapped_file::size() const {
+
+    return m_size;
+}
+
+std::pair<const void*, std::size_t> mapped_file::section_data(
+    std::size_t index, std::size_t element_size) const {
+
+    // Find the description of the section.
+    if (index >= n_sections()) {
+        throw std::out_of_range("Mapped file section index out of range");
+    }
+    const char* start = static_cast<const char*>(m_data);
+    const auto* section =
+        reinterpret_cast<const details::mapped_file_section*>(
+            start + sizeof(details::mapped_file_header)) +
+        index;
+
+    // Make sure that it can be used as requested.
+    if (section->element_size != element_size) {
+        throw std::runtime_error("Mapped file section element size mismatch");
+    }
+    if ((section->offset % alignment != 0) ||
+        (section->offset + section->size * section->element_size > m_size)) {
+        throw std::runtime_error("Invalid mapped file section");
+    }
+
+    // Return the section's payload.
+    return {start + section->offset, static_cast<std::size_t>(section->size)};
+}
+
+}  // namespace traccc::io
@@ -0,0 +1,39 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// System include(s).
+#include <cstdint>
+
+namespace traccc::io::details {
+
+/// The identifier at the start of every @c traccc::data_format::mapped file
+constexpr char mapped_file_magic[8] = {'T', 'R', 'C', 'C',
+                                       'M', 'A', 'P', '\0'};
+
+/// Header of a @c traccc::data_format::mapped file
+struct mapped_file_header {
+    /// File type identifier, must be @c mapped_file_magic
+    char magic[8];
+    /// Version of the file layout
+    std::uint32_t version;
+    /// Number of sections in the file
+    std::uint32_t n_sections;
+};
+
+/// Entry of the table of sections, following the header of the file
+struct mapped_file_section {
+    /// Offset of the section's payload from the start of the file
+    std::uint64_t offset;
+    /// Number of elements in the section
+    std::uint64_t size;
+    /// Size of one element of the section (in bytes)
+    std::uint64_t element_size;
+};
+
+}  // namespace traccc::io::details
@@ -0,0 +1,85 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Local include(s).
+#include "traccc/io/mapped_geometry.hpp"
+
+#include "write_mapped.hpp"
+
+// System include(s).
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace {
+
+/// Identifier / barcode pair, as stored in the mapped file
+struct barcode_entry {
+    std::uint64_t source;
+    std::uint64_t barcode;
+};
+
+/// Copy the contents of a view into a vector, for writing it
+template <typename T>
+std::vector<T> to_vector(vecmem::data::vector_view<const T> view) {
+    return {view.ptr(), view.ptr() + view.size()};
+}
+
+}  // namespace
+
+namespace traccc::io {
+
+void write_mapped_geometry(
+    std::string_view filename, const geometry& geom,
+    const std::map<std::uint64_t, detray::geometry::barcode>* barcode_map) {
+
+    std::vector<barcode_entry> barcodes;
+    if (barcode_map != nullptr) {
+        barcodes.reserve(barcode_map->size());
+        for (const auto& [source, barcode] : *barcode_map) {
+            barcodes.push_back({source, barcode.value()});
+        }
+    }
+    details::write_mapped_file(filename, to_vector(geom.nodes()),
+                               to_vector(geom.values()), barcodes,
+                               std::vector<std::uint8_t>{
+                                   static_cast<std::uint8_t>(barcode_map !=
+                                                             nullptr)});
+}
+
+mapped_geometry read_mapped_geometry(std::string_view filename) {
+
+    mapped_file file(filename);
+    if (file.n_sections() != 4u) {
+        throw std::runtime_error("Unexpected number of sections in file: " +
+                                 std::string(filename));
+    }
+
+    // Set up the geometry on top of the mapped memory.
+    geometry geom{file.section<geometry::node_type>(0),
+                  file.section<transform3>(1)};
+
+    // Build the barcode map, if the file has one.
+    std::unique_ptr<std::map<std::uint64_t, detray::geometry::barcode>>
+        barcode_map;
+    const auto has_barcode_map = file.section<std::uint8_t>(3);
+    if ((has_barcode_map.size() == 1u) && (has_barcode_map.ptr()[0] != 0u)) {
+        barcode_map = std::make_unique<
+            std::map<std::uint64_t, detray::geometry::barcode>>();
+        const auto barcodes = file.section<barcode_entry>(2);
+        for (unsigned int i = 0; i < barcodes.size(); ++i) {
+            barcode_map->emplace_hint(
+                barcode_map->end(), barcodes.ptr()[i].source,
+                detray::geometry::barcode{barcodes.ptr()[i].barcode});
+        }
+    }
+
+    return {std::move(file), std::move(geom), std::move(barcode_map)};
+}
+
+}  // namespace traccc::io
@@ -1,6 +1,6 @@
 /** TRACCC library, part of the ACTS project (R&D line)
  *
- * (c) 2022 CERN for the benefit of the ACTS project
+ * (c) 2022-2024 CERN for the benefit of the ACTS project
  *
  * Mozilla Public License Version 2.0
  */
@@ -8,6 +8,7 @@
 // Local include(s).
 #include "traccc/io/mapper.hpp"
 
+#include "parallel_sort.hpp"
 #include "traccc/io/csv/make_cell_reader.hpp"
 #include "traccc/io/csv/make_hit_reader.hpp"
 #include "traccc/io/csv/make_measurement_hit_id_reader.hpp"
@@ -22,6 +23,134 @@
 #include "traccc/clusterization/component_connection.hpp"
 #include "traccc/clusterization/measurement_creation.hpp"
 
+// System include(s).
+#include <algorithm>
+#include <limits>
+#include <utility>
+#include <vector>
+
+namespace {
+
+/// Index value for measurements without a simulated hit
+constexpr std::size_t no_hit = std::numeric_limits<std::size_t>::max();
+
+/// Read all simulated hits of an event
+std::vector<traccc::io::csv::hit> read_hits(std::size_t event,
+                                            const std::string& hits_dir) {
+
+    auto hreader = traccc::io::csv::make_hit_reader(
+        traccc::io::data_directory() + hits_dir +
+        traccc::io::get_event_filename(event, "-hits.csv"));
+
+    std::vector<traccc::io::csv::hit> result;
+    traccc::io::csv::hit iohit;
+    while (hreader.read(iohit)) {
+        result.push_back(iohit);
+    }
+    return result;
+}
+
+/// Read the index of the simulated hit of every measurement of an event
+///
+/// @return A vector, indexed by measurement identifier, holding the index of
+///         the corresponding hit (or @c no_hit)
+///
+std::vector<std::size_t> read_measurement_hits(std::size_t event,
+                                               const std::string& hits_dir) {
+
+    auto mhid_reader = traccc::io::csv::make_measurement_hit_id_reader(
+        traccc::io::data_directory() + hits_dir +
+        traccc::io::get_event_filename(event, "-measurement-simhit-map.csv"));
+
+    std::vector<std::size_t> result;
+    traccc::io::csv::measurement_hit_id mh_id;
+    while (mhid_reader.read(mh_id)) {
+        if (mh_id.measurement_id >= result.size()) {
+            result.resize(mh_id.measurement_id + 1, no_hit);
+        }
+        result[mh_id.measurement_id] = mh_id.hit_id;
+    }
+    return result;
+}
+
+/// Get the truth particle of every simulated hit
+std::vector<traccc::particle> hit_particles(
+    const std::vector<traccc::io::csv::hit>& hits,
+    const traccc::particle_map& pmap) {
+
+    std::vector<traccc::particle> result(hits.size());
+    traccc::io::details::parallel_for_each_index(
+        hits.size(), [&](std::size_t i) {
+            auto it = pmap.find(hits[i].particle_id);
+            if (it != pmap.end()) {
+                result[i] = it->second;
+            }
+        });
+    return result;
+}
+
+/// Find an element in a vector of key-value pairs, sorted by key
+///
+/// @return The value belonging to the key, or a default constructed value
+///         if the key is not found
+///
+template <typename key_t, typename value_t>
+value_t find_sorted(const std::vector<std::pair<key_t, value_t>>& entries,
+                    const key_t& key) {
+
+    auto it = std::lower_bound(
+        entries.begin(), entries.end(), key,
+        [](const auto& entry, const key_t& k) { return entry.first < k; });
+    if ((it != entries.end()) && !(key < it->first)) {
+        return it->second;
+    }
+    return value_t{};
+}
+
+/// Generate the truth particle of every simulated cell of an event, sorted
+/// by cell
+std::vector<std::pair<traccc::cell, traccc::particle>> generate_cell_particles(
+    std::size_t event, const std::string& cells_dir,
+    const std::string& hits_dir, const std::string& particle_dir,
+    const traccc::geoId_link_map& link_map) {
+
+    // Truth information of the hits.
+    const std::vector<traccc::particle> particles = hit_particles(
+        read_hits(event, hits_dir),
+        traccc::generate_particle_map(event, particle_dir));
+    const std::vector<std::size_t> measurement_hits =
+        read_measurement_hits(event, hits_dir);
+
+    // Read the cells, and associate them with the particles of their hits.
+    std::vector<std::pair<traccc::cell, traccc::particle>> result;
+    auto creader = traccc::io::csv::make_cell_reader(
+        traccc::io::data_directory() + cells_dir +
+        traccc::io::get_event_filename(event, "-cells.csv"));
+    traccc::io::csv::cell iocell;
+    while (creader.read(iocell)) {
+        unsigned int link = 0;
+        auto it = link_map.find(iocell.geometry_id);
+        if (it != link_map.end()) {
+            link = (*it).second;
+        }
+        const std::size_t hit = (iocell.hit_id < measurement_hits.size())
+                                    ? measurement_hits[iocell.hit_id]
+                                    : no_hit;
+        result.emplace_back(
+            traccc::cell{iocell.channel0, iocell.channel1, iocell.value,
+                         iocell.timestamp, link},
+            (hit < particles.size()) ? particles[hit] : traccc::particle{});
+    }
+
+    // Sort them, for the lookups.
+    traccc::io::details::parallel_sort(
+        result.begin(), result.end(),
+        [](const auto& lhs, const auto& rhs) { return lhs.first < rhs.first; });
+    return result;
+}
+
+}  // namespace
+
 namespace traccc {
 
 particle_map generate_particle_map(std::size_t event,
@@ -110,9 +239,13 @@ hit_map generate_hit_map(std::size_t event, const std::string& hits_dir) {
 
     io::csv::measurement_hit_id mh_id;
 
-    std::map<uint64_t, uint64_t> mh_id_map;
+    // Measurement identifier of every hit, indexed by the hit's identifier.
+    std::vector<uint64_t> mh_id_map;
 
     while (mhid_reader.read(mh_id)) {
+        if (mh_id.hit_id >= mh_id_map.size()) {
+            mh_id_map.resize(mh_id.hit_id + 1, 0u);
+        }
         mh_id_map[mh_id.hit_id] = mh_id.measurement_id;
     }
 
@@ -123,7 +256,7 @@ hit_map generate_hit_map(std::size_t event, const std::string& hits_dir) {
         sp.global = {iohit.tx, iohit.ty, iohit.tz};
 
         // result[hid] = sp;
-        result[mh_id_map[hid]] = sp;
+        result[(hid < mh_id_map.size()) ? mh_id_map[hid] : 0u] = sp;
 
         hid++;
     }
@@ -245,13 +378,18 @@ measurement_particle_map generate_measurement_particle_map(
         link_map[modules[i].surface_link.value()] = i;
     }
 
-    // generate cell particle map
-    auto c_p_map = generate_cell_particle_map(event, cells_dir, hits_dir,
-                                              particle_dir, link_map);
+    // generate the (sorted) truth particles of the cells
+    const auto c_p_vec = generate_cell_particles(event, cells_dir, hits_dir,
+                                                 particle_dir, link_map);
 
+    // The measurements come in order from the map, so they can be appended
+    // to the result without searching for their place in it.
     for (auto const& [meas, cells] : m_c_map) {
+        auto& particles = result.emplace_hint(result.end(), meas,
+                                              std::map<particle, uint64_t>{})
+                              ->second;
         for (const auto& c : cells) {
-            result[meas][c_p_map[c]]++;
+            particles[find_sorted(c_p_vec, c)]++;
         }
     }
 
@@ -274,16 +412,27 @@ measurement_particle_map generate_measurement_particle_map(
                          traccc::data_format::csv);
     spacepoint_collection_types::host& spacepoints_per_event =
         readOut.spacepoints;
-    cell_module_collection_types::host& modules = readOut.modules;
-
-    geoId_link_map link_map;
 
-    for (unsigned int i = 0; i < modules.size(); ++i) {
-        link_map[modules[i].surface_link.value()] = i;
+    // The truth particle of every simulated hit, sorted by hit position.
+    // Hits at the same position are kept in their original order, with only
+    // the last one of them being found by the lookups.
+    const std::vector<io::csv::hit> hits = read_hits(event, hits_dir);
+    const std::vector<particle> particles =
+        hit_particles(hits, generate_particle_map(event, particle_dir));
+    std::vector<std::pair<spacepoint, std::size_t>> h_p_vec(hits.size());
+    for (std::size_t i = 0; i < hits.size(); ++i) {
+        h_p_vec[i].first.global = {hits[i].tx, hits[i].ty, hits[i].tz};
+        h_p_vec[i].second = i;
     }
-
-    auto h_p_map =
-        generate_hit_particle_map(event, hits_dir, particle_dir, link_map);
+    io::details::parallel_sort(
+        h_p_vec.begin(), h_p_vec.end(), [](const auto& lhs, const auto& rhs) {
+            if (lhs.first < rhs.first) {
+                return true;
+            } else if (rhs.first < lhs.first) {
+                return false;
+            }
+            return lhs.second < rhs.second;
+        });
 
     for (const auto& hit : spacepoints_per_event) {
         const auto& meas = hit.meas;
@@ -291,8 +440,14 @@ measurement_particle_map generate_measurement_particle_map(
         spacepoint new_hit;
         new_hit.global = hit.global;
 
-        const auto& ptc = h_p_map[new_hit];
-        result[meas][ptc]++;
+        auto it = std::upper_bound(
+            h_p_vec.begin(), h_p_vec.end(), new_hit,
+            [](const spacepoint& sp, const auto& entry) {
+                return sp < entry.first;
+            });
+        const bool found =
+            (it != h_p_vec.begin()) && !((it - 1)->first < new_hit);
+        result[meas][found ? particles[(it - 1)->second] : particle{}]++;
     }
 
     return result;
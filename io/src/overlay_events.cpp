@@ -0,0 +1,130 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Local include(s).
+#include "traccc/io/overlay_events.hpp"
+
+// System include(s).
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <unordered_map>
+
+namespace traccc::io {
+namespace {
+
+/// Helper giving the modules of the overlaid events a common index
+class module_merger {
+
+    public:
+    /// Constructor with the modules of the result
+    explicit module_merger(cell_module_collection_types::host& modules)
+        : m_modules(modules) {}
+
+    /// Get the index of a module in the result, adding it if necessary
+    cell::link_type index(const cell_module& module) {
+
+        auto [it, inserted] = m_index.try_emplace(
+            module.surface_link.value(),
+            static_cast<cell::link_type>(m_modules.size()));
+        if (inserted) {
+            m_modules.push_back(module);
+        }
+        return it->second;
+    }
+
+    private:
+    /// The modules of the result
+    cell_module_collection_types::host& m_modules;
+    /// The index of every module of the result, by surface identifier
+    std::unordered_map<std::uint64_t, cell::link_type> m_index;
+
+};  // class module_merger
+
+}  // namespace
+
+void overlay_cells(cell_reader_output& out,
+                   const std::vector<const cell_reader_output*>& events) {
+
+    // Collect the cells of all events, linked to the common modules.
+    cell_module_collection_types::host modules(out.modules.get_allocator());
+    cell_collection_types::host cells(out.cells.get_allocator());
+    module_merger merger{modules};
+    std::size_t n_cells = 0;
+    for (const cell_reader_output* event : events) {
+        n_cells += event->cells.size();
+    }
+    cells.reserve(n_cells);
+    for (const cell_reader_output* event : events) {
+        std::vector<cell::link_type> links;
+        links.reserve(event->modules.size());
+        for (const cell_module& module : event->modules) {
+            links.push_back(merger.index(module));
+        }
+        for (cell c : event->cells) {
+            c.module_link = links.at(c.module_link);
+            cells.push_back(c);
+        }
+    }
+
+    // Order the cells by module and channel, and merge the ones that ended
+    // up on the same channel.
+    std::stable_sort(cells.begin(), cells.end(),
+                     [](const cell& lhs, const cell& rhs) {
+                         if (lhs.module_link != rhs.module_link) {
+                             return lhs.module_link < rhs.module_link;
+                         } else if (lhs.channel0 != rhs.channel0) {
+                             return lhs.channel0 < rhs.channel0;
+                         }
+                         return lhs.channel1 < rhs.channel1;
+                     });
+    std::size_t n_merged = 0;
+    for (std::size_t i = 0; i < cells.size(); ++i) {
+        if ((n_merged > 0) &&
+            (cells[n_merged - 1].module_link == cells[i].module_link) &&
+            (cells[n_merged - 1].channel0 == cells[i].channel0) &&
+            (cells[n_merged - 1].channel1 == cells[i].channel1)) {
+            cell& merged = cells[n_merged - 1];
+            merged.activation += cells[i].activation;
+            merged.time = std::min(merged.time, cells[i].time);
+        } else {
+            cells[n_merged++] = cells[i];
+        }
+    }
+    cells.resize(n_merged);
+
+    out.cells = std::move(cells);
+    out.modules = std::move(modules);
+}
+
+void overlay_measurements(
+    measurement_reader_output& out,
+    const std::vector<const measurement_reader_output*>& events) {
+
+    // Collect the measurements of all events, linked to the common modules.
+    cell_module_collection_types::host modules(out.modules.get_allocator());
+    measurement_collection_types::host measurements(
+        out.measurements.get_allocator());
+    module_merger merger{modules};
+    for (const measurement_reader_output* event : events) {
+        std::vector<cell::link_type> links;
+        links.reserve(event->modules.size());
+        for (const cell_module& module : event->modules) {
+            links.push_back(merger.index(module));
+        }
+        for (measurement meas : event->measurements) {
+            meas.module_link = links.at(meas.module_link);
+            meas.measurement_id = measurements.size();
+            measurements.push_back(meas);
+        }
+    }
+
+    out.measurements = std::move(measurements);
+    out.modules = std::move(modules);
+}
+
+}  // namespace traccc::io
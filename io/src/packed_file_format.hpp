@@ -0,0 +1,56 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// System include(s).
+#include <cstdint>
+
+namespace traccc::io::details {
+
+/// The identifier at the start of every @c traccc::data_format::packed file
+constexpr char packed_file_magic[8] = {'T', 'R', 'C', 'C',
+                                       'P', 'A', 'C', 'K'};
+
+/// The version of the packed file layout written/understood by this code
+constexpr std::uint32_t packed_file_version = 1;
+
+/// The alignment of the payloads inside of a packed file (in bytes)
+constexpr std::uint64_t packed_file_alignment = 64;
+
+/// The name of the packed cell file, inside of an input directory
+constexpr char packed_cells_filename[] = "cells.pack";
+
+/// Header of a @c traccc::data_format::packed file
+struct packed_file_header {
+    /// File type identifier, must be @c packed_file_magic
+    char magic[8];
+    /// Version of the file layout
+    std::uint32_t version;
+    /// Size of one cell (in bytes)
+    std::uint32_t cell_size;
+    /// Size of one module (in bytes)
+    std::uint32_t module_size;
+    /// Padding, to keep the index 8-byte aligned
+    std::uint32_t padding;
+    /// Number of events in the file
+    std::uint64_t n_events;
+};
+
+/// Entry of the event index, following the header of the file
+struct packed_file_event {
+    /// Offset of the event's cells from the start of the file
+    std::uint64_t cells_offset;
+    /// Number of cells in the event
+    std::uint64_t n_cells;
+    /// Offset of the event's modules from the start of the file
+    std::uint64_t modules_offset;
+    /// Number of modules in the event
+    std::uint64_t n_modules;
+};
+
+}  // namespace traccc::io::details
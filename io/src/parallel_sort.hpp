@@ -0,0 +1,56 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// TBB include(s).
+#ifdef TRACCC_IO_HAVE_TBB
+#include <tbb/parallel_for.h>
+#include <tbb/parallel_sort.h>
+#endif
+
+// System include(s).
+#include <algorithm>
+#include <cstddef>
+
+namespace traccc::io::details {
+
+/// Sort a range of elements, in parallel (with TBB) if possible
+///
+/// @param begin The start of the range
+/// @param end The end of the range
+/// @param comp The comparator to sort the elements with
+///
+template <typename iterator_t, typename comparator_t>
+void parallel_sort(iterator_t begin, iterator_t end, comparator_t comp) {
+
+#ifdef TRACCC_IO_HAVE_TBB
+    tbb::parallel_sort(begin, end, comp);
+#else
+    std::sort(begin, end, comp);
+#endif
+}
+
+/// Execute a function for every index in a range, in parallel (with TBB) if
+/// possible
+///
+/// @param size The number of indices to process
+/// @param func The function to call with every index
+///
+template <typename function_t>
+void parallel_for_each_index(std::size_t size, function_t func) {
+
+#ifdef TRACCC_IO_HAVE_TBB
+    tbb::parallel_for(std::size_t{0}, size, func);
+#else
+    for (std::size_t i = 0; i < size; ++i) {
+        func(i);
+    }
+#endif
+}
+
+}  // namespace traccc::io::details
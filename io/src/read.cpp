@@ -11,23 +11,39 @@
 #include "traccc/io/read_cells.hpp"
 #include "traccc/io/read_digitization_config.hpp"
 #include "traccc/io/read_geometry.hpp"
+#include "traccc/io/read_packed.hpp"
 
 // OpenMP include(s).
 #ifdef _OPENMP
 #include <omp.h>
 #endif
 
+// System include(s).
+#include <numeric>
+#include <vector>
+
 namespace traccc::io {
 
 void read(demonstrator_input& out, std::size_t events,
           std::string_view directory, std::string_view detector_file,
-          std::string_view digi_config_file, data_format format) {
+          std::string_view digi_config_file, data_format format,
+          data_format geometry_format) {
+
+    // A packed file holds everything that is needed about the events,
+    // including the description of their modules.
+    if (format == data_format::packed) {
+        std::vector<std::size_t> event_indices(events);
+        std::iota(event_indices.begin(), event_indices.end(), 0u);
+        read_packed(out, directory, event_indices);
+        return;
+    }
 
     // Read in the detector configuration. We can't use structured bindings for
     // the return value of read_geometry(...), because the old Intel compiler
     // used in the CI, when using OpenMP, crashes on such code. :-(
-    const auto geom_pair = io::read_geometry(detector_file);
+    const auto geom_pair = io::read_geometry(detector_file, geometry_format);
     const auto& geom = geom_pair.first;
+    const auto* barcode_map = geom_pair.second.get();
     const digitization_config digi_cfg =
         io::read_digitization_config(digi_config_file);
 
@@ -36,7 +52,8 @@ void read(demonstrator_input& out, std::size_t events,
     // Read in the cell data for all events. In parallel if possible.
 #pragma omp parallel for
     for (std::size_t event = 0; event < events; ++event) {
-        io::read_cells(out[event], event, directory, format, &geom, &digi_cfg);
+        io::read_cells(out[event], event, directory, format, &geom, &digi_cfg,
+                       barcode_map);
     }
 }
 
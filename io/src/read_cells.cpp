@@ -1,6 +1,6 @@
 /** TRACCC library, part of the ACTS project (R&D line)
  *
- * (c) 2022-2023 CERN for the benefit of the ACTS project
+ * (c) 2022-2024 CERN for the benefit of the ACTS project
  *
  * Mozilla Public License Version 2.0
  */
@@ -8,8 +8,10 @@
 // Local include(s).
 #include "traccc/io/read_cells.hpp"
 
+#include "compressed_cells.hpp"
 #include "csv/read_cells.hpp"
 #include "read_binary.hpp"
+#include "traccc/io/read_mapped.hpp"
 #include "traccc/io/utils.hpp"
 
 namespace traccc::io {
@@ -18,14 +20,15 @@ void read_cells(
     cell_reader_output& out, std::size_t event, std::string_view directory,
     data_format format, const geometry* geom,
     const digitization_config* dconfig,
-    const std::map<std::uint64_t, detray::geometry::barcode>* barcode_map) {
+    const std::map<std::uint64_t, detray::geometry::barcode>* barcode_map,
+    bool use_module_index) {
 
     switch (format) {
         case data_format::csv: {
             read_cells(out,
                        data_directory() + directory.data() +
                            get_event_filename(event, "-cells.csv"),
-                       format, geom, dconfig, barcode_map);
+                       format, geom, dconfig, barcode_map, use_module_index);
             break;
         }
         case data_format::binary: {
@@ -37,6 +40,22 @@ void read_cells(
                                  get_event_filename(event, "-modules.dat"));
             break;
         }
+        case data_format::compressed: {
+            details::read_compressed_cells(
+                out, data_directory() + directory.data() +
+                         get_event_filename(event, "-cells.zdat"));
+            break;
+        }
+        case data_format::mapped: {
+            const mapped_cell_reader_output mapped =
+                read_mapped_cells(event, directory);
+            const cell_collection_types::const_device cells{mapped.cells};
+            out.cells.assign(cells.begin(), cells.end());
+            const cell_module_collection_types::const_device modules{
+                mapped.modules};
+            out.modules.assign(modules.begin(), modules.end());
+            break;
+        }
         default:
             throw std::invalid_argument("Unsupported data format");
     }
@@ -45,11 +64,13 @@ void read_cells(
 void read_cells(
     cell_reader_output& out, std::string_view filename, data_format format,
     const geometry* geom, const digitization_config* dconfig,
-    const std::map<std::uint64_t, detray::geometry::barcode>* barcode_map) {
+    const std::map<std::uint64_t, detray::geometry::barcode>* barcode_map,
+    bool use_module_index) {
 
     switch (format) {
         case data_format::csv:
-            return csv::read_cells(out, filename, geom, dconfig, barcode_map);
+            return csv::read_cells(out, filename, geom, dconfig, barcode_map,
+                                   use_module_index);
 
         default:
             throw std::invalid_argument("Unsupported data format");
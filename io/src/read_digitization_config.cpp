@@ -1,6 +1,6 @@
 /** TRACCC library, part of the ACTS project (R&D line)
  *
- * (c) 2022 CERN for the benefit of the ACTS project
+ * (c) 2022-2024 CERN for the benefit of the ACTS project
  *
  * Mozilla Public License Version 2.0
  */
@@ -8,6 +8,7 @@
 // Local include(s).
 #include "traccc/io/read_digitization_config.hpp"
 
+#include "snapshot_cache.hpp"
 #include "traccc/io/utils.hpp"
 
 // Acts include(s).
@@ -60,19 +61,40 @@ digitization_config read_digitization_config(std::string_view filename) {
 
 }  // namespace json
 
-digitization_config read_digitization_config(std::string_view filename,
-                                             data_format format) {
+digitization_config read_digitization_config(
+    std::string_view filename, data_format format,
+    std::string_view cache_directory) {
 
     // Construct the full filename.
     std::string full_filename = data_directory() + filename.data();
 
+    // Use a snapshot of the configuration if one is available.
+    const std::string snapshot =
+        cache_directory.empty()
+            ? std::string{}
+            : details::snapshot_filename(cache_directory, "digitization",
+                                         full_filename, format);
+    if (!snapshot.empty()) {
+        if (auto result = details::read_digitization_snapshot(snapshot)) {
+            return std::move(*result);
+        }
+    }
+
     // Decide how to read the file.
+    digitization_config result;
     switch (format) {
         case data_format::json:
-            return json::read_digitization_config(full_filename);
+            result = json::read_digitization_config(full_filename);
+            break;
         default:
             throw std::invalid_argument("Unsupported data format");
     }
+
+    // Save the configuration for the next time.
+    if (!snapshot.empty()) {
+        details::write_digitization_snapshot(snapshot, result);
+    }
+    return result;
 }
 
 }  // namespace io
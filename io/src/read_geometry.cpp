@@ -8,6 +8,7 @@
 // Local include(s).
 #include "traccc/io/read_geometry.hpp"
 
+#include "snapshot_cache.hpp"
 #include "traccc/io/details/read_surfaces.hpp"
 #include "traccc/io/utils.hpp"
 
@@ -64,21 +65,44 @@ namespace traccc::io {
 
 std::pair<geometry,
           std::unique_ptr<std::map<std::uint64_t, detray::geometry::barcode>>>
-read_geometry(std::string_view filename, data_format format) {
+read_geometry(std::string_view filename, data_format format,
+              std::string_view cache_directory) {
 
     // Construct the full file name.
     const std::string full_filename = data_directory() + filename.data();
 
+    // Use a snapshot of the geometry if one is available.
+    const std::string snapshot =
+        cache_directory.empty()
+            ? std::string{}
+            : details::snapshot_filename(cache_directory, "geometry",
+                                         full_filename, format);
+    if (!snapshot.empty()) {
+        if (auto result = details::read_geometry_snapshot(snapshot)) {
+            return std::move(*result);
+        }
+    }
+
     // Decide how to read the file.
+    std::pair<geometry, std::unique_ptr<details::barcode_map_type>> result;
     switch (format) {
         case data_format::csv:
-            return {geometry{details::read_surfaces(full_filename, format)},
-                    nullptr};
+            result = {geometry{details::read_surfaces(full_filename, format)},
+                      nullptr};
+            break;
         case data_format::json:
-            return ::read_json_geometry(full_filename);
+            result = ::read_json_geometry(full_filename);
+            break;
         default:
             throw std::invalid_argument("Unsupported data format");
     }
+
+    // Save the geometry for the next time.
+    if (!snapshot.empty()) {
+        details::write_geometry_snapshot(snapshot, result.first,
+                                         result.second.get());
+    }
+    return result;
 }
 
 }  // namespace traccc::io
@@ -0,0 +1,47 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Local include(s).
+#include "traccc/io/read_magnetic_field.hpp"
+
+// System include(s).
+#include <fstream>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+
+namespace traccc::io {
+
+const detray::bfield::inhom_field_t& read_magnetic_field(
+    std::string_view filename) {
+
+    // The field maps read so far.
+    static std::map<std::string, std::unique_ptr<detray::bfield::inhom_field_t>,
+                    std::less<>>
+        cache;
+    static std::mutex cache_mutex;
+
+    std::lock_guard<std::mutex> lock(cache_mutex);
+    auto it = cache.find(filename);
+    if (it != cache.end()) {
+        return *(it->second);
+    }
+
+    // Read the file, if it was not read yet.
+    std::ifstream file(std::string(filename), std::ifstream::binary);
+    if (!file.good()) {
+        throw std::runtime_error("Could not open magnetic field file: " +
+                                 std::string(filename));
+    }
+    auto field = std::make_unique<detray::bfield::inhom_field_t>(file);
+    return *(cache.emplace(std::string(filename), std::move(field))
+                 .first->second);
+}
+
+}  // namespace traccc::io
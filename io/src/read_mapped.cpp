@@ -0,0 +1,64 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Local include(s).
+#include "traccc/io/read_mapped.hpp"
+
+#include "traccc/io/utils.hpp"
+
+// System include(s).
+#include <stdexcept>
+#include <utility>
+
+namespace {
+
+/// Map a file, and make sure that it has the expected number of sections
+traccc::io::mapped_file map_file(const std::string& filename) {
+
+    traccc::io::mapped_file result(filename);
+    if (result.n_sections() != 2u) {
+        throw std::runtime_error("Unexpected number of sections in file: " +
+                                 filename);
+    }
+    return result;
+}
+
+}  // namespace
+
+namespace traccc::io {
+
+mapped_cell_reader_output read_mapped_cells(std::size_t event,
+                                            std::string_view directory) {
+
+    mapped_file file = map_file(data_directory() + directory.data() +
+                                get_event_filename(event, "-cells.map"));
+    const auto cells = file.section<cell>(0);
+    const auto modules = file.section<cell_module>(1);
+    return {std::move(file), cells, modules};
+}
+
+mapped_measurement_reader_output read_mapped_measurements(
+    std::size_t event, std::string_view directory) {
+
+    mapped_file file = map_file(data_directory() + directory.data() +
+                                get_event_filename(event, "-measurements.map"));
+    const auto measurements = file.section<measurement>(0);
+    const auto modules = file.section<cell_module>(1);
+    return {std::move(file), measurements, modules};
+}
+
+mapped_spacepoint_reader_output read_mapped_spacepoints(
+    std::size_t event, std::string_view directory) {
+
+    mapped_file file = map_file(data_directory() + directory.data() +
+                                get_event_filename(event, "-hits.map"));
+    const auto spacepoints = file.section<spacepoint>(0);
+    const auto modules = file.section<cell_module>(1);
+    return {std::move(file), spacepoints, modules};
+}
+
+}  // namespace traccc::io
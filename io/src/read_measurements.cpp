@@ -1,6 +1,6 @@
 /** TRACCC library, part of the ACTS project (R&D line)
  *
- * (c) 2022 CERN for the benefit of the ACTS project
+ * (c) 2022-2024 CERN for the benefit of the ACTS project
  *
  * Mozilla Public License Version 2.0
  */
@@ -10,6 +10,7 @@
 
 #include "csv/read_measurements.hpp"
 #include "read_binary.hpp"
+#include "traccc/io/read_mapped.hpp"
 #include "traccc/io/utils.hpp"
 
 namespace traccc::io {
@@ -37,6 +38,17 @@ void read_measurements(measurement_reader_output& out, std::size_t event,
                                  get_event_filename(event, "-modules.dat"));
             break;
         }
+        case data_format::mapped: {
+            const mapped_measurement_reader_output mapped =
+                read_mapped_measurements(event, directory);
+            const measurement_collection_types::const_device measurements{
+                mapped.measurements};
+            out.measurements.assign(measurements.begin(), measurements.end());
+            const cell_module_collection_types::const_device modules{
+                mapped.modules};
+            out.modules.assign(modules.begin(), modules.end());
+            break;
+        }
         default:
             throw std::invalid_argument("Unsupported data format");
     }
@@ -0,0 +1,134 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Local include(s).
+#include "traccc/io/read_packed.hpp"
+
+#include "packed_file_format.hpp"
+#include "traccc/io/utils.hpp"
+
+// TBB include(s).
+#ifdef TRACCC_IO_HAVE_TBB
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+#endif
+
+// System include(s).
+#include <cassert>
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+
+namespace {
+
+/// Get the full name of the packed cell file in a directory
+std::string packed_filename(std::string_view directory) {
+
+    return traccc::io::data_directory() + directory.data() +
+           traccc::io::details::packed_cells_filename;
+}
+
+/// Read and check the header of a packed cell file
+traccc::io::details::packed_file_header read_header(
+    std::ifstream& in_file, const std::string& filename) {
+
+    traccc::io::details::packed_file_header header;
+    in_file.read(reinterpret_cast<char*>(&header), sizeof(header));
+    if (!in_file) {
+        throw std::runtime_error("Could not read header of file: " +
+                                 filename);
+    }
+    if (std::memcmp(header.magic, traccc::io::details::packed_file_magic,
+                    sizeof(traccc::io::details::packed_file_magic)) != 0) {
+        throw std::runtime_error("Not a packed traccc file: " + filename);
+    }
+    if (header.version != traccc::io::details::packed_file_version) {
+        throw std::runtime_error("Unsupported packed file version (" +
+                                 std::to_string(header.version) +
+                                 ") in file: " + filename);
+    }
+    if ((header.cell_size != sizeof(traccc::cell)) ||
+        (header.module_size != sizeof(traccc::cell_module))) {
+        throw std::runtime_error("Incompatible EDM in packed file: " +
+                                 filename);
+    }
+    return header;
+}
+
+/// Read one event from an (open) packed cell file
+void read_event(std::ifstream& in_file,
+                const traccc::io::details::packed_file_event& event,
+                traccc::io::cell_reader_output& out) {
+
+    out.cells.resize(event.n_cells);
+    in_file.seekg(static_cast<std::streamoff>(event.cells_offset));
+    in_file.read(reinterpret_cast<char*>(out.cells.data()),
+                 event.n_cells * sizeof(traccc::cell));
+    out.modules.resize(event.n_modules);
+    in_file.seekg(static_cast<std::streamoff>(event.modules_offset));
+    in_file.read(reinterpret_cast<char*>(out.modules.data()),
+                 event.n_modules * sizeof(traccc::cell_module));
+    if (!in_file) {
+        throw std::runtime_error("Could not read event from packed file");
+    }
+}
+
+}  // namespace
+
+namespace traccc::io {
+
+std::size_t packed_events(std::string_view directory) {
+
+    const std::string filename = packed_filename(directory);
+    std::ifstream in_file(filename, std::ios::binary);
+    if (!in_file) {
+        throw std::runtime_error("Could not open file: " + filename);
+    }
+    return read_header(in_file, filename).n_events;
+}
+
+void read_packed(demonstrator_input& out, std::string_view directory,
+                 const std::vector<std::size_t>& events) {
+
+    assert(out.size() >= events.size());
+
+    // Read the header and the index of the file.
+    const std::string filename = packed_filename(directory);
+    std::ifstream in_file(filename, std::ios::binary);
+    if (!in_file) {
+        throw std::runtime_error("Could not open file: " + filename);
+    }
+    const details::packed_file_header header = read_header(in_file, filename);
+    std::vector<details::packed_file_event> index(header.n_events);
+    in_file.read(reinterpret_cast<char*>(index.data()),
+                 index.size() * sizeof(details::packed_file_event));
+    for (std::size_t event : events) {
+        if (event >= index.size()) {
+            throw std::out_of_range("Event " + std::to_string(event) +
+                                    " not found in file: " + filename);
+        }
+    }
+
+    // Read the requested events. Every task using its own file handle.
+#ifdef TRACCC_IO_HAVE_TBB
+    tbb::parallel_for(tbb::blocked_range<std::size_t>(0, events.size()),
+                      [&](const tbb::blocked_range<std::size_t>& range) {
+                          std::ifstream task_file(filename, std::ios::binary);
+                          for (std::size_t i = range.begin(); i != range.end();
+                               ++i) {
+                              read_event(task_file, index[events[i]], out[i]);
+                          }
+                      });
+#else
+    for (std::size_t i = 0; i < events.size(); ++i) {
+        read_event(in_file, index[events[i]], out[i]);
+    }
+#endif
+}
+
+}  // namespace traccc::io
@@ -1,6 +1,6 @@
 /** TRACCC library, part of the ACTS project (R&D line)
  *
- * (c) 2022 CERN for the benefit of the ACTS project
+ * (c) 2022-2024 CERN for the benefit of the ACTS project
  *
  * Mozilla Public License Version 2.0
  */
@@ -10,6 +10,7 @@
 
 #include "csv/read_spacepoints.hpp"
 #include "read_binary.hpp"
+#include "traccc/io/read_mapped.hpp"
 #include "traccc/io/utils.hpp"
 
 namespace traccc::io {
@@ -40,6 +41,17 @@ void read_spacepoints(spacepoint_reader_output& out, std::size_t event,
                                  get_event_filename(event, "-modules.dat"));
             break;
         }
+        case data_format::mapped: {
+            const mapped_spacepoint_reader_output mapped =
+                read_mapped_spacepoints(event, directory);
+            const spacepoint_collection_types::const_device spacepoints{
+                mapped.spacepoints};
+            out.spacepoints.assign(spacepoints.begin(), spacepoints.end());
+            const cell_module_collection_types::const_device modules{
+                mapped.modules};
+            out.modules.assign(modules.begin(), modules.end());
+            break;
+        }
         default:
             throw std::invalid_argument("Unsupported data format");
     }
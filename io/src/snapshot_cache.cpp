@@ -0,0 +1,420 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Local include(s).
+#include "snapshot_cache.hpp"
+
+// Acts include(s).
+#include <Acts/Utilities/BinningData.hpp>
+
+// System include(s).
+#include <unistd.h>
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <sstream>
+#include <type_traits>
+#include <vector>
+
+namespace traccc::io::details {
+
+namespace {
+
+/// The identifier at the start of every snapshot file
+constexpr char snapshot_magic[8] = {'T', 'R', 'C', 'C', 'S', 'N', 'A', 'P'};
+
+/// Version of the snapshot layout, to be increased with every change
+constexpr std::uint32_t snapshot_version = 1u;
+
+/// Read the whole contents of a file into memory
+///
+/// @return The contents, or an empty optional if the file can not be read
+///
+std::optional<std::string> read_file(std::string_view filename) {
+
+    std::ifstream in_file(std::string(filename), std::ios::binary);
+    if (!in_file) {
+        return {};
+    }
+    std::ostringstream contents;
+    contents << in_file.rdbuf();
+    if (in_file.bad()) {
+        return {};
+    }
+    return contents.str();
+}
+
+/// Helper class serialising objects into a byte buffer
+class snapshot_writer {
+
+    public:
+    /// Constructor, writing the header of the snapshot
+    snapshot_writer() {
+        m_buffer.append(snapshot_magic, sizeof(snapshot_magic));
+        write(snapshot_version);
+    }
+
+    /// Write a standard layout object
+    template <typename T>
+    void write(const T& value) {
+        static_assert(std::is_standard_layout_v<T>,
+                      "Only standard layout types can be written");
+        m_buffer.append(reinterpret_cast<const char*>(&value), sizeof(T));
+    }
+
+    /// Write a vector of standard layout objects, with its size
+    template <typename T>
+    void write(const std::vector<T>& values) {
+        static_assert(std::is_standard_layout_v<T>,
+                      "Only standard layout types can be written");
+        write(static_cast<std::uint64_t>(values.size()));
+        m_buffer.append(reinterpret_cast<const char*>(values.data()),
+                        values.size() * sizeof(T));
+    }
+
+    /// Write the buffer into a file, replacing it atomically
+    void save(std::string_view filename) const {
+
+        // Write into a temporary file first, so that concurrent jobs never
+        // see a partially written snapshot.
+        const std::string target(filename);
+        const std::string temp = target + ".tmp" + std::to_string(::getpid());
+        {
+            std::ofstream out_file(temp, std::ios::binary);
+            out_file.write(m_buffer.data(),
+                           static_cast<std::streamsize>(m_buffer.size()));
+            if (!out_file) {
+                out_file.close();
+                std::remove(temp.c_str());
+                return;
+            }
+        }
+        if (std::rename(temp.c_str(), target.c_str()) != 0) {
+            std::remove(temp.c_str());
+        }
+    }
+
+    private:
+    /// The serialised data
+    std::string m_buffer;
+};
+
+/// Helper class de-serialising objects from a byte buffer
+class snapshot_reader {
+
+    public:
+    /// Constructor, checking the header of the snapshot
+    explicit snapshot_reader(std::string data) : m_data(std::move(data)) {
+
+        if ((m_data.size() < sizeof(snapshot_magic)) ||
+            (std::memcmp(m_data.data(), snapshot_magic,
+                         sizeof(snapshot_magic)) != 0)) {
+            m_good = false;
+            return;
+        }
+        m_pos = sizeof(snapshot_magic);
+        std::uint32_t version = 0u;
+        read(version);
+        m_good = m_good && (version == snapshot_version);
+    }
+
+    /// Whether all reads succeeded so far
+    bool good() const { return m_good; }
+    /// Whether the whole buffer was read successfully
+    bool done() const { return m_good && (m_pos == m_data.size()); }
+
+    /// Read a standard layout object
+    template <typename T>
+    void read(T& value) {
+        static_assert(std::is_standard_layout_v<T>,
+                      "Only standard layout types can be read");
+        if (!check(sizeof(T))) {
+            return;
+        }
+        std::memcpy(&value, m_data.data() + m_pos, sizeof(T));
+        m_pos += sizeof(T);
+    }
+
+    /// Read a vector of standard layout objects, written with its size
+    template <typename T>
+    void read(std::vector<T>& values) {
+        static_assert(std::is_standard_layout_v<T>,
+                      "Only standard layout types can be read");
+        std::uint64_t size = 0u;
+        read(size);
+        if (!m_good || (size > (m_data.size() - m_pos) / sizeof(T))) {
+            m_good = false;
+            return;
+        }
+        values.resize(size);
+        std::memcpy(values.data(), m_data.data() + m_pos, size * sizeof(T));
+        m_pos += size * sizeof(T);
+    }
+
+    private:
+    /// Check that @c size more bytes can be read
+    bool check(std::size_t size) {
+        m_good = m_good && (size <= m_data.size() - m_pos);
+        return m_good;
+    }
+
+    /// The serialised data
+    std::string m_data;
+    /// The current reading position
+    std::size_t m_pos = 0;
+    /// Whether all reads succeeded so far
+    bool m_good = true;
+};
+
+}  // namespace
+
+std::string snapshot_filename(std::string_view cache_directory,
+                              std::string_view kind, std::string_view filename,
+                              data_format format) {
+
+    // Read the input file. If that fails, let the "real" reader report the
+    // error.
+    const std::optional<std::string> contents = read_file(filename);
+    if (!contents) {
+        return "";
+    }
+
+    // Make sure that the cache directory exists.
+    std::error_code ec;
+    std::filesystem::create_directories(std::string(cache_directory), ec);
+    if (ec) {
+        return "";
+    }
+
+    // Hash the contents and the format of the file (64-bit FNV-1a).
+    std::uint64_t hash = 14695981039346656037ull;
+    auto hash_bytes = [&hash](const char* data, std::size_t size) {
+        for (std::size_t i = 0; i < size; ++i) {
+            hash ^= static_cast<unsigned char>(data[i]);
+            hash *= 1099511628211ull;
+        }
+    };
+    hash_bytes(contents->data(), contents->size());
+    const auto format_value = static_cast<std::uint32_t>(format);
+    hash_bytes(reinterpret_cast<const char*>(&format_value),
+               sizeof(format_value));
+
+    // Construct the snapshot's file name.
+    char hash_string[17];
+    std::snprintf(hash_string, sizeof(hash_string), "%016llx",
+                  static_cast<unsigned long long>(hash));
+    return (std::filesystem::path(std::string(cache_directory)) /
+            (std::string(kind) + "-" + hash_string + ".snapshot"))
+        .string();
+}
+
+std::optional<geometry_snapshot> read_geometry_snapshot(
+    std::string_view filename) {
+
+    std::optional<std::string> data = read_file(filename);
+    if (!data) {
+        return {};
+    }
+    snapshot_reader reader(std::move(*data));
+
+    // Check that the snapshot was written with the same transform type.
+    std::uint64_t transform_size = 0u;
+    reader.read(transform_size);
+    if (transform_size != sizeof(transform3)) {
+        return {};
+    }
+
+    // Read the geometry.
+    std::vector<geometry_id> ids;
+    std::vector<transform3> transforms;
+    reader.read(ids);
+    reader.read(transforms);
+    if (!reader.good() || (ids.size() != transforms.size())) {
+        return {};
+    }
+    std::map<geometry_id, transform3> transform_map;
+    for (std::size_t i = 0; i < ids.size(); ++i) {
+        transform_map.emplace_hint(transform_map.end(), ids[i], transforms[i]);
+    }
+
+    // Read the barcode map.
+    std::uint8_t has_barcode_map = 0u;
+    reader.read(has_barcode_map);
+    std::unique_ptr<barcode_map_type> barcode_map;
+    if (has_barcode_map != 0u) {
+        std::vector<std::uint64_t> sources, barcodes;
+        reader.read(sources);
+        reader.read(barcodes);
+        if (!reader.good() || (sources.size() != barcodes.size())) {
+            return {};
+        }
+        barcode_map = std::make_unique<barcode_map_type>();
+        for (std::size_t i = 0; i < sources.size(); ++i) {
+            barcode_map->emplace_hint(barcode_map->end(), sources[i],
+                                      detray::geometry::barcode{barcodes[i]});
+        }
+    }
+    if (!reader.done()) {
+        return {};
+    }
+
+    return geometry_snapshot{geometry{transform_map}, std::move(barcode_map)};
+}
+
+void write_geometry_snapshot(std::string_view filename, const geometry& geom,
+                             const barcode_map_type* barcode_map) {
+
+    snapshot_writer writer;
+    writer.write(static_cast<std::uint64_t>(sizeof(transform3)));
+
+    // Write the geometry, ordered by identifier.
+    std::map<geometry_id, transform3> transform_map;
+    geom.for_each([&transform_map](geometry_id id, const transform3& tf) {
+        transform_map.emplace(id, tf);
+    });
+    std::vector<geometry_id> ids;
+    std::vector<transform3> transforms;
+    ids.reserve(transform_map.size());
+    transforms.reserve(transform_map.size());
+    for (const auto& [id, tf] : transform_map) {
+        ids.push_back(id);
+        transforms.push_back(tf);
+    }
+    writer.write(ids);
+    writer.write(transforms);
+
+    // Write the barcode map.
+    writer.write(static_cast<std::uint8_t>(barcode_map != nullptr));
+    if (barcode_map != nullptr) {
+        std::vector<std::uint64_t> sources, barcodes;
+        sources.reserve(barcode_map->size());
+        barcodes.reserve(barcode_map->size());
+        for (const auto& [source, barcode] : *barcode_map) {
+            sources.push_back(source);
+            barcodes.push_back(barcode.value());
+        }
+        writer.write(sources);
+        writer.write(barcodes);
+    }
+
+    writer.save(filename);
+}
+
+std::optional<digitization_config> read_digitization_snapshot(
+    std::string_view filename) {
+
+    std::optional<std::string> data = read_file(filename);
+    if (!data) {
+        return {};
+    }
+    snapshot_reader reader(std::move(*data));
+
+    std::uint64_t n_modules = 0u;
+    reader.read(n_modules);
+    if (!reader.good()) {
+        return {};
+    }
+    std::vector<std::pair<Acts::GeometryIdentifier, module_digitization_config>>
+        elements;
+    for (std::uint64_t i = 0u; (i < n_modules) && reader.good(); ++i) {
+
+        std::uint64_t id = 0u;
+        reader.read(id);
+
+        // The transform of the segmentation.
+        Acts::Transform3 transform = Acts::Transform3::Identity();
+        std::vector<Acts::ActsScalar> matrix;
+        reader.read(matrix);
+        if (!reader.good() ||
+            (matrix.size() !=
+             static_cast<std::size_t>(transform.matrix().size()))) {
+            return {};
+        }
+        std::copy(matrix.begin(), matrix.end(), transform.data());
+        Acts::BinUtility segmentation(transform);
+
+        // The binning data of the segmentation.
+        std::uint32_t n_binnings = 0u;
+        reader.read(n_binnings);
+        for (std::uint32_t j = 0u; (j < n_binnings) && reader.good(); ++j) {
+            std::uint32_t type = 0u, option = 0u, value = 0u, bins = 0u;
+            float min = 0.f, max = 0.f;
+            std::vector<float> boundaries;
+            reader.read(type);
+            reader.read(option);
+            reader.read(value);
+            reader.read(bins);
+            reader.read(min);
+            reader.read(max);
+            reader.read(boundaries);
+            if (!reader.good()) {
+                return {};
+            }
+            if (static_cast<Acts::BinningType>(type) == Acts::equidistant) {
+                segmentation += Acts::BinUtility(Acts::BinningData(
+                    static_cast<Acts::BinningOption>(option),
+                    static_cast<Acts::BinningValue>(value), bins, min, max));
+            } else {
+                segmentation += Acts::BinUtility(Acts::BinningData(
+                    static_cast<Acts::BinningOption>(option),
+                    static_cast<Acts::BinningValue>(value), boundaries));
+            }
+        }
+        elements.emplace_back(Acts::GeometryIdentifier{id},
+                              module_digitization_config{segmentation});
+    }
+    if (!reader.done()) {
+        return {};
+    }
+
+    return digitization_config{std::move(elements)};
+}
+
+void write_digitization_snapshot(std::string_view filename,
+                                 const digitization_config& config) {
+
+    snapshot_writer writer;
+    writer.write(static_cast<std::uint64_t>(config.size()));
+    for (std::size_t i = 0; i < config.size(); ++i) {
+
+        writer.write(static_cast<std::uint64_t>(config.idAt(i).value()));
+
+        // The transform of the segmentation.
+        const Acts::BinUtility& segmentation = config.valueAt(i).segmentation;
+        const Acts::Transform3& transform = segmentation.transform();
+        writer.write(std::vector<Acts::ActsScalar>(
+            transform.data(), transform.data() + transform.matrix().size()));
+
+        // The binning data of the segmentation.
+        const std::vector<Acts::BinningData>& binnings =
+            segmentation.binningData();
+        writer.write(static_cast<std::uint32_t>(binnings.size()));
+        for (const Acts::BinningData& binning : binnings) {
+            // Sub-binnings are not used by traccc, and are not supported.
+            if (binning.subBinningData) {
+                return;
+            }
+            writer.write(static_cast<std::uint32_t>(binning.type));
+            writer.write(static_cast<std::uint32_t>(binning.option));
+            writer.write(static_cast<std::uint32_t>(binning.binvalue));
+            writer.write(static_cast<std::uint32_t>(binning.bins()));
+            writer.write(binning.min);
+            writer.write(binning.max);
+            writer.write((binning.type == Acts::arbitrary)
+                             ? binning.boundaries()
+                             : std::vector<float>{});
+        }
+    }
+
+    writer.save(filename);
+}
+
+}  // namespace traccc::io::details
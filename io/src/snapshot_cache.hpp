@@ -0,0 +1,90 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s).
+#include "traccc/geometry/geometry.hpp"
+#include "traccc/io/data_format.hpp"
+#include "traccc/io/digitization_config.hpp"
+
+// Detray include(s).
+#include <detray/geometry/barcode.hpp>
+
+// System include(s).
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <utility>
+
+namespace traccc::io::details {
+
+/// Map from Acts surface identifiers to Detray barcodes
+using barcode_map_type = std::map<std::uint64_t, detray::geometry::barcode>;
+
+/// The objects stored in a geometry snapshot
+using geometry_snapshot =
+    std::pair<geometry, std::unique_ptr<barcode_map_type>>;
+
+/// Name of the snapshot file belonging to an input file
+///
+/// The name is built from a hash of the contents of the input file, its
+/// format and the kind of the snapshot. So a modified input file never picks
+/// up an outdated snapshot.
+///
+/// @param cache_directory The directory holding the snapshots
+/// @param kind            The kind of object stored in the snapshot
+/// @param filename        The full name of the input file
+/// @param format          The format of the input file
+/// @return The full name of the snapshot file
+///
+std::string snapshot_filename(std::string_view cache_directory,
+                              std::string_view kind, std::string_view filename,
+                              data_format format);
+
+/// Read a geometry snapshot
+///
+/// @param filename The full name of the snapshot file
+/// @return The geometry and barcode map, if a valid snapshot was found
+///
+std::optional<geometry_snapshot> read_geometry_snapshot(
+    std::string_view filename);
+
+/// Write a geometry snapshot
+///
+/// Failures are silently ignored, the cache being just an optimisation.
+///
+/// @param filename    The full name of the snapshot file
+/// @param geom        The geometry to store
+/// @param barcode_map The barcode map to store (may be @c nullptr)
+///
+void write_geometry_snapshot(std::string_view filename, const geometry& geom,
+                             const barcode_map_type* barcode_map);
+
+/// Read a digitization configuration snapshot
+///
+/// @param filename The full name of the snapshot file
+/// @return The digitization configuration, if a valid snapshot was found
+///
+std::optional<digitization_config> read_digitization_snapshot(
+    std::string_view filename);
+
+/// Write a digitization configuration snapshot
+///
+/// Failures, and configurations that can not be represented (e.g. using
+/// sub-binnings), are silently ignored.
+///
+/// @param filename The full name of the snapshot file
+/// @param config   The digitization configuration to store
+///
+void write_digitization_snapshot(std::string_view filename,
+                                 const digitization_config& config);
+
+}  // namespace traccc::io::details
@@ -1,6 +1,6 @@
 /** TRACCC library, part of the ACTS project (R&D line)
  *
- * (c) 2022 CERN for the benefit of the ACTS project
+ * (c) 2022-2024 CERN for the benefit of the ACTS project
  *
  * Mozilla Public License Version 2.0
  */
@@ -8,8 +8,38 @@
 // Local include(s).
 #include "traccc/io/write.hpp"
 
+#include "compressed_cells.hpp"
+#include "packed_file_format.hpp"
 #include "traccc/io/utils.hpp"
 #include "write_binary.hpp"
+#include "write_mapped.hpp"
+
+// System include(s).
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+#include <vector>
+
+namespace {
+
+/// Round an offset up to the alignment of the packed file payloads
+std::uint64_t packed_file_align(std::uint64_t offset) {
+
+    return (offset + traccc::io::details::packed_file_alignment - 1) /
+           traccc::io::details::packed_file_alignment *
+           traccc::io::details::packed_file_alignment;
+}
+
+/// Write padding bytes up to a given offset of a file
+void pad_to(std::ofstream& out_file, std::uint64_t offset) {
+
+    static const char padding[traccc::io::details::packed_file_alignment] =
+        {};
+    out_file.write(padding,
+                   offset - static_cast<std::uint64_t>(out_file.tellp()));
+}
+
+}  // namespace
 
 namespace traccc::io {
 
@@ -29,6 +59,20 @@ void write(std::size_t event, std::string_view directory,
                     get_event_filename(event, "-modules.dat"),
                 traccc::cell_module_collection_types::const_device{modules});
             break;
+        case data_format::compressed:
+            details::write_compressed_cells(
+                data_directory() + directory.data() +
+                    get_event_filename(event, "-cells.zdat"),
+                traccc::cell_collection_types::const_device{cells},
+                traccc::cell_module_collection_types::const_device{modules});
+            break;
+        case data_format::mapped:
+            details::write_mapped_file(
+                data_directory() + directory.data() +
+                    get_event_filename(event, "-cells.map"),
+                traccc::cell_collection_types::const_device{cells},
+                traccc::cell_module_collection_types::const_device{modules});
+            break;
         default:
             throw std::invalid_argument("Unsupported data format");
     }
@@ -50,6 +94,13 @@ void write(std::size_t event, std::string_view directory,
                     get_event_filename(event, "-modules.dat"),
                 traccc::cell_module_collection_types::const_device{modules});
             break;
+        case data_format::mapped:
+            details::write_mapped_file(
+                data_directory() + directory.data() +
+                    get_event_filename(event, "-hits.map"),
+                traccc::spacepoint_collection_types::const_device{spacepoints},
+                traccc::cell_module_collection_types::const_device{modules});
+            break;
         default:
             throw std::invalid_argument("Unsupported data format");
     }
@@ -72,9 +123,88 @@ void write(std::size_t event, std::string_view directory,
                     get_event_filename(event, "-modules.dat"),
                 traccc::cell_module_collection_types::const_device{modules});
             break;
+        case data_format::mapped:
+            details::write_mapped_file(
+                data_directory() + directory.data() +
+                    get_event_filename(event, "-measurements.map"),
+                traccc::measurement_collection_types::const_device{
+                    measurements},
+                traccc::cell_module_collection_types::const_device{modules});
+            break;
         default:
             throw std::invalid_argument("Unsupported data format");
     }
 }
 
+void write(std::string_view measurements_file, std::string_view modules_file,
+           traccc::data_format format,
+           measurement_collection_types::const_view measurements,
+           traccc::cell_module_collection_types::const_view modules) {
+
+    if (format != data_format::binary) {
+        throw std::invalid_argument("Unsupported data format");
+    }
+    details::write_binary_collection(
+        measurements_file,
+        traccc::measurement_collection_types::const_device{measurements});
+    details::write_binary_collection(
+        modules_file,
+        traccc::cell_module_collection_types::const_device{modules});
+}
+
+void write(std::string_view directory, traccc::data_format format,
+           const demonstrator_input& events) {
+
+    if (format != data_format::packed) {
+        throw std::invalid_argument("Unsupported data format");
+    }
+
+    // Lay out the events in the file.
+    std::vector<details::packed_file_event> index(events.size());
+    std::uint64_t offset =
+        sizeof(details::packed_file_header) +
+        events.size() * sizeof(details::packed_file_event);
+    for (std::size_t i = 0; i < events.size(); ++i) {
+        index[i].cells_offset = packed_file_align(offset);
+        index[i].n_cells = events[i].cells.size();
+        offset = index[i].cells_offset + index[i].n_cells * sizeof(cell);
+        index[i].modules_offset = packed_file_align(offset);
+        index[i].n_modules = events[i].modules.size();
+        offset =
+            index[i].modules_offset + index[i].n_modules * sizeof(cell_module);
+    }
+
+    // Open the output file.
+    const std::string filename = data_directory() + directory.data() +
+                                 details::packed_cells_filename;
+    std::ofstream out_file(filename, std::ios::binary);
+    if (!out_file) {
+        throw std::runtime_error("Could not open file: " + filename);
+    }
+
+    // Write the header and the index.
+    details::packed_file_header header;
+    std::memcpy(header.magic, details::packed_file_magic,
+                sizeof(details::packed_file_magic));
+    header.version = details::packed_file_version;
+    header.cell_size = sizeof(cell);
+    header.module_size = sizeof(cell_module);
+    header.padding = 0;
+    header.n_events = events.size();
+    out_file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    out_file.write(reinterpret_cast<const char*>(index.data()),
+                   index.size() * sizeof(details::packed_file_event));
+
+    // Write the payload of the events.
+    for (std::size_t i = 0; i < events.size(); ++i) {
+        pad_to(out_file, index[i].cells_offset);
+        out_file.write(reinterpret_cast<const char*>(events[i].cells.data()),
+                       index[i].n_cells * sizeof(cell));
+        pad_to(out_file, index[i].modules_offset);
+        out_file.write(
+            reinterpret_cast<const char*>(events[i].modules.data()),
+            index[i].n_modules * sizeof(cell_module));
+    }
+}
+
 }  // namespace traccc::io
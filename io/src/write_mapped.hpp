@@ -0,0 +1,92 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Local include(s).
+#include "mapped_file_format.hpp"
+#include "traccc/io/mapped_file.hpp"
+
+// System include(s).
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+namespace traccc::io::details {
+
+/// Function for writing collections into a @c traccc::data_format::mapped
+/// file
+///
+/// @param filename is the output filename which includes the path
+/// @param collections are the traccc collections to write, one per section
+///
+template <typename... collection_ts>
+void write_mapped_file(std::string_view filename,
+                       const collection_ts&... collections) {
+
+    // Make sure that the chosen types work.
+    static_assert(
+        (std::is_standard_layout_v<typename collection_ts::value_type> && ...),
+        "Collection item types must have standard layout.");
+
+    // Lay out the sections of the file.
+    constexpr std::size_t n_sections = sizeof...(collection_ts);
+    std::array<mapped_file_section, n_sections> sections;
+    std::uint64_t offset = sizeof(mapped_file_header) +
+                           n_sections * sizeof(mapped_file_section);
+    std::size_t i = 0;
+    (
+        [&]() {
+            offset = (offset + mapped_file::alignment - 1) /
+                     mapped_file::alignment * mapped_file::alignment;
+            sections[i].offset = offset;
+            sections[i].size = collections.size();
+            sections[i].element_size =
+                sizeof(typename collection_ts::value_type);
+            offset += sections[i].size * sections[i].element_size;
+            ++i;
+        }(),
+        ...);
+
+    // Open the output file.
+    std::ofstream out_file(filename.data(), std::ios::binary);
+    if (!out_file) {
+        throw std::runtime_error("Could not open file: " +
+                                 std::string(filename));
+    }
+
+    // Write the header and the table of sections.
+    mapped_file_header header;
+    std::memcpy(header.magic, mapped_file_magic, sizeof(mapped_file_magic));
+    header.version = mapped_file::version;
+    header.n_sections = static_cast<std::uint32_t>(n_sections);
+    out_file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    out_file.write(reinterpret_cast<const char*>(sections.data()),
+                   n_sections * sizeof(mapped_file_section));
+
+    // Write the payload of the sections, with the padding in front of them.
+    const char padding[mapped_file::alignment] = {};
+    i = 0;
+    (
+        [&]() {
+            out_file.write(padding, sections[i].offset -
+                                        static_cast<std::uint64_t>(
+                                            out_file.tellp()));
+            out_file.write(
+                reinterpret_cast<const char*>(collections.data()),
+                sections[i].size * sections[i].element_size);
+            ++i;
+        }(),
+        ...);
+}
+
+}  // namespace traccc::io::details
@@ -1,6 +1,6 @@
 /** TRACCC library, part of the ACTS project (R&D line)
  *
- * (c) 2023 CERN for the benefit of the ACTS project
+ * (c) 2023-2024 CERN for the benefit of the ACTS project
  *
  * Mozilla Public License Version 2.0
  */
@@ -13,9 +13,11 @@
 // Project include(s).
 #include "traccc/edm/track_candidate.hpp"
 #include "traccc/edm/track_state.hpp"
+#include "traccc/edm/truth_match.hpp"
 #include "traccc/io/event_map2.hpp"
 
 // System include(s).
+#include <cstdint>
 #include <map>
 #include <memory>
 #include <string>
@@ -62,6 +64,10 @@ class finding_performance_writer {
     /// Destructor
     ~finding_performance_writer();
 
+    /// Fill the plots with the results of one event
+    ///
+    /// The function may be called concurrently from multiple threads, with
+    /// every thread filling its own copy of the plots.
     void write(const track_candidate_container_types::const_view&
                    track_candidates_view,
                const event_map2& evt_map);
@@ -69,6 +75,17 @@ class finding_performance_writer {
     void write(const track_state_container_types::const_view& track_states_view,
                const event_map2& evt_map);
 
+    /// Fill the plots with the truth matches of the tracks of one event
+    ///
+    /// For tracks that were matched to the particles already, for instance
+    /// on a device by @c traccc::cuda::truth_matching_algorithm.
+    void write(
+        const track_truth_match_collection_types::const_view& matches_view,
+        const event_map2& evt_map);
+
+    /// Merge the plots of all threads, and write them into the output file
+    ///
+    /// Without ROOT, the plots are written into a CSV file instead.
     void finalize();
 
     private:
@@ -82,6 +99,10 @@ class finding_performance_writer {
     void write_common(const std::vector<std::vector<measurement>>& tracks,
                       const event_map2& evt_map);
 
+    /// Fill the plots from the number of tracks matched to every particle
+    void fill_plots(const std::map<std::uint64_t, std::size_t>& match_counter,
+                    const event_map2& evt_map);
+
 };  // class finding_performance_writer
 
 }  // namespace traccc
@@ -1,6 +1,6 @@
 /** TRACCC library, part of the ACTS project (R&D line)
  *
- * (c) 2022-2023 CERN for the benefit of the ACTS project
+ * (c) 2022-2024 CERN for the benefit of the ACTS project
  *
  * Mozilla Public License Version 2.0
  */
@@ -41,6 +41,10 @@ class seeding_performance_writer {
         std::string file_path = "performance_track_seeding.root";
         /// Output file mode
         std::string file_mode = "RECREATE";
+        /// Name of the seed collection, used for naming the plots. Allows
+        /// writing the plots of different (e.g. selected) seed collections
+        /// into the same file.
+        std::string name = "seeding";
 
         /// Plot tool configurations.
         std::map<std::string, plot_helpers::binning> var_binning = {
@@ -61,6 +65,10 @@ class seeding_performance_writer {
     /// Destructor
     ~seeding_performance_writer();
 
+    /// Fill the plots with the results of one event
+    ///
+    /// The function may be called concurrently from multiple threads, with
+    /// every thread filling its own copy of the plots.
     void write(const seed_collection_types::const_view& seeds_view,
                const spacepoint_collection_types::const_view& spacepoints_view,
                const event_map& evt_map);
@@ -69,6 +77,9 @@ class seeding_performance_writer {
                const spacepoint_collection_types::const_view& spacepoints_view,
                const event_map2& evt_map);
 
+    /// Merge the plots of all threads, and write them into the output file
+    ///
+    /// Without ROOT, the plots are written into a CSV file instead.
     void finalize();
 
     private:
@@ -0,0 +1,72 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Local include(s).
+#include "traccc/performance/timing_info.hpp"
+#include "traccc/performance/timing_registry.hpp"
+
+// Project include(s).
+#include "traccc/utils/instrumented_memory_resource.hpp"
+
+// System include(s).
+#include <cstddef>
+#include <iosfwd>
+#include <string>
+#include <vector>
+
+namespace traccc::performance {
+
+/// Throughput of one (logical) device during a throughput measurement
+struct device_throughput {
+
+    /// The description of the device (if known)
+    std::string description;
+    /// The number of events processed on the device
+    std::size_t processed_events = 0;
+    /// The throughput of the device, in events per second
+    double events_per_second = 0.;
+
+};  // struct device_throughput
+
+/// Summary of one throughput measurement
+///
+/// Collects the results that the throughput applications print, in a form
+/// that measurements made with different backends can be tabulated and
+/// compared with.
+///
+struct benchmark_summary {
+
+    /// The application (backend) that made the measurement
+    std::string application;
+    /// The input (data set) that the measurement was made with
+    std::string input;
+    /// The number of events processed in the measurement
+    std::size_t processed_events = 0;
+    /// The number of track parameters reconstructed during the measurement
+    std::size_t reconstructed_track_params = 0;
+    /// The throughput of the event processing, in events per second
+    double events_per_second = 0.;
+    /// The total times of the steps of the application
+    timing_info times;
+    /// The latencies of the scopes timed for every event (if any)
+    std::vector<timing_statistics> latencies;
+    /// The host memory used by the (most demanding) algorithm instance
+    memory_statistics host_memory;
+    /// The device memory used by the (most demanding) algorithm instance
+    memory_statistics device_memory;
+    /// The throughput of the individual devices, if the events were
+    /// scheduled between (logical) devices
+    std::vector<device_throughput> devices;
+
+};  // struct benchmark_summary
+
+/// Write the summary of a throughput measurement in JSON format
+void write_json(std::ostream& out, const benchmark_summary& summary);
+
+}  // namespace traccc::performance
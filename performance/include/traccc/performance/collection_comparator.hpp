@@ -1,6 +1,6 @@
 /** TRACCC library, part of the ACTS project (R&D line)
  *
- * (c) 2022 CERN for the benefit of the ACTS project
+ * (c) 2022-2024 CERN for the benefit of the ACTS project
  *
  * Mozilla Public License Version 2.0
  */
@@ -9,6 +9,7 @@
 
 // Library include(s).
 #include "traccc/performance/details/comparator_factory.hpp"
+#include "traccc/performance/details/comparison_key.hpp"
 
 // Project include(s).
 #include "traccc/definitions/common.hpp"
@@ -16,6 +17,7 @@
 #include "traccc/edm/container.hpp"
 
 // System include(s).
+#include <cstddef>
 #include <functional>
 #include <iostream>
 #include <string>
@@ -30,6 +32,12 @@ namespace traccc {
 /// the results made on the host and on a device. Though the code actually
 /// allows comparisons between any two containers.
 ///
+/// For types with a @c traccc::details::comparison_key, the elements of the
+/// RHS collection are put into buckets, and every LHS element is only
+/// compared to the elements of its neighbouring buckets. For other types
+/// every LHS element is compared to every RHS element. The matching rates
+/// at the different uncertainties are evaluated in parallel.
+///
 /// @tparam TYPE The type in the collection
 ///
 template <typename TYPE>
@@ -51,6 +59,12 @@ class collection_comparator {
         const typename collection_types<TYPE>::const_view& rhs) const;
 
     private:
+    /// Count the LHS elements that have an equivalent RHS element
+    std::size_t count_matches(
+        const typename collection_types<TYPE>::const_device& lhs,
+        const typename collection_types<TYPE>::const_device& rhs,
+        scalar uncertainty) const;
+
     /// Container type name to print
     std::string m_type_name;
     /// Type of the "Left Hand Side" collection
@@ -0,0 +1,98 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s).
+#include "traccc/definitions/primitives.hpp"
+#include "traccc/edm/measurement.hpp"
+#include "traccc/edm/seed.hpp"
+#include "traccc/edm/spacepoint.hpp"
+#include "traccc/edm/track_parameters.hpp"
+
+// System include(s).
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <utility>
+
+namespace traccc::details {
+
+/// Key used for finding the candidates of a match quickly
+///
+/// For types that specialise this trait, @c traccc::collection_comparator
+/// puts the objects into buckets based on an identifier and a scalar value,
+/// and only compares objects in neighbouring buckets with each other.
+///
+/// For this to give the same results as a comparison with every object,
+/// @c traccc::details::is_same_object for the type must only accept objects
+/// with the same identifier, whose values are the same according to
+/// @c traccc::details::is_same_scalar.
+///
+/// @tparam TYPE The type to provide the key for
+///
+template <typename TYPE>
+struct comparison_key {
+    /// No key is available by default
+    static constexpr bool available = false;
+};
+
+/// @c traccc::details::comparison_key specialisation for
+/// @c traccc::measurement
+template <>
+struct comparison_key<measurement> {
+    static constexpr bool available = true;
+    static std::uint64_t id(const measurement& obj) { return obj.module_link; }
+    static scalar value(const measurement& obj) { return obj.local[0]; }
+};
+
+/// @c traccc::details::comparison_key specialisation for
+/// @c traccc::spacepoint
+template <>
+struct comparison_key<spacepoint> {
+    static constexpr bool available = true;
+    static std::uint64_t id(const spacepoint& obj) {
+        return obj.meas.module_link;
+    }
+    static scalar value(const spacepoint& obj) { return obj.meas.local[0]; }
+};
+
+/// @c traccc::details::comparison_key specialisation for @c traccc::seed
+template <>
+struct comparison_key<seed> {
+    static constexpr bool available = true;
+    static std::uint64_t id(const seed&) { return 0u; }
+    static scalar value(const seed& obj) { return obj.z_vertex; }
+};
+
+/// @c traccc::details::comparison_key specialisation for
+/// @c traccc::bound_track_parameters
+template <>
+struct comparison_key<bound_track_parameters> {
+    static constexpr bool available = true;
+    static std::uint64_t id(const bound_track_parameters& obj) {
+        return obj.surface_link().value();
+    }
+    static scalar value(const bound_track_parameters& obj) {
+        return obj.bound_local()[0];
+    }
+};
+
+/// Identifier of a bucket of objects: the object identifier and the bucket
+/// index of the object's value
+using comparison_bucket = std::pair<std::uint64_t, std::int64_t>;
+
+/// Hash function for @c traccc::details::comparison_bucket
+struct comparison_bucket_hash {
+    std::size_t operator()(const comparison_bucket& bucket) const {
+        const std::size_t h1 = std::hash<std::uint64_t>{}(bucket.first);
+        const std::size_t h2 = std::hash<std::int64_t>{}(bucket.second);
+        return h1 ^ (h2 + 0x9e3779b9 + (h1 << 6) + (h1 >> 2));
+    }
+};
+
+}  // namespace traccc::details
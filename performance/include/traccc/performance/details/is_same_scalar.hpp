@@ -1,6 +1,6 @@
 /** TRACCC library, part of the ACTS project (R&D line)
  *
- * (c) 2022 CERN for the benefit of the ACTS project
+ * (c) 2022-2024 CERN for the benefit of the ACTS project
  *
  * Mozilla Public License Version 2.0
  */
@@ -11,6 +11,10 @@
 #include "traccc/definitions/common.hpp"
 #include "traccc/definitions/primitives.hpp"
 
+// System include(s).
+#include <cstdint>
+#include <optional>
+
 namespace traccc::details {
 
 /// Comparison of scalars, used in algorithmic code validation
@@ -26,4 +30,18 @@ namespace traccc::details {
 ///
 bool is_same_scalar(scalar lhs, scalar rhs, scalar unc = float_epsilon);
 
+/// Bucket of a scalar, used for finding "the same" scalars quickly
+///
+/// The buckets are logarithmic, with signed indices. So that any two values
+/// accepted by @c traccc::details::is_same_scalar with the same uncertainty
+/// would end up in the same, or in neighbouring buckets.
+///
+/// @param value The value to find the bucket of
+/// @param unc The uncertainty percentage expressed in the 0.0-1.0 range
+/// @return The index of the bucket of the value, or an empty optional if the
+///         value could not be "the same" as any other value
+///
+std::optional<std::int64_t> scalar_bucket(scalar value,
+                                          scalar unc = float_epsilon);
+
 }  // namespace traccc::details
@@ -0,0 +1,125 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// System include(s).
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <iosfwd>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace traccc::performance {
+
+namespace details {
+/// Interface of the energy counters of the individual devices
+class energy_counter;
+}  // namespace details
+
+/// Energy used by one device
+struct energy_reading {
+
+    /// The name of the device
+    std::string device;
+    /// The energy used by the device, in joules
+    double joules = 0.;
+    /// The duration of the measurement
+    std::chrono::nanoseconds duration{0};
+
+};  // struct energy_reading
+
+/// Meter of the energy used by the devices of the host
+///
+/// It samples all energy counters that are available at runtime, and that the
+/// project was built with support for:
+///   - The RAPL counters of the CPU packages, through the Linux powercap
+///     interface;
+///   - The counters of NVIDIA GPUs, through NVML;
+///   - The counters of Intel GPUs, through Level Zero Sysman.
+///
+/// The counters are sampled periodically on a background thread while the
+/// meter is running, so that the wrap-arounds of the counters would be
+/// accounted for.
+///
+class energy_meter {
+
+    public:
+    /// Constructor, finding the available energy counters
+    ///
+    /// @param interval The interval of the sampling of the counters
+    ///
+    explicit energy_meter(
+        std::chrono::milliseconds interval = std::chrono::milliseconds{100});
+    /// Destructor
+    ~energy_meter();
+
+    /// Check whether any energy counters are available
+    bool empty() const;
+
+    /// Start integrating the energy used, from zero
+    void start();
+    /// Stop integrating the energy used
+    void stop();
+
+    /// Get the energy used by each device, between the last @c start() and
+    /// @c stop() calls
+    std::vector<energy_reading> readings() const;
+
+    private:
+    /// Sample all counters, accumulating their increments
+    void sample();
+
+    /// The interval of the sampling
+    std::chrono::milliseconds m_interval;
+    /// The available energy counters
+    std::vector<std::unique_ptr<details::energy_counter> > m_counters;
+    /// The last value read from each counter, in joules
+    std::vector<double> m_last;
+    /// The energy accumulated by each counter, in joules
+    std::vector<double> m_accumulated;
+    /// The time of the start of the measurement
+    std::chrono::steady_clock::time_point m_start;
+    /// The duration of the measurement
+    std::chrono::nanoseconds m_duration{0};
+
+    /// Mutex protecting the state of the meter
+    mutable std::mutex m_mutex;
+    /// Condition variable waking up the sampling thread
+    std::condition_variable m_cv;
+    /// Flag telling the sampling thread to stop
+    bool m_stop = false;
+    /// The sampling thread
+    std::thread m_thread;
+
+};  // class energy_meter
+
+/// Convenience type for printing energy efficiency information
+struct energy_efficiency {
+
+    /// Constructor with the number of events and the energy used
+    energy_efficiency(std::size_t events, const energy_reading& reading);
+
+    /// The name of the device
+    std::string m_device;
+    /// The energy used, in joules
+    double m_joules;
+    /// The average power, in watts
+    double m_watts;
+    /// The events per kilowatt-hour value
+    double m_perKWh;
+
+};  // struct energy_efficiency
+
+/// Printout operator
+std::ostream& operator<<(std::ostream& out, const energy_efficiency& eff);
+
+}  // namespace traccc::performance
@@ -0,0 +1,72 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// System include(s).
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+
+namespace traccc::performance {
+
+/// Values of the hardware performance counters of a CPU thread
+///
+/// Counters that are not available on the host (or to the user) stay at
+/// zero.
+///
+struct hardware_counter_values {
+
+    /// The number of CPU cycles
+    std::uint64_t cycles = 0;
+    /// The number of instructions retired
+    std::uint64_t instructions = 0;
+    /// The number of (last level) cache references
+    std::uint64_t cache_references = 0;
+    /// The number of (last level) cache misses
+    std::uint64_t cache_misses = 0;
+    /// The number of branch instructions retired
+    std::uint64_t branches = 0;
+    /// The number of mispredicted branches
+    std::uint64_t branch_misses = 0;
+
+    /// The number of measurements summed into the values
+    std::size_t measurements = 0;
+
+    /// Add the values of another measurement to these ones
+    hardware_counter_values& operator+=(const hardware_counter_values& other);
+
+    /// The instructions per cycle
+    double ipc() const;
+    /// The fraction of cache references that missed the cache
+    double cache_miss_rate() const;
+    /// The fraction of branches that were mispredicted
+    double branch_miss_rate() const;
+
+};  // struct hardware_counter_values
+
+/// Get the difference of two readings of the counters
+///
+/// @param end   The reading at the end of the measurement
+/// @param start The reading at the start of the measurement
+/// @return The counts of the measurement, as a single measurement
+///
+hardware_counter_values operator-(const hardware_counter_values& end,
+                                  const hardware_counter_values& start);
+
+/// Read the hardware performance counters of the calling thread
+///
+/// The counters are set up with @c perf_event_open on Linux, the first time
+/// a thread reads them, and only count the (user space) activity of that
+/// one thread. So work offloaded to other threads is not accounted for.
+///
+/// @return The current values of the counters, or nothing if no counters
+///         are available on the host (or are not accessible to the user)
+///
+std::optional<hardware_counter_values> read_hardware_counters();
+
+}  // namespace traccc::performance
@@ -1,6 +1,6 @@
 /** TRACCC library, part of the ACTS project (R&D line)
  *
- * (c) 2022 CERN for the benefit of the ACTS project
+ * (c) 2022-2024 CERN for the benefit of the ACTS project
  *
  * Mozilla Public License Version 2.0
  */
@@ -8,7 +8,9 @@
 #pragma once
 
 // Library include(s).
+#include "traccc/performance/details/comparison_key.hpp"
 #include "traccc/performance/details/is_same_object.hpp"
+#include "traccc/performance/details/is_same_scalar.hpp"
 
 // Project include(s).
 #include "traccc/definitions/common.hpp"
@@ -20,8 +22,11 @@
 #include <cassert>
 #include <cmath>
 #include <functional>
+#include <future>
 #include <iostream>
+#include <optional>
 #include <string_view>
+#include <unordered_map>
 #include <vector>
 
 namespace traccc {
@@ -52,24 +57,21 @@ void collection_comparator<TYPE>::operator()(
                 << " (" << m_lhs_type << "), " << rhs_coll.size() << " ("
                 << m_rhs_type << ")\n";
 
-    // Calculate the agreements at various uncertainties.
+    // Count the matches at the various uncertainties in parallel.
+    std::vector<std::future<std::size_t>> matches;
+    matches.reserve(m_uncertainties.size());
+    for (scalar uncertainty : m_uncertainties) {
+        matches.push_back(std::async(std::launch::async, [&, uncertainty]() {
+            return count_matches(lhs_coll, rhs_coll, uncertainty);
+        }));
+    }
+
+    // Calculate the agreements at the various uncertainties.
     std::vector<scalar> agreements;
     agreements.reserve(m_uncertainties.size());
-    for (scalar uncertainty : m_uncertainties) {
-        // The number of matched items between the containers.
-        std::size_t matched = 0;
-        // Iterate over all elements of the LHS collection.
-        for (const TYPE& obj : lhs_coll) {
-            // Check if there's an equivalent element in the RHS collection.
-            if (std::find_if(rhs_coll.begin(), rhs_coll.end(),
-                             m_comp_factory.make_comparator(
-                                 obj, uncertainty)) != rhs_coll.end()) {
-                ++matched;
-            }
-        }
-        // Calculate the agreement value.
+    for (std::future<std::size_t>& matched : matches) {
         agreements.push_back(
-            static_cast<scalar>(matched) /
+            static_cast<scalar>(matched.get()) /
             static_cast<scalar>(std::max(lhs_coll.size(), rhs_coll.size())) *
             100.);
     }
@@ -84,4 +86,74 @@ void collection_comparator<TYPE>::operator()(
     m_out.get() << std::flush;
 }
 
+template <typename TYPE>
+std::size_t collection_comparator<TYPE>::count_matches(
+    const typename collection_types<TYPE>::const_device& lhs,
+    const typename collection_types<TYPE>::const_device& rhs,
+    scalar uncertainty) const {
+
+    // The number of matched items between the containers.
+    std::size_t matched = 0;
+
+    // Use buckets if it's possible for this type and uncertainty.
+    if constexpr (details::comparison_key<TYPE>::available) {
+        if ((uncertainty > 0.f) && (uncertainty < 2.f)) {
+
+            using key_type = details::comparison_key<TYPE>;
+
+            // Put the RHS elements into buckets.
+            std::unordered_map<details::comparison_bucket,
+                               std::vector<unsigned int>,
+                               details::comparison_bucket_hash>
+                buckets;
+            for (unsigned int i = 0; i < rhs.size(); ++i) {
+                const std::optional<std::int64_t> index =
+                    details::scalar_bucket(key_type::value(rhs[i]),
+                                           uncertainty);
+                if (index) {
+                    buckets[{key_type::id(rhs[i]), *index}].push_back(i);
+                }
+            }
+
+            // Look for an equivalent element for every LHS element, in its
+            // own and in the neighbouring buckets.
+            for (const TYPE& obj : lhs) {
+                const std::optional<std::int64_t> index =
+                    details::scalar_bucket(key_type::value(obj), uncertainty);
+                if (!index) {
+                    continue;
+                }
+                const auto comparator =
+                    m_comp_factory.make_comparator(obj, uncertainty);
+                bool found = false;
+                for (std::int64_t i = *index - 1; (i <= *index + 1) && !found;
+                     ++i) {
+                    auto it = buckets.find({key_type::id(obj), i});
+                    if (it == buckets.end()) {
+                        continue;
+                    }
+                    found = std::any_of(
+                        it->second.begin(), it->second.end(),
+                        [&](unsigned int j) { return comparator(rhs[j]); });
+                }
+                if (found) {
+                    ++matched;
+                }
+            }
+            return matched;
+        }
+    }
+
+    // Iterate over all elements of the LHS collection.
+    for (const TYPE& obj : lhs) {
+        // Check if there's an equivalent element in the RHS collection.
+        if (std::find_if(rhs.begin(), rhs.end(),
+                         m_comp_factory.make_comparator(obj, uncertainty)) !=
+            rhs.end()) {
+            ++matched;
+        }
+    }
+    return matched;
+}
+
 }  // namespace traccc
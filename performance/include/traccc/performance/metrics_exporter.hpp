@@ -0,0 +1,138 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Local include(s).
+#include "traccc/performance/timing_registry.hpp"
+
+// Project include(s).
+#include "traccc/utils/instrumented_memory_resource.hpp"
+
+// System include(s).
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+namespace traccc::performance {
+
+/// Periodic exporter of the metrics of a running job
+///
+/// Meant for monitoring long-running reconstruction jobs while they run. A
+/// background thread periodically collects the statistics of a timing
+/// registry, of some memory resources, and of any number of counters and
+/// gauges, and writes them into a file. The file is replaced atomically, so
+/// it can be scraped at any time. It is written in JSON format if its name
+/// ends in @c .json, and in the Prometheus text exposition format (as
+/// expected by the "textfile collector" of the node exporter) otherwise.
+///
+/// For every timed scope the number of measurements, their rate over the
+/// last interval, and the quantiles of all of them are exported. For every
+/// memory resource the current and the peak use, in total and per stage.
+///
+/// All sources must be added before the export is started, and must outlive
+/// the exporter. They are read concurrently with the job, so they all need
+/// to be thread-safe.
+///
+class metrics_exporter {
+
+    public:
+    /// Function providing the value of a counter or a gauge
+    using value_function = std::function<double()>;
+    /// Function providing the statistics of (a set of) memory resources
+    using memory_function = std::function<memory_statistics()>;
+
+    /// Constructor
+    ///
+    /// @param filename The name of the file to write the metrics into
+    /// @param interval The interval of writing the metrics
+    ///
+    explicit metrics_exporter(
+        std::string_view filename,
+        std::chrono::milliseconds interval = std::chrono::seconds{10});
+    /// Destructor, writing the final metrics of the job
+    ~metrics_exporter();
+
+    /// Copying is not allowed
+    metrics_exporter(const metrics_exporter&) = delete;
+    /// Copying is not allowed
+    metrics_exporter& operator=(const metrics_exporter&) = delete;
+
+    /// Export the statistics of the scopes timed with a registry
+    void add_timings(const timing_registry& registry);
+    /// Export (the statistics of) some memory resources
+    ///
+    /// @param name The name of the resource(s) in the metrics
+    /// @param func The function collecting the statistics
+    ///
+    void add_memory(std::string_view name, memory_function func);
+    /// Export a counter, which only ever increases
+    void add_counter(std::string_view name, std::string_view help,
+                     value_function func);
+    /// Export a gauge, which can go up and down
+    void add_gauge(std::string_view name, std::string_view help,
+                   value_function func);
+
+    /// Start the periodic export of the metrics
+    void start();
+    /// Write the current metrics right away
+    void write();
+
+    private:
+    /// A counter or a gauge
+    struct value_source {
+        /// The name of the value
+        std::string name;
+        /// Description of the value
+        std::string help;
+        /// The function providing the value
+        value_function func;
+        /// Whether the value is a counter
+        bool counter;
+    };
+
+    /// Write the metrics, with the mutex held
+    void write_locked();
+
+    /// The name of the file to write
+    std::string m_filename;
+    /// Whether the file is written in JSON format
+    bool m_json;
+    /// The interval of writing the metrics
+    std::chrono::milliseconds m_interval;
+
+    /// The timing registry to export, if any
+    const timing_registry* m_timings = nullptr;
+    /// The memory resources to export
+    std::vector<std::pair<std::string, memory_function>> m_memory;
+    /// The counters and gauges to export
+    std::vector<value_source> m_values;
+
+    /// The number of measurements of every scope at the previous export
+    std::map<std::string, std::size_t> m_last_counts;
+    /// The time of the previous export
+    std::chrono::steady_clock::time_point m_last_time;
+
+    /// Mutex protecting the state of the exporter
+    std::mutex m_mutex;
+    /// Condition variable waking up the export thread
+    std::condition_variable m_cv;
+    /// Flag telling the export thread to stop
+    bool m_stop = false;
+    /// The export thread
+    std::thread m_thread;
+
+};  // class metrics_exporter
+
+}  // namespace traccc::performance
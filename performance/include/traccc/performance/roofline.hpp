@@ -0,0 +1,75 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Local include(s).
+#include "traccc/performance/timing_info.hpp"
+
+// Project include(s).
+#include "traccc/utils/work_counter.hpp"
+
+// System include(s).
+#include <chrono>
+#include <iosfwd>
+#include <string>
+#include <vector>
+
+namespace traccc::performance {
+
+/// Roofline information of one processing stage
+struct roofline_entry {
+
+    /// The name of the stage
+    std::string stage;
+    /// The (analytic) estimate of the work done in the stage
+    work_estimate work;
+    /// The measured time of the stage
+    std::chrono::nanoseconds time{0};
+
+    /// The arithmetic intensity of the stage [FLOP/byte]
+    double intensity() const;
+    /// The achieved memory bandwidth [GB/s]
+    double bandwidth() const;
+    /// The achieved floating point throughput [GFLOP/s]
+    double gflops() const;
+
+};  // struct roofline_entry
+
+/// Roofline report of the processing stages run on one device
+///
+/// It is an extension of the @c traccc::performance::timing_info printout,
+/// combining the measured times of the stages with the work estimated for
+/// them by a @c traccc::work_counter.
+///
+struct roofline_report {
+
+    /// Construct the report from timing information and work estimates
+    ///
+    /// The stages are matched up by their names, i.e. the name of the
+    /// @c traccc::work_counter::scope of a stage has to be the same as the
+    /// name of its timer. Timers without any work estimated for them are
+    /// ignored.
+    ///
+    /// @param times The measured times of the stages
+    /// @param counter The work estimated for the stages
+    /// @param peaks The peak performance of the device
+    ///
+    roofline_report(const timing_info& times, const work_counter& counter,
+                    const device_peaks& peaks);
+
+    /// The peak performance of the device
+    device_peaks peaks;
+    /// The information of the individual stages
+    std::vector<roofline_entry> entries;
+
+};  // struct roofline_report
+
+/// Printout helper for @c traccc::performance::roofline_report
+std::ostream& operator<<(std::ostream& out, const roofline_report& report);
+
+}  // namespace traccc::performance
@@ -0,0 +1,59 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s).
+#include "traccc/performance/timing_registry.hpp"
+
+// System include(s).
+#include <chrono>
+#include <cstddef>
+#include <string_view>
+
+namespace traccc::performance {
+
+/// Object used for measuring the execution time of a (nested) scope
+///
+/// Start time measured at construction. End time at destruction. Timers
+/// created while another timer of the same registry is active on the same
+/// thread measure sub-scopes of that timer's scope. The name of the scope may
+/// itself also contain parent scope names, separated by '/'. This allows
+/// scopes timed on worker threads to appear under a scope that was timed on
+/// a different thread.
+///
+/// Unlike @c traccc::performance::timer, it can be used concurrently from
+/// any number of threads.
+///
+class scoped_timer {
+
+    public:
+    /// Start time measurement
+    /// @param name name of the measured scope, relative to the current one
+    /// @param registry the registry to record the measurement into
+    scoped_timer(std::string_view name, timing_registry& registry);
+
+    /// End time measurement
+    ~scoped_timer();
+
+    /// The timer can not be copied
+    scoped_timer(const scoped_timer&) = delete;
+    /// The timer can not be copied
+    scoped_timer& operator=(const scoped_timer&) = delete;
+
+    private:
+    /// The registry to record the measurement into
+    timing_registry& m_registry;
+
+    /// The length of the name of the (thread's) previous scope
+    std::size_t m_previous;
+
+    /// Start time (measured at construct time)
+    std::chrono::steady_clock::time_point m_start;
+};  // class scoped_timer
+
+}  // namespace traccc::performance
@@ -0,0 +1,128 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// System include(s).
+#include <cstddef>
+#include <iosfwd>
+#include <string>
+#include <vector>
+
+namespace traccc::performance {
+
+/// Configuration of one point of a throughput sweep
+struct sweep_configuration {
+
+    /// The number of processing threads
+    unsigned int threads = 1;
+    /// The number of algorithm instances per device (0: one per thread)
+    unsigned int streams_per_device = 0;
+    /// The average number of cells in a clusterization partition
+    unsigned int target_cells_per_partition = 1024;
+    /// The pileup of the (overlaid) events (0: the input events as they are)
+    unsigned int pileup = 0;
+
+    /// Check whether two configurations are the same
+    bool operator==(const sweep_configuration& other) const;
+
+};  // struct sweep_configuration
+
+/// Printout helper for @c traccc::performance::sweep_configuration
+std::ostream& operator<<(std::ostream& out, const sweep_configuration& config);
+
+/// Throughput measurements of one configuration
+struct sweep_point {
+
+    /// The measured configuration
+    sweep_configuration config;
+    /// The throughput of the individual repetitions, in events per second
+    std::vector<double> events_per_second;
+
+    /// The mean throughput of the repetitions
+    double mean() const;
+    /// The (sample) standard deviation of the throughput of the repetitions
+    double stddev() const;
+
+};  // struct sweep_point
+
+/// Results of a throughput sweep
+struct sweep_results {
+
+    /// The input (data set) that the sweep was made with
+    std::string input;
+    /// The number of events processed in every measurement
+    std::size_t processed_events = 0;
+    /// The measured configurations
+    std::vector<sweep_point> points;
+
+};  // struct sweep_results
+
+/// Printout helper for @c traccc::performance::sweep_results
+std::ostream& operator<<(std::ostream& out, const sweep_results& results);
+
+/// Write the results of a throughput sweep in JSON format
+void write_json(std::ostream& out, const sweep_results& results);
+
+/// Read the results of a throughput sweep, written by
+/// @c traccc::performance::write_json
+///
+/// @throws std::runtime_error If the input could not be interpreted
+///
+sweep_results read_sweep_results(std::istream& in);
+
+/// One-sided Welch's t-test of two sets of measurements
+///
+/// @param sample The measurements tested
+/// @param reference The measurements to compare to
+/// @return The p-value of the hypothesis that the mean of @c sample is not
+///         smaller than the mean of @c reference
+///
+double welch_t_test(const std::vector<double>& sample,
+                    const std::vector<double>& reference);
+
+/// Comparison of the throughput of one configuration with its baseline
+struct sweep_comparison {
+
+    /// The compared configuration
+    sweep_configuration config;
+    /// The mean throughput of the baseline, in events per second
+    double baseline = 0.;
+    /// The mean throughput of the new measurement, in events per second
+    double current = 0.;
+    /// The p-value of the throughput not having decreased
+    double p_value = 1.;
+    /// Whether the change qualifies as a regression
+    bool regression = false;
+
+    /// The relative change of the throughput
+    double relative_change() const;
+
+};  // struct sweep_comparison
+
+/// Compare the results of a throughput sweep with a baseline
+///
+/// A configuration is flagged as a regression if its throughput is
+/// (statistically) significantly lower than in the baseline, and the
+/// decrease is larger than the tolerance. Configurations not present in the
+/// baseline are not compared.
+///
+/// @param baseline The baseline results
+/// @param current The new results
+/// @param significance The p-value below which a decrease is significant
+/// @param tolerance The largest relative decrease that is not a regression
+/// @return The comparisons of all configurations present in both results
+///
+std::vector<sweep_comparison> compare(const sweep_results& baseline,
+                                      const sweep_results& current,
+                                      double significance, double tolerance);
+
+/// Printout helper for the result of @c traccc::performance::compare
+std::ostream& operator<<(std::ostream& out,
+                         const std::vector<sweep_comparison>& comparisons);
+
+}  // namespace traccc::performance
@@ -8,10 +8,12 @@
 #pragma once
 
 // Project include(s).
+#include "traccc/performance/hardware_counters.hpp"
 #include "traccc/performance/timing_info.hpp"
 
 // System include(s).
 #include <chrono>
+#include <optional>
 #include <string>
 #include <string_view>
 
@@ -22,6 +24,9 @@ namespace traccc::performance {
 /// Creating more than one start & stop of timer with the same timer_name &
 /// sharing timing info will lead to incrementing the total time for that name
 ///
+/// If the timing info asks for it, the hardware performance counters of the
+/// thread are read at the start and end of the measurement as well.
+///
 class timer {
 
     public:
@@ -36,6 +41,8 @@ class timer {
     private:
     /// Start time (measured at construct time)
     std::chrono::high_resolution_clock::time_point m_start;
+    /// Hardware counter values at the start (if measured)
+    std::optional<hardware_counter_values> m_start_counters;
 
     /// Name of measurement
     std::string m_name;
@@ -7,9 +7,13 @@
 
 #pragma once
 
+// Local include(s).
+#include "traccc/performance/hardware_counters.hpp"
+
 // System include(s).
 #include <chrono>
 #include <iosfwd>
+#include <string>
 #include <string_view>
 #include <utility>
 #include <vector>
@@ -18,6 +22,8 @@ namespace traccc::performance {
 
 /// Helper type used for timing information storage
 using timing_info_pair = std::pair<std::string, std::chrono::nanoseconds>;
+/// Helper type used for hardware counter information storage
+using counter_info_pair = std::pair<std::string, hardware_counter_values>;
 
 /// Struct for storing time measurements collected in timer class
 ///
@@ -26,6 +32,12 @@ struct timing_info {
     /// The low level data.
     std::vector<timing_info_pair> data;
 
+    /// Whether the timers should also read the hardware performance counters
+    /// (of their own thread)
+    bool measure_hardware_counters = false;
+    /// The hardware counter values of the timed components, if measured
+    std::vector<counter_info_pair> counters;
+
     /// Get the time taken by a given component
     ///
     /// @param timer_name The name of the component
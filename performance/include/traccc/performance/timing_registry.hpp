@@ -0,0 +1,163 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// System include(s).
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <iosfwd>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+namespace traccc::performance {
+
+/// Histogram of (latency) time measurements
+///
+/// The histogram uses logarithmic bins, with 32 bins per power of two. So
+/// the quantiles calculated from it have a relative uncertainty of at most
+/// about 3%.
+///
+class latency_histogram {
+
+    public:
+    /// Add a time measurement to the histogram
+    void add(std::chrono::nanoseconds time);
+    /// Add the contents of another histogram to this one
+    void merge(const latency_histogram& other);
+
+    /// The number of measurements in the histogram
+    std::size_t count() const { return m_count; }
+    /// The sum of all measurements
+    std::chrono::nanoseconds total() const { return m_total; }
+    /// The smallest measurement
+    std::chrono::nanoseconds min() const { return m_min; }
+    /// The largest measurement
+    std::chrono::nanoseconds max() const { return m_max; }
+    /// The mean of the measurements
+    std::chrono::nanoseconds mean() const;
+
+    /// Get (an approximation of) a quantile of the measurements
+    ///
+    /// @param q The quantile to get, in the [0, 1] range
+    /// @return The time that the given fraction of measurements did not
+    ///         exceed
+    ///
+    std::chrono::nanoseconds quantile(double q) const;
+
+    private:
+    /// Measurement counts per bin
+    std::vector<std::uint64_t> m_bins;
+    /// The number of measurements
+    std::size_t m_count = 0;
+    /// The sum of all measurements
+    std::chrono::nanoseconds m_total{0};
+    /// The smallest measurement
+    std::chrono::nanoseconds m_min{0};
+    /// The largest measurement
+    std::chrono::nanoseconds m_max{0};
+
+};  // class latency_histogram
+
+/// Summary of the time measurements of one (possibly nested) scope
+struct timing_statistics {
+
+    /// The full name of the scope, with its parent scopes separated by '/'
+    std::string name;
+    /// The nesting depth of the scope (0 for top level scopes)
+    std::size_t depth = 0;
+    /// The distribution of the time measurements of the scope
+    latency_histogram latencies;
+
+};  // struct timing_statistics
+
+/// Thread-safe registry of hierarchical time measurements
+///
+/// Time measurements are made with @c traccc::performance::scoped_timer.
+/// Every thread records its measurements into its own storage, which only
+/// gets merged with the "other threads'" on request. Every measurement
+/// (every timed scope) contributes one entry into the latency distribution
+/// of its scope, so scopes timed once per event provide per-event latency
+/// distributions.
+///
+class timing_registry {
+
+    public:
+    /// Constructor
+    timing_registry();
+    /// Destructor
+    ~timing_registry();
+
+    /// Record a time measurement
+    ///
+    /// @param name The full name of the measured scope
+    /// @param time The measured time
+    ///
+    void record(std::string_view name, std::chrono::nanoseconds time);
+
+    /// Get the merged statistics of all threads
+    ///
+    /// The scopes are returned in tree order, with child scopes following
+    /// their parents, and siblings appearing in the order in which they were
+    /// first measured.
+    ///
+    std::vector<timing_statistics> statistics() const;
+
+    /// Write the merged statistics of all threads in JSON format
+    void write_json(std::ostream& out) const;
+
+    /// @name Functions used by @c traccc::performance::scoped_timer
+    /// @{
+
+    /// Enter a (nested) scope on the current thread
+    ///
+    /// @param name The name of the scope, relative to the current one
+    /// @return The length of the name of the previous scope
+    ///
+    std::size_t enter_scope(std::string_view name);
+    /// Leave the current scope on the current thread, recording the time
+    /// spent in it
+    ///
+    /// @param previous The length of the name of the previous scope
+    /// @param time The time spent in the scope
+    ///
+    void leave_scope(std::size_t previous, std::chrono::nanoseconds time);
+
+    /// @}
+
+    private:
+    /// Time measurements of one thread
+    struct thread_data;
+
+    /// Get the time measurements of the current thread
+    thread_data& local();
+    /// Record a time measurement into the storage of the current thread
+    void record(thread_data& data, std::string_view name,
+                std::chrono::nanoseconds time);
+
+    /// Unique identifier of this registry
+    std::size_t m_id;
+    /// Counter for the order in which the scopes were first measured
+    std::atomic<std::size_t> m_next_sequence{0};
+    /// Mutex protecting the per-thread storage
+    mutable std::mutex m_mutex;
+    /// The time measurements of the individual threads
+    std::map<std::thread::id, std::unique_ptr<thread_data>> m_threads;
+
+};  // class timing_registry
+
+/// Printout helper for @c traccc::performance::timing_registry
+std::ostream& operator<<(std::ostream& out, const timing_registry& registry);
+
+}  // namespace traccc::performance
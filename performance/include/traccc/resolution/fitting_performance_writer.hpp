@@ -1,6 +1,6 @@
 /** TRACCC library, part of the ACTS project (R&D line)
  *
- * (c) 2022 CERN for the benefit of the ACTS project
+ * (c) 2022-2024 CERN for the benefit of the ACTS project
  *
  * Mozilla Public License Version 2.0
  */
@@ -51,6 +51,9 @@ class fitting_performance_writer {
 
     /// Fill the tracking results into the histograms
     ///
+    /// The function may be called concurrently from multiple threads, with
+    /// every thread filling its own copy of the histograms.
+    ///
     /// @param track_states_per_track vector of track states of a track
     /// @param det detector object
     /// @param evt_map event map to find the truth values
@@ -101,7 +104,9 @@ class fitting_performance_writer {
         write_stat(fit_res, track_states_per_track);
     }
 
-    /// Writing caches into the file
+    /// Merge the plots of all threads, and write them into the output file
+    ///
+    /// Without ROOT, the plots are written into a CSV file instead.
     void finalize();
 
     private:
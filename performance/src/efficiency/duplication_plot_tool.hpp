@@ -1,6 +1,6 @@
 /** TRACCC library, part of the ACTS project (R&D line)
  *
- * (c) 2022-2023 CERN for the benefit of the ACTS project
+ * (c) 2022-2024 CERN for the benefit of the ACTS project
  *
  * Mozilla Public License Version 2.0
  */
@@ -9,11 +9,14 @@
 
 // Local include(s).
 #include "../utils/helpers.hpp"
+#include "../utils/light_plots.hpp"
 
 // Project include(s).
 #include "traccc/edm/particle.hpp"
 
 // System include(s).
+#include <ostream>
+#include <string>
 #include <string_view>
 
 namespace traccc {
@@ -51,7 +54,20 @@ class duplication_plot_tool {
             duplication_rate_vs_eta;  ///< Tracking duplication rate vs eta
         std::unique_ptr<TEfficiency>
             duplication_rate_vs_phi;  ///< Tracking duplication rate vs phi
-#endif                                // TRACCC_HAVE_ROOT
+#else
+        plot_helpers::light_profile
+            n_duplicated_vs_pT;  ///< Number of duplicated tracks vs pT
+        plot_helpers::light_profile
+            n_duplicated_vs_eta;  ///< Number of duplicated tracks vs eta
+        plot_helpers::light_profile
+            n_duplicated_vs_phi;  ///< Number of duplicated tracks vs phi
+        plot_helpers::light_efficiency
+            duplication_rate_vs_pT;  ///< Tracking duplication rate vs pT
+        plot_helpers::light_efficiency
+            duplication_rate_vs_eta;  ///< Tracking duplication rate vs eta
+        plot_helpers::light_efficiency
+            duplication_rate_vs_phi;  ///< Tracking duplication rate vs phi
+#endif  // TRACCC_HAVE_ROOT
     };
 
     /// Constructor
@@ -69,10 +85,6 @@ class duplication_plot_tool {
         plot_helpers::binning b_phi = m_cfg.var_binning.at("Phi");
         plot_helpers::binning b_num = m_cfg.var_binning.at("Num");
 
-        // Avoid unused variable warnings when building the code without ROOT.
-        (void)name;
-        (void)cache;
-
 #ifdef TRACCC_HAVE_ROOT
         // duplication rate vs pT
         cache.duplication_rate_vs_pT = plot_helpers::book_eff(
@@ -99,6 +111,20 @@ class duplication_plot_tool {
         cache.n_duplicated_vs_phi = plot_helpers::book_prof(
             TString(name) + "_nDuplicated_vs_phi",
             "Number of duplicated track candidates", b_phi, b_num);
+#else
+        // The y-axis range of the profiles is not enforced by the lightweight
+        // plots.
+        (void)b_num;
+        const std::string prefix(name);
+        cache.duplication_rate_vs_pT = {prefix + "_duplicationRate_vs_pT",
+                                        b_pt};
+        cache.duplication_rate_vs_eta = {prefix + "_duplicationRate_vs_eta",
+                                         b_eta};
+        cache.duplication_rate_vs_phi = {prefix + "_duplicationRate_vs_phi",
+                                         b_phi};
+        cache.n_duplicated_vs_pT = {prefix + "_nDuplicated_vs_pT", b_pt};
+        cache.n_duplicated_vs_eta = {prefix + "_nDuplicated_vs_eta", b_eta};
+        cache.n_duplicated_vs_phi = {prefix + "_nDuplicated_vs_phi", b_phi};
 #endif  // TRACCC_HAVE_ROOT
     }
 
@@ -114,37 +140,70 @@ class duplication_plot_tool {
         const auto t_pT =
             getter::perp(vector2{truth_particle.mom[0], truth_particle.mom[1]});
 
-        // Avoid unused variable warnings when building the code without ROOT.
-        (void)t_phi;
-        (void)t_eta;
-        (void)t_pT;
-        (void)cache;
-        (void)n_duplicated_tracks;
-
 #ifdef TRACCC_HAVE_ROOT
         cache.n_duplicated_vs_pT->Fill(t_pT, n_duplicated_tracks);
         cache.n_duplicated_vs_eta->Fill(t_eta, n_duplicated_tracks);
         cache.n_duplicated_vs_phi->Fill(t_phi, n_duplicated_tracks);
+#else
+        const auto n_duplicated = static_cast<float>(n_duplicated_tracks);
+        cache.n_duplicated_vs_pT.fill(t_pT, n_duplicated);
+        cache.n_duplicated_vs_eta.fill(t_eta, n_duplicated);
+        cache.n_duplicated_vs_phi.fill(t_phi, n_duplicated);
 #endif  // TRACCC_HAVE_ROOT
     }
 
+    /// @brief merge the contents of one cache into another
+    ///
+    /// @param target cache object receiving the contents
+    /// @param source cache object to add to @c target
+    void merge(duplication_plot_cache& target,
+               const duplication_plot_cache& source) const {
+
+#ifdef TRACCC_HAVE_ROOT
+        target.duplication_rate_vs_pT->Add(*(source.duplication_rate_vs_pT));
+        target.duplication_rate_vs_eta->Add(*(source.duplication_rate_vs_eta));
+        target.duplication_rate_vs_phi->Add(*(source.duplication_rate_vs_phi));
+        target.n_duplicated_vs_pT->Add(source.n_duplicated_vs_pT.get());
+        target.n_duplicated_vs_eta->Add(source.n_duplicated_vs_eta.get());
+        target.n_duplicated_vs_phi->Add(source.n_duplicated_vs_phi.get());
+#else
+        target.duplication_rate_vs_pT.merge(source.duplication_rate_vs_pT);
+        target.duplication_rate_vs_eta.merge(source.duplication_rate_vs_eta);
+        target.duplication_rate_vs_phi.merge(source.duplication_rate_vs_phi);
+        target.n_duplicated_vs_pT.merge(source.n_duplicated_vs_pT);
+        target.n_duplicated_vs_eta.merge(source.n_duplicated_vs_eta);
+        target.n_duplicated_vs_phi.merge(source.n_duplicated_vs_phi);
+#endif  // TRACCC_HAVE_ROOT
+    }
+
+#ifdef TRACCC_HAVE_ROOT
     /// @brief write the duplication plots to file
     ///
     /// @param duplicationPlotCache cache object for duplication plots
     void write(const duplication_plot_cache& cache) const {
 
-        // Avoid unused variable warnings when building the code without ROOT.
-        (void)cache;
-
-#ifdef TRACCC_HAVE_ROOT
         cache.duplication_rate_vs_pT->Write();
         cache.duplication_rate_vs_eta->Write();
         cache.duplication_rate_vs_phi->Write();
         cache.n_duplicated_vs_pT->Write();
         cache.n_duplicated_vs_eta->Write();
         cache.n_duplicated_vs_phi->Write();
-#endif  // TRACCC_HAVE_ROOT
     }
+#else
+    /// @brief write the duplication plots as CSV
+    ///
+    /// @param duplicationPlotCache cache object for duplication plots
+    /// @param out stream to write the CSV table of the plots to
+    void write(const duplication_plot_cache& cache, std::ostream& out) const {
+
+        cache.duplication_rate_vs_pT.write(out);
+        cache.duplication_rate_vs_eta.write(out);
+        cache.duplication_rate_vs_phi.write(out);
+        cache.n_duplicated_vs_pT.write(out);
+        cache.n_duplicated_vs_eta.write(out);
+        cache.n_duplicated_vs_phi.write(out);
+    }
+#endif  // TRACCC_HAVE_ROOT
 
     private:
     config m_cfg;  ///< The Config class
@@ -1,6 +1,6 @@
 /** TRACCC library, part of the ACTS project (R&D line)
  *
- * (c) 2022-2023 CERN for the benefit of the ACTS project
+ * (c) 2022-2024 CERN for the benefit of the ACTS project
  *
  * Mozilla Public License Version 2.0
  */
@@ -9,11 +9,14 @@
 
 // Local include(s).
 #include "../utils/helpers.hpp"
+#include "../utils/light_plots.hpp"
 
 // Project include(s).
 #include "traccc/edm/particle.hpp"
 
 // System include(s).
+#include <ostream>
+#include <string>
 #include <string_view>
 
 namespace traccc {
@@ -40,7 +43,14 @@ class eff_plot_tool {
             track_eff_vs_eta;  ///< Tracking efficiency vs eta
         std::unique_ptr<TEfficiency>
             track_eff_vs_phi;  ///< Tracking efficiency vs phi
-#endif                         // TRACCC_HAVE_ROOT
+#else
+        plot_helpers::light_efficiency
+            track_eff_vs_pT;  ///< Tracking efficiency vs pT
+        plot_helpers::light_efficiency
+            track_eff_vs_eta;  ///< Tracking efficiency vs eta
+        plot_helpers::light_efficiency
+            track_eff_vs_phi;  ///< Tracking efficiency vs phi
+#endif  // TRACCC_HAVE_ROOT
     };
 
     /// Constructor
@@ -58,10 +68,6 @@ class eff_plot_tool {
         plot_helpers::binning b_eta = m_cfg.var_binning.at("Eta");
         plot_helpers::binning b_pt = m_cfg.var_binning.at("Pt");
 
-        // Avoid unused variable warnings when building the code without ROOT.
-        (void)name;
-        (void)cache;
-
 #ifdef TRACCC_HAVE_ROOT
         // efficiency vs pT
         cache.track_eff_vs_pT = plot_helpers::book_eff(
@@ -75,6 +81,11 @@ class eff_plot_tool {
         cache.track_eff_vs_phi = plot_helpers::book_eff(
             TString(name) + "_trackeff_vs_phi",
             "Tracking efficiency;Truth #phi;Efficiency", b_phi);
+#else
+        const std::string prefix(name);
+        cache.track_eff_vs_pT = {prefix + "_trackeff_vs_pT", b_pt};
+        cache.track_eff_vs_eta = {prefix + "_trackeff_vs_eta", b_eta};
+        cache.track_eff_vs_phi = {prefix + "_trackeff_vs_phi", b_phi};
 #endif  // TRACCC_HAVE_ROOT
     }
 
@@ -91,34 +102,56 @@ class eff_plot_tool {
         const auto t_pT =
             getter::perp(vector2{truth_particle.mom[0], truth_particle.mom[1]});
 
-        // Avoid unused variable warnings when building the code without ROOT.
-        (void)t_phi;
-        (void)t_eta;
-        (void)t_pT;
-        (void)cache;
-        (void)status;
-
 #ifdef TRACCC_HAVE_ROOT
         cache.track_eff_vs_pT->Fill(status, t_pT);
         cache.track_eff_vs_eta->Fill(status, t_eta);
         cache.track_eff_vs_phi->Fill(status, t_phi);
+#else
+        cache.track_eff_vs_pT.fill(status, t_pT);
+        cache.track_eff_vs_eta.fill(status, t_eta);
+        cache.track_eff_vs_phi.fill(status, t_phi);
 #endif  // TRACCC_HAVE_ROOT
     }
 
+    /// @brief merge the contents of one cache into another
+    ///
+    /// @param target cache object receiving the contents
+    /// @param source cache object to add to @c target
+    void merge(eff_plot_cache& target, const eff_plot_cache& source) const {
+
+#ifdef TRACCC_HAVE_ROOT
+        target.track_eff_vs_pT->Add(*(source.track_eff_vs_pT));
+        target.track_eff_vs_eta->Add(*(source.track_eff_vs_eta));
+        target.track_eff_vs_phi->Add(*(source.track_eff_vs_phi));
+#else
+        target.track_eff_vs_pT.merge(source.track_eff_vs_pT);
+        target.track_eff_vs_eta.merge(source.track_eff_vs_eta);
+        target.track_eff_vs_phi.merge(source.track_eff_vs_phi);
+#endif  // TRACCC_HAVE_ROOT
+    }
+
+#ifdef TRACCC_HAVE_ROOT
     /// @brief write the efficiency plots to file
     ///
     /// @param effPlotCache cache object for efficiency plots
     void write(const eff_plot_cache& cache) const {
 
-        // Avoid unused variable warnings when building the code without ROOT.
-        (void)cache;
-
-#ifdef TRACCC_HAVE_ROOT
         cache.track_eff_vs_pT->Write();
         cache.track_eff_vs_eta->Write();
         cache.track_eff_vs_phi->Write();
-#endif  // TRACCC_HAVE_ROOT
     }
+#else
+    /// @brief write the efficiency plots as CSV
+    ///
+    /// @param effPlotCache cache object for efficiency plots
+    /// @param out stream to write the CSV table of the plots to
+    void write(const eff_plot_cache& cache, std::ostream& out) const {
+
+        cache.track_eff_vs_pT.write(out);
+        cache.track_eff_vs_eta.write(out);
+        cache.track_eff_vs_phi.write(out);
+    }
+#endif  // TRACCC_HAVE_ROOT
 
     private:
     config m_cfg;  ///< The Config class
@@ -1,6 +1,6 @@
 /** TRACCC library, part of the ACTS project (R&D line)
  *
- * (c) 2023 CERN for the benefit of the ACTS project
+ * (c) 2023-2024 CERN for the benefit of the ACTS project
  *
  * Mozilla Public License Version 2.0
  */
@@ -8,6 +8,7 @@
 // Local include(s).
 #include "traccc/efficiency/finding_performance_writer.hpp"
 
+#include "../utils/thread_local_caches.hpp"
 #include "duplication_plot_tool.hpp"
 #include "eff_plot_tool.hpp"
 #include "track_classification.hpp"
@@ -18,7 +19,7 @@
 #endif  // TRACCC_HAVE_ROOT
 
 // System include(s).
-#include <iostream>
+#include <fstream>
 #include <memory>
 #include <stdexcept>
 
@@ -31,15 +32,23 @@ struct finding_performance_writer_data {
     finding_performance_writer_data(
         const finding_performance_writer::config& cfg)
         : m_eff_plot_tool({cfg.var_binning}),
-          m_duplication_plot_tool({cfg.var_binning}) {}
+          m_eff_plot_caches([this, name = cfg.algorithm_name](auto& cache) {
+              m_eff_plot_tool.book(name, cache);
+          }),
+          m_duplication_plot_tool({cfg.var_binning}),
+          m_duplication_plot_caches(
+              [this, name = cfg.algorithm_name](auto& cache) {
+                  m_duplication_plot_tool.book(name, cache);
+              }) {}
 
     /// Plot tool for efficiency
     eff_plot_tool m_eff_plot_tool;
-    eff_plot_tool::eff_plot_cache m_eff_plot_cache;
+    thread_local_caches<eff_plot_tool::eff_plot_cache> m_eff_plot_caches;
 
     /// Plot tool for duplication rate
     duplication_plot_tool m_duplication_plot_tool;
-    duplication_plot_tool::duplication_plot_cache m_duplication_plot_cache;
+    thread_local_caches<duplication_plot_tool::duplication_plot_cache>
+        m_duplication_plot_caches;
 
     measurement_particle_map m_measurement_particle_map;
     particle_map m_particle_map;
@@ -50,13 +59,7 @@ struct finding_performance_writer_data {
 
 finding_performance_writer::finding_performance_writer(const config& cfg)
     : m_cfg(cfg),
-      m_data(std::make_unique<details::finding_performance_writer_data>(cfg)) {
-
-    m_data->m_eff_plot_tool.book(m_cfg.algorithm_name,
-                                 m_data->m_eff_plot_cache);
-    m_data->m_duplication_plot_tool.book(m_cfg.algorithm_name,
-                                         m_data->m_duplication_plot_cache);
-}
+      m_data(std::make_unique<details::finding_performance_writer_data>(cfg)) {}
 
 finding_performance_writer::~finding_performance_writer() {}
 
@@ -116,7 +119,7 @@ void finding_performance_writer::write_common(
     const std::vector<std::vector<measurement>>& tracks,
     const event_map2& evt_map) {
 
-    std::map<particle_id, std::size_t> match_counter;
+    std::map<std::uint64_t, std::size_t> match_counter;
 
     // Iterate over the tracks.
     const unsigned int n_tracks = tracks.size();
@@ -135,6 +138,17 @@ void finding_performance_writer::write_common(
         }
     }
 
+    fill_plots(match_counter, evt_map);
+}
+
+void finding_performance_writer::fill_plots(
+    const std::map<std::uint64_t, std::size_t>& match_counter,
+    const event_map2& evt_map) {
+
+    // Fill the plots of the current thread.
+    auto& eff_plot_cache = m_data->m_eff_plot_caches.local();
+    auto& duplication_plot_cache = m_data->m_duplication_plot_caches.local();
+
     for (auto const& [pid, ptc] : evt_map.ptc_map) {
 
         // Count only charged particles which satisfiy pT_cut
@@ -150,9 +164,8 @@ void finding_performance_writer::write_common(
             n_matched_seeds_for_particle = it->second;
         }
 
-        m_data->m_eff_plot_tool.fill(m_data->m_eff_plot_cache, ptc, is_matched);
-        m_data->m_duplication_plot_tool.fill(m_data->m_duplication_plot_cache,
-                                             ptc,
+        m_data->m_eff_plot_tool.fill(eff_plot_cache, ptc, is_matched);
+        m_data->m_duplication_plot_tool.fill(duplication_plot_cache, ptc,
                                              n_matched_seeds_for_particle - 1);
     }
 }
@@ -175,8 +188,35 @@ void finding_performance_writer::write(
     write_common(tracks, evt_map);
 }
 
+/// For tracks matched to the particles already
+void finding_performance_writer::write(
+    const track_truth_match_collection_types::const_view& matches_view,
+    const event_map2& evt_map) {
+
+    std::map<std::uint64_t, std::size_t> match_counter;
+    const track_truth_match_collection_types::const_device matches(
+        matches_view);
+    for (const track_truth_match& match : matches) {
+        if (match.is_matched()) {
+            match_counter[match.particle_id]++;
+        }
+    }
+    fill_plots(match_counter, evt_map);
+}
+
 void finding_performance_writer::finalize() {
 
+    // Merge the plots filled by the different threads.
+    const auto& eff_plot_cache = m_data->m_eff_plot_caches.merge(
+        [this](auto& target, const auto& source) {
+            m_data->m_eff_plot_tool.merge(target, source);
+        });
+    const auto& duplication_plot_cache =
+        m_data->m_duplication_plot_caches.merge(
+            [this](auto& target, const auto& source) {
+                m_data->m_duplication_plot_tool.merge(target, source);
+            });
+
 #ifdef TRACCC_HAVE_ROOT
     // Open the output file.
     std::unique_ptr<TFile> ofile(
@@ -187,13 +227,16 @@ void finding_performance_writer::finalize() {
                                  m_cfg.file_mode + "\"");
     }
     ofile->cd();
+
+    m_data->m_eff_plot_tool.write(eff_plot_cache);
+    m_data->m_duplication_plot_tool.write(duplication_plot_cache);
 #else
-    std::cout << "ROOT file \"" << m_cfg.file_path << "\" is NOT created"
-              << std::endl;
-#endif  // TRACCC_HAVE_ROOT
+    std::ofstream ofile =
+        plot_helpers::open_light_plots_file(m_cfg.file_path, m_cfg.file_mode);
 
-    m_data->m_eff_plot_tool.write(m_data->m_eff_plot_cache);
-    m_data->m_duplication_plot_tool.write(m_data->m_duplication_plot_cache);
+    m_data->m_eff_plot_tool.write(eff_plot_cache, ofile);
+    m_data->m_duplication_plot_tool.write(duplication_plot_cache, ofile);
+#endif  // TRACCC_HAVE_ROOT
 }
 
 }  // namespace traccc
@@ -1,6 +1,6 @@
 /** TRACCC library, part of the ACTS project (R&D line)
  *
- * (c) 2022-2023 CERN for the benefit of the ACTS project
+ * (c) 2022-2024 CERN for the benefit of the ACTS project
  *
  * Mozilla Public License Version 2.0
  */
@@ -8,6 +8,7 @@
 // Local include(s).
 #include "traccc/efficiency/seeding_performance_writer.hpp"
 
+#include "../utils/thread_local_caches.hpp"
 #include "duplication_plot_tool.hpp"
 #include "eff_plot_tool.hpp"
 #include "track_classification.hpp"
@@ -18,7 +19,7 @@
 #endif  // TRACCC_HAVE_ROOT
 
 // System include(s).
-#include <iostream>
+#include <fstream>
 #include <memory>
 #include <stdexcept>
 
@@ -31,15 +32,22 @@ struct seeding_performance_writer_data {
     seeding_performance_writer_data(
         const seeding_performance_writer::config& cfg)
         : m_eff_plot_tool({cfg.var_binning}),
-          m_duplication_plot_tool({cfg.var_binning}) {}
+          m_eff_plot_caches([this, name = cfg.name](auto& cache) {
+              m_eff_plot_tool.book(name, cache);
+          }),
+          m_duplication_plot_tool({cfg.var_binning}),
+          m_duplication_plot_caches([this, name = cfg.name](auto& cache) {
+              m_duplication_plot_tool.book(name, cache);
+          }) {}
 
     /// Plot tool for efficiency
     eff_plot_tool m_eff_plot_tool;
-    eff_plot_tool::eff_plot_cache m_eff_plot_cache;
+    thread_local_caches<eff_plot_tool::eff_plot_cache> m_eff_plot_caches;
 
     /// Plot tool for duplication rate
     duplication_plot_tool m_duplication_plot_tool;
-    duplication_plot_tool::duplication_plot_cache m_duplication_plot_cache;
+    thread_local_caches<duplication_plot_tool::duplication_plot_cache>
+        m_duplication_plot_caches;
 
     measurement_particle_map m_measurement_particle_map;
     particle_map m_particle_map;
@@ -50,12 +58,7 @@ struct seeding_performance_writer_data {
 
 seeding_performance_writer::seeding_performance_writer(const config& cfg)
     : m_cfg(cfg),
-      m_data(std::make_unique<details::seeding_performance_writer_data>(cfg)) {
-
-    m_data->m_eff_plot_tool.book("seeding", m_data->m_eff_plot_cache);
-    m_data->m_duplication_plot_tool.book("seeding",
-                                         m_data->m_duplication_plot_cache);
-}
+      m_data(std::make_unique<details::seeding_performance_writer_data>(cfg)) {}
 
 seeding_performance_writer::~seeding_performance_writer() {}
 
@@ -81,6 +84,10 @@ void seeding_performance_writer::write(
         }
     }
 
+    // Fill the plots of the current thread.
+    auto& eff_plot_cache = m_data->m_eff_plot_caches.local();
+    auto& duplication_plot_cache = m_data->m_duplication_plot_caches.local();
+
     for (auto const& [pid, ptc] : evt_map.ptc_map) {
 
         // Count only charged particles which satisfiy pT_cut
@@ -96,9 +103,8 @@ void seeding_performance_writer::write(
             n_matched_seeds_for_particle = it->second;
         }
 
-        m_data->m_eff_plot_tool.fill(m_data->m_eff_plot_cache, ptc, is_matched);
-        m_data->m_duplication_plot_tool.fill(m_data->m_duplication_plot_cache,
-                                             ptc,
+        m_data->m_eff_plot_tool.fill(eff_plot_cache, ptc, is_matched);
+        m_data->m_duplication_plot_tool.fill(duplication_plot_cache, ptc,
                                              n_matched_seeds_for_particle - 1);
     }
 }
@@ -125,6 +131,10 @@ void seeding_performance_writer::write(
         }
     }
 
+    // Fill the plots of the current thread.
+    auto& eff_plot_cache = m_data->m_eff_plot_caches.local();
+    auto& duplication_plot_cache = m_data->m_duplication_plot_caches.local();
+
     for (auto const& [pid, ptc] : evt_map.ptc_map) {
 
         // Count only charged particles which satisfiy pT_cut
@@ -140,15 +150,25 @@ void seeding_performance_writer::write(
             n_matched_seeds_for_particle = it->second;
         }
 
-        m_data->m_eff_plot_tool.fill(m_data->m_eff_plot_cache, ptc, is_matched);
-        m_data->m_duplication_plot_tool.fill(m_data->m_duplication_plot_cache,
-                                             ptc,
+        m_data->m_eff_plot_tool.fill(eff_plot_cache, ptc, is_matched);
+        m_data->m_duplication_plot_tool.fill(duplication_plot_cache, ptc,
                                              n_matched_seeds_for_particle - 1);
     }
 }
 
 void seeding_performance_writer::finalize() {
 
+    // Merge the plots filled by the different threads.
+    const auto& eff_plot_cache = m_data->m_eff_plot_caches.merge(
+        [this](auto& target, const auto& source) {
+            m_data->m_eff_plot_tool.merge(target, source);
+        });
+    const auto& duplication_plot_cache =
+        m_data->m_duplication_plot_caches.merge(
+            [this](auto& target, const auto& source) {
+                m_data->m_duplication_plot_tool.merge(target, source);
+            });
+
 #ifdef TRACCC_HAVE_ROOT
     // Open the output file.
     std::unique_ptr<TFile> ofile(
@@ -159,13 +179,16 @@ void seeding_performance_writer::finalize() {
                                  m_cfg.file_mode + "\"");
     }
     ofile->cd();
+
+    m_data->m_eff_plot_tool.write(eff_plot_cache);
+    m_data->m_duplication_plot_tool.write(duplication_plot_cache);
 #else
-    std::cout << "ROOT file \"" << m_cfg.file_path << "\" is NOT created"
-              << std::endl;
-#endif  // TRACCC_HAVE_ROOT
+    std::ofstream ofile =
+        plot_helpers::open_light_plots_file(m_cfg.file_path, m_cfg.file_mode);
 
-    m_data->m_eff_plot_tool.write(m_data->m_eff_plot_cache);
-    m_data->m_duplication_plot_tool.write(m_data->m_duplication_plot_cache);
+    m_data->m_eff_plot_tool.write(eff_plot_cache, ofile);
+    m_data->m_duplication_plot_tool.write(duplication_plot_cache, ofile);
+#endif  // TRACCC_HAVE_ROOT
 }
 
 }  // namespace traccc
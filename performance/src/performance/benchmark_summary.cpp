@@ -0,0 +1,82 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Local include(s).
+#include "traccc/performance/benchmark_summary.hpp"
+
+// nlohmann_json include(s).
+#include <nlohmann/json.hpp>
+
+// System include(s).
+#include <chrono>
+#include <iostream>
+#include <utility>
+
+namespace traccc::performance {
+namespace {
+
+/// Convert a time to milliseconds
+double to_ms(std::chrono::nanoseconds time) {
+    return std::chrono::duration<double, std::milli>(time).count();
+}
+
+/// Convert the usage of (a part of) a memory resource to JSON
+nlohmann::json to_json(const memory_usage& usage) {
+
+    return {{"allocations", usage.allocations},
+            {"allocated_bytes", usage.allocated_bytes},
+            {"peak_bytes", usage.peak_bytes}};
+}
+
+/// Convert the statistics of a memory resource to JSON
+nlohmann::json to_json(const memory_statistics& stats) {
+
+    nlohmann::json stages = nlohmann::json::object();
+    for (const auto& [name, usage] : stats.stages) {
+        stages[name] = to_json(usage);
+    }
+    return {{"total", to_json(stats.total)}, {"stages", std::move(stages)}};
+}
+
+}  // namespace
+
+void write_json(std::ostream& out, const benchmark_summary& summary) {
+
+    nlohmann::json times = nlohmann::json::array();
+    for (const timing_info_pair& entry : summary.times.data) {
+        times.push_back({{"name", entry.first}, {"ms", to_ms(entry.second)}});
+    }
+    nlohmann::json latencies = nlohmann::json::array();
+    for (const timing_statistics& stats : summary.latencies) {
+        const latency_histogram& lat = stats.latencies;
+        latencies.push_back({{"name", stats.name},
+                             {"count", lat.count()},
+                             {"mean_ms", to_ms(lat.mean())},
+                             {"p50_ms", to_ms(lat.quantile(0.5))},
+                             {"p99_ms", to_ms(lat.quantile(0.99))}});
+    }
+    nlohmann::json devices = nlohmann::json::array();
+    for (const device_throughput& device : summary.devices) {
+        devices.push_back({{"description", device.description},
+                           {"processed_events", device.processed_events},
+                           {"events_per_second", device.events_per_second}});
+    }
+    const nlohmann::json json = {
+        {"application", summary.application},
+        {"input", summary.input},
+        {"processed_events", summary.processed_events},
+        {"reconstructed_track_params", summary.reconstructed_track_params},
+        {"events_per_second", summary.events_per_second},
+        {"times", std::move(times)},
+        {"latencies", std::move(latencies)},
+        {"host_memory", to_json(summary.host_memory)},
+        {"device_memory", to_json(summary.device_memory)},
+        {"devices", std::move(devices)}};
+    out << json.dump(2) << std::endl;
+}
+
+}  // namespace traccc::performance
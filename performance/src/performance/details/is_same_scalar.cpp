@@ -1,6 +1,6 @@
 /** TRACCC library, part of the ACTS project (R&D line)
  *
- * (c) 2022 CERN for the benefit of the ACTS project
+ * (c) 2022-2024 CERN for the benefit of the ACTS project
  *
  * Mozilla Public License Version 2.0
  */
@@ -9,6 +9,7 @@
 #include "traccc/performance/details/is_same_scalar.hpp"
 
 // System include(s).
+#include <cassert>
 #include <cmath>
 
 namespace traccc::details {
@@ -21,4 +22,32 @@ bool is_same_scalar(scalar lhs, scalar rhs, scalar unc) {
             (unc * ((std::abs(lhs) + std::abs(rhs)) / 2.f)));
 }
 
+std::optional<std::int64_t> scalar_bucket(scalar value, scalar unc) {
+
+    // The bucketing only works for uncertainties that do not allow values of
+    // opposite signs to be the same.
+    assert((unc > 0.f) && (unc < 2.f));
+
+    // Zero is only ever the same as zero, and non-finite values are never
+    // the same as anything.
+    if (value == 0.f) {
+        return 0;
+    }
+    if (!std::isfinite(value)) {
+        return {};
+    }
+
+    // Values that are the same differ by at most a factor of
+    // (2 + unc) / (2 - unc). So make the buckets (a bit) wider than that on a
+    // logarithmic scale, with an offset keeping the indices of the positive
+    // and negative values apart.
+    const double width =
+        1.01 * std::log((2. + static_cast<double>(unc)) /
+                        (2. - static_cast<double>(unc)));
+    const auto index = static_cast<std::int64_t>(
+        std::floor(std::log(std::abs(static_cast<double>(value))) / width));
+    constexpr std::int64_t offset = std::int64_t{1} << 52;
+    return (value > 0.f ? offset + index : -(offset + index));
+}
+
 }  // namespace traccc::details
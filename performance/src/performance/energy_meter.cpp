@@ -0,0 +1,378 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Local include(s).
+#include "traccc/performance/energy_meter.hpp"
+
+// NVML include(s).
+#ifdef TRACCC_HAVE_NVML
+#include <nvml.h>
+#endif  // TRACCC_HAVE_NVML
+
+// Level Zero include(s).
+#ifdef TRACCC_HAVE_LEVEL_ZERO
+#include <level_zero/zes_api.h>
+#endif  // TRACCC_HAVE_LEVEL_ZERO
+
+// System include(s).
+#include <algorithm>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <system_error>
+#include <utility>
+
+namespace traccc::performance {
+
+namespace details {
+
+/// Interface of the energy counters of the individual devices
+class energy_counter {
+
+    public:
+    /// Virtual destructor
+    virtual ~energy_counter() = default;
+
+    /// The name of the device
+    virtual std::string name() const = 0;
+    /// Read the counter, in joules
+    virtual double read() = 0;
+    /// The value (in joules) at which the counter wraps around, 0 if it
+    /// never does
+    virtual double range() const { return 0.; }
+
+};  // class energy_counter
+
+}  // namespace details
+
+namespace {
+
+/// Energy counter of a CPU package, read through the Linux powercap
+/// interface of RAPL
+class rapl_counter : public details::energy_counter {
+
+    public:
+    /// Constructor with the powercap directory of the package
+    explicit rapl_counter(const std::filesystem::path& dir)
+        : m_file(dir / "energy_uj") {
+
+        std::ifstream name_file(dir / "name");
+        std::getline(name_file, m_name);
+        std::ifstream range_file(dir / "max_energy_range_uj");
+        std::uint64_t range = 0;
+        if (range_file >> range) {
+            m_range = static_cast<double>(range) * 1e-6;
+        }
+    }
+
+    std::string name() const override { return "CPU " + m_name; }
+    double read() override {
+        std::ifstream file(m_file);
+        std::uint64_t value = 0;
+        file >> value;
+        return static_cast<double>(value) * 1e-6;
+    }
+    double range() const override { return m_range; }
+
+    /// Check whether the counter can be read (by the current user)
+    bool readable() const {
+        std::ifstream file(m_file);
+        std::uint64_t value = 0;
+        return static_cast<bool>(file >> value);
+    }
+
+    private:
+    /// The file holding the counter
+    std::filesystem::path m_file;
+    /// The name of the package
+    std::string m_name;
+    /// The wrap-around value of the counter
+    double m_range = 0.;
+
+};  // class rapl_counter
+
+/// Find the RAPL counters of the CPU packages
+void find_rapl_counters(
+    std::vector<std::unique_ptr<details::energy_counter> >& counters) {
+
+    // The packages are the top level "intel-rapl:N" zones. (The name is used
+    // by the AMD driver as well.)
+    static const std::filesystem::path powercap = "/sys/class/powercap";
+    std::error_code ec;
+    std::vector<std::filesystem::path> zones;
+    for (const auto& entry :
+         std::filesystem::directory_iterator(powercap, ec)) {
+        const std::string zone = entry.path().filename().string();
+        if ((zone.rfind("intel-rapl:", 0) == 0) &&
+            (zone.find(':') == zone.rfind(':'))) {
+            zones.push_back(entry.path());
+        }
+    }
+    std::sort(zones.begin(), zones.end());
+    for (const std::filesystem::path& zone : zones) {
+        auto counter = std::make_unique<rapl_counter>(zone);
+        if (counter->readable()) {
+            counters.push_back(std::move(counter));
+        }
+    }
+}
+
+#ifdef TRACCC_HAVE_NVML
+
+/// Helper (de-)initializing NVML
+struct nvml_session {
+    nvml_session() : m_ok(nvmlInit_v2() == NVML_SUCCESS) {}
+    ~nvml_session() {
+        if (m_ok) {
+            nvmlShutdown();
+        }
+    }
+    bool m_ok;
+};
+
+/// Energy counter of an NVIDIA GPU
+class nvml_counter : public details::energy_counter {
+
+    public:
+    /// Constructor with the device to read
+    nvml_counter(std::shared_ptr<nvml_session> session, nvmlDevice_t device,
+                 std::string name)
+        : m_session(std::move(session)),
+          m_device(device),
+          m_name(std::move(name)) {}
+
+    std::string name() const override { return m_name; }
+    double read() override {
+        unsigned long long value = 0;
+        nvmlDeviceGetTotalEnergyConsumption(m_device, &value);
+        return static_cast<double>(value) * 1e-3;
+    }
+
+    private:
+    /// The NVML session that the device belongs to
+    std::shared_ptr<nvml_session> m_session;
+    /// The device
+    nvmlDevice_t m_device;
+    /// The name of the device
+    std::string m_name;
+
+};  // class nvml_counter
+
+/// Find the energy counters of the NVIDIA GPUs
+void find_nvml_counters(
+    std::vector<std::unique_ptr<details::energy_counter> >& counters) {
+
+    auto session = std::make_shared<nvml_session>();
+    unsigned int n_devices = 0;
+    if (!session->m_ok || (nvmlDeviceGetCount_v2(&n_devices) != NVML_SUCCESS)) {
+        return;
+    }
+    for (unsigned int i = 0; i < n_devices; ++i) {
+        nvmlDevice_t device;
+        unsigned long long value = 0;
+        if ((nvmlDeviceGetHandleByIndex_v2(i, &device) != NVML_SUCCESS) ||
+            (nvmlDeviceGetTotalEnergyConsumption(device, &value) !=
+             NVML_SUCCESS)) {
+            continue;
+        }
+        char name[NVML_DEVICE_NAME_V2_BUFFER_SIZE] = {0};
+        nvmlDeviceGetName(device, name, NVML_DEVICE_NAME_V2_BUFFER_SIZE);
+        counters.push_back(std::make_unique<nvml_counter>(
+            session, device,
+            "GPU " + std::to_string(i) + " (" + std::string(name) + ")"));
+    }
+}
+
+#endif  // TRACCC_HAVE_NVML
+
+#ifdef TRACCC_HAVE_LEVEL_ZERO
+
+/// Energy counter of an Intel GPU
+class level_zero_counter : public details::energy_counter {
+
+    public:
+    /// Constructor with the power domain to read
+    level_zero_counter(zes_pwr_handle_t domain, std::string name)
+        : m_domain(domain), m_name(std::move(name)) {}
+
+    std::string name() const override { return m_name; }
+    double read() override {
+        zes_power_energy_counter_t counter{};
+        zesPowerGetEnergyCounter(m_domain, &counter);
+        return static_cast<double>(counter.energy) * 1e-6;
+    }
+
+    private:
+    /// The power domain of the device
+    zes_pwr_handle_t m_domain;
+    /// The name of the device
+    std::string m_name;
+
+};  // class level_zero_counter
+
+/// Find the energy counters of the Intel GPUs
+void find_level_zero_counters(
+    std::vector<std::unique_ptr<details::energy_counter> >& counters) {
+
+    if (zesInit(0) != ZE_RESULT_SUCCESS) {
+        return;
+    }
+    std::uint32_t n_drivers = 0;
+    if (zesDriverGet(&n_drivers, nullptr) != ZE_RESULT_SUCCESS) {
+        return;
+    }
+    std::vector<zes_driver_handle_t> drivers(n_drivers);
+    zesDriverGet(&n_drivers, drivers.data());
+    std::size_t index = 0;
+    for (zes_driver_handle_t driver : drivers) {
+        std::uint32_t n_devices = 0;
+        zesDeviceGet(driver, &n_devices, nullptr);
+        std::vector<zes_device_handle_t> devices(n_devices);
+        zesDeviceGet(driver, &n_devices, devices.data());
+        for (zes_device_handle_t device : devices) {
+            // Use the power domain of the whole card, if there is one, or
+            // the first domain of the device otherwise.
+            zes_pwr_handle_t domain = nullptr;
+            if (zesDeviceGetCardPowerDomain(device, &domain) !=
+                ZE_RESULT_SUCCESS) {
+                std::uint32_t n_domains = 1;
+                if ((zesDeviceEnumPowerDomains(device, &n_domains, &domain) !=
+                     ZE_RESULT_SUCCESS) ||
+                    (n_domains == 0)) {
+                    continue;
+                }
+            }
+            zes_device_properties_t props{};
+            props.stype = ZES_STRUCTURE_TYPE_DEVICE_PROPERTIES;
+            zesDeviceGetProperties(device, &props);
+            counters.push_back(std::make_unique<level_zero_counter>(
+                domain, "GPU " + std::to_string(index++) + " (" +
+                            std::string(props.core.name) + ")"));
+        }
+    }
+}
+
+#endif  // TRACCC_HAVE_LEVEL_ZERO
+
+}  // namespace
+
+energy_meter::energy_meter(std::chrono::milliseconds interval)
+    : m_interval(interval) {
+
+    find_rapl_counters(m_counters);
+#ifdef TRACCC_HAVE_NVML
+    find_nvml_counters(m_counters);
+#endif  // TRACCC_HAVE_NVML
+#ifdef TRACCC_HAVE_LEVEL_ZERO
+    find_level_zero_counters(m_counters);
+#endif  // TRACCC_HAVE_LEVEL_ZERO
+    m_last.resize(m_counters.size(), 0.);
+    m_accumulated.resize(m_counters.size(), 0.);
+}
+
+energy_meter::~energy_meter() {
+
+    if (m_thread.joinable()) {
+        stop();
+    }
+}
+
+bool energy_meter::empty() const {
+
+    return m_counters.empty();
+}
+
+void energy_meter::start() {
+
+    if (m_thread.joinable()) {
+        stop();
+    }
+
+    std::lock_guard lock{m_mutex};
+    for (std::size_t i = 0; i < m_counters.size(); ++i) {
+        m_last[i] = m_counters[i]->read();
+        m_accumulated[i] = 0.;
+    }
+    m_start = std::chrono::steady_clock::now();
+    m_duration = std::chrono::nanoseconds{0};
+    m_stop = false;
+    if (m_counters.empty()) {
+        return;
+    }
+    m_thread = std::thread([this]() {
+        std::unique_lock thread_lock{m_mutex};
+        while (!m_cv.wait_for(thread_lock, m_interval,
+                              [this]() { return m_stop; })) {
+            sample();
+        }
+    });
+}
+
+void energy_meter::stop() {
+
+    {
+        std::lock_guard lock{m_mutex};
+        m_stop = true;
+    }
+    m_cv.notify_all();
+    if (m_thread.joinable()) {
+        m_thread.join();
+    }
+    std::lock_guard lock{m_mutex};
+    sample();
+    m_duration = std::chrono::steady_clock::now() - m_start;
+}
+
+std::vector<energy_reading> energy_meter::readings() const {
+
+    std::lock_guard lock{m_mutex};
+    std::vector<energy_reading> result;
+    for (std::size_t i = 0; i < m_counters.size(); ++i) {
+        result.push_back(
+            {m_counters[i]->name(), m_accumulated[i], m_duration});
+    }
+    return result;
+}
+
+void energy_meter::sample() {
+
+    for (std::size_t i = 0; i < m_counters.size(); ++i) {
+        const double value = m_counters[i]->read();
+        double delta = value - m_last[i];
+        if (delta < 0.) {
+            // The counter wrapped around (or got reset).
+            delta += m_counters[i]->range();
+        }
+        if (delta > 0.) {
+            m_accumulated[i] += delta;
+        }
+        m_last[i] = value;
+    }
+}
+
+energy_efficiency::energy_efficiency(std::size_t events,
+                                     const energy_reading& reading)
+    : m_device(reading.device), m_joules(reading.joules) {
+
+    const double seconds =
+        std::chrono::duration<double>(reading.duration).count();
+    m_watts = (seconds > 0.) ? m_joules / seconds : 0.;
+    m_perKWh =
+        (m_joules > 0.) ? static_cast<double>(events) / (m_joules / 3.6e6)
+                        : 0.;
+}
+
+std::ostream& operator<<(std::ostream& out, const energy_efficiency& eff) {
+
+    out << std::setw(30) << std::right << eff.m_device << "  " << eff.m_joules
+        << " J, " << eff.m_watts << " W, " << eff.m_perKWh << " events/kWh";
+    return out;
+}
+
+}  // namespace traccc::performance
@@ -0,0 +1,186 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Library include(s).
+#include "traccc/performance/hardware_counters.hpp"
+
+// System include(s).
+#include <array>
+#include <cstring>
+#include <vector>
+
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif  // __linux__
+
+namespace traccc::performance {
+
+namespace {
+
+/// Get a ratio, protecting against a zero denominator
+double ratio(std::uint64_t num, std::uint64_t denom) {
+    return (denom > 0 ? static_cast<double>(num) / static_cast<double>(denom)
+                      : 0.);
+}
+
+#ifdef __linux__
+
+/// The counted events, with the fields of the values they are stored into
+using counter_field = std::uint64_t hardware_counter_values::*;
+const std::array<std::pair<std::uint64_t, counter_field>, 6> counted_events{
+    {{PERF_COUNT_HW_CPU_CYCLES, &hardware_counter_values::cycles},
+     {PERF_COUNT_HW_INSTRUCTIONS, &hardware_counter_values::instructions},
+     {PERF_COUNT_HW_CACHE_REFERENCES,
+      &hardware_counter_values::cache_references},
+     {PERF_COUNT_HW_CACHE_MISSES, &hardware_counter_values::cache_misses},
+     {PERF_COUNT_HW_BRANCH_INSTRUCTIONS, &hardware_counter_values::branches},
+     {PERF_COUNT_HW_BRANCH_MISSES, &hardware_counter_values::branch_misses}}};
+
+/// The counters of one thread, read as one group
+class thread_counters {
+
+    public:
+    /// Open the counters of the current thread
+    thread_counters() {
+
+        for (const auto& [config, field] : counted_events) {
+            perf_event_attr attr;
+            std::memset(&attr, 0, sizeof(attr));
+            attr.size = sizeof(attr);
+            attr.type = PERF_TYPE_HARDWARE;
+            attr.config = config;
+            attr.disabled = (m_fds.empty() ? 1 : 0);
+            attr.exclude_kernel = 1;
+            attr.exclude_hv = 1;
+            attr.read_format = PERF_FORMAT_GROUP |
+                               PERF_FORMAT_TOTAL_TIME_ENABLED |
+                               PERF_FORMAT_TOTAL_TIME_RUNNING;
+            const int fd = static_cast<int>(
+                syscall(SYS_perf_event_open, &attr, 0, -1,
+                        (m_fds.empty() ? -1 : m_fds.front()), 0));
+            // Events not supported by the host are just skipped, but without
+            // the cycles there is nothing to measure.
+            if (fd < 0) {
+                if (m_fds.empty()) {
+                    return;
+                }
+                continue;
+            }
+            m_fds.push_back(fd);
+            m_fields.push_back(field);
+        }
+        ioctl(m_fds.front(), PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+        ioctl(m_fds.front(), PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+    }
+
+    /// Close the counters
+    ~thread_counters() {
+        for (int fd : m_fds) {
+            close(fd);
+        }
+    }
+
+    /// The object can not be copied
+    thread_counters(const thread_counters&) = delete;
+    /// The object can not be copied
+    thread_counters& operator=(const thread_counters&) = delete;
+
+    /// Read the counters
+    std::optional<hardware_counter_values> read() const {
+
+        if (m_fds.empty()) {
+            return {};
+        }
+        // The number of values, the enabled and running times, and the
+        // values themselves.
+        std::array<std::uint64_t, 3 + counted_events.size()> buffer{};
+        if (::read(m_fds.front(), buffer.data(), sizeof(buffer)) <= 0) {
+            return {};
+        }
+        // Scale the values if the counters were multiplexed with others.
+        const double scale =
+            (buffer[2] > 0 ? static_cast<double>(buffer[1]) /
+                                 static_cast<double>(buffer[2])
+                           : 1.);
+        hardware_counter_values result;
+        for (std::size_t i = 0; (i < buffer[0]) && (i < m_fields.size());
+             ++i) {
+            result.*(m_fields[i]) = static_cast<std::uint64_t>(
+                static_cast<double>(buffer[3 + i]) * scale);
+        }
+        result.measurements = 1;
+        return result;
+    }
+
+    private:
+    /// The file descriptors of the counters, the group leader first
+    std::vector<int> m_fds;
+    /// The fields that the counters are stored into
+    std::vector<counter_field> m_fields;
+
+};  // class thread_counters
+
+#endif  // __linux__
+
+}  // namespace
+
+hardware_counter_values& hardware_counter_values::operator+=(
+    const hardware_counter_values& other) {
+
+    cycles += other.cycles;
+    instructions += other.instructions;
+    cache_references += other.cache_references;
+    cache_misses += other.cache_misses;
+    branches += other.branches;
+    branch_misses += other.branch_misses;
+    measurements += other.measurements;
+    return *this;
+}
+
+double hardware_counter_values::ipc() const {
+
+    return ratio(instructions, cycles);
+}
+
+double hardware_counter_values::cache_miss_rate() const {
+
+    return ratio(cache_misses, cache_references);
+}
+
+double hardware_counter_values::branch_miss_rate() const {
+
+    return ratio(branch_misses, branches);
+}
+
+hardware_counter_values operator-(const hardware_counter_values& end,
+                                  const hardware_counter_values& start) {
+
+    hardware_counter_values result;
+    result.cycles = end.cycles - start.cycles;
+    result.instructions = end.instructions - start.instructions;
+    result.cache_references = end.cache_references - start.cache_references;
+    result.cache_misses = end.cache_misses - start.cache_misses;
+    result.branches = end.branches - start.branches;
+    result.branch_misses = end.branch_misses - start.branch_misses;
+    result.measurements = 1;
+    return result;
+}
+
+std::optional<hardware_counter_values> read_hardware_counters() {
+
+#ifdef __linux__
+    static thread_local const thread_counters counters;
+    return counters.read();
+#else
+    return {};
+#endif  // __linux__
+}
+
+}  // namespace traccc::performance
@@ -0,0 +1,298 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Library include(s).
+#include "traccc/performance/metrics_exporter.hpp"
+
+// nlohmann_json include(s).
+#include <nlohmann/json.hpp>
+
+// System include(s).
+#include <array>
+#include <cmath>
+#include <cstdio>
+#include <fstream>
+#include <ostream>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+namespace traccc::performance {
+
+namespace {
+
+/// The latency quantiles to export
+constexpr std::array<double, 3> quantiles{0.5, 0.9, 0.99};
+
+/// Convert a time to seconds
+double to_seconds(std::chrono::nanoseconds time) {
+    return std::chrono::duration<double>(time).count();
+}
+
+/// Write a label value in the Prometheus text format, with the necessary
+/// escapes
+void write_label(std::ostream& out, std::string_view value) {
+
+    out << '"';
+    for (const char c : value) {
+        switch (c) {
+            case '"':
+                out << "\\\"";
+                break;
+            case '\\':
+                out << "\\\\";
+                break;
+            case '\n':
+                out << "\\n";
+                break;
+            default:
+                out << c;
+        }
+    }
+    out << '"';
+}
+
+/// Write the header of a metric in the Prometheus text format
+void write_header(std::ostream& out, std::string_view name,
+                  std::string_view type, std::string_view help) {
+
+    out << "# HELP " << name << ' ' << help << '\n'
+        << "# TYPE " << name << ' ' << type << '\n';
+}
+
+/// The statistics of one scope, as exported
+struct scope_metrics {
+    /// The full name of the scope
+    std::string name;
+    /// The distribution of its measurements
+    latency_histogram latencies;
+    /// The rate of the measurements over the last interval, per second
+    double rate;
+};
+
+}  // namespace
+
+metrics_exporter::metrics_exporter(std::string_view filename,
+                                   std::chrono::milliseconds interval)
+    : m_filename(filename),
+      m_json(filename.size() >= 5 &&
+             filename.substr(filename.size() - 5) == ".json"),
+      m_interval(interval),
+      m_last_time(std::chrono::steady_clock::now()) {}
+
+metrics_exporter::~metrics_exporter() {
+
+    {
+        std::lock_guard lock{m_mutex};
+        m_stop = true;
+    }
+    m_cv.notify_all();
+    if (m_thread.joinable()) {
+        m_thread.join();
+    }
+    // Write the final metrics, but don't let a failure escape the destructor.
+    try {
+        write();
+    } catch (const std::exception&) {
+    }
+}
+
+void metrics_exporter::add_timings(const timing_registry& registry) {
+
+    m_timings = &registry;
+}
+
+void metrics_exporter::add_memory(std::string_view name,
+                                  memory_function func) {
+
+    m_memory.emplace_back(std::string{name}, std::move(func));
+}
+
+void metrics_exporter::add_counter(std::string_view name,
+                                   std::string_view help,
+                                   value_function func) {
+
+    m_values.push_back(
+        {std::string{name}, std::string{help}, std::move(func), true});
+}
+
+void metrics_exporter::add_gauge(std::string_view name, std::string_view help,
+                                 value_function func) {
+
+    m_values.push_back(
+        {std::string{name}, std::string{help}, std::move(func), false});
+}
+
+void metrics_exporter::start() {
+
+    if (m_thread.joinable()) {
+        return;
+    }
+    m_thread = std::thread([this]() {
+        std::unique_lock thread_lock{m_mutex};
+        while (!m_cv.wait_for(thread_lock, m_interval,
+                              [this]() { return m_stop; })) {
+            // Keep exporting, even if one of the writes fails.
+            try {
+                write_locked();
+            } catch (const std::exception&) {
+            }
+        }
+    });
+}
+
+void metrics_exporter::write() {
+
+    std::lock_guard lock{m_mutex};
+    write_locked();
+}
+
+void metrics_exporter::write_locked() {
+
+    // Collect the statistics of the timed scopes.
+    const std::chrono::steady_clock::time_point now =
+        std::chrono::steady_clock::now();
+    const double elapsed = to_seconds(now - m_last_time);
+    m_last_time = now;
+    std::vector<scope_metrics> scopes;
+    if (m_timings != nullptr) {
+        for (timing_statistics& stats : m_timings->statistics()) {
+            std::size_t& last = m_last_counts[stats.name];
+            const std::size_t count = stats.latencies.count();
+            const double rate =
+                (elapsed > 0.) ? static_cast<double>(count - last) / elapsed
+                               : 0.;
+            last = count;
+            scopes.push_back(
+                {std::move(stats.name), std::move(stats.latencies), rate});
+        }
+    }
+
+    // Write the metrics into a temporary file, that replaces the previous
+    // one once it's complete.
+    const std::string tmp_filename = m_filename + ".tmp";
+    {
+        std::ofstream out(tmp_filename);
+        if (!out) {
+            throw std::runtime_error("Could not open file: " + tmp_filename);
+        }
+        if (m_json) {
+            nlohmann::json json = {{"scopes", nlohmann::json::array()},
+                                   {"memory", nlohmann::json::object()},
+                                   {"counters", nlohmann::json::object()},
+                                   {"gauges", nlohmann::json::object()}};
+            for (const scope_metrics& scope : scopes) {
+                nlohmann::json entry = {
+                    {"name", scope.name},
+                    {"count", scope.latencies.count()},
+                    {"rate", scope.rate},
+                    {"mean_s", to_seconds(scope.latencies.mean())}};
+                for (double q : quantiles) {
+                    entry["p" + std::to_string(std::lround(q * 100.)) +
+                          "_s"] = to_seconds(scope.latencies.quantile(q));
+                }
+                json["scopes"].push_back(std::move(entry));
+            }
+            for (const auto& [name, func] : m_memory) {
+                const memory_statistics stats = func();
+                nlohmann::json stages = nlohmann::json::object();
+                for (const auto& [stage, usage] : stats.stages) {
+                    stages[stage] = {{"current_bytes", usage.current_bytes},
+                                     {"peak_bytes", usage.peak_bytes}};
+                }
+                json["memory"][name] = {
+                    {"current_bytes", stats.total.current_bytes},
+                    {"peak_bytes", stats.total.peak_bytes},
+                    {"stages", std::move(stages)}};
+            }
+            for (const value_source& value : m_values) {
+                json[value.counter ? "counters" : "gauges"][value.name] =
+                    value.func();
+            }
+            out << json.dump(2) << '\n';
+        } else {
+            if (!scopes.empty()) {
+                write_header(out, "traccc_scope_measurements_total", "counter",
+                             "Number of measurements of the timed scopes");
+                for (const scope_metrics& scope : scopes) {
+                    out << "traccc_scope_measurements_total{scope=";
+                    write_label(out, scope.name);
+                    out << "} " << scope.latencies.count() << '\n';
+                }
+                write_header(
+                    out, "traccc_scope_rate", "gauge",
+                    "Measurements of the timed scopes per second, over the "
+                    "last export interval");
+                for (const scope_metrics& scope : scopes) {
+                    out << "traccc_scope_rate{scope=";
+                    write_label(out, scope.name);
+                    out << "} " << scope.rate << '\n';
+                }
+                write_header(out, "traccc_scope_latency_seconds", "summary",
+                             "Latencies of the timed scopes");
+                for (const scope_metrics& scope : scopes) {
+                    for (double q : quantiles) {
+                        out << "traccc_scope_latency_seconds{scope=";
+                        write_label(out, scope.name);
+                        out << ",quantile=\"" << q << "\"} "
+                            << to_seconds(scope.latencies.quantile(q)) << '\n';
+                    }
+                    out << "traccc_scope_latency_seconds_sum{scope=";
+                    write_label(out, scope.name);
+                    out << "} " << to_seconds(scope.latencies.total()) << '\n';
+                    out << "traccc_scope_latency_seconds_count{scope=";
+                    write_label(out, scope.name);
+                    out << "} " << scope.latencies.count() << '\n';
+                }
+            }
+            if (!m_memory.empty()) {
+                std::vector<std::pair<std::string, memory_statistics>> memory;
+                for (const auto& [name, func] : m_memory) {
+                    memory.emplace_back(name, func());
+                }
+                auto write_memory = [&](std::string_view metric,
+                                        std::string_view help,
+                                        std::size_t memory_usage::*member) {
+                    write_header(out, metric, "gauge", help);
+                    for (const auto& [name, stats] : memory) {
+                        out << metric << "{resource=";
+                        write_label(out, name);
+                        out << ",stage=\"total\"} " << stats.total.*member
+                            << '\n';
+                        for (const auto& [stage, usage] : stats.stages) {
+                            out << metric << "{resource=";
+                            write_label(out, name);
+                            out << ",stage=";
+                            write_label(out, stage);
+                            out << "} " << usage.*member << '\n';
+                        }
+                    }
+                };
+                write_memory("traccc_memory_current_bytes",
+                             "Memory currently allocated from the resources",
+                             &memory_usage::current_bytes);
+                write_memory("traccc_memory_peak_bytes",
+                             "Peak memory allocated from the resources",
+                             &memory_usage::peak_bytes);
+            }
+            for (const value_source& value : m_values) {
+                const std::string metric = "traccc_" + value.name;
+                write_header(out, metric, value.counter ? "counter" : "gauge",
+                             value.help);
+                out << metric << ' ' << value.func() << '\n';
+            }
+        }
+        if (!out) {
+            throw std::runtime_error("Failed to write file: " + tmp_filename);
+        }
+    }
+    if (std::rename(tmp_filename.c_str(), m_filename.c_str()) != 0) {
+        throw std::runtime_error("Could not replace file: " + m_filename);
+    }
+}
+
+}  // namespace traccc::performance
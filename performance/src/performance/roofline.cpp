@@ -0,0 +1,116 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Library include(s).
+#include "traccc/performance/roofline.hpp"
+
+// System include(s).
+#include <iomanip>
+#include <iostream>
+
+namespace traccc::performance {
+
+namespace {
+
+/// Get a duration in seconds
+double seconds(std::chrono::nanoseconds time) {
+
+    return std::chrono::duration<double>(time).count();
+}
+
+/// Print a relation to a peak value, if the peak is known
+void print_fraction(std::ostream& out, double value, double peak) {
+
+    if (peak > 0.) {
+        out << " (" << std::setprecision(1) << 100. * value / peak
+            << "% of peak)";
+    }
+}
+
+}  // namespace
+
+double roofline_entry::intensity() const {
+
+    const double bytes =
+        static_cast<double>(work.bytes_read + work.bytes_written);
+    return (bytes > 0.) ? static_cast<double>(work.flops) / bytes : 0.;
+}
+
+double roofline_entry::bandwidth() const {
+
+    const double s = seconds(time);
+    return (s > 0.) ? static_cast<double>(work.bytes_read +
+                                          work.bytes_written) *
+                          1e-9 / s
+                    : 0.;
+}
+
+double roofline_entry::gflops() const {
+
+    const double s = seconds(time);
+    return (s > 0.) ? static_cast<double>(work.flops) * 1e-9 / s : 0.;
+}
+
+roofline_report::roofline_report(const timing_info& times,
+                                 const work_counter& counter,
+                                 const device_peaks& device)
+    : peaks(device) {
+
+    const auto stages = counter.stages();
+    for (const timing_info_pair& timing : times.data) {
+        auto it = stages.find(timing.first);
+        if (it == stages.end()) {
+            continue;
+        }
+        entries.push_back({timing.first, it->second, timing.second});
+    }
+}
+
+std::ostream& operator<<(std::ostream& out, const roofline_report& report) {
+
+    const std::ios_base::fmtflags flags = out.flags();
+    const std::streamsize precision = out.precision();
+
+    out << std::setw(30) << std::right << "Device" << "  " << report.peaks.name;
+    if (report.peaks.bandwidth > 0.) {
+        out << ", " << report.peaks.bandwidth << " GB/s";
+    }
+    if (report.peaks.gflops > 0.) {
+        out << ", " << report.peaks.gflops << " GFLOP/s";
+    }
+    // The arithmetic intensity at the ridge point of the roofline.
+    const double ridge = ((report.peaks.bandwidth > 0.) &&
+                          (report.peaks.gflops > 0.))
+                             ? report.peaks.gflops / report.peaks.bandwidth
+                             : 0.;
+
+    out << std::fixed;
+    for (const roofline_entry& entry : report.entries) {
+        out << "\n"
+            << std::setw(30) << std::right << entry.stage << "  "
+            << std::setprecision(3)
+            << static_cast<double>(entry.work.bytes_read +
+                                   entry.work.bytes_written) *
+                   1e-9
+            << " GB, " << static_cast<double>(entry.work.flops) * 1e-9
+            << " GFLOP, " << std::setprecision(2) << entry.intensity()
+            << " FLOP/B, " << entry.bandwidth() << " GB/s";
+        print_fraction(out, entry.bandwidth(), report.peaks.bandwidth);
+        out << ", " << std::setprecision(2) << entry.gflops() << " GFLOP/s";
+        print_fraction(out, entry.gflops(), report.peaks.gflops);
+        if (ridge > 0.) {
+            out << ((entry.intensity() < ridge) ? ", memory bound"
+                                                : ", compute bound");
+        }
+    }
+
+    out.flags(flags);
+    out.precision(precision);
+    return out;
+}
+
+}  // namespace traccc::performance
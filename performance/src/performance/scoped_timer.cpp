@@ -0,0 +1,38 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Library include(s).
+#include "traccc/performance/scoped_timer.hpp"
+
+// System include(s).
+#include <string>
+
+// Nividia tool extensions library
+#ifdef TRACCC_HAVE_NVTX
+#include "nvtx3/nvToolsExt.h"
+#endif  // TRACCC_HAVE_NVTX
+
+namespace traccc::performance {
+
+scoped_timer::scoped_timer(std::string_view name, timing_registry& registry)
+    : m_registry(registry),
+      m_previous(registry.enter_scope(name)),
+      m_start(std::chrono::steady_clock::now()) {
+#ifdef TRACCC_HAVE_NVTX
+    nvtxRangePushA(std::string{name}.c_str());
+#endif  // TRACCC_HAVE_NVTX
+}
+
+scoped_timer::~scoped_timer() {
+#ifdef TRACCC_HAVE_NVTX
+    nvtxRangePop();
+#endif  // TRACCC_HAVE_NVTX
+    m_registry.leave_scope(m_previous,
+                           std::chrono::steady_clock::now() - m_start);
+}
+
+}  // namespace traccc::performance
@@ -0,0 +1,290 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Library include(s).
+#include "traccc/performance/throughput_sweep.hpp"
+
+// nlohmann_json include(s).
+#include <nlohmann/json.hpp>
+
+// System include(s).
+#include <algorithm>
+#include <cmath>
+#include <iomanip>
+#include <iostream>
+#include <numeric>
+#include <stdexcept>
+
+namespace traccc::performance {
+
+namespace {
+
+/// The sample variance of some measurements
+double variance(const std::vector<double>& values) {
+
+    if (values.size() < 2u) {
+        return 0.;
+    }
+    const double mean =
+        std::accumulate(values.begin(), values.end(), 0.) /
+        static_cast<double>(values.size());
+    double sum = 0.;
+    for (double value : values) {
+        sum += (value - mean) * (value - mean);
+    }
+    return sum / static_cast<double>(values.size() - 1u);
+}
+
+/// Continued fraction evaluation of the regularized incomplete beta function
+double beta_continued_fraction(double a, double b, double x) {
+
+    static constexpr int max_iterations = 300;
+    static constexpr double epsilon = 1e-14;
+    static constexpr double tiny = 1e-300;
+
+    double c = 1.;
+    double d = 1. - (a + b) * x / (a + 1.);
+    d = 1. / ((std::abs(d) < tiny) ? tiny : d);
+    double result = d;
+    for (int m = 1; m <= max_iterations; ++m) {
+        const double m2 = 2. * m;
+        // The even step of the recurrence.
+        double coeff = m * (b - m) * x / ((a + m2 - 1.) * (a + m2));
+        d = 1. + coeff * d;
+        d = 1. / ((std::abs(d) < tiny) ? tiny : d);
+        c = 1. + coeff / c;
+        c = (std::abs(c) < tiny) ? tiny : c;
+        result *= d * c;
+        // The odd step of the recurrence.
+        coeff = -(a + m) * (a + b + m) * x / ((a + m2) * (a + m2 + 1.));
+        d = 1. + coeff * d;
+        d = 1. / ((std::abs(d) < tiny) ? tiny : d);
+        c = 1. + coeff / c;
+        c = (std::abs(c) < tiny) ? tiny : c;
+        const double delta = d * c;
+        result *= delta;
+        if (std::abs(delta - 1.) < epsilon) {
+            break;
+        }
+    }
+    return result;
+}
+
+/// The regularized incomplete beta function, I_x(a, b)
+double incomplete_beta(double a, double b, double x) {
+
+    if (x <= 0.) {
+        return 0.;
+    }
+    if (x >= 1.) {
+        return 1.;
+    }
+    const double front =
+        std::exp(std::lgamma(a + b) - std::lgamma(a) - std::lgamma(b) +
+                 a * std::log(x) + b * std::log(1. - x));
+    if (x < (a + 1.) / (a + b + 2.)) {
+        return front * beta_continued_fraction(a, b, x) / a;
+    }
+    return 1. - front * beta_continued_fraction(b, a, 1. - x) / b;
+}
+
+/// The cumulative distribution function of Student's t-distribution
+double student_t_cdf(double t, double dof) {
+
+    const double tail = 0.5 * incomplete_beta(0.5 * dof, 0.5,
+                                              dof / (dof + t * t));
+    return (t < 0.) ? tail : 1. - tail;
+}
+
+}  // namespace
+
+bool sweep_configuration::operator==(const sweep_configuration& other) const {
+
+    return ((threads == other.threads) &&
+            (streams_per_device == other.streams_per_device) &&
+            (target_cells_per_partition == other.target_cells_per_partition) &&
+            (pileup == other.pileup));
+}
+
+std::ostream& operator<<(std::ostream& out, const sweep_configuration& config) {
+
+    out << "threads = " << std::setw(3) << config.threads
+        << ", streams/device = " << std::setw(2) << config.streams_per_device
+        << ", cells/partition = " << std::setw(5)
+        << config.target_cells_per_partition;
+    if (config.pileup > 0) {
+        out << ", pileup = " << std::setw(3) << config.pileup;
+    }
+    return out;
+}
+
+double sweep_point::mean() const {
+
+    if (events_per_second.empty()) {
+        return 0.;
+    }
+    return std::accumulate(events_per_second.begin(), events_per_second.end(),
+                           0.) /
+           static_cast<double>(events_per_second.size());
+}
+
+double sweep_point::stddev() const {
+
+    return std::sqrt(variance(events_per_second));
+}
+
+std::ostream& operator<<(std::ostream& out, const sweep_results& results) {
+
+    const auto flags = out.flags();
+    const auto precision = out.precision();
+    out << std::fixed << std::setprecision(2);
+    for (std::size_t i = 0; i < results.points.size(); ++i) {
+        const sweep_point& point = results.points[i];
+        out << "  " << point.config << ": " << std::setw(10) << point.mean()
+            << " +- " << std::setw(8) << point.stddev() << " events/s";
+        if (i + 1 < results.points.size()) {
+            out << "\n";
+        }
+    }
+    out.flags(flags);
+    out.precision(precision);
+    return out;
+}
+
+void write_json(std::ostream& out, const sweep_results& results) {
+
+    nlohmann::json points = nlohmann::json::array();
+    for (const sweep_point& point : results.points) {
+        points.push_back(
+            {{"threads", point.config.threads},
+             {"streams_per_device", point.config.streams_per_device},
+             {"target_cells_per_partition",
+              point.config.target_cells_per_partition},
+             {"pileup", point.config.pileup},
+             {"events_per_second", point.events_per_second},
+             {"mean", point.mean()},
+             {"stddev", point.stddev()}});
+    }
+    const nlohmann::json json = {{"input", results.input},
+                                 {"processed_events", results.processed_events},
+                                 {"points", std::move(points)}};
+    out << json.dump(2) << std::endl;
+}
+
+sweep_results read_sweep_results(std::istream& in) {
+
+    sweep_results results;
+    try {
+        const nlohmann::json json = nlohmann::json::parse(in);
+        results.input = json.at("input").get<std::string>();
+        results.processed_events =
+            json.at("processed_events").get<std::size_t>();
+        for (const nlohmann::json& point : json.at("points")) {
+            sweep_point& result = results.points.emplace_back();
+            result.config.threads = point.at("threads").get<unsigned int>();
+            result.config.streams_per_device =
+                point.at("streams_per_device").get<unsigned int>();
+            result.config.target_cells_per_partition =
+                point.at("target_cells_per_partition").get<unsigned int>();
+            // (Results written before the pileup sweep existed have none.)
+            result.config.pileup = point.value("pileup", 0u);
+            result.events_per_second =
+                point.at("events_per_second").get<std::vector<double>>();
+        }
+    } catch (const nlohmann::json::exception& e) {
+        throw std::runtime_error(
+            std::string("Could not read throughput sweep results: ") +
+            e.what());
+    }
+    return results;
+}
+
+double welch_t_test(const std::vector<double>& sample,
+                    const std::vector<double>& reference) {
+
+    if (sample.empty() || reference.empty()) {
+        return 1.;
+    }
+    const double n1 = static_cast<double>(sample.size());
+    const double n2 = static_cast<double>(reference.size());
+    const double mean1 = std::accumulate(sample.begin(), sample.end(), 0.) / n1;
+    const double mean2 =
+        std::accumulate(reference.begin(), reference.end(), 0.) / n2;
+    const double var1 = variance(sample) / n1;
+    const double var2 = variance(reference) / n2;
+
+    // Without any spread in the measurements, the means decide.
+    if (var1 + var2 <= 0.) {
+        return (mean1 < mean2) ? 0. : 1.;
+    }
+
+    // The t statistic, and the Welch-Satterthwaite degrees of freedom.
+    const double t = (mean1 - mean2) / std::sqrt(var1 + var2);
+    const double dof_denominator =
+        ((sample.size() > 1u) ? var1 * var1 / (n1 - 1.) : 0.) +
+        ((reference.size() > 1u) ? var2 * var2 / (n2 - 1.) : 0.);
+    const double dof = (var1 + var2) * (var1 + var2) / dof_denominator;
+    return student_t_cdf(t, dof);
+}
+
+double sweep_comparison::relative_change() const {
+
+    if (baseline <= 0.) {
+        return 0.;
+    }
+    return (current - baseline) / baseline;
+}
+
+std::vector<sweep_comparison> compare(const sweep_results& baseline,
+                                      const sweep_results& current,
+                                      double significance, double tolerance) {
+
+    std::vector<sweep_comparison> result;
+    for (const sweep_point& point : current.points) {
+        auto ref = std::find_if(baseline.points.begin(), baseline.points.end(),
+                                [&point](const sweep_point& p) {
+                                    return p.config == point.config;
+                                });
+        if (ref == baseline.points.end()) {
+            continue;
+        }
+        sweep_comparison& comp = result.emplace_back();
+        comp.config = point.config;
+        comp.baseline = ref->mean();
+        comp.current = point.mean();
+        comp.p_value =
+            welch_t_test(point.events_per_second, ref->events_per_second);
+        comp.regression = ((comp.p_value < significance) &&
+                           (comp.relative_change() < -tolerance));
+    }
+    return result;
+}
+
+std::ostream& operator<<(std::ostream& out,
+                         const std::vector<sweep_comparison>& comparisons) {
+
+    const auto flags = out.flags();
+    const auto precision = out.precision();
+    out << std::fixed;
+    for (std::size_t i = 0; i < comparisons.size(); ++i) {
+        const sweep_comparison& comp = comparisons[i];
+        out << "  " << comp.config << ": " << std::setprecision(2)
+            << std::setw(10) << comp.baseline << " -> " << std::setw(10)
+            << comp.current << " events/s (" << std::showpos
+            << std::setw(7) << comp.relative_change() * 100. << "%"
+            << std::noshowpos << ", p = " << std::setprecision(4)
+            << comp.p_value << ")" << (comp.regression ? " REGRESSION" : "");
+        if (i + 1 < comparisons.size()) {
+            out << "\n";
+        }
+    }
+    out.flags(flags);
+    out.precision(precision);
+    return out;
+}
+
+}  // namespace traccc::performance
@@ -28,6 +28,9 @@ timer::timer(const std::string_view timer_name, timing_info& t_info)
 #ifdef TRACCC_HAVE_NVTX
     nvtxRangePushA(timer_name.data());
 #endif  // TRACCC_HAVE_NVTX
+    if (m_timing_info.measure_hardware_counters) {
+        m_start_counters = read_hardware_counters();
+    }
 }
 
 /// End time measurement
@@ -48,6 +51,28 @@ timer::~timer() {
     } else {
         pos->second += totalTime;
     }
+
+    // Record the hardware counts of the measurement, if they were measured.
+    if (!m_start_counters) {
+        return;
+    }
+    const std::optional<hardware_counter_values> end_counters =
+        read_hardware_counters();
+    if (!end_counters) {
+        return;
+    }
+    const hardware_counter_values counts = *end_counters - *m_start_counters;
+    const auto cpos =
+        std::find_if(m_timing_info.counters.begin(),
+                     m_timing_info.counters.end(),
+                     [&name = m_name](const counter_info_pair& element) {
+                         return element.first == name;
+                     });
+    if (cpos == m_timing_info.counters.end()) {
+        m_timing_info.counters.push_back({m_name, counts});
+    } else {
+        cpos->second += counts;
+    }
 }
 
 }  // namespace traccc::performance
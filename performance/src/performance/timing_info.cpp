@@ -41,6 +41,23 @@ std::ostream& operator<<(std::ostream& out, const timing_info& info) {
             out << "\n";
         }
     }
+    if (!info.counters.empty()) {
+        out << "\nHardware counters (per measurement):";
+    }
+    const std::streamsize precision = out.precision();
+    for (const counter_info_pair& ci : info.counters) {
+        const hardware_counter_values& values = ci.second;
+        const double n = static_cast<double>(std::max<std::size_t>(
+            values.measurements, 1u));
+        out << "\n"
+            << std::setw(30) << std::right << ci.first << "  " << std::fixed
+            << std::setprecision(2)
+            << static_cast<double>(values.cycles) / n * 1e-6
+            << " M cycles, IPC " << values.ipc() << ", cache misses "
+            << values.cache_miss_rate() * 100. << "%, branch misses "
+            << values.branch_miss_rate() * 100. << "%"
+            << std::defaultfloat << std::setprecision(precision);
+    }
     return out;
 }
 
@@ -0,0 +1,370 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Library include(s).
+#include "traccc/performance/timing_registry.hpp"
+
+// System include(s).
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <unordered_map>
+#include <utility>
+
+namespace traccc::performance {
+
+namespace {
+
+/// The number of (bits describing the) bins per power of two
+constexpr unsigned int sub_bin_bits = 5u;
+constexpr std::uint64_t sub_bins = 1u << sub_bin_bits;
+
+/// Get the histogram bin index of a (nanosecond) value
+std::size_t bin_index(std::uint64_t value) {
+
+    if (value < sub_bins) {
+        return static_cast<std::size_t>(value);
+    }
+    unsigned int exponent = 0u;
+    for (std::uint64_t v = value; v > 1u; v >>= 1u) {
+        ++exponent;
+    }
+    const unsigned int shift = exponent - sub_bin_bits;
+    return static_cast<std::size_t>(sub_bins * (shift + 1u) +
+                                    ((value >> shift) & (sub_bins - 1u)));
+}
+
+/// Get the lower edge and the width of a histogram bin
+std::pair<std::uint64_t, std::uint64_t> bin_range(std::size_t index) {
+
+    if (index < sub_bins) {
+        return {index, 1u};
+    }
+    const std::uint64_t shift = (index - sub_bins) / sub_bins;
+    const std::uint64_t mantissa = (index - sub_bins) % sub_bins;
+    return {(sub_bins + mantissa) << shift, std::uint64_t{1u} << shift};
+}
+
+/// Counter providing a unique identifier for every registry
+std::atomic<std::size_t> registry_counter{0};
+
+/// Get the name of the parent of a scope (empty for top level scopes)
+std::string_view parent_name(std::string_view name) {
+
+    const std::size_t pos = name.rfind('/');
+    return (pos == std::string_view::npos ? std::string_view{}
+                                          : name.substr(0, pos));
+}
+
+/// Write a string into a JSON output, with the necessary escapes
+void write_json_string(std::ostream& out, std::string_view str) {
+
+    out << '"';
+    for (const char c : str) {
+        switch (c) {
+            case '"':
+                out << "\\\"";
+                break;
+            case '\\':
+                out << "\\\\";
+                break;
+            case '\n':
+                out << "\\n";
+                break;
+            case '\t':
+                out << "\\t";
+                break;
+            default:
+                out << c;
+        }
+    }
+    out << '"';
+}
+
+/// Convert a time to milliseconds, for printing
+double to_ms(std::chrono::nanoseconds time) {
+    return std::chrono::duration<double, std::milli>(time).count();
+}
+
+}  // namespace
+
+void latency_histogram::add(std::chrono::nanoseconds time) {
+
+    time = std::max(time, std::chrono::nanoseconds{0});
+    const std::size_t index =
+        bin_index(static_cast<std::uint64_t>(time.count()));
+    if (m_bins.size() <= index) {
+        m_bins.resize(index + 1u, 0u);
+    }
+    ++(m_bins[index]);
+    if (m_count == 0u) {
+        m_min = time;
+        m_max = time;
+    } else {
+        m_min = std::min(m_min, time);
+        m_max = std::max(m_max, time);
+    }
+    ++m_count;
+    m_total += time;
+}
+
+void latency_histogram::merge(const latency_histogram& other) {
+
+    if (other.m_count == 0u) {
+        return;
+    }
+    if (m_bins.size() < other.m_bins.size()) {
+        m_bins.resize(other.m_bins.size(), 0u);
+    }
+    for (std::size_t i = 0; i < other.m_bins.size(); ++i) {
+        m_bins[i] += other.m_bins[i];
+    }
+    if (m_count == 0u) {
+        m_min = other.m_min;
+        m_max = other.m_max;
+    } else {
+        m_min = std::min(m_min, other.m_min);
+        m_max = std::max(m_max, other.m_max);
+    }
+    m_count += other.m_count;
+    m_total += other.m_total;
+}
+
+std::chrono::nanoseconds latency_histogram::mean() const {
+
+    if (m_count == 0u) {
+        return std::chrono::nanoseconds{0};
+    }
+    return m_total / m_count;
+}
+
+std::chrono::nanoseconds latency_histogram::quantile(double q) const {
+
+    if (m_count == 0u) {
+        return std::chrono::nanoseconds{0};
+    }
+    const std::uint64_t rank = std::max<std::uint64_t>(
+        static_cast<std::uint64_t>(
+            std::ceil(std::clamp(q, 0., 1.) * static_cast<double>(m_count))),
+        1u);
+    if (rank >= m_count) {
+        return m_max;
+    }
+    std::uint64_t cumulative = 0u;
+    for (std::size_t i = 0; i < m_bins.size(); ++i) {
+        cumulative += m_bins[i];
+        if (cumulative >= rank) {
+            const auto [low, width] = bin_range(i);
+            const std::chrono::nanoseconds result{
+                static_cast<std::chrono::nanoseconds::rep>(low + width / 2u)};
+            return std::clamp(result, m_min, m_max);
+        }
+    }
+    return m_max;
+}
+
+/// Time measurements of one thread
+struct timing_registry::thread_data {
+
+    /// Measurements of one scope
+    struct entry {
+        /// The order in which the scope was first measured
+        std::size_t sequence = 0;
+        /// The distribution of the measurements
+        latency_histogram latencies;
+    };
+
+    /// Mutex protecting the measurements (only ever contended while the
+    /// statistics are being collected)
+    std::mutex mutex;
+    /// The (full) name of the current scope
+    std::string scope;
+    /// The measurements per scope
+    std::map<std::string, entry, std::less<>> entries;
+
+};  // struct timing_registry::thread_data
+
+timing_registry::timing_registry() : m_id(registry_counter++) {}
+
+timing_registry::~timing_registry() = default;
+
+void timing_registry::record(std::string_view name,
+                             std::chrono::nanoseconds time) {
+
+    record(local(), name, time);
+}
+
+std::size_t timing_registry::enter_scope(std::string_view name) {
+
+    thread_data& data = local();
+    const std::size_t previous = data.scope.size();
+    if (!data.scope.empty()) {
+        data.scope += '/';
+    }
+    data.scope += name;
+    return previous;
+}
+
+void timing_registry::leave_scope(std::size_t previous,
+                                  std::chrono::nanoseconds time) {
+
+    thread_data& data = local();
+    record(data, data.scope, time);
+    data.scope.resize(previous);
+}
+
+timing_registry::thread_data& timing_registry::local() {
+
+    // Cache of the storage that the current thread uses in every registry.
+    // Identifiers of destroyed registries are never re-used, so stale
+    // entries in the cache are never accessed.
+    thread_local std::unordered_map<std::size_t, thread_data*> cache;
+
+    auto it = cache.find(m_id);
+    if (it == cache.end()) {
+        std::lock_guard lock{m_mutex};
+        std::unique_ptr<thread_data>& data =
+            m_threads[std::this_thread::get_id()];
+        if (!data) {
+            data = std::make_unique<thread_data>();
+        }
+        it = cache.emplace(m_id, data.get()).first;
+    }
+    return *(it->second);
+}
+
+void timing_registry::record(thread_data& data, std::string_view name,
+                             std::chrono::nanoseconds time) {
+
+    std::lock_guard lock{data.mutex};
+    auto it = data.entries.find(name);
+    if (it == data.entries.end()) {
+        it = data.entries.emplace(std::string{name}, thread_data::entry{})
+                 .first;
+        it->second.sequence = m_next_sequence++;
+    }
+    it->second.latencies.add(time);
+}
+
+std::vector<timing_statistics> timing_registry::statistics() const {
+
+    // Merge the measurements of all threads.
+    std::map<std::string, thread_data::entry, std::less<>> merged;
+    {
+        std::lock_guard lock{m_mutex};
+        for (const auto& [id, data] : m_threads) {
+            std::lock_guard data_lock{data->mutex};
+            for (const auto& [name, entry] : data->entries) {
+                auto it = merged.find(name);
+                if (it == merged.end()) {
+                    merged.emplace(name, entry);
+                } else {
+                    it->second.sequence =
+                        std::min(it->second.sequence, entry.sequence);
+                    it->second.latencies.merge(entry.latencies);
+                }
+            }
+        }
+    }
+
+    // Attach every scope to its closest measured ancestor, in the order in
+    // which they were first measured.
+    std::vector<const std::string*> order;
+    order.reserve(merged.size());
+    for (const auto& [name, entry] : merged) {
+        order.push_back(&name);
+    }
+    std::sort(order.begin(), order.end(),
+              [&merged](const std::string* a, const std::string* b) {
+                  return merged.find(*a)->second.sequence <
+                         merged.find(*b)->second.sequence;
+              });
+    std::map<std::string_view, std::vector<const std::string*>> children;
+    for (const std::string* name : order) {
+        std::string_view parent = parent_name(*name);
+        while (!parent.empty() && (merged.find(parent) == merged.end())) {
+            parent = parent_name(parent);
+        }
+        children[parent].push_back(name);
+    }
+
+    // Collect the statistics in tree order.
+    std::vector<timing_statistics> result;
+    result.reserve(merged.size());
+    std::function<void(std::string_view, std::size_t)> collect =
+        [&](std::string_view parent, std::size_t depth) {
+            auto it = children.find(parent);
+            if (it == children.end()) {
+                return;
+            }
+            for (const std::string* name : it->second) {
+                result.push_back(
+                    {*name, depth, merged.find(*name)->second.latencies});
+                if (!name->empty()) {
+                    collect(*name, depth + 1u);
+                }
+            }
+        };
+    collect({}, 0u);
+    return result;
+}
+
+void timing_registry::write_json(std::ostream& out) const {
+
+    const std::vector<timing_statistics> stats = statistics();
+    out << "{\n  \"scopes\": [";
+    for (std::size_t i = 0; i < stats.size(); ++i) {
+        const latency_histogram& lat = stats[i].latencies;
+        out << (i == 0 ? "\n" : ",\n") << "    {\"name\": ";
+        write_json_string(out, stats[i].name);
+        out << ", \"depth\": " << stats[i].depth
+            << ", \"count\": " << lat.count()
+            << ", \"total_ns\": " << lat.total().count()
+            << ", \"mean_ns\": " << lat.mean().count()
+            << ", \"min_ns\": " << lat.min().count()
+            << ", \"p50_ns\": " << lat.quantile(0.5).count()
+            << ", \"p90_ns\": " << lat.quantile(0.9).count()
+            << ", \"p99_ns\": " << lat.quantile(0.99).count()
+            << ", \"max_ns\": " << lat.max().count() << "}";
+    }
+    out << "\n  ]\n}" << std::endl;
+}
+
+std::ostream& operator<<(std::ostream& out, const timing_registry& registry) {
+
+    const std::vector<timing_statistics> stats = registry.statistics();
+    out << std::setw(40) << std::left << "Scope" << std::right
+        << std::setw(10) << "count" << std::setw(12) << "total [ms]"
+        << std::setw(11) << "mean [ms]" << std::setw(11) << "p50 [ms]"
+        << std::setw(11) << "p90 [ms]" << std::setw(11) << "p99 [ms]"
+        << std::setw(11) << "max [ms]";
+    const auto flags = out.flags();
+    const auto precision = out.precision();
+    out << std::fixed << std::setprecision(3);
+    for (const timing_statistics& stat : stats) {
+        const latency_histogram& lat = stat.latencies;
+        const std::size_t pos = stat.name.rfind('/');
+        const std::string label =
+            std::string(2u * stat.depth, ' ') +
+            (pos == std::string::npos ? stat.name : stat.name.substr(pos + 1));
+        out << "\n"
+            << std::setw(40) << std::left << label << std::right
+            << std::setw(10) << lat.count() << std::setw(12)
+            << to_ms(lat.total()) << std::setw(11) << to_ms(lat.mean())
+            << std::setw(11) << to_ms(lat.quantile(0.5)) << std::setw(11)
+            << to_ms(lat.quantile(0.9)) << std::setw(11)
+            << to_ms(lat.quantile(0.99)) << std::setw(11)
+            << to_ms(lat.max());
+    }
+    out.flags(flags);
+    out.precision(precision);
+    return out;
+}
+
+}  // namespace traccc::performance
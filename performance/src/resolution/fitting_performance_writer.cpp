@@ -1,6 +1,6 @@
 /** TRACCC library, part of the ACTS project (R&D line)
  *
- * (c) 2022-2023 CERN for the benefit of the ACTS project
+ * (c) 2022-2024 CERN for the benefit of the ACTS project
  *
  * Mozilla Public License Version 2.0
  */
@@ -8,6 +8,7 @@
 // Library include(s).
 #include "traccc/resolution/fitting_performance_writer.hpp"
 
+#include "../utils/thread_local_caches.hpp"
 #include "res_plot_tool.hpp"
 #include "stat_plot_tool.hpp"
 
@@ -17,7 +18,7 @@
 #endif  // TRACCC_HAVE_ROOT
 
 // System include(s).
-#include <iostream>
+#include <fstream>
 #include <memory>
 #include <stdexcept>
 
@@ -29,30 +30,41 @@ struct fitting_performance_writer_data {
     /// Constructor
     fitting_performance_writer_data(
         const fitting_performance_writer::config& cfg)
-        : m_res_plot_tool(cfg.res_config), m_stat_plot_tool(cfg.stat_config) {}
+        : m_res_plot_tool(cfg.res_config),
+          m_res_plot_caches(
+              [this](auto& cache) { m_res_plot_tool.book(cache); }),
+          m_stat_plot_tool(cfg.stat_config),
+          m_stat_plot_caches(
+              [this](auto& cache) { m_stat_plot_tool.book(cache); }) {}
 
     /// Plot tool for resolution
     res_plot_tool m_res_plot_tool;
-    res_plot_tool::res_plot_cache m_res_plot_cache;
+    thread_local_caches<res_plot_tool::res_plot_cache> m_res_plot_caches;
     /// Plot tool for statistics
     stat_plot_tool m_stat_plot_tool;
-    stat_plot_tool::stat_plot_cache m_stat_plot_cache;
+    thread_local_caches<stat_plot_tool::stat_plot_cache> m_stat_plot_caches;
 };
 
 }  // namespace details
 
 fitting_performance_writer::fitting_performance_writer(const config& cfg)
     : m_cfg(cfg),
-      m_data(std::make_unique<details::fitting_performance_writer_data>(cfg)) {
-
-    m_data->m_res_plot_tool.book(m_data->m_res_plot_cache);
-    m_data->m_stat_plot_tool.book(m_data->m_stat_plot_cache);
-}
+      m_data(std::make_unique<details::fitting_performance_writer_data>(cfg)) {}
 
 fitting_performance_writer::~fitting_performance_writer() {}
 
 void fitting_performance_writer::finalize() {
 
+    // Merge the plots filled by the different threads.
+    auto& res_plot_cache = m_data->m_res_plot_caches.merge(
+        [this](auto& target, const auto& source) {
+            m_data->m_res_plot_tool.merge(target, source);
+        });
+    const auto& stat_plot_cache = m_data->m_stat_plot_caches.merge(
+        [this](auto& target, const auto& source) {
+            m_data->m_stat_plot_tool.merge(target, source);
+        });
+
 #ifdef TRACCC_HAVE_ROOT
     // Open the output file.
     std::unique_ptr<TFile> ofile(
@@ -63,31 +75,37 @@ void fitting_performance_writer::finalize() {
                                  m_cfg.file_mode + "\"");
     }
     ofile->cd();
+
+    m_data->m_res_plot_tool.write(res_plot_cache);
+    m_data->m_stat_plot_tool.write(stat_plot_cache);
 #else
-    std::cout << "ROOT file \"" << m_cfg.file_path << "\" is NOT created"
-              << std::endl;
-#endif  // TRACCC_HAVE_ROOT
+    std::ofstream ofile =
+        plot_helpers::open_light_plots_file(m_cfg.file_path, m_cfg.file_mode);
 
-    m_data->m_res_plot_tool.write(m_data->m_res_plot_cache);
-    m_data->m_stat_plot_tool.write(m_data->m_stat_plot_cache);
+    m_data->m_res_plot_tool.write(res_plot_cache, ofile);
+    m_data->m_stat_plot_tool.write(stat_plot_cache, ofile);
+#endif  // TRACCC_HAVE_ROOT
 }
 
 void fitting_performance_writer::write_res(
     const bound_track_parameters& truth_param,
     const bound_track_parameters& fit_param, const particle& ptc) {
 
-    m_data->m_res_plot_tool.fill(m_data->m_res_plot_cache, truth_param,
-                                 fit_param, ptc);
+    m_data->m_res_plot_tool.fill(m_data->m_res_plot_caches.local(),
+                                 truth_param, fit_param, ptc);
 }
 
 void fitting_performance_writer::write_stat(
     const fitting_result<transform3>& fit_res,
     const track_state_collection_types::host& track_states) {
 
-    m_data->m_stat_plot_tool.fill(m_data->m_stat_plot_cache, fit_res);
+    // Fill the plots of the current thread.
+    auto& stat_plot_cache = m_data->m_stat_plot_caches.local();
+
+    m_data->m_stat_plot_tool.fill(stat_plot_cache, fit_res);
 
     for (const auto& trk_state : track_states) {
-        m_data->m_stat_plot_tool.fill(m_data->m_stat_plot_cache, trk_state);
+        m_data->m_stat_plot_tool.fill(stat_plot_cache, trk_state);
     }
 }
 
@@ -1,6 +1,6 @@
 /** TRACCC library, part of the ACTS project (R&D line)
  *
- * (c) 2022-2023 CERN for the benefit of the ACTS project
+ * (c) 2022-2024 CERN for the benefit of the ACTS project
  *
  * Mozilla Public License Version 2.0
  */
@@ -27,12 +27,6 @@ void res_plot_tool::book(res_plot_cache& cache) const {
     plot_helpers::binning b_eta = m_cfg.var_binning.at("Eta");
     plot_helpers::binning b_pT = m_cfg.var_binning.at("Pt");
 
-    // Avoid unused variable warnings when building the code without ROOT.
-    (void)cache;
-    (void)b_pull;
-    (void)b_eta;
-    (void)b_pT;
-
     for (std::size_t idx = 0; idx < m_cfg.param_names.size(); idx++) {
         std::string par_name = m_cfg.param_names.at(idx);
 
@@ -40,9 +34,6 @@ void res_plot_tool::book(res_plot_cache& cache) const {
         std::string par_residual = "residual_" + par_name;
         plot_helpers::binning b_residual = m_cfg.var_binning.at(par_residual);
 
-        // Avoid unused variable warnings when building the code without ROOT.
-        (void)b_residual;
-
 #ifdef TRACCC_HAVE_ROOT
         // residual distributions
         cache.residuals[par_name] = plot_helpers::book_histo(
@@ -88,6 +79,13 @@ void res_plot_tool::book(res_plot_cache& cache) const {
                 Form("Residual of %s at %d th pT", par_name.c_str(), i),
                 b_residual);
         }
+#else
+        cache.residuals[par_name] = {"res_" + par_name, b_residual};
+        cache.pulls[par_name] = {"pull_" + par_name, b_pull};
+        cache.residuals_eta[par_name] = {"residual_" + par_name + "_vs_eta",
+                                         b_eta};
+        cache.residuals_pT[par_name] = {"residual_" + par_name + "_vs_pT",
+                                        b_pT};
 #endif  // TRACCC_HAVE_ROOT
     }
 }
@@ -101,11 +99,6 @@ void res_plot_tool::fill(res_plot_cache& cache,
     const scalar eta = getter::eta(ptc.mom);
     const scalar pT = std::hypot(ptc.mom[0], ptc.mom[1]);
 
-    // Avoid unused variable warnings when building the code without ROOT.
-    (void)cache;
-    (void)eta;
-    (void)pT;
-
     for (std::size_t idx = 0; idx < m_cfg.param_names.size(); idx++) {
         std::string par_name = m_cfg.param_names.at(idx);
 
@@ -123,10 +116,6 @@ void res_plot_tool::fill(res_plot_cache& cache,
             residual = fit_param.qopz() - truth_param.qopz();
         }
 
-        // Avoid unused variable warnings when building the code without ROOT.
-        (void)residual;
-        (void)pull;
-
 #ifdef TRACCC_HAVE_ROOT
         const auto eta_idx =
             std::min(cache.resolutions_eta[par_name]->FindBin(eta) - 1,
@@ -143,16 +132,62 @@ void res_plot_tool::fill(res_plot_cache& cache,
         cache.residuals_pT.at(par_name)->Fill(pT, residual);
         cache.residuals_per_eta.at(par_name).at(eta_idx)->Fill(residual);
         cache.residuals_per_pT.at(par_name).at(pT_idx)->Fill(residual);
+#else
+        cache.residuals.at(par_name).fill(residual);
+        if (idx < e_bound_size) {
+            cache.pulls.at(par_name).fill(pull);
+        }
+        cache.residuals_eta.at(par_name).fill(eta, residual);
+        cache.residuals_pT.at(par_name).fill(pT, residual);
 #endif  // TRACCC_HAVE_ROOT
     }
 }
 
-void res_plot_tool::write(res_plot_cache& cache) const {
+void res_plot_tool::merge(res_plot_cache& target,
+                          const res_plot_cache& source) const {
 
-    // Avoid unused variable warnings when building the code without ROOT.
-    (void)cache;
+#ifdef TRACCC_HAVE_ROOT
+    for (const auto& [par_name, hist] : source.residuals) {
+        target.residuals.at(par_name)->Add(hist.get());
+    }
+    for (const auto& [par_name, hist] : source.pulls) {
+        target.pulls.at(par_name)->Add(hist.get());
+    }
+    for (const auto& [par_name, hist] : source.residuals_eta) {
+        target.residuals_eta.at(par_name)->Add(hist.get());
+    }
+    for (const auto& [par_name, hist] : source.residuals_pT) {
+        target.residuals_pT.at(par_name)->Add(hist.get());
+    }
+    for (const auto& [par_name, hists] : source.residuals_per_eta) {
+        for (const auto& [i, hist] : hists) {
+            target.residuals_per_eta.at(par_name).at(i)->Add(hist.get());
+        }
+    }
+    for (const auto& [par_name, hists] : source.residuals_per_pT) {
+        for (const auto& [i, hist] : hists) {
+            target.residuals_per_pT.at(par_name).at(i)->Add(hist.get());
+        }
+    }
+#else
+    for (const auto& [par_name, hist] : source.residuals) {
+        target.residuals.at(par_name).merge(hist);
+    }
+    for (const auto& [par_name, hist] : source.pulls) {
+        target.pulls.at(par_name).merge(hist);
+    }
+    for (const auto& [par_name, prof] : source.residuals_eta) {
+        target.residuals_eta.at(par_name).merge(prof);
+    }
+    for (const auto& [par_name, prof] : source.residuals_pT) {
+        target.residuals_pT.at(par_name).merge(prof);
+    }
+#endif  // TRACCC_HAVE_ROOT
+}
 
 #ifdef TRACCC_HAVE_ROOT
+void res_plot_tool::write(res_plot_cache& cache) const {
+
     for (const auto& residual : cache.residuals) {
         residual.second->Write();
     }
@@ -235,8 +270,26 @@ void res_plot_tool::write(res_plot_cache& cache) const {
 
         G->Write();
     }
+}
+#else
+void res_plot_tool::write(const res_plot_cache& cache,
+                          std::ostream& out) const {
 
-#endif  // TRACCC_HAVE_ROOT
+    for (const auto& residual : cache.residuals) {
+        residual.second.write(out);
+    }
+    for (const auto& pull : cache.pulls) {
+        pull.second.write(out);
+    }
+    for (const auto& [par_name, prof] : cache.residuals_eta) {
+        prof.write(out);
+        prof.write_spread(out, "resolution_" + par_name + "_vs_eta");
+    }
+    for (const auto& [par_name, prof] : cache.residuals_pT) {
+        prof.write(out);
+        prof.write_spread(out, "resolution_" + par_name + "_vs_pT");
+    }
 }
+#endif  // TRACCC_HAVE_ROOT
 
 }  // namespace traccc
@@ -1,6 +1,6 @@
 /** TRACCC library, part of the ACTS project (R&D line)
  *
- * (c) 2022-2023 CERN for the benefit of the ACTS project
+ * (c) 2022-2024 CERN for the benefit of the ACTS project
  *
  * Mozilla Public License Version 2.0
  */
@@ -9,6 +9,7 @@
 
 // Library include(s).
 #include "../utils/helpers.hpp"
+#include "../utils/light_plots.hpp"
 #include "traccc/resolution/res_plot_tool_config.hpp"
 
 // Project include(s).
@@ -18,6 +19,7 @@
 // System include(s).
 #include <map>
 #include <memory>
+#include <ostream>
 #include <string>
 
 namespace traccc {
@@ -39,6 +41,13 @@ class res_plot_tool {
             residuals_per_eta;
         std::map<std::string, std::map<std::size_t, std::shared_ptr<TH1>>>
             residuals_per_pT;
+#else
+        std::map<std::string, plot_helpers::light_histogram> residuals;
+        std::map<std::string, plot_helpers::light_histogram> pulls;
+        // The resolutions are taken as the RMS of the residuals in the bins
+        // of these profiles.
+        std::map<std::string, plot_helpers::light_profile> residuals_eta;
+        std::map<std::string, plot_helpers::light_profile> residuals_pT;
 #endif  // TRACCC_HAVE_ROOT
     };
 
@@ -61,10 +70,24 @@ class res_plot_tool {
               const bound_track_parameters& fit_param,
               const particle& ptc) const;
 
+    /// @brief merge the contents of one cache into another
+    ///
+    /// @param target the cache receiving the contents
+    /// @param source the cache to add to @c target
+    void merge(res_plot_cache& target, const res_plot_cache& source) const;
+
+#ifdef TRACCC_HAVE_ROOT
     /// @brief write the resolution plots into ROOT
     ///
     /// @param cache the cache for resolution plots
     void write(res_plot_cache& cache) const;
+#else
+    /// @brief write the resolution plots as CSV
+    ///
+    /// @param cache the cache for resolution plots
+    /// @param out stream to write the CSV table of the plots to
+    void write(const res_plot_cache& cache, std::ostream& out) const;
+#endif  // TRACCC_HAVE_ROOT
 
     private:
     res_plot_tool_config m_cfg;  ///< The Config class
@@ -1,6 +1,6 @@
 /** TRACCC library, part of the ACTS project (R&D line)
  *
- * (c) 2023 CERN for the benefit of the ACTS project
+ * (c) 2023-2024 CERN for the benefit of the ACTS project
  *
  * Mozilla Public License Version 2.0
  */
@@ -13,21 +13,39 @@
 #include <Math/ProbFuncMathCore.h>
 #endif  // TRACCC_HAVE_ROOT
 
+// System include(s).
+#include <cmath>
+#include <string>
+
 namespace traccc {
 
 stat_plot_tool::stat_plot_tool(const stat_plot_tool_config& cfg) : m_cfg(cfg) {}
 
-void stat_plot_tool::book(stat_plot_cache& cache) const {
+#ifndef TRACCC_HAVE_ROOT
+namespace {
 
-    // Avoid unused variable warnings when building the code without ROOT.
-    (void)cache;
+/// Upper tail probability of a chi2 distribution with @c D (1 or 2) degrees
+/// of freedom, for the lightweight plots
+scalar chi2_pval(scalar chi2, unsigned int D) {
+
+    if (D == 1u) {
+        return std::erfc(std::sqrt(0.5f * chi2));
+    }
+    return std::exp(-0.5f * chi2);
+}
+
+}  // namespace
+#endif  // !TRACCC_HAVE_ROOT
+
+void stat_plot_tool::book(stat_plot_cache& cache) const {
 
-#ifdef TRACCC_HAVE_ROOT
     plot_helpers::binning b_ndf = m_cfg.var_binning.at("ndf");
     plot_helpers::binning b_chi2 = m_cfg.var_binning.at("chi2");
     plot_helpers::binning b_reduced_chi2 = m_cfg.var_binning.at("reduced_chi2");
     plot_helpers::binning b_pval = m_cfg.var_binning.at("pval");
     plot_helpers::binning b_chi2_local = m_cfg.var_binning.at("chi2_local");
+
+#ifdef TRACCC_HAVE_ROOT
     cache.ndf_hist = plot_helpers::book_histo("ndf", "NDF", b_ndf);
     cache.chi2_hist = plot_helpers::book_histo("chi2", "Chi2", b_chi2);
     cache.reduced_chi2_hist =
@@ -47,52 +65,102 @@ void stat_plot_tool::book(stat_plot_cache& cache) const {
             Form("pval_%dD_smoothed", D),
             Form("p value of %dD smoothed parameters", D), b_pval);
     }
+#else
+    cache.ndf_hist = {"ndf", b_ndf};
+    cache.chi2_hist = {"chi2", b_chi2};
+    cache.reduced_chi2_hist = {"reduced_chi2", b_reduced_chi2};
+    for (unsigned int D = 1u; D <= 2u; D++) {
+        const std::string dim = std::to_string(D) + "D";
+        cache.chi2_filtered_hist[D] = {"chi2_" + dim + "_filtered",
+                                       b_chi2_local};
+        cache.chi2_smoothed_hist[D] = {"chi2_" + dim + "_smoothed",
+                                       b_chi2_local};
+        cache.pval_filtered_hist[D] = {"pval_" + dim + "_filtered", b_pval};
+        cache.pval_smoothed_hist[D] = {"pval_" + dim + "_smoothed", b_pval};
+    }
 #endif  // TRACCC_HAVE_ROOT
 }
 
 void stat_plot_tool::fill(stat_plot_cache& cache,
                           const fitting_result<transform3>& fit_res) const {
 
-    // Avoid unused variable warnings when building the code without ROOT.
-    (void)cache;
-    (void)fit_res;
-
-#ifdef TRACCC_HAVE_ROOT
     const auto& ndf = fit_res.ndf;
     const auto& chi2 = fit_res.chi2;
+#ifdef TRACCC_HAVE_ROOT
     cache.ndf_hist->Fill(ndf);
     cache.chi2_hist->Fill(chi2);
     cache.reduced_chi2_hist->Fill(chi2 / ndf);
     cache.pval_hist->Fill(ROOT::Math::chisquared_cdf_c(chi2, ndf));
+#else
+    cache.ndf_hist.fill(ndf);
+    cache.chi2_hist.fill(chi2);
+    cache.reduced_chi2_hist.fill(chi2 / ndf);
 #endif  // TRACCC_HAVE_ROOT
 }
 
 void stat_plot_tool::fill(stat_plot_cache& cache,
                           const track_state<transform3>& trk_state) const {
 
-    // Avoid unused variable warnings when building the code without ROOT.
-    (void)cache;
-    (void)trk_state;
-
-#ifdef TRACCC_HAVE_ROOT
     const unsigned int D = trk_state.get_measurement().meas_dim;
     const auto filtered_chi2 = trk_state.filtered_chi2();
     const auto smoothed_chi2 = trk_state.smoothed_chi2();
+#ifdef TRACCC_HAVE_ROOT
     cache.chi2_filtered_hist[D]->Fill(filtered_chi2);
     cache.chi2_smoothed_hist[D]->Fill(smoothed_chi2);
     cache.pval_filtered_hist[D]->Fill(
         ROOT::Math::chisquared_cdf_c(filtered_chi2, D));
     cache.pval_smoothed_hist[D]->Fill(
         ROOT::Math::chisquared_cdf_c(smoothed_chi2, D));
+#else
+    cache.chi2_filtered_hist[D].fill(filtered_chi2);
+    cache.chi2_smoothed_hist[D].fill(smoothed_chi2);
+    cache.pval_filtered_hist[D].fill(chi2_pval(filtered_chi2, D));
+    cache.pval_smoothed_hist[D].fill(chi2_pval(smoothed_chi2, D));
 #endif  // TRACCC_HAVE_ROOT
 }
 
-void stat_plot_tool::write(const stat_plot_cache& cache) const {
+void stat_plot_tool::merge(stat_plot_cache& target,
+                           const stat_plot_cache& source) const {
 
-    // Avoid unused variable warnings when building the code without ROOT.
-    (void)cache;
+#ifdef TRACCC_HAVE_ROOT
+    target.ndf_hist->Add(source.ndf_hist.get());
+    target.chi2_hist->Add(source.chi2_hist.get());
+    target.reduced_chi2_hist->Add(source.reduced_chi2_hist.get());
+    target.pval_hist->Add(source.pval_hist.get());
+    for (const auto& [D, hist] : source.chi2_filtered_hist) {
+        target.chi2_filtered_hist.at(D)->Add(hist.get());
+    }
+    for (const auto& [D, hist] : source.chi2_smoothed_hist) {
+        target.chi2_smoothed_hist.at(D)->Add(hist.get());
+    }
+    for (const auto& [D, hist] : source.pval_filtered_hist) {
+        target.pval_filtered_hist.at(D)->Add(hist.get());
+    }
+    for (const auto& [D, hist] : source.pval_smoothed_hist) {
+        target.pval_smoothed_hist.at(D)->Add(hist.get());
+    }
+#else
+    target.ndf_hist.merge(source.ndf_hist);
+    target.chi2_hist.merge(source.chi2_hist);
+    target.reduced_chi2_hist.merge(source.reduced_chi2_hist);
+    for (const auto& [D, hist] : source.chi2_filtered_hist) {
+        target.chi2_filtered_hist.at(D).merge(hist);
+    }
+    for (const auto& [D, hist] : source.chi2_smoothed_hist) {
+        target.chi2_smoothed_hist.at(D).merge(hist);
+    }
+    for (const auto& [D, hist] : source.pval_filtered_hist) {
+        target.pval_filtered_hist.at(D).merge(hist);
+    }
+    for (const auto& [D, hist] : source.pval_smoothed_hist) {
+        target.pval_smoothed_hist.at(D).merge(hist);
+    }
+#endif  // TRACCC_HAVE_ROOT
+}
 
 #ifdef TRACCC_HAVE_ROOT
+void stat_plot_tool::write(const stat_plot_cache& cache) const {
+
     cache.ndf_hist->Write();
     cache.chi2_hist->Write();
     cache.reduced_chi2_hist->Write();
@@ -114,8 +182,28 @@ void stat_plot_tool::write(const stat_plot_cache& cache) const {
     for (const auto& smt : cache.pval_smoothed_hist) {
         smt.second->Write();
     }
+}
+#else
+void stat_plot_tool::write(const stat_plot_cache& cache,
+                           std::ostream& out) const {
 
-#endif  // TRACCC_HAVE_ROOT
+    cache.ndf_hist.write(out);
+    cache.chi2_hist.write(out);
+    cache.reduced_chi2_hist.write(out);
+
+    for (const auto& flt : cache.chi2_filtered_hist) {
+        flt.second.write(out);
+    }
+    for (const auto& smt : cache.chi2_smoothed_hist) {
+        smt.second.write(out);
+    }
+    for (const auto& flt : cache.pval_filtered_hist) {
+        flt.second.write(out);
+    }
+    for (const auto& smt : cache.pval_smoothed_hist) {
+        smt.second.write(out);
+    }
 }
+#endif  // TRACCC_HAVE_ROOT
 
 }  // namespace traccc
@@ -1,6 +1,6 @@
 /** TRACCC library, part of the ACTS project (R&D line)
  *
- * (c) 2023 CERN for the benefit of the ACTS project
+ * (c) 2023-2024 CERN for the benefit of the ACTS project
  *
  * Mozilla Public License Version 2.0
  */
@@ -9,11 +9,16 @@
 
 // Library include(s).
 #include "../utils/helpers.hpp"
+#include "../utils/light_plots.hpp"
 #include "traccc/resolution/stat_plot_tool_config.hpp"
 
 // Project include(s).
 #include "traccc/edm/track_state.hpp"
 
+// System include(s).
+#include <map>
+#include <ostream>
+
 namespace traccc {
 
 class stat_plot_tool {
@@ -38,6 +43,25 @@ class stat_plot_tool {
         std::map<unsigned int, std::unique_ptr<TH1>> pval_filtered_hist;
         // Histogram for p-value of smoothed states
         std::map<unsigned int, std::unique_ptr<TH1>> pval_smoothed_hist;
+#else
+        // Histogram for the number of DoFs
+        plot_helpers::light_histogram ndf_hist;
+        // Histogram for the chi sqaure
+        plot_helpers::light_histogram chi2_hist;
+        // Histogram for the chi2/ndf
+        plot_helpers::light_histogram reduced_chi2_hist;
+        // Histogram for chi2 of filtered states
+        std::map<unsigned int, plot_helpers::light_histogram>
+            chi2_filtered_hist;
+        // Histogram for chi2 of smoothed states
+        std::map<unsigned int, plot_helpers::light_histogram>
+            chi2_smoothed_hist;
+        // Histogram for p-value of filtered states
+        std::map<unsigned int, plot_helpers::light_histogram>
+            pval_filtered_hist;
+        // Histogram for p-value of smoothed states
+        std::map<unsigned int, plot_helpers::light_histogram>
+            pval_smoothed_hist;
 #endif  // TRACCC_HAVE_ROOT
     };
 
@@ -65,10 +89,24 @@ class stat_plot_tool {
     void fill(stat_plot_cache& cache,
               const track_state<transform3>& trk_state) const;
 
+    /// @brief merge the contents of one cache into another
+    ///
+    /// @param target the cache receiving the contents
+    /// @param source the cache to add to @c target
+    void merge(stat_plot_cache& target, const stat_plot_cache& source) const;
+
+#ifdef TRACCC_HAVE_ROOT
     /// @brief write the statistics plots into ROOT
     ///
     /// @param cache the cache for statistics plots
     void write(const stat_plot_cache& cache) const;
+#else
+    /// @brief write the statistics plots as CSV
+    ///
+    /// @param cache the cache for statistics plots
+    /// @param out stream to write the CSV table of the plots to
+    void write(const stat_plot_cache& cache, std::ostream& out) const;
+#endif  // TRACCC_HAVE_ROOT
 
     private:
     stat_plot_tool_config m_cfg;  ///< The Config class
@@ -1,6 +1,6 @@
 /** TRACCC library, part of the ACTS project (R&D line)
  *
- * (c) 2022 CERN for the benefit of the ACTS project
+ * (c) 2022-2024 CERN for the benefit of the ACTS project
  *
  * Mozilla Public License Version 2.0
  */
@@ -26,6 +26,9 @@ namespace traccc::plot_helpers {
 
 #ifdef TRACCC_HAVE_ROOT
 
+// The plots booked by these functions are not attached to any ROOT directory,
+// so that they could be booked and filled on multiple threads at once.
+
 /// @brief book a 1D histogram
 /// @param histName the name of histogram
 /// @param histTitle the title of histogram
@@ -0,0 +1,219 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Library include(s).
+#include "light_plots.hpp"
+
+// System include(s).
+#include <algorithm>
+#include <cmath>
+#include <filesystem>
+#include <iostream>
+#include <stdexcept>
+#include <utility>
+
+namespace traccc::plot_helpers {
+
+light_plot::light_plot(std::string_view name, const binning& var_binning)
+    : m_name(name), m_binning(var_binning) {}
+
+void light_plot::write_header(std::ostream& out) {
+
+    out << "plot,bin,low,high,value,error,entries\n";
+}
+
+std::size_t light_plot::find_bin(float x) const {
+
+    if (!(x >= m_binning.min)) {
+        return 0u;
+    }
+    if (x >= m_binning.max) {
+        return n_bins() - 1u;
+    }
+    const std::size_t n = static_cast<std::size_t>(m_binning.n_bins);
+    const std::size_t bin = static_cast<std::size_t>(
+        (x - m_binning.min) / (m_binning.max - m_binning.min) *
+        static_cast<float>(n));
+    return std::min(bin, n - 1u) + 1u;
+}
+
+std::size_t light_plot::n_bins() const {
+
+    return static_cast<std::size_t>(std::max(m_binning.n_bins, 0)) + 2u;
+}
+
+void light_plot::write_row(std::ostream& out, std::string_view name,
+                           std::size_t bin, double value, double error,
+                           double entries) const {
+
+    const double width =
+        (m_binning.max - m_binning.min) / static_cast<double>(n_bins() - 2u);
+    const double low = m_binning.min + static_cast<double>(bin - 1u) * width;
+    out << name << ',' << bin << ',' << low << ',' << low + width << ','
+        << value << ',' << error << ',' << entries << '\n';
+}
+
+light_histogram::light_histogram(std::string_view name,
+                                 const binning& var_binning)
+    : light_plot(name, var_binning),
+      m_sumw(n_bins(), 0.),
+      m_sumw2(n_bins(), 0.) {}
+
+void light_histogram::fill(float x, float weight) {
+
+    const std::size_t bin = find_bin(x);
+    m_sumw[bin] += weight;
+    m_sumw2[bin] += static_cast<double>(weight) * weight;
+}
+
+void light_histogram::merge(const light_histogram& other) {
+
+    if (other.m_sumw.size() != m_sumw.size()) {
+        throw std::invalid_argument("Incompatible histograms to merge: " +
+                                    m_name);
+    }
+    for (std::size_t i = 0; i < m_sumw.size(); ++i) {
+        m_sumw[i] += other.m_sumw[i];
+        m_sumw2[i] += other.m_sumw2[i];
+    }
+}
+
+void light_histogram::write(std::ostream& out) const {
+
+    for (std::size_t bin = 1; bin + 1 < m_sumw.size(); ++bin) {
+        write_row(out, m_name, bin, m_sumw[bin], std::sqrt(m_sumw2[bin]),
+                  m_sumw[bin]);
+    }
+}
+
+light_efficiency::light_efficiency(std::string_view name,
+                                   const binning& var_binning)
+    : light_plot(name, var_binning),
+      m_passed(n_bins(), 0u),
+      m_total(n_bins(), 0u) {}
+
+void light_efficiency::fill(bool passed, float x) {
+
+    const std::size_t bin = find_bin(x);
+    if (passed) {
+        ++(m_passed[bin]);
+    }
+    ++(m_total[bin]);
+}
+
+void light_efficiency::merge(const light_efficiency& other) {
+
+    if (other.m_total.size() != m_total.size()) {
+        throw std::invalid_argument("Incompatible efficiencies to merge: " +
+                                    m_name);
+    }
+    for (std::size_t i = 0; i < m_total.size(); ++i) {
+        m_passed[i] += other.m_passed[i];
+        m_total[i] += other.m_total[i];
+    }
+}
+
+void light_efficiency::write(std::ostream& out) const {
+
+    for (std::size_t bin = 1; bin + 1 < m_total.size(); ++bin) {
+        const double total = static_cast<double>(m_total[bin]);
+        const double eff =
+            (total > 0. ? static_cast<double>(m_passed[bin]) / total : 0.);
+        const double error =
+            (total > 0. ? std::sqrt(eff * (1. - eff) / total) : 0.);
+        write_row(out, m_name, bin, eff, error, total);
+    }
+}
+
+light_profile::light_profile(std::string_view name,
+                             const binning& var_binning)
+    : light_plot(name, var_binning),
+      m_n(n_bins(), 0u),
+      m_sum(n_bins(), 0.),
+      m_sum2(n_bins(), 0.) {}
+
+void light_profile::fill(float x, float y) {
+
+    const std::size_t bin = find_bin(x);
+    ++(m_n[bin]);
+    m_sum[bin] += y;
+    m_sum2[bin] += static_cast<double>(y) * y;
+}
+
+void light_profile::merge(const light_profile& other) {
+
+    if (other.m_n.size() != m_n.size()) {
+        throw std::invalid_argument("Incompatible profiles to merge: " +
+                                    m_name);
+    }
+    for (std::size_t i = 0; i < m_n.size(); ++i) {
+        m_n[i] += other.m_n[i];
+        m_sum[i] += other.m_sum[i];
+        m_sum2[i] += other.m_sum2[i];
+    }
+}
+
+namespace {
+
+/// Calculate the mean and RMS of the values in a profile bin
+std::pair<double, double> mean_and_rms(std::size_t n, double sum,
+                                       double sum2) {
+
+    if (n == 0u) {
+        return {0., 0.};
+    }
+    const double mean = sum / static_cast<double>(n);
+    const double var = sum2 / static_cast<double>(n) - mean * mean;
+    return {mean, std::sqrt(std::max(var, 0.))};
+}
+
+}  // namespace
+
+void light_profile::write(std::ostream& out) const {
+
+    for (std::size_t bin = 1; bin + 1 < m_n.size(); ++bin) {
+        const auto [mean, rms] =
+            mean_and_rms(m_n[bin], m_sum[bin], m_sum2[bin]);
+        const double n = static_cast<double>(m_n[bin]);
+        write_row(out, m_name, bin, mean, (n > 0. ? rms / std::sqrt(n) : 0.),
+                  n);
+    }
+}
+
+void light_profile::write_spread(std::ostream& out,
+                                 std::string_view name) const {
+
+    for (std::size_t bin = 1; bin + 1 < m_n.size(); ++bin) {
+        const auto [mean, rms] =
+            mean_and_rms(m_n[bin], m_sum[bin], m_sum2[bin]);
+        const double n = static_cast<double>(m_n[bin]);
+        write_row(out, name, bin, rms,
+                  (n > 0. ? rms / std::sqrt(2. * n) : 0.), n);
+    }
+}
+
+std::ofstream open_light_plots_file(const std::string& file_path,
+                                    std::string_view file_mode) {
+
+    const std::string csv_path =
+        std::filesystem::path(file_path).replace_extension(".csv").string();
+    const bool append = ((file_mode == "UPDATE") &&
+                         std::filesystem::exists(csv_path));
+    std::ofstream result(csv_path, (append ? std::ios::app : std::ios::trunc));
+    if (!result.good()) {
+        throw std::runtime_error("Could not open output file \"" + csv_path +
+                                 "\"");
+    }
+    std::cout << "ROOT is not available, writing plots into \"" << csv_path
+              << "\"" << std::endl;
+    if (!append) {
+        light_plot::write_header(result);
+    }
+    return result;
+}
+
+}  // namespace traccc::plot_helpers
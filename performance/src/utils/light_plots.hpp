@@ -0,0 +1,149 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Local include(s).
+#include "traccc/utils/helpers.hpp"
+
+// System include(s).
+#include <cstddef>
+#include <fstream>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace traccc::plot_helpers {
+
+/// @name Lightweight plots, used when the code is built without ROOT
+///
+/// The plots are written as CSV tables, with one row per (in-range) bin and
+/// columns "plot,bin,low,high,value,error,entries". Values falling outside
+/// of the binning are accumulated in under- and overflow bins, which are not
+/// written out.
+///
+/// @{
+
+/// Common base of the lightweight plots
+class light_plot {
+
+    public:
+    /// Constructor with the name and binning of the plot
+    light_plot(std::string_view name = "", const binning& var_binning = {});
+
+    /// The name of the plot
+    const std::string& name() const { return m_name; }
+
+    /// Write the header row of a CSV table of plots
+    static void write_header(std::ostream& out);
+
+    protected:
+    /// Find the bin (including under- and overflow) of a value
+    std::size_t find_bin(float x) const;
+    /// The number of bins, including under- and overflow
+    std::size_t n_bins() const;
+    /// Write one row of the CSV table of the plot
+    void write_row(std::ostream& out, std::string_view name, std::size_t bin,
+                   double value, double error, double entries) const;
+
+    /// Name of the plot
+    std::string m_name;
+    /// Binning of the plot
+    binning m_binning;
+
+};  // class light_plot
+
+/// Lightweight 1D histogram
+class light_histogram : public light_plot {
+
+    public:
+    /// Constructor with the name and binning of the histogram
+    light_histogram(std::string_view name = "",
+                    const binning& var_binning = {});
+
+    /// Fill the histogram with a (weighted) value
+    void fill(float x, float weight = 1.f);
+    /// Add the contents of another histogram, with the same binning
+    void merge(const light_histogram& other);
+    /// Write the histogram as CSV rows
+    void write(std::ostream& out) const;
+
+    private:
+    /// Sum of weights per bin
+    std::vector<double> m_sumw;
+    /// Sum of squared weights per bin
+    std::vector<double> m_sumw2;
+
+};  // class light_histogram
+
+/// Lightweight 1D efficiency plot
+class light_efficiency : public light_plot {
+
+    public:
+    /// Constructor with the name and binning of the plot
+    light_efficiency(std::string_view name = "",
+                     const binning& var_binning = {});
+
+    /// Fill the plot with the outcome of one trial
+    void fill(bool passed, float x);
+    /// Add the contents of another plot, with the same binning
+    void merge(const light_efficiency& other);
+    /// Write the efficiencies (with binomial errors) as CSV rows
+    void write(std::ostream& out) const;
+
+    private:
+    /// Number of passed trials per bin
+    std::vector<std::size_t> m_passed;
+    /// Number of all trials per bin
+    std::vector<std::size_t> m_total;
+
+};  // class light_efficiency
+
+/// Lightweight 1D profile plot
+class light_profile : public light_plot {
+
+    public:
+    /// Constructor with the name and binning of the plot
+    light_profile(std::string_view name = "",
+                  const binning& var_binning = {});
+
+    /// Fill the plot with a value at some position
+    void fill(float x, float y);
+    /// Add the contents of another plot, with the same binning
+    void merge(const light_profile& other);
+    /// Write the means (with their errors) as CSV rows
+    void write(std::ostream& out) const;
+    /// Write the RMS values (with their errors) as CSV rows
+    void write_spread(std::ostream& out, std::string_view name) const;
+
+    private:
+    /// Number of entries per bin
+    std::vector<std::size_t> m_n;
+    /// Sum of the values per bin
+    std::vector<double> m_sum;
+    /// Sum of the squared values per bin
+    std::vector<double> m_sum2;
+
+};  // class light_profile
+
+/// Open the CSV file that lightweight plots would be written to
+///
+/// The file is named after the would-be ROOT file, with its extension
+/// replaced by ".csv".
+///
+/// @param file_path The path of the (ROOT) output file
+/// @param file_mode The (ROOT) mode of the output file, "UPDATE" appending to
+///                  an existing CSV file
+/// @return The opened output stream
+///
+std::ofstream open_light_plots_file(const std::string& file_path,
+                                    std::string_view file_mode);
+
+/// @}
+
+}  // namespace traccc::plot_helpers
@@ -0,0 +1,102 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// ROOT include(s).
+#ifdef TRACCC_HAVE_ROOT
+#include <TROOT.h>
+#endif  // TRACCC_HAVE_ROOT
+
+// System include(s).
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+
+namespace traccc::details {
+
+/// Plot caches, with a separate instance for every thread filling them
+///
+/// The caches are booked lazily, the first time that a given thread asks
+/// for its own instance. So the filling of the plots never needs to be
+/// synchronised, and the instances are only merged in the end, when writing
+/// out the plots.
+///
+/// @tparam cache_t The type of the plot cache
+///
+template <typename cache_t>
+class thread_local_caches {
+
+    public:
+    /// Type of the function booking the plots of a new cache instance
+    using booker_type = std::function<void(cache_t&)>;
+
+    /// Constructor with the function booking new cache instances
+    explicit thread_local_caches(booker_type booker)
+        : m_booker(std::move(booker)) {
+#ifdef TRACCC_HAVE_ROOT
+        // Plots may be booked from multiple threads.
+        ROOT::EnableThreadSafety();
+#endif  // TRACCC_HAVE_ROOT
+    }
+
+    /// Access the cache instance of the current thread
+    cache_t& local() {
+
+        const std::thread::id id = std::this_thread::get_id();
+        std::lock_guard lock{m_mutex};
+        auto it = m_caches.find(id);
+        if (it == m_caches.end()) {
+            auto cache = std::make_unique<cache_t>();
+            m_booker(*cache);
+            it = m_caches.emplace(id, std::move(cache)).first;
+        }
+        return *(it->second);
+    }
+
+    /// Merge all cache instances into one, and return that
+    ///
+    /// The function must not be called concurrently with the filling of the
+    /// caches.
+    ///
+    /// @param merger Function adding the contents of its second argument to
+    ///               its first one
+    /// @return The cache holding the contents of all threads
+    ///
+    template <typename merger_t>
+    cache_t& merge(merger_t merger) {
+
+        std::lock_guard lock{m_mutex};
+        if (m_caches.empty()) {
+            // Make sure that (empty) plots would be written out even if no
+            // data was filled into them.
+            auto cache = std::make_unique<cache_t>();
+            m_booker(*cache);
+            m_caches.emplace(std::this_thread::get_id(), std::move(cache));
+        }
+        auto it = m_caches.begin();
+        cache_t& result = *(it->second);
+        for (++it; it != m_caches.end(); it = m_caches.erase(it)) {
+            merger(result, *(it->second));
+        }
+        return result;
+    }
+
+    private:
+    /// Function booking new cache instances
+    booker_type m_booker;
+    /// Mutex protecting the cache instances
+    std::mutex m_mutex;
+    /// Cache instances per thread
+    std::map<std::thread::id, std::unique_ptr<cache_t>> m_caches;
+
+};  // class thread_local_caches
+
+}  // namespace traccc::details
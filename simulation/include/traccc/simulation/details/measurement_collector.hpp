@@ -0,0 +1,100 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s).
+#include "traccc/definitions/primitives.hpp"
+#include "traccc/definitions/track_parametrization.hpp"
+#include "traccc/edm/cell.hpp"
+#include "traccc/edm/measurement.hpp"
+#include "traccc/io/csv/measurement.hpp"
+
+// Detray include(s).
+#include "detray/geometry/barcode.hpp"
+
+// System include(s).
+#include <array>
+#include <cstdint>
+#include <map>
+
+namespace traccc::details {
+
+/// Helper turning simulated (CSV) measurements into traccc measurements
+///
+/// The measurements, and the modules that they belong to, are constructed
+/// the same way as when reading them back from a CSV file.
+///
+class measurement_collector {
+
+    public:
+    /// Add a measurement to the collection
+    ///
+    /// @param iomeas The simulated measurement
+    /// @return The constructed measurement
+    ///
+    const measurement& add(const io::csv::measurement& iomeas) {
+
+        // Find the module of the measurement.
+        auto it = m_module_links.find(iomeas.geometry_id);
+        if (it == m_module_links.end()) {
+            cell_module mod;
+            mod.surface_link = detray::geometry::barcode{iomeas.geometry_id};
+            it = m_module_links
+                     .emplace(iomeas.geometry_id,
+                              static_cast<unsigned int>(m_modules.size()))
+                     .first;
+            m_modules.push_back(mod);
+        }
+
+        // Construct the measurement object. The local key tells which of the
+        // local coordinates were measured.
+        measurement meas;
+        std::array<typename transform3::size_type, 2u> indices{0u, 0u};
+        meas.meas_dim = 0u;
+        for (unsigned int ipar = 0; ipar < 2u; ++ipar) {
+            if (((iomeas.local_key) & (1 << (ipar + 1))) != 0) {
+                switch (ipar) {
+                    case e_bound_loc0: {
+                        meas.local[0] = iomeas.local0;
+                        meas.variance[0] = iomeas.var_local0;
+                        indices[meas.meas_dim++] = ipar;
+                    }; break;
+                    case e_bound_loc1: {
+                        meas.local[1] = iomeas.local1;
+                        meas.variance[1] = iomeas.var_local1;
+                        indices[meas.meas_dim++] = ipar;
+                    }; break;
+                }
+            }
+        }
+        meas.subs.set_indices(indices);
+        meas.surface_link = detray::geometry::barcode{iomeas.geometry_id};
+        meas.module_link = it->second;
+        meas.measurement_id = iomeas.measurement_id;
+        m_measurements.push_back(meas);
+        return m_measurements.back();
+    }
+
+    /// The collected measurements
+    measurement_collection_types::host& measurements() {
+        return m_measurements;
+    }
+    /// The modules of the collected measurements
+    cell_module_collection_types::host& modules() { return m_modules; }
+
+    private:
+    /// The collected measurements
+    measurement_collection_types::host m_measurements;
+    /// The modules of the collected measurements
+    cell_module_collection_types::host m_modules;
+    /// Module indices of the surfaces with measurements
+    std::map<std::uint64_t, unsigned int> m_module_links;
+
+};  // class measurement_collector
+
+}  // namespace traccc::details
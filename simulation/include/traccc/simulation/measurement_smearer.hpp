@@ -1,6 +1,6 @@
 /** TRACCC library, part of the ACTS project (R&D line)
  *
- * (c) 2023 CERN for the benefit of the ACTS project
+ * (c) 2023-2024 CERN for the benefit of the ACTS project
  *
  * Mozilla Public License Version 2.0
  */
@@ -8,7 +8,9 @@
 #pragma once
 
 // Project include(s).
+#include "traccc/definitions/qualifiers.hpp"
 #include "traccc/io/csv/measurement.hpp"
+#include "traccc/utils/philox.hpp"
 #include "traccc/utils/subspace.hpp"
 
 // Detray include(s).
@@ -18,11 +20,20 @@
 
 // System include(s).
 #include <array>
-#include <random>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
 #include <string>
 
 namespace traccc {
 
+/// Smearer of the simulated measurements
+///
+/// The offsets of the measurements are drawn with a counter-based random
+/// number generator, keyed by the seed (the event index) of the smearer,
+/// and by the particle and the surface of every hit. So they do not depend
+/// on the order in which the hits are smeared, or on the thread doing it.
+///
 template <typename transform3_t>
 struct measurement_smearer {
 
@@ -38,19 +49,57 @@ struct measurement_smearer {
                         const scalar_type stddev_local1)
         : stddev({stddev_local0, stddev_local1}) {}
 
-    measurement_smearer(measurement_smearer& smearer)
-        : stddev(smearer.stddev), generator(smearer.generator) {}
+    /// Identifier of one hit to smear
+    struct hit_key {
+        /// The particle making the hit
+        std::uint64_t particle_id = 0u;
+        /// The (barcode of the) surface of the hit
+        std::uint64_t surface_id = 0u;
+    };
 
-    void set_seed(const uint_fast64_t sd) { generator.seed(sd); }
+    void set_seed(const uint_fast64_t sd) { seed = sd; }
 
     std::array<scalar_type, 2> stddev;
-    std::random_device rd{};
-    std::mt19937_64 generator{rd()};
+    /// The seed of the random numbers of the smearer
+    uint_fast64_t seed = 0u;
+
+    /// The offsets of the measurement of one hit
+    ///
+    /// @param particle_id The particle making the hit
+    /// @param surface_id The (barcode of the) surface of the hit
+    ///
+    TRACCC_HOST_DEVICE
+    std::array<scalar_type, 2> get_offset(std::uint64_t particle_id,
+                                          std::uint64_t surface_id) const {
+        const std::array<scalar, 2> normal =
+            philox4x32::normal(seed, particle_id, surface_id);
+        return {static_cast<scalar_type>(normal[0]) * stddev[0],
+                static_cast<scalar_type>(normal[1]) * stddev[1]};
+    }
+
+    /// The offsets of the measurements of (all) hits of an event, in one
+    /// pass
+    ///
+    /// The hits are independent of each other, so the loop can be
+    /// vectorised, and gives the same offsets as @c get_offset(...) does
+    /// for the individual hits.
+    ///
+    /// @param hits The hits to smear
+    /// @param n_hits The number of hits to smear
+    /// @param[out] offsets The offsets of the hits
+    ///
+    void get_offsets(const hit_key* hits, std::size_t n_hits,
+                     std::array<scalar_type, 2>* offsets) const {
+        for (std::size_t i = 0; i < n_hits; ++i) {
+            offsets[i] = get_offset(hits[i].particle_id, hits[i].surface_id);
+        }
+    }
 
-    std::array<scalar_type, 2> get_offset() {
-        return {
-            std::normal_distribution<scalar_type>(0.f, stddev[0])(generator),
-            std::normal_distribution<scalar_type>(0.f, stddev[1])(generator)};
+    /// @c get_offsets(...) for containers of hits and offsets
+    template <typename hits_t, typename offsets_t>
+    void get_offsets(const hits_t& hits, offsets_t& offsets) const {
+        assert(offsets.size() == hits.size());
+        get_offsets(hits.data(), hits.size(), offsets.data());
     }
 
     template <typename mask_t>
@@ -21,8 +21,15 @@
 #include "detray/simulation/random_scatterer.hpp"
 
 // System include(s).
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <future>
 #include <limits>
 #include <memory>
+#include <type_traits>
+#include <utility>
+#include <vector>
 
 namespace traccc {
 
@@ -34,6 +41,8 @@ struct simulator {
 
     struct config {
         detray::propagation::config<scalar_type> propagation;
+        /// Number of threads to simulate the events with
+        std::size_t n_threads = 1u;
     };
 
     using transform3 = typename detector_t::transform3;
@@ -51,6 +60,10 @@ struct simulator {
     using propagator_type =
         detray::propagator<stepper_type, navigator_type, actor_chain_type>;
 
+    /// Type of the tracks produced by the track generator
+    using track_type = std::decay_t<decltype(
+        *(std::declval<track_generator_t&>().begin()))>;
+
     simulator(std::size_t events, const detector_t& det,
               const bfield_type& field, track_generator_t&& track_gen,
               typename writer_t::config&& writer_cfg,
@@ -65,43 +78,96 @@ struct simulator {
 
     config& get_config() { return m_cfg; }
 
+    /// Simulate all events
+    ///
+    /// The events are simulated by @c config::n_threads threads in parallel.
+    /// The tracks of the events are generated in event order, and the random
+    /// numbers of the material interactions are seeded by the event index.
+    /// The measurement smearing uses counter-based random numbers, keyed by
+    /// the event, the particle and the surface of every hit. So the output
+    /// does not depend on the number of threads used.
+    ///
     void run() {
 
-        for (std::size_t event_id = 0u; event_id < m_events; event_id++) {
+        const std::size_t n_threads =
+            std::max<std::size_t>(m_cfg.n_threads, 1u);
+        const std::size_t batch_size = 4u * n_threads;
 
-            typename writer_t::state writer_state(
-                event_id, std::move(m_writer_cfg), m_directory);
+        std::vector<std::vector<track_type>> tracks;
+        for (std::size_t first = 0u; first < m_events; first += batch_size) {
 
-            // Set random seed
-            m_scatterer.set_seed(event_id);
-            writer_state.set_seed(event_id);
+            // Generate the tracks of the next batch of events.
+            tracks.resize(std::min(batch_size, m_events - first));
+            for (std::vector<track_type>& event_tracks : tracks) {
+                event_tracks.clear();
+                for (auto track : *m_track_generator.get()) {
+                    event_tracks.push_back(track);
+                }
+            }
 
-            auto actor_states =
-                std::tie(m_transporter, m_scatterer, m_resetter, writer_state);
+            // Simulate the events of the batch in parallel.
+            std::atomic<std::size_t> next{0u};
+            auto simulate_events = [&]() {
+                for (std::size_t i = next++; i < tracks.size(); i = next++) {
+                    simulate_event(first + i, tracks[i]);
+                }
+            };
+            std::vector<std::future<void>> workers;
+            for (std::size_t i = 1u; i < n_threads; ++i) {
+                workers.push_back(
+                    std::async(std::launch::async, simulate_events));
+            }
+            simulate_events();
+            for (std::future<void>& worker : workers) {
+                worker.get();
+            }
+        }
+    }
 
-            for (auto track : *m_track_generator.get()) {
+    private:
+    /// Simulate a single event, with its own propagator and actor states
+    void simulate_event(std::size_t event_id,
+                        const std::vector<track_type>& tracks) const {
 
-                writer_state.write_particle(track);
+        typename writer_t::config writer_cfg = m_writer_cfg;
+        typename writer_t::state writer_state(event_id, std::move(writer_cfg),
+                                              m_directory);
 
-                typename propagator_type::state propagation(track, m_field,
-                                                            m_detector);
+        // Actor states
+        typename detray::parameter_transporter<transform3>::state transporter{};
+        typename detray::random_scatterer<transform3>::state scatterer{};
+        typename detray::parameter_resetter<transform3>::state resetter{};
 
-                propagator_type p(m_cfg.propagation);
+        // Set random seed
+        scatterer.set_seed(event_id);
+        writer_state.set_seed(event_id);
 
-                // Set overstep tolerance and stepper constraint
-                propagation._stepping.template set_constraint<
-                    detray::step::constraint::e_accuracy>(
-                    m_cfg.propagation.stepping.step_constraint);
+        auto actor_states =
+            std::tie(transporter, scatterer, resetter, writer_state);
 
-                p.propagate(propagation, actor_states);
+        propagator_type p(m_cfg.propagation);
 
-                // Increase the particle id
-                writer_state.particle_id++;
-            }
+        for (const auto& track : tracks) {
+
+            writer_state.write_particle(track);
+
+            typename propagator_type::state propagation(track, m_field,
+                                                        m_detector);
+
+            // Set overstep tolerance and stepper constraint
+            propagation._stepping.template set_constraint<
+                detray::step::constraint::e_accuracy>(
+                m_cfg.propagation.stepping.step_constraint);
+
+            p.propagate(propagation, actor_states);
+
+            // Increase the particle id
+            writer_state.particle_id++;
         }
+
+        writer_state.flush();
     }
 
-    private:
     config m_cfg;
     std::size_t m_events{0u};
     std::string m_directory = "";
@@ -109,11 +175,6 @@ struct simulator {
     const bfield_type& m_field;
     std::unique_ptr<track_generator_t> m_track_generator;
     typename writer_t::config m_writer_cfg;
-
-    /// Actor states
-    typename detray::parameter_transporter<transform3>::state m_transporter{};
-    typename detray::random_scatterer<transform3>::state m_scatterer{};
-    typename detray::parameter_resetter<transform3>::state m_resetter{};
 };
 
 }  // namespace traccc
@@ -0,0 +1,275 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s).
+#include "traccc/edm/cell.hpp"
+#include "traccc/edm/measurement.hpp"
+#include "traccc/edm/particle.hpp"
+#include "traccc/edm/track_candidate.hpp"
+#include "traccc/edm/track_parameters.hpp"
+#include "traccc/io/csv/measurement.hpp"
+#include "traccc/simulation/details/measurement_collector.hpp"
+#include "traccc/simulation/smearing_writer.hpp"
+
+// Detray core include(s).
+#include "detray/propagator/base_actor.hpp"
+#include "detray/tracks/free_track_parameters.hpp"
+
+// VecMem include(s).
+#include <vecmem/memory/memory_resource.hpp>
+
+// System include(s).
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace traccc {
+
+/// Simulated event, recorded in memory
+struct simulated_event {
+
+    /// Truth information about the measurements of one particle
+    struct truth_track {
+        /// Index of the particle in @c traccc::simulated_event::particles
+        std::size_t particle_index = 0u;
+        /// Truth track parameters on the surface of the first measurement
+        free_track_parameters first_hit;
+        /// The measurements of the particle, in the order of the hits
+        std::vector<measurement> measurements;
+    };
+
+    /// The smeared measurements, sorted by their surfaces
+    measurement_collection_types::host measurements;
+    /// The modules of the measurements
+    cell_module_collection_types::host modules;
+    /// The simulated particles
+    particle_collection_types::host particles;
+    /// The truth tracks of the particles with at least one measurement
+    std::vector<truth_track> truth_tracks;
+
+    /// Generate truth track candidates, the same way as
+    /// @c traccc::event_map2::generate_truth_candidates does from files
+    ///
+    /// @param sg The seed generator to create the track parameters with
+    /// @param resource The memory resource for the output container
+    /// @return The truth track candidates, with (smeared) seeds as headers
+    ///
+    template <typename seed_generator_t>
+    track_candidate_container_types::host truth_candidates(
+        seed_generator_t& sg, vecmem::memory_resource& resource) const {
+
+        track_candidate_container_types::host result(&resource);
+        for (const truth_track& track : truth_tracks) {
+            vecmem::vector<track_candidate> candidates(
+                track.measurements.begin(), track.measurements.end(),
+                &resource);
+            result.push_back(
+                sg(track.measurements.front().surface_link, track.first_hit),
+                std::move(candidates));
+        }
+        return result;
+    }
+
+    /// Generate truth seeds for the track finding
+    ///
+    /// @param sg The seed generator to create the track parameters with
+    /// @param resource The memory resource for the output collection
+    /// @return One seed for every truth track
+    ///
+    template <typename seed_generator_t>
+    bound_track_parameters_collection_types::host truth_seeds(
+        seed_generator_t& sg, vecmem::memory_resource& resource) const {
+
+        bound_track_parameters_collection_types::host result(&resource);
+        result.reserve(truth_tracks.size());
+        for (const truth_track& track : truth_tracks) {
+            result.push_back(
+                sg(track.measurements.front().surface_link, track.first_hit));
+        }
+        return result;
+    }
+
+};  // struct simulated_event
+
+/// Storage for the events recorded by @c traccc::smearing_recorder
+///
+/// Events may be added to it concurrently, by the threads of
+/// @c traccc::simulator.
+///
+class simulated_event_store {
+
+    public:
+    /// Add (or replace) the event with a given index
+    void insert(std::size_t event_id, simulated_event&& event) {
+
+        std::lock_guard lock{m_mutex};
+        if (m_events.size() <= event_id) {
+            m_events.resize(event_id + 1u);
+        }
+        m_events[event_id] = std::move(event);
+    }
+
+    /// The recorded events, indexed by their event index
+    ///
+    /// Must not be called concurrently with the recording of new events.
+    ///
+    std::vector<simulated_event>& events() { return m_events; }
+    /// The recorded events, indexed by their event index
+    const std::vector<simulated_event>& events() const { return m_events; }
+
+    private:
+    /// Mutex protecting the event storage
+    std::mutex m_mutex;
+    /// The recorded events
+    std::vector<simulated_event> m_events;
+
+};  // class simulated_event_store
+
+/// Actor recording smeared measurements and truth particles in memory
+///
+/// It can be used with @c traccc::simulator in place of
+/// @c traccc::smearing_writer, to feed simulated events straight into the
+/// reconstruction, without going through files on disk.
+///
+template <typename smearer_t>
+struct smearing_recorder : detray::actor {
+
+    using transform3_type = typename smearer_t::transform3_type;
+    using scalar_type = typename transform3_type::scalar_type;
+
+    struct config {
+        smearer_t smearer;
+        /// The storage to record the simulated events into
+        simulated_event_store* output = nullptr;
+    };
+
+    struct state {
+        /// Constructor with the same signature as
+        /// @c traccc::smearing_writer::state, ignoring the output directory
+        state(std::size_t event_id, config&& recorder_cfg,
+              const std::string /*directory*/ = "")
+            : m_meas_smearer(recorder_cfg.smearer),
+              m_event_id(event_id),
+              m_output(recorder_cfg.output) {
+
+            if (m_output == nullptr) {
+                throw std::invalid_argument(
+                    "No output storage given to the smearing recorder");
+            }
+        }
+
+        uint64_t particle_id = 0u;
+        uint64_t m_hit_count = 0u;
+        smearer_t m_meas_smearer;
+
+        void set_seed(const uint_fast64_t sd) { m_meas_smearer.set_seed(sd); }
+
+        /// Record a simulated particle
+        void write_particle(
+            const detray::free_track_parameters<transform3_type>& track) {
+
+            particle ptc;
+            ptc.particle_id = particle_id;
+            ptc.particle_type = 0;
+            ptc.process = 0;
+            ptc.pos = track.pos();
+            ptc.time = track.time();
+            ptc.mom = track.mom();
+            ptc.mass = 0.f;
+            ptc.charge = track.charge();
+            m_event.particles.push_back(ptc);
+        }
+
+        /// Record a measurement of the current particle
+        void write_measurement(
+            const io::csv::measurement& iomeas,
+            const detray::free_track_parameters<transform3_type>& track) {
+
+            const measurement& meas = m_collector.add(iomeas);
+
+            const std::size_t particle_index = m_event.particles.size() - 1u;
+            if (m_event.truth_tracks.empty() ||
+                (m_event.truth_tracks.back().particle_index !=
+                 particle_index)) {
+                simulated_event::truth_track truth;
+                truth.particle_index = particle_index;
+                truth.first_hit = free_track_parameters(
+                    track.pos(), track.time(), track.mom(), track.charge());
+                m_event.truth_tracks.push_back(std::move(truth));
+            }
+            m_event.truth_tracks.back().measurements.push_back(meas);
+        }
+
+        /// Hand over the recorded event to the output storage
+        void flush() {
+
+            m_event.measurements = std::move(m_collector.measurements());
+            m_event.modules = std::move(m_collector.modules());
+            // The track finding expects the measurements to be sorted by
+            // their surfaces.
+            std::stable_sort(m_event.measurements.begin(),
+                             m_event.measurements.end(),
+                             measurement_sort_comp());
+            m_output->insert(m_event_id, std::move(m_event));
+        }
+
+        private:
+        /// Index of the event being recorded
+        std::size_t m_event_id;
+        /// The storage to hand the event over to
+        simulated_event_store* m_output;
+        /// Helper constructing the measurements and their modules
+        details::measurement_collector m_collector;
+        /// The event being recorded
+        simulated_event m_event;
+    };
+
+    template <typename propagator_state_t>
+    void operator()(state& recorder_state,
+                    propagator_state_t& propagation) const {
+
+        auto& navigation = propagation._navigation;
+        auto& stepping = propagation._stepping;
+
+        // triggered only for sensitive surfaces
+        if (navigation.is_on_sensitive()) {
+
+            const auto sf = navigation.get_surface();
+            const auto bound_params = stepping._bound_params;
+
+            // Smear the measurement, the same way as smearing_writer does
+            io::csv::measurement meas;
+            meas.measurement_id = recorder_state.m_hit_count;
+            meas.geometry_id = sf.barcode().value();
+            auto stddev_0 = recorder_state.m_meas_smearer.stddev[0];
+            auto stddev_1 = recorder_state.m_meas_smearer.stddev[1];
+            meas.var_local0 = stddev_0 * stddev_0;
+            meas.var_local1 = stddev_1 * stddev_1;
+            meas.phi = bound_params.phi();
+            meas.theta = bound_params.theta();
+            meas.time = bound_params.time();
+
+            // Set local_key and smeared_local
+            sf.template visit_mask<
+                typename smearing_writer<smearer_t>::measurement_kernel>(
+                bound_params, recorder_state.m_meas_smearer,
+                recorder_state.particle_id, meas);
+
+            recorder_state.write_measurement(meas, stepping());
+            recorder_state.m_hit_count++;
+        }
+    }
+};
+
+}  // namespace traccc
@@ -8,11 +8,16 @@
 #pragma once
 
 // Project include(s).
+#include "traccc/edm/cell.hpp"
+#include "traccc/edm/measurement.hpp"
 #include "traccc/io/csv/hit.hpp"
 #include "traccc/io/csv/measurement.hpp"
 #include "traccc/io/csv/measurement_hit_id.hpp"
 #include "traccc/io/csv/particle.hpp"
+#include "traccc/io/data_format.hpp"
 #include "traccc/io/utils.hpp"
+#include "traccc/io/write.hpp"
+#include "traccc/simulation/details/measurement_collector.hpp"
 #include "traccc/simulation/measurement_smearer.hpp"
 
 // Detray core include(s).
@@ -25,6 +30,12 @@
 #include <dfe/dfe_io_dsv.hpp>
 #include <dfe/dfe_namedtuple.hpp>
 
+// System include(s).
+#include <cstdint>
+#include <optional>
+#include <stdexcept>
+#include <string>
+
 namespace traccc {
 
 template <typename smearer_t>
@@ -41,6 +52,13 @@ struct smearing_writer : detray::actor {
 
     struct config {
         smearer_t smearer;
+        /// Format of the measurement files (@c traccc::data_format::csv or
+        /// @c traccc::data_format::binary)
+        ///
+        /// The truth information (particles, hits and the measurement-hit
+        /// map) is always written in CSV format.
+        ///
+        data_format format = data_format::csv;
     };
 
     struct state {
@@ -50,23 +68,63 @@ struct smearing_writer : detray::actor {
                                                 event_id, "-particles.csv")),
               m_hit_writer(directory + traccc::io::get_event_filename(
                                            event_id, "-hits.csv")),
-              m_meas_writer(directory + traccc::io::get_event_filename(
-                                            event_id, "-measurements.csv")),
               m_measurement_hit_id_writer(
                   directory + traccc::io::get_event_filename(
                                   event_id, "-measurement-simhit-map.csv")),
-              m_meas_smearer(writer_cfg.smearer) {}
+              m_meas_smearer(writer_cfg.smearer),
+              m_format(writer_cfg.format),
+              m_event_id(event_id),
+              m_directory(directory) {
+
+            switch (m_format) {
+                case data_format::csv:
+                    m_meas_writer.emplace(
+                        directory + traccc::io::get_event_filename(
+                                        event_id, "-measurements.csv"));
+                    break;
+                case data_format::binary:
+                    break;
+                default:
+                    throw std::invalid_argument(
+                        "Unsupported measurement data format");
+            }
+        }
 
         uint64_t particle_id = 0u;
         particle_writer m_particle_writer;
         hit_writer m_hit_writer;
-        measurement_writer m_meas_writer;
+        std::optional<measurement_writer> m_meas_writer;
         measurement_hit_id_writer m_measurement_hit_id_writer;
         uint64_t m_hit_count = 0u;
         smearer_t m_meas_smearer;
 
         void set_seed(const uint_fast64_t sd) { m_meas_smearer.set_seed(sd); }
 
+        /// Write a measurement, in the configured format
+        void write_measurement(const io::csv::measurement& iomeas) {
+
+            if (m_meas_writer) {
+                m_meas_writer->append(iomeas);
+                return;
+            }
+
+            m_collector.add(iomeas);
+        }
+
+        /// Write out the measurements collected for a binary output file
+        void flush() {
+
+            if (m_format != data_format::binary) {
+                return;
+            }
+            io::write(m_directory + traccc::io::get_event_filename(
+                                        m_event_id, "-measurements.dat"),
+                      m_directory + traccc::io::get_event_filename(
+                                        m_event_id, "-modules.dat"),
+                      m_format, vecmem::get_data(m_collector.measurements()),
+                      vecmem::get_data(m_collector.modules()));
+        }
+
         void write_particle(
             const detray::free_track_parameters<transform3_type>& track) {
             io::csv::particle particle;
@@ -85,6 +143,16 @@ struct smearing_writer : detray::actor {
 
             m_particle_writer.append(particle);
         }
+
+        private:
+        /// Format of the measurement output
+        data_format m_format;
+        /// Index of the event being written
+        std::size_t m_event_id;
+        /// Directory to write the output files into
+        std::string m_directory;
+        /// Measurements (and modules) collected for a binary output file
+        details::measurement_collector m_collector;
     };
 
     struct measurement_kernel {
@@ -93,11 +161,15 @@ struct smearing_writer : detray::actor {
         inline void operator()(
             const mask_group_t& mask_group, const index_t& index,
             const detray::bound_track_parameters<transform3_type>& bound_params,
-            smearer_t& smearer, io::csv::measurement& iomeas) const {
+            smearer_t& smearer, const std::uint64_t particle_id,
+            io::csv::measurement& iomeas) const {
 
             const auto& mask = mask_group[index];
 
-            smearer(mask, smearer.get_offset(), bound_params, iomeas);
+            // The offsets are keyed by the particle and the surface of the
+            // hit, so they do not depend on the order of the smearing.
+            smearer(mask, smearer.get_offset(particle_id, iomeas.geometry_id),
+                    bound_params, iomeas);
         }
     };
 
@@ -148,9 +220,10 @@ struct smearing_writer : detray::actor {
 
             // Set local_key and smeared_local
             sf.template visit_mask<measurement_kernel>(
-                bound_params, writer_state.m_meas_smearer, meas);
+                bound_params, writer_state.m_meas_smearer,
+                writer_state.particle_id, meas);
 
-            writer_state.m_meas_writer.append(meas);
+            writer_state.write_measurement(meas);
 
             // Write hit measurement map
             io::csv::measurement_hit_id measurement_hit_id;
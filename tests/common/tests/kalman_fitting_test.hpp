@@ -10,6 +10,7 @@
 // Project include(s).
 #include "traccc/definitions/common.hpp"
 #include "traccc/fitting/kalman_filter/kalman_fitter.hpp"
+#include "traccc/navigation/planar_navigator.hpp"
 
 // detray include(s).
 #include "detray/core/detector.hpp"
@@ -62,6 +63,10 @@ class KalmanFittingTests
     using host_navigator_type = detray::navigator<const host_detector_type>;
     using host_fitter_type =
         kalman_fitter<rk_stepper_type, host_navigator_type>;
+    using host_planar_navigator_type =
+        planar_navigator<const host_detector_type>;
+    using host_planar_fitter_type =
+        kalman_fitter<rk_stepper_type, host_planar_navigator_type>;
     using device_navigator_type = detray::navigator<const device_detector_type>;
     using device_fitter_type =
         kalman_fitter<rk_stepper_type, device_navigator_type>;
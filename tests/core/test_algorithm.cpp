@@ -214,3 +214,56 @@ TEST(algorithm, partial_application_compose) {
     ASSERT_EQ(f(-1), 14);
     ASSERT_EQ(f(5), 20);
 }
+
+TEST(algorithm, chain_double_int) {
+    double_int i;
+    double_int_affine j;
+
+    auto f = traccc::chain(std::cref(i), std::cref(j), std::cref(i));
+
+    ASSERT_EQ(f(1), 8);
+    ASSERT_EQ(f(-1), -8);
+    ASSERT_EQ(f(5), 40);
+}
+
+TEST(algorithm, chain_string_lambda) {
+    double_string_regular i;
+
+    auto f = traccc::chain(
+        std::cref(i), [](std::string &&s) { return s.size(); },
+        [](std::size_t n) { return static_cast<int>(n) + 1; });
+
+    ASSERT_EQ(f("hello"), 11);
+    ASSERT_EQ(f(std::string("bye")), 7);
+}
+
+TEST(algorithm, chain_many_arguments) {
+    add i;
+    double_int j;
+
+    auto f = traccc::chain(i, j);
+
+    ASSERT_EQ(f(1, 2), 6);
+    ASSERT_EQ(f(-1, 5), 8);
+}
+
+TEST(algorithm, async_adaptor_regular) {
+    add i;
+    traccc::async_adaptor<int(const int &, const int &)> a(i);
+
+    std::future<int> f1 = a.submit(1, 2);
+    std::future<int> f2 = a.submit(5, 5);
+
+    ASSERT_EQ(f1.get(), 3);
+    ASSERT_EQ(f2.get(), 10);
+}
+
+TEST(algorithm, async_adaptor_affine) {
+    double_string_affine i;
+    traccc::async_adaptor<std::string(std::string &&)> a(i);
+
+    std::string s = "test";
+    std::future<std::string> f = a.submit(std::move(s));
+
+    ASSERT_EQ(f.get(), "testtest");
+}
@@ -8,6 +8,7 @@
 
 // Project include(s).
 #include "traccc/definitions/primitives.hpp"
+#include "traccc/geometry/hashed_module_map.hpp"
 #include "traccc/geometry/module_map.hpp"
 #include "traccc/io/details/read_surfaces.hpp"
 #include "traccc/io/utils.hpp"
@@ -164,3 +165,67 @@ TEST(geometry, module_map_read_trackml) {
         ASSERT_EQ(map.at(i.first), i.second);
     }
 }
+
+/*
+ * Simple test of the hashed map, using integers and strings.
+ */
+TEST(geometry, hashed_module_map_simple) {
+    std::map<std::size_t, std::string> inp{{0, "zero"},    {1, "one"},
+                                           {2, "two"},     {5, "five"},
+                                           {11, "eleven"}, {21, "twenty-one"}};
+
+    traccc::hashed_module_map<std::size_t, std::string> map(inp);
+
+    ASSERT_EQ(map.size(), inp.size());
+    ASSERT_GE(map.n_slots(), 2 * inp.size());
+
+    for (const auto& [key, value] : inp) {
+        ASSERT_TRUE(map.contains(key));
+        ASSERT_EQ(map.at(key), value);
+        ASSERT_EQ(map[key], value);
+    }
+    ASSERT_FALSE(map.contains(3));
+    ASSERT_FALSE(map.contains(15));
+    ASSERT_FALSE(map.contains(510482));
+    ASSERT_THROW(map.at(100), std::out_of_range);
+}
+
+/*
+ * Check that an empty hashed map does not find anything.
+ */
+TEST(geometry, hashed_module_map_empty) {
+    std::map<std::size_t, std::string> inp{};
+
+    traccc::hashed_module_map<std::size_t, std::string> map(inp);
+
+    ASSERT_TRUE(map.empty());
+    ASSERT_FALSE(map.contains(0));
+    ASSERT_THROW(map.at(0), std::out_of_range);
+}
+
+/*
+ * Check that the lookups through a view of the hashed map give the same
+ * results as the (tree based) module map, for the TrackML detector.
+ */
+TEST(geometry, hashed_module_map_read_trackml) {
+
+    const std::string file =
+        traccc::io::data_directory() + "tml_detector/trackml-detector.csv";
+    std::map<traccc::geometry_id, traccc::transform3> inp =
+        traccc::io::details::read_surfaces(file);
+
+    const traccc::module_map<> tree(inp);
+    const traccc::hashed_module_map<> map(tree);
+    ASSERT_EQ(map.size(), inp.size());
+
+    const traccc::hashed_module_map_device<> device(map.view());
+    ASSERT_EQ(device.size(), inp.size());
+    for (const std::map<traccc::geometry_id, traccc::transform3>::value_type
+             &i : inp) {
+        const traccc::transform3* value = device.find(i.first);
+        ASSERT_NE(value, nullptr);
+        ASSERT_EQ(*value, i.second);
+        ASSERT_EQ(*value, tree.at(i.first));
+    }
+    ASSERT_EQ(device.find(0u), nullptr);
+}
@@ -0,0 +1,191 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Project include(s).
+#include "traccc/ambiguity_resolution/flat_greedy_ambiguity_resolution_algorithm.hpp"
+#include "traccc/ambiguity_resolution/greedy_ambiguity_resolution_algorithm.hpp"
+#include "traccc/edm/measurement.hpp"
+#include "traccc/edm/track_state.hpp"
+
+// VecMem include(s).
+#include <vecmem/memory/host_memory_resource.hpp>
+
+// GTest include(s).
+#include <gtest/gtest.h>
+
+// System include(s).
+#include <algorithm>
+#include <numeric>
+#include <random>
+#include <vector>
+
+using namespace traccc;
+
+namespace {
+
+/// Make random tracks, sharing measurements with each other
+track_state_container_types::host make_tracks(std::size_t n_tracks,
+                                              std::size_t n_measurements,
+                                              vecmem::memory_resource& mr) {
+
+    std::mt19937 gen(1234u);
+    std::uniform_int_distribution<std::size_t> length(3u, 10u);
+    // Few distinct chi-squares, to exercise the tie breaking
+    std::uniform_int_distribution<int> chi2(0, 5);
+
+    std::vector<std::size_t> ids(n_measurements);
+    std::iota(ids.begin(), ids.end(), 0u);
+
+    track_state_container_types::host tracks(&mr);
+    for (std::size_t i = 0; i < n_tracks; ++i) {
+        std::shuffle(ids.begin(), ids.end(), gen);
+        fitting_result<transform3> header;
+        header.chi2 = static_cast<scalar>(chi2(gen));
+        vecmem::vector<track_state<transform3>> states(&mr);
+        const std::size_t n = length(gen);
+        for (std::size_t j = 0; j < n; ++j) {
+            measurement meas;
+            meas.measurement_id = ids[j];
+            states.emplace_back(meas);
+        }
+        tracks.push_back(header, std::move(states));
+    }
+    return tracks;
+}
+
+/// Add a track with the given measurements to a container
+void add_track(track_state_container_types::host& tracks, scalar chi2,
+               const std::vector<std::size_t>& ids,
+               vecmem::memory_resource& mr) {
+
+    fitting_result<transform3> header;
+    header.chi2 = chi2;
+    vecmem::vector<track_state<transform3>> states(&mr);
+    for (std::size_t id : ids) {
+        measurement meas;
+        meas.measurement_id = id;
+        states.emplace_back(meas);
+    }
+    tracks.push_back(header, std::move(states));
+}
+
+/// The measurement identifiers of every track of a container
+std::vector<std::vector<std::size_t>> measurement_ids(
+    const track_state_container_types::host& tracks) {
+
+    std::vector<std::vector<std::size_t>> result;
+    for (std::size_t i = 0; i < tracks.size(); ++i) {
+        std::vector<std::size_t> ids;
+        for (auto const& st : tracks.at(i).items) {
+            ids.push_back(st.get_measurement().measurement_id);
+        }
+        result.push_back(std::move(ids));
+    }
+    return result;
+}
+
+}  // namespace
+
+// Compare the flat resolution with the node based one
+TEST(ambiguity_resolution, flat_greedy) {
+
+    vecmem::host_memory_resource host_mr;
+
+    // The tracks have 3 to 10 measurements, so that with the larger minimum
+    // some of them are rejected up front.
+    for (std::size_t n_meas_min : {3u, 6u}) {
+        for (std::uint32_t max_shared : {1u, 2u, 3u}) {
+            for (std::size_t n_measurements : {50u, 200u, 1000u}) {
+
+                const track_state_container_types::host tracks =
+                    make_tracks(300u, n_measurements, host_mr);
+
+                greedy_ambiguity_resolution_algorithm::config_t cfg;
+                cfg.maximum_shared_hits = max_shared;
+                cfg.n_measurements_min = n_meas_min;
+                cfg.check_obvious_errs = false;
+                cfg.verbose_info = false;
+                cfg.verbose_error = false;
+                greedy_ambiguity_resolution_algorithm resolution(cfg);
+
+                flat_greedy_ambiguity_resolution_algorithm::config_t flat_cfg;
+                flat_cfg.maximum_shared_hits = max_shared;
+                flat_cfg.n_measurements_min = n_meas_min;
+                flat_greedy_ambiguity_resolution_algorithm flat_resolution(
+                    flat_cfg);
+
+                const auto expected = resolution(tracks);
+                const auto result = flat_resolution(tracks);
+
+                ASSERT_EQ(result.size(), expected.size());
+                EXPECT_EQ(measurement_ids(result), measurement_ids(expected));
+                for (std::size_t i = 0; i < result.size(); ++i) {
+                    EXPECT_EQ(result.at(i).header.chi2,
+                              expected.at(i).header.chi2);
+                }
+            }
+        }
+    }
+}
+
+// Check the tracks selected among tracks that partly fail the minimum number
+// of measurements, against a hand-computed result
+TEST(ambiguity_resolution, too_short_tracks) {
+
+    vecmem::host_memory_resource host_mr;
+
+    // Track 0 and 3 are too short, and track 1 and 2 share measurement 4.
+    // (Track 2 being removed, for its larger chi-square.)
+    track_state_container_types::host tracks(&host_mr);
+    add_track(tracks, 1.f, {0u, 2u}, host_mr);
+    add_track(tracks, 1.f, {2u, 3u, 4u}, host_mr);
+    add_track(tracks, 2.f, {4u, 5u, 6u}, host_mr);
+    add_track(tracks, 0.f, {7u}, host_mr);
+    add_track(tracks, 0.f, {8u, 9u, 10u}, host_mr);
+    const std::vector<std::vector<std::size_t>> expected = {{2u, 3u, 4u},
+                                                            {8u, 9u, 10u}};
+
+    greedy_ambiguity_resolution_algorithm::config_t cfg;
+    cfg.verbose_info = false;
+    greedy_ambiguity_resolution_algorithm resolution(cfg);
+    EXPECT_EQ(measurement_ids(resolution(tracks)), expected);
+
+    cfg.resolve_components_in_parallel = true;
+    greedy_ambiguity_resolution_algorithm parallel_resolution(cfg);
+    EXPECT_EQ(measurement_ids(parallel_resolution(tracks)), expected);
+
+    flat_greedy_ambiguity_resolution_algorithm flat_resolution;
+    EXPECT_EQ(measurement_ids(flat_resolution(tracks)), expected);
+}
+
+// Compare the resolution of the connected components with the one of the
+// whole event
+TEST(ambiguity_resolution, parallel_components) {
+
+    vecmem::host_memory_resource host_mr;
+
+    for (std::size_t n_measurements : {500u, 2000u, 10000u}) {
+
+        const track_state_container_types::host tracks =
+            make_tracks(300u, n_measurements, host_mr);
+
+        greedy_ambiguity_resolution_algorithm::config_t cfg;
+        cfg.check_obvious_errs = false;
+        cfg.verbose_info = false;
+        cfg.verbose_error = false;
+        greedy_ambiguity_resolution_algorithm resolution(cfg);
+
+        cfg.resolve_components_in_parallel = true;
+        greedy_ambiguity_resolution_algorithm parallel_resolution(cfg);
+
+        const auto expected = resolution(tracks);
+        const auto result = parallel_resolution(tracks);
+
+        ASSERT_EQ(result.size(), expected.size());
+        EXPECT_EQ(measurement_ids(result), measurement_ids(expected));
+    }
+}
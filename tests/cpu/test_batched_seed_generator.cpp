@@ -0,0 +1,127 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Project include(s).
+#include "traccc/definitions/common.hpp"
+#include "traccc/edm/truth_seed_input.hpp"
+#include "traccc/utils/batched_seed_generator.hpp"
+
+// Detray include(s).
+#include "detray/detectors/build_telescope_detector.hpp"
+#include "detray/geometry/shapes/rectangle2D.hpp"
+#include "detray/navigation/detail/ray.hpp"
+
+// VecMem include(s).
+#include <vecmem/memory/host_memory_resource.hpp>
+
+// GTest include(s).
+#include <gtest/gtest.h>
+
+// System include(s).
+#include <array>
+#include <cmath>
+#include <type_traits>
+#include <vector>
+
+using namespace traccc;
+
+namespace {
+
+/// Standard deviations for the smearing of the seeds
+constexpr std::array<scalar, e_bound_size> stddevs = {
+    0.01f * detray::unit<scalar>::mm,
+    0.01f * detray::unit<scalar>::mm,
+    0.001f,
+    0.001f,
+    0.001f / detray::unit<scalar>::GeV,
+    0.01f * detray::unit<scalar>::ns};
+
+/// Check that two sets of parameters are the same
+void expect_same(const bound_track_parameters& a,
+                 const bound_track_parameters& b) {
+
+    EXPECT_EQ(a.surface_link(), b.surface_link());
+    for (unsigned int i = 0; i < e_bound_size; ++i) {
+        EXPECT_FLOAT_EQ(getter::element(a.vector(), i, 0u),
+                        getter::element(b.vector(), i, 0u));
+        EXPECT_FLOAT_EQ(getter::element(a.covariance(), i, i),
+                        getter::element(b.covariance(), i, i));
+    }
+}
+
+}  // namespace
+
+TEST(batched_seed_generator, telescope) {
+
+    vecmem::host_memory_resource host_mr;
+
+    // Build a telescope along the x axis
+    detray::mask<detray::rectangle2D> rectangle{
+        0u, 10000.f * detray::unit<scalar>::mm,
+        10000.f * detray::unit<scalar>::mm};
+    detray::detail::ray<transform3> traj{{0, 0, 0}, 0, {1, 0, 0}, -1};
+    std::vector<scalar> plane_positions = {20.f, 40.f, 60.f, 80.f, 100.f};
+    detray::tel_det_config<> tel_cfg{rectangle};
+    tel_cfg.positions(plane_positions);
+    tel_cfg.pilot_track(traj);
+    const auto [det, name_map] = build_telescope_detector(host_mr, tel_cfg);
+    using detector_type = std::remove_cv_t<decltype(det)>;
+
+    // Particles crossing the first plane, more than fit into one task
+    const detray::geometry::barcode surface_link = det.surfaces()[0].barcode();
+    truth_seed_input_collection_types::host inputs(&host_mr);
+    const unsigned int n_particles =
+        3u * batched_seed_generator<detector_type>::chunk_size + 10u;
+    for (unsigned int i = 0; i < n_particles; ++i) {
+        const scalar offset = static_cast<scalar>(i % 100u) - 50.f;
+        inputs.push_back(
+            {surface_link,
+             free_track_parameters({20.f, offset, -offset}, 0.f,
+                                   {1.f, 0.01f * offset, 0.02f * offset},
+                                   -1.f)});
+    }
+
+    // Without smearing, the seeds are the ones of the single seed operations
+    const std::array<scalar, e_bound_size> no_stddevs{};
+    const batched_seed_generator<detector_type> unsmeared_sg(det, no_stddevs);
+    const bound_track_parameters_collection_types::host unsmeared =
+        unsmeared_sg(inputs, 0u, host_mr);
+    ASSERT_EQ(unsmeared.size(), n_particles);
+    for (unsigned int i = 0; i < n_particles; ++i) {
+        expect_same(unsmeared[i],
+                    details::make_truth_seed(det, inputs[i].surface_link,
+                                             inputs[i].free_param));
+    }
+
+    // The smearing only depends on the seed, the event and the particle
+    const batched_seed_generator<detector_type> sg(det, stddevs, 42u);
+    const bound_track_parameters_collection_types::host seeds =
+        sg(inputs, 1u, host_mr);
+    const bound_track_parameters_collection_types::host same_seeds =
+        sg(inputs, 1u, host_mr);
+    const bound_track_parameters_collection_types::host other_seeds =
+        sg(inputs, 2u, host_mr);
+    ASSERT_EQ(seeds.size(), n_particles);
+    ASSERT_EQ(other_seeds.size(), n_particles);
+    unsigned int n_different = 0u;
+    for (unsigned int i = 0; i < n_particles; ++i) {
+        expect_same(seeds[i], same_seeds[i]);
+        for (unsigned int j = 0; j < e_bound_size; ++j) {
+            const scalar value = getter::element(seeds[i].vector(), j, 0u);
+            const scalar mean = getter::element(unsmeared[i].vector(), j, 0u);
+            const scalar pull = (value - mean) / stddevs[j];
+            EXPECT_LT(std::abs(pull), 7.f);
+            EXPECT_FLOAT_EQ(getter::element(seeds[i].covariance(), j, j),
+                            stddevs[j] * stddevs[j]);
+        }
+        if (getter::element(seeds[i].vector(), e_bound_loc0, 0u) !=
+            getter::element(other_seeds[i].vector(), e_bound_loc0, 0u)) {
+            ++n_different;
+        }
+    }
+    EXPECT_EQ(n_different, n_particles);
+}
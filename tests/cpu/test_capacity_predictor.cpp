@@ -0,0 +1,38 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Project include(s).
+#include "traccc/utils/capacity_predictor.hpp"
+
+// GTest include(s).
+#include <gtest/gtest.h>
+
+// Test the predictions made from the recorded events
+TEST(capacity_predictor, predictions) {
+
+    traccc::capacity_predictor predictor({3, 1.5f});
+    EXPECT_FALSE(predictor.ready());
+    EXPECT_EQ(predictor.predict(1000), 1u);
+
+    // Events without input are ignored.
+    predictor.record(0, 10);
+    EXPECT_FALSE(predictor.ready());
+
+    // The prediction uses the largest ratio seen, times the margin.
+    predictor.record(100, 200);
+    EXPECT_TRUE(predictor.ready());
+    EXPECT_EQ(predictor.predict(1000), 3000u);
+    predictor.record(100, 400);
+    predictor.record(100, 100);
+    EXPECT_EQ(predictor.predict(1000), 6000u);
+
+    // The largest ratio is forgotten once it falls out of the history.
+    predictor.record(100, 100);
+    EXPECT_EQ(predictor.predict(1000), 6000u);
+    predictor.record(100, 100);
+    EXPECT_EQ(predictor.predict(1000), 1500u);
+}
@@ -1,15 +1,21 @@
 /** TRACCC library, part of the ACTS project (R&D line)
  *
- * (c) 2021-2022 CERN for the benefit of the ACTS project
+ * (c) 2021-2024 CERN for the benefit of the ACTS project
  *
  * Mozilla Public License Version 2.0
  */
 
 // Project include(s).
 #include "traccc/clusterization/clusterization_algorithm.hpp"
+#include "traccc/clusterization/detail/dense_ccl.hpp"
+#include "traccc/clusterization/detail/sparse_ccl.hpp"
+#include "traccc/clusterization/detail/sparse_ccl_simd.hpp"
 #include "traccc/definitions/primitives.hpp"
 #include "traccc/edm/cell.hpp"
 #include "traccc/edm/cluster.hpp"
+#include "traccc/io/read_cells.hpp"
+#include "traccc/io/read_digitization_config.hpp"
+#include "traccc/io/read_geometry.hpp"
 
 // Test include(s).
 #include "tests/cca_test.hpp"
@@ -22,6 +28,8 @@
 
 // System include(s).
 #include <functional>
+#include <random>
+#include <vector>
 
 namespace {
 vecmem::host_memory_resource resource;
@@ -52,3 +60,139 @@ INSTANTIATE_TEST_SUITE_P(
         ::testing::Values(f),
         ::testing::ValuesIn(ConnectedComponentAnalysisTests::get_test_files())),
     ConnectedComponentAnalysisTests::get_test_name);
+
+TEST(SparseCclAlgorithm, FusedMatchesClusterContainer) {
+
+    vecmem::host_memory_resource host_mr;
+
+    // Read a full event.
+    auto [surface_transforms, _] =
+        traccc::io::read_geometry("tml_detector/trackml-detector.csv");
+    auto digi_cfg = traccc::io::read_digitization_config(
+        "tml_detector/default-geometric-config-generic.json");
+    traccc::io::cell_reader_output cells(&host_mr);
+    traccc::io::read_cells(cells, 0, "tml_full/ttbar_mu100/",
+                           traccc::data_format::csv, &surface_transforms,
+                           &digi_cfg);
+
+    // Create measurements with and without an intermediate cluster container.
+    traccc::clusterization_algorithm fused(host_mr);
+    traccc::clusterization_algorithm with_clusters(host_mr, true);
+    const auto fused_meas = fused(cells.cells, cells.modules);
+    const auto reference = with_clusters(cells.cells, cells.modules);
+
+    // They must be identical.
+    ASSERT_EQ(fused_meas.size(), reference.size());
+    for (std::size_t i = 0; i < reference.size(); ++i) {
+        EXPECT_EQ(fused_meas.at(i), reference.at(i));
+        EXPECT_EQ(fused_meas.at(i).module_link, reference.at(i).module_link);
+    }
+}
+
+TEST(SparseCclAlgorithm, DenseMatchesSparse) {
+
+    vecmem::host_memory_resource host_mr;
+
+    // Create a few modules with random cells of increasing occupancy, sorted
+    // in column major order.
+    std::mt19937 gen(1234u);
+    std::uniform_real_distribution<float> dist(0.f, 1.f);
+    traccc::cell_collection_types::host cells(&host_mr);
+    for (unsigned int module = 0; module < 10; ++module) {
+        const float occupancy = 0.1f * static_cast<float>(module);
+        for (traccc::channel_id ch1 = 0; ch1 < 50; ++ch1) {
+            for (traccc::channel_id ch0 = 0; ch0 < 40; ++ch0) {
+                if (dist(gen) < occupancy) {
+                    cells.push_back({ch0, ch1, 1.f, 0.f, module});
+                }
+            }
+        }
+    }
+
+    // Label the cells with SparseCCL, and with the dense CCL on every module.
+    std::vector<unsigned int> sparse_labels(cells.size());
+    const unsigned int n_sparse =
+        traccc::detail::sparse_ccl(cells, sparse_labels);
+    std::vector<unsigned int> dense_labels(cells.size());
+    const unsigned int n_dense =
+        traccc::detail::adaptive_ccl(cells, dense_labels, 0.f);
+
+    // They must agree exactly.
+    EXPECT_EQ(n_dense, n_sparse);
+    EXPECT_EQ(dense_labels, sparse_labels);
+}
+
+TEST(SparseCclAlgorithm, SimdMatchesScalar) {
+
+    vecmem::host_memory_resource host_mr;
+
+    // Create modules with random cells of different occupancies and sizes,
+    // sorted by their second channel. Some of the modules have channels
+    // 2^16 apart, whose squared difference wraps around to zero, to check
+    // that the block tests do the same unsigned arithmetic as the scalar
+    // ones.
+    std::mt19937 gen(4321u);
+    std::uniform_real_distribution<float> dist(0.f, 1.f);
+    traccc::cell_collection_types::host cells(&host_mr);
+    for (unsigned int module = 0; module < 30; ++module) {
+        const float occupancy = 0.02f * static_cast<float>(module);
+        const traccc::channel_id width = 5u + 3u * module;
+        const traccc::channel_id offset = (module % 3 == 0) ? (1u << 16) : 0u;
+        for (traccc::channel_id ch1 = 0; ch1 < 40; ++ch1) {
+            for (traccc::channel_id ch0 = 0; ch0 < width; ++ch0) {
+                if (dist(gen) < occupancy) {
+                    cells.push_back({ch0 + ((ch0 % 2 == 0) ? offset : 0u),
+                                     ch1, 1.f, 0.f, module});
+                }
+            }
+        }
+    }
+
+    // Label the cells with the scalar and the block tests of SparseCCL.
+    std::vector<unsigned int> scalar_labels(cells.size());
+    const unsigned int n_scalar =
+        traccc::detail::sparse_ccl(cells, scalar_labels);
+    std::vector<unsigned int> simd_labels(cells.size());
+    const unsigned int n_simd =
+        traccc::detail::sparse_ccl_simd(cells, simd_labels);
+
+    // They must agree exactly.
+    EXPECT_EQ(n_simd, n_scalar);
+    EXPECT_EQ(simd_labels, scalar_labels);
+}
+
+TEST(SparseCclAlgorithm, StripMatchesSparse) {
+
+    vecmem::host_memory_resource host_mr;
+
+    // Create strip-like modules with random cells, alternately along the
+    // first and along the second channel.
+    std::mt19937 gen(2468u);
+    std::uniform_real_distribution<float> dist(0.f, 1.f);
+    traccc::cell_collection_types::host cells(&host_mr);
+    for (unsigned int module = 0; module < 20; ++module) {
+        const float occupancy = 0.05f * static_cast<float>(module);
+        for (traccc::channel_id ch = 0; ch < 500; ++ch) {
+            if (dist(gen) < occupancy) {
+                if (module % 2 == 0) {
+                    cells.push_back({ch, 7u, 1.f, 0.f, module});
+                } else {
+                    cells.push_back({3u, ch, 1.f, 0.f, module});
+                }
+            }
+        }
+    }
+
+    // Label the cells with SparseCCL, and with the run-length CCL that the
+    // adaptive CCL uses for these modules.
+    std::vector<unsigned int> sparse_labels(cells.size());
+    const unsigned int n_sparse =
+        traccc::detail::sparse_ccl(cells, sparse_labels);
+    std::vector<unsigned int> strip_labels(cells.size());
+    const unsigned int n_strip = traccc::detail::adaptive_ccl(
+        cells, strip_labels, traccc::detail::default_dense_ccl_occupancy);
+
+    // They must agree exactly.
+    EXPECT_EQ(n_strip, n_sparse);
+    EXPECT_EQ(strip_labels, sparse_labels);
+}
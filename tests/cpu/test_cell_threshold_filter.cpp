@@ -0,0 +1,95 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Project include(s).
+#include "traccc/clusterization/cell_threshold_filter.hpp"
+#include "traccc/clusterization/component_connection.hpp"
+
+// VecMem include(s).
+#include <vecmem/memory/host_memory_resource.hpp>
+
+// GTest include(s).
+#include <gtest/gtest.h>
+
+namespace {
+
+/// Make the test cells, on two modules with a threshold of 1
+///
+/// Module 0 has a cluster of two cells above the threshold, bridged by a
+/// sub-threshold cell, and an isolated sub-threshold cell. Module 1 has an
+/// isolated sub-threshold cell, and one cell above the threshold.
+///
+void make_cells(traccc::cell_collection_types::host& cells,
+                traccc::cell_module_collection_types::host& modules) {
+
+    modules.resize(2);
+    for (traccc::cell_module& module : modules) {
+        module.threshold = 1.f;
+    }
+    cells.push_back({1u, 1u, 5.f, 0.f, 0});
+    cells.push_back({2u, 2u, 0.5f, 0.f, 0});
+    cells.push_back({3u, 3u, 5.f, 0.f, 0});
+    cells.push_back({10u, 10u, 0.5f, 0.f, 0});
+    cells.push_back({4u, 4u, 0.5f, 0.f, 1});
+    cells.push_back({8u, 4u, 5.f, 0.f, 1});
+}
+
+}  // namespace
+
+TEST(CellThresholdFilter, Isolated) {
+
+    vecmem::host_memory_resource host_mr;
+    traccc::cell_collection_types::host cells{&host_mr};
+    traccc::cell_module_collection_types::host modules{&host_mr};
+    make_cells(cells, modules);
+
+    traccc::cell_threshold_filter filter(
+        host_mr, traccc::threshold_filter_mode::e_isolated);
+    const auto kept = filter(cells, modules);
+
+    // Only the isolated sub-threshold cells are dropped, in order.
+    ASSERT_EQ(kept.size(), 4u);
+    EXPECT_EQ(kept[0], cells[0]);
+    EXPECT_EQ(kept[1], cells[1]);
+    EXPECT_EQ(kept[2], cells[2]);
+    EXPECT_EQ(kept[3], cells[5]);
+
+    // Which must not change the clusters above the threshold.
+    traccc::component_connection cc(host_mr);
+    EXPECT_EQ(cc(kept).size(), 2u);
+}
+
+TEST(CellThresholdFilter, All) {
+
+    vecmem::host_memory_resource host_mr;
+    traccc::cell_collection_types::host cells{&host_mr};
+    traccc::cell_module_collection_types::host modules{&host_mr};
+    make_cells(cells, modules);
+
+    traccc::cell_threshold_filter filter(host_mr,
+                                         traccc::threshold_filter_mode::e_all);
+    const auto kept = filter(cells, modules);
+
+    // All sub-threshold cells are dropped, which splits the bridged cluster.
+    ASSERT_EQ(kept.size(), 3u);
+    EXPECT_EQ(kept[0], cells[0]);
+    EXPECT_EQ(kept[1], cells[2]);
+    EXPECT_EQ(kept[2], cells[5]);
+
+    traccc::component_connection cc(host_mr);
+    EXPECT_EQ(cc(kept).size(), 3u);
+}
+
+TEST(CellThresholdFilter, Empty) {
+
+    vecmem::host_memory_resource host_mr;
+    traccc::cell_collection_types::host cells{&host_mr};
+    traccc::cell_module_collection_types::host modules{&host_mr};
+
+    traccc::cell_threshold_filter filter(host_mr);
+    EXPECT_TRUE(filter(cells, modules).empty());
+}
@@ -0,0 +1,62 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Project include(s).
+#include "traccc/finding/chi2_prescreen.hpp"
+
+// GTest include(s).
+#include <gtest/gtest.h>
+
+using namespace traccc;
+
+namespace {
+
+/// Track parameters at the origin of a surface, with unit local covariances
+/// once combined with the measurements' variances
+bound_track_parameters make_params(scalar loc0, scalar loc1) {
+
+    bound_track_parameters params;
+    getter::element(params.vector(), e_bound_loc0, 0u) = loc0;
+    getter::element(params.vector(), e_bound_loc1, 0u) = loc1;
+    auto& cov = params.covariance();
+    getter::element(cov, e_bound_loc0, e_bound_loc0) = 0.5f;
+    getter::element(cov, e_bound_loc1, e_bound_loc1) = 0.5f;
+    return params;
+}
+
+}  // namespace
+
+// Test the chi-square lower bound against the exact chi-square of a
+// measurement with M = I (where chi2 = |r|^2)
+TEST(chi2_prescreen, lower_bound) {
+
+    measurement meas;
+    meas.local = {1.f, 2.f};
+    meas.variance = {0.5f, 0.5f};
+
+    const bound_track_parameters params = make_params(0.f, 0.f);
+
+    const scalar exact_chi2 = 5.f;
+    const scalar bound = chi2_lower_bound(meas, params);
+    EXPECT_LE(bound, exact_chi2);
+    EXPECT_FLOAT_EQ(bound, exact_chi2 / 2.f);
+
+    // A one dimensional measurement only uses its first local coordinate.
+    meas.meas_dim = 1u;
+    EXPECT_FLOAT_EQ(chi2_lower_bound(meas, params), 1.f);
+}
+
+// Test that the sign of the first local coordinate is ignored
+TEST(chi2_prescreen, flipped_loc0) {
+
+    measurement meas;
+    meas.local = {-1.f, 0.f};
+    meas.variance = {0.5f, 0.5f};
+
+    EXPECT_FLOAT_EQ(chi2_lower_bound(meas, make_params(1.f, 0.f)), 0.f);
+    EXPECT_FLOAT_EQ(chi2_lower_bound(meas, make_params(-1.f, 1.f)), 0.5f);
+}
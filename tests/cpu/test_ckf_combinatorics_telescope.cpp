@@ -1,6 +1,6 @@
 /** TRACCC library, part of the ACTS project (R&D line)
  *
- * (c) 2023 CERN for the benefit of the ACTS project
+ * (c) 2023-2024 CERN for the benefit of the ACTS project
  *
  * Mozilla Public License Version 2.0
  */
@@ -120,11 +120,21 @@ TEST_P(CkfCombinatoricsTelescopeTests, Run) {
         rk_stepper_type, host_navigator_type>::config_type cfg_limit;
     cfg_limit.max_num_branches_per_initial_seed = nmax_per_seed;
 
+    // The same configurations, processing the parameters in parallel tasks
+    auto cfg_parallel = cfg;
+    cfg_parallel.host_params_per_task = 1;
+    auto cfg_limit_parallel = cfg_limit;
+    cfg_limit_parallel.host_params_per_task = 1;
+
     // Finding algorithm object
     traccc::finding_algorithm<rk_stepper_type, host_navigator_type>
         host_finding(cfg);
     traccc::finding_algorithm<rk_stepper_type, host_navigator_type>
         host_finding_limit(cfg_limit);
+    traccc::finding_algorithm<rk_stepper_type, host_navigator_type>
+        host_finding_parallel(cfg_parallel);
+    traccc::finding_algorithm<rk_stepper_type, host_navigator_type>
+        host_finding_limit_parallel(cfg_limit_parallel);
 
     // Iterate over events
     for (std::size_t i_evt = 0; i_evt < n_events; i_evt++) {
@@ -164,6 +174,25 @@ TEST_P(CkfCombinatoricsTelescopeTests, Run) {
 
         ASSERT_EQ(track_candidates_limit.size(),
                   n_truth_tracks * nmax_per_seed);
+
+        // The parallel track finding should give the same results, in the
+        // same order.
+        auto track_candidates_parallel = host_finding_parallel(
+            host_det, field, measurements_per_event, seeds);
+        auto track_candidates_limit_parallel = host_finding_limit_parallel(
+            host_det, field, measurements_per_event, seeds);
+
+        ASSERT_EQ(track_candidates_parallel.size(), track_candidates.size());
+        for (std::size_t i = 0; i < track_candidates.size(); ++i) {
+            EXPECT_EQ(track_candidates_parallel.at(i).items,
+                      track_candidates.at(i).items);
+        }
+        ASSERT_EQ(track_candidates_limit_parallel.size(),
+                  track_candidates_limit.size());
+        for (std::size_t i = 0; i < track_candidates_limit.size(); ++i) {
+            EXPECT_EQ(track_candidates_limit_parallel.at(i).items,
+                      track_candidates_limit.at(i).items);
+        }
     }
 }
 
@@ -127,6 +127,12 @@ TEST_P(CkfSparseTrackTelescopeTests, Run) {
     typename traccc::fitting_algorithm<host_fitter_type>::config_type fit_cfg;
     traccc::fitting_algorithm<host_fitter_type> host_fitting(fit_cfg);
 
+    // Finding and fitting algorithm objects walking the telescope planes in
+    // a fixed order
+    traccc::finding_algorithm<rk_stepper_type, host_planar_navigator_type>
+        planar_finding(cfg);
+    traccc::fitting_algorithm<host_planar_fitter_type> planar_fitting(fit_cfg);
+
     // Iterate over events
     for (std::size_t i_evt = 0; i_evt < n_events; i_evt++) {
 
@@ -163,6 +169,56 @@ TEST_P(CkfSparseTrackTelescopeTests, Run) {
 
         ASSERT_EQ(track_states.size(), n_truth_tracks);
 
+        // Run finding with the smoothing of the filtered states, instead of a
+        // full refit
+        auto smoothed_track_states = host_finding.find_and_smooth(
+            host_det, field, measurements_per_event, seeds);
+
+        ASSERT_EQ(smoothed_track_states.size(), n_truth_tracks);
+
+        // Run finding with the transport recorded, and the fitting re-using
+        // it, which must find and fit the same tracks
+        const auto [transported_candidates, filtered_states] =
+            host_finding.find_with_transport(host_det, field,
+                                             measurements_per_event, seeds);
+        ASSERT_EQ(transported_candidates.size(), n_truth_tracks);
+        ASSERT_EQ(filtered_states.size(), n_truth_tracks);
+        auto transported_track_states = host_fitting(
+            host_det, field, transported_candidates, filtered_states);
+        ASSERT_EQ(transported_track_states.size(), n_truth_tracks);
+        for (unsigned int i_trk = 0; i_trk < n_truth_tracks; i_trk++) {
+            EXPECT_EQ(transported_track_states[i_trk].items.size(),
+                      track_states[i_trk].items.size());
+            EXPECT_FLOAT_EQ(transported_track_states[i_trk].header.ndf,
+                            track_states[i_trk].header.ndf);
+        }
+
+        // Run the finding and the fitting along the fixed-order walk of the
+        // planes, which must find the same tracks
+        auto planar_track_candidates =
+            planar_finding(host_det, field, measurements_per_event, seeds);
+        ASSERT_EQ(planar_track_candidates.size(), n_truth_tracks);
+        auto planar_track_states =
+            planar_fitting(host_det, field, planar_track_candidates);
+        ASSERT_EQ(planar_track_states.size(), n_truth_tracks);
+        for (unsigned int i_trk = 0; i_trk < n_truth_tracks; i_trk++) {
+            EXPECT_EQ(planar_track_candidates[i_trk].items.size(),
+                      track_candidates[i_trk].items.size());
+            EXPECT_FLOAT_EQ(planar_track_states[i_trk].header.ndf,
+                            track_states[i_trk].header.ndf);
+        }
+
+        for (unsigned int i_trk = 0; i_trk < n_truth_tracks; i_trk++) {
+
+            const auto& smoothed_states = smoothed_track_states[i_trk].items;
+            const auto& smoothed_res = smoothed_track_states[i_trk].header;
+
+            consistency_tests(smoothed_states);
+
+            EXPECT_EQ(smoothed_states.size(), track_states[i_trk].items.size());
+            EXPECT_FLOAT_EQ(smoothed_res.ndf, track_states[i_trk].header.ndf);
+        }
+
         for (unsigned int i_trk = 0; i_trk < n_truth_tracks; i_trk++) {
 
             const auto& track_states_per_track = track_states[i_trk].items;
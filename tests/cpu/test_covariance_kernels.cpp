@@ -0,0 +1,125 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Project include(s).
+#include "traccc/definitions/primitives.hpp"
+#include "traccc/definitions/track_parametrization.hpp"
+#include "traccc/fitting/kalman_filter/covariance_kernels.hpp"
+
+// GTest include(s).
+#include <gtest/gtest.h>
+
+using namespace traccc;
+
+namespace {
+
+using kernels = covariance_kernels<transform3>;
+using matrix_operator = typename transform3::matrix_actor;
+template <unsigned int ROWS, unsigned int COLS>
+using matrix_type = typename matrix_operator::template matrix_type<ROWS, COLS>;
+
+/// A dense, symmetric positive definite matrix
+template <unsigned int N>
+matrix_type<N, N> make_spd() {
+
+    matrix_type<N, N> A = matrix_operator().template zero<N, N>();
+    for (unsigned int i = 0u; i < N; ++i) {
+        for (unsigned int j = 0u; j <= i; ++j) {
+            getter::element(A, i, j) = 0.1f * static_cast<scalar>(i + j + 1u);
+        }
+    }
+    return A * matrix_operator().transpose(A) +
+           matrix_operator().template identity<N, N>();
+}
+
+/// A dense, non-symmetric matrix
+template <unsigned int ROWS, unsigned int COLS>
+matrix_type<ROWS, COLS> make_dense() {
+
+    matrix_type<ROWS, COLS> J;
+    for (unsigned int i = 0u; i < ROWS; ++i) {
+        for (unsigned int j = 0u; j < COLS; ++j) {
+            getter::element(J, i, j) =
+                0.2f * static_cast<scalar>(i) - 0.3f * static_cast<scalar>(j) +
+                ((i == j) ? 1.f : 0.f);
+        }
+    }
+    return J;
+}
+
+/// Compare two matrices element by element
+template <unsigned int ROWS, unsigned int COLS>
+void expect_near(const matrix_type<ROWS, COLS>& a,
+                 const matrix_type<ROWS, COLS>& b, scalar tolerance) {
+
+    for (unsigned int i = 0u; i < ROWS; ++i) {
+        for (unsigned int j = 0u; j < COLS; ++j) {
+            EXPECT_NEAR(getter::element(a, i, j), getter::element(b, i, j),
+                        tolerance);
+        }
+    }
+}
+
+}  // namespace
+
+TEST(covariance_kernels, pack) {
+
+    const matrix_type<e_bound_size, e_bound_size> C = make_spd<e_bound_size>();
+    const kernels::packed_matrix<e_bound_size> packed =
+        kernels::pack<e_bound_size>(C);
+    EXPECT_EQ(kernels::packed_matrix<e_bound_size>::size, 21u);
+    EXPECT_FLOAT_EQ(packed(4u, 1u), getter::element(C, 1u, 4u));
+    expect_near<e_bound_size, e_bound_size>(
+        kernels::unpack<e_bound_size>(packed), C, 0.f);
+}
+
+TEST(covariance_kernels, sandwich) {
+
+    const matrix_type<e_bound_size, e_bound_size> C = make_spd<e_bound_size>();
+    const matrix_type<e_bound_size, e_bound_size> J =
+        make_dense<e_bound_size, e_bound_size>();
+    expect_near<e_bound_size, e_bound_size>(
+        kernels::sandwich<e_bound_size, e_bound_size>(J, C),
+        J * C * matrix_operator().transpose(J), 1e-3f);
+
+    // Projection onto a 2D measurement
+    const matrix_type<2u, e_bound_size> H = make_dense<2u, e_bound_size>();
+    expect_near<2u, 2u>(kernels::sandwich<2u, e_bound_size>(H, C),
+                        H * C * matrix_operator().transpose(H), 1e-3f);
+}
+
+TEST(covariance_kernels, subtract_symmetric_product) {
+
+    const matrix_type<e_bound_size, e_bound_size> P = make_spd<e_bound_size>();
+    const matrix_type<2u, e_bound_size> H = make_dense<2u, e_bound_size>();
+    const matrix_type<e_bound_size, 2u> PHt =
+        P * matrix_operator().transpose(H);
+    const matrix_type<2u, 2u> M =
+        H * PHt + matrix_operator().template identity<2u, 2u>();
+    const matrix_type<e_bound_size, 2u> K = PHt * matrix_operator().inverse(M);
+    expect_near<e_bound_size, e_bound_size>(
+        kernels::subtract_symmetric_product<e_bound_size, 2u>(P, K, PHt),
+        P - K * matrix_operator().transpose(PHt), 1e-4f);
+}
+
+TEST(covariance_kernels, inverse_spd) {
+
+    const matrix_type<2u, 2u> C2 = make_spd<2u>();
+    expect_near<2u, 2u>(kernels::inverse_spd<2u>(C2) * C2,
+                        matrix_operator().template identity<2u, 2u>(), 1e-5f);
+
+    const matrix_type<e_bound_size, e_bound_size> C6 = make_spd<e_bound_size>();
+    expect_near<e_bound_size, e_bound_size>(
+        kernels::inverse_spd<e_bound_size>(C6),
+        matrix_operator().inverse(C6), 1e-3f);
+
+    // Matrices that are not positive definite use the generic inversion
+    matrix_type<2u, 2u> N = matrix_operator().template zero<2u, 2u>();
+    getter::element(N, 0u, 1u) = 1.f;
+    getter::element(N, 1u, 0u) = 1.f;
+    expect_near<2u, 2u>(kernels::inverse_spd<2u>(N), N, 1e-6f);
+}
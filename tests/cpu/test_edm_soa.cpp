@@ -0,0 +1,198 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Project include(s).
+#include "traccc/edm/cell_soa.hpp"
+#include "traccc/edm/measurement_soa.hpp"
+#include "traccc/edm/module_descriptor_soa.hpp"
+#include "traccc/edm/track_candidate_soa.hpp"
+
+// VecMem include(s).
+#include <vecmem/memory/host_memory_resource.hpp>
+#include <vecmem/utils/copy.hpp>
+
+// Google test include(s).
+#include <gtest/gtest.h>
+
+// System include(s).
+#include <cmath>
+#include <limits>
+
+TEST(EdmSoA, CellRoundTrip) {
+
+    // Memory resource used by the test.
+    vecmem::host_memory_resource host_mr;
+
+    // Create some cells in AoS layout.
+    traccc::cell_collection_types::host cells{&host_mr};
+    for (unsigned int i = 0; i < 10u; ++i) {
+        cells.push_back({i, 2 * i, 0.1f * i, 0.5f * i, i / 3});
+    }
+
+    // Convert them to SoA layout and back.
+    const traccc::cell_soa_collection_types::host soa =
+        traccc::to_soa(cells, &host_mr);
+    ASSERT_EQ(soa.size(), cells.size());
+    const traccc::cell_collection_types::host aos =
+        traccc::to_aos(soa, &host_mr);
+    ASSERT_EQ(aos.size(), cells.size());
+    for (std::size_t i = 0; i < cells.size(); ++i) {
+        EXPECT_EQ(soa.at(i), cells[i]);
+        EXPECT_EQ(aos[i], cells[i]);
+    }
+
+    // Copy the SoA collection through a buffer, and access it as a device
+    // collection.
+    vecmem::copy copy;
+    traccc::cell_soa_collection_types::buffer buffer(
+        static_cast<traccc::cell_soa_collection_types::buffer::size_type>(
+            soa.size()),
+        host_mr);
+    traccc::copy(copy, traccc::get_data(soa), traccc::get_data(buffer));
+    const traccc::cell_soa_collection_types::const_device device{
+        traccc::cell_soa_collection_types::const_view{
+            traccc::get_data(buffer)}};
+    ASSERT_EQ(device.size(), cells.size());
+    for (unsigned int i = 0; i < device.size(); ++i) {
+        EXPECT_EQ(device.channel0[i], cells[i].channel0);
+        EXPECT_EQ(device.at(i), cells[i]);
+    }
+}
+
+TEST(EdmSoA, MeasurementRoundTrip) {
+
+    // Memory resource used by the test.
+    vecmem::host_memory_resource host_mr;
+
+    // Create some measurements in AoS layout.
+    traccc::measurement_collection_types::host meas{&host_mr};
+    for (unsigned int i = 0; i < 10u; ++i) {
+        traccc::measurement m;
+        m.local = {1.f * i, 2.f * i};
+        m.variance = {0.1f * i, 0.2f * i};
+        m.surface_link = detray::geometry::barcode{100u + i};
+        m.measurement_id = i;
+        m.module_link = i / 2;
+        if (i % 2 == 0) {
+            m.cluster_link = 3 * i;
+        }
+        m.meas_dim = 1u + i % 2;
+        if (i % 3 == 0) {
+            m.subs.set_indices({1u, 2u});
+        }
+        meas.push_back(m);
+    }
+
+    // Convert them to SoA layout and back.
+    const traccc::measurement_soa_collection_types::host soa =
+        traccc::to_soa(meas, &host_mr);
+    const traccc::measurement_collection_types::host aos =
+        traccc::to_aos(soa, &host_mr);
+    ASSERT_EQ(aos.size(), meas.size());
+    for (std::size_t i = 0; i < meas.size(); ++i) {
+        EXPECT_EQ(aos[i], meas[i]);
+        EXPECT_EQ(aos[i].measurement_id, meas[i].measurement_id);
+        EXPECT_EQ(aos[i].module_link, meas[i].module_link);
+        EXPECT_EQ(aos[i].cluster_link, meas[i].cluster_link);
+        EXPECT_EQ(aos[i].meas_dim, meas[i].meas_dim);
+        EXPECT_EQ(aos[i].subs.get_indices(), meas[i].subs.get_indices());
+    }
+    EXPECT_EQ(aos[1].cluster_link, std::numeric_limits<std::size_t>::max());
+
+    // Access the SoA collection as a device collection.
+    const traccc::measurement_soa_collection_types::const_device device{
+        traccc::get_data(soa)};
+    ASSERT_EQ(device.size(), meas.size());
+    for (unsigned int i = 0; i < device.size(); ++i) {
+        EXPECT_EQ(device.at(i), meas[i]);
+        EXPECT_EQ(device.at(i).cluster_link, meas[i].cluster_link);
+    }
+}
+
+TEST(EdmSoA, FlatTrackCandidates) {
+
+    vecmem::host_memory_resource host_mr;
+
+    // Some measurements to refer to.
+    traccc::measurement_collection_types::host meas{&host_mr};
+    for (unsigned int i = 0; i < 5; ++i) {
+        traccc::measurement m;
+        m.local = {static_cast<traccc::scalar>(i), 0.f};
+        m.measurement_id = i;
+        meas.push_back(m);
+    }
+
+    // Two tracks, with 3 and 2 candidates.
+    traccc::track_candidate_soa_collection_types::host cands{&host_mr};
+    cands.seeds.resize(2);
+    cands.offsets = {0u, 3u, 5u};
+    cands.measurement_indices = {4u, 0u, 2u, 1u, 3u};
+
+    // Access them as a device container.
+    const traccc::track_candidate_soa_collection_types::const_device device{
+        traccc::get_data(cands)};
+    ASSERT_EQ(device.size(), 2u);
+    EXPECT_EQ(device.n_candidates(0), 3u);
+    EXPECT_EQ(device.n_candidates(1), 2u);
+
+    // Convert them to the jagged container layout.
+    const traccc::track_candidate_container_types::host container =
+        traccc::to_container(cands, meas, host_mr);
+    ASSERT_EQ(container.size(), 2u);
+    ASSERT_EQ(container.at(0).items.size(), 3u);
+    ASSERT_EQ(container.at(1).items.size(), 2u);
+    for (unsigned int i = 0; i < 2u; ++i) {
+        for (unsigned int j = 0; j < device.n_candidates(i); ++j) {
+            EXPECT_EQ(container.at(i).items.at(j).measurement_id,
+                      cands.measurement_indices.at(cands.offsets.at(i) + j));
+        }
+    }
+}
+
+TEST(EdmSoA, ModuleDescriptors) {
+
+    // Memory resource used by the test.
+    vecmem::host_memory_resource host_mr;
+
+    // Create some rotated and translated modules.
+    traccc::cell_module_collection_types::host modules{&host_mr};
+    for (unsigned int i = 0; i < 5u; ++i) {
+        traccc::cell_module m;
+        m.surface_link = detray::geometry::barcode{i};
+        const traccc::scalar phi = 0.3f * static_cast<traccc::scalar>(i);
+        m.placement = traccc::transform3{
+            traccc::vector3{10.f * i, -5.f, 2.f * i},
+            traccc::vector3{0.f, 0.f, 1.f},
+            traccc::vector3{std::cos(phi), std::sin(phi), 0.f}};
+        m.threshold = 0.1f * i;
+        m.pixel = {-1.f, -2.f, 0.05f, 0.1f};
+        modules.push_back(m);
+    }
+
+    // Describe them, and compare the (single precision) transformations to
+    // the full ones.
+    traccc::module_descriptor_soa_collection_types::host descriptors =
+        traccc::make_module_descriptors(modules, &host_mr);
+    ASSERT_EQ(descriptors.size(), modules.size());
+    const traccc::module_descriptor_soa_collection_types::const_device
+        device{traccc::get_data(descriptors)};
+    ASSERT_EQ(device.size(), modules.size());
+    const traccc::cell c{3, 7, 1.f, 0.f, 0};
+    for (unsigned int i = 0; i < modules.size(); ++i) {
+        EXPECT_EQ(device.surface_link[i], modules[i].surface_link);
+        EXPECT_FLOAT_EQ(device.threshold[i], modules[i].threshold);
+        const traccc::point2 local = device.cell_position(i, c);
+        EXPECT_FLOAT_EQ(local[0], -1.f + 3 * 0.05f);
+        EXPECT_FLOAT_EQ(local[1], -2.f + 7 * 0.1f);
+        const traccc::point3 expected = modules[i].placement.point_to_global(
+            traccc::point3{local[0], local[1], 0.f});
+        const traccc::point3 global = device.point_to_global(i, local);
+        for (unsigned int j = 0; j < 3; ++j) {
+            EXPECT_NEAR(global[j], expected[j], 1e-4);
+        }
+    }
+}
@@ -0,0 +1,109 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Project include(s).
+#include "traccc/clusterization/clusterization_algorithm.hpp"
+#include "traccc/clusterization/event_batch.hpp"
+
+// VecMem include(s).
+#include <vecmem/memory/host_memory_resource.hpp>
+
+// GTest include(s).
+#include <gtest/gtest.h>
+
+// System include(s).
+#include <algorithm>
+#include <vector>
+
+using namespace traccc;
+
+namespace {
+
+/// Create a small event, with a few clusters on each of its modules
+void make_event(unsigned int n_modules, unsigned int seed,
+                cell_collection_types::host& cells,
+                cell_module_collection_types::host& modules) {
+
+    for (unsigned int m = 0; m < n_modules; ++m) {
+        cells.push_back({seed + 1u, 1u, 1.f, 0.f, m});
+        cells.push_back({seed + 2u, 1u, 2.f, 0.f, m});
+        cells.push_back({seed + 5u, 5u, 1.f, 0.f, m});
+        cell_module mod;
+        mod.surface_link = detray::geometry::barcode{100u * seed + m};
+        modules.push_back(mod);
+    }
+}
+
+}  // namespace
+
+TEST(event_batch, merge) {
+
+    vecmem::host_memory_resource host_mr;
+
+    cell_collection_types::host cells1{&host_mr}, cells2{&host_mr};
+    cell_module_collection_types::host modules1{&host_mr}, modules2{&host_mr};
+    make_event(3u, 1u, cells1, modules1);
+    make_event(2u, 2u, cells2, modules2);
+
+    event_batch batch{host_mr};
+    EXPECT_EQ(batch.add(cells1, modules1), 0u);
+    EXPECT_EQ(batch.add(cells2, modules2), 1u);
+    ASSERT_EQ(batch.size(), 2u);
+
+    ASSERT_EQ(batch.cells().size(), cells1.size() + cells2.size());
+    ASSERT_EQ(batch.modules().size(), modules1.size() + modules2.size());
+    ASSERT_EQ(batch.module_events().size(), batch.modules().size());
+
+    // The cells of the second event point at its (shifted) modules.
+    for (std::size_t i = 0; i < cells2.size(); ++i) {
+        const cell& c = batch.cells()[cells1.size() + i];
+        EXPECT_EQ(c.module_link, cells2[i].module_link + modules1.size());
+        EXPECT_EQ(batch.modules()[c.module_link],
+                  modules2[cells2[i].module_link]);
+        EXPECT_EQ(batch.module_events()[c.module_link], 1u);
+    }
+    // The cells of the batch remain ordered by module.
+    EXPECT_TRUE(std::is_sorted(batch.cells().begin(), batch.cells().end(),
+                               [](const cell& a, const cell& b) {
+                                   return a.module_link < b.module_link;
+                               }));
+
+    batch.clear();
+    EXPECT_EQ(batch.size(), 0u);
+    EXPECT_TRUE(batch.cells().empty());
+    EXPECT_EQ(batch.add(cells2, modules2), 0u);
+}
+
+TEST(event_batch, clusterization) {
+
+    vecmem::host_memory_resource host_mr;
+    clusterization_algorithm ca(host_mr);
+
+    // Clusterize a few events one by one, and as a batch.
+    static constexpr unsigned int n_events = 4u;
+    event_batch batch{host_mr};
+    std::vector<std::size_t> n_measurements;
+    for (unsigned int e = 0; e < n_events; ++e) {
+        cell_collection_types::host cells{&host_mr};
+        cell_module_collection_types::host modules{&host_mr};
+        make_event(e + 1u, e, cells, modules);
+        n_measurements.push_back(ca(cells, modules).size());
+        batch.add(cells, modules);
+    }
+    const clusterization_algorithm::output_type measurements =
+        ca(batch.cells(), batch.modules());
+
+    // The measurements of the batch are de-multiplexed with the event index
+    // of their modules.
+    std::vector<std::size_t> batch_measurements(n_events, 0u);
+    for (const measurement& m : measurements) {
+        ++(batch_measurements.at(batch.module_events().at(m.module_link)));
+    }
+    for (unsigned int e = 0; e < n_events; ++e) {
+        EXPECT_EQ(batch_measurements[e], n_measurements[e]);
+    }
+}
@@ -0,0 +1,163 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Project include(s).
+#include "traccc/definitions/primitives.hpp"
+#include "traccc/edm/measurement.hpp"
+#include "traccc/edm/track_state.hpp"
+#include "traccc/fitting/kalman_filter/gain_matrix_updater.hpp"
+
+// Detray include(s).
+#include "detray/geometry/shapes/line.hpp"
+#include "detray/geometry/shapes/rectangle2D.hpp"
+
+// GTest include(s).
+#include <gtest/gtest.h>
+
+using namespace traccc;
+
+namespace {
+
+using matrix_operator = typename transform3::matrix_actor;
+template <unsigned int ROWS, unsigned int COLS>
+using matrix_type = typename matrix_operator::template matrix_type<ROWS, COLS>;
+
+/// Predicted track parameters, with a dense (symmetric) covariance
+bound_track_parameters make_params(scalar loc0) {
+
+    bound_track_parameters params;
+    for (unsigned int i = 0u; i < e_bound_size; ++i) {
+        getter::element(params.vector(), i, 0u) = 0.1f * static_cast<scalar>(i);
+    }
+    getter::element(params.vector(), e_bound_loc0, 0u) = loc0;
+
+    matrix_type<e_bound_size, e_bound_size> A =
+        matrix_operator().template zero<e_bound_size, e_bound_size>();
+    for (unsigned int i = 0u; i < e_bound_size; ++i) {
+        for (unsigned int j = 0u; j <= i; ++j) {
+            getter::element(A, i, j) = 0.1f * static_cast<scalar>(i + j + 1u);
+        }
+    }
+    params.set_covariance(
+        A * matrix_operator().transpose(A) +
+        matrix_operator().template identity<e_bound_size, e_bound_size>());
+    return params;
+}
+
+/// The textbook Kalman update, with the full projection matrix
+template <unsigned int D>
+void reference_update(const measurement& meas, bool flip_loc0,
+                      const bound_track_parameters& params,
+                      matrix_type<e_bound_size, 1>& filtered_vec,
+                      matrix_type<e_bound_size, e_bound_size>& filtered_cov,
+                      scalar& chi2) {
+
+    track_state<transform3> trk_state(meas);
+    matrix_type<D, e_bound_size> H = meas.subs.template projector<D>();
+    if (flip_loc0) {
+        getter::element(H, 0u, e_bound_loc0) = -1;
+    }
+    const matrix_type<D, 1> x = trk_state.template measurement_local<D>();
+    const matrix_type<D, D> V = trk_state.template measurement_covariance<D>();
+    const auto& P = params.covariance();
+    const matrix_type<D, D> M = H * P * matrix_operator().transpose(H) + V;
+    const matrix_type<e_bound_size, D> K =
+        P * matrix_operator().transpose(H) * matrix_operator().inverse(M);
+    filtered_vec = params.vector() + K * (x - H * params.vector());
+    filtered_cov =
+        (matrix_operator().template identity<e_bound_size, e_bound_size>() -
+         K * H) *
+        P;
+    const matrix_type<D, 1> r = x - H * filtered_vec;
+    const matrix_type<D, D> R =
+        (matrix_operator().template identity<D, D>() - H * K) * V;
+    chi2 = getter::element(matrix_operator().transpose(r) *
+                               matrix_operator().inverse(R) * r,
+                           0u, 0u);
+}
+
+/// Compare the updater with the reference for one measurement
+template <unsigned int D, typename shape_t,
+          typename precise_scalar_t = scalar>
+void compare_with_reference(const measurement& meas, bool flip_loc0,
+                            const bound_track_parameters& in_params) {
+
+    matrix_type<e_bound_size, 1> ref_vec;
+    matrix_type<e_bound_size, e_bound_size> ref_cov;
+    scalar ref_chi2 = 0.f;
+    reference_update<D>(meas, flip_loc0, in_params, ref_vec, ref_cov,
+                        ref_chi2);
+
+    track_state<transform3> trk_state(meas);
+    bound_track_parameters params = in_params;
+    gain_matrix_updater<transform3, precise_scalar_t>{}
+        .template update<D, shape_t>(trk_state, params);
+
+    for (unsigned int i = 0u; i < e_bound_size; ++i) {
+        EXPECT_NEAR(getter::element(params.vector(), i, 0u),
+                    getter::element(ref_vec, i, 0u), 1e-4f);
+        for (unsigned int j = 0u; j < e_bound_size; ++j) {
+            EXPECT_NEAR(getter::element(params.covariance(), i, j),
+                        getter::element(ref_cov, i, j), 1e-4f);
+        }
+    }
+    EXPECT_NEAR(trk_state.filtered_chi2(), ref_chi2, 1e-3f);
+}
+
+}  // namespace
+
+// Test the update with a pixel (2D) measurement
+TEST(gain_matrix_updater, pixel) {
+
+    measurement meas;
+    meas.local = {1.f, 2.f};
+    meas.variance = {0.01f, 0.02f};
+
+    compare_with_reference<2u, detray::rectangle2D>(meas, false,
+                                                    make_params(0.5f));
+}
+
+// Test the update with a strip (1D) measurement
+TEST(gain_matrix_updater, strip) {
+
+    measurement meas;
+    meas.local = {1.f, 0.f};
+    meas.variance = {0.01f, 0.f};
+    meas.meas_dim = 1u;
+
+    compare_with_reference<1u, detray::rectangle2D>(meas, false,
+                                                    make_params(0.5f));
+}
+
+// Test the update on a line surface, with a negative predicted loc0
+TEST(gain_matrix_updater, line) {
+
+    measurement meas;
+    meas.local = {1.f, 2.f};
+    meas.variance = {0.01f, 0.02f};
+
+    compare_with_reference<2u, detray::line<false>>(meas, true,
+                                                    make_params(-0.5f));
+    compare_with_reference<2u, detray::line<false>>(meas, false,
+                                                    make_params(0.5f));
+}
+
+// Test the update with the gain inversion and chi-square in double precision
+TEST(gain_matrix_updater, mixed_precision) {
+
+    measurement meas;
+    meas.local = {1.f, 2.f};
+    meas.variance = {0.01f, 0.02f};
+
+    compare_with_reference<2u, detray::rectangle2D, double>(meas, false,
+                                                            make_params(0.5f));
+
+    meas.variance = {0.01f, 0.f};
+    meas.meas_dim = 1u;
+    compare_with_reference<1u, detray::rectangle2D, double>(meas, false,
+                                                            make_params(0.5f));
+}
@@ -0,0 +1,123 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Project include(s).
+#include "traccc/utils/instrumented_memory_resource.hpp"
+
+// VecMem include(s).
+#include <vecmem/memory/host_memory_resource.hpp>
+
+// GTest include(s).
+#include <gtest/gtest.h>
+
+// System include(s).
+#include <sstream>
+#include <thread>
+#include <vector>
+
+// Test the overall counters and the high-water mark
+TEST(instrumented_memory_resource, totals) {
+
+    vecmem::host_memory_resource upstream;
+    traccc::instrumented_memory_resource mr(upstream);
+
+    void* a = mr.allocate(100);
+    void* b = mr.allocate(200);
+    mr.deallocate(a, 100);
+    void* c = mr.allocate(50);
+
+    traccc::memory_statistics stats = mr.statistics();
+    EXPECT_EQ(stats.total.allocations, 3u);
+    EXPECT_EQ(stats.total.deallocations, 1u);
+    EXPECT_EQ(stats.total.allocated_bytes, 350u);
+    EXPECT_EQ(stats.total.current_bytes, 250u);
+    EXPECT_EQ(stats.total.peak_bytes, 300u);
+
+    // The peak restarts from the current use.
+    mr.reset_peak();
+    mr.deallocate(b, 200);
+    mr.deallocate(c, 50);
+    stats = mr.statistics();
+    EXPECT_EQ(stats.total.current_bytes, 0u);
+    EXPECT_EQ(stats.total.peak_bytes, 250u);
+
+    // Make sure that the statistics can be printed.
+    std::ostringstream out;
+    out << stats;
+    EXPECT_FALSE(out.str().empty());
+}
+
+// Test the attribution of the allocations to stages
+TEST(instrumented_memory_resource, stages) {
+
+    vecmem::host_memory_resource upstream;
+    traccc::instrumented_memory_resource mr(upstream);
+
+    void* a = nullptr;
+    void* b = nullptr;
+    {
+        traccc::instrumented_memory_resource::stage s1{"first"};
+        a = mr.allocate(100);
+        {
+            traccc::instrumented_memory_resource::stage s2{"second"};
+            b = mr.allocate(200);
+        }
+    }
+    void* c = mr.allocate(10);
+    // Deallocations belong to the stage of the allocation.
+    {
+        traccc::instrumented_memory_resource::stage s2{"second"};
+        mr.deallocate(a, 100);
+    }
+
+    const traccc::memory_statistics stats = mr.statistics();
+    ASSERT_EQ(stats.stages.size(), 3u);
+    EXPECT_EQ(stats.stages.at("first").allocations, 1u);
+    EXPECT_EQ(stats.stages.at("first").deallocations, 1u);
+    EXPECT_EQ(stats.stages.at("first").current_bytes, 0u);
+    EXPECT_EQ(stats.stages.at("first").peak_bytes, 100u);
+    EXPECT_EQ(stats.stages.at("second").current_bytes, 200u);
+    EXPECT_EQ(
+        stats.stages.at(traccc::instrumented_memory_resource::no_stage)
+            .allocated_bytes,
+        10u);
+
+    mr.deallocate(b, 200);
+    mr.deallocate(c, 10);
+}
+
+// Test that the stages and the statistics are thread-safe
+TEST(instrumented_memory_resource, threads) {
+
+    vecmem::host_memory_resource upstream;
+    traccc::instrumented_memory_resource mr(upstream);
+
+    static constexpr std::size_t n_threads = 4u;
+    static constexpr std::size_t n_allocations = 1000u;
+    std::vector<std::thread> threads;
+    for (std::size_t i = 0; i < n_threads; ++i) {
+        threads.emplace_back([&mr, i]() {
+            traccc::instrumented_memory_resource::stage s{
+                (i % 2 == 0) ? "even" : "odd"};
+            for (std::size_t j = 0; j < n_allocations; ++j) {
+                void* ptr = mr.allocate(16);
+                mr.deallocate(ptr, 16);
+            }
+        });
+    }
+    for (std::thread& t : threads) {
+        t.join();
+    }
+
+    const traccc::memory_statistics stats = mr.statistics();
+    EXPECT_EQ(stats.total.allocations, n_threads * n_allocations);
+    EXPECT_EQ(stats.total.current_bytes, 0u);
+    EXPECT_EQ(stats.stages.at("even").allocations,
+              n_threads / 2 * n_allocations);
+    EXPECT_EQ(stats.stages.at("odd").deallocations,
+              n_threads / 2 * n_allocations);
+}
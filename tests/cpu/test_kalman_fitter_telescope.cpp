@@ -8,6 +8,8 @@
 // Project include(s).
 #include "traccc/edm/track_state.hpp"
 #include "traccc/fitting/fitting_algorithm.hpp"
+#include "traccc/fitting/track_selection.hpp"
+#include "traccc/fitting/track_state_compaction.hpp"
 #include "traccc/io/utils.hpp"
 #include "traccc/resolution/fitting_performance_writer.hpp"
 #include "traccc/simulation/simulator.hpp"
@@ -116,6 +118,32 @@ TEST_P(KalmanFittingTelescopeTests, Run) {
     typename traccc::fitting_algorithm<host_fitter_type>::config_type fit_cfg;
     fitting_algorithm<host_fitter_type> fitting(fit_cfg);
 
+    // Fitting algorithm object fitting the tracks in parallel tasks
+    typename traccc::fitting_algorithm<host_fitter_type>::config_type
+        parallel_fit_cfg;
+    parallel_fit_cfg.host_tracks_per_task = 7;
+    fitting_algorithm<host_fitter_type> parallel_fitting(parallel_fit_cfg);
+
+    // Fitting algorithm object walking the telescope planes in a fixed order
+    fitting_algorithm<host_planar_fitter_type> planar_fitting(fit_cfg);
+
+    // Algorithm compacting the fitted track states
+    traccc::track_state_compaction compaction;
+
+    // Algorithms selecting the fitted tracks, without and with a cut
+    traccc::track_selection_algorithm select_all({});
+    traccc::track_selection_config pT_cut_cfg;
+    pT_cut_cfg.min_pT = 1000.f * detray::unit<scalar>::GeV;
+    traccc::track_selection_algorithm select_none(pT_cut_cfg);
+
+    // Fitting algorithm object visiting the surfaces of the candidates
+    // directly, and refitting the tracks once more
+    typename traccc::fitting_algorithm<host_fitter_type>::config_type
+        direct_fit_cfg;
+    direct_fit_cfg.direct_first_fit = true;
+    direct_fit_cfg.n_iterations = 2;
+    fitting_algorithm<host_fitter_type> direct_fitting(direct_fit_cfg);
+
     // Iterate over events
     for (std::size_t i_evt = 0; i_evt < n_events; i_evt++) {
         // Event map
@@ -137,6 +165,79 @@ TEST_P(KalmanFittingTelescopeTests, Run) {
         // n_trakcs = 100
         ASSERT_EQ(n_tracks, n_truth_tracks);
 
+        // The parallel fitting must give the same results
+        auto parallel_track_states =
+            parallel_fitting(host_det, field, track_candidates);
+        ASSERT_EQ(parallel_track_states.size(), n_tracks);
+        for (std::size_t i_trk = 0; i_trk < n_tracks; i_trk++) {
+            EXPECT_EQ(parallel_track_states[i_trk].header.ndf,
+                      track_states[i_trk].header.ndf);
+            EXPECT_EQ(parallel_track_states[i_trk].header.chi2,
+                      track_states[i_trk].header.chi2);
+        }
+
+        // The fixed-order walk must find the same track states, with
+        // compatible fitted parameters
+        auto planar_track_states =
+            planar_fitting(host_det, field, track_candidates);
+        ASSERT_EQ(planar_track_states.size(), n_tracks);
+        for (std::size_t i_trk = 0; i_trk < n_tracks; i_trk++) {
+            consistency_tests(planar_track_states[i_trk].items);
+            EXPECT_FLOAT_EQ(planar_track_states[i_trk].header.ndf,
+                            track_states[i_trk].header.ndf);
+            const scalar p = track_states[i_trk].header.fit_params.p();
+            EXPECT_NEAR(planar_track_states[i_trk].header.fit_params.p(), p,
+                        0.01f * p);
+        }
+
+        // The compact track states must keep the smoothed quantities
+        const auto compact_track_states = compaction(track_states);
+        const auto covariances = compaction.covariances(track_states);
+        ASSERT_EQ(compact_track_states.size(), n_tracks);
+        ASSERT_EQ(covariances.size(), n_tracks);
+        for (std::size_t i_trk = 0; i_trk < n_tracks; i_trk++) {
+            const auto& states = track_states[i_trk].items;
+            const auto& compact_states = compact_track_states[i_trk].items;
+            ASSERT_EQ(compact_states.size(), states.size());
+            ASSERT_EQ(covariances[i_trk].size(), states.size());
+            EXPECT_EQ(compact_track_states[i_trk].header.chi2,
+                      track_states[i_trk].header.chi2);
+            for (std::size_t i_st = 0; i_st < states.size(); i_st++) {
+                EXPECT_EQ(compact_states[i_st].surface_link,
+                          states[i_st].surface_link());
+                EXPECT_EQ(compact_states[i_st].smoothed_chi2,
+                          states[i_st].smoothed_chi2());
+                EXPECT_EQ(compact_states[i_st].is_hole, states[i_st].is_hole);
+            }
+        }
+
+        // The selection must keep all of the (good) tracks, in order, and
+        // must reject all of them with an impossible cut
+        const auto selected_track_states = select_all(track_states);
+        ASSERT_EQ(selected_track_states.size(), n_tracks);
+        for (std::size_t i_trk = 0; i_trk < n_tracks; i_trk++) {
+            EXPECT_EQ(selected_track_states[i_trk].header.chi2,
+                      track_states[i_trk].header.chi2);
+            EXPECT_EQ(selected_track_states[i_trk].items.size(),
+                      track_states[i_trk].items.size());
+        }
+        EXPECT_EQ(select_none(track_states).size(), 0u);
+
+        // The direct navigation must find the same track states, with
+        // compatible fitted parameters
+        auto direct_track_states =
+            direct_fitting(host_det, field, track_candidates);
+        ASSERT_EQ(direct_track_states.size(), n_tracks);
+        for (std::size_t i_trk = 0; i_trk < n_tracks; i_trk++) {
+            consistency_tests(direct_track_states[i_trk].items);
+            for (const auto& trk_state : direct_track_states[i_trk].items) {
+                EXPECT_FALSE(trk_state.is_hole);
+            }
+            const scalar p = track_states[i_trk].header.fit_params.p();
+            EXPECT_NEAR(direct_track_states[i_trk].header.fit_params.p(), p,
+                        0.01f * p);
+        }
+
         for (std::size_t i_trk = 0; i_trk < n_tracks; i_trk++) {
 
             const auto& track_states_per_track = track_states[i_trk].items;
@@ -0,0 +1,107 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Project include(s).
+#include "traccc/utils/logging.hpp"
+
+// GTest include(s).
+#include <gtest/gtest.h>
+
+// System include(s).
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+
+/// Count the occurrences of a string in another one
+std::size_t count(const std::string& text, const std::string& what) {
+
+    std::size_t result = 0;
+    for (std::size_t pos = text.find(what); pos != std::string::npos;
+         pos = text.find(what, pos + what.size())) {
+        ++result;
+    }
+    return result;
+}
+
+}  // namespace
+
+// Test the formatting and the buffering of the messages
+TEST(logging, buffering) {
+
+#if TRACCC_MIN_LOG_LEVEL > 3
+    GTEST_SKIP() << "All log messages are compiled out";
+#endif
+    std::ostringstream out;
+    traccc::logging::set_output(out);
+
+    TRACCC_LOG(ERROR, "test", "Error " << 1);
+    EXPECT_EQ(out.str(), "ERROR @test: Error 1\n");
+
+    // Informational messages are only written once flushed.
+    out.str("");
+    TRACCC_LOG_IF(INFO, true, "test", "Info " << 2);
+    TRACCC_LOG_IF(INFO, false, "test", "Not written");
+#if TRACCC_MIN_LOG_LEVEL <= 1
+    EXPECT_TRUE(out.str().empty());
+    traccc::logging::flush();
+    EXPECT_EQ(out.str(), "@test: Info 2\n");
+#endif
+
+    traccc::logging::set_output(std::cout);
+}
+
+// Test the removal of the messages below the compiled level
+TEST(logging, compile_time_filter) {
+
+    std::ostringstream out;
+    traccc::logging::set_output(out);
+
+    int evaluations = 0;
+    TRACCC_LOG(FLOOD, "test", ++evaluations);
+    traccc::logging::flush();
+    EXPECT_EQ(evaluations, (TRACCC_MIN_LOG_LEVEL <= 0) ? 1 : 0);
+    EXPECT_EQ(out.str().empty(), (TRACCC_MIN_LOG_LEVEL > 0));
+
+    traccc::logging::set_output(std::cout);
+}
+
+// Test logging from multiple threads at the same time
+TEST(logging, multi_threaded) {
+
+#if TRACCC_MIN_LOG_LEVEL > 2
+    GTEST_SKIP() << "Warnings are compiled out";
+#endif
+    std::ostringstream out;
+    traccc::logging::set_output(out);
+
+    static constexpr int n_threads = 4;
+    static constexpr int n_messages = 1000;
+    std::vector<std::thread> threads;
+    for (int i = 0; i < n_threads; ++i) {
+        threads.emplace_back([i]() {
+            for (int j = 0; j < n_messages; ++j) {
+                TRACCC_LOG(WARNING, "thread", "message " << i << " " << j);
+            }
+        });
+    }
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+
+    // Every message must have been written as a whole line.
+    const std::string text = out.str();
+    EXPECT_EQ(count(text, "\n"),
+              static_cast<std::size_t>(n_threads * n_messages));
+    EXPECT_EQ(count(text, "WARNING @thread: message "),
+              static_cast<std::size_t>(n_threads * n_messages));
+
+    traccc::logging::set_output(std::cout);
+}
@@ -0,0 +1,79 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Project include(s).
+#include "traccc/edm/measurement.hpp"
+#include "traccc/finding/measurement_range.hpp"
+
+// VecMem include(s).
+#include <vecmem/memory/host_memory_resource.hpp>
+
+// GTest include(s).
+#include <gtest/gtest.h>
+
+// System include(s).
+#include <utility>
+#include <vector>
+
+using namespace traccc;
+
+// Test the measurement range table of surface-sorted measurements
+TEST(measurement_range, make_measurement_ranges) {
+
+    vecmem::host_memory_resource mr;
+
+    // Measurements on surfaces 1, 1, 4, 6, 6, 6.
+    measurement_collection_types::host measurements(&mr);
+    for (unsigned int index : {1u, 1u, 4u, 6u, 6u, 6u}) {
+        measurement meas;
+        meas.surface_link =
+            detray::geometry::barcode{}.set_volume(0u).set_index(index);
+        measurements.push_back(meas);
+    }
+
+    const measurement_range_collection_types::host ranges =
+        make_measurement_ranges(measurements, mr);
+    ASSERT_EQ(ranges.size(), 7u);
+
+    const std::vector<std::pair<unsigned int, unsigned int>> expected = {
+        {0u, 0u}, {0u, 2u}, {0u, 0u}, {0u, 0u}, {2u, 3u}, {0u, 0u}, {3u, 6u}};
+    for (unsigned int i = 0; i < ranges.size(); ++i) {
+        EXPECT_EQ(ranges[i].begin, expected[i].first);
+        EXPECT_EQ(ranges[i].end, expected[i].second);
+    }
+
+    // Surfaces beyond the end of the table have no measurements.
+    EXPECT_EQ(find_measurement_range(ranges, 4u).size(), 1u);
+    EXPECT_EQ(find_measurement_range(ranges, 100u).size(), 0u);
+
+    // An empty measurement collection gives an empty table.
+    EXPECT_TRUE(
+        make_measurement_ranges(measurement_collection_types::host{&mr}, mr)
+            .empty());
+}
+
+// Test that the integer sort keys order measurements like the comparator
+TEST(measurement_range, measurement_sort_key) {
+
+    std::vector<measurement> measurements;
+    for (unsigned int volume : {0u, 1u, 3u}) {
+        for (unsigned int index : {0u, 2u, 70u, 1000u}) {
+            measurement meas;
+            meas.surface_link =
+                detray::geometry::barcode{}.set_volume(volume).set_index(
+                    index);
+            measurements.push_back(meas);
+        }
+    }
+
+    for (const measurement& m1 : measurements) {
+        for (const measurement& m2 : measurements) {
+            EXPECT_EQ(measurement_sort_comp()(m1, m2),
+                      measurement_sort_key()(m1) < measurement_sort_key()(m2));
+        }
+    }
+}
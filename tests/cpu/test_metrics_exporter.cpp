@@ -0,0 +1,111 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Project include(s).
+#include "traccc/performance/metrics_exporter.hpp"
+#include "traccc/performance/scoped_timer.hpp"
+
+// GTest include(s).
+#include <gtest/gtest.h>
+
+// System include(s).
+#include <chrono>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <thread>
+
+using namespace traccc::performance;
+
+namespace {
+
+/// Read the full contents of a file
+std::string read_file(const std::string& filename) {
+
+    std::ifstream in_file(filename);
+    return {std::istreambuf_iterator<char>(in_file),
+            std::istreambuf_iterator<char>()};
+}
+
+}  // namespace
+
+// Test the metrics written in the Prometheus text format
+TEST(metrics_exporter, prometheus) {
+
+    const std::string filename =
+        (std::filesystem::temp_directory_path() / "traccc_metrics.prom")
+            .string();
+
+    timing_registry registry;
+    for (int i = 0; i < 10; ++i) {
+        scoped_timer t{"Event", registry};
+    }
+    traccc::memory_statistics memory;
+    memory.total.current_bytes = 1024u;
+    memory.stages["seeding"].current_bytes = 512u;
+
+    {
+        metrics_exporter exporter(filename);
+        exporter.add_timings(registry);
+        exporter.add_memory("host", [&]() { return memory; });
+        exporter.add_gauge("queue_depth", "Events in the queue",
+                           []() { return 3.; });
+        exporter.write();
+
+        const std::string metrics = read_file(filename);
+        EXPECT_NE(metrics.find(
+                      "traccc_scope_measurements_total{scope=\"Event\"} 10\n"),
+                  std::string::npos);
+        EXPECT_NE(metrics.find("traccc_scope_latency_seconds{scope=\"Event\","
+                               "quantile=\"0.99\"}"),
+                  std::string::npos);
+        EXPECT_NE(metrics.find("traccc_memory_current_bytes{resource=\"host\","
+                               "stage=\"total\"} 1024\n"),
+                  std::string::npos);
+        EXPECT_NE(metrics.find("traccc_memory_current_bytes{resource=\"host\","
+                               "stage=\"seeding\"} 512\n"),
+                  std::string::npos);
+        EXPECT_NE(metrics.find("# TYPE traccc_queue_depth gauge\n"
+                               "traccc_queue_depth 3\n"),
+                  std::string::npos);
+
+        // The final metrics are written by the destructor.
+        scoped_timer t{"Event", registry};
+    }
+    EXPECT_NE(read_file(filename).find(
+                  "traccc_scope_measurements_total{scope=\"Event\"} 11\n"),
+              std::string::npos);
+
+    std::remove(filename.c_str());
+}
+
+// Test the periodic export of the metrics in JSON format
+TEST(metrics_exporter, periodic_json) {
+
+    const std::string filename =
+        (std::filesystem::temp_directory_path() / "traccc_metrics.json")
+            .string();
+    std::remove(filename.c_str());
+
+    {
+        metrics_exporter exporter(filename, std::chrono::milliseconds{10});
+        exporter.add_counter("retries_total", "Retried events",
+                             []() { return 7.; });
+        exporter.start();
+        for (int i = 0; (i < 500) && !std::filesystem::exists(filename);
+             ++i) {
+            std::this_thread::sleep_for(std::chrono::milliseconds{10});
+        }
+        EXPECT_TRUE(std::filesystem::exists(filename));
+    }
+    EXPECT_NE(read_file(filename).find("\"retries_total\": 7.0"),
+              std::string::npos);
+
+    std::remove(filename.c_str());
+}
@@ -0,0 +1,58 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Project include(s).
+#include "traccc/geometry/module_table.hpp"
+
+// VecMem include(s).
+#include <vecmem/memory/host_memory_resource.hpp>
+
+// Google test include(s).
+#include <gtest/gtest.h>
+
+TEST(module_table, relink) {
+
+    // Memory resource used by the test.
+    vecmem::host_memory_resource host_mr;
+
+    // The table to fill.
+    traccc::module_table table{&host_mr};
+
+    // A first event, with modules 10 and 20.
+    traccc::cell_module_collection_types::host modules1{&host_mr};
+    modules1.push_back({detray::geometry::barcode{10u}});
+    modules1.push_back({detray::geometry::barcode{20u}});
+    traccc::cell_collection_types::host cells1{&host_mr};
+    cells1.push_back({1, 1, 1.f, 0.f, 0});
+    cells1.push_back({2, 1, 1.f, 0.f, 1});
+    table.relink(cells1, modules1);
+    ASSERT_EQ(table.size(), 2u);
+    EXPECT_EQ(cells1[0].module_link, 0u);
+    EXPECT_EQ(cells1[1].module_link, 1u);
+
+    // A second event, with modules 30 and 10 (in this order).
+    traccc::cell_module_collection_types::host modules2{&host_mr};
+    modules2.push_back({detray::geometry::barcode{30u}});
+    modules2.push_back({detray::geometry::barcode{10u}});
+    traccc::cell_collection_types::host cells2{&host_mr};
+    cells2.push_back({3, 1, 1.f, 0.f, 0});
+    cells2.push_back({4, 1, 1.f, 0.f, 0});
+    cells2.push_back({5, 1, 1.f, 0.f, 1});
+    table.relink(cells2, modules2);
+    ASSERT_EQ(table.size(), 3u);
+    EXPECT_EQ(table.modules()[2].surface_link, detray::geometry::barcode{30u});
+
+    // The cells of module 10 need to come first now, with the cells of every
+    // module kept in order.
+    ASSERT_EQ(cells2.size(), 3u);
+    EXPECT_EQ(cells2[0].module_link, 0u);
+    EXPECT_EQ(cells2[0].channel0, 5u);
+    EXPECT_EQ(cells2[1].module_link, 2u);
+    EXPECT_EQ(cells2[1].channel0, 3u);
+    EXPECT_EQ(cells2[2].module_link, 2u);
+    EXPECT_EQ(cells2[2].channel0, 4u);
+}
@@ -0,0 +1,90 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Project include(s).
+#include "traccc/definitions/primitives.hpp"
+#include "traccc/definitions/track_parametrization.hpp"
+#include "traccc/edm/packed_track_parameters.hpp"
+#include "traccc/edm/track_parameters.hpp"
+
+// VecMem include(s).
+#include <vecmem/memory/host_memory_resource.hpp>
+
+// GTest include(s).
+#include <gtest/gtest.h>
+
+using namespace traccc;
+
+namespace {
+
+using packed_type = packed_bound_track_parameters<transform3>;
+
+/// Bound track parameters with distinct values in all elements
+bound_track_parameters make_parameters(unsigned int surface) {
+
+    bound_vector vec;
+    bound_covariance cov;
+    for (unsigned int i = 0u; i < e_bound_size; ++i) {
+        getter::element(vec, i, 0u) = 0.5f * static_cast<scalar>(i + 1u);
+        for (unsigned int j = 0u; j < e_bound_size; ++j) {
+            // A symmetric matrix, with different values in every element of
+            // its upper triangle.
+            const unsigned int lo = (i < j) ? i : j;
+            const unsigned int hi = (i < j) ? j : i;
+            getter::element(cov, i, j) =
+                0.01f * static_cast<scalar>(lo * e_bound_size + hi + 1u);
+        }
+    }
+    return {detray::geometry::barcode{}.set_volume(1u).set_index(surface), vec,
+            cov};
+}
+
+}  // namespace
+
+TEST(packed_track_parameters, round_trip) {
+
+    const bound_track_parameters par = make_parameters(42u);
+    const packed_type packed{par};
+    EXPECT_EQ(packed.surface_link(), par.surface_link());
+
+    const bound_track_parameters unpacked = packed;
+    EXPECT_EQ(unpacked.surface_link(), par.surface_link());
+    for (unsigned int i = 0u; i < e_bound_size; ++i) {
+        EXPECT_EQ(getter::element(unpacked.vector(), i, 0u),
+                  getter::element(par.vector(), i, 0u));
+        for (unsigned int j = 0u; j < e_bound_size; ++j) {
+            EXPECT_FLOAT_EQ(getter::element(unpacked.covariance(), i, j),
+                            getter::element(par.covariance(), i, j));
+        }
+    }
+}
+
+TEST(packed_track_parameters, layout) {
+
+    // The upper triangle is stored row by row, without gaps.
+    unsigned int expected = 0u;
+    for (unsigned int i = 0u; i < e_bound_size; ++i) {
+        for (unsigned int j = i; j < e_bound_size; ++j) {
+            EXPECT_EQ(packed_type::index(i, j), expected++);
+        }
+    }
+    EXPECT_EQ(expected, packed_type::covariance_size);
+    EXPECT_LT(sizeof(packed_type), sizeof(bound_track_parameters));
+}
+
+TEST(packed_track_parameters, collection) {
+
+    vecmem::host_memory_resource mr;
+    packed_bound_track_parameters_collection_types::host params{&mr};
+    for (unsigned int i = 0u; i < 10u; ++i) {
+        params.push_back(make_parameters(i));
+    }
+    for (unsigned int i = 0u; i < 10u; ++i) {
+        const bound_track_parameters par = params.at(i);
+        EXPECT_EQ(par.surface_link().index(), i);
+    }
+}
@@ -0,0 +1,52 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Project include(s).
+#include "traccc/clusterization/clusterization_algorithm.hpp"
+#include "traccc/clusterization/parallel_clusterization_algorithm.hpp"
+#include "traccc/io/read_cells.hpp"
+#include "traccc/io/read_digitization_config.hpp"
+#include "traccc/io/read_geometry.hpp"
+
+// VecMem include(s).
+#include <vecmem/memory/host_memory_resource.hpp>
+
+// GTest include(s).
+#include <gtest/gtest.h>
+
+TEST(ParallelClusterization, MatchesSerial) {
+
+    vecmem::host_memory_resource host_mr;
+
+    // Read a full event.
+    auto [surface_transforms, _] =
+        traccc::io::read_geometry("tml_detector/trackml-detector.csv");
+    auto digi_cfg = traccc::io::read_digitization_config(
+        "tml_detector/default-geometric-config-generic.json");
+    traccc::io::cell_reader_output cells(&host_mr);
+    traccc::io::read_cells(cells, 0, "tml_full/ttbar_mu100/",
+                           traccc::data_format::csv, &surface_transforms,
+                           &digi_cfg);
+
+    // Run the serial clusterization.
+    traccc::clusterization_algorithm serial(host_mr);
+    const auto reference = serial(cells.cells, cells.modules);
+
+    // The parallel one must give the same result, for any partitioning.
+    for (std::size_t partition_size : {1u, 100u, 1024u, 1000000u}) {
+        traccc::parallel_clusterization_algorithm parallel(host_mr,
+                                                           partition_size);
+        ASSERT_GT(parallel.partitions(cells.cells).size(), 1u);
+        const auto measurements = parallel(cells.cells, cells.modules);
+        ASSERT_EQ(measurements.size(), reference.size());
+        for (std::size_t i = 0; i < reference.size(); ++i) {
+            EXPECT_EQ(measurements.at(i), reference.at(i));
+            EXPECT_EQ(measurements.at(i).module_link,
+                      reference.at(i).module_link);
+        }
+    }
+}
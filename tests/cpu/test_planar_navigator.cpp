@@ -0,0 +1,127 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Project include(s).
+#include "traccc/definitions/common.hpp"
+#include "traccc/edm/track_parameters.hpp"
+#include "traccc/edm/track_state.hpp"
+#include "traccc/navigation/planar_navigator.hpp"
+
+// Detray include(s).
+#include "detray/detectors/bfield.hpp"
+#include "detray/detectors/build_telescope_detector.hpp"
+#include "detray/geometry/shapes/rectangle2D.hpp"
+#include "detray/navigation/detail/helix.hpp"
+#include "detray/navigation/detail/ray.hpp"
+
+// VecMem include(s).
+#include <vecmem/memory/host_memory_resource.hpp>
+
+// GTest include(s).
+#include <gtest/gtest.h>
+
+// System include(s).
+#include <cmath>
+#include <type_traits>
+#include <vector>
+
+using namespace traccc;
+
+namespace {
+
+/// Field type used by the tests
+using b_field_t = covfie::field<detray::bfield::const_bknd_t>;
+
+/// Make parameters on a plane of the telescope, with a diagonal covariance
+bound_track_parameters make_params(detray::geometry::barcode bcd,
+                                   scalar loc0, scalar loc1, scalar phi,
+                                   scalar theta, scalar qop) {
+
+    bound_vector vec;
+    getter::element(vec, e_bound_loc0, 0u) = loc0;
+    getter::element(vec, e_bound_loc1, 0u) = loc1;
+    getter::element(vec, e_bound_phi, 0u) = phi;
+    getter::element(vec, e_bound_theta, 0u) = theta;
+    getter::element(vec, e_bound_qoverp, 0u) = qop;
+    getter::element(vec, e_bound_time, 0u) = 0.f;
+    const bound_covariance cov =
+        track_state<transform3>::matrix_operator()
+            .template identity<e_bound_size, e_bound_size>();
+    return {bcd, vec, cov};
+}
+
+}  // namespace
+
+TEST(planar_navigator, telescope) {
+
+    vecmem::host_memory_resource host_mr;
+
+    // Build a telescope along the x axis
+    detray::mask<detray::rectangle2D> rectangle{
+        0u, 10000.f * detray::unit<scalar>::mm,
+        10000.f * detray::unit<scalar>::mm};
+    detray::detail::ray<transform3> traj{{0, 0, 0}, 0, {1, 0, 0}, -1};
+    std::vector<scalar> plane_positions = {20.f,  40.f,  60.f,  80.f, 100.f,
+                                           120.f, 140.f, 160.f, 180.f};
+    detray::tel_det_config<> tel_cfg{rectangle};
+    tel_cfg.positions(plane_positions);
+    tel_cfg.pilot_track(traj);
+    const auto [det, name_map] = build_telescope_detector(host_mr, tel_cfg);
+    using detector_type = std::remove_cv_t<decltype(det)>;
+
+    const planar_navigator<const detector_type> walk(det);
+    ASSERT_EQ(walk.size(), plane_positions.size());
+    const auto surfaces = det.surfaces();
+    for (std::size_t i = 0; i < plane_positions.size(); ++i) {
+        EXPECT_EQ(walk.position(surfaces[i].barcode()), i);
+    }
+
+    // Transport a straight track from the first plane to the second one,
+    // without a magnetic field
+    const b_field_t no_field =
+        detray::bfield::create_const_field(vector3{0.f, 0.f, 0.f});
+    const b_field_t::view_t no_field_view(no_field);
+
+    const scalar phi = std::atan(0.1f);
+    const scalar theta = 0.5f * detray::constant<scalar>::pi;
+    const scalar qop = -1.f / unit<scalar>::GeV;
+    bound_track_parameters params =
+        make_params(surfaces[0].barcode(), 1.f, 2.f, phi, theta, qop);
+    planar_navigator<const detector_type>::bound_matrix jacobian;
+    ASSERT_TRUE(walk.step(params, no_field_view, jacobian));
+    EXPECT_EQ(params.surface_link(), surfaces[1].barcode());
+    EXPECT_NEAR(params.bound_local()[0], 3.f, 1e-4f);
+    EXPECT_NEAR(params.bound_local()[1], 2.f, 1e-4f);
+    EXPECT_NEAR(getter::element(jacobian, e_bound_loc0, e_bound_loc0), 1.f,
+                1e-4f);
+    EXPECT_NEAR(getter::element(jacobian, e_bound_loc0, e_bound_phi),
+                20.f / (std::cos(phi) * std::cos(phi)), 1e-3f);
+    EXPECT_NEAR(getter::element(jacobian, e_bound_loc1, e_bound_theta),
+                -20.f / std::cos(phi), 1e-3f);
+    EXPECT_NEAR(getter::element(jacobian, e_bound_phi, e_bound_phi), 1.f,
+                1e-4f);
+
+    // Transport a track along the beam axis in a field perpendicular to it,
+    // comparing with the helix of detray
+    const vector3 B{0.f, 0.f, 2.f * unit<scalar>::T};
+    const b_field_t field = detray::bfield::create_const_field(B);
+    const b_field_t::view_t field_view(field);
+
+    params = make_params(surfaces[0].barcode(), 1.f, 2.f, 0.f, theta, qop);
+    ASSERT_TRUE(walk.step(params, field_view, jacobian));
+    EXPECT_EQ(params.surface_link(), surfaces[1].barcode());
+
+    const scalar q = -1.f * unit<scalar>::e;
+    detray::detail::helix<transform3> hlx(
+        {20.f, 1.f, 2.f}, 0.f, {1.f * unit<scalar>::GeV, 0.f, 0.f}, q, &B);
+    const scalar radius = 1.f * unit<scalar>::GeV / (B[2] * unit<scalar>::e);
+    const point3 expected = hlx(radius * std::asin(20.f / radius));
+    EXPECT_NEAR(expected[0], 40.f, 1e-3f);
+    EXPECT_NEAR(params.bound_local()[0], expected[1], 1e-3f);
+    EXPECT_NEAR(params.bound_local()[1], expected[2], 1e-3f);
+    EXPECT_GT(std::abs(params.bound_local()[0] - 1.f), 1e-2f);
+}
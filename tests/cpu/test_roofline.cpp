@@ -0,0 +1,84 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Project include(s).
+#include "traccc/performance/roofline.hpp"
+#include "traccc/utils/work_counter.hpp"
+
+// GTest include(s).
+#include <gtest/gtest.h>
+
+// System include(s).
+#include <chrono>
+#include <sstream>
+#include <thread>
+
+// Test that the work is collected by the scopes of the threads
+TEST(roofline, work_counter_scopes) {
+
+    // Without a scope, nothing is counted.
+    EXPECT_FALSE(traccc::counting_work());
+    traccc::count_work({1, 1, 1});
+
+    traccc::work_counter counter;
+    {
+        traccc::work_counter::scope outer(counter, "outer");
+        EXPECT_TRUE(traccc::counting_work());
+        traccc::count_work({100, 10, 1000});
+        {
+            traccc::work_counter::scope inner(counter, "inner");
+            traccc::count_work({1, 2, 3});
+            // A scope without a counter leaves the current one in place.
+            traccc::work_counter::scope none(nullptr, "none");
+            traccc::count_work({1, 2, 3});
+        }
+        traccc::count_work({100, 10, 1000});
+
+        // Other threads do not inherit the scope.
+        std::thread thread([]() {
+            EXPECT_FALSE(traccc::counting_work());
+            traccc::count_work({5, 5, 5});
+        });
+        thread.join();
+    }
+    EXPECT_FALSE(traccc::counting_work());
+
+    const auto stages = counter.stages();
+    ASSERT_EQ(stages.size(), 2u);
+    EXPECT_EQ(stages.at("outer").bytes_read, 200u);
+    EXPECT_EQ(stages.at("outer").bytes_written, 20u);
+    EXPECT_EQ(stages.at("outer").flops, 2000u);
+    EXPECT_EQ(stages.at("inner").bytes_read, 2u);
+    EXPECT_EQ(stages.at("inner").bytes_written, 4u);
+    EXPECT_EQ(stages.at("inner").flops, 6u);
+}
+
+// Test the combination of the timing and the work information
+TEST(roofline, report) {
+
+    traccc::work_counter counter;
+    counter.add("Seeding", {3'000'000'000u, 1'000'000'000u, 2'000'000'000u});
+
+    traccc::performance::timing_info times;
+    times.data.push_back({"Reading", std::chrono::seconds{1}});
+    times.data.push_back({"Seeding", std::chrono::seconds{2}});
+
+    const traccc::performance::roofline_report report{
+        times, counter, {"Device", 100., 10.}};
+    ASSERT_EQ(report.entries.size(), 1u);
+    const traccc::performance::roofline_entry& entry = report.entries[0];
+    EXPECT_EQ(entry.stage, "Seeding");
+    EXPECT_DOUBLE_EQ(entry.intensity(), 0.5);
+    EXPECT_DOUBLE_EQ(entry.bandwidth(), 2.);
+    EXPECT_DOUBLE_EQ(entry.gflops(), 1.);
+
+    // The arithmetic intensity is below the ridge point of 0.1 FLOP/B.
+    std::ostringstream out;
+    out << report;
+    EXPECT_NE(out.str().find("compute bound"), std::string::npos);
+    EXPECT_NE(out.str().find("2.00 GB/s (2.0% of peak)"), std::string::npos);
+}
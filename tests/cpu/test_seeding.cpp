@@ -7,16 +7,35 @@
 
 // Project include(s).
 #include "traccc/definitions/common.hpp"
+#include "traccc/edm/nseed.hpp"
 #include "traccc/edm/spacepoint.hpp"
+#include "traccc/seeding/device/extend_seeds.hpp"
+#include "traccc/seeding/device/mask_grid.hpp"
+#include "traccc/seeding/doublet_finding.hpp"
+#include "traccc/seeding/doublet_finding_helper.hpp"
+#include "traccc/seeding/hough_seeding_algorithm.hpp"
 #include "traccc/seeding/seeding_algorithm.hpp"
+#include "traccc/seeding/spacepoint_binning.hpp"
+#include "traccc/seeding/spacepoint_roi_selection.hpp"
 #include "traccc/seeding/track_params_estimation.hpp"
+#include "traccc/seeding/triplet_finding_helper.hpp"
+#include "traccc/utils/parallel_for.hpp"
 
 // VecMem include(s).
+#include <vecmem/containers/data/vector_buffer.hpp>
+#include <vecmem/containers/vector.hpp>
 #include <vecmem/memory/host_memory_resource.hpp>
+#include <vecmem/utils/copy.hpp>
 
 // GTest include(s).
 #include <gtest/gtest.h>
 
+// System include(s).
+#include <algorithm>
+#include <cmath>
+#include <optional>
+#include <vector>
+
 using namespace traccc;
 
 namespace {
@@ -28,6 +47,22 @@ vecmem::host_memory_resource host_mr;
 static constexpr vector3 B{0. * unit<scalar>::T, 0. * unit<scalar>::T,
                            2. * unit<scalar>::T};
 
+// Make an event with spacepoints on the given number of "layers".
+spacepoint_collection_types::host make_layered_event(int n_layers) {
+
+    spacepoint_collection_types::host spacepoints;
+    for (int layer = n_layers; layer > 0; --layer) {
+        for (int i = 0; i < 20; ++i) {
+            const scalar r = static_cast<scalar>(15 * layer + i % 3);
+            const scalar phi = static_cast<scalar>(0.02 * i * layer);
+            spacepoints.push_back({{r * std::cos(phi), r * std::sin(phi),
+                                    static_cast<scalar>(10 * (i % 4))},
+                                   {}});
+        }
+    }
+    return spacepoints;
+}
+
 }  // namespace
 
 // Seeding with two muons
@@ -114,3 +149,662 @@ TEST(seeding, case2) {
                 0.1 * unit<scalar>::GeV);
     */
 }
+
+TEST(seeding, spacepoint_binning) {
+
+    // Config objects
+    traccc::seedfinder_config finder_config;
+    traccc::spacepoint_grid_config grid_config(finder_config);
+    traccc::spacepoint_binning sb(finder_config, grid_config, host_mr);
+
+    // Spacepoints on a few "layers", many of them sharing the same bins,
+    // given in order of decreasing radius.
+    spacepoint_collection_types::host spacepoints;
+    for (int layer = 10; layer > 0; --layer) {
+        for (int i = 0; i < 20; ++i) {
+            const scalar r = static_cast<scalar>(15 * layer + i % 3);
+            const scalar phi = static_cast<scalar>(0.01 * i);
+            spacepoints.push_back(
+                {{r * std::cos(phi), r * std::sin(phi),
+                  static_cast<scalar>(10 * (i % 4))},
+                 {}});
+        }
+    }
+
+    // Run the binning.
+    const sp_soa_grid_host grid = sb(spacepoints);
+    ASSERT_EQ(grid.bin_offsets.size(), grid.nbins() + 1);
+    ASSERT_EQ(grid.bin_offsets.back(), grid.size());
+
+    // Every spacepoint should be in exactly one bin, and the spacepoints of
+    // every bin should be sorted by radius.
+    for (unsigned int bin = 0; bin < grid.nbins(); ++bin) {
+        ASSERT_LE(grid.bin_begin(bin), grid.bin_end(bin));
+        EXPECT_TRUE(std::is_sorted(grid.radius.begin() + grid.bin_begin(bin),
+                                   grid.radius.begin() + grid.bin_end(bin)));
+    }
+    // Spacepoint locations should refer to the same spacepoints as the flat
+    // indices.
+    for (unsigned int i = 0; i < grid.size(); ++i) {
+        EXPECT_EQ(grid.index(grid.location(i)), i);
+    }
+    std::vector<unsigned int> links(grid.link.begin(), grid.link.end());
+    std::sort(links.begin(), links.end());
+    ASSERT_EQ(links.size(), spacepoints.size());
+    for (std::size_t i = 0; i < links.size(); ++i) {
+        EXPECT_EQ(links[i], i);
+    }
+}
+
+// Re-using the binning for events of different sizes
+TEST(seeding, spacepoint_binning_reuse) {
+
+    // Config objects
+    traccc::seedfinder_config finder_config;
+    traccc::spacepoint_grid_config grid_config(finder_config);
+    traccc::spacepoint_binning sb(finder_config, grid_config, host_mr);
+
+    // A smaller event binned after a larger one should give the same grid as
+    // with a freshly made algorithm.
+    const spacepoint_collection_types::host large_event =
+        make_layered_event(10);
+    const spacepoint_collection_types::host small_event =
+        make_layered_event(3);
+    const sp_soa_grid_host large_grid = sb(large_event);
+    ASSERT_EQ(large_grid.size(), large_event.size());
+    const sp_soa_grid_host small_grid = sb(small_event);
+    const sp_soa_grid_host fresh_grid = traccc::spacepoint_binning(
+        finder_config, grid_config, host_mr)(small_event);
+
+    ASSERT_EQ(small_grid.size(), small_event.size());
+    ASSERT_EQ(small_grid.size(), fresh_grid.size());
+    EXPECT_TRUE(std::equal(small_grid.bin_offsets.begin(),
+                           small_grid.bin_offsets.end(),
+                           fresh_grid.bin_offsets.begin(),
+                           fresh_grid.bin_offsets.end()));
+    EXPECT_TRUE(std::equal(small_grid.link.begin(), small_grid.link.end(),
+                           fresh_grid.link.begin(), fresh_grid.link.end()));
+}
+
+// Running the binning of several events at the same time, from (nested)
+// parallel loops
+TEST(seeding, spacepoint_binning_concurrent) {
+
+    // Config objects
+    traccc::seedfinder_config finder_config;
+    traccc::spacepoint_grid_config grid_config(finder_config);
+    const traccc::spacepoint_binning sb(finder_config, grid_config, host_mr);
+
+    // Events of different sizes, and their grids made one after the other.
+    static constexpr std::size_t n_events = 64;
+    std::vector<spacepoint_collection_types::host> events;
+    std::vector<sp_soa_grid_host> reference_grids;
+    for (std::size_t i = 0; i < n_events; ++i) {
+        events.push_back(make_layered_event(static_cast<int>(1 + i % 10)));
+        reference_grids.push_back(sb(events.back()));
+    }
+
+    // Bin all events in parallel a few times. The threads waiting for the
+    // parallel loops of the binning must not pick up the binning of other
+    // events in the meantime.
+    for (int repetition = 0; repetition < 5; ++repetition) {
+        std::vector<std::optional<sp_soa_grid_host>> grids(n_events);
+        traccc::details::parallel_for(
+            n_events, [&](std::size_t i) { grids[i].emplace(sb(events[i])); });
+        for (std::size_t i = 0; i < n_events; ++i) {
+            ASSERT_TRUE(grids[i].has_value());
+            const sp_soa_grid_host& grid = *(grids[i]);
+            const sp_soa_grid_host& reference = reference_grids[i];
+            ASSERT_EQ(grid.size(), reference.size());
+            EXPECT_TRUE(std::equal(grid.bin_offsets.begin(),
+                                   grid.bin_offsets.end(),
+                                   reference.bin_offsets.begin(),
+                                   reference.bin_offsets.end()));
+            EXPECT_TRUE(std::equal(grid.link.begin(), grid.link.end(),
+                                   reference.link.begin(),
+                                   reference.link.end()));
+        }
+    }
+}
+
+TEST(seeding, radius_window) {
+
+    traccc::seedfinder_config finder_config;
+    const std::vector<scalar> radii = {30.f, 31.f, 35.f, 40.f, 40.f, 60.f,
+                                       80.f, 95.f, 101.f, 150.f, 199.f};
+
+    // The same window as a linear scan of the sorted radii gives.
+    for (scalar r1 : {20.f, 35.f, 40.5f, 90.f, 100.f, 140.f, 300.f}) {
+        unsigned int begin = 0;
+        while (begin < radii.size() &&
+               doublet_finding_helper::isBelowDeltaRRange<
+                   details::spacepoint_type::bottom>(r1, radii[begin],
+                                                     finder_config)) {
+            ++begin;
+        }
+        unsigned int end = begin;
+        while (end < radii.size() &&
+               !doublet_finding_helper::isAboveDeltaRRange<
+                   details::spacepoint_type::top>(r1, radii[end],
+                                                  finder_config)) {
+            ++end;
+        }
+        const darray<unsigned int, 2> window =
+            doublet_finding_helper::radiusWindow(
+                radii, 0u, static_cast<unsigned int>(radii.size()), r1,
+                finder_config);
+        EXPECT_EQ(window[0], begin) << r1;
+        EXPECT_EQ(window[1], end) << r1;
+    }
+
+    // A sub-range of the radii.
+    const darray<unsigned int, 2> window =
+        doublet_finding_helper::radiusWindow(radii, 3u, 6u, 105.f,
+                                             finder_config);
+    EXPECT_EQ(window[0], 5u);
+    EXPECT_EQ(window[1], 6u);
+}
+
+TEST(seeding, compressed_grid) {
+
+    // Config objects
+    traccc::seedfinder_config finder_config;
+    traccc::spacepoint_grid_config grid_config(finder_config);
+    traccc::spacepoint_binning sb(finder_config, grid_config, host_mr);
+
+    // Spacepoints on a few layers, spread in Z.
+    spacepoint_collection_types::host spacepoints;
+    for (int layer = 1; layer <= 6; ++layer) {
+        for (int i = 0; i < 30; ++i) {
+            const scalar r = static_cast<scalar>(35 * layer) + 0.37f * i;
+            const scalar phi = static_cast<scalar>(0.005 * i);
+            spacepoints.push_back({{r * std::cos(phi), r * std::sin(phi),
+                                    static_cast<scalar>(7.3 * (i - 15))},
+                                   {}});
+        }
+    }
+    const sp_soa_grid_host grid = sb(spacepoints);
+
+    // The decompressed intervals hold the full precision coordinates.
+    for (unsigned int bin = 0; bin < grid.nbins(); ++bin) {
+        const compressed_rz_bin cbin = grid.compressed_bin(bin);
+        for (unsigned int i = grid.bin_begin(bin); i < grid.bin_end(bin);
+             ++i) {
+            const rz_interval rz = cbin.decompress(grid.rz[i]);
+            EXPECT_LE(rz.r_lo, grid.radius[i]);
+            EXPECT_GE(rz.r_hi, grid.radius[i]);
+            EXPECT_LE(rz.z_lo, grid.z[i]);
+            EXPECT_GE(rz.z_hi, grid.z[i]);
+            if (rz.r_lo > -compressed_rz_helper::unbounded) {
+                EXPECT_LT(rz.r_hi - rz.r_lo, 0.1f);
+            }
+        }
+    }
+
+    // The pre-selection never rejects a compatible pair.
+    unsigned int n_compatible = 0;
+    for (unsigned int m = 0; m < grid.size(); ++m) {
+        const internal_spacepoint<spacepoint> spM = grid.at(m);
+        for (unsigned int bin = 0; bin < grid.nbins(); ++bin) {
+            const compressed_rz_bin cbin = grid.compressed_bin(bin);
+            bool stopped = false;
+            for (unsigned int i = grid.bin_begin(bin); i < grid.bin_end(bin);
+                 ++i) {
+                const compressed_preselection pre =
+                    doublet_finding_helper::preselect(
+                        spM, cbin.decompress(grid.rz[i]), finder_config);
+                stopped |= (pre == compressed_preselection::stop);
+                const bool compatible =
+                    doublet_finding_helper::isCompatible<
+                        details::spacepoint_type::bottom>(
+                        spM, grid.radius[i], grid.z[i], finder_config) ||
+                    doublet_finding_helper::isCompatible<
+                        details::spacepoint_type::top>(
+                        spM, grid.radius[i], grid.z[i], finder_config);
+                if (compatible) {
+                    ++n_compatible;
+                    EXPECT_EQ(pre, compressed_preselection::test);
+                    EXPECT_FALSE(stopped);
+                }
+            }
+        }
+    }
+    EXPECT_GT(n_compatible, 0u);
+}
+
+TEST(seeding, masked_grid) {
+
+    // Config objects
+    traccc::seedfinder_config finder_config;
+    traccc::spacepoint_grid_config grid_config(finder_config);
+    traccc::spacepoint_binning sb(finder_config, grid_config, host_mr);
+
+    // Spacepoints on a few layers.
+    spacepoint_collection_types::host spacepoints;
+    for (int layer = 1; layer <= 4; ++layer) {
+        for (int i = 0; i < 20; ++i) {
+            const scalar r = static_cast<scalar>(40 * layer) + 0.5f * i;
+            const scalar phi = static_cast<scalar>(0.01 * i);
+            spacepoints.push_back({{r * std::cos(phi), r * std::sin(phi),
+                                    static_cast<scalar>(5.1 * (i - 10))},
+                                   {}});
+        }
+    }
+    const sp_soa_grid_host grid = sb(spacepoints);
+    ASSERT_GT(grid.size(), 0u);
+
+    // Mask every other spacepoint.
+    vecmem::vector<unsigned int> used(
+        device::bitmask_size(static_cast<unsigned int>(spacepoints.size())),
+        0u, &host_mr);
+    for (unsigned int i = 0; i < spacepoints.size(); i += 2) {
+        used[i / device::bitmask_word_bits] |=
+            1u << (i % device::bitmask_word_bits);
+    }
+
+    // Count the unused spacepoints of every bin, and fill the masked grid.
+    vecmem::vector<unsigned int> bin_sizes(grid.nbins(), 0u, &host_mr);
+    for (unsigned int bin = 0; bin < grid.nbins(); ++bin) {
+        device::count_masked_grid_bin(bin, get_data(grid),
+                                      vecmem::get_data(used),
+                                      vecmem::get_data(bin_sizes));
+    }
+    sp_soa_grid_host masked_grid(grid.phi_axis, grid.z_axis, host_mr);
+    for (unsigned int bin = 0; bin < grid.nbins(); ++bin) {
+        masked_grid.bin_offsets[bin + 1] =
+            masked_grid.bin_offsets[bin] + bin_sizes[bin];
+    }
+    masked_grid.resize(masked_grid.bin_offsets.back());
+    for (unsigned int bin = 0; bin < grid.nbins(); ++bin) {
+        device::fill_masked_grid_bin(bin, get_data(grid),
+                                     vecmem::get_data(used),
+                                     get_data(masked_grid));
+    }
+
+    // Only the unused spacepoints are kept, sorted by radius in every bin.
+    unsigned int n_unused = 0;
+    for (unsigned int i = 0; i < grid.size(); ++i) {
+        n_unused += (grid.link[i] % 2 == 1) ? 1u : 0u;
+    }
+    ASSERT_EQ(masked_grid.size(), n_unused);
+    for (unsigned int bin = 0; bin < masked_grid.nbins(); ++bin) {
+        const compressed_rz_bin cbin = masked_grid.compressed_bin(bin);
+        for (unsigned int i = masked_grid.bin_begin(bin);
+             i < masked_grid.bin_end(bin); ++i) {
+            EXPECT_EQ(masked_grid.link[i] % 2, 1u);
+            if (i > masked_grid.bin_begin(bin)) {
+                EXPECT_LE(masked_grid.radius[i - 1], masked_grid.radius[i]);
+            }
+            const rz_interval rz = cbin.decompress(masked_grid.rz[i]);
+            EXPECT_LE(rz.r_lo, masked_grid.radius[i]);
+            EXPECT_GE(rz.r_hi, masked_grid.radius[i]);
+        }
+    }
+}
+
+TEST(seeding, adaptive_z_binning) {
+
+    // Config objects
+    traccc::seedfinder_config finder_config;
+    traccc::spacepoint_grid_config grid_config(finder_config);
+
+    // Spacepoints on a few layers, with most of them at small |Z|.
+    spacepoint_collection_types::host spacepoints;
+    for (int layer = 1; layer <= 5; ++layer) {
+        for (int i = 0; i < 60; ++i) {
+            const scalar r = static_cast<scalar>(35 * layer);
+            const scalar phi = static_cast<scalar>(0.004 * i);
+            const scalar u = static_cast<scalar>(i - 30) / 30.f;
+            spacepoints.push_back({{r * std::cos(phi), r * std::sin(phi),
+                                    1100.f * u * u * u + 0.1f * layer},
+                                   {}});
+        }
+    }
+
+    // Derive the Z bins from the spacepoints.
+    grid_config.zBinEdges =
+        adaptive_z_bin_edges(finder_config, grid_config, spacepoints);
+    ASSERT_GE(grid_config.zBinEdges.size(), 2u);
+    EXPECT_FLOAT_EQ(grid_config.zBinEdges.front(), finder_config.zMin);
+    EXPECT_FLOAT_EQ(grid_config.zBinEdges.back(), finder_config.zMax);
+    EXPECT_TRUE(std::is_sorted(grid_config.zBinEdges.begin(),
+                               grid_config.zBinEdges.end()));
+
+    traccc::spacepoint_binning regular_sb(
+        finder_config, traccc::spacepoint_grid_config(finder_config), host_mr);
+    traccc::spacepoint_binning adaptive_sb(finder_config, grid_config,
+                                           host_mr);
+    const sp_soa_grid_host regular_grid = regular_sb(spacepoints);
+    const sp_soa_grid_host adaptive_grid = adaptive_sb(spacepoints);
+    ASSERT_TRUE(adaptive_grid.axis_p1().is_adaptive());
+    ASSERT_EQ(regular_grid.size(), adaptive_grid.size());
+
+    // The most occupied Z bin holds fewer spacepoints with adaptive bins.
+    auto max_z_occupancy = [](const sp_soa_grid_host& grid) {
+        unsigned int result = 0;
+        const unsigned int n_phi =
+            static_cast<unsigned int>(grid.axis_p0().bins());
+        for (unsigned int z_bin = 0; z_bin < grid.axis_p1().bins(); ++z_bin) {
+            unsigned int n = 0;
+            for (unsigned int phi_bin = 0; phi_bin < n_phi; ++phi_bin) {
+                n += grid.bin_size(grid.bin_index(phi_bin, z_bin));
+            }
+            result = std::max(result, n);
+        }
+        return result;
+    };
+    EXPECT_LT(max_z_occupancy(adaptive_grid), max_z_occupancy(regular_grid));
+
+    // Every spacepoint is in the Z bin holding its Z coordinate.
+    const unsigned int n_phi =
+        static_cast<unsigned int>(adaptive_grid.axis_p0().bins());
+    for (unsigned int i = 0; i < adaptive_grid.size(); ++i) {
+        const unsigned int z_bin = adaptive_grid.bin_of(i) / n_phi;
+        EXPECT_GE(adaptive_grid.z[i], adaptive_grid.axis_p1().lower(z_bin));
+        EXPECT_LE(adaptive_grid.z[i], adaptive_grid.axis_p1().upper(z_bin));
+    }
+
+    // The doublet finding finds the same doublets with both grids.
+    auto count_doublets = [&](const sp_soa_grid_host& grid) {
+        doublet_finding<details::spacepoint_type::bottom> find_bottom(
+            finder_config);
+        doublet_finding<details::spacepoint_type::top> find_top(
+            finder_config);
+        std::size_t result = 0;
+        for (unsigned int i = 0; i < grid.size(); ++i) {
+            result += find_bottom(grid, grid.location(i)).first.size() +
+                      find_top(grid, grid.location(i)).first.size();
+        }
+        return result;
+    };
+    const std::size_t n_doublets = count_doublets(regular_grid);
+    EXPECT_GT(n_doublets, 0u);
+    EXPECT_EQ(count_doublets(adaptive_grid), n_doublets);
+}
+
+TEST(seeding, seed_extension) {
+
+    // Config objects
+    traccc::seedfinder_config finder_config;
+    traccc::spacepoint_grid_config grid_config(finder_config);
+    traccc::seed_extension_config extension_config;
+    extension_config.max_seed_size = 5;
+    extension_config.min_seed_size = 4;
+    traccc::spacepoint_binning sb(finder_config, grid_config, host_mr);
+
+    spacepoint_collection_types::host spacepoints;
+
+    // Spacepoints from 16.62 GeV muon
+    spacepoints.push_back({{36.6706, 10.6472, 104.131}, {}});
+    spacepoints.push_back({{94.2191, 29.6699, 113.628}, {}});
+    spacepoints.push_back({{149.805, 47.9518, 122.979}, {}});
+    spacepoints.push_back({{218.514, 70.3049, 134.029}, {}});
+    spacepoints.push_back({{275.359, 88.668, 143.378}, {}});
+    // Spacepoints not compatible with the muon, at the same radii
+    spacepoints.push_back({{218.514, 70.3049, 140.029}, {}});
+    spacepoints.push_back({{70.3049, 218.514, 134.029}, {}});
+
+    // Bin the spacepoints.
+    const sp_soa_grid_host grid = sb(spacepoints);
+
+    // Seeds for the muon, and for some of the incompatible spacepoints.
+    seed_collection_types::host seeds{&host_mr};
+    seeds.push_back({0u, 1u, 2u, 0.f, 0.f});
+    seeds.push_back({0u, 1u, 6u, 0.f, 0.f});
+
+    // Extend the seeds on the host.
+    vecmem::copy copy;
+    extended_seed_collection_types::host nseeds(seeds.size(), &host_mr);
+    seed_collection_types::buffer kept_seeds(
+        static_cast<unsigned int>(seeds.size()), host_mr,
+        vecmem::data::buffer_type::resizable);
+    copy.setup(kept_seeds);
+    for (std::size_t i = 0; i < seeds.size(); ++i) {
+        device::extend_seeds(i, finder_config, extension_config,
+                             vecmem::get_data(spacepoints), get_data(grid),
+                             vecmem::get_data(seeds),
+                             vecmem::get_data(nseeds), kept_seeds);
+    }
+
+    // The muon seed should pick up the rest of the muon's spacepoints.
+    ASSERT_EQ(nseeds[0].size(), 5u);
+    EXPECT_EQ(nseeds[0][3], 3u);
+    EXPECT_EQ(nseeds[0][4], 4u);
+
+    // The other seed should not be extended, and hence not be kept.
+    EXPECT_EQ(nseeds[1].size(), 3u);
+    seed_collection_types::host kept_seeds_host{&host_mr};
+    copy(kept_seeds, kept_seeds_host);
+    ASSERT_EQ(kept_seeds_host.size(), 1u);
+    EXPECT_EQ(kept_seeds_host[0].spT_link, 2u);
+}
+
+TEST(seeding, hough_transform) {
+
+    traccc::hough_seeding_config hough_config;
+    hough_config.rMax = 300. * unit<scalar>::mm;
+    traccc::hough_seeding_algorithm ha(hough_config, host_mr);
+
+    spacepoint_collection_types::host spacepoints;
+
+    // Spacepoints from 16.62 GeV muon
+    spacepoints.push_back({{36.6706, 10.6472, 104.131}, {}});
+    spacepoints.push_back({{94.2191, 29.6699, 113.628}, {}});
+    spacepoints.push_back({{149.805, 47.9518, 122.979}, {}});
+    spacepoints.push_back({{218.514, 70.3049, 134.029}, {}});
+    spacepoints.push_back({{275.359, 88.668, 143.378}, {}});
+    // Spacepoints not compatible with the muon, at the same radii
+    spacepoints.push_back({{218.514, 70.3049, 140.029}, {}});
+    spacepoints.push_back({{70.3049, 218.514, 134.029}, {}});
+
+    const auto seeds = ha(spacepoints);
+
+    // The muon needs to be found, and all seeds need to be made of its
+    // spacepoints, ordered from the inside out.
+    ASSERT_FALSE(seeds.empty());
+    for (const seed& s : seeds) {
+        EXPECT_LT(s.spB_link, s.spM_link);
+        EXPECT_LT(s.spM_link, s.spT_link);
+        EXPECT_LT(s.spT_link, 5u);
+        EXPECT_GE(s.weight, static_cast<scalar>(hough_config.minLayers));
+    }
+}
+
+TEST(seeding, multi_threaded) {
+
+    // Config objects
+    traccc::seedfinder_config finder_config;
+    traccc::spacepoint_grid_config grid_config(finder_config);
+    traccc::seedfilter_config filter_config;
+
+    // Adjust parameters
+    finder_config.deltaRMax = 100. * unit<scalar>::mm;
+    finder_config.maxPtScattering = 0.5 * unit<scalar>::GeV;
+    traccc::seeding_algorithm sa_st(finder_config, grid_config, filter_config,
+                                    host_mr);
+    traccc::seeding_algorithm sa_mt(finder_config, grid_config, filter_config,
+                                    host_mr, true);
+
+    // Spacepoints of many straight tracks from the origin, spread out in phi
+    // and in Z, so that they end up in many different bins.
+    spacepoint_collection_types::host spacepoints;
+    for (int track = 0; track < 200; ++track) {
+        const scalar phi = static_cast<scalar>(0.031 * track);
+        const scalar cot_theta = static_cast<scalar>(0.1 * (track % 20) - 1.);
+        for (scalar r : {36.f, 94.f, 150.f, 218.f, 275.f}) {
+            spacepoints.push_back(
+                {{r * std::cos(phi), r * std::sin(phi), r * cot_theta}, {}});
+        }
+    }
+
+    // Run the seeding both ways.
+    const auto seeds_st = sa_st(spacepoints);
+    const auto seeds_mt = sa_mt(spacepoints);
+
+    // The results should be identical, in the same order.
+    EXPECT_GT(seeds_st.size(), 0u);
+    ASSERT_EQ(seeds_st.size(), seeds_mt.size());
+    for (std::size_t i = 0; i < seeds_st.size(); ++i) {
+        EXPECT_EQ(seeds_st[i].spB_link, seeds_mt[i].spB_link);
+        EXPECT_EQ(seeds_st[i].spM_link, seeds_mt[i].spM_link);
+        EXPECT_EQ(seeds_st[i].spT_link, seeds_mt[i].spT_link);
+        EXPECT_EQ(seeds_st[i].weight, seeds_mt[i].weight);
+        EXPECT_EQ(seeds_st[i].z_vertex, seeds_mt[i].z_vertex);
+    }
+}
+
+// The batched compatibility checks must agree with the single-candidate ones
+TEST(seeding, batched_helpers) {
+
+    traccc::seedfinder_config config;
+
+    // A middle spacepoint and a number of candidates around it. Every second
+    // candidate is on the straight line going through the origin and the
+    // middle spacepoint, the others are scattered around.
+    traccc::internal_spacepoint<traccc::spacepoint> spM{};
+    spM.m_x = 70.f;
+    spM.m_y = 60.f;
+    spM.m_z = 40.f;
+    spM.m_r = std::sqrt(spM.m_x * spM.m_x + spM.m_y * spM.m_y);
+    const scalar phiM = std::atan2(spM.m_y, spM.m_x);
+    std::vector<scalar> x, y, z, r;
+    for (int i = 0; i < 150; ++i) {
+        const scalar radius = static_cast<scalar>(2 * i + 1);
+        const bool on_line = (i % 2 == 0);
+        const scalar phi =
+            on_line ? phiM : phiM + 0.002f * static_cast<scalar>(i % 7);
+        x.push_back(radius * std::cos(phi));
+        y.push_back(radius * std::sin(phi));
+        z.push_back(on_line ? radius * spM.m_z / spM.m_r
+                            : static_cast<scalar>((i * 37) % 400) - 150.f);
+        r.push_back(radius);
+    }
+    const auto n = static_cast<unsigned int>(r.size());
+    std::vector<unsigned int> all_indices(n);
+    for (unsigned int i = 0; i < n; ++i) {
+        all_indices[i] = i;
+    }
+
+    // Check the doublet compatibility both ways.
+    std::vector<unsigned char> bottom(n), top(n);
+    traccc::doublet_finding_helper::isCompatible<
+        traccc::details::spacepoint_type::bottom>(spM, r.data(), z.data(), n,
+                                                  config, bottom.data());
+    traccc::doublet_finding_helper::isCompatible<
+        traccc::details::spacepoint_type::top>(spM, r.data(), z.data(), n,
+                                               config, top.data());
+    std::vector<traccc::lin_circle> lbs(n), lts(n);
+    traccc::doublet_finding_helper::transform_coordinates<
+        traccc::details::spacepoint_type::bottom>(spM, x.data(), y.data(),
+                                                  z.data(), all_indices.data(),
+                                                  n, lbs.data());
+    traccc::doublet_finding_helper::transform_coordinates<
+        traccc::details::spacepoint_type::top>(spM, x.data(), y.data(),
+                                               z.data(), all_indices.data(), n,
+                                               lts.data());
+
+    unsigned int n_bottom = 0, n_top = 0;
+    for (unsigned int i = 0; i < n; ++i) {
+        traccc::internal_spacepoint<traccc::spacepoint> sp{};
+        sp.m_x = x[i];
+        sp.m_y = y[i];
+        sp.m_z = z[i];
+        sp.m_r = r[i];
+        EXPECT_EQ(static_cast<bool>(bottom[i]),
+                  traccc::doublet_finding_helper::isCompatible<
+                      traccc::details::spacepoint_type::bottom>(spM, sp,
+                                                                config));
+        EXPECT_EQ(static_cast<bool>(top[i]),
+                  traccc::doublet_finding_helper::isCompatible<
+                      traccc::details::spacepoint_type::top>(spM, sp, config));
+        const traccc::lin_circle lb =
+            traccc::doublet_finding_helper::transform_coordinates<
+                traccc::details::spacepoint_type::bottom>(spM, sp);
+        EXPECT_EQ(lb.U(), lbs[i].U());
+        EXPECT_EQ(lb.V(), lbs[i].V());
+        EXPECT_EQ(lb.cotTheta(), lbs[i].cotTheta());
+        n_bottom += bottom[i];
+        n_top += top[i];
+    }
+    EXPECT_GT(n_bottom, 0u);
+    EXPECT_GT(n_top, 0u);
+
+    // Check the triplet compatibility both ways, for every bottom candidate.
+    std::vector<scalar> curvature(n), impact_parameter(n);
+    std::vector<unsigned char> compatible(n);
+    unsigned int n_triplets = 0;
+    for (unsigned int b = 0; b < n; ++b) {
+        const traccc::lin_circle& lb = lbs[b];
+        const scalar iSinTheta2 = 1 + lb.cotTheta() * lb.cotTheta();
+        const scalar scatteringInRegion2 = config.maxScatteringAngle2 *
+                                           iSinTheta2 * config.sigmaScattering *
+                                           config.sigmaScattering;
+        traccc::triplet_finding_helper::isCompatible(
+            spM, lb, lts.data(), n, config, iSinTheta2, scatteringInRegion2,
+            curvature.data(), impact_parameter.data(), compatible.data());
+        for (unsigned int t = 0; t < n; ++t) {
+            scalar curv = 0.f, impact = 0.f;
+            const bool result = traccc::triplet_finding_helper::isCompatible(
+                spM, lb, lts[t], config, iSinTheta2, scatteringInRegion2, curv,
+                impact);
+            ASSERT_EQ(static_cast<bool>(compatible[t]), result);
+            if (result) {
+                EXPECT_EQ(curv, curvature[t]);
+                EXPECT_EQ(impact, impact_parameter[t]);
+                ++n_triplets;
+            }
+        }
+    }
+    EXPECT_GT(n_triplets, 0u);
+}
+
+TEST(seeding, roi_selection) {
+
+    // A region in positive eta, around phi = 0, and one (wrapping around)
+    // around phi = pi.
+    region_of_interest_collection_types::host rois;
+    rois.push_back({0.5f, 1.5f, -0.2f, 0.2f, -10.f, 10.f});
+    rois.push_back({-0.5f, 0.5f, 3.05f, -3.05f, -10.f, 10.f});
+
+    // Spacepoints at a fixed radius, scanning phi and z.
+    static constexpr scalar r = 100.f;
+    spacepoint_collection_types::host spacepoints;
+    for (int iphi = -31; iphi <= 31; ++iphi) {
+        for (int iz = -10; iz <= 10; ++iz) {
+            const scalar phi = static_cast<scalar>(0.1 * iphi);
+            spacepoints.push_back({{r * std::cos(phi), r * std::sin(phi),
+                                    static_cast<scalar>(25 * iz)},
+                                   {}});
+        }
+    }
+
+    // Select the spacepoints in the regions.
+    traccc::spacepoint_roi_selection rs(host_mr);
+    const auto selected = rs(spacepoints, rois);
+    ASSERT_GT(selected.size(), 0u);
+    ASSERT_LT(selected.size(), spacepoints.size());
+
+    // Every spacepoint should be selected if and only if it is inside of one
+    // of the regions, with the order of the spacepoints kept.
+    std::size_t i_selected = 0;
+    for (const spacepoint& sp : spacepoints) {
+        const scalar phi = std::atan2(sp.y(), sp.x());
+        const bool in_rois = std::any_of(
+            rois.begin(), rois.end(),
+            [&sp](const region_of_interest& roi) {
+                return roi.contains(sp.global);
+            });
+        // A spacepoint at z = 0 is inside of the central region near pi.
+        if (sp.z() == 0.f) {
+            EXPECT_EQ(in_rois, std::abs(phi) > 3.05f);
+        }
+        if (in_rois) {
+            ASSERT_LT(i_selected, selected.size());
+            EXPECT_EQ(selected.at(i_selected).x(), sp.x());
+            EXPECT_EQ(selected.at(i_selected).y(), sp.y());
+            EXPECT_EQ(selected.at(i_selected).z(), sp.z());
+            ++i_selected;
+        }
+    }
+    EXPECT_EQ(i_selected, selected.size());
+}
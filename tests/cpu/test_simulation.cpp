@@ -12,6 +12,8 @@
 #include "traccc/io/csv/make_measurement_reader.hpp"
 #include "traccc/io/csv/make_particle_reader.hpp"
 #include "traccc/simulation/simulator.hpp"
+#include "traccc/simulation/smearing_recorder.hpp"
+#include "traccc/utils/philox.hpp"
 
 // Detray include(s).
 #include "detray/detectors/bfield.hpp"
@@ -29,7 +31,10 @@
 #include <gtest/gtest.h>
 
 // System include(s).
+#include <array>
 #include <filesystem>
+#include <string>
+#include <vector>
 
 using namespace traccc;
 using namespace detray;
@@ -67,6 +72,63 @@ TEST(simulation, simulation) {
     ASSERT_NEAR(iomeas3.local1, -3.f, tol);
 }
 
+TEST(simulation, philox) {
+
+    // Known answers of the reference implementation of Philox4x32-10.
+    EXPECT_EQ(philox4x32::generate({0u, 0u, 0u, 0u}, {0u, 0u}),
+              (philox4x32::counter_type{0x6627e8d5u, 0xe169c58du,
+                                        0xbc57ac4cu, 0x9b00dbd8u}));
+    EXPECT_EQ(philox4x32::generate(
+                  {0xffffffffu, 0xffffffffu, 0xffffffffu, 0xffffffffu},
+                  {0xffffffffu, 0xffffffffu}),
+              (philox4x32::counter_type{0x408f276du, 0x41c83b0eu,
+                                        0xa20bc7c6u, 0x6d5451fdu}));
+}
+
+TEST(simulation, counter_based_smearing) {
+
+    measurement_smearer<transform3> smearer(50.f * detray::unit<scalar>::um,
+                                            50.f * detray::unit<scalar>::um);
+    smearer.set_seed(42u);
+
+    using hit_key = measurement_smearer<transform3>::hit_key;
+    std::vector<hit_key> hits;
+    for (std::uint64_t particle = 0u; particle < 100u; ++particle) {
+        for (std::uint64_t surface = 0u; surface < 10u; ++surface) {
+            hits.push_back({particle, (surface << 20u) | 3u});
+        }
+    }
+
+    // The batched smearing needs to give the offsets of the individual hits,
+    // in whatever order they are smeared.
+    std::vector<std::array<scalar, 2>> offsets(hits.size());
+    smearer.get_offsets(hits, offsets);
+    for (std::size_t i = hits.size(); i > 0u; --i) {
+        const hit_key& hit = hits[i - 1u];
+        EXPECT_EQ(smearer.get_offset(hit.particle_id, hit.surface_id),
+                  offsets[i - 1u]);
+    }
+
+    // A copy of the smearer, with the same seed, gives the same offsets. A
+    // different seed gives different ones.
+    measurement_smearer<transform3> copy = smearer;
+    EXPECT_EQ(copy.get_offset(12u, 34u), smearer.get_offset(12u, 34u));
+    copy.set_seed(43u);
+    EXPECT_NE(copy.get_offset(12u, 34u), smearer.get_offset(12u, 34u));
+
+    // The offsets follow the expected distribution.
+    scalar mean = 0.f;
+    scalar var = 0.f;
+    for (const auto& offset : offsets) {
+        mean += offset[0] + offset[1];
+        var += offset[0] * offset[0] + offset[1] * offset[1];
+    }
+    mean /= static_cast<scalar>(2u * offsets.size());
+    var /= static_cast<scalar>(2u * offsets.size());
+    EXPECT_NEAR(mean, 0.f, 0.1f * smearer.stddev[0]);
+    EXPECT_NEAR(std::sqrt(var), smearer.stddev[0], 0.05f * smearer.stddev[0]);
+}
+
 GTEST_TEST(detray_simulation, toy_detector_simulation) {
 
     // Create geometry
@@ -192,6 +254,105 @@ GTEST_TEST(detray_simulation, toy_detector_simulation) {
     }
 }
 
+GTEST_TEST(detray_simulation, in_memory_recording) {
+
+    // Create geometry
+    vecmem::host_memory_resource host_mr;
+
+    // Create B field
+    using b_field_t = covfie::field<detray::bfield::const_bknd_t>;
+    const vector3 B{0.f, 0.f, 2.f * detray::unit<scalar>::T};
+    auto field = detray::bfield::create_const_field(B);
+
+    // Create geometry
+    detray::toy_det_config<scalar> toy_cfg{};
+    toy_cfg.module_mat_thickness(0.15f * detray::unit<scalar>::mm);
+    const auto [detector, names] = detray::build_toy_detector(host_mr, toy_cfg);
+
+    // Create (identical) track generators for the two simulations
+    using uniform_gen_t =
+        detray::random_numbers<scalar, std::uniform_real_distribution<scalar>,
+                               std::seed_seq>;
+    using generator_type =
+        detray::random_track_generator<traccc::free_track_parameters,
+                                       uniform_gen_t>;
+    generator_type::configuration gen_cfg{};
+    constexpr unsigned int n_tracks{100u};
+    gen_cfg.n_tracks(n_tracks);
+    gen_cfg.origin(vector3{0.f, 0.f, 0.f});
+
+    // Create smearer
+    measurement_smearer<transform3> smearer(67.f * detray::unit<scalar>::um,
+                                            170.f * detray::unit<scalar>::um);
+
+    constexpr std::size_t n_events{5u};
+    const std::string directory = "in_memory_recording/";
+    std::filesystem::create_directory(directory);
+
+    using detector_type = decltype(detector);
+
+    // Simulate into files
+    using writer_type = smearing_writer<measurement_smearer<transform3>>;
+    typename writer_type::config writer_cfg{smearer};
+    auto file_sim =
+        simulator<detector_type, b_field_t, generator_type, writer_type>(
+            n_events, detector, field, generator_type(gen_cfg),
+            std::move(writer_cfg), directory);
+    file_sim.get_config().propagation.navigation.search_window = {3u, 3u};
+    file_sim.run();
+
+    // Simulate into memory, with multiple threads
+    simulated_event_store store;
+    using recorder_type = smearing_recorder<measurement_smearer<transform3>>;
+    typename recorder_type::config recorder_cfg{smearer, &store};
+    auto memory_sim =
+        simulator<detector_type, b_field_t, generator_type, recorder_type>(
+            n_events, detector, field, generator_type(gen_cfg),
+            std::move(recorder_cfg));
+    memory_sim.get_config().propagation.navigation.search_window = {3u, 3u};
+    memory_sim.get_config().n_threads = 2u;
+    memory_sim.run();
+
+    ASSERT_EQ(store.events().size(), n_events);
+
+    for (std::size_t i_event = 0u; i_event < n_events; i_event++) {
+
+        std::vector<traccc::io::csv::measurement> measurements;
+        auto measurement_reader = traccc::io::csv::make_measurement_reader(
+            directory +
+            traccc::io::get_event_filename(i_event, "-measurements.csv"));
+        traccc::io::csv::measurement io_measurement;
+        while (measurement_reader.read(io_measurement)) {
+            measurements.push_back(io_measurement);
+        }
+
+        const simulated_event& event = store.events()[i_event];
+        ASSERT_EQ(event.particles.size(), n_tracks);
+        ASSERT_EQ(event.measurements.size(), measurements.size());
+
+        // The recorded measurements are sorted by surface, but are otherwise
+        // the same as the ones written to file.
+        std::size_t n_track_measurements = 0u;
+        for (const auto& track : event.truth_tracks) {
+            n_track_measurements += track.measurements.size();
+        }
+        ASSERT_EQ(n_track_measurements, measurements.size());
+        for (std::size_t i = 0u; i < event.measurements.size(); i++) {
+            const traccc::measurement& meas = event.measurements[i];
+            if (i > 0u) {
+                ASSERT_FALSE(meas.surface_link <
+                             event.measurements[i - 1u].surface_link);
+            }
+            const auto& iomeas = measurements.at(meas.measurement_id);
+            EXPECT_EQ(meas.surface_link.value(), iomeas.geometry_id);
+            EXPECT_EQ(event.modules.at(meas.module_link).surface_link,
+                      meas.surface_link);
+            EXPECT_NEAR(meas.local[0], iomeas.local0, tol);
+            EXPECT_NEAR(meas.local[1], iomeas.local1, tol);
+        }
+    }
+}
+
 // Test parameters: <initial momentum, theta direction, charge>
 class TelescopeDetectorSimulation
     : public ::testing::TestWithParam<
@@ -6,6 +6,7 @@
  */
 
 // Project include(s).
+#include "traccc/clusterization/spacepoint_formation.hpp"
 #include "traccc/definitions/common.hpp"
 #include "traccc/edm/spacepoint.hpp"
 #include "traccc/seeding/experimental/spacepoint_formation.hpp"
@@ -21,6 +22,9 @@
 // GTest include(s).
 #include <gtest/gtest.h>
 
+// System include(s).
+#include <cmath>
+
 using namespace traccc;
 
 TEST(spacepoint_formation, cpu) {
@@ -71,3 +75,49 @@ TEST(spacepoint_formation, cpu) {
     EXPECT_FLOAT_EQ(spacepoints[1].global[1], 10.f);
     EXPECT_FLOAT_EQ(spacepoints[1].global[2], 15.f);
 }
+
+TEST(spacepoint_formation, host) {
+
+    // Memory resource used by the EDM.
+    vecmem::host_memory_resource host_mr;
+
+    // Create some rotated and translated modules.
+    cell_module_collection_types::host modules{&host_mr};
+    for (unsigned int i = 0; i < 4u; ++i) {
+        cell_module m;
+        const scalar phi = 0.4f * static_cast<scalar>(i);
+        m.placement =
+            transform3{vector3{10.f * i, -5.f, 2.f * i}, vector3{0.f, 0.f, 1.f},
+                       vector3{std::cos(phi), std::sin(phi), 0.f}};
+        modules.push_back(m);
+    }
+
+    // Create measurements on the modules. With a long run on one module, that
+    // has to be processed in multiple blocks, and with short runs of the
+    // same module interleaved with other ones.
+    measurement_collection_types::host measurements{&host_mr};
+    for (unsigned int i = 0; i < 150u; ++i) {
+        measurement m;
+        m.local = {0.1f * static_cast<scalar>(i),
+                   -0.2f * static_cast<scalar>(i)};
+        m.module_link = (i < 100u ? 1u : i % 4u);
+        measurements.push_back(m);
+    }
+
+    // Run spacepoint formation
+    traccc::spacepoint_formation sp_formation(host_mr);
+    auto spacepoints = sp_formation(measurements, modules);
+
+    // Check the results, against transforming the measurements one by one.
+    ASSERT_EQ(spacepoints.size(), measurements.size());
+    for (unsigned int i = 0; i < measurements.size(); ++i) {
+        const measurement& meas = measurements[i];
+        const point3 expected =
+            modules[meas.module_link].placement.point_to_global(
+                point3{meas.local[0], meas.local[1], 0.f});
+        for (unsigned int dim = 0; dim < 3u; ++dim) {
+            EXPECT_NEAR(spacepoints[i].global[dim], expected[dim], 1e-3f);
+        }
+        EXPECT_EQ(spacepoints[i].meas, meas);
+    }
+}
@@ -0,0 +1,43 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Project include(s).
+#include "traccc/seeding/detail/static_seeding_config.hpp"
+
+// GTest include(s).
+#include <gtest/gtest.h>
+
+using namespace traccc;
+
+TEST(static_seeding_config, default_preset) {
+
+    // The default configuration is covered by the default preset.
+    seedfinder_config finder_config;
+    seedfilter_config filter_config;
+    EXPECT_TRUE(
+        seeding_presets::default_config::matches(finder_config, filter_config));
+    EXPECT_FALSE(
+        seeding_presets::dense_config::matches(finder_config, filter_config));
+
+    // The preset gives the same values as the runtime configuration.
+    using preset = seeding_presets::default_config;
+    EXPECT_EQ(preset::neighbor_scope(finder_config),
+              runtime_seeding_config::neighbor_scope(finder_config));
+    EXPECT_EQ(preset::max_triplets_per_spM(filter_config),
+              runtime_seeding_config::max_triplets_per_spM(filter_config));
+    EXPECT_EQ(preset::max_seeds_per_spM(filter_config),
+              runtime_seeding_config::max_seeds_per_spM(filter_config));
+    EXPECT_EQ(preset::compat_seed_limit(filter_config),
+              runtime_seeding_config::compat_seed_limit(filter_config));
+    static_assert(preset::is_static);
+    static_assert(!runtime_seeding_config::is_static);
+
+    // Any difference falls back to the runtime configuration.
+    filter_config.max_triplets_per_spM = 6;
+    EXPECT_FALSE(
+        seeding_presets::default_config::matches(finder_config, filter_config));
+}
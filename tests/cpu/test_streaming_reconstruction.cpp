@@ -0,0 +1,135 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Project include(s).
+#include "traccc/clusterization/clusterization_algorithm.hpp"
+#include "traccc/clusterization/time_window_partitioner.hpp"
+#include "traccc/streaming/streaming_reconstruction.hpp"
+
+// VecMem include(s).
+#include <vecmem/memory/host_memory_resource.hpp>
+
+// GTest include(s).
+#include <gtest/gtest.h>
+
+// System include(s).
+#include <algorithm>
+#include <stdexcept>
+
+using namespace traccc;
+
+namespace {
+
+/// Time window configuration used by the tests
+time_window_config make_config() {
+
+    time_window_config config;
+    config.window_length = 100.f;
+    config.cluster_time_window = 5.f;
+    config.overlap = 20.f;
+    return config;
+}
+
+}  // namespace
+
+TEST(time_window_partitioner, windows) {
+
+    vecmem::host_memory_resource host_mr;
+    time_window_partitioner partitioner{make_config(), host_mr};
+
+    cell_collection_types::host cells{&host_mr};
+    cells.push_back({2u, 1u, 1.f, 150.f, 0u});
+    cells.push_back({1u, 1u, 1.f, 10.f, 0u});
+    cells.push_back({3u, 1u, 1.f, 250.f, 0u});
+    partitioner.push(cells);
+
+    // The first two windows are complete.
+    ASSERT_TRUE(partitioner.ready());
+    EXPECT_FLOAT_EQ(partitioner.window_begin(), 0.f);
+    EXPECT_FLOAT_EQ(partitioner.window_end(), 100.f);
+    cell_collection_types::host window = partitioner.pop();
+    ASSERT_EQ(window.size(), 1u);
+    EXPECT_EQ(window[0].channel0, 1u);
+
+    ASSERT_TRUE(partitioner.ready());
+    EXPECT_EQ(partitioner.window_index(), 1u);
+    window = partitioner.pop();
+    ASSERT_EQ(window.size(), 1u);
+    EXPECT_EQ(window[0].channel0, 2u);
+
+    // The last one only once the end of the stream is signalled.
+    EXPECT_FALSE(partitioner.ready());
+    partitioner.finish();
+    ASSERT_TRUE(partitioner.ready());
+    window = partitioner.pop();
+    ASSERT_EQ(window.size(), 1u);
+    EXPECT_EQ(window[0].channel0, 3u);
+    EXPECT_FALSE(partitioner.ready());
+}
+
+TEST(time_window_partitioner, invalid_config) {
+
+    vecmem::host_memory_resource host_mr;
+    time_window_config config = make_config();
+    config.overlap = config.window_length;
+    EXPECT_THROW(time_window_partitioner(config, host_mr),
+                 std::invalid_argument);
+}
+
+TEST(streaming_reconstruction, window_boundaries) {
+
+    vecmem::host_memory_resource host_mr;
+
+    cell_module_collection_types::host modules{&host_mr};
+    modules.push_back({});
+
+    // One early cluster, one cluster crossing the boundary of the first
+    // window, one cluster close to that boundary, and one late cluster.
+    cell_collection_types::host early{&host_mr}, late{&host_mr};
+    early.push_back({1u, 1u, 1.f, 10.f, 0u});
+    early.push_back({2u, 1u, 1.f, 10.f, 0u});
+    early.push_back({10u, 10u, 1.f, 98.f, 0u});
+    early.push_back({30u, 30u, 1.f, 90.f, 0u});
+    late.push_back({11u, 10u, 1.f, 102.f, 0u});
+    late.push_back({20u, 20u, 1.f, 150.f, 0u});
+
+    seedfinder_config finder_config;
+    streaming_reconstruction reco{make_config(),
+                                  finder_config,
+                                  spacepoint_grid_config{finder_config},
+                                  seedfilter_config{},
+                                  modules,
+                                  host_mr};
+
+    // Nothing is reconstructed before the first window is complete.
+    EXPECT_TRUE(reco.push(early).empty());
+
+    // The cluster crossing the boundary is deferred to the second window.
+    const streaming_reconstruction::output_type first = reco.push(late);
+    ASSERT_EQ(first.size(), 1u);
+    EXPECT_EQ(first[0].index, 0u);
+    EXPECT_EQ(first[0].measurements.size(), 2u);
+    EXPECT_EQ(first[0].n_carried_spacepoints, 0u);
+
+    // The second window finalises the deferred cluster, and seeds with the
+    // spacepoint close to the end of the first window.
+    const streaming_reconstruction::output_type second = reco.finish();
+    ASSERT_EQ(second.size(), 1u);
+    EXPECT_EQ(second[0].index, 1u);
+    EXPECT_EQ(second[0].measurements.size(), 2u);
+    EXPECT_EQ(second[0].n_carried_spacepoints, 1u);
+    EXPECT_EQ(second[0].spacepoints.size(), 3u);
+
+    // Every cluster was finalised exactly once.
+    cell_collection_types::host all{&host_mr};
+    all.insert(all.end(), early.begin(), early.end());
+    all.insert(all.end(), late.begin(), late.end());
+    std::sort(all.begin(), all.end());
+    clusterization_algorithm clusterization{host_mr};
+    EXPECT_EQ(first[0].measurements.size() + second[0].measurements.size(),
+              clusterization(all, modules).size());
+}
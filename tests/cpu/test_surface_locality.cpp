@@ -0,0 +1,56 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Project include(s).
+#include "traccc/geometry/surface_locality.hpp"
+
+// GTest include(s).
+#include <gtest/gtest.h>
+
+// System include(s).
+#include <algorithm>
+#include <vector>
+
+// Test the decoding of the layer of Acts geometry identifiers
+TEST(surface_locality, acts_layer_id) {
+
+    // Volume 8, layer 4, sensitive 17.
+    const std::uint64_t source =
+        (std::uint64_t{8} << 56) | (std::uint64_t{4} << 36) | 17u;
+    EXPECT_EQ(traccc::acts_layer_id(source), 4u);
+    EXPECT_EQ(traccc::acts_layer_id(17u), 0u);
+}
+
+// Test the ordering of the surfaces
+TEST(surface_locality, order) {
+
+    std::vector<traccc::surface_locality_key> keys{{1u, 2u, 0.5f, 0.f, 0u},
+                                                   {0u, 4u, 0.1f, 0.f, 1u},
+                                                   {1u, 2u, -0.5f, 0.f, 2u},
+                                                   {0u, 2u, 0.3f, 1.f, 3u},
+                                                   {0u, 2u, 0.3f, -1.f, 4u}};
+    std::sort(keys.begin(), keys.end());
+
+    std::vector<unsigned int> indices;
+    for (const traccc::surface_locality_key& key : keys) {
+        indices.push_back(key.index);
+    }
+    EXPECT_EQ(indices, (std::vector<unsigned int>{4u, 3u, 1u, 2u, 0u}));
+}
+
+// Test the counting of the touched cache lines
+TEST(surface_locality, count_cache_lines) {
+
+    // Contiguous elements share the cache lines.
+    EXPECT_EQ(traccc::count_cache_lines({0u, 1u, 2u, 3u}, 16u), 1u);
+    EXPECT_EQ(traccc::count_cache_lines({0u, 1u, 2u, 3u, 4u}, 16u), 2u);
+    // Scattered ones do not.
+    EXPECT_EQ(traccc::count_cache_lines({0u, 8u, 16u, 24u}, 16u), 4u);
+    // Elements may straddle cache lines.
+    EXPECT_EQ(traccc::count_cache_lines({1u}, 48u), 2u);
+    EXPECT_EQ(traccc::count_cache_lines({}, 48u), 0u);
+}
@@ -0,0 +1,69 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Project include(s).
+#include "traccc/utils/thread_caching_memory_resource.hpp"
+
+// VecMem include(s).
+#include <vecmem/containers/vector.hpp>
+
+// GTest include(s).
+#include <gtest/gtest.h>
+
+// System include(s).
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+namespace {
+
+/// Fill a vector from the resource, and check its contents
+void fill_and_check(vecmem::memory_resource& mr) {
+
+    for (int i = 0; i < 100; ++i) {
+        vecmem::vector<int> values(&mr);
+        for (int j = 0; j < 1000; ++j) {
+            values.push_back(j);
+        }
+        for (int j = 0; j < 1000; ++j) {
+            ASSERT_EQ(values[j], j);
+        }
+    }
+}
+
+}  // namespace
+
+// Test the alignment of the allocations
+TEST(thread_caching_memory_resource, alignment) {
+
+    traccc::thread_caching_memory_resource mr;
+    for (std::size_t alignment : {8u, 16u, 64u, 256u, 4096u}) {
+        void* ptr = mr.allocate(100u, alignment);
+        ASSERT_NE(ptr, nullptr);
+        EXPECT_EQ(reinterpret_cast<std::uintptr_t>(ptr) % alignment, 0u);
+        mr.deallocate(ptr, 100u, alignment);
+    }
+}
+
+// Test the use of the resource by multiple threads at the same time
+TEST(thread_caching_memory_resource, multi_threaded) {
+
+    traccc::thread_caching_memory_resource mr;
+    std::vector<std::thread> threads;
+    for (int i = 0; i < 4; ++i) {
+        threads.emplace_back([&mr]() { fill_and_check(mr); });
+    }
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+
+    // Memory may be given back through any instance of the resource.
+    traccc::thread_caching_memory_resource other;
+    EXPECT_TRUE(mr.is_equal(other));
+    void* ptr = mr.allocate(64u, 16u);
+    other.deallocate(ptr, 64u, 16u);
+}
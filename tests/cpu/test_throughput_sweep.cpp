@@ -0,0 +1,92 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Project include(s).
+#include "traccc/performance/throughput_sweep.hpp"
+
+// GTest include(s).
+#include <gtest/gtest.h>
+
+// System include(s).
+#include <sstream>
+#include <stdexcept>
+#include <vector>
+
+using namespace traccc::performance;
+
+// Test the p-values of the Welch t-test
+TEST(throughput_sweep, welch_t_test) {
+
+    const std::vector<double> reference = {100., 101., 99., 100.5, 99.5};
+    const std::vector<double> slower = {90., 91., 89., 90.5, 89.5};
+    const std::vector<double> same = {100.2, 100.8, 99.1, 100.1, 99.3};
+
+    EXPECT_LT(welch_t_test(slower, reference), 1e-6);
+    EXPECT_GT(welch_t_test(reference, slower), 1. - 1e-6);
+    EXPECT_GT(welch_t_test(same, reference), 0.1);
+    EXPECT_LT(welch_t_test(same, reference), 0.9);
+    // Identical samples give a t statistic of 0.
+    EXPECT_NEAR(welch_t_test(reference, reference), 0.5, 1e-6);
+    // Known value: t = -2.5 with 8 degrees of freedom.
+    EXPECT_NEAR(welch_t_test({1., 2., 3., 4., 5.}, {3.5, 4.5, 5.5, 6.5, 7.5}),
+                0.01842, 1e-4);
+}
+
+// Test writing and reading back the sweep results
+TEST(throughput_sweep, json_round_trip) {
+
+    sweep_results results;
+    results.input = "tml_full/ttbar_mu200/";
+    results.processed_events = 100;
+    results.points.push_back({{4, 0, 1024}, {10., 12., 11.}});
+    results.points.push_back({{8, 2, 2048, 100}, {20.5, 19.5}});
+
+    std::stringstream json;
+    write_json(json, results);
+    const sweep_results read = read_sweep_results(json);
+
+    EXPECT_EQ(read.input, results.input);
+    EXPECT_EQ(read.processed_events, results.processed_events);
+    ASSERT_EQ(read.points.size(), 2u);
+    EXPECT_EQ(read.points[0].config, results.points[0].config);
+    EXPECT_EQ(read.points[1].config, results.points[1].config);
+    EXPECT_EQ(read.points[1].events_per_second,
+              results.points[1].events_per_second);
+    EXPECT_DOUBLE_EQ(read.points[0].mean(), 11.);
+    EXPECT_DOUBLE_EQ(read.points[0].stddev(), 1.);
+
+    std::stringstream invalid{"{\"input\": 1}"};
+    EXPECT_THROW(read_sweep_results(invalid), std::runtime_error);
+}
+
+// Test flagging regressions against a baseline
+TEST(throughput_sweep, regressions) {
+
+    sweep_results baseline;
+    baseline.points.push_back({{1, 0, 1024}, {100., 101., 99.}});
+    baseline.points.push_back({{2, 0, 1024}, {200., 202., 198.}});
+    baseline.points.push_back({{4, 0, 1024}, {400., 404., 396.}});
+
+    sweep_results current;
+    // Significantly, but only slightly slower.
+    current.points.push_back({{1, 0, 1024}, {98., 98.5, 97.5}});
+    // Significantly, and a lot slower.
+    current.points.push_back({{2, 0, 1024}, {150., 152., 148.}});
+    // Faster.
+    current.points.push_back({{4, 0, 1024}, {450., 452., 448.}});
+    // Not in the baseline.
+    current.points.push_back({{8, 0, 1024}, {1., 1.1, 0.9}});
+
+    const std::vector<sweep_comparison> comps =
+        compare(baseline, current, 0.05, 0.05);
+    ASSERT_EQ(comps.size(), 3u);
+    EXPECT_FALSE(comps[0].regression);
+    EXPECT_LT(comps[0].p_value, 0.05);
+    EXPECT_TRUE(comps[1].regression);
+    EXPECT_NEAR(comps[1].relative_change(), -0.25, 1e-6);
+    EXPECT_FALSE(comps[2].regression);
+}
@@ -0,0 +1,95 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Project include(s).
+#include "traccc/performance/scoped_timer.hpp"
+#include "traccc/performance/timing_registry.hpp"
+
+// GTest include(s).
+#include <gtest/gtest.h>
+
+// System include(s).
+#include <chrono>
+#include <sstream>
+#include <thread>
+#include <vector>
+
+using namespace traccc::performance;
+
+// Test the quantiles of the latency histogram
+TEST(timing_registry, latency_quantiles) {
+
+    latency_histogram hist;
+    for (int i = 1; i <= 100000; ++i) {
+        hist.add(std::chrono::nanoseconds{i});
+    }
+
+    EXPECT_EQ(hist.count(), 100000u);
+    EXPECT_EQ(hist.min().count(), 1);
+    EXPECT_EQ(hist.max().count(), 100000);
+    EXPECT_EQ(hist.quantile(1.).count(), 100000);
+    EXPECT_NEAR(static_cast<double>(hist.quantile(0.5).count()), 50000.,
+                0.03 * 50000.);
+    EXPECT_NEAR(static_cast<double>(hist.quantile(0.9).count()), 90000.,
+                0.03 * 90000.);
+    EXPECT_NEAR(static_cast<double>(hist.quantile(0.99).count()), 99000.,
+                0.03 * 99000.);
+
+    // Merging a histogram into itself should not change its quantiles
+    latency_histogram merged = hist;
+    merged.merge(hist);
+    EXPECT_EQ(merged.count(), 2 * hist.count());
+    EXPECT_EQ(merged.quantile(0.5), hist.quantile(0.5));
+    EXPECT_EQ(merged.quantile(0.99), hist.quantile(0.99));
+}
+
+// Test the nesting of scopes timed on multiple threads
+TEST(timing_registry, nested_scopes) {
+
+    timing_registry registry;
+    static constexpr unsigned int n_threads = 4u;
+    static constexpr unsigned int n_events = 100u;
+    {
+        scoped_timer outer{"Processing", registry};
+        std::vector<std::thread> threads;
+        for (unsigned int i = 0; i < n_threads; ++i) {
+            threads.emplace_back([&registry]() {
+                for (unsigned int j = 0; j < n_events; ++j) {
+                    scoped_timer event{"Processing/Event", registry};
+                    { scoped_timer stage{"Stage 1", registry}; }
+                    { scoped_timer stage{"Stage 2", registry}; }
+                }
+            });
+        }
+        for (std::thread& thread : threads) {
+            thread.join();
+        }
+    }
+
+    const std::vector<timing_statistics> stats = registry.statistics();
+    ASSERT_EQ(stats.size(), 4u);
+    EXPECT_EQ(stats[0].name, "Processing");
+    EXPECT_EQ(stats[0].depth, 0u);
+    EXPECT_EQ(stats[0].latencies.count(), 1u);
+    EXPECT_EQ(stats[1].name, "Processing/Event");
+    EXPECT_EQ(stats[1].depth, 1u);
+    EXPECT_EQ(stats[1].latencies.count(), n_threads * n_events);
+    EXPECT_EQ(stats[2].name, "Processing/Event/Stage 1");
+    EXPECT_EQ(stats[2].depth, 2u);
+    EXPECT_EQ(stats[2].latencies.count(), n_threads * n_events);
+    EXPECT_EQ(stats[3].name, "Processing/Event/Stage 2");
+    EXPECT_EQ(stats[3].depth, 2u);
+    EXPECT_EQ(stats[3].latencies.count(), n_threads * n_events);
+    EXPECT_LE(stats[1].latencies.total(),
+              n_threads * stats[0].latencies.total());
+
+    // Make sure that the JSON output has an entry for every scope
+    std::ostringstream json;
+    registry.write_json(json);
+    EXPECT_NE(json.str().find("\"name\": \"Processing/Event/Stage 2\""),
+              std::string::npos);
+}
@@ -10,6 +10,7 @@
 #include "traccc/edm/spacepoint.hpp"
 #include "traccc/seeding/seeding_algorithm.hpp"
 #include "traccc/seeding/track_params_estimation.hpp"
+#include "traccc/seeding/track_params_estimation_helper.hpp"
 
 // Detray include(s).
 #include "detray/navigation/detail/helix.hpp"
@@ -20,6 +21,9 @@
 // GTest include(s).
 #include <gtest/gtest.h>
 
+// System include(s).
+#include <random>
+
 using namespace traccc;
 
 TEST(track_params_estimation, helix) {
@@ -59,3 +63,46 @@ TEST(track_params_estimation, helix) {
     ASSERT_EQ(bound_params.size(), 1u);
     ASSERT_NEAR(bound_params[0].p(), getter::norm(mom), 1e-4);
 }
+
+TEST(track_params_estimation, batched) {
+
+    // Set B field
+    const vector3 B{0. * unit<scalar>::T, 0. * unit<scalar>::T,
+                    2. * unit<scalar>::T};
+
+    // Make random seeds with increasing radii
+    std::mt19937 gen(42u);
+    std::uniform_real_distribution<scalar> dist(-1.f, 1.f);
+    spacepoint_collection_types::host spacepoints;
+    seed_collection_types::host seeds;
+    for (unsigned int i = 0; i < 100u; ++i) {
+        const unsigned int first = spacepoints.size();
+        for (unsigned int j = 0; j < 3u; ++j) {
+            const scalar r = 50.f * static_cast<scalar>(j + 1);
+            spacepoints.push_back({{r + dist(gen), r * 0.1f * dist(gen),
+                                    r * dist(gen) + dist(gen)},
+                                   {}});
+        }
+        seeds.push_back({first, first + 1, first + 2, 0.f, 0.f});
+    }
+
+    // Estimate the parameters in one batch
+    seed_batch<128> batch;
+    gather_seed_batch(spacepoints, seeds.data(), seeds.size(), batch);
+    std::array<scalar, 128> phi, theta, qoverp, time;
+    seed_batch_to_bound_parameters(batch, seeds.size(), B, PION_MASS_MEV,
+                                   phi.data(), theta.data(), qoverp.data(),
+                                   time.data());
+
+    // Compare them to the parameters estimated one seed at a time
+    for (std::size_t i = 0; i < seeds.size(); ++i) {
+        const bound_vector ref =
+            seed_to_bound_vector(spacepoints, seeds[i], B, PION_MASS_MEV);
+        EXPECT_NEAR(phi[i], getter::element(ref, e_bound_phi, 0), 1e-4);
+        EXPECT_NEAR(theta[i], getter::element(ref, e_bound_theta, 0), 1e-4);
+        EXPECT_NEAR(qoverp[i], getter::element(ref, e_bound_qoverp, 0),
+                    1e-4 * std::abs(getter::element(ref, e_bound_qoverp, 0)));
+        EXPECT_NEAR(time[i], getter::element(ref, e_bound_time, 0),
+                    1e-4 * std::abs(getter::element(ref, e_bound_time, 0)));
+    }
+}
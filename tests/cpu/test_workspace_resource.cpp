@@ -0,0 +1,108 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Project include(s).
+#include "traccc/utils/memory_resource.hpp"
+#include "traccc/utils/workspace_resource.hpp"
+
+// VecMem include(s).
+#include <vecmem/containers/data/vector_buffer.hpp>
+#include <vecmem/memory/host_memory_resource.hpp>
+
+// GTest include(s).
+#include <gtest/gtest.h>
+
+// System include(s).
+#include <cstdint>
+
+// Test that the workspace serves aligned slices of its block
+TEST(workspace_resource, slices) {
+
+    vecmem::host_memory_resource upstream;
+    traccc::workspace_resource workspace(upstream, 4096);
+    EXPECT_EQ(workspace.capacity(), 4096u);
+
+    void* a = workspace.allocate(100, 8);
+    void* b = workspace.allocate(10, 4);
+    EXPECT_NE(a, b);
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(b) % 256, 0u);
+    EXPECT_EQ(workspace.used(), 512u);
+
+    workspace.deallocate(a, 100, 8);
+    workspace.deallocate(b, 10, 4);
+    workspace.reset();
+    EXPECT_EQ(workspace.used(), 0u);
+    EXPECT_EQ(workspace.capacity(), 4096u);
+
+    // After a reset, the same memory is handed out again.
+    void* c = workspace.allocate(100, 8);
+    EXPECT_EQ(a, c);
+    workspace.deallocate(c, 100, 8);
+}
+
+// Test that the workspace grows after running out of memory
+TEST(workspace_resource, growth) {
+
+    vecmem::host_memory_resource upstream;
+    traccc::workspace_resource workspace(upstream);
+    EXPECT_EQ(workspace.capacity(), 0u);
+
+    // Without a block, everything comes from the upstream resource.
+    {
+        vecmem::data::vector_buffer<int> buffer1(1000, workspace);
+        vecmem::data::vector_buffer<int> buffer2(3000, workspace);
+        buffer1.ptr()[999] = 1;
+        buffer2.ptr()[2999] = 2;
+    }
+    const std::size_t used = workspace.used();
+    EXPECT_GE(used, 4000 * sizeof(int));
+
+    // The reset grows the block, so that the same buffers fit into it.
+    workspace.reset();
+    EXPECT_GE(workspace.capacity(), used);
+    {
+        vecmem::data::vector_buffer<int> buffer1(1000, workspace);
+        vecmem::data::vector_buffer<int> buffer2(3000, workspace);
+        EXPECT_EQ(workspace.used(), used);
+    }
+    const std::size_t capacity = workspace.capacity();
+    workspace.reset();
+    EXPECT_EQ(workspace.capacity(), capacity);
+}
+
+// Test using the workspace as the event arena of the algorithms
+TEST(workspace_resource, event_arena) {
+
+    vecmem::host_memory_resource upstream;
+    traccc::workspace_resource arena(upstream);
+
+    // Without an arena, the per-event buffers come from the main resource.
+    traccc::memory_resource mr{upstream};
+    EXPECT_EQ(&(mr.event_memory()), &upstream);
+    mr.event_arena = &arena;
+    EXPECT_EQ(&(mr.event_memory()), &arena);
+
+    // Simulate a few events, the first one growing the arena to fit all the
+    // buffers of an event, and the later ones not allocating anything from
+    // the upstream resource.
+    std::size_t used = 0, capacity = 0;
+    for (int event = 0; event < 3; ++event) {
+        arena.reset();
+        if (event > 1) {
+            EXPECT_EQ(arena.capacity(), capacity);
+        }
+        capacity = arena.capacity();
+        vecmem::data::vector_buffer<int> a(1000, mr.event_memory());
+        vecmem::data::vector_buffer<float> b(5000, mr.event_memory());
+        EXPECT_GE(arena.used(), 6000 * sizeof(int));
+        if (event > 0) {
+            EXPECT_EQ(arena.used(), used);
+            EXPECT_GE(arena.capacity(), used);
+        }
+        used = arena.used();
+    }
+}
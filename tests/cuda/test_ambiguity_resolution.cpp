@@ -0,0 +1,156 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Project include(s).
+#include "traccc/cuda/ambiguity_resolution/greedy_ambiguity_resolution_algorithm.hpp"
+#include "traccc/cuda/utils/stream.hpp"
+#include "traccc/device/container_h2d_copy_alg.hpp"
+#include "traccc/edm/measurement.hpp"
+#include "traccc/edm/track_state.hpp"
+#include "traccc/utils/memory_resource.hpp"
+
+// VecMem include(s).
+#include <vecmem/containers/vector.hpp>
+#include <vecmem/memory/cuda/device_memory_resource.hpp>
+#include <vecmem/memory/host_memory_resource.hpp>
+#include <vecmem/utils/cuda/async_copy.hpp>
+
+// GTest include(s).
+#include <gtest/gtest.h>
+
+// System include(s).
+#include <algorithm>
+#include <map>
+#include <numeric>
+#include <random>
+#include <vector>
+
+using namespace traccc;
+
+namespace {
+
+/// Add a track with the given measurements to a container
+void add_track(track_state_container_types::host& tracks,
+               const std::vector<std::size_t>& measurement_ids, scalar chi2,
+               vecmem::memory_resource& mr) {
+
+    fitting_result<transform3> header;
+    header.chi2 = chi2;
+    vecmem::vector<track_state<transform3>> states(&mr);
+    for (std::size_t id : measurement_ids) {
+        measurement meas;
+        meas.measurement_id = id;
+        states.emplace_back(meas);
+    }
+    tracks.push_back(header, std::move(states));
+}
+
+/// Run the device ambiguity resolution on host tracks
+vecmem::vector<unsigned int> resolve(
+    const track_state_container_types::host& tracks,
+    const cuda::greedy_ambiguity_resolution_algorithm::config_t& cfg,
+    vecmem::memory_resource& host_mr) {
+
+    vecmem::cuda::device_memory_resource device_mr;
+    traccc::memory_resource mr{device_mr, &host_mr};
+    cuda::stream stream;
+    vecmem::cuda::async_copy copy{stream.cudaStream()};
+
+    device::container_h2d_copy_alg<track_state_container_types> h2d{mr, copy};
+    const track_state_container_types::buffer tracks_buffer =
+        h2d(get_data(tracks));
+
+    cuda::greedy_ambiguity_resolution_algorithm resolution(cfg, mr, copy,
+                                                           stream);
+    auto selected_buffer = resolution(tracks_buffer);
+
+    vecmem::vector<unsigned int> selected(&host_mr);
+    copy(selected_buffer, selected)->wait();
+    return selected;
+}
+
+}  // namespace
+
+// Resolve a small, known case
+TEST(CUDAAmbiguityResolution, Simple) {
+
+    vecmem::host_memory_resource host_mr;
+    track_state_container_types::host tracks(&host_mr);
+    add_track(tracks, {1u, 2u, 3u}, 1.f, host_mr);
+    add_track(tracks, {3u, 4u, 5u}, 2.f, host_mr);
+    add_track(tracks, {6u, 7u, 8u}, 0.f, host_mr);
+    add_track(tracks, {9u, 10u}, 0.f, host_mr);
+
+    const vecmem::vector<unsigned int> selected =
+        resolve(tracks, {}, host_mr);
+
+    // The second track has the larger chi-square of the two overlapping
+    // ones, and the last one is too short.
+    ASSERT_EQ(selected.size(), 4u);
+    EXPECT_EQ(selected[0], 1u);
+    EXPECT_EQ(selected[1], 0u);
+    EXPECT_EQ(selected[2], 1u);
+    EXPECT_EQ(selected[3], 0u);
+}
+
+// Check the final state for random tracks
+TEST(CUDAAmbiguityResolution, Random) {
+
+    vecmem::host_memory_resource host_mr;
+
+    std::mt19937 gen(4321u);
+    std::uniform_int_distribution<std::size_t> length(3u, 10u);
+    std::uniform_real_distribution<scalar> chi2(0.f, 10.f);
+    std::vector<std::size_t> ids(500u);
+    std::iota(ids.begin(), ids.end(), 0u);
+
+    track_state_container_types::host tracks(&host_mr);
+    for (std::size_t i = 0; i < 1000u; ++i) {
+        std::shuffle(ids.begin(), ids.end(), gen);
+        add_track(tracks,
+                  std::vector<std::size_t>(ids.begin(),
+                                           ids.begin() + length(gen)),
+                  chi2(gen), host_mr);
+    }
+
+    for (std::uint32_t max_shared : {1u, 2u}) {
+
+        cuda::greedy_ambiguity_resolution_algorithm::config_t cfg;
+        cfg.maximum_shared_hits = max_shared;
+        const vecmem::vector<unsigned int> selected =
+            resolve(tracks, cfg, host_mr);
+        ASSERT_EQ(selected.size(), tracks.size());
+
+        // Count the selected tracks of every measurement
+        std::map<std::size_t, unsigned int> n_tracks;
+        for (std::size_t i = 0; i < tracks.size(); ++i) {
+            if (selected[i] == 0u) {
+                continue;
+            }
+            for (const auto& st : tracks.at(i).items) {
+                ++n_tracks[st.get_measurement().measurement_id];
+            }
+        }
+
+        // No selected track may have too many shared measurements
+        std::size_t n_selected = 0u;
+        for (std::size_t i = 0; i < tracks.size(); ++i) {
+            if (selected[i] == 0u) {
+                continue;
+            }
+            ++n_selected;
+            unsigned int n_shared = 0u;
+            for (const auto& st : tracks.at(i).items) {
+                if (n_tracks[st.get_measurement().measurement_id] > 1u) {
+                    ++n_shared;
+                }
+            }
+            EXPECT_LT(n_shared, max_shared);
+        }
+        EXPECT_GT(n_selected, 0u);
+    }
+}
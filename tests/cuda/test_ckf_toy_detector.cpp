@@ -9,6 +9,7 @@
 #include "traccc/cuda/finding/finding_algorithm.hpp"
 #include "traccc/device/container_d2h_copy_alg.hpp"
 #include "traccc/device/container_h2d_copy_alg.hpp"
+#include "traccc/edm/track_candidate_soa.hpp"
 #include "traccc/finding/finding_algorithm.hpp"
 #include "traccc/io/event_map2.hpp"
 #include "traccc/io/read_measurements.hpp"
@@ -154,6 +155,47 @@ TEST_P(CkfToyDetectorTests, Run) {
     traccc::cuda::finding_algorithm<rk_stepper_type, device_navigator_type>
         device_finding(cfg, mr, copy, stream);
 
+    // Finding algorithm object running its step loop on the device
+    auto device_loop_cfg = cfg;
+    device_loop_cfg.run_step_loop_on_device = true;
+    traccc::cuda::finding_algorithm<rk_stepper_type, device_navigator_type>
+        device_loop_finding(device_loop_cfg, mr, copy, stream);
+
+    // Finding algorithm object sorting the parameters of every step by
+    // surface
+    auto sorting_cfg = cfg;
+    sorting_cfg.min_params_for_surface_sort = 1u;
+    traccc::cuda::finding_algorithm<rk_stepper_type, device_navigator_type>
+        sorting_finding(sorting_cfg, mr, copy, stream);
+
+    // Finding algorithm object processing every parameter with a whole warp
+    auto warp_cfg = cfg;
+    warp_cfg.min_measurements_for_warp_finding = 1u;
+    traccc::cuda::finding_algorithm<rk_stepper_type, device_navigator_type>
+        warp_finding(warp_cfg, mr, copy, stream);
+
+    // Finding algorithm object processing the seeds in chunks (of a few
+    // thousand seeds with the default branching limits)
+    auto chunked_cfg = cfg;
+    chunked_cfg.device_memory_budget = 1024u * 1024u * 1024u;
+    traccc::cuda::finding_algorithm<rk_stepper_type, device_navigator_type>
+        chunked_finding(chunked_cfg, mr, copy, stream);
+
+    // Finding algorithm object pruning the branches of every seed that reach
+    // the same measurements
+    auto pruning_cfg = cfg;
+    pruning_cfg.prune_shared_hits = true;
+    pruning_cfg.pruning_seed_group_size = 1u;
+    traccc::cuda::finding_algorithm<rk_stepper_type, device_navigator_type>
+        pruning_finding(pruning_cfg, mr, copy, stream);
+
+    // Finding algorithm object with tight seed and branch budgets
+    auto budget_cfg = cfg;
+    budget_cfg.max_num_seeds = (n_truth_tracks + 1u) / 2u;
+    budget_cfg.max_num_branches_in_flight = 1u;
+    traccc::cuda::finding_algorithm<rk_stepper_type, device_navigator_type>
+        budget_finding(budget_cfg, mr, copy, stream);
+
     // Iterate over events
     for (std::size_t i_evt = 0; i_evt < n_events; i_evt++) {
 
@@ -236,6 +278,174 @@ TEST_P(CkfToyDetectorTests, Run) {
         float matching_rate = float(n_matches) / track_candidates.size();
 
         EXPECT_FLOAT_EQ(matching_rate, 1.f);
+
+        // Run device finding without per-step host synchronisation
+        traccc::track_candidate_container_types::host
+            track_candidates_device_loop =
+                track_candidate_d2h(device_loop_finding(
+                    det_view, field, navigation_buffer, measurements_buffer,
+                    seeds_buffer));
+
+        // Make sure that the outputs of the two device step loops are the same
+        ASSERT_EQ(track_candidates_device_loop.size(),
+                  track_candidates_cuda.size());
+        unsigned int n_device_loop_matches = 0u;
+        for (unsigned int i = 0u; i < track_candidates_cuda.size(); i++) {
+            auto iso = traccc::details::is_same_object(
+                track_candidates_cuda.at(i).items);
+
+            for (unsigned int j = 0u; j < track_candidates_device_loop.size();
+                 j++) {
+                if (iso(track_candidates_device_loop.at(j).items)) {
+                    n_device_loop_matches++;
+                    break;
+                }
+            }
+        }
+        EXPECT_EQ(n_device_loop_matches, track_candidates_cuda.size());
+
+        // Make sure that sorting the parameters does not change the output
+        traccc::track_candidate_container_types::host
+            track_candidates_sorted = track_candidate_d2h(
+                sorting_finding(det_view, field, navigation_buffer,
+                                measurements_buffer, seeds_buffer));
+        ASSERT_EQ(track_candidates_sorted.size(), track_candidates_cuda.size());
+        unsigned int n_sorted_matches = 0u;
+        for (unsigned int i = 0u; i < track_candidates_cuda.size(); i++) {
+            auto iso = traccc::details::is_same_object(
+                track_candidates_cuda.at(i).items);
+
+            for (unsigned int j = 0u; j < track_candidates_sorted.size(); j++) {
+                if (iso(track_candidates_sorted.at(j).items)) {
+                    n_sorted_matches++;
+                    break;
+                }
+            }
+        }
+        EXPECT_EQ(n_sorted_matches, track_candidates_cuda.size());
+
+        // Make sure that the per-warp measurement search does not change the
+        // output
+        traccc::track_candidate_container_types::host track_candidates_warp =
+            track_candidate_d2h(
+                warp_finding(det_view, field, navigation_buffer,
+                             measurements_buffer, seeds_buffer));
+        ASSERT_EQ(track_candidates_warp.size(), track_candidates_cuda.size());
+        unsigned int n_warp_matches = 0u;
+        for (unsigned int i = 0u; i < track_candidates_cuda.size(); i++) {
+            auto iso = traccc::details::is_same_object(
+                track_candidates_cuda.at(i).items);
+
+            for (unsigned int j = 0u; j < track_candidates_warp.size(); j++) {
+                if (iso(track_candidates_warp.at(j).items)) {
+                    n_warp_matches++;
+                    break;
+                }
+            }
+        }
+        EXPECT_EQ(n_warp_matches, track_candidates_cuda.size());
+
+        // Make sure that processing the seeds in chunks does not change the
+        // output
+        traccc::track_candidate_container_types::host
+            track_candidates_chunked = track_candidate_d2h(
+                chunked_finding(det_view, field, navigation_buffer,
+                                measurements_buffer, seeds_buffer));
+        ASSERT_EQ(track_candidates_chunked.size(),
+                  track_candidates_cuda.size());
+        unsigned int n_chunked_matches = 0u;
+        for (unsigned int i = 0u; i < track_candidates_cuda.size(); i++) {
+            auto iso = traccc::details::is_same_object(
+                track_candidates_cuda.at(i).items);
+
+            for (unsigned int j = 0u; j < track_candidates_chunked.size();
+                 j++) {
+                if (iso(track_candidates_chunked.at(j).items)) {
+                    n_chunked_matches++;
+                    break;
+                }
+            }
+        }
+        EXPECT_EQ(n_chunked_matches, track_candidates_cuda.size());
+
+        // Make sure that pruning the shared hits only ever removes branches,
+        // and keeps at least one track per (truth) seed
+        traccc::track_candidate_container_types::host
+            track_candidates_pruned = track_candidate_d2h(
+                pruning_finding(det_view, field, navigation_buffer,
+                                measurements_buffer, seeds_buffer));
+        EXPECT_LE(track_candidates_pruned.size(),
+                  track_candidates_cuda.size());
+        EXPECT_GE(track_candidates_pruned.size(), n_truth_tracks);
+
+        // Make sure that exceeding the budgets is flagged, and only ever
+        // removes track candidates
+        traccc::track_candidate_container_types::host
+            track_candidates_budget = track_candidate_d2h(
+                budget_finding(det_view, field, navigation_buffer,
+                               measurements_buffer, seeds_buffer));
+        if (n_truth_tracks > 1u) {
+            EXPECT_TRUE(budget_finding.get_budget_status().seeds_truncated);
+            EXPECT_TRUE(budget_finding.get_budget_status().branches_limited);
+        }
+        EXPECT_FALSE(budget_finding.get_budget_status().deadline_exceeded);
+        EXPECT_LE(track_candidates_budget.size(),
+                  track_candidates_cuda.size());
+        EXPECT_FALSE(device_finding.get_budget_status().degraded());
+
+        // Make sure that the flat output layout holds the same candidates
+        traccc::track_candidate_soa_collection_types::buffer
+            track_candidates_flat_buffer = device_finding.find_flat(
+                det_view, field, navigation_buffer, measurements_buffer,
+                seeds_buffer);
+        traccc::track_candidate_soa_collection_types::host
+            track_candidates_flat_soa{&host_mr};
+        traccc::copy(copy, traccc::get_data(track_candidates_flat_buffer),
+                     track_candidates_flat_soa);
+        const traccc::track_candidate_container_types::host
+            track_candidates_flat = traccc::to_container(
+                track_candidates_flat_soa, measurements_per_event, host_mr);
+        ASSERT_EQ(track_candidates_flat.size(), track_candidates_cuda.size());
+        unsigned int n_flat_matches = 0u;
+        for (unsigned int i = 0u; i < track_candidates_cuda.size(); i++) {
+            auto iso = traccc::details::is_same_object(
+                track_candidates_cuda.at(i).items);
+
+            for (unsigned int j = 0u; j < track_candidates_flat.size(); j++) {
+                if (iso(track_candidates_flat.at(j).items)) {
+                    n_flat_matches++;
+                    break;
+                }
+            }
+        }
+        EXPECT_EQ(n_flat_matches, track_candidates_cuda.size());
+
+        // Make sure that a navigation buffer with fewer candidate vectors than
+        // tracks does not change the output either
+        auto small_navigation_buffer =
+            detray::create_candidates_buffer(host_det, 128u, mr.main, mr.host);
+        for (const auto& finding : {&device_finding, &device_loop_finding}) {
+            traccc::track_candidate_container_types::host
+                track_candidates_small = track_candidate_d2h((*finding)(
+                    det_view, field, small_navigation_buffer,
+                    measurements_buffer, seeds_buffer));
+            ASSERT_EQ(track_candidates_small.size(),
+                      track_candidates_cuda.size());
+            unsigned int n_small_matches = 0u;
+            for (unsigned int i = 0u; i < track_candidates_cuda.size(); i++) {
+                auto iso = traccc::details::is_same_object(
+                    track_candidates_cuda.at(i).items);
+
+                for (unsigned int j = 0u; j < track_candidates_small.size();
+                     j++) {
+                    if (iso(track_candidates_small.at(j).items)) {
+                        n_small_matches++;
+                        break;
+                    }
+                }
+            }
+            EXPECT_EQ(n_small_matches, track_candidates_cuda.size());
+        }
     }
 }
 
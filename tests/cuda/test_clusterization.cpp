@@ -1,21 +1,33 @@
 /** TRACCC library, part of the ACTS project (R&D line)
  *
- * (c) 2023 CERN for the benefit of the ACTS project
+ * (c) 2023-2024 CERN for the benefit of the ACTS project
  *
  * Mozilla Public License Version 2.0
  */
 
 // Project include(s).
+#include "traccc/clusterization/event_batch.hpp"
+#include "traccc/cuda/clusterization/clusterization_algorithm.hpp"
 #include "traccc/cuda/clusterization/experimental/clusterization_algorithm.hpp"
+#include "traccc/cuda/clusterization/persistent_clusterization.hpp"
+#include "traccc/cuda/clusterization/raw_cell_sorting_algorithm.hpp"
 #include "traccc/definitions/common.hpp"
 
 // VecMem include(s).
+#include <vecmem/memory/cuda/device_memory_resource.hpp>
 #include <vecmem/memory/cuda/managed_memory_resource.hpp>
+#include <vecmem/memory/host_memory_resource.hpp>
 #include <vecmem/utils/cuda/async_copy.hpp>
+#include <vecmem/utils/cuda/copy.hpp>
 
 // GTest include(s).
 #include <gtest/gtest.h>
 
+// System include(s).
+#include <algorithm>
+#include <map>
+#include <vector>
+
 using namespace traccc;
 
 TEST(clusterization, cuda) {
@@ -68,4 +80,370 @@ TEST(clusterization, cuda) {
         {{6.f, 5.f}, {0.483333, 0.483333}, detray::geometry::barcode{0u}});
 
     EXPECT_EQ(test, ref);
-}
\ No newline at end of file
+}
+TEST(clusterization, cuda_dense_module) {
+
+    // Memory resource used by the EDM.
+    vecmem::cuda::managed_memory_resource mng_mr;
+    traccc::memory_resource mr{mng_mr};
+
+    // Cuda stream
+    traccc::cuda::stream stream;
+
+    // Cuda copy objects
+    vecmem::cuda::async_copy copy{stream.cudaStream()};
+
+    // Create a fully occupied 64x64 module, which does not fit into a
+    // single (shared memory) partition, followed by a module with a single
+    // cell.
+    static constexpr unsigned int n_channels = 64;
+    traccc::cell_collection_types::host cells{&mng_mr};
+    for (unsigned int c1 = 0; c1 < n_channels; ++c1) {
+        for (unsigned int c0 = 0; c0 < n_channels; ++c0) {
+            cells.push_back({c0, c1, 1.f, 0, 0});
+        }
+    }
+    cells.push_back({1u, 1u, 1.f, 0, 1});
+
+    // Create module collection
+    traccc::cell_module_collection_types::host modules{&mng_mr};
+    modules.push_back({});
+    modules.push_back({});
+
+    // Run Clusterization, with partitions much smaller than the dense module
+    traccc::cuda::experimental::clusterization_algorithm ca_cuda(mr, copy,
+                                                                 stream, 128);
+
+    auto measurements_buffer =
+        ca_cuda(vecmem::get_data(cells), vecmem::get_data(modules));
+
+    measurement_collection_types::device measurements(measurements_buffer);
+
+    // Check the results
+    ASSERT_EQ(copy.get_size(measurements_buffer), 2u);
+    for (unsigned int i = 0; i < 2u; ++i) {
+        const measurement& m = measurements[i];
+        if (m.module_link == 0u) {
+            EXPECT_NEAR(m.local[0], 31.5f, 1e-3f);
+            EXPECT_NEAR(m.local[1], 31.5f, 1e-3f);
+            // (64^2 - 1) / 12 for the uniform distribution, plus 1 / 12
+            EXPECT_NEAR(m.variance[0], 341.3333f, 1e-2f);
+            EXPECT_NEAR(m.variance[1], 341.3333f, 1e-2f);
+        } else {
+            EXPECT_EQ(m.module_link, 1u);
+            EXPECT_NEAR(m.local[0], 1.f, 1e-5f);
+            EXPECT_NEAR(m.local[1], 1.f, 1e-5f);
+        }
+    }
+    EXPECT_NE(measurements[0].module_link, measurements[1].module_link);
+}
+
+TEST(clusterization, cuda_warp_ccl) {
+
+    // Memory resource used by the EDM.
+    vecmem::cuda::managed_memory_resource mng_mr;
+    traccc::memory_resource mr{mng_mr};
+
+    // Cuda stream
+    traccc::cuda::stream stream;
+
+    // Cuda copy objects
+    vecmem::cuda::async_copy copy{stream.cudaStream()};
+
+    // Create a sparse event, with two clusters on each of many modules.
+    static constexpr unsigned int n_modules = 200;
+    traccc::cell_collection_types::host cells{&mng_mr};
+    traccc::cell_module_collection_types::host modules{&mng_mr};
+    for (unsigned int m = 0; m < n_modules; ++m) {
+        cells.push_back({10 * m, 0u, 1.f, 0, m});
+        cells.push_back({10 * m + 1, 0u, 2.f, 0, m});
+        cells.push_back({10 * m, 1u, 3.f, 0, m});
+        cells.push_back({10 * m + 5, 5u, 1.f, 0, m});
+        modules.push_back({});
+    }
+
+    // Run the clusterization with warp-level and with block-level CCL.
+    auto run = [&](float warp_ccl_max_cells_per_module) {
+        traccc::cuda::clusterization_algorithm ca_cuda(
+            mr, copy, stream, 1024, warp_ccl_max_cells_per_module);
+        auto result =
+            ca_cuda(vecmem::get_data(cells), vecmem::get_data(modules));
+        stream.synchronize();
+        spacepoint_collection_types::const_device spacepoints(result.first);
+        std::vector<spacepoint> sorted(spacepoints.begin(), spacepoints.end());
+        std::sort(sorted.begin(), sorted.end());
+        return sorted;
+    };
+    const std::vector<spacepoint> warp_result = run(1e6f);
+    const std::vector<spacepoint> block_result = run(0.f);
+
+    // The two must agree.
+    ASSERT_EQ(warp_result.size(), 2 * n_modules);
+    ASSERT_EQ(block_result.size(), warp_result.size());
+    for (std::size_t i = 0; i < warp_result.size(); ++i) {
+        EXPECT_EQ(warp_result[i], block_result[i]);
+    }
+}
+
+TEST(clusterization, cuda_compact_measurements) {
+
+    // Memory resource used by the EDM.
+    vecmem::cuda::managed_memory_resource mng_mr;
+    traccc::memory_resource mr{mng_mr};
+
+    // Cuda stream
+    traccc::cuda::stream stream;
+
+    // Cuda copy objects
+    vecmem::cuda::async_copy copy{stream.cudaStream()};
+
+    // Create a few modules with two clusters each.
+    static constexpr unsigned int n_modules = 20;
+    traccc::cell_collection_types::host cells{&mng_mr};
+    traccc::cell_module_collection_types::host modules{&mng_mr};
+    for (unsigned int m = 0; m < n_modules; ++m) {
+        cells.push_back({1u, 0u, 1.f, 0, m});
+        cells.push_back({2u, 0u, 1.f, 0, m});
+        cells.push_back({1u, 1u, 1.f, 0, m});
+        cells.push_back({6u, 6u, 1.f, 0, m});
+        modules.push_back({});
+    }
+
+    // The measurement buffer returned by the algorithm must have the size of
+    // the actual measurements, with and without compaction.
+    for (bool compact : {true, false}) {
+        traccc::cuda::clusterization_algorithm ca_cuda(mr, copy, stream, 1024,
+                                                       32.f, compact);
+        auto [measurements, spacepoints, cell_links] =
+            ca_cuda.run_with_measurements(vecmem::get_data(cells),
+                                          vecmem::get_data(modules));
+        stream.synchronize();
+
+        EXPECT_EQ(copy.get_size(measurements), 2 * n_modules);
+        EXPECT_EQ(copy.get_size(spacepoints), 2 * n_modules);
+        if (compact) {
+            EXPECT_EQ(measurements.capacity(), 2 * n_modules);
+        }
+    }
+}
+
+TEST(clusterization, cuda_no_cell_links) {
+
+    // Memory resource used by the EDM.
+    vecmem::cuda::managed_memory_resource mng_mr;
+    traccc::memory_resource mr{mng_mr};
+
+    // Cuda stream
+    traccc::cuda::stream stream;
+
+    // Cuda copy objects
+    vecmem::cuda::async_copy copy{stream.cudaStream()};
+
+    // Create a module with two clusters.
+    traccc::cell_collection_types::host cells{&mng_mr};
+    cells.push_back({1u, 0u, 1.f, 0, 0});
+    cells.push_back({2u, 0u, 1.f, 0, 0});
+    cells.push_back({6u, 6u, 1.f, 0, 0});
+    traccc::cell_module_collection_types::host modules{&mng_mr};
+    modules.push_back({});
+
+    // Run the clusterization without producing the cell links.
+    traccc::cuda::clusterization_algorithm ca_cuda(mr, copy, stream, 1024,
+                                                   32.f, true, false);
+    auto [spacepoints, cell_links] =
+        ca_cuda(vecmem::get_data(cells), vecmem::get_data(modules));
+    stream.synchronize();
+
+    EXPECT_EQ(copy.get_size(spacepoints), 2u);
+    EXPECT_EQ(cell_links.size(), 0u);
+}
+
+TEST(clusterization, cuda_batched) {
+
+    // Memory resource used by the EDM.
+    vecmem::cuda::managed_memory_resource mng_mr;
+    traccc::memory_resource mr{mng_mr};
+
+    // Cuda stream
+    traccc::cuda::stream stream;
+
+    // Cuda copy objects
+    vecmem::cuda::async_copy copy{stream.cudaStream()};
+
+    // Create a few small events, with a different number of modules (with
+    // two clusters each) in each of them. Leaving one event empty.
+    static constexpr unsigned int n_events = 5;
+    traccc::event_batch batch{mng_mr};
+    for (unsigned int e = 0; e < n_events; ++e) {
+        traccc::cell_collection_types::host cells{&mng_mr};
+        traccc::cell_module_collection_types::host modules{&mng_mr};
+        const unsigned int n_modules = (e == 2) ? 0 : 3 * e + 1;
+        for (unsigned int m = 0; m < n_modules; ++m) {
+            cells.push_back({1u, 0u, 1.f, 0, m});
+            cells.push_back({2u, 0u, 1.f, 0, m});
+            cells.push_back({6u, 6u, 1.f, 0, m});
+            modules.push_back({});
+        }
+        batch.add(cells, modules);
+    }
+
+    // Run the clusterization on the whole batch.
+    traccc::cuda::clusterization_algorithm ca_cuda(mr, copy, stream, 1024);
+    auto result = ca_cuda.run_batched(
+        vecmem::get_data(batch.cells()), vecmem::get_data(batch.modules()),
+        vecmem::get_data(batch.module_events()), batch.size());
+    stream.synchronize();
+
+    // Check that the results got de-multiplexed correctly.
+    ASSERT_EQ(result.offsets.size(), n_events + 1);
+    EXPECT_EQ(result.offsets.front(), 0u);
+    for (unsigned int e = 0; e < n_events; ++e) {
+        const unsigned int n_modules = (e == 2) ? 0 : 3 * e + 1;
+        const measurement_collection_types::const_device measurements(
+            result.event_measurements(e));
+        const spacepoint_collection_types::const_device spacepoints(
+            result.event_spacepoints(e));
+        ASSERT_EQ(measurements.size(), 2 * n_modules);
+        ASSERT_EQ(spacepoints.size(), 2 * n_modules);
+        for (unsigned int i = 0; i < measurements.size(); ++i) {
+            EXPECT_EQ(batch.module_events()[measurements[i].module_link], e);
+            EXPECT_EQ(spacepoints[i].meas, measurements[i]);
+        }
+    }
+}
+
+TEST(clusterization, cuda_raw_cell_sorting) {
+
+    // Memory resource used by the EDM.
+    vecmem::cuda::managed_memory_resource mng_mr;
+    traccc::memory_resource mr{mng_mr};
+
+    // Cuda stream
+    traccc::cuda::stream stream;
+
+    // Cuda copy objects
+    vecmem::cuda::async_copy copy{stream.cudaStream()};
+
+    // Module descriptions for two of the three modules of the cells.
+    std::map<geometry_id, cell_module> module_descriptions;
+    module_descriptions[20u].surface_link = detray::geometry::barcode{20u};
+    module_descriptions[20u].threshold = 2.f;
+    module_descriptions[10u].surface_link = detray::geometry::barcode{10u};
+    module_descriptions[10u].threshold = 1.f;
+    const hashed_module_map<geometry_id, cell_module> module_map(
+        module_descriptions, &mng_mr);
+
+    // Create unsorted raw cells
+    raw_cell_collection_types::host raw_cells{&mng_mr};
+    raw_cells.push_back({20u, 1u, 2u, 1.f, 0.f});
+    raw_cells.push_back({10u, 5u, 1u, 2.f, 0.f});
+    raw_cells.push_back({30u, 0u, 0u, 3.f, 0.f});
+    raw_cells.push_back({10u, 2u, 1u, 4.f, 0.f});
+    raw_cells.push_back({20u, 1u, 1u, 5.f, 0.f});
+    raw_cells.push_back({10u, 3u, 0u, 6.f, 0.f});
+
+    // Sort the cells
+    traccc::cuda::raw_cell_sorting_algorithm sorting(module_map.view(), mr,
+                                                     copy, stream);
+    auto result = sorting(vecmem::get_data(raw_cells));
+    stream.synchronize();
+
+    // Check the modules
+    cell_module_collection_types::const_device modules(result.modules);
+    ASSERT_EQ(modules.size(), 3u);
+    EXPECT_EQ(modules[0].surface_link.value(), 10u);
+    EXPECT_FLOAT_EQ(modules[0].threshold, 1.f);
+    EXPECT_EQ(modules[1].surface_link.value(), 20u);
+    EXPECT_FLOAT_EQ(modules[1].threshold, 2.f);
+    EXPECT_EQ(modules[2].surface_link.value(), 30u);
+    EXPECT_FLOAT_EQ(modules[2].threshold, 0.f);
+
+    // Check the cells, sorted by module, channel1 and channel0
+    cell_collection_types::const_device cells(result.cells);
+    ASSERT_EQ(cells.size(), 6u);
+    const std::vector<cell> expected{
+        {3u, 0u, 6.f, 0.f, 0u}, {2u, 1u, 4.f, 0.f, 0u},
+        {5u, 1u, 2.f, 0.f, 0u}, {1u, 1u, 5.f, 0.f, 1u},
+        {1u, 2u, 1.f, 0.f, 1u}, {0u, 0u, 3.f, 0.f, 2u}};
+    for (std::size_t i = 0; i < expected.size(); ++i) {
+        EXPECT_EQ(cells[i], expected[i]);
+    }
+}
+
+TEST(clusterization, cuda_persistent) {
+
+    // Memory resources used by the EDM.
+    vecmem::cuda::managed_memory_resource mng_mr;
+    vecmem::cuda::device_memory_resource device_mr;
+    vecmem::host_memory_resource host_mr;
+    traccc::memory_resource mr{mng_mr};
+
+    // Cuda stream
+    traccc::cuda::stream stream;
+
+    // Cuda copy objects
+    vecmem::cuda::async_copy copy{stream.cudaStream()};
+    vecmem::cuda::copy sync_copy;
+
+    // Create a few events, with a different number of modules (with two
+    // clusters each) in each of them. Leaving one event empty, and making one
+    // large enough for multiple partitions.
+    static constexpr unsigned int n_events = 6;
+    std::vector<traccc::cell_collection_types::host> cells;
+    std::vector<traccc::cell_module_collection_types::host> modules;
+    for (unsigned int e = 0; e < n_events; ++e) {
+        cells.emplace_back(&mng_mr);
+        modules.emplace_back(&mng_mr);
+        const unsigned int n_modules = (e == 2) ? 0 : 100 * e + 1;
+        for (unsigned int m = 0; m < n_modules; ++m) {
+            cells.back().push_back({1u, 0u, 1.f, 0, m});
+            cells.back().push_back({2u, 0u, 2.f, 0, m});
+            cells.back().push_back({1u, 1u, 3.f, 0, m});
+            cells.back().push_back({6u, 6u, 1.f, 0, m});
+            modules.back().push_back({});
+        }
+    }
+
+    // Produce the reference spacepoints with the regular algorithm, before
+    // the persistent kernel takes over the device.
+    std::vector<std::vector<spacepoint>> reference;
+    {
+        traccc::cuda::clusterization_algorithm ca_cuda(mr, copy, stream, 1024);
+        for (unsigned int e = 0; e < n_events; ++e) {
+            auto result = ca_cuda(vecmem::get_data(cells[e]),
+                                  vecmem::get_data(modules[e]));
+            stream.synchronize();
+            spacepoint_collection_types::const_device spacepoints(
+                result.first);
+            reference.emplace_back(spacepoints.begin(), spacepoints.end());
+            std::sort(reference.back().begin(), reference.back().end());
+        }
+    }
+
+    // Enqueue all events (twice, to re-use the slots of the queue), and
+    // collect their results.
+    traccc::cuda::persistent_clusterization persistent(
+        traccc::memory_resource{device_mr}, 1024, n_events - 2);
+    std::vector<traccc::cuda::persistent_clusterization::ticket_type> tickets;
+    for (unsigned int i = 0; i < 2 * n_events; ++i) {
+        tickets.push_back(
+            persistent.enqueue(vecmem::get_data(cells[i % n_events]),
+                               vecmem::get_data(modules[i % n_events])));
+        if (i >= 2) {
+            auto result = persistent.wait(tickets[i - 2]);
+            spacepoint_collection_types::host spacepoints{&host_mr};
+            sync_copy(result.spacepoints, spacepoints)->wait();
+            std::sort(spacepoints.begin(), spacepoints.end());
+            const std::vector<spacepoint>& ref =
+                reference[(i - 2) % n_events];
+            ASSERT_EQ(spacepoints.size(), ref.size());
+            EXPECT_EQ(sync_copy.get_size(result.measurements), ref.size());
+            for (std::size_t j = 0; j < ref.size(); ++j) {
+                EXPECT_EQ(spacepoints[j], ref[j]);
+            }
+        }
+    }
+    EXPECT_TRUE(persistent.is_done(tickets.back() - 2));
+    persistent.wait(tickets.back());
+    persistent.stop();
+}
@@ -0,0 +1,58 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Project include(s).
+#include "traccc/cuda/utils/device_partitions.hpp"
+#include "traccc/cuda/utils/stream.hpp"
+
+// GTest include(s).
+#include <gtest/gtest.h>
+
+// System include(s).
+#include <sstream>
+#include <vector>
+
+using namespace traccc;
+
+TEST(cuda_device_partitions, enumeration) {
+
+    const std::vector<cuda::device_partition> partitions =
+        cuda::get_device_partitions();
+    ASSERT_FALSE(partitions.empty());
+
+    for (std::size_t i = 0; i < partitions.size(); ++i) {
+        const cuda::device_partition& partition = partitions[i];
+        EXPECT_EQ(partition.device, static_cast<int>(i));
+        EXPECT_FALSE(partition.name.empty());
+        EXPECT_EQ(partition.uuid.size(), 40u);
+        EXPECT_GT(partition.sm_count, 0u);
+        EXPECT_GE(partition.usable_sm_count(), 1u);
+        EXPECT_LE(partition.usable_sm_count(), partition.sm_count);
+
+        std::ostringstream description;
+        description << partition;
+        EXPECT_NE(description.str().find(partition.name), std::string::npos);
+
+        // Every logical device can be used for the algorithms' streams.
+        cuda::stream str{partition.device};
+        str.synchronize();
+    }
+}
+
+TEST(cuda_device_partitions, mps_share) {
+
+    cuda::device_partition partition;
+    partition.sm_count = 108u;
+    partition.kind = cuda::partition_kind::mps_client;
+    partition.active_thread_percentage = 25u;
+    EXPECT_EQ(partition.usable_sm_count(), 27u);
+    partition.active_thread_percentage = 10u;
+    EXPECT_EQ(partition.usable_sm_count(), 11u);
+    partition.sm_count = 4u;
+    partition.active_thread_percentage = 1u;
+    EXPECT_EQ(partition.usable_sm_count(), 1u);
+}
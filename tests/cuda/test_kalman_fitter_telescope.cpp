@@ -148,6 +148,20 @@ TEST_P(KalmanFittingTelescopeTests, Run) {
     traccc::cuda::fitting_algorithm<device_fitter_type> device_fitting(
         fit_cfg, mr, copy, stream);
 
+    // Fitting algorithm object fitting the longest tracks first
+    typename traccc::cuda::fitting_algorithm<device_fitter_type>::config_type
+        sorted_fit_cfg;
+    sorted_fit_cfg.sort_tracks_by_length = true;
+    traccc::cuda::fitting_algorithm<device_fitter_type> sorted_device_fitting(
+        sorted_fit_cfg, mr, copy, stream);
+
+    // Fitting algorithm object smoothing with staged track states
+    typename traccc::cuda::fitting_algorithm<device_fitter_type>::config_type
+        staged_fit_cfg;
+    staged_fit_cfg.staged_smoothing = true;
+    traccc::cuda::fitting_algorithm<device_fitter_type> staged_device_fitting(
+        staged_fit_cfg, mr, copy, stream);
+
     // Iterate over events
     for (std::size_t i_evt = 0; i_evt < n_events; i_evt++) {
         // Event map
@@ -182,6 +196,41 @@ TEST_P(KalmanFittingTelescopeTests, Run) {
 
         ASSERT_EQ(track_states_cuda.size(), n_truth_tracks);
 
+        // The fitting order must not change the results
+        traccc::track_state_container_types::host sorted_track_states_cuda =
+            track_state_d2h(sorted_device_fitting(
+                det_view, field, navigation_buffer,
+                track_candidates_cuda_buffer));
+        ASSERT_EQ(sorted_track_states_cuda.size(), n_truth_tracks);
+        EXPECT_GT(sorted_device_fitting.get_warp_efficiency(), 0.f);
+        EXPECT_LE(sorted_device_fitting.get_warp_efficiency(), 1.f);
+        for (std::size_t i_trk = 0; i_trk < n_truth_tracks; i_trk++) {
+            EXPECT_FLOAT_EQ(sorted_track_states_cuda[i_trk].header.ndf,
+                            track_states_cuda[i_trk].header.ndf);
+            EXPECT_FLOAT_EQ(sorted_track_states_cuda[i_trk].header.chi2,
+                            track_states_cuda[i_trk].header.chi2);
+        }
+
+        // The staged smoothing must not change the results either, beyond
+        // the rounding of the chi2 sum
+        traccc::track_state_container_types::host staged_track_states_cuda =
+            track_state_d2h(staged_device_fitting(
+                det_view, field, navigation_buffer,
+                track_candidates_cuda_buffer));
+        ASSERT_EQ(staged_track_states_cuda.size(), n_truth_tracks);
+        for (std::size_t i_trk = 0; i_trk < n_truth_tracks; i_trk++) {
+            const auto& staged = staged_track_states_cuda[i_trk];
+            const auto& ref = track_states_cuda[i_trk];
+            EXPECT_FLOAT_EQ(staged.header.ndf, ref.header.ndf);
+            EXPECT_NEAR(staged.header.chi2, ref.header.chi2,
+                        1e-4f * ref.header.chi2);
+            ASSERT_EQ(staged.items.size(), ref.items.size());
+            for (std::size_t i_st = 0; i_st < ref.items.size(); i_st++) {
+                EXPECT_FLOAT_EQ(staged.items[i_st].smoothed_chi2(),
+                                ref.items[i_st].smoothed_chi2());
+            }
+        }
+
         for (std::size_t i_trk = 0; i_trk < n_truth_tracks; i_trk++) {
 
             const auto& track_states_per_track = track_states_cuda[i_trk].items;
@@ -0,0 +1,61 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Project include(s).
+#include "traccc/cuda/utils/launch_tuning.hpp"
+
+// GTest include(s).
+#include <gtest/gtest.h>
+
+// System include(s).
+#include <cstdio>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+
+using namespace traccc;
+
+TEST(cuda_launch_tuning, lookup) {
+
+    cuda::launch_tuning tuning;
+    tuning.set("fit", 128u);
+    EXPECT_EQ(tuning.size(), 1u);
+    EXPECT_EQ(tuning.threads_per_block("fit", 64u), 128u);
+    EXPECT_EQ(tuning.threads_per_block("build_tracks", 64u), 64u);
+
+    const cuda::launch_tuning uniform = cuda::launch_tuning::uniform(256u);
+    EXPECT_EQ(uniform.threads_per_block("fit", 64u), 256u);
+    EXPECT_EQ(uniform.threads_per_block("build_tracks", 64u), 256u);
+}
+
+TEST(cuda_launch_tuning, file_round_trip) {
+
+    const std::string filename = "test_cuda_launch_tuning.txt";
+
+    cuda::launch_tuning tuning;
+    tuning.set("fit", 128u);
+    tuning.set("propagate_to_next_surface", 256u);
+    tuning.set_device_name("Test Device 1000");
+    tuning.write(filename);
+
+    const cuda::launch_tuning read = cuda::launch_tuning::read(filename);
+    EXPECT_EQ(read.size(), 2u);
+    EXPECT_EQ(read.device_name(), "Test Device 1000");
+    EXPECT_EQ(read.threads_per_block("fit", 64u), 128u);
+    EXPECT_EQ(read.threads_per_block("propagate_to_next_surface", 64u),
+              256u);
+
+    // Block sizes that are not multiples of the warp size are rejected.
+    {
+        std::ofstream file(filename);
+        file << "fit 100\n";
+    }
+    EXPECT_THROW(cuda::launch_tuning::read(filename), std::runtime_error);
+    std::remove(filename.c_str());
+
+    EXPECT_THROW(cuda::launch_tuning::read(filename), std::runtime_error);
+}
@@ -0,0 +1,82 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Project include(s).
+#include "traccc/cuda/clusterization/measurement_sorting_algorithm.hpp"
+#include "traccc/cuda/finding/measurement_segmentation_algorithm.hpp"
+#include "traccc/edm/measurement.hpp"
+#include "traccc/finding/measurement_range.hpp"
+
+// VecMem include(s).
+#include <vecmem/memory/cuda/managed_memory_resource.hpp>
+#include <vecmem/utils/cuda/async_copy.hpp>
+
+// GTest include(s).
+#include <gtest/gtest.h>
+
+// System include(s).
+#include <algorithm>
+#include <iterator>
+
+using namespace traccc;
+
+// Test the sorting and segmentation of measurements by surface, against the
+// host implementation
+TEST(measurement_segmentation, cuda) {
+
+    // Memory resource used by the EDM.
+    vecmem::cuda::managed_memory_resource mng_mr;
+    traccc::memory_resource mr{mng_mr};
+
+    // CUDA stream and copy object.
+    traccc::cuda::stream stream;
+    vecmem::cuda::async_copy copy{stream.cudaStream()};
+
+    // Measurements on surfaces in different volumes, in partition order.
+    measurement_collection_types::host measurements(&mng_mr);
+    const unsigned int volumes[] = {2u, 0u, 1u, 0u, 2u, 1u, 0u, 2u, 0u};
+    const unsigned int indices[] = {7u, 3u, 5u, 3u, 7u, 1u, 0u, 9u, 3u};
+    for (unsigned int i = 0; i < std::size(indices); ++i) {
+        measurement meas;
+        meas.surface_link = detray::geometry::barcode{}
+                                .set_volume(volumes[i])
+                                .set_index(indices[i]);
+        meas.local = {static_cast<float>(i), 0.f};
+        measurements.push_back(meas);
+    }
+
+    // Sort and segment the measurements on the device.
+    traccc::cuda::measurement_sorting_algorithm sorting(mr, copy, stream);
+    traccc::cuda::measurement_segmentation_algorithm segmentation(mr, copy,
+                                                                  stream);
+    const measurement_collection_types::view sorted =
+        sorting(vecmem::get_data(measurements));
+    const measurement_range_collection_types::buffer ranges_buffer =
+        segmentation(sorted);
+    stream.synchronize();
+
+    // Compare with a (stable) sort, and the range table, on the host.
+    measurement_collection_types::host expected(&mng_mr);
+    expected.assign(measurements.begin(), measurements.end());
+    std::stable_sort(expected.begin(), expected.end(),
+                     measurement_sort_comp());
+    const measurement_range_collection_types::host expected_ranges =
+        make_measurement_ranges(expected, mng_mr);
+
+    ASSERT_EQ(sorted.size(), expected.size());
+    for (unsigned int i = 0; i < expected.size(); ++i) {
+        EXPECT_EQ(measurements[i].surface_link, expected[i].surface_link);
+        EXPECT_EQ(measurements[i].local[0], expected[i].local[0]);
+    }
+    const measurement_range_collection_types::const_device ranges(
+        ranges_buffer);
+    ASSERT_EQ(ranges.size(), expected_ranges.size());
+    for (unsigned int i = 0; i < ranges.size(); ++i) {
+        EXPECT_EQ(ranges[i].begin, expected_ranges[i].begin);
+        EXPECT_EQ(ranges[i].end, expected_ranges[i].end);
+    }
+}
@@ -0,0 +1,67 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Project include(s).
+#include "traccc/cuda/utils/result_ring.hpp"
+#include "traccc/cuda/utils/stream.hpp"
+
+// VecMem include(s).
+#include <vecmem/containers/data/vector_buffer.hpp>
+#include <vecmem/memory/cuda/device_memory_resource.hpp>
+#include <vecmem/memory/host_memory_resource.hpp>
+#include <vecmem/utils/cuda/async_copy.hpp>
+
+// GTest include(s).
+#include <gtest/gtest.h>
+
+// System include(s).
+#include <vector>
+
+using namespace traccc;
+
+TEST(cuda_result_ring, in_order_delivery) {
+
+    cuda::stream str;
+    vecmem::cuda::device_memory_resource device_mr;
+    vecmem::cuda::async_copy copy{str.cudaStream()};
+
+    // Upload a few results of different sizes.
+    static constexpr unsigned int n_results = 10u;
+    std::vector<vecmem::data::vector_buffer<int>> buffers;
+    for (unsigned int i = 0; i < n_results; ++i) {
+        std::vector<int> input(100u * (i + 1u), static_cast<int>(i));
+        buffers.emplace_back(static_cast<unsigned int>(input.size()),
+                             device_mr);
+        copy(vecmem::get_data(input), buffers.back(),
+             vecmem::copy::type::host_to_device);
+    }
+
+    // Copy them back through a ring with fewer slots than results. Results
+    // made of two blocks are delivered as one.
+    std::vector<std::vector<int>> outputs;
+    {
+        cuda::result_ring ring{str, 3u};
+        for (const auto& buffer : buffers) {
+            const std::size_t half = (buffer.size() / 2u) * sizeof(int);
+            ring.enqueue({{buffer.ptr(), half},
+                          {reinterpret_cast<const char*>(buffer.ptr()) + half,
+                           buffer.size() * sizeof(int) - half}},
+                         [&outputs](const void* data, std::size_t size) {
+                             const int* values = static_cast<const int*>(data);
+                             outputs.emplace_back(
+                                 values, values + size / sizeof(int));
+                         });
+        }
+        ring.drain();
+    }
+
+    ASSERT_EQ(outputs.size(), n_results);
+    for (unsigned int i = 0; i < n_results; ++i) {
+        EXPECT_EQ(outputs[i],
+                  std::vector<int>(100u * (i + 1u), static_cast<int>(i)));
+    }
+}
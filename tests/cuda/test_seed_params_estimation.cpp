@@ -0,0 +1,123 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Project include(s).
+#include "traccc/cuda/seeding/seeding_algorithm.hpp"
+#include "traccc/cuda/seeding/track_params_estimation.hpp"
+#include "traccc/definitions/common.hpp"
+#include "traccc/edm/seed.hpp"
+#include "traccc/edm/spacepoint.hpp"
+#include "traccc/edm/track_parameters.hpp"
+#include "traccc/seeding/detail/seeding_config.hpp"
+
+// VecMem include(s).
+#include <vecmem/memory/cuda/managed_memory_resource.hpp>
+#include <vecmem/utils/cuda/async_copy.hpp>
+
+// GTest include(s).
+#include <gtest/gtest.h>
+
+// System include(s).
+#include <array>
+#include <cmath>
+#include <random>
+
+using namespace traccc;
+
+namespace {
+
+/// Make the spacepoints of helical tracks from the beam line
+spacepoint_collection_types::host make_spacepoints(
+    unsigned int n_tracks, vecmem::memory_resource& mr) {
+
+    static constexpr std::array<scalar, 6> radii = {
+        40.f * unit<scalar>::mm,  70.f * unit<scalar>::mm,
+        100.f * unit<scalar>::mm, 130.f * unit<scalar>::mm,
+        160.f * unit<scalar>::mm, 190.f * unit<scalar>::mm};
+    static constexpr scalar b_field = 2.f * unit<scalar>::T;
+
+    std::mt19937 gen(1234u);
+    std::uniform_real_distribution<scalar> phi_dist(-M_PI, M_PI);
+    std::uniform_real_distribution<scalar> eta_dist(-2.f, 2.f);
+    std::uniform_real_distribution<scalar> pt_dist(1.f * unit<scalar>::GeV,
+                                                   10.f * unit<scalar>::GeV);
+    std::normal_distribution<scalar> z0_dist(0.f, 50.f * unit<scalar>::mm);
+    std::bernoulli_distribution charge_dist;
+
+    spacepoint_collection_types::host result(&mr);
+    for (unsigned int i = 0; i < n_tracks; ++i) {
+        const scalar phi0 = phi_dist(gen);
+        const scalar cot_theta = std::sinh(eta_dist(gen));
+        const scalar z0 = z0_dist(gen);
+        const scalar charge = charge_dist(gen) ? 1.f : -1.f;
+        const scalar helix_radius = pt_dist(gen) / b_field;
+        for (const scalar r : radii) {
+            const scalar alpha = std::asin(r / (2.f * helix_radius));
+            const scalar phi = phi0 - charge * alpha;
+            const scalar path = 2.f * helix_radius * alpha;
+            result.push_back({{r * std::cos(phi), r * std::sin(phi),
+                               z0 + cot_theta * path},
+                              {}});
+        }
+    }
+    return result;
+}
+
+}  // namespace
+
+// Test that the track parameters estimated by the seed finding are the same
+// as the ones of the separate parameter estimation
+TEST(seed_params_estimation, cuda) {
+
+    // Memory resource used by the EDM.
+    vecmem::cuda::managed_memory_resource mng_mr;
+    traccc::memory_resource mr{mng_mr};
+
+    // CUDA stream and copy object.
+    traccc::cuda::stream stream;
+    vecmem::cuda::async_copy copy{stream.cudaStream()};
+
+    // The spacepoints of the event.
+    const spacepoint_collection_types::host spacepoints =
+        make_spacepoints(500u, mng_mr);
+    const vector3 bfield{0.f, 0.f, 2.f * unit<scalar>::T};
+
+    // Find the seeds, with their parameters.
+    seedfinder_config finder_config;
+    spacepoint_grid_config grid_config(finder_config);
+    seedfilter_config filter_config;
+    traccc::cuda::seeding_algorithm seeding(
+        finder_config, grid_config, filter_config, mr, copy, stream);
+    sp_soa_grid_types::buffer grid =
+        seeding.bin(vecmem::get_data(spacepoints));
+    auto [seeds_buffer, params_buffer] =
+        seeding(vecmem::get_data(spacepoints), get_data(grid), bfield);
+
+    // Estimate the parameters of the same seeds separately.
+    traccc::cuda::track_params_estimation estimation(mr, copy, stream);
+    auto ref_params_buffer =
+        estimation(vecmem::get_data(spacepoints), seeds_buffer, bfield);
+
+    seed_collection_types::host seeds;
+    copy(seeds_buffer, seeds)->wait();
+    bound_track_parameters_collection_types::host params, ref_params;
+    copy(params_buffer, params)->wait();
+    copy(ref_params_buffer, ref_params)->wait();
+
+    ASSERT_GT(seeds.size(), 0u);
+    ASSERT_EQ(params.size(), seeds.size());
+    ASSERT_EQ(ref_params.size(), seeds.size());
+    for (unsigned int i = 0; i < seeds.size(); ++i) {
+        EXPECT_EQ(params[i].surface_link(), ref_params[i].surface_link());
+        for (unsigned int j = 0; j < e_bound_size; ++j) {
+            EXPECT_FLOAT_EQ(getter::element(params[i].vector(), j, 0),
+                            getter::element(ref_params[i].vector(), j, 0));
+            EXPECT_FLOAT_EQ(getter::element(params[i].covariance(), j, j),
+                            getter::element(ref_params[i].covariance(), j, j));
+        }
+    }
+}
@@ -0,0 +1,175 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Project include(s).
+#include "traccc/cuda/seeding/seed_selection.hpp"
+#include "traccc/edm/seed.hpp"
+#include "traccc/edm/track_parameters.hpp"
+#include "traccc/seeding/seed_selection_helper.hpp"
+
+// VecMem include(s).
+#include <vecmem/memory/cuda/managed_memory_resource.hpp>
+#include <vecmem/utils/cuda/async_copy.hpp>
+
+// GTest include(s).
+#include <gtest/gtest.h>
+
+// System include(s).
+#include <map>
+#include <random>
+#include <vector>
+
+using namespace traccc;
+
+namespace {
+
+/// Make the parameters of a seed
+bound_track_parameters make_params(const scalar phi, const scalar theta,
+                                   const scalar qop) {
+    bound_vector vector = bound_track_parameters{}.vector();
+    getter::element(vector, e_bound_phi, 0) = phi;
+    getter::element(vector, e_bound_theta, 0) = theta;
+    getter::element(vector, e_bound_qoverp, 0) = qop;
+    bound_track_parameters result;
+    result.set_vector(vector);
+    return result;
+}
+
+}  // namespace
+
+// Test the seed selection on the device, against a simple host
+// implementation
+TEST(seed_selection, cuda) {
+
+    // Memory resource used by the EDM.
+    vecmem::cuda::managed_memory_resource mng_mr;
+    traccc::memory_resource mr{mng_mr};
+
+    // CUDA stream and copy object.
+    traccc::cuda::stream stream;
+    vecmem::cuda::async_copy copy{stream.cudaStream()};
+
+    // Random seeds, made out of a small number of spacepoints, to have many
+    // of them share spacepoints. With parameters grouped around a few
+    // values, to have many of them be compatible.
+    std::mt19937 gen(1234u);
+    std::uniform_int_distribution<unsigned int> sp_dist(0u, 29u);
+    std::uniform_int_distribution<int> group_dist(0, 3);
+    std::uniform_real_distribution<scalar> weight_dist(0.f, 500.f);
+    std::normal_distribution<scalar> spread(0.f, 0.005f);
+    seed_collection_types::host seeds(&mng_mr);
+    bound_track_parameters_collection_types::host params(&mng_mr);
+    for (unsigned int i = 0; i < 500u; ++i) {
+        const unsigned int spB = sp_dist(gen);
+        const unsigned int spM = 30u + sp_dist(gen);
+        const unsigned int spT = 60u + sp_dist(gen);
+        seeds.push_back({spB, spM, spT, weight_dist(gen), 0.f});
+        const scalar group = static_cast<scalar>(group_dist(gen));
+        const scalar qop = (0.5f + 0.1f * group) * (1.f + spread(gen));
+        params.push_back(make_params(0.5f * group + spread(gen),
+                                     1.f + 0.3f * group + spread(gen), qop));
+    }
+
+    // Run the selection on the device.
+    seed_selection_config config;
+    config.enabled = true;
+    config.max_seeds_per_region = 3u;
+    config.max_duplicate_candidates = 500u;
+    traccc::cuda::seed_selection selection(config, mr, copy, stream);
+    const auto [seeds_buffer, params_buffer] =
+        selection(vecmem::get_data(seeds), vecmem::get_data(params));
+    seed_collection_types::host selected_seeds;
+    bound_track_parameters_collection_types::host selected_params;
+    copy(seeds_buffer, selected_seeds)->wait();
+    copy(params_buffer, selected_params)->wait();
+
+    // Remove the duplicates on the host.
+    std::vector<bool> removed(seeds.size(), false);
+    for (unsigned int i = 0; i < seeds.size(); ++i) {
+        for (unsigned int j = 0; j < seeds.size(); ++j) {
+            if ((i != j) && seed_selection_helper::is_duplicate_of(
+                                config, seeds[i], i, params[i], seeds[j], j,
+                                params[j])) {
+                removed[i] = true;
+                break;
+            }
+        }
+    }
+
+    // Cap the number of seeds per region on the host.
+    std::map<unsigned int, std::vector<unsigned int>> regions;
+    for (unsigned int i = 0; i < seeds.size(); ++i) {
+        if (!removed[i]) {
+            regions[seed_selection_helper::region_index(config, params[i])]
+                .push_back(i);
+        }
+    }
+    for (const auto& [region, indices] : regions) {
+        for (unsigned int i : indices) {
+            unsigned int n_better = 0u;
+            for (unsigned int j : indices) {
+                if (seed_selection_helper::is_better(seeds[j], j, seeds[i],
+                                                     i)) {
+                    ++n_better;
+                }
+            }
+            if (n_better >= config.max_seeds_per_region) {
+                removed[i] = true;
+            }
+        }
+    }
+
+    // Compare the results, which should be in the original order.
+    std::vector<unsigned int> expected;
+    for (unsigned int i = 0; i < seeds.size(); ++i) {
+        if (!removed[i]) {
+            expected.push_back(i);
+        }
+    }
+    ASSERT_GT(expected.size(), 0u);
+    ASSERT_LT(expected.size(), seeds.size());
+    ASSERT_EQ(selected_seeds.size(), expected.size());
+    ASSERT_EQ(selected_params.size(), expected.size());
+    for (unsigned int i = 0; i < expected.size(); ++i) {
+        const seed& ref = seeds[expected[i]];
+        EXPECT_EQ(selected_seeds[i].spB_link, ref.spB_link);
+        EXPECT_EQ(selected_seeds[i].spM_link, ref.spM_link);
+        EXPECT_EQ(selected_seeds[i].spT_link, ref.spT_link);
+        EXPECT_FLOAT_EQ(selected_params[i].phi(), params[expected[i]].phi());
+    }
+}
+
+// Test that the selection keeps all seeds when it is disabled
+TEST(seed_selection, cuda_disabled) {
+
+    // Memory resource used by the EDM.
+    vecmem::cuda::managed_memory_resource mng_mr;
+    traccc::memory_resource mr{mng_mr};
+
+    // CUDA stream and copy object.
+    traccc::cuda::stream stream;
+    vecmem::cuda::async_copy copy{stream.cudaStream()};
+
+    // Two identical seeds.
+    seed_collection_types::host seeds(&mng_mr);
+    bound_track_parameters_collection_types::host params(&mng_mr);
+    for (unsigned int i = 0; i < 2u; ++i) {
+        seeds.push_back({0u, 1u, 2u, 100.f, 0.f});
+        params.push_back(make_params(0.f, 1.f, 0.5f));
+    }
+
+    // Run the selection, with and without enabling it.
+    for (const bool enabled : {false, true}) {
+        seed_selection_config config;
+        config.enabled = enabled;
+        traccc::cuda::seed_selection selection(config, mr, copy, stream);
+        const auto [seeds_buffer, params_buffer] =
+            selection(vecmem::get_data(seeds), vecmem::get_data(params));
+        EXPECT_EQ(copy.get_size(seeds_buffer), enabled ? 1u : 2u);
+        EXPECT_EQ(copy.get_size(params_buffer), enabled ? 1u : 2u);
+    }
+}
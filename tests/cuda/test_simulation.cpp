@@ -0,0 +1,182 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Project include(s).
+#include "traccc/cuda/simulation/simulation_algorithm.hpp"
+#include "traccc/edm/measurement.hpp"
+#include "traccc/edm/track_parameters.hpp"
+#include "traccc/simulation/track_simulator.hpp"
+#include "traccc/utils/memory_resource.hpp"
+
+// Test include(s).
+#include "tests/kalman_fitting_telescope_test.hpp"
+
+// detray include(s).
+#include "detray/io/frontend/detector_reader.hpp"
+#include "detray/simulation/event_generator/track_generators.hpp"
+
+// VecMem include(s).
+#include <vecmem/containers/data/vector_buffer.hpp>
+#include <vecmem/containers/vector.hpp>
+#include <vecmem/memory/cuda/device_memory_resource.hpp>
+#include <vecmem/memory/cuda/managed_memory_resource.hpp>
+#include <vecmem/memory/host_memory_resource.hpp>
+#include <vecmem/utils/copy.hpp>
+#include <vecmem/utils/cuda/async_copy.hpp>
+
+// GTest include(s).
+#include <gtest/gtest.h>
+
+// System include(s).
+#include <algorithm>
+#include <string>
+
+using namespace traccc;
+
+/// Particle gun simulation in the telescope geometry
+class CudaSimulationTelescopeTests : public KalmanFittingTelescopeTests {};
+
+TEST_P(CudaSimulationTelescopeTests, Run) {
+
+    // Get the parameters
+    const std::string name = std::get<0>(GetParam());
+    const std::array<scalar, 3u> origin = std::get<1>(GetParam());
+    const std::array<scalar, 3u> origin_stddev = std::get<2>(GetParam());
+    const std::array<scalar, 2u> mom_range = std::get<3>(GetParam());
+    const std::array<scalar, 2u> eta_range = std::get<4>(GetParam());
+    const std::array<scalar, 2u> theta_range = eta_to_theta_range(eta_range);
+    const std::array<scalar, 2u> phi_range = std::get<5>(GetParam());
+    const scalar charge = std::get<6>(GetParam());
+    const unsigned int n_truth_tracks = std::get<7>(GetParam());
+    const unsigned int n_events = std::get<8>(GetParam());
+
+    // Memory resources used by the application.
+    vecmem::host_memory_resource host_mr;
+    vecmem::cuda::device_memory_resource device_mr;
+    traccc::memory_resource mr{device_mr, &host_mr};
+    vecmem::cuda::managed_memory_resource mng_mr;
+
+    // Read back detector file
+    const std::string path = name + "/";
+    detray::io::detector_reader_config reader_cfg{};
+    reader_cfg.add_file(path + "telescope_detector_geometry.json")
+        .add_file(path + "telescope_detector_homogeneous_material.json");
+
+    auto [host_det, names] =
+        detray::io::read_detector<host_detector_type>(mng_mr, reader_cfg);
+    auto det_view = detray::get_data(host_det);
+
+    auto field = detray::bfield::create_const_field(B);
+
+    // Track generator
+    using generator_type =
+        detray::random_track_generator<traccc::free_track_parameters,
+                                       uniform_gen_t>;
+    generator_type::configuration gen_cfg{};
+    gen_cfg.n_tracks(n_truth_tracks);
+    gen_cfg.origin(origin);
+    gen_cfg.origin_stddev(origin_stddev);
+    gen_cfg.phi_range(phi_range[0], phi_range[1]);
+    gen_cfg.theta_range(theta_range[0], theta_range[1]);
+    gen_cfg.mom_range(mom_range[0], mom_range[1]);
+    gen_cfg.charge(charge);
+    generator_type generator(gen_cfg);
+
+    // Simulation configuration
+    track_simulation_config sim_cfg;
+    sim_cfg.smearing = smearing;
+
+    // Simulation objects
+    using host_simulator_type =
+        track_simulator<rk_stepper_type, host_navigator_type>;
+    using device_simulator_type =
+        track_simulator<rk_stepper_type, device_navigator_type>;
+    const host_simulator_type host_simulator(host_det, field, sim_cfg);
+
+    traccc::cuda::stream stream;
+    vecmem::cuda::async_copy copy{stream.cudaStream()};
+    vecmem::copy host_copy;
+    traccc::cuda::simulation_algorithm<device_simulator_type>
+        device_simulation(sim_cfg, mr, copy, stream);
+
+    for (std::size_t i_evt = 0; i_evt < n_events; i_evt++) {
+
+        vecmem::vector<free_track_parameters> tracks(&host_mr);
+        for (auto track : generator) {
+            tracks.push_back(track);
+        }
+        ASSERT_EQ(tracks.size(), n_truth_tracks);
+
+        // Simulate the event on the host, with the same track simulator.
+        measurement_collection_types::buffer host_buffer(
+            n_truth_tracks * sim_cfg.max_measurements_per_track, host_mr,
+            vecmem::data::buffer_type::resizable);
+        host_copy.setup(host_buffer);
+        measurement_collection_types::device host_device_measurements(
+            host_buffer);
+        for (std::size_t i_trk = 0; i_trk < tracks.size(); i_trk++) {
+            host_simulator.simulate(
+                tracks[i_trk], i_evt, i_trk, host_device_measurements,
+                host_simulator_type::vector_type<
+                    host_simulator_type::intersection_type>(&host_mr));
+        }
+        measurement_collection_types::host host_measurements(&host_mr);
+        host_copy(host_buffer, host_measurements);
+
+        // Simulate the event on the device.
+        vecmem::data::vector_buffer<free_track_parameters> tracks_buffer(
+            n_truth_tracks, mr.main);
+        copy(vecmem::get_data(tracks), tracks_buffer,
+             vecmem::copy::type::host_to_device);
+        auto navigation_buffer = detray::create_candidates_buffer(
+            host_det, n_truth_tracks, mr.main, mr.host);
+        const measurement_collection_types::buffer device_buffer =
+            device_simulation(det_view, field, navigation_buffer,
+                              tracks_buffer, i_evt);
+        measurement_collection_types::host device_measurements(&host_mr);
+        copy(device_buffer, device_measurements)->wait();
+
+        // Every track crosses every plane of the telescope.
+        ASSERT_EQ(host_measurements.size(),
+                  n_truth_tracks * plane_positions.size());
+        ASSERT_EQ(device_measurements.size(), host_measurements.size());
+
+        // The device writes the measurements in an arbitrary order, but they
+        // need to be the same as on the host.
+        auto by_surface_and_position = [](const measurement& a,
+                                          const measurement& b) {
+            return (a.surface_link != b.surface_link)
+                       ? (a.surface_link < b.surface_link)
+                       : (a.local[0] < b.local[0]);
+        };
+        std::sort(host_measurements.begin(), host_measurements.end(),
+                  by_surface_and_position);
+        std::sort(device_measurements.begin(), device_measurements.end(),
+                  by_surface_and_position);
+        for (std::size_t i = 0; i < host_measurements.size(); i++) {
+            const measurement& host_meas = host_measurements[i];
+            const measurement& device_meas = device_measurements[i];
+            EXPECT_EQ(host_meas.surface_link, device_meas.surface_link);
+            EXPECT_EQ(host_meas.meas_dim, device_meas.meas_dim);
+            EXPECT_NEAR(host_meas.local[0], device_meas.local[0],
+                        1.f * detray::unit<scalar>::um);
+            EXPECT_NEAR(host_meas.local[1], device_meas.local[1],
+                        1.f * detray::unit<scalar>::um);
+            EXPECT_FLOAT_EQ(host_meas.variance[0], device_meas.variance[0]);
+            EXPECT_FLOAT_EQ(host_meas.variance[1], device_meas.variance[1]);
+        }
+    }
+}
+
+INSTANTIATE_TEST_SUITE_P(
+    CudaSimulationTelescope, CudaSimulationTelescopeTests,
+    ::testing::Values(std::make_tuple(
+        "cuda_simulation_telescope_1_GeV_0_phi",
+        std::array<scalar, 3u>{0.f, 0.f, 0.f},
+        std::array<scalar, 3u>{0.f, 0.f, 0.f}, std::array<scalar, 2u>{1.f, 1.f},
+        std::array<scalar, 2u>{0.f, 0.f}, std::array<scalar, 2u>{0.f, 0.f},
+        -1.f, 100, 10)));
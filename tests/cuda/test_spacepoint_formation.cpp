@@ -6,6 +6,7 @@
  */
 
 // Project include(s).
+#include "traccc/cuda/clusterization/experimental/spacepoint_clusterization_algorithm.hpp"
 #include "traccc/cuda/seeding/experimental/spacepoint_formation.hpp"
 #include "traccc/definitions/common.hpp"
 #include "traccc/edm/spacepoint.hpp"
@@ -91,3 +92,74 @@ TEST(spacepoint_formation, cuda) {
 
     EXPECT_EQ(test, ref);
 }
+
+TEST(spacepoint_formation, cuda_fused_clusterization) {
+
+    // Memory resource used by the EDM.
+    vecmem::cuda::managed_memory_resource mng_mr;
+    traccc::memory_resource mr{mng_mr};
+
+    // Cuda stream
+    traccc::cuda::stream stream;
+
+    // Cuda copy objects
+    vecmem::cuda::async_copy copy{stream.cudaStream()};
+
+    // Use rectangle surfaces
+    detray::mask<detray::rectangle2D> rectangle{
+        0u, 10000.f * detray::unit<scalar>::mm,
+        10000.f * detray::unit<scalar>::mm};
+
+    // Plane alignment direction (aligned to x-axis)
+    detray::detail::ray<transform3> traj{{0, 0, 0}, 0, {1, 0, 0}, -1};
+
+    // Position of planes (in mm unit)
+    std::vector<scalar> plane_positions = {20.f,  40.f,  60.f,  80.f, 100.f,
+                                           120.f, 140.f, 160.f, 180.f};
+
+    detray::tel_det_config<> tel_cfg{rectangle};
+    tel_cfg.positions(plane_positions);
+    tel_cfg.pilot_track(traj);
+
+    // Create telescope geometry
+    auto [det, name_map] = build_telescope_detector(mng_mr, tel_cfg);
+    using device_detector_type =
+        detray::detector<detray::telescope_metadata<detray::rectangle2D>,
+                         detray::device_container_types>;
+
+    // Surface lookup
+    auto surfaces = det.surfaces();
+
+    // Create modules on the first and the last plane
+    cell_module_collection_types::host modules{&mng_mr};
+    modules.push_back({surfaces[0].barcode()});
+    modules.push_back({surfaces[8u].barcode()});
+
+    // Create a two-cell cluster on the first, and a single-cell cluster on
+    // the last module
+    cell_collection_types::host cells{&mng_mr};
+    cells.push_back({7u, 2u, 1.f, 0.f, 0u});
+    cells.push_back({8u, 2u, 1.f, 0.f, 0u});
+    cells.push_back({10u, 15u, 1.f, 0.f, 1u});
+
+    // Run the fused clusterization and spacepoint formation
+    traccc::cuda::experimental::spacepoint_clusterization_algorithm<
+        device_detector_type>
+        sp_clusterization(mr, copy, stream, 1024);
+    auto spacepoints_buffer =
+        sp_clusterization(detray::get_data(det), vecmem::get_data(cells),
+                          vecmem::get_data(modules));
+
+    spacepoint_collection_types::device spacepoints(spacepoints_buffer);
+
+    // Check the results. The spacepoints are sorted by surface.
+    ASSERT_EQ(copy.get_size(spacepoints_buffer), 2u);
+    EXPECT_EQ(spacepoints[0].meas.surface_link, surfaces[0].barcode());
+    EXPECT_EQ(spacepoints[1].meas.surface_link, surfaces[8u].barcode());
+    EXPECT_NEAR(spacepoints[0].global[0], 20.f, 1e-4f);
+    EXPECT_NEAR(spacepoints[0].global[1], 7.5f, 1e-4f);
+    EXPECT_NEAR(spacepoints[0].global[2], 2.f, 1e-4f);
+    EXPECT_NEAR(spacepoints[1].global[0], 180.f, 1e-4f);
+    EXPECT_NEAR(spacepoints[1].global[1], 10.f, 1e-4f);
+    EXPECT_NEAR(spacepoints[1].global[2], 15.f, 1e-4f);
+}
@@ -0,0 +1,73 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Project include(s).
+#include "traccc/cuda/utils/stream.hpp"
+#include "traccc/cuda/utils/stream_ordered_memory_resource.hpp"
+
+// VecMem include(s).
+#include <vecmem/containers/data/vector_buffer.hpp>
+#include <vecmem/containers/vector.hpp>
+#include <vecmem/memory/host_memory_resource.hpp>
+#include <vecmem/utils/cuda/async_copy.hpp>
+
+// GTest include(s).
+#include <gtest/gtest.h>
+
+using namespace traccc;
+
+TEST(cuda_stream_ordered_memory_resource, round_trip) {
+
+    if (!cuda::stream_ordered_memory_resource::is_supported()) {
+        GTEST_SKIP() << "Memory pools are not supported by the device";
+    }
+
+    cuda::stream str;
+    cuda::stream_ordered_memory_resource device_mr{str};
+    vecmem::host_memory_resource host_mr;
+    vecmem::cuda::async_copy copy{str.cudaStream()};
+
+    // Copy the data through (re-used) stream-ordered device buffers.
+    for (unsigned int iteration = 0; iteration < 3; ++iteration) {
+
+        vecmem::vector<int> input(&host_mr);
+        for (int i = 0; i < 1000; ++i) {
+            input.push_back(i * static_cast<int>(iteration + 1u));
+        }
+        vecmem::data::vector_buffer<int> buffer(
+            static_cast<unsigned int>(input.size()), device_mr);
+        copy(vecmem::get_data(input), buffer,
+             vecmem::copy::type::host_to_device);
+        vecmem::vector<int> output(&host_mr);
+        copy(buffer, output, vecmem::copy::type::device_to_host);
+        str.synchronize();
+        EXPECT_EQ(input, output);
+    }
+
+    // The freed memory stays in the pool.
+    str.synchronize();
+    EXPECT_EQ(device_mr.used_size(), 0u);
+    EXPECT_GT(device_mr.reserved_size(), 0u);
+    device_mr.trim();
+    EXPECT_EQ(device_mr.reserved_size(), 0u);
+}
+
+TEST(cuda_stream_ordered_memory_resource, release_threshold) {
+
+    if (!cuda::stream_ordered_memory_resource::is_supported()) {
+        GTEST_SKIP() << "Memory pools are not supported by the device";
+    }
+
+    cuda::stream str;
+    cuda::stream_ordered_memory_resource device_mr{
+        str, cuda::stream::INVALID_DEVICE, 1024u};
+    EXPECT_EQ(device_mr.release_threshold(), 1024u);
+    device_mr.set_release_threshold(
+        cuda::stream_ordered_memory_resource::keep_all);
+    EXPECT_EQ(device_mr.release_threshold(),
+              cuda::stream_ordered_memory_resource::keep_all);
+}
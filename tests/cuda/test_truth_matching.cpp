@@ -0,0 +1,95 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Project include(s).
+#include "traccc/cuda/finding/truth_matching_algorithm.hpp"
+#include "traccc/edm/track_candidate.hpp"
+#include "traccc/edm/truth_match.hpp"
+
+// VecMem include(s).
+#include <vecmem/memory/cuda/managed_memory_resource.hpp>
+#include <vecmem/utils/cuda/async_copy.hpp>
+
+// GTest include(s).
+#include <gtest/gtest.h>
+
+// System include(s).
+#include <cstdint>
+#include <vector>
+
+using namespace traccc;
+
+namespace {
+
+/// Make a measurement on a given surface
+measurement make_measurement(unsigned int surface, scalar local0) {
+    measurement result;
+    result.surface_link = detray::geometry::barcode{}.set_index(surface);
+    result.local = {local0, 0.f};
+    return result;
+}
+
+}  // namespace
+
+// Test the truth matching of track candidates on the device
+TEST(truth_matching, cuda) {
+
+    // Memory resource used by the EDM.
+    vecmem::cuda::managed_memory_resource mng_mr;
+    traccc::memory_resource mr{mng_mr};
+
+    // CUDA stream and copy object.
+    traccc::cuda::stream stream;
+    vecmem::cuda::async_copy copy{stream.cudaStream()};
+
+    // Truth information of 6 measurements, sorted. The fourth measurement
+    // is shared by two particles.
+    const std::vector<std::vector<std::uint64_t>> particles = {
+        {10u}, {10u}, {20u}, {10u, 20u}, {20u}, {30u}};
+    measurement_particle_container_types::host truth(&mng_mr);
+    for (unsigned int i = 0; i < particles.size(); ++i) {
+        vecmem::vector<std::uint64_t> ids(&mng_mr);
+        ids.assign(particles[i].begin(), particles[i].end());
+        truth.push_back(make_measurement(i, 1.f), std::move(ids));
+    }
+
+    // Track candidates made from these, and from measurements without truth
+    // information.
+    const std::vector<std::vector<measurement>> tracks = {
+        // All measurements from particle 10.
+        {make_measurement(0u, 1.f), make_measurement(1u, 1.f)},
+        // Particles 10 and 20.
+        {make_measurement(1u, 1.f), make_measurement(2u, 1.f)},
+        // Particle 20, with a shared measurement.
+        {make_measurement(2u, 1.f), make_measurement(3u, 1.f)},
+        // Particle 30, and measurements without truth information.
+        {make_measurement(5u, 1.f), make_measurement(5u, 2.f),
+         make_measurement(7u, 1.f)},
+        // No truth information at all.
+        {make_measurement(8u, 1.f)}};
+    track_candidate_container_types::host track_candidates(&mng_mr);
+    for (const std::vector<measurement>& track : tracks) {
+        vecmem::vector<track_candidate> cands(&mng_mr);
+        cands.assign(track.begin(), track.end());
+        track_candidates.push_back(bound_track_parameters{},
+                                   std::move(cands));
+    }
+
+    // Run the matching on the device.
+    traccc::cuda::truth_matching_algorithm matching(mr, copy, stream);
+    track_truth_match_collection_types::host matches;
+    copy(matching(traccc::get_data(track_candidates), traccc::get_data(truth)),
+         matches)
+        ->wait();
+
+    ASSERT_EQ(matches.size(), tracks.size());
+    EXPECT_EQ(matches[0].particle_id, 10u);
+    EXPECT_FALSE(matches[1].is_matched());
+    EXPECT_FALSE(matches[2].is_matched());
+    EXPECT_EQ(matches[3].particle_id, 30u);
+    EXPECT_FALSE(matches[4].is_matched());
+}
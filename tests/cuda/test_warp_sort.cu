@@ -0,0 +1,91 @@
+/**
+ * TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <functional>
+#include <vector>
+
+#include "../../device/cuda/src/utils/warp_sort.cuh"
+
+__global__ void testWarpTopKernel(const float *weights, unsigned int n,
+                                  float *top_weights,
+                                  unsigned int *top_indices) {
+
+    traccc::cuda::details::warp_candidate best{
+        0.f, 0.f, traccc::cuda::details::warp_candidate::invalid_index};
+    for (unsigned int chunk = 0; chunk < n; chunk += 32u) {
+        const unsigned int i = chunk + threadIdx.x;
+        traccc::cuda::details::warp_candidate candidate{
+            0.f, 0.f, traccc::cuda::details::warp_candidate::invalid_index};
+        // Leave out every seventh candidate, like the seed selection does
+        // with the triplets failing its cuts.
+        if (i < n && i % 7 != 0) {
+            candidate = {weights[i], 0.f, i};
+        }
+        best = traccc::cuda::details::warp_merge_top(
+            best, traccc::cuda::details::warp_bitonic_sort(candidate));
+    }
+
+    top_weights[threadIdx.x] = best.weight;
+    top_indices[threadIdx.x] = best.index;
+}
+
+TEST(CUDAWarpSort, WarpTop) {
+
+    // Weights in a "random" order.
+    const unsigned int n = 100u;
+    std::vector<float> weights(n);
+    for (unsigned int i = 0; i < n; ++i) {
+        weights[i] = static_cast<float>((i * 37u) % 101u);
+    }
+
+    float *dev_weights = nullptr, *dev_top_weights = nullptr;
+    unsigned int *dev_top_indices = nullptr;
+    float host_top_weights[32];
+    unsigned int host_top_indices[32];
+
+    ASSERT_EQ(cudaMalloc(&dev_weights, n * sizeof(float)), cudaSuccess);
+    ASSERT_EQ(cudaMalloc(&dev_top_weights, 32u * sizeof(float)), cudaSuccess);
+    ASSERT_EQ(cudaMalloc(&dev_top_indices, 32u * sizeof(unsigned int)),
+              cudaSuccess);
+    ASSERT_EQ(cudaMemcpy(dev_weights, weights.data(), n * sizeof(float),
+                         cudaMemcpyHostToDevice),
+              cudaSuccess);
+
+    testWarpTopKernel<<<1, 32u>>>(dev_weights, n, dev_top_weights,
+                                  dev_top_indices);
+
+    ASSERT_EQ(cudaPeekAtLastError(), cudaSuccess);
+
+    ASSERT_EQ(cudaMemcpy(host_top_weights, dev_top_weights,
+                         32u * sizeof(float), cudaMemcpyDeviceToHost),
+              cudaSuccess);
+    ASSERT_EQ(cudaMemcpy(host_top_indices, dev_top_indices,
+                         32u * sizeof(unsigned int), cudaMemcpyDeviceToHost),
+              cudaSuccess);
+
+    // The expected result, sorted on the host.
+    std::vector<float> expected;
+    for (unsigned int i = 0; i < n; ++i) {
+        if (i % 7 != 0) {
+            expected.push_back(weights[i]);
+        }
+    }
+    std::sort(expected.begin(), expected.end(), std::greater<float>());
+
+    for (unsigned int i = 0; i < 32u; ++i) {
+        ASSERT_EQ(host_top_weights[i], expected[i]);
+        ASSERT_EQ(weights[host_top_indices[i]], host_top_weights[i]);
+    }
+
+    ASSERT_EQ(cudaFree(dev_weights), cudaSuccess);
+    ASSERT_EQ(cudaFree(dev_top_weights), cudaSuccess);
+    ASSERT_EQ(cudaFree(dev_top_indices), cudaSuccess);
+}
@@ -1,6 +1,6 @@
 /** TRACCC library, part of the ACTS project (R&D line)
  *
- * (c) 2021-2022 CERN for the benefit of the ACTS project
+ * (c) 2021-2024 CERN for the benefit of the ACTS project
  *
  * Mozilla Public License Version 2.0
  */
@@ -8,7 +8,7 @@
 // Project include(s).
 #include "traccc/definitions/primitives.hpp"
 #include "traccc/edm/cell.hpp"
-#include "traccc/futhark/component_connection.hpp"
+#include "traccc/futhark/clusterization_algorithm.hpp"
 
 // Test include(s).
 #include "tests/cca_test.hpp"
@@ -18,28 +18,49 @@
 
 // System include(s).
 #include <functional>
+#include <vector>
 
 namespace {
 vecmem::host_memory_resource resource;
-traccc::futhark::component_connection cc(resource);
+traccc::futhark::clusterization_algorithm ca(resource);
 
-cca_function_t f = [](const traccc::cell_container_types::host &data) {
+cca_function_t f = [](const traccc::cell_collection_types::host &cells,
+                      const traccc::cell_module_collection_types::host
+                          &modules) {
     std::map<traccc::geometry_id, vecmem::vector<traccc::measurement>> result;
 
-    traccc::measurement_container_types::host mss = cc(data);
-
-    for (std::size_t i = 0; i < mss.size(); ++i) {
-        vecmem::vector<traccc::measurement> msv(&resource);
-
-        for (std::size_t j = 0; j < mss.at(i).items.size(); ++j) {
-            msv.push_back(mss.at(i).items.at(j));
-        }
-
-        result.emplace(mss.at(i).header.module, std::move(msv));
+    const traccc::spacepoint_collection_types::host sps = ca(cells, modules);
+    for (std::size_t i = 0; i < sps.size(); ++i) {
+        const traccc::measurement &m = sps.at(i).meas;
+        result[modules.at(m.module_link).surface_link.value()].push_back(m);
     }
 
     return result;
 };
+
+// Run the event as part of a batch, after an empty event and a copy of
+// itself, which must not change the clusterization of either copy.
+cca_function_t f_batched =
+    [](const traccc::cell_collection_types::host &cells,
+       const traccc::cell_module_collection_types::host &modules) {
+        std::map<traccc::geometry_id, vecmem::vector<traccc::measurement>>
+            result;
+
+        const traccc::cell_collection_types::host no_cells(&resource);
+        const traccc::cell_module_collection_types::host no_modules(&resource);
+        const std::vector<traccc::spacepoint_collection_types::host> sps =
+            ca({{no_cells, no_modules}, {cells, modules}, {cells, modules}});
+        EXPECT_EQ(sps.size(), 3u);
+        EXPECT_TRUE(sps.at(0).empty());
+        EXPECT_EQ(sps.at(1).size(), sps.at(2).size());
+        for (std::size_t i = 0; i < sps.at(2).size(); ++i) {
+            const traccc::measurement &m = sps.at(2).at(i).meas;
+            result[modules.at(m.module_link).surface_link.value()].push_back(
+                m);
+        }
+
+        return result;
+    };
 }  // namespace
 
 TEST_P(ConnectedComponentAnalysisTests, Run) {
@@ -52,3 +73,10 @@ INSTANTIATE_TEST_SUITE_P(
         ::testing::Values(f),
         ::testing::ValuesIn(ConnectedComponentAnalysisTests::get_test_files())),
     ConnectedComponentAnalysisTests::get_test_name);
+
+INSTANTIATE_TEST_SUITE_P(
+    FutharkBatchedCcaAlgorithm, ConnectedComponentAnalysisTests,
+    ::testing::Combine(
+        ::testing::Values(f_batched),
+        ::testing::ValuesIn(ConnectedComponentAnalysisTests::get_test_files())),
+    ConnectedComponentAnalysisTests::get_test_name);
@@ -0,0 +1,174 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Project include(s).
+#include "traccc/io/async_writer.hpp"
+
+// VecMem include(s).
+#include <vecmem/memory/host_memory_resource.hpp>
+
+// GTest include(s).
+#include <gtest/gtest.h>
+
+// System include(s).
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+
+/// Read all records of a file written by @c traccc::io::async_writer
+std::vector<std::pair<traccc::io::async_writer::record_header, std::string>>
+read_records(const std::string& filename) {
+
+    std::ifstream in_file(filename, std::ios::binary);
+    const std::string data{std::istreambuf_iterator<char>(in_file),
+                           std::istreambuf_iterator<char>()};
+
+    std::vector<std::pair<traccc::io::async_writer::record_header, std::string>>
+        result;
+    std::size_t pos = 0;
+    while (pos < data.size()) {
+        traccc::io::async_writer::record_header header;
+        EXPECT_LE(pos + sizeof(header), data.size());
+        std::memcpy(&header, data.data() + pos, sizeof(header));
+        pos += sizeof(header);
+        EXPECT_LE(pos + header.size, data.size());
+        result.emplace_back(header, data.substr(pos, header.size));
+        pos += header.size;
+    }
+    return result;
+}
+
+}  // namespace
+
+// This checks the records written for the track states of some events
+TEST(io_async_writer, track_states) {
+
+    const std::string filename =
+        (std::filesystem::temp_directory_path() / "traccc_async_writer.dat")
+            .string();
+    vecmem::host_memory_resource host_mr;
+
+    // Write the track states of a few events, from multiple threads.
+    static constexpr std::size_t n_events = 20;
+    {
+        traccc::io::async_writer writer(filename, 2u, 1024u);
+        std::vector<std::thread> threads;
+        for (std::size_t t = 0; t < 2; ++t) {
+            threads.emplace_back([&, t]() {
+                for (std::size_t event = t; event < n_events; event += 2) {
+                    traccc::track_state_container_types::host track_states{
+                        &host_mr};
+                    for (std::size_t i = 0; i < event % 4; ++i) {
+                        traccc::fitting_result<traccc::transform3> result;
+                        result.chi2 = static_cast<traccc::scalar>(event);
+                        track_states.push_back(
+                            result,
+                            vecmem::vector<
+                                traccc::track_state<traccc::transform3>>(
+                                i + 1, &host_mr));
+                    }
+                    writer.write(event, track_states);
+                }
+            });
+        }
+        for (std::thread& thread : threads) {
+            thread.join();
+        }
+        writer.flush();
+    }
+
+    // Check the records in the file.
+    const auto records = read_records(filename);
+    ASSERT_EQ(records.size(), n_events);
+    std::vector<bool> seen(n_events, false);
+    for (const auto& [header, payload] : records) {
+        EXPECT_EQ(header.type,
+                  traccc::io::async_writer::record_type::track_states);
+        ASSERT_LT(header.event, n_events);
+        EXPECT_FALSE(seen[header.event]);
+        seen[header.event] = true;
+
+        // The number of tracks, and the number of states of every track.
+        std::size_t n_tracks = 0;
+        std::memcpy(&n_tracks, payload.data(), sizeof(std::size_t));
+        ASSERT_EQ(n_tracks, header.event % 4);
+        std::size_t n_states = 0;
+        for (std::size_t i = 0; i < n_tracks; ++i) {
+            std::size_t size = 0;
+            std::memcpy(&size,
+                        payload.data() + (i + 1) * sizeof(std::size_t),
+                        sizeof(std::size_t));
+            EXPECT_EQ(size, i + 1);
+            n_states += size;
+        }
+        EXPECT_EQ(
+            payload.size(),
+            (n_tracks + 1) * sizeof(std::size_t) +
+                n_tracks * sizeof(traccc::fitting_result<traccc::transform3>) +
+                n_states * sizeof(traccc::track_state<traccc::transform3>));
+
+        // The chi-square of the first track.
+        if (n_tracks > 0) {
+            traccc::fitting_result<traccc::transform3> result;
+            std::memcpy(&result,
+                        payload.data() + (n_tracks + 1) * sizeof(std::size_t),
+                        sizeof(result));
+            EXPECT_EQ(result.chi2, static_cast<traccc::scalar>(header.event));
+        }
+    }
+
+    std::remove(filename.c_str());
+}
+
+// This checks reading back the track parameters written for some events
+TEST(io_async_writer, read_track_parameters) {
+
+    const std::string filename =
+        (std::filesystem::temp_directory_path() / "traccc_async_params.dat")
+            .string();
+    vecmem::host_memory_resource host_mr;
+
+    // Write the track parameters of a few events, among other records.
+    static constexpr std::size_t n_events = 5;
+    {
+        traccc::io::async_writer writer(filename);
+        for (std::size_t event = 0; event < n_events; ++event) {
+            traccc::bound_track_parameters_collection_types::host params{
+                &host_mr};
+            for (std::size_t i = 0; i < event; ++i) {
+                traccc::bound_track_parameters param;
+                param.set_surface_link(
+                    detray::geometry::barcode{}.set_index(i));
+                params.push_back(param);
+            }
+            writer.write(event, params);
+            const traccc::track_state_container_types::host track_states{
+                &host_mr};
+            writer.write(event, track_states);
+        }
+        writer.flush();
+    }
+
+    // Read them back.
+    const auto result = traccc::io::read_track_parameters(filename, host_mr);
+    ASSERT_EQ(result.size(), n_events);
+    for (const auto& [event, params] : result) {
+        ASSERT_EQ(params.size(), event);
+        for (std::size_t i = 0; i < params.size(); ++i) {
+            EXPECT_EQ(params[i].surface_link().index(), i);
+        }
+    }
+
+    std::remove(filename.c_str());
+}
@@ -6,10 +6,12 @@
  */
 
 // Project include(s).
+#include "traccc/io/demonstrator_edm.hpp"
 #include "traccc/io/read_cells.hpp"
 #include "traccc/io/read_digitization_config.hpp"
 #include "traccc/io/read_geometry.hpp"
 #include "traccc/io/read_measurements.hpp"
+#include "traccc/io/read_packed.hpp"
 #include "traccc/io/read_spacepoints.hpp"
 #include "traccc/io/utils.hpp"
 #include "traccc/io/write.hpp"
@@ -23,6 +25,7 @@
 // System
 #include <cstdio>
 #include <fstream>
+#include <vector>
 
 // This defines the local frame test suite for binary cell container
 TEST(io_binary, cell) {
@@ -228,4 +231,127 @@ TEST(io_binary, measurement) {
     for (std::size_t i = 0; i < modules_csv.size(); i++) {
         ASSERT_EQ(modules_csv[i].surface_link, modules_binary[i].surface_link);
     }
-}
\ No newline at end of file
+}
+// This checks the writing and the (partial) reading of a packed cell file
+TEST(io_binary, packed) {
+
+    // Set event configuration
+    const std::size_t n_events = 3;
+    const std::string cells_directory = "tml_full/ttbar_mu100/";
+
+    // Memory resource used by the EDM.
+    vecmem::host_memory_resource host_mr;
+
+    // Read the surface transforms
+    auto [surface_transforms, _] =
+        traccc::io::read_geometry("tml_detector/trackml-detector.csv");
+
+    // Read the digitization configuration file
+    auto digi_cfg = traccc::io::read_digitization_config(
+        "tml_detector/default-geometric-config-generic.json");
+
+    // Read csv files
+    traccc::demonstrator_input events_csv(&host_mr);
+    for (std::size_t event = 0; event < n_events; ++event) {
+        events_csv.push_back(traccc::io::cell_reader_output(&host_mr));
+        traccc::io::read_cells(events_csv.back(), event, cells_directory,
+                               traccc::data_format::csv, &surface_transforms,
+                               &digi_cfg);
+    }
+
+    // Write packed file
+    traccc::io::write(cells_directory, traccc::data_format::packed,
+                      events_csv);
+    ASSERT_EQ(traccc::io::packed_events(cells_directory), n_events);
+
+    // Read a subset of the events, in a different order
+    const std::vector<std::size_t> event_indices = {2, 0};
+    traccc::demonstrator_input events_packed(&host_mr);
+    for (std::size_t i = 0; i < event_indices.size(); ++i) {
+        events_packed.push_back(traccc::io::cell_reader_output(&host_mr));
+    }
+    traccc::io::read_packed(events_packed, cells_directory, event_indices);
+
+    // Delete packed file
+    std::string io_packed_file =
+        traccc::io::data_directory() + cells_directory + "cells.pack";
+    std::remove(io_packed_file.c_str());
+
+    ASSERT_TRUE(!std::ifstream(io_packed_file));
+
+    // Check the events
+    for (std::size_t i = 0; i < event_indices.size(); ++i) {
+        const traccc::io::cell_reader_output& csv =
+            events_csv[event_indices[i]];
+        const traccc::io::cell_reader_output& packed = events_packed[i];
+        ASSERT_TRUE(csv.cells.size() > 0);
+        ASSERT_EQ(csv.cells.size(), packed.cells.size());
+        ASSERT_EQ(csv.modules.size(), packed.modules.size());
+        for (std::size_t j = 0; j < csv.cells.size(); j++) {
+            ASSERT_EQ(csv.cells[j], packed.cells[j]);
+        }
+        for (std::size_t j = 0; j < csv.modules.size(); j++) {
+            ASSERT_EQ(csv.modules[j].surface_link,
+                      packed.modules[j].surface_link);
+            ASSERT_EQ(csv.modules[j].placement, packed.modules[j].placement);
+        }
+    }
+}
+
+// This checks the round trip of the cells through a compressed cell file
+TEST(io_binary, compressed) {
+
+    // Set event configuration
+    const std::size_t event = 0;
+    const std::string cells_directory = "tml_full/ttbar_mu100/";
+
+    // Memory resource used by the EDM.
+    vecmem::host_memory_resource host_mr;
+
+    // Read the surface transforms
+    auto [surface_transforms, _] =
+        traccc::io::read_geometry("tml_detector/trackml-detector.csv");
+
+    // Read the digitization configuration file
+    auto digi_cfg = traccc::io::read_digitization_config(
+        "tml_detector/default-geometric-config-generic.json");
+
+    // Read csv file
+    traccc::io::cell_reader_output reader_csv(&host_mr);
+    traccc::io::read_cells(reader_csv, event, cells_directory,
+                           traccc::data_format::csv, &surface_transforms,
+                           &digi_cfg);
+
+    // Write compressed file
+    traccc::io::write(event, cells_directory, traccc::data_format::compressed,
+                      vecmem::get_data(reader_csv.cells),
+                      vecmem::get_data(reader_csv.modules));
+
+    // Read compressed file
+    traccc::io::cell_reader_output reader_compressed(&host_mr);
+    traccc::io::read_cells(reader_compressed, event, cells_directory,
+                           traccc::data_format::compressed);
+
+    // Delete compressed file
+    std::string io_cells_file =
+        traccc::io::data_directory() + cells_directory +
+        traccc::io::get_event_filename(event, "-cells.zdat");
+    std::remove(io_cells_file.c_str());
+
+    ASSERT_TRUE(!std::ifstream(io_cells_file));
+
+    // Check the cells and modules
+    ASSERT_TRUE(reader_csv.cells.size() > 0);
+    ASSERT_EQ(reader_csv.cells.size(), reader_compressed.cells.size());
+    ASSERT_EQ(reader_csv.modules.size(), reader_compressed.modules.size());
+    for (std::size_t i = 0; i < reader_csv.cells.size(); i++) {
+        ASSERT_EQ(reader_csv.cells[i], reader_compressed.cells[i]);
+        ASSERT_EQ(reader_csv.cells[i].time, reader_compressed.cells[i].time);
+    }
+    for (std::size_t i = 0; i < reader_csv.modules.size(); i++) {
+        ASSERT_EQ(reader_csv.modules[i].surface_link,
+                  reader_compressed.modules[i].surface_link);
+        ASSERT_EQ(reader_csv.modules[i].placement,
+                  reader_compressed.modules[i].placement);
+    }
+}
@@ -130,4 +130,37 @@ TEST_F(io, csv_read_tml_single_muon) {
     ASSERT_EQ(measurements_per_event.measurements.size(), 11u);
 
     ASSERT_EQ(particles_per_event.size(), 1u);
-}
\ No newline at end of file
+}
+
+// This checks that the indexed and the linear cell readers produce the same
+// output
+TEST_F(io, csv_read_cells_indexed) {
+    vecmem::host_memory_resource resource;
+
+    // Read the surface transforms
+    auto [surface_transforms, _] =
+        traccc::io::read_geometry("tml_detector/trackml-detector.csv");
+
+    // Read the digitization configuration file
+    auto digi_cfg = traccc::io::read_digitization_config(
+        "tml_detector/default-geometric-config-generic.json");
+
+    // Read the cells of the same event with both readers
+    traccc::io::cell_reader_output indexed(&resource);
+    traccc::io::read_cells(indexed, 0, "tml_full/ttbar_mu100/",
+                           traccc::data_format::csv, &surface_transforms,
+                           &digi_cfg, nullptr, true);
+    traccc::io::cell_reader_output linear(&resource);
+    traccc::io::read_cells(linear, 0, "tml_full/ttbar_mu100/",
+                           traccc::data_format::csv, &surface_transforms,
+                           &digi_cfg, nullptr, false);
+
+    ASSERT_EQ(indexed.modules.size(), linear.modules.size());
+    for (std::size_t i = 0; i < indexed.modules.size(); ++i) {
+        EXPECT_EQ(indexed.modules.at(i), linear.modules.at(i));
+    }
+    ASSERT_EQ(indexed.cells.size(), linear.cells.size());
+    for (std::size_t i = 0; i < indexed.cells.size(); ++i) {
+        EXPECT_EQ(indexed.cells.at(i), linear.cells.at(i));
+    }
+}
@@ -0,0 +1,188 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Project include(s).
+#include "traccc/io/read_cells.hpp"
+#include "traccc/io/read_digitization_config.hpp"
+#include "traccc/io/read_geometry.hpp"
+#include "traccc/io/mapped_geometry.hpp"
+#include "traccc/io/read_mapped.hpp"
+#include "traccc/io/read_measurements.hpp"
+#include "traccc/io/utils.hpp"
+#include "traccc/io/write.hpp"
+
+// VecMem include(s).
+#include <vecmem/memory/host_memory_resource.hpp>
+
+// GTest include(s).
+#include <gtest/gtest.h>
+
+// System
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <map>
+
+// This checks the zero-copy views of a mapped cell file
+TEST(io_mapped, cell) {
+
+    // Set event configuration
+    const std::size_t event = 0;
+    const std::string cells_directory = "tml_full/ttbar_mu100/";
+
+    // Memory resource used by the EDM.
+    vecmem::host_memory_resource host_mr;
+
+    // Read the surface transforms
+    auto [surface_transforms, _] =
+        traccc::io::read_geometry("tml_detector/trackml-detector.csv");
+
+    // Read the digitization configuration file
+    auto digi_cfg = traccc::io::read_digitization_config(
+        "tml_detector/default-geometric-config-generic.json");
+
+    // Read csv file
+    traccc::io::cell_reader_output reader_csv(&host_mr);
+    traccc::io::read_cells(reader_csv, event, cells_directory,
+                           traccc::data_format::csv, &surface_transforms,
+                           &digi_cfg);
+    const traccc::cell_collection_types::host& cells_csv = reader_csv.cells;
+    const traccc::cell_module_collection_types::host& modules_csv =
+        reader_csv.modules;
+
+    // Write mapped file
+    traccc::io::write(event, cells_directory, traccc::data_format::mapped,
+                      vecmem::get_data(cells_csv),
+                      vecmem::get_data(modules_csv));
+
+    {
+        // Map the file, and check the views into it
+        const traccc::io::mapped_cell_reader_output mapped =
+            traccc::io::read_mapped_cells(event, cells_directory);
+        ASSERT_EQ(mapped.cells.size(), cells_csv.size());
+        ASSERT_EQ(mapped.modules.size(), modules_csv.size());
+        EXPECT_EQ(reinterpret_cast<std::uintptr_t>(mapped.cells.ptr()) %
+                      traccc::io::mapped_file::alignment,
+                  0u);
+        for (std::size_t i = 0; i < cells_csv.size(); i++) {
+            ASSERT_EQ(cells_csv[i], mapped.cells.ptr()[i]);
+        }
+        for (std::size_t i = 0; i < modules_csv.size(); i++) {
+            ASSERT_EQ(modules_csv[i].surface_link,
+                      mapped.modules.ptr()[i].surface_link);
+            ASSERT_EQ(modules_csv[i].placement,
+                      mapped.modules.ptr()[i].placement);
+        }
+
+        // Read the file through the generic reader as well
+        traccc::io::cell_reader_output reader_mapped(&host_mr);
+        traccc::io::read_cells(reader_mapped, event, cells_directory,
+                               traccc::data_format::mapped);
+        ASSERT_EQ(reader_mapped.cells.size(), cells_csv.size());
+        for (std::size_t i = 0; i < cells_csv.size(); i++) {
+            ASSERT_EQ(cells_csv[i], reader_mapped.cells[i]);
+        }
+    }
+
+    // Delete mapped file
+    std::string io_cells_file =
+        traccc::io::data_directory() + cells_directory +
+        traccc::io::get_event_filename(event, "-cells.map");
+    std::remove(io_cells_file.c_str());
+
+    ASSERT_TRUE(!std::ifstream(io_cells_file));
+}
+
+// This checks the zero-copy views of a mapped measurement file
+TEST(io_mapped, measurement) {
+
+    // Set event configuration
+    const std::size_t event = 0;
+    const std::string measurements_directory = "tml_full/ttbar_mu300/";
+
+    // Memory resource used by the EDM.
+    vecmem::host_memory_resource host_mr;
+
+    // Read csv file
+    traccc::io::measurement_reader_output reader_csv(&host_mr);
+    traccc::io::read_measurements(reader_csv, event, measurements_directory,
+                                  traccc::data_format::csv);
+    const traccc::measurement_collection_types::host& measurements_csv =
+        reader_csv.measurements;
+    const traccc::cell_module_collection_types::host& modules_csv =
+        reader_csv.modules;
+
+    // Write mapped file
+    traccc::io::write(
+        event, measurements_directory, traccc::data_format::mapped,
+        vecmem::get_data(measurements_csv), vecmem::get_data(modules_csv));
+
+    {
+        // Map the file, and check the views into it
+        const traccc::io::mapped_measurement_reader_output mapped =
+            traccc::io::read_mapped_measurements(event,
+                                                 measurements_directory);
+        ASSERT_EQ(mapped.measurements.size(), measurements_csv.size());
+        ASSERT_EQ(mapped.modules.size(), modules_csv.size());
+        for (std::size_t i = 0; i < measurements_csv.size(); i++) {
+            ASSERT_EQ(measurements_csv[i], mapped.measurements.ptr()[i]);
+        }
+        for (std::size_t i = 0; i < modules_csv.size(); i++) {
+            ASSERT_EQ(modules_csv[i], mapped.modules.ptr()[i]);
+        }
+    }
+
+    // Delete mapped file
+    std::string io_measurements_file =
+        traccc::io::data_directory() + measurements_directory +
+        traccc::io::get_event_filename(event, "-measurements.map");
+    std::remove(io_measurements_file.c_str());
+
+    ASSERT_TRUE(!std::ifstream(io_measurements_file));
+}
+
+// This checks the zero-copy geometry of a mapped geometry file
+TEST(io_mapped, geometry) {
+
+    // Read the geometry, and make up a barcode map for it
+    auto [surface_transforms, _] =
+        traccc::io::read_geometry("tml_detector/trackml-detector.csv");
+    std::map<std::uint64_t, detray::geometry::barcode> barcode_map;
+    surface_transforms.for_each(
+        [&barcode_map](traccc::geometry_id id, const traccc::transform3&) {
+            const auto index = static_cast<unsigned int>(barcode_map.size());
+            barcode_map[id] =
+                detray::geometry::barcode{}.set_volume(0u).set_index(index);
+        });
+
+    // Write mapped file
+    const std::string io_geometry_file =
+        traccc::io::data_directory() + "tml_detector/trackml-detector.map";
+    traccc::io::write_mapped_geometry(io_geometry_file, surface_transforms,
+                                      &barcode_map);
+
+    {
+        // Map the file, and check the geometry using it
+        const traccc::io::mapped_geometry mapped =
+            traccc::io::read_mapped_geometry(io_geometry_file);
+        ASSERT_EQ(mapped.geom.size(), surface_transforms.size());
+        EXPECT_EQ(mapped.geom.nodes().ptr(),
+                  mapped.file.section<traccc::geometry::node_type>(0).ptr());
+        surface_transforms.for_each([&mapped](traccc::geometry_id id,
+                                              const traccc::transform3& tf) {
+            ASSERT_TRUE(mapped.geom.contains(id));
+            ASSERT_EQ(mapped.geom[id], tf);
+        });
+        ASSERT_NE(mapped.barcode_map, nullptr);
+        EXPECT_EQ(*(mapped.barcode_map), barcode_map);
+    }
+
+    // Delete mapped file
+    std::remove(io_geometry_file.c_str());
+
+    ASSERT_TRUE(!std::ifstream(io_geometry_file));
+}
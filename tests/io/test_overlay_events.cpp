@@ -0,0 +1,95 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Project include(s).
+#include "traccc/io/overlay_events.hpp"
+
+// VecMem include(s).
+#include <vecmem/memory/host_memory_resource.hpp>
+
+// GTest include(s).
+#include <gtest/gtest.h>
+
+using namespace traccc;
+
+namespace {
+
+/// Make a module on a given surface
+cell_module make_module(unsigned int surface) {
+
+    cell_module result;
+    result.surface_link =
+        detray::geometry::barcode{}.set_volume(1u).set_index(surface);
+    return result;
+}
+
+}  // namespace
+
+TEST(overlay_events, cells) {
+
+    vecmem::host_memory_resource mr;
+
+    // Two events, sharing the module on surface 2.
+    io::cell_reader_output event1{&mr}, event2{&mr};
+    event1.modules.push_back(make_module(1u));
+    event1.modules.push_back(make_module(2u));
+    event1.cells.push_back({1u, 1u, 0.5f, 2.f, 0u});
+    event1.cells.push_back({3u, 4u, 0.5f, 2.f, 1u});
+    event2.modules.push_back(make_module(2u));
+    event2.modules.push_back(make_module(3u));
+    event2.cells.push_back({3u, 4u, 0.25f, 1.f, 0u});
+    event2.cells.push_back({2u, 4u, 0.25f, 1.f, 0u});
+    event2.cells.push_back({5u, 5u, 1.f, 3.f, 1u});
+
+    io::cell_reader_output result{&mr};
+    io::overlay_cells(result, {&event1, &event2});
+
+    ASSERT_EQ(result.modules.size(), 3u);
+    EXPECT_EQ(result.modules[0].surface_link.index(), 1u);
+    EXPECT_EQ(result.modules[1].surface_link.index(), 2u);
+    EXPECT_EQ(result.modules[2].surface_link.index(), 3u);
+
+    // The cells on the same channel of the shared module are merged, and the
+    // cells are ordered by module and channel.
+    ASSERT_EQ(result.cells.size(), 4u);
+    EXPECT_EQ(result.cells[0].module_link, 0u);
+    EXPECT_EQ(result.cells[1].module_link, 1u);
+    EXPECT_EQ(result.cells[1].channel0, 2u);
+    EXPECT_EQ(result.cells[2].module_link, 1u);
+    EXPECT_EQ(result.cells[2].channel0, 3u);
+    EXPECT_FLOAT_EQ(result.cells[2].activation, 0.75f);
+    EXPECT_FLOAT_EQ(result.cells[2].time, 1.f);
+    EXPECT_EQ(result.cells[3].module_link, 2u);
+}
+
+TEST(overlay_events, measurements) {
+
+    vecmem::host_memory_resource mr;
+
+    io::measurement_reader_output event1{&mr}, event2{&mr};
+    event1.modules.push_back(make_module(1u));
+    event1.measurements.push_back({});
+    event1.measurements.back().module_link = 0u;
+    event2.modules.push_back(make_module(2u));
+    event2.modules.push_back(make_module(1u));
+    event2.measurements.push_back({});
+    event2.measurements.back().module_link = 1u;
+    event2.measurements.push_back({});
+    event2.measurements.back().module_link = 0u;
+
+    io::measurement_reader_output result{&mr};
+    io::overlay_measurements(result, {&event1, &event2});
+
+    ASSERT_EQ(result.modules.size(), 2u);
+    ASSERT_EQ(result.measurements.size(), 3u);
+    EXPECT_EQ(result.measurements[0].module_link, 0u);
+    EXPECT_EQ(result.measurements[1].module_link, 0u);
+    EXPECT_EQ(result.measurements[2].module_link, 1u);
+    for (std::size_t i = 0; i < result.measurements.size(); ++i) {
+        EXPECT_EQ(result.measurements[i].measurement_id, i);
+    }
+}
@@ -0,0 +1,90 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Project include(s).
+#include "traccc/io/read_digitization_config.hpp"
+#include "traccc/io/read_geometry.hpp"
+
+// GTest include(s).
+#include <gtest/gtest.h>
+
+// System include(s).
+#include <filesystem>
+#include <string>
+
+// This checks that a cached geometry is the same as the original one
+TEST(io_snapshot_cache, geometry) {
+
+    // Directory used for the snapshots of the test
+    const std::string cache_directory =
+        (std::filesystem::temp_directory_path() / "traccc_snapshot_geometry")
+            .string();
+    std::filesystem::remove_all(cache_directory);
+
+    auto [reference, reference_map] =
+        traccc::io::read_geometry("tml_detector/trackml-detector.csv");
+
+    // Read the geometry twice, once writing, and once reading the snapshot.
+    for (int i = 0; i < 2; ++i) {
+        auto [geom, barcode_map] = traccc::io::read_geometry(
+            "tml_detector/trackml-detector.csv", traccc::data_format::csv,
+            cache_directory);
+        EXPECT_EQ(barcode_map, nullptr);
+        ASSERT_EQ(geom.size(), reference.size());
+        reference.for_each([&geom = geom](traccc::geometry_id id,
+                                          const traccc::transform3& tf) {
+            ASSERT_TRUE(geom.contains(id));
+            EXPECT_TRUE(geom[id] == tf);
+        });
+    }
+    EXPECT_FALSE(std::filesystem::is_empty(cache_directory));
+
+    std::filesystem::remove_all(cache_directory);
+}
+
+// This checks that a cached digitization configuration is the same as the
+// original one
+TEST(io_snapshot_cache, digitization_config) {
+
+    // Directory used for the snapshots of the test
+    const std::string cache_directory =
+        (std::filesystem::temp_directory_path() /
+         "traccc_snapshot_digitization")
+            .string();
+    std::filesystem::remove_all(cache_directory);
+
+    const traccc::digitization_config reference =
+        traccc::io::read_digitization_config(
+            "tml_detector/default-geometric-config-generic.json");
+
+    // Read the configuration twice, once writing, and once reading the
+    // snapshot.
+    for (int i = 0; i < 2; ++i) {
+        const traccc::digitization_config digi_cfg =
+            traccc::io::read_digitization_config(
+                "tml_detector/default-geometric-config-generic.json",
+                traccc::data_format::json, cache_directory);
+        ASSERT_EQ(digi_cfg.size(), reference.size());
+        for (std::size_t j = 0; j < reference.size(); ++j) {
+            EXPECT_EQ(digi_cfg.idAt(j), reference.idAt(j));
+            const auto& ref_binning =
+                reference.valueAt(j).segmentation.binningData();
+            const auto& binning =
+                digi_cfg.valueAt(j).segmentation.binningData();
+            ASSERT_EQ(binning.size(), ref_binning.size());
+            for (std::size_t k = 0; k < ref_binning.size(); ++k) {
+                EXPECT_EQ(binning[k].bins(), ref_binning[k].bins());
+                EXPECT_EQ(binning[k].min, ref_binning[k].min);
+                EXPECT_EQ(binning[k].max, ref_binning[k].max);
+                EXPECT_EQ(binning[k].step, ref_binning[k].step);
+            }
+        }
+    }
+    EXPECT_FALSE(std::filesystem::is_empty(cache_directory));
+
+    std::filesystem::remove_all(cache_directory);
+}